@@ -18,17 +18,28 @@
 
 #include "unicode/utypes.h"
 #include "unicode/uniset.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
 #include "cmemory.h"
 #include "bmpset.h"
 #include "uassert.h"
+#include "usimd.h"
 
 U_NAMESPACE_BEGIN
 
+/*
+ * Minimum number of supplementary inversion list entries for building suppTrie.
+ * With fewer, the binary search takes only a few steps.
+ */
+static const int32_t SUPP_TRIE_MIN_LIST_LENGTH=32;
+
 BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
-        list(parentList), listLength(parentListLength) {
+        list(parentList), listLength(parentListLength),
+        suppTrie(NULL), suppTrieMemory(NULL) {
     uprv_memset(latin1Contains, 0, sizeof(latin1Contains));
+    uprv_memset(asciiBits, 0, sizeof(asciiBits));
     uprv_memset(table7FF, 0, sizeof(table7FF));
     uprv_memset(bmpBlockBits, 0, sizeof(bmpBlockBits));
 
@@ -49,18 +60,39 @@ BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
 
     initBits();
     overrideIllegal();
+    initSuppTrie();
 }
 
 BMPSet::BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength) :
         containsFFFD(otherBMPSet.containsFFFD),
-        list(newParentList), listLength(newParentListLength) {
+        list(newParentList), listLength(newParentListLength),
+        suppTrie(NULL), suppTrieMemory(NULL) {
     uprv_memcpy(latin1Contains, otherBMPSet.latin1Contains, sizeof(latin1Contains));
+    uprv_memcpy(asciiBits, otherBMPSet.asciiBits, sizeof(asciiBits));
     uprv_memcpy(table7FF, otherBMPSet.table7FF, sizeof(table7FF));
     uprv_memcpy(bmpBlockBits, otherBMPSet.bmpBlockBits, sizeof(bmpBlockBits));
     uprv_memcpy(list4kStarts, otherBMPSet.list4kStarts, sizeof(list4kStarts));
+    if(otherBMPSet.suppTrie!=NULL) {
+        // Copy the serialized trie rather than building it again.
+        // Without the trie, lookups fall back to binary search.
+        UErrorCode errorCode=U_ZERO_ERROR;
+        int32_t length=ucptrie_toBinary(otherBMPSet.suppTrie, NULL, 0, &errorCode);
+        if(errorCode==U_BUFFER_OVERFLOW_ERROR &&
+                (suppTrieMemory=uprv_malloc(length))!=NULL) {
+            errorCode=U_ZERO_ERROR;
+            ucptrie_toBinary(otherBMPSet.suppTrie, suppTrieMemory, length, &errorCode);
+            suppTrie=ucptrie_openFromBinary(UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_8,
+                                            suppTrieMemory, length, NULL, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                suppTrie=NULL;
+            }
+        }
+    }
 }
 
 BMPSet::~BMPSet() {
+    ucptrie_close(suppTrie);
+    uprv_free(suppTrieMemory);
 }
 
 /*
@@ -138,6 +170,13 @@ void BMPSet::initBits() {
         } while(start<limit && start<0x100);
     } while(limit<=0x100);
 
+    // Set asciiBits[].
+    for(start=0; start<0x80; ++start) {
+        if(latin1Contains[start]) {
+            asciiBits[start&0xf]|=(uint8_t)(1<<(start>>4));
+        }
+    }
+
     // Find the first range overlapping with (or after) 80..FF again,
     // to include them in table7FF as well.
     for(listIndex=0;;) {
@@ -218,6 +257,37 @@ void BMPSet::initBits() {
     }
 }
 
+/*
+ * Build a trie for the supplementary part of the set if it has many ranges.
+ * Binary search costs log2(number of ranges) branchy steps; the trie lookup
+ * is a few array accesses.
+ * If building fails, contains() uses the binary search.
+ */
+void BMPSet::initSuppTrie() {
+    int32_t lo=list4kStarts[0x10];
+    if((list4kStarts[0x11]-lo)<SUPP_TRIE_MIN_LIST_LENGTH) {
+        return;
+    }
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UMutableCPTrie *mutableTrie=umutablecptrie_open(0, 0, &errorCode);
+    // A code point c is in the set if findCodePoint(c) is odd.
+    UChar32 start=0x10000;
+    for(int32_t i=lo; i<listLength && U_SUCCESS(errorCode); ++i) {
+        UChar32 limit=list[i];
+        if(i&1) {
+            umutablecptrie_setRange(mutableTrie, start, limit-1, 1, &errorCode);
+        }
+        start=limit;
+    }
+    suppTrie=umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_8,
+                                           &errorCode);
+    umutablecptrie_close(mutableTrie);
+    if(U_FAILURE(errorCode)) {
+        ucptrie_close(suppTrie);
+        suppTrie=NULL;
+    }
+}
+
 /*
  * Override some bits and bytes to the result of contains(FFFD)
  * for faster validity checking at runtime.
@@ -305,9 +375,11 @@ BMPSet::contains(UChar32 c) const {
             // Look up the code point in its 4k block of code points.
             return containsSlow(c, list4kStarts[lead], list4kStarts[lead+1]);
         }
+    } else if((uint32_t)c<=0xffff) {
+        // surrogate code point
+        return containsSlow(c, list4kStarts[0xd], list4kStarts[0xe]);
     } else if((uint32_t)c<=0x10ffff) {
-        // surrogate or supplementary code point
-        return containsSlow(c, list4kStarts[0xd], list4kStarts[0x11]);
+        return containsSupplementary(c);
     } else {
         // Out-of-range code points get FALSE, consistent with long-standing
         // behavior of UnicodeSet::contains(c).
@@ -357,7 +429,7 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
                 }
             } else {
                 // surrogate pair
-                if(!containsSlow(U16_GET_SUPPLEMENTARY(c, c2), list4kStarts[0x10], list4kStarts[0x11])) {
+                if(!containsSupplementary(U16_GET_SUPPLEMENTARY(c, c2))) {
                     break;
                 }
                 ++s;
@@ -397,7 +469,7 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
                 }
             } else {
                 // surrogate pair
-                if(containsSlow(U16_GET_SUPPLEMENTARY(c, c2), list4kStarts[0x10], list4kStarts[0x11])) {
+                if(containsSupplementary(U16_GET_SUPPLEMENTARY(c, c2))) {
                     break;
                 }
                 ++s;
@@ -446,7 +518,7 @@ BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondi
                 }
             } else {
                 // surrogate pair
-                if(!containsSlow(U16_GET_SUPPLEMENTARY(c2, c), list4kStarts[0x10], list4kStarts[0x11])) {
+                if(!containsSupplementary(U16_GET_SUPPLEMENTARY(c2, c))) {
                     break;
                 }
                 --limit;
@@ -489,7 +561,7 @@ BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondi
                 }
             } else {
                 // surrogate pair
-                if(containsSlow(U16_GET_SUPPLEMENTARY(c2, c), list4kStarts[0x10], list4kStarts[0x11])) {
+                if(containsSupplementary(U16_GET_SUPPLEMENTARY(c2, c))) {
                     break;
                 }
                 --limit;
@@ -512,6 +584,14 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
     uint8_t b=*s;
     if(U8_IS_SINGLE(b)) {
         // Initial all-ASCII span.
+#if UPRV_HAVE_SIMD_LOOKUP
+        if(length>=UPRV_SIMD_MIN_LENGTH) {
+            s+=uprv_asciiSpanInSet(s, length, asciiBits, (UBool)(spanCondition!=USET_SPAN_NOT_CONTAINED));
+            if(s==limit || U8_IS_SINGLE(*s)) {
+                return s;
+            }
+        } else
+#endif
         if(spanCondition) {
             do {
                 if(!latin1Contains[b] || ++s==limit) {
@@ -578,6 +658,16 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
         b=*s;
         if(U8_IS_SINGLE(b)) {
             // ASCII
+#if UPRV_HAVE_SIMD_LOOKUP
+            if((limit-s)>=UPRV_SIMD_MIN_LENGTH) {
+                s+=uprv_asciiSpanInSet(s, (int32_t)(limit-s), asciiBits, (UBool)spanCondition);
+                if(s==limit) {
+                    return limit0;
+                } else if(U8_IS_SINGLE(b=*s)) {
+                    return s;
+                }
+            } else
+#endif
             if(spanCondition) {
                 do {
                     if(!latin1Contains[b]) {
@@ -631,7 +721,7 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
                 // Give an illegal sequence the same value as the result of contains(FFFD).
                 UChar32 c=((UChar32)(b-0xf0)<<18)|((UChar32)t1<<12)|(t2<<6)|t3;
                 if( (   (0x10000<=c && c<=0x10ffff) ?
-                            containsSlow(c, list4kStarts[0x10], list4kStarts[0x11]) :
+                            containsSupplementary(c) :
                             containsFFFD
                     ) != spanCondition
                 ) {
@@ -730,7 +820,7 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
                 }
             }
         } else {
-            if(containsSlow(c, list4kStarts[0x10], list4kStarts[0x11]) != spanCondition) {
+            if(containsSupplementary(c) != spanCondition) {
                 return prev+1;
             }
         }
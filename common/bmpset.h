@@ -21,6 +21,7 @@
 
 #include "unicode/utypes.h"
 #include "unicode/uniset.h"
+#include "unicode/ucptrie.h"
 
 U_NAMESPACE_BEGIN
 
@@ -33,7 +34,8 @@ U_NAMESPACE_BEGIN
  * 3-byte characters: Use zero/one/mixed data per 64-block in U+0000..U+FFFF,
  *                    with mixed for illegal ranges.
  * Supplementary characters: Binary search over
- * the supplementary part of the parent set's inversion list.
+ * the supplementary part of the parent set's inversion list,
+ * or with many supplementary ranges a lookup in a small UCPTrie with 0/1 values.
  */
 class BMPSet : public UMemory {
 public:
@@ -74,6 +76,7 @@ class BMPSet : public UMemory {
 private:
     void initBits();
     void overrideIllegal();
+    void initSuppTrie();
 
     /**
      * Same as UnicodeSet::findCodePoint(UChar32 c) const except that the
@@ -96,11 +99,20 @@ class BMPSet : public UMemory {
 
     inline UBool containsSlow(UChar32 c, int32_t lo, int32_t hi) const;
 
+    /* For a supplementary code point c. */
+    inline UBool containsSupplementary(UChar32 c) const;
+
     /*
      * One byte 0 or 1 per Latin-1 character.
      */
     UBool latin1Contains[0x100];
 
+    /*
+     * The ASCII part of latin1Contains[] as a bit table for vectorized lookups:
+     * set.contains(c)==(asciiBits[c&0xf] bit (c>>4)) for c<=0x7f.
+     */
+    uint8_t asciiBits[16];
+
     /* TRUE if contains(U+FFFD). */
     UBool containsFFFD;
 
@@ -153,12 +165,29 @@ class BMPSet : public UMemory {
      */
     const int32_t *list;
     int32_t listLength;
+
+    /*
+     * NULL unless the set has at least SUPP_TRIE_MIN_LIST_LENGTH
+     * supplementary inversion list entries.
+     * Then it maps each supplementary code point in the set to 1, others to 0,
+     * for constant-time lookups instead of binary searches.
+     * A copied BMPSet has a copy of the trie's binary data in suppTrieMemory.
+     */
+    UCPTrie *suppTrie;
+    void *suppTrieMemory;
 };
 
 inline UBool BMPSet::containsSlow(UChar32 c, int32_t lo, int32_t hi) const {
     return (UBool)(findCodePoint(c, lo, hi) & 1);
 }
 
+inline UBool BMPSet::containsSupplementary(UChar32 c) const {
+    if(suppTrie!=NULL) {
+        return (UBool)UCPTRIE_SMALL_GET(suppTrie, UCPTRIE_8, c);
+    }
+    return containsSlow(c, list4kStarts[0x10], list4kStarts[0x11]);
+}
+
 U_NAMESPACE_END
 
 #endif
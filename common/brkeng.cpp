@@ -265,6 +265,20 @@ ICULanguageBreakFactory::loadDictionaryMatcherFor(UScriptCode script) {
             const UChar *characters = (const UChar *)(data + offset);
             m = new UCharsDictionaryMatcher(characters, file);
         }
+        else if (trieType == DictionaryData::TRIE_TYPE_DOUBLE_ARRAY) {
+            const int32_t *cells = (const int32_t *)(data + offset);
+            const int32_t codeMapOffset = indexes[DictionaryData::IX_RESERVED1_OFFSET];
+            const int32_t cellCount = (codeMapOffset - offset) / 8;
+            UCPTrie *codeMap = ucptrie_openFromBinary(
+                UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_ANY, data + codeMapOffset,
+                indexes[DictionaryData::IX_RESERVED2_OFFSET] - codeMapOffset, NULL, &status);
+            if (U_SUCCESS(status) && codeMap->valueWidth != UCPTRIE_VALUE_BITS_8) {
+                m = new DoubleArrayDictionaryMatcher(cells, cellCount, codeMap, file);
+            }
+            if (m == NULL) {
+                ucptrie_close(codeMap);
+            }
+        }
         if (m == NULL) {
             // no matcher exists to take ownership - either we are an invalid 
             // type or memory allocation failed
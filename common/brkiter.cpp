@@ -31,6 +31,7 @@
 #include "unicode/ustring.h"
 #include "unicode/filteredbrk.h"
 #include "ucln_cmn.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "umutex.h"
 #include "servloc.h"
@@ -39,6 +40,9 @@
 #include "uassert.h"
 #include "ubrkimpl.h"
 #include "charstr.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
+#include "utracimp.h"
 
 // *****************************************************************************
 // class BreakIterator
@@ -366,14 +370,18 @@ BreakIterator::getAvailableLocales(void)
 BreakIterator*
 BreakIterator::createInstance(const Locale& loc, int32_t kind, UErrorCode& status)
 {
+    MemoryTagScope memoryTag(UMEM_TAG_BREAK_ITERATION);
     if (U_FAILURE(status)) {
         return NULL;
     }
+    UTRACE_ENTRY_OC(UTRACE_UBRK_CREATE);
+    UTRACE_DATA2(UTRACE_OPEN_CLOSE, "locale %s kind %d", loc.getName(), kind);
+    BreakIterator *result;
 
 #if !UCONFIG_NO_SERVICE
     if (hasService()) {
         Locale actualLoc("");
-        BreakIterator *result = (BreakIterator*)gService->get(loc, kind, &actualLoc, status);
+        result = (BreakIterator*)gService->get(loc, kind, &actualLoc, status);
         // TODO: The way the service code works in ICU 2.8 is that if
         // there is a real registered break iterator, the actualLoc
         // will be populated, but if the handleDefault path is taken
@@ -388,20 +396,183 @@ BreakIterator::createInstance(const Locale& loc, int32_t kind, UErrorCode& statu
             U_LOCALE_BASED(locBased, *result);
             locBased.setLocaleIDs(actualLoc.getName(), actualLoc.getName());
         }
-        return result;
     }
     else
 #endif
     {
-        return makeInstance(loc, kind, status);
+        result = makeInstance(loc, kind, status);
     }
+    UTRACE_EXIT_PTR_STATUS(result, status);
+    return result;
 }
 
 // -------------------------------------
-enum { kKeyValueLenMax = 32 };
+// One released iterator is kept for reuse, so that callers which need
+// a temporary iterator for each call, such as titlecasing, do not clone
+// a new one each time. Registered iterators are never reused, since
+// registration can change which iterator a locale gets.
+
+static UMutex gReleasedInstanceMutex = U_MUTEX_INITIALIZER;
+static BreakIterator *gReleasedInstance = NULL;
+static int32_t gReleasedInstanceKind = 0;
+static char gReleasedInstanceLocale[ULOC_FULLNAME_CAPACITY];
+
+U_CDECL_BEGIN
+static UBool U_CALLCONV released_breakiterator_cleanup(void) {
+    delete gReleasedInstance;
+    gReleasedInstance = NULL;
+    return TRUE;
+}
+U_CDECL_END
+
+BreakIterator* U_EXPORT2
+BreakIterator::acquireInstance(const Locale& where, UBreakIteratorType kind, UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    BreakIterator *result = NULL;
+#if !UCONFIG_NO_SERVICE
+    if (!hasService())
+#endif
+    {
+        umtx_lock(&gReleasedInstanceMutex);
+        if (gReleasedInstance != NULL && gReleasedInstanceKind == kind &&
+                uprv_strcmp(gReleasedInstanceLocale, where.getName()) == 0) {
+            result = gReleasedInstance;
+            gReleasedInstance = NULL;
+        }
+        umtx_unlock(&gReleasedInstanceMutex);
+    }
+    if (result == NULL) {
+        result = createInstance(where, kind, status);
+    }
+    return result;
+}
+
+void U_EXPORT2
+BreakIterator::releaseInstance(BreakIterator* iter, const Locale& where, UBreakIteratorType kind)
+{
+    if (iter == NULL) {
+        return;
+    }
+    BreakIterator *toDelete = iter;
+    if (
+#if !UCONFIG_NO_SERVICE
+            !hasService() &&
+#endif
+            uprv_strlen(where.getName()) < ULOC_FULLNAME_CAPACITY) {
+        umtx_lock(&gReleasedInstanceMutex);
+        toDelete = gReleasedInstance;
+        gReleasedInstance = iter;
+        gReleasedInstanceKind = kind;
+        uprv_strcpy(gReleasedInstanceLocale, where.getName());
+        ucln_common_registerCleanup(UCLN_COMMON_RELEASED_BREAKITERATOR, released_breakiterator_cleanup);
+        umtx_unlock(&gReleasedInstanceMutex);
+    }
+    delete toDelete;
+}
+
+// -------------------------------------
+// Break iterators made from the ICU data are cloned from prototypes that are
+// cached in the UnifiedCache by locale and kind, so that the resource lookups
+// and the loading of the rules happen once per process rather than once per
+// instance. Clones share the immutable rule data of their prototype.
+// The prototypes themselves are never iterated.
+
+class BreakIteratorPrototype : public SharedObject {
+public:
+    BreakIteratorPrototype(BreakIterator *prototypeToAdopt) : fPrototype(prototypeToAdopt) {}
+    virtual ~BreakIteratorPrototype();
+    const BreakIterator *get() const { return fPrototype; }
+private:
+    BreakIterator *fPrototype;
+
+    BreakIteratorPrototype(const BreakIteratorPrototype &);
+    BreakIteratorPrototype &operator=(const BreakIteratorPrototype &);
+};
+
+BreakIteratorPrototype::~BreakIteratorPrototype() {
+    delete fPrototype;
+}
+
+template<>
+const BreakIteratorPrototype *LocaleCacheKey<BreakIteratorPrototype>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return NULL;
+}
+
+class BreakIteratorCacheKey : public LocaleCacheKey<BreakIteratorPrototype> {
+private:
+    int32_t fKind;
+public:
+    BreakIteratorCacheKey(const Locale &loc, int32_t kind)
+            : LocaleCacheKey<BreakIteratorPrototype>(loc), fKind(kind) {}
+    BreakIteratorCacheKey(const BreakIteratorCacheKey &other)
+            : LocaleCacheKey<BreakIteratorPrototype>(other), fKind(other.fKind) {}
+    virtual ~BreakIteratorCacheKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)LocaleCacheKey<BreakIteratorPrototype>::hashCode() +
+                         (uint32_t)fKind);
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<BreakIteratorPrototype>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        return static_cast<const BreakIteratorCacheKey &>(other).fKind == fKind;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new BreakIteratorCacheKey(*this);
+    }
+    virtual const BreakIteratorPrototype *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        BreakIterator *prototype = BreakIterator::makeUncachedInstance(fLoc, fKind, status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        BreakIteratorPrototype *result = new BreakIteratorPrototype(prototype);
+        if (result == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            delete prototype;
+            return NULL;
+        }
+        result->addRef();
+        return result;
+    }
+};
+
+BreakIteratorCacheKey::~BreakIteratorCacheKey() {}
 
 BreakIterator*
 BreakIterator::makeInstance(const Locale& loc, int32_t kind, UErrorCode& status)
+{
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const BreakIteratorPrototype *shared = NULL;
+    cache->get(BreakIteratorCacheKey(loc, kind), shared, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    BreakIterator *result = shared->get()->clone();
+    shared->removeRef();
+    if (result == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return result;
+}
+
+// -------------------------------------
+enum { kKeyValueLenMax = 32 };
+
+BreakIterator*
+BreakIterator::makeUncachedInstance(const Locale& loc, int32_t kind, UErrorCode& status)
 {
 
     if (U_FAILURE(status)) {
@@ -206,7 +206,7 @@ BytesTrie::next(int32_t inByte) {
 }
 
 UStringTrieResult
-BytesTrie::next(const char *s, size_t sLength) {
+BytesTrie::next(const char *s, int32_t sLength) {
     if(sLength<0 ? *s==0 : sLength==0) {
         // Empty input.
         return current();
@@ -366,7 +366,7 @@ BytesTrieBuilder::BTLinearMatchNode::write(StringTrieBuilder &builder) {
 StringTrieBuilder::Node *
 BytesTrieBuilder::createLinearMatchNode(int32_t i, int32_t byteIndex, int32_t length,
                                         Node *nextNode) const {
-    return new BTLinearMatchNode(
+    return new(*this) BTLinearMatchNode(
             elements[i].getString(*strings).data()+byteIndex,
             length,
             nextNode);
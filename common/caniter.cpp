@@ -21,6 +21,7 @@
 #include "cmemory.h"
 #include "hash.h"
 #include "normalizer2impl.h"
+#include "uvector.h"
 
 /**
  * This class allows one to iterate through all the strings that are canonically equivalent to a given
@@ -73,6 +74,8 @@ CanonicalIterator::CanonicalIterator(const UnicodeString &sourceStr, UErrorCode
     pieces_lengths(NULL),
     current(NULL),
     current_length(0),
+    max_count(INT32_MAX),
+    returned_count(0),
     nfd(*Normalizer2::getNFDInstance(status)),
     nfcImpl(*Normalizer2Factory::getNFCImpl(status))
 {
@@ -81,6 +84,26 @@ CanonicalIterator::CanonicalIterator(const UnicodeString &sourceStr, UErrorCode
     }
 }
 
+/**
+ *@param source string to get results for
+ *@param maxCount the maximum number of strings to return
+ */
+CanonicalIterator::CanonicalIterator(const UnicodeString &sourceStr, int32_t maxCount, UErrorCode &status) :
+    pieces(NULL),
+    pieces_length(0),
+    pieces_lengths(NULL),
+    current(NULL),
+    current_length(0),
+    max_count(INT32_MAX),
+    returned_count(0),
+    nfd(*Normalizer2::getNFDInstance(status)),
+    nfcImpl(*Normalizer2Factory::getNFCImpl(status))
+{
+    if(U_SUCCESS(status) && nfcImpl.ensureCanonIterData(status)) {
+      setSource(sourceStr, maxCount, status);
+    }
+}
+
 CanonicalIterator::~CanonicalIterator() {
   cleanPieces();
 }
@@ -120,6 +143,7 @@ UnicodeString CanonicalIterator::getSource() {
  */
 void CanonicalIterator::reset() {
     done = FALSE;
+    returned_count = 0;
     for (int i = 0; i < current_length; ++i) {
         current[i] = 0;
     }
@@ -149,6 +173,10 @@ UnicodeString CanonicalIterator::next() {
 
     // find next value for next time
 
+    if (++returned_count >= max_count) {
+        done = TRUE;
+        return buffer;
+    }
     for (i = current_length - 1; ; --i) {
         if (i < 0) {
             done = TRUE;
@@ -166,17 +194,33 @@ UnicodeString CanonicalIterator::next() {
  * while changing the source string, saving object creation.
  */
 void CanonicalIterator::setSource(const UnicodeString &newSource, UErrorCode &status) {
+    setSource(newSource, INT32_MAX, status);
+}
+
+/**
+ *@param set the source string to iterate against, and the maximum number of strings to return.
+ */
+void CanonicalIterator::setSource(const UnicodeString &newSource, int32_t maxCount, UErrorCode &status) {
     int32_t list_length = 0;
     UChar32 cp = 0;
     int32_t start = 0;
     int32_t i = 0;
     UnicodeString *list = NULL;
 
+    if(U_FAILURE(status)) {
+      return;
+    }
+    if(maxCount <= 0) {
+      status = U_ILLEGAL_ARGUMENT_ERROR;
+      return;
+    }
     nfd.normalize(newSource, source, status);
     if(U_FAILURE(status)) {
       return;
     }
     done = FALSE;
+    max_count = maxCount;
+    returned_count = 0;
 
     cleanPieces();
 
@@ -240,12 +284,33 @@ void CanonicalIterator::setSource(const UnicodeString &newSource, UErrorCode &st
 
     for (i = 0; i < current_length; i++) {
         current[i] = 0;
+        pieces[i] = NULL;
     }
     // for each segment, get all the combinations that can produce 
     // it after NFD normalization
-    for (i = 0; i < pieces_length; ++i) {
-        //if (PROGRESS) printf("SEGMENT\n");
-        pieces[i] = getEquivalents(list[i], pieces_lengths[i], status);
+    {
+        // Repeated segments, for example of the same accented letter, are computed once.
+        Hashtable segmentIndexes(status);
+        for (i = 0; i < pieces_length && U_SUCCESS(status); ++i) {
+            //if (PROGRESS) printf("SEGMENT\n");
+            int32_t j = segmentIndexes.geti(list[i]) - 1;
+            if (j >= 0) {
+                pieces_lengths[i] = pieces_lengths[j];
+                pieces[i] = new UnicodeString[pieces_lengths[j]];
+                if (pieces[i] == NULL) {
+                    status = U_MEMORY_ALLOCATION_ERROR;
+                    break;
+                }
+                for (int32_t k = 0; k < pieces_lengths[j]; ++k) {
+                    pieces[i][k] = pieces[j][k];
+                }
+            } else {
+                pieces[i] = getEquivalents(list[i], pieces_lengths[i], status);
+                if (pieces[i] != NULL) {
+                    segmentIndexes.puti(list[i], i + 1, status);
+                }
+            }
+        }
     }
 
     delete[] list;
@@ -340,61 +405,323 @@ void U_EXPORT2 CanonicalIterator::permute(UnicodeString &source, UBool skipZeros
 
 // privates
 
+namespace {
+
+/**
+ * Generates the permutations of the characters of a string whose NFD form is a given segment,
+ * in the same way as CanonicalIterator::permute() with skipZeros, followed by the NFD check.
+ * Rather than building every permutation and then normalizing it, each prefix is checked
+ * as it grows: NFD does not reorder characters across a starter or among characters of
+ * the same combining class, so each character of a decomposition must be the next one
+ * of its combining class in the segment, after the same starters.
+ * Identical characters are used in their string order, which yields the same strings.
+ * For the same reason, an item is skipped when one that differs only in the order
+ * of the characters between two of class zero has already been permuted.
+ * This makes long runs of combining marks tractable, as long as the number of
+ * actual results is moderate, and the count can be bounded.
+ */
+class CanonicalPermuter : public UMemory {
+public:
+    CanonicalPermuter(const Normalizer2 &nfd, const UnicodeString &segment,
+                      UVector &results, Hashtable &resultSet, int32_t maxCount,
+                      UErrorCode &errorCode);
+
+    /**
+     * Adds the permutations of item that are canonically equivalent to the segment
+     * and not yet in the result set.
+     * @return FALSE if the maximum number of results has been reached
+     */
+    UBool addPermutations(const UnicodeString &item, UErrorCode &errorCode);
+
+private:
+    UBool permute(int32_t depth, UErrorCode &errorCode);
+    UBool append(int32_t index);
+    void unappend(int32_t index, int32_t count);
+
+    const Normalizer2 &nfd;
+    const UnicodeString &segment;
+    UVector &results;
+    Hashtable &resultSet;
+    int32_t maxCount;
+
+    // The segment: its code points and combining classes, how many starters precede each,
+    // and the code point indexes grouped by combining class, in string order.
+    int32_t segmentLength;
+    MaybeStackArray<UChar32, 32> segmentCps;
+    MaybeStackArray<uint8_t, 32> segmentCcs;
+    MaybeStackArray<int32_t, 32> segmentStarters;
+    MaybeStackArray<int32_t, 32> classIndexes;
+    int32_t classStart[257];
+
+    // Matching state: the number of characters of each combining class,
+    // of starters, and of all characters that the prefix decomposes to.
+    int32_t classCount[256];
+    int32_t starterCount;
+    int32_t decompCount;
+
+    // The current item: its code points and combining classes,
+    // the previous identical code point, and the NFD of each code point
+    // at itemDecompStart[i]..itemDecompStart[i+1]-1 of decompCps/decompCcs.
+    int32_t itemLength;
+    MaybeStackArray<UChar32, 32> itemCps;
+    MaybeStackArray<uint8_t, 32> itemCcs;
+    MaybeStackArray<int32_t, 32> itemPrevSame;
+    MaybeStackArray<UBool, 32> itemUsed;
+    MaybeStackArray<int32_t, 33> itemDecompStart;
+    MaybeStackArray<UChar32, 32> decompCps;
+    MaybeStackArray<uint8_t, 32> decompCcs;
+
+    Hashtable itemKeys;
+    UnicodeString prefix;
+    UnicodeString attempt;
+};
+
+CanonicalPermuter::CanonicalPermuter(const Normalizer2 &nfd, const UnicodeString &segment,
+                                     UVector &results, Hashtable &resultSet, int32_t maxCount,
+                                     UErrorCode &errorCode) :
+        nfd(nfd), segment(segment), results(results), resultSet(resultSet), maxCount(maxCount),
+        segmentLength(0), starterCount(0), decompCount(0), itemLength(0), itemKeys(errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    int32_t length = segment.countChar32();
+    if ((length > segmentCps.getCapacity() && segmentCps.resize(length) == NULL) ||
+            (length > segmentCcs.getCapacity() && segmentCcs.resize(length) == NULL) ||
+            (length > segmentStarters.getCapacity() && segmentStarters.resize(length) == NULL) ||
+            (length > classIndexes.getCapacity() && classIndexes.resize(length) == NULL)) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memset(classStart, 0, sizeof(classStart));
+    int32_t starters = 0;
+    UChar32 c;
+    for (int32_t i = 0; i < segment.length(); i += U16_LENGTH(c)) {
+        c = segment.char32At(i);
+        uint8_t cc = u_getCombiningClass(c);
+        segmentCps[segmentLength] = c;
+        segmentCcs[segmentLength] = cc;
+        segmentStarters[segmentLength++] = starters;
+        if (cc == 0) {
+            ++starters;
+        }
+        ++classStart[cc + 1];
+    }
+    for (int32_t cc = 0; cc < 256; ++cc) {
+        classStart[cc + 1] += classStart[cc];
+        classCount[cc] = 0;
+    }
+    for (int32_t i = 0; i < segmentLength; ++i) {
+        uint8_t cc = segmentCcs[i];
+        classIndexes[classStart[cc] + classCount[cc]++] = i;
+    }
+    uprv_memset(classCount, 0, sizeof(classCount));
+}
+
+UBool CanonicalPermuter::addPermutations(const UnicodeString &item, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return FALSE;
+    }
+    int32_t length = item.countChar32();
+    if ((length > itemCps.getCapacity() && itemCps.resize(length) == NULL) ||
+            (length > itemCcs.getCapacity() && itemCcs.resize(length) == NULL) ||
+            (length > itemPrevSame.getCapacity() && itemPrevSame.resize(length) == NULL) ||
+            (length > itemUsed.getCapacity() && itemUsed.resize(length) == NULL) ||
+            (length >= itemDecompStart.getCapacity() && itemDecompStart.resize(length + 1) == NULL)) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return FALSE;
+    }
+    itemLength = 0;
+    int32_t decompLength = 0;
+    UnicodeString decomp;
+    UChar32 c;
+    for (int32_t i = 0; i < item.length(); i += U16_LENGTH(c)) {
+        c = item.char32At(i);
+        itemCps[itemLength] = c;
+        itemCcs[itemLength] = u_getCombiningClass(c);
+        itemUsed[itemLength] = FALSE;
+        itemPrevSame[itemLength] = -1;
+        for (int32_t j = itemLength - 1; j >= 0; --j) {
+            if (itemCps[j] == c) {
+                itemPrevSame[itemLength] = j;
+                break;
+            }
+        }
+        itemDecompStart[itemLength++] = decompLength;
+        nfd.normalize(UnicodeString(c), decomp, errorCode);
+        if (U_FAILURE(errorCode)) {
+            return FALSE;
+        }
+        UChar32 d;
+        for (int32_t j = 0; j < decomp.length(); j += U16_LENGTH(d)) {
+            d = decomp.char32At(j);
+            if (decompLength >= decompCps.getCapacity() &&
+                    (decompCps.resize(2 * decompLength, decompLength) == NULL ||
+                     decompCcs.resize(2 * decompLength, decompLength) == NULL)) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return FALSE;
+            }
+            decompCps[decompLength] = d;
+            decompCcs[decompLength++] = u_getCombiningClass(d);
+        }
+    }
+    itemDecompStart[itemLength] = decompLength;
+    if (decompLength != segmentLength) {
+        return TRUE;  // not canonically equivalent
+    }
+    // The key is the item with the characters after each one of class zero sorted.
+    UnicodeString key;
+    int32_t runStart = 0;
+    for (int32_t i = 0; i < itemLength; ++i) {
+        if (itemCcs[i] == 0) {
+            key.append(itemCps[i]);
+            runStart = key.length();
+        } else {
+            UChar32 k;
+            int32_t j = runStart;
+            while (j < key.length() && (k = key.char32At(j)) < itemCps[i]) {
+                j += U16_LENGTH(k);
+            }
+            key.insert(j, itemCps[i]);
+        }
+    }
+    if (itemKeys.geti(key) != 0) {
+        return TRUE;
+    }
+    itemKeys.puti(key, 1, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return FALSE;
+    }
+    prefix.remove();
+    return permute(0, errorCode);
+}
+
+UBool CanonicalPermuter::permute(int32_t depth, UErrorCode &errorCode) {
+    if (depth == itemLength) {
+        nfd.normalize(prefix, attempt, errorCode);
+        if (U_FAILURE(errorCode)) {
+            return FALSE;
+        }
+        if (attempt == segment && resultSet.geti(prefix) == 0) {
+            UnicodeString *result = new UnicodeString(prefix);
+            if (result == NULL) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return FALSE;
+            }
+            results.addElement(result, errorCode);
+            if (U_FAILURE(errorCode)) {
+                delete result;
+                return FALSE;
+            }
+            resultSet.puti(prefix, 1, errorCode);
+            if (U_FAILURE(errorCode) || results.size() >= maxCount) {
+                return FALSE;
+            }
+        }
+        return TRUE;
+    }
+    UBool isFirst = TRUE;
+    for (int32_t i = 0; i < itemLength; ++i) {
+        if (itemUsed[i]) {
+            continue;
+        }
+        // As in permute() with skipZeros, a character of class zero stays
+        // in front of the ones that follow it.
+        UBool skip = (itemCcs[i] == 0 && !isFirst) ||
+            (itemPrevSame[i] >= 0 && !itemUsed[itemPrevSame[i]]);
+        isFirst = FALSE;
+        if (skip || !append(i)) {
+            continue;
+        }
+        itemUsed[i] = TRUE;
+        int32_t prefixLength = prefix.length();
+        prefix.append(itemCps[i]);
+        UBool more = permute(depth + 1, errorCode);
+        prefix.truncate(prefixLength);
+        itemUsed[i] = FALSE;
+        unappend(i, itemDecompStart[i + 1] - itemDecompStart[i]);
+        if (!more) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+UBool CanonicalPermuter::append(int32_t index) {
+    int32_t start = itemDecompStart[index];
+    int32_t limit = itemDecompStart[index + 1];
+    for (int32_t j = start; j < limit; ++j) {
+        uint8_t cc = decompCcs[j];
+        int32_t k = classStart[cc] + classCount[cc];
+        int32_t segmentIndex;
+        if (k >= classStart[cc + 1] ||
+                segmentCps[segmentIndex = classIndexes[k]] != decompCps[j] ||
+                (cc == 0 ? decompCount != segmentIndex :
+                           starterCount != segmentStarters[segmentIndex])) {
+            unappend(index, j - start);
+            return FALSE;
+        }
+        ++classCount[cc];
+        ++decompCount;
+        if (cc == 0) {
+            ++starterCount;
+        }
+    }
+    return TRUE;
+}
+
+void CanonicalPermuter::unappend(int32_t index, int32_t count) {
+    int32_t start = itemDecompStart[index];
+    for (int32_t j = start + count - 1; j >= start; --j) {
+        uint8_t cc = decompCcs[j];
+        --classCount[cc];
+        --decompCount;
+        if (cc == 0) {
+            --starterCount;
+        }
+    }
+}
+
+}  // namespace
+
 // we have a segment, in NFD. Find all the strings that are canonically equivalent to it.
+// The segment itself comes first, followed by at most max_count-1 others.
 UnicodeString* CanonicalIterator::getEquivalents(const UnicodeString &segment, int32_t &result_len, UErrorCode &status) {
-    Hashtable result(status);
-    Hashtable permutations(status);
+    UVector result(uprv_deleteUObject, NULL, status);
+    Hashtable resultSet(status);
     Hashtable basic(status);
     if (U_FAILURE(status)) {
         return 0;
     }
-    result.setValueDeleter(uprv_deleteUObject);
-    permutations.setValueDeleter(uprv_deleteUObject);
     basic.setValueDeleter(uprv_deleteUObject);
 
-    UChar USeg[256];
-    int32_t segLen = segment.extract(USeg, 256, status);
-    getEquivalents2(&basic, USeg, segLen, status);
-
-    // now get all the permutations
-    // add only the ones that are canonically equivalent
-    // TODO: optimize by not permuting any class zero.
-
-    const UHashElement *ne = NULL;
-    int32_t el = UHASH_FIRST;
-    //Iterator it = basic.iterator();
-    ne = basic.nextElement(el);
-    //while (it.hasNext())
-    while (ne != NULL) {
-        //String item = (String) it.next();
-        UnicodeString item = *((UnicodeString *)(ne->value.pointer));
-
-        permutations.removeAll();
-        permute(item, CANITER_SKIP_ZEROES, &permutations, status);
-        const UHashElement *ne2 = NULL;
-        int32_t el2 = UHASH_FIRST;
-        //Iterator it2 = permutations.iterator();
-        ne2 = permutations.nextElement(el2);
-        //while (it2.hasNext())
-        while (ne2 != NULL) {
-            //String possible = (String) it2.next();
-            //UnicodeString *possible = new UnicodeString(*((UnicodeString *)(ne2->value.pointer)));
-            UnicodeString possible(*((UnicodeString *)(ne2->value.pointer)));
-            UnicodeString attempt;
-            nfd.normalize(possible, attempt, status);
-
-            // TODO: check if operator == is semanticaly the same as attempt.equals(segment)
-            if (attempt==segment) {
-                //if (PROGRESS) printf("Adding Permutation: %s\n", UToS(Tr(*possible)));
-                // TODO: use the hashtable just to catch duplicates - store strings directly (somehow).
-                result.put(possible, new UnicodeString(possible), status); //add(possible);
-            } else {
-                //if (PROGRESS) printf("-Skipping Permutation: %s\n", UToS(Tr(*possible)));
-            }
+    UnicodeString *first = new UnicodeString(segment);
+    if (first == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    result.addElement(first, status);
+    if (U_FAILURE(status)) {
+        delete first;
+        return NULL;
+    }
+    resultSet.puti(segment, 1, status);
 
-            ne2 = permutations.nextElement(el2);
-        }
+    if (result.size() < max_count) {
+        getEquivalents2(&basic, segment.getBuffer(), segment.length(), status);
+
+        // now get all the permutations
+        // add only the ones that are canonically equivalent
+        CanonicalPermuter permuter(nfd, segment, result, resultSet, max_count, status);
+        const UHashElement *ne = NULL;
+        int32_t el = UHASH_FIRST;
         ne = basic.nextElement(el);
+        while (ne != NULL) {
+            const UnicodeString &item = *((UnicodeString *)(ne->value.pointer));
+            if (!permuter.addPermutations(item, status)) {
+                break;
+            }
+            ne = basic.nextElement(el);
+        }
     }
 
     /* Test for buffer overflows */
@@ -402,30 +729,14 @@ UnicodeString* CanonicalIterator::getEquivalents(const UnicodeString &segment, i
         return 0;
     }
     // convert into a String[] to clean up storage
-    //String[] finalResult = new String[result.size()];
-    UnicodeString *finalResult = NULL;
-    int32_t resultCount;
-    if((resultCount = result.count()) != 0) {
-        finalResult = new UnicodeString[resultCount];
-        if (finalResult == 0) {
-            status = U_MEMORY_ALLOCATION_ERROR;
-            return NULL;
-        }
-    }
-    else {
-        status = U_ILLEGAL_ARGUMENT_ERROR;
+    UnicodeString *finalResult = new UnicodeString[result.size()];
+    if (finalResult == 0) {
+        status = U_MEMORY_ALLOCATION_ERROR;
         return NULL;
     }
-    //result.toArray(finalResult);
-    result_len = 0;
-    el = UHASH_FIRST;
-    ne = result.nextElement(el);
-    while(ne != NULL) {
-        finalResult[result_len++] = *((UnicodeString *)(ne->value.pointer));
-        ne = result.nextElement(el);
+    for (result_len = 0; result_len < result.size(); ++result_len) {
+        finalResult[result_len] = *((UnicodeString *)result.elementAt(result_len));
     }
-
-
     return finalResult;
 }
 
@@ -444,8 +755,10 @@ Hashtable *CanonicalIterator::getEquivalents2(Hashtable *fillinResult, const UCh
     UnicodeSet starts;
 
     // cycle through all the characters
+    // Each of these strings is canonically equivalent to the segment,
+    // so there is no need to find more than max_count of them.
     UChar32 cp;
-    for (int32_t i = 0; i < segLen; i += U16_LENGTH(cp)) {
+    for (int32_t i = 0; i < segLen && fillinResult->count() < max_count; i += U16_LENGTH(cp)) {
         // see if any character is at the start of some decomposition
         U16_GET(segment, 0, i, segLen, cp);
         if (!nfcImpl.getCanonStartSet(cp, starts)) {
@@ -453,7 +766,7 @@ Hashtable *CanonicalIterator::getEquivalents2(Hashtable *fillinResult, const UCh
         }
         // if so, see which decompositions match
         UnicodeSetIterator iter(starts);
-        while (iter.next()) {
+        while (iter.next() && fillinResult->count() < max_count) {
             UChar32 cp2 = iter.getCodepoint();
             Hashtable remainder(status);
             remainder.setValueDeleter(uprv_deleteUObject);
@@ -24,8 +24,13 @@
 #include "cmemory.h"
 #include "putilimp.h"
 #include "uassert.h"
+#include "utracimp.h"
 #include <stdlib.h>
 
+#if U_ENABLE_MEMORY_ACCOUNTING
+#include <atomic>
+#endif
+
 /* uprv_malloc(0) returns a pointer to this read-only data. */
 static const int32_t zeroMem[] = {0, 0, 0, 0, 0, 0};
 
@@ -35,6 +40,96 @@ static UMemAllocFn    *pAlloc;
 static UMemReallocFn  *pRealloc;
 static UMemFreeFn     *pFree;
 
+#if U_ENABLE_MEMORY_SCOPES
+/*
+ * Per-thread stack of memory scopes from u_pushMemoryScope(),
+ * and the nesting level of uprv_suspendMemoryScopes().
+ */
+static thread_local UMemoryScope *gMemoryScopes;
+static thread_local int32_t gMemoryScopesSuspended;
+
+/* Returns the memory scope of this thread that owns the block, or NULL. */
+static inline UMemoryScope *findMemoryScope(const void *buffer) {
+    for (UMemoryScope *scope = gMemoryScopes; scope != NULL; scope = scope->previous) {
+        if ((*scope->containsFn)(scope->context, buffer)) {
+            return scope;
+        }
+    }
+    return NULL;
+}
+#endif
+
+/* Allocation functions without memory scopes or accounting. */
+static inline void *heapAlloc(size_t s) {
+    if (pAlloc) {
+        return (*pAlloc)(pContext, s);
+    } else {
+        return uprv_default_malloc(s);
+    }
+}
+
+static inline void *heapRealloc(void *buffer, size_t size) {
+    if (pRealloc) {
+        return (*pRealloc)(pContext, buffer, size);
+    } else {
+        return uprv_default_realloc(buffer, size);
+    }
+}
+
+static inline void heapFree(void *buffer) {
+    if (pFree) {
+        (*pFree)(pContext, buffer);
+    } else {
+        uprv_default_free(buffer);
+    }
+}
+
+#if U_ENABLE_MEMORY_ACCOUNTING
+/*
+ * Memory accounting for u_getMemoryUsage().
+ * Each heap block starts with a header with its size and UMemoryTag,
+ * so that uprv_free() can subtract it from the right subsystem.
+ * The counters are spread over several cache lines, like the utrace metrics,
+ * so that threads on different cores rarely write to the same one.
+ */
+struct MemoryHeader {
+    size_t size;
+    int32_t tag;
+};
+/* Keeps the alignment of the blocks from the underlying allocator. */
+static const size_t MEMORY_HEADER_SIZE = 16;
+static_assert(sizeof(MemoryHeader) <= MEMORY_HEADER_SIZE, "MemoryHeader too large");
+
+static const int32_t ACCOUNTING_SHARD_COUNT = 16;
+
+struct alignas(64) AccountingShard {
+    std::atomic<int64_t> liveBytes[UMEM_TAG_LIMIT];
+    std::atomic<int64_t> liveBlocks[UMEM_TAG_LIMIT];
+    std::atomic<int64_t> allocations[UMEM_TAG_LIMIT];
+};
+
+static AccountingShard gAccountingShards[ACCOUNTING_SHARD_COUNT];
+static std::atomic<int32_t> gNextAccountingShard(0);
+static thread_local int32_t gAccountingShard = -1;
+static thread_local int32_t gMemoryTag = UMEM_TAG_OTHER;
+
+static void account(int32_t tag, int64_t bytes, int32_t blocks, int32_t allocations) {
+    int32_t shard = gAccountingShard;
+    if (shard < 0) {
+        gAccountingShard = shard =
+            gNextAccountingShard.fetch_add(1, std::memory_order_relaxed) % ACCOUNTING_SHARD_COUNT;
+    }
+    AccountingShard &counters = gAccountingShards[shard];
+    counters.liveBytes[tag].fetch_add(bytes, std::memory_order_relaxed);
+    if (blocks != 0) {
+        counters.liveBlocks[tag].fetch_add(blocks, std::memory_order_relaxed);
+    }
+    if (allocations != 0) {
+        counters.allocations[tag].fetch_add(allocations, std::memory_order_relaxed);
+    }
+}
+#endif
+
 #if U_DEBUG && defined(UPRV_MALLOC_COUNT)
 #include <stdio.h>
 static int n=0;
@@ -52,11 +147,27 @@ uprv_malloc(size_t s) {
 #endif
 #endif
     if (s > 0) {
-        if (pAlloc) {
-            return (*pAlloc)(pContext, s);
-        } else {
-            return uprv_default_malloc(s);
+        UTRACE_METRIC_INC(UTRACE_METRIC_ALLOC_COUNT);
+        UTRACE_METRIC_ADD(UTRACE_METRIC_ALLOC_BYTES, (int64_t)s);
+#if U_ENABLE_MEMORY_SCOPES
+        UMemoryScope *scope = gMemoryScopes;
+        if (scope != NULL && gMemoryScopesSuspended == 0) {
+            return (*scope->allocFn)(scope->context, s);
+        }
+#endif
+#if U_ENABLE_MEMORY_ACCOUNTING
+        char *block = (char *)heapAlloc(s + MEMORY_HEADER_SIZE);
+        if (block == NULL) {
+            return NULL;
         }
+        MemoryHeader *header = (MemoryHeader *)block;
+        header->size = s;
+        header->tag = gMemoryTag;
+        account(header->tag, (int64_t)s, 1, 1);
+        return block + MEMORY_HEADER_SIZE;
+#else
+        return heapAlloc(s);
+#endif
     } else {
         return (void *)zeroMem;
     }
@@ -68,21 +179,40 @@ uprv_realloc(void * buffer, size_t size) {
   putchar('~');
   fflush(stdout);
 #endif
-    if (buffer == zeroMem) {
+    if (buffer == zeroMem
+#if U_ENABLE_MEMORY_ACCOUNTING
+            // A NULL block has no header.
+            || buffer == NULL
+#endif
+            ) {
         return uprv_malloc(size);
     } else if (size == 0) {
-        if (pFree) {
-            (*pFree)(pContext, buffer);
-        } else {
-            uprv_default_free(buffer);
-        }
+        uprv_free(buffer);
         return (void *)zeroMem;
     } else {
-        if (pRealloc) {
-            return (*pRealloc)(pContext, buffer, size);
-        } else {
-            return uprv_default_realloc(buffer, size);
+        UTRACE_METRIC_INC(UTRACE_METRIC_ALLOC_COUNT);
+        UTRACE_METRIC_ADD(UTRACE_METRIC_ALLOC_BYTES, (int64_t)size);
+#if U_ENABLE_MEMORY_SCOPES
+        UMemoryScope *scope = gMemoryScopes != NULL ? findMemoryScope(buffer) : NULL;
+        if (scope != NULL) {
+            return (*scope->reallocFn)(scope->context, buffer, size);
+        }
+#endif
+#if U_ENABLE_MEMORY_ACCOUNTING
+        // The block keeps the tag of its original allocation.
+        char *block = (char *)buffer - MEMORY_HEADER_SIZE;
+        size_t oldSize = ((MemoryHeader *)block)->size;
+        block = (char *)heapRealloc(block, size + MEMORY_HEADER_SIZE);
+        if (block == NULL) {
+            return NULL;
         }
+        MemoryHeader *header = (MemoryHeader *)block;
+        header->size = size;
+        account(header->tag, (int64_t)size - (int64_t)oldSize, 0, 1);
+        return block + MEMORY_HEADER_SIZE;
+#else
+        return heapRealloc(buffer, size);
+#endif
     }
 }
 
@@ -93,11 +223,26 @@ uprv_free(void *buffer) {
   fflush(stdout);
 #endif
     if (buffer != zeroMem) {
-        if (pFree) {
-            (*pFree)(pContext, buffer);
-        } else {
-            uprv_default_free(buffer);
+        if (buffer != NULL) {
+            UTRACE_METRIC_INC(UTRACE_METRIC_FREE_COUNT);
         }
+#if U_ENABLE_MEMORY_SCOPES
+        UMemoryScope *scope = gMemoryScopes != NULL ? findMemoryScope(buffer) : NULL;
+        if (scope != NULL) {
+            (*scope->freeFn)(scope->context, buffer);
+            return;
+        }
+#endif
+#if U_ENABLE_MEMORY_ACCOUNTING
+        if (buffer == NULL) {
+            return;
+        }
+        char *block = (char *)buffer - MEMORY_HEADER_SIZE;
+        const MemoryHeader *header = (const MemoryHeader *)block;
+        account(header->tag, -(int64_t)header->size, -1, 0);
+        buffer = block;
+#endif
+        heapFree(buffer);
     }
 }
 
@@ -128,6 +273,120 @@ u_setMemoryFunctions(const void *context, UMemAllocFn *a, UMemReallocFn *r, UMem
     pFree     = f;
 }
 
+U_CAPI void U_EXPORT2
+u_pushMemoryScope(UMemoryScope *scope, UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (scope==NULL || scope->allocFn==NULL || scope->reallocFn==NULL ||
+            scope->freeFn==NULL || scope->containsFn==NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+#if U_ENABLE_MEMORY_SCOPES
+    scope->previous = gMemoryScopes;
+    gMemoryScopes = scope;
+#else
+    *status = U_UNSUPPORTED_ERROR;
+#endif
+}
+
+U_CAPI void U_EXPORT2
+u_popMemoryScope(UMemoryScope *scope, UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return;
+    }
+#if U_ENABLE_MEMORY_SCOPES
+    if (scope==NULL || scope!=gMemoryScopes) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    gMemoryScopes = scope->previous;
+    scope->previous = NULL;
+#else
+    // No scope can have been pushed.
+    (void)scope;
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+#endif
+}
+
+U_CAPI void U_EXPORT2
+uprv_suspendMemoryScopes() {
+#if U_ENABLE_MEMORY_SCOPES
+    ++gMemoryScopesSuspended;
+#endif
+}
+
+U_CAPI void U_EXPORT2
+uprv_resumeMemoryScopes() {
+#if U_ENABLE_MEMORY_SCOPES
+    U_ASSERT(gMemoryScopesSuspended > 0);
+    --gMemoryScopesSuspended;
+#endif
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_setMemoryTag(int32_t tag) {
+#if U_ENABLE_MEMORY_ACCOUNTING
+    U_ASSERT(0 <= tag && tag < UMEM_TAG_LIMIT);
+    int32_t previous = gMemoryTag;
+    gMemoryTag = tag;
+    return previous;
+#else
+    (void)tag;
+    return UMEM_TAG_OTHER;
+#endif
+}
+
+U_CAPI int32_t U_EXPORT2
+u_getMemoryUsage(UMemoryUsage *usage, int32_t capacity, UErrorCode *status) {
+    if (status == NULL || U_FAILURE(*status)) {
+        return 0;
+    }
+    if (capacity < 0 || (usage == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (capacity > UMEM_TAG_LIMIT) {
+        capacity = UMEM_TAG_LIMIT;
+    }
+    for (int32_t tag = 0; tag < capacity; ++tag) {
+        UMemoryUsage &u = usage[tag];
+        u.liveBytes = u.liveBlocks = u.allocations = 0;
+#if U_ENABLE_MEMORY_ACCOUNTING
+        for (int32_t shard = 0; shard < ACCOUNTING_SHARD_COUNT; ++shard) {
+            const AccountingShard &counters = gAccountingShards[shard];
+            u.liveBytes += counters.liveBytes[tag].load(std::memory_order_relaxed);
+            u.liveBlocks += counters.liveBlocks[tag].load(std::memory_order_relaxed);
+            u.allocations += counters.allocations[tag].load(std::memory_order_relaxed);
+        }
+#endif
+    }
+    return UMEM_TAG_LIMIT;
+}
+
+static const char * const memoryTagNames[] = {
+    "other",
+    "collation",
+    "conversion",
+    "formatting",
+    "resources",
+    "breakIteration",
+    "regex"
+};
+static_assert(UPRV_LENGTHOF(memoryTagNames) == UMEM_TAG_LIMIT, "memoryTagNames");
+
+U_CAPI const char * U_EXPORT2
+u_getMemoryTagName(int32_t tag) {
+    if (0 <= tag && tag < UMEM_TAG_LIMIT) {
+        return memoryTagNames[tag];
+    } else {
+        return "[BOGUS Memory Tag]";
+    }
+}
+
 
 U_CFUNC UBool cmemory_cleanup(void) {
     pContext   = NULL;
@@ -27,6 +27,7 @@
 #define CMEMORY_H
 
 #include "unicode/utypes.h"
+#include "unicode/uclean.h"
 
 #include <stddef.h>
 #include <string.h>
@@ -50,6 +51,7 @@
 #define UPRV_LENGTHOF(array) (int32_t)(sizeof(array)/sizeof((array)[0]))
 #define uprv_memset(buffer, mark, size) U_STANDARD_CPP_NAMESPACE memset(buffer, mark, size)
 #define uprv_memcmp(buffer1, buffer2, size) U_STANDARD_CPP_NAMESPACE memcmp(buffer1, buffer2,size)
+#define uprv_memchr(buffer, c, size) U_STANDARD_CPP_NAMESPACE memchr(buffer, c, size)
 
 U_CAPI void * U_EXPORT2
 uprv_malloc(size_t s) U_MALLOC_ATTR U_ALLOC_SIZE_ATTR(1);
@@ -104,6 +106,29 @@ typedef union {
 U_CFUNC UBool 
 cmemory_cleanup(void);
 
+/**
+ * Makes uprv_malloc() on this thread bypass the memory scopes from
+ * u_pushMemoryScope(), until the matching uprv_resumeMemoryScopes().
+ * Used while creating objects that may outlive the current scope,
+ * such as cached objects. Calls may be nested.
+ */
+U_CAPI void U_EXPORT2
+uprv_suspendMemoryScopes(void);
+
+/**
+ * Ends the uprv_suspendMemoryScopes() period on this thread.
+ */
+U_CAPI void U_EXPORT2
+uprv_resumeMemoryScopes(void);
+
+/**
+ * Sets the UMemoryTag for ICU heap allocations on this thread.
+ * Use the MemoryTagScope class instead of calling this directly.
+ * @return the previous tag
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_setMemoryTag(int32_t tag);
+
 /**
  * A function called by <TT>uhash_remove</TT>,
  * <TT>uhash_close</TT>, or <TT>uhash_put</TT> to delete
@@ -122,8 +147,47 @@ uprv_deleteUObject(void *obj);
 
 #ifdef __cplusplus
 
+#include <utility>
+#include "unicode/uobject.h"
+
 U_NAMESPACE_BEGIN
 
+/**
+ * Suspends the memory scopes of this thread for the lifetime of this object.
+ * Use it where ICU creates objects for its caches.
+ * @see uprv_suspendMemoryScopes
+ */
+class MemoryScopeSuspender {
+public:
+    MemoryScopeSuspender() { uprv_suspendMemoryScopes(); }
+    ~MemoryScopeSuspender() { uprv_resumeMemoryScopes(); }
+private:
+    MemoryScopeSuspender(const MemoryScopeSuspender &) = delete;
+    MemoryScopeSuspender &operator=(const MemoryScopeSuspender &) = delete;
+};
+
+/**
+ * Attributes the ICU heap allocations on this thread to a UMemoryTag
+ * for the lifetime of this object. Put one at the entry points of a subsystem.
+ * Does nothing unless U_ENABLE_MEMORY_ACCOUNTING is set.
+ * @see u_getMemoryUsage
+ */
+class MemoryTagScope {
+public:
+#if U_ENABLE_MEMORY_ACCOUNTING
+    explicit MemoryTagScope(int32_t tag) : previous(uprv_setMemoryTag(tag)) {}
+    ~MemoryTagScope() { uprv_setMemoryTag(previous); }
+#else
+    explicit MemoryTagScope(int32_t /*tag*/) {}
+#endif
+private:
+    MemoryTagScope(const MemoryTagScope &) = delete;
+    MemoryTagScope &operator=(const MemoryTagScope &) = delete;
+#if U_ENABLE_MEMORY_ACCOUNTING
+    int32_t previous;
+#endif
+};
+
 /**
  * "Smart pointer" class, deletes memory via uprv_free().
  * For most methods see the LocalPointerBase base class.
@@ -675,6 +739,150 @@ inline H *MaybeStackHeaderAndArray<H, T, stackCapacity>::orphanOrClone(int32_t l
     return p;
 }
 
+/**
+ * A simple memory management class that creates new heap allocated objects
+ * (of any class that has a public constructor), keeps track of them and
+ * eventually deletes them all in its own destructor.
+ *
+ * A typical use-case would be code like this:
+ *
+ *     MemoryPool<MyType> pool;
+ *
+ *     MyType* o1 = pool.create();
+ *     if (o1 != nullptr) {
+ *         foo(o1);
+ *     }
+ *
+ *     MyType* o2 = pool.create(1, 2, 3);
+ *     if (o2 != nullptr) {
+ *         bar(o2);
+ *     }
+ *
+ *     // MemoryPool will take care of deleting the MyType objects.
+ *
+ * The pointers are kept in a MaybeStackArray, so that small pools
+ * need no heap memory of their own. Unlike UVector, there is no
+ * function-pointer deleter: the element type is known at compile time.
+ */
+template<typename T, int32_t stackCapacity = 8>
+class MemoryPool : public UMemory {
+public:
+    MemoryPool() : count(0), pool() {}
+
+    ~MemoryPool() {
+        for (int32_t i = 0; i < count; ++i) {
+            delete pool[i];
+        }
+    }
+
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    MemoryPool(MemoryPool&& other) U_NOEXCEPT : count(other.count),
+                                                pool(std::move(other.pool)) {
+        other.count = 0;
+    }
+
+    MemoryPool& operator=(MemoryPool&& other) U_NOEXCEPT {
+        // Delete this pool's objects before taking over the other ones.
+        for (int32_t i = 0; i < count; ++i) {
+            delete pool[i];
+        }
+        count = other.count;
+        pool = std::move(other.pool);
+        other.count = 0;
+        return *this;
+    }
+
+    /**
+     * Creates a new object of typename T, by forwarding any and all arguments
+     * to the typename T constructor.
+     *
+     * @param args Arguments to be forwarded to the typename T constructor.
+     * @return A pointer to the newly created object, or nullptr on error.
+     */
+    template<typename... Args>
+    T* create(Args&&... args) {
+        int32_t capacity = pool.getCapacity();
+        if (count == capacity &&
+            pool.resize(capacity == stackCapacity ? 4 * capacity : 2 * capacity,
+                        capacity) == nullptr) {
+            return nullptr;
+        }
+        T *p = new T(std::forward<Args>(args)...);
+        if (p != nullptr) {
+            pool[count++] = p;
+        }
+        return p;
+    }
+
+protected:
+    int32_t count;
+    MaybeStackArray<T*, stackCapacity> pool;
+};
+
+/**
+ * An internal Vector-like implementation based on MemoryPool.
+ *
+ * Heap-allocates each element and stores it in the pool, in the order
+ * of insertion. Element access is inline and does not check the index.
+ * The vector owns its elements and deletes them in its destructor,
+ * or when they are removed.
+ */
+template<typename T, int32_t stackCapacity = 8>
+class MaybeStackVector : protected MemoryPool<T, stackCapacity> {
+public:
+    /**
+     * Creates a new item at the end of the vector, forwarding the arguments
+     * to the typename T constructor.
+     * @return a pointer to the new item, or nullptr on error
+     */
+    template<typename... Args>
+    T* emplaceBack(Args&&... args) {
+        return this->create(std::forward<Args>(args)...);
+    }
+
+    int32_t length() const {
+        return this->count;
+    }
+
+    T** getAlias() {
+        return this->pool.getAlias();
+    }
+
+    /**
+     * Array item access (read-only).
+     * No index bounds check.
+     * @param i array index
+     * @return pointer to the item
+     */
+    const T* operator[](ptrdiff_t i) const {
+        return this->pool[i];
+    }
+
+    /**
+     * Array item access (writable).
+     * No index bounds check.
+     * @param i array index
+     * @return pointer to the item
+     */
+    T* operator[](ptrdiff_t i) {
+        return this->pool[i];
+    }
+
+    /**
+     * Deletes the item at index i and moves the following items down by one.
+     * No index bounds check.
+     * @param i array index
+     */
+    void removeAt(int32_t i) {
+        T** items = this->pool.getAlias();
+        delete items[i];
+        uprv_memmove(items + i, items + i + 1, (size_t)(this->count - i - 1) * sizeof(T*));
+        --this->count;
+    }
+};
+
 U_NAMESPACE_END
 
 #endif  /* __cplusplus */
@@ -0,0 +1,86 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// codepointtrie.cpp
+// created: 2026oct14
+
+#include "unicode/utypes.h"
+#include "unicode/codepointtrie.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
+
+U_NAMESPACE_BEGIN
+
+CodePointTrie *
+CodePointTrie::fromBinary(UCPTrieType type, UCPTrieValueWidth valueWidth,
+                          const void *data, int32_t length, int32_t *pActualLength,
+                          UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    UCPTrie *trie = ucptrie_openFromBinary(type, valueWidth, data, length, pActualLength,
+                                           &errorCode);
+    return adoptUCPTrie(trie, errorCode);
+}
+
+CodePointTrie *
+CodePointTrie::adoptUCPTrie(UCPTrie *adopted, UErrorCode &errorCode) {
+    if (U_SUCCESS(errorCode) && adopted == nullptr) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    if (U_FAILURE(errorCode)) {
+        ucptrie_close(adopted);
+        return nullptr;
+    }
+    CodePointTrie *result = new CodePointTrie(adopted);
+    if (result == nullptr) {
+        ucptrie_close(adopted);
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return result;
+}
+
+CodePointTrie::~CodePointTrie() {
+    ucptrie_close(trie);
+}
+
+MutableCodePointTrie::MutableCodePointTrie(uint32_t initialValue, uint32_t errorValue,
+                                           UErrorCode &errorCode) :
+        trie(umutablecptrie_open(initialValue, errorValue, &errorCode)) {}
+
+MutableCodePointTrie::MutableCodePointTrie(const CodePointTrie &other, UErrorCode &errorCode) :
+        trie(umutablecptrie_fromUCPTrie(other.toUCPTrie(), &errorCode)) {}
+
+MutableCodePointTrie::~MutableCodePointTrie() {
+    umutablecptrie_close(trie);
+}
+
+uint32_t MutableCodePointTrie::get(UChar32 c) const {
+    return trie != nullptr ? umutablecptrie_get(trie, c) : 0;
+}
+
+UChar32 MutableCodePointTrie::getRange(UChar32 start, UCPMapRangeOption option,
+                                       uint32_t surrogateValue, UCPMapValueFilter *filter,
+                                       const void *context, uint32_t *pValue) const {
+    if (trie == nullptr) { return -1; }
+    return umutablecptrie_getRange(trie, start, option, surrogateValue, filter, context, pValue);
+}
+
+void MutableCodePointTrie::set(UChar32 c, uint32_t value, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return; }
+    umutablecptrie_set(trie, c, value, &errorCode);
+}
+
+void MutableCodePointTrie::setRange(UChar32 start, UChar32 end, uint32_t value,
+                                    UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return; }
+    umutablecptrie_setRange(trie, start, end, value, &errorCode);
+}
+
+CodePointTrie *
+MutableCodePointTrie::buildImmutable(UCPTrieType type, UCPTrieValueWidth valueWidth,
+                                     UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    UCPTrie *immutable = umutablecptrie_buildImmutable(trie, type, valueWidth, &errorCode);
+    return CodePointTrie::adoptUCPTrie(immutable, errorCode);
+}
+
+U_NAMESPACE_END
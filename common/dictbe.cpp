@@ -1237,47 +1237,114 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         }
     }
                 
-    // bestSnlp[i] is the snlp of the best segmentation of the first i
-    // code points in the range to be matched.
-    UVector32 bestSnlp(numCodePts + 1, status);
-    bestSnlp.addElement(0, status);
-    for(int32_t i = 1; i <= numCodePts; i++) {
-        bestSnlp.addElement(kuint32max, status);
-    }
-
+    // t_boundary (t for tentative) receives the code point positions of the
+    // optimal segmentation, in ascending order.
+    UVector32 t_boundary(status);
 
-    // prev[i] is the index of the last CJK code point in the previous word in 
-    // the best segmentation of the first i characters.
-    UVector32 prev(numCodePts + 1, status);
-    for(int32_t i = 0; i <= numCodePts; i++){
-        prev.addElement(-1, status);
+    // Add a break for the start of the dictionary range if there is not one
+    // there already.
+    if (foundBreaks.size() == 0 || foundBreaks.peeki() < rangeStart) {
+        t_boundary.addElement(0, status);
     }
+    int32_t startBreaks = t_boundary.size();
+
+    // Dynamic programming to find the best segmentation.
+    //
+    // A position that no candidate word spans is a boundary of every segmentation,
+    // so the text is segmented one such piece at a time: When the loop gets to
+    // a position that ends the longest candidate word seen since the start of
+    // the piece, the best segmentation of the piece is final, its boundaries are
+    // recorded, and the DP buffers are reused for the next piece. The buffers
+    // are the size of the longest piece rather than that of the whole range,
+    // and usually fit on the stack.
+    //
+    // bestSnlp[i - segStart] is the snlp of the best segmentation of the
+    // code points from segStart to i.
+    // prev[i - segStart] is the index of the last CJK code point in the previous
+    // word in that segmentation.
+    // The first segInit entries are initialized.
+    MaybeStackArray<uint32_t, 128> bestSnlp;
+    MaybeStackArray<int32_t, 128> prev;
+    int32_t segStart = 0;
+    int32_t segReach = 0;   // The end of the longest candidate word since segStart.
+    int32_t segInit = 1;
+    bestSnlp[0] = 0;
+    prev[0] = -1;
 
     const int32_t maxWordSize = 20;
-    UVector32 values(numCodePts, status);
-    values.setSize(numCodePts);
-    UVector32 lengths(numCodePts, status);
-    lengths.setSize(numCodePts);
+    // At most one match per length, and the 1-character word added below.
+    int32_t values[maxWordSize + 1];
+    int32_t lengths[maxWordSize + 1];
 
     UText fu = UTEXT_INITIALIZER;
     utext_openUnicodeString(&fu, &inString, &status);
 
-    // Dynamic programming to find the best segmentation.
-
-    // In outer loop, i  is the code point index,
-    //                ix is the corresponding string (code unit) index.
+    // In the loop, i  is the code point index,
+    //              ix is the corresponding string (code unit) index.
     //    They differ when the string contains supplementary characters.
+    UBool isSegmented = TRUE;
     int32_t ix = 0;
     bool is_prev_katakana = false;
-    for (int32_t i = 0;  i < numCodePts;  ++i, ix = inString.moveIndex32(ix, 1)) {
-        if ((uint32_t)bestSnlp.elementAti(i) == kuint32max) {
+    for (int32_t i = 0; ; ++i, ix = inString.moveIndex32(ix, 1)) {
+        if (i > segStart && segReach <= i) {
+            if (segReach < i) {
+                // Position i cannot be reached.
+                isSegmented = FALSE;
+                break;
+            }
+            // No candidate word spans position i. Record the boundaries from
+            // segStart up to i, which come from prev[] in reverse order.
+            int32_t first = t_boundary.size();
+            for (int32_t k = i; k > segStart; k = prev[k - segStart]) {
+                t_boundary.addElement(k, status);
+            }
+            U_ASSERT(U_FAILURE(status) || prev[t_boundary.peeki() - segStart] == segStart);
+            for (int32_t last = t_boundary.size() - 1; first < last; ++first, --last) {
+                int32_t k = t_boundary.elementAti(first);
+                t_boundary.setElementAt(t_boundary.elementAti(last), first);
+                t_boundary.setElementAt(k, last);
+            }
+            // The piece starting at i is segmented independently.
+            segStart = i;
+            segInit = 1;
+            bestSnlp[0] = 0;
+            prev[0] = -1;
+        }
+        if (i == numCodePts) {
+            break;
+        }
+
+        // Make room for the candidate words starting at i.
+        int32_t segLimit = i + maxWordSize;
+        if (segLimit > numCodePts) {
+            segLimit = numCodePts;
+        }
+        int32_t needed = segLimit - segStart + 1;
+        if (needed > bestSnlp.getCapacity()) {
+            int32_t capacity = 2 * bestSnlp.getCapacity();
+            if (capacity < needed) {
+                capacity = needed;
+            }
+            if (bestSnlp.resize(capacity, segInit) == NULL ||
+                    prev.resize(capacity, segInit) == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                break;
+            }
+        }
+        for (; segInit < needed; ++segInit) {
+            bestSnlp[segInit] = kuint32max;
+            prev[segInit] = -1;
+        }
+
+        uint32_t snlp = bestSnlp[i - segStart];
+        if (snlp == kuint32max) {
             continue;
         }
 
         int32_t count;
         utext_setNativeIndex(&fu, ix);
-        count = fDictionary->matches(&fu, maxWordSize, numCodePts,
-                             NULL, lengths.getBuffer(), values.getBuffer(), NULL);
+        count = fDictionary->matches(&fu, maxWordSize, maxWordSize,
+                             NULL, lengths, values, NULL);
                              // Note: lengths is filled with code point lengths
                              //       The NULL parameter is the ignored code unit lengths.
 
@@ -1286,18 +1353,21 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         // with the highest value possible, i.e. the least likely to occur.
         // Exclude Korean characters from this treatment, as they should be left
         // together by default.
-        if ((count == 0 || lengths.elementAti(0) != 1) &&
+        if ((count == 0 || lengths[0] != 1) &&
                 !fHangulWordSet.contains(inString.char32At(ix))) {
-            values.setElementAt(maxSnlp, count);   // 255
-            lengths.setElementAt(1, count++);
+            values[count] = maxSnlp;   // 255
+            lengths[count++] = 1;
         }
 
         for (int32_t j = 0; j < count; j++) {
-            uint32_t newSnlp = (uint32_t)bestSnlp.elementAti(i) + (uint32_t)values.elementAti(j);
-            int32_t ln_j_i = lengths.elementAti(j) + i;
-            if (newSnlp < (uint32_t)bestSnlp.elementAti(ln_j_i)) {
-                bestSnlp.setElementAt(newSnlp, ln_j_i);
-                prev.setElementAt(i, ln_j_i);
+            uint32_t newSnlp = snlp + (uint32_t)values[j];
+            int32_t ln_j_i = lengths[j] + i;
+            if (newSnlp < bestSnlp[ln_j_i - segStart]) {
+                bestSnlp[ln_j_i - segStart] = newSnlp;
+                prev[ln_j_i - segStart] = i;
+            }
+            if (ln_j_i > segReach) {
+                segReach = ln_j_i;
             }
         }
 
@@ -1318,49 +1388,37 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
                 katakanaRunLength++;
             }
             if (katakanaRunLength < kMaxKatakanaGroupLength) {
-                uint32_t newSnlp = bestSnlp.elementAti(i) + getKatakanaCost(katakanaRunLength);
-                if (newSnlp < (uint32_t)bestSnlp.elementAti(i+katakanaRunLength)) {
-                    bestSnlp.setElementAt(newSnlp, i+katakanaRunLength);
-                    prev.setElementAt(i, i+katakanaRunLength);  // prev[j] = i;
+                uint32_t newSnlp = snlp + getKatakanaCost(katakanaRunLength);
+                int32_t runEnd = i + katakanaRunLength;
+                if (newSnlp < bestSnlp[runEnd - segStart]) {
+                    bestSnlp[runEnd - segStart] = newSnlp;
+                    prev[runEnd - segStart] = i;  // prev[j] = i;
+                }
+                if (runEnd > segReach) {
+                    segReach = runEnd;
                 }
             }
         }
         is_prev_katakana = is_katakana;
     }
     utext_close(&fu);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
 
-    // Start pushing the optimal offset index into t_boundary (t for tentative).
-    // prev[numCodePts] is guaranteed to be meaningful.
-    // We'll first push in the reverse order, i.e.,
-    // t_boundary[0] = numCodePts, and afterwards do a swap.
-    UVector32 t_boundary(numCodePts+1, status);
-
-    int32_t numBreaks = 0;
     // No segmentation found, set boundary to end of range
-    if ((uint32_t)bestSnlp.elementAti(numCodePts) == kuint32max) {
+    if (!isSegmented) {
+        t_boundary.setSize(startBreaks);
         t_boundary.addElement(numCodePts, status);
-        numBreaks++;
-    } else {
-        for (int32_t i = numCodePts; i > 0; i = prev.elementAti(i)) {
-            t_boundary.addElement(i, status);
-            numBreaks++;
-        }
-        U_ASSERT(prev.elementAti(t_boundary.elementAti(numBreaks - 1)) == 0);
-    }
-
-    // Add a break for the start of the dictionary range if there is not one
-    // there already.
-    if (foundBreaks.size() == 0 || foundBreaks.peeki() < rangeStart) {
-        t_boundary.addElement(0, status);
-        numBreaks++;
     }
 
     // Now that we're done, convert positions in t_boundary[] (indices in 
     // the normalized input string) back to indices in the original input UText
-    // while reversing t_boundary and pushing values to foundBreaks.
+    // while pushing values to foundBreaks.
+    int32_t numBreaks = t_boundary.size();
     int32_t prevCPPos = -1;
     int32_t prevUTextPos = -1;
-    for (int32_t i = numBreaks-1; i >= 0; i--) {
+    for (int32_t i = 0; i < t_boundary.size(); i++) {
         int32_t cpPos = t_boundary.elementAti(i);
         U_ASSERT(cpPos > prevCPPos);
         int32_t utextPos =  inputMap.isValid() ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
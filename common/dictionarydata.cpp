@@ -23,6 +23,7 @@ U_NAMESPACE_BEGIN
 
 const int32_t  DictionaryData::TRIE_TYPE_BYTES = 0;
 const int32_t  DictionaryData::TRIE_TYPE_UCHARS = 1;
+const int32_t  DictionaryData::TRIE_TYPE_DOUBLE_ARRAY = 2;
 const int32_t  DictionaryData::TRIE_TYPE_MASK = 7;
 const int32_t  DictionaryData::TRIE_HAS_VALUES = 8;
 
@@ -51,9 +52,9 @@ int32_t UCharsDictionaryMatcher::matches(UText *text, int32_t maxLength, int32_t
     int32_t wordCount = 0;
     int32_t codePointsMatched = 0;
 
-    for (UChar32 c = utext_next32(text); c >= 0; c=utext_next32(text)) {
+    for (UChar32 c = UTEXT_NEXT32(text); c >= 0; c = UTEXT_NEXT32(text)) {
         UStringTrieResult result = (codePointsMatched == 0) ? uct.first(c) : uct.next(c);
-        int32_t lengthMatched = (int32_t)utext_getNativeIndex(text) - startingTextIndex;
+        int32_t lengthMatched = (int32_t)UTEXT_GETNATIVEINDEX(text) - startingTextIndex;
         codePointsMatched += 1;
         if (USTRINGTRIE_HAS_VALUE(result)) {
             if (wordCount < limit) {
@@ -118,9 +119,9 @@ int32_t BytesDictionaryMatcher::matches(UText *text, int32_t maxLength, int32_t
     int32_t wordCount = 0;
     int32_t codePointsMatched = 0;
 
-    for (UChar32 c = utext_next32(text); c >= 0; c=utext_next32(text)) {
+    for (UChar32 c = UTEXT_NEXT32(text); c >= 0; c = UTEXT_NEXT32(text)) {
         UStringTrieResult result = (codePointsMatched == 0) ? bt.first(transform(c)) : bt.next(transform(c));
-        int32_t lengthMatched = (int32_t)utext_getNativeIndex(text) - startingTextIndex;
+        int32_t lengthMatched = (int32_t)UTEXT_GETNATIVEINDEX(text) - startingTextIndex;
         codePointsMatched += 1;
         if (USTRINGTRIE_HAS_VALUE(result)) {
             if (wordCount < limit) {
@@ -153,6 +154,61 @@ int32_t BytesDictionaryMatcher::matches(UText *text, int32_t maxLength, int32_t
     return wordCount;
 }
 
+DoubleArrayDictionaryMatcher::~DoubleArrayDictionaryMatcher() {
+    ucptrie_close(codeMap);
+    udata_close(file);
+}
+
+int32_t DoubleArrayDictionaryMatcher::getType() const {
+    return DictionaryData::TRIE_TYPE_DOUBLE_ARRAY;
+}
+
+int32_t DoubleArrayDictionaryMatcher::matches(UText *text, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const {
+    int32_t state = 1;
+    int32_t startingTextIndex = (int32_t)utext_getNativeIndex(text);
+    int32_t wordCount = 0;
+    int32_t codePointsMatched = 0;
+
+    for (UChar32 c = UTEXT_NEXT32(text); c >= 0; c = UTEXT_NEXT32(text)) {
+        int32_t code = getCode(c);
+        int32_t next = cells[2 * state] + code;
+        int32_t lengthMatched = (int32_t)UTEXT_GETNATIVEINDEX(text) - startingTextIndex;
+        codePointsMatched += 1;
+        if (code == 0 || next >= cellCount || cells[2 * next + 1] != state) {
+            break;
+        }
+        state = next;
+        int32_t base = cells[2 * state];
+        UBool isFinal = base < 0;
+        if (isFinal || (base < cellCount && cells[2 * base + 1] == state)) {
+            if (wordCount < limit) {
+                if (values != NULL) {
+                    values[wordCount] = isFinal ? ~base : cells[2 * base];
+                }
+                if (lengths != NULL) {
+                    lengths[wordCount] = lengthMatched;
+                }
+                if (cpLengths != NULL) {
+                    cpLengths[wordCount] = codePointsMatched;
+                }
+                ++wordCount;
+            }
+            if (isFinal) {
+                break;
+            }
+        }
+        if (lengthMatched >= maxLength) {
+            break;
+        }
+    }
+
+    if (prefix != NULL) {
+        *prefix = codePointsMatched;
+    }
+    return wordCount;
+}
 
 U_NAMESPACE_END
 
@@ -223,6 +279,15 @@ udict_swap(const UDataSwapper *ds, const void *inData, int32_t length,
             ds->swapArray16(ds, inBytes + offset, nextOffset - offset, outBytes + offset, pErrorCode);
         } else if (trieType == DictionaryData::TRIE_TYPE_BYTES) {
             // nothing to do
+        } else if (trieType == DictionaryData::TRIE_TYPE_DOUBLE_ARRAY) {
+            ds->swapArray32(ds, inBytes + offset, nextOffset - offset, outBytes + offset, pErrorCode);
+            offset = nextOffset;
+            nextOffset = indexes[DictionaryData::IX_RESERVED2_OFFSET];
+            ucptrie_swap(ds, inBytes + offset, nextOffset - offset, outBytes + offset, pErrorCode);
+            if (U_FAILURE(*pErrorCode)) {
+                udata_printError(ds, "udict_swap(): failed to swap the code map of a double-array trie\n");
+                return 0;
+            }
         } else {
             udata_printError(ds, "udict_swap(): unknown trie type!\n");
             *pErrorCode = U_UNSUPPORTED_ERROR;
@@ -23,6 +23,7 @@
 #include "udataswp.h"
 #include "unicode/uobject.h"
 #include "unicode/ustringtrie.h"
+#include "unicode/ucptrie.h"
 
 U_NAMESPACE_BEGIN
 
@@ -33,6 +34,7 @@ class U_COMMON_API DictionaryData : public UMemory {
 public:
     static const int32_t TRIE_TYPE_BYTES; // = 0;
     static const int32_t TRIE_TYPE_UCHARS; // = 1;
+    static const int32_t TRIE_TYPE_DOUBLE_ARRAY; // = 2;
     static const int32_t TRIE_TYPE_MASK; // = 7;
     static const int32_t TRIE_HAS_VALUES; // = 8;
 
@@ -135,6 +137,32 @@ class U_COMMON_API BytesDictionaryMatcher : public DictionaryMatcher {
     UDataMemory *file;
 };
 
+// Implementation of the DictionaryMatcher interface for a double-array trie dictionary.
+// Each code point takes one transition: a code map lookup and two array accesses.
+class U_COMMON_API DoubleArrayDictionaryMatcher : public DictionaryMatcher {
+public:
+    // constructs a new DoubleArrayDictionaryMatcher.
+    // The UCPTrie * and the UDataMemory * will be closed on this object's destruction.
+    DoubleArrayDictionaryMatcher(const int32_t *c, int32_t count, UCPTrie *m, UDataMemory *f)
+            : cells(c), cellCount(count), codeMap(m), file(f) { }
+    virtual ~DoubleArrayDictionaryMatcher();
+    virtual int32_t matches(UText *text, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const;
+    virtual int32_t getType() const;
+private:
+    int32_t getCode(UChar32 c) const {
+        return codeMap->valueWidth == UCPTRIE_VALUE_BITS_16 ?
+            UCPTRIE_FAST_GET(codeMap, UCPTRIE_16, c) : UCPTRIE_FAST_GET(codeMap, UCPTRIE_32, c);
+    }
+
+    // pairs of (base, check)
+    const int32_t *cells;
+    int32_t cellCount;
+    UCPTrie *codeMap;
+    UDataMemory *file;
+};
+
 U_NAMESPACE_END
 
 U_CAPI int32_t U_EXPORT2
@@ -185,6 +213,21 @@ udict_swap(const UDataSwapper *ds, const void *inData, int32_t length, void *out
  *
  *      The dictionary maps strings to specific values (TRIE_HAS_VALUES bit set in trieType),
  *      or it maps all strings to 0 (TRIE_HAS_VALUES bit not set).
+ *
+ * For TRIE_TYPE_DOUBLE_ARRAY, the string trie part contains
+ * int32_t cells[2*cellCount] instead, and the first reserved part
+ * (from indexes[IX_RESERVED1_OFFSET] to indexes[IX_RESERVED2_OFFSET]) contains
+ * a serialized UCPTrie of type UCPTRIE_TYPE_FAST with 16-bit or 32-bit values.
+ *
+ *      The UCPTrie maps each code point that occurs in the dictionary to a code>=1,
+ *      and all other code points to 0.
+ *      Each cell is a pair of (base, check) values.
+ *      A state is the index of its cell; the start state is 1, and cell 0 is unused.
+ *      For a state s with base>=0, the transition for code point c goes to
+ *      state t=base+code(c) if code(c)!=0 and t<cellCount and check[t]==s.
+ *      If check[base]==s, then the string that leads to s is a word,
+ *      and base[base] is its value.
+ *      A state with base<0 has no transitions; its string is a word with value ~base.
  */
 
 #endif  /* !UCONFIG_NO_BREAK_ITERATION */
@@ -18,6 +18,7 @@
 
 #include "uresimp.h" // ures_getByKeyWithFallback
 #include "ubrkimpl.h" // U_ICUDATA_BRKITR
+#include "unifiedcache.h"
 #include "uvector.h"
 #include "cmemory.h"
 
@@ -133,19 +134,30 @@ static const int32_t kAddToForward = (1<<1);
 static const UChar   kFULLSTOP = 0x002E; // '.'
 
 /**
- * Shared data for SimpleFilteredSentenceBreakIterator
+ * Shared data for SimpleFilteredSentenceBreakIterator.
+ * Immutable once built; shared by the builder that compiled it, the iterators
+ * it built, and their clones, possibly on several threads.
+ * The iterators match with stack copies of the tries, which alias the same
+ * trie arrays but carry their own matching state.
  */
-class SimpleFilteredSentenceBreakData : public UMemory {
+class SimpleFilteredSentenceBreakData : public SharedObject {
 public:
   SimpleFilteredSentenceBreakData(UCharsTrie *forwards, UCharsTrie *backwards ) 
-      : fForwardsPartialTrie(forwards), fBackwardsTrie(backwards), refcount(1) { }
-  SimpleFilteredSentenceBreakData *incr() { refcount++;  return this; }
-  SimpleFilteredSentenceBreakData *decr() { if((--refcount) <= 0) delete this; return 0; }
+      : fForwardsPartialTrie(forwards), fBackwardsTrie(backwards) { }
   virtual ~SimpleFilteredSentenceBreakData();
 
+  /**
+   * Compile the set of exceptions into tries.
+   * @return new data with a reference count of zero, or NULL on failure
+   */
+  static SimpleFilteredSentenceBreakData *compile(const UStringSet &exceptions, UErrorCode &status);
+
   LocalPointer<UCharsTrie>    fForwardsPartialTrie; //  Has ".a" for "a.M."
   LocalPointer<UCharsTrie>    fBackwardsTrie; //  i.e. ".srM" for Mrs.
-  int32_t                     refcount;
+
+private:
+  SimpleFilteredSentenceBreakData(const SimpleFilteredSentenceBreakData &);
+  SimpleFilteredSentenceBreakData &operator=(const SimpleFilteredSentenceBreakData &);
 };
 
 SimpleFilteredSentenceBreakData::~SimpleFilteredSentenceBreakData() {}
@@ -155,12 +167,13 @@ SimpleFilteredSentenceBreakData::~SimpleFilteredSentenceBreakData() {}
  */
 class SimpleFilteredSentenceBreakIterator : public BreakIterator {
 public:
-  SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UErrorCode &status);
+  SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, const SimpleFilteredSentenceBreakData *data, UErrorCode &status);
   SimpleFilteredSentenceBreakIterator(const SimpleFilteredSentenceBreakIterator& other);
   virtual ~SimpleFilteredSentenceBreakIterator();
 private:
-  SimpleFilteredSentenceBreakData *fData;
+  const SimpleFilteredSentenceBreakData *fData;
   LocalPointer<BreakIterator> fDelegate;
+  /** Shallow clone of the delegate's text; NULL until needed and after the text changes. */
   LocalUTextPointer           fText;
 
   /* -- subclass interface -- */
@@ -178,10 +191,10 @@ class SimpleFilteredSentenceBreakIterator : public BreakIterator {
   virtual UBool operator==(const BreakIterator& o) const { if(this==&o) return true; return false; }
 
   /* -- text modifying -- */
-  virtual void setText(UText *text, UErrorCode &status) { fDelegate->setText(text,status); }
-  virtual BreakIterator &refreshInputText(UText *input, UErrorCode &status) { fDelegate->refreshInputText(input,status); return *this; }
-  virtual void adoptText(CharacterIterator* it) { fDelegate->adoptText(it); }
-  virtual void setText(const UnicodeString &text) { fDelegate->setText(text); }
+  virtual void setText(UText *text, UErrorCode &status) { fText.adoptInstead(NULL); fDelegate->setText(text,status); }
+  virtual BreakIterator &refreshInputText(UText *input, UErrorCode &status) { fText.adoptInstead(NULL); fDelegate->refreshInputText(input,status); return *this; }
+  virtual void adoptText(CharacterIterator* it) { fText.adoptInstead(NULL); fDelegate->adoptText(it); }
+  virtual void setText(const UnicodeString &text) { fText.adoptInstead(NULL); fDelegate->setText(text); }
 
   /* -- other functions that are just delegated -- */
   virtual UText *getUText(UText *fillIn, UErrorCode &status) const { return fDelegate->getUText(fillIn,status); }
@@ -218,7 +231,8 @@ class SimpleFilteredSentenceBreakIterator : public BreakIterator {
     /**
      * set up the UText with the value of the fDelegate.
      * Call this before calling breakExceptionAt. 
-     * May be able to avoid excess calls
+     * Only clones the delegate's text after it changed, so that
+     * the UText keeps its chunk from one boundary to the next.
      */
     void resetState(UErrorCode &status);
     /**
@@ -234,95 +248,82 @@ class SimpleFilteredSentenceBreakIterator : public BreakIterator {
 };
 
 SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(const SimpleFilteredSentenceBreakIterator& other)
-  : BreakIterator(other), fData(other.fData->incr()), fDelegate(other.fDelegate->clone())
+  : BreakIterator(other), fData(other.fData), fDelegate(other.fDelegate->clone())
 {
+  fData->addRef();
 }
 
 
-SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UErrorCode &status) :
+SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, const SimpleFilteredSentenceBreakData *data, UErrorCode &status) :
   BreakIterator(adopt->getLocale(ULOC_VALID_LOCALE,status),adopt->getLocale(ULOC_ACTUAL_LOCALE,status)),
-  fData(new SimpleFilteredSentenceBreakData(forwards, backwards)),
+  fData(data),
   fDelegate(adopt)
 {
-  // all set..
+  fData->addRef();
 }
 
 SimpleFilteredSentenceBreakIterator::~SimpleFilteredSentenceBreakIterator() {
-    fData = fData->decr();
+    SharedObject::clearPtr(fData);
 }
 
 void SimpleFilteredSentenceBreakIterator::resetState(UErrorCode &status) {
-  fText.adoptInstead(fDelegate->getUText(fText.orphan(), status));
+  if(fText.isNull()) {
+    fText.adoptInstead(fDelegate->getUText(NULL, status));
+  }
 }
 
 SimpleFilteredSentenceBreakIterator::EFBMatchResult
 SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
     int64_t bestPosn = -1;
     int32_t bestValue = -1;
+    // The UText macros step within the current chunk inline, and the tries
+    // are stack copies because fData is shared with other iterators.
+    UText *text = fText.getAlias();
+    UCharsTrie backwardsTrie(*fData->fBackwardsTrie);
     // loops while 'n' points to an exception.
-    utext_setNativeIndex(fText.getAlias(), n); // from n..
-    fData->fBackwardsTrie->reset();
+    UTEXT_SETNATIVEINDEX(text, n); // from n..
     UChar32 uch;
 
-    //if(debug2) u_printf(" n@ %d\n", n);
     // Assume a space is following the '.'  (so we handle the case:  "Mr. /Brown")
-    if((uch=utext_previous32(fText.getAlias()))==(UChar32)0x0020) {  // TODO: skip a class of chars here??
+    if((uch=UTEXT_PREVIOUS32(text))==(UChar32)0x0020) {  // TODO: skip a class of chars here??
       // TODO only do this the 1st time?
-      //if(debug2) u_printf("skipping prev: |%C| \n", (UChar)uch);
     } else {
-      //if(debug2) u_printf("not skipping prev: |%C| \n", (UChar)uch);
-      uch = utext_next32(fText.getAlias());
-      //if(debug2) u_printf(" -> : |%C| \n", (UChar)uch);
+      uch = UTEXT_NEXT32(text);
     }
 
     UStringTrieResult r = USTRINGTRIE_INTERMEDIATE_VALUE;
 
-    while((uch=utext_previous32(fText.getAlias()))!=U_SENTINEL  &&   // more to consume backwards and..
-          USTRINGTRIE_HAS_NEXT(r=fData->fBackwardsTrie->nextForCodePoint(uch))) {// more in the trie
+    while((uch=UTEXT_PREVIOUS32(text))!=U_SENTINEL  &&   // more to consume backwards and..
+          USTRINGTRIE_HAS_NEXT(r=backwardsTrie.nextForCodePoint(uch))) {// more in the trie
       if(USTRINGTRIE_HAS_VALUE(r)) { // remember the best match so far
-        bestPosn = utext_getNativeIndex(fText.getAlias());
-        bestValue = fData->fBackwardsTrie->getValue();
+        bestPosn = UTEXT_GETNATIVEINDEX(text);
+        bestValue = backwardsTrie.getValue();
       }
-      //if(debug2) u_printf("rev< /%C/ cont?%d @%d\n", (UChar)uch, r, utext_getNativeIndex(fText.getAlias()));
     }
 
     if(USTRINGTRIE_MATCHES(r)) { // exact match?
-      //if(debug2) u_printf("rev<?/%C/?end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
-      bestValue = fData->fBackwardsTrie->getValue();
-      bestPosn = utext_getNativeIndex(fText.getAlias());
-      //if(debug2) u_printf("rev<+/%C/+end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
+      bestValue = backwardsTrie.getValue();
+      bestPosn = UTEXT_GETNATIVEINDEX(text);
     }
 
     if(bestPosn>=0) {
-      //if(debug2) u_printf("rev< /%C/ end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
-
-      //if(USTRINGTRIE_MATCHES(r)) {  // matched - so, now what?
-      //int32_t bestValue = fBackwardsTrie->getValue();
-      ////if(debug2) u_printf("rev< /%C/ matched, skip..%d  bestValue=%d\n", (UChar)uch, r, bestValue);
-
       if(bestValue == kMATCH) { // exact match!
-        //if(debug2) u_printf(" exact backward match\n");
         return kExceptionHere; // See if the next is another exception.
       } else if(bestValue == kPARTIAL
                 && fData->fForwardsPartialTrie.isValid()) { // make sure there's a forward trie
-        //if(debug2) u_printf(" partial backward match\n");
         // We matched the "Ph." in "Ph.D." - now we need to run everything through the forwards trie
         // to see if it matches something going forward.
-        fData->fForwardsPartialTrie->reset();
+        UCharsTrie forwardsPartialTrie(*fData->fForwardsPartialTrie);
         UStringTrieResult rfwd = USTRINGTRIE_INTERMEDIATE_VALUE;
-        utext_setNativeIndex(fText.getAlias(), bestPosn); // hope that's close ..
-        //if(debug2) u_printf("Retrying at %d\n", bestPosn);
-        while((uch=utext_next32(fText.getAlias()))!=U_SENTINEL &&
-              USTRINGTRIE_HAS_NEXT(rfwd=fData->fForwardsPartialTrie->nextForCodePoint(uch))) {
-          //if(debug2) u_printf("fwd> /%C/ cont?%d @%d\n", (UChar)uch, rfwd, utext_getNativeIndex(fText.getAlias()));
+        UTEXT_SETNATIVEINDEX(text, bestPosn); // hope that's close ..
+        while((uch=UTEXT_NEXT32(text))!=U_SENTINEL &&
+              USTRINGTRIE_HAS_NEXT(rfwd=forwardsPartialTrie.nextForCodePoint(uch))) {
         }
         if(USTRINGTRIE_MATCHES(rfwd)) {
-          //if(debug2) u_printf("fwd> /%C/ == forward match!\n", (UChar)uch);
           // only full matches here, nothing to check
           // skip the next:
             return kExceptionHere;
         } else {
-          //if(debug2) u_printf("fwd> /%C/ no match.\n", (UChar)uch);
           // no match (no exception) -return the 'underlying' break
           return kNoExceptionHere;
         }
@@ -330,7 +331,6 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
         return kNoExceptionHere; // internal error and/or no forwards trie
       }
     } else {
-      //if(debug2) u_printf("rev< /%C/ .. no match..%d\n", (UChar)uch, r);  // no best match
       return kNoExceptionHere; // No match - so exit. Not an exception.
     }
 }
@@ -454,33 +454,36 @@ SimpleFilteredSentenceBreakIterator::last(void) {
 
 
 /**
- * Concrete implementation of builder class.
+ * The sentence break exceptions of one locale, and their compiled tries.
+ * Cached in the UnifiedCache, so that the resource data is read and
+ * the tries are built once per locale, not for each builder.
  */
-class U_COMMON_API SimpleFilteredBreakIteratorBuilder : public FilteredBreakIteratorBuilder {
+class SimpleFilteredBreakLocaleData : public SharedObject {
 public:
-  virtual ~SimpleFilteredBreakIteratorBuilder();
-  SimpleFilteredBreakIteratorBuilder(const Locale &fromLocale, UErrorCode &status);
-  SimpleFilteredBreakIteratorBuilder(UErrorCode &status);
-  virtual UBool suppressBreakAfter(const UnicodeString& exception, UErrorCode& status);
-  virtual UBool unsuppressBreakAfter(const UnicodeString& exception, UErrorCode& status);
-  virtual BreakIterator *build(BreakIterator* adoptBreakIterator, UErrorCode& status);
+  SimpleFilteredBreakLocaleData(UErrorCode &status)
+      : fExceptions(status), fCompiled(NULL), fLoadStatus(U_ZERO_ERROR) { }
+  virtual ~SimpleFilteredBreakLocaleData();
+
+  UStringSet fExceptions;
+  const SimpleFilteredSentenceBreakData *fCompiled;
+  /** The status of loading the exceptions; failures and warnings are passed on to each builder. */
+  UErrorCode fLoadStatus;
+
 private:
-  UStringSet fSet;
+  SimpleFilteredBreakLocaleData(const SimpleFilteredBreakLocaleData &);
+  SimpleFilteredBreakLocaleData &operator=(const SimpleFilteredBreakLocaleData &);
 };
 
-SimpleFilteredBreakIteratorBuilder::~SimpleFilteredBreakIteratorBuilder()
-{
-}
-
-SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(UErrorCode &status) 
-  : fSet(status)
-{
+SimpleFilteredBreakLocaleData::~SimpleFilteredBreakLocaleData() {
+  SharedObject::clearPtr(fCompiled);
 }
 
-SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(const Locale &fromLocale, UErrorCode &status)
-  : fSet(status)
-{
-  if(U_SUCCESS(status)) {
+/**
+ * Load the exceptions of the locale into the set.
+ * A missing bundle or exceptions list leaves the set empty and sets status
+ * to the failure or to U_USING_DEFAULT_WARNING.
+ */
+static void loadExceptions(const Locale &fromLocale, UStringSet &set, UErrorCode &status) {
     UErrorCode subStatus = U_ZERO_ERROR;
     LocalUResourceBundlePointer b(ures_open(U_ICUDATA_BRKITR, fromLocale.getBaseName(), &subStatus));
     if (U_FAILURE(subStatus) || (subStatus == U_USING_DEFAULT_WARNING) ) {    
@@ -521,12 +524,90 @@ SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(const Loc
       strs.adoptInstead(ures_getNextResource(breaks.getAlias(), strs.orphan(), &subStatus));
       if(strs.isValid() && U_SUCCESS(subStatus)) {
         UnicodeString str(ures_getUnicodeString(strs.getAlias(), &status));
-        suppressBreakAfter(str, status); // load the string
+        set.add(str, status); // load the string
       }
     } while (strs.isValid() && U_SUCCESS(subStatus));
     if(U_FAILURE(subStatus)&&subStatus!=U_INDEX_OUTOFBOUNDS_ERROR&&U_SUCCESS(status)) {
       status = subStatus;
     }
+}
+
+template<> U_COMMON_API
+const SimpleFilteredBreakLocaleData *LocaleCacheKey<SimpleFilteredBreakLocaleData>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+  LocalPointer<SimpleFilteredBreakLocaleData> result(new SimpleFilteredBreakLocaleData(status), status);
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
+  loadExceptions(fLoc, result->fExceptions, result->fLoadStatus);
+  if(U_SUCCESS(result->fLoadStatus)) {
+    const SimpleFilteredSentenceBreakData *compiled =
+        SimpleFilteredSentenceBreakData::compile(result->fExceptions, status);
+    if(U_FAILURE(status)) {
+      return NULL;
+    }
+    compiled->addRef();
+    result->fCompiled = compiled;
+  }
+  result->addRef();
+  return result.orphan();
+}
+
+/**
+ * Concrete implementation of builder class.
+ */
+class U_COMMON_API SimpleFilteredBreakIteratorBuilder : public FilteredBreakIteratorBuilder {
+public:
+  virtual ~SimpleFilteredBreakIteratorBuilder();
+  SimpleFilteredBreakIteratorBuilder(const Locale &fromLocale, UErrorCode &status);
+  SimpleFilteredBreakIteratorBuilder(UErrorCode &status);
+  virtual UBool suppressBreakAfter(const UnicodeString& exception, UErrorCode& status);
+  virtual UBool unsuppressBreakAfter(const UnicodeString& exception, UErrorCode& status);
+  virtual BreakIterator *build(BreakIterator* adoptBreakIterator, UErrorCode& status);
+private:
+  UStringSet fSet;
+  /** Tries compiled from fSet, shared with the iterators; NULL after fSet changes. */
+  const SimpleFilteredSentenceBreakData *fData;
+};
+
+SimpleFilteredBreakIteratorBuilder::~SimpleFilteredBreakIteratorBuilder()
+{
+  SharedObject::clearPtr(fData);
+}
+
+SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(UErrorCode &status) 
+  : fSet(status), fData(NULL)
+{
+}
+
+SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(const Locale &fromLocale, UErrorCode &status)
+  : fSet(status), fData(NULL)
+{
+  if(U_SUCCESS(status)) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+      return;
+    }
+    const SimpleFilteredBreakLocaleData *localeData = NULL;
+    cache->get(LocaleCacheKey<SimpleFilteredBreakLocaleData>(Locale(fromLocale.getBaseName())),
+               localeData, status);
+    if (U_FAILURE(status)) {
+      return;
+    }
+    if (localeData->fLoadStatus != U_ZERO_ERROR) {
+      status = localeData->fLoadStatus;
+    }
+    // The cached set is sorted, so appending keeps fSet sorted.
+    for (int32_t i = 0; U_SUCCESS(status) && i < localeData->fExceptions.size(); ++i) {
+      LocalPointer<UnicodeString> str(new UnicodeString(*localeData->fExceptions.getStringAt(i)), status);
+      if (U_SUCCESS(status)) {
+        fSet.addElement(str.orphan(), status);
+      }
+    }
+    if (U_SUCCESS(status)) {
+      SharedObject::copyPtr(localeData->fCompiled, fData);
+    }
+    localeData->removeRef();
   }
 }
 
@@ -535,6 +616,9 @@ SimpleFilteredBreakIteratorBuilder::suppressBreakAfter(const UnicodeString& exce
 {
   UBool r = fSet.add(exception, status);
   FB_TRACE("suppressBreakAfter",&exception,r,0);
+  if(r) {
+    SharedObject::clearPtr(fData);
+  }
   return r;
 }
 
@@ -543,6 +627,9 @@ SimpleFilteredBreakIteratorBuilder::unsuppressBreakAfter(const UnicodeString& ex
 {
   UBool r = fSet.remove(exception, status);
   FB_TRACE("unsuppressBreakAfter",&exception,r,0);
+  if(r) {
+    SharedObject::clearPtr(fData);
+  }
   return r;
 }
 
@@ -557,10 +644,11 @@ static inline UnicodeString* newUnicodeStringArray(size_t count) {
     return new UnicodeString[count ? count : 1];
 }
 
-BreakIterator *
-SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UErrorCode& status) {
-  LocalPointer<BreakIterator> adopt(adoptBreakIterator);
-
+SimpleFilteredSentenceBreakData *
+SimpleFilteredSentenceBreakData::compile(const UStringSet &exceptions, UErrorCode &status) {
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
   LocalPointer<UCharsTrieBuilder> builder(new UCharsTrieBuilder(status), status);
   LocalPointer<UCharsTrieBuilder> builder2(new UCharsTrieBuilder(status), status);
   if(U_FAILURE(status)) {
@@ -570,7 +658,7 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
   int32_t revCount = 0;
   int32_t fwdCount = 0;
 
-  int32_t subCount = fSet.size();
+  int32_t subCount = exceptions.size();
 
   UnicodeString *ustrs_ptr = newUnicodeStringArray(subCount);
   
@@ -584,9 +672,9 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
 
   int n=0;
   for ( int32_t i = 0;
-        i<fSet.size();
+        i<exceptions.size();
         i++) {
-    const UnicodeString *abbr = fSet.getStringAt(i);
+    const UnicodeString *abbr = exceptions.getStringAt(i);
     if(abbr) {
       FB_TRACE("build",abbr,TRUE,i);
       ustrs[n] = *abbr; // copy by value
@@ -674,7 +762,39 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
     }
   }
 
-  return new SimpleFilteredSentenceBreakIterator(adopt.orphan(), forwardsPartialTrie.orphan(), backwardsTrie.orphan(), status);
+  SimpleFilteredSentenceBreakData *data =
+      new SimpleFilteredSentenceBreakData(forwardsPartialTrie.getAlias(), backwardsTrie.getAlias());
+  if(data == NULL) {
+    status = U_MEMORY_ALLOCATION_ERROR;
+    return NULL;
+  }
+  forwardsPartialTrie.orphan();
+  backwardsTrie.orphan();
+  return data;
+}
+
+BreakIterator *
+SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UErrorCode& status) {
+  LocalPointer<BreakIterator> adopt(adoptBreakIterator);
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
+  // The tries are compiled once, and shared by all of the iterators
+  // built until the set of exceptions changes.
+  if(fData == NULL) {
+    const SimpleFilteredSentenceBreakData *data = SimpleFilteredSentenceBreakData::compile(fSet, status);
+    if(U_FAILURE(status)) {
+      return NULL;
+    }
+    SharedObject::copyPtr(data, fData);
+  }
+  BreakIterator *result = new SimpleFilteredSentenceBreakIterator(adopt.getAlias(), fData, status);
+  if(result == NULL) {
+    status = U_MEMORY_ALLOCATION_ERROR;
+    return NULL;
+  }
+  adopt.orphan();
+  return result;
 }
 
 
@@ -0,0 +1,726 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// localematcher.cpp
+// created: 2026oct14
+
+#include "unicode/utypes.h"
+#include "unicode/localematcher.h"
+#include "unicode/locid.h"
+#include "unicode/stringpiece.h"
+#include "unicode/uloc.h"
+#include "unicode/ures.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "uassert.h"
+#include "ucln_cmn.h"
+#include "uhash.h"
+#include "umutex.h"
+#include "uresimp.h"
+
+U_NAMESPACE_BEGIN
+
+/** A maximized locale: language, script and region, plus the partitions of its region. */
+struct LSR : public UMemory {
+    char language[ULOC_LANG_CAPACITY];
+    char script[ULOC_SCRIPT_CAPACITY];
+    char region[ULOC_COUNTRY_CAPACITY];
+    /** One bit per match variable that contains the region. */
+    uint32_t regionVariables;
+};
+
+namespace {
+
+/** Distance levels: language, script, region. */
+constexpr int32_t LEVEL_COUNT = 3;
+constexpr int32_t MAX_PATTERN_LENGTH = 16;
+constexpr int32_t MAX_VARIABLES = 32;
+
+/** Distances used when the data has no catch-all rule. */
+constexpr int32_t DEFAULT_DISTANCES[LEVEL_COUNT] = { 80, 50, 4 };
+
+/** Regions are 2 letters or 3 digits: 26*26 + 1000 region indexes. */
+constexpr int32_t REGION_INDEX_LIMIT = 26 * 26 + 1000;
+
+struct SubtagPattern {
+    char value[MAX_PATTERN_LENGTH];
+    /** Index of the match variable ($name or $!name), or -1. */
+    int8_t variable;
+    UBool negated;
+    UBool any;
+};
+
+/**
+ * One rule of supplementalData/languageMatchingNew.
+ * The rule applies at its last level; the higher levels are part of the condition.
+ */
+struct DistanceRule {
+    SubtagPattern desired[LEVEL_COUNT];
+    SubtagPattern supported[LEVEL_COUNT];
+    int32_t distance;
+    UBool oneway;
+    /** TRUE if all subtag patterns are literals, so that gExactRules has the rule. */
+    UBool exact;
+};
+
+struct LocaleDistanceData : public UMemory {
+    LocaleDistanceData() : variableCount(0) {
+        for (int32_t level = 0; level < LEVEL_COUNT; ++level) {
+            rules[level] = nullptr;
+            ruleCounts[level] = 0;
+            exactRules[level] = nullptr;
+        }
+        uprv_memset(regionVariables, 0, sizeof(regionVariables));
+    }
+    ~LocaleDistanceData() {
+        for (int32_t level = 0; level < LEVEL_COUNT; ++level) {
+            uprv_free(rules[level]);
+            uhash_close(exactRules[level]);
+        }
+    }
+
+    /** The rules of each level, in data order. */
+    DistanceRule *rules[LEVEL_COUNT];
+    int32_t ruleCounts[LEVEL_COUNT];
+    /**
+     * Maps "desired|supported" subtags of the exact rules of each level
+     * to 1 + 2 * (rule index) + (1 if the rule applies in reverse).
+     */
+    UHashtable *exactRules[LEVEL_COUNT];
+    /** Names of the match variables, without the '$'. */
+    char variables[MAX_VARIABLES][MAX_PATTERN_LENGTH];
+    int32_t variableCount;
+    /** For each region index, one bit per match variable that contains the region. */
+    uint32_t regionVariables[REGION_INDEX_LIMIT];
+};
+
+LocaleDistanceData *gLocaleDistanceData = nullptr;
+UInitOnce gLocaleDistanceDataInitOnce = U_INITONCE_INITIALIZER;
+
+/**
+ * A supported locale matches only if its distance is below this threshold,
+ * the distance between different scripts of the same language.
+ */
+constexpr int32_t THRESHOLD_DISTANCE = 50;
+
+/**
+ * Each further desired locale is demoted by this distance,
+ * a little more than the distance between two regions.
+ */
+constexpr int32_t DEMOTION_PER_DESIRED_LOCALE = 5;
+
+UBool U_CALLCONV cleanup() {
+    delete gLocaleDistanceData;
+    gLocaleDistanceData = nullptr;
+    gLocaleDistanceDataInitOnce.reset();
+    return TRUE;
+}
+
+int32_t getRegionIndex(const char *region) {
+    if (uprv_isASCIILetter(region[0]) && uprv_isASCIILetter(region[1]) && region[2] == 0) {
+        return (uprv_toupper(region[0]) - 'A') * 26 + (uprv_toupper(region[1]) - 'A');
+    }
+    if ('0' <= region[0] && region[0] <= '9' && '0' <= region[1] && region[1] <= '9' &&
+            '0' <= region[2] && region[2] <= '9' && region[3] == 0) {
+        return 26 * 26 + (region[0] - '0') * 100 + (region[1] - '0') * 10 + (region[2] - '0');
+    }
+    return -1;
+}
+
+void addRegionToVariable(LocaleDistanceData &data, UResourceBundle *containment,
+                         UResourceBundle *groupings, const char *region, uint32_t bit,
+                         int32_t depth, UErrorCode &errorCode);
+
+void addContainedRegionsToVariable(LocaleDistanceData &data, UResourceBundle *containment,
+                                   UResourceBundle *groupings, UResourceBundle *table,
+                                   const char *region, uint32_t bit, int32_t depth,
+                                   UErrorCode &errorCode) {
+    if (table == nullptr) {
+        return;
+    }
+    UErrorCode localErrorCode = U_ZERO_ERROR;
+    LocalUResourceBundlePointer contained(ures_getByKey(table, region, nullptr, &localErrorCode));
+    if (U_FAILURE(localErrorCode)) {
+        return;  // The region does not contain other regions.
+    }
+    int32_t count = ures_getSize(contained.getAlias());
+    for (int32_t i = 0; i < count && U_SUCCESS(errorCode); ++i) {
+        char subRegion[ULOC_COUNTRY_CAPACITY + 1];
+        int32_t length = ULOC_COUNTRY_CAPACITY + 1;
+        ures_getUTF8StringByIndex(contained.getAlias(), i, subRegion, &length, TRUE, &errorCode);
+        if (U_SUCCESS(errorCode)) {
+            addRegionToVariable(data, containment, groupings, subRegion, bit, depth + 1, errorCode);
+        } else if (errorCode == U_BUFFER_OVERFLOW_ERROR) {
+            errorCode = U_ZERO_ERROR;  // Not a region code.
+        }
+    }
+}
+
+/**
+ * Adds the variable bit to the region and to all of the regions that it contains,
+ * including grouping regions like 419 (Latin America) which are not part of the
+ * strict containment hierarchy.
+ */
+void addRegionToVariable(LocaleDistanceData &data, UResourceBundle *containment,
+                         UResourceBundle *groupings, const char *region, uint32_t bit,
+                         int32_t depth, UErrorCode &errorCode) {
+    int32_t regionIndex = getRegionIndex(region);
+    if (regionIndex < 0 || depth > 8) {
+        return;
+    }
+    data.regionVariables[regionIndex] |= bit;
+    addContainedRegionsToVariable(data, containment, groupings, containment,
+                                  region, bit, depth, errorCode);
+    addContainedRegionsToVariable(data, containment, groupings, groupings,
+                                  region, bit, depth, errorCode);
+}
+
+void loadMatchVariables(LocaleDistanceData &data, UResourceBundle *supplementalData,
+                        UErrorCode &errorCode) {
+    LocalUResourceBundlePointer variables(ures_getByKeyWithFallback(
+        supplementalData, "languageMatchingInfo/written/matchVariable", nullptr, &errorCode));
+    LocalUResourceBundlePointer containment(ures_getByKey(
+        supplementalData, "territoryContainment", nullptr, &errorCode));
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    UErrorCode localErrorCode = U_ZERO_ERROR;
+    LocalUResourceBundlePointer groupings(ures_getByKey(
+        containment.getAlias(), "containedGroupings", nullptr, &localErrorCode));
+    if (U_FAILURE(localErrorCode)) {
+        groupings.adoptInstead(nullptr);
+    }
+    int32_t count = ures_getSize(variables.getAlias());
+    if (count > MAX_VARIABLES) {
+        errorCode = U_UNSUPPORTED_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < count && U_SUCCESS(errorCode); ++i) {
+        char value[128];
+        int32_t length = UPRV_LENGTHOF(value);
+        const char *key = nullptr;
+        LocalUResourceBundlePointer variable(ures_getByIndex(variables.getAlias(), i, nullptr, &errorCode));
+        ures_getUTF8String(variable.getAlias(), value, &length, TRUE, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        key = ures_getKey(variable.getAlias());
+        if (uprv_strlen(key) >= MAX_PATTERN_LENGTH) {
+            errorCode = U_UNSUPPORTED_ERROR;
+            return;
+        }
+        uprv_strcpy(data.variables[data.variableCount], key);
+        uint32_t bit = (uint32_t)1 << data.variableCount++;
+        // The value is a '+'-separated list of regions.
+        for (char *region = value; region != nullptr;) {
+            char *next = uprv_strchr(region, '+');
+            if (next != nullptr) {
+                *next++ = 0;
+            }
+            addRegionToVariable(data, containment.getAlias(), groupings.getAlias(),
+                                region, bit, 0, errorCode);
+            region = next;
+        }
+    }
+}
+
+void parsePattern(const LocaleDistanceData &data, const char *s, int32_t length,
+                  int32_t level, SubtagPattern &pattern, UErrorCode &errorCode) {
+    pattern.variable = -1;
+    pattern.negated = FALSE;
+    pattern.any = length == 1 && s[0] == '*';
+    if (length >= MAX_PATTERN_LENGTH) {
+        errorCode = U_UNSUPPORTED_ERROR;
+        return;
+    }
+    uprv_memcpy(pattern.value, s, length);
+    pattern.value[length] = 0;
+    if (length > 1 && s[0] == '$') {
+        if (level != LEVEL_COUNT - 1) {
+            errorCode = U_UNSUPPORTED_ERROR;  // Only regions have match variables.
+            return;
+        }
+        const char *name = pattern.value + 1;
+        if (*name == '!') {
+            pattern.negated = TRUE;
+            ++name;
+        }
+        for (int32_t i = 0; i < data.variableCount; ++i) {
+            if (uprv_strcmp(name, data.variables[i]) == 0) {
+                pattern.variable = (int8_t)i;
+                return;
+            }
+        }
+        errorCode = U_INVALID_FORMAT_ERROR;  // Unknown match variable.
+    }
+}
+
+/**
+ * Parses a rule locale pattern like "en_*_$!enUS" into its subtag patterns.
+ * @return the number of subtags
+ */
+int32_t parseRuleLocale(const LocaleDistanceData &data, const char *s,
+                        SubtagPattern patterns[], UErrorCode &errorCode) {
+    int32_t count = 0;
+    for (;;) {
+        const char *limit = uprv_strchr(s, '_');
+        int32_t length = limit != nullptr ? (int32_t)(limit - s) : (int32_t)uprv_strlen(s);
+        if (count == LEVEL_COUNT) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return 0;
+        }
+        parsePattern(data, s, length, count, patterns[count], errorCode);
+        ++count;
+        if (limit == nullptr || U_FAILURE(errorCode)) {
+            return count;
+        }
+        s = limit + 1;
+    }
+}
+
+/** Appends the subtags of the levels 0..level, separated by '_'. */
+int32_t appendKey(const char *const subtags[], int32_t level, char *key, int32_t length) {
+    for (int32_t i = 0; i <= level; ++i) {
+        if (i > 0) {
+            key[length++] = '_';
+        }
+        int32_t subtagLength = (int32_t)uprv_strlen(subtags[i]);
+        uprv_memcpy(key + length, subtags[i], subtagLength);
+        length += subtagLength;
+    }
+    return length;
+}
+
+/** Key buffer capacity for "desired|supported" with 3 levels each. */
+constexpr int32_t KEY_CAPACITY = 2 * LEVEL_COUNT * MAX_PATTERN_LENGTH + 8;
+
+int32_t makeExactRuleKey(const char *const desired[], const char *const supported[],
+                         int32_t level, char key[]) {
+    int32_t length = appendKey(desired, level, key, 0);
+    key[length++] = '|';
+    length = appendKey(supported, level, key, length);
+    key[length] = 0;
+    return length;
+}
+
+void addExactRule(LocaleDistanceData &data, int32_t level, const SubtagPattern from[],
+                  const SubtagPattern to[], int32_t value, UErrorCode &errorCode) {
+    const char *desired[LEVEL_COUNT];
+    const char *supported[LEVEL_COUNT];
+    for (int32_t i = 0; i <= level; ++i) {
+        desired[i] = from[i].value;
+        supported[i] = to[i].value;
+    }
+    char key[KEY_CAPACITY];
+    int32_t length = makeExactRuleKey(desired, supported, level, key);
+    if (uhash_geti(data.exactRules[level], key) != 0) {
+        return;  // An earlier rule wins.
+    }
+    char *ownedKey = (char *)uprv_malloc(length + 1);
+    if (ownedKey == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memcpy(ownedKey, key, length + 1);
+    uhash_puti(data.exactRules[level], ownedKey, value, &errorCode);
+}
+
+void loadRules(LocaleDistanceData &data, UResourceBundle *supplementalData, UErrorCode &errorCode) {
+    LocalUResourceBundlePointer rules(ures_getByKeyWithFallback(
+        supplementalData, "languageMatchingNew/written", nullptr, &errorCode));
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    int32_t count = ures_getSize(rules.getAlias());
+    for (int32_t level = 0; level < LEVEL_COUNT; ++level) {
+        data.rules[level] = (DistanceRule *)uprv_malloc(count * sizeof(DistanceRule));
+        data.exactRules[level] = uhash_open(uhash_hashChars, uhash_compareChars, nullptr, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        if (data.rules[level] == nullptr) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        uhash_setKeyDeleter(data.exactRules[level], uprv_free);
+    }
+    for (int32_t i = 0; i < count && U_SUCCESS(errorCode); ++i) {
+        LocalUResourceBundlePointer rule(ures_getByIndex(rules.getAlias(), i, nullptr, &errorCode));
+        char strings[4][KEY_CAPACITY];
+        for (int32_t j = 0; j < 4; ++j) {
+            int32_t length = KEY_CAPACITY;
+            ures_getUTF8StringByIndex(rule.getAlias(), j, strings[j], &length, TRUE, &errorCode);
+        }
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        SubtagPattern desired[LEVEL_COUNT];
+        SubtagPattern supported[LEVEL_COUNT];
+        int32_t levels = parseRuleLocale(data, strings[0], desired, errorCode);
+        if (parseRuleLocale(data, strings[1], supported, errorCode) != levels) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+        }
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        int32_t level = levels - 1;
+        int32_t ruleIndex = data.ruleCounts[level]++;
+        DistanceRule &r = data.rules[level][ruleIndex];
+        r.exact = TRUE;
+        for (int32_t j = 0; j < levels; ++j) {
+            r.desired[j] = desired[j];
+            r.supported[j] = supported[j];
+            if (desired[j].any || desired[j].variable >= 0 ||
+                    supported[j].any || supported[j].variable >= 0) {
+                r.exact = FALSE;
+            }
+        }
+        r.distance = (int32_t)uprv_strtol(strings[2], nullptr, 10);
+        r.oneway = uprv_strcmp(strings[3], "1") == 0;
+        if (r.exact) {
+            addExactRule(data, level, desired, supported, 1 + 2 * ruleIndex, errorCode);
+            if (!r.oneway) {
+                addExactRule(data, level, supported, desired, 2 + 2 * ruleIndex, errorCode);
+            }
+        }
+    }
+}
+
+void U_CALLCONV initLocaleDistanceData(UErrorCode &errorCode) {
+    ucln_common_registerCleanup(UCLN_COMMON_LOCALE_MATCHER, cleanup);
+    LocalPointer<LocaleDistanceData> data(new LocaleDistanceData(), errorCode);
+    LocalUResourceBundlePointer supplementalData(ures_openDirect(nullptr, "supplementalData", &errorCode));
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    loadMatchVariables(*data, supplementalData.getAlias(), errorCode);
+    loadRules(*data, supplementalData.getAlias(), errorCode);
+    if (U_SUCCESS(errorCode)) {
+        gLocaleDistanceData = data.orphan();
+    }
+}
+
+UBool matchesPattern(const SubtagPattern &pattern, const char *subtag, uint32_t regionVariables) {
+    if (pattern.any) {
+        return TRUE;
+    }
+    if (pattern.variable >= 0) {
+        UBool inVariable = (regionVariables & ((uint32_t)1 << pattern.variable)) != 0;
+        return inVariable != pattern.negated;
+    }
+    return uprv_strcmp(pattern.value, subtag) == 0;
+}
+
+UBool matchesRule(const SubtagPattern from[], const SubtagPattern to[], int32_t level,
+                  const char *const desired[], const char *const supported[],
+                  const LSR &desiredLSR, const LSR &supportedLSR) {
+    for (int32_t i = 0; i <= level; ++i) {
+        uint32_t desiredVariables = i == LEVEL_COUNT - 1 ? desiredLSR.regionVariables : 0;
+        uint32_t supportedVariables = i == LEVEL_COUNT - 1 ? supportedLSR.regionVariables : 0;
+        if (!matchesPattern(from[i], desired[i], desiredVariables) ||
+                !matchesPattern(to[i], supported[i], supportedVariables)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/** Returns the distance for different subtags at the given level. */
+int32_t getLevelDistance(const LocaleDistanceData &data, int32_t level,
+                         const char *const desired[], const char *const supported[],
+                         const LSR &desiredLSR, const LSR &supportedLSR) {
+    // The first matching rule wins.
+    // Look up the first exact rule, and check the wildcard rules before it.
+    char key[KEY_CAPACITY];
+    makeExactRuleKey(desired, supported, level, key);
+    int32_t exactValue = uhash_geti(data.exactRules[level], key);
+    int32_t limit = exactValue != 0 ? (exactValue - 1) / 2 : data.ruleCounts[level];
+    const DistanceRule *rules = data.rules[level];
+    for (int32_t i = 0; i < limit; ++i) {
+        const DistanceRule &rule = rules[i];
+        if (rule.exact) {
+            continue;
+        }
+        if (matchesRule(rule.desired, rule.supported, level, desired, supported,
+                        desiredLSR, supportedLSR) ||
+                (!rule.oneway && matchesRule(rule.supported, rule.desired, level, desired, supported,
+                                             desiredLSR, supportedLSR))) {
+            return rule.distance;
+        }
+    }
+    if (exactValue != 0) {
+        return rules[limit].distance;
+    }
+    return DEFAULT_DISTANCES[level];
+}
+
+int32_t getDistance(const LocaleDistanceData &data, const LSR &desiredLSR, const LSR &supportedLSR,
+                    int32_t threshold) {
+    const char *desired[LEVEL_COUNT] = {
+        desiredLSR.language, desiredLSR.script, desiredLSR.region
+    };
+    const char *supported[LEVEL_COUNT] = {
+        supportedLSR.language, supportedLSR.script, supportedLSR.region
+    };
+    int32_t distance = 0;
+    for (int32_t level = 0; level < LEVEL_COUNT; ++level) {
+        if (uprv_strcmp(desired[level], supported[level]) != 0) {
+            distance += getLevelDistance(data, level, desired, supported, desiredLSR, supportedLSR);
+            if (distance >= threshold) {
+                break;
+            }
+        }
+    }
+    return distance;
+}
+
+void setLSR(const LocaleDistanceData &data, const Locale &locale, LSR &lsr, UErrorCode &errorCode) {
+    char maximized[ULOC_FULLNAME_CAPACITY];
+    uloc_addLikelySubtags(locale.getBaseName(), maximized, UPRV_LENGTHOF(maximized), &errorCode);
+    uloc_getLanguage(maximized, lsr.language, UPRV_LENGTHOF(lsr.language), &errorCode);
+    uloc_getScript(maximized, lsr.script, UPRV_LENGTHOF(lsr.script), &errorCode);
+    uloc_getCountry(maximized, lsr.region, UPRV_LENGTHOF(lsr.region), &errorCode);
+    if (errorCode == U_STRING_NOT_TERMINATED_WARNING) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    int32_t regionIndex = getRegionIndex(lsr.region);
+    lsr.regionVariables = regionIndex >= 0 ? data.regionVariables[regionIndex] : 0;
+}
+
+const LocaleDistanceData *getLocaleDistanceData(UErrorCode &errorCode) {
+    umtx_initOnce(gLocaleDistanceDataInitOnce, &initLocaleDistanceData, errorCode);
+    return gLocaleDistanceData;
+}
+
+/** A language range of an Accept-Language string. */
+struct LanguageRange {
+    int32_t start;
+    int32_t length;
+    /** Quality value times 1000. */
+    int32_t quality;
+};
+
+inline UBool isWhiteSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+/**
+ * Parses the quality value after "q=".
+ * @return the quality times 1000, or -1 if it is not well-formed
+ */
+int32_t parseQuality(const char *s, int32_t length) {
+    // qvalue = ( "0" [ "." 0*3DIGIT ] ) | ( "1" [ "." 0*3("0") ] )
+    if (length == 0 || (s[0] != '0' && s[0] != '1')) {
+        return -1;
+    }
+    int32_t quality = (s[0] - '0') * 1000;
+    if (length == 1) {
+        return quality;
+    }
+    if (s[1] != '.' || length > 5) {
+        return -1;
+    }
+    int32_t factor = 100;
+    for (int32_t i = 2; i < length; ++i, factor /= 10) {
+        if (s[i] < '0' || '9' < s[i]) {
+            return -1;
+        }
+        quality += (s[i] - '0') * factor;
+    }
+    return quality <= 1000 ? quality : -1;
+}
+
+}  // namespace
+
+LocaleMatcher::LocaleMatcher(const Locale *supported, int32_t length, UErrorCode &errorCode)
+        : supportedLocales(nullptr), supportedLSRs(nullptr), supportedLocalesLength(0) {
+    const LocaleDistanceData *data = getLocaleDistanceData(errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (length < 0 || (supported == nullptr && length > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (length == 0) {
+        return;
+    }
+    supportedLocales = new Locale[length];
+    supportedLSRs = new LSR[length];
+    if (supportedLocales == nullptr || supportedLSRs == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    supportedLocalesLength = length;
+    for (int32_t i = 0; i < length && U_SUCCESS(errorCode); ++i) {
+        supportedLocales[i] = supported[i];
+        setLSR(*data, supportedLocales[i], supportedLSRs[i], errorCode);
+    }
+}
+
+LocaleMatcher::~LocaleMatcher() {
+    delete[] supportedLocales;
+    delete[] supportedLSRs;
+}
+
+const Locale *LocaleMatcher::getBestMatch(const Locale &desiredLocale, UErrorCode &errorCode) const {
+    int32_t index = getBestMatchIndex(&desiredLocale, 1, errorCode);
+    return index >= 0 ? supportedLocales + index : nullptr;
+}
+
+const Locale *LocaleMatcher::getBestMatch(const Locale *desiredLocales, int32_t length,
+                                          UErrorCode &errorCode) const {
+    int32_t index = getBestMatchIndex(desiredLocales, length, errorCode);
+    return index >= 0 ? supportedLocales + index : nullptr;
+}
+
+int32_t LocaleMatcher::getBestMatchIndex(const Locale *desiredLocales, int32_t length,
+                                         UErrorCode &errorCode) const {
+    const LocaleDistanceData *data = getLocaleDistanceData(errorCode);
+    if (U_FAILURE(errorCode)) {
+        return -1;
+    }
+    if (length < 0 || (desiredLocales == nullptr && length > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return -1;
+    }
+    if (supportedLocalesLength == 0) {
+        return -1;
+    }
+    int32_t bestIndex = 0;  // The first supported locale is the default.
+    int32_t bestDistance = THRESHOLD_DISTANCE;
+    for (int32_t i = 0; i < length; ++i) {
+        int32_t demotion = i * DEMOTION_PER_DESIRED_LOCALE;
+        if (bestDistance <= demotion) {
+            break;  // No later desired locale can do better.
+        }
+        if (desiredLocales[i].isBogus()) {
+            continue;
+        }
+        LSR desiredLSR;
+        setLSR(*data, desiredLocales[i], desiredLSR, errorCode);
+        if (U_FAILURE(errorCode)) {
+            return -1;
+        }
+        for (int32_t j = 0; j < supportedLocalesLength; ++j) {
+            int32_t distance = demotion +
+                getDistance(*data, desiredLSR, supportedLSRs[j], bestDistance - demotion);
+            if (distance < bestDistance) {
+                bestIndex = j;
+                bestDistance = distance;
+                if (distance == demotion) {
+                    break;  // Exact match for this desired locale.
+                }
+            }
+        }
+    }
+    return bestIndex;
+}
+
+const Locale *LocaleMatcher::getBestMatchForListString(StringPiece desiredLocaleList,
+                                                       UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return nullptr;
+    }
+    const char *s = desiredLocaleList.data();
+    int32_t limit = desiredLocaleList.length();
+    MaybeStackArray<LanguageRange, 16> ranges;
+    int32_t rangesLength = 0;
+    for (int32_t start = 0; start < limit;) {
+        int32_t end = start;
+        while (end < limit && s[end] != ',') {
+            ++end;
+        }
+        // Trim the range and split off the parameters.
+        int32_t rangeStart = start;
+        while (rangeStart < end && isWhiteSpace(s[rangeStart])) {
+            ++rangeStart;
+        }
+        int32_t rangeLimit = rangeStart;
+        while (rangeLimit < end && s[rangeLimit] != ';' && !isWhiteSpace(s[rangeLimit])) {
+            ++rangeLimit;
+        }
+        int32_t quality = 1000;
+        int32_t p = rangeLimit;
+        while (p < end && isWhiteSpace(s[p])) {
+            ++p;
+        }
+        if (p < end) {
+            // ";" OWS "q=" qvalue OWS
+            if (s[p++] != ';') {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return nullptr;
+            }
+            while (p < end && isWhiteSpace(s[p])) {
+                ++p;
+            }
+            if (end - p < 2 || (s[p] != 'q' && s[p] != 'Q') || s[p + 1] != '=') {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return nullptr;
+            }
+            p += 2;
+            int32_t qLimit = end;
+            while (qLimit > p && isWhiteSpace(s[qLimit - 1])) {
+                --qLimit;
+            }
+            quality = parseQuality(s + p, qLimit - p);
+            if (quality < 0) {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return nullptr;
+            }
+        }
+        if (rangeLimit > rangeStart) {
+            UBool isWildcard = rangeLimit - rangeStart == 1 && s[rangeStart] == '*';
+            if (quality > 0 && !isWildcard) {
+                if (rangesLength == ranges.getCapacity() &&
+                        ranges.resize(2 * rangesLength, rangesLength) == nullptr) {
+                    errorCode = U_MEMORY_ALLOCATION_ERROR;
+                    return nullptr;
+                }
+                // Insert in descending order of quality, after the ranges with the same quality.
+                int32_t i = rangesLength++;
+                for (; i > 0 && ranges[i - 1].quality < quality; --i) {
+                    ranges[i] = ranges[i - 1];
+                }
+                ranges[i].start = rangeStart;
+                ranges[i].length = rangeLimit - rangeStart;
+                ranges[i].quality = quality;
+            }
+        } else if (p < end) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;  // parameters without a range
+            return nullptr;
+        }
+        start = end + 1;
+    }
+
+    LocalArray<Locale> desiredLocales(new Locale[rangesLength > 0 ? rangesLength : 1]);
+    if (desiredLocales.isNull()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    for (int32_t i = 0; i < rangesLength; ++i) {
+        desiredLocales[i] = Locale::forLanguageTag(
+            StringPiece(s + ranges[i].start, ranges[i].length), errorCode);
+    }
+    if (U_FAILURE(errorCode)) {
+        return nullptr;
+    }
+    return getBestMatch(desiredLocales.getAlias(), rangesLength, errorCode);
+}
+
+int32_t LocaleMatcher::internalDistance(const Locale &desired, const Locale &supported,
+                                        UErrorCode &errorCode) {
+    const LocaleDistanceData *data = getLocaleDistanceData(errorCode);
+    LSR desiredLSR, supportedLSR;
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    setLSR(*data, desired, desiredLSR, errorCode);
+    setLSR(*data, supported, supportedLSR, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    return getDistance(*data, desiredLSR, supportedLSR, INT32_MAX);
+}
+
+U_NAMESPACE_END
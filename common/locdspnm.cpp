@@ -21,8 +21,10 @@
 #include "cmemory.h"
 #include "cstring.h"
 #include "mutex.h"
+#include "sharedobject.h"
 #include "ulocimp.h"
 #include "umutex.h"
+#include "unifiedcache.h"
 #include "ureslocs.h"
 #include "uresimp.h"
 
@@ -63,9 +65,15 @@ U_NAMESPACE_BEGIN
 
 // Access resource data for locale components.
 // Wrap code in uloc.c for now.
+// The bundle for the locale stays open for the lifetime of the table,
+// so that lookups do not open it again each time.
 class ICUDataTable {
     const char* path;
     Locale locale;
+    UResourceBundle* bundle;
+
+    const UChar* getString(const char* tableKey, const char* subTableKey, const char* itemKey,
+                           int32_t& length, UErrorCode& status) const;
 
 public:
     ICUDataTable(const char* path, const Locale& locale);
@@ -95,7 +103,7 @@ ICUDataTable::getNoFallback(const char* tableKey, const char* itemKey, UnicodeSt
 }
 
 ICUDataTable::ICUDataTable(const char* path, const Locale& locale)
-    : path(NULL), locale(Locale::getRoot())
+    : path(NULL), locale(Locale::getRoot()), bundle(NULL)
 {
   if (path) {
     int32_t len = static_cast<int32_t>(uprv_strlen(path));
@@ -105,9 +113,16 @@ ICUDataTable::ICUDataTable(const char* path, const Locale& locale)
       this->locale = locale;
     }
   }
+  UErrorCode status = U_ZERO_ERROR;
+  bundle = ures_open(this->path, this->locale.getName(), &status);
+  if (U_FAILURE(status)) {
+    ures_close(bundle);
+    bundle = NULL;
+  }
 }
 
 ICUDataTable::~ICUDataTable() {
+  ures_close(bundle);
   if (path) {
     uprv_free((void*) path);
     path = NULL;
@@ -119,15 +134,26 @@ ICUDataTable::getLocale() {
   return locale;
 }
 
+const UChar*
+ICUDataTable::getString(const char* tableKey, const char* subTableKey, const char* itemKey,
+                        int32_t& length, UErrorCode& status) const {
+  if (bundle == NULL) {
+    // Not even root could be opened.
+    status = U_MISSING_RESOURCE_ERROR;
+    return NULL;
+  }
+  return uloc_getTableStringWithFallbackFromBundle(bundle, path, locale.getName(),
+                                                   tableKey, subTableKey, itemKey,
+                                                   &length, &status);
+}
+
 UnicodeString &
 ICUDataTable::get(const char* tableKey, const char* subTableKey, const char* itemKey,
                   UnicodeString &result) const {
   UErrorCode status = U_ZERO_ERROR;
   int32_t len = 0;
 
-  const UChar *s = uloc_getTableStringWithFallback(path, locale.getName(),
-                                                   tableKey, subTableKey, itemKey,
-                                                   &len, &status);
+  const UChar *s = getString(tableKey, subTableKey, itemKey, len, status);
   if (U_SUCCESS(status) && len > 0) {
     return result.setTo(s, len);
   }
@@ -140,9 +166,7 @@ ICUDataTable::getNoFallback(const char* tableKey, const char* subTableKey, const
   UErrorCode status = U_ZERO_ERROR;
   int32_t len = 0;
 
-  const UChar *s = uloc_getTableStringWithFallback(path, locale.getName(),
-                                                   tableKey, subTableKey, itemKey,
-                                                   &len, &status);
+  const UChar *s = getString(tableKey, subTableKey, itemKey, len, status);
   if (U_SUCCESS(status)) {
     return result.setTo(s, len);
   }
@@ -155,6 +179,15 @@ ICUDataTable::getNoFallback(const char* tableKey, const char* subTableKey, const
 
 LocaleDisplayNames::~LocaleDisplayNames() {}
 
+UnicodeString*
+LocaleDisplayNames::localeDisplayNames(const Locale* locales, int32_t count,
+                                       UnicodeString* results) const {
+    for (int32_t i = 0; i < count; ++i) {
+        localeDisplayName(locales[i], results[i]);
+    }
+    return results;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #if 0  // currently unused
@@ -309,7 +342,6 @@ class LocaleDisplayNamesImpl : public LocaleDisplayNames {
 
 public:
     // constructor
-    LocaleDisplayNamesImpl(const Locale& locale, UDialectHandling dialectHandling);
     LocaleDisplayNamesImpl(const Locale& locale, UDisplayContext *contexts, int32_t length);
     virtual ~LocaleDisplayNamesImpl();
 
@@ -354,18 +386,6 @@ class LocaleDisplayNamesImpl : public LocaleDisplayNames {
 
 UMutex LocaleDisplayNamesImpl::capitalizationBrkIterLock = U_MUTEX_INITIALIZER;
 
-LocaleDisplayNamesImpl::LocaleDisplayNamesImpl(const Locale& locale,
-                                               UDialectHandling dialectHandling)
-    : dialectHandling(dialectHandling)
-    , langData(U_ICUDATA_LANG, locale)
-    , regionData(U_ICUDATA_REGION, locale)
-    , capitalizationContext(UDISPCTX_CAPITALIZATION_NONE)
-    , capitalizationBrkIter(NULL)
-    , nameLength(UDISPCTX_LENGTH_FULL)
-{
-    initialize();
-}
-
 LocaleDisplayNamesImpl::LocaleDisplayNamesImpl(const Locale& locale,
                                                UDisplayContext *contexts, int32_t length)
     : dialectHandling(ULDN_STANDARD_NAMES)
@@ -835,10 +855,182 @@ LocaleDisplayNamesImpl::keyValueDisplayName(const char* key,
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// LocaleDisplayNamesImpl instances only read their data after construction,
+// and guard their break iterator with a mutex, so one instance per display
+// locale and set of contexts is shared through the UnifiedCache.
+// createInstance() returns a CachedLocaleDisplayNames which forwards to it.
+
+class SharedLocaleDisplayNames : public SharedObject {
+public:
+    SharedLocaleDisplayNames(LocaleDisplayNamesImpl *implToAdopt) : fImpl(implToAdopt) {}
+    virtual ~SharedLocaleDisplayNames();
+    const LocaleDisplayNamesImpl *get() const { return fImpl; }
+private:
+    LocaleDisplayNamesImpl *fImpl;
+
+    SharedLocaleDisplayNames(const SharedLocaleDisplayNames &);
+    SharedLocaleDisplayNames &operator=(const SharedLocaleDisplayNames &);
+};
+
+SharedLocaleDisplayNames::~SharedLocaleDisplayNames() {
+    delete fImpl;
+}
+
+template<>
+const SharedLocaleDisplayNames *LocaleCacheKey<SharedLocaleDisplayNames>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return NULL;
+}
+
+class LocaleDisplayNamesCacheKey : public LocaleCacheKey<SharedLocaleDisplayNames> {
+private:
+    UDisplayContext fContexts[3];  // dialect handling, capitalization, display length
+public:
+    LocaleDisplayNamesCacheKey(const Locale &loc, const UDisplayContext contexts[3])
+            : LocaleCacheKey<SharedLocaleDisplayNames>(loc) {
+        uprv_memcpy(fContexts, contexts, sizeof(fContexts));
+    }
+    LocaleDisplayNamesCacheKey(const LocaleDisplayNamesCacheKey &other)
+            : LocaleCacheKey<SharedLocaleDisplayNames>(other) {
+        uprv_memcpy(fContexts, other.fContexts, sizeof(fContexts));
+    }
+    virtual ~LocaleDisplayNamesCacheKey();
+    virtual int32_t hashCode() const {
+        uint32_t hash = (uint32_t)LocaleCacheKey<SharedLocaleDisplayNames>::hashCode();
+        for (int32_t i = 0; i < UPRV_LENGTHOF(fContexts); ++i) {
+            hash = 37u * hash + (uint32_t)fContexts[i];
+        }
+        return (int32_t)hash;
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<SharedLocaleDisplayNames>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const LocaleDisplayNamesCacheKey &otherKey =
+            static_cast<const LocaleDisplayNamesCacheKey &>(other);
+        return uprv_memcmp(fContexts, otherKey.fContexts, sizeof(fContexts)) == 0;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new LocaleDisplayNamesCacheKey(*this);
+    }
+    virtual const SharedLocaleDisplayNames *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        UDisplayContext contexts[3];
+        uprv_memcpy(contexts, fContexts, sizeof(contexts));
+        LocalPointer<LocaleDisplayNamesImpl> impl(
+            new LocaleDisplayNamesImpl(fLoc, contexts, UPRV_LENGTHOF(contexts)), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        SharedLocaleDisplayNames *result = new SharedLocaleDisplayNames(impl.getAlias());
+        if (result == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        impl.orphan();
+        result->addRef();
+        return result;
+    }
+};
+
+LocaleDisplayNamesCacheKey::~LocaleDisplayNamesCacheKey() {}
+
+class CachedLocaleDisplayNames : public LocaleDisplayNames {
+    const SharedLocaleDisplayNames *shared;
+    const LocaleDisplayNamesImpl *impl;
+
+public:
+    // Adopts a reference to shared.
+    CachedLocaleDisplayNames(const SharedLocaleDisplayNames *shared)
+        : shared(shared), impl(shared->get()) {}
+    virtual ~CachedLocaleDisplayNames();
+
+    virtual const Locale& getLocale() const {
+        return impl->getLocale();
+    }
+    virtual UDialectHandling getDialectHandling() const {
+        return impl->getDialectHandling();
+    }
+    virtual UDisplayContext getContext(UDisplayContextType type) const {
+        return impl->getContext(type);
+    }
+
+    virtual UnicodeString& localeDisplayName(const Locale& locale,
+                                                UnicodeString& result) const {
+        return impl->localeDisplayName(locale, result);
+    }
+    virtual UnicodeString& localeDisplayName(const char* localeId,
+                                                UnicodeString& result) const {
+        return impl->localeDisplayName(localeId, result);
+    }
+    virtual UnicodeString& languageDisplayName(const char* lang,
+                                               UnicodeString& result) const {
+        return impl->languageDisplayName(lang, result);
+    }
+    virtual UnicodeString& scriptDisplayName(const char* script,
+                                                UnicodeString& result) const {
+        return impl->scriptDisplayName(script, result);
+    }
+    virtual UnicodeString& scriptDisplayName(UScriptCode scriptCode,
+                                                UnicodeString& result) const {
+        return impl->scriptDisplayName(scriptCode, result);
+    }
+    virtual UnicodeString& regionDisplayName(const char* region,
+                                                UnicodeString& result) const {
+        return impl->regionDisplayName(region, result);
+    }
+    virtual UnicodeString& variantDisplayName(const char* variant,
+                                                UnicodeString& result) const {
+        return impl->variantDisplayName(variant, result);
+    }
+    virtual UnicodeString& keyDisplayName(const char* key,
+                                                UnicodeString& result) const {
+        return impl->keyDisplayName(key, result);
+    }
+    virtual UnicodeString& keyValueDisplayName(const char* key,
+                                                const char* value,
+                                                UnicodeString& result) const {
+        return impl->keyValueDisplayName(key, value, result);
+    }
+};
+
+CachedLocaleDisplayNames::~CachedLocaleDisplayNames() {
+    shared->removeRef();
+}
+
+static LocaleDisplayNames *
+createCachedInstance(const Locale& locale, const UDisplayContext contexts[3]) {
+    UErrorCode status = U_ZERO_ERROR;
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    const SharedLocaleDisplayNames *shared = NULL;
+    if (U_SUCCESS(status)) {
+        cache->get(LocaleDisplayNamesCacheKey(locale, contexts), shared, status);
+    }
+    if (U_SUCCESS(status)) {
+        LocaleDisplayNames *result = new CachedLocaleDisplayNames(shared);
+        if (result != NULL) {
+            return result;
+        }
+        shared->removeRef();
+    }
+    // Fall back to an instance of its own.
+    UDisplayContext contextsCopy[3];
+    uprv_memcpy(contextsCopy, contexts, sizeof(contextsCopy));
+    return new LocaleDisplayNamesImpl(locale, contextsCopy, UPRV_LENGTHOF(contextsCopy));
+}
+
 LocaleDisplayNames*
 LocaleDisplayNames::createInstance(const Locale& locale,
                                    UDialectHandling dialectHandling) {
-    return new LocaleDisplayNamesImpl(locale, dialectHandling);
+    UDisplayContext contexts[3] = {
+        (UDisplayContext)dialectHandling, UDISPCTX_CAPITALIZATION_NONE, UDISPCTX_LENGTH_FULL
+    };
+    return createCachedInstance(locale, contexts);
 }
 
 LocaleDisplayNames*
@@ -847,7 +1039,29 @@ LocaleDisplayNames::createInstance(const Locale& locale,
     if (contexts == NULL) {
         length = 0;
     }
-    return new LocaleDisplayNamesImpl(locale, contexts, length);
+    // Normalize the contexts the way the LocaleDisplayNamesImpl constructor
+    // reads them, so that equivalent lists share one cache entry.
+    UDisplayContext normalized[3] = {
+        UDISPCTX_STANDARD_NAMES, UDISPCTX_CAPITALIZATION_NONE, UDISPCTX_LENGTH_FULL
+    };
+    while (length-- > 0) {
+        UDisplayContext value = *contexts++;
+        UDisplayContextType selector = (UDisplayContextType)((uint32_t)value >> 8);
+        switch (selector) {
+            case UDISPCTX_TYPE_DIALECT_HANDLING:
+                normalized[0] = value;
+                break;
+            case UDISPCTX_TYPE_CAPITALIZATION:
+                normalized[1] = value;
+                break;
+            case UDISPCTX_TYPE_DISPLAY_LENGTH:
+                normalized[2] = value;
+                break;
+            default:
+                break;
+        }
+    }
+    return createCachedInstance(locale, normalized);
 }
 
 U_NAMESPACE_END
@@ -66,6 +66,10 @@ static UMutex gDefaultLocaleMutex = U_MUTEX_INITIALIZER;
 static UHashtable *gDefaultLocalesHashT = NULL;
 static Locale *gDefaultLocale = NULL;
 
+// gLocaleIDMutex protects all access to gLocaleIDsHashT.
+static UMutex gLocaleIDMutex = U_MUTEX_INITIALIZER;
+static UHashtable *gLocaleIDsHashT = NULL;
+
 /**
  * \def ULOC_STRING_LIMIT
  * strings beyond this value crash in CharString
@@ -130,6 +134,11 @@ static UBool U_CALLCONV locale_cleanup(void)
         gDefaultLocalesHashT = NULL;
     }
     gDefaultLocale = NULL;
+    // The interned IDs are owned by the Locale objects that still use them.
+    if (gLocaleIDsHashT) {
+        uhash_close(gLocaleIDsHashT);
+        gLocaleIDsHashT = NULL;
+    }
     return TRUE;
 }
 
@@ -172,6 +181,8 @@ U_NAMESPACE_BEGIN
 Locale *locale_set_default_internal(const char *id, UErrorCode& status) {
     // Synchronize this entire function.
     Mutex lock(&gDefaultLocaleMutex);
+    // The default Locale objects are cached beyond the current memory scope.
+    MemoryScopeSuspender suspender;
 
     UBool canonicalize = FALSE;
 
@@ -249,6 +260,100 @@ U_NAMESPACE_BEGIN
 
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(Locale)
 
+/*
+ * Locale IDs that do not fit into fullNameBuffer, and base names that differ
+ * from the full name, are interned in a process-wide table of reference-counted strings.
+ * Copying a Locale then only increments a reference count, and two Locale objects
+ * with the same interned ID share the same pointer.
+ * The fullName and baseName fields point to the name of an InternedLocaleID.
+ *
+ * Only the last release deletes an entry. Lookups run under gLocaleIDMutex and
+ * do not revive an entry whose count already dropped to 0; they replace it instead.
+ */
+struct InternedLocaleID {
+    u_atomic_int32_t refCount;
+    int32_t hashCode;
+    char name[1];  // NUL-terminated, allocated with the necessary length
+};
+
+static inline InternedLocaleID *getInternedLocaleID(const char *name) {
+    return (InternedLocaleID *)(name - offsetof(InternedLocaleID, name));
+}
+
+/*
+ * Returns the interned copy of the first length chars of id,
+ * with a reference owned by the caller, or NULL if memory allocation fails.
+ */
+static char *internLocaleID(const char *id, int32_t length) {
+    char stackBuffer[ULOC_FULLNAME_CAPACITY];
+    CharString heapBuffer;
+    const char *key = id;
+    if (id[length] != 0) {
+        // uhash needs a NUL-terminated key.
+        if (length < (int32_t)sizeof(stackBuffer)) {
+            uprv_memcpy(stackBuffer, id, length);
+            stackBuffer[length] = 0;
+            key = stackBuffer;
+        } else {
+            UErrorCode status = U_ZERO_ERROR;
+            key = heapBuffer.append(id, length, status).data();
+            if (U_FAILURE(status)) {
+                return NULL;
+            }
+        }
+    }
+
+    Mutex lock(&gLocaleIDMutex);
+    UErrorCode status = U_ZERO_ERROR;
+    if (gLocaleIDsHashT == NULL) {
+        gLocaleIDsHashT = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        ucln_common_registerCleanup(UCLN_COMMON_LOCALE, locale_cleanup);
+    }
+    InternedLocaleID *entry = (InternedLocaleID *)uhash_get(gLocaleIDsHashT, key);
+    if (entry != NULL) {
+        if (umtx_atomic_inc(&entry->refCount) > 1) {
+            return entry->name;
+        }
+        // The last reference was just released, and that releaser deletes the entry.
+        umtx_atomic_dec(&entry->refCount);
+        uhash_remove(gLocaleIDsHashT, key);
+    }
+    entry = (InternedLocaleID *)uprv_malloc(sizeof(InternedLocaleID) + length);
+    if (entry == NULL) {
+        return NULL;
+    }
+    umtx_storeRelease(entry->refCount, 1);
+    uprv_memcpy(entry->name, key, length + 1);
+    entry->hashCode = ustr_hashCharsN(entry->name, length);
+    uhash_put(gLocaleIDsHashT, entry->name, entry, &status);
+    if (U_FAILURE(status)) {
+        uprv_free(entry);
+        return NULL;
+    }
+    return entry->name;
+}
+
+static void addRefLocaleID(char *name) {
+    umtx_atomic_inc(&getInternedLocaleID(name)->refCount);
+}
+
+static void releaseLocaleID(char *name) {
+    if (name == NULL) {
+        return;
+    }
+    InternedLocaleID *entry = getInternedLocaleID(name);
+    if (umtx_atomic_dec(&entry->refCount) == 0) {
+        Mutex lock(&gLocaleIDMutex);
+        if (gLocaleIDsHashT != NULL && uhash_get(gLocaleIDsHashT, name) == entry) {
+            uhash_remove(gLocaleIDsHashT, name);
+        }
+        uprv_free(entry);
+    }
+}
+
 /*Character separating the posix id fields*/
 // '_'
 // In the platform codepage.
@@ -257,13 +362,13 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(Locale)
 Locale::~Locale()
 {
     if (baseName != fullName) {
-        uprv_free(baseName);
+        releaseLocaleID(baseName);
     }
     baseName = NULL;
-    /*if fullName is on the heap, we free it*/
+    /*if fullName is interned, we release it*/
     if (fullName != fullNameBuffer)
     {
-        uprv_free(fullName);
+        releaseLocaleID(fullName);
         fullName = NULL;
     }
 }
@@ -446,15 +551,15 @@ Locale& Locale::operator=(const Locale& other) {
     } else if (other.fullName == nullptr) {
         fullName = nullptr;
     } else {
-        fullName = uprv_strdup(other.fullName);
-        if (fullName == nullptr) return *this;
+        fullName = other.fullName;
+        addRefLocaleID(fullName);
     }
 
     if (other.baseName == other.fullName) {
         baseName = fullName;
     } else if (other.baseName != nullptr) {
-        baseName = uprv_strdup(other.baseName);
-        if (baseName == nullptr) return *this;
+        baseName = other.baseName;
+        addRefLocaleID(baseName);
     }
 
     uprv_strcpy(language, other.language);
@@ -468,8 +573,8 @@ Locale& Locale::operator=(const Locale& other) {
 }
 
 Locale& Locale::operator=(Locale&& other) U_NOEXCEPT {
-    if (baseName != fullName) uprv_free(baseName);
-    if (fullName != fullNameBuffer) uprv_free(fullName);
+    if (baseName != fullName) releaseLocaleID(baseName);
+    if (fullName != fullNameBuffer) releaseLocaleID(fullName);
 
     if (other.fullName == other.fullNameBuffer) {
         uprv_strcpy(fullNameBuffer, other.fullNameBuffer);
@@ -504,7 +609,8 @@ Locale::clone() const {
 UBool
 Locale::operator==( const   Locale& other) const
 {
-    return (uprv_strcmp(other.fullName, fullName) == 0);
+    // Equal interned IDs are normally the same string.
+    return other.fullName == fullName || uprv_strcmp(other.fullName, fullName) == 0;
 }
 
 #define ISASCIIALPHA(c) (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z'))
@@ -515,11 +621,11 @@ Locale& Locale::init(const char* localeID, UBool canonicalize)
     fIsBogus = FALSE;
     /* Free our current storage */
     if (baseName != fullName) {
-        uprv_free(baseName);
+        releaseLocaleID(baseName);
     }
     baseName = NULL;
     if(fullName != fullNameBuffer) {
-        uprv_free(fullName);
+        releaseLocaleID(fullName);
         fullName = fullNameBuffer;
     }
 
@@ -550,16 +656,26 @@ Locale& Locale::init(const char* localeID, UBool canonicalize)
             uloc_getName(localeID, fullName, sizeof(fullNameBuffer), &err);
 
         if(err == U_BUFFER_OVERFLOW_ERROR || length >= (int32_t)sizeof(fullNameBuffer)) {
-            /*Go to heap for the fullName if necessary*/
-            fullName = (char *)uprv_malloc(sizeof(char)*(length + 1));
-            if(fullName == 0) {
-                fullName = fullNameBuffer;
+            /*Intern the fullName if necessary*/
+            CharString longName;
+            int32_t capacity;
+            err = U_ZERO_ERROR;
+            char *buffer = longName.getAppendBuffer(length + 1, length + 1, capacity, err);
+            if(U_FAILURE(err)) {
                 break; // error: out of memory
             }
-            err = U_ZERO_ERROR;
             length = canonicalize ?
-                uloc_canonicalize(localeID, fullName, length+1, &err) :
-                uloc_getName(localeID, fullName, length+1, &err);
+                uloc_canonicalize(localeID, buffer, capacity, &err) :
+                uloc_getName(localeID, buffer, capacity, &err);
+            if(U_FAILURE(err) || err == U_STRING_NOT_TERMINATED_WARNING) {
+                /* should never occur */
+                break;
+            }
+            fullName = internLocaleID(buffer, length);
+            if(fullName == NULL) {
+                fullName = fullNameBuffer;
+                break; // error: out of memory
+            }
         }
         if(U_FAILURE(err) || err == U_STRING_NOT_TERMINATED_WARNING) {
             /* should never occur */
@@ -655,13 +771,11 @@ Locale::initBaseName(UErrorCode &status) {
     if (atPtr && eqPtr && atPtr < eqPtr) {
         // Key words exist.
         int32_t baseNameLength = (int32_t)(atPtr - fullName);
-        baseName = (char *)uprv_malloc(baseNameLength + 1);
+        baseName = internLocaleID(fullName, baseNameLength);
         if (baseName == NULL) {
             status = U_MEMORY_ALLOCATION_ERROR;
             return;
         }
-        uprv_strncpy(baseName, fullName, baseNameLength);
-        baseName[baseNameLength] = 0;
 
         // The original computation of variantBegin leaves it equal to the length
         // of fullName if there is no variant.  It should instead be
@@ -678,6 +792,9 @@ Locale::initBaseName(UErrorCode &status) {
 int32_t
 Locale::hashCode() const
 {
+    if (fullName != fullNameBuffer && fullName != NULL) {
+        return getInternedLocaleID(fullName)->hashCode;
+    }
     return ustr_hashCharsN(fullName, static_cast<int32_t>(uprv_strlen(fullName)));
 }
 
@@ -685,11 +802,11 @@ void
 Locale::setToBogus() {
     /* Free our current storage */
     if(baseName != fullName) {
-        uprv_free(baseName);
+        releaseLocaleID(baseName);
     }
     baseName = NULL;
     if(fullName != fullNameBuffer) {
-        uprv_free(fullName);
+        releaseLocaleID(fullName);
         fullName = fullNameBuffer;
     }
     *fullNameBuffer = 0;
@@ -1500,6 +1617,36 @@ Locale::getUnicodeKeywordValue(StringPiece keywordName,
 void
 Locale::setKeywordValue(const char* keywordName, const char* keywordValue, UErrorCode &status)
 {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (fullName != fullNameBuffer) {
+        // An interned fullName is shared with other Locale objects:
+        // Modify a copy, and re-initialize from it.
+        int32_t length = (int32_t)uprv_strlen(fullName);
+        int32_t capacity = length + 1;
+        if (keywordName != NULL) {
+            capacity += (int32_t)uprv_strlen(keywordName) + 2;
+        }
+        if (keywordValue != NULL) {
+            capacity += (int32_t)uprv_strlen(keywordValue);
+        }
+        CharString newName;
+        int32_t resultCapacity;
+        char *buffer = newName.getAppendBuffer(capacity, capacity, resultCapacity, status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        uprv_memcpy(buffer, fullName, length + 1);
+        uloc_setKeywordValue(keywordName, keywordValue, buffer, resultCapacity, &status);
+        if (U_SUCCESS(status)) {
+            init(buffer, FALSE);
+            if (isBogus()) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            }
+        }
+        return;
+    }
     uloc_setKeywordValue(keywordName, keywordValue, fullName, ULOC_FULLNAME_CAPACITY, &status);
     if (U_SUCCESS(status) && baseName == fullName) {
         // May have added the first keyword, meaning that the fullName is no longer also the baseName.
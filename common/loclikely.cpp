@@ -20,17 +20,89 @@
 */
 
 #include "unicode/utypes.h"
+#include "unicode/bytestrie.h"
+#include "unicode/bytestriebuilder.h"
 #include "unicode/locid.h"
 #include "unicode/putil.h"
 #include "unicode/uchar.h"
 #include "unicode/uloc.h"
 #include "unicode/ures.h"
 #include "unicode/uscript.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "ucln_cmn.h"
 #include "ulocimp.h"
+#include "umutex.h"
+#include "uresimp.h"
 #include "ustr_imp.h"
 
+U_NAMESPACE_USE
+
+/*
+ * The likelySubtags resource table, converted once into a BytesTrie
+ * that maps each locale ID to the offset of its likely subtags
+ * in gLikelySubtagsValues.
+ * Looking up the trie avoids opening the resource bundle and converting
+ * its UChar string for every lookup.
+ */
+static uint8_t *gLikelySubtagsTrie = NULL;
+static CharString *gLikelySubtagsValues = NULL;
+static icu::UInitOnce gLikelySubtagsInitOnce = U_INITONCE_INITIALIZER;
+
+U_CDECL_BEGIN
+
+static UBool U_CALLCONV
+loclikely_cleanup(void) {
+    uprv_free(gLikelySubtagsTrie);
+    gLikelySubtagsTrie = NULL;
+    delete gLikelySubtagsValues;
+    gLikelySubtagsValues = NULL;
+    gLikelySubtagsInitOnce.reset();
+    return TRUE;
+}
+
+U_CDECL_END
+
+static void U_CALLCONV
+initLikelySubtags(UErrorCode &errorCode) {
+    ucln_common_registerCleanup(UCLN_COMMON_LIKELY_SUBTAGS, loclikely_cleanup);
+    LocalUResourceBundlePointer subtags(ures_openDirect(NULL, "likelySubtags", &errorCode));
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    LocalPointer<CharString> values(new CharString(), errorCode);
+    LocalPointer<BytesTrieBuilder> builder(new BytesTrieBuilder(errorCode), errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    UResourceBundle item;
+    ures_initStackObject(&item);
+    while (ures_hasNext(subtags.getAlias()) && U_SUCCESS(errorCode)) {
+        ures_getNextResource(subtags.getAlias(), &item, &errorCode);
+        int32_t length = 0;
+        const UChar *s = ures_getString(&item, &length, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        int32_t offset = values->length();
+        values->appendInvariantChars(s, length, errorCode).append((char)0, errorCode);
+        builder->add(ures_getKey(&item), offset, errorCode);
+    }
+    ures_close(&item);
+    StringPiece trie = builder->buildStringPiece(USTRINGTRIE_BUILD_SMALL, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    gLikelySubtagsTrie = (uint8_t *)uprv_malloc(trie.length());
+    if (gLikelySubtagsTrie == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memcpy(gLikelySubtagsTrie, trie.data(), trie.length());
+    gLikelySubtagsValues = values.orphan();
+}
+
 /**
  * This function looks for the localeID in the likelySubtags resource.
  *
@@ -46,36 +118,25 @@ findLikelySubtags(const char* localeID,
                   UErrorCode* err) {
     const char* result = NULL;
 
+    umtx_initOnce(gLikelySubtagsInitOnce, &initLikelySubtags, *err);
     if (!U_FAILURE(*err)) {
-        int32_t resLen = 0;
-        const UChar* s = NULL;
-        UErrorCode tmpErr = U_ZERO_ERROR;
-        UResourceBundle* subtags = ures_openDirect(NULL, "likelySubtags", &tmpErr);
-        if (U_SUCCESS(tmpErr)) {
-            s = ures_getStringByKey(subtags, localeID, &resLen, &tmpErr);
-
-            if (U_FAILURE(tmpErr)) {
-                /*
-                 * If a resource is missing, it's not really an error, it's
-                 * just that we don't have any data for that particular locale ID.
-                 */
-                if (tmpErr != U_MISSING_RESOURCE_ERROR) {
-                    *err = tmpErr;
-                }
-            }
-            else if (resLen >= bufferLength) {
+        BytesTrie trie(gLikelySubtagsTrie);
+        if (USTRINGTRIE_HAS_VALUE(trie.next(localeID, (int32_t)uprv_strlen(localeID)))) {
+            const char* s = gLikelySubtagsValues->data() + trie.getValue();
+            int32_t resLen = (int32_t)uprv_strlen(s);
+            if (resLen >= bufferLength) {
                 /* The buffer should never overflow. */
                 *err = U_INTERNAL_PROGRAM_ERROR;
             }
             else {
-                u_UCharsToChars(s, buffer, resLen + 1);
+                uprv_memcpy(buffer, s, resLen + 1);
                 result = buffer;
             }
-
-            ures_close(subtags);
-        } else {
-            *err = tmpErr;
         }
+        /*
+         * If a locale ID is missing, it's not really an error, it's
+         * just that we don't have any data for that particular locale ID.
+         */
     }
 
     return result;
@@ -48,11 +48,9 @@ uloc_getTableStringWithFallback(const char *path, const char *locale,
                               int32_t *pLength,
                               UErrorCode *pErrorCode)
 {
-/*    char localeBuffer[ULOC_FULLNAME_CAPACITY*4];*/
-    UResourceBundle *rb=NULL, table, subTable;
-    const UChar *item=NULL;
+    UResourceBundle *rb;
+    const UChar *item;
     UErrorCode errorCode;
-    char explicitFallbackName[ULOC_FULLNAME_CAPACITY] = {0};
 
     /*
      * open the bundle for the current locale
@@ -72,10 +70,32 @@ uloc_getTableStringWithFallback(const char *path, const char *locale,
         *pErrorCode=errorCode;
     }
 
+    item=uloc_getTableStringWithFallbackFromBundle(rb, path, locale,
+                                                  tableKey, subTableKey, itemKey,
+                                                  pLength, pErrorCode);
+    ures_close(rb);
+    return item;
+}
+
+U_CAPI const UChar * U_EXPORT2
+uloc_getTableStringWithFallbackFromBundle(const UResourceBundle *bundle,
+                                        const char *path, const char *locale,
+                                        const char *tableKey, const char *subTableKey,
+                                        const char *itemKey,
+                                        int32_t *pLength,
+                                        UErrorCode *pErrorCode)
+{
+    /* rb is only opened for an explicit "Fallback" locale */
+    UResourceBundle *rb=NULL, table, subTable;
+    const UResourceBundle *current=bundle;
+    const UChar *item=NULL;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    char explicitFallbackName[ULOC_FULLNAME_CAPACITY] = {0};
+
     for(;;){
         ures_initStackObject(&table);
         ures_initStackObject(&subTable);
-        ures_getByKeyWithFallback(rb, tableKey, &table, &errorCode);
+        ures_getByKeyWithFallback(current, tableKey, &table, &errorCode);
 
         if (subTableKey != NULL) {
             /*
@@ -141,6 +161,7 @@ uloc_getTableStringWithFallback(const char *path, const char *locale,
                 *pErrorCode = errorCode;
                 break;
             }
+            current = rb;
             /* succeeded in opening the fallback bundle .. continue and try to fetch the item */
         }else{
             break;
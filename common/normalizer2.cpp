@@ -20,11 +20,14 @@
 
 #if !UCONFIG_NO_NORMALIZATION
 
+#include "unicode/appendable.h"
+#include "unicode/bytestream.h"
 #include "unicode/edits.h"
 #include "unicode/normalizer2.h"
 #include "unicode/stringoptions.h"
 #include "unicode/unistr.h"
 #include "unicode/unorm.h"
+#include "charstr.h"
 #include "cstring.h"
 #include "mutex.h"
 #include "norm2allmodes.h"
@@ -42,6 +45,30 @@ using icu::Normalizer2Impl;
 
 U_NAMESPACE_BEGIN
 
+namespace {
+
+// The text can be split before a code point that has a boundary before it.
+// Surrogate code units are never split points: At the edges of a chunk,
+// they may belong to a surrogate pair that continues in another chunk.
+// i must be at the start of a code point.
+UBool isSplitPoint(const Normalizer2 &norm2, const UnicodeString &s, int32_t i) {
+    UChar32 c = s.char32At(i);
+    return !U_IS_SURROGATE(c) && norm2.hasBoundaryBefore(c);
+}
+
+// Same for UTF-8, except that i can be at any byte.
+// Neither trail bytes nor incomplete or ill-formed sequences are split points.
+UBool isSplitPointUTF8(const Normalizer2 &norm2, const char *s, int32_t i, int32_t length) {
+    if (U8_IS_TRAIL(s[i])) {
+        return FALSE;
+    }
+    UChar32 c;
+    U8_NEXT(s, i, length, c);
+    return c >= 0 && norm2.hasBoundaryBefore(c);
+}
+
+}  // namespace
+
 // Public API dispatch via Normalizer2 subclasses -------------------------- ***
 
 Normalizer2::~Normalizer2() {}
@@ -80,6 +107,196 @@ Normalizer2::isNormalizedUTF8(StringPiece s, UErrorCode &errorCode) const {
     return U_SUCCESS(errorCode) && isNormalized(UnicodeString::fromUTF8(s), errorCode);
 }
 
+int32_t
+Normalizer2::getSplitPoints(const UnicodeString &s, int32_t pieceLength,
+                            int32_t *dest, int32_t destCapacity, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    if (s.isBogus() || pieceLength <= 0 || destCapacity < 0 ||
+            (dest == NULL && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t length = s.length();
+    int32_t count = 0;
+    int32_t i = 0;
+    while (pieceLength < length - i) {
+        i += pieceLength;
+        if (U16_IS_TRAIL(s.charAt(i)) && U16_IS_LEAD(s.charAt(i - 1))) {
+            ++i;
+        }
+        while (i < length && !isSplitPoint(*this, s, i)) {
+            i = s.moveIndex32(i, 1);
+        }
+        if (i == length) {
+            break;
+        }
+        if (count < destCapacity) {
+            dest[count] = i;
+        }
+        ++count;
+    }
+    if (count > destCapacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+int32_t
+Normalizer2::getSplitPointsUTF8(StringPiece s, int32_t pieceLength,
+                                int32_t *dest, int32_t destCapacity, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    if (pieceLength <= 0 || destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const char *p = s.data();
+    int32_t length = s.length();
+    int32_t count = 0;
+    int32_t i = 0;
+    while (pieceLength < length - i) {
+        i += pieceLength;
+        while (i < length && !isSplitPointUTF8(*this, p, i, length)) {
+            ++i;
+        }
+        if (i == length) {
+            break;
+        }
+        if (count < destCapacity) {
+            dest[count] = i;
+        }
+        ++count;
+    }
+    if (count > destCapacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+// StreamingNormalizer2 ---------------------------------------------------- ***
+
+StreamingNormalizer2::StreamingNormalizer2(const Normalizer2 &n2) :
+        norm2(n2), pending8(NULL) {}
+
+StreamingNormalizer2::~StreamingNormalizer2() {
+    delete pending8;
+}
+
+void
+StreamingNormalizer2::write(const UnicodeString &src, Appendable &dest, UErrorCode &errorCode) {
+    norm2.normalize(src, normalized, errorCode);
+    if (U_SUCCESS(errorCode)) {
+        dest.appendString(normalized.getBuffer(), normalized.length());
+    }
+}
+
+void
+StreamingNormalizer2::normalize(const UnicodeString &chunk, Appendable &dest,
+                                UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (chunk.isBogus()) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    int32_t length = chunk.length();
+    int32_t first = 0;
+    while (first < length && !isSplitPoint(norm2, chunk, first)) {
+        first = chunk.moveIndex32(first, 1);
+    }
+    if (first == length) {
+        pending.append(chunk);
+        return;
+    }
+    int32_t last = length;
+    do {
+        last = chunk.moveIndex32(last, -1);
+    } while (!isSplitPoint(norm2, chunk, last));
+
+    // The pending text and the chunk up to its first boundary belong together.
+    // The rest up to the last boundary is normalized directly from the chunk.
+    if (!pending.isEmpty() || first > 0) {
+        pending.append(chunk, 0, first);
+        write(pending, dest, errorCode);
+    }
+    if (first < last) {
+        write(chunk.tempSubStringBetween(first, last), dest, errorCode);
+    }
+    pending.setTo(chunk, last);
+}
+
+void
+StreamingNormalizer2::finish(Appendable &dest, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (!pending.isEmpty()) {
+        write(pending, dest, errorCode);
+        pending.remove();
+    }
+}
+
+void
+StreamingNormalizer2::normalizeUTF8(StringPiece chunk, ByteSink &sink, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (pending8 == NULL) {
+        pending8 = new CharString();
+        if (pending8 == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    const char *s = chunk.data();
+    int32_t length = chunk.length();
+    int32_t first = 0;
+    while (first < length && !isSplitPointUTF8(norm2, s, first, length)) {
+        ++first;
+    }
+    if (first == length) {
+        pending8->append(s, length, errorCode);
+        return;
+    }
+    int32_t last = length - 1;
+    while (!isSplitPointUTF8(norm2, s, last, length)) {
+        --last;
+    }
+
+    if (!pending8->isEmpty() || first > 0) {
+        pending8->append(s, first, errorCode);
+        norm2.normalizeUTF8(0, pending8->toStringPiece(), sink, NULL, errorCode);
+        pending8->clear();
+    }
+    if (first < last) {
+        norm2.normalizeUTF8(0, StringPiece(s + first, last - first), sink, NULL, errorCode);
+    }
+    pending8->append(s + last, length - last, errorCode);
+}
+
+void
+StreamingNormalizer2::finishUTF8(ByteSink &sink, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (pending8 != NULL && !pending8->isEmpty()) {
+        norm2.normalizeUTF8(0, pending8->toStringPiece(), sink, NULL, errorCode);
+        pending8->clear();
+    }
+}
+
+void
+StreamingNormalizer2::reset() {
+    pending.remove();
+    if (pending8 != NULL) {
+        pending8->clear();
+    }
+}
+
 // Normalizer2 implementation for the old UNORM_NONE.
 class NoopNormalizer2 : public Normalizer2 {
     virtual ~NoopNormalizer2();
@@ -40,6 +40,7 @@
 #include "uassert.h"
 #include "ucptrie_impl.h"
 #include "uset_imp.h"
+#include "usimd.h"
 #include "uvector.h"
 
 U_NAMESPACE_BEGIN
@@ -451,6 +452,20 @@ Normalizer2Impl::init(const int32_t *inIndexes, const UCPTrie *inTrie,
     extraData=maybeYesCompositions+((MIN_NORMAL_MAYBE_YES-minMaybeYes)>>OFFSET_SHIFT);
 
     smallFCD=inSmallFCD;
+
+    for (UChar32 c = 0; c < 0x80; ++c) {
+        uint16_t norm16 = getNorm16(c);
+        uint8_t mapped = NO_ASCII_MAPPING;
+        if (isCompYesAndZeroCC(norm16)) {
+            mapped = (uint8_t)c;
+        } else if (!isMaybeOrNonZeroCC(norm16) && isDecompNoAlgorithmic(norm16)) {
+            UChar32 m = c + getAlgorithmicDelta(norm16);
+            if (0 <= m && m < 0x80 && isCompYesAndZeroCC(getNorm16(m))) {
+                mapped = (uint8_t)m;
+            }
+        }
+        asciiCompositions[c] = mapped;
+    }
 }
 
 U_CDECL_BEGIN
@@ -1737,6 +1752,12 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
     U_ASSERT(limit != nullptr);
     UnicodeString s16;
     uint8_t minNoMaybeLead = leadByteForCP(minCompNoMaybeCP);
+    // With ASCII characters that have mappings, like A-Z in NFKC_Casefold,
+    // write runs of ASCII text in one piece while mapping them.
+    // Not used with edits and for omitting unchanged text because
+    // the run is not split into changed and unchanged parts.
+    UBool mapASCIIRuns = minNoMaybeLead < 0x80 && sink != nullptr && edits == nullptr &&
+        (options & U_OMIT_UNCHANGED_TEXT) == 0;
     const uint8_t *prevBoundary = src;
 
     for (;;) {
@@ -1753,8 +1774,52 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
                 return TRUE;
             }
             if (*src < minNoMaybeLead) {
-                ++src;
+                if ((limit - src) >= UPRV_SIMD_MIN_LENGTH) {
+                    // Skip a long run of such bytes, typically ASCII or Latin-1 text,
+                    // a block at a time.
+                    src += uprv_spanBytesBelow(src, (int32_t)(limit - src), minNoMaybeLead);
+                } else {
+                    ++src;
+                }
             } else {
+                if (mapASCIIRuns && *src < 0x80) {
+                    const uint8_t *runLimit = src;
+                    while (runLimit != limit && *runLimit < 0x80 &&
+                            asciiCompositions[*runLimit] != NO_ASCII_MAPPING) {
+                        ++runLimit;
+                    }
+                    // The run must end at a boundary. All of its characters
+                    // have boundaries before them.
+                    if (runLimit != src && runLimit != limit &&
+                            !norm16HasCompBoundaryAfter(getNorm16(runLimit[-1]), onlyContiguous) &&
+                            !hasCompBoundaryBefore(runLimit, limit)) {
+                        --runLimit;
+                    }
+                    if (runLimit != src) {
+                        const uint8_t *p = src;
+                        while (p != runLimit && asciiCompositions[*p] == *p) {
+                            ++p;
+                        }
+                        if (p != runLimit) {
+                            if (prevBoundary != p &&
+                                    !ByteSinkUtil::appendUnchanged(prevBoundary, p,
+                                                                   *sink, options, edits, errorCode)) {
+                                return TRUE;
+                            }
+                            char buffer[256];
+                            while (p != runLimit) {
+                                int32_t length = 0;
+                                do {
+                                    buffer[length++] = (char)asciiCompositions[*p++];
+                                } while (p != runLimit && length < UPRV_LENGTHOF(buffer));
+                                sink->Append(buffer, length);
+                            }
+                            prevBoundary = runLimit;
+                        }
+                        src = runLimit;
+                        continue;
+                    }
+                }
                 prevSrc = src;
                 UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
                 if (!isCompYesAndZeroCC(norm16)) {
@@ -720,6 +720,11 @@ class U_COMMON_API Normalizer2Impl : public UObject {
     const uint16_t *maybeYesCompositions;
     const uint16_t *extraData;  // mappings and/or compositions for yesYes, yesNo & noNo characters
     const uint8_t *smallFCD;  // [0x100] one bit per 32 BMP code points, set if any FCD!=0
+    // For the composeUTF8() fast path when minCompNoMaybeCP<0x80, as in NFKC_Casefold:
+    // The composition of each ASCII character when that is itself or another
+    // ASCII character, both with isCompYesAndZeroCC(), otherwise NO_ASCII_MAPPING.
+    enum { NO_ASCII_MAPPING = 0xff };
+    uint8_t asciiCompositions[0x80];
 
     UInitOnce       fCanonIterDataInitOnce;
     CanonIterData  *fCanonIterData;
@@ -0,0 +1,284 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ohashmap.h
+// created: 2026oct14
+
+#ifndef __OHASHMAP_H__
+#define __OHASHMAP_H__
+
+#include "unicode/utypes.h"
+#include "unicode/uobject.h"
+#include "cmemory.h"
+#include "uassert.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * An open-addressing hash map for internal caches.
+ * Unlike UHashtable, the hash and equality functions are inlined from a traits class
+ * instead of being called through function pointers with UElement unions.
+ *
+ * The slots are in groups of 8. Each slot has a control byte that is either
+ * empty, deleted, or the top 7 bits of the (mixed) hash code of its key.
+ * A lookup compares those 7 bits with all 8 control bytes of a group at once,
+ * compares keys only in the slots that match, and stops at the first group
+ * with an empty slot.
+ * This is the layout of Abseil's "Swiss tables", with 64-bit integer operations
+ * instead of SIMD instructions.
+ *
+ * Keys and values are copied with assignment and are never destroyed;
+ * they should be pointers or other small plain values.
+ * The map does not delete what they point to.
+ *
+ * The Traits class must have these static functions:
+ * <pre>
+ *     static int32_t hash(const K &key);
+ *     static UBool equals(const K &key1, const K &key2);
+ * </pre>
+ *
+ * Adding entries may move all entries, which invalidates Entry pointers
+ * and iteration positions. Removing entries does not move the others.
+ *
+ * OpenHashMap is an INTERNAL CLASS. It is not thread-safe.
+ */
+template<typename K, typename V, typename Traits>
+class OpenHashMap : public UMemory {
+public:
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    OpenHashMap() : fCtrl(nullptr), fEntries(nullptr), fMask(-1), fCount(0), fDeleted(0) {}
+
+    ~OpenHashMap() {
+        uprv_free(fCtrl);
+        uprv_free(fEntries);
+    }
+
+    /** @return the number of entries */
+    int32_t count() const { return fCount; }
+
+    /**
+     * @return the entry with a key equal to the given one, or nullptr
+     */
+    Entry *find(const K &key) const {
+        if (fCount == 0) {
+            return nullptr;
+        }
+        uint32_t hash = mixHash(key);
+        uint8_t h2 = (uint8_t)(hash >> 25);
+        int32_t groupMask = fMask >> 3;
+        int32_t group = (int32_t)hash & groupMask;
+        for (int32_t step = 1;; ++step) {
+            const uint8_t *ctrl = fCtrl + group * 8;
+            uint64_t bits = loadGroup(ctrl);
+            for (uint64_t matches = matchByte(bits, h2); matches != 0; matches &= matches - 1) {
+                int32_t i = group * 8 + lowestIndex(matches);
+                // matchByte() can report a false, but full, neighbor of a match.
+                if (fCtrl[i] == h2 && Traits::equals(fEntries[i].key, key)) {
+                    return fEntries + i;
+                }
+            }
+            if (matchEmpty(bits) != 0 || step > groupMask) {
+                return nullptr;
+            }
+            group = (group + step) & groupMask;  // Triangular probing visits all groups.
+        }
+    }
+
+    /**
+     * @return the value for the key, or a default-constructed V if there is none
+     */
+    V get(const K &key) const {
+        Entry *entry = find(key);
+        return entry != nullptr ? entry->value : V();
+    }
+
+    /**
+     * Sets the value for a key, adding an entry if there is none for an equal key yet.
+     * @return the entry, or nullptr if memory allocation failed
+     */
+    Entry *put(const K &key, const V &value, UErrorCode &errorCode) {
+        if (U_FAILURE(errorCode)) {
+            return nullptr;
+        }
+        Entry *entry = find(key);
+        if (entry == nullptr) {
+            if ((fCount + fDeleted + 1) * 8 > (fMask + 1) * 7 && !rehash(fCount + 1)) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return nullptr;
+            }
+            uint32_t hash = mixHash(key);
+            int32_t i = findFreeSlot(fCtrl, fMask, hash);
+            if (fCtrl[i] == kDeleted) {
+                --fDeleted;
+            }
+            fCtrl[i] = (uint8_t)(hash >> 25);
+            entry = fEntries + i;
+            entry->key = key;
+            ++fCount;
+        }
+        entry->value = value;
+        return entry;
+    }
+
+    /**
+     * Removes the entry for a key, if there is one.
+     * @return TRUE if an entry was removed
+     */
+    UBool remove(const K &key) {
+        Entry *entry = find(key);
+        if (entry == nullptr) {
+            return FALSE;
+        }
+        removeEntry(entry);
+        return TRUE;
+    }
+
+    /**
+     * Removes an entry that was returned by find(), put() or nextEntry().
+     * Does not move other entries, so that iteration can continue.
+     */
+    void removeEntry(const Entry *entry) {
+        int32_t i = (int32_t)(entry - fEntries);
+        U_ASSERT(0 <= i && i <= fMask && fCtrl[i] < 0x80);
+        // Lookups stop at a group with an empty slot, so while this group has one,
+        // the slot can become empty rather than deleted.
+        if (matchEmpty(loadGroup(fCtrl + (i & ~7))) != 0) {
+            fCtrl[i] = kEmpty;
+        } else {
+            fCtrl[i] = kDeleted;
+            ++fDeleted;
+        }
+        --fCount;
+    }
+
+    /**
+     * Iterates over the entries, in no particular order.
+     * @param pos start with -1 (UHASH_FIRST), and pass the same variable to each call
+     * @return the next entry, or nullptr at the end
+     */
+    Entry *nextEntry(int32_t &pos) const {
+        while (++pos <= fMask) {
+            if (fCtrl[pos] < 0x80) {
+                return fEntries + pos;
+            }
+        }
+        pos = fMask;
+        return nullptr;
+    }
+
+    /** Removes all entries, keeping the memory. */
+    void removeAll() {
+        if (fCtrl != nullptr) {
+            uprv_memset(fCtrl, kEmpty, fMask + 1);
+        }
+        fCount = fDeleted = 0;
+    }
+
+private:
+    OpenHashMap(const OpenHashMap &other) = delete;
+    OpenHashMap &operator=(const OpenHashMap &other) = delete;
+
+    static const uint8_t kEmpty = 0x80;
+    static const uint8_t kDeleted = 0xfe;
+
+    static uint32_t mixHash(const K &key) {
+        // Spreads hash codes with few varying bits, like small integers or
+        // short strings, over the group index bits and the top 7 bits.
+        uint32_t hash = (uint32_t)Traits::hash(key) * 0x9e3779b1u;
+        return hash ^ (hash >> 16);
+    }
+
+    static uint64_t loadGroup(const uint8_t *ctrl) {
+        uint64_t bits;
+        uprv_memcpy(&bits, ctrl, 8);
+        return bits;
+    }
+
+    // Each of these sets the high bit of each byte of the group that matches.
+    static uint64_t matchByte(uint64_t bits, uint8_t h2) {
+        uint64_t x = bits ^ (0x0101010101010101ULL * h2);
+        return (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL;
+    }
+    static uint64_t matchEmpty(uint64_t bits) {
+        // kEmpty is the only control byte with the high bit set and bit 1 clear.
+        return bits & (~bits << 6) & 0x8080808080808080ULL;
+    }
+    static uint64_t matchEmptyOrDeleted(uint64_t bits) {
+        return bits & 0x8080808080808080ULL;
+    }
+
+    // Index in the group of the lowest set match bit.
+    static int32_t lowestIndex(uint64_t matches) {
+#if (defined(__GNUC__) && U_GCC_MAJOR_MINOR >= 304) || defined(__clang__)
+        int32_t bit = __builtin_ctzll(matches);
+#else
+        int32_t bit = 7;
+        while ((matches & ((uint64_t)1 << bit)) == 0) {
+            bit += 8;
+        }
+#endif
+#if U_IS_BIG_ENDIAN
+        return 7 - (bit >> 3);
+#else
+        return bit >> 3;
+#endif
+    }
+
+    static int32_t findFreeSlot(const uint8_t *ctrl, int32_t mask, uint32_t hash) {
+        int32_t groupMask = mask >> 3;
+        int32_t group = (int32_t)hash & groupMask;
+        for (int32_t step = 1;; ++step) {
+            uint64_t matches = matchEmptyOrDeleted(loadGroup(ctrl + group * 8));
+            if (matches != 0) {
+                return group * 8 + lowestIndex(matches);
+            }
+            group = (group + step) & groupMask;
+        }
+    }
+
+    // Moves the entries into new arrays for at least minCount entries,
+    // with at most 7/16 of the slots in use.
+    UBool rehash(int32_t minCount) {
+        int32_t capacity = 8;
+        while (capacity * 7 < minCount * 16) {
+            capacity *= 2;
+        }
+        uint8_t *ctrl = (uint8_t *)uprv_malloc(capacity);
+        Entry *entries = (Entry *)uprv_malloc(capacity * sizeof(Entry));
+        if (ctrl == nullptr || entries == nullptr) {
+            uprv_free(ctrl);
+            uprv_free(entries);
+            return FALSE;
+        }
+        uprv_memset(ctrl, kEmpty, capacity);
+        for (int32_t i = 0; i <= fMask; ++i) {
+            if (fCtrl[i] < 0x80) {
+                uint32_t hash = mixHash(fEntries[i].key);
+                int32_t j = findFreeSlot(ctrl, capacity - 1, hash);
+                ctrl[j] = (uint8_t)(hash >> 25);
+                entries[j] = fEntries[i];
+            }
+        }
+        uprv_free(fCtrl);
+        uprv_free(fEntries);
+        fCtrl = ctrl;
+        fEntries = entries;
+        fMask = capacity - 1;
+        fDeleted = 0;
+        return TRUE;
+    }
+
+    uint8_t *fCtrl;     // fMask+1 control bytes
+    Entry *fEntries;    // fMask+1 slots, filled where the control byte is < 0x80
+    int32_t fMask;      // number of slots - 1, with a power-of-2 number of slots >= 8
+    int32_t fCount;     // number of entries
+    int32_t fDeleted;   // number of deleted slots
+};
+
+U_NAMESPACE_END
+
+#endif  // __OHASHMAP_H__
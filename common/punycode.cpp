@@ -42,6 +42,8 @@ Disclaimer and license
  * - ICU string buffer handling with implicit source lengths
  *   and destination preflighting
  * - UTF-16 handling
+ * - UTF-8 input for the encoder
+ * - Encoder sorts the extended code points once instead of rescanning per delta
  */
 
 #include "unicode/utypes.h"
@@ -51,10 +53,12 @@ Disclaimer and license
 #include "unicode/ustring.h"
 #include "unicode/utf.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "ustr_imp.h"
 #include "cstring.h"
 #include "cmemory.h"
 #include "punycode.h"
+#include "uarrsort.h"
 #include "uassert.h"
 
 
@@ -180,6 +184,167 @@ adaptBias(int32_t delta, int32_t length, UBool firstTime) {
 
 #define MAX_CP_COUNT    200
 
+/*
+ * The encoder sorts the extended code points once, together with their
+ * positions, so that it need not rescan the input for each one.
+ * A sort key holds the code point in bits 28..8 and its position in bits 7..0.
+ */
+#define SORT_KEY_INDEX_BITS 8
+#define SORT_KEY_INDEX_MASK 0xff
+static_assert(MAX_CP_COUNT<=(SORT_KEY_INDEX_MASK+1), "positions must fit into sort keys");
+
+/* Up to this many extended code points are sorted with a simple insertion sort. */
+#define SHORT_SORT_LENGTH 32
+
+/*
+ * Counts of handled code point positions, in a Fenwick tree (binary indexed tree).
+ * handledTree[1..srcCPCount] each covers the positions below it
+ * down to the next lower multiple of its lowest set bit.
+ */
+static void
+addHandled(int16_t handledTree[], int32_t srcCPCount, int32_t index) {
+    for(++index; index<=srcCPCount; index+=index&-index) {
+        ++handledTree[index];
+    }
+}
+
+/* Returns the number of handled code points before the given position. */
+static int32_t
+countHandledBefore(const int16_t handledTree[], int32_t index) {
+    int32_t count=0;
+    for(; index>0; index&=index-1) {
+        count+=handledTree[index];
+    }
+    return count;
+}
+
+/*
+ * Encodes the extended code points after the basic ones have been output
+ * and terminated with the delimiter.
+ * cpBuffer[] contains 0 for each basic code point and
+ * each extended one with its case flag in the sign bit.
+ */
+template<typename CharType>
+static int32_t
+encodeExtended(const int32_t *cpBuffer, int32_t srcCPCount, int32_t basicLength,
+               CharType *dest, int32_t destCapacity, int32_t destLength,
+               UErrorCode *pErrorCode) {
+    int32_t sortKeys[MAX_CP_COUNT];
+    int16_t handledTree[MAX_CP_COUNT+1];
+    int32_t n, delta, handledCPCount, extendedCount, bias, j, m, q, k, t, s;
+
+    uprv_memset(handledTree, 0, (srcCPCount+1)*sizeof(handledTree[0]));
+    for(extendedCount=0, j=0; j<srcCPCount; ++j) {
+        if(cpBuffer[j]==0) {
+            addHandled(handledTree, srcCPCount, j);
+        } else {
+            sortKeys[extendedCount++]=((cpBuffer[j]&0x7fffffff)<<SORT_KEY_INDEX_BITS)|j;
+        }
+    }
+    /*
+     * Each key is unique, so the order is by code point, then by position.
+     * Labels are short, and a plain insertion sort is fastest for them.
+     */
+    if(extendedCount<=SHORT_SORT_LENGTH) {
+        for(s=1; s<extendedCount; ++s) {
+            int32_t key=sortKeys[s];
+            for(j=s; j>0 && sortKeys[j-1]>key; --j) {
+                sortKeys[j]=sortKeys[j-1];
+            }
+            sortKeys[j]=key;
+        }
+    } else {
+        uprv_sortArray(sortKeys, extendedCount, (int32_t)sizeof(sortKeys[0]),
+                       uprv_int32Comparator, NULL, FALSE, pErrorCode);
+        if(U_FAILURE(*pErrorCode)) {
+            return 0;
+        }
+    }
+
+    /*
+     * handledCPCount is the number of code points that have been handled
+     * basicLength is the number of basic code points
+     * destLength is the number of chars that have been output
+     */
+
+    /* Initialize the state: */
+    n=INITIAL_N;
+    delta=0;
+    bias=INITIAL_BIAS;
+    handledCPCount=basicLength;
+
+    /* Main encoding loop: */
+    for(s=0; s<extendedCount; /* no op */) {
+        /*
+         * All non-basic code points < n have been handled already.
+         * The next larger one is next in sort order.
+         */
+        int32_t roundStart=s, roundHandledCount=handledCPCount, handledBefore=0;
+        m=sortKeys[s]>>SORT_KEY_INDEX_BITS;
+
+        /*
+         * Increase delta enough to advance the decoder's
+         * <n,i> state to <m,0>, but guard against overflow:
+         */
+        if(m-n>(0x7fffffff-MAX_CP_COUNT-delta)/(handledCPCount+1)) {
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+            return 0;
+        }
+        delta+=(m-n)*(handledCPCount+1);
+        n=m;
+
+        /*
+         * Encode a sequence of same code points n.
+         * Up to each one, delta counts the code points <n from the previous one.
+         */
+        for(; s<extendedCount && (sortKeys[s]>>SORT_KEY_INDEX_BITS)==n; ++s) {
+            j=sortKeys[s]&SORT_KEY_INDEX_MASK;
+            int32_t count=countHandledBefore(handledTree, j);
+            delta+=count-handledBefore;
+            handledBefore=count;
+
+            /* Represent delta as a generalized variable-length integer: */
+            for(q=delta, k=BASE; /* no condition */; k+=BASE) {
+                t=k-bias;
+                if(t<TMIN) {
+                    t=TMIN;
+                } else if(k>=(bias+TMAX)) {
+                    t=TMAX;
+                }
+
+                if(q<t) {
+                    break;
+                }
+
+                if(destLength<destCapacity) {
+                    dest[destLength]=digitToBasic(t+(q-t)%(BASE-t), 0);
+                }
+                ++destLength;
+                q=(q-t)/(BASE-t);
+            }
+
+            if(destLength<destCapacity) {
+                dest[destLength]=digitToBasic(q, (UBool)(cpBuffer[j]<0));
+            }
+            ++destLength;
+            bias=adaptBias(delta, handledCPCount+1, (UBool)(handledCPCount==basicLength));
+            delta=0;
+            ++handledCPCount;
+        }
+
+        /* Count the code points <n after the last one, then mark this round's as handled. */
+        delta+=roundHandledCount-handledBefore;
+        for(; roundStart<s; ++roundStart) {
+            addHandled(handledTree, srcCPCount, sortKeys[roundStart]&SORT_KEY_INDEX_MASK);
+        }
+
+        ++delta;
+        ++n;
+    }
+
+    return destLength;
+}
+
 U_CFUNC int32_t
 u_strToPunycode(const UChar *src, int32_t srcLength,
                 UChar *dest, int32_t destCapacity,
@@ -187,7 +352,7 @@ u_strToPunycode(const UChar *src, int32_t srcLength,
                 UErrorCode *pErrorCode) {
 
     int32_t cpBuffer[MAX_CP_COUNT];
-    int32_t n, delta, handledCPCount, basicLength, destLength, bias, j, m, q, k, t, srcCPCount;
+    int32_t n, basicLength, destLength, j, srcCPCount;
     UChar c, c2;
 
     /* argument checking */
@@ -284,93 +449,77 @@ u_strToPunycode(const UChar *src, int32_t srcLength,
         ++destLength;
     }
 
-    /*
-     * handledCPCount is the number of code points that have been handled
-     * basicLength is the number of basic code points
-     * destLength is the number of chars that have been output
-     */
+    destLength=encodeExtended(cpBuffer, srcCPCount, basicLength,
+                              dest, destCapacity, destLength, pErrorCode);
+    return u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
+}
 
-    /* Initialize the state: */
-    n=INITIAL_N;
-    delta=0;
-    bias=INITIAL_BIAS;
+U_CFUNC int32_t
+u_strToPunycodeUTF8(const char *src, int32_t srcLength,
+                    char *dest, int32_t destCapacity,
+                    const UBool *caseFlags,
+                    UErrorCode *pErrorCode) {
+    int32_t cpBuffer[MAX_CP_COUNT];
+    int32_t basicLength, destLength, i, start, srcCPCount;
+    UChar32 c;
 
-    /* Main encoding loop: */
-    for(handledCPCount=basicLength; handledCPCount<srcCPCount; /* no op */) {
-        /*
-         * All non-basic code points < n have been handled already.
-         * Find the next larger one:
-         */
-        for(m=0x7fffffff, j=0; j<srcCPCount; ++j) {
-            q=cpBuffer[j]&0x7fffffff; /* remove case flag from the sign bit */
-            if(n<=q && q<m) {
-                m=q;
-            }
-        }
+    /* argument checking */
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
 
-        /*
-         * Increase delta enough to advance the decoder's
-         * <n,i> state to <m,0>, but guard against overflow:
-         */
-        if(m-n>(0x7fffffff-MAX_CP_COUNT-delta)/(handledCPCount+1)) {
-            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
-            return 0;
-        }
-        delta+=(m-n)*(handledCPCount+1);
-        n=m;
+    if(src==NULL || srcLength<-1 || (dest==NULL && destCapacity!=0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
 
-        /* Encode a sequence of same code points n */
-        for(j=0; j<srcCPCount; ++j) {
-            q=cpBuffer[j]&0x7fffffff; /* remove case flag from the sign bit */
-            if(q<n) {
-                ++delta;
-            } else if(q==n) {
-                /* Represent delta as a generalized variable-length integer: */
-                for(q=delta, k=BASE; /* no condition */; k+=BASE) {
-
-                    /** RAM: comment out the old code for conformance with draft-ietf-idn-punycode-03.txt
-
-                    t=k-bias;
-                    if(t<TMIN) {
-                        t=TMIN;
-                    } else if(t>TMAX) {
-                        t=TMAX;
-                    }
-                    */
-
-                    t=k-bias;
-                    if(t<TMIN) {
-                        t=TMIN;
-                    } else if(k>=(bias+TMAX)) {
-                        t=TMAX;
-                    }
-
-                    if(q<t) {
-                        break;
-                    }
-
-                    if(destLength<destCapacity) {
-                        dest[destLength]=digitToBasic(t+(q-t)%(BASE-t), 0);
-                    }
-                    ++destLength;
-                    q=(q-t)/(BASE-t);
-                }
+    if(srcLength==-1) {
+        srcLength=(int32_t)uprv_strlen(src);
+    }
 
-                if(destLength<destCapacity) {
-                    dest[destLength]=digitToBasic(q, (UBool)(cpBuffer[j]<0));
-                }
-                ++destLength;
-                bias=adaptBias(delta, handledCPCount+1, (UBool)(handledCPCount==basicLength));
-                delta=0;
-                ++handledCPCount;
+    /*
+     * Handle the basic code points and
+     * convert extended ones to UTF-32 in cpBuffer (caseFlag in sign bit):
+     */
+    srcCPCount=destLength=0;
+    for(i=0; i<srcLength;) {
+        if(srcCPCount==MAX_CP_COUNT) {
+            /* too many input code points */
+            *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        start=i;
+        U8_NEXT(src, i, srcLength, c);
+        if(c<0) {
+            /* error: ill-formed UTF-8 */
+            *pErrorCode=U_INVALID_CHAR_FOUND;
+            return 0;
+        } else if(IS_BASIC(c)) {
+            cpBuffer[srcCPCount++]=0;
+            if(destLength<destCapacity) {
+                dest[destLength]=
+                    caseFlags!=NULL ?
+                        asciiCaseMap((char)c, caseFlags[start]) :
+                        (char)c;
             }
+            ++destLength;
+        } else {
+            cpBuffer[srcCPCount++]=((caseFlags!=NULL && caseFlags[start])<<31L)|c;
         }
+    }
 
-        ++delta;
-        ++n;
+    /* Finish the basic string - if it is not empty - with a delimiter. */
+    basicLength=destLength;
+    if(basicLength>0) {
+        if(destLength<destCapacity) {
+            dest[destLength]=DELIMITER;
+        }
+        ++destLength;
     }
 
-    return u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
+    destLength=encodeExtended(cpBuffer, srcCPCount, basicLength,
+                              dest, destCapacity, destLength, pErrorCode);
+    return u_terminateChars(dest, destCapacity, destLength, pErrorCode);
 }
 
 U_CFUNC int32_t
@@ -71,6 +71,35 @@ u_strToPunycode(const UChar *src, int32_t srcLength,
                 const UBool *caseFlags,
                 UErrorCode *pErrorCode);
 
+/**
+ * u_strToPunycodeUTF8() converts UTF-8 to Punycode.
+ * Same as u_strToPunycode() but with UTF-8 input and char output.
+ *
+ * @param src Input UTF-8 string.
+ *            This function handles the same limited amount of code points
+ *            as u_strToPunycode().
+ * @param srcLength Number of bytes in src, or -1 if NUL-terminated.
+ * @param dest Output Punycode array.
+ * @param destCapacity Size of dest.
+ * @param caseFlags Vector of boolean values, one per input byte,
+ *                  with the same meaning as for u_strToPunycode().
+ *                  Flags corresponding to UTF-8 trail bytes are ignored.
+ *                  If caseFlags==NULL then input characters are not
+ *                  case-mapped.
+ * @param pErrorCode ICU in/out error code parameter.
+ *                   U_INVALID_CHAR_FOUND if src is not well-formed UTF-8.
+ *                   U_INDEX_OUTOFBOUNDS_ERROR if src contains
+ *                   too many code points.
+ * @return Number of ASCII characters in puny.
+ *
+ * @see u_strToPunycode
+ */
+U_CFUNC int32_t
+u_strToPunycodeUTF8(const char *src, int32_t srcLength,
+                    char *dest, int32_t destCapacity,
+                    const UBool *caseFlags,
+                    UErrorCode *pErrorCode);
+
 /**
  * u_strFromPunycode() converts Punycode to Unicode.
  * The Unicode string will be at most as long (in UChars)
@@ -139,6 +139,7 @@ RuleBasedBreakIterator::RuleBasedBreakIterator( const UnicodeString  &rules,
                                                 UErrorCode           &status)
  : fSCharIter(UnicodeString())
 {
+    MemoryTagScope memoryTag(UMEM_TAG_BREAK_ITERATION);
     init(status);
     if (U_FAILURE(status)) {return;}
     RuleBasedBreakIterator *bi = (RuleBasedBreakIterator *)
@@ -755,15 +756,38 @@ struct LookAheadResults {
 //-----------------------------------------------------------------------------------
 //
 //  handleNext()
-//     Run the state machine to find a boundary
+//     Run the state machine to find a boundary.
+//     The state machine is instantiated for each row width of the state tables,
+//     RBBIStateTableRow8 and RBBIStateTableRow16, and for UTF-8 text in memory.
 //
 //-----------------------------------------------------------------------------------
 int32_t RuleBasedBreakIterator::handleNext() {
+    // handleNext alway sets the break tag value.
+    // Set the default for it.
+    fRuleStatusIndex = 0;
+
+    fDictionaryCharCount = 0;
+
+    UBool use8Bits = (fData->fForwardTable->fFlags & RBBI_8BITS_ROWS) != 0;
+
+    // UTF-8 text in memory is read directly, without the UText access functions.
+    const char *utf8 = utext_getUTF8(&fText);
+    if (utf8 != NULL) {
+        const uint8_t *s = (const uint8_t *)utf8;
+        int32_t length = (int32_t)utext_nativeLength(&fText);
+        return use8Bits ? handleNextUTF8<RBBIStateTableRow8>(s, length) :
+                          handleNextUTF8<RBBIStateTableRow16>(s, length);
+    }
+    return use8Bits ? handleNextUText<RBBIStateTableRow8>() : handleNextUText<RBBIStateTableRow16>();
+}
+
+template <typename RowType>
+int32_t RuleBasedBreakIterator::handleNextUText() {
     int32_t             state;
     uint16_t            category        = 0;
     RBBIRunMode         mode;
 
-    RBBIStateTableRow  *row;
+    const RowType      *row;
     UChar32             c;
     LookAheadResults    lookAheadMatches;
     int32_t             result             = 0;
@@ -777,12 +801,6 @@ int32_t RuleBasedBreakIterator::handleNext() {
         }
     #endif
 
-    // handleNext alway sets the break tag value.
-    // Set the default for it.
-    fRuleStatusIndex = 0;
-
-    fDictionaryCharCount = 0;
-
     // if we're already at the end of the text, return DONE.
     initialPosition = fPosition;
     UTEXT_SETNATIVEINDEX(&fText, initialPosition);
@@ -795,7 +813,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
 
     //  Set the initial state for the state machine
     state = START_STATE;
-    row = (RBBIStateTableRow *)
+    row = (const RowType *)
             //(statetable->fTableData + (statetable->fRowLen * state));
             (tableData + tableRowLen * state);
 
@@ -866,7 +884,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         // fNextState is a variable-length array.
         U_ASSERT(category<fData->fHeader->fCatCount);
         state = row->fNextState[category];  /*Not accessing beyond memory*/
-        row = (RBBIStateTableRow *)
+        row = (const RowType *)
             // (statetable->fTableData + (statetable->fRowLen * state));
             (tableData + tableRowLen * state);
 
@@ -939,6 +957,209 @@ int32_t RuleBasedBreakIterator::handleNext() {
 }
 
 
+//-----------------------------------------------------------------------------------
+//
+//  handleNextUTF8()
+//     handleNext() for UTF-8 text in memory. Looks up the character categories
+//     with the UTrie2 UTF-8 macros, and tracks the position as a byte index, which
+//     is the native index of the UTF-8 UText. Ill-formed sequences are treated
+//     as U+FFFD, one per maximal subpart, as in the UText.
+//
+//-----------------------------------------------------------------------------------
+static inline uint16_t nextCategoryUTF8(const UTrie2 *trie, const uint8_t *s,
+                                        const uint8_t *&p, const uint8_t *limit) {
+    const uint8_t *start = p;
+    uint16_t category;
+    UTRIE2_U8_NEXT16(trie, p, limit, category);
+    if (category == trie->errorValue) {
+        // Possibly an ill-formed sequence, which has the category of U+FFFD.
+        int32_t i = (int32_t)(start - s);
+        UChar32 c;
+        U8_NEXT_OR_FFFD(s, i, (int32_t)(limit - s), c);
+        p = s + i;
+        category = UTRIE2_GET16(trie, c);
+    }
+    return category;
+}
+
+template <typename RowType>
+int32_t RuleBasedBreakIterator::handleNextUTF8(const uint8_t *s, int32_t length) {
+    int32_t             state;
+    uint16_t            category        = 0;
+    uint16_t            charCategory;      // The category of the last character read.
+    UBool               atEnd           = FALSE;
+    RBBIRunMode         mode;
+
+    const RowType      *row;
+    LookAheadResults    lookAheadMatches;
+    int32_t             result             = 0;
+    int32_t             initialPosition    = 0;
+    const RBBIStateTable *statetable       = fData->fForwardTable;
+    const char         *tableData          = statetable->fTableData;
+    uint32_t            tableRowLen        = statetable->fRowLen;
+    const UTrie2       *trie               = fData->fTrie;
+    const uint8_t      *limit              = s + length;
+    const uint8_t      *p;                 // Following the last character read.
+    #ifdef RBBI_DEBUG
+        if (gTrace) {
+            RBBIDebugPuts("Handle Next UTF-8   pos   state category");
+        }
+    #endif
+
+    // if we're already at the end of the text, return DONE.
+    //   Like utext_setNativeIndex(), a position within a character moves to its start.
+    initialPosition = fPosition;
+    if (initialPosition < 0) {
+        initialPosition = 0;
+    } else if (initialPosition > length) {
+        initialPosition = length;
+    } else if (initialPosition < length) {
+        U8_SET_CP_START(s, 0, initialPosition);
+    }
+    result = initialPosition;
+    p = s + initialPosition;
+    if (p == limit) {
+        fDone = TRUE;
+        return UBRK_DONE;
+    }
+    charCategory = nextCategoryUTF8(trie, s, p, limit);
+
+    //  Set the initial state for the state machine
+    state = START_STATE;
+    row = (const RowType *)
+            (tableData + tableRowLen * state);
+
+
+    mode     = RBBI_RUN;
+    if (statetable->fFlags & RBBI_BOF_REQUIRED) {
+        category = 2;
+        mode     = RBBI_START;
+    }
+
+
+    // loop until we reach the end of the text or transition to state 0
+    //
+    for (;;) {
+        if (atEnd) {
+            // Reached end of input string.
+            if (mode == RBBI_END) {
+                // We have already run the loop one last time with the
+                //   character set to the psueudo {eof} value.  Now it is time
+                //   to unconditionally bail out.
+                break;
+            }
+            // Run the loop one last time with the fake end-of-input character category.
+            mode = RBBI_END;
+            category = 1;
+        }
+
+        //
+        // Get the char category.  An incoming category of 1 or 2 means that
+        //      we are preset for doing the beginning or end of input, and
+        //      that we shouldn't get a category from an actual text input character.
+        //
+        if (mode == RBBI_RUN) {
+            category = charCategory;
+
+            // Check the dictionary bit in the character's category.
+            //    Counter is only used by dictionary based iteration.
+            //    Chars that need to be handled by a dictionary have a flag bit set
+            //    in their category values.
+            //
+            if ((category & 0x4000) != 0)  {
+                fDictionaryCharCount++;
+                //  And off the dictionary flag bit.
+                category &= ~0x4000;
+            }
+        }
+
+       #ifdef RBBI_DEBUG
+            if (gTrace) {
+                RBBIDebugPrintf("             %4d   ", (int32_t)(p - s));
+                RBBIDebugPrintf("%3d  %3d\n", state, category);
+            }
+        #endif
+
+        // State Transition - move machine to its next state
+        //
+
+        // fNextState is a variable-length array.
+        U_ASSERT(category<fData->fHeader->fCatCount);
+        state = row->fNextState[category];  /*Not accessing beyond memory*/
+        row = (const RowType *)
+            (tableData + tableRowLen * state);
+
+
+        if (row->fAccepting == -1) {
+            // Match found, common case.
+            if (mode != RBBI_START) {
+                result = (int32_t)(p - s);
+            }
+            fRuleStatusIndex = row->fTagIdx;   // Remember the break status (tag) values.
+        }
+
+        int16_t completedRule = row->fAccepting;
+        if (completedRule > 0) {
+            // Lookahead match is completed.
+            int32_t lookaheadResult = lookAheadMatches.getPosition(completedRule);
+            if (lookaheadResult >= 0) {
+                fRuleStatusIndex = row->fTagIdx;
+                fPosition = lookaheadResult;
+                return lookaheadResult;
+            }
+        }
+        int16_t rule = row->fLookAhead;
+        if (rule != 0) {
+            // At the position of a '/' in a look-ahead match. Record it.
+            int32_t  pos = (int32_t)(p - s);
+            lookAheadMatches.setPosition(rule, pos);
+        }
+
+        if (state == STOP_STATE) {
+            // This is the normal exit from the lookup state machine.
+            // We have advanced through the string until it is certain that no
+            //   longer match is possible, no matter what characters follow.
+            break;
+        }
+
+        // Advance to the next character.
+        // If this is a beginning-of-input loop iteration, don't advance
+        //    the input position.  The next iteration will be processing the
+        //    first real input character.
+        if (mode == RBBI_RUN) {
+            if (p == limit) {
+                atEnd = TRUE;
+            } else {
+                charCategory = nextCategoryUTF8(trie, s, p, limit);
+            }
+        } else {
+            if (mode == RBBI_START) {
+                mode = RBBI_RUN;
+            }
+        }
+    }
+
+    // The state machine is done.  Check whether it found a match...
+
+    // If the iterator failed to advance in the match engine, force it ahead by one.
+    //   (This really indicates a defect in the break rules.  They should always match
+    //    at least one character.)
+    if (result == initialPosition) {
+        U8_FWD_1(s, result, length);
+        fRuleStatusIndex = 0;
+    }
+
+    // Leave the iterator at our result position.
+    fPosition = result;
+    #ifdef RBBI_DEBUG
+        if (gTrace) {
+            RBBIDebugPrintf("result = %d\n\n", result);
+        }
+    #endif
+    return result;
+}
+
+
 //-----------------------------------------------------------------------------------
 //
 //  handleSafePrevious()
@@ -949,9 +1170,16 @@ int32_t RuleBasedBreakIterator::handleNext() {
 //
 //-----------------------------------------------------------------------------------
 int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
+    return (fData->fReverseTable->fFlags & RBBI_8BITS_ROWS) != 0 ?
+        handleSafePreviousUText<RBBIStateTableRow8>(fromPosition) :
+        handleSafePreviousUText<RBBIStateTableRow16>(fromPosition);
+}
+
+template <typename RowType>
+int32_t RuleBasedBreakIterator::handleSafePreviousUText(int32_t fromPosition) {
     int32_t             state;
     uint16_t            category        = 0;
-    RBBIStateTableRow  *row;
+    const RowType      *row;
     UChar32             c;
     int32_t             result          = 0;
 
@@ -971,7 +1199,7 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
     //  Set the initial state for the state machine
     c = UTEXT_PREVIOUS32(&fText);
     state = START_STATE;
-    row = (RBBIStateTableRow *)
+    row = (const RowType *)
             (stateTable->fTableData + (stateTable->fRowLen * state));
 
     // loop until we reach the start of the text or transition to state 0
@@ -1004,7 +1232,7 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
         // fNextState is a variable-length array.
         U_ASSERT(category<fData->fHeader->fCatCount);
         state = row->fNextState[category];  /*Not accessing beyond memory*/
-        row = (RBBIStateTableRow *)
+        row = (const RowType *)
             (stateTable->fTableData + (stateTable->fRowLen * state));
 
         if (state == STOP_STATE) {
@@ -1024,6 +1252,74 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
     return result;
 }
 
+//-------------------------------------------------------------------------------
+//
+//   getBoundaries()   All boundaries in a range of text, in one call.
+//                     Boundaries come from handleNext() and the dictionary cache,
+//                     as in BreakCache::populateFollowing(), but are not added to
+//                     the break cache.
+//
+//-------------------------------------------------------------------------------
+int32_t RuleBasedBreakIterator::getBoundaries(int32_t start, int32_t limit,
+                                              int32_t *boundaries, int32_t *ruleStatuses,
+                                              int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (boundaries == NULL && capacity > 0) || start > limit) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t textLength = (int32_t)utext_nativeLength(&fText);
+    if (start < 0) {
+        start = 0;
+    }
+    if (limit > textLength) {
+        limit = textLength;
+    }
+    int32_t pos = start == 0 ? first() : following(start - 1);
+    int32_t ruleStatusIdx = fRuleStatusIndex;
+    int32_t count = 0;
+    int32_t last = UBRK_DONE;
+    while (pos != UBRK_DONE && pos <= limit) {
+        if (count < capacity) {
+            boundaries[count] = pos;
+            if (ruleStatuses != NULL) {
+                ruleStatuses[count] =
+                    fData->fRuleStatusTable[ruleStatusIdx + fData->fRuleStatusTable[ruleStatusIdx]];
+            }
+        }
+        ++count;
+        last = pos;
+        if (pos == limit) {
+            break;
+        }
+
+        int32_t fromRuleStatusIdx = ruleStatusIdx;
+        if (!fDictionaryCache->following(pos, &pos, &ruleStatusIdx)) {
+            int32_t fromPosition = pos;
+            fPosition = pos;
+            pos = handleNext();
+            ruleStatusIdx = fRuleStatusIndex;
+            if (pos != UBRK_DONE && fDictionaryCharCount > 0) {
+                // The text segment obtained from the rules includes dictionary characters.
+                fDictionaryCache->populateDictionary(fromPosition, pos, fromRuleStatusIdx,
+                                                     ruleStatusIdx);
+                fDictionaryCache->following(fromPosition, &pos, &ruleStatusIdx);
+            }
+        }
+    }
+
+    // Leave the iterator, and its break cache, at the last boundary.
+    if (last != UBRK_DONE) {
+        isBoundary(last);
+    }
+    if (count > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
 //-------------------------------------------------------------------------------
 //
 //   getRuleStatus()   Return the break rule tag associated with the current
@@ -67,7 +67,7 @@ RBBIDataWrapper::RBBIDataWrapper(UDataMemory* udm, UErrorCode &status) {
 }
 
 UBool RBBIDataWrapper::isDataVersionAcceptable(const UVersionInfo version) {
-    return RBBI_DATA_FORMAT_VERSION[0] == version[0];
+    return version[0] == RBBI_DATA_FORMAT_VERSION[0] || version[0] == 5;
 }
 
 
@@ -236,12 +236,21 @@ void  RBBIDataWrapper::printTable(const char *heading, const RBBIStateTable *tab
         RBBIDebugPrintf("         N U L L   T A B L E\n\n");
         return;
     }
+    UBool use8Bits = (table->fFlags & RBBI_8BITS_ROWS) != 0;
     for (s=0; s<table->fNumStates; s++) {
-        RBBIStateTableRow *row = (RBBIStateTableRow *)
-                                  (table->fTableData + (table->fRowLen * s));
-        RBBIDebugPrintf("%4d  |  %3d %3d %3d ", s, row->fAccepting, row->fLookAhead, row->fTagIdx);
-        for (c=0; c<fHeader->fCatCount; c++)  {
-            RBBIDebugPrintf("%3d ", row->fNextState[c]);
+        const char *rowBytes = table->fTableData + (table->fRowLen * s);
+        if (use8Bits) {
+            const RBBIStateTableRow8 *row = (const RBBIStateTableRow8 *)rowBytes;
+            RBBIDebugPrintf("%4d  |  %3d %3d %3d ", s, row->fAccepting, row->fLookAhead, row->fTagIdx);
+            for (c=0; c<fHeader->fCatCount; c++)  {
+                RBBIDebugPrintf("%3d ", row->fNextState[c]);
+            }
+        } else {
+            const RBBIStateTableRow16 *row = (const RBBIStateTableRow16 *)rowBytes;
+            RBBIDebugPrintf("%4d  |  %3d %3d %3d ", s, row->fAccepting, row->fLookAhead, row->fTagIdx);
+            for (c=0; c<fHeader->fCatCount; c++)  {
+                RBBIDebugPrintf("%3d ", row->fNextState[c]);
+            }
         }
         RBBIDebugPrintf("\n");
     }
@@ -273,6 +282,32 @@ void  RBBIDataWrapper::printData() {
 U_NAMESPACE_END
 U_NAMESPACE_USE
 
+//-----------------------------------------------------------------------------
+//
+//  swapStateTable   -  byte swap of one state table.
+//                      The table begins with several 32 bit fields, followed by
+//                      rows of 16 bit values, or of bytes that need no swapping.
+//
+//-----------------------------------------------------------------------------
+
+static void
+swapStateTable(const UDataSwapper *ds, const uint8_t *inBytes, int32_t tableLength, uint8_t *outBytes,
+               UErrorCode *status) {
+    const RBBIStateTable *inTable = (const RBBIStateTable *)inBytes;
+    int32_t topSize = offsetof(RBBIStateTable, fTableData);
+    UBool use8Bits = (ds->readUInt32(inTable->fFlags) & RBBI_8BITS_ROWS) != 0;
+
+    ds->swapArray32(ds, inBytes, topSize, outBytes, status);
+    if (use8Bits) {
+        if (inBytes != outBytes) {
+            uprv_memmove(outBytes+topSize, inBytes+topSize, tableLength-topSize);
+        }
+    } else {
+        ds->swapArray16(ds, inBytes+topSize, tableLength-topSize,
+                            outBytes+topSize, status);
+    }
+}
+
 //-----------------------------------------------------------------------------
 //
 //  ubrk_swap   -  byte swap and char encoding swap of RBBI data
@@ -371,21 +406,13 @@ ubrk_swap(const UDataSwapper *ds, const void *inData, int32_t length, void *outD
         uprv_memset(outBytes, 0, breakDataLength);
     }
 
-    //
-    // Each state table begins with several 32 bit fields.  Calculate the size
-    //   in bytes of these.
-    //
-    int32_t         topSize = offsetof(RBBIStateTable, fTableData);
-
     // Forward state table.  
     tableStartOffset = ds->readUInt32(rbbiDH->fFTable);
     tableLength      = ds->readUInt32(rbbiDH->fFTableLen);
 
     if (tableLength > 0) {
-        ds->swapArray32(ds, inBytes+tableStartOffset, topSize, 
-                            outBytes+tableStartOffset, status);
-        ds->swapArray16(ds, inBytes+tableStartOffset+topSize, tableLength-topSize,
-                            outBytes+tableStartOffset+topSize, status);
+        swapStateTable(ds, inBytes+tableStartOffset, tableLength,
+                           outBytes+tableStartOffset, status);
     }
     
     // Reverse state table.  Same layout as forward table, above.
@@ -393,10 +420,8 @@ ubrk_swap(const UDataSwapper *ds, const void *inData, int32_t length, void *outD
     tableLength      = ds->readUInt32(rbbiDH->fRTableLen);
 
     if (tableLength > 0) {
-        ds->swapArray32(ds, inBytes+tableStartOffset, topSize, 
-                            outBytes+tableStartOffset, status);
-        ds->swapArray16(ds, inBytes+tableStartOffset+topSize, tableLength-topSize,
-                            outBytes+tableStartOffset+topSize, status);
+        swapStateTable(ds, inBytes+tableStartOffset, tableLength,
+                           outBytes+tableStartOffset, status);
     }
 
     // Trie table for character categories
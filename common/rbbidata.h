@@ -58,7 +58,9 @@ ubrk_swap(const UDataSwapper *ds,
 U_NAMESPACE_BEGIN
 
 // The current RBBI data format version.
-static const uint8_t RBBI_DATA_FORMAT_VERSION[] = {5, 0, 0, 0};
+// Version 6 added state tables with 8-bit rows; see RBBI_8BITS_ROWS.
+// Version 5 data, which has only 16-bit rows, is still accepted.
+static const uint8_t RBBI_DATA_FORMAT_VERSION[] = {6, 0, 0, 0};
 
 /*  
  *   The following structs map exactly onto the raw data from ICU common data file. 
@@ -94,25 +96,30 @@ struct RBBIDataHeader {
 
 
 
-struct  RBBIStateTableRow {
-    int16_t          fAccepting;    /*  Non-zero if this row is for an accepting state.   */
+/*
+ *   A row of a state table.  The rows of a table with the RBBI_8BITS_ROWS flag
+ *   are RBBIStateTableRow8, those of other tables RBBIStateTableRow16.
+ */
+template <typename T, typename ST>
+struct  RBBIStateTableRowT {
+    T                fAccepting;    /*  Non-zero if this row is for an accepting state.   */
                                     /*  Value 0: not an accepting state.                  */
                                     /*       -1: Unconditional Accepting state.           */
                                     /*    positive:  Look-ahead match has completed.      */
                                     /*           Actual boundary position happened earlier */
                                     /*           Value here == fLookAhead in earlier      */
                                     /*              state, at actual boundary pos.        */
-    int16_t          fLookAhead;    /*  Non-zero if this row is for a state that          */
+    T                fLookAhead;    /*  Non-zero if this row is for a state that          */
                                     /*    corresponds to a '/' in the rule source.        */
                                     /*    Value is the same as the fAccepting             */
                                     /*      value for the rule (which will appear         */
                                     /*      in a different state.                         */
-    int16_t          fTagIdx;       /*  Non-zero if this row covers a {tagged} position   */
+    T                fTagIdx;       /*  Non-zero if this row covers a {tagged} position   */
                                     /*     from a rule.  Value is the index in the        */
                                     /*     StatusTable of the set of matching             */
                                     /*     tags (rule status values)                      */
-    int16_t          fReserved;
-    uint16_t         fNextState[1]; /*  Next State, indexed by char category.             */
+    T                fReserved;
+    ST               fNextState[1]; /*  Next State, indexed by char category.             */
                                     /*    Variable-length array declared with length 1    */
                                     /*    to disable bounds checkers.                     */
                                     /*    Array Size is actually fData->fHeader->fCatCount*/
@@ -120,13 +127,16 @@ struct  RBBIStateTableRow {
                                     /*              before changing anything here.        */
 };
 
+typedef RBBIStateTableRowT<int16_t, uint16_t> RBBIStateTableRow16;
+typedef RBBIStateTableRowT<int8_t, uint8_t> RBBIStateTableRow8;
+
 
 struct RBBIStateTable {
     uint32_t         fNumStates;    /*  Number of states.                                 */
     uint32_t         fRowLen;       /*  Length of a state table row, in bytes.            */
     uint32_t         fFlags;        /*  Option Flags for this state table                 */
     uint32_t         fReserved;     /*  reserved                                          */
-    char             fTableData[1]; /*  First RBBIStateTableRow begins here.              */
+    char             fTableData[1]; /*  First RBBIStateTableRow8 or 16 begins here.       */
                                     /*    Variable-length array declared with length 1    */
                                     /*    to disable bounds checkers.                     */
                                     /*    (making it char[] simplifies ugly address       */
@@ -135,7 +145,8 @@ struct RBBIStateTable {
 
 typedef enum {
     RBBI_LOOKAHEAD_HARD_BREAK = 1,
-    RBBI_BOF_REQUIRED = 2
+    RBBI_BOF_REQUIRED = 2,
+    RBBI_8BITS_ROWS = 4         // The rows are RBBIStateTableRow8. Since data format version 6.
 } RBBIStateTableFlags;
 
 
@@ -327,6 +327,26 @@ void RBBINode::printNode(const RBBINode *node) {
 #endif
 
 
+U_CFUNC int32_t U_CALLCONV
+RBBI_hashNodeSet(const UElement key) {
+    const UVector *set = static_cast<const UVector *>(key.pointer);
+    int32_t size = set->size();
+    uint32_t hash = (uint32_t)size;
+    for (int32_t i = 0; i < size; i++) {
+        uint64_t p = (uint64_t)(uintptr_t)set->elementAt(i);
+        hash = hash * 37 + (uint32_t)(p ^ (p >> 32));
+    }
+    return (int32_t)hash;
+}
+
+U_CFUNC UBool U_CALLCONV
+RBBI_compareNodeSets(const UElement key1, const UElement key2) {
+    const UVector *set1 = static_cast<const UVector *>(key1.pointer);
+    const UVector *set2 = static_cast<const UVector *>(key2.pointer);
+    return set1->equals(*set2);
+}
+
+
 #ifdef RBBI_DEBUG
 U_CFUNC void RBBI_DEBUG_printUnicodeString(const UnicodeString &s, int minWidth) {
     RBBIDebugPrintf("%*s", minWidth, CStr(s)());
@@ -12,6 +12,7 @@
 #include "unicode/utypes.h"
 #include "unicode/unistr.h"
 #include "unicode/uobject.h"
+#include "uelement.h"
 
 //
 //  class RBBINode
@@ -121,6 +122,19 @@ U_CFUNC void
 RBBI_DEBUG_printUnicodeString(const UnicodeString &s, int minWidth=0);
 #endif
 
+//
+//  Hash and equality functions for sets of nodes, which are UVectors of
+//    RBBINode pointers, as UHashtable keys.  Equal sets must have their
+//    nodes in the same order.
+//
+U_CDECL_BEGIN
+U_CFUNC int32_t U_CALLCONV
+RBBI_hashNodeSet(const UElement key);
+
+U_CFUNC UBool U_CALLCONV
+RBBI_compareNodeSets(const UElement key1, const UElement key2);
+U_CDECL_END
+
 U_NAMESPACE_END
 
 #endif
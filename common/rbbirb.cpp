@@ -33,11 +33,36 @@
 #include "rbbisetb.h"
 #include "rbbitblb.h"
 #include "rbbidata.h"
+#include "hash.h"
 #include "uassert.h"
+#include "ucln_cmn.h"
+#include "umutex.h"
 
 
 U_NAMESPACE_BEGIN
 
+//----------------------------------------------------------------------------------------
+//
+//  Cache of compiled rules.  Maps rule source strings to break iterators built
+//     from them; clones of those share the compiled data, so that rules that
+//     were compiled once need not be compiled again.
+//
+//----------------------------------------------------------------------------------------
+static UMutex      gCompiledRulesMutex = U_MUTEX_INITIALIZER;
+static Hashtable  *gCompiledRules = NULL;
+
+// Upper limit for the number of cached rule sets. When it is reached, the cache
+//   is emptied before new rules are added, so that it keeps the recent ones.
+static const int32_t MAX_COMPILED_RULES = 16;
+
+U_CDECL_BEGIN
+static UBool U_CALLCONV rbbi_rules_cleanup(void) {
+    delete gCompiledRules;
+    gCompiledRules = NULL;
+    return TRUE;
+}
+U_CDECL_END
+
 
 //----------------------------------------------------------------------------------------
 //
@@ -218,6 +243,29 @@ RBBIRuleBuilder::createRuleBasedBreakIterator( const UnicodeString    &rules,
                                     UParseError      *parseError,
                                     UErrorCode       &status)
 {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+
+    //
+    // Rules that were compiled before are not compiled again.
+    //
+    BreakIterator *cached = NULL;
+    umtx_lock(&gCompiledRulesMutex);
+    if (gCompiledRules != NULL) {
+        const BreakIterator *prototype = static_cast<const BreakIterator *>(gCompiledRules->get(rules));
+        if (prototype != NULL) {
+            cached = prototype->clone();
+        }
+    }
+    umtx_unlock(&gCompiledRulesMutex);
+    if (cached != NULL) {
+        if (parseError != NULL) {
+            uprv_memset(parseError, 0, sizeof(UParseError));
+        }
+        return cached;
+    }
+
     //
     // Read the input rules, generate a parse tree, symbol table,
     // and list of all Unicode Sets referenced by the rules.
@@ -246,9 +294,61 @@ RBBIRuleBuilder::createRuleBasedBreakIterator( const UnicodeString    &rules,
     else if(This == NULL) { // test for NULL
         status = U_MEMORY_ALLOCATION_ERROR;
     }
+    else {
+        cacheCompiledRules(rules, data);
+    }
     return This;
 }
 
+//----------------------------------------------------------------------------------------
+//
+//  cacheCompiledRules    Add a break iterator for newly compiled rules to the cache.
+//                        It gets its own copy of the compiled data, allocated
+//                        outside of any memory scope of the caller, since the
+//                        cache outlives the caller's iterator.
+//                        Failures only mean that the rules are not cached;
+//                        they do not affect the caller.
+//
+//----------------------------------------------------------------------------------------
+void RBBIRuleBuilder::cacheCompiledRules(const UnicodeString &rules,
+                                         const RBBIDataHeader *data) {
+    MemoryScopeSuspender suspender;
+    UErrorCode status = U_ZERO_ERROR;
+    umtx_lock(&gCompiledRulesMutex);
+    if (gCompiledRules == NULL) {
+        gCompiledRules = new Hashtable(status);
+        if (gCompiledRules == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        } else if (U_FAILURE(status)) {
+            delete gCompiledRules;
+            gCompiledRules = NULL;
+        } else {
+            gCompiledRules->setValueDeleter(uprv_deleteUObject);
+            ucln_common_registerCleanup(UCLN_COMMON_RBBI_RULES, rbbi_rules_cleanup);
+        }
+    }
+    if (U_SUCCESS(status) && gCompiledRules->get(rules) == NULL) {
+        if (gCompiledRules->count() >= MAX_COMPILED_RULES) {
+            gCompiledRules->removeAll();
+        }
+        RBBIDataHeader *dataCopy = (RBBIDataHeader *)uprv_malloc(data->fLength);
+        if (dataCopy != NULL) {
+            uprv_memcpy(dataCopy, data, data->fLength);
+            // The prototype adopts the data copy.
+            RuleBasedBreakIterator *prototype = new RuleBasedBreakIterator(dataCopy, status);
+            if (prototype == NULL) {
+                uprv_free(dataCopy);
+            } else if (U_FAILURE(status)) {
+                delete prototype;
+            } else {
+                // The table adopts the prototype, and deletes it if put() fails.
+                gCompiledRules->put(rules, prototype, status);
+            }
+        }
+    }
+    umtx_unlock(&gCompiledRulesMutex);
+}
+
 RBBIDataHeader *RBBIRuleBuilder::build(UErrorCode &status) {
     if (U_FAILURE(status)) {
         return nullptr;
@@ -116,6 +116,9 @@ class RBBIRuleBuilder : public UMemory {
                                     UParseError      *parseError,
                                     UErrorCode       &status);
 
+private:
+    static void cacheCompiledRules(const UnicodeString &rules, const RBBIDataHeader *data);
+
 public:
     // The "public" functions and data members that appear below are accessed
     //  (and shared) by the various parts that make up the rule builder.  They
@@ -37,6 +37,7 @@
 #include "unicode/uniset.h"
 #include "utrie2.h"
 #include "uvector.h"
+#include "uhash.h"
 #include "uassert.h"
 #include "cmemory.h"
 #include "cstring.h"
@@ -197,19 +198,26 @@ void RBBISetBuilder::buildRanges() {
     //               # 2  is reserved - table column 2 is for beginning-in-input
     //               # 3  is the first range list.
     //
-    RangeDescriptor *rlSearchRange;
+    //    The map from the sets of each group to its number finds the group of
+    //    a range without comparing its sets with those of all earlier ranges.
+    //    The sets of each range are in the order of fUSetNodes.
+    //
+    LocalUHashtablePointer groupNumbers(
+        uhash_open(RBBI_hashNodeSet, RBBI_compareNodeSets, NULL, fStatus));
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
     for (rlRange = fRangeList; rlRange!=0; rlRange=rlRange->fNext) {
-        for (rlSearchRange=fRangeList; rlSearchRange != rlRange; rlSearchRange=rlSearchRange->fNext) {
-            if (rlRange->fIncludesSets->equals(*rlSearchRange->fIncludesSets)) {
-                rlRange->fNum = rlSearchRange->fNum;
-                break;
-            }
-        }
+        rlRange->fNum = uhash_geti(groupNumbers.getAlias(), rlRange->fIncludesSets);
         if (rlRange->fNum == 0) {
             fGroupCount ++;
             rlRange->fNum = fGroupCount+2; 
             rlRange->setDictionaryFlag();
             addValToSets(rlRange->fIncludesSets, fGroupCount+2);
+            uhash_puti(groupNumbers.getAlias(), rlRange->fIncludesSets, rlRange->fNum, fStatus);
+            if (U_FAILURE(*fStatus)) {
+                return;
+            }
         }
     }
 
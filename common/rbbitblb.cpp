@@ -23,6 +23,7 @@
 #include "cstring.h"
 #include "uassert.h"
 #include "uvectr32.h"
+#include "uhash.h"
 #include "cmemory.h"
 
 U_NAMESPACE_BEGIN
@@ -31,26 +32,13 @@ RBBITableBuilder::RBBITableBuilder(RBBIRuleBuilder *rb, RBBINode **rootNode, UEr
         fRB(rb),
         fTree(*rootNode),
         fStatus(&status),
-        fDStates(nullptr),
+        fDStates(),
         fSafeTable(nullptr) {
-    if (U_FAILURE(status)) {
-        return;
-    }
-    // fDStates is UVector<RBBIStateDescriptor *>
-    fDStates = new UVector(status);
-    if (U_SUCCESS(status) && fDStates == nullptr ) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-    }
 }
 
 
 
 RBBITableBuilder::~RBBITableBuilder() {
-    int i;
-    for (i=0; i<fDStates->size(); i++) {
-        delete (RBBIStateDescriptor *)fDStates->elementAt(i);
-    }
-    delete fDStates;
     delete fSafeTable;
 }
 
@@ -569,58 +557,66 @@ void RBBITableBuilder::buildStateTable() {
     if (U_FAILURE(*fStatus)) {
         return;
     }
-    RBBIStateDescriptor *failState;
-    // Set it to NULL to avoid uninitialized warning
-    RBBIStateDescriptor *initialState = NULL; 
+    // The states are owned by fDStates from the moment they are created,
+    //   so there is nothing to clean up here on errors.
     //
     // Add a dummy state 0 - the stop state.  Not from Aho.
     int      lastInputSymbol = fRB->fSetBuilder->getNumCharCategories() - 1;
-    failState = new RBBIStateDescriptor(lastInputSymbol, fStatus);
+    RBBIStateDescriptor *failState = fDStates.emplaceBack(lastInputSymbol, fStatus);
     if (failState == NULL) {
         *fStatus = U_MEMORY_ALLOCATION_ERROR;
-        goto ExitBuildSTdeleteall;
+        return;
+    }
+    if (U_FAILURE(*fStatus)) {
+        return;
     }
     failState->fPositions = new UVector(*fStatus);
     if (failState->fPositions == NULL) {
         *fStatus = U_MEMORY_ALLOCATION_ERROR;
     }
-    if (failState->fPositions == NULL || U_FAILURE(*fStatus)) {
-        goto ExitBuildSTdeleteall;
-    }
-    fDStates->addElement(failState, *fStatus);
     if (U_FAILURE(*fStatus)) {
-        goto ExitBuildSTdeleteall;
+        return;
     }
 
     // initially, the only unmarked state in Dstates is firstpos(root),
     //       where toot is the root of the syntax tree for (r)#;
-    initialState = new RBBIStateDescriptor(lastInputSymbol, fStatus);
+    RBBIStateDescriptor *initialState = fDStates.emplaceBack(lastInputSymbol, fStatus);
     if (initialState == NULL) {
         *fStatus = U_MEMORY_ALLOCATION_ERROR;
     }
     if (U_FAILURE(*fStatus)) {
-        goto ExitBuildSTdeleteall;
+        return;
     }
     initialState->fPositions = new UVector(*fStatus);
     if (initialState->fPositions == NULL) {
         *fStatus = U_MEMORY_ALLOCATION_ERROR;
     }
     if (U_FAILURE(*fStatus)) {
-        goto ExitBuildSTdeleteall;
+        return;
     }
     setAdd(initialState->fPositions, fTree->fFirstPosSet);
-    fDStates->addElement(initialState, *fStatus);
     if (U_FAILURE(*fStatus)) {
-        goto ExitBuildSTdeleteall;
+        return;
+    }
+
+    // Map from the position set of each state to its state number, so that
+    //   finding a set in Dstates does not need to compare it with all of them.
+    //   The stop state is not in the map; its set is empty, unlike the others.
+    //   The position sets are sorted, so that equal sets have the same order.
+    LocalUHashtablePointer stateNumbers(
+        uhash_open(RBBI_hashNodeSet, RBBI_compareNodeSets, NULL, fStatus));
+    uhash_puti(stateNumbers.getAlias(), initialState->fPositions, 1, fStatus);
+    if (U_FAILURE(*fStatus)) {
+        return;
     }
 
     // while there is an unmarked state T in Dstates do begin
     for (;;) {
         RBBIStateDescriptor *T = NULL;
         int32_t              tx;
-        for (tx=1; tx<fDStates->size(); tx++) {
+        for (tx=1; tx<fDStates.length(); tx++) {
             RBBIStateDescriptor *temp;
-            temp = (RBBIStateDescriptor *)fDStates->elementAt(tx);
+            temp = fDStates[tx];
             if (temp->fMarked == FALSE) {
                 T = temp;
                 break;
@@ -649,7 +645,7 @@ void RBBITableBuilder::buildStateTable() {
                         U = new UVector(*fStatus);
                         if (U == NULL) {
                         	*fStatus = U_MEMORY_ALLOCATION_ERROR;
-                        	goto ExitBuildSTdeleteall;
+                        	return;
                         }
                     }
                     setAdd(U, p->fFollowPos);
@@ -661,35 +657,33 @@ void RBBITableBuilder::buildStateTable() {
             UBool    UinDstates = FALSE;
             if (U != NULL) {
                 U_ASSERT(U->size() > 0);
-                int  ix;
-                for (ix=0; ix<fDStates->size(); ix++) {
-                    RBBIStateDescriptor *temp2;
-                    temp2 = (RBBIStateDescriptor *)fDStates->elementAt(ix);
-                    if (setEquals(U, temp2->fPositions)) {
-                        delete U;
-                        U  = temp2->fPositions;
-                        ux = ix;
-                        UinDstates = TRUE;
-                        break;
-                    }
+                int32_t ix = uhash_geti(stateNumbers.getAlias(), U);
+                if (ix > 0) {
+                    U_ASSERT(setEquals(U, fDStates[ix]->fPositions));
+                    delete U;
+                    U  = fDStates[ix]->fPositions;
+                    ux = ix;
+                    UinDstates = TRUE;
                 }
 
                 // Add U as an unmarked state to Dstates
                 if (!UinDstates)
                 {
-                    RBBIStateDescriptor *newState = new RBBIStateDescriptor(lastInputSymbol, fStatus);
+                    RBBIStateDescriptor *newState = fDStates.emplaceBack(lastInputSymbol, fStatus);
                     if (newState == NULL) {
                     	*fStatus = U_MEMORY_ALLOCATION_ERROR;
+                    	delete U;
+                    	return;
                     }
+                    newState->fPositions = U;
                     if (U_FAILURE(*fStatus)) {
-                        goto ExitBuildSTdeleteall;
+                        return;
                     }
-                    newState->fPositions = U;
-                    fDStates->addElement(newState, *fStatus);
+                    ux = fDStates.length()-1;
+                    uhash_puti(stateNumbers.getAlias(), U, ux, fStatus);
                     if (U_FAILURE(*fStatus)) {
                         return;
                     }
-                    ux = fDStates->size()-1;
                 }
 
                 // Dtran[T, a] := U;
@@ -697,11 +691,6 @@ void RBBITableBuilder::buildStateTable() {
             }
         }
     }
-    return;
-    // delete local pointers only if error occured.
-ExitBuildSTdeleteall:
-    delete initialState;
-    delete failState;
 }
 
 
@@ -735,8 +724,8 @@ void     RBBITableBuilder::flagAcceptingStates() {
 
     for (i=0; i<endMarkerNodes.size(); i++) {
         endMarker = (RBBINode *)endMarkerNodes.elementAt(i);
-        for (n=0; n<fDStates->size(); n++) {
-            RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(n);
+        for (n=0; n<fDStates.length(); n++) {
+            RBBIStateDescriptor *sd = fDStates[n];
             if (sd->fPositions->indexOf(endMarker) >= 0) {
                 // Any non-zero value for fAccepting means this is an accepting node.
                 // The value is what will be returned to the user as the break status.
@@ -793,8 +782,8 @@ void     RBBITableBuilder::flagLookAheadStates() {
     for (i=0; i<lookAheadNodes.size(); i++) {
         lookAheadNode = (RBBINode *)lookAheadNodes.elementAt(i);
 
-        for (n=0; n<fDStates->size(); n++) {
-            RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(n);
+        for (n=0; n<fDStates.length(); n++) {
+            RBBIStateDescriptor *sd = fDStates[n];
             if (sd->fPositions->indexOf(lookAheadNode) >= 0) {
                 sd->fLookAhead = lookAheadNode->fVal;
             }
@@ -829,8 +818,8 @@ void     RBBITableBuilder::flagTaggedStates() {
     for (i=0; i<tagNodes.size(); i++) {                   // For each tag node t (all of 'em)
         tagNode = (RBBINode *)tagNodes.elementAt(i);
 
-        for (n=0; n<fDStates->size(); n++) {              //    For each state  s (row in the state table)
-            RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(n);
+        for (n=0; n<fDStates.length(); n++) {              //    For each state  s (row in the state table)
+            RBBIStateDescriptor *sd = fDStates[n];
             if (sd->fPositions->indexOf(tagNode) >= 0) {  //       if  s include the tag node t
                 sortedAdd(&sd->fTagVals, tagNode->fVal);
             }
@@ -872,8 +861,8 @@ void  RBBITableBuilder::mergeRuleStatusVals() {
     }
 
     //    For each state
-    for (n=0; n<fDStates->size(); n++) {
-        RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(n);
+    for (n=0; n<fDStates.length(); n++) {
+        RBBIStateDescriptor *sd = fDStates[n];
         UVector *thisStatesTagValues = sd->fTagVals;
         if (thisStatesTagValues == NULL) {
             // No tag values are explicitly associated with this state.
@@ -1079,7 +1068,7 @@ void RBBITableBuilder::printPosSets(RBBINode *n) {
 //    findDuplCharClassFrom()
 //
 bool RBBITableBuilder::findDuplCharClassFrom(IntPair *categories) {
-    int32_t numStates = fDStates->size();
+    int32_t numStates = fDStates.length();
     int32_t numCols = fRB->fSetBuilder->getNumCharCategories();
 
     for (; categories->first < numCols-1; categories->first++) {
@@ -1088,7 +1077,7 @@ bool RBBITableBuilder::findDuplCharClassFrom(IntPair *categories) {
             uint16_t table_base = 0;
             uint16_t table_dupl = 1;
             for (int32_t state=0; state<numStates; state++) {
-                RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(state);
+                RBBIStateDescriptor *sd = fDStates[state];
                 table_base = (uint16_t)sd->fDtran->elementAti(categories->first);
                 table_dupl = (uint16_t)sd->fDtran->elementAti(categories->second);
                 if (table_base != table_dupl) {
@@ -1108,9 +1097,9 @@ bool RBBITableBuilder::findDuplCharClassFrom(IntPair *categories) {
 //    removeColumn()
 //
 void RBBITableBuilder::removeColumn(int32_t column) {
-    int32_t numStates = fDStates->size();
+    int32_t numStates = fDStates.length();
     for (int32_t state=0; state<numStates; state++) {
-        RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(state);
+        RBBIStateDescriptor *sd = fDStates[state];
         U_ASSERT(column < sd->fDtran->size());
         sd->fDtran->removeElementAt(column);
     }
@@ -1120,13 +1109,13 @@ void RBBITableBuilder::removeColumn(int32_t column) {
  * findDuplicateState
  */
 bool RBBITableBuilder::findDuplicateState(IntPair *states) {
-    int32_t numStates = fDStates->size();
+    int32_t numStates = fDStates.length();
     int32_t numCols = fRB->fSetBuilder->getNumCharCategories();
 
     for (; states->first<numStates-1; states->first++) {
-        RBBIStateDescriptor *firstSD = (RBBIStateDescriptor *)fDStates->elementAt(states->first);
+        RBBIStateDescriptor *firstSD = fDStates[states->first];
         for (states->second=states->first+1; states->second<numStates; states->second++) {
-            RBBIStateDescriptor *duplSD = (RBBIStateDescriptor *)fDStates->elementAt(states->second);
+            RBBIStateDescriptor *duplSD = fDStates[states->second];
             if (firstSD->fAccepting != duplSD->fAccepting ||
                 firstSD->fLookAhead != duplSD->fLookAhead ||
                 firstSD->fTagsIdx   != duplSD->fTagsIdx) {
@@ -1184,16 +1173,14 @@ void RBBITableBuilder::removeState(IntPair duplStates) {
     const int32_t keepState = duplStates.first;
     const int32_t duplState = duplStates.second;
     U_ASSERT(keepState < duplState);
-    U_ASSERT(duplState < fDStates->size());
+    U_ASSERT(duplState < fDStates.length());
 
-    RBBIStateDescriptor *duplSD = (RBBIStateDescriptor *)fDStates->elementAt(duplState);
-    fDStates->removeElementAt(duplState);
-    delete duplSD;
+    fDStates.removeAt(duplState);
 
-    int32_t numStates = fDStates->size();
+    int32_t numStates = fDStates.length();
     int32_t numCols = fRB->fSetBuilder->getNumCharCategories();
     for (int32_t state=0; state<numStates; ++state) {
-        RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(state);
+        RBBIStateDescriptor *sd = fDStates[state];
         for (int32_t col=0; col<numCols; col++) {
             int32_t existingVal = sd->fDtran->elementAti(col);
             int32_t newVal = existingVal;
@@ -1277,15 +1264,45 @@ int32_t  RBBITableBuilder::getTableSize() const {
 
     size    = offsetof(RBBIStateTable, fTableData);    // The header, with no rows to the table.
 
-    numRows = fDStates->size();
+    numRows = fDStates.length();
     numCols = fRB->fSetBuilder->getNumCharCategories();
 
-    rowSize = offsetof(RBBIStateTableRow, fNextState) + sizeof(uint16_t)*numCols;
+    if (use8BitsForTable()) {
+        rowSize = offsetof(RBBIStateTableRow8, fNextState) + sizeof(uint8_t)*numCols;
+    } else {
+        rowSize = offsetof(RBBIStateTableRow16, fNextState) + sizeof(uint16_t)*numCols;
+    }
     size   += numRows * rowSize;
     return size;
 }
 
 
+//-----------------------------------------------------------------------------
+//
+//   use8BitsForTable()    The state table rows are 8 bits wide if the state
+//                         numbers and the values of all rows fit into them.
+//                         Most rule sets have fewer than 256 states, and
+//                         their tables are then half as large.
+//
+//-----------------------------------------------------------------------------
+static inline bool fitsInt8(int32_t value) {
+    return INT8_MIN <= value && value <= INT8_MAX;
+}
+
+bool RBBITableBuilder::use8BitsForTable() const {
+    if (fDStates.length() > 0x100) {
+        return false;
+    }
+    for (int32_t state=0; state<fDStates.length(); state++) {
+        const RBBIStateDescriptor *sd = fDStates[state];
+        if (!fitsInt8(sd->fAccepting) || !fitsInt8(sd->fLookAhead) || !fitsInt8(sd->fTagsIdx)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
 //-----------------------------------------------------------------------------
 //
 //   exportTable()    export the state transition table in the format required
@@ -1304,13 +1321,18 @@ void RBBITableBuilder::exportTable(void *where) {
 
     int32_t catCount = fRB->fSetBuilder->getNumCharCategories();
     if (catCount > 0x7fff ||
-        fDStates->size() > 0x7fff) {
+        fDStates.length() > 0x7fff) {
         *fStatus = U_BRK_INTERNAL_ERROR;
         return;
     }
 
-    table->fRowLen    = offsetof(RBBIStateTableRow, fNextState) + sizeof(uint16_t) * catCount;
-    table->fNumStates = fDStates->size();
+    bool use8Bits = use8BitsForTable();
+    if (use8Bits) {
+        table->fRowLen = offsetof(RBBIStateTableRow8, fNextState) + sizeof(uint8_t) * catCount;
+    } else {
+        table->fRowLen = offsetof(RBBIStateTableRow16, fNextState) + sizeof(uint16_t) * catCount;
+    }
+    table->fNumStates = fDStates.length();
     table->fFlags     = 0;
     if (fRB->fLookAheadHardBreak) {
         table->fFlags  |= RBBI_LOOKAHEAD_HARD_BREAK;
@@ -1318,18 +1340,34 @@ void RBBITableBuilder::exportTable(void *where) {
     if (fRB->fSetBuilder->sawBOF()) {
         table->fFlags  |= RBBI_BOF_REQUIRED;
     }
+    if (use8Bits) {
+        table->fFlags  |= RBBI_8BITS_ROWS;
+    }
     table->fReserved  = 0;
 
     for (state=0; state<table->fNumStates; state++) {
-        RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(state);
-        RBBIStateTableRow   *row = (RBBIStateTableRow *)(table->fTableData + state*table->fRowLen);
-        U_ASSERT (-32768 < sd->fAccepting && sd->fAccepting <= 32767);
-        U_ASSERT (-32768 < sd->fLookAhead && sd->fLookAhead <= 32767);
-        row->fAccepting = (int16_t)sd->fAccepting;
-        row->fLookAhead = (int16_t)sd->fLookAhead;
-        row->fTagIdx    = (int16_t)sd->fTagsIdx;
-        for (col=0; col<catCount; col++) {
-            row->fNextState[col] = (uint16_t)sd->fDtran->elementAti(col);
+        RBBIStateDescriptor *sd = fDStates[state];
+        char *rowBytes = table->fTableData + state*table->fRowLen;
+        if (use8Bits) {
+            RBBIStateTableRow8 *row = (RBBIStateTableRow8 *)rowBytes;
+            row->fAccepting = (int8_t)sd->fAccepting;
+            row->fLookAhead = (int8_t)sd->fLookAhead;
+            row->fTagIdx    = (int8_t)sd->fTagsIdx;
+            row->fReserved  = 0;
+            for (col=0; col<catCount; col++) {
+                row->fNextState[col] = (uint8_t)sd->fDtran->elementAti(col);
+            }
+        } else {
+            RBBIStateTableRow16 *row = (RBBIStateTableRow16 *)rowBytes;
+            U_ASSERT (-32768 < sd->fAccepting && sd->fAccepting <= 32767);
+            U_ASSERT (-32768 < sd->fLookAhead && sd->fLookAhead <= 32767);
+            row->fAccepting = (int16_t)sd->fAccepting;
+            row->fLookAhead = (int16_t)sd->fLookAhead;
+            row->fTagIdx    = (int16_t)sd->fTagsIdx;
+            row->fReserved  = 0;
+            for (col=0; col<catCount; col++) {
+                row->fNextState[col] = (uint16_t)sd->fDtran->elementAti(col);
+            }
         }
     }
 }
@@ -1368,16 +1406,16 @@ void RBBITableBuilder::buildSafeReverseTable(UErrorCode &status) {
     UnicodeString safePairs;
 
     int32_t numCharClasses = fRB->fSetBuilder->getNumCharCategories();
-    int32_t numStates = fDStates->size();
+    int32_t numStates = fDStates.length();
 
     for (int32_t c1=0; c1<numCharClasses; ++c1) {
         for (int32_t c2=0; c2 < numCharClasses; ++c2) {
             int32_t wantedEndState = -1;
             int32_t endState = 0;
             for (int32_t startState = 1; startState < numStates; ++startState) {
-                RBBIStateDescriptor *startStateD = static_cast<RBBIStateDescriptor *>(fDStates->elementAt(startState));
+                RBBIStateDescriptor *startStateD = fDStates[startState];
                 int32_t s2 = startStateD->fDtran->elementAti(c1);
-                RBBIStateDescriptor *s2StateD = static_cast<RBBIStateDescriptor *>(fDStates->elementAt(s2));
+                RBBIStateDescriptor *s2StateD = fDStates[s2];
                 endState = s2StateD->fDtran->elementAti(c2);
                 if (wantedEndState < 0) {
                     wantedEndState = endState;
@@ -1465,12 +1503,27 @@ int32_t  RBBITableBuilder::getSafeTableSize() const {
     numRows = fSafeTable->size();
     numCols = fRB->fSetBuilder->getNumCharCategories();
 
-    rowSize = offsetof(RBBIStateTableRow, fNextState) + sizeof(uint16_t)*numCols;
+    if (use8BitsForSafeTable()) {
+        rowSize = offsetof(RBBIStateTableRow8, fNextState) + sizeof(uint8_t)*numCols;
+    } else {
+        rowSize = offsetof(RBBIStateTableRow16, fNextState) + sizeof(uint16_t)*numCols;
+    }
     size   += numRows * rowSize;
     return size;
 }
 
 
+//-----------------------------------------------------------------------------
+//
+//   use8BitsForSafeTable()    The rows of the safe table have no values other
+//                             than the next states.
+//
+//-----------------------------------------------------------------------------
+bool RBBITableBuilder::use8BitsForSafeTable() const {
+    return fSafeTable->size() <= 0x100;
+}
+
+
 //-----------------------------------------------------------------------------
 //
 //   exportSafeTable()   export the state transition table in the format required
@@ -1494,20 +1547,40 @@ void RBBITableBuilder::exportSafeTable(void *where) {
         return;
     }
 
-    table->fRowLen    = offsetof(RBBIStateTableRow, fNextState) + sizeof(uint16_t) * catCount;
+    bool use8Bits = use8BitsForSafeTable();
+    if (use8Bits) {
+        table->fRowLen = offsetof(RBBIStateTableRow8, fNextState) + sizeof(uint8_t) * catCount;
+    } else {
+        table->fRowLen = offsetof(RBBIStateTableRow16, fNextState) + sizeof(uint16_t) * catCount;
+    }
     table->fNumStates = fSafeTable->size();
     table->fFlags     = 0;
+    if (use8Bits) {
+        table->fFlags  |= RBBI_8BITS_ROWS;
+    }
     table->fReserved  = 0;
 
     for (state=0; state<table->fNumStates; state++) {
         UnicodeString *rowString = (UnicodeString *)fSafeTable->elementAt(state);
-        RBBIStateTableRow   *row = (RBBIStateTableRow *)(table->fTableData + state*table->fRowLen);
-        row->fAccepting = 0;
-        row->fLookAhead = 0;
-        row->fTagIdx    = 0;
-        row->fReserved  = 0;
-        for (col=0; col<catCount; col++) {
-            row->fNextState[col] = rowString->charAt(col);
+        char *rowBytes = table->fTableData + state*table->fRowLen;
+        if (use8Bits) {
+            RBBIStateTableRow8 *row = (RBBIStateTableRow8 *)rowBytes;
+            row->fAccepting = 0;
+            row->fLookAhead = 0;
+            row->fTagIdx    = 0;
+            row->fReserved  = 0;
+            for (col=0; col<catCount; col++) {
+                row->fNextState[col] = (uint8_t)rowString->charAt(col);
+            }
+        } else {
+            RBBIStateTableRow16 *row = (RBBIStateTableRow16 *)rowBytes;
+            row->fAccepting = 0;
+            row->fLookAhead = 0;
+            row->fTagIdx    = 0;
+            row->fReserved  = 0;
+            for (col=0; col<catCount; col++) {
+                row->fNextState[col] = rowString->charAt(col);
+            }
         }
     }
 }
@@ -1554,8 +1627,8 @@ void RBBITableBuilder::printStates() {
     }
     RBBIDebugPrintf("\n");
 
-    for (n=0; n<fDStates->size(); n++) {
-        RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(n);
+    for (n=0; n<fDStates.length(); n++) {
+        RBBIStateDescriptor *sd = fDStates[n];
         RBBIDebugPrintf("  %3d | " , n);
         RBBIDebugPrintf("%3d %3d %5d ", sd->fAccepting, sd->fLookAhead, sd->fTagsIdx);
         for (c=0; c<fRB->fSetBuilder->getNumCharCategories(); c++) {
@@ -20,6 +20,7 @@
 
 #include "unicode/uobject.h"
 #include "unicode/rbbi.h"
+#include "cmemory.h"
 #include "rbbirb.h"
 #include "rbbinode.h"
 
@@ -28,6 +29,7 @@ U_NAMESPACE_BEGIN
 
 class RBBIRuleScanner;
 class RBBIRuleBuilder;
+class RBBIStateDescriptor;
 class UVector32;
 
 //
@@ -53,6 +55,11 @@ class RBBITableBuilder : public UMemory {
      */
     void     exportTable(void *where);
 
+    /** Return true if the runtime state table has 8-bit rows (RBBIStateTableRow8),
+     *  because its states and values all fit into 8 bits.
+     */
+    bool     use8BitsForTable() const;
+
     /**
      *  Find duplicate (redundant) character classes. Begin looking with categories.first.
      *  Duplicate, if found are returned in the categories parameter.
@@ -85,6 +92,9 @@ class RBBITableBuilder : public UMemory {
      */
     void     exportSafeTable(void *where);
 
+    /** Return true if the runtime safe state table has 8-bit rows (RBBIStateTableRow8). */
+    bool     use8BitsForSafeTable() const;
+
 
 private:
     void     calcNullable(RBBINode *n);
@@ -167,8 +177,9 @@ class RBBITableBuilder : public UMemory {
                                            //   table for.
     UErrorCode       *fStatus;
 
-    /** State Descriptors, UVector<RBBIStateDescriptor> */
-    UVector          *fDStates;            //  D states (Aho's terminology)
+    /** State Descriptors, owned by the vector */
+    MaybeStackVector<RBBIStateDescriptor, 64>
+                      fDStates;            //  D states (Aho's terminology)
                                            //  Index is state number
                                            //  Contents are RBBIStateDescriptor pointers.
 
@@ -360,6 +360,11 @@ ResourceBundle ResourceBundle::getWithFallback(const char* key, UErrorCode& stat
     }
     return res;
 }
+void ResourceBundle::getAllItemsWithFallback(const char *path, ResourceSink &sink,
+                                             UErrorCode &status) const {
+    ures_getAllItemsWithFallback(fResource, path, sink, status);
+}
+
 UnicodeString ResourceBundle::getStringEx(const char* key, UErrorCode& status) const {
     int32_t len = 0;
     const UChar* r = ures_getStringByKey(fResource, key, &len, &status);
@@ -376,7 +381,7 @@ void ResourceBundle::getVersion(UVersionInfo versionInfo) const {
     ures_getVersion(fResource, versionInfo);
 }
 
-static UMutex gLocaleLock = U_MUTEX_INITIALIZER;
+static UMutex gLocaleLock = U_NAMED_MUTEX_INITIALIZER("ResourceBundle");
 const Locale &ResourceBundle::getLocale(void) const {
     Mutex lock(&gLocaleLock);
     if (fLocale != NULL) {
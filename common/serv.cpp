@@ -333,7 +333,7 @@ U_CDECL_END
 ******************************************************************
 */
 
-static UMutex lock = U_MUTEX_INITIALIZER;
+static UMutex lock = U_NAMED_MUTEX_INITIALIZER("ICUService");
 
 ICUService::ICUService()
 : name()
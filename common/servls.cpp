@@ -26,7 +26,7 @@
 
 U_NAMESPACE_BEGIN
 
-static UMutex llock = U_MUTEX_INITIALIZER;
+static UMutex llock = U_NAMED_MUTEX_INITIALIZER("ICULocaleService");
 ICULocaleService::ICULocaleService()
   : fallbackLocale(Locale::getDefault())
 {
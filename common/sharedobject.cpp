@@ -52,6 +52,11 @@ SharedObject::getRefCount() const {
     return umtx_loadAcquire(hardRefCount);
 }
 
+int32_t
+SharedObject::getApproximateSize() const {
+    return 0;
+}
+
 void
 SharedObject::deleteIfZeroRefCount() const {
     if (this->cachePtr == nullptr && getRefCount() == 0) {
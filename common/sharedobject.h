@@ -89,6 +89,14 @@ class U_COMMON_API SharedObject : public UObject {
      */
     int32_t getRefCount() const;
 
+    /**
+     * Returns the approximate number of heap bytes used by this object,
+     * including the memory that it owns.
+     * The UnifiedCache charges this against its memory limit.
+     * Returns 0 if the size is unknown; the default implementation does that.
+     */
+    virtual int32_t getApproximateSize() const;
+
     /**
      * If noHardReferences() == TRUE then this object has no hard references.
      * Must be called only from within the internals of UnifiedCache.
@@ -165,9 +173,10 @@ class U_COMMON_API SharedObject : public UObject {
      * The number of references from the UnifiedCache, which is
      * the number of times that the sharedObject is stored as a hash table value.
      * For use by UnifiedCache implementation code only.
-     * All access is synchronized by UnifiedCache's gCacheMutex
+     * Atomic because the same value may be stored in more than one of the
+     * UnifiedCache's independently locked shards.
      */
-    mutable int32_t softRefCount;
+    mutable u_atomic_int32_t softRefCount;
     friend class UnifiedCache;
 
     /**
@@ -94,6 +94,13 @@ struct UStringPrepProfile{
     UBool isDataLoaded;
     UBool doNFKC;
     UBool checkBiDi;
+    UBool isShared;         /* held by the cache of usprep_openByType(), not reference-counted */
+    uint8_t asciiMap[0x80]; /* the result of each ASCII character, if it is an ASCII character
+                               that is not prohibited, otherwise _SPREP_NOT_ASCII */
+};
+
+enum {
+    _SPREP_NOT_ASCII = 0xff
 };
 
 /**
@@ -14,6 +14,7 @@
 #include "ucln_cmn.h"
 #include "unicode/uniset.h"
 #include "uresimp.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "uassert.h"
 
@@ -65,6 +66,29 @@ UnicodeSet* computeUnion(Key k1, Key k2, Key k3) {
 }
 
 
+// Sets of fixed characters, as (start, end) ranges for UnicodeSet::setToRanges(),
+// so that they are built without parsing patterns.
+// ['٬‘’＇\u0020\u00A0\u2000-\u200A\u202F\u205F\u3000]
+const UChar32 kOtherGroupingSeparators[] = {
+    0x20, 0x20, 0x27, 0x27, 0xa0, 0xa0, 0x66c, 0x66c, 0x2000, 0x200a, 0x2018, 0x2019,
+    0x202f, 0x202f, 0x205f, 0x205f, 0x3000, 0x3000, 0xff07, 0xff07
+};
+const UChar32 kPercentSign[] = { 0x25, 0x25, 0x66a, 0x66a };  // [%٪]
+const UChar32 kPermilleSign[] = { 0x609, 0x609, 0x2030, 0x2030 };  // [‰؉]
+const UChar32 kInfinity[] = { 0x221e, 0x221e };  // [∞]
+const UChar32 kYenSign[] = { 0xa5, 0xa5, 0xffe5, 0xffe5 };  // [¥\uffe5]
+
+UnicodeSet* newSetFromRanges(const UChar32* ranges, int32_t length, UErrorCode& status) {
+    if (U_FAILURE(status)) { return nullptr; }
+    UnicodeSet* result = new UnicodeSet();
+    if (result == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    result->setToRanges(ranges, length, status);
+    return result;
+}
+
 void saveSet(Key key, const UnicodeString& unicodeSetPattern, UErrorCode& status) {
     // assert unicodeSets.get(key) == null;
     gUnicodeSets[key] = new UnicodeSet(unicodeSetPattern, status);
@@ -156,8 +180,8 @@ void U_CALLCONV initNumberParseUniSets(UErrorCode& status) {
     U_ASSERT(gUnicodeSets[PERIOD] != nullptr);
     U_ASSERT(gUnicodeSets[STRICT_PERIOD] != nullptr);
 
-    gUnicodeSets[OTHER_GROUPING_SEPARATORS] = new UnicodeSet(
-            u"['٬‘’＇\\u0020\\u00A0\\u2000-\\u200A\\u202F\\u205F\\u3000]", status);
+    gUnicodeSets[OTHER_GROUPING_SEPARATORS] = newSetFromRanges(
+            kOtherGroupingSeparators, UPRV_LENGTHOF(kOtherGroupingSeparators), status);
     gUnicodeSets[ALL_SEPARATORS] = computeUnion(COMMA, PERIOD, OTHER_GROUPING_SEPARATORS);
     gUnicodeSets[STRICT_ALL_SEPARATORS] = computeUnion(
             STRICT_COMMA, STRICT_PERIOD, OTHER_GROUPING_SEPARATORS);
@@ -165,14 +189,14 @@ void U_CALLCONV initNumberParseUniSets(UErrorCode& status) {
     U_ASSERT(gUnicodeSets[MINUS_SIGN] != nullptr);
     U_ASSERT(gUnicodeSets[PLUS_SIGN] != nullptr);
 
-    gUnicodeSets[PERCENT_SIGN] = new UnicodeSet(u"[%٪]", status);
-    gUnicodeSets[PERMILLE_SIGN] = new UnicodeSet(u"[‰؉]", status);
-    gUnicodeSets[INFINITY_KEY] = new UnicodeSet(u"[∞]", status);
+    gUnicodeSets[PERCENT_SIGN] = newSetFromRanges(kPercentSign, UPRV_LENGTHOF(kPercentSign), status);
+    gUnicodeSets[PERMILLE_SIGN] = newSetFromRanges(kPermilleSign, UPRV_LENGTHOF(kPermilleSign), status);
+    gUnicodeSets[INFINITY_KEY] = newSetFromRanges(kInfinity, UPRV_LENGTHOF(kInfinity), status);
 
     U_ASSERT(gUnicodeSets[DOLLAR_SIGN] != nullptr);
     U_ASSERT(gUnicodeSets[POUND_SIGN] != nullptr);
     U_ASSERT(gUnicodeSets[RUPEE_SIGN] != nullptr);
-    gUnicodeSets[YEN_SIGN] = new UnicodeSet(u"[¥\\uffe5]", status);
+    gUnicodeSets[YEN_SIGN] = newSetFromRanges(kYenSign, UPRV_LENGTHOF(kYenSign), status);
 
     gUnicodeSets[DIGITS] = new UnicodeSet(u"[:digit:]", status);
 
@@ -17,24 +17,112 @@
 #include "utypeinfo.h"  // for 'typeid' to work
 #include "unicode/utypes.h"
 #include "unicode/stringtriebuilder.h"
+#include "cmemory.h"
+#include "ohashmap.h"
 #include "uassert.h"
-#include "uhash.h"
 
-U_CDECL_BEGIN
+U_NAMESPACE_BEGIN
+
+/**
+ * Hash set of the nodes of a trie that is being built,
+ * for sharing equivalent sub-tries.
+ * The nodes are allocated in large blocks which are all freed together
+ * when the set is deleted. Builds of tries with millions of strings
+ * create many small nodes, and most of them are duplicates.
+ */
+class StringTrieBuilder::NodeSet : public UMemory {
+public:
+    NodeSet() : blocks(NULL), start(NULL), limit(NULL), last(NULL) {}
+    ~NodeSet();
+
+    void *allocate(size_t size);
+    /** Returns the node's memory to its block if it was the last allocation. */
+    void release(void *p) {
+        if(p==last && p!=NULL) {
+            start=(char *)p;
+            last=NULL;
+        }
+    }
 
-static int32_t U_CALLCONV
-hashStringTrieNode(const UHashTok key) {
-    return icu::StringTrieBuilder::hashNode(key.pointer);
+    Node *find(const Node &node) const {
+        Map::Entry *entry=map.find(const_cast<Node *>(&node));
+        return entry!=NULL ? entry->key : NULL;
+    }
+
+    /**
+     * Adds the node unless there is an equivalent one already.
+     * @return the equivalent node, or the input node if it was added,
+     *         or NULL if memory allocation failed
+     */
+    Node *add(Node *node, UErrorCode &errorCode) {
+        Map::Entry *entry=map.put(node, TRUE, errorCode);
+        return entry!=NULL ? entry->key : NULL;
+    }
+
+private:
+    struct NodeTraits {
+        static int32_t hash(Node *const &node) { return node->hashCode(); }
+        static UBool equals(Node *const &left, Node *const &right) { return *left==*right; }
+    };
+    typedef OpenHashMap<Node *, UBool, NodeTraits> Map;
+
+    // Each block starts with a pointer to the previous block.
+    static const size_t kBlockSize=0x10000;
+    static const size_t kAlignment=sizeof(double) > sizeof(void *) ? sizeof(double) : sizeof(void *);
+
+    Map map;
+    void *blocks;
+    char *start;  // free memory in the current block
+    char *limit;
+    void *last;  // the last allocation, unless it was released
+};
+
+StringTrieBuilder::NodeSet::~NodeSet() {
+    int32_t pos=-1;
+    Map::Entry *entry;
+    while((entry=map.nextEntry(pos))!=NULL) {
+        delete entry->key;  // Runs the destructor; the blocks are freed below.
+    }
+    while(blocks!=NULL) {
+        void *previous=*(void **)blocks;
+        uprv_free(blocks);
+        blocks=previous;
+    }
+}
+
+void *
+StringTrieBuilder::NodeSet::allocate(size_t size) {
+    size=(size+kAlignment-1)&~(kAlignment-1);
+    if((size_t)(limit-start)<size) {
+        U_ASSERT(size<=kBlockSize-kAlignment);
+        char *block=(char *)uprv_malloc(kBlockSize);
+        if(block==NULL) {
+            return NULL;
+        }
+        *(void **)block=blocks;
+        blocks=block;
+        start=block+kAlignment;
+        limit=block+kBlockSize;
+    }
+    last=start;
+    start+=size;
+    return last;
 }
 
-static UBool U_CALLCONV
-equalStringTrieNodes(const UHashTok key1, const UHashTok key2) {
-    return icu::StringTrieBuilder::equalNodes(key1.pointer, key2.pointer);
+void *
+StringTrieBuilder::Node::operator new(size_t size, const StringTrieBuilder &builder) U_NOEXCEPT {
+    return builder.nodes->allocate(size);
 }
 
-U_CDECL_END
+void
+StringTrieBuilder::Node::operator delete(void *p, const StringTrieBuilder &builder) U_NOEXCEPT {
+    builder.nodes->release(p);
+}
 
-U_NAMESPACE_BEGIN
+void
+StringTrieBuilder::Node::operator delete(void * /*p*/) U_NOEXCEPT {
+    // The NodeSet frees the memory.
+}
 
 StringTrieBuilder::StringTrieBuilder() : nodes(NULL) {}
 
@@ -43,24 +131,19 @@ StringTrieBuilder::~StringTrieBuilder() {
 }
 
 void
-StringTrieBuilder::createCompactBuilder(int32_t sizeGuess, UErrorCode &errorCode) {
+StringTrieBuilder::createCompactBuilder(int32_t /*sizeGuess*/, UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) {
         return;
     }
-    nodes=uhash_openSize(hashStringTrieNode, equalStringTrieNodes, NULL,
-                         sizeGuess, &errorCode);
-    if(U_SUCCESS(errorCode)) {
-        if(nodes==NULL) {
-          errorCode=U_MEMORY_ALLOCATION_ERROR;
-        } else {
-          uhash_setKeyDeleter(nodes, uprv_deleteUObject);
-        }
+    nodes=new NodeSet();
+    if(nodes==NULL) {
+        errorCode=U_MEMORY_ALLOCATION_ERROR;
     }
 }
 
 void
 StringTrieBuilder::deleteCompactBuilder() {
-    uhash_close(nodes);
+    delete nodes;
     nodes=NULL;
 }
 
@@ -242,13 +325,13 @@ StringTrieBuilder::makeNode(int32_t start, int32_t limit, int32_t unitIndex, UEr
         int32_t length=countElementUnits(start, limit, unitIndex);
         // length>=2 because minUnit!=maxUnit.
         Node *subNode=makeBranchSubNode(start, limit, unitIndex, length, errorCode);
-        node=new BranchHeadNode(length, subNode);
+        node=new(*this) BranchHeadNode(length, subNode);
     }
     if(hasValue && node!=NULL) {
         if(matchNodesCanHaveValues()) {
             ((ValueNode *)node)->setValue(value);
         } else {
-            node=new IntermediateValueNode(value, registerNode(node, errorCode));
+            node=new(*this) IntermediateValueNode(value, registerNode(node, errorCode));
         }
     }
     return registerNode(node, errorCode);
@@ -280,7 +363,7 @@ StringTrieBuilder::makeBranchSubNode(int32_t start, int32_t limit, int32_t unitI
     if(U_FAILURE(errorCode)) {
         return NULL;
     }
-    ListBranchNode *listNode=new ListBranchNode();
+    ListBranchNode *listNode=new(*this) ListBranchNode();
     if(listNode==NULL) {
         errorCode=U_MEMORY_ALLOCATION_ERROR;
         return NULL;
@@ -310,7 +393,7 @@ StringTrieBuilder::makeBranchSubNode(int32_t start, int32_t limit, int32_t unitI
     while(ltLength>0) {
         --ltLength;
         node=registerNode(
-            new SplitBranchNode(middleUnits[ltLength], lessThan[ltLength], node), errorCode);
+            new(*this) SplitBranchNode(middleUnits[ltLength], lessThan[ltLength], node), errorCode);
     }
     return node;
 }
@@ -325,23 +408,13 @@ StringTrieBuilder::registerNode(Node *newNode, UErrorCode &errorCode) {
         errorCode=U_MEMORY_ALLOCATION_ERROR;
         return NULL;
     }
-    const UHashElement *old=uhash_find(nodes, newNode);
-    if(old!=NULL) {
-        delete newNode;
-        return (Node *)old->key.pointer;
-    }
-    // If uhash_puti() returns a non-zero value from an equivalent, previously
-    // registered node, then uhash_find() failed to find that and we will leak newNode.
-#if U_DEBUG
-    int32_t oldValue=  // Only in debug mode to avoid a compiler warning about unused oldValue.
-#endif
-    uhash_puti(nodes, newNode, 1, &errorCode);
-    U_ASSERT(oldValue==0);
-    if(U_FAILURE(errorCode)) {
+    Node *node=nodes->add(newNode, errorCode);
+    if(node!=newNode) {
+        // Failure, or an equivalent node is registered already.
+        nodes->release(newNode);
         delete newNode;
-        return NULL;
     }
-    return newNode;
+    return node;
 }
 
 StringTrieBuilder::Node *
@@ -350,27 +423,11 @@ StringTrieBuilder::registerFinalValue(int32_t value, UErrorCode &errorCode) {
         return NULL;
     }
     FinalValueNode key(value);
-    const UHashElement *old=uhash_find(nodes, &key);
-    if(old!=NULL) {
-        return (Node *)old->key.pointer;
-    }
-    Node *newNode=new FinalValueNode(value);
-    if(newNode==NULL) {
-        errorCode=U_MEMORY_ALLOCATION_ERROR;
-        return NULL;
-    }
-    // If uhash_puti() returns a non-zero value from an equivalent, previously
-    // registered node, then uhash_find() failed to find that and we will leak newNode.
-#if U_DEBUG
-    int32_t oldValue=  // Only in debug mode to avoid a compiler warning about unused oldValue.
-#endif
-    uhash_puti(nodes, newNode, 1, &errorCode);
-    U_ASSERT(oldValue==0);
-    if(U_FAILURE(errorCode)) {
-        delete newNode;
-        return NULL;
+    Node *oldNode=nodes->find(key);
+    if(oldNode!=NULL) {
+        return oldNode;
     }
-    return newNode;
+    return registerNode(new(*this) FinalValueNode(value), errorCode);
 }
 
 int32_t
@@ -26,6 +26,7 @@
 #include "ubidi_props.h"
 #include "ubidiimp.h"
 #include "uassert.h"
+#include "usimd.h"
 
 /*
  * General implementation notes:
@@ -182,6 +183,89 @@ ubidi_openSized(int32_t maxLength, int32_t maxRunCount, UErrorCode *pErrorCode)
     }
 }
 
+/*
+ * Layout of a ubidi_openBuffer() buffer, after aligning its start:
+ * the UBiDi object, runs[maxRunCount] (only if maxRunCount>1,
+ * otherwise simpleRuns[] suffices), dirProps[maxLength], levels[maxLength].
+ * The size includes the worst-case alignment padding so that
+ * ubidi_getBufferSize() does not depend on the buffer address.
+ * Returns -1 if the size does not fit into an int32_t.
+ */
+#define BUFFER_OBJECT_SIZE \
+        ((sizeof(UBiDi)+sizeof(UAlignedMemory)-1)&~(sizeof(UAlignedMemory)-1))
+
+static int32_t
+getBufferSize(int32_t maxLength, int32_t maxRunCount) {
+    int64_t size=(int64_t)(sizeof(UAlignedMemory)-1)+(int64_t)BUFFER_OBJECT_SIZE;
+    if(maxRunCount>1) {
+        size+=(int64_t)maxRunCount*(int64_t)sizeof(Run);
+    }
+    size+=2*(int64_t)maxLength;
+    return size<=INT32_MAX ? (int32_t)size : -1;
+}
+
+U_CAPI int32_t U_EXPORT2
+ubidi_getBufferSize(int32_t maxLength, int32_t maxRunCount, UErrorCode *pErrorCode) {
+    int32_t size;
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    } else if(maxLength<0 || maxRunCount<0 || (size=getBufferSize(maxLength, maxRunCount))<0) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    return size;
+}
+
+U_CAPI UBiDi * U_EXPORT2
+ubidi_openBuffer(void *buffer, int32_t capacity,
+                 int32_t maxLength, int32_t maxRunCount,
+                 UErrorCode *pErrorCode) {
+    UBiDi *pBiDi;
+    char *p;
+    int32_t size;
+
+    /* check the argument values */
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return NULL;
+    } else if(buffer==NULL || capacity<0 || maxLength<0 || maxRunCount<0 ||
+              (size=getBufferSize(maxLength, maxRunCount))<0) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    } else if(capacity<size) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+        return NULL;
+    }
+
+    p=(char *)buffer;
+    if(U_ALIGNMENT_OFFSET(p)!=0) {
+        p+=U_ALIGNMENT_OFFSET_UP(p);
+    }
+    pBiDi=(UBiDi *)p;
+
+    /* reset the object, all pointers NULL, all flags FALSE, all sizes 0 */
+    uprv_memset(pBiDi, 0, sizeof(UBiDi));
+    pBiDi->isInBuffer=TRUE;
+    p+=BUFFER_OBJECT_SIZE;
+
+    /* carve the fixed-size arrays; mayAllocateText/Runs stay FALSE */
+    if(maxRunCount>1) {
+        pBiDi->runsMemory=(Run *)p;
+        pBiDi->runsSize=maxRunCount*(int32_t)sizeof(Run);
+        p+=pBiDi->runsSize;
+    } else if(maxRunCount==1) {
+        /* use simpleRuns[] */
+        pBiDi->runsSize=sizeof(Run);
+    }
+    if(maxLength>0) {
+        pBiDi->dirPropsMemory=(DirProp *)p;
+        pBiDi->dirPropsSize=maxLength;
+        p+=maxLength;
+        pBiDi->levelsMemory=(UBiDiLevel *)p;
+        pBiDi->levelsSize=maxLength;
+    }
+    return pBiDi;
+}
+
 /*
  * We are allowed to allocate memory if memory==NULL or
  * mayAllocate==TRUE for each array that we need.
@@ -238,11 +322,16 @@ U_CAPI void U_EXPORT2
 ubidi_close(UBiDi *pBiDi) {
     if(pBiDi!=NULL) {
         pBiDi->pParaBiDi=NULL;          /* in case one tries to reuse this block */
-        if(pBiDi->dirPropsMemory!=NULL) {
-            uprv_free(pBiDi->dirPropsMemory);
-        }
-        if(pBiDi->levelsMemory!=NULL) {
-            uprv_free(pBiDi->levelsMemory);
+        if(!pBiDi->isInBuffer) {
+            if(pBiDi->dirPropsMemory!=NULL) {
+                uprv_free(pBiDi->dirPropsMemory);
+            }
+            if(pBiDi->levelsMemory!=NULL) {
+                uprv_free(pBiDi->levelsMemory);
+            }
+            if(pBiDi->runsMemory!=NULL) {
+                uprv_free(pBiDi->runsMemory);
+            }
         }
         if(pBiDi->openingsMemory!=NULL) {
             uprv_free(pBiDi->openingsMemory);
@@ -250,9 +339,6 @@ ubidi_close(UBiDi *pBiDi) {
         if(pBiDi->parasMemory!=NULL) {
             uprv_free(pBiDi->parasMemory);
         }
-        if(pBiDi->runsMemory!=NULL) {
-            uprv_free(pBiDi->runsMemory);
-        }
         if(pBiDi->isolatesMemory!=NULL) {
             uprv_free(pBiDi->isolatesMemory);
         }
@@ -260,7 +346,9 @@ ubidi_close(UBiDi *pBiDi) {
             uprv_free(pBiDi->insertPoints.points);
         }
 
-        uprv_free(pBiDi);
+        if(!pBiDi->isInBuffer) {
+            uprv_free(pBiDi);
+        }
     }
 }
 
@@ -2550,6 +2638,115 @@ setParaRunsOnly(UBiDi *pBiDi, const UChar *text, int32_t length,
     pBiDi->reorderingMode=UBIDI_REORDER_RUNS_ONLY;
 }
 
+/*
+ * Fast path for ubidi_setPara() without embeddingLevels:
+ * Determine the paragraph level and the flags like getDirProps() does,
+ * but without storing dirProps[], and stop as soon as the text cannot be
+ * unidirectional.
+ * If directionFromFlags() yields UBIDI_LTR or UBIDI_RTL, then all levels are
+ * implicitly at paraLevel and ubidi_setPara() would not look at dirProps[]
+ * and levels[] again, so neither needs to be allocated.
+ *
+ * Handles only a single paragraph (a block separator only at the end)
+ * without explicit embedding or isolate controls, with the default
+ * character classes and forward reordering, and without streaming.
+ * Runs of Latin-1 letters, digits, punctuation and spaces, which are
+ * neither R, AL nor AN, are skipped in bulk on LTR paragraphs; this sets
+ * the ON flag for them in place of their actual classes, which does not
+ * change the outcome except that text with AN falls back to the full algorithm.
+ *
+ * Returns TRUE and sets up the UBiDi object if the paragraph is unidirectional.
+ * Returns FALSE if the full algorithm is needed; pBiDi->flags is then stale.
+ */
+static UBool
+setParaUnidirectional(UBiDi *pBiDi) {
+    const UChar *text=pBiDi->text;
+    int32_t i=0, length=pBiDi->originalLength;
+    Flags flags=0;
+    UChar32 uchar;
+    UChar c;
+    DirProp dirProp;
+    UBiDiLevel level=pBiDi->paraLevel;
+    UBool isDefaultLevel=IS_DEFAULT_LEVEL(level);
+    UBool seekingStrong=FALSE;
+    int32_t lastArabicPos=-1;
+    int32_t controlCount=0;
+    UBool removeBiDiControls = (UBool)(pBiDi->reorderingOptions &
+                                       UBIDI_OPTION_REMOVE_CONTROLS);
+    UBiDiDirection direction;
+
+    if(pBiDi->fnClassCallback!=NULL ||
+       pBiDi->reorderingMode>UBIDI_REORDER_GROUP_NUMBERS_WITH_R ||
+       (pBiDi->reorderingOptions & UBIDI_OPTION_STREAMING)) {
+        return FALSE;
+    }
+    if(isDefaultLevel) {
+        level&=1;
+        if(pBiDi->proLength>0 &&                    /* there is a prologue */
+           (dirProp=firstL_R_AL(pBiDi))!=ON) {  /* with a strong character */
+            level= dirProp==L ? 0 : 1;
+        } else {
+            seekingStrong=TRUE;
+        }
+    }
+    while(i<length) {
+        if(!seekingStrong && !(level&1) &&
+           (c=text[i])<=0xff && (c&0x60)!=0) {
+            i+=uprv_latin1SpanNotControlUChars(text+i, length-i);
+            flags|=DIRPROP_FLAG(ON);
+            continue;
+        }
+        /* i is incremented by U16_NEXT */
+        U16_NEXT(text, i, length, uchar);
+        flags|=DIRPROP_FLAG(dirProp=(DirProp)ubidi_getClass(uchar));
+        if(uchar>0xffff) {  /* the lead surrogate's property would be BN */
+            flags|=DIRPROP_FLAG(BN);
+        }
+        if(removeBiDiControls && IS_BIDI_CONTROL_CHAR(uchar))
+            controlCount++;
+        if(dirProp==L || dirProp==R || dirProp==AL) {
+            if(seekingStrong) {
+                level= dirProp==L ? 0 : 1;
+                seekingStrong=FALSE;
+            }
+            if(dirProp==AL)
+                lastArabicPos=i-1;
+        } else if(dirProp==B) {
+            if(i<length && !(uchar==CR && text[i]==LF && (i+1)==length)) {
+                return FALSE;           /* more than one paragraph */
+            }
+        } else if(DIRPROP_FLAG(dirProp)&(MASK_EXPLICIT|MASK_ISO)) {
+            return FALSE;
+        }
+        if(!seekingStrong && (flags&((level&1) ? MASK_LTR : MASK_RTL))) {
+            return FALSE;               /* mixed directionality */
+        }
+    }
+
+    flags|=DIRPROP_FLAG_LR(level);
+    if(pBiDi->orderParagraphsLTR && (flags&DIRPROP_FLAG(B))) {
+        flags|=DIRPROP_FLAG(L);
+    }
+    pBiDi->flags=flags;
+    direction=directionFromFlags(pBiDi);
+    if(direction==UBIDI_MIXED) {
+        return FALSE;
+    }
+
+    pBiDi->paras[0].limit=length;
+    pBiDi->paras[0].level=level;
+    if(isDefaultLevel) {
+        pBiDi->paraLevel=level;
+    }
+    pBiDi->controlCount=controlCount;
+    pBiDi->lastArabicPos=lastArabicPos;
+    pBiDi->isolateCount=-1;
+    pBiDi->direction=direction;
+    /* all levels are implicitly at paraLevel (important for ubidi_getLevels()) */
+    pBiDi->trailingWSStart=0;
+    return TRUE;
+}
+
 /* ubidi_setPara ------------------------------------------------------------ */
 
 U_CAPI void U_EXPORT2
@@ -2621,6 +2818,15 @@ ubidi_setPara(UBiDi *pBiDi, const UChar *text, int32_t length,
     else
         pBiDi->paras=pBiDi->simpleParas;
 
+    /* unidirectional text needs neither dirProps[] nor levels[] */
+    if(embeddingLevels==NULL && setParaUnidirectional(pBiDi)) {
+        if(pBiDi->reorderingOptions & UBIDI_OPTION_REMOVE_CONTROLS) {
+            pBiDi->resultLength -= pBiDi->controlCount;
+        }
+        setParaSuccess(pBiDi);          /* mark successful setPara */
+        return;
+    }
+
     /*
      * Get the directional properties,
      * the flags bit-set, and
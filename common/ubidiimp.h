@@ -287,6 +287,10 @@ struct UBiDi {
     /* indicators for whether memory may be allocated after ubidi_open() */
     UBool mayAllocateText, mayAllocateRuns;
 
+    /* TRUE if the object and its text and runs arrays live in a caller buffer
+     * (ubidi_openBuffer()) and must not be freed */
+    UBool isInBuffer;
+
     /* arrays with one value per text-character */
     DirProp *dirProps;
     UBiDiLevel *levels;
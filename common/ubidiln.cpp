@@ -167,8 +167,9 @@ ubidi_setLine(const UBiDi *pParaBiDi,
         pLineBiDi->resultLength-=pLineBiDi->controlCount;
     }
 
-    pLineBiDi->dirProps=pParaBiDi->dirProps+start;
-    pLineBiDi->levels=pParaBiDi->levels+start;
+    /* a unidirectional paragraph may have neither dirProps[] nor levels[] */
+    pLineBiDi->dirProps= pParaBiDi->dirProps!=NULL ? pParaBiDi->dirProps+start : NULL;
+    pLineBiDi->levels= pParaBiDi->levels!=NULL ? pParaBiDi->levels+start : NULL;
     pLineBiDi->runCount=-1;
 
     if(pParaBiDi->direction!=UBIDI_MIXED) {
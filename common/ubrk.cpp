@@ -353,5 +353,47 @@ ubrk_getBinaryRules(UBreakIterator *bi,
     return (int32_t)rulesLength;
 }
 
+U_CAPI int32_t U_EXPORT2
+ubrk_getBoundaries(UBreakIterator *bi, int32_t start, int32_t limit,
+                   int32_t *boundaries, int32_t *ruleStatuses, int32_t capacity,
+                   UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    BreakIterator *brkit = reinterpret_cast<BreakIterator *>(bi);
+    RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(brkit);
+    if (rbbi != NULL) {
+        return rbbi->getBoundaries(start, limit, boundaries, ruleStatuses, capacity, *status);
+    }
+
+    // Other break iterators, one boundary at a time.
+    if (capacity < 0 || (boundaries == NULL && capacity > 0) || start > limit) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t count = 0;
+    int32_t pos = start <= 0 ? brkit->first() : brkit->following(start - 1);
+    int32_t last = UBRK_DONE;
+    while (pos != UBRK_DONE && pos <= limit) {
+        if (count < capacity) {
+            boundaries[count] = pos;
+            if (ruleStatuses != NULL) {
+                ruleStatuses[count] = brkit->getRuleStatus();
+            }
+        }
+        ++count;
+        last = pos;
+        pos = brkit->next();
+    }
+    if (last != UBRK_DONE) {
+        brkit->isBoundary(last);
+    }
+    if (count > capacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
 
 #endif /* #if !UCONFIG_NO_BREAK_ITERATION */
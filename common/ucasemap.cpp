@@ -41,6 +41,7 @@
 #include "uassert.h"
 #include "ucase.h"
 #include "ucasemap_imp.h"
+#include "usimd.h"
 #include "ustr_imp.h"
 
 U_NAMESPACE_USE
@@ -213,7 +214,11 @@ void toLower(int32_t caseLocale, uint32_t options,
     } else {
         latinToLower = LatinCase::TO_LOWER_TR_LT;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    // Without Edits, ASCII runs are lowercased in bulk into the sink's buffer.
+    // Otherwise, and for tr/lt (special I), only runs of unchanged ASCII are skipped in bulk.
+    UBool asciiToLower = latinToLower == LatinCase::TO_LOWER_NORMAL && edits == nullptr &&
+        (options & U_OMIT_UNCHANGED_TEXT) == 0;
+    const UCPTrie *trie = ucase_getTrie();
     int32_t prev = srcStart;
     int32_t srcIndex = srcStart;
     for (;;) {
@@ -225,6 +230,33 @@ void toLower(int32_t caseLocale, uint32_t options,
                 c = U_SENTINEL;
                 break;
             }
+            if (src[srcIndex] <= 0x7f && (srcLimit - srcIndex) >= UPRV_SIMD_MIN_LENGTH &&
+                    src[srcIndex + UPRV_SIMD_MIN_LENGTH - 1] <= 0x7f) {
+                // probably a long ASCII run
+                int32_t length;
+                if (asciiToLower) {
+                    ByteSinkUtil::appendUnchanged(src + prev, srcIndex - prev,
+                                                  sink, options, edits, errorCode);
+                    char scratch[200];
+                    int32_t capacity;
+                    char *buffer = sink.GetAppendBuffer(
+                        UPRV_SIMD_MIN_LENGTH, srcLimit - srcIndex,
+                        scratch, UPRV_LENGTHOF(scratch), &capacity);
+                    length = srcLimit - srcIndex;
+                    if (length > capacity) {
+                        length = capacity;
+                    }
+                    length = uprv_asciiToLower(src + srcIndex, (uint8_t *)buffer, length);
+                    sink.Append(buffer, length);
+                    prev = srcIndex + length;
+                } else {
+                    length = uprv_asciiSpanNotUpper(src + srcIndex, srcLimit - srcIndex);
+                }
+                if (length > 0) {
+                    srcIndex += length;
+                    continue;
+                }
+            }
             uint8_t lead = src[srcIndex++];
             if (lead <= 0x7f) {
                 int8_t d = latinToLower[lead];
@@ -278,7 +310,7 @@ void toLower(int32_t caseLocale, uint32_t options,
                 // ill-formed UTF-8
                 continue;
             }
-            uint16_t props = UTRIE2_GET16(trie, c);
+            uint16_t props = UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
             if (UCASE_HAS_EXCEPTION(props)) { break; }
             int32_t delta;
             if (!UCASE_IS_UPPER_OR_TITLE(props) || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -312,6 +344,101 @@ void toLower(int32_t caseLocale, uint32_t options,
                                   sink, options, edits, errorCode);
 }
 
+/**
+ * Lowercases s[0..length[ in place while each mapping has the same UTF-8 length
+ * as its original code point.
+ * @return length, or the index of the first code point that would change length
+ */
+int32_t toLowerInPlace(int32_t caseLocale, uint8_t *s, int32_t length, UErrorCode &errorCode) {
+    const int8_t *latinToLower;
+    if (caseLocale == UCASE_LOC_TURKISH || caseLocale == UCASE_LOC_LITHUANIAN) {
+        latinToLower = LatinCase::TO_LOWER_TR_LT;
+    } else {
+        latinToLower = LatinCase::TO_LOWER_NORMAL;
+    }
+    const UCPTrie *trie = ucase_getTrie();
+    UCaseContext csc = UCASECONTEXT_INITIALIZER;
+    csc.p = s;
+    csc.limit = length;
+    int32_t srcIndex = 0;
+    while (srcIndex < length) {
+        uint8_t lead = s[srcIndex];
+        if (lead <= 0x7f) {
+            if (latinToLower == LatinCase::TO_LOWER_NORMAL &&
+                    (length - srcIndex) >= UPRV_SIMD_MIN_LENGTH) {
+                srcIndex += uprv_asciiToLower(s + srcIndex, s + srcIndex, length - srcIndex);
+                continue;
+            }
+            int8_t d = latinToLower[lead];
+            if (d != LatinCase::EXC) {
+                s[srcIndex++] = (uint8_t)(lead + d);
+                continue;
+            }
+        }
+        int32_t cpStart = srcIndex;
+        UChar32 c;
+        U8_NEXT(s, srcIndex, length, c);
+        if (c < 0) {
+            continue;  // ill-formed UTF-8 is left unchanged
+        }
+        UChar32 lower;
+        int8_t d;
+        if (c < LatinCase::LONG_S && (d = latinToLower[c]) != LatinCase::EXC) {
+            lower = c + d;
+        } else {
+            uint16_t props = UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
+            if (!UCASE_HAS_EXCEPTION(props)) {
+                lower = UCASE_IS_UPPER_OR_TITLE(props) ? c + UCASE_GET_DELTA(props) : c;
+            } else {
+                if (caseLocale == UCASE_LOC_TURKISH && c == 0x49) {
+                    // I lowercases to the two-byte dotless i, or to i when a
+                    // combining dot above follows; that U+0307 is then removed, but only
+                    // while the preceding I is still there, so I must not be rewritten.
+                    errorCode = U_UNSUPPORTED_ERROR;
+                    return cpStart;
+                }
+                csc.cpStart = cpStart;
+                csc.cpLimit = srcIndex;
+                const UChar *mapping;
+                lower = ucase_toFullLower(c, utf8_caseContextIterator, &csc, &mapping, caseLocale);
+                if (lower < 0) {
+                    continue;
+                }
+                if (lower <= UCASE_MAX_STRING_LENGTH) {
+                    // Mapping to a string: Write it if its UTF-8 length matches.
+                    int32_t mappingLength = lower;
+                    int32_t utf8Length = 0;
+                    for (int32_t i = 0; i < mappingLength;) {
+                        UChar32 m;
+                        U16_NEXT(mapping, i, mappingLength, m);
+                        utf8Length += U8_LENGTH(m);
+                    }
+                    if (utf8Length != (srcIndex - cpStart)) {
+                        errorCode = U_UNSUPPORTED_ERROR;
+                        return cpStart;
+                    }
+                    int32_t destIndex = cpStart;
+                    for (int32_t i = 0; i < mappingLength;) {
+                        UChar32 m;
+                        U16_NEXT(mapping, i, mappingLength, m);
+                        U8_APPEND_UNSAFE(s, destIndex, m);
+                    }
+                    continue;
+                }
+            }
+        }
+        if (lower != c) {
+            if (U8_LENGTH(lower) != (srcIndex - cpStart)) {
+                errorCode = U_UNSUPPORTED_ERROR;
+                return cpStart;
+            }
+            int32_t destIndex = cpStart;
+            U8_APPEND_UNSAFE(s, destIndex, lower);
+        }
+    }
+    return length;
+}
+
 void toUpper(int32_t caseLocale, uint32_t options,
              const uint8_t *src, UCaseContext *csc, int32_t srcLength,
              icu::ByteSink &sink, icu::Edits *edits, UErrorCode &errorCode) {
@@ -321,7 +448,7 @@ void toUpper(int32_t caseLocale, uint32_t options,
     } else {
         latinToUpper = LatinCase::TO_UPPER_NORMAL;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    const UCPTrie *trie = ucase_getTrie();
     int32_t prev = 0;
     int32_t srcIndex = 0;
     for (;;) {
@@ -386,7 +513,7 @@ void toUpper(int32_t caseLocale, uint32_t options,
                 // ill-formed UTF-8
                 continue;
             }
-            uint16_t props = UTRIE2_GET16(trie, c);
+            uint16_t props = UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
             if (UCASE_HAS_EXCEPTION(props)) { break; }
             int32_t delta;
             if (UCASE_GET_TYPE(props) != UCASE_LOWER || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -858,6 +985,23 @@ ucasemap_utf8ToLower(const UCaseMap *csm,
         ucasemap_internalUTF8ToLower, NULL, *pErrorCode);
 }
 
+U_CAPI int32_t U_EXPORT2
+ucasemap_utf8ToLowerInPlace(const UCaseMap *csm,
+                            char *s, int32_t length,
+                            UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if ((s == NULL && length != 0) || length < -1) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (length == -1) {
+        length = (int32_t)uprv_strlen(s);
+    }
+    return toLowerInPlace(csm->caseLocale, (uint8_t *)s, length, *pErrorCode);
+}
+
 U_CAPI int32_t U_EXPORT2
 ucasemap_utf8ToUpper(const UCaseMap *csm,
                      char *dest, int32_t destCapacity,
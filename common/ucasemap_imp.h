@@ -14,8 +14,9 @@
 
 /**
  * Bit mask for the titlecasing iterator options bit field.
- * Currently only 3 out of 8 values are used:
- * 0 (words), U_TITLECASE_WHOLE_STRING, U_TITLECASE_SENTENCES.
+ * Currently only 4 out of 8 values are used:
+ * 0 (words), U_TITLECASE_WHOLE_STRING, U_TITLECASE_SENTENCES,
+ * U_TITLECASE_WHITE_SPACE_WORDS.
  * See stringoptions.h.
  * @internal
  */
@@ -96,6 +97,16 @@ BreakIterator *ustrcase_getTitleBreakIterator(
         const Locale *locale, const char *locID, uint32_t options, BreakIterator *iter,
         LocalPointer<BreakIterator> &ownedIter, UErrorCode &errorCode);
 
+/**
+ * Releases the ownedIter from ustrcase_getTitleBreakIterator(),
+ * for reuse by a later call with the same locale and options.
+ * Pass the same locale, locID and options.
+ */
+U_CFUNC
+void ustrcase_releaseTitleBreakIterator(
+        const Locale *locale, const char *locID, uint32_t options,
+        LocalPointer<BreakIterator> &ownedIter);
+
 #endif
 
 U_NAMESPACE_END
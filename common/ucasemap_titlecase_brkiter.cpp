@@ -52,6 +52,7 @@ void CaseMap::utf8ToTitle(
         src.data(), src.length(),
         ucasemap_internalUTF8ToTitle, sink, edits, errorCode);
     utext_close(&utext);
+    ustrcase_releaseTitleBreakIterator(nullptr, locale, options, ownedIter);
 }
 
 int32_t CaseMap::utf8ToTitle(
@@ -77,6 +78,7 @@ int32_t CaseMap::utf8ToTitle(
         src, srcLength,
         ucasemap_internalUTF8ToTitle, edits, errorCode);
     utext_close(&utext);
+    ustrcase_releaseTitleBreakIterator(nullptr, locale, options, ownedIter);
     return length;
 }
 
@@ -27,8 +27,12 @@
 #include "unicode/udata.h"
 #include "uassert.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "ucln_cmn.h"
-#include "utrie2.h"
+#include "unicode/ucptrie.h"
+#include "unicode/ustring.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "udataswp.h"
 #include "uprops.h"
 #include "ustr_imp.h"
@@ -40,7 +44,7 @@
 /* constants and macros for access to the data ------------------------------ */
 
 /* getting a uint32_t properties word from the data */
-#define GET_PROPS(c, result) ((result)=UTRIE2_GET16(&propsTrie, c));
+#define GET_PROPS(c, result) ((result)=UCPTRIE_FAST_GET(&propsTrie, UCPTRIE_16, c));
 
 /* API functions ------------------------------------------------------------ */
 
@@ -53,10 +57,6 @@ u_charType(UChar32 c) {
 }
 
 /* Enumerate all code points with their general categories. */
-struct _EnumTypeCallback {
-    UCharEnumTypeRange *enumRange;
-    const void *context;
-};
 
 static uint32_t U_CALLCONV
 _enumTypeValue(const void *context, uint32_t value) {
@@ -64,25 +64,22 @@ _enumTypeValue(const void *context, uint32_t value) {
     return GET_CATEGORY(value);
 }
 
-static UBool U_CALLCONV
-_enumTypeRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
-    /* just cast the value to UCharCategory */
-    return ((struct _EnumTypeCallback *)context)->
-        enumRange(((struct _EnumTypeCallback *)context)->context,
-                  start, end+1, (UCharCategory)value);
-}
-
 U_CAPI void U_EXPORT2
 u_enumCharTypes(UCharEnumTypeRange *enumRange, const void *context) {
-    struct _EnumTypeCallback callback;
-
     if(enumRange==NULL) {
         return;
     }
 
-    callback.enumRange=enumRange;
-    callback.context=context;
-    utrie2_enum(&propsTrie, _enumTypeValue, _enumTypeRange, &callback);
+    UChar32 start=0, end;
+    uint32_t value;
+    while((end=ucptrie_getRange(&propsTrie, start, UCPMAP_RANGE_NORMAL, 0,
+                                _enumTypeValue, NULL, &value))>=0) {
+        /* just cast the value to UCharCategory */
+        if(!enumRange(context, start, end+1, (UCharCategory)value)) {
+            break;
+        }
+        start=end+1;
+    }
 }
 
 /* Checks if ch is a lower case letter.*/
@@ -521,7 +518,7 @@ u_getUnicodeProperties(UChar32 c, int32_t column) {
     if(column>=propsVectorsColumns) {
         return 0;
     } else {
-        uint16_t vecIndex=UTRIE2_GET16(&propsVectorsTrie, c);
+        uint16_t vecIndex=UCPTRIE_FAST_GET(&propsVectorsTrie, UCPTRIE_16, c);
         return propsVectors[vecIndex+column];
     }
 }
@@ -635,6 +632,224 @@ uscript_getScriptExtensions(UChar32 c,
     return length;
 }
 
+/* script runs -------------------------------------------------------------- */
+
+namespace {
+
+/** Number of 32-bit words in a bit set of UScriptCode values. */
+constexpr int32_t SCRIPT_SET_LENGTH=(USCRIPT_CODE_LIMIT+31)/32;
+
+/**
+ * Collects script runs from the script/Script_Extensions bits (UPROPS_SCRIPT_X_MASK)
+ * of consecutive code points.
+ * While the run has seen a script-specific character, scripts[] contains
+ * the scripts that all of its characters have in common.
+ */
+class ScriptRunBuilder {
+public:
+    ScriptRunBuilder(UScriptRunInfo *runs, int32_t capacity) :
+            runs(runs), capacity(capacity), count(0),
+            runStart(0), runScript(USCRIPT_COMMON), anyScript(TRUE) {}
+
+    /** Adds the code point at index i. */
+    inline void add(int32_t i, uint32_t scriptX) {
+        if(scriptX<UPROPS_SCRIPT_X_WITH_COMMON) {
+            if(scriptX<=USCRIPT_INHERITED) {
+                return;  // Common & Inherited continue any run.
+            }
+            if(anyScript ? startRun(scriptX) : narrowTo(scriptX)) {
+                return;
+            }
+        } else if(addExtensions(scriptX)) {
+            return;
+        }
+        // Not compatible with the current run: Start a new one.
+        appendRun(i);
+        runStart=i;
+        anyScript=TRUE;
+        if(scriptX<UPROPS_SCRIPT_X_WITH_COMMON) {
+            startRun(scriptX);
+        } else {
+            addExtensions(scriptX);
+        }
+    }
+
+    int32_t finish(int32_t limit, UErrorCode &errorCode) {
+        if(limit>runStart) {
+            appendRun(limit);
+        }
+        if(count>capacity) {
+            errorCode=U_BUFFER_OVERFLOW_ERROR;
+        }
+        return count;
+    }
+
+private:
+    UBool startRun(uint32_t sc) {
+        runScript=(UScriptCode)sc;
+        anyScript=FALSE;
+        uprv_memset(scripts, 0, sizeof(scripts));
+        scripts[sc>>5]=(uint32_t)1<<(sc&31);
+        return TRUE;
+    }
+
+    /** Narrows the run to script sc if that is one of its possible scripts. */
+    UBool narrowTo(uint32_t sc) {
+        if((scripts[sc>>5]&((uint32_t)1<<(sc&31)))==0) {
+            return FALSE;
+        }
+        startRun(sc);
+        return TRUE;
+    }
+
+    UBool addExtensions(uint32_t scriptX) {
+        const uint16_t *scx=scriptExtensions+(scriptX&UPROPS_SCRIPT_MASK);
+        UScriptCode preferred;
+        if(scriptX>=UPROPS_SCRIPT_X_WITH_OTHER) {
+            preferred=(UScriptCode)*scx;
+            scx=scriptExtensions+scx[1];
+        } else {
+            preferred=(UScriptCode)(*scx&0x7fff);
+        }
+        uint32_t set[SCRIPT_SET_LENGTH]={ 0 };
+        uint16_t sx;
+        do {
+            sx=*scx++&0x7fff;
+            // Guard against data beyond the UScriptCode values known to this code.
+            if(sx<USCRIPT_CODE_LIMIT) {
+                set[sx>>5]|=(uint32_t)1<<(sx&31);
+            }
+        } while(scx[-1]<0x8000);
+        if(anyScript) {
+            uprv_memcpy(scripts, set, sizeof(scripts));
+            runScript=preferred;
+            anyScript=FALSE;
+            return TRUE;
+        }
+        uint32_t any=0;
+        for(int32_t j=0; j<SCRIPT_SET_LENGTH; ++j) {
+            any|=set[j]&=scripts[j];
+        }
+        if(any==0) {
+            return FALSE;
+        }
+        uprv_memcpy(scripts, set, sizeof(scripts));
+        if((scripts[runScript>>5]&((uint32_t)1<<(runScript&31)))==0) {
+            // Use the lowest-numbered script that is still possible.
+            for(int32_t j=0;; ++j) {
+                if(scripts[j]!=0) {
+                    uint32_t bits=scripts[j];
+                    int32_t bit=0;
+                    while((bits&1)==0) {
+                        bits>>=1;
+                        ++bit;
+                    }
+                    runScript=(UScriptCode)(j*32+bit);
+                    break;
+                }
+            }
+        }
+        return TRUE;
+    }
+
+    void appendRun(int32_t limit) {
+        if(count<capacity) {
+            UScriptRunInfo &run=runs[count];
+            run.start=runStart;
+            run.limit=limit;
+            run.script=anyScript ? USCRIPT_COMMON : runScript;
+        }
+        ++count;
+    }
+
+    UScriptRunInfo *runs;
+    int32_t capacity;
+    int32_t count;
+    int32_t runStart;
+    UScriptCode runScript;
+    UBool anyScript;
+    uint32_t scripts[SCRIPT_SET_LENGTH];
+};
+
+/**
+ * Script bits for ASCII: All ASCII letters are Latin, all other ASCII characters
+ * are Common without Script_Extensions.
+ */
+inline uint32_t asciiScriptX(UChar32 c) {
+    return (uint32_t)((c|0x20)-0x61)<26 ? USCRIPT_LATIN : USCRIPT_COMMON;
+}
+
+UBool checkScriptRunsArgs(const void *s, int32_t length,
+                          UScriptRunInfo *runs, int32_t capacity,
+                          UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return FALSE;
+    }
+    if((s==NULL && length!=0) || length<-1 || capacity<0 || (capacity>0 && runs==NULL)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+uscript_getScriptRuns(const UChar *s, int32_t length,
+                      UScriptRunInfo *runs, int32_t capacity,
+                      UErrorCode *pErrorCode) {
+    if(!checkScriptRunsArgs(s, length, runs, capacity, pErrorCode)) {
+        return 0;
+    }
+    if(length<0) {
+        length=u_strlen(s);
+    }
+    ScriptRunBuilder builder(runs, capacity);
+    const UChar *p=s, *limit=s+length;
+    while(p<limit) {
+        int32_t i=(int32_t)(p-s);
+        UChar32 c=*p;
+        if(c<0x80) {
+            ++p;
+            builder.add(i, asciiScriptX(c));
+        } else {
+            // One trie lookup per code point; unpaired surrogates yield
+            // the error value, which is the vector for unassigned code points.
+            uint16_t vecIndex;
+            UCPTRIE_FAST_U16_NEXT(&propsVectorsTrie, UCPTRIE_16, p, limit, c, vecIndex);
+            builder.add(i, propsVectors[vecIndex]&UPROPS_SCRIPT_X_MASK);
+        }
+    }
+    return builder.finish(length, *pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+uscript_getScriptRunsUTF8(const char *s, int32_t length,
+                          UScriptRunInfo *runs, int32_t capacity,
+                          UErrorCode *pErrorCode) {
+    if(!checkScriptRunsArgs(s, length, runs, capacity, pErrorCode)) {
+        return 0;
+    }
+    if(length<0) {
+        length=(int32_t)uprv_strlen(s);
+    }
+    ScriptRunBuilder builder(runs, capacity);
+    const char *p=s, *limit=s+length;
+    while(p<limit) {
+        int32_t i=(int32_t)(p-s);
+        uint8_t b=(uint8_t)*p;
+        if(b<0x80) {
+            ++p;
+            builder.add(i, asciiScriptX(b));
+        } else {
+            uint16_t vecIndex;
+            UCPTRIE_FAST_U8_NEXT(&propsVectorsTrie, UCPTRIE_16, p, limit, vecIndex);
+            builder.add(i, propsVectors[vecIndex]&UPROPS_SCRIPT_X_MASK);
+        }
+    }
+    return builder.finish(length, *pErrorCode);
+}
+
 U_CAPI UBlockCode U_EXPORT2
 ublock_getCode(UChar32 c) {
     return (UBlockCode)((u_getUnicodeProperties(c, 0)&UPROPS_BLOCK_MASK)>>UPROPS_BLOCK_SHIFT);
@@ -642,14 +857,14 @@ ublock_getCode(UChar32 c) {
 
 /* property starts for UnicodeSet ------------------------------------------- */
 
-static UBool U_CALLCONV
-_enumPropertyStartsRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
-    /* add the start code point to the USet */
-    const USetAdder *sa=(const USetAdder *)context;
-    sa->add(sa->set, start);
-    (void)end;
-    (void)value;
-    return TRUE;
+static void
+_addPropertyStarts(const UCPTrie *trie, const USetAdder *sa) {
+    UChar32 start=0, end;
+    while((end=ucptrie_getRange(trie, start, UCPMAP_RANGE_NORMAL, 0,
+                                NULL, NULL, NULL))>=0) {
+        sa->add(sa->set, start);
+        start=end+1;
+    }
 }
 
 #define USET_ADD_CP_AND_NEXT(sa, cp) sa->add(sa->set, cp); sa->add(sa->set, cp+1)
@@ -661,7 +876,7 @@ uchar_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
     }
 
     /* add the start code point of each same-value range of the main trie */
-    utrie2_enum(&propsTrie, NULL, _enumPropertyStartsRange, sa);
+    _addPropertyStarts(&propsTrie, sa);
 
     /* add code points with hardcoded properties, plus the ones following them */
 
@@ -721,5 +936,5 @@ upropsvec_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
     }
 
     /* add the start code point of each same-value range of the properties vectors trie */
-    utrie2_enum(&propsVectorsTrie, NULL, _enumPropertyStartsRange, sa);
+    _addPropertyStarts(&propsVectorsTrie, sa);
 }
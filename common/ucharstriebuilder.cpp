@@ -82,7 +82,14 @@ UCharsTrieElement::setTo(const UnicodeString &s, int32_t val,
 
 int32_t
 UCharsTrieElement::compareStringTo(const UCharsTrieElement &other, const UnicodeString &strings) const {
-    return getString(strings).compare(other.getString(strings));
+    // Compare the units directly rather than via temporary substrings:
+    // Sorting large sets of strings spends most of its time in here.
+    const UChar *s=strings.getBuffer()+stringOffset;
+    const UChar *t=strings.getBuffer()+other.stringOffset;
+    int32_t length=*s++;
+    int32_t otherLength=*t++;
+    int32_t result=u_memcmp(s, t, length<otherLength ? length : otherLength);
+    return result!=0 ? result : length-otherLength;
 }
 
 UCharsTrieBuilder::UCharsTrieBuilder(UErrorCode & /*errorCode*/)
@@ -313,7 +320,7 @@ UCharsTrieBuilder::UCTLinearMatchNode::write(StringTrieBuilder &builder) {
 StringTrieBuilder::Node *
 UCharsTrieBuilder::createLinearMatchNode(int32_t i, int32_t unitIndex, int32_t length,
                                          Node *nextNode) const {
-    return new UCTLinearMatchNode(
+    return new(*this) UCTLinearMatchNode(
             elements[i].getString(strings).getBuffer()+unitIndex,
             length,
             nextNode);
@@ -35,12 +35,16 @@ typedef enum ECleanupCommonType {
     UCLN_COMMON_START = -1,
     UCLN_COMMON_NUMPARSE_UNISETS,
     UCLN_COMMON_USPREP,
+    UCLN_COMMON_RELEASED_BREAKITERATOR,
+    UCLN_COMMON_RBBI_RULES,
     UCLN_COMMON_BREAKITERATOR,
     UCLN_COMMON_RBBI,
     UCLN_COMMON_SERVICE,
     UCLN_COMMON_LOCALE_KEY_TYPE,
     UCLN_COMMON_LOCALE,
     UCLN_COMMON_LOCALE_AVAILABLE,
+    UCLN_COMMON_LIKELY_SUBTAGS,
+    UCLN_COMMON_LOCALE_MATCHER,
     UCLN_COMMON_ULOC,
     UCLN_COMMON_CURRENCY,
     UCLN_COMMON_LOADED_NORMALIZER2,
@@ -62,6 +66,11 @@ typedef enum ECleanupCommonType {
     */
     UCLN_COMMON_UNIFIED_CACHE,
     UCLN_COMMON_URES,
+    /*
+       Resource bundles release their decompressed data items when they are
+       cleaned up, so the cache of decompressed items must be cleaned up last.
+    */
+    UCLN_COMMON_UCMPDATA,
     UCLN_COMMON_COUNT /* This must be last */
 } ECleanupCommonType;
 
@@ -24,6 +24,7 @@
 
 #include "unicode/utypes.h"
 #include "unicode/udata.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "ucmndata.h"
 #include "udatamem.h"
@@ -211,6 +212,92 @@ pointerTOCPrefixBinarySearch(const char *s, const PointerTOCEntry *toc, int32_t
     return -1;
 }
 
+/*-----------------------------------------------------------------------------*
+ *                                                                             *
+ *    Hash index for offset TOCs                                               *
+ *                                                                             *
+ *-----------------------------------------------------------------------------*/
+
+U_CAPI uint32_t U_EXPORT2
+udata_hashTOCEntryName(const char *name) {
+    /* FNV-1a */
+    uint32_t hash=0x811c9dc5;
+    uint8_t c;
+    while((c=(uint8_t)*name++)!=0) {
+        hash=(hash^c)*0x01000193;
+    }
+    return hash;
+}
+
+U_CAPI int32_t U_EXPORT2
+udata_getTOCHashIndexSize(int32_t count) {
+    if(count<=0 || count>0x7fff) {
+        return 0;
+    }
+    int32_t length=4;
+    while(length<2*count) {
+        length<<=1;
+    }
+    /* length is a multiple of 2, so the slots end on a 4-byte boundary */
+    return 8+2*length;
+}
+
+U_CAPI void U_EXPORT2
+udata_buildTOCHashIndex(const char *const names[], int32_t count, UDataTOCHashIndex *index) {
+    uint32_t length=(uint32_t)(udata_getTOCHashIndexSize(count)-8)/2;
+    uint32_t mask=length-1;
+    index->signature=UDATA_TOC_HASH_SIGNATURE;
+    index->length=length;
+    uprv_memset(index->slots, 0, length*2);
+    for(int32_t number=0; number<count; ++number) {
+        uint32_t i=udata_hashTOCEntryName(names[number])&mask;
+        while(index->slots[i]!=0) {
+            i=(i+1)&mask;
+        }
+        index->slots[i]=(uint16_t)(number+1);
+    }
+}
+
+/*
+ * Returns the hash index of the TOC, or NULL if it does not have a valid one.
+ */
+static const UDataTOCHashIndex *
+getOffsetTOCHashIndex(const UDataOffsetTOC *toc) {
+    uint32_t count=toc->count;
+    uint32_t indexOffset=4+8*count;
+    if(count>0 && toc->entry[0].nameOffset>=indexOffset+8) {
+        const UDataTOCHashIndex *index=(const UDataTOCHashIndex *)(toc->entry+count);
+        uint32_t length=index->length;
+        if(index->signature==UDATA_TOC_HASH_SIGNATURE &&
+                length>count && (length&(length-1))==0 &&
+                indexOffset+8+2*length<=toc->entry[0].nameOffset) {
+            return index;
+        }
+    }
+    return NULL;
+}
+
+static int32_t
+offsetTOCHashSearch(const char *s, const char *names,
+                    const UDataOffsetTOCEntry *toc, int32_t count,
+                    const UDataTOCHashIndex *index) {
+    uint32_t mask=index->length-1;
+    uint32_t i=udata_hashTOCEntryName(s)&mask;
+    /* There is at least one empty slot, but do not rely on that for bad data. */
+    for(uint32_t probes=0; probes<=mask; ++probes) {
+        int32_t number=index->slots[i];
+        if(number==0) {
+            break;
+        }
+        --number;
+        if(number<count && 0==uprv_strcmp(s, names+toc[number].nameOffset)) {
+            return number;
+        }
+        i=(i+1)&mask;
+    }
+    return -1;
+}
+
 U_CDECL_BEGIN
 static uint32_t U_CALLCONV
 offsetTOCEntryCount(const UDataMemory *pData) {
@@ -240,7 +327,12 @@ offsetTOCLookupFn(const UDataMemory *pData,
             fprintf(stderr, "\tx%d: %s\n", number, &base[toc->entry[number].nameOffset]);
         }
 #endif
-        number=offsetTOCPrefixBinarySearch(tocEntryName, base, toc->entry, count);
+        const UDataTOCHashIndex *index=getOffsetTOCHashIndex(toc);
+        if(index!=NULL) {
+            number=offsetTOCHashSearch(tocEntryName, base, toc->entry, count, index);
+        } else {
+            number=offsetTOCPrefixBinarySearch(tocEntryName, base, toc->entry, count);
+        }
         if(number>=0) {
             /* found it */
             const UDataOffsetTOCEntry *entry=toc->entry+number;
@@ -269,6 +361,27 @@ offsetTOCLookupFn(const UDataMemory *pData,
 }
 
 
+static const DataHeader * U_CALLCONV
+offsetTOCEntryFn(const UDataMemory *pData,
+                 int32_t number,
+                 const char **pName,
+                 int32_t *pLength) {
+    const UDataOffsetTOC  *toc = (UDataOffsetTOC *)pData->toc;
+    if(toc==NULL || number<0 || (uint32_t)number>=toc->count) {
+        return NULL;
+    }
+    const char *base=(const char *)toc;
+    const UDataOffsetTOCEntry *entry=toc->entry+number;
+    *pName=base+entry->nameOffset;
+    if((uint32_t)(number+1) < toc->count) {
+        *pLength = (int32_t)(entry[1].dataOffset - entry->dataOffset);
+    } else {
+        *pLength = -1;
+    }
+    return (const DataHeader *)(base+entry->dataOffset);
+}
+
+
 static uint32_t U_CALLCONV pointerTOCEntryCount(const UDataMemory *pData) {
     const PointerTOC *toc = (PointerTOC *)pData->toc;
     return (uint32_t)((toc != NULL) ? (toc->count) : 0);
@@ -307,11 +420,23 @@ static const DataHeader * U_CALLCONV pointerTOCLookupFn(const UDataMemory *pData
         return pData->pHeader;
     }
 }
+static const DataHeader * U_CALLCONV pointerTOCEntryFn(const UDataMemory *pData,
+                   int32_t number,
+                   const char **pName,
+                   int32_t *pLength) {
+    const PointerTOC *toc = (PointerTOC *)pData->toc;
+    if(toc==NULL || number<0 || (uint32_t)number>=toc->count) {
+        return NULL;
+    }
+    *pName=toc->entry[number].entryName;
+    *pLength=-1;
+    return UDataMemory_normalizeDataPointer(toc->entry[number].pHeader);
+}
 U_CDECL_END
 
 
-static const commonDataFuncs CmnDFuncs = {offsetTOCLookupFn,  offsetTOCEntryCount};
-static const commonDataFuncs ToCPFuncs = {pointerTOCLookupFn, pointerTOCEntryCount};
+static const commonDataFuncs CmnDFuncs = {offsetTOCLookupFn,  offsetTOCEntryCount,  offsetTOCEntryFn};
+static const commonDataFuncs ToCPFuncs = {pointerTOCLookupFn, pointerTOCEntryCount, pointerTOCEntryFn};
 
 
 
@@ -59,6 +59,58 @@ typedef struct {
     UDataOffsetTOCEntry entry[1];
 } UDataOffsetTOC;
 
+/*
+ * Optional hash index for an offset TOC, written by icupkg --hash-toc.
+ * If present, it immediately follows the TOC entries, before the entry names:
+ *   uint32_t signature;        UDATA_TOC_HASH_SIGNATURE
+ *   uint32_t length;           number of slots, a power of 2 larger than the item count
+ *   uint16_t slots[length];    entry index+1, or 0 for an empty slot
+ * padded with 0 bytes to a multiple of 4 bytes.
+ * A name is looked up starting at slot udata_hashTOCEntryName(name)&(length-1),
+ * with linear probing up to the next empty slot.
+ *
+ * Without the index, the names immediately follow the entries.
+ * Readers that do not know the index skip it because they only follow
+ * the offsets in the entries.
+ */
+#define UDATA_TOC_HASH_SIGNATURE 0xffffffff
+
+typedef struct {
+    uint32_t signature;
+    uint32_t length;
+    /**
+     * Variable-length array declared with length 2 to disable bounds checkers.
+     * The actual array length is in the length field.
+     */
+    uint16_t slots[2];
+} UDataTOCHashIndex;
+
+/**
+ * Hash function for TOC entry names in UDataTOCHashIndex.
+ *
+ * @internal
+ */
+U_CAPI uint32_t U_EXPORT2
+udata_hashTOCEntryName(const char *name);
+
+/**
+ * Returns the number of bytes of the UDataTOCHashIndex for a TOC with count entries,
+ * or 0 if there are too many entries for an index.
+ *
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+udata_getTOCHashIndexSize(int32_t count);
+
+/**
+ * Builds the UDataTOCHashIndex for the count TOC entry names, in platform endianness,
+ * in udata_getTOCHashIndexSize(count) bytes at index.
+ *
+ * @internal
+ */
+U_CAPI void U_EXPORT2
+udata_buildTOCHashIndex(const char *const names[], int32_t count, UDataTOCHashIndex *index);
+
 /**
  * Get the header size from a const DataHeader *udh.
  * Handles opposite-endian data.
@@ -94,11 +146,23 @@ typedef const DataHeader *
 typedef uint32_t
 (U_CALLCONV * NumEntriesFn)(const UDataMemory *pData);
 
+/*
+ * Returns the data piece with the given index in the table of contents,
+ * and sets *pName to its TOC entry name, or returns NULL if the index is out of range.
+ * *pLength is set to the length of the piece, or to -1 if it is not known.
+ */
+typedef const DataHeader *
+(U_CALLCONV * EntryFn)(const UDataMemory *pData,
+                       int32_t index,
+                       const char **pName,
+                       int32_t *pLength);
+
 U_CDECL_END
 
 typedef struct {
     LookupFn      Lookup;
     NumEntriesFn  NumEntries; 
+    EntryFn       Entry;
 } commonDataFuncs;
 
 
@@ -0,0 +1,523 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*   file name:  ucmpdata.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2026oct14
+*
+*   Compressed ICU data items, and the cache of decompressed items.
+*   See ucmpdata.h for the format.
+*
+*   The compressed bytes use the LZ4 block format
+*   (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md):
+*   A sequence of literal runs and back references of at least 4 bytes
+*   within the preceding 64kB, with the last 5 bytes always literal.
+*   It is simple enough to implement here and decompresses very fast.
+*/
+
+#include "unicode/utypes.h"
+#include "unicode/udata.h"
+#include "cmemory.h"
+#include "mutex.h"
+#include "ucln_cmn.h"
+#include "ucmpdata.h"
+#include "uhash.h"
+#include "umutex.h"
+
+namespace {
+
+// LZ4 block format constants.
+const int32_t MIN_MATCH = 4;
+const int32_t LAST_LITERALS = 5;    // The last 5 bytes are always literals.
+const int32_t MATCH_LIMIT = 12;     // The last match starts at least 12 bytes before the end.
+const int32_t MAX_OFFSET = 0xffff;
+const int32_t HASH_BITS = 12;
+
+inline uint32_t readUInt32(const uint8_t *p) {
+    uint32_t v;
+    uprv_memcpy(&v, p, 4);
+    return v;
+}
+
+inline int32_t hashUInt32(uint32_t v) {
+    return (int32_t)((v * 2654435761u) >> (32 - HASH_BITS));
+}
+
+/**
+ * Writes the LZ4 length extension bytes for length>=15.
+ * @return FALSE if the bytes do not fit
+ */
+UBool writeLength(uint8_t *dest, int32_t &destIndex, int32_t destCapacity, int32_t length) {
+    length -= 15;
+    while (length >= 255) {
+        if (destIndex >= destCapacity) { return FALSE; }
+        dest[destIndex++] = 255;
+        length -= 255;
+    }
+    if (destIndex >= destCapacity) { return FALSE; }
+    dest[destIndex++] = (uint8_t)length;
+    return TRUE;
+}
+
+/**
+ * Reads the LZ4 length extension bytes and adds them to length.
+ * @return FALSE if the bytes are truncated or the length exceeds the limit
+ */
+UBool readLength(const uint8_t *src, int32_t &srcIndex, int32_t srcLength,
+                 int32_t &length, int32_t limit) {
+    uint8_t b;
+    do {
+        if (srcIndex >= srcLength) { return FALSE; }
+        b = src[srcIndex++];
+        length += b;
+        if (length > limit) { return FALSE; }
+    } while (b == 255);
+    return TRUE;
+}
+
+/**
+ * Writes one sequence: literals, then a match unless matchLength is 0.
+ * @return FALSE if it does not fit
+ */
+UBool writeSequence(const uint8_t *literals, int32_t literalLength,
+                    int32_t offset, int32_t matchLength,
+                    uint8_t *dest, int32_t &destIndex, int32_t destCapacity) {
+    if (destIndex >= destCapacity) { return FALSE; }
+    int32_t tokenIndex = destIndex++;
+    uint8_t token = literalLength < 15 ? (uint8_t)(literalLength << 4) : 0xf0;
+    if (literalLength >= 15 && !writeLength(dest, destIndex, destCapacity, literalLength)) {
+        return FALSE;
+    }
+    if (literalLength > destCapacity - destIndex) { return FALSE; }
+    uprv_memcpy(dest + destIndex, literals, literalLength);
+    destIndex += literalLength;
+    if (matchLength > 0) {
+        if (2 > destCapacity - destIndex) { return FALSE; }
+        dest[destIndex++] = (uint8_t)offset;
+        dest[destIndex++] = (uint8_t)(offset >> 8);
+        matchLength -= MIN_MATCH;
+        if (matchLength < 15) {
+            token |= (uint8_t)matchLength;
+        } else {
+            token |= 0xf;
+            if (!writeLength(dest, destIndex, destCapacity, matchLength)) {
+                return FALSE;
+            }
+        }
+    }
+    dest[tokenIndex] = token;
+    return TRUE;
+}
+
+/**
+ * Greedy LZ4 compression with a small hash table of recent positions.
+ * @return the compressed length, or -1 if it does not fit
+ */
+int32_t compress(const uint8_t *src, int32_t srcLength, uint8_t *dest, int32_t destCapacity) {
+    int32_t table[1 << HASH_BITS];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(table); ++i) {
+        table[i] = -1;
+    }
+    int32_t destIndex = 0;
+    int32_t anchor = 0;  // Start of the pending literals.
+    int32_t matchEndLimit = srcLength - LAST_LITERALS;
+    for (int32_t i = 0; i + MATCH_LIMIT < srcLength;) {
+        uint32_t v = readUInt32(src + i);
+        int32_t h = hashUInt32(v);
+        int32_t ref = table[h];
+        table[h] = i;
+        if (ref < 0 || (i - ref) > MAX_OFFSET || readUInt32(src + ref) != v) {
+            ++i;
+            continue;
+        }
+        int32_t matchLength = MIN_MATCH;
+        while ((i + matchLength) < matchEndLimit && src[ref + matchLength] == src[i + matchLength]) {
+            ++matchLength;
+        }
+        if (!writeSequence(src + anchor, i - anchor, i - ref, matchLength,
+                           dest, destIndex, destCapacity)) {
+            return -1;
+        }
+        i += matchLength;
+        anchor = i;
+        if (i + MATCH_LIMIT < srcLength) {
+            // Remember a position inside the match, for more matches in repetitive data.
+            table[hashUInt32(readUInt32(src + i - 2))] = i - 2;
+        }
+    }
+    if (!writeSequence(src + anchor, srcLength - anchor, 0, 0, dest, destIndex, destCapacity)) {
+        return -1;
+    }
+    return destIndex;
+}
+
+inline uint16_t readUInt16(const uint8_t *p, UBool isBigEndian) {
+    return isBigEndian ? (uint16_t)((p[0] << 8) | p[1]) : (uint16_t)((p[1] << 8) | p[0]);
+}
+
+inline int32_t readInt32(const uint8_t *p, UBool isBigEndian) {
+    return isBigEndian ?
+        (int32_t)(((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]) :
+        (int32_t)(((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0]);
+}
+
+inline void writeUInt16(uint8_t *p, uint16_t v, UBool isBigEndian) {
+    if (isBigEndian) {
+        p[0] = (uint8_t)(v >> 8);
+        p[1] = (uint8_t)v;
+    } else {
+        p[0] = (uint8_t)v;
+        p[1] = (uint8_t)(v >> 8);
+    }
+}
+
+inline void writeInt32(uint8_t *p, int32_t v, UBool isBigEndian) {
+    uint32_t u = (uint32_t)v;
+    for (int32_t i = 0; i < 4; ++i) {
+        p[isBigEndian ? 3 - i : i] = (uint8_t)(u >> (8 * i));
+    }
+}
+
+inline UBool isCompressedFormat(const UDataInfo &info) {
+    return info.dataFormat[0] == 0x43 &&    // dataFormat="Cmpr"
+        info.dataFormat[1] == 0x6d &&
+        info.dataFormat[2] == 0x70 &&
+        info.dataFormat[3] == 0x72 &&
+        info.formatVersion[0] == 1;
+}
+
+// Cache of decompressed items ---------------------------------------------
+
+/**
+ * A decompressed item. It is referenced by each UDataMemory that is open for it.
+ * Unreferenced items are on a list, newest first, until they are evicted.
+ */
+struct DecompressedItem : public icu::UMemory {
+    const DataHeader *source;   // The compressed item in the package, the cache key.
+    uint8_t *bytes;
+    int32_t length;
+    int32_t refCount;
+    DecompressedItem *newer, *older;
+
+    ~DecompressedItem() { uprv_free(bytes); }
+};
+
+UHashtable *gDecompressedItems = NULL;      // Compressed item pointer -> DecompressedItem.
+DecompressedItem *gNewestUnused = NULL;
+DecompressedItem *gOldestUnused = NULL;
+int32_t gUnusedLength = 0;                  // Total length of the unreferenced items.
+int32_t gCacheCapacity = 0x100000;
+icu::UInitOnce gDecompressedItemsInitOnce = U_INITONCE_INITIALIZER;
+UMutex gDecompressedItemsMutex = U_MUTEX_INITIALIZER;
+
+int32_t U_CALLCONV hashPointer(const UHashTok key) {
+    uintptr_t p = (uintptr_t)key.pointer;
+    return (int32_t)(p ^ (p >> 16));
+}
+
+UBool U_CALLCONV comparePointers(const UHashTok key1, const UHashTok key2) {
+    return key1.pointer == key2.pointer;
+}
+
+void U_CALLCONV deleteDecompressedItem(void *obj) {
+    delete (DecompressedItem *)obj;
+}
+
+UBool U_CALLCONV ucmpdata_cleanup() {
+    uhash_close(gDecompressedItems);
+    gDecompressedItems = NULL;
+    gNewestUnused = gOldestUnused = NULL;
+    gUnusedLength = 0;
+    gDecompressedItemsInitOnce.reset();
+    return TRUE;
+}
+
+void U_CALLCONV initDecompressedItems(UErrorCode &errorCode) {
+    gDecompressedItems = uhash_open(hashPointer, comparePointers, NULL, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        gDecompressedItems = NULL;
+        return;
+    }
+    uhash_setValueDeleter(gDecompressedItems, deleteDecompressedItem);
+    ucln_common_registerCleanup(UCLN_COMMON_UCMPDATA, ucmpdata_cleanup);
+}
+
+void unlinkUnused(DecompressedItem *item) {
+    if (item->newer != NULL) {
+        item->newer->older = item->older;
+    } else {
+        gNewestUnused = item->older;
+    }
+    if (item->older != NULL) {
+        item->older->newer = item->newer;
+    } else {
+        gOldestUnused = item->newer;
+    }
+    item->newer = item->older = NULL;
+    gUnusedLength -= item->length;
+}
+
+/** Frees the least recently used unreferenced items beyond the capacity. */
+void evictUnused() {
+    while (gUnusedLength > gCacheCapacity && gOldestUnused != NULL) {
+        DecompressedItem *item = gOldestUnused;
+        unlinkUnused(item);
+        uhash_remove(gDecompressedItems, (void *)item->source);
+    }
+}
+
+}  // namespace
+
+U_CAPI const uint8_t * U_EXPORT2
+ucmpdata_getCompressedBytes(const DataHeader *pHeader, int32_t length,
+                            int32_t *pCompressedLength, int32_t *pUncompressedLength,
+                            UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode) || pHeader == NULL ||
+            (length >= 0 && length < UCMPDATA_HEADER_LENGTH) ||
+            pHeader->dataHeader.magic1 != 0xda || pHeader->dataHeader.magic2 != 0x27 ||
+            !isCompressedFormat(pHeader->info)) {
+        return NULL;
+    }
+    const uint8_t *p = (const uint8_t *)pHeader;
+    UBool isBigEndian = pHeader->info.isBigEndian;
+    int32_t headerSize = readUInt16(p, isBigEndian);
+    int32_t minLength = headerSize + UCMPDATA_INDEX_COUNT * 4;
+    if (headerSize < UCMPDATA_HEADER_LENGTH || (length >= 0 && length < minLength)) {
+        *pErrorCode = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    const uint8_t *indexes = p + headerSize;
+    int32_t uncompressedLength =
+        readInt32(indexes + 4 * UCMPDATA_UNCOMPRESSED_LENGTH, isBigEndian);
+    int32_t compressedLength = readInt32(indexes + 4 * UCMPDATA_COMPRESSED_LENGTH, isBigEndian);
+    if (uncompressedLength <= 0 || compressedLength <= 0 ||
+            (length >= 0 && compressedLength > (length - minLength))) {
+        *pErrorCode = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    *pCompressedLength = compressedLength;
+    *pUncompressedLength = uncompressedLength;
+    return indexes + UCMPDATA_INDEX_COUNT * 4;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucmpdata_decompress(const uint8_t *src, int32_t srcLength,
+                    uint8_t *dest, int32_t destCapacity,
+                    UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    int32_t srcIndex = 0, destIndex = 0;
+    for (;;) {
+        if (srcIndex >= srcLength) {
+            *pErrorCode = U_INVALID_FORMAT_ERROR;
+            return 0;
+        }
+        uint8_t token = src[srcIndex++];
+        int32_t literalLength = token >> 4;
+        if (literalLength == 15 &&
+                !readLength(src, srcIndex, srcLength, literalLength, destCapacity)) {
+            *pErrorCode = U_INVALID_FORMAT_ERROR;
+            return 0;
+        }
+        if (literalLength > (srcLength - srcIndex) || literalLength > (destCapacity - destIndex)) {
+            *pErrorCode = U_INVALID_FORMAT_ERROR;
+            return 0;
+        }
+        uprv_memcpy(dest + destIndex, src + srcIndex, literalLength);
+        srcIndex += literalLength;
+        destIndex += literalLength;
+        if (srcIndex == srcLength) {
+            return destIndex;  // The last sequence has only literals.
+        }
+        if ((srcLength - srcIndex) < 2) {
+            *pErrorCode = U_INVALID_FORMAT_ERROR;
+            return 0;
+        }
+        int32_t offset = src[srcIndex] | (src[srcIndex + 1] << 8);
+        srcIndex += 2;
+        int32_t matchLength = token & 0xf;
+        if (matchLength == 15 &&
+                !readLength(src, srcIndex, srcLength, matchLength, destCapacity)) {
+            *pErrorCode = U_INVALID_FORMAT_ERROR;
+            return 0;
+        }
+        matchLength += MIN_MATCH;
+        if (offset == 0 || offset > destIndex || matchLength > (destCapacity - destIndex)) {
+            *pErrorCode = U_INVALID_FORMAT_ERROR;
+            return 0;
+        }
+        // The match may overlap the bytes that it writes; copy forward one byte at a time.
+        const uint8_t *match = dest + destIndex - offset;
+        for (int32_t i = 0; i < matchLength; ++i) {
+            dest[destIndex + i] = match[i];
+        }
+        destIndex += matchLength;
+    }
+}
+
+U_CAPI int32_t U_EXPORT2
+ucmpdata_compressItem(const uint8_t *item, int32_t length,
+                      uint8_t *dest, int32_t destCapacity,
+                      UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    const DataHeader *pHeader = (const DataHeader *)item;
+    int32_t dataStart = UCMPDATA_HEADER_LENGTH + UCMPDATA_INDEX_COUNT * 4;
+    if (item == NULL || length < (int32_t)sizeof(DataHeader) ||
+            pHeader->dataHeader.magic1 != 0xda || pHeader->dataHeader.magic2 != 0x27 ||
+            dest == NULL || destCapacity < dataStart) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t compressedLength = compress(item, length, dest + dataStart, destCapacity - dataStart);
+    int32_t itemLength = (dataStart + compressedLength + 15) & ~15;
+    if (compressedLength < 0 || itemLength > destCapacity) {
+        *pErrorCode = U_BUFFER_OVERFLOW_ERROR;
+        return 0;
+    }
+
+    // The header and indexes have the charset family and endianness of the original item.
+    UBool isBigEndian = pHeader->info.isBigEndian;
+    uprv_memset(dest, 0, dataStart);
+    writeUInt16(dest, UCMPDATA_HEADER_LENGTH, isBigEndian);
+    dest[2] = 0xda;
+    dest[3] = 0x27;
+    UDataInfo *pInfo = (UDataInfo *)(dest + 4);
+    writeUInt16((uint8_t *)&pInfo->size, (uint16_t)sizeof(UDataInfo), isBigEndian);
+    pInfo->isBigEndian = isBigEndian;
+    pInfo->charsetFamily = pHeader->info.charsetFamily;
+    pInfo->sizeofUChar = U_SIZEOF_UCHAR;
+    pInfo->dataFormat[0] = 0x43;
+    pInfo->dataFormat[1] = 0x6d;
+    pInfo->dataFormat[2] = 0x70;
+    pInfo->dataFormat[3] = 0x72;
+    pInfo->formatVersion[0] = 1;
+    uint8_t *indexes = dest + UCMPDATA_HEADER_LENGTH;
+    writeInt32(indexes + 4 * UCMPDATA_UNCOMPRESSED_LENGTH, length, isBigEndian);
+    writeInt32(indexes + 4 * UCMPDATA_COMPRESSED_LENGTH, compressedLength, isBigEndian);
+    uprv_memset(dest + dataStart + compressedLength, 0, itemLength - (dataStart + compressedLength));
+    return itemLength;
+}
+
+U_CFUNC UBool
+ucmpdata_isCompressedItem(const DataHeader *pHeader) {
+    return pHeader->dataHeader.magic1 == 0xda && pHeader->dataHeader.magic2 == 0x27 &&
+        pHeader->info.isBigEndian == U_IS_BIG_ENDIAN &&
+        pHeader->info.charsetFamily == U_CHARSET_FAMILY &&
+        isCompressedFormat(pHeader->info);
+}
+
+U_CFUNC const DataHeader *
+ucmpdata_openItem(const DataHeader *pHeader, int32_t *length, void **pCacheEntry,
+                  UErrorCode *pErrorCode) {
+    umtx_initOnce(gDecompressedItemsInitOnce, &initDecompressedItems, *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    DecompressedItem *item;
+    {
+        icu::Mutex lock(&gDecompressedItemsMutex);
+        item = (DecompressedItem *)uhash_get(gDecompressedItems, pHeader);
+        if (item != NULL) {
+            if (item->refCount++ == 0) {
+                unlinkUnused(item);
+            }
+            *length = item->length;
+            *pCacheEntry = item;
+            return (const DataHeader *)item->bytes;
+        }
+    }
+
+    // Decompress outside of the mutex, and discard the result
+    // if another thread added the same item in the meantime.
+    // The decompressed item is cached beyond the current memory scope.
+    icu::MemoryScopeSuspender suspender;
+    int32_t compressedLength, uncompressedLength;
+    const uint8_t *compressed = ucmpdata_getCompressedBytes(
+        pHeader, *length, &compressedLength, &uncompressedLength, pErrorCode);
+    if (compressed == NULL) {
+        if (U_SUCCESS(*pErrorCode)) {
+            *pErrorCode = U_INVALID_FORMAT_ERROR;
+        }
+        return NULL;
+    }
+    item = new DecompressedItem();
+    if (item == NULL) {
+        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    item->source = pHeader;
+    item->bytes = (uint8_t *)uprv_malloc(uncompressedLength);
+    item->length = uncompressedLength;
+    item->refCount = 1;
+    item->newer = item->older = NULL;
+    if (item->bytes == NULL) {
+        delete item;
+        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    if (ucmpdata_decompress(compressed, compressedLength,
+                            item->bytes, uncompressedLength, pErrorCode) != uncompressedLength ||
+            U_FAILURE(*pErrorCode)) {
+        delete item;
+        *pErrorCode = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+
+    icu::Mutex lock(&gDecompressedItemsMutex);
+    DecompressedItem *other = (DecompressedItem *)uhash_get(gDecompressedItems, pHeader);
+    if (other != NULL) {
+        delete item;
+        item = other;
+        if (item->refCount++ == 0) {
+            unlinkUnused(item);
+        }
+    } else {
+        uhash_put(gDecompressedItems, (void *)pHeader, item, pErrorCode);
+        if (U_FAILURE(*pErrorCode)) {
+            return NULL;  // uhash_put() deleted the item.
+        }
+    }
+    *length = item->length;
+    *pCacheEntry = item;
+    return (const DataHeader *)item->bytes;
+}
+
+U_CFUNC void
+ucmpdata_releaseItem(void *cacheEntry) {
+    DecompressedItem *item = (DecompressedItem *)cacheEntry;
+    icu::Mutex lock(&gDecompressedItemsMutex);
+    if (--item->refCount == 0) {
+        item->older = gNewestUnused;
+        if (gNewestUnused != NULL) {
+            gNewestUnused->newer = item;
+        } else {
+            gOldestUnused = item;
+        }
+        gNewestUnused = item;
+        gUnusedLength += item->length;
+        evictUnused();
+    }
+}
+
+U_CAPI void U_EXPORT2
+udata_setDecompressedCacheCapacity(int32_t capacity, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (capacity < 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    icu::Mutex lock(&gDecompressedItemsMutex);
+    gCacheCapacity = capacity;
+    if (gDecompressedItems != NULL) {
+        evictUnused();
+    }
+}
@@ -0,0 +1,125 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*   file name:  ucmpdata.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2026oct14
+*
+*   Compressed ICU data items.
+*
+*   icupkg --compress replaces each item of a .dat package that compresses well
+*   with a small data item that contains the whole original item
+*   (header and all) in the LZ4 block format:
+*
+*     DataHeader    dataFormat="Cmpr", formatVersion 1,
+*                   same charset family and endianness as the original item
+*     int32_t       indexes[UCMPDATA_INDEX_COUNT]
+*     uint8_t       compressed[indexes[UCMPDATA_COMPRESSED_LENGTH]]
+*
+*   When such an item is opened from a package, it is decompressed into
+*   a heap block that is shared by all UDataMemory objects for that item.
+*   The block stays around while the item is open, and then in a bounded
+*   cache of recently used items; see udata_setDecompressedCacheCapacity().
+*
+*   These functions are part of the ICU internal implementation, and
+*   are not intended to be used directly by applications.
+*/
+
+#ifndef __UCMPDATA_H__
+#define __UCMPDATA_H__
+
+#include "unicode/utypes.h"
+#include "unicode/udata.h"
+#include "ucmndata.h"
+
+/** Indexes into the int32_t array that follows the header of a compressed item. */
+enum {
+    /** Length of the original item, including its header. */
+    UCMPDATA_UNCOMPRESSED_LENGTH,
+    /** Length of the compressed bytes after the indexes. */
+    UCMPDATA_COMPRESSED_LENGTH,
+    UCMPDATA_RESERVED_INDEX_2,
+    UCMPDATA_RESERVED_INDEX_3,
+    UCMPDATA_INDEX_COUNT
+};
+
+/** Length of the DataHeader of a compressed item. */
+#define UCMPDATA_HEADER_LENGTH 32
+
+/**
+ * Maximum length of a compressed item for an original item of length n.
+ */
+#define UCMPDATA_COMPRESSED_ITEM_CAPACITY(n) \
+    (UCMPDATA_HEADER_LENGTH + UCMPDATA_INDEX_COUNT * 4 + (n) + (n) / 255 + 16)
+
+/**
+ * Returns the compressed bytes of a compressed item, or NULL if the item
+ * is not a compressed item (without setting an error code).
+ * Works for items of any charset family and endianness.
+ * @param pHeader the item
+ * @param length the length of the item, or -1 if not known
+ * @param pCompressedLength receives the length of the compressed bytes
+ * @param pUncompressedLength receives the length of the original item
+ * @param pErrorCode set to U_INVALID_FORMAT_ERROR if the item is a compressed item
+ *                   whose lengths do not fit
+ * @internal
+ */
+U_CAPI const uint8_t * U_EXPORT2
+ucmpdata_getCompressedBytes(const DataHeader *pHeader, int32_t length,
+                            int32_t *pCompressedLength, int32_t *pUncompressedLength,
+                            UErrorCode *pErrorCode);
+
+/**
+ * Decompresses LZ4 block format bytes.
+ * @return the length of the decompressed bytes
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+ucmpdata_decompress(const uint8_t *src, int32_t srcLength,
+                    uint8_t *dest, int32_t destCapacity,
+                    UErrorCode *pErrorCode);
+
+/**
+ * Writes a compressed item for an ICU data item.
+ * @param item the original item, with its DataHeader
+ * @param length the length of the original item
+ * @param dest receives the compressed item, padded to a multiple of 16 bytes
+ * @param destCapacity should be at least UCMPDATA_COMPRESSED_ITEM_CAPACITY(length)
+ * @return the length of the compressed item
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+ucmpdata_compressItem(const uint8_t *item, int32_t length,
+                      uint8_t *dest, int32_t destCapacity,
+                      UErrorCode *pErrorCode);
+
+/**
+ * Returns TRUE if the item is a compressed item for this platform.
+ */
+U_CFUNC UBool
+ucmpdata_isCompressedItem(const DataHeader *pHeader);
+
+/**
+ * Returns the decompressed item for a compressed item from a package,
+ * decompressing it if it is not in the cache.
+ * @param pHeader the compressed item
+ * @param length the length of the compressed item, or -1 if not known;
+ *               receives the length of the decompressed item
+ * @param pCacheEntry receives the cache entry to be passed into ucmpdata_releaseItem()
+ * @return the decompressed item, or NULL if an error occurred
+ */
+U_CFUNC const DataHeader *
+ucmpdata_openItem(const DataHeader *pHeader, int32_t *length, void **pCacheEntry,
+                  UErrorCode *pErrorCode);
+
+/**
+ * Releases an item that was returned by ucmpdata_openItem().
+ */
+U_CFUNC void
+ucmpdata_releaseItem(void *cacheEntry);
+
+#endif
@@ -155,6 +155,7 @@ and created from a converter that is shared across threads.
 U_CAPI UConverter* U_EXPORT2
 ucnv_safeClone(const UConverter* cnv, void *stackBuffer, int32_t *pBufferSize, UErrorCode *status)
 {
+    icu::MemoryTagScope memoryTag(UMEM_TAG_CONVERSION);
     UConverter *localConverter, *allocatedConverter;
     int32_t stackBufferSize;
     int32_t bufferSizeNeeded;
@@ -393,6 +394,123 @@ ucnv_close (UConverter * converter)
     UTRACE_EXIT();
 }
 
+/* converter pools ---------------------------------------------------------- */
+
+struct UConverterPool {
+    UConverter *prototype;      /* opened by ucnv_openPool(), cloned for new converters */
+    UConverter **converters;    /* released converters, kept for reuse */
+    int32_t count;
+    int32_t capacity;
+};
+
+U_CAPI UConverterPool * U_EXPORT2
+ucnv_openPool(const char *converterName, int32_t capacity, UErrorCode *status) {
+    UConverterPool *pool;
+
+    if(status==NULL || U_FAILURE(*status)) {
+        return NULL;
+    }
+    if(capacity<0) {
+        *status=U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    pool=(UConverterPool *)uprv_malloc(sizeof(UConverterPool));
+    if(pool==NULL) {
+        *status=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    pool->converters=NULL;
+    if(capacity>0) {
+        pool->converters=(UConverter **)uprv_malloc(capacity*sizeof(UConverter *));
+        if(pool->converters==NULL) {
+            uprv_free(pool);
+            *status=U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+    }
+    pool->count=0;
+    pool->capacity=capacity;
+    pool->prototype=ucnv_open(converterName, status);
+    if(U_FAILURE(*status)) {
+        uprv_free(pool->converters);
+        uprv_free(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+U_CAPI void U_EXPORT2
+ucnv_closePool(UConverterPool *pool) {
+    if(pool!=NULL) {
+        while(pool->count>0) {
+            ucnv_close(pool->converters[--pool->count]);
+        }
+        ucnv_close(pool->prototype);
+        uprv_free(pool->converters);
+        uprv_free(pool);
+    }
+}
+
+U_CAPI UConverter * U_EXPORT2
+ucnv_openPooled(UConverterPool *pool, UErrorCode *status) {
+    UConverter *cnv;
+    UErrorCode cloneStatus=U_ZERO_ERROR;
+
+    if(status==NULL || U_FAILURE(*status)) {
+        return NULL;
+    }
+    if(pool==NULL) {
+        *status=U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    if(pool->count>0) {
+        return pool->converters[--pool->count];
+    }
+    /* a clone shares the loaded data without another name lookup; ignore U_SAFECLONE_ALLOCATED_WARNING */
+    cnv=ucnv_safeClone(pool->prototype, NULL, NULL, &cloneStatus);
+    if(U_FAILURE(cloneStatus)) {
+        *status=cloneStatus;
+        return NULL;
+    }
+    return cnv;
+}
+
+/* TRUE if cnv has the same settings as the pool's prototype, which has the defaults */
+static UBool
+ucnv_hasPoolSettings(const UConverter *cnv, const UConverter *prototype) {
+    int32_t subLength;
+    if( cnv->sharedData!=prototype->sharedData ||
+        cnv->options!=prototype->options ||
+        cnv->fromCharErrorBehaviour!=prototype->fromCharErrorBehaviour ||
+        cnv->fromUCharErrorBehaviour!=prototype->fromUCharErrorBehaviour ||
+        cnv->toUContext!=prototype->toUContext ||
+        cnv->fromUContext!=prototype->fromUContext ||
+        cnv->useFallback!=prototype->useFallback ||
+        cnv->subChar1!=prototype->subChar1 ||
+        cnv->subCharLen!=prototype->subCharLen
+    ) {
+        return FALSE;
+    }
+    /* subCharLen<0 counts UChars of a Unicode substitution string */
+    subLength=cnv->subCharLen>=0 ? cnv->subCharLen : -cnv->subCharLen*U_SIZEOF_UCHAR;
+    return (UBool)(uprv_memcmp(cnv->subChars, prototype->subChars, subLength)==0);
+}
+
+U_CAPI void U_EXPORT2
+ucnv_release(UConverterPool *pool, UConverter *cnv) {
+    if(cnv==NULL) {
+        return;
+    }
+    if( pool!=NULL && pool->count<pool->capacity &&
+        ucnv_hasPoolSettings(cnv, pool->prototype)
+    ) {
+        ucnv_reset(cnv);
+        pool->converters[pool->count++]=cnv;
+    } else {
+        ucnv_close(cnv);
+    }
+}
+
 /*returns a single Name from the list, will return NULL if out of bounds
  */
 U_CAPI const char*   U_EXPORT2
@@ -642,6 +760,160 @@ ucnv_resetFromUnicode(UConverter *converter)
     _reset(converter, UCNV_RESET_FROM_UNICODE, TRUE);
 }
 
+/* saving and restoring the conversion state -------------------------------- */
+
+namespace {
+
+/* "CnvS" */
+const uint32_t STATE_SIGNATURE = 0x436e7653;
+
+/**
+ * The layout of a ucnv_saveState() buffer:
+ * the stream state fields of the UConverter,
+ * followed by the state that the converter keeps in its extraInfo.
+ * The sharedData and options identify the kind of converter.
+ */
+struct SavedState {
+    uint32_t signature;
+    uint32_t options;
+    const UConverterSharedData *sharedData;
+
+    uint32_t toUnicodeStatus;
+    int32_t mode;
+    uint32_t fromUnicodeStatus;
+    UChar32 fromUChar32;
+    UChar32 preFromUFirstCP;
+    UConverterCallbackReason toUCallbackReason;
+
+    int8_t toULength;
+    int8_t charErrorBufferLength;
+    int8_t UCharErrorBufferLength;
+    int8_t preFromULength, preToULength, preToUFirstLength;
+    uint8_t toUBytes[UCNV_MAX_CHAR_LEN-1];
+    uint8_t charErrorBuffer[UCNV_ERROR_BUFFER_LENGTH];
+    UChar UCharErrorBuffer[UCNV_ERROR_BUFFER_LENGTH];
+    UChar preFromU[UCNV_EXT_MAX_UCHARS];
+    char preToU[UCNV_EXT_MAX_BYTES];
+
+    uint8_t extra[UCNV_EXTRA_STATE_CAPACITY];
+};
+
+static_assert(sizeof(SavedState) <= UCNV_STATE_CAPACITY, "SavedState too large");
+
+/* preFromULength and preToULength are negative while replaying */
+inline UBool isValidLength(int8_t length, int32_t capacity) {
+    return -capacity <= length && length <= capacity;
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+ucnv_saveState(const UConverter *cnv, void *state, int32_t capacity, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(cnv == NULL || capacity < 0 || (state == NULL && capacity > 0)) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t length = (int32_t)sizeof(SavedState);
+    if(capacity < length) {
+        *pErrorCode = U_BUFFER_OVERFLOW_ERROR;
+        return length;
+    }
+
+    SavedState saved;
+    uprv_memset(&saved, 0, sizeof(saved));
+    saved.signature = STATE_SIGNATURE;
+    saved.options = cnv->options;
+    saved.sharedData = cnv->sharedData;
+
+    saved.toUnicodeStatus = cnv->toUnicodeStatus;
+    saved.mode = cnv->mode;
+    saved.fromUnicodeStatus = cnv->fromUnicodeStatus;
+    saved.fromUChar32 = cnv->fromUChar32;
+    saved.preFromUFirstCP = cnv->preFromUFirstCP;
+    saved.toUCallbackReason = cnv->toUCallbackReason;
+
+    saved.toULength = cnv->toULength;
+    saved.charErrorBufferLength = cnv->charErrorBufferLength;
+    saved.UCharErrorBufferLength = cnv->UCharErrorBufferLength;
+    saved.preFromULength = cnv->preFromULength;
+    saved.preToULength = cnv->preToULength;
+    saved.preToUFirstLength = cnv->preToUFirstLength;
+    uprv_memcpy(saved.toUBytes, cnv->toUBytes, sizeof(saved.toUBytes));
+    uprv_memcpy(saved.charErrorBuffer, cnv->charErrorBuffer, sizeof(saved.charErrorBuffer));
+    uprv_memcpy(saved.UCharErrorBuffer, cnv->UCharErrorBuffer, sizeof(saved.UCharErrorBuffer));
+    uprv_memcpy(saved.preFromU, cnv->preFromU, sizeof(saved.preFromU));
+    uprv_memcpy(saved.preToU, cnv->preToU, sizeof(saved.preToU));
+
+    UConverterCopyState copyState = cnv->sharedData->impl->copyState;
+    if(copyState != NULL) {
+        copyState(const_cast<UConverter *>(cnv), saved.extra, TRUE, pErrorCode);
+        if(U_FAILURE(*pErrorCode)) {
+            return 0;
+        }
+    }
+    uprv_memcpy(state, &saved, length);
+    return length;
+}
+
+U_CAPI void U_EXPORT2
+ucnv_restoreState(UConverter *cnv, const void *state, int32_t length, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if(cnv == NULL || state == NULL || length != (int32_t)sizeof(SavedState)) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    // The caller's buffer need not be aligned.
+    SavedState saved;
+    uprv_memcpy(&saved, state, length);
+    if( saved.signature != STATE_SIGNATURE ||
+        saved.sharedData != cnv->sharedData || saved.options != cnv->options ||
+        !(0 <= saved.toULength && saved.toULength <= (int32_t)sizeof(saved.toUBytes)) ||
+        !(0 <= saved.charErrorBufferLength && saved.charErrorBufferLength <= UCNV_ERROR_BUFFER_LENGTH) ||
+        !(0 <= saved.UCharErrorBufferLength && saved.UCharErrorBufferLength <= UCNV_ERROR_BUFFER_LENGTH) ||
+        !isValidLength(saved.preFromULength, UCNV_EXT_MAX_UCHARS) ||
+        !isValidLength(saved.preToULength, UCNV_EXT_MAX_BYTES)
+    ) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    UConverterCopyState copyState = cnv->sharedData->impl->copyState;
+    if(copyState != NULL) {
+        copyState(cnv, saved.extra, FALSE, pErrorCode);
+        if(U_FAILURE(*pErrorCode)) {
+            return;
+        }
+    }
+
+    cnv->toUnicodeStatus = saved.toUnicodeStatus;
+    cnv->mode = saved.mode;
+    cnv->fromUnicodeStatus = saved.fromUnicodeStatus;
+    cnv->fromUChar32 = saved.fromUChar32;
+    cnv->preFromUFirstCP = saved.preFromUFirstCP;
+    cnv->toUCallbackReason = saved.toUCallbackReason;
+
+    cnv->toULength = saved.toULength;
+    cnv->charErrorBufferLength = saved.charErrorBufferLength;
+    cnv->UCharErrorBufferLength = saved.UCharErrorBufferLength;
+    cnv->preFromULength = saved.preFromULength;
+    cnv->preToULength = saved.preToULength;
+    cnv->preToUFirstLength = saved.preToUFirstLength;
+    uprv_memcpy(cnv->toUBytes, saved.toUBytes, sizeof(saved.toUBytes));
+    uprv_memcpy(cnv->charErrorBuffer, saved.charErrorBuffer, sizeof(saved.charErrorBuffer));
+    uprv_memcpy(cnv->UCharErrorBuffer, saved.UCharErrorBuffer, sizeof(saved.UCharErrorBuffer));
+    uprv_memcpy(cnv->preFromU, saved.preFromU, sizeof(saved.preFromU));
+    uprv_memcpy(cnv->preToU, saved.preToU, sizeof(saved.preToU));
+
+    /* no pending callback data from the previous stream */
+    cnv->invalidCharLength = 0;
+    cnv->invalidUCharLength = 0;
+}
+
 U_CAPI int8_t   U_EXPORT2
 ucnv_getMaxCharSize (const UConverter * converter)
 {
@@ -116,6 +116,17 @@ enum {
  */
 #define IS_2022_CONTROL(c) (((c)<0x20) && (((uint32_t)1<<(c))&0x0800c000)!=0)
 
+/*
+ * In the ASCII state, bytes 00..7F map to and from U+0000..U+007F
+ * except for the control codes SO, SI and ESC, and for CR and LF which reset
+ * (part of) the state. Runs of the other ASCII characters are converted in bulk.
+ * Bit (b>>4) in asciiRunStopBits[b&0xf] is set for those control codes,
+ * as for uprv_asciiSpanInSet().
+ */
+static const uint8_t asciiRunStopBits[16]={
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 1, 1, 1
+};
+
 /* for ISO-2022-JP and -CN implementations */
 typedef enum  {
         /* shared values */
@@ -219,6 +230,8 @@ typedef struct{
     UBool isEmptySegment;
     char name[30];
     char locale[3];
+    /* bytes 00..7F that end a run of ASCII in the ASCII state, see asciiRunStopBits[] */
+    uint8_t asciiStopBits[16];
 }UConverterDataISO2022;
 
 /* Protos */
@@ -475,6 +488,27 @@ setInitialStateFromUnicodeKR(UConverter* converter,UConverterDataISO2022 *myConv
     }
 }
 
+#if !UCONFIG_ONLY_HTML_CONVERSION
+/*
+ * ISO-2022-KR converts single bytes with ibm-949, which maps a few ASCII bytes
+ * to other code points (for example, 1A<->U+001C) or only one way (5C).
+ * Exclude them from the runs that are converted in bulk.
+ */
+static void
+addKRAsciiStopBits(UConverterDataISO2022 *myConverterData) {
+    UConverterSharedData *sharedData=myConverterData->currentConverter->sharedData;
+    for(UChar32 c=0; c<=0x7f; ++c) {
+        char b=(char)c;
+        uint32_t value;
+        if( ucnv_MBCSSimpleGetNextUChar(sharedData, &b, 1, FALSE)!=c ||
+            ucnv_MBCSFromUChar32(sharedData, c, &value, FALSE)!=1 || value!=(uint32_t)c
+        ) {
+            myConverterData->asciiStopBits[c&0xf]|=(uint8_t)(1<<(c>>4));
+        }
+    }
+}
+#endif
+
 static void U_CALLCONV
 _ISO2022Open(UConverter *cnv, UConverterLoadArgs *pArgs, UErrorCode *errorCode){
 
@@ -490,6 +524,7 @@ _ISO2022Open(UConverter *cnv, UConverterLoadArgs *pArgs, UErrorCode *errorCode){
         stackArgs.onlyTestIsLoadable = pArgs->onlyTestIsLoadable;
 
         uprv_memset(myConverterData, 0, sizeof(UConverterDataISO2022));
+        uprv_memcpy(myConverterData->asciiStopBits, asciiRunStopBits, sizeof(asciiRunStopBits));
         myConverterData->currentType = ASCII1;
         cnv->fromUnicodeStatus =FALSE;
         if(pArgs->locale){
@@ -572,6 +607,7 @@ _ISO2022Open(UConverter *cnv, UConverterLoadArgs *pArgs, UErrorCode *errorCode){
                     cnv->subCharLen = myConverterData->currentConverter->subCharLen;
                 }else{
                     (void)uprv_strcpy(myConverterData->name,"ISO_2022,locale=ko,version=0");
+                    addKRAsciiStopBits(myConverterData);
                 }
 
                 /* initialize the state variables */
@@ -1695,6 +1731,21 @@ UConverter_fromUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterFromUnicodeArgs* args
     while(source < sourceLimit) {
         if(target < targetLimit) {
 
+            if(pFromU2022State->g == 0 && pFromU2022State->cs[0] == ASCII) {
+                /* ASCII characters are written as they are without changing the state */
+                len = ucnv_fromUAsciiRun(source, sourceLimit, (char *)target, (const char *)targetLimit,
+                                         offsets, (int32_t)(source - args->source),
+                                         converterData->asciiStopBits);
+                if(len > 0) {
+                    source += len;
+                    target += len;
+                    if(offsets) {
+                        offsets += len;
+                    }
+                    continue;
+                }
+            }
+
             sourceChar  = *(source++);
             /*check if the char is a First surrogate*/
             if(U16_IS_SURROGATE(sourceChar)) {
@@ -2110,6 +2161,20 @@ UConverter_toUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
         targetUniChar =missingCharMarker;
 
+        if(pToU2022State->g == 0 && pToU2022State->cs[0] == ASCII) {
+            /* ASCII bytes map to themselves without changing the state */
+            int32_t length = ucnv_toUAsciiRun(mySource, mySourceLimit, myTarget, args->targetLimit,
+                                              args->offsets ? args->offsets + (myTarget - args->target) : NULL,
+                                              (int32_t)(mySource - args->source),
+                                              myData->asciiStopBits);
+            if(length > 0) {
+                mySource += length;
+                myTarget += length;
+                myData->isEmptySegment = FALSE;
+                continue;
+            }
+        }
+
         if(myTarget < args->targetLimit){
 
             mySourceChar= (unsigned char) *mySource++;
@@ -2395,6 +2460,21 @@ UConverter_fromUnicode_ISO_2022_KR_OFFSETS_LOGIC(UConverterFromUnicodeArgs* args
         targetByteUnit = missingCharMarker;
 
         if(target < (unsigned char*) args->targetLimit){
+            if(!isTargetByteDBCS) {
+                /* ASCII characters are written as they are in the single-byte state */
+                length = ucnv_fromUAsciiRun(source, sourceLimit, (char *)target, (const char *)targetLimit,
+                                            offsets, (int32_t)(source - args->source),
+                                            converterData->asciiStopBits);
+                if(length > 0) {
+                    source += length;
+                    target += length;
+                    if(offsets) {
+                        offsets += length;
+                    }
+                    continue;
+                }
+            }
+
             sourceChar = *source++;
 
             /* do not convert SO/SI/ESC */
@@ -2705,6 +2785,20 @@ UConverter_toUnicode_ISO_2022_KR_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
     while(mySource< mySourceLimit){
 
+        if(myData->toU2022State.g == 0) {
+            /* ASCII bytes map to themselves in the single-byte state */
+            int32_t length = ucnv_toUAsciiRun(mySource, mySourceLimit, myTarget, args->targetLimit,
+                                              args->offsets ? args->offsets + (myTarget - args->target) : NULL,
+                                              (int32_t)(mySource - args->source),
+                                              myData->asciiStopBits);
+            if(length > 0) {
+                mySource += length;
+                myTarget += length;
+                myData->isEmptySegment = FALSE;
+                continue;
+            }
+        }
+
         if(myTarget < args->targetLimit){
 
             mySourceChar= (unsigned char) *mySource++;
@@ -2944,6 +3038,21 @@ UConverter_fromUnicode_ISO_2022_CN_OFFSETS_LOGIC(UConverterFromUnicodeArgs* args
     while( source < sourceLimit){
         if(target < targetLimit){
 
+            if(pFromU2022State->g == 0) {
+                /* ASCII characters are written as they are without changing the state */
+                len = ucnv_fromUAsciiRun(source, sourceLimit, (char *)target, (const char *)targetLimit,
+                                         offsets, (int32_t)(source - args->source),
+                                         converterData->asciiStopBits);
+                if(len > 0) {
+                    source += len;
+                    target += len;
+                    if(offsets) {
+                        offsets += len;
+                    }
+                    continue;
+                }
+            }
+
             sourceChar  = *(source++);
             /*check if the char is a First surrogate*/
              if(U16_IS_SURROGATE(sourceChar)) {
@@ -3293,6 +3402,20 @@ UConverter_toUnicode_ISO_2022_CN_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
         targetUniChar =missingCharMarker;
 
+        if(pToU2022State->g == 0) {
+            /* ASCII bytes map to themselves without changing the state */
+            int32_t length = ucnv_toUAsciiRun(mySource, mySourceLimit, myTarget, args->targetLimit,
+                                              args->offsets ? args->offsets + (myTarget - args->target) : NULL,
+                                              (int32_t)(mySource - args->source),
+                                              myData->asciiStopBits);
+            if(length > 0) {
+                mySource += length;
+                myTarget += length;
+                myData->isEmptySegment = FALSE;
+                continue;
+            }
+        }
+
         if(myTarget < args->targetLimit){
 
             mySourceChar= (unsigned char) *mySource++;
@@ -3638,6 +3761,53 @@ _ISO_2022_SafeClone(
     return &localClone->cnv;
 }
 
+/* the part of the ISO-2022 state that ucnv_saveState() copies */
+typedef struct ISO2022SavedState {
+    ISO2022State toU2022State, fromU2022State;
+    uint32_t key;
+    UBool isEmptySegment;
+    /* ISO-2022-KR version 1: state of the ibm-25546 subconverter */
+    uint32_t subToUnicodeStatus, subFromUnicodeStatus;
+    int32_t subMode;
+} ISO2022SavedState;
+
+static void U_CALLCONV
+_ISO2022CopyState(UConverter *cnv, uint8_t *extraState, UBool save, UErrorCode *pErrorCode) {
+    UConverterDataISO2022 *cnvData = (UConverterDataISO2022 *)cnv->extraInfo;
+    ISO2022SavedState *state = (ISO2022SavedState *)extraState;
+    UConverter *subCnv;
+
+    static_assert(sizeof(ISO2022SavedState) <= UCNV_EXTRA_STATE_CAPACITY, "ISO2022SavedState too large");
+    if(cnvData->locale[0] == 0) {
+        /* the generic ISO-2022 converter switches between subconverters */
+        *pErrorCode = U_UNSUPPORTED_ERROR;
+        return;
+    }
+    subCnv = cnvData->locale[0] == 'k' && cnvData->version == 1 ? cnvData->currentConverter : NULL;
+    if(save) {
+        uprv_memset(state, 0, sizeof(ISO2022SavedState));
+        state->toU2022State = cnvData->toU2022State;
+        state->fromU2022State = cnvData->fromU2022State;
+        state->key = cnvData->key;
+        state->isEmptySegment = cnvData->isEmptySegment;
+        if(subCnv != NULL) {
+            state->subToUnicodeStatus = subCnv->toUnicodeStatus;
+            state->subFromUnicodeStatus = subCnv->fromUnicodeStatus;
+            state->subMode = subCnv->mode;
+        }
+    } else {
+        cnvData->toU2022State = state->toU2022State;
+        cnvData->fromU2022State = state->fromU2022State;
+        cnvData->key = state->key;
+        cnvData->isEmptySegment = state->isEmptySegment;
+        if(subCnv != NULL) {
+            subCnv->toUnicodeStatus = state->subToUnicodeStatus;
+            subCnv->fromUnicodeStatus = state->subFromUnicodeStatus;
+            subCnv->mode = state->subMode;
+        }
+    }
+}
+
 U_CDECL_END
 
 static void U_CALLCONV
@@ -3801,7 +3971,9 @@ static const UConverterImpl _ISO2022Impl={
     _ISO_2022_GetUnicodeSet,
 
     NULL,
-    NULL
+    NULL,
+
+    _ISO2022CopyState
 };
 static const UConverterStaticData _ISO2022StaticData={
     sizeof(UConverterStaticData),
@@ -3846,7 +4018,9 @@ static const UConverterImpl _ISO2022JPImpl={
     _ISO_2022_GetUnicodeSet,
 
     NULL,
-    NULL
+    NULL,
+
+    _ISO2022CopyState
 };
 static const UConverterStaticData _ISO2022JPStaticData={
     sizeof(UConverterStaticData),
@@ -3897,7 +4071,9 @@ static const UConverterImpl _ISO2022KRImpl={
     _ISO_2022_GetUnicodeSet,
 
     NULL,
-    NULL
+    NULL,
+
+    _ISO2022CopyState
 };
 static const UConverterStaticData _ISO2022KRStaticData={
     sizeof(UConverterStaticData),
@@ -3948,7 +4124,9 @@ static const UConverterImpl _ISO2022CNImpl={
     _ISO_2022_GetUnicodeSet,
 
     NULL,
-    NULL
+    NULL,
+
+    _ISO2022CopyState
 };
 static const UConverterStaticData _ISO2022CNStaticData={
     sizeof(UConverterStaticData),
@@ -45,7 +45,9 @@
 #include "cmemory.h"
 #include "ucln_cmn.h"
 #include "ustr_cnv.h"
+#include "ustr_imp.h"
 
+U_NAMESPACE_USE
 
 #if 0
 #include <stdio.h>
@@ -194,9 +196,35 @@ static struct {
 
 /*initializes some global variables */
 static UHashtable *SHARED_DATA_HASHTABLE = NULL;
-static UMutex cnvCacheMutex = U_MUTEX_INITIALIZER;  /* Mutex for synchronizing cnv cache access. */
-                                                    /*  Note:  the global mutex is used for      */
-                                                    /*         reference count updates.          */
+static UMutex cnvCacheMutex = U_NAMED_MUTEX_INITIALIZER("cnvCacheMutex");  /* Mutex for synchronizing cnv cache access. */
+
+/*
+ * Lock-free lookup of cached converters.
+ *
+ * SHARED_DATA_HASHTABLE is only changed while holding cnvCacheMutex.
+ * After each change, an immutable copy of its entries (a "snapshot") is published,
+ * so that opening a converter that is already loaded finds its shared data
+ * and increments its atomic reference counter without locking the mutex.
+ *
+ * Two snapshot slots take turns. The reader count of each slot includes
+ * one reference for the slot itself while it holds a snapshot.
+ * A reader increments the count of the current slot; if the count was 0, then
+ * the slot has been retired and the reader falls back to the mutex.
+ * A writer fills the other slot and makes it current, then drops the old slot's
+ * own reference and waits for its readers to finish before freeing it.
+ * ucnv_flushCache() deletes shared data only after the snapshots that contained it
+ * have been retired this way, and only if its reference counter is still 0.
+ */
+typedef struct {
+    int32_t mask;                       /* capacity-1, with a power-of-2 capacity */
+    UConverterSharedData *entries[1];   /* linear probing, NULL where empty */
+} UConverterCacheSnapshot;
+
+static UConverterCacheSnapshot *gCacheSnapshots[2] = { NULL, NULL };
+static u_atomic_int32_t gCacheSnapshotReaders[2] = {
+    ATOMIC_INT32_T_INITIALIZER(0), ATOMIC_INT32_T_INITIALIZER(0)
+};
+static u_atomic_int32_t gCurrentCacheSnapshot = ATOMIC_INT32_T_INITIALIZER(0);
 
 static const char **gAvailableConverters = NULL;
 static uint16_t gAvailableConverterCount = 0;
@@ -314,7 +342,8 @@ ucnv_data_unFlattenClone(UConverterLoadArgs *pArgs, UDataMemory *pData, UErrorCo
     }
 
     /* copy initial values from the static structure for this type */
-    uprv_memcpy(data, converterData[type], sizeof(UConverterSharedData));
+    /* (void *) because of the atomic referenceCounter, which starts at 1 */
+    uprv_memcpy((void *)data, converterData[type], sizeof(UConverterSharedData));
 
     data->staticData = source;
 
@@ -426,6 +455,87 @@ getAlgorithmicTypeFromName(const char *realName)
 */
 #define UCNV_CACHE_LOAD_FACTOR 2
 
+static int32_t
+ucnv_hashCacheSnapshotKey(const char *name) {
+    return ustr_hashCharsN(name, (int32_t)uprv_strlen(name));
+}
+
+/*
+ * Replaces the current snapshot with one of the current SHARED_DATA_HASHTABLE,
+ * or with none if the table is empty or there is not enough memory,
+ * and frees the old snapshot when no reader uses it any more.
+ * Must be called with cnvCacheMutex held.
+ */
+static void
+ucnv_publishCacheSnapshot()
+{
+    UConverterCacheSnapshot *snapshot = NULL;
+    int32_t count = SHARED_DATA_HASHTABLE != NULL ? uhash_count(SHARED_DATA_HASHTABLE) : 0;
+    if (count > 0) {
+        int32_t capacity = 16;
+        while (capacity < 2 * count) {
+            capacity <<= 1;
+        }
+        snapshot = (UConverterCacheSnapshot *)uprv_malloc(
+            sizeof(UConverterCacheSnapshot) + (capacity - 1) * sizeof(UConverterSharedData *));
+        if (snapshot != NULL) {
+            int32_t pos = UHASH_FIRST;
+            const UHashElement *e;
+            snapshot->mask = capacity - 1;
+            uprv_memset(snapshot->entries, 0, capacity * sizeof(UConverterSharedData *));
+            while ((e = uhash_nextElement(SHARED_DATA_HASHTABLE, &pos)) != NULL) {
+                UConverterSharedData *data = (UConverterSharedData *)e->value.pointer;
+                int32_t i = ucnv_hashCacheSnapshotKey(data->staticData->name) & snapshot->mask;
+                while (snapshot->entries[i] != NULL) {
+                    i = (i + 1) & snapshot->mask;
+                }
+                snapshot->entries[i] = data;
+            }
+        }
+    }
+
+    int32_t current = umtx_loadAcquire(gCurrentCacheSnapshot);
+    int32_t next = 1 - current;
+    /* The next slot was drained when it was retired. */
+    if (snapshot != NULL) {
+        gCacheSnapshots[next] = snapshot;
+        umtx_atomic_inc(&gCacheSnapshotReaders[next]);
+    }
+    umtx_storeRelease(gCurrentCacheSnapshot, next);
+    if (gCacheSnapshots[current] != NULL) {
+        umtx_atomic_dec(&gCacheSnapshotReaders[current]);
+        /* Readers hold the count for no longer than one lookup. */
+        while (umtx_loadAcquire(gCacheSnapshotReaders[current]) != 0) {}
+        uprv_free(gCacheSnapshots[current]);
+        gCacheSnapshots[current] = NULL;
+    }
+}
+
+/*
+ * Looks up a converter name in the current snapshot without locking cnvCacheMutex,
+ * and increments the reference counter of the shared data if it is found.
+ * Returns NULL if the name is not found; the caller then uses ucnv_load().
+ */
+static UConverterSharedData *
+ucnv_retainCachedSharedData(const char *name)
+{
+    UConverterSharedData *data = NULL;
+    int32_t slot = umtx_loadAcquire(gCurrentCacheSnapshot);
+    if (umtx_atomic_inc(&gCacheSnapshotReaders[slot]) > 1) {
+        const UConverterCacheSnapshot *snapshot = gCacheSnapshots[slot];
+        int32_t i = ucnv_hashCacheSnapshotKey(name) & snapshot->mask;
+        while ((data = snapshot->entries[i]) != NULL &&
+                uprv_strcmp(data->staticData->name, name) != 0) {
+            i = (i + 1) & snapshot->mask;
+        }
+        if (data != NULL) {
+            umtx_atomic_inc(&data->referenceCounter);
+        }
+    }
+    umtx_atomic_dec(&gCacheSnapshotReaders[slot]);
+    return data;
+}
+
 /* Puts the shared data in the static hashtable SHARED_DATA_HASHTABLE */
 /*   Will always be called with the cnvCacheMutex alrady being held   */
 /*     by the calling function.                                       */
@@ -471,6 +581,7 @@ ucnv_shareConverterData(UConverterSharedData * data)
             &err);
     UCNV_DEBUG_LOG("put", data->staticData->name,data);
 
+    ucnv_publishCacheSnapshot();
 }
 
 /*  Look up a converter name in the shared data cache.                    */
@@ -514,7 +625,7 @@ ucnv_deleteSharedConverterData(UConverterSharedData * deadSharedData)
     UTRACE_ENTRY_OC(UTRACE_UCNV_UNLOAD);
     UTRACE_DATA2(UTRACE_OPEN_CLOSE, "unload converter %s shared data %p", deadSharedData->staticData->name, deadSharedData);
 
-    if (deadSharedData->referenceCounter > 0) {
+    if (umtx_loadAcquire(deadSharedData->referenceCounter) > 0) {
         UTRACE_EXIT_VALUE((int32_t)FALSE);
         return FALSE;
     }
@@ -556,6 +667,9 @@ ucnv_load(UConverterLoadArgs *pArgs, UErrorCode *err) {
     if (mySharedConverterData == NULL)
     {
         /*Not cached, we need to stream it in from file */
+        UTRACE_METRIC_INC(UTRACE_METRIC_CONVERTER_CACHE_MISS);
+        /* The shared data is cached beyond the current memory scope. */
+        MemoryScopeSuspender suspender;
         mySharedConverterData = createConverterFromFile(pArgs, err);
         if (U_FAILURE (*err) || (mySharedConverterData == NULL))
         {
@@ -571,7 +685,8 @@ ucnv_load(UConverterLoadArgs *pArgs, UErrorCode *err) {
     {
         /* The data for this converter was already in the cache.            */
         /* Update the reference counter on the shared data: one more client */
-        mySharedConverterData->referenceCounter++;
+        UTRACE_METRIC_INC(UTRACE_METRIC_CONVERTER_CACHE_HIT);
+        umtx_atomic_inc(&mySharedConverterData->referenceCounter);
     }
 
     return mySharedConverterData;
@@ -585,11 +700,12 @@ ucnv_load(UConverterLoadArgs *pArgs, UErrorCode *err) {
 U_CAPI void
 ucnv_unload(UConverterSharedData *sharedData) {
     if(sharedData != NULL) {
-        if (sharedData->referenceCounter > 0) {
-            sharedData->referenceCounter--;
+        int32_t count = umtx_loadAcquire(sharedData->referenceCounter);
+        if (count > 0) {
+            count = umtx_atomic_dec(&sharedData->referenceCounter);
         }
 
-        if((sharedData->referenceCounter <= 0)&&(sharedData->sharedDataCached == FALSE)) {
+        if((count <= 0)&&(sharedData->sharedDataCached == FALSE)) {
             ucnv_deleteSharedConverterData(sharedData);
         }
     }
@@ -599,9 +715,17 @@ U_CFUNC void
 ucnv_unloadSharedDataIfReady(UConverterSharedData *sharedData)
 {
     if(sharedData != NULL && sharedData->isReferenceCounted) {
-        umtx_lock(&cnvCacheMutex);
-        ucnv_unload(sharedData);
-        umtx_unlock(&cnvCacheMutex);
+        if (sharedData->sharedDataCached) {
+            /*
+             * Cached shared data is deleted only by ucnv_flushCache(),
+             * which does not clear sharedDataCached while the caller holds a reference.
+             */
+            umtx_atomic_dec(&sharedData->referenceCounter);
+        } else {
+            umtx_lock(&cnvCacheMutex);
+            ucnv_unload(sharedData);
+            umtx_unlock(&cnvCacheMutex);
+        }
     }
 }
 
@@ -609,9 +733,7 @@ U_CFUNC void
 ucnv_incrementRefCount(UConverterSharedData *sharedData)
 {
     if(sharedData != NULL && sharedData->isReferenceCounted) {
-        umtx_lock(&cnvCacheMutex);
-        sharedData->referenceCounter++;
-        umtx_unlock(&cnvCacheMutex);
+        umtx_atomic_inc(&sharedData->referenceCounter);
     }
 }
 
@@ -805,19 +927,23 @@ ucnv_loadSharedData(const char *converterName,
     if (mySharedConverterData == NULL)
     {
         /* it is a data-based converter, get its shared data.               */
-        /* Hold the cnvCacheMutex through the whole process of checking the */
-        /*   converter data cache, and adding new entries to the cache      */
-        /*   to prevent other threads from modifying the cache during the   */
-        /*   process.                                                       */
+        /* Most converters are already loaded: look them up without locking. */
+        /* Otherwise hold the cnvCacheMutex through the whole process of    */
+        /*   checking the converter data cache, and adding new entries to   */
+        /*   the cache to prevent other threads from modifying the cache    */
+        /*   during the process.                                            */
         pArgs->nestedLoads=1;
         pArgs->pkg=NULL;
 
-        umtx_lock(&cnvCacheMutex);
-        mySharedConverterData = ucnv_load(pArgs, err);
-        umtx_unlock(&cnvCacheMutex);
-        if (U_FAILURE (*err) || (mySharedConverterData == NULL))
-        {
-            return NULL;
+        mySharedConverterData = ucnv_retainCachedSharedData(pArgs->name);
+        if (mySharedConverterData == NULL) {
+            umtx_lock(&cnvCacheMutex);
+            mySharedConverterData = ucnv_load(pArgs, err);
+            umtx_unlock(&cnvCacheMutex);
+            if (U_FAILURE (*err) || (mySharedConverterData == NULL))
+            {
+                return NULL;
+            }
         }
     }
 
@@ -827,6 +953,7 @@ ucnv_loadSharedData(const char *converterName,
 U_CAPI UConverter *
 ucnv_createConverter(UConverter *myUConverter, const char *converterName, UErrorCode * err)
 {
+    MemoryTagScope memoryTag(UMEM_TAG_CONVERSION);
     UConverterNamePieces stackPieces;
     UConverterLoadArgs stackArgs=UCNV_LOAD_ARGS_INITIALIZER;
     UConverterSharedData *mySharedConverterData;
@@ -919,6 +1046,7 @@ ucnv_createAlgorithmicConverter(UConverter *myUConverter,
 U_CFUNC UConverter*
 ucnv_createConverterFromPackage(const char *packageName, const char *converterName, UErrorCode * err)
 {
+    MemoryTagScope memoryTag(UMEM_TAG_CONVERSION);
     UConverter *myUConverter;
     UConverterSharedData *mySharedConverterData;
     UConverterNamePieces stackPieces;
@@ -1054,13 +1182,14 @@ ucnv_flushCache ()
     * table
     *
     * Synchronization:  holding cnvCacheMutex will prevent any other thread from
-    *                   accessing or modifying the hash table during the iteration.
-    *                   The reference count of an entry may be decremented by
-    *                   ucnv_close while the iteration is in process, but this is
-    *                   benign.  It can't be incremented (in ucnv_createConverter())
-    *                   because the sequence of looking up in the cache + incrementing
-    *                   is protected by cnvCacheMutex.
+    *                   modifying the hash table during the iteration.
+    *                   The reference count of an entry may be changed by
+    *                   ucnv_close and by a lock-free ucnv_open while the iteration
+    *                   is in process. Therefore unused entries are first removed
+    *                   from the table and from the snapshot, and deleted only
+    *                   if they are still unused once the old snapshot is retired.
     */
+    MaybeStackArray<UConverterSharedData *, 32> unused;
     umtx_lock(&cnvCacheMutex);
     /*
      * double loop: A delta/extension-only converter has a pointer to its base table's
@@ -1070,22 +1199,39 @@ ucnv_flushCache ()
      */
     i = 0;
     do {
+        int32_t unusedCount = 0;
         remaining = 0;
         pos = UHASH_FIRST;
         while ((e = uhash_nextElement (SHARED_DATA_HASHTABLE, &pos)) != NULL)
         {
             mySharedData = (UConverterSharedData *) e->value.pointer;
             /*deletes only if reference counter == 0 */
-            if (mySharedData->referenceCounter == 0)
+            if (umtx_loadAcquire(mySharedData->referenceCounter) == 0 &&
+                    (unusedCount < unused.getCapacity() ||
+                        unused.resize(2 * unused.getCapacity(), unusedCount) != NULL))
+            {
+                uhash_removeElement(SHARED_DATA_HASHTABLE, e);
+                unused[unusedCount++] = mySharedData;
+            } else {
+                ++remaining;
+            }
+        }
+        if (unusedCount > 0) {
+            ucnv_publishCacheSnapshot();
+        }
+        for (int32_t j = 0; j < unusedCount; ++j) {
+            mySharedData = unused[j];
+            if (umtx_loadAcquire(mySharedData->referenceCounter) == 0)
             {
                 tableDeletedNum++;
 
                 UCNV_DEBUG_LOG("del",mySharedData->staticData->name,mySharedData);
 
-                uhash_removeElement(SHARED_DATA_HASHTABLE, e);
                 mySharedData->sharedDataCached = FALSE;
                 ucnv_deleteSharedConverterData (mySharedData);
             } else {
+                /* opened again through the old snapshot */
+                ucnv_shareConverterData(mySharedData);
                 ++remaining;
             }
         }
@@ -1342,7 +1488,8 @@ ucnv_swap(const UDataSwapper *ds,
     _MBCSHeader *outMBCSHeader;
     _MBCSHeader mbcsHeader;
     uint32_t mbcsHeaderLength;
-    UBool noFromU=FALSE;
+    UBool noFromU=FALSE, hasSwapLFNL=FALSE;
+    uint32_t swapLFNLLength=0;
 
     uint8_t outputType;
 
@@ -1441,6 +1588,9 @@ ucnv_swap(const UDataSwapper *ds,
         ) {
             mbcsHeaderLength=mbcsHeader.options&MBCS_OPT_LENGTH_MASK;
             noFromU=(UBool)((mbcsHeader.options&MBCS_OPT_NO_FROM_U)!=0);
+            hasSwapLFNL=(UBool)(
+                (mbcsHeader.options&MBCS_OPT_SWAP_LFNL)!=0 &&
+                mbcsHeaderLength>=MBCS_HEADER_V5_SWAP_LFNL_LENGTH && !noFromU);
         } else {
             udata_printError(ds, "ucnv_swap(): unsupported _MBCSHeader.version %d.%d\n",
                              inMBCSHeader->version[0], inMBCSHeader->version[1]);
@@ -1457,6 +1607,9 @@ ucnv_swap(const UDataSwapper *ds,
         mbcsHeader.flags=               ds->readUInt32(inMBCSHeader->flags);
         mbcsHeader.fromUBytesLength=    ds->readUInt32(inMBCSHeader->fromUBytesLength);
         /* mbcsHeader.options have been read above */
+        if(hasSwapLFNL) {
+            mbcsHeader.offsetSwapLFNL=  ds->readUInt32(inMBCSHeader->offsetSwapLFNL);
+        }
 
         extOffset=(int32_t)(mbcsHeader.flags>>8);
         outputType=(uint8_t)mbcsHeader.flags;
@@ -1502,11 +1655,29 @@ ucnv_swap(const UDataSwapper *ds,
             mbcsIndexLength=((maxFastUChar+1)>>6)*2;  /* number of bytes */
         }
 
+        /*
+         * Optional precomputed swaplfnl data:
+         * state table, fromUBytes, and the converter name padded to 4-alignment.
+         */
+        if(hasSwapLFNL) {
+            uint32_t nameOffset=
+                mbcsHeader.offsetSwapLFNL+mbcsHeader.countStates*1024+mbcsHeader.fromUBytesLength;
+            if(length>=0 && (uint32_t)length<=nameOffset) {
+                udata_printError(ds, "ucnv_swap(): too few bytes (%d after headers) for the swaplfnl data of an ICU MBCS .cnv conversion table\n",
+                                 length);
+                *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+                return 0;
+            }
+            swapLFNLLength=nameOffset-mbcsHeader.offsetSwapLFNL+
+                (((uint32_t)uprv_strlen((const char *)inBytes+nameOffset)+4)&~3);
+        }
+
         if(extOffset==0) {
             size=(int32_t)(mbcsHeader.offsetFromUBytes+mbcsIndexLength);
             if(!noFromU) {
                 size+=(int32_t)mbcsHeader.fromUBytesLength;
             }
+            size+=(int32_t)swapLFNLLength;
 
             /* avoid compiler warnings - not otherwise necessary, and the value does not matter */
             inExtIndexes=NULL;
@@ -1625,6 +1796,25 @@ ucnv_swap(const UDataSwapper *ds,
                                            outBytes+offset, pErrorCode);
                     }
                 }
+
+                if(hasSwapLFNL) {
+                    /* swap the swaplfnl state table, 1kB per state */
+                    offset=mbcsHeader.offsetSwapLFNL;
+                    count=mbcsHeader.countStates*1024;
+                    ds->swapArray32(ds, inBytes+offset, (int32_t)count,
+                                       outBytes+offset, pErrorCode);
+
+                    /* swap the swaplfnl fromUBytes, 16 bits wide for both SBCS and EBCDIC_STATEFUL */
+                    offset+=count;
+                    count=mbcsHeader.fromUBytesLength;
+                    ds->swapArray16(ds, inBytes+offset, (int32_t)count,
+                                       outBytes+offset, pErrorCode);
+
+                    /* swap the swaplfnl converter name */
+                    offset+=count;
+                    ds->swapInvChars(ds, inBytes+offset, (int32_t)uprv_strlen((const char *)inBytes+offset),
+                                        outBytes+offset, pErrorCode);
+                }
             }
 
             if(extOffset!=0) {
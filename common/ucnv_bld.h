@@ -30,6 +30,9 @@
 #include "ucnvmbcs.h"
 #include "ucnv_ext.h"
 #include "udataswp.h"
+#ifdef __cplusplus
+#include "umutex.h"
+#endif
 
 /* size of the overflow buffers in UConverter, enough for escaping callbacks */
 #define UCNV_ERROR_BUFFER_LENGTH 32
@@ -95,7 +98,12 @@ typedef struct UConverterStaticData {   /* +offset: size */
  */
 struct UConverterSharedData {
     uint32_t structSize;            /* Size of this structure */
-    uint32_t referenceCounter;      /* used to count number of clients, unused for static/immutable SharedData */
+#ifdef __cplusplus
+    /* used to count number of clients, unused for static/immutable SharedData; see ucnv_bld.cpp */
+    U_NAMESPACE_QUALIFIER u_atomic_int32_t referenceCounter;
+#else
+    int32_t referenceCounter;       /* same size and layout, for C code that only needs sizeof() */
+#endif
 
     const void *dataMemory;         /* from udata_openChoice() - for cleanup */
 
@@ -127,7 +135,7 @@ struct UConverterSharedData {
 /** UConverterSharedData initializer for static, non-reference-counted converters. */
 #define UCNV_IMMUTABLE_SHARED_DATA_INITIALIZER(pStaticData, pImpl) \
     { \
-        sizeof(UConverterSharedData), ~((uint32_t)0), \
+        sizeof(UConverterSharedData), ATOMIC_INT32_T_INITIALIZER(-1), \
         NULL, pStaticData, FALSE, FALSE, pImpl, \
         0, UCNV_MBCS_TABLE_INITIALIZER \
     }
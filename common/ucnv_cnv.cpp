@@ -27,6 +27,7 @@
 #include "ucnv_cnv.h"
 #include "ucnv_bld.h"
 #include "cmemory.h"
+#include "usimd.h"
 
 U_CFUNC void
 ucnv_getCompleteUnicodeSet(const UConverter *cnv,
@@ -179,4 +180,46 @@ ucnv_toUWriteCodePoint(UConverter *cnv,
     }
 }
 
+U_CFUNC int32_t
+ucnv_toUAsciiRun(const char *source, const char *sourceLimit,
+                 UChar *target, const UChar *targetLimit,
+                 int32_t *offsets, int32_t sourceIndex,
+                 const uint8_t stopBits[16]) {
+    int32_t length=(int32_t)(sourceLimit-source);
+    if(length>(int32_t)(targetLimit-target)) {
+        length=(int32_t)(targetLimit-target);
+    }
+    /* uprv_asciiSpanInSet() also stops before the first non-ASCII byte */
+    length=uprv_asciiSpanInSet((const uint8_t *)source, length, stopBits, FALSE);
+    uprv_asciiToUChars((const uint8_t *)source, target, length);
+    if(offsets!=NULL) {
+        for(int32_t i=0; i<length; ++i) {
+            offsets[i]=sourceIndex+i;
+        }
+    }
+    return length;
+}
+
+U_CFUNC int32_t
+ucnv_fromUAsciiRun(const UChar *source, const UChar *sourceLimit,
+                   char *target, const char *targetLimit,
+                   int32_t *offsets, int32_t sourceIndex,
+                   const uint8_t stopBits[16]) {
+    int32_t length=(int32_t)(sourceLimit-source);
+    if(length>(int32_t)(targetLimit-target)) {
+        length=(int32_t)(targetLimit-target);
+    }
+    int32_t i=0;
+    UChar c;
+    while(i<length && (c=source[i])<=0x7f && (stopBits[c&0xf]&(1<<(c>>4)))==0) {
+        target[i++]=(char)c;
+    }
+    if(offsets!=NULL) {
+        for(int32_t j=0; j<i; ++j) {
+            offsets[j]=sourceIndex+j;
+        }
+    }
+    return i;
+}
+
 #endif
@@ -211,6 +211,21 @@ typedef void (*UConverterGetUnicodeSet) (const UConverter *cnv,
                                          UConverterUnicodeSet which,
                                          UErrorCode *pErrorCode);
 
+/** Number of bytes for the part of a ucnv_saveState() buffer that UConverterCopyState uses. */
+#define UCNV_EXTRA_STATE_CAPACITY 96
+
+/**
+ * Copies the conversion state that a converter keeps in its extraInfo
+ * into (save==TRUE) or out of (save==FALSE) the UCNV_EXTRA_STATE_CAPACITY bytes
+ * at extraState, for ucnv_saveState() and ucnv_restoreState().
+ * Only needed for converters whose state is not all in the UConverter fields.
+ * Sets U_UNSUPPORTED_ERROR if the state cannot be copied.
+ */
+typedef void (*UConverterCopyState) (UConverter *cnv,
+                                     uint8_t *extraState,
+                                     UBool save,
+                                     UErrorCode *pErrorCode);
+
 UBool CONVERSION_U_SUCCESS (UErrorCode err);
 
 /**
@@ -253,6 +268,8 @@ struct UConverterImpl {
 
     UConverterConvert toUTF8;
     UConverterConvert fromUTF8;
+
+    UConverterCopyState copyState;
 };
 
 extern const UConverterSharedData
@@ -318,6 +335,32 @@ ucnv_toUWriteCodePoint(UConverter *cnv,
                        int32_t sourceIndex,
                        UErrorCode *pErrorCode);
 
+/**
+ * Converts the initial run of ASCII bytes that are not in the stop set
+ * to the UChars with the same values, as in the ASCII mode of a stateful converter.
+ * Converts at most as many bytes as fit into the target.
+ * The stop set is passed in as for uprv_asciiSpanInSet().
+ * If offsets!=NULL, then the offsets sourceIndex, sourceIndex+1, ... are written.
+ * @return the number of bytes read and UChars written
+ */
+U_CFUNC int32_t
+ucnv_toUAsciiRun(const char *source, const char *sourceLimit,
+                 UChar *target, const UChar *targetLimit,
+                 int32_t *offsets, int32_t sourceIndex,
+                 const uint8_t stopBits[16]);
+
+/**
+ * Converts the initial run of ASCII UChars that are not in the stop set
+ * to the bytes with the same values, as in the ASCII mode of a stateful converter.
+ * Otherwise like ucnv_toUAsciiRun().
+ * @return the number of UChars read and bytes written
+ */
+U_CFUNC int32_t
+ucnv_fromUAsciiRun(const UChar *source, const UChar *sourceLimit,
+                   char *target, const char *targetLimit,
+                   int32_t *offsets, int32_t sourceIndex,
+                   const uint8_t stopBits[16]);
+
 #endif
 
 #endif /* UCNV_CNV */
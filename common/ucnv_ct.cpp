@@ -596,6 +596,16 @@ _CompoundText_GetUnicodeSet(const UConverter *cnv,
     sa->addRange(sa->set, 0x0020, 0x007F);
     sa->addRange(sa->set, 0x00A0, 0x00FF);
 }
+
+static void U_CALLCONV
+_CompoundTextCopyState(UConverter *cnv, uint8_t *extraState, UBool save, UErrorCode * /*pErrorCode*/) {
+    UConverterDataCompoundText *myConverterData = (UConverterDataCompoundText *)cnv->extraInfo;
+    if (save) {
+        uprv_memcpy(extraState, &myConverterData->state, sizeof(myConverterData->state));
+    } else {
+        uprv_memcpy(&myConverterData->state, extraState, sizeof(myConverterData->state));
+    }
+}
 U_CDECL_END
 
 static const UConverterImpl _CompoundTextImpl = {
@@ -621,7 +631,9 @@ static const UConverterImpl _CompoundTextImpl = {
     NULL,
     _CompoundText_GetUnicodeSet,
     NULL,
-    NULL
+    NULL,
+
+    _CompoundTextCopyState
 };
 
 static const UConverterStaticData _CompoundTextStaticData = {
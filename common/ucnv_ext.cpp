@@ -363,6 +363,35 @@ ucnv_extSimpleMatchToU(const int32_t *cx,
     return 0xfffe;
 }
 
+/*
+ * Same match as ucnv_extInitialMatchToU() but with the firstLength bytes
+ * in the first array rather than in cnv->toUBytes, and without output:
+ * Returns the code point if the mapping is to a single one,
+ * and sets *pSrcLength to the number of bytes that the match consumed from src.
+ * Returns U_SENTINEL for no match, a partial match, or a mapping to a string.
+ */
+U_CFUNC UChar32
+ucnv_extInitialMatchToUCodePoint(const UConverter *cnv, const int32_t *cx,
+                                 const char *first, int32_t firstLength,
+                                 const char *src, const char *srcLimit,
+                                 UBool flush,
+                                 int32_t *pSrcLength) {
+    uint32_t value = 0;  /* initialize output-only param to 0 to silence gcc */
+    int32_t match;
+
+    /* try to match */
+    match=ucnv_extMatchToU(cx, (int8_t)UCNV_SISO_STATE(cnv),
+                           first, firstLength,
+                           src, (int32_t)(srcLimit-src),
+                           &value,
+                           cnv->useFallback, flush);
+    if(match>0 && UCNV_EXT_TO_U_IS_CODE_POINT(value)) {
+        *pSrcLength=match-firstLength;
+        return UCNV_EXT_TO_U_GET_CODE_POINT(value);
+    }
+    return U_SENTINEL;
+}
+
 /*
  * continue partial match with new input
  * never called for simple, single-character conversion
@@ -363,6 +363,13 @@ ucnv_extSimpleMatchToU(const int32_t *cx,
                        const char *source, int32_t length,
                        UBool useFallback);
 
+U_CFUNC UChar32
+ucnv_extInitialMatchToUCodePoint(const UConverter *cnv, const int32_t *cx,
+                                 const char *first, int32_t firstLength,
+                                 const char *src, const char *srcLimit,
+                                 UBool flush,
+                                 int32_t *pSrcLength);
+
 U_CFUNC void
 ucnv_extContinueMatchToU(UConverter *cnv,
                          UConverterToUnicodeArgs *pArgs, int32_t srcIndex,
@@ -604,6 +604,7 @@ static const UConverterImpl _LMBCSImpl##n={\
     _LMBCSSafeClone,\
     ucnv_getCompleteUnicodeSet,\
     NULL,\
+    NULL,\
     NULL\
 };\
 static const UConverterStaticData _LMBCSStaticData##n={\
@@ -25,6 +25,7 @@
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
 #include "cmemory.h"
+#include "usimd.h"
 
 enum {
     UCNV_NEED_TO_WRITE_BOM=1
@@ -130,6 +131,13 @@ _UTF16BEFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                     target[0]=(uint8_t)(c>>8);
                     target[1]=(uint8_t)c;
                     target+=2;
+                    /* copy the rest of a run without surrogates in bulk */
+                    if(count>UPRV_SIMD_MIN_LENGTH) {
+                        int32_t n=uprv_uCharsToBytesNoSurrogates(source, (uint8_t *)target, (int32_t)count-1, TRUE);
+                        source+=n;
+                        target+=2*n;
+                        count-=n;
+                    }
                 } else if(U16_IS_SURROGATE_LEAD(c) && count>=2 && U16_IS_TRAIL(trail=*source)) {
                     ++source;
                     --count;
@@ -152,6 +160,16 @@ _UTF16BEFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                     target+=2;
                     *offsets++=sourceIndex;
                     *offsets++=sourceIndex++;
+                    if(count>UPRV_SIMD_MIN_LENGTH) {
+                        int32_t n=uprv_uCharsToBytesNoSurrogates(source, (uint8_t *)target, (int32_t)count-1, TRUE);
+                        source+=n;
+                        target+=2*n;
+                        count-=n;
+                        while(n-->0) {
+                            *offsets++=sourceIndex;
+                            *offsets++=sourceIndex++;
+                        }
+                    }
                 } else if(U16_IS_SURROGATE_LEAD(c) && count>=2 && U16_IS_TRAIL(trail=*source)) {
                     ++source;
                     --count;
@@ -390,6 +408,13 @@ _UTF16BEToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                 source+=2;
                 if(U16_IS_SINGLE(c)) {
                     *target++=c;
+                    /* copy the rest of a run without surrogates in bulk */
+                    if(count>UPRV_SIMD_MIN_LENGTH) {
+                        int32_t n=uprv_bytesToUCharsNoSurrogates(source, target, (int32_t)count-1, TRUE);
+                        source+=2*n;
+                        target+=n;
+                        count-=n;
+                    }
                 } else if(U16_IS_SURROGATE_LEAD(c) && count>=2 &&
                           U16_IS_TRAIL(trail=((UChar)source[0]<<8)|source[1])
                 ) {
@@ -409,6 +434,16 @@ _UTF16BEToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                     *target++=c;
                     *offsets++=sourceIndex;
                     sourceIndex+=2;
+                    if(count>UPRV_SIMD_MIN_LENGTH) {
+                        int32_t n=uprv_bytesToUCharsNoSurrogates(source, target, (int32_t)count-1, TRUE);
+                        source+=2*n;
+                        target+=n;
+                        count-=n;
+                        while(n-->0) {
+                            *offsets++=sourceIndex;
+                            sourceIndex+=2;
+                        }
+                    }
                 } else if(U16_IS_SURROGATE_LEAD(c) && count>=2 &&
                           U16_IS_TRAIL(trail=((UChar)source[0]<<8)|source[1])
                 ) {
@@ -630,6 +665,8 @@ static const UConverterImpl _UTF16BEImpl={
     ucnv_getNonSurrogateUnicodeSet,
 
     NULL,
+    NULL,
+
     NULL
 };
 
@@ -731,6 +768,13 @@ _UTF16LEFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                     target[0]=(uint8_t)c;
                     target[1]=(uint8_t)(c>>8);
                     target+=2;
+                    /* copy the rest of a run without surrogates in bulk */
+                    if(count>UPRV_SIMD_MIN_LENGTH) {
+                        int32_t n=uprv_uCharsToBytesNoSurrogates(source, (uint8_t *)target, (int32_t)count-1, FALSE);
+                        source+=n;
+                        target+=2*n;
+                        count-=n;
+                    }
                 } else if(U16_IS_SURROGATE_LEAD(c) && count>=2 && U16_IS_TRAIL(trail=*source)) {
                     ++source;
                     --count;
@@ -753,6 +797,16 @@ _UTF16LEFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                     target+=2;
                     *offsets++=sourceIndex;
                     *offsets++=sourceIndex++;
+                    if(count>UPRV_SIMD_MIN_LENGTH) {
+                        int32_t n=uprv_uCharsToBytesNoSurrogates(source, (uint8_t *)target, (int32_t)count-1, FALSE);
+                        source+=n;
+                        target+=2*n;
+                        count-=n;
+                        while(n-->0) {
+                            *offsets++=sourceIndex;
+                            *offsets++=sourceIndex++;
+                        }
+                    }
                 } else if(U16_IS_SURROGATE_LEAD(c) && count>=2 && U16_IS_TRAIL(trail=*source)) {
                     ++source;
                     --count;
@@ -991,6 +1045,13 @@ _UTF16LEToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                 source+=2;
                 if(U16_IS_SINGLE(c)) {
                     *target++=c;
+                    /* copy the rest of a run without surrogates in bulk */
+                    if(count>UPRV_SIMD_MIN_LENGTH) {
+                        int32_t n=uprv_bytesToUCharsNoSurrogates(source, target, (int32_t)count-1, FALSE);
+                        source+=2*n;
+                        target+=n;
+                        count-=n;
+                    }
                 } else if(U16_IS_SURROGATE_LEAD(c) && count>=2 &&
                           U16_IS_TRAIL(trail=((UChar)source[1]<<8)|source[0])
                 ) {
@@ -1010,6 +1071,16 @@ _UTF16LEToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                     *target++=c;
                     *offsets++=sourceIndex;
                     sourceIndex+=2;
+                    if(count>UPRV_SIMD_MIN_LENGTH) {
+                        int32_t n=uprv_bytesToUCharsNoSurrogates(source, target, (int32_t)count-1, FALSE);
+                        source+=2*n;
+                        target+=n;
+                        count-=n;
+                        while(n-->0) {
+                            *offsets++=sourceIndex;
+                            sourceIndex+=2;
+                        }
+                    }
                 } else if(U16_IS_SURROGATE_LEAD(c) && count>=2 &&
                           U16_IS_TRAIL(trail=((UChar)source[1]<<8)|source[0])
                 ) {
@@ -1231,6 +1302,8 @@ static const UConverterImpl _UTF16LEImpl={
     ucnv_getNonSurrogateUnicodeSet,
 
     NULL,
+    NULL,
+
     NULL
 };
 
@@ -1513,6 +1586,8 @@ static const UConverterImpl _UTF16Impl = {
     ucnv_getNonSurrogateUnicodeSet,
 
     NULL,
+    NULL,
+
     NULL
 };
 
@@ -1558,6 +1633,8 @@ static const UConverterImpl _UTF16v2Impl = {
     ucnv_getNonSurrogateUnicodeSet,
 
     NULL,
+    NULL,
+
     NULL
 };
 
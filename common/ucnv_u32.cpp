@@ -25,6 +25,7 @@
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
 #include "cmemory.h"
+#include "usimd.h"
 
 #define MAXIMUM_UCS2            0x0000FFFF
 #define MAXIMUM_UTF             0x0010FFFF
@@ -53,6 +54,7 @@ T_UConverter_toUnicode_UTF32_BE(UConverterToUnicodeArgs * args,
     const UChar *targetLimit = args->targetLimit;
     unsigned char *toUBytes = args->converter->toUBytes;
     uint32_t ch, i;
+    int32_t count;
 
     /* Restore state of current sequence */
     if (args->converter->toULength > 0 && myTarget < targetLimit) {
@@ -88,6 +90,16 @@ T_UConverter_toUnicode_UTF32_BE(UConverterToUnicodeArgs * args,
             {
                 /* fits in 16 bits */
                 *(myTarget++) = (UChar) ch;
+                /* convert the rest of a run of BMP code points in bulk */
+                count = (int32_t)((sourceLimit - mySource) >> 2);
+                if (count > (targetLimit - myTarget)) {
+                    count = (int32_t)(targetLimit - myTarget);
+                }
+                if (count >= UPRV_SIMD_MIN_LENGTH) {
+                    count = uprv_utf32BytesToUCharsBMP(mySource, myTarget, count, TRUE);
+                    mySource += 4 * count;
+                    myTarget += count;
+                }
             }
             else {
                 /* write out the surrogates */
@@ -220,6 +232,7 @@ T_UConverter_fromUnicode_UTF32_BE(UConverterFromUnicodeArgs * args,
     UChar32 ch, ch2;
     unsigned int indexToWrite;
     unsigned char temp[sizeof(uint32_t)];
+    int32_t count;
 
     if(mySource >= sourceLimit) {
         /* no input, nothing to do */
@@ -300,6 +313,18 @@ T_UConverter_fromUnicode_UTF32_BE(UConverterFromUnicodeArgs * args,
                 *err = U_BUFFER_OVERFLOW_ERROR;
             }
         }
+        /* convert the rest of a run of BMP code points in bulk */
+        if (ch <= MAXIMUM_UCS2) {
+            count = (int32_t)(sourceLimit - mySource);
+            if (count > ((targetLimit - myTarget) >> 2)) {
+                count = (int32_t)((targetLimit - myTarget) >> 2);
+            }
+            if (count >= UPRV_SIMD_MIN_LENGTH) {
+                count = uprv_uCharsToUTF32BytesBMP(mySource, myTarget, count, TRUE);
+                mySource += count;
+                myTarget += 4 * count;
+            }
+        }
     }
 
     if (mySource < sourceLimit && myTarget >= targetLimit && U_SUCCESS(*err)) {
@@ -485,6 +510,8 @@ static const UConverterImpl _UTF32BEImpl = {
     ucnv_getNonSurrogateUnicodeSet,
 
     NULL,
+    NULL,
+
     NULL
 };
 
@@ -515,6 +542,7 @@ T_UConverter_toUnicode_UTF32_LE(UConverterToUnicodeArgs * args,
     const UChar *targetLimit = args->targetLimit;
     unsigned char *toUBytes = args->converter->toUBytes;
     uint32_t ch, i;
+    int32_t count;
 
     /* Restore state of current sequence */
     if (args->converter->toULength > 0 && myTarget < targetLimit)
@@ -555,6 +583,16 @@ T_UConverter_toUnicode_UTF32_LE(UConverterToUnicodeArgs * args,
             if (ch <= MAXIMUM_UCS2) {
                 /* fits in 16 bits */
                 *(myTarget++) = (UChar) ch;
+                /* convert the rest of a run of BMP code points in bulk */
+                count = (int32_t)((sourceLimit - mySource) >> 2);
+                if (count > (targetLimit - myTarget)) {
+                    count = (int32_t)(targetLimit - myTarget);
+                }
+                if (count >= UPRV_SIMD_MIN_LENGTH) {
+                    count = uprv_utf32BytesToUCharsBMP(mySource, myTarget, count, FALSE);
+                    mySource += 4 * count;
+                    myTarget += count;
+                }
             }
             else {
                 /* write out the surrogates */
@@ -698,6 +736,7 @@ T_UConverter_fromUnicode_UTF32_LE(UConverterFromUnicodeArgs * args,
     UChar32 ch, ch2;
     unsigned int indexToWrite;
     unsigned char temp[sizeof(uint32_t)];
+    int32_t count;
 
     if(mySource >= sourceLimit) {
         /* no input, nothing to do */
@@ -785,6 +824,18 @@ T_UConverter_fromUnicode_UTF32_LE(UConverterFromUnicodeArgs * args,
                 *err = U_BUFFER_OVERFLOW_ERROR;
             }
         }
+        /* convert the rest of a run of BMP code points in bulk */
+        if (ch <= MAXIMUM_UCS2) {
+            count = (int32_t)(sourceLimit - mySource);
+            if (count > ((targetLimit - myTarget) >> 2)) {
+                count = (int32_t)((targetLimit - myTarget) >> 2);
+            }
+            if (count >= UPRV_SIMD_MIN_LENGTH) {
+                count = uprv_uCharsToUTF32BytesBMP(mySource, myTarget, count, FALSE);
+                mySource += count;
+                myTarget += 4 * count;
+            }
+        }
     }
 
     if (mySource < sourceLimit && myTarget >= targetLimit && U_SUCCESS(*err))
@@ -980,6 +1031,8 @@ static const UConverterImpl _UTF32LEImpl = {
     ucnv_getNonSurrogateUnicodeSet,
 
     NULL,
+    NULL,
+
     NULL
 };
 
@@ -1227,6 +1280,8 @@ static const UConverterImpl _UTF32Impl = {
     ucnv_getNonSurrogateUnicodeSet,
 
     NULL,
+    NULL,
+
     NULL
 };
 
@@ -768,6 +768,8 @@ static const UConverterImpl _UTF7Impl={
     ucnv_getCompleteUnicodeSet,
 
     NULL,
+    NULL,
+
     NULL
 };
 
@@ -1469,6 +1471,8 @@ static const UConverterImpl _IMAPImpl={
     NULL,
     ucnv_getCompleteUnicodeSet,
     NULL,
+    NULL,
+
     NULL
 };
 
@@ -32,6 +32,7 @@
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
 #include "cmemory.h"
+#include "usimd.h"
 #include "ustr_imp.h"
 
 /* Prototypes --------------------------------------------------------------- */
@@ -94,9 +95,35 @@ static void  U_CALLCONV ucnv_toUnicode_UTF8 (UConverterToUnicodeArgs * args,
         if (U8_IS_SINGLE(ch))        /* Simple case */
         {
             *(myTarget++) = (UChar) ch;
+
+            /* widen the rest of an ASCII run in bulk */
+            int32_t count = (int32_t)(sourceLimit - mySource);
+            if (count > (targetLimit - myTarget)) {
+                count = (int32_t)(targetLimit - myTarget);
+            }
+            if (count >= UPRV_SIMD_MIN_LENGTH) {
+                count = uprv_asciiToUChars(mySource, myTarget, count);
+                mySource += count;
+                myTarget += count;
+            }
         }
         else
         {
+            /* handle well-formed U+0080..U+FFFF inline */
+            uint8_t t1, t2;
+            if (ch < 0xe0) {
+                if (ch >= 0xc2 && mySource < sourceLimit && U8_IS_TRAIL(t1 = *mySource)) {
+                    ++mySource;
+                    *(myTarget++) = (UChar) (((ch & 0x1f) << 6) | (t1 & 0x3f));
+                    continue;
+                }
+            } else if (ch < 0xf0 && (sourceLimit - mySource) >= 2 &&
+                    U8_IS_VALID_LEAD3_AND_T1(ch, t1 = mySource[0]) && U8_IS_TRAIL(t2 = mySource[1])) {
+                mySource += 2;
+                *(myTarget++) = (UChar) ((ch << 12) | ((t1 & 0x3f) << 6) | (t2 & 0x3f));
+                continue;
+            }
+
             /* store the first char */
             toUBytes[0] = (char)ch;
             inBytes = U8_COUNT_BYTES_NON_ASCII(ch); /* lookup current sequence length */
@@ -212,9 +239,42 @@ static void  U_CALLCONV ucnv_toUnicode_UTF8_OFFSETS_LOGIC (UConverterToUnicodeAr
         {
             *(myTarget++) = (UChar) ch;
             *(myOffsets++) = offsetNum++;
+
+            /* widen the rest of an ASCII run in bulk */
+            int32_t count = (int32_t)(sourceLimit - mySource);
+            if (count > (targetLimit - myTarget)) {
+                count = (int32_t)(targetLimit - myTarget);
+            }
+            if (count >= UPRV_SIMD_MIN_LENGTH) {
+                count = uprv_asciiToUChars(mySource, myTarget, count);
+                mySource += count;
+                myTarget += count;
+                while (count-- > 0) {
+                    *(myOffsets++) = offsetNum++;
+                }
+            }
         }
         else
         {
+            /* handle well-formed U+0080..U+FFFF inline */
+            uint8_t t1, t2;
+            if (ch < 0xe0) {
+                if (ch >= 0xc2 && mySource < sourceLimit && U8_IS_TRAIL(t1 = *mySource)) {
+                    ++mySource;
+                    *(myTarget++) = (UChar) (((ch & 0x1f) << 6) | (t1 & 0x3f));
+                    *(myOffsets++) = offsetNum;
+                    offsetNum += 2;
+                    continue;
+                }
+            } else if (ch < 0xf0 && (sourceLimit - mySource) >= 2 &&
+                    U8_IS_VALID_LEAD3_AND_T1(ch, t1 = mySource[0]) && U8_IS_TRAIL(t2 = mySource[1])) {
+                mySource += 2;
+                *(myTarget++) = (UChar) ((ch << 12) | ((t1 & 0x3f) << 6) | (t2 & 0x3f));
+                *(myOffsets++) = offsetNum;
+                offsetNum += 3;
+                continue;
+            }
+
             toUBytes[0] = (char)ch;
             inBytes = U8_COUNT_BYTES_NON_ASCII(ch);
             i = 1;
@@ -726,6 +786,15 @@ ucnv_UTF8FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
             /* convert ASCII */
             *target++=b;
             --count;
+
+            /* copy the rest of an ASCII run in bulk */
+            if(count>=UPRV_SIMD_MIN_LENGTH) {
+                int32_t asciiLength=uprv_asciiSpan(source, count);
+                uprv_memcpy(target, source, asciiLength);
+                source+=asciiLength;
+                target+=asciiLength;
+                count-=asciiLength;
+            }
             continue;
         } else {
             if(b>=0xe0) {
@@ -879,7 +948,9 @@ static const UConverterImpl _UTF8Impl={
     ucnv_getNonSurrogateUnicodeSet,
 
     ucnv_UTF8FromUTF8,
-    ucnv_UTF8FromUTF8
+    ucnv_UTF8FromUTF8,
+
+    NULL
 };
 
 /* The 1208 CCSID refers to any version of Unicode of UTF-8 */
@@ -923,6 +994,8 @@ static const UConverterImpl _CESU8Impl={
     ucnv_getCompleteUnicodeSet,
 
     NULL,
+    NULL,
+
     NULL
 };
 
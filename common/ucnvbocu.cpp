@@ -226,6 +226,13 @@ bocu1TrailToByte[BOCU1_TRAIL_CONTROLS_COUNT]={
 
 #define BOCU1_SIMPLE_PREV(c) (((c)&~0x7f)+BOCU1_ASCII_PREV)
 
+/*
+ * "prev" for all of the Unihan and Hangul blocks.
+ * All differences within each block fit into one or two bytes.
+ */
+#define BOCU1_UNIHAN_PREV (0x4e00-BOCU1_REACH_NEG_2)
+#define BOCU1_HANGUL_PREV ((0xd7a3+0xac00)/2)
+
 /**
  * Compute the next "previous" value for differencing
  * from the current code point.
@@ -241,10 +248,10 @@ bocu1Prev(int32_t c) {
         return 0x3070;
     } else if(0x4e00<=c && c<=0x9fa5) {
         /* CJK Unihan */
-        return 0x4e00-BOCU1_REACH_NEG_2;
+        return BOCU1_UNIHAN_PREV;
     } else if(0xac00<=c /* && c<=0xd7a3 */) {
         /* Korean Hangul */
-        return (0xd7a3+0xac00)/2;
+        return BOCU1_HANGUL_PREV;
     } else {
         /* mostly small scripts */
         return BOCU1_SIMPLE_PREV(c);
@@ -625,6 +632,56 @@ _Bocu1FromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                     break;
                 }
             }
+
+            if(prev==BOCU1_UNIHAN_PREV || prev==BOCU1_HANGUL_PREV) {
+                /*
+                 * Fast loop for the rest of a run of Unihan or Hangul characters:
+                 * They all keep the same prev, with one- or two-byte differences.
+                 */
+                int32_t first, last;
+                if(prev==BOCU1_UNIHAN_PREV) {
+                    first=0x4e00;
+                    last=0x9fa5;
+                } else {
+                    first=0xac00;
+                    last=0xd7a3;
+                }
+                while(source<sourceLimit && targetCapacity>=2) {
+                    c=*source;
+                    if(c<first || last<c) {
+                        break;
+                    }
+                    ++source;
+                    diff=c-prev;
+                    if(DIFF_IS_SINGLE(diff)) {
+                        *target++=(uint8_t)PACK_SINGLE_DIFF(diff);
+                        *offsets++=sourceIndex;
+                        --targetCapacity;
+                    } else {
+                        /*
+                         * Two bytes as above, but with a non-negative dividend for
+                         * both signs, so that only the constants depend on the sign.
+                         */
+                        int32_t m, lead;
+
+                        if(diff>=0) {
+                            diff-=BOCU1_REACH_POS_1+1;
+                            lead=BOCU1_START_POS_2;
+                        } else {
+                            diff-=BOCU1_REACH_NEG_2;
+                            lead=BOCU1_START_NEG_3;
+                        }
+                        m=diff%BOCU1_TRAIL_COUNT;
+                        diff=diff/BOCU1_TRAIL_COUNT+lead;
+                        *target++=(uint8_t)diff;
+                        *target++=(uint8_t)BOCU1_TRAIL_TO_BYTE(m);
+                        *offsets++=sourceIndex;
+                        *offsets++=sourceIndex;
+                        targetCapacity-=2;
+                    }
+                    sourceIndex=++nextSourceIndex;
+                }
+            }
         } else {
             /* target is full */
             *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
@@ -854,6 +911,52 @@ _Bocu1FromUnicode(UConverterFromUnicodeArgs *pArgs,
                     break;
                 }
             }
+
+            if(prev==BOCU1_UNIHAN_PREV || prev==BOCU1_HANGUL_PREV) {
+                /*
+                 * Fast loop for the rest of a run of Unihan or Hangul characters:
+                 * They all keep the same prev, with one- or two-byte differences.
+                 */
+                int32_t first, last;
+                if(prev==BOCU1_UNIHAN_PREV) {
+                    first=0x4e00;
+                    last=0x9fa5;
+                } else {
+                    first=0xac00;
+                    last=0xd7a3;
+                }
+                while(source<sourceLimit && targetCapacity>=2) {
+                    c=*source;
+                    if(c<first || last<c) {
+                        break;
+                    }
+                    ++source;
+                    diff=c-prev;
+                    if(DIFF_IS_SINGLE(diff)) {
+                        *target++=(uint8_t)PACK_SINGLE_DIFF(diff);
+                        --targetCapacity;
+                    } else {
+                        /*
+                         * Two bytes as above, but with a non-negative dividend for
+                         * both signs, so that only the constants depend on the sign.
+                         */
+                        int32_t m, lead;
+
+                        if(diff>=0) {
+                            diff-=BOCU1_REACH_POS_1+1;
+                            lead=BOCU1_START_POS_2;
+                        } else {
+                            diff-=BOCU1_REACH_NEG_2;
+                            lead=BOCU1_START_NEG_3;
+                        }
+                        m=diff%BOCU1_TRAIL_COUNT;
+                        diff=diff/BOCU1_TRAIL_COUNT+lead;
+                        *target++=(uint8_t)diff;
+                        *target++=(uint8_t)BOCU1_TRAIL_TO_BYTE(m);
+                        targetCapacity-=2;
+                    }
+                }
+            }
         } else {
             /* target is full */
             *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
@@ -1147,6 +1250,53 @@ _Bocu1ToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
             }
         }
         sourceIndex=nextSourceIndex;
+
+        if(prev==BOCU1_UNIHAN_PREV || prev==BOCU1_HANGUL_PREV) {
+            /*
+             * Fast loop for the rest of a run of Unihan or Hangul characters,
+             * which all keep the same prev.
+             */
+            int32_t first, last, length;
+            if(prev==BOCU1_UNIHAN_PREV) {
+                first=0x4e00;
+                last=0x9fa5;
+            } else {
+                first=0xac00;
+                last=0xd7a3;
+            }
+            while(source<sourceLimit && target<targetLimit) {
+                c=*source;
+                if(BOCU1_START_NEG_2<=c && c<BOCU1_START_POS_2) {
+                    c=prev+(c-BOCU1_MIDDLE);
+                    length=1;
+                } else if(BOCU1_START_NEG_3<=c && c<BOCU1_START_POS_3 && (source+1)<sourceLimit) {
+                    int32_t trail=decodeBocu1TrailByte(1, source[1]);
+                    if(trail<0) {
+                        break;
+                    }
+                    int32_t start, reach;
+                    if(c>=BOCU1_MIDDLE) {
+                        start=BOCU1_START_POS_2;
+                        reach=BOCU1_REACH_POS_1+1;
+                    } else {
+                        start=BOCU1_START_NEG_3;
+                        reach=BOCU1_REACH_NEG_2;
+                    }
+                    c=prev+(c-start)*BOCU1_TRAIL_COUNT+reach+trail;
+                    length=2;
+                } else {
+                    break;
+                }
+                if(c<first || last<c) {
+                    break;
+                }
+                *target++=(UChar)c;
+                *offsets++=sourceIndex;
+                source+=length;
+                nextSourceIndex+=length;
+                sourceIndex=nextSourceIndex;
+            }
+        }
     }
 endloop:
 
@@ -1346,6 +1496,50 @@ _Bocu1ToUnicode(UConverterToUnicodeArgs *pArgs,
                 break;
             }
         }
+
+        if(prev==BOCU1_UNIHAN_PREV || prev==BOCU1_HANGUL_PREV) {
+            /*
+             * Fast loop for the rest of a run of Unihan or Hangul characters,
+             * which all keep the same prev.
+             */
+            int32_t first, last, length;
+            if(prev==BOCU1_UNIHAN_PREV) {
+                first=0x4e00;
+                last=0x9fa5;
+            } else {
+                first=0xac00;
+                last=0xd7a3;
+            }
+            while(source<sourceLimit && target<targetLimit) {
+                c=*source;
+                if(BOCU1_START_NEG_2<=c && c<BOCU1_START_POS_2) {
+                    c=prev+(c-BOCU1_MIDDLE);
+                    length=1;
+                } else if(BOCU1_START_NEG_3<=c && c<BOCU1_START_POS_3 && (source+1)<sourceLimit) {
+                    int32_t trail=decodeBocu1TrailByte(1, source[1]);
+                    if(trail<0) {
+                        break;
+                    }
+                    int32_t start, reach;
+                    if(c>=BOCU1_MIDDLE) {
+                        start=BOCU1_START_POS_2;
+                        reach=BOCU1_REACH_POS_1+1;
+                    } else {
+                        start=BOCU1_START_NEG_3;
+                        reach=BOCU1_REACH_NEG_2;
+                    }
+                    c=prev+(c-start)*BOCU1_TRAIL_COUNT+reach+trail;
+                    length=2;
+                } else {
+                    break;
+                }
+                if(c<first || last<c) {
+                    break;
+                }
+                *target++=(UChar)c;
+                source+=length;
+            }
+        }
     }
 endloop:
 
@@ -1391,6 +1585,8 @@ static const UConverterImpl _Bocu1Impl={
     ucnv_getCompleteUnicodeSet,
 
     NULL,
+    NULL,
+
     NULL
 };
 
@@ -37,6 +37,15 @@
 #define TILDE_ESCAPE "\x7E\x7E"
 #define ESC_LEN       2
 
+/*
+ * In ASCII mode, all bytes 00..7F except the tilde map to and from U+0000..U+007F.
+ * Runs of them are converted in bulk. Bit (b>>4) in [b&0xf] is set for '~',
+ * as for uprv_asciiSpanInSet().
+ */
+static const uint8_t asciiRunStopBits[16]={
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80, 0
+};
+
 
 #define CONCAT_ESCAPE_MACRO( args, targetIndex,targetLength,strToAppend, err, len,sourceIndex){                             \
     while(len-->0){                                                                                                         \
@@ -172,6 +181,20 @@ UConverter_toUnicode_HZ_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
     }*/
     
     while(mySource< mySourceLimit){
+
+        if(args->converter->mode != UCNV_TILDE && !myData->isStateDBCS) {
+            /* ASCII bytes other than '~' map to themselves */
+            int32_t length = ucnv_toUAsciiRun(mySource, mySourceLimit, myTarget, args->targetLimit,
+                                              args->offsets ? args->offsets + (myTarget - args->target) : NULL,
+                                              (int32_t)(mySource - args->source),
+                                              asciiRunStopBits);
+            if(length > 0) {
+                mySource += length;
+                myTarget += length;
+                myData->isEmptySegment = FALSE;
+                continue;
+            }
+        }
         
         if(myTarget < args->targetLimit){
             
@@ -362,6 +385,21 @@ UConverter_fromUnicode_HZ_OFFSETS_LOGIC (UConverterFromUnicodeArgs * args,
     while (mySourceIndex < mySourceLength){
         targetUniChar = missingCharMarker;
         if (myTargetIndex < targetLength){
+
+            if(!isTargetUCharDBCS && myConverterData->isEscapeAppended) {
+                /* ASCII characters other than '~' are written as they are in ASCII mode */
+                len = ucnv_fromUAsciiRun(mySource + mySourceIndex, args->sourceLimit,
+                                         myTarget + myTargetIndex, args->targetLimit,
+                                         offsets, mySourceIndex, asciiRunStopBits);
+                if(len > 0) {
+                    mySourceIndex += len;
+                    myTargetIndex += len;
+                    if(offsets) {
+                        offsets += len;
+                    }
+                    continue;
+                }
+            }
             
             mySourceChar = (UChar) mySource[mySourceIndex++];
             
@@ -582,6 +620,23 @@ _HZ_GetUnicodeSet(const UConverter *cnv,
         sa, which, UCNV_SET_FILTER_HZ,
         pErrorCode);
 }
+
+static void U_CALLCONV
+_HZ_CopyState(UConverter *cnv, uint8_t *extraState, UBool save, UErrorCode * /*pErrorCode*/) {
+    /* the mode bytes; the GBK sub-converter is stateless */
+    UConverterDataHZ *myConverterData=(UConverterDataHZ*)cnv->extraInfo;
+    if(save) {
+        extraState[0]=myConverterData->isEscapeAppended;
+        extraState[1]=myConverterData->isStateDBCS;
+        extraState[2]=myConverterData->isTargetUCharDBCS;
+        extraState[3]=myConverterData->isEmptySegment;
+    } else {
+        myConverterData->isEscapeAppended=extraState[0];
+        myConverterData->isStateDBCS=extraState[1];
+        myConverterData->isTargetUCharDBCS=extraState[2];
+        myConverterData->isEmptySegment=extraState[3];
+    }
+}
 U_CDECL_END
 static const UConverterImpl _HZImpl={
 
@@ -606,7 +661,9 @@ static const UConverterImpl _HZImpl={
     _HZ_SafeClone,
     _HZ_GetUnicodeSet,
     NULL,
-    NULL
+    NULL,
+
+    _HZ_CopyState
 };
 
 static const UConverterStaticData _HZStaticData={
@@ -1584,6 +1584,17 @@ _ISCIIGetUnicodeSet(const UConverter *cnv,
     sa->add(sa->set, ZWNJ);
     sa->add(sa->set, ZWJ);
 }
+
+static void U_CALLCONV
+_ISCIICopyState(UConverter *cnv, uint8_t *extraState, UBool save, UErrorCode * /*pErrorCode*/) {
+    /* the contexts and script states; the name is the same for converters with the same options */
+    static_assert(sizeof(UConverterDataISCII)<=UCNV_EXTRA_STATE_CAPACITY, "UConverterDataISCII too large");
+    if(save) {
+        uprv_memcpy(extraState, cnv->extraInfo, sizeof(UConverterDataISCII));
+    } else {
+        uprv_memcpy(cnv->extraInfo, extraState, sizeof(UConverterDataISCII));
+    }
+}
 U_CDECL_END
 static const UConverterImpl _ISCIIImpl={
 
@@ -1608,7 +1619,9 @@ static const UConverterImpl _ISCIIImpl={
     _ISCII_SafeClone,
     _ISCIIGetUnicodeSet,
     NULL,
-    NULL
+    NULL,
+
+    _ISCIICopyState
 };
 
 static const UConverterStaticData _ISCIIStaticData={
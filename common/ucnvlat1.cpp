@@ -458,7 +458,9 @@ static const UConverterImpl _Latin1Impl={
     _Latin1GetUnicodeSet,
 
     NULL,
-    ucnv_Latin1FromUTF8
+    ucnv_Latin1FromUTF8,
+
+    NULL
 };
 
 static const UConverterStaticData _Latin1StaticData={
@@ -737,7 +739,9 @@ static const UConverterImpl _ASCIIImpl={
     _ASCIIGetUnicodeSet,
 
     NULL,
-    ucnv_ASCIIFromUTF8
+    ucnv_ASCIIFromUTF8,
+
+    NULL
 };
 
 static const UConverterStaticData _ASCIIStaticData={
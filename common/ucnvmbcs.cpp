@@ -431,6 +431,11 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                   UConverterToUnicodeArgs *pToUArgs,
                   UErrorCode *pErrorCode);
 
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode);
+
 static const UConverterImpl _SBCSUTF8Impl={
     UCNV_MBCS,
 
@@ -453,8 +458,10 @@ static const UConverterImpl _SBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
-    ucnv_SBCSFromUTF8
+    ucnv_MBCSToUTF8,
+    ucnv_SBCSFromUTF8,
+
+    NULL
 };
 
 static const UConverterImpl _DBCSUTF8Impl={
@@ -479,8 +486,10 @@ static const UConverterImpl _DBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
-    ucnv_DBCSFromUTF8
+    ucnv_MBCSToUTF8,
+    ucnv_DBCSFromUTF8,
+
+    NULL
 };
 
 static const UConverterImpl _MBCSImpl={
@@ -505,6 +514,8 @@ static const UConverterImpl _MBCSImpl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
     NULL,
+    NULL,
+
     NULL
 };
 
@@ -513,7 +524,7 @@ static const UConverterImpl _MBCSImpl={
  */
 
 const UConverterSharedData _MBCSData={
-    sizeof(UConverterSharedData), 1,
+    sizeof(UConverterSharedData), ATOMIC_INT32_T_INITIALIZER(1),
     NULL, NULL, FALSE, TRUE, &_MBCSImpl,
     0, UCNV_MBCS_TABLE_INITIALIZER
 };
@@ -1254,22 +1265,13 @@ _extToU(UConverter *cnv, const UConverterSharedData *sharedData,
 #define U_LF 0x0a
 #define U_NL 0x85
 
-static UBool
-_EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
-    UConverterMBCSTable *mbcsTable;
-
+U_CAPI UBool U_EXPORT2
+ucnv_MBCSSwapLFNL(const UConverterMBCSTable *mbcsTable,
+                  int32_t (*newStateTable)[256], uint8_t *newResults) {
     const uint16_t *table, *results;
     const uint8_t *bytes;
-
-    int32_t (*newStateTable)[256];
-    uint16_t *newResults;
-    uint8_t *p;
-    char *name;
-
+    uint16_t *newResults16;
     uint32_t stage2Entry;
-    uint32_t size, sizeofFromUBytes;
-
-    mbcsTable=&sharedData->mbcs;
 
     table=mbcsTable->fromUnicodeTable;
     bytes=mbcsTable->fromUnicodeBytes;
@@ -1314,6 +1316,51 @@ _EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
         }
     }
 
+    if(newStateTable==NULL) {
+        return TRUE;
+    }
+
+    /* copy and modify the to-Unicode state table */
+    uprv_memcpy(newStateTable, mbcsTable->stateTable, mbcsTable->countStates*1024);
+
+    newStateTable[0][EBCDIC_LF]=MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, U_NL);
+    newStateTable[0][EBCDIC_NL]=MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, U_LF);
+
+    /* copy and modify the from-Unicode result table */
+    newResults16=(uint16_t *)newResults;
+    uprv_memcpy(newResults16, bytes, mbcsTable->fromUBytesLength);
+
+    /* conveniently, the table access macros work on the left side of expressions */
+    if(mbcsTable->outputType==MBCS_OUTPUT_1) {
+        MBCS_SINGLE_RESULT_FROM_U(table, newResults16, U_LF)=EBCDIC_RT_NL;
+        MBCS_SINGLE_RESULT_FROM_U(table, newResults16, U_NL)=EBCDIC_RT_LF;
+    } else /* MBCS_OUTPUT_2_SISO */ {
+        stage2Entry=MBCS_STAGE_2_FROM_U(table, U_LF);
+        MBCS_VALUE_2_FROM_STAGE_2(newResults16, stage2Entry, U_LF)=EBCDIC_NL;
+
+        stage2Entry=MBCS_STAGE_2_FROM_U(table, U_NL);
+        MBCS_VALUE_2_FROM_STAGE_2(newResults16, stage2Entry, U_NL)=EBCDIC_LF;
+    }
+    return TRUE;
+}
+
+static UBool
+_EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
+    UConverterMBCSTable *mbcsTable;
+
+    int32_t (*newStateTable)[256];
+    uint8_t *newResults;
+    uint8_t *p;
+    char *name;
+
+    uint32_t size, sizeofFromUBytes;
+
+    mbcsTable=&sharedData->mbcs;
+
+    if(!ucnv_MBCSSwapLFNL(mbcsTable, NULL, NULL)) {
+        return FALSE;
+    }
+
     if(mbcsTable->fromUBytesLength>0) {
         /*
          * We _know_ the number of bytes in the fromUnicodeBytes array
@@ -1354,28 +1401,9 @@ _EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
         return FALSE;
     }
 
-    /* copy and modify the to-Unicode state table */
     newStateTable=(int32_t (*)[256])p;
-    uprv_memcpy(newStateTable, mbcsTable->stateTable, mbcsTable->countStates*1024);
-
-    newStateTable[0][EBCDIC_LF]=MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, U_NL);
-    newStateTable[0][EBCDIC_NL]=MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, U_LF);
-
-    /* copy and modify the from-Unicode result table */
-    newResults=(uint16_t *)newStateTable[mbcsTable->countStates];
-    uprv_memcpy(newResults, bytes, sizeofFromUBytes);
-
-    /* conveniently, the table access macros work on the left side of expressions */
-    if(mbcsTable->outputType==MBCS_OUTPUT_1) {
-        MBCS_SINGLE_RESULT_FROM_U(table, newResults, U_LF)=EBCDIC_RT_NL;
-        MBCS_SINGLE_RESULT_FROM_U(table, newResults, U_NL)=EBCDIC_RT_LF;
-    } else /* MBCS_OUTPUT_2_SISO */ {
-        stage2Entry=MBCS_STAGE_2_FROM_U(table, U_LF);
-        MBCS_VALUE_2_FROM_STAGE_2(newResults, stage2Entry, U_LF)=EBCDIC_NL;
-
-        stage2Entry=MBCS_STAGE_2_FROM_U(table, U_NL);
-        MBCS_VALUE_2_FROM_STAGE_2(newResults, stage2Entry, U_NL)=EBCDIC_LF;
-    }
+    newResults=(uint8_t *)newStateTable[mbcsTable->countStates];
+    ucnv_MBCSSwapLFNL(mbcsTable, newStateTable, newResults);
 
     /* set the canonical converter name */
     name=(char *)newResults+sizeofFromUBytes;
@@ -1386,7 +1414,7 @@ _EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
     umtx_lock(NULL);
     if(mbcsTable->swapLFNLStateTable==NULL) {
         mbcsTable->swapLFNLStateTable=newStateTable;
-        mbcsTable->swapLFNLFromUnicodeBytes=(uint8_t *)newResults;
+        mbcsTable->swapLFNLFromUnicodeBytes=newResults;
         mbcsTable->swapLFNLName=name;
 
         newStateTable=NULL;
@@ -1561,7 +1589,7 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
     _MBCSHeader *header=(_MBCSHeader *)raw;
     uint32_t offset;
     uint32_t headerLength;
-    UBool noFromU=FALSE;
+    UBool noFromU=FALSE, hasSwapLFNL=FALSE;
 
     if(header->version[0]==4) {
         headerLength=MBCS_HEADER_V4_LENGTH;
@@ -1569,6 +1597,9 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
               (header->options&MBCS_OPT_UNKNOWN_INCOMPATIBLE_MASK)==0) {
         headerLength=header->options&MBCS_OPT_LENGTH_MASK;
         noFromU=(UBool)((header->options&MBCS_OPT_NO_FROM_U)!=0);
+        hasSwapLFNL=(UBool)(
+            (header->options&MBCS_OPT_SWAP_LFNL)!=0 &&
+            headerLength>=MBCS_HEADER_V5_SWAP_LFNL_LENGTH && !noFromU);
     } else {
         *pErrorCode=U_INVALID_TABLE_FORMAT;
         return;
@@ -1660,6 +1691,7 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
         mbcsTable->swapLFNLStateTable=NULL;
         mbcsTable->swapLFNLFromUnicodeBytes=NULL;
         mbcsTable->swapLFNLName=NULL;
+        mbcsTable->swapLFNLFromData=FALSE;
 
         /*
          * The reconstitutedData must be deleted only when the base converter
@@ -1776,6 +1808,20 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
         mbcsTable->fromUnicodeBytes=(const uint8_t *)(raw+header->offsetFromUBytes);
         mbcsTable->fromUBytesLength=header->fromUBytesLength;
 
+        if(hasSwapLFNL) {
+            /*
+             * makeconv precomputed the data for the swaplfnl option.
+             * Use it in place, so that it is shared like the rest of the mapped .cnv file.
+             */
+            const uint8_t *swapLFNLData=raw+header->offsetSwapLFNL;
+            mbcsTable->swapLFNLStateTable=(int32_t (*)[256])swapLFNLData;
+            mbcsTable->swapLFNLFromUnicodeBytes=
+                (uint8_t *)(swapLFNLData+mbcsTable->countStates*1024);
+            mbcsTable->swapLFNLName=
+                (char *)(mbcsTable->swapLFNLFromUnicodeBytes+mbcsTable->fromUBytesLength);
+            mbcsTable->swapLFNLFromData=TRUE;
+        }
+
         /*
          * converter versions 6.1 and up contain a unicodeMask that is
          * used here to select the most efficient function implementations
@@ -1880,7 +1926,7 @@ static void U_CALLCONV
 ucnv_MBCSUnload(UConverterSharedData *sharedData) {
     UConverterMBCSTable *mbcsTable=&sharedData->mbcs;
 
-    if(mbcsTable->swapLFNLStateTable!=NULL) {
+    if(mbcsTable->swapLFNLStateTable!=NULL && !mbcsTable->swapLFNLFromData) {
         uprv_free(mbcsTable->swapLFNLStateTable);
     }
     if(mbcsTable->stateTableOwned) {
@@ -5622,6 +5668,248 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/* MBCS-to-UTF-8 conversion functions --------------------------------------- */
+
+/*
+ * Converts directly from the codepage to UTF-8 without pivoting through UTF-16,
+ * for utf8Friendly SBCS and DBCS (MBCS_OUTPUT_2) tables.
+ *
+ * Only characters with roundtrip or fallback mappings to single code points,
+ * in the base table or in the extension table, are converted here.
+ * The function stops before any other byte sequence (unmappable, illegal,
+ * SI/SO state changes, truncated at the end of the input, or if its UTF-8 form
+ * does not fit into the rest of the target buffer) and sets U_USING_DEFAULT_WARNING
+ * so that ucnv_convertEx() converts it by pivoting, with callbacks as usual.
+ */
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode) {
+    UConverter *cnv;
+    const uint8_t *source, *sourceLimit, *charStart;
+    uint8_t *target;
+    int32_t targetCapacity;
+
+    const int32_t (*stateTable)[256];
+    const uint16_t *unicodeCodeUnits;
+    const int32_t *cx;
+
+    uint32_t offset;
+    uint8_t state, charState, action;
+    int32_t entry, length;
+    UChar32 c;
+    UBool isUnassigned;
+
+    cnv=pToUArgs->converter;
+    if(cnv->toULength>0 || pFromUArgs->converter->fromUChar32!=0) {
+        /* finish a partial character by pivoting */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetCapacity=(int32_t)(pFromUArgs->targetLimit-pFromUArgs->target);
+
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+    } else {
+        stateTable=cnv->sharedData->mbcs.stateTable;
+    }
+    unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+    cx=cnv->sharedData->mbcs.extIndexes;
+
+    /* same as in ucnv_MBCSToUnicodeWithOffsets() */
+    if((state=(uint8_t)(cnv->mode))==0) {
+        state=cnv->sharedData->mbcs.dbcsOnlyState;
+    }
+
+    if(cnv->sharedData->mbcs.countStates==1) {
+        /* optimized loop for SBCS, where each byte is one character */
+        const int32_t *sbcsTable=stateTable[0];
+        while( source<sourceLimit && targetCapacity>=3 &&
+               MBCS_ENTRY_FINAL_IS_VALID_DIRECT_16(entry=sbcsTable[*source])
+        ) {
+            ++source;
+            c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            if(c<=0x7f) {
+                *target++=(uint8_t)c;
+                --targetCapacity;
+            } else if(c<=0x7ff) {
+                *target++=(uint8_t)((c>>6)|0xc0);
+                *target++=(uint8_t)((c&0x3f)|0x80);
+                targetCapacity-=2;
+            } else {
+                *target++=(uint8_t)((c>>12)|0xe0);
+                *target++=(uint8_t)(((c>>6)&0x3f)|0x80);
+                *target++=(uint8_t)((c&0x3f)|0x80);
+                targetCapacity-=3;
+            }
+        }
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(targetCapacity<=0) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        /* optimized code for 1/2-byte input and BMP output, as in ucnv_MBCSToUnicodeWithOffsets() */
+        entry=stateTable[state][*source];
+        if(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            int32_t trail;
+            if( targetCapacity>=3 && (sourceLimit-source)>=2 &&
+                MBCS_ENTRY_IS_FINAL(trail=stateTable[MBCS_ENTRY_TRANSITION_STATE(entry)][source[1]]) &&
+                MBCS_ENTRY_FINAL_ACTION(trail)==MBCS_STATE_VALID_16 &&
+                (c=unicodeCodeUnits[MBCS_ENTRY_TRANSITION_OFFSET(entry)+MBCS_ENTRY_FINAL_VALUE_16(trail)])<0xfffe
+            ) {
+                source+=2;
+                state=(uint8_t)MBCS_ENTRY_FINAL_STATE(trail); /* typically 0 */
+                if(c<=0x7ff) {
+                    *target++=(uint8_t)((c>>6)|0xc0);
+                    *target++=(uint8_t)((c&0x3f)|0x80);
+                    targetCapacity-=2;
+                } else {
+                    *target++=(uint8_t)((c>>12)|0xe0);
+                    *target++=(uint8_t)(((c>>6)&0x3f)|0x80);
+                    *target++=(uint8_t)((c&0x3f)|0x80);
+                    targetCapacity-=3;
+                }
+                continue;
+            }
+        } else if(MBCS_ENTRY_FINAL_IS_VALID_DIRECT_16(entry) && targetCapacity>=3) {
+            c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            ++source;
+            state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+            if(c<=0x7f) {
+                *target++=(uint8_t)c;
+                --targetCapacity;
+            } else if(c<=0x7ff) {
+                *target++=(uint8_t)((c>>6)|0xc0);
+                *target++=(uint8_t)((c&0x3f)|0x80);
+                targetCapacity-=2;
+            } else {
+                *target++=(uint8_t)((c>>12)|0xe0);
+                *target++=(uint8_t)(((c>>6)&0x3f)|0x80);
+                *target++=(uint8_t)((c&0x3f)|0x80);
+                targetCapacity-=3;
+            }
+            continue;
+        }
+
+        /* read one character */
+        charStart=source;
+        charState=state;
+        offset=0;
+        entry=stateTable[state][*source++];
+        while(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            if(source>=sourceLimit) {
+                break;
+            }
+            state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
+            offset+=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+            entry=stateTable[state][*source++];
+        }
+
+        c=U_SENTINEL;
+        isUnassigned=FALSE;
+        if(MBCS_ENTRY_IS_FINAL(entry)) {
+            action=(uint8_t)(MBCS_ENTRY_FINAL_ACTION(entry));
+            if( action==MBCS_STATE_VALID_DIRECT_16 ||
+                (action==MBCS_STATE_FALLBACK_DIRECT_16 && UCNV_TO_U_USE_FALLBACK(cnv))
+            ) {
+                c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            } else if(action==MBCS_STATE_VALID_16) {
+                offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+                c=unicodeCodeUnits[offset];
+                if(c==0xfffe) {
+                    if(UCNV_TO_U_USE_FALLBACK(cnv) &&
+                            (c=(UChar32)ucnv_MBCSGetFallback(&cnv->sharedData->mbcs, offset))!=0xfffe) {
+                        /* fallback BMP code point */
+                    } else {
+                        c=U_SENTINEL;
+                        isUnassigned=TRUE;
+                    }
+                } else if(c==0xffff) {
+                    c=U_SENTINEL;
+                }
+            } else if(action==MBCS_STATE_VALID_DIRECT_20 ||
+                      (action==MBCS_STATE_FALLBACK_DIRECT_20 && UCNV_TO_U_USE_FALLBACK(cnv))
+            ) {
+                c=MBCS_ENTRY_FINAL_VALUE(entry)+0x10000;
+            } else if(action==MBCS_STATE_VALID_16_PAIR) {
+                offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+                c=unicodeCodeUnits[offset++];
+                if(c<0xd800) {
+                    /* BMP code point below 0xd800 */
+                } else if(UCNV_TO_U_USE_FALLBACK(cnv) ? c<=0xdfff : c<=0xdbff) {
+                    /* roundtrip or fallback surrogate pair */
+                    c=U16_GET_SUPPLEMENTARY(c&0xdbff, unicodeCodeUnits[offset]);
+                } else if(UCNV_TO_U_USE_FALLBACK(cnv) ? (c&0xfffe)==0xe000 : c==0xe000) {
+                    /* roundtrip BMP code point above 0xd800 or fallback BMP code point */
+                    c=unicodeCodeUnits[offset];
+                } else {
+                    isUnassigned= c!=0xffff;
+                    c=U_SENTINEL;
+                }
+            } else if(action==MBCS_STATE_UNASSIGNED) {
+                isUnassigned=TRUE;
+            }
+            if(isUnassigned && cx!=NULL) {
+                /* try an extension mapping, as _extToU() would */
+                int32_t extLength;
+                c=ucnv_extInitialMatchToUCodePoint(cnv, cx,
+                                                   (const char *)charStart, (int32_t)(source-charStart),
+                                                   (const char *)source, (const char *)sourceLimit,
+                                                   pToUArgs->flush, &extLength);
+                if(c>=0) {
+                    source+=extLength;
+                }
+            }
+        }
+        length= c>=0 ? U8_LENGTH(c) : 0;
+        if(length==0 || length>targetCapacity) {
+            /* leave this character to the pivoting conversion */
+            source=charStart;
+            state=charState;
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+
+        /* set the next state; the state before each character is in charState */
+        state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+
+        /* write the UTF-8 bytes */
+        if(length==1) {
+            *target++=(uint8_t)c;
+        } else if(length==2) {
+            *target++=(uint8_t)((c>>6)|0xc0);
+            *target++=(uint8_t)((c&0x3f)|0x80);
+        } else if(length==3) {
+            *target++=(uint8_t)((c>>12)|0xe0);
+            *target++=(uint8_t)(((c>>6)&0x3f)|0x80);
+            *target++=(uint8_t)((c&0x3f)|0x80);
+        } else {
+            *target++=(uint8_t)((c>>18)|0xf0);
+            *target++=(uint8_t)(((c>>12)&0x3f)|0x80);
+            *target++=(uint8_t)(((c>>6)&0x3f)|0x80);
+            *target++=(uint8_t)((c&0x3f)|0x80);
+        }
+        targetCapacity-=length;
+    }
+
+    /* set the converter state back into UConverter; there is no partial character */
+    cnv->mode=state;
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 /* miscellaneous ------------------------------------------------------------ */
 
 static void U_CALLCONV
@@ -153,8 +153,13 @@
  *
  * New and required in version 5:
  *  8   uint32_t    options, bits:
- *                      31..16 reserved for flags that can be added without breaking
+ *                      31..17 reserved for flags that can be added without breaking
  *                                 backward compatibility
+ *                          16 MBCS_OPT_SWAP_LFNL -- if set,
+ *                                 then offsetSwapLFNL is present and points to
+ *                                 precomputed data for the swaplfnl option;
+ *                                 only set for EBCDIC tables with standard LF and NL
+ *                                 mappings, and never together with MBCS_OPT_NO_FROM_U
  *                      15.. 6 reserved for flags whose addition will break
  *                                 backward compatibility
  *                           6 MBCS_OPT_FROM_U -- if set,
@@ -170,6 +175,8 @@
  *  9   uint32_t    fullStage2Length: used if MBCS_OPT_FROM_U is set
  *                                 specifies the full length of stage 2
  *                                 including the omitted part
+ * 10   uint32_t    offsetSwapLFNL: used if MBCS_OPT_SWAP_LFNL is set
+ *                                 (the header length is then at least 11)
  *
  * if(outputType==MBCS_OUTPUT_EXT_ONLY) {
  *     -- base table name for extension-only table
@@ -234,6 +241,16 @@
  *         maxFastUChar=(maxFastUChar<<8)|0xff;
  *         uint16_t mbcsIndex[(maxFastUChar+1)>>6];
  *     }
+ *
+ *     -- optional precomputed swaplfnl data -- _MBCSHeader.version 5.4 and higher
+ *     if(options&MBCS_OPT_SWAP_LFNL) {
+ *         -- at offsetSwapLFNL, like the state table and the fromUBytes[] above
+ *            but with the mappings for LF and NL swapped
+ *         int32_t swapLFNLStateTable[countStates][256];
+ *         uint16_t swapLFNLFromUBytes[fromUBytesLength/2];
+ *         -- the converter name with ",swaplfnl" appended
+ *         char swapLFNLName[variable]; -- with NUL plus padding for 4-alignment
+ *     }
  * }
  *
  * -- extension table, details see ucnv_ext.h
@@ -396,6 +413,8 @@ typedef struct UConverterMBCSTable {
 
     /* converter name for swaplfnl */
     char *swapLFNLName;
+    /* TRUE if the swaplfnl data points into the .cnv file rather than to allocated memory */
+    UBool swapLFNLFromData;
 
     /* extension data */
     struct UConverterSharedData *baseSharedData;
@@ -431,6 +450,7 @@ typedef struct UConverterMBCSTable {
      \
     /* converter name for swaplfnl */ \
     NULL, \
+    FALSE, \
      \
     /* extension data */ \
     NULL, \
@@ -440,6 +460,8 @@ typedef struct UConverterMBCSTable {
 enum {
     MBCS_OPT_LENGTH_MASK=0x3f,
     MBCS_OPT_NO_FROM_U=0x40,
+    /* Precomputed swaplfnl data, see offsetSwapLFNL. Compatible with older readers. */
+    MBCS_OPT_SWAP_LFNL=0x10000,
     /*
      * If any of the following options bits are set,
      * then the file must be rejected.
@@ -454,7 +476,8 @@ enum {
 
 enum {
     MBCS_HEADER_V4_LENGTH=8,
-    MBCS_HEADER_V5_MIN_LENGTH=9
+    MBCS_HEADER_V5_MIN_LENGTH=9,
+    MBCS_HEADER_V5_SWAP_LFNL_LENGTH=11
 };
 
 /**
@@ -475,9 +498,12 @@ typedef struct {
 
     /* new and optional in version 5; used if options&MBCS_OPT_NO_FROM_U */
     uint32_t fullStage2Length;  /* number of 32-bit units */
+
+    /* new and optional in version 5; used if options&MBCS_OPT_SWAP_LFNL */
+    uint32_t offsetSwapLFNL;
 } _MBCSHeader;
 
-#define UCNV_MBCS_HEADER_INITIALIZER { { 0 },  0, 0, 0, 0, 0, 0, 0,  0,  0 }
+#define UCNV_MBCS_HEADER_INITIALIZER { { 0 },  0, 0, 0, 0, 0, 0, 0,  0,  0,  0 }
 
 /*
  * This is a simple version of _MBCSGetNextUChar() that is used
@@ -522,6 +548,22 @@ ucnv_MBCSSingleSimpleGetNextUChar(UConverterSharedData *sharedData,
 U_CFUNC UBool
 ucnv_MBCSIsLeadByte(UConverterSharedData *sharedData, char byte);
 
+/**
+ * Checks whether the swaplfnl option applies to an MBCS table:
+ * Whether it is an EBCDIC table with an SBCS portion and with
+ * the standard mappings for LF and NL.
+ * If so, and if newStateTable is not NULL, then the state table and
+ * the fromUnicodeBytes are copied to newStateTable[countStates] and
+ * newResults[fromUBytesLength], with the mappings for LF and NL swapped.
+ * Only the toUnicode state table and the fromUnicode fields are used.
+ *
+ * This is an internal function that is used when a converter is opened
+ * with the swaplfnl option, and by makeconv for precomputing the data.
+ */
+U_CAPI UBool U_EXPORT2
+ucnv_MBCSSwapLFNL(const UConverterMBCSTable *mbcsTable,
+                  int32_t (*newStateTable)[256], uint8_t *newResults);
+
 /** This is a macro version of _MBCSIsLeadByte(). */
 #define _MBCS_IS_LEAD_BYTE(sharedData, byte) \
     (UBool)MBCS_ENTRY_IS_TRANSITION((sharedData)->mbcs.stateTable[0][(uint8_t)(byte)])
@@ -1062,6 +1062,24 @@ _SCSUFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
             goto getTrailSingle;
         }
 
+        /* fast path for US-ASCII graphic characters and the current dynamic window */
+        while(source<sourceLimit && targetCapacity>0) {
+            UChar u=*source;
+            if((uint32_t)(u-0x20)<=0x5f) {
+                *target++=(uint8_t)u;
+            } else if((delta=u-currentOffset)<=0x7f) {
+                *target++=(uint8_t)(delta|0x80);
+            } else {
+                break;
+            }
+            ++source;
+            if(offsets!=NULL) {
+                *offsets++=sourceIndex;
+            }
+            sourceIndex=++nextSourceIndex;
+            --targetCapacity;
+        }
+
         /* state machine for single-byte mode */
 /* singleByteMode: */
         while(source<sourceLimit) {
@@ -1239,6 +1257,23 @@ _SCSUFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
             goto getTrailUnicode;
         }
 
+        /* fast path for uncompressible characters (BMP ideographs and similar) */
+        while(source<sourceLimit && targetCapacity>=2) {
+            UChar u=*source;
+            if((uint32_t)(u-0x3400)>=(0xd800-0x3400)) {
+                break;
+            }
+            *target++=(uint8_t)(u>>8);
+            *target++=(uint8_t)u;
+            ++source;
+            if(offsets!=NULL) {
+                *offsets++=sourceIndex;
+                *offsets++=sourceIndex;
+            }
+            sourceIndex=++nextSourceIndex;
+            targetCapacity-=2;
+        }
+
         /* state machine for Unicode mode */
 /* unicodeByteMode: */
         while(source<sourceLimit) {
@@ -1562,6 +1597,20 @@ _SCSUFromUnicode(UConverterFromUnicodeArgs *pArgs,
             goto getTrailSingle;
         }
 
+        /* fast path for US-ASCII graphic characters and the current dynamic window */
+        while(source<sourceLimit && targetCapacity>0) {
+            UChar u=*source;
+            if((uint32_t)(u-0x20)<=0x5f) {
+                *target++=(uint8_t)u;
+            } else if((delta=u-currentOffset)<=0x7f) {
+                *target++=(uint8_t)(delta|0x80);
+            } else {
+                break;
+            }
+            ++source;
+            --targetCapacity;
+        }
+
         /* state machine for single-byte mode */
 /* singleByteMode: */
         while(source<sourceLimit) {
@@ -1721,6 +1770,18 @@ _SCSUFromUnicode(UConverterFromUnicodeArgs *pArgs,
             goto getTrailUnicode;
         }
 
+        /* fast path for uncompressible characters (BMP ideographs and similar) */
+        while(source<sourceLimit && targetCapacity>=2) {
+            UChar u=*source;
+            if((uint32_t)(u-0x3400)>=(0xd800-0x3400)) {
+                break;
+            }
+            *target++=(uint8_t)(u>>8);
+            *target++=(uint8_t)u;
+            ++source;
+            targetCapacity-=2;
+        }
+
         /* state machine for Unicode mode */
 /* unicodeByteMode: */
         while(source<sourceLimit) {
@@ -1995,6 +2056,17 @@ _SCSUSafeClone(const UConverter *cnv,
 
     return &localClone->cnv;
 }
+
+static void U_CALLCONV
+_SCSUCopyState(UConverter *cnv, uint8_t *extraState, UBool save, UErrorCode * /*pErrorCode*/) {
+    /* the windows and modes; the locale is the same for converters with the same name */
+    static_assert(sizeof(SCSUData)<=UCNV_EXTRA_STATE_CAPACITY, "SCSUData too large");
+    if(save) {
+        uprv_memcpy(extraState, cnv->extraInfo, sizeof(SCSUData));
+    } else {
+        uprv_memcpy(cnv->extraInfo, extraState, sizeof(SCSUData));
+    }
+}
 U_CDECL_END
 
 static const UConverterImpl _SCSUImpl={
@@ -2019,7 +2091,9 @@ static const UConverterImpl _SCSUImpl={
     _SCSUSafeClone,
     ucnv_getCompleteUnicodeSet,
     NULL,
-    NULL
+    NULL,
+
+    _SCSUCopyState
 };
 
 static const UConverterStaticData _SCSUStaticData={
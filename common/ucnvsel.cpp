@@ -45,6 +45,7 @@
 #include "uenumimp.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "usimd.h"
 
 U_NAMESPACE_USE
 
@@ -57,8 +58,23 @@ struct UConverterSelector {
   int32_t encodingStrLength;
   uint8_t* swapped;
   UBool ownPv, ownEncodingStrings;
+  int32_t asciiPvIndex;      // pv offset shared by all of U+0000..U+007F, or -1
 };
 
+// Selecting for ASCII text needs no trie lookups if all ASCII code points
+// have the same row of bits. That is usually the case, unless some of the
+// encodings are not ASCII-compatible or the excluded set contains ASCII.
+static void initAsciiPvIndex(UConverterSelector* sel) {
+  int32_t pvIndex = UTRIE2_GET16(sel->trie, 0);
+  for (UChar32 c = 1; c < 0x80; ++c) {
+    if (UTRIE2_GET16(sel->trie, c) != pvIndex) {
+      pvIndex = -1;
+      break;
+    }
+  }
+  sel->asciiPvIndex = pvIndex;
+}
+
 static void generateSelectorData(UConverterSelector* result,
                                  UPropsVectors *upvec,
                                  const USet* excludedCodePoints,
@@ -221,6 +237,7 @@ ucnvsel_open(const char* const*  converterList, int32_t converterListSize,
   if (U_FAILURE(*status)) {
     return NULL;
   }
+  initAsciiPvIndex(newSelector.getAlias());
 
   return newSelector.orphan();
 }
@@ -584,6 +601,7 @@ ucnvsel_openFromSerialized(const void* buffer, int32_t length, UErrorCode* statu
     s += uprv_strlen(s) + 1;
   }
   p += sel->encodingStrLength;
+  initAsciiPvIndex(sel);
 
   return sel;
 }
@@ -665,13 +683,21 @@ static const UEnumeration defaultEncodings = {
 
 // internal fn to intersect two sets of masks
 // returns whether the mask has reduced to all zeros
+// Four words per iteration, with independent OR chains, which compilers
+// turn into vector instructions.
 static UBool intersectMasks(uint32_t* dest, const uint32_t* source1, int32_t len) {
-  int32_t i;
-  uint32_t oredDest = 0;
-  for (i = 0 ; i < len ; ++i) {
-    oredDest |= (dest[i] &= source1[i]);
-  }
-  return oredDest == 0;
+  int32_t i = 0;
+  uint32_t ored0 = 0, ored1 = 0, ored2 = 0, ored3 = 0;
+  for (; i + 4 <= len; i += 4) {
+    ored0 |= (dest[i] &= source1[i]);
+    ored1 |= (dest[i + 1] &= source1[i + 1]);
+    ored2 |= (dest[i + 2] &= source1[i + 2]);
+    ored3 |= (dest[i + 3] &= source1[i + 3]);
+  }
+  for (; i < len; ++i) {
+    ored0 |= (dest[i] &= source1[i]);
+  }
+  return (ored0 | ored1 | ored2 | ored3) == 0;
 }
 
 // internal fn to count how many 1's are there in a mask
@@ -768,12 +794,25 @@ ucnvsel_selectForString(const UConverterSelector* sel,
       limit = NULL;
     }
     
+    // Intersecting with the same row again does not change the mask.
+    int32_t prevPvIndex = -1;
     while (limit == NULL ? *s != 0 : s != limit) {
       UChar32 c;
       uint16_t pvIndex;
-      UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
+      if (*s < 0x80 && sel->asciiPvIndex >= 0) {
+        // Skip the ASCII run without trie lookups. The NUL terminator stops it, too.
+        pvIndex = (uint16_t)sel->asciiPvIndex;
+        do {
+          ++s;
+        } while ((limit == NULL || s != limit) && 0 < *s && *s < 0x80);
+      } else {
+        UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex);
+      }
+      if (pvIndex != prevPvIndex) {
+        if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
+          break;
+        }
+        prevPvIndex = pvIndex;
       }
     }
   }
@@ -809,11 +848,29 @@ ucnvsel_selectForUTF8(const UConverterSelector* sel,
   if(s!=NULL) {
     const char *limit = s + length;
     
+    // Intersecting with the same row again does not change the mask.
+    int32_t prevPvIndex = -1;
     while (s != limit) {
       uint16_t pvIndex;
-      UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
+      if ((uint8_t)*s < 0x80 && sel->asciiPvIndex >= 0) {
+        // Skip the ASCII run without trie lookups.
+        pvIndex = (uint16_t)sel->asciiPvIndex;
+        int32_t remaining = (int32_t)(limit - s);
+        if (remaining >= UPRV_SIMD_MIN_LENGTH) {
+          s += uprv_asciiSpan((const uint8_t *)s, remaining);
+        } else {
+          do {
+            ++s;
+          } while (s != limit && (uint8_t)*s < 0x80);
+        }
+      } else {
+        UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
+      }
+      if (pvIndex != prevPvIndex) {
+        if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
+          break;
+        }
+        prevPvIndex = pvIndex;
       }
     }
   }
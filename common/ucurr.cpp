@@ -117,6 +117,20 @@ static icu::UInitOnce gIsoCodesInitOnce = U_INITONCE_INITIALIZER;
 static const icu::Hashtable* gCurrSymbolsEquiv = NULL;
 static icu::UInitOnce gCurrSymbolsEquivInitOnce = U_INITONCE_INITIALIZER;
 
+// Currency data from supplementalData, loaded once.
+typedef struct CurrencyMetaEntry {
+    char isoCode[ISO_CURRENCY_CODE_LENGTH+1];
+    const int32_t *data;
+} CurrencyMetaEntry;
+
+// CurrencyMeta entries sorted by ISO code, without DEFAULT.
+static CurrencyMetaEntry* gCurrencyMeta = NULL;
+static int32_t gCurrencyMetaCount = 0;
+static const int32_t* gDefaultMeta = LAST_RESORT_DATA;
+// CurrencyMap, kept open for ucurr_forLocale().
+static UResourceBundle* gCurrencyMap = NULL;
+static icu::UInitOnce gCurrencyDataInitOnce = U_INITONCE_INITIALIZER;
+
 U_NAMESPACE_BEGIN
 
 // EquivIterator iterates over all strings that are equivalent to a given
@@ -255,6 +269,22 @@ isoCodes_cleanup(void)
     return TRUE;
 }
 
+/**
+ * Cleanup callback func
+ */
+static UBool U_CALLCONV 
+currencyData_cleanup(void)
+{
+    uprv_free(gCurrencyMeta);
+    gCurrencyMeta = NULL;
+    gCurrencyMetaCount = 0;
+    gDefaultMeta = LAST_RESORT_DATA;
+    ures_close(gCurrencyMap);
+    gCurrencyMap = NULL;
+    gCurrencyDataInitOnce.reset();
+    return TRUE;
+}
+
 /**
  * Cleanup callback func
  */
@@ -296,6 +326,64 @@ myUCharsToChars(char* resultOfLen4, const UChar* currency) {
     return resultOfLen4;
 }
 
+/**
+ * Internal function to look up currency data.  Result is an array of
+ * four integers.  The first is the fraction digits.  The second is the
+ * rounding increment, or 0 if none.  The rounding increment is in
+ * units of 10^(-fraction_digits).  The third and fourth are the same
+ * except that they are those used in cash transations ( cashDigits
+ * and cashRounding ).
+ */
+U_CDECL_BEGIN
+static UBool U_CALLCONV currency_cleanup(void);
+U_CDECL_END
+
+/**
+ * Loads the CurrencyMeta table into an array sorted by ISO code,
+ * and opens CurrencyMap.
+ * The int vectors point into the data of the supplementalData bundle,
+ * which is kept open via gCurrencyMap.
+ */
+static void U_CALLCONV initCurrencyData(UErrorCode &status) {
+    ucln_common_registerCleanup(UCLN_COMMON_CURRENCY, currency_cleanup);
+    UResourceBundle *currencyData = ures_openDirect(U_ICUDATA_CURR, CURRENCY_DATA, &status);
+    LocalUResourceBundlePointer currencyMeta(ures_getByKey(currencyData, CURRENCY_META, NULL, &status));
+    gCurrencyMap = ures_getByKey(currencyData, CURRENCY_MAP, currencyData, &status);
+    if (U_FAILURE(status)) {
+        ures_close(gCurrencyMap);
+        gCurrencyMap = NULL;
+        return;
+    }
+
+    int32_t size = ures_getSize(currencyMeta.getAlias());
+    gCurrencyMeta = (CurrencyMetaEntry *)uprv_malloc(size * sizeof(CurrencyMetaEntry));
+    if (gCurrencyMeta == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    // Table keys are sorted, so the array is sorted too.
+    LocalUResourceBundlePointer rb;
+    for (int32_t i = 0; i < size; ++i) {
+        rb.adoptInstead(ures_getByIndex(currencyMeta.getAlias(), i, rb.orphan(), &status));
+        int32_t len;
+        const int32_t *data = ures_getIntVector(rb.getAlias(), &len, &status);
+        if (U_FAILURE(status) || len != 4) {
+            if (U_SUCCESS(status)) {
+                status = U_INVALID_FORMAT_ERROR;
+            }
+            return;
+        }
+        const char *key = ures_getKey(rb.getAlias());
+        if (uprv_strcmp(key, DEFAULT_META) == 0) {
+            gDefaultMeta = data;
+        } else if (uprv_strlen(key) == ISO_CURRENCY_CODE_LENGTH) {
+            CurrencyMetaEntry &entry = gCurrencyMeta[gCurrencyMetaCount++];
+            uprv_strcpy(entry.isoCode, key);
+            entry.data = data;
+        }
+    }
+}
+
 /**
  * Internal function to look up currency data.  Result is an array of
  * four integers.  The first is the fraction digits.  The second is the
@@ -314,48 +402,28 @@ _findMetaData(const UChar* currency, UErrorCode& ec) {
         return LAST_RESORT_DATA;
     }
 
-    // Get CurrencyMeta resource out of root locale file.  [This may
-    // move out of the root locale file later; if it does, update this
-    // code.]
-    UResourceBundle* currencyData = ures_openDirect(U_ICUDATA_CURR, CURRENCY_DATA, &ec);
-    UResourceBundle* currencyMeta = ures_getByKey(currencyData, CURRENCY_META, currencyData, &ec);
-
+    umtx_initOnce(gCurrencyDataInitOnce, &initCurrencyData, ec);
     if (U_FAILURE(ec)) {
-        ures_close(currencyMeta);
         // Config/build error; return hard-coded defaults
         return LAST_RESORT_DATA;
     }
 
     // Look up our currency, or if that's not available, then DEFAULT
     char buf[ISO_CURRENCY_CODE_LENGTH+1];
-    UErrorCode ec2 = U_ZERO_ERROR; // local error code: soft failure
-    UResourceBundle* rb = ures_getByKey(currencyMeta, myUCharsToChars(buf, currency), NULL, &ec2);
-      if (U_FAILURE(ec2)) {
-        ures_close(rb);
-        rb = ures_getByKey(currencyMeta,DEFAULT_META, NULL, &ec);
-        if (U_FAILURE(ec)) {
-            ures_close(currencyMeta);
-            ures_close(rb);
-            // Config/build error; return hard-coded defaults
-            return LAST_RESORT_DATA;
-        }
-    }
-
-    int32_t len;
-    const int32_t *data = ures_getIntVector(rb, &len, &ec);
-    if (U_FAILURE(ec) || len != 4) {
-        // Config/build error; return hard-coded defaults
-        if (U_SUCCESS(ec)) {
-            ec = U_INVALID_FORMAT_ERROR;
+    myUCharsToChars(buf, currency);
+    int32_t start = 0, limit = gCurrencyMetaCount;
+    while (start < limit) {
+        int32_t mid = (start + limit) / 2;
+        int32_t cmp = uprv_strcmp(buf, gCurrencyMeta[mid].isoCode);
+        if (cmp == 0) {
+            return gCurrencyMeta[mid].data;
+        } else if (cmp < 0) {
+            limit = mid;
+        } else {
+            start = mid + 1;
         }
-        ures_close(currencyMeta);
-        ures_close(rb);
-        return LAST_RESORT_DATA;
     }
-
-    ures_close(currencyMeta);
-    ures_close(rb);
-    return data;
+    return gDefaultMeta;
 }
 
 // -------------------------------------
@@ -394,14 +462,10 @@ idForLocale(const char* locale, char* countryAndVariant, int capacity, UErrorCod
 
 // don't use ICUService since we don't need fallback
 
-U_CDECL_BEGIN
-static UBool U_CALLCONV currency_cleanup(void);
-U_CDECL_END
-
 #if !UCONFIG_NO_SERVICE
 struct CReg;
 
-static UMutex gCRegLock = U_MUTEX_INITIALIZER;
+static UMutex gCRegLock = U_NAMED_MUTEX_INITIALIZER("currencyRegistry");
 static CReg* gCRegHead = 0;
 
 struct CReg : public icu::UMemory {
@@ -536,6 +600,7 @@ static UBool U_CALLCONV currency_cleanup(void) {
     currency_cache_cleanup();
     isoCodes_cleanup();
     currSymbolsEquiv_cleanup();
+    currencyData_cleanup();
 
     return TRUE;
 }
@@ -597,9 +662,8 @@ ucurr_forLocale(const char* locale,
     } else {
         // Look up the CurrencyMap element in the root bundle.
         localStatus = U_ZERO_ERROR;
-        UResourceBundle *rb = ures_openDirect(U_ICUDATA_CURR, CURRENCY_DATA, &localStatus);
-        UResourceBundle *cm = ures_getByKey(rb, CURRENCY_MAP, rb, &localStatus);
-        UResourceBundle *countryArray = ures_getByKey(rb, id, cm, &localStatus);
+        umtx_initOnce(gCurrencyDataInitOnce, &initCurrencyData, localStatus);
+        UResourceBundle *countryArray = ures_getByKey(gCurrencyMap, id, NULL, &localStatus);
         UResourceBundle *currencyReq = ures_getByIndex(countryArray, 0, NULL, &localStatus);
         s = ures_getStringByKey(currencyReq, "id", &resLen, &localStatus);
 
@@ -1386,16 +1450,19 @@ typedef struct {
     // The entry is deleted when ref count is zero, which means 
     // the entry is replaced out of cache and no process is accessing it.
     int32_t refCount;
+    // value of gCacheAccessCount at the last access, for LRU replacement
+    uint32_t lastAccess;
 } CurrencyNameCacheEntry;
 
 
-#define CURRENCY_NAME_CACHE_NUM 10
+#define CURRENCY_NAME_CACHE_NUM 16
 
-// Reserve 10 cache entries.
+// Reserve 16 cache entries.
 static CurrencyNameCacheEntry* currCache[CURRENCY_NAME_CACHE_NUM] = {NULL};
-// Using an index to indicate which entry to be replaced when cache is full.
-// It is a simple round-robin replacement strategy.
-static int8_t currentCacheEntryIndex = 0;
+// Counts cache accesses. When the cache is full, the least recently used
+// entry is replaced, so that a few frequently parsed locales stay cached
+// while others come and go.
+static uint32_t gCacheAccessCount = 0;
 
 static UMutex gCurrencyCacheMutex = U_MUTEX_INITIALIZER;
 
@@ -1446,6 +1513,8 @@ getCacheEntry(const char* locale, UErrorCode& ec) {
     CurrencyNameStruct* currencySymbols = NULL;
     CurrencyNameCacheEntry* cacheEntry = NULL;
 
+    // The cache entry outlives the current memory scope.
+    icu::MemoryScopeSuspender suspender;
     umtx_lock(&gCurrencyCacheMutex);
     // in order to handle racing correctly,
     // not putting 'search' in a separate function.
@@ -1460,6 +1529,7 @@ getCacheEntry(const char* locale, UErrorCode& ec) {
     if (found != -1) {
         cacheEntry = currCache[found];
         ++(cacheEntry->refCount);
+        cacheEntry->lastAccess = ++gCacheAccessCount;
     }
     umtx_unlock(&gCurrencyCacheMutex);
     if (found == -1) {
@@ -1477,12 +1547,19 @@ getCacheEntry(const char* locale, UErrorCode& ec) {
             }
         }
         if (found == -1) {
-            // insert new entry to 
-            // currentCacheEntryIndex % CURRENCY_NAME_CACHE_NUM
-            // and remove the existing entry 
-            // currentCacheEntryIndex % CURRENCY_NAME_CACHE_NUM
-            // from cache.
-            cacheEntry = currCache[currentCacheEntryIndex];
+            // insert the new entry into an empty slot, or else replace
+            // the least recently used entry.
+            int32_t replace = 0;
+            for (int32_t i = 0; i < CURRENCY_NAME_CACHE_NUM; ++i) {
+                if (currCache[i] == NULL) {
+                    replace = i;
+                    break;
+                }
+                if (currCache[i]->lastAccess < currCache[replace]->lastAccess) {
+                    replace = i;
+                }
+            }
+            cacheEntry = currCache[replace];
             if (cacheEntry) {
                 --(cacheEntry->refCount);
                 // delete if the ref count is zero
@@ -1491,20 +1568,21 @@ getCacheEntry(const char* locale, UErrorCode& ec) {
                 }
             }
             cacheEntry = (CurrencyNameCacheEntry*)uprv_malloc(sizeof(CurrencyNameCacheEntry));
-            currCache[currentCacheEntryIndex] = cacheEntry;
+            currCache[replace] = cacheEntry;
             uprv_strcpy(cacheEntry->locale, locale);
             cacheEntry->currencyNames = currencyNames;
             cacheEntry->totalCurrencyNameCount = total_currency_name_count;
             cacheEntry->currencySymbols = currencySymbols;
             cacheEntry->totalCurrencySymbolCount = total_currency_symbol_count;
             cacheEntry->refCount = 2; // one for cache, one for reference
-            currentCacheEntryIndex = (currentCacheEntryIndex + 1) % CURRENCY_NAME_CACHE_NUM;
+            cacheEntry->lastAccess = ++gCacheAccessCount;
             ucln_common_registerCleanup(UCLN_COMMON_CURRENCY, currency_cleanup);
         } else {
             deleteCurrencyNames(currencyNames, total_currency_name_count);
             deleteCurrencyNames(currencySymbols, total_currency_symbol_count);
             cacheEntry = currCache[found];
             ++(cacheEntry->refCount);
+            cacheEntry->lastAccess = ++gCacheAccessCount;
         }
         umtx_unlock(&gCurrencyCacheMutex);
     }
@@ -36,10 +36,13 @@ might have to #include some other header
 #include "uassert.h"
 #include "ucln_cmn.h"
 #include "ucmndata.h"
+#include "ucmpdata.h"
 #include "udatamem.h"
 #include "uhash.h"
 #include "umapfile.h"
 #include "umutex.h"
+#include "ustr_imp.h"
+#include "utracimp.h"
 
 /***********************************************************************
 *
@@ -70,7 +73,7 @@ might have to #include some other header
 /* If you are excruciatingly bored turn this on .. */
 /* #define UDATA_DEBUG 1 */
 
-#if defined(UDATA_DEBUG)
+#if defined(UDATA_DEBUG) || !UCONFIG_NO_FILE_IO
 #   include <stdio.h>
 #endif
 
@@ -103,12 +106,18 @@ static UDataMemory *udata_findCachedData(const char *path, UErrorCode &err);
  * that they really need, reducing the size of binaries that take advantage
  * of this.
  */
-static UDataMemory *gCommonICUDataArray[10] = { NULL };   // Access protected by icu global mutex.
+static UDataMemory *gCommonICUDataArray[10] = { NULL };   // Changes protected by icu global mutex.
+// Number of leading non-NULL entries of gCommonICUDataArray, for reading them without the mutex.
+// Incremented with a release barrier after the entry is set.
+static u_atomic_int32_t gCommonICUDataCount = ATOMIC_INT32_T_INITIALIZER(0);
 
 static u_atomic_int32_t gHaveTriedToLoadCommonData = ATOMIC_INT32_T_INITIALIZER(0);  //  See extendICUData().
 
-static UHashtable  *gCommonDataCache = NULL;  /* Global hash table of opened ICU data files.  */
-static icu::UInitOnce gCommonDataCacheInitOnce = U_INITONCE_INITIALIZER;
+struct DataCacheTable;
+/* Global hash tables of opened ICU data files, see udata_findCachedData(). */
+static DataCacheTable *gCommonDataCacheTables[32] = { NULL };
+/* Number of gCommonDataCacheTables, the last one being current. Set with a release barrier. */
+static u_atomic_int32_t gCommonDataCacheTableCount = ATOMIC_INT32_T_INITIALIZER(0);
 
 #if U_PLATFORM_HAS_WINUWP_API == 0 
 static UDataFileAccess  gDataFileAccess = UDATA_DEFAULT_ACCESS;  // Access not synchronized.
@@ -117,21 +126,23 @@ static UDataFileAccess  gDataFileAccess = UDATA_DEFAULT_ACCESS;  // Access not s
 static UDataFileAccess  gDataFileAccess = UDATA_NO_FILES;        // Windows UWP looks in one spot explicitly
 #endif
 
+static void udata_deleteCache();
+static void udata_closeTrace();
+
 static UBool U_CALLCONV
 udata_cleanup(void)
 {
     int32_t i;
 
-    if (gCommonDataCache) {             /* Delete the cache of user data mappings.  */
-        uhash_close(gCommonDataCache);  /*   Table owns the contents, and will delete them. */
-        gCommonDataCache = NULL;        /*   Cleanup is not thread safe.                */
-    }
-    gCommonDataCacheInitOnce.reset();
+    udata_deleteCache();                /* Delete the cache of user data mappings.  */
+                                        /*   Cleanup is not thread safe.                */
+    udata_closeTrace();
 
     for (i = 0; i < UPRV_LENGTHOF(gCommonICUDataArray) && gCommonICUDataArray[i] != NULL; ++i) {
         udata_close(gCommonICUDataArray[i]);
         gCommonICUDataArray[i] = NULL;
     }
+    gCommonICUDataCount = 0;
     gHaveTriedToLoadCommonData = 0;
 
     return TRUE;                   /* Everything was cleaned up */
@@ -186,6 +197,7 @@ setCommonICUData(UDataMemory *pData,     /*  The new common data.  Belongs to ca
     for (i = 0; i < UPRV_LENGTHOF(gCommonICUDataArray); ++i) {
         if (gCommonICUDataArray[i] == NULL) {
             gCommonICUDataArray[i] = newCommonData;
+            umtx_storeRelease(gCommonICUDataCount, i + 1);
             didUpdate = TRUE;
             break;
         } else if (gCommonICUDataArray[i]->pHeader == pData->pHeader) {
@@ -264,12 +276,70 @@ typedef struct DataCacheElement {
     UDataMemory   *item;
 } DataCacheElement;
 
+/*
+ * The cache is read without locking.
+ * Elements are only added, with the global mutex held, and they are neither changed
+ * nor removed until udata_cleanup().
+ *
+ * Each table is a power-of-2 number of slots with linear probing.
+ * A slot is filled with a release barrier on its "used" flag after its element pointer.
+ * When a table would become more than half full, its elements are copied into
+ * a new table of twice the size, which is then published as the current one.
+ * Readers may still be looking at the older tables, so they are kept until udata_cleanup().
+ * A reader that misses an element that is just being added goes on to open the data
+ * and then finds the element in udata_cacheDataItem().
+ */
+typedef struct DataCacheSlot {
+    u_atomic_int32_t  used;
+    DataCacheElement *element;
+} DataCacheSlot;
+
+struct DataCacheTable {
+    int32_t       mask;                 /* number of slots - 1 */
+    int32_t       count;                /* number of elements */
+    /**
+     * Variable-length array declared with length 1 to disable bounds checkers.
+     */
+    DataCacheSlot slots[1];
+};
+
+static DataCacheTable *udata_createCacheTable(int32_t capacity) {
+    DataCacheTable *table = (DataCacheTable *)uprv_malloc(
+        sizeof(DataCacheTable) + (capacity - 1) * sizeof(DataCacheSlot));
+    if (table != NULL) {
+        uprv_memset((void *)table->slots, 0, capacity * sizeof(DataCacheSlot));
+        table->mask = capacity - 1;
+        table->count = 0;
+    }
+    return table;
+}
 
+/* Must be called with the global mutex held, and the element not in the table yet. */
+static void udata_addToCacheTable(DataCacheTable *table, DataCacheElement *element) {
+    int32_t i = ustr_hashCharsN(element->name, (int32_t)uprv_strlen(element->name)) & table->mask;
+    while (umtx_loadAcquire(table->slots[i].used)) {
+        i = (i + 1) & table->mask;
+    }
+    table->slots[i].element = element;
+    umtx_storeRelease(table->slots[i].used, 1);
+    ++table->count;
+}
+
+static DataCacheElement *udata_findInCacheTable(DataCacheTable *table, const char *name) {
+    int32_t i = ustr_hashCharsN(name, (int32_t)uprv_strlen(name)) & table->mask;
+    while (umtx_loadAcquire(table->slots[i].used)) {
+        DataCacheElement *element = table->slots[i].element;
+        if (uprv_strcmp(element->name, name) == 0) {
+            return element;
+        }
+        i = (i + 1) & table->mask;
+    }
+    return NULL;
+}
 
 /*
  * Deleter function for DataCacheElements.
- *         udata cleanup function closes the hash table; hash table in turn calls back to
- *         here for each entry.
+ *         udata cleanup function deletes the cache, which in turn calls here for each entry.
  */
 static void U_CALLCONV DataCacheElement_deleter(void *pDCEl) {
     DataCacheElement *p = (DataCacheElement *)pDCEl;
@@ -278,46 +348,54 @@ static void U_CALLCONV DataCacheElement_deleter(void *pDCEl) {
     uprv_free(pDCEl);                  /* delete 'this'          */
 }
 
-static void U_CALLCONV udata_initHashTable(UErrorCode &err) {
-    U_ASSERT(gCommonDataCache == NULL);
-    gCommonDataCache = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &err);
-    if (U_FAILURE(err)) {
-       return;
+static void udata_deleteCache() {
+    int32_t count = gCommonDataCacheTableCount;
+    if (count > 0) {
+        /* The current table has all of the elements. */
+        DataCacheTable *table = gCommonDataCacheTables[count - 1];
+        for (int32_t i = 0; i <= table->mask; ++i) {
+            if (table->slots[i].used) {
+                DataCacheElement_deleter(table->slots[i].element);
+            }
+        }
     }
-    U_ASSERT(gCommonDataCache != NULL);
-    uhash_setValueDeleter(gCommonDataCache, DataCacheElement_deleter);
-    ucln_common_registerCleanup(UCLN_COMMON_UDATA, udata_cleanup);
+    for (int32_t i = 0; i < count; ++i) {
+        uprv_free(gCommonDataCacheTables[i]);
+        gCommonDataCacheTables[i] = NULL;
+    }
+    gCommonDataCacheTableCount = 0;
 }
 
- /*   udata_getCacheHashTable()
-  *     Get the hash table used to store the data cache entries.
-  *     Lazy create it if it doesn't yet exist.
-  */
-static UHashtable *udata_getHashTable(UErrorCode &err) {
-    umtx_initOnce(gCommonDataCacheInitOnce, &udata_initHashTable, err);
-    return gCommonDataCache;
+static DataCacheTable *udata_getCurrentCacheTable() {
+    int32_t count = umtx_loadAcquire(gCommonDataCacheTableCount);
+    return count > 0 ? gCommonDataCacheTables[count - 1] : NULL;
 }
 
 
 
 static UDataMemory *udata_findCachedData(const char *path, UErrorCode &err)
 {
-    UHashtable        *htable;
+    DataCacheTable    *table;
     UDataMemory       *retVal = NULL;
     DataCacheElement  *el;
     const char        *baseName;
 
-    htable = udata_getHashTable(err);
     if (U_FAILURE(err)) {
         return NULL;
     }
+    table = udata_getCurrentCacheTable();
+    if (table == NULL) {
+        UTRACE_METRIC_INC(UTRACE_METRIC_UDATA_CACHE_MISS);
+        return NULL;
+    }
 
     baseName = findBasename(path);   /* Cache remembers only the base name, not the full path. */
-    umtx_lock(NULL);
-    el = (DataCacheElement *)uhash_get(htable, baseName);
-    umtx_unlock(NULL);
+    el = udata_findInCacheTable(table, baseName);
     if (el != NULL) {
         retVal = el->item;
+        UTRACE_METRIC_INC(UTRACE_METRIC_UDATA_CACHE_HIT);
+    } else {
+        UTRACE_METRIC_INC(UTRACE_METRIC_UDATA_CACHE_MISS);
     }
 #ifdef UDATA_DEBUG
     fprintf(stderr, "Cache: [%s] -> %p\n", baseName, retVal);
@@ -330,15 +408,16 @@ static UDataMemory *udata_cacheDataItem(const char *path, UDataMemory *item, UEr
     DataCacheElement *newElement;
     const char       *baseName;
     int32_t           nameLen;
-    UHashtable       *htable;
     DataCacheElement *oldValue = NULL;
     UErrorCode        subErr = U_ZERO_ERROR;
 
-    htable = udata_getHashTable(*pErr);
     if (U_FAILURE(*pErr)) {
         return NULL;
     }
 
+    /* The cache outlives the current memory scope. */
+    MemoryScopeSuspender suspender;
+
     /* Create a new DataCacheElement - the thingy we store in the hash table -
      * and copy the supplied path and UDataMemoryItems into it.
      */
@@ -368,18 +447,41 @@ static UDataMemory *udata_cacheDataItem(const char *path, UDataMemory *item, UEr
     /* Stick the new DataCacheElement into the hash table.
     */
     umtx_lock(NULL);
-    oldValue = (DataCacheElement *)uhash_get(htable, path);
+    int32_t tableCount = gCommonDataCacheTableCount;
+    DataCacheTable *table = tableCount > 0 ? gCommonDataCacheTables[tableCount - 1] : NULL;
+    if (table != NULL) {
+        oldValue = udata_findInCacheTable(table, baseName);
+    }
     if (oldValue != NULL) {
         subErr = U_USING_DEFAULT_WARNING;
-    }
-    else {
-        uhash_put(
-            htable,
-            newElement->name,               /* Key   */
-            newElement,                     /* Value */
-            &subErr);
+    } else if (table == NULL || 2 * (table->count + 1) > table->mask + 1) {
+        /* Publish a larger table with the old elements and the new one. */
+        DataCacheTable *newTable = NULL;
+        if (tableCount < UPRV_LENGTHOF(gCommonDataCacheTables)) {
+            newTable = udata_createCacheTable(table == NULL ? 8 : 2 * (table->mask + 1));
+        }
+        if (newTable == NULL) {
+            subErr = U_MEMORY_ALLOCATION_ERROR;
+        } else {
+            if (table != NULL) {
+                for (int32_t i = 0; i <= table->mask; ++i) {
+                    if (table->slots[i].used) {
+                        udata_addToCacheTable(newTable, table->slots[i].element);
+                    }
+                }
+            }
+            udata_addToCacheTable(newTable, newElement);
+            gCommonDataCacheTables[tableCount] = newTable;
+            umtx_storeRelease(gCommonDataCacheTableCount, tableCount + 1);
+        }
+    } else {
+        udata_addToCacheTable(table, newElement);
     }
     umtx_unlock(NULL);
+    if (tableCount == 0 && U_SUCCESS(subErr)) {
+        /* Registering takes the global mutex. */
+        ucln_common_registerCleanup(UCLN_COMMON_UDATA, udata_cleanup);
+    }
 
 #ifdef UDATA_DEBUG
     fprintf(stderr, "Cache: [%s] <<< %p : %s. vFunc=%p\n", newElement->name, 
@@ -654,6 +756,19 @@ extern const void *uprv_getICUData_collation(void) ATTRIBUTE_WEAK;
 extern const void *uprv_getICUData_conversion(void) ATTRIBUTE_WEAK;
 */
 
+/*
+ * Maps a data file into memory, like uprv_mapFile().
+ * Traced with the file path, so that data loading time can be attributed to files.
+ */
+static UBool
+udata_mapFile(UDataMemory *pData, const char *path, UErrorCode *pErrorCode) {
+    UTRACE_ENTRY_OC(UTRACE_UDATA_MAP_FILE);
+    UTRACE_DATA1(UTRACE_OPEN_CLOSE, "file %s", path);
+    UBool isMapped = uprv_mapFile(pData, path, pErrorCode);
+    UTRACE_EXIT_VALUE_STATUS((int32_t)isMapped, *pErrorCode);
+    return isMapped;
+}
+
 /*----------------------------------------------------------------------*
  *                                                                      *
  *   openCommonData   Attempt to open a common format (.dat) file       *
@@ -677,6 +792,9 @@ openCommonData(const char *path,          /*  Path from OpenChoice?          */
         return NULL;
     }
 
+    /* Common data is cached beyond the current memory scope. */
+    MemoryScopeSuspender suspender;
+
     UDataMemory_init(&tData);
 
     /* ??????? TODO revisit this */ 
@@ -685,6 +803,10 @@ openCommonData(const char *path,          /*  Path from OpenChoice?          */
         if(commonDataIndex >= UPRV_LENGTHOF(gCommonICUDataArray)) {
             return NULL;
         }
+        /* Entries are never changed once they are set, other than in udata_cleanup(). */
+        if(commonDataIndex < umtx_loadAcquire(gCommonICUDataCount)) {
+            return gCommonICUDataArray[commonDataIndex];
+        }
         {
             Mutex lock;
             if(gCommonICUDataArray[commonDataIndex] != NULL) {
@@ -764,7 +886,7 @@ openCommonData(const char *path,          /*  Path from OpenChoice?          */
 #ifdef UDATA_DEBUG
         fprintf(stderr, "ocd: trying path %s - ", pathBuffer);
 #endif
-        uprv_mapFile(&tData, pathBuffer, pErrorCode);
+        udata_mapFile(&tData, pathBuffer, pErrorCode);
 #ifdef UDATA_DEBUG
         fprintf(stderr, "%s\n", UDataMemory_isLoaded(&tData)?"LOADED":"not loaded");
 #endif
@@ -780,7 +902,7 @@ openCommonData(const char *path,          /*  Path from OpenChoice?          */
         uprv_strncpy(ourPathBuffer, path, 1019);
         ourPathBuffer[1019]=0;
         uprv_strcat(ourPathBuffer, ".dat");
-        uprv_mapFile(&tData, ourPathBuffer, pErrorCode);
+        udata_mapFile(&tData, ourPathBuffer, pErrorCode);
     }
 #endif
 
@@ -929,6 +1051,89 @@ udata_setAppData(const char *path, const void *data, UErrorCode *err)
     udata_cacheDataItem(path, &udm, err);
 }
 
+/*----------------------------------------------------------------------------*
+ *                                                                            *
+ *  udata_prefetchLocales                                                     *
+ *                                                                            *
+ *----------------------------------------------------------------------------*/
+
+/*
+ * Is the TOC entry name, like "icudt63l/coll/de_CH.res",
+ * that of a resource bundle which the given locales will use?
+ * Those are the bundles of the locales and of their truncation fallbacks,
+ * root, and the pool bundle, in any resource tree.
+ */
+static UBool
+isLocaleBundleName(const char *tocEntryName, const char *const *localeIDs, int32_t count) {
+    const char *stem=uprv_strrchr(tocEntryName, '/');
+    stem= stem==NULL ? tocEntryName : stem+1;
+    const char *suffix=uprv_strrchr(stem, '.');
+    if(suffix==NULL || uprv_strcmp(suffix, ".res")!=0) {
+        return FALSE;
+    }
+    int32_t stemLength=(int32_t)(suffix-stem);
+    if((stemLength==4 && (uprv_strncmp(stem, "root", 4)==0 || uprv_strncmp(stem, "pool", 4)==0))) {
+        return TRUE;
+    }
+    for(int32_t i=0; i<count; ++i) {
+        const char *id=localeIDs[i];
+        if(id==NULL) {
+            continue;
+        }
+        /* Keywords and the codepage do not select different bundles. */
+        int32_t length=0;
+        while(id[length]!=0 && id[length]!='@' && id[length]!='.') {
+            ++length;
+        }
+        while(length>0) {
+            if(length==stemLength && uprv_strncmp(id, stem, length)==0) {
+                return TRUE;
+            }
+            do {
+                --length;
+            } while(length>0 && id[length]!='_');
+        }
+    }
+    return FALSE;
+}
+
+U_CAPI void U_EXPORT2
+udata_prefetchLocales(const char *const *localeIDs, int32_t count, UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if(count<0 || (localeIDs==NULL && count>0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    /* Same loop over the common ICU data packages as in doLoadFromCommonData(). */
+    UBool checkedExtendedICUData = gDataFileAccess==UDATA_NO_FILES;
+    for(int32_t commonDataIndex=0;;) {
+        UErrorCode subErrorCode=U_ZERO_ERROR;
+        UDataMemory *pCommonData=openCommonData(NULL, commonDataIndex, &subErrorCode);
+        if(pCommonData!=NULL) {
+            int32_t entryCount=(int32_t)pCommonData->vFuncs->NumEntries(pCommonData);
+            for(int32_t i=0; i<entryCount; ++i) {
+                const char *name;
+                int32_t length;
+                const DataHeader *pHeader=pCommonData->vFuncs->Entry(pCommonData, i, &name, &length);
+                if(pHeader!=NULL && isLocaleBundleName(name, localeIDs, count)) {
+                    uprv_adviseMappedData(pHeader, length, UPRV_MAP_ADVICE_WILLNEED);
+                }
+            }
+            ++commonDataIndex;
+        } else if(subErrorCode==U_MEMORY_ALLOCATION_ERROR) {
+            *pErrorCode=subErrorCode;
+            return;
+        } else if(!checkedExtendedICUData && extendICUData(&subErrorCode)) {
+            checkedExtendedICUData=TRUE;
+        } else {
+            return;
+        }
+    }
+}
+
 /*----------------------------------------------------------------------------*
  *                                                                            *
  *  checkDataItem     Given a freshly located/loaded data item, either        *
@@ -1002,7 +1207,7 @@ static UDataMemory *doLoadFromIndividualFiles(const char *pkgName,
 #ifdef UDATA_DEBUG
         fprintf(stderr, "UDATA: trying individual file %s\n", pathBuffer);
 #endif
-        if (uprv_mapFile(&dataMemory, pathBuffer, pErrorCode))
+        if (udata_mapFile(&dataMemory, pathBuffer, pErrorCode))
         {
             pEntryData = checkDataItem(dataMemory.pHeader, isAcceptable, context, type, name, subErrorCode, pErrorCode);
             if (pEntryData != NULL) {
@@ -1073,16 +1278,30 @@ static UDataMemory *doLoadFromCommonData(UBool isICUData, const char * /*pkgName
             fprintf(stderr, "%s: pHeader=%p - %s\n", tocEntryName, pHeader, u_errorName(*subErrorCode));
 #endif
 
+            /* decompress an item from a compressed package, or share its cached copy */
+            void *decompressedItem = NULL;
+            if(pHeader!=NULL && ucmpdata_isCompressedItem(pHeader)) {
+                pHeader=ucmpdata_openItem(pHeader, &length, &decompressedItem, subErrorCode);
+            }
+
             if(pHeader!=NULL) {
                 pEntryData = checkDataItem(pHeader, isAcceptable, context, type, name, subErrorCode, pErrorCode);
 #ifdef UDATA_DEBUG
                 fprintf(stderr, "pEntryData=%p\n", pEntryData);
 #endif
+                if (pEntryData == NULL && decompressedItem != NULL) {
+                    ucmpdata_releaseItem(decompressedItem);
+                }
                 if (U_FAILURE(*pErrorCode)) {
                     return NULL;
                 }
                 if (pEntryData != NULL) {
                     pEntryData->length = length;
+                    pEntryData->decompressedItem = decompressedItem;
+                    if (decompressedItem == NULL && 0 < length && length <= UPRV_MAP_SMALL_ITEM_LENGTH) {
+                        /* Most of a small item will be read: Page it in with one request. */
+                        uprv_adviseMappedData(pHeader, length, UPRV_MAP_ADVICE_WILLNEED);
+                    }
                     return pEntryData;
                 }
             }
@@ -1119,6 +1338,94 @@ static UBool isTimeZoneFile(const char *name, const char *type) {
              uprv_strcmp(name, "metaZones") == 0));
 }
 
+/*----------------------------------------------------------------------------*
+ *                                                                            *
+ * Trace of the ICU data items that are used                                  *
+ *                                                                            *
+ *   If the ICU_DATA_TRACE environment variable names a file, then the name   *
+ *   of each ICU data item that is loaded, for example coll/de.res, is        *
+ *   appended to that file, once per process.  The file can be passed to      *
+ *   icupkg --keep to build a .dat package with only those items.             *
+ *                                                                            *
+ *----------------------------------------------------------------------------*/
+#if !UCONFIG_NO_FILE_IO
+
+static FILE         *gTraceFile = NULL;
+static UHashtable   *gTracedItems = NULL;   // Item names that were written to the trace file.
+static icu::UInitOnce gTraceInitOnce = U_INITONCE_INITIALIZER;
+static UMutex        gTraceMutex = U_MUTEX_INITIALIZER;
+
+static void U_CALLCONV udata_initTrace() {
+    const char *traceFileName = NULL;
+#if U_PLATFORM_HAS_WINUWP_API == 0  // Windows UWP does not support getenv
+    traceFileName = getenv("ICU_DATA_TRACE");
+#endif
+    if (traceFileName == NULL || *traceFileName == 0) {
+        return;
+    }
+    UErrorCode errorCode = U_ZERO_ERROR;
+    gTracedItems = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    uhash_setKeyDeleter(gTracedItems, uprv_free);
+    gTraceFile = fopen(traceFileName, "a");
+    if (gTraceFile == NULL) {
+        uhash_close(gTracedItems);
+        gTracedItems = NULL;
+        return;
+    }
+    ucln_common_registerCleanup(UCLN_COMMON_UDATA, udata_cleanup);
+}
+
+static void udata_closeTrace() {
+    if (gTraceFile != NULL) {
+        fclose(gTraceFile);
+        gTraceFile = NULL;
+    }
+    uhash_close(gTracedItems);
+    gTracedItems = NULL;
+    gTraceInitOnce.reset();
+}
+
+/*
+ * Records the name of a loaded ICU data item, relative to the package,
+ * and returns the item.
+ */
+static UDataMemory *udata_traceItem(UDataMemory *item, const char *itemName) {
+    if (item == NULL || itemName == NULL) {
+        return item;
+    }
+    umtx_initOnce(gTraceInitOnce, &udata_initTrace);
+    if (gTraceFile == NULL) {
+        return item;
+    }
+    Mutex lock(&gTraceMutex);
+    if (uhash_get(gTracedItems, itemName) == NULL) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        char *key = (char *)uprv_malloc(uprv_strlen(itemName) + 1);
+        if (key != NULL) {
+            uprv_strcpy(key, itemName);
+            uhash_put(gTracedItems, key, key, &errorCode);
+            if (U_SUCCESS(errorCode)) {
+                fprintf(gTraceFile, "%s\n", itemName);
+                fflush(gTraceFile);
+            }
+        }
+    }
+    return item;
+}
+
+#else
+
+static void udata_closeTrace() {}
+
+static inline UDataMemory *udata_traceItem(UDataMemory *item, const char * /*itemName*/) {
+    return item;
+}
+
+#endif  // !UCONFIG_NO_FILE_IO
+
 /*
  *  A note on the ownership of Mapped Memory
  *
@@ -1270,6 +1577,8 @@ doOpenChoice(const char *path, const char *type, const char *name,
     }
     // The +1 is for the U_FILE_SEP_CHAR that is always appended above.
     tocEntryPathSuffix = tocEntryPath.data() + tocEntrySuffixIndex + 1; /* suffix starts here */
+    /* Only ICU data items are traced, by their names relative to the package. */
+    const char *traceItemName = isICUData ? tocEntryName.data() + tocEntrySuffixIndex + 1 : NULL;
 
 #ifdef UDATA_DEBUG
     fprintf(stderr, " tocEntryName = %s\n", tocEntryName.data());
@@ -1303,7 +1612,7 @@ doOpenChoice(const char *path, const char *type, const char *name,
             retVal = doLoadFromIndividualFiles(/* pkgName.data() */ "", tzFilesDir, tocEntryPathSuffix,
                             /* path */ "", type, name, isAcceptable, context, &subErrorCode, pErrorCode);
             if((retVal != NULL) || U_FAILURE(*pErrorCode)) {
-                return retVal;
+                return udata_traceItem(retVal, traceItemName);
             }
         }
     }
@@ -1318,7 +1627,7 @@ doOpenChoice(const char *path, const char *type, const char *name,
                             pkgName.data(), dataPath, tocEntryPathSuffix, tocEntryName.data(),
                             path, type, name, isAcceptable, context, &subErrorCode, pErrorCode);
         if((retVal != NULL) || U_FAILURE(*pErrorCode)) {
-            return retVal;
+            return udata_traceItem(retVal, traceItemName);
         }
     }
 
@@ -1333,7 +1642,7 @@ doOpenChoice(const char *path, const char *type, const char *name,
             retVal = doLoadFromIndividualFiles(pkgName.data(), dataPath, tocEntryPathSuffix,
                             path, type, name, isAcceptable, context, &subErrorCode, pErrorCode);
             if((retVal != NULL) || U_FAILURE(*pErrorCode)) {
-                return retVal;
+                return udata_traceItem(retVal, traceItemName);
             }
         }
     }
@@ -1348,7 +1657,7 @@ doOpenChoice(const char *path, const char *type, const char *name,
                             pkgName.data(), dataPath, tocEntryPathSuffix, tocEntryName.data(),
                             path, type, name, isAcceptable, context, &subErrorCode, pErrorCode);
         if((retVal != NULL) || U_FAILURE(*pErrorCode)) {
-            return retVal;
+            return udata_traceItem(retVal, traceItemName);
         }
     }
     
@@ -1363,7 +1672,7 @@ doOpenChoice(const char *path, const char *type, const char *name,
                             pkgName.data(), "", tocEntryPathSuffix, tocEntryName.data(),
                             path, type, name, isAcceptable, context, &subErrorCode, pErrorCode);
         if((retVal != NULL) || U_FAILURE(*pErrorCode)) {
-            return retVal;
+            return udata_traceItem(retVal, traceItemName);
         }
     }
 
@@ -1387,6 +1696,7 @@ doOpenChoice(const char *path, const char *type, const char *name,
 U_CAPI UDataMemory * U_EXPORT2
 udata_open(const char *path, const char *type, const char *name,
            UErrorCode *pErrorCode) {
+    MemoryTagScope memoryTag(UMEM_TAG_RESOURCES);
 #ifdef UDATA_DEBUG
   fprintf(stderr, "udata_open(): Opening: %s : %s . %s\n", (path?path:"NULL"), name, type);
     fflush(stderr);
@@ -1398,7 +1708,11 @@ udata_open(const char *path, const char *type, const char *name,
         *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
         return NULL;
     } else {
-        return doOpenChoice(path, type, name, NULL, NULL, pErrorCode);
+        UTRACE_ENTRY_OC(UTRACE_UDATA_OPEN);
+        UTRACE_DATA3(UTRACE_OPEN_CLOSE, "package %s type %s name %s", path, type, name);
+        UDataMemory *pData = doOpenChoice(path, type, name, NULL, NULL, pErrorCode);
+        UTRACE_EXIT_PTR_STATUS(pData, *pErrorCode);
+        return pData;
     }
 }
 
@@ -1408,6 +1722,7 @@ U_CAPI UDataMemory * U_EXPORT2
 udata_openChoice(const char *path, const char *type, const char *name,
                  UDataMemoryIsAcceptable *isAcceptable, void *context,
                  UErrorCode *pErrorCode) {
+    MemoryTagScope memoryTag(UMEM_TAG_RESOURCES);
 #ifdef UDATA_DEBUG
   fprintf(stderr, "udata_openChoice(): Opening: %s : %s . %s\n", (path?path:"NULL"), name, type);
 #endif
@@ -1418,7 +1733,11 @@ udata_openChoice(const char *path, const char *type, const char *name,
         *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
         return NULL;
     } else {
-        return doOpenChoice(path, type, name, isAcceptable, context, pErrorCode);
+        UTRACE_ENTRY_OC(UTRACE_UDATA_OPEN);
+        UTRACE_DATA3(UTRACE_OPEN_CLOSE, "package %s type %s name %s", path, type, name);
+        UDataMemory *pData = doOpenChoice(path, type, name, isAcceptable, context, pErrorCode);
+        UTRACE_EXIT_PTR_STATUS(pData, *pErrorCode);
+        return pData;
     }
 }
 
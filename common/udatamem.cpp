@@ -23,6 +23,7 @@
 #include "cmemory.h"
 #include "unicode/udata.h"
 
+#include "ucmpdata.h"
 #include "udatamem.h"
 
 U_CFUNC void UDataMemory_init(UDataMemory *This) {
@@ -92,6 +93,9 @@ U_CAPI void U_EXPORT2
 udata_close(UDataMemory *pData) {
     if(pData!=NULL) {
         uprv_unmapFile(pData);
+        if(pData->decompressedItem!=NULL) {
+            ucmpdata_releaseItem(pData->decompressedItem);
+        }
         if(pData->heapAllocated ) {
             uprv_free(pData);
         } else {
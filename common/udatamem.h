@@ -42,6 +42,9 @@ struct UDataMemory {
                                    /*  the associated data, and additional info       */
                                    /*   beyond the mapAddr is needed to do that.      */
     int32_t           length;      /* Length of the data in bytes; -1 if unknown.     */
+    void             *decompressedItem;  /* For an item that was decompressed from   */
+                                   /*  a compressed package item, its cache entry,    */
+                                   /*  which is released when this is closed.         */
 };
 
 U_CFUNC UDataMemory *UDataMemory_createNewInstance(UErrorCode *pErr);
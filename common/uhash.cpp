@@ -854,13 +854,13 @@ uhash_tokp(void* p) {
 U_CAPI int32_t U_EXPORT2
 uhash_hashUChars(const UHashTok key) {
     const UChar *s = (const UChar *)key.pointer;
-    return s == NULL ? 0 : ustr_hashUCharsN(s, u_strlen(s));
+    return s == NULL ? 0 : ustr_fastHashUCharsN(s, u_strlen(s));
 }
 
 U_CAPI int32_t U_EXPORT2
 uhash_hashChars(const UHashTok key) {
     const char *s = (const char *)key.pointer;
-    return s == NULL ? 0 : static_cast<int32_t>(ustr_hashCharsN(s, static_cast<int32_t>(uprv_strlen(s))));
+    return s == NULL ? 0 : ustr_fastHashCharsN(s, static_cast<int32_t>(uprv_strlen(s)));
 }
 
 U_CAPI int32_t U_EXPORT2
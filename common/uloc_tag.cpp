@@ -2761,6 +2761,121 @@ uloc_forLanguageTag(const char* langtag,
 }
 
 
+/*
+ * Converts a language tag of the common form language["-" script]["-" region]
+ * without copying it and without any heap allocation.
+ * Returns FALSE if the tag has any other form, including the grandfathered and
+ * redundant tags, so that the caller falls back to ultag_parse().
+ * All of those tags either have a first subtag with fewer than 2 letters,
+ * a second subtag that is neither a script nor a region,
+ * or start with "sgn-".
+ */
+static UBool
+_forSimpleLanguageTag(const char* langtag,
+                      int32_t tagLen,
+                      char* localeID,
+                      int32_t localeIDCapacity,
+                      int32_t* parsedLength,
+                      int32_t* reslen,
+                      UErrorCode* status) {
+    const char *subtags[3];
+    int32_t subtagLens[3];
+    int32_t subtagCount = 0;
+
+    if (tagLen < 0) {
+        tagLen = (int32_t)uprv_strlen(langtag);
+    }
+    if (tagLen < MINLEN) {
+        return FALSE;
+    }
+
+    /* split into at most 3 subtags */
+    const char *p = langtag;
+    const char *limit = langtag + tagLen;
+    const char *start = p;
+    for (; p < limit; p++) {
+        if (*p == SEP) {
+            if (p == start || subtagCount == 2) {
+                return FALSE;
+            }
+            subtags[subtagCount] = start;
+            subtagLens[subtagCount++] = (int32_t)(p - start);
+            start = p + 1;
+        }
+    }
+    if (p == start) {
+        return FALSE;
+    }
+    subtags[subtagCount] = start;
+    subtagLens[subtagCount++] = (int32_t)(p - start);
+
+    const char *language = subtags[0];
+    int32_t languageLen = subtagLens[0];
+    const char *script = NULL;
+    const char *region = NULL;
+    int32_t regionLen = 0;
+    if (!_isLanguageSubtag(language, languageLen) ||
+            (languageLen == 3 && uprv_strnicmp(language, "sgn", 3) == 0)) {
+        return FALSE;
+    }
+    if (subtagCount >= 2) {
+        if (_isScriptSubtag(subtags[1], subtagLens[1])) {
+            script = subtags[1];
+            if (subtagCount == 3) {
+                if (!_isRegionSubtag(subtags[2], subtagLens[2])) {
+                    return FALSE;
+                }
+                region = subtags[2];
+                regionLen = subtagLens[2];
+            }
+        } else if (subtagCount == 2 && _isRegionSubtag(subtags[1], subtagLens[1])) {
+            region = subtags[1];
+            regionLen = subtagLens[1];
+        } else {
+            return FALSE;
+        }
+    }
+
+    int32_t len = 0;
+    int32_t i;
+    if (languageLen != LANG_UND_LEN || uprv_strnicmp(language, LANG_UND, LANG_UND_LEN) != 0) {
+        for (i = 0; i < languageLen; i++, len++) {
+            if (len < localeIDCapacity) {
+                localeID[len] = uprv_tolower(language[i]);
+            }
+        }
+    }
+    if (script != NULL) {
+        if (len < localeIDCapacity) {
+            localeID[len] = LOCALE_SEP;
+        }
+        len++;
+        /* write out the script in title case */
+        for (i = 0; i < 4; i++, len++) {
+            if (len < localeIDCapacity) {
+                localeID[len] = (i == 0) ? uprv_toupper(script[i]) : uprv_tolower(script[i]);
+            }
+        }
+    }
+    if (region != NULL) {
+        if (len < localeIDCapacity) {
+            localeID[len] = LOCALE_SEP;
+        }
+        len++;
+        for (i = 0; i < regionLen; i++, len++) {
+            if (len < localeIDCapacity) {
+                localeID[len] = uprv_toupper(region[i]);
+            }
+        }
+    }
+
+    if (parsedLength != NULL) {
+        *parsedLength = (int32_t)(p - langtag);
+    }
+    *reslen = u_terminateChars(localeID, localeIDCapacity, len, status);
+    return TRUE;
+}
+
 U_CAPI int32_t U_EXPORT2
 ulocimp_forLanguageTag(const char* langtag,
                        int32_t tagLen,
@@ -2775,6 +2890,17 @@ ulocimp_forLanguageTag(const char* langtag,
     int32_t i, n;
     UBool noRegion = TRUE;
 
+    if (U_FAILURE(*status)) {
+        if (parsedLength != NULL) {
+            *parsedLength = 0;
+        }
+        return 0;
+    }
+    if (_forSimpleLanguageTag(langtag, tagLen, localeID, localeIDCapacity,
+                              parsedLength, &reslen, status)) {
+        return reslen;
+    }
+
     lt = ultag_parse(langtag, tagLen, parsedLength, status);
     if (U_FAILURE(*status)) {
         return 0;
@@ -11,6 +11,7 @@
 #define ULOCIMP_H
 
 #include "unicode/uloc.h"
+#include "unicode/ures.h"
 
 /**
  * Create an iterator over the specified keywords list
@@ -37,6 +38,22 @@ uloc_getTableStringWithFallback(
     int32_t *pLength,
     UErrorCode *pErrorCode);
 
+/**
+ * Same as uloc_getTableStringWithFallback(), but starts the lookup in a bundle
+ * that the caller has already opened for the locale, with the same path.
+ * Callers that look up many items for one locale keep the bundle open.
+ */
+U_CAPI const UChar * U_EXPORT2
+uloc_getTableStringWithFallbackFromBundle(
+    const UResourceBundle *bundle,
+    const char *path,
+    const char *locale,
+    const char *tableKey,
+    const char *subTableKey,
+    const char *itemKey,
+    int32_t *pLength,
+    UErrorCode *pErrorCode);
+
 /*returns TRUE if a is an ID separator FALSE otherwise*/
 #define _isIDSeparator(a) (a == '_' || a == '-')
 
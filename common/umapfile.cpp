@@ -247,9 +247,11 @@
         pData->map = (char *)data + length;
         pData->pHeader=(const DataHeader *)data;
         pData->mapAddr = data;
-#if U_PLATFORM == U_PF_IPHONE
-        posix_madvise(data, length, POSIX_MADV_RANDOM);
-#endif
+        if(length>UPRV_MAP_SMALL_ITEM_LENGTH) {
+            /* A large file is normally a package of many items, only some of which are used.
+             * Small files are left to the default read-ahead. */
+            uprv_adviseMappedData(data, length, UPRV_MAP_ADVICE_RANDOM);
+        }
         return TRUE;
     }
 
@@ -265,6 +267,27 @@
         }
     }
 
+    U_CFUNC void
+    uprv_adviseMappedData(const void *start, int32_t length, UMapAdvice advice) {
+#if defined(POSIX_MADV_RANDOM) && defined(POSIX_MADV_WILLNEED)
+        if(start==NULL || length<=0) {
+            return;
+        }
+        /* posix_madvise() requires a page-aligned address. */
+        long pageSize=sysconf(_SC_PAGESIZE);
+        if(pageSize<=0) {
+            return;
+        }
+        size_t offset=(size_t)((uintptr_t)start%(uintptr_t)pageSize);
+        posix_madvise((char *)start-offset, (size_t)length+offset,
+                      advice==UPRV_MAP_ADVICE_WILLNEED ? POSIX_MADV_WILLNEED : POSIX_MADV_RANDOM);
+#else
+        (void)start;
+        (void)length;
+        (void)advice;
+#endif
+    }
+
 
 
 #elif MAP_IMPLEMENTATION==MAP_STDIO
@@ -526,3 +549,10 @@
 #else
 #   error MAP_IMPLEMENTATION is set incorrectly
 #endif
+
+#if MAP_IMPLEMENTATION!=MAP_POSIX
+    U_CFUNC void
+    uprv_adviseMappedData(const void * /*start*/, int32_t /*length*/, UMapAdvice /*advice*/) {
+        /* No access advice for this mapping implementation. */
+    }
+#endif
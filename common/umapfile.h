@@ -32,6 +32,28 @@
 U_CFUNC UBool uprv_mapFile(UDataMemory *pdm, const char *path, UErrorCode *status);
 U_CFUNC void  uprv_unmapFile(UDataMemory *pData);
 
+/**
+ * Items of mapped data up to this many bytes are expected to be read mostly in full
+ * when they are used. Larger ones, like packages or large collation or converter tables,
+ * are expected to be read only in parts.
+ */
+#define UPRV_MAP_SMALL_ITEM_LENGTH 0x10000
+
+/** Access advice for uprv_adviseMappedData(). */
+typedef enum UMapAdvice {
+    /** The pages will be read in no particular order: Do not read ahead. */
+    UPRV_MAP_ADVICE_RANDOM,
+    /** The pages will be read soon: Start reading them in. */
+    UPRV_MAP_ADVICE_WILLNEED
+} UMapAdvice;
+
+/**
+ * Tells the operating system how the length bytes at start, normally part of
+ * data mapped by uprv_mapFile(), are going to be read.
+ * This is only a hint. It has no effect where the platform does not support it.
+ */
+U_CFUNC void  uprv_adviseMappedData(const void *start, int32_t length, UMapAdvice advice);
+
 /* MAP_NONE: no memory mapping, no file access at all */
 #define MAP_NONE        0
 #define MAP_WIN32       1
@@ -23,12 +23,53 @@
 #include "umutex.h"
 
 #include "unicode/utypes.h"
+#include "unicode/utrace.h"
 #include "uassert.h"
 #include "cmemory.h"
+#include "utracimp.h"
+
+#if U_ENABLE_TRACING
+#include <chrono>
+
+// Clock for UTRACE_METRIC_MUTEX_WAIT_NANOS.
+// umtx_lock() reads it only after a failed try-lock,
+// so that uncontended locks stay as cheap as without metrics.
+static inline int64_t mutexWaitClock() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+#if U_MUTEX_HAS_STATS
+#include <mutex>
+
+// The mutexes that were locked at least once, newest first, for utrace_getMutexStats().
+// Items are only ever prepended, and all UMutex objects are static,
+// so the list can be traversed after reading its head.
+static UMutex *gMutexStatsList = NULL;
+// Protects gMutexStatsList. Not a UMutex, which would record statistics about itself.
+static std::mutex gMutexStatsListLock;
+
+// Called by umtx_lock() while holding the mutex.
+static void umtx_recordLock(UMutex *mutex, UBool contended, int64_t waitNanos) {
+    UMutexStats &stats = mutex->fStats;
+    ++stats.fAcquisitions;
+    if (contended) {
+        ++stats.fContentions;
+        stats.fWaitNanos += waitNanos;
+    }
+    if (!stats.fListed) {
+        stats.fListed = TRUE;
+        std::lock_guard<std::mutex> guard(gMutexStatsListLock);
+        stats.fNext = gMutexStatsList;
+        gMutexStatsList = mutex;
+    }
+}
+#endif
 
 
 // The ICU global mutex. Used when ICU implementation code passes NULL for the mutex pointer.
-static UMutex   globalMutex = U_MUTEX_INITIALIZER;
+static UMutex   globalMutex = U_NAMED_MUTEX_INITIALIZER("global");
 
 /*
  * ICU Mutex wrappers.  Wrap operating system mutexes, giving the rest of ICU a
@@ -67,6 +108,8 @@ U_COMMON_API UBool U_EXPORT2 umtx_initImplPreInit(UInitOnce &uio) {
             0);           //  Compare value
 
         if (previousState == 0) {
+            // Objects from init functions usually live until u_cleanup().
+            uprv_suspendMemoryScopes();
             return true;   // Caller will next call the init function.
                            // Current state == 1.
         } else if (previousState == 2) {
@@ -89,6 +132,7 @@ U_COMMON_API UBool U_EXPORT2 umtx_initImplPreInit(UInitOnce &uio) {
 // just after completing the function.
 
 U_COMMON_API void U_EXPORT2 umtx_initImplPostInit(UInitOnce &uio) {
+    uprv_resumeMemoryScopes();
     umtx_storeRelease(uio.fState, 2);
 }
 
@@ -106,7 +150,20 @@ umtx_lock(UMutex *mutex) {
     }
     CRITICAL_SECTION *cs = &mutex->fCS;
     umtx_initOnce(mutex->fInitOnce, winMutexInit, cs);
+#if U_ENABLE_TRACING
+    if (TryEnterCriticalSection(cs)) {
+        umtx_recordLock(mutex, FALSE, 0);
+        return;
+    }
+    int64_t start = mutexWaitClock();
     EnterCriticalSection(cs);
+    int64_t waitNanos = mutexWaitClock() - start;
+    UTRACE_METRIC_INC(UTRACE_METRIC_MUTEX_WAIT_COUNT);
+    UTRACE_METRIC_ADD(UTRACE_METRIC_MUTEX_WAIT_NANOS, waitNanos);
+    umtx_recordLock(mutex, TRUE, waitNanos);
+#else
+    EnterCriticalSection(cs);
+#endif
 }
 
 U_CAPI void  U_EXPORT2
@@ -118,6 +175,18 @@ umtx_unlock(UMutex* mutex)
     LeaveCriticalSection(&mutex->fCS);
 }
 
+#if U_MUTEX_HAS_STATS
+// Locks a mutex for reading its statistics, without recording statistics.
+// The mutex was locked before, so its CRITICAL_SECTION is initialized.
+static void umtx_lockForStats(UMutex *mutex) {
+    EnterCriticalSection(&mutex->fCS);
+}
+
+static void umtx_unlockForStats(UMutex *mutex) {
+    LeaveCriticalSection(&mutex->fCS);
+}
+#endif
+
 
 U_CAPI void U_EXPORT2
 umtx_condBroadcast(UConditionVar *condition) {
@@ -194,9 +263,22 @@ umtx_lock(UMutex *mutex) {
     if (mutex == NULL) {
         mutex = &globalMutex;
     }
+#if U_ENABLE_TRACING
+    if (pthread_mutex_trylock(&mutex->fMutex) == 0) {
+        umtx_recordLock(mutex, FALSE, 0);
+        return;
+    }
+    int64_t start = mutexWaitClock();
+#endif
     int sysErr = pthread_mutex_lock(&mutex->fMutex);
     (void)sysErr;   // Suppress unused variable warnings.
     U_ASSERT(sysErr == 0);
+#if U_ENABLE_TRACING
+    int64_t waitNanos = mutexWaitClock() - start;
+    UTRACE_METRIC_INC(UTRACE_METRIC_MUTEX_WAIT_COUNT);
+    UTRACE_METRIC_ADD(UTRACE_METRIC_MUTEX_WAIT_NANOS, waitNanos);
+    umtx_recordLock(mutex, TRUE, waitNanos);
+#endif
 }
 
 
@@ -211,6 +293,17 @@ umtx_unlock(UMutex* mutex)
     U_ASSERT(sysErr == 0);
 }
 
+#if U_MUTEX_HAS_STATS
+// Locks a mutex for reading its statistics, without recording statistics.
+static void umtx_lockForStats(UMutex *mutex) {
+    pthread_mutex_lock(&mutex->fMutex);
+}
+
+static void umtx_unlockForStats(UMutex *mutex) {
+    pthread_mutex_unlock(&mutex->fMutex);
+}
+#endif
+
 
 U_CAPI void U_EXPORT2
 umtx_condWait(UConditionVar *cond, UMutex *mutex) {
@@ -259,6 +352,8 @@ umtx_initImplPreInit(UInitOnce &uio) {
     if (state == 0) {
         umtx_storeRelease(uio.fState, 1);
         pthread_mutex_unlock(&initMutex);
+        // Objects from init functions usually live until u_cleanup().
+        uprv_suspendMemoryScopes();
         return TRUE;   // Caller will next call the init function.
     } else {
         while (uio.fState == 1) {
@@ -282,6 +377,7 @@ umtx_initImplPreInit(UInitOnce &uio) {
 
 U_COMMON_API void U_EXPORT2
 umtx_initImplPostInit(UInitOnce &uio) {
+    uprv_resumeMemoryScopes();
     pthread_mutex_lock(&initMutex);
     umtx_storeRelease(uio.fState, 2);
     pthread_cond_broadcast(&initCondition);
@@ -299,6 +395,64 @@ U_NAMESPACE_END
 #endif  // Platform #define chain.
 
 
+//-------------------------------------------------------------------------------
+//
+//   Mutex statistics, platform neutral.
+//
+//-------------------------------------------------------------------------------
+
+U_CAPI int32_t U_EXPORT2
+utrace_getMutexStats(UTraceMutexStats *stats, int32_t capacity, UErrorCode *status) {
+    if (status == NULL || U_FAILURE(*status)) {
+        return 0;
+    }
+    if (capacity < 0 || (stats == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t count = 0;
+#if U_MUTEX_HAS_STATS
+    UMutex *mutex;
+    {
+        std::lock_guard<std::mutex> guard(gMutexStatsListLock);
+        mutex = gMutexStatsList;
+    }
+    // Do not hold gMutexStatsListLock while locking the mutexes:
+    // umtx_recordLock() takes the locks in the opposite order.
+    for (; mutex != NULL; mutex = mutex->fStats.fNext, ++count) {
+        if (count < capacity) {
+            UTraceMutexStats &dest = stats[count];
+            umtx_lockForStats(mutex);
+            dest.name = mutex->fStats.fName;
+            dest.acquisitions = mutex->fStats.fAcquisitions;
+            dest.contentions = mutex->fStats.fContentions;
+            dest.waitNanos = mutex->fStats.fWaitNanos;
+            umtx_unlockForStats(mutex);
+        }
+    }
+#endif
+    return count;
+}
+
+U_CAPI void U_EXPORT2
+utrace_resetMutexStats() {
+#if U_MUTEX_HAS_STATS
+    UMutex *mutex;
+    {
+        std::lock_guard<std::mutex> guard(gMutexStatsListLock);
+        mutex = gMutexStatsList;
+    }
+    for (; mutex != NULL; mutex = mutex->fStats.fNext) {
+        umtx_lockForStats(mutex);
+        mutex->fStats.fAcquisitions = 0;
+        mutex->fStats.fContentions = 0;
+        mutex->fStats.fWaitNanos = 0;
+        umtx_unlockForStats(mutex);
+    }
+#endif
+}
+
+
 //-------------------------------------------------------------------------------
 //
 //   Atomic Operations, out-of-line versions.
@@ -333,6 +487,15 @@ umtx_atomic_dec(u_atomic_int32_t *p) {
     return retVal;
 }
 
+U_COMMON_API int32_t U_EXPORT2
+umtx_atomic_add(u_atomic_int32_t *p, int32_t delta) {
+    int32_t retVal;
+    umtx_lock(&gIncDecMutex);
+    retVal = (*p += delta);
+    umtx_unlock(&gIncDecMutex);
+    return retVal;
+}
+
 U_COMMON_API int32_t U_EXPORT2
 umtx_loadAcquire(u_atomic_int32_t &var) {
     umtx_lock(&gIncDecMutex);
@@ -81,6 +81,10 @@ inline int32_t umtx_atomic_inc(u_atomic_int32_t *var) {
 inline int32_t umtx_atomic_dec(u_atomic_int32_t *var) {
     return var->fetch_sub(1) - 1;
 }
+
+inline int32_t umtx_atomic_add(u_atomic_int32_t *var, int32_t delta) {
+    return var->fetch_add(delta) + delta;
+}
 U_NAMESPACE_END
 
 #elif U_PLATFORM_HAS_WIN32_API
@@ -126,6 +130,10 @@ inline int32_t umtx_atomic_inc(u_atomic_int32_t *var) {
 inline int32_t umtx_atomic_dec(u_atomic_int32_t *var) {
     return InterlockedDecrement(var);
 }
+
+inline int32_t umtx_atomic_add(u_atomic_int32_t *var, int32_t delta) {
+    return InterlockedExchangeAdd(var, delta) + delta;
+}
 U_NAMESPACE_END
 
 
@@ -153,6 +161,10 @@ inline int32_t umtx_atomic_inc(u_atomic_int32_t *var) {
 inline int32_t umtx_atomic_dec(u_atomic_int32_t *var) {
     return __c11_atomic_fetch_sub(var, 1, __ATOMIC_SEQ_CST) - 1;
 }
+
+inline int32_t umtx_atomic_add(u_atomic_int32_t *var, int32_t delta) {
+    return __c11_atomic_fetch_add(var, delta, __ATOMIC_SEQ_CST) + delta;
+}
 U_NAMESPACE_END
 
 
@@ -183,6 +195,10 @@ inline int32_t umtx_atomic_inc(u_atomic_int32_t *p)  {
 inline int32_t umtx_atomic_dec(u_atomic_int32_t *p)  {
    return __sync_sub_and_fetch(p, 1);
 }
+
+inline int32_t umtx_atomic_add(u_atomic_int32_t *p, int32_t delta)  {
+   return __sync_add_and_fetch(p, delta);
+}
 U_NAMESPACE_END
 
 #else
@@ -210,6 +226,9 @@ umtx_atomic_inc(u_atomic_int32_t *p);
 U_COMMON_API int32_t U_EXPORT2 
 umtx_atomic_dec(u_atomic_int32_t *p);
 
+U_COMMON_API int32_t U_EXPORT2 
+umtx_atomic_add(u_atomic_int32_t *p, int32_t delta);
+
 U_NAMESPACE_END
 
 #endif  /* Low Level Atomic Ops Platform Chain */
@@ -325,6 +344,26 @@ U_NAMESPACE_END
  *
  *************************************************************************************************/
 
+#if U_ENABLE_TRACING && !defined(U_USER_MUTEX_H)
+/*
+ * Lock statistics of one UMutex, read by utrace_getMutexStats().
+ * The counters are modified only while holding the mutex.
+ */
+struct UMutexStats {
+    const char *fName;        // from U_NAMED_MUTEX_INITIALIZER, or NULL
+    int64_t     fAcquisitions;
+    int64_t     fContentions; // acquisitions that had to wait for another thread
+    int64_t     fWaitNanos;
+    UMutex     *fNext;        // list of the mutexes that were locked at least once
+    UBool       fListed;
+};
+#define U_MUTEX_HAS_STATS 1
+#define U_MUTEX_STATS_INITIALIZER(name) , {name, 0, 0, 0, NULL, FALSE}
+#else
+#define U_MUTEX_HAS_STATS 0
+#define U_MUTEX_STATS_INITIALIZER(name)
+#endif
+
 #if defined(U_USER_MUTEX_H)
 // #include "U_USER_MUTEX_H"
 #include U_MUTEX_XSTR(U_USER_MUTEX_H)
@@ -357,12 +396,16 @@ U_NAMESPACE_END
 typedef struct UMutex {
     icu::UInitOnce    fInitOnce;
     CRITICAL_SECTION  fCS;
+#if U_MUTEX_HAS_STATS
+    UMutexStats       fStats;
+#endif
 } UMutex;
 
 /* Initializer for a static UMUTEX. Deliberately contains no value for the
  *  CRITICAL_SECTION.
  */
 #define U_MUTEX_INITIALIZER {U_INITONCE_INITIALIZER}
+#define U_NAMED_MUTEX_INITIALIZER(name) {U_INITONCE_INITIALIZER, {} U_MUTEX_STATS_INITIALIZER(name)}
 
 struct UConditionVar {
     HANDLE           fEntryGate;
@@ -384,9 +427,13 @@ struct UConditionVar {
 
 struct UMutex {
     pthread_mutex_t  fMutex;
+#if U_MUTEX_HAS_STATS
+    UMutexStats      fStats;
+#endif
 };
 typedef struct UMutex UMutex;
 #define U_MUTEX_INITIALIZER  {PTHREAD_MUTEX_INITIALIZER}
+#define U_NAMED_MUTEX_INITIALIZER(name) {PTHREAD_MUTEX_INITIALIZER U_MUTEX_STATS_INITIALIZER(name)}
 
 struct UConditionVar {
     pthread_cond_t   fCondition;
@@ -404,6 +451,15 @@ struct UConditionVar {
 
 #endif
 
+/*
+ * Initializer for a static UMutex with a name for utrace_getMutexStats(),
+ * for example U_NAMED_MUTEX_INITIALIZER("resbMutex").
+ * The name must be a string literal. Without tracing, it is the same as U_MUTEX_INITIALIZER.
+ */
+#ifndef U_NAMED_MUTEX_INITIALIZER
+#define U_NAMED_MUTEX_INITIALIZER(name) U_MUTEX_INITIALIZER
+#endif
+
 
 
 /**************************************************************************************
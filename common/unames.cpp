@@ -162,6 +162,8 @@ static const char * const charCatNames[U_CHAR_EXTENDED_CATEGORY_COUNT] = {
 
 /* implementation ----------------------------------------------------------- */
 
+static void freeNameIndexes();
+
 static UBool U_CALLCONV unames_cleanup(void)
 {
     if(uCharNamesData) {
@@ -171,6 +173,7 @@ static UBool U_CALLCONV unames_cleanup(void)
     if(uCharNames) {
         uCharNames = NULL;
     }
+    freeNameIndexes();
     gCharNamesInitOnce.reset();
     gMaxNameLength=0;
     return TRUE;
@@ -769,6 +772,125 @@ enumNames(UCharNames *names,
     return TRUE;
 }
 
+/*
+ * Hashed index from names to code points, one per UCharNameChoice.
+ * u_charFromName() would otherwise expand and compare the name strings
+ * of all groups for each lookup.
+ * unames.icu does not contain such an index, so it is built lazily from the
+ * group strings on the first lookup with each name choice.
+ *
+ * Each entry is (code+1)|(hash tag<<21), or 0 if empty.
+ * The tag is taken from the high bits of the hash and rejects most
+ * colliding entries without expanding their names.
+ * Lookups use open addressing with linear probing.
+ */
+#define NAME_INDEX_CODE_MASK 0x1fffff
+#define NAME_INDEX_TAG_SHIFT 21
+
+typedef struct {
+    uint32_t *entries;
+    uint32_t mask;
+} NameIndex;
+
+static NameIndex gNameIndexes[U_CHAR_NAME_CHOICE_COUNT]={ { NULL, 0 } };
+static icu::UInitOnce gNameIndexInitOnce[U_CHAR_NAME_CHOICE_COUNT]={
+    U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER,
+    U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER
+};
+
+static inline uint32_t
+hashName(const char *s, int32_t length) {
+    /* FNV-1a */
+    uint32_t hash=0x811c9dc5;
+    while(length>0) {
+        hash=(hash^(uint8_t)*s++)*0x01000193;
+        --length;
+    }
+    return hash;
+}
+
+static void
+freeNameIndexes() {
+    for(int32_t i=0; i<U_CHAR_NAME_CHOICE_COUNT; ++i) {
+        uprv_free(gNameIndexes[i].entries);
+        gNameIndexes[i].entries=NULL;
+        gNameIndexes[i].mask=0;
+        gNameIndexInitOnce[i].reset();
+    }
+}
+
+static void U_CALLCONV
+buildNameIndex(UCharNameChoice nameChoice) {
+    const uint16_t *groups=GET_GROUPS(uCharNames);
+    uint16_t groupCount=*groups++;
+    const uint16_t *group, *groupLimit=groups+groupCount*GROUP_LENGTH;
+    uint16_t offsets[LINES_PER_GROUP+2], lengths[LINES_PER_GROUP+2];
+    char buffer[200];
+
+    /* size the table for a load factor of at most 3/4 */
+    uint32_t capacity=1024;
+    while(capacity*3<(uint32_t)groupCount*LINES_PER_GROUP*4) {
+        capacity<<=1;
+    }
+    uint32_t *entries=(uint32_t *)uprv_malloc(capacity*4);
+    if(entries==NULL) {
+        /* u_charFromName() falls back to enumerating the names */
+        return;
+    }
+    uprv_memset(entries, 0, capacity*4);
+
+    for(group=groups; group<groupLimit; group=NEXT_GROUP(group)) {
+        const uint8_t *s=(uint8_t *)uCharNames+uCharNames->groupStringOffset+GET_GROUP_OFFSET(group);
+        UChar32 start=(UChar32)group[GROUP_MSB]<<GROUP_SHIFT;
+        s=expandGroupLengths(s, offsets, lengths);
+        for(int32_t line=0; line<LINES_PER_GROUP; ++line) {
+            uint16_t length=expandName(uCharNames, s+offsets[line], lengths[line], nameChoice,
+                                       buffer, sizeof(buffer));
+            if(length==0 || length>=sizeof(buffer)) {
+                continue;
+            }
+            uint32_t hash=hashName(buffer, length);
+            uint32_t i=hash&(capacity-1);
+            while(entries[i]!=0) {
+                i=(i+1)&(capacity-1);
+            }
+            entries[i]=(uint32_t)(start+line+1)|(hash>>NAME_INDEX_TAG_SHIFT)<<NAME_INDEX_TAG_SHIFT;
+        }
+    }
+    gNameIndexes[nameChoice].entries=entries;
+    gNameIndexes[nameChoice].mask=capacity-1;
+}
+
+/*
+ * Looks up an uppercase name in the index.
+ * Returns FALSE if there is no index, and then *pCode is not set.
+ * Otherwise *pCode is the code point, or 0xffff if the name is not found.
+ */
+static UBool
+findNameInIndex(UCharNameChoice nameChoice, const char *upper, int32_t length, UChar32 *pCode) {
+    umtx_initOnce(gNameIndexInitOnce[nameChoice], &buildNameIndex, nameChoice);
+    const NameIndex &index=gNameIndexes[nameChoice];
+    if(index.entries==NULL) {
+        return FALSE;
+    }
+    char buffer[200];
+    uint32_t hash=hashName(upper, length);
+    uint32_t tag=hash>>NAME_INDEX_TAG_SHIFT;
+    uint32_t entry;
+    for(uint32_t i=hash&index.mask; (entry=index.entries[i])!=0; i=(i+1)&index.mask) {
+        if((entry>>NAME_INDEX_TAG_SHIFT)==tag) {
+            UChar32 code=(UChar32)(entry&NAME_INDEX_CODE_MASK)-1;
+            if(getName(uCharNames, (uint32_t)code, nameChoice, buffer, sizeof(buffer))==length &&
+                    uprv_memcmp(buffer, upper, length)==0) {
+                *pCode=code;
+                return TRUE;
+            }
+        }
+    }
+    *pCode=0xffff;
+    return TRUE;
+}
+
 static uint16_t
 writeFactorSuffix(const uint16_t *factors, uint16_t count,
                   const char *s, /* suffix elements */
@@ -1615,6 +1737,12 @@ u_charFromName(UCharNameChoice nameChoice,
     }
 
     /* normal character name */
+    if(findNameInIndex(nameChoice, upper, (int32_t)uprv_strlen(upper), &cp)) {
+        if(cp==error) {
+            *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+        }
+        return cp;
+    }
     findName.otherName=upper;
     findName.code=error;
     enumNames(uCharNames, 0, UCHAR_MAX_VALUE + 1, DO_FIND_NAME, &findName, nameChoice);
@@ -585,6 +585,34 @@ class U_COMMON_API BreakIterator : public UObject {
      *  @internal
      */
     const char *getLocaleID(ULocDataLocaleType type, UErrorCode& status) const;
+
+    /**
+     * Creates a break iterator of the given kind for the locale, like
+     * createWordInstance() etc., but reuses the iterator that was most recently
+     * passed to releaseInstance() for the same locale and kind, if there is one.
+     * This is for callers that use a temporary iterator for each call,
+     * such as titlecasing.
+     * The text of a reused iterator must be set before it is used.
+     * @param where   the locale
+     * @param kind    the kind of iterator
+     * @param status  error code for the operation
+     * @return a new or reused break iterator, owned by the caller
+     * @internal
+     */
+    static BreakIterator* U_EXPORT2 acquireInstance(const Locale& where, UBreakIteratorType kind,
+                                                    UErrorCode& status);
+
+    /**
+     * Adopts an iterator that acquireInstance() returned for this locale and kind,
+     * and keeps it for reuse by a later acquireInstance() call.
+     * Another iterator that was kept before is deleted.
+     * @param iter    the iterator to adopt; can be NULL
+     * @param where   the locale that was passed to acquireInstance()
+     * @param kind    the kind that was passed to acquireInstance()
+     * @internal
+     */
+    static void U_EXPORT2 releaseInstance(BreakIterator* iter, const Locale& where,
+                                          UBreakIteratorType kind);
 #endif  /* U_HIDE_INTERNAL_API */
 
     /**
@@ -618,9 +646,11 @@ class U_COMMON_API BreakIterator : public UObject {
     static BreakIterator* buildInstance(const Locale& loc, const char *type, UErrorCode& status);
     static BreakIterator* createInstance(const Locale& loc, int32_t kind, UErrorCode& status);
     static BreakIterator* makeInstance(const Locale& loc, int32_t kind, UErrorCode& status);
+    static BreakIterator* makeUncachedInstance(const Locale& loc, int32_t kind, UErrorCode& status);
 
     friend class ICUBreakIteratorFactory;
     friend class ICUBreakIteratorService;
+    friend class BreakIteratorCacheKey;
 
 protected:
     // Do not enclose protected default/copy constructors with #ifndef U_HIDE_INTERNAL_API
@@ -194,7 +194,7 @@ class U_COMMON_API BytesTrie : public UMemory {
      * @return The match/value Result.
      * @stable ICU 4.8
      */
-    UStringTrieResult next(const char *s, size_t length);
+    UStringTrieResult next(const char *s, int32_t length);
 
     /**
      * Returns a matching byte sequence's value if called immediately after
@@ -81,6 +81,21 @@ class U_COMMON_API CanonicalIterator U_FINAL : public UObject {
      */
     CanonicalIterator(const UnicodeString &source, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Construct a CanonicalIterator object that returns at most maxCount
+     * of the strings that are canonically equivalent to source.
+     * The first string is the NFD form of source.
+     * Unlike the number of all equivalent strings, which grows exponentially
+     * with the number of combining marks, the work is then bounded by maxCount.
+     * @param source    string to get results for
+     * @param maxCount  the maximum number of strings to return; must be positive
+     * @param status    Fill-in parameter which receives the status of this operation.
+     * @draft ICU 64
+     */
+    CanonicalIterator(const UnicodeString &source, int32_t maxCount, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
     /** Destructor
      *  Cleans pieces
      * @stable ICU 2.4
@@ -118,6 +133,19 @@ class U_COMMON_API CanonicalIterator U_FINAL : public UObject {
      */
     void setSource(const UnicodeString &newSource, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Set a new source for this iterator, and return at most maxCount
+     * of the strings that are canonically equivalent to it.
+     * The first string is the NFD form of newSource.
+     * @param newSource     the source string to iterate against.
+     * @param maxCount      the maximum number of strings to return; must be positive
+     * @param status        Fill-in parameter which receives the status of this operation.
+     * @draft ICU 64
+     */
+    void setSource(const UnicodeString &newSource, int32_t maxCount, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
     /**
      * Dumb recursive implementation of permutation.
@@ -177,6 +205,10 @@ class U_COMMON_API CanonicalIterator U_FINAL : public UObject {
     int32_t *current;
     int32_t current_length;
 
+    // the maximum number of strings to return, and the number returned so far
+    int32_t max_count;
+    int32_t returned_count;
+
     // transient fields
     UnicodeString buffer;
 
@@ -117,7 +117,8 @@ class U_COMMON_API CaseMap U_FINAL : public UMemory {
      * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT, U_EDITS_NO_RESET,
      *                  U_TITLECASE_NO_LOWERCASE,
      *                  U_TITLECASE_NO_BREAK_ADJUSTMENT, U_TITLECASE_ADJUST_TO_CASED,
-     *                  U_TITLECASE_WHOLE_STRING, U_TITLECASE_SENTENCES.
+     *                  U_TITLECASE_WHOLE_STRING, U_TITLECASE_SENTENCES,
+     *                  U_TITLECASE_WHITE_SPACE_WORDS.
      * @param iter      A break iterator to find the first characters of words that are to be titlecased.
      *                  It is set to the source string (setText())
      *                  and used one or more times for iteration (first() and next()).
@@ -261,7 +262,8 @@ class U_COMMON_API CaseMap U_FINAL : public UMemory {
      * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT, U_EDITS_NO_RESET,
      *                  U_TITLECASE_NO_LOWERCASE,
      *                  U_TITLECASE_NO_BREAK_ADJUSTMENT, U_TITLECASE_ADJUST_TO_CASED,
-     *                  U_TITLECASE_WHOLE_STRING, U_TITLECASE_SENTENCES.
+     *                  U_TITLECASE_WHOLE_STRING, U_TITLECASE_SENTENCES,
+     *                  U_TITLECASE_WHITE_SPACE_WORDS.
      * @param iter      A break iterator to find the first characters of words that are to be titlecased.
      *                  It is set to the source string (setUText())
      *                  and used one or more times for iteration (first() and next()).
@@ -405,7 +407,8 @@ class U_COMMON_API CaseMap U_FINAL : public UMemory {
      * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT, U_EDITS_NO_RESET,
      *                  U_TITLECASE_NO_LOWERCASE,
      *                  U_TITLECASE_NO_BREAK_ADJUSTMENT, U_TITLECASE_ADJUST_TO_CASED,
-     *                  U_TITLECASE_WHOLE_STRING, U_TITLECASE_SENTENCES.
+     *                  U_TITLECASE_WHOLE_STRING, U_TITLECASE_SENTENCES,
+     *                  U_TITLECASE_WHITE_SPACE_WORDS.
      * @param iter      A break iterator to find the first characters of words that are to be titlecased.
      *                  It is set to the source string (setUText())
      *                  and used one or more times for iteration (first() and next()).
@@ -0,0 +1,397 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// codepointtrie.h
+// created: 2026oct14
+
+#ifndef __CODEPOINTTRIE_H__
+#define __CODEPOINTTRIE_H__
+
+#include "unicode/utypes.h"
+
+#if U_SHOW_CPLUSPLUS_API
+
+#include "unicode/ucpmap.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
+#include "unicode/uobject.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+
+/**
+ * \file
+ * \brief C++ API: Immutable and mutable Unicode code point tries.
+ *
+ * C++ wrappers for UCPTrie and UMutableCPTrie.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Immutable Unicode code point trie.
+ * Fast, reasonably compact, map from Unicode code points (U+0000..U+10FFFF) to integer values.
+ * Owns and wraps a UCPTrie; see there for details.
+ *
+ * A CodePointTrie is built with a MutableCodePointTrie,
+ * or opened from the memory-mappable form written by toBinary().
+ * The inline get(), nextU16() and nextU8() functions use the UCPTrie macros
+ * for the trie type and value width.
+ * If the type and width are known at compile time,
+ * then the UCPTRIE_FAST_... macros can be used directly on toUCPTrie().
+ *
+ * A CodePointTrie is thread-safe:
+ * Any number of threads may call its const functions at the same time.
+ *
+ * \code
+ * MutableCodePointTrie mutableTrie(0, 0xff, errorCode);
+ * mutableTrie.setRange(0x41, 0x5a, 1, errorCode);  // A-Z
+ * mutableTrie.setRange(0x61, 0x7a, 2, errorCode);  // a-z
+ * LocalPointer<CodePointTrie> trie(
+ *     mutableTrie.buildImmutable(UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_8, errorCode));
+ * const char16_t *p = s, *limit = s + length;
+ * UChar32 c;
+ * while (p < limit) {
+ *     uint32_t category = trie->nextU16(p, limit, c);
+ *     ...
+ * }
+ * \endcode
+ *
+ * @draft ICU 64
+ */
+class U_COMMON_API CodePointTrie : public UMemory {
+public:
+    /**
+     * Opens a trie from its binary form, stored in 32-bit-aligned memory.
+     * Inverse of toBinary().
+     * The memory must remain valid and unchanged as long as the trie is used.
+     *
+     * @param type selects the trie type, or UCPTRIE_TYPE_ANY; see ucptrie_openFromBinary()
+     * @param valueWidth selects the number of bits in a data value, or UCPTRIE_VALUE_BITS_ANY
+     * @param data a pointer to 32-bit-aligned memory containing the binary data of a trie
+     * @param length the number of bytes available at data; can be more than necessary
+     * @param pActualLength receives the actual number of bytes at data taken up by the trie data;
+     *                      can be NULL
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @return the trie, owned by the caller; NULL if an error occurred
+     * @see ucptrie_openFromBinary
+     * @draft ICU 64
+     */
+    static CodePointTrie *fromBinary(UCPTrieType type, UCPTrieValueWidth valueWidth,
+                                     const void *data, int32_t length, int32_t *pActualLength,
+                                     UErrorCode &errorCode);
+
+    /**
+     * Wraps a UCPTrie. The CodePointTrie takes ownership of the UCPTrie
+     * and closes it when it is deleted, even if an error occurs.
+     *
+     * @param adopted the UCPTrie to be adopted
+     * @param errorCode ICU error code
+     * @return the trie, owned by the caller; NULL if an error occurred
+     * @draft ICU 64
+     */
+    static CodePointTrie *adoptUCPTrie(UCPTrie *adopted, UErrorCode &errorCode);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    ~CodePointTrie();
+
+    /**
+     * @return the trie type
+     * @draft ICU 64
+     */
+    UCPTrieType getType() const { return (UCPTrieType)trie->type; }
+
+    /**
+     * @return the number of bits in a trie data value
+     * @draft ICU 64
+     */
+    UCPTrieValueWidth getValueWidth() const { return (UCPTrieValueWidth)trie->valueWidth; }
+
+    /**
+     * Returns the value for a code point as stored in the trie, with range checking.
+     *
+     * @param c the code point
+     * @return the trie value,
+     *         or the trie error value if the code point is not in the range 0..U+10FFFF
+     * @draft ICU 64
+     */
+    inline uint32_t get(UChar32 c) const;
+
+    /**
+     * UTF-16: Reads the next code point, advances src, and returns its trie value.
+     * Returns the trie error value if c is an unpaired surrogate.
+     *
+     * @param src the source text pointer; in/out
+     * @param limit the limit pointer for the text; must be greater than src
+     * @param c receives the code point
+     * @return the trie value
+     * @see UCPTRIE_FAST_U16_NEXT
+     * @draft ICU 64
+     */
+    inline uint32_t nextU16(const char16_t *&src, const char16_t *limit, UChar32 &c) const;
+
+    /**
+     * UTF-8: Reads the next code point, advances src, and returns its trie value.
+     * Returns the trie error value for an ill-formed byte sequence,
+     * in which case src is advanced past the maximal ill-formed subpart.
+     *
+     * @param src the source text pointer; in/out
+     * @param limit the limit pointer for the text; must be greater than src
+     * @return the trie value
+     * @see UCPTRIE_FAST_U8_NEXT
+     * @draft ICU 64
+     */
+    inline uint32_t nextU8(const char *&src, const char *limit) const;
+
+    /**
+     * Returns the last code point such that all those from start to there have the same value.
+     * See ucptrie_getRange() for details and a code sample.
+     *
+     * @param start range start
+     * @param option defines whether surrogates are treated normally,
+     *               or as having the surrogateValue; usually UCPMAP_RANGE_NORMAL
+     * @param surrogateValue value for surrogates; ignored if option==UCPMAP_RANGE_NORMAL
+     * @param filter a pointer to a function that may modify the trie data value,
+     *     or NULL if the values from the trie are to be used unmodified
+     * @param context an opaque pointer that is passed on to the filter function
+     * @param pValue if not NULL, receives the value that every code point start..end has
+     * @return the range end code point, or -1 if start is not a valid code point
+     * @draft ICU 64
+     */
+    UChar32 getRange(UChar32 start, UCPMapRangeOption option, uint32_t surrogateValue,
+                     UCPMapValueFilter *filter, const void *context, uint32_t *pValue) const {
+        return ucptrie_getRange(trie, start, option, surrogateValue, filter, context, pValue);
+    }
+
+    /**
+     * Writes a memory-mappable form of the trie into 32-bit aligned memory.
+     * Inverse of fromBinary().
+     *
+     * @param data a pointer to 32-bit-aligned memory to be filled with the trie data;
+     *             can be NULL if capacity==0
+     * @param capacity the number of bytes available at data, or 0 for pure preflighting
+     * @param errorCode ICU error code; U_BUFFER_OVERFLOW_ERROR if the capacity is too small
+     * @return the number of bytes written or (if buffer overflow) needed for the trie
+     * @draft ICU 64
+     */
+    int32_t toBinary(void *data, int32_t capacity, UErrorCode &errorCode) const {
+        return ucptrie_toBinary(trie, data, capacity, &errorCode);
+    }
+
+    /**
+     * @return the wrapped UCPTrie, for use with the UCPTRIE_... macros;
+     *         owned by this object
+     * @draft ICU 64
+     */
+    const UCPTrie *toUCPTrie() const { return trie; }
+
+    /**
+     * @return the trie as a UCPMap, for use with the ucpmap_... functions;
+     *         owned by this object
+     * @draft ICU 64
+     */
+    const UCPMap *toUCPMap() const { return reinterpret_cast<const UCPMap *>(trie); }
+
+private:
+    CodePointTrie(UCPTrie *adopted) : trie(adopted) {}
+    CodePointTrie(const CodePointTrie &other) = delete;
+    CodePointTrie &operator=(const CodePointTrie &other) = delete;
+
+    inline uint32_t getFromIndex(int32_t i) const;
+    uint32_t getErrorValue() const { return getFromIndex(trie->dataLength - UCPTRIE_ERROR_VALUE_NEG_DATA_OFFSET); }
+
+    UCPTrie *trie;
+};
+
+#ifndef U_IN_DOXYGEN
+
+uint32_t CodePointTrie::getFromIndex(int32_t i) const {
+    switch (trie->valueWidth) {
+    case UCPTRIE_VALUE_BITS_16:
+        return UCPTRIE_16(trie, i);
+    case UCPTRIE_VALUE_BITS_32:
+        return UCPTRIE_32(trie, i);
+    default:
+        return UCPTRIE_8(trie, i);
+    }
+}
+
+uint32_t CodePointTrie::get(UChar32 c) const {
+    return getFromIndex(trie->type == UCPTRIE_TYPE_FAST ?
+                        _UCPTRIE_CP_INDEX(trie, 0xffff, c) :
+                        _UCPTRIE_CP_INDEX(trie, UCPTRIE_SMALL_MAX, c));
+}
+
+uint32_t CodePointTrie::nextU16(const char16_t *&src, const char16_t *limit, UChar32 &c) const {
+    if (trie->type == UCPTRIE_TYPE_FAST) {
+        uint32_t result;
+        switch (trie->valueWidth) {
+        case UCPTRIE_VALUE_BITS_16:
+            UCPTRIE_FAST_U16_NEXT(trie, UCPTRIE_16, src, limit, c, result);
+            break;
+        case UCPTRIE_VALUE_BITS_32:
+            UCPTRIE_FAST_U16_NEXT(trie, UCPTRIE_32, src, limit, c, result);
+            break;
+        default:
+            UCPTRIE_FAST_U16_NEXT(trie, UCPTRIE_8, src, limit, c, result);
+            break;
+        }
+        return result;
+    }
+    c = *src++;
+    if (U16_IS_SURROGATE(c)) {
+        if (U16_IS_SURROGATE_LEAD(c) && src != limit && U16_IS_TRAIL(*src)) {
+            c = U16_GET_SUPPLEMENTARY(c, *src++);
+        } else {
+            return getErrorValue();
+        }
+    }
+    return get(c);
+}
+
+uint32_t CodePointTrie::nextU8(const char *&src, const char *limit) const {
+    if (trie->type == UCPTRIE_TYPE_FAST) {
+        uint32_t result;
+        switch (trie->valueWidth) {
+        case UCPTRIE_VALUE_BITS_16:
+            UCPTRIE_FAST_U8_NEXT(trie, UCPTRIE_16, src, limit, result);
+            break;
+        case UCPTRIE_VALUE_BITS_32:
+            UCPTRIE_FAST_U8_NEXT(trie, UCPTRIE_32, src, limit, result);
+            break;
+        default:
+            UCPTRIE_FAST_U8_NEXT(trie, UCPTRIE_8, src, limit, result);
+            break;
+        }
+        return result;
+    }
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(src);
+    int32_t i = 0, length = (int32_t)(limit - src);
+    UChar32 c;
+    U8_NEXT(s, i, length, c);
+    src += i;
+    return c >= 0 ? get(c) : getErrorValue();
+}
+
+#endif  // U_IN_DOXYGEN
+
+/**
+ * Mutable Unicode code point trie.
+ * Fast map from Unicode code points (U+0000..U+10FFFF) to 32-bit integer values.
+ * Owns and wraps a UMutableCPTrie; see there for details.
+ * Builds a compacted, immutable CodePointTrie.
+ *
+ * @draft ICU 64
+ */
+class U_COMMON_API MutableCodePointTrie : public UMemory {
+public:
+    /**
+     * Constructs a mutable trie that initially maps each Unicode code point to the same value.
+     *
+     * @param initialValue the initial value that is set for all code points
+     * @param errorValue the value for out-of-range code points and ill-formed UTF-8/16
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    MutableCodePointTrie(uint32_t initialValue, uint32_t errorValue, UErrorCode &errorCode);
+
+    /**
+     * Constructs a mutable trie with the same contents as the immutable one.
+     *
+     * @param other the immutable trie
+     * @param errorCode ICU error code
+     * @draft ICU 64
+     */
+    MutableCodePointTrie(const CodePointTrie &other, UErrorCode &errorCode);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    ~MutableCodePointTrie();
+
+    /**
+     * Returns the value for a code point as stored in the trie.
+     *
+     * @param c the code point
+     * @return the value
+     * @draft ICU 64
+     */
+    uint32_t get(UChar32 c) const;
+
+    /**
+     * Returns the last code point such that all those from start to there have the same value.
+     * The trie can be modified between calls to this function.
+     * See umutablecptrie_getRange() for details.
+     *
+     * @param start range start
+     * @param option defines whether surrogates are treated normally,
+     *               or as having the surrogateValue; usually UCPMAP_RANGE_NORMAL
+     * @param surrogateValue value for surrogates; ignored if option==UCPMAP_RANGE_NORMAL
+     * @param filter a pointer to a function that may modify the trie data value,
+     *     or NULL if the values from the trie are to be used unmodified
+     * @param context an opaque pointer that is passed on to the filter function
+     * @param pValue if not NULL, receives the value that every code point start..end has
+     * @return the range end code point, or -1 if start is not a valid code point
+     * @draft ICU 64
+     */
+    UChar32 getRange(UChar32 start, UCPMapRangeOption option, uint32_t surrogateValue,
+                     UCPMapValueFilter *filter, const void *context, uint32_t *pValue) const;
+
+    /**
+     * Sets a value for a code point.
+     *
+     * @param c the code point
+     * @param value the value
+     * @param errorCode ICU error code
+     * @draft ICU 64
+     */
+    void set(UChar32 c, uint32_t value, UErrorCode &errorCode);
+
+    /**
+     * Sets a value for each code point [start..end].
+     * Faster and more space-efficient than setting the value for each code point separately.
+     *
+     * @param start the first code point to get the value
+     * @param end the last code point to get the value (inclusive)
+     * @param value the value
+     * @param errorCode ICU error code
+     * @draft ICU 64
+     */
+    void setRange(UChar32 start, UChar32 end, uint32_t value, UErrorCode &errorCode);
+
+    /**
+     * Compacts the data and builds an immutable CodePointTrie.
+     * After this, the mutable trie will be empty.
+     * See umutablecptrie_buildImmutable() for details.
+     *
+     * @param type selects the trie type
+     * @param valueWidth selects the number of bits in a trie data value; if smaller than 32 bits,
+     *                   then the values stored in the trie will be truncated first
+     * @param errorCode ICU error code
+     * @return the immutable trie, owned by the caller; NULL if an error occurred
+     * @draft ICU 64
+     */
+    CodePointTrie *buildImmutable(UCPTrieType type, UCPTrieValueWidth valueWidth,
+                                  UErrorCode &errorCode);
+
+private:
+    MutableCodePointTrie(const MutableCodePointTrie &other) = delete;
+    MutableCodePointTrie &operator=(const MutableCodePointTrie &other) = delete;
+
+    UMutableCPTrie *trie;
+};
+
+U_NAMESPACE_END
+
+#endif  // U_HIDE_DRAFT_API
+#endif  // U_SHOW_CPLUSPLUS_API
+#endif  // __CODEPOINTTRIE_H__
@@ -0,0 +1,158 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// localematcher.h
+// created: 2026oct14
+
+#ifndef __LOCALEMATCHER_H__
+#define __LOCALEMATCHER_H__
+
+#include "unicode/utypes.h"
+#include "unicode/locid.h"
+#include "unicode/stringpiece.h"
+#include "unicode/uobject.h"
+
+/**
+ * \file
+ * \brief C++ API: Locale matcher: User's desired locales vs. application's supported locales.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+U_NAMESPACE_BEGIN
+
+struct LSR;
+
+/**
+ * Immutable class that picks the best match between a user's desired locales
+ * and an application's supported locales.
+ *
+ * Both the desired and the supported locales are maximized with likely subtags,
+ * and their language, script and region subtags are compared
+ * with the CLDR language matching distances (supplementalData/languageMatchingNew).
+ * The supported locales are maximized once when the matcher is constructed,
+ * and the distance rules are loaded once per process,
+ * so that matching a desired locale is cheap.
+ *
+ * A supported locale matches only if its distance is below
+ * the distance between different scripts of the same language.
+ * Each further desired locale in a list is demoted by a little more than
+ * the distance between two regions, so that a user's first language is preferred
+ * even if it is not supported for the desired region.
+ * Among supported locales with the same distance, the earliest one wins.
+ * If nothing matches, then the first supported locale is the default result.
+ *
+ * A LocaleMatcher is thread-safe:
+ * Any number of threads may call its const functions at the same time.
+ *
+ * \code
+ * Locale supported[] = { Locale("en"), Locale("de"), Locale("fr-CH") };
+ * LocaleMatcher matcher(supported, 3, errorCode);
+ * const Locale *best = matcher.getBestMatchForListString("fr-FR, de;q=0.9", errorCode);
+ * // best is the supported "fr_CH"
+ * \endcode
+ *
+ * @draft ICU 64
+ */
+class U_COMMON_API LocaleMatcher : public UMemory {
+public:
+    /**
+     * Constructs a matcher for the given supported locales.
+     * The locales are copied.
+     *
+     * @param supportedLocales the application's locales, in order of preference
+     * @param length the number of supported locales
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    LocaleMatcher(const Locale *supportedLocales, int32_t length, UErrorCode &errorCode);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    ~LocaleMatcher();
+
+    /**
+     * Returns the supported locale which best matches the desired locale.
+     *
+     * @param desiredLocale Typically a user's language.
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @return the best-matching supported locale, or the first supported locale
+     *         if none of them match; NULL if there are no supported locales
+     * @draft ICU 64
+     */
+    const Locale *getBestMatch(const Locale &desiredLocale, UErrorCode &errorCode) const;
+
+    /**
+     * Returns the supported locale which best matches one of the desired locales.
+     *
+     * @param desiredLocales Typically a user's languages, in order of preference (descending).
+     * @param length the number of desired locales
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @return the best-matching supported locale, or the first supported locale
+     *         if none of them match; NULL if there are no supported locales
+     * @draft ICU 64
+     */
+    const Locale *getBestMatch(const Locale *desiredLocales, int32_t length,
+                               UErrorCode &errorCode) const;
+
+    /**
+     * Parses an Accept-Language string
+     * (<a href="https://tools.ietf.org/html/rfc2616#section-14.4">RFC 2616 Section 14.4</a>),
+     * such as "af, en, fr;q=0.9", and returns the best-matching supported locale.
+     * Language ranges are matched in descending order of their quality values,
+     * and in input order for equal quality values.
+     * The "*" range and ranges with q=0 are ignored.
+     *
+     * @param desiredLocaleList Typically a user's languages, as an Accept-Language string.
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     *                  Set to U_ILLEGAL_ARGUMENT_ERROR if the string is not well-formed.
+     * @return the best-matching supported locale, or the first supported locale
+     *         if none of them match; NULL if there are no supported locales
+     * @draft ICU 64
+     */
+    const Locale *getBestMatchForListString(StringPiece desiredLocaleList,
+                                            UErrorCode &errorCode) const;
+
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Returns the distance between the desired and the supported locale,
+     * after maximizing both of them.
+     * 0 means that they are equivalent.
+     * The distance is not symmetric.
+     *
+     * @param desired the desired locale
+     * @param supported the supported locale
+     * @param errorCode ICU error code
+     * @return the distance
+     * @internal ICU 64 for testing
+     */
+    static int32_t internalDistance(const Locale &desired, const Locale &supported,
+                                    UErrorCode &errorCode);
+#endif  // U_HIDE_INTERNAL_API
+
+private:
+    LocaleMatcher(const LocaleMatcher &other) = delete;
+    LocaleMatcher &operator=(const LocaleMatcher &other) = delete;
+
+    int32_t getBestMatchIndex(const Locale *desiredLocales, int32_t length,
+                              UErrorCode &errorCode) const;
+
+    Locale *supportedLocales;
+    LSR *supportedLSRs;
+    int32_t supportedLocalesLength;
+};
+
+U_NAMESPACE_END
+
+#endif  // U_HIDE_DRAFT_API
+#endif  // __LOCALEMATCHER_H__
@@ -123,6 +123,21 @@ class U_COMMON_API LocaleDisplayNames : public UObject {
     virtual UnicodeString& localeDisplayName(const char* localeId,
                          UnicodeString& result) const = 0;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Returns the display names of several locales, as localeDisplayName() does
+     * for each of them. This is convenient for filling a list of locales,
+     * such as a language picker.
+     * @param locales the locales whose display names to return
+     * @param count the number of locales
+     * @param results receives the display names; must have room for count strings
+     * @return results
+     * @draft ICU 64
+     */
+    UnicodeString* localeDisplayNames(const Locale* locales, int32_t count,
+                                      UnicodeString* results) const;
+#endif  // U_HIDE_DRAFT_API
+
     // names for components of a locale id
     /**
      * Returns the display name of the provided language code.
@@ -35,7 +35,9 @@
 
 U_NAMESPACE_BEGIN
 
+class Appendable;
 class ByteSink;
+class CharString;
 
 /**
  * Unicode normalization functionality for standard Unicode normalization or
@@ -485,6 +487,66 @@ class U_COMMON_API Normalizer2 : public UObject {
      * @stable ICU 4.4
      */
     virtual UBool isInert(UChar32 c) const = 0;
+
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Finds positions at which a long string can be split into pieces
+     * of about pieceLength code units each, such that the pieces can be normalized
+     * independently of each other, for example on several threads.
+     * The concatenation of the normalized pieces is the same as normalize(s).
+     *
+     * Each split point is the first normalization boundary
+     * (see hasBoundaryBefore()) at least pieceLength code units after the previous one.
+     * A piece can be longer when there is no boundary near its end,
+     * and there are no split points in strings of up to pieceLength code units.
+     * @param s input string
+     * @param pieceLength the minimum length of each piece except the last one; must be positive
+     * @param dest receives the split points in ascending order,
+     *             each greater than 0 and less than s.length();
+     *             can be NULL if destCapacity is 0
+     * @param destCapacity the capacity of dest
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Set to U_BUFFER_OVERFLOW_ERROR if there are more
+     *                  split points than destCapacity.
+     * @return the number of split points; there is one more piece than split points
+     * @draft ICU 64
+     */
+    int32_t getSplitPoints(const UnicodeString &s, int32_t pieceLength,
+                           int32_t *dest, int32_t destCapacity, UErrorCode &errorCode) const;
+
+    /**
+     * Finds positions at which a long UTF-8 string can be split into pieces
+     * of about pieceLength bytes each, such that the pieces can be normalized
+     * independently of each other with normalizeUTF8(), for example on several threads.
+     * The concatenation of the normalized pieces is the same as
+     * normalizeUTF8() of the whole string, with the same options.
+     *
+     * Each split point is at the start of a well-formed character with
+     * a normalization boundary before it (see hasBoundaryBefore()),
+     * at least pieceLength bytes after the previous one.
+     * A piece can be longer when there is no boundary near its end,
+     * and there are no split points in strings of up to pieceLength bytes.
+     * @param s UTF-8 input string
+     * @param pieceLength the minimum length of each piece except the last one; must be positive
+     * @param dest receives the split points in ascending order,
+     *             each greater than 0 and less than s.length();
+     *             can be NULL if destCapacity is 0
+     * @param destCapacity the capacity of dest
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Set to U_BUFFER_OVERFLOW_ERROR if there are more
+     *                  split points than destCapacity.
+     * @return the number of split points; there is one more piece than split points
+     * @draft ICU 64
+     */
+    int32_t getSplitPointsUTF8(StringPiece s, int32_t pieceLength,
+                               int32_t *dest, int32_t destCapacity, UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
 };
 
 /**
@@ -768,6 +830,115 @@ class U_COMMON_API FilteredNormalizer2 : public Normalizer2 {
     const UnicodeSet &set;
 };
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Normalizes text that arrives in chunks, such as while reading a large file,
+ * with an otherwise immutable Normalizer2 instance.
+ *
+ * The text up to the last normalization boundary in the input so far
+ * (see Normalizer2::hasBoundaryBefore()) is normalized and written out,
+ * and the rest is kept until the next chunk or the end of the input.
+ * The memory use therefore does not depend on the total length of the text,
+ * only on the lengths of the chunks and of the longest sequence of
+ * characters without a boundary between them.
+ *
+ * The output is the same as that of Normalizer2::normalize() or normalizeUTF8()
+ * for the concatenation of all of the chunks.
+ * Chunks may end in the middle of a surrogate pair or UTF-8 byte sequence.
+ *
+ * UTF-16 and UTF-8 text are separate streams, each with its own carried-over text.
+ * An instance of this class must not be used by multiple threads at the same time.
+ * @draft ICU 64
+ */
+class U_COMMON_API StreamingNormalizer2 : public UMemory {
+public:
+    /**
+     * Constructs a streaming normalizer for any Normalizer2 instance,
+     * which is aliased and must not be deleted while this object is used.
+     * @param n2 the Normalizer2 instance, for example from Normalizer2::getNFCInstance()
+     * @draft ICU 64
+     */
+    StreamingNormalizer2(const Normalizer2 &n2);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    ~StreamingNormalizer2();
+
+    /**
+     * Normalizes the next chunk of UTF-16 text.
+     * Appends the normalized form of the text before the last normalization boundary
+     * to dest, and keeps the text after the boundary for the next call.
+     * @param chunk the next part of the input text
+     * @param dest receives normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    void normalize(const UnicodeString &chunk, Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Ends the UTF-16 input: Appends the normalized form of the remaining
+     * text to dest. The object is then ready for a new stream of UTF-16 text.
+     * @param dest receives normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    void finish(Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the next chunk of UTF-8 text.
+     * Writes the normalized form of the text before the last normalization boundary
+     * to the sink, and keeps the text after the boundary for the next call.
+     * @param chunk the next part of the input text
+     * @param sink receives normalized UTF-8 text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    void normalizeUTF8(StringPiece chunk, ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Ends the UTF-8 input: Writes the normalized form of the remaining
+     * text to the sink. The object is then ready for a new stream of UTF-8 text.
+     * @param sink receives normalized UTF-8 text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    void finishUTF8(ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Discards the carried-over text of both streams without writing it.
+     * @draft ICU 64
+     */
+    void reset();
+
+private:
+    StreamingNormalizer2(const StreamingNormalizer2 &);
+    StreamingNormalizer2 &operator=(const StreamingNormalizer2 &);
+
+    void write(const UnicodeString &src, Appendable &dest, UErrorCode &errorCode);
+
+    const Normalizer2 &norm2;
+    UnicodeString pending;      // UTF-16 text after the last boundary
+    CharString *pending8;       // UTF-8 text after the last boundary, created on demand
+    UnicodeString normalized;   // scratch output buffer
+};
+
+#endif  // U_HIDE_DRAFT_API
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_NORMALIZATION
@@ -586,6 +586,34 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     virtual const uint8_t *getBinaryRules(uint32_t &length);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Finds all of the boundaries from start to limit, inclusive, and writes them
+     * to an array, together with their rule status values if requested.
+     * This is equivalent to iterating with following(start - 1) and next(),
+     * but much faster for many boundaries because it runs the rules directly,
+     * without filling the break iterator's cache of recent boundaries.
+     *
+     * After the call, the iterator is positioned at the last boundary that was
+     * found, or is unchanged if there is none.
+     *
+     * @param start        The start of the range of the text. Clamped to the text.
+     * @param limit        The end of the range of the text, inclusive. Clamped to the text.
+     * @param boundaries   Receives the boundaries in ascending order.
+     *                     Can be NULL if capacity is 0.
+     * @param ruleStatuses If not NULL, receives for each boundary the value that
+     *                     getRuleStatus() would return at it. Must have the same capacity.
+     * @param capacity     The capacity of the arrays.
+     * @param status       Receives errors. Set to U_BUFFER_OVERFLOW_ERROR if there
+     *                     are more boundaries than capacity, and to U_ILLEGAL_ARGUMENT_ERROR
+     *                     if start > limit.
+     * @return The number of boundaries from start to limit.
+     * @draft ICU 64
+     */
+    int32_t getBoundaries(int32_t start, int32_t limit, int32_t *boundaries,
+                          int32_t *ruleStatuses, int32_t capacity, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      *  Set the subject text string upon which the break iterator is operating
      *  without changing any other aspect of the matching state.
@@ -642,6 +670,13 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     int32_t handleSafePrevious(int32_t fromPosition);
 
+    /**
+     * handleSafePrevious() for state table rows of type RowType.
+     * @internal (private)
+     */
+    template <typename RowType>
+    int32_t handleSafePreviousUText(int32_t fromPosition);
+
     /**
      * Find a rule-based boundary by running the state machine.
      * Input
@@ -656,6 +691,24 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     int32_t handleNext();
 
+    /**
+     * handleNext() for state table rows of type RowType, reading fText
+     * with the UText access functions.
+     * @internal (private)
+     */
+    template <typename RowType>
+    int32_t handleNextUText();
+
+    /**
+     * handleNext() for UTF-8 text in memory, read without the UText access functions,
+     * and for state table rows of type RowType.
+     * @param s       the UTF-8 text of fText
+     * @param length  its length in bytes
+     * @internal (private)
+     */
+    template <typename RowType>
+    int32_t handleNextUTF8(const uint8_t *s, int32_t length);
+
 
     /**
      * This function returns the appropriate LanguageBreakEngine for a
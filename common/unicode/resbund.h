@@ -458,6 +458,26 @@ class U_COMMON_API ResourceBundle : public UObject {
      */
     const Locale
       getLocale(ULocDataLocaleType type, UErrorCode &status) const;
+
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Enumerates the items of a table or array resource in this bundle,
+     * with fallback to parent bundles, without creating a ResourceBundle
+     * for each item. Use this instead of getNext() or get() loops
+     * when reading all of a large table.
+     *
+     * @param path   "/"-separated path to the table or array resource
+     *               within this bundle, or "" for this resource itself
+     * @param sink   receives the items
+     * @param status in/out ICU error code
+     * @see ures_getAllItemsWithFallback
+     * @see ResourceSink
+     * @draft ICU 64
+     */
+    void
+      getAllItemsWithFallback(const char *path, ResourceSink &sink, UErrorCode &status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
     /**
      * This API implements multilevel fallback
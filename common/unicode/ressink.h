@@ -0,0 +1,351 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ressink.h
+// Public version of the resource bundle value and sink classes
+// that were added in resource.h on 2015nov04 by Markus W. Scherer.
+
+#ifndef __RESSINK_H__
+#define __RESSINK_H__
+
+#include "unicode/utypes.h"
+
+#if U_SHOW_CPLUSPLUS_API
+
+#include "unicode/uobject.h"
+#include "unicode/unistr.h"
+#include "unicode/ures.h"
+
+/**
+ * \file
+ * \brief C++ API: Resource bundle values and sinks for bulk enumeration.
+ *
+ * A ResourceSink receives the items of a resource bundle table or array
+ * via ures_getAllItemsWithFallback() or ResourceBundle::getAllItemsWithFallback().
+ * The items are read directly from the loaded resource data:
+ * keys and string values are pointers into the (usually memory-mapped) data,
+ * and no UResourceBundle or ResourceBundle object is created for them.
+ * A single ResourceValue object is reused for all of the items.
+ */
+
+// Note: Ported from ICU4J class UResource and its nested classes,
+// but the C++ classes are separate, not nested.
+
+struct ResourceData;
+
+U_NAMESPACE_BEGIN
+
+class ResourceValue;
+
+// Note: In C++, we use const char * pointers for keys,
+// rather than an abstraction like Java UResource.Key.
+
+/**
+ * Interface for iterating over a resource bundle array resource.
+ * @draft ICU 64
+ */
+class U_COMMON_API ResourceArray {
+public:
+    /**
+     * Constructs an empty array object.
+     * @draft ICU 64
+     */
+    ResourceArray() : items16(NULL), items32(NULL), length(0) {}
+
+#ifndef U_HIDE_INTERNAL_API
+    /** Only for implementation use. @internal */
+    ResourceArray(const uint16_t *i16, const uint32_t *i32, int32_t len) :
+            items16(i16), items32(i32), length(len) {}
+#endif  /* U_HIDE_INTERNAL_API */
+
+    /**
+     * @return The number of items in the array resource.
+     * @draft ICU 64
+     */
+    int32_t getSize() const { return length; }
+    /**
+     * @param i Array item index.
+     * @param value Output-only, receives the value of the i'th item.
+     * @return TRUE if i is non-negative and less than getSize().
+     * @draft ICU 64
+     */
+    UBool getValue(int32_t i, ResourceValue &value) const;
+
+#ifndef U_HIDE_INTERNAL_API
+    /** Only for implementation use. @internal */
+    uint32_t internalGetResource(const ResourceData *pResData, int32_t i) const;
+#endif  /* U_HIDE_INTERNAL_API */
+
+private:
+    const uint16_t *items16;
+    const uint32_t *items32;
+    int32_t length;
+};
+
+/**
+ * Interface for iterating over a resource bundle table resource.
+ * @draft ICU 64
+ */
+class U_COMMON_API ResourceTable {
+public:
+    /**
+     * Constructs an empty table object.
+     * @draft ICU 64
+     */
+    ResourceTable() : keys16(NULL), keys32(NULL), items16(NULL), items32(NULL), length(0) {}
+
+#ifndef U_HIDE_INTERNAL_API
+    /** Only for implementation use. @internal */
+    ResourceTable(const uint16_t *k16, const int32_t *k32,
+                  const uint16_t *i16, const uint32_t *i32, int32_t len) :
+            keys16(k16), keys32(k32), items16(i16), items32(i32), length(len) {}
+#endif  /* U_HIDE_INTERNAL_API */
+
+    /**
+     * @return The number of items in the array resource.
+     * @draft ICU 64
+     */
+    int32_t getSize() const { return length; }
+    /**
+     * @param i Array item index.
+     * @param key Output-only, receives the key of the i'th item.
+     *     The key points into the resource data and stays valid
+     *     as long as the resource bundle is open.
+     * @param value Output-only, receives the value of the i'th item.
+     * @return TRUE if i is non-negative and less than getSize().
+     * @draft ICU 64
+     */
+    UBool getKeyAndValue(int32_t i, const char *&key, ResourceValue &value) const;
+
+private:
+    const uint16_t *keys16;
+    const int32_t *keys32;
+    const uint16_t *items16;
+    const uint32_t *items32;
+    int32_t length;
+};
+
+/**
+ * Represents a resource bundle item's value.
+ * Avoids object creations as much as possible.
+ * Mutable, not thread-safe.
+ *
+ * Pointers returned by the getters point into the resource data
+ * and stay valid as long as the resource bundle is open.
+ * @draft ICU 64
+ */
+class U_COMMON_API ResourceValue : public UObject {
+public:
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    virtual ~ResourceValue();
+
+    /**
+     * @return ICU resource type, for example, URES_STRING
+     * @draft ICU 64
+     */
+    virtual UResType getType() const = 0;
+
+    /**
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is not a string resource.
+     *
+     * @see ures_getString()
+     * @draft ICU 64
+     */
+    virtual const UChar *getString(int32_t &length, UErrorCode &errorCode) const = 0;
+
+    /**
+     * Returns a read-only alias of the string value.
+     * @see getString()
+     * @draft ICU 64
+     */
+    inline UnicodeString getUnicodeString(UErrorCode &errorCode) const {
+        int32_t len = 0;
+        const UChar *r = getString(len, errorCode);
+        return UnicodeString(TRUE, r, len);
+    }
+
+    /**
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is not an alias resource.
+     * @draft ICU 64
+     */
+    virtual const UChar *getAliasString(int32_t &length, UErrorCode &errorCode) const = 0;
+
+    /**
+     * Returns a read-only alias of the alias string value.
+     * @see getAliasString()
+     * @draft ICU 64
+     */
+    inline UnicodeString getAliasUnicodeString(UErrorCode &errorCode) const {
+        int32_t len = 0;
+        const UChar *r = getAliasString(len, errorCode);
+        return UnicodeString(TRUE, r, len);
+    }
+
+    /**
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is not an integer resource.
+     *
+     * @see ures_getInt()
+     * @draft ICU 64
+     */
+    virtual int32_t getInt(UErrorCode &errorCode) const = 0;
+
+    /**
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is not an integer resource.
+     *
+     * @see ures_getUInt()
+     * @draft ICU 64
+     */
+    virtual uint32_t getUInt(UErrorCode &errorCode) const = 0;
+
+    /**
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is not an intvector resource.
+     *
+     * @see ures_getIntVector()
+     * @draft ICU 64
+     */
+    virtual const int32_t *getIntVector(int32_t &length, UErrorCode &errorCode) const = 0;
+
+    /**
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is not a binary-blob resource.
+     *
+     * @see ures_getBinary()
+     * @draft ICU 64
+     */
+    virtual const uint8_t *getBinary(int32_t &length, UErrorCode &errorCode) const = 0;
+
+    /**
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is not an array resource
+     * @draft ICU 64
+     */
+    virtual ResourceArray getArray(UErrorCode &errorCode) const = 0;
+
+    /**
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is not a table resource
+     * @draft ICU 64
+     */
+    virtual ResourceTable getTable(UErrorCode &errorCode) const = 0;
+
+    /**
+     * Is this a no-fallback/no-inheritance marker string?
+     * Such a marker is used for
+     * CLDR no-fallback data values of (three empty-set symbols)=={2205, 2205, 2205}
+     * when enumerating tables with fallback from the specific resource bundle to root.
+     *
+     * @return TRUE if this is a no-inheritance marker string
+     * @draft ICU 64
+     */
+    virtual UBool isNoInheritanceMarker() const = 0;
+
+    /**
+     * Sets the dest strings from the string values in this array resource.
+     *
+     * @return the number of strings in this array resource.
+     *     If greater than capacity, then an overflow error is set.
+     *
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is not an array resource
+     *     or if any of the array items is not a string
+     * @draft ICU 64
+     */
+    virtual int32_t getStringArray(UnicodeString *dest, int32_t capacity,
+                                   UErrorCode &errorCode) const = 0;
+
+    /**
+     * Same as
+     * <pre>
+     * if (getType() == URES_STRING) {
+     *     return new String[] { getString(); }
+     * } else {
+     *     return getStringArray();
+     * }
+     * </pre>
+     *
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is
+     *     neither a string resource nor an array resource containing strings
+     * @see getString()
+     * @see getStringArray()
+     * @draft ICU 64
+     */
+    virtual int32_t getStringArrayOrStringAsArray(UnicodeString *dest, int32_t capacity,
+                                                  UErrorCode &errorCode) const = 0;
+
+    /**
+     * Same as
+     * <pre>
+     * if (getType() == URES_STRING) {
+     *     return getString();
+     * } else {
+     *     return getStringArray()[0];
+     * }
+     * </pre>
+     *
+     * Sets U_RESOURCE_TYPE_MISMATCH if this is
+     *     neither a string resource nor an array resource containing strings
+     * @see getString()
+     * @see getStringArray()
+     * @draft ICU 64
+     */
+    virtual UnicodeString getStringOrFirstOfArray(UErrorCode &errorCode) const = 0;
+
+protected:
+    /**
+     * Default constructor, for subclasses.
+     * @draft ICU 64
+     */
+    ResourceValue() {}
+
+private:
+    ResourceValue(const ResourceValue &);  // no copy constructor
+    ResourceValue &operator=(const ResourceValue &);  // no assignment operator
+};
+
+/**
+ * Sink for ICU resource bundle contents.
+ * Subclass this and pass it to ures_getAllItemsWithFallback()
+ * or ResourceBundle::getAllItemsWithFallback().
+ * @draft ICU 64
+ */
+class U_COMMON_API ResourceSink : public UObject {
+public:
+    /**
+     * Default constructor.
+     * @draft ICU 64
+     */
+    ResourceSink() {}
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    virtual ~ResourceSink();
+
+    /**
+     * Called once for each bundle (child-parent-...-root).
+     * The value is normally an array or table resource,
+     * and implementations of this method normally iterate over the
+     * tree of resource items stored there.
+     *
+     * @param key The key string of the enumeration-start resource.
+     *     Empty if the enumeration starts at the top level of the bundle.
+     * @param value Call getArray() or getTable() as appropriate.
+     *     Then reuse for output values from Array and Table getters.
+     * @param noFallback true if the bundle has no parent;
+     *     that is, its top-level table has the nofallback attribute,
+     *     or it is the root bundle of a locale tree.
+     * @param errorCode ICU error code; set a failure to stop the enumeration
+     * @draft ICU 64
+     */
+    virtual void put(const char *key, ResourceValue &value, UBool noFallback,
+                     UErrorCode &errorCode) = 0;
+
+private:
+    ResourceSink(const ResourceSink &);  // no copy constructor
+    ResourceSink &operator=(const ResourceSink &);  // no assignment operator
+};
+
+U_NAMESPACE_END
+
+#endif  /* U_SHOW_CPLUSPLUS_API */
+
+#endif  // __RESSINK_H__
@@ -65,6 +65,26 @@
  */
 #define U_TITLECASE_SENTENCES 0x40
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Titlecase words that are separated by white space,
+ * rather than words as found by a word BreakIterator.
+ * (Titlecase the first character after each run of White_Space characters,
+ * possibly adjusted.)
+ * This does not load any break iteration data, and is much faster than
+ * the default word segmentation, but it does not separate words at punctuation
+ * and does not handle scripts that are written without spaces.
+ * Option bits value for titlecasing APIs that take an options bit set.
+ *
+ * It is an error to specify multiple titlecasing iterator options together,
+ * including both an options bit and an explicit BreakIterator.
+ *
+ * @see U_TITLECASE_ADJUST_TO_CASED
+ * @draft ICU 64
+ */
+#define U_TITLECASE_WHITE_SPACE_WORDS 0x80
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Do not lowercase non-initial parts of words when titlecasing.
  * Option bit for titlecasing APIs that take an options bit set.
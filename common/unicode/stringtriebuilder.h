@@ -25,12 +25,6 @@
  * \brief C++ API: Builder API for trie builders
  */
 
-// Forward declaration.
-/// \cond
-struct UHashtable;
-typedef struct UHashtable UHashtable;
-/// \endcond
-
 /**
  * Build options for BytesTrieBuilder and CharsTrieBuilder.
  * @stable ICU 4.8
@@ -184,9 +178,10 @@ class U_COMMON_API StringTrieBuilder : public UObject {
      * a Node pointer, or before setting a new UErrorCode.
      */
 
-    // Hash set of nodes, maps from nodes to integer 1.
+    // Hash set of nodes, which also owns the memory for them.
+    class NodeSet;
     /** @internal */
-    UHashtable *nodes;
+    NodeSet *nodes;
 
     // Do not conditionalize the following with #ifndef U_HIDE_INTERNAL_API,
     // it is needed for layout of other objects.
@@ -246,6 +241,11 @@ class U_COMMON_API StringTrieBuilder : public UObject {
             }
         }
         inline int32_t getOffset() const { return offset; }
+        // Nodes are allocated in memory owned by the builder's NodeSet,
+        // which frees all of it at once at the end of building the trie.
+        static void *operator new(size_t size, const StringTrieBuilder &builder) U_NOEXCEPT;
+        static void operator delete(void *p, const StringTrieBuilder &builder) U_NOEXCEPT;
+        static void operator delete(void *p) U_NOEXCEPT;
     protected:
         int32_t hash;
         int32_t offset;
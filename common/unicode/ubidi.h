@@ -536,6 +536,70 @@ ubidi_open(void);
 U_STABLE UBiDi * U_EXPORT2
 ubidi_openSized(int32_t maxLength, int32_t maxRunCount, UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Returns the number of bytes that <code>ubidi_openBuffer()</code> needs
+ * for a <code>UBiDi</code> object with the given sizings.
+ * The size does not depend on the alignment of the buffer.
+ *
+ * @param maxLength is the maximum text or line length, as for <code>ubidi_openSized()</code>.
+ * @param maxRunCount is the maximum number of same-level runs, as for <code>ubidi_openSized()</code>.
+ * @param pErrorCode must be a valid pointer to an error code value.
+ *        Set to U_ILLEGAL_ARGUMENT_ERROR if the sizings are negative or too large.
+ * @return The buffer size in bytes.
+ * @see ubidi_openBuffer
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ubidi_getBufferSize(int32_t maxLength, int32_t maxRunCount, UErrorCode *pErrorCode);
+
+/**
+ * Initialize a <code>UBiDi</code> object in a buffer provided by the caller,
+ * for example a slice of a per-thread arena.
+ * The object itself, its <code>maxLength</code> text arrays and its
+ * <code>maxRunCount</code> runs all live in the buffer, and none of them is
+ * ever reallocated: unlike with <code>ubidi_openSized()</code>, a sizing
+ * of 0 does not mean allocation on demand.
+ * Texts whose paragraphs need more memory fail with
+ * U_MEMORY_ALLOCATION_ERROR, as with <code>ubidi_openSized()</code>.<p>
+ *
+ * Only rarely needed internal structures are still allocated from the heap:
+ * those for more than a few paragraphs, isolates or bracket pairs, and those
+ * for the inverse and runs-only reordering modes.
+ * They are kept for reuse until <code>ubidi_close()</code>, so that repeated
+ * <code>ubidi_setPara()</code> and <code>ubidi_setLine()</code> calls on the same
+ * object do not allocate after the first time.<p>
+ *
+ * Such objects work well as a pool of line objects: each
+ * <code>ubidi_setLine()</code> call resets a line object in constant time
+ * without freeing or allocating anything, and the whole pool goes away
+ * with its buffer.
+ * <code>ubidi_close()</code> must still be called to release the heap
+ * structures, but it does not free the buffer.
+ * The buffer must stay valid and unchanged until then.
+ *
+ * @param buffer is the memory for the object. It need not be aligned.
+ * @param capacity is the size of the buffer in bytes; it must be at least
+ *        <code>ubidi_getBufferSize(maxLength, maxRunCount, pErrorCode)</code>.
+ * @param maxLength is the maximum text or line length that the object can process.
+ * @param maxRunCount is the maximum number of same-level runs that the object can hold.
+ *        Values 0 and 1 both allow only unidirectional text and lines.
+ * @param pErrorCode must be a valid pointer to an error code value.
+ *        Set to U_BUFFER_OVERFLOW_ERROR if the buffer is too small.
+ * @return An empty <code>UBiDi</code> object at the start of the buffer,
+ *         or NULL if an error occurred.
+ * @see ubidi_getBufferSize
+ * @see ubidi_openSized
+ * @draft ICU 64
+ */
+U_DRAFT UBiDi * U_EXPORT2
+ubidi_openBuffer(void *buffer, int32_t capacity,
+                 int32_t maxLength, int32_t maxRunCount,
+                 UErrorCode *pErrorCode);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * <code>ubidi_close()</code> must be called to free the memory
  * associated with a UBiDi object.<p>
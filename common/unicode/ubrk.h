@@ -623,6 +623,37 @@ ubrk_getBinaryRules(UBreakIterator *bi,
                     uint8_t *       binaryRules, int32_t rulesCapacity,
                     UErrorCode *    status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Finds all of the boundaries from start to limit, inclusive, and writes them to
+ * an array, together with their rule status values if requested. This is equivalent
+ * to iterating with ubrk_following(bi, start - 1) and ubrk_next(), but for rule-based
+ * break iterators much faster for many boundaries, because the rules are run
+ * directly, without filling the break iterator's cache of recent boundaries.
+ *
+ * After the call, the iterator is positioned at the last boundary that was found,
+ * or is unchanged if there is none.
+ *
+ * @param bi           The break iterator to use.
+ * @param start        The start of the range of the text. Clamped to the text.
+ * @param limit        The end of the range of the text, inclusive. Clamped to the text.
+ * @param boundaries   Receives the boundaries in ascending order.
+ *                     Can be NULL if capacity is 0.
+ * @param ruleStatuses If not NULL, receives for each boundary the value that
+ *                     ubrk_getRuleStatus() would return at it. Must have the same capacity.
+ * @param capacity     The capacity of the arrays.
+ * @param status       Pointer to UErrorCode to receive any errors.
+ *                     Set to U_BUFFER_OVERFLOW_ERROR if there are more boundaries
+ *                     than capacity, and to U_ILLEGAL_ARGUMENT_ERROR if start > limit.
+ * @return The number of boundaries from start to limit.
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ubrk_getBoundaries(UBreakIterator *bi, int32_t start, int32_t limit,
+                   int32_t *boundaries, int32_t *ruleStatuses, int32_t capacity,
+                   UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #endif /* #if !UCONFIG_NO_BREAK_ITERATION */
 
 #endif
@@ -263,6 +263,40 @@ ucasemap_utf8ToLower(const UCaseMap *csm,
                      const char *src, int32_t srcLength,
                      UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Lowercase the characters in a UTF-8 string in place,
+ * as long as each lowercase mapping has the same UTF-8 length as the original
+ * character. This is true for nearly all Latin, Greek and Cyrillic text.
+ * There is no separate destination buffer and no copy.
+ *
+ * If a character lowercases to a different number of bytes,
+ * for example U+0130 (capital I with dot above) or the Turkish capital I,
+ * then the function stops before that character, sets U_UNSUPPORTED_ERROR
+ * and returns its index. In this case, the text before the index has been lowercased,
+ * and the rest of the buffer is unchanged.
+ * Lowercasing this partially lowercased text with ucasemap_utf8ToLower()
+ * yields the same result as for the original text,
+ * so the caller can fall back to that function.
+ *
+ * @param csm       UCaseMap service object.
+ * @param s         The string to lowercase in place.
+ * @param length    The length of the string. If -1, then s must be NUL-terminated.
+ * @param pErrorCode Must be a valid pointer to an error code value,
+ *                  which must not indicate a failure before the function call.
+ *                  Set to U_UNSUPPORTED_ERROR if the string cannot be lowercased in place.
+ * @return The length of the string, if successful - or in case of U_UNSUPPORTED_ERROR,
+ *         the index of the first character that was not lowercased.
+ *
+ * @see ucasemap_utf8ToLower
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucasemap_utf8ToLowerInPlace(const UCaseMap *csm,
+                            char *s, int32_t length,
+                            UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Uppercase the characters in a UTF-8 string.
  * Casing is locale-dependent and context-sensitive.
@@ -2756,6 +2756,70 @@ u_getIntPropertyMaxValue(UProperty which);
 U_CAPI const UCPMap * U_EXPORT2
 u_getIntPropertyMap(UProperty property, UErrorCode *pErrorCode);
 
+/**
+ * Gets the values of several binary/enumerated/int/mask properties
+ * for each code point of a UTF-16 string.
+ * This is equivalent to calling u_getIntPropertyValue() for each code point
+ * and each property, but the properties are looked up only once per call,
+ * and enumerated/int property values are read from the same tries as used by
+ * u_getIntPropertyMap().
+ *
+ * For the i-th code point and the j-th property, the value is stored at
+ * values[i*whichCount+j].
+ * Unpaired surrogates are treated like surrogate code points.
+ *
+ * Sample usage:
+ * \code
+ * static const UProperty which[] = { UCHAR_GENERAL_CATEGORY, UCHAR_SCRIPT };
+ * int32_t values[2*100];
+ * int32_t count = u_getIntPropertyValues(s, length, which, 2, values, 2*100, &errorCode);
+ * \endcode
+ *
+ * @param s the string
+ * @param length the length of the string, or -1 if it is NUL-terminated
+ * @param which the properties; each must be
+ *        UCHAR_BINARY_START<=which<UCHAR_BINARY_LIMIT
+ *        or UCHAR_INT_START<=which<UCHAR_INT_LIMIT
+ *        or UCHAR_GENERAL_CATEGORY_MASK
+ * @param whichCount the number of properties, must be positive
+ * @param values output array for the property values
+ * @param capacity the number of int32_t values that fit into the values array
+ * @param pErrorCode an in/out ICU UErrorCode;
+ *        set to U_ILLEGAL_ARGUMENT_ERROR for an unsupported property,
+ *        and to U_BUFFER_OVERFLOW_ERROR if capacity is less than the number of
+ *        code points times whichCount
+ * @return the number of code points in the string
+ * @see u_getIntPropertyValue
+ * @see u_getIntPropertyValuesUTF8
+ * @draft ICU 64
+ */
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertyValues(const UChar *s, int32_t length,
+                       const UProperty *which, int32_t whichCount,
+                       int32_t *values, int32_t capacity, UErrorCode *pErrorCode);
+
+/**
+ * Gets the values of several binary/enumerated/int/mask properties
+ * for each code point of a UTF-8 string.
+ * Same as u_getIntPropertyValues() except for the string encoding.
+ * Each maximal subpart of an ill-formed sequence is treated like U+FFFD.
+ *
+ * @param s the UTF-8 string
+ * @param length the length of the string in bytes, or -1 if it is NUL-terminated
+ * @param which the properties; see u_getIntPropertyValues()
+ * @param whichCount the number of properties, must be positive
+ * @param values output array for the property values
+ * @param capacity the number of int32_t values that fit into the values array
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the number of code points in the string
+ * @see u_getIntPropertyValues
+ * @draft ICU 64
+ */
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertyValuesUTF8(const char *s, int32_t length,
+                           const UProperty *which, int32_t whichCount,
+                           int32_t *values, int32_t capacity, UErrorCode *pErrorCode);
+
 #endif  // U_HIDE_DRAFT_API
 
 /**
@@ -152,6 +152,161 @@ U_STABLE void U_EXPORT2
 u_setMemoryFunctions(const void *context, UMemAllocFn * U_CALLCONV_FPTR a, UMemReallocFn * U_CALLCONV_FPTR r, UMemFreeFn * U_CALLCONV_FPTR f, 
                     UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+  *  Pointer type for a user supplied function that tells whether a block of memory
+  *  was allocated by a memory scope.
+  *  @param context user supplied value, from the UMemoryScope.
+  *  @param mem     Pointer to a memory block that is being freed or resized.
+  *  @return        TRUE if the block belongs to the memory scope.
+  *  @draft ICU 64
+  *  @system
+  */
+typedef UBool U_CALLCONV UMemContainsFn(const void *context, const void *mem);
+
+/**
+ * A set of memory functions that is pushed onto the calling thread's stack of
+ * memory scopes with u_pushMemoryScope().
+ *
+ * While a scope is on top of a thread's stack, ICU heap allocations on that
+ * thread are made with its allocFn instead of the functions from
+ * u_setMemoryFunctions() or the C library.
+ * ICU passes a block that is freed or resized on that thread to the freeFn or
+ * reallocFn of the first scope on the stack whose containsFn returns TRUE for it,
+ * and otherwise to the regular memory functions.
+ * For example, a scope can serve all allocations for one request from an arena,
+ * and release them all at once when the request is done.
+ *
+ * ICU bypasses the scopes when it creates objects for its own caches and
+ * other long-lived internal data, so that these can outlive a scope.
+ * All other memory allocated while a scope is active must be freed on the
+ * same thread while the scope is still on the stack, or abandoned.
+ *
+ * All of the function pointers must be non-NULL.
+ * The caller owns the struct, which must remain valid while the scope is on the stack.
+ * @draft ICU 64
+ * @system
+ */
+typedef struct UMemoryScope {
+    /** User supplied value that is passed into the functions. @draft ICU 64 */
+    const void *context;
+    /** Allocation function. @draft ICU 64 */
+    UMemAllocFn * U_CALLCONV_FPTR allocFn;
+    /** Re-allocation function for blocks of this scope. @draft ICU 64 */
+    UMemReallocFn * U_CALLCONV_FPTR reallocFn;
+    /** Free function for blocks of this scope. @draft ICU 64 */
+    UMemFreeFn * U_CALLCONV_FPTR freeFn;
+    /** Tells whether a block belongs to this scope. @draft ICU 64 */
+    UMemContainsFn * U_CALLCONV_FPTR containsFn;
+    /** Set and used by ICU while the scope is on the stack. @internal */
+    struct UMemoryScope *previous;
+} UMemoryScope;
+
+/**
+ *  Pushes a memory scope onto the calling thread's stack of memory scopes.
+ *  Subsequent ICU heap allocations on this thread use the scope's allocFn,
+ *  until the scope is popped or another scope is pushed.
+ *  @param scope   The memory scope. Must remain valid until u_popMemoryScope().
+ *  @param status  Receives error values. U_ILLEGAL_ARGUMENT_ERROR if the scope
+ *                 or one of its functions is NULL. U_UNSUPPORTED_ERROR if ICU
+ *                 was built without U_ENABLE_MEMORY_SCOPES (the default),
+ *                 because the scope lookup slows down every ICU heap allocation.
+ *  @draft ICU 64
+ *  @system
+ */
+U_DRAFT void U_EXPORT2
+u_pushMemoryScope(UMemoryScope *scope, UErrorCode *status);
+
+/**
+ *  Pops a memory scope off the calling thread's stack of memory scopes.
+ *  @param scope   The memory scope, which must be the one on top of the stack.
+ *  @param status  Receives error values. U_ILLEGAL_ARGUMENT_ERROR if the scope
+ *                 is not on top of this thread's stack.
+ *  @draft ICU 64
+ *  @system
+ */
+U_DRAFT void U_EXPORT2
+u_popMemoryScope(UMemoryScope *scope, UErrorCode *status);
+
+/**
+ * ICU subsystems for memory accounting.
+ * ICU heap memory is attributed to the subsystem that was active
+ * on the allocating thread, for example to UMEM_TAG_COLLATION while
+ * a collator is created, or to UMEM_TAG_RESOURCES while that collator's
+ * resource bundle is opened.
+ * @see u_getMemoryUsage
+ * @draft ICU 64
+ */
+typedef enum UMemoryTag {
+    /** Memory allocated outside of the other subsystems. @draft ICU 64 */
+    UMEM_TAG_OTHER,
+    /** Collators and their tailorings. @draft ICU 64 */
+    UMEM_TAG_COLLATION,
+    /** Charset converters. @draft ICU 64 */
+    UMEM_TAG_CONVERSION,
+    /** Number, date and message formatters. @draft ICU 64 */
+    UMEM_TAG_FORMATTING,
+    /** Resource bundles and data items. @draft ICU 64 */
+    UMEM_TAG_RESOURCES,
+    /** Break iterators. @draft ICU 64 */
+    UMEM_TAG_BREAK_ITERATION,
+    /** Regular expression patterns and matchers. @draft ICU 64 */
+    UMEM_TAG_REGEX,
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * One more than the highest tag.
+     * The number of tags may grow; use the return value of u_getMemoryUsage().
+     * @internal
+     */
+    UMEM_TAG_LIMIT
+#endif  /* U_HIDE_INTERNAL_API */
+} UMemoryTag;
+
+/**
+ * ICU heap memory usage of one subsystem.
+ * @see u_getMemoryUsage
+ * @draft ICU 64
+ */
+typedef struct UMemoryUsage {
+    /** Bytes in blocks that are currently allocated, not counting allocator overhead. @draft ICU 64 */
+    int64_t liveBytes;
+    /** Number of blocks that are currently allocated. @draft ICU 64 */
+    int64_t liveBlocks;
+    /** Number of allocations and reallocations since process start. @draft ICU 64 */
+    int64_t allocations;
+} UMemoryUsage;
+
+/**
+ *  Writes the ICU heap memory usage of each subsystem, indexed by UMemoryTag values.
+ *  Together with u_getMemoryTagName() this shows which ICU subsystems own how much memory,
+ *  for example to decide which caches to flush under memory pressure.
+ *
+ *  The usage is only recorded when ICU is built with U_ENABLE_MEMORY_ACCOUNTING;
+ *  otherwise all values are 0.
+ *  Memory from u_pushMemoryScope() scopes is not included.
+ *
+ *  @param usage    Output array. Can be NULL if capacity is 0.
+ *  @param capacity The number of elements in the usage array.
+ *                  If it is smaller than the number of tags, then only that many are written.
+ *  @param status   Receives error values.
+ *  @return The number of tags this version of ICU supports.
+ *  @draft ICU 64
+ *  @system
+ */
+U_DRAFT int32_t U_EXPORT2
+u_getMemoryUsage(UMemoryUsage *usage, int32_t capacity, UErrorCode *status);
+
+/**
+ *  Get the name of a memory tag, for example "collation".
+ *  @param tag A UMemoryTag value.
+ *  @return The name string for the tag.
+ *  @draft ICU 64
+ *  @system
+ */
+U_DRAFT const char * U_EXPORT2
+u_getMemoryTagName(int32_t tag);
+#endif  /* U_HIDE_DRAFT_API */
+
 U_CDECL_END
 
 #ifndef U_HIDE_DEPRECATED_API
@@ -588,6 +588,100 @@ U_NAMESPACE_END
 
 #endif
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * A pool of converters of one kind, for code that opens and closes
+ * converters at a high rate.
+ * @draft ICU 64
+ */
+struct UConverterPool;
+/** @draft ICU 64 */
+typedef struct UConverterPool UConverterPool;
+
+/**
+ * Opens a pool of converters for one converter name.
+ * The name is resolved and the converter data is loaded once, here;
+ * converters are then taken from the pool with ucnv_openPooled()
+ * and given back with ucnv_release().
+ *
+ * A pool is not thread-safe. Use one pool per thread, for example one
+ * for each worker thread of a server.
+ *
+ * @param converterName the name of the converter, as for ucnv_open()
+ * @param capacity the maximum number of released converters that the pool keeps
+ *                 for reuse; must be >=0
+ * @param status a pointer to a UErrorCode to receive any errors
+ * @return the new pool, or NULL if an error occurred
+ * @see ucnv_openPooled
+ * @see ucnv_release
+ * @see ucnv_closePool
+ * @draft ICU 64
+ */
+U_DRAFT UConverterPool * U_EXPORT2
+ucnv_openPool(const char *converterName, int32_t capacity, UErrorCode *status);
+
+/**
+ * Closes a pool and the converters that it keeps.
+ * Converters that were taken from the pool and not yet released
+ * must be released or closed before the pool is closed.
+ * @param pool the pool to close; can be NULL
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucnv_closePool(UConverterPool *pool);
+
+/**
+ * Returns a converter from the pool: one that was released earlier,
+ * or a new one if the pool is empty.
+ * The converter is in its reset state, with the default callbacks,
+ * substitution character and fallback setting. It does not need
+ * the alias table lookup or the converter data cache of ucnv_open().
+ *
+ * Give the converter back with ucnv_release(), or close it with ucnv_close().
+ *
+ * @param pool the pool
+ * @param status a pointer to a UErrorCode to receive any errors
+ * @return a converter, or NULL if an error occurred
+ * @draft ICU 64
+ */
+U_DRAFT UConverter * U_EXPORT2
+ucnv_openPooled(UConverterPool *pool, UErrorCode *status);
+
+/**
+ * Gives a converter back to the pool that it came from.
+ * The converter is reset and kept for reuse if the pool has room
+ * and the caller did not change the callbacks, substitution character
+ * or fallback setting; otherwise it is closed.
+ *
+ * @param pool the pool that returned the converter
+ * @param cnv the converter to release; can be NULL
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucnv_release(UConverterPool *pool, UConverter *cnv);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUConverterPoolPointer
+ * "Smart pointer" class, closes a UConverterPool via ucnv_closePool().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 64
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUConverterPoolPointer, UConverterPool, ucnv_closePool);
+
+U_NAMESPACE_END
+
+#endif
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Fills in the output parameter, subChars, with the substitution characters
  * as multiple bytes.
@@ -739,6 +833,67 @@ ucnv_resetToUnicode(UConverter *converter);
 U_STABLE void U_EXPORT2
 ucnv_resetFromUnicode(UConverter *converter);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * The maximum number of bytes that ucnv_saveState() writes.
+ * A buffer of this size can hold the state of any converter.
+ * @draft ICU 64
+ */
+#define UCNV_STATE_CAPACITY 384
+
+/**
+ * Saves the conversion state of a converter into a small block of plain bytes,
+ * so that the converter can be used for other streams in between
+ * and later continue this one after ucnv_restoreState().
+ * For example, a few converters can serve many interleaved streams
+ * instead of keeping one converter open per stream.
+ *
+ * The state includes the partial input of both directions (bytes of an
+ * incomplete character, a lead surrogate, partial extension matches),
+ * the shift and escape states of stateful converters, and output that was
+ * kept in the converter after a U_BUFFER_OVERFLOW_ERROR.
+ * It does not include the settings of the converter: callbacks and
+ * their contexts, substitution characters and the fallback flag.
+ *
+ * The saved state is only valid in the same process, and only for converters
+ * that were opened with the same name.
+ *
+ * @param cnv the converter
+ * @param state the buffer for the state; can be NULL if capacity==0
+ * @param capacity the number of bytes available at state;
+ *                 UCNV_STATE_CAPACITY is always enough
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Set to U_UNSUPPORTED_ERROR if the state of this kind
+ *                   of converter cannot be saved.
+ * @return the length of the state, in bytes. If it is greater than capacity,
+ *         then U_BUFFER_OVERFLOW_ERROR is set and nothing is written.
+ * @see ucnv_restoreState
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnv_saveState(const UConverter *cnv, void *state, int32_t capacity, UErrorCode *pErrorCode);
+
+/**
+ * Restores a conversion state that ucnv_saveState() returned,
+ * possibly from another converter that was opened with the same name.
+ * The converter then continues the conversion of that stream
+ * in both directions.
+ *
+ * @param cnv the converter
+ * @param state the state from ucnv_saveState()
+ * @param length the length of the state, as returned by ucnv_saveState()
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Set to U_ILLEGAL_ARGUMENT_ERROR if the state is not valid
+ *                   or was saved from a different kind of converter.
+ * @see ucnv_saveState
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucnv_restoreState(UConverter *cnv, const void *state, int32_t length, UErrorCode *pErrorCode);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Returns the maximum number of bytes that are output per UChar in conversion
  * from Unicode using this converter.
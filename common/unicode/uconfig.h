@@ -136,6 +136,27 @@
 #define U_ENABLE_TRACING 0
 #endif
 
+/**
+ * \def U_ENABLE_MEMORY_ACCOUNTING
+ * Determines whether ICU records its heap memory usage per subsystem,
+ * for u_getMemoryUsage(). This adds a small header to each heap block.
+ * @internal
+ */
+#ifndef U_ENABLE_MEMORY_ACCOUNTING
+#define U_ENABLE_MEMORY_ACCOUNTING 0
+#endif
+
+/**
+ * \def U_ENABLE_MEMORY_SCOPES
+ * Determines whether u_pushMemoryScope() is supported.
+ * When enabled, every ICU heap allocation and free reads the
+ * calling thread's memory scope stack from thread-local storage.
+ * @internal
+ */
+#ifndef U_ENABLE_MEMORY_SCOPES
+#define U_ENABLE_MEMORY_SCOPES 0
+#endif
+
 /**
  * \def UCONFIG_ENABLE_PLUGINS
  * Determines whether to enable ICU plugins.
@@ -432,6 +432,50 @@ typedef enum UDataFileAccess {
 U_STABLE void U_EXPORT2
 udata_setFileAccess(UDataFileAccess access, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Asks the operating system to start reading in the parts of the common ICU data
+ * package that resource bundles for the given locales will use:
+ * The bundles for each locale and for its truncation fallbacks, like "de_CH" and "de",
+ * in each resource tree of the package (locale data, collation, break iteration etc.),
+ * the root bundles and the pool bundles.
+ * The items are found via the table of contents of the package.
+ *
+ * This can avoid many page faults while an application starts up with a memory-mapped
+ * .dat file that is not yet in the operating system's page cache.
+ * The function does not wait for the data to be read, and does not open any of it.
+ * It has no effect on data that is loaded from individual files,
+ * or on platforms without memory mapping advice.
+ *
+ * @param localeIDs array of ICU locale IDs, like "de_CH" or "zh_Hant_TW";
+ *                  keywords after '@' are ignored
+ * @param count number of locale IDs
+ * @param status An input-output error code.
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+udata_prefetchLocales(const char *const *localeIDs, int32_t count, UErrorCode *status);
+
+/**
+ * Sets how many bytes of decompressed data items ICU keeps after they are closed.
+ *
+ * Items in a .dat package that was written with icupkg --compress are
+ * decompressed into heap memory when they are first opened.
+ * An item stays decompressed while it is open; closed items are kept up to
+ * this many bytes, so that reopening a recently used item is fast,
+ * and the least recently used ones are freed beyond that.
+ * Resource bundles keep their items open as long as they are cached.
+ * The default capacity is 1MB.
+ *
+ * @param capacity number of bytes; 0 frees decompressed items as soon as they are closed
+ * @param status An input-output error code.
+ *               Set to U_ILLEGAL_ARGUMENT_ERROR if the capacity is negative.
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+udata_setDecompressedCacheCapacity(int32_t capacity, UErrorCode *status);
+#endif  // U_HIDE_DRAFT_API
+
 U_CDECL_END
 
 #endif
@@ -594,6 +594,44 @@ class U_COMMON_API UnicodeSet U_FINAL : public UnicodeFilter {
      */
     UnicodeSet& set(UChar32 start, UChar32 end);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Make this object represent the given code point ranges, and no strings.
+     * The ranges must be in ascending order and must not overlap;
+     * adjacent ranges are merged.
+     * This allocates the set's storage once and does not parse or build any pattern,
+     * so it is a cheap way to construct constant sets, such as cached static sets.
+     * A frozen set will not be modified.
+     *
+     * @param ranges pairs of (start, end) code points, each range inclusive
+     * @param length number of UChar32 values in the ranges array,
+     *               twice the number of ranges
+     * @param errorCode Set to U_ILLEGAL_ARGUMENT_ERROR if the length is odd or negative,
+     *                  or if the ranges are out of order, overlap, or contain
+     *                  values outside 0..0x10FFFF. Then the set is not modified.
+     * @return a reference to this set
+     * @draft ICU 64
+     */
+    UnicodeSet &setToRanges(const UChar32 *ranges, int32_t length, UErrorCode &errorCode);
+
+    /**
+     * Make this object represent the code points of the given serialized set, and no strings.
+     * The serialized form (see serialize()) can be built into data and
+     * wrapped with uset_getSerializedSet(); this copies its inversion list
+     * into this set without parsing anything.
+     * Use freeze() on the result for a set that is as fast as one built from a pattern
+     * and frozen.
+     * A frozen set will not be modified.
+     *
+     * @param set the serialized set
+     * @param errorCode Set to U_ILLEGAL_ARGUMENT_ERROR if the serialized code points
+     *                  are not in strictly ascending order. Then the set is not modified.
+     * @return a reference to this set
+     * @draft ICU 64
+     */
+    UnicodeSet &setToSerialized(const USerializedSet &set, UErrorCode &errorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Return true if the given position, in the given pattern, appears
      * to be the start of a UnicodeSet pattern.
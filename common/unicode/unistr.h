@@ -77,6 +77,7 @@ U_NAMESPACE_BEGIN
 class Locale;               // unicode/locid.h
 class StringCharacterIterator;
 class UnicodeStringAppendable;  // unicode/appendable.h
+class UnicodeStringArena;       // unicode/unistrarena.h
 
 /* The <iostream> include has been moved to unicode/ustream.h */
 
@@ -2780,7 +2781,8 @@ class U_COMMON_API UnicodeString : public Replaceable
    * @param locale    The locale to consider.
    * @param options   Options bit set, usually 0. See U_TITLECASE_NO_LOWERCASE,
    *                  U_TITLECASE_NO_BREAK_ADJUSTMENT, U_TITLECASE_ADJUST_TO_CASED,
-   *                  U_TITLECASE_WHOLE_STRING, U_TITLECASE_SENTENCES.
+   *                  U_TITLECASE_WHOLE_STRING, U_TITLECASE_SENTENCES,
+   *                  U_TITLECASE_WHITE_SPACE_WORDS.
    * @param options Options bit set, see ucasemap_open().
    * @return A reference to this.
    * @stable ICU 3.8
@@ -3341,6 +3343,35 @@ class U_COMMON_API UnicodeString : public Replaceable
    */
   UnicodeString(const UnicodeString& src, int32_t srcStart, int32_t srcLength);
 
+#ifndef U_HIDE_DRAFT_API
+  /**
+   * Constructs an empty string whose buffer is allocated from the arena.
+   * When the string grows, its larger buffers are also allocated from the arena.
+   * The arena must outlive this string.
+   * Copies of this string use heap buffers.
+   *
+   * @param arena The arena for the buffers of this string.
+   * @param capacity The number of char16_ts this string should be able to hold
+   *        before it needs to grow.
+   * @draft ICU 64
+   * @see UnicodeStringArena
+   */
+  explicit UnicodeString(UnicodeStringArena &arena, int32_t capacity = 0);
+
+  /**
+   * Constructs a string with a copy of the contents of src,
+   * with a buffer that is allocated from the arena.
+   * When the string grows, its larger buffers are also allocated from the arena.
+   * The arena must outlive this string.
+   *
+   * @param arena The arena for the buffers of this string.
+   * @param src The UnicodeString object to copy.
+   * @draft ICU 64
+   * @see UnicodeStringArena
+   */
+  UnicodeString(UnicodeStringArena &arena, const UnicodeString &src);
+#endif  // U_HIDE_DRAFT_API
+
   /**
    * Clone this object, an instance of a subclass of Replaceable.
    * Clones can be used concurrently in multiple threads.
@@ -3627,6 +3658,10 @@ class U_COMMON_API UnicodeString : public Replaceable
   // returns boolean for success or failure
   UBool allocate(int32_t capacity);
 
+  // allocate a buffer from the arena, or like allocate(capacity) if arena==NULL;
+  // an arena buffer is never the stack buffer
+  UBool allocate(int32_t capacity, UnicodeStringArena *arena);
+
   // release the array if owned
   void releaseArray(void);
 
@@ -3972,7 +4007,9 @@ UnicodeString::operator== (const UnicodeString& text) const
     return text.isBogus();
   } else {
     int32_t len = length(), textLength = text.length();
-    return !text.isBogus() && len == textLength && doEquals(text, len);
+    return !text.isBogus() && len == textLength &&
+        // Copies of a string often share its buffer.
+        (getArrayStart() == text.getArrayStart() || doEquals(text, len));
   }
 }
 
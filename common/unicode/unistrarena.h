@@ -0,0 +1,106 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// unistrarena.h
+// created: 2026oct14
+
+#ifndef __UNISTRARENA_H__
+#define __UNISTRARENA_H__
+
+#include "unicode/utypes.h"
+#include "unicode/uobject.h"
+
+/**
+ * \file
+ * \brief C++ API: Monotonic allocator for UnicodeString buffers
+ */
+
+U_NAMESPACE_BEGIN
+
+/**
+ * A monotonic allocator for the buffers of short-lived strings.
+ *
+ * A UnicodeString that is constructed with an arena takes its buffer from the arena,
+ * and it also gets the larger buffers for its growth from the same arena.
+ * Buffers are never returned to the arena one at a time:
+ * All of the memory is released together when the arena is destroyed.
+ * This keeps the churn of temporary strings, for example for one formatting request,
+ * away from the global heap.
+ *
+ * The arena first uses the memory that the caller provides, if any.
+ * When that is used up, it allocates blocks from the heap for further buffers.
+ *
+ * The arena must outlive all strings that use its buffers.
+ * A copy of such a string (copy constructor, assignment, fastCopyFrom())
+ * gets a heap buffer and is independent of the arena.
+ * Moving or swapping a string moves its buffer along,
+ * so the target string then also must not outlive the arena.
+ *
+ * An arena must not be used by multiple threads at the same time.
+ *
+ * \code
+ * char buffer[4096];
+ * UnicodeStringArena arena(buffer, sizeof(buffer));
+ * UnicodeString s(arena);
+ * s.append(u"strings built here use the stack buffer of the arena");
+ * \endcode
+ *
+ * @see UnicodeString::UnicodeString(UnicodeStringArena &, int32_t)
+ * @draft ICU 64
+ */
+class U_COMMON_API UnicodeStringArena : public UMemory {
+public:
+    /**
+     * Constructs an arena that allocates all of its memory from the heap,
+     * in blocks that are large enough for many strings.
+     * @draft ICU 64
+     */
+    UnicodeStringArena();
+
+    /**
+     * Constructs an arena that first allocates from the caller's memory.
+     * @param buffer memory for the arena; must remain valid while the arena is in use
+     * @param capacity the number of bytes at buffer
+     * @draft ICU 64
+     */
+    UnicodeStringArena(void *buffer, int32_t capacity);
+
+    /**
+     * Destructor. Releases the heap blocks of the arena.
+     * @draft ICU 64
+     */
+    ~UnicodeStringArena();
+
+    /**
+     * Allocates memory from the arena.
+     * The memory is aligned to a multiple of 16 bytes.
+     * It is released only when the arena is destroyed.
+     * @param length the number of bytes
+     * @return a pointer to the memory, or NULL if length<0 or
+     *         if the memory could not be allocated
+     * @draft ICU 64
+     */
+    void *allocate(int32_t length);
+
+    /**
+     * Returns the number of blocks that the arena has allocated from the heap.
+     * It is 0 as long as the caller's memory was large enough.
+     * @return the number of heap blocks
+     * @draft ICU 64
+     */
+    int32_t getHeapBlockCount() const { return fHeapBlockCount; }
+
+private:
+    UnicodeStringArena(const UnicodeStringArena &) = delete;
+    UnicodeStringArena &operator=(const UnicodeStringArena &) = delete;
+
+    char *fStart;
+    char *fLimit;
+    void *fHeapBlocks;
+    int32_t fHeapBlockCount;
+    int32_t fNextBlockLength;
+};
+
+U_NAMESPACE_END
+
+#endif  // __UNISTRARENA_H__
@@ -58,6 +58,8 @@
 
 /* C exports renaming data */
 
+#define RBBI_compareNodeSets U_ICU_ENTRY_POINT_RENAME(RBBI_compareNodeSets)
+#define RBBI_hashNodeSet U_ICU_ENTRY_POINT_RENAME(RBBI_hashNodeSet)
 #define T_CString_int64ToString U_ICU_ENTRY_POINT_RENAME(T_CString_int64ToString)
 #define T_CString_integerToString U_ICU_ENTRY_POINT_RENAME(T_CString_integerToString)
 #define T_CString_stringToInteger U_ICU_ENTRY_POINT_RENAME(T_CString_stringToInteger)
@@ -186,6 +188,7 @@
 #define pl_resetFontRuns U_ICU_ENTRY_POINT_RENAME(pl_resetFontRuns)
 #define pl_resetLocaleRuns U_ICU_ENTRY_POINT_RENAME(pl_resetLocaleRuns)
 #define pl_resetValueRuns U_ICU_ENTRY_POINT_RENAME(pl_resetValueRuns)
+#define pl_updateText U_ICU_ENTRY_POINT_RENAME(pl_updateText)
 #define res_countArrayItems U_ICU_ENTRY_POINT_RENAME(res_countArrayItems)
 #define res_findResource U_ICU_ENTRY_POINT_RENAME(res_findResource)
 #define res_getAlias U_ICU_ENTRY_POINT_RENAME(res_getAlias)
@@ -236,21 +239,25 @@
 #define u_file_read U_ICU_ENTRY_POINT_RENAME(u_file_read)
 #define u_file_write U_ICU_ENTRY_POINT_RENAME(u_file_write)
 #define u_file_write_flush U_ICU_ENTRY_POINT_RENAME(u_file_write_flush)
+#define u_file_write_utf8 U_ICU_ENTRY_POINT_RENAME(u_file_write_utf8)
 #define u_finit U_ICU_ENTRY_POINT_RENAME(u_finit)
 #define u_flushDefaultConverter U_ICU_ENTRY_POINT_RENAME(u_flushDefaultConverter)
 #define u_foldCase U_ICU_ENTRY_POINT_RENAME(u_foldCase)
 #define u_fopen U_ICU_ENTRY_POINT_RENAME(u_fopen)
+#define u_fopen_mapped U_ICU_ENTRY_POINT_RENAME(u_fopen_mapped)
 #define u_fopen_u U_ICU_ENTRY_POINT_RENAME(u_fopen_u)
 #define u_forDigit U_ICU_ENTRY_POINT_RENAME(u_forDigit)
 #define u_formatMessage U_ICU_ENTRY_POINT_RENAME(u_formatMessage)
 #define u_formatMessageWithError U_ICU_ENTRY_POINT_RENAME(u_formatMessageWithError)
 #define u_fprintf U_ICU_ENTRY_POINT_RENAME(u_fprintf)
+#define u_fprintf_format U_ICU_ENTRY_POINT_RENAME(u_fprintf_format)
 #define u_fprintf_u U_ICU_ENTRY_POINT_RENAME(u_fprintf_u)
 #define u_fputc U_ICU_ENTRY_POINT_RENAME(u_fputc)
 #define u_fputs U_ICU_ENTRY_POINT_RENAME(u_fputs)
 #define u_frewind U_ICU_ENTRY_POINT_RENAME(u_frewind)
 #define u_fscanf U_ICU_ENTRY_POINT_RENAME(u_fscanf)
 #define u_fscanf_u U_ICU_ENTRY_POINT_RENAME(u_fscanf_u)
+#define u_fsetbuffersize U_ICU_ENTRY_POINT_RENAME(u_fsetbuffersize)
 #define u_fsetcodepage U_ICU_ENTRY_POINT_RENAME(u_fsetcodepage)
 #define u_fsetlocale U_ICU_ENTRY_POINT_RENAME(u_fsetlocale)
 #define u_fsettransliterator U_ICU_ENTRY_POINT_RENAME(u_fsettransliterator)
@@ -268,7 +275,11 @@
 #define u_getIntPropertyMaxValue U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyMaxValue)
 #define u_getIntPropertyMinValue U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyMinValue)
 #define u_getIntPropertyValue U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyValue)
+#define u_getIntPropertyValues U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyValues)
+#define u_getIntPropertyValuesUTF8 U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyValuesUTF8)
 #define u_getMainProperties U_ICU_ENTRY_POINT_RENAME(u_getMainProperties)
+#define u_getMemoryTagName U_ICU_ENTRY_POINT_RENAME(u_getMemoryTagName)
+#define u_getMemoryUsage U_ICU_ENTRY_POINT_RENAME(u_getMemoryUsage)
 #define u_getNumericValue U_ICU_ENTRY_POINT_RENAME(u_getNumericValue)
 #define u_getPropertyEnum U_ICU_ENTRY_POINT_RENAME(u_getPropertyEnum)
 #define u_getPropertyName U_ICU_ENTRY_POINT_RENAME(u_getPropertyName)
@@ -281,6 +292,7 @@
 #define u_get_stdout U_ICU_ENTRY_POINT_RENAME(u_get_stdout)
 #define u_hasBinaryProperty U_ICU_ENTRY_POINT_RENAME(u_hasBinaryProperty)
 #define u_init U_ICU_ENTRY_POINT_RENAME(u_init)
+#define u_initServices U_ICU_ENTRY_POINT_RENAME(u_initServices)
 #define u_isIDIgnorable U_ICU_ENTRY_POINT_RENAME(u_isIDIgnorable)
 #define u_isIDPart U_ICU_ENTRY_POINT_RENAME(u_isIDPart)
 #define u_isIDStart U_ICU_ENTRY_POINT_RENAME(u_isIDStart)
@@ -327,9 +339,14 @@
 #define u_memset U_ICU_ENTRY_POINT_RENAME(u_memset)
 #define u_parseMessage U_ICU_ENTRY_POINT_RENAME(u_parseMessage)
 #define u_parseMessageWithError U_ICU_ENTRY_POINT_RENAME(u_parseMessageWithError)
+#define u_popMemoryScope U_ICU_ENTRY_POINT_RENAME(u_popMemoryScope)
 #define u_printf U_ICU_ENTRY_POINT_RENAME(u_printf)
+#define u_printf_closeFormat U_ICU_ENTRY_POINT_RENAME(u_printf_closeFormat)
+#define u_printf_format_compiled U_ICU_ENTRY_POINT_RENAME(u_printf_format_compiled)
+#define u_printf_openFormat U_ICU_ENTRY_POINT_RENAME(u_printf_openFormat)
 #define u_printf_parse U_ICU_ENTRY_POINT_RENAME(u_printf_parse)
 #define u_printf_u U_ICU_ENTRY_POINT_RENAME(u_printf_u)
+#define u_pushMemoryScope U_ICU_ENTRY_POINT_RENAME(u_pushMemoryScope)
 #define u_releaseDefaultConverter U_ICU_ENTRY_POINT_RENAME(u_releaseDefaultConverter)
 #define u_scanf_parse U_ICU_ENTRY_POINT_RENAME(u_scanf_parse)
 #define u_setAtomicIncDecFunctions U_ICU_ENTRY_POINT_RENAME(u_setAtomicIncDecFunctions)
@@ -339,6 +356,7 @@
 #define u_setTimeZoneFilesDirectory U_ICU_ENTRY_POINT_RENAME(u_setTimeZoneFilesDirectory)
 #define u_shapeArabic U_ICU_ENTRY_POINT_RENAME(u_shapeArabic)
 #define u_snprintf U_ICU_ENTRY_POINT_RENAME(u_snprintf)
+#define u_snprintf_format U_ICU_ENTRY_POINT_RENAME(u_snprintf_format)
 #define u_snprintf_u U_ICU_ENTRY_POINT_RENAME(u_snprintf_u)
 #define u_sprintf U_ICU_ENTRY_POINT_RENAME(u_sprintf)
 #define u_sprintf_u U_ICU_ENTRY_POINT_RENAME(u_sprintf_u)
@@ -362,6 +380,7 @@
 #define u_strToJavaModifiedUTF8 U_ICU_ENTRY_POINT_RENAME(u_strToJavaModifiedUTF8)
 #define u_strToLower U_ICU_ENTRY_POINT_RENAME(u_strToLower)
 #define u_strToPunycode U_ICU_ENTRY_POINT_RENAME(u_strToPunycode)
+#define u_strToPunycodeUTF8 U_ICU_ENTRY_POINT_RENAME(u_strToPunycodeUTF8)
 #define u_strToTitle U_ICU_ENTRY_POINT_RENAME(u_strToTitle)
 #define u_strToUTF32 U_ICU_ENTRY_POINT_RENAME(u_strToUTF32)
 #define u_strToUTF32WithSub U_ICU_ENTRY_POINT_RENAME(u_strToUTF32WithSub)
@@ -408,12 +427,14 @@
 #define u_vformatMessage U_ICU_ENTRY_POINT_RENAME(u_vformatMessage)
 #define u_vformatMessageWithError U_ICU_ENTRY_POINT_RENAME(u_vformatMessageWithError)
 #define u_vfprintf U_ICU_ENTRY_POINT_RENAME(u_vfprintf)
+#define u_vfprintf_format U_ICU_ENTRY_POINT_RENAME(u_vfprintf_format)
 #define u_vfprintf_u U_ICU_ENTRY_POINT_RENAME(u_vfprintf_u)
 #define u_vfscanf U_ICU_ENTRY_POINT_RENAME(u_vfscanf)
 #define u_vfscanf_u U_ICU_ENTRY_POINT_RENAME(u_vfscanf_u)
 #define u_vparseMessage U_ICU_ENTRY_POINT_RENAME(u_vparseMessage)
 #define u_vparseMessageWithError U_ICU_ENTRY_POINT_RENAME(u_vparseMessageWithError)
 #define u_vsnprintf U_ICU_ENTRY_POINT_RENAME(u_vsnprintf)
+#define u_vsnprintf_format U_ICU_ENTRY_POINT_RENAME(u_vsnprintf_format)
 #define u_vsnprintf_u U_ICU_ENTRY_POINT_RENAME(u_vsnprintf_u)
 #define u_vsprintf U_ICU_ENTRY_POINT_RENAME(u_vsprintf)
 #define u_vsprintf_u U_ICU_ENTRY_POINT_RENAME(u_vsprintf_u)
@@ -425,6 +446,7 @@
 #define ubidi_countParagraphs U_ICU_ENTRY_POINT_RENAME(ubidi_countParagraphs)
 #define ubidi_countRuns U_ICU_ENTRY_POINT_RENAME(ubidi_countRuns)
 #define ubidi_getBaseDirection U_ICU_ENTRY_POINT_RENAME(ubidi_getBaseDirection)
+#define ubidi_getBufferSize U_ICU_ENTRY_POINT_RENAME(ubidi_getBufferSize)
 #define ubidi_getClass U_ICU_ENTRY_POINT_RENAME(ubidi_getClass)
 #define ubidi_getClassCallback U_ICU_ENTRY_POINT_RENAME(ubidi_getClassCallback)
 #define ubidi_getCustomizedClass U_ICU_ENTRY_POINT_RENAME(ubidi_getCustomizedClass)
@@ -462,6 +484,7 @@
 #define ubidi_isMirrored U_ICU_ENTRY_POINT_RENAME(ubidi_isMirrored)
 #define ubidi_isOrderParagraphsLTR U_ICU_ENTRY_POINT_RENAME(ubidi_isOrderParagraphsLTR)
 #define ubidi_open U_ICU_ENTRY_POINT_RENAME(ubidi_open)
+#define ubidi_openBuffer U_ICU_ENTRY_POINT_RENAME(ubidi_openBuffer)
 #define ubidi_openSized U_ICU_ENTRY_POINT_RENAME(ubidi_openSized)
 #define ubidi_orderParagraphsLTR U_ICU_ENTRY_POINT_RENAME(ubidi_orderParagraphsLTR)
 #define ubidi_reorderLogical U_ICU_ENTRY_POINT_RENAME(ubidi_reorderLogical)
@@ -486,6 +509,7 @@
 #define ubrk_following U_ICU_ENTRY_POINT_RENAME(ubrk_following)
 #define ubrk_getAvailable U_ICU_ENTRY_POINT_RENAME(ubrk_getAvailable)
 #define ubrk_getBinaryRules U_ICU_ENTRY_POINT_RENAME(ubrk_getBinaryRules)
+#define ubrk_getBoundaries U_ICU_ENTRY_POINT_RENAME(ubrk_getBoundaries)
 #define ubrk_getLocaleByType U_ICU_ENTRY_POINT_RENAME(ubrk_getLocaleByType)
 #define ubrk_getRuleStatus U_ICU_ENTRY_POINT_RENAME(ubrk_getRuleStatus)
 #define ubrk_getRuleStatusVec U_ICU_ENTRY_POINT_RENAME(ubrk_getRuleStatusVec)
@@ -581,6 +605,7 @@
 #define ucasemap_toTitle U_ICU_ENTRY_POINT_RENAME(ucasemap_toTitle)
 #define ucasemap_utf8FoldCase U_ICU_ENTRY_POINT_RENAME(ucasemap_utf8FoldCase)
 #define ucasemap_utf8ToLower U_ICU_ENTRY_POINT_RENAME(ucasemap_utf8ToLower)
+#define ucasemap_utf8ToLowerInPlace U_ICU_ENTRY_POINT_RENAME(ucasemap_utf8ToLowerInPlace)
 #define ucasemap_utf8ToTitle U_ICU_ENTRY_POINT_RENAME(ucasemap_utf8ToTitle)
 #define ucasemap_utf8ToUpper U_ICU_ENTRY_POINT_RENAME(ucasemap_utf8ToUpper)
 #define uchar_addPropertyStarts U_ICU_ENTRY_POINT_RENAME(uchar_addPropertyStarts)
@@ -591,6 +616,12 @@
 #define ucln_io_registerCleanup U_ICU_ENTRY_POINT_RENAME(ucln_io_registerCleanup)
 #define ucln_lib_cleanup U_ICU_ENTRY_POINT_RENAME(ucln_lib_cleanup)
 #define ucln_registerCleanup U_ICU_ENTRY_POINT_RENAME(ucln_registerCleanup)
+#define ucmpdata_compressItem U_ICU_ENTRY_POINT_RENAME(ucmpdata_compressItem)
+#define ucmpdata_decompress U_ICU_ENTRY_POINT_RENAME(ucmpdata_decompress)
+#define ucmpdata_getCompressedBytes U_ICU_ENTRY_POINT_RENAME(ucmpdata_getCompressedBytes)
+#define ucmpdata_isCompressedItem U_ICU_ENTRY_POINT_RENAME(ucmpdata_isCompressedItem)
+#define ucmpdata_openItem U_ICU_ENTRY_POINT_RENAME(ucmpdata_openItem)
+#define ucmpdata_releaseItem U_ICU_ENTRY_POINT_RENAME(ucmpdata_releaseItem)
 #define ucnv_MBCSFromUChar32 U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSFromUChar32)
 #define ucnv_MBCSFromUnicodeWithOffsets U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSFromUnicodeWithOffsets)
 #define ucnv_MBCSGetFilteredUnicodeSetForUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSGetFilteredUnicodeSetForUnicode)
@@ -598,6 +629,7 @@
 #define ucnv_MBCSGetUnicodeSetForUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSGetUnicodeSetForUnicode)
 #define ucnv_MBCSIsLeadByte U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSIsLeadByte)
 #define ucnv_MBCSSimpleGetNextUChar U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSSimpleGetNextUChar)
+#define ucnv_MBCSSwapLFNL U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSSwapLFNL)
 #define ucnv_MBCSToUnicodeWithOffsets U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSToUnicodeWithOffsets)
 #define ucnv_bld_countAvailableConverters U_ICU_ENTRY_POINT_RENAME(ucnv_bld_countAvailableConverters)
 #define ucnv_bld_getAvailableConverter U_ICU_ENTRY_POINT_RENAME(ucnv_bld_getAvailableConverter)
@@ -608,6 +640,7 @@
 #define ucnv_cbToUWriteSub U_ICU_ENTRY_POINT_RENAME(ucnv_cbToUWriteSub)
 #define ucnv_cbToUWriteUChars U_ICU_ENTRY_POINT_RENAME(ucnv_cbToUWriteUChars)
 #define ucnv_close U_ICU_ENTRY_POINT_RENAME(ucnv_close)
+#define ucnv_closePool U_ICU_ENTRY_POINT_RENAME(ucnv_closePool)
 #define ucnv_compareNames U_ICU_ENTRY_POINT_RENAME(ucnv_compareNames)
 #define ucnv_convert U_ICU_ENTRY_POINT_RENAME(ucnv_convert)
 #define ucnv_convertEx U_ICU_ENTRY_POINT_RENAME(ucnv_convertEx)
@@ -625,11 +658,13 @@
 #define ucnv_extGetUnicodeSet U_ICU_ENTRY_POINT_RENAME(ucnv_extGetUnicodeSet)
 #define ucnv_extInitialMatchFromU U_ICU_ENTRY_POINT_RENAME(ucnv_extInitialMatchFromU)
 #define ucnv_extInitialMatchToU U_ICU_ENTRY_POINT_RENAME(ucnv_extInitialMatchToU)
+#define ucnv_extInitialMatchToUCodePoint U_ICU_ENTRY_POINT_RENAME(ucnv_extInitialMatchToUCodePoint)
 #define ucnv_extSimpleMatchFromU U_ICU_ENTRY_POINT_RENAME(ucnv_extSimpleMatchFromU)
 #define ucnv_extSimpleMatchToU U_ICU_ENTRY_POINT_RENAME(ucnv_extSimpleMatchToU)
 #define ucnv_fixFileSeparator U_ICU_ENTRY_POINT_RENAME(ucnv_fixFileSeparator)
 #define ucnv_flushCache U_ICU_ENTRY_POINT_RENAME(ucnv_flushCache)
 #define ucnv_fromAlgorithmic U_ICU_ENTRY_POINT_RENAME(ucnv_fromAlgorithmic)
+#define ucnv_fromUAsciiRun U_ICU_ENTRY_POINT_RENAME(ucnv_fromUAsciiRun)
 #define ucnv_fromUChars U_ICU_ENTRY_POINT_RENAME(ucnv_fromUChars)
 #define ucnv_fromUCountPending U_ICU_ENTRY_POINT_RENAME(ucnv_fromUCountPending)
 #define ucnv_fromUWriteBytes U_ICU_ENTRY_POINT_RENAME(ucnv_fromUWriteBytes)
@@ -673,12 +708,17 @@
 #define ucnv_openAllNames U_ICU_ENTRY_POINT_RENAME(ucnv_openAllNames)
 #define ucnv_openCCSID U_ICU_ENTRY_POINT_RENAME(ucnv_openCCSID)
 #define ucnv_openPackage U_ICU_ENTRY_POINT_RENAME(ucnv_openPackage)
+#define ucnv_openPool U_ICU_ENTRY_POINT_RENAME(ucnv_openPool)
+#define ucnv_openPooled U_ICU_ENTRY_POINT_RENAME(ucnv_openPooled)
 #define ucnv_openStandardNames U_ICU_ENTRY_POINT_RENAME(ucnv_openStandardNames)
 #define ucnv_openU U_ICU_ENTRY_POINT_RENAME(ucnv_openU)
+#define ucnv_release U_ICU_ENTRY_POINT_RENAME(ucnv_release)
 #define ucnv_reset U_ICU_ENTRY_POINT_RENAME(ucnv_reset)
 #define ucnv_resetFromUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_resetFromUnicode)
 #define ucnv_resetToUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_resetToUnicode)
+#define ucnv_restoreState U_ICU_ENTRY_POINT_RENAME(ucnv_restoreState)
 #define ucnv_safeClone U_ICU_ENTRY_POINT_RENAME(ucnv_safeClone)
+#define ucnv_saveState U_ICU_ENTRY_POINT_RENAME(ucnv_saveState)
 #define ucnv_setDefaultName U_ICU_ENTRY_POINT_RENAME(ucnv_setDefaultName)
 #define ucnv_setFallback U_ICU_ENTRY_POINT_RENAME(ucnv_setFallback)
 #define ucnv_setFromUCallBack U_ICU_ENTRY_POINT_RENAME(ucnv_setFromUCallBack)
@@ -688,6 +728,7 @@
 #define ucnv_swap U_ICU_ENTRY_POINT_RENAME(ucnv_swap)
 #define ucnv_swapAliases U_ICU_ENTRY_POINT_RENAME(ucnv_swapAliases)
 #define ucnv_toAlgorithmic U_ICU_ENTRY_POINT_RENAME(ucnv_toAlgorithmic)
+#define ucnv_toUAsciiRun U_ICU_ENTRY_POINT_RENAME(ucnv_toUAsciiRun)
 #define ucnv_toUChars U_ICU_ENTRY_POINT_RENAME(ucnv_toUChars)
 #define ucnv_toUCountPending U_ICU_ENTRY_POINT_RENAME(ucnv_toUCountPending)
 #define ucnv_toUWriteCodePoint U_ICU_ENTRY_POINT_RENAME(ucnv_toUWriteCodePoint)
@@ -705,12 +746,14 @@
 #define ucol_cloneBinary U_ICU_ENTRY_POINT_RENAME(ucol_cloneBinary)
 #define ucol_close U_ICU_ENTRY_POINT_RENAME(ucol_close)
 #define ucol_closeElements U_ICU_ENTRY_POINT_RENAME(ucol_closeElements)
+#define ucol_closeScratch U_ICU_ENTRY_POINT_RENAME(ucol_closeScratch)
 #define ucol_countAvailable U_ICU_ENTRY_POINT_RENAME(ucol_countAvailable)
 #define ucol_equal U_ICU_ENTRY_POINT_RENAME(ucol_equal)
 #define ucol_equals U_ICU_ENTRY_POINT_RENAME(ucol_equals)
 #define ucol_getAttribute U_ICU_ENTRY_POINT_RENAME(ucol_getAttribute)
 #define ucol_getAvailable U_ICU_ENTRY_POINT_RENAME(ucol_getAvailable)
 #define ucol_getBound U_ICU_ENTRY_POINT_RENAME(ucol_getBound)
+#define ucol_getBoundedSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getBoundedSortKey)
 #define ucol_getContractions U_ICU_ENTRY_POINT_RENAME(ucol_getContractions)
 #define ucol_getContractionsAndExpansions U_ICU_ENTRY_POINT_RENAME(ucol_getContractionsAndExpansions)
 #define ucol_getDisplayName U_ICU_ENTRY_POINT_RENAME(ucol_getDisplayName)
@@ -729,6 +772,10 @@
 #define ucol_getRulesEx U_ICU_ENTRY_POINT_RENAME(ucol_getRulesEx)
 #define ucol_getShortDefinitionString U_ICU_ENTRY_POINT_RENAME(ucol_getShortDefinitionString)
 #define ucol_getSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getSortKey)
+#define ucol_getSortKeyPrefix U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeyPrefix)
+#define ucol_getSortKeyUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeyUTF8)
+#define ucol_getSortKeys U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeys)
+#define ucol_getSortKeysUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeysUTF8)
 #define ucol_getStrength U_ICU_ENTRY_POINT_RENAME(ucol_getStrength)
 #define ucol_getTailoredSet U_ICU_ENTRY_POINT_RENAME(ucol_getTailoredSet)
 #define ucol_getUCAVersion U_ICU_ENTRY_POINT_RENAME(ucol_getUCAVersion)
@@ -749,6 +796,7 @@
 #define ucol_openElements U_ICU_ENTRY_POINT_RENAME(ucol_openElements)
 #define ucol_openFromShortString U_ICU_ENTRY_POINT_RENAME(ucol_openFromShortString)
 #define ucol_openRules U_ICU_ENTRY_POINT_RENAME(ucol_openRules)
+#define ucol_openScratch U_ICU_ENTRY_POINT_RENAME(ucol_openScratch)
 #define ucol_prepareShortStringOpen U_ICU_ENTRY_POINT_RENAME(ucol_prepareShortStringOpen)
 #define ucol_previous U_ICU_ENTRY_POINT_RENAME(ucol_previous)
 #define ucol_primaryOrder U_ICU_ENTRY_POINT_RENAME(ucol_primaryOrder)
@@ -763,9 +811,11 @@
 #define ucol_setStrength U_ICU_ENTRY_POINT_RENAME(ucol_setStrength)
 #define ucol_setText U_ICU_ENTRY_POINT_RENAME(ucol_setText)
 #define ucol_setVariableTop U_ICU_ENTRY_POINT_RENAME(ucol_setVariableTop)
+#define ucol_sortStrings U_ICU_ENTRY_POINT_RENAME(ucol_sortStrings)
 #define ucol_strcoll U_ICU_ENTRY_POINT_RENAME(ucol_strcoll)
 #define ucol_strcollIter U_ICU_ENTRY_POINT_RENAME(ucol_strcollIter)
 #define ucol_strcollUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_strcollUTF8)
+#define ucol_strcollWithScratch U_ICU_ENTRY_POINT_RENAME(ucol_strcollWithScratch)
 #define ucol_swap U_ICU_ENTRY_POINT_RENAME(ucol_swap)
 #define ucol_swapInverseUCA U_ICU_ENTRY_POINT_RENAME(ucol_swapInverseUCA)
 #define ucol_tertiaryOrder U_ICU_ENTRY_POINT_RENAME(ucol_tertiaryOrder)
@@ -786,6 +836,7 @@
 #define ucsdet_close U_ICU_ENTRY_POINT_RENAME(ucsdet_close)
 #define ucsdet_detect U_ICU_ENTRY_POINT_RENAME(ucsdet_detect)
 #define ucsdet_detectAll U_ICU_ENTRY_POINT_RENAME(ucsdet_detectAll)
+#define ucsdet_detectBatch U_ICU_ENTRY_POINT_RENAME(ucsdet_detectBatch)
 #define ucsdet_enableInputFilter U_ICU_ENTRY_POINT_RENAME(ucsdet_enableInputFilter)
 #define ucsdet_getAllDetectableCharsets U_ICU_ENTRY_POINT_RENAME(ucsdet_getAllDetectableCharsets)
 #define ucsdet_getConfidence U_ICU_ENTRY_POINT_RENAME(ucsdet_getConfidence)
@@ -797,6 +848,8 @@
 #define ucsdet_open U_ICU_ENTRY_POINT_RENAME(ucsdet_open)
 #define ucsdet_setDeclaredEncoding U_ICU_ENTRY_POINT_RENAME(ucsdet_setDeclaredEncoding)
 #define ucsdet_setDetectableCharset U_ICU_ENTRY_POINT_RENAME(ucsdet_setDetectableCharset)
+#define ucsdet_setSampleLength U_ICU_ENTRY_POINT_RENAME(ucsdet_setSampleLength)
+#define ucsdet_setStopConfidence U_ICU_ENTRY_POINT_RENAME(ucsdet_setStopConfidence)
 #define ucsdet_setText U_ICU_ENTRY_POINT_RENAME(ucsdet_setText)
 #define ucurr_countCurrencies U_ICU_ENTRY_POINT_RENAME(ucurr_countCurrencies)
 #define ucurr_forLocale U_ICU_ENTRY_POINT_RENAME(ucurr_forLocale)
@@ -822,6 +875,7 @@
 #define udat_countAvailable U_ICU_ENTRY_POINT_RENAME(udat_countAvailable)
 #define udat_countSymbols U_ICU_ENTRY_POINT_RENAME(udat_countSymbols)
 #define udat_format U_ICU_ENTRY_POINT_RENAME(udat_format)
+#define udat_formatBatch U_ICU_ENTRY_POINT_RENAME(udat_formatBatch)
 #define udat_formatCalendar U_ICU_ENTRY_POINT_RENAME(udat_formatCalendar)
 #define udat_formatCalendarForFields U_ICU_ENTRY_POINT_RENAME(udat_formatCalendarForFields)
 #define udat_formatForFields U_ICU_ENTRY_POINT_RENAME(udat_formatForFields)
@@ -851,6 +905,7 @@
 #define udat_toPatternRelativeDate U_ICU_ENTRY_POINT_RENAME(udat_toPatternRelativeDate)
 #define udat_toPatternRelativeTime U_ICU_ENTRY_POINT_RENAME(udat_toPatternRelativeTime)
 #define udat_unregisterOpener U_ICU_ENTRY_POINT_RENAME(udat_unregisterOpener)
+#define udata_buildTOCHashIndex U_ICU_ENTRY_POINT_RENAME(udata_buildTOCHashIndex)
 #define udata_checkCommonData U_ICU_ENTRY_POINT_RENAME(udata_checkCommonData)
 #define udata_close U_ICU_ENTRY_POINT_RENAME(udata_close)
 #define udata_closeSwapper U_ICU_ENTRY_POINT_RENAME(udata_closeSwapper)
@@ -860,15 +915,19 @@
 #define udata_getLength U_ICU_ENTRY_POINT_RENAME(udata_getLength)
 #define udata_getMemory U_ICU_ENTRY_POINT_RENAME(udata_getMemory)
 #define udata_getRawMemory U_ICU_ENTRY_POINT_RENAME(udata_getRawMemory)
+#define udata_getTOCHashIndexSize U_ICU_ENTRY_POINT_RENAME(udata_getTOCHashIndexSize)
+#define udata_hashTOCEntryName U_ICU_ENTRY_POINT_RENAME(udata_hashTOCEntryName)
 #define udata_open U_ICU_ENTRY_POINT_RENAME(udata_open)
 #define udata_openChoice U_ICU_ENTRY_POINT_RENAME(udata_openChoice)
 #define udata_openSwapper U_ICU_ENTRY_POINT_RENAME(udata_openSwapper)
 #define udata_openSwapperForInputData U_ICU_ENTRY_POINT_RENAME(udata_openSwapperForInputData)
+#define udata_prefetchLocales U_ICU_ENTRY_POINT_RENAME(udata_prefetchLocales)
 #define udata_printError U_ICU_ENTRY_POINT_RENAME(udata_printError)
 #define udata_readInt16 U_ICU_ENTRY_POINT_RENAME(udata_readInt16)
 #define udata_readInt32 U_ICU_ENTRY_POINT_RENAME(udata_readInt32)
 #define udata_setAppData U_ICU_ENTRY_POINT_RENAME(udata_setAppData)
 #define udata_setCommonData U_ICU_ENTRY_POINT_RENAME(udata_setCommonData)
+#define udata_setDecompressedCacheCapacity U_ICU_ENTRY_POINT_RENAME(udata_setDecompressedCacheCapacity)
 #define udata_setFileAccess U_ICU_ENTRY_POINT_RENAME(udata_setFileAccess)
 #define udata_swapDataHeader U_ICU_ENTRY_POINT_RENAME(udata_swapDataHeader)
 #define udata_swapInvStringBlock U_ICU_ENTRY_POINT_RENAME(udata_swapInvStringBlock)
@@ -1076,6 +1135,7 @@
 #define uloc_getParent U_ICU_ENTRY_POINT_RENAME(uloc_getParent)
 #define uloc_getScript U_ICU_ENTRY_POINT_RENAME(uloc_getScript)
 #define uloc_getTableStringWithFallback U_ICU_ENTRY_POINT_RENAME(uloc_getTableStringWithFallback)
+#define uloc_getTableStringWithFallbackFromBundle U_ICU_ENTRY_POINT_RENAME(uloc_getTableStringWithFallbackFromBundle)
 #define uloc_getVariant U_ICU_ENTRY_POINT_RENAME(uloc_getVariant)
 #define uloc_isRightToLeft U_ICU_ENTRY_POINT_RENAME(uloc_isRightToLeft)
 #define uloc_minimizeSubtags U_ICU_ENTRY_POINT_RENAME(uloc_minimizeSubtags)
@@ -1206,6 +1266,7 @@
 #define unumf_closeResult U_ICU_ENTRY_POINT_RENAME(unumf_closeResult)
 #define unumf_formatDecimal U_ICU_ENTRY_POINT_RENAME(unumf_formatDecimal)
 #define unumf_formatDouble U_ICU_ENTRY_POINT_RENAME(unumf_formatDouble)
+#define unumf_formatDoubleBatch U_ICU_ENTRY_POINT_RENAME(unumf_formatDoubleBatch)
 #define unumf_formatInt U_ICU_ENTRY_POINT_RENAME(unumf_formatInt)
 #define unumf_openForSkeletonAndLocale U_ICU_ENTRY_POINT_RENAME(unumf_openForSkeletonAndLocale)
 #define unumf_openResult U_ICU_ENTRY_POINT_RENAME(unumf_openResult)
@@ -1253,9 +1314,20 @@
 #define uprops_getSource U_ICU_ENTRY_POINT_RENAME(uprops_getSource)
 #define upropsvec_addPropertyStarts U_ICU_ENTRY_POINT_RENAME(upropsvec_addPropertyStarts)
 #define uprv_add32_overflow U_ICU_ENTRY_POINT_RENAME(uprv_add32_overflow)
+#define uprv_adviseMappedData U_ICU_ENTRY_POINT_RENAME(uprv_adviseMappedData)
 #define uprv_aestrncpy U_ICU_ENTRY_POINT_RENAME(uprv_aestrncpy)
+#define uprv_asciiCaseEqualSpanUChars U_ICU_ENTRY_POINT_RENAME(uprv_asciiCaseEqualSpanUChars)
 #define uprv_asciiFromEbcdic U_ICU_ENTRY_POINT_RENAME(uprv_asciiFromEbcdic)
+#define uprv_asciiFromUChars U_ICU_ENTRY_POINT_RENAME(uprv_asciiFromUChars)
+#define uprv_asciiSpan U_ICU_ENTRY_POINT_RENAME(uprv_asciiSpan)
+#define uprv_asciiSpanInSet U_ICU_ENTRY_POINT_RENAME(uprv_asciiSpanInSet)
+#define uprv_asciiSpanNotUpper U_ICU_ENTRY_POINT_RENAME(uprv_asciiSpanNotUpper)
+#define uprv_asciiSpanNotUpperUChars U_ICU_ENTRY_POINT_RENAME(uprv_asciiSpanNotUpperUChars)
+#define uprv_asciiToLower U_ICU_ENTRY_POINT_RENAME(uprv_asciiToLower)
+#define uprv_asciiToLowerUChars U_ICU_ENTRY_POINT_RENAME(uprv_asciiToLowerUChars)
+#define uprv_asciiToUChars U_ICU_ENTRY_POINT_RENAME(uprv_asciiToUChars)
 #define uprv_asciitolower U_ICU_ENTRY_POINT_RENAME(uprv_asciitolower)
+#define uprv_bytesToUCharsNoSurrogates U_ICU_ENTRY_POINT_RENAME(uprv_bytesToUCharsNoSurrogates)
 #define uprv_calloc U_ICU_ENTRY_POINT_RENAME(uprv_calloc)
 #define uprv_ceil U_ICU_ENTRY_POINT_RENAME(uprv_ceil)
 #define uprv_compareASCIIPropertyNames U_ICU_ENTRY_POINT_RENAME(uprv_compareASCIIPropertyNames)
@@ -1268,6 +1340,7 @@
 #define uprv_convertToPosix U_ICU_ENTRY_POINT_RENAME(uprv_convertToPosix)
 #define uprv_copyAscii U_ICU_ENTRY_POINT_RENAME(uprv_copyAscii)
 #define uprv_copyEbcdic U_ICU_ENTRY_POINT_RENAME(uprv_copyEbcdic)
+#define uprv_countSurrogatePairs U_ICU_ENTRY_POINT_RENAME(uprv_countSurrogatePairs)
 #define uprv_currencyLeads U_ICU_ENTRY_POINT_RENAME(uprv_currencyLeads)
 #define uprv_decContextClearStatus U_ICU_ENTRY_POINT_RENAME(uprv_decContextClearStatus)
 #define uprv_decContextDefault U_ICU_ENTRY_POINT_RENAME(uprv_decContextDefault)
@@ -1355,7 +1428,10 @@
 #define uprv_ebcdicFromAscii U_ICU_ENTRY_POINT_RENAME(uprv_ebcdicFromAscii)
 #define uprv_ebcdicToLowercaseAscii U_ICU_ENTRY_POINT_RENAME(uprv_ebcdicToLowercaseAscii)
 #define uprv_ebcdictolower U_ICU_ENTRY_POINT_RENAME(uprv_ebcdictolower)
+#define uprv_equalPrefixBytes U_ICU_ENTRY_POINT_RENAME(uprv_equalPrefixBytes)
 #define uprv_fabs U_ICU_ENTRY_POINT_RENAME(uprv_fabs)
+#define uprv_findUCharPair U_ICU_ENTRY_POINT_RENAME(uprv_findUCharPair)
+#define uprv_findUChars U_ICU_ENTRY_POINT_RENAME(uprv_findUChars)
 #define uprv_floor U_ICU_ENTRY_POINT_RENAME(uprv_floor)
 #define uprv_fmax U_ICU_ENTRY_POINT_RENAME(uprv_fmax)
 #define uprv_fmin U_ICU_ENTRY_POINT_RENAME(uprv_fmin)
@@ -1379,6 +1455,7 @@
 #define uprv_isNegativeInfinity U_ICU_ENTRY_POINT_RENAME(uprv_isNegativeInfinity)
 #define uprv_isPositiveInfinity U_ICU_ENTRY_POINT_RENAME(uprv_isPositiveInfinity)
 #define uprv_itou U_ICU_ENTRY_POINT_RENAME(uprv_itou)
+#define uprv_latin1SpanNotControlUChars U_ICU_ENTRY_POINT_RENAME(uprv_latin1SpanNotControlUChars)
 #define uprv_log U_ICU_ENTRY_POINT_RENAME(uprv_log)
 #define uprv_malloc U_ICU_ENTRY_POINT_RENAME(uprv_malloc)
 #define uprv_mapFile U_ICU_ENTRY_POINT_RENAME(uprv_mapFile)
@@ -1393,14 +1470,19 @@
 #define uprv_pow U_ICU_ENTRY_POINT_RENAME(uprv_pow)
 #define uprv_pow10 U_ICU_ENTRY_POINT_RENAME(uprv_pow10)
 #define uprv_realloc U_ICU_ENTRY_POINT_RENAME(uprv_realloc)
+#define uprv_resumeMemoryScopes U_ICU_ENTRY_POINT_RENAME(uprv_resumeMemoryScopes)
+#define uprv_setMemoryTag U_ICU_ENTRY_POINT_RENAME(uprv_setMemoryTag)
 #define uprv_round U_ICU_ENTRY_POINT_RENAME(uprv_round)
 #define uprv_sortArray U_ICU_ENTRY_POINT_RENAME(uprv_sortArray)
+#define uprv_spanBytesBelow U_ICU_ENTRY_POINT_RENAME(uprv_spanBytesBelow)
 #define uprv_stableBinarySearch U_ICU_ENTRY_POINT_RENAME(uprv_stableBinarySearch)
 #define uprv_strCompare U_ICU_ENTRY_POINT_RENAME(uprv_strCompare)
+#define uprv_strFindUChar U_ICU_ENTRY_POINT_RENAME(uprv_strFindUChar)
 #define uprv_strdup U_ICU_ENTRY_POINT_RENAME(uprv_strdup)
 #define uprv_stricmp U_ICU_ENTRY_POINT_RENAME(uprv_stricmp)
 #define uprv_strndup U_ICU_ENTRY_POINT_RENAME(uprv_strndup)
 #define uprv_strnicmp U_ICU_ENTRY_POINT_RENAME(uprv_strnicmp)
+#define uprv_suspendMemoryScopes U_ICU_ENTRY_POINT_RENAME(uprv_suspendMemoryScopes)
 #define uprv_syntaxError U_ICU_ENTRY_POINT_RENAME(uprv_syntaxError)
 #define uprv_timezone U_ICU_ENTRY_POINT_RENAME(uprv_timezone)
 #define uprv_toupper U_ICU_ENTRY_POINT_RENAME(uprv_toupper)
@@ -1408,9 +1490,12 @@
 #define uprv_tzname U_ICU_ENTRY_POINT_RENAME(uprv_tzname)
 #define uprv_tzname_clear_cache U_ICU_ENTRY_POINT_RENAME(uprv_tzname_clear_cache)
 #define uprv_tzset U_ICU_ENTRY_POINT_RENAME(uprv_tzset)
+#define uprv_uCharsToBytesNoSurrogates U_ICU_ENTRY_POINT_RENAME(uprv_uCharsToBytesNoSurrogates)
+#define uprv_uCharsToUTF32BytesBMP U_ICU_ENTRY_POINT_RENAME(uprv_uCharsToUTF32BytesBMP)
 #define uprv_uint16Comparator U_ICU_ENTRY_POINT_RENAME(uprv_uint16Comparator)
 #define uprv_uint32Comparator U_ICU_ENTRY_POINT_RENAME(uprv_uint32Comparator)
 #define uprv_unmapFile U_ICU_ENTRY_POINT_RENAME(uprv_unmapFile)
+#define uprv_utf32BytesToUCharsBMP U_ICU_ENTRY_POINT_RENAME(uprv_utf32BytesToUCharsBMP)
 #define upvec_cloneArray U_ICU_ENTRY_POINT_RENAME(upvec_cloneArray)
 #define upvec_close U_ICU_ENTRY_POINT_RENAME(upvec_close)
 #define upvec_compact U_ICU_ENTRY_POINT_RENAME(upvec_compact)
@@ -1434,6 +1519,7 @@
 #define uregex_findNext U_ICU_ENTRY_POINT_RENAME(uregex_findNext)
 #define uregex_flags U_ICU_ENTRY_POINT_RENAME(uregex_flags)
 #define uregex_getFindProgressCallback U_ICU_ENTRY_POINT_RENAME(uregex_getFindProgressCallback)
+#define uregex_getHeapAllocationCount U_ICU_ENTRY_POINT_RENAME(uregex_getHeapAllocationCount)
 #define uregex_getMatchCallback U_ICU_ENTRY_POINT_RENAME(uregex_getMatchCallback)
 #define uregex_getStackLimit U_ICU_ENTRY_POINT_RENAME(uregex_getStackLimit)
 #define uregex_getText U_ICU_ENTRY_POINT_RENAME(uregex_getText)
@@ -1473,6 +1559,7 @@
 #define uregex_setRegion U_ICU_ENTRY_POINT_RENAME(uregex_setRegion)
 #define uregex_setRegion64 U_ICU_ENTRY_POINT_RENAME(uregex_setRegion64)
 #define uregex_setRegionAndStart U_ICU_ENTRY_POINT_RENAME(uregex_setRegionAndStart)
+#define uregex_setStackArena U_ICU_ENTRY_POINT_RENAME(uregex_setStackArena)
 #define uregex_setStackLimit U_ICU_ENTRY_POINT_RENAME(uregex_setStackLimit)
 #define uregex_setText U_ICU_ENTRY_POINT_RENAME(uregex_setText)
 #define uregex_setTimeLimit U_ICU_ENTRY_POINT_RENAME(uregex_setTimeLimit)
@@ -1546,6 +1633,7 @@
 #define ures_openFillIn U_ICU_ENTRY_POINT_RENAME(ures_openFillIn)
 #define ures_openNoDefault U_ICU_ENTRY_POINT_RENAME(ures_openNoDefault)
 #define ures_openU U_ICU_ENTRY_POINT_RENAME(ures_openU)
+#define ures_preload U_ICU_ENTRY_POINT_RENAME(ures_preload)
 #define ures_resetIterator U_ICU_ENTRY_POINT_RENAME(ures_resetIterator)
 #define ures_swap U_ICU_ENTRY_POINT_RENAME(ures_swap)
 #define uscript_breaksBetweenLetters U_ICU_ENTRY_POINT_RENAME(uscript_breaksBetweenLetters)
@@ -1556,6 +1644,8 @@
 #define uscript_getSampleUnicodeString U_ICU_ENTRY_POINT_RENAME(uscript_getSampleUnicodeString)
 #define uscript_getScript U_ICU_ENTRY_POINT_RENAME(uscript_getScript)
 #define uscript_getScriptExtensions U_ICU_ENTRY_POINT_RENAME(uscript_getScriptExtensions)
+#define uscript_getScriptRuns U_ICU_ENTRY_POINT_RENAME(uscript_getScriptRuns)
+#define uscript_getScriptRunsUTF8 U_ICU_ENTRY_POINT_RENAME(uscript_getScriptRunsUTF8)
 #define uscript_getShortName U_ICU_ENTRY_POINT_RENAME(uscript_getShortName)
 #define uscript_getUsage U_ICU_ENTRY_POINT_RENAME(uscript_getUsage)
 #define uscript_hasScript U_ICU_ENTRY_POINT_RENAME(uscript_hasScript)
@@ -1566,6 +1656,8 @@
 #define uscript_resetRun U_ICU_ENTRY_POINT_RENAME(uscript_resetRun)
 #define uscript_setRunText U_ICU_ENTRY_POINT_RENAME(uscript_setRunText)
 #define usearch_close U_ICU_ENTRY_POINT_RENAME(usearch_close)
+#define usearch_closeMulti U_ICU_ENTRY_POINT_RENAME(usearch_closeMulti)
+#define usearch_findAllMulti U_ICU_ENTRY_POINT_RENAME(usearch_findAllMulti)
 #define usearch_first U_ICU_ENTRY_POINT_RENAME(usearch_first)
 #define usearch_following U_ICU_ENTRY_POINT_RENAME(usearch_following)
 #define usearch_getAttribute U_ICU_ENTRY_POINT_RENAME(usearch_getAttribute)
@@ -1585,6 +1677,7 @@
 #define usearch_next U_ICU_ENTRY_POINT_RENAME(usearch_next)
 #define usearch_open U_ICU_ENTRY_POINT_RENAME(usearch_open)
 #define usearch_openFromCollator U_ICU_ENTRY_POINT_RENAME(usearch_openFromCollator)
+#define usearch_openMulti U_ICU_ENTRY_POINT_RENAME(usearch_openMulti)
 #define usearch_preceding U_ICU_ENTRY_POINT_RENAME(usearch_preceding)
 #define usearch_previous U_ICU_ENTRY_POINT_RENAME(usearch_previous)
 #define usearch_reset U_ICU_ENTRY_POINT_RENAME(usearch_reset)
@@ -1634,6 +1727,8 @@
 #define uset_openEmpty U_ICU_ENTRY_POINT_RENAME(uset_openEmpty)
 #define uset_openPattern U_ICU_ENTRY_POINT_RENAME(uset_openPattern)
 #define uset_openPatternOptions U_ICU_ENTRY_POINT_RENAME(uset_openPatternOptions)
+#define uset_openRanges U_ICU_ENTRY_POINT_RENAME(uset_openRanges)
+#define uset_openSerialized U_ICU_ENTRY_POINT_RENAME(uset_openSerialized)
 #define uset_remove U_ICU_ENTRY_POINT_RENAME(uset_remove)
 #define uset_removeAll U_ICU_ENTRY_POINT_RENAME(uset_removeAll)
 #define uset_removeAllStrings U_ICU_ENTRY_POINT_RENAME(uset_removeAllStrings)
@@ -1659,6 +1754,8 @@
 #define uspoof_check2 U_ICU_ENTRY_POINT_RENAME(uspoof_check2)
 #define uspoof_check2UTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_check2UTF8)
 #define uspoof_check2UnicodeString U_ICU_ENTRY_POINT_RENAME(uspoof_check2UnicodeString)
+#define uspoof_checkBatch U_ICU_ENTRY_POINT_RENAME(uspoof_checkBatch)
+#define uspoof_checkBatchUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_checkBatchUTF8)
 #define uspoof_checkUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_checkUTF8)
 #define uspoof_checkUnicodeString U_ICU_ENTRY_POINT_RENAME(uspoof_checkUnicodeString)
 #define uspoof_clone U_ICU_ENTRY_POINT_RENAME(uspoof_clone)
@@ -1695,7 +1792,10 @@
 #define usprep_open U_ICU_ENTRY_POINT_RENAME(usprep_open)
 #define usprep_openByType U_ICU_ENTRY_POINT_RENAME(usprep_openByType)
 #define usprep_prepare U_ICU_ENTRY_POINT_RENAME(usprep_prepare)
+#define usprep_prepareUTF8 U_ICU_ENTRY_POINT_RENAME(usprep_prepareUTF8)
 #define usprep_swap U_ICU_ENTRY_POINT_RENAME(usprep_swap)
+#define ustr_fastHashCharsN U_ICU_ENTRY_POINT_RENAME(ustr_fastHashCharsN)
+#define ustr_fastHashUCharsN U_ICU_ENTRY_POINT_RENAME(ustr_fastHashUCharsN)
 #define ustr_hashCharsN U_ICU_ENTRY_POINT_RENAME(ustr_hashCharsN)
 #define ustr_hashICharsN U_ICU_ENTRY_POINT_RENAME(ustr_hashICharsN)
 #define ustr_hashUCharsN U_ICU_ENTRY_POINT_RENAME(ustr_hashUCharsN)
@@ -1707,6 +1807,7 @@
 #define ustrcase_internalToUpper U_ICU_ENTRY_POINT_RENAME(ustrcase_internalToUpper)
 #define ustrcase_map U_ICU_ENTRY_POINT_RENAME(ustrcase_map)
 #define ustrcase_mapWithOverlap U_ICU_ENTRY_POINT_RENAME(ustrcase_mapWithOverlap)
+#define ustrcase_releaseTitleBreakIterator U_ICU_ENTRY_POINT_RENAME(ustrcase_releaseTitleBreakIterator)
 #define utext_char32At U_ICU_ENTRY_POINT_RENAME(utext_char32At)
 #define utext_clone U_ICU_ENTRY_POINT_RENAME(utext_clone)
 #define utext_close U_ICU_ENTRY_POINT_RENAME(utext_close)
@@ -1717,6 +1818,8 @@
 #define utext_freeze U_ICU_ENTRY_POINT_RENAME(utext_freeze)
 #define utext_getNativeIndex U_ICU_ENTRY_POINT_RENAME(utext_getNativeIndex)
 #define utext_getPreviousNativeIndex U_ICU_ENTRY_POINT_RENAME(utext_getPreviousNativeIndex)
+#define utext_getUTF8 U_ICU_ENTRY_POINT_RENAME(utext_getUTF8)
+#define utext_getUTF8RefillCount U_ICU_ENTRY_POINT_RENAME(utext_getUTF8RefillCount)
 #define utext_hasMetaData U_ICU_ENTRY_POINT_RENAME(utext_hasMetaData)
 #define utext_isLengthExpensive U_ICU_ENTRY_POINT_RENAME(utext_isLengthExpensive)
 #define utext_isWritable U_ICU_ENTRY_POINT_RENAME(utext_isWritable)
@@ -1728,7 +1831,9 @@
 #define utext_openConstUnicodeString U_ICU_ENTRY_POINT_RENAME(utext_openConstUnicodeString)
 #define utext_openReplaceable U_ICU_ENTRY_POINT_RENAME(utext_openReplaceable)
 #define utext_openUChars U_ICU_ENTRY_POINT_RENAME(utext_openUChars)
+#define utext_openUCharsSegments U_ICU_ENTRY_POINT_RENAME(utext_openUCharsSegments)
 #define utext_openUTF8 U_ICU_ENTRY_POINT_RENAME(utext_openUTF8)
+#define utext_openUTF8Segments U_ICU_ENTRY_POINT_RENAME(utext_openUTF8Segments)
 #define utext_openUnicodeString U_ICU_ENTRY_POINT_RENAME(utext_openUnicodeString)
 #define utext_previous32 U_ICU_ENTRY_POINT_RENAME(utext_previous32)
 #define utext_previous32From U_ICU_ENTRY_POINT_RENAME(utext_previous32From)
@@ -1743,6 +1848,7 @@
 #define utmscale_fromInt64 U_ICU_ENTRY_POINT_RENAME(utmscale_fromInt64)
 #define utmscale_getTimeScaleValue U_ICU_ENTRY_POINT_RENAME(utmscale_getTimeScaleValue)
 #define utmscale_toInt64 U_ICU_ENTRY_POINT_RENAME(utmscale_toInt64)
+#define utrace_addMetric U_ICU_ENTRY_POINT_RENAME(utrace_addMetric)
 #define utrace_cleanup U_ICU_ENTRY_POINT_RENAME(utrace_cleanup)
 #define utrace_data U_ICU_ENTRY_POINT_RENAME(utrace_data)
 #define utrace_entry U_ICU_ENTRY_POINT_RENAME(utrace_entry)
@@ -1751,6 +1857,11 @@
 #define utrace_functionName U_ICU_ENTRY_POINT_RENAME(utrace_functionName)
 #define utrace_getFunctions U_ICU_ENTRY_POINT_RENAME(utrace_getFunctions)
 #define utrace_getLevel U_ICU_ENTRY_POINT_RENAME(utrace_getLevel)
+#define utrace_getMetrics U_ICU_ENTRY_POINT_RENAME(utrace_getMetrics)
+#define utrace_getMutexStats U_ICU_ENTRY_POINT_RENAME(utrace_getMutexStats)
+#define utrace_metricName U_ICU_ENTRY_POINT_RENAME(utrace_metricName)
+#define utrace_resetMetrics U_ICU_ENTRY_POINT_RENAME(utrace_resetMetrics)
+#define utrace_resetMutexStats U_ICU_ENTRY_POINT_RENAME(utrace_resetMutexStats)
 #define utrace_setFunctions U_ICU_ENTRY_POINT_RENAME(utrace_setFunctions)
 #define utrace_setLevel U_ICU_ENTRY_POINT_RENAME(utrace_setLevel)
 #define utrace_vformat U_ICU_ENTRY_POINT_RENAME(utrace_vformat)
@@ -1774,6 +1885,7 @@
 #define utrans_transIncremental U_ICU_ENTRY_POINT_RENAME(utrans_transIncremental)
 #define utrans_transIncrementalUChars U_ICU_ENTRY_POINT_RENAME(utrans_transIncrementalUChars)
 #define utrans_transUChars U_ICU_ENTRY_POINT_RENAME(utrans_transUChars)
+#define utrans_transUTF8 U_ICU_ENTRY_POINT_RENAME(utrans_transUTF8)
 #define utrans_transliterator_cleanup U_ICU_ENTRY_POINT_RENAME(utrans_transliterator_cleanup)
 #define utrans_unregister U_ICU_ENTRY_POINT_RENAME(utrans_unregister)
 #define utrans_unregisterID U_ICU_ENTRY_POINT_RENAME(utrans_unregisterID)
@@ -888,8 +888,44 @@ ures_getUnicodeStringByKey(const UResourceBundle *resB, const char* key, UErrorC
     return result;
 }
 
+class ResourceSink;
+
 U_NAMESPACE_END
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Enumerates the items of a table or array resource, with fallback to parent bundles,
+ * without creating a UResourceBundle for each item.
+ *
+ * The sink's put() is called once for the resource in the given bundle,
+ * then once for the same resource in each parent bundle up to the root bundle,
+ * as long as the parent bundle has that resource.
+ * The sink iterates over the items via icu::ResourceValue::getTable() or getArray().
+ * Keys and string values are read-only pointers into the resource data,
+ * valid while the bundle is open.
+ * A child bundle's items are visited before its parent's; the sink should
+ * keep the first value it sees for each key and treat a no-inheritance marker
+ * (see icu::ResourceValue::isNoInheritanceMarker()) as an item that blocks the
+ * parent's value.
+ *
+ * This is much faster than ures_getNextResource() or ures_getByKeyWithFallback()
+ * loops over large tables such as time zone names or currency names.
+ *
+ * @param bundle    a resource bundle, for example from ures_open()
+ * @param path      "/"-separated path to the table or array resource
+ *                  within the bundle, or "" for the bundle itself
+ * @param sink      receives the items
+ * @param errorCode in/out ICU error code.
+ *                  U_MISSING_RESOURCE_ERROR if the bundle and its parents
+ *                  do not have the path.
+ * @see icu::ResourceSink
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ures_getAllItemsWithFallback(const UResourceBundle *bundle, const char *path,
+                             icu::ResourceSink &sink, UErrorCode &errorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 #endif
 
 /**
@@ -903,6 +939,32 @@ U_NAMESPACE_END
 U_STABLE UEnumeration* U_EXPORT2
 ures_openAvailableLocales(const char *packageName, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Loads the resource bundles of the given locales into the resource bundle cache,
+ * using several threads. For each locale, this opens the bundles of the main locale
+ * data and of the collation, break iteration, time zone name and currency trees.
+ * The threads page in the data of the bundles in parallel, so that their disk reads
+ * and page faults overlap, rather than taking turns inside ures_open().
+ *
+ * Call this at application startup, for example before u_initServices()
+ * or from a background thread, so that later ures_open() calls find the bundles
+ * in the cache. The bundles stay cached until u_cleanup().
+ *
+ * @param locales       NULL-terminated array of locale IDs.
+ * @param threadCount   The number of threads to use, including the calling one.
+ *                      With 1, all bundles are loaded on the calling thread.
+ * @param status        Receives errors. U_ILLEGAL_ARGUMENT_ERROR if locales is NULL
+ *                      or threadCount is less than 1. A bundle that does not exist
+ *                      does not set an error.
+ * @return the number of bundles that were found for their locales
+ *         or for a parent locale other than the root locale
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ures_preload(const char * const *locales, int32_t threadCount, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 #endif /*_URES*/
 /*eof*/
@@ -584,6 +584,87 @@ uscript_getScriptExtensions(UChar32 c,
                             UScriptCode *scripts, int32_t capacity,
                             UErrorCode *errorCode);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * A run of text in a single script, as found by uscript_getScriptRuns().
+ *
+ * @draft ICU 64
+ */
+typedef struct UScriptRunInfo {
+    /** Index of the first code unit of the run. @draft ICU 64 */
+    int32_t start;
+    /** Index after the last code unit of the run. @draft ICU 64 */
+    int32_t limit;
+    /**
+     * The script of the run.
+     * USCRIPT_COMMON if the run contains only Common and Inherited characters.
+     * @draft ICU 64
+     */
+    UScriptCode script;
+} UScriptRunInfo;
+
+/**
+ * Segments a UTF-16 string into script runs, taking Script_Extensions into account.
+ *
+ * Each code point is looked up once.
+ * A character with Script_Extensions continues the run if one of its
+ * extension scripts is one of the scripts still possible for the run,
+ * and narrows down the possible scripts to those.
+ * For example, U+30FC KATAKANA-HIRAGANA PROLONGED SOUND MARK continues
+ * both Hiragana and Katakana runs.
+ * Common and Inherited characters without Script_Extensions continue any run.
+ * The run script is the first script-specific character's Script value
+ * if that is still possible at the end of the run,
+ * or else the lowest-numbered script that is still possible.
+ *
+ * Unpaired surrogates are treated like unassigned code points (USCRIPT_UNKNOWN).
+ *
+ * Unlike the internal UScriptRun iterator, this function does not
+ * assign paired punctuation to the script of the matching opening punctuation.
+ *
+ * @param s the string
+ * @param length the length of the string, or -1 if it is NUL-terminated
+ * @param runs output array for the runs
+ * @param capacity capacity of the runs array
+ * @param errorCode Standard ICU error code. Its input value must
+ *                  pass the U_SUCCESS() test, or else the function returns
+ *                  immediately. Check for U_FAILURE() on output or use with
+ *                  function chaining. (See User Guide for details.)
+ * @return the number of runs,
+ *         written to runs unless U_BUFFER_OVERFLOW_ERROR indicates insufficient capacity
+ * @see uscript_getScriptExtensions
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+uscript_getScriptRuns(const UChar *s, int32_t length,
+                      UScriptRunInfo *runs, int32_t capacity,
+                      UErrorCode *errorCode);
+
+/**
+ * Segments a UTF-8 string into script runs, taking Script_Extensions into account.
+ * Same as uscript_getScriptRuns() except for the string encoding;
+ * run start and limit are byte indexes.
+ * Each maximal subpart of an ill-formed sequence is treated like
+ * an unassigned code point (USCRIPT_UNKNOWN).
+ *
+ * @param s the UTF-8 string
+ * @param length the length of the string in bytes, or -1 if it is NUL-terminated
+ * @param runs output array for the runs
+ * @param capacity capacity of the runs array
+ * @param errorCode Standard ICU error code
+ * @return the number of runs,
+ *         written to runs unless U_BUFFER_OVERFLOW_ERROR indicates insufficient capacity
+ * @see uscript_getScriptRuns
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+uscript_getScriptRunsUTF8(const char *s, int32_t length,
+                          UScriptRunInfo *runs, int32_t capacity,
+                          UErrorCode *errorCode);
+
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Script usage constants.
  * See UAX #31 Unicode Identifier and Pattern Syntax.
@@ -305,6 +305,42 @@ uset_openPatternOptions(const UChar* pattern, int32_t patternLength,
                  uint32_t options,
                  UErrorCode* ec);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Creates a set that contains the given code point ranges.
+ * Unlike uset_openPattern(), this does not parse anything,
+ * and it allocates the set's storage only once.
+ * @param ranges pairs of (start, end) code points, each range inclusive;
+ *               in ascending order, not overlapping (adjacent ranges are merged)
+ * @param length number of UChar32 values in the ranges array,
+ *               twice the number of ranges
+ * @param ec the error code; set to U_ILLEGAL_ARGUMENT_ERROR if the length is odd
+ *           or the ranges are out of order, overlap, or are not valid code points
+ * @return a newly created USet, or NULL if an error occurred.
+ *         The caller must call uset_close() on it when done.
+ * @see UnicodeSet::setToRanges
+ * @draft ICU 64
+ */
+U_DRAFT USet* U_EXPORT2
+uset_openRanges(const UChar32 *ranges, int32_t length, UErrorCode *ec);
+
+/**
+ * Creates a set that contains the code points of the given serialized set.
+ * Together with uset_serialize() and uset_getSerializedSet(), this
+ * turns precomputed data into a set, for example to be frozen and cached,
+ * without parsing a pattern or evaluating properties.
+ * @param set the serialized set
+ * @param ec the error code; set to U_ILLEGAL_ARGUMENT_ERROR if the serialized
+ *           code points are not in strictly ascending order
+ * @return a newly created USet, or NULL if an error occurred.
+ *         The caller must call uset_close() on it when done.
+ * @see UnicodeSet::setToSerialized
+ * @draft ICU 64
+ */
+U_DRAFT USet* U_EXPORT2
+uset_openSerialized(const USerializedSet *set, UErrorCode *ec);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Disposes of the storage used by a USet object.  This function should
  * be called exactly once for objects returned by uset_open().
@@ -265,6 +265,37 @@ usprep_prepare(   const UStringPrepProfile* prep,
                   UParseError* parseError,
                   UErrorCode* status );
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Prepare a UTF-8 string for use in applications with the given profile.
+ * Same as usprep_prepare() but with UTF-8 input and output.
+ * ASCII strings are prepared without conversion to UTF-16.
+ *
+ * @param prep          The profile to use 
+ * @param src           Pointer to the UTF-8 string to prepare
+ * @param srcLength     Length of the source string in bytes, or -1 if NUL-terminated
+ * @param dest          Pointer to the destination buffer to receive the UTF-8 output
+ * @param destCapacity  The capacity of destination array, in bytes
+ * @param options       A bit set of options, as for usprep_prepare()
+ * @param parseError        Pointer to UParseError struct to receive information on position 
+ *                          of error if an error is encountered. Can be NULL.
+ *                          The offset and context refer to the string in UTF-16.
+ * @param status            ICU in/out error code parameter.
+ *                          U_INVALID_CHAR_FOUND if src is not well-formed UTF-8.
+ *                          U_BUFFER_OVERFLOW_ERROR if destCapacity is not enough
+ * @return The number of bytes in the destination buffer
+ * @see usprep_prepare
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+usprep_prepareUTF8(const UStringPrepProfile* prep,
+                   const char* src, int32_t srcLength,
+                   char* dest, int32_t destCapacity,
+                   int32_t options,
+                   UParseError* parseError,
+                   UErrorCode* status );
+#endif  /* U_HIDE_DRAFT_API */
+
 
 #endif /* #if !UCONFIG_NO_IDNA */
 
@@ -226,6 +226,34 @@ U_NAMESPACE_END
 U_STABLE UText * U_EXPORT2
 utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Returns the UTF-8 string of a UText that was opened with utext_openUTF8(),
+ * or of a clone of one, for code that reads the bytes directly.
+ * The native indexes of such a UText are byte offsets into this string.
+ * Its length is utext_nativeLength().
+ *
+ * @param ut  the UText
+ * @return the UTF-8 string, or NULL if the UText does not wrap one
+ * @internal ICU 64 technology preview
+ */
+U_INTERNAL const char * U_EXPORT2
+utext_getUTF8(const UText *ut);
+
+/**
+ * Returns how many times a UText that was opened with utext_openUTF8()
+ * has converted a chunk of its UTF-8 string to UTF-16,
+ * for measuring the cost of an access pattern.
+ * The count is reset by utext_openUTF8() and copied by utext_clone().
+ *
+ * @param ut  the UText
+ * @return the number of chunk refills, or -1 if the UText does not wrap a UTF-8 string
+ * @internal ICU 64 technology preview
+ */
+U_INTERNAL int64_t U_EXPORT2
+utext_getUTF8RefillCount(const UText *ut);
+#endif  /* U_HIDE_INTERNAL_API */
+
 
 /**
  * Open a read-only UText for UChar * string.
@@ -244,6 +272,62 @@ utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status);
 U_STABLE UText * U_EXPORT2
 utext_openUChars(UText *ut, const UChar *s, int64_t length, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Open a read-only UText for text that is stored in several UTF-8 strings,
+ * for example the pieces of a rope, without concatenating them.
+ * The text is the concatenation of the segments, and its native indexes are
+ * byte offsets into that concatenation.
+ * A character may be split across segments.
+ * Finding the segment for a native index takes O(log count).
+ *
+ * The segments array and the lengths array are copied, but the segment strings are not:
+ * they must stay unchanged and valid while the UText (or a shallow clone of it) is in use.
+ *
+ * @param ut       Pointer to a UText struct.  If NULL, a new UText will be created.
+ *                 If non-NULL, must refer to an initialized UText struct, which will then
+ *                 be reset to reference the specified segments.
+ * @param segments An array of count UTF-8 strings.
+ * @param lengths  The lengths of the segments in bytes, or -1 for a zero terminated segment.
+ * @param count    The number of segments.
+ * @param status   Errors are returned here.
+ *                 U_INDEX_OUTOFBOUNDS_ERROR if the total length does not fit into 32 bits.
+ * @return         A pointer to the UText.  If a pre-allocated UText was provided, it
+ *                 will always be used and returned.
+ * @draft ICU 64
+ */
+U_DRAFT UText * U_EXPORT2
+utext_openUTF8Segments(UText *ut, const char * const *segments, const int32_t *lengths,
+                       int32_t count, UErrorCode *status);
+
+/**
+ * Open a read-only UText for text that is stored in several UChar (UTF-16) strings,
+ * for example the pieces of a rope, without concatenating them.
+ * The text is the concatenation of the segments, and its native indexes are
+ * UChar offsets into that concatenation.
+ * A surrogate pair may be split across segments.
+ * Finding the segment for a native index takes O(log count).
+ *
+ * The segments array and the lengths array are copied, but the segment strings are not:
+ * they must stay unchanged and valid while the UText (or a shallow clone of it) is in use.
+ *
+ * @param ut       Pointer to a UText struct.  If NULL, a new UText will be created.
+ *                 If non-NULL, must refer to an initialized UText struct, which will then
+ *                 be reset to reference the specified segments.
+ * @param segments An array of count UChar strings.
+ * @param lengths  The lengths of the segments in UChars, or -1 for a zero terminated segment.
+ * @param count    The number of segments.
+ * @param status   Errors are returned here.
+ *                 U_INDEX_OUTOFBOUNDS_ERROR if the total length does not fit into 32 bits.
+ * @return         A pointer to the UText.  If a pre-allocated UText was provided, it
+ *                 will always be used and returned.
+ * @draft ICU 64
+ */
+U_DRAFT UText * U_EXPORT2
+utext_openUCharsSegments(UText *ut, const UChar * const *segments, const int32_t *lengths,
+                         int32_t count, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 #if U_SHOW_CPLUSPLUS_API
 /**
@@ -106,8 +106,55 @@ typedef enum UTraceFunctionNumber {
      * One more than the highest normal collation trace location.
      * @deprecated ICU 58 The numeric value may change over time, see ICU ticket #12420.
      */
-    UTRACE_COLLATION_LIMIT
+    UTRACE_COLLATION_LIMIT,
 #endif  // U_HIDE_DEPRECATED_API
+
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Loading of resource bundles and data files.
+     * Traced at UTRACE_OPEN_CLOSE level, with the bundle or data item names,
+     * so that the entry and exit functions can attribute load times to them.
+     * @draft ICU 64
+     */
+    UTRACE_RESOURCE_START=0x3000,
+    /** ures_open() and related functions, with the package path and locale ID. @draft ICU 64 */
+    UTRACE_URES_OPEN=UTRACE_RESOURCE_START,
+    /** udata_open() and udata_openChoice(), with the package path, type and name. @draft ICU 64 */
+    UTRACE_UDATA_OPEN,
+    /** Memory-mapping of an individual data file or package, with its file path. @draft ICU 64 */
+    UTRACE_UDATA_MAP_FILE,
+    /** ures_preload(), with the number of threads. @draft ICU 64 */
+    UTRACE_URES_PRELOAD,
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * One more than the highest normal resource trace location.
+     * @internal The numeric value may change over time.
+     */
+    UTRACE_RESOURCE_LIMIT,
+#endif  // U_HIDE_INTERNAL_API
+
+    /**
+     * Construction of service objects.
+     * Traced at UTRACE_OPEN_CLOSE level.
+     * @draft ICU 64
+     */
+    UTRACE_SERVICE_START=0x4000,
+    /** BreakIterator::createInstance(), with the locale ID and break iterator type. @draft ICU 64 */
+    UTRACE_UBRK_CREATE=UTRACE_SERVICE_START,
+    /** Compilation of a LocalizedNumberFormatter for repeated use, with the locale ID. @draft ICU 64 */
+    UTRACE_UNUMF_COMPILE,
+    /** Creation of a shared object after a UnifiedCache miss, with the cache key. @draft ICU 64 */
+    UTRACE_UNIFIED_CACHE_CREATE,
+    /** u_initServices(), with the bit set of requested services. @draft ICU 64 */
+    UTRACE_U_INIT_SERVICES,
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * One more than the highest normal service trace location.
+     * @internal The numeric value may change over time.
+     */
+    UTRACE_SERVICE_LIMIT
+#endif  // U_HIDE_INTERNAL_API
+#endif  // U_HIDE_DRAFT_API
 } UTraceFunctionNumber;
 
 /**
@@ -374,6 +421,149 @@ utrace_format(char *outBuf, int32_t capacity,
 U_STABLE const char * U_EXPORT2
 utrace_functionName(int32_t fnNumber);
 
+/* Metrics ------------------------------------------------------------------ */
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Counters for frequent internal ICU operations.
+ *
+ * Unlike function tracing, these do not call back into the application:
+ * Each event increments a counter with a relaxed atomic operation
+ * on one of several per-thread shards, which makes them cheap enough
+ * to leave enabled in production.
+ * The application takes snapshots with utrace_getMetrics().
+ *
+ * The counters are only updated when ICU is built with tracing enabled
+ * (see U_ENABLE_TRACING); otherwise they are always 0.
+ *
+ * @see utrace_getMetrics
+ * @draft ICU 64
+ */
+typedef enum UTraceMetric {
+    /** UnifiedCache lookups that found an object, for example a number formatter's data. @draft ICU 64 */
+    UTRACE_METRIC_UNIFIED_CACHE_HIT,
+    /** UnifiedCache lookups that had to create the object. @draft ICU 64 */
+    UTRACE_METRIC_UNIFIED_CACHE_MISS,
+    /** udata_open() lookups of already-loaded data items. @draft ICU 64 */
+    UTRACE_METRIC_UDATA_CACHE_HIT,
+    /** udata_open() lookups that needed to find and load the data. @draft ICU 64 */
+    UTRACE_METRIC_UDATA_CACHE_MISS,
+    /** Resource bundle lookups of already-loaded bundle files. @draft ICU 64 */
+    UTRACE_METRIC_RESBUND_CACHE_HIT,
+    /** Resource bundle lookups that needed to load a bundle file. @draft ICU 64 */
+    UTRACE_METRIC_RESBUND_CACHE_MISS,
+    /** Converter opens that shared already-loaded converter data. @draft ICU 64 */
+    UTRACE_METRIC_CONVERTER_CACHE_HIT,
+    /** Converter opens that needed to load the converter data. @draft ICU 64 */
+    UTRACE_METRIC_CONVERTER_CACHE_MISS,
+    /** Number of ICU heap allocations and reallocations (uprv_malloc() etc.). @draft ICU 64 */
+    UTRACE_METRIC_ALLOC_COUNT,
+    /** Total number of bytes requested by ICU heap allocations and reallocations. @draft ICU 64 */
+    UTRACE_METRIC_ALLOC_BYTES,
+    /** Number of ICU heap blocks freed. @draft ICU 64 */
+    UTRACE_METRIC_FREE_COUNT,
+    /** Number of ICU mutex locks that had to wait for another thread. @draft ICU 64 */
+    UTRACE_METRIC_MUTEX_WAIT_COUNT,
+    /** Total time in nanoseconds that ICU mutex locks waited for other threads. @draft ICU 64 */
+    UTRACE_METRIC_MUTEX_WAIT_NANOS,
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * One more than the highest metric.
+     * The number of metrics may grow; use the return value of utrace_getMetrics().
+     * @internal
+     */
+    UTRACE_METRIC_LIMIT
+#endif  // U_HIDE_INTERNAL_API
+} UTraceMetric;
+
+/**
+ * Writes a snapshot of the metrics counters, indexed by UTraceMetric values.
+ * The values are sums over all threads since process start or utrace_resetMetrics().
+ * The snapshot is not atomic as a whole: Counters that are updated concurrently
+ * may be slightly inconsistent with each other.
+ *
+ * @param metrics Output array for the counter values. Can be NULL if capacity is 0.
+ * @param capacity The number of elements in the metrics array.
+ *                 If it is smaller than the number of metrics, then only that many are written.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The number of metrics this version of ICU supports.
+ * @see UTraceMetric
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+utrace_getMetrics(int64_t *metrics, int32_t capacity, UErrorCode *status);
+
+/**
+ * Resets all metrics counters to 0.
+ * Counts from operations that run concurrently may or may not be lost.
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+utrace_resetMetrics(void);
+
+/**
+ * Get the name of a metric, for example "unifiedCacheHit".
+ *
+ * @param metric A UTraceMetric value.
+ * @return The name string for the metric.
+ * @see UTraceMetric
+ * @draft ICU 64
+ */
+U_DRAFT const char * U_EXPORT2
+utrace_metricName(int32_t metric);
+
+/**
+ * Lock statistics of one internal ICU mutex.
+ * @see utrace_getMutexStats
+ * @draft ICU 64
+ */
+typedef struct UTraceMutexStats {
+    /**
+     * Name of the mutex, for example "resbMutex" or "UnifiedCache".
+     * NULL for mutexes without a name.
+     * Several mutexes may have the same name, for example the shards of one cache.
+     * @draft ICU 64
+     */
+    const char *name;
+    /** Number of times the mutex was locked. @draft ICU 64 */
+    int64_t acquisitions;
+    /** Number of locks that had to wait for another thread to unlock the mutex. @draft ICU 64 */
+    int64_t contentions;
+    /** Total time in nanoseconds that those locks waited. @draft ICU 64 */
+    int64_t waitNanos;
+} UTraceMutexStats;
+
+/**
+ * Writes the lock statistics of each internal ICU mutex that was locked at least once
+ * since process start. The statistics are the per-mutex breakdown of
+ * UTRACE_METRIC_MUTEX_WAIT_COUNT and UTRACE_METRIC_MUTEX_WAIT_NANOS,
+ * and they show which ICU lock is a bottleneck in a heavily multi-threaded process.
+ *
+ * The statistics are only recorded when ICU is built with tracing enabled
+ * (see U_ENABLE_TRACING) and uses its own mutex implementation;
+ * otherwise this function returns 0.
+ *
+ * @param stats Output array. Can be NULL if capacity is 0.
+ * @param capacity The number of elements in the stats array.
+ *                 If it is smaller than the number of mutexes, then only that many are written.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The number of mutexes with statistics.
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+utrace_getMutexStats(UTraceMutexStats *stats, int32_t capacity, UErrorCode *status);
+
+/**
+ * Resets the counters of all mutex statistics to 0.
+ * @see utrace_getMutexStats
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+utrace_resetMutexStats(void);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 U_CDECL_END
 
 #endif
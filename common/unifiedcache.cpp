@@ -13,21 +13,41 @@
 #include "unifiedcache.h"
 
 #include <algorithm>      // For std::max()
+#include <typeinfo>
 
+#include "cmemory.h"
 #include "mutex.h"
 #include "uassert.h"
 #include "uhash.h"
 #include "ucln_cmn.h"
 #include "umutex.h"
+#include "utracimp.h"
 
 static icu::UnifiedCache *gCache = NULL;
-static UMutex gCacheMutex = U_MUTEX_INITIALIZER;
-static UConditionVar gInProgressValueAddedCond = U_CONDITION_INITIALIZER;
 static icu::UInitOnce gCacheInitOnce = U_INITONCE_INITIALIZER;
 
+// One mutex and condition variable per shard, see UnifiedCache::SHARD_COUNT.
+#define CACHE_MUTEX_4 U_NAMED_MUTEX_INITIALIZER("UnifiedCache"), U_NAMED_MUTEX_INITIALIZER("UnifiedCache"), \
+                      U_NAMED_MUTEX_INITIALIZER("UnifiedCache"), U_NAMED_MUTEX_INITIALIZER("UnifiedCache")
+#define CACHE_COND_4 U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER
+static UMutex gCacheMutex[icu::UnifiedCache::SHARD_COUNT] = {
+    CACHE_MUTEX_4, CACHE_MUTEX_4, CACHE_MUTEX_4, CACHE_MUTEX_4
+};
+static UConditionVar gInProgressValueAddedCond[icu::UnifiedCache::SHARD_COUNT] = {
+    CACHE_COND_4, CACHE_COND_4, CACHE_COND_4, CACHE_COND_4
+};
+#undef CACHE_MUTEX_4
+#undef CACHE_COND_4
+
+// Serializes eviction slices and protects the eviction position.
+// Taken before, never while holding, a gCacheMutex.
+static UMutex gCacheEvictMutex = U_NAMED_MUTEX_INITIALIZER("UnifiedCacheEviction");
+
 static const int32_t MAX_EVICT_ITERATIONS = 10;
 static const int32_t DEFAULT_MAX_UNUSED = 1000;
 static const int32_t DEFAULT_PERCENTAGE_OF_IN_USE = 100;
+// Charged for cached values that do not know their size.
+static const int32_t DEFAULT_VALUE_SIZE = 256;
 
 
 U_CDECL_BEGIN
@@ -92,14 +112,19 @@ UnifiedCache *UnifiedCache::getInstance(UErrorCode &status) {
 }
 
 UnifiedCache::UnifiedCache(UErrorCode &status) :
-        fHashtable(NULL),
-        fEvictPos(UHASH_FIRST),
+        fEvictShard(0),
+        fNumKeys(0),
         fNumValuesTotal(0),
         fNumValuesInUse(0),
         fMaxUnused(DEFAULT_MAX_UNUSED),
         fMaxPercentageOfInUse(DEFAULT_PERCENTAGE_OF_IN_USE),
+        fNumBytes(0),
+        fMaxBytes(0),
         fAutoEvictedCount(0),
         fNoValue(nullptr) {
+    for (int32_t i = 0; i < SHARD_COUNT; ++i) {
+        fEvictPos[i] = UHASH_FIRST;
+    }
     if (U_FAILURE(status)) {
         return;
     }
@@ -111,59 +136,67 @@ UnifiedCache::UnifiedCache(UErrorCode &status) :
     fNoValue->softRefCount = 1;  // Add fake references to prevent fNoValue from being deleted
     fNoValue->hardRefCount = 1;  // when other references to it are removed.
     fNoValue->cachePtr = this;
+}
 
-    fHashtable = uhash_open(
-            &ucache_hashKeys,
-            &ucache_compareKeys,
-            NULL,
-            &status);
+void UnifiedCache::setEvictionPolicy(
+        int32_t count, int32_t percentageOfInUseItems, UErrorCode &status) {
     if (U_FAILURE(status)) {
         return;
     }
-    uhash_setKeyDeleter(fHashtable, &ucache_deleteKey);
+    if (count < 0 || percentageOfInUseItems < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    umtx_storeRelease(fMaxUnused, count);
+    umtx_storeRelease(fMaxPercentageOfInUse, percentageOfInUseItems);
 }
 
-void UnifiedCache::setEvictionPolicy(
-        int32_t count, int32_t percentageOfInUseItems, UErrorCode &status) {
+void UnifiedCache::setMemoryLimit(int32_t maxBytes, UErrorCode &status) {
     if (U_FAILURE(status)) {
         return;
     }
-    if (count < 0 || percentageOfInUseItems < 0) {
+    if (maxBytes < 0) {
         status = U_ILLEGAL_ARGUMENT_ERROR;
         return;
     }
-    Mutex lock(&gCacheMutex);
-    fMaxUnused = count;
-    fMaxPercentageOfInUse = percentageOfInUseItems;
+    umtx_storeRelease(fMaxBytes, maxBytes);
+}
+
+int32_t UnifiedCache::memoryUsage() const {
+    return umtx_loadAcquire(fNumBytes);
 }
 
 int32_t UnifiedCache::unusedCount() const {
-    Mutex lock(&gCacheMutex);
-    return uhash_count(fHashtable) - fNumValuesInUse;
+    return umtx_loadAcquire(fNumKeys) - umtx_loadAcquire(fNumValuesInUse);
 }
 
 int64_t UnifiedCache::autoEvictedCount() const {
-    Mutex lock(&gCacheMutex);
+    Mutex lock(&gCacheEvictMutex);
     return fAutoEvictedCount;
 }
 
 int32_t UnifiedCache::keyCount() const {
-    Mutex lock(&gCacheMutex);
-    return uhash_count(fHashtable);
+    return umtx_loadAcquire(fNumKeys);
 }
 
 void UnifiedCache::flush() const {
-    Mutex lock(&gCacheMutex);
-
     // Use a loop in case cache items that are flushed held hard references to
     // other cache items making those additional cache items eligible for
-    // flushing.
-    while (_flush(FALSE));
+    // flushing. Those may be in any shard.
+    UBool flushed;
+    do {
+        flushed = FALSE;
+        for (int32_t shard = 0; shard < SHARD_COUNT; ++shard) {
+            Mutex lock(&gCacheMutex[shard]);
+            while (_flush(shard, FALSE)) {
+                flushed = TRUE;
+            }
+        }
+    } while (flushed);
 }
 
 void UnifiedCache::handleUnreferencedObject() const {
-    Mutex lock(&gCacheMutex);
-    --fNumValuesInUse;
+    umtx_atomic_dec(&fNumValuesInUse);
     _runEvictionSlice();
 }
 
@@ -181,36 +214,36 @@ void UnifiedCache::dump() {
 }
 
 void UnifiedCache::dumpContents() const {
-    Mutex lock(&gCacheMutex);
     _dumpContents();
 }
 
 // Dumps content of cache.
-// On entry, gCacheMutex must be held.
+// On entry, no gCacheMutex must be held.
 // On exit, cache contents dumped to stderr.
 void UnifiedCache::_dumpContents() const {
-    int32_t pos = UHASH_FIRST;
-    const UHashElement *element = uhash_nextElement(fHashtable, &pos);
     char buffer[256];
     int32_t cnt = 0;
-    for (; element != NULL; element = uhash_nextElement(fHashtable, &pos)) {
-        const SharedObject *sharedObject =
-                (const SharedObject *) element->value.pointer;
-        const CacheKeyBase *key =
-                (const CacheKeyBase *) element->key.pointer;
-        if (sharedObject->hasHardReferences()) {
-            ++cnt;
-            fprintf(
-                    stderr,
-                    "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
-                    key->writeDescription(buffer, 256),
-                    key->creationStatus,
-                    sharedObject == fNoValue ? NULL :sharedObject,
-                    sharedObject->getRefCount(),
-                    sharedObject->getSoftRefCount());
+    for (int32_t shard = 0; shard < SHARD_COUNT; ++shard) {
+        Mutex lock(&gCacheMutex[shard]);
+        int32_t pos = UHASH_FIRST;
+        const Element *element = fTables[shard].nextEntry(pos);
+        for (; element != NULL; element = fTables[shard].nextEntry(pos)) {
+            const SharedObject *sharedObject = element->value;
+            const CacheKeyBase *key = element->key;
+            if (sharedObject->hasHardReferences()) {
+                ++cnt;
+                fprintf(
+                        stderr,
+                        "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
+                        key->writeDescription(buffer, 256),
+                        key->creationStatus,
+                        sharedObject == fNoValue ? NULL :sharedObject,
+                        sharedObject->getRefCount(),
+                        sharedObject->getSoftRefCount());
+            }
         }
     }
-    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, uhash_count(fHashtable));
+    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, keyCount());
 }
 #endif
 
@@ -221,39 +254,41 @@ UnifiedCache::~UnifiedCache() {
         // Now all that should be left in the cache are entries that refer to
         // each other and entries with hard references from outside the cache.
         // Nothing we can do about these so proceed to wipe out the cache.
-        Mutex lock(&gCacheMutex);
-        _flush(TRUE);
+        for (int32_t shard = 0; shard < SHARD_COUNT; ++shard) {
+            Mutex lock(&gCacheMutex[shard]);
+            _flush(shard, TRUE);
+        }
     }
-    uhash_close(fHashtable);
-    fHashtable = nullptr;
     delete fNoValue;
     fNoValue = nullptr;
 }
 
-const UHashElement *
-UnifiedCache::_nextElement() const {
-    const UHashElement *element = uhash_nextElement(fHashtable, &fEvictPos);
+int32_t UnifiedCache::_shardOf(const CacheKeyBase &key) {
+    uint32_t hash = (uint32_t) key.hashCode();
+    return (int32_t) ((hash ^ (hash >> 16)) & (SHARD_COUNT - 1));
+}
+
+const UnifiedCache::Element *
+UnifiedCache::_nextElement(int32_t shard) const {
+    const Element *element = fTables[shard].nextEntry(fEvictPos[shard]);
     if (element == NULL) {
-        fEvictPos = UHASH_FIRST;
-        return uhash_nextElement(fHashtable, &fEvictPos);
+        fEvictPos[shard] = UHASH_FIRST;
+        return fTables[shard].nextEntry(fEvictPos[shard]);
     }
     return element;
 }
 
-UBool UnifiedCache::_flush(UBool all) const {
+UBool UnifiedCache::_flush(int32_t shard, UBool all) const {
     UBool result = FALSE;
-    int32_t origSize = uhash_count(fHashtable);
+    int32_t origSize = fTables[shard].count();
     for (int32_t i = 0; i < origSize; ++i) {
-        const UHashElement *element = _nextElement();
+        const Element *element = _nextElement(shard);
         if (element == nullptr) {
             break;
         }
         if (all || _isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    (const SharedObject *) element->value.pointer;
-            U_ASSERT(sharedObject->cachePtr == this);
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
+            U_ASSERT(element->value->cachePtr == this);
+            _removeElement(shard, element);
             result = TRUE;
         }
     }
@@ -261,39 +296,77 @@ UBool UnifiedCache::_flush(UBool all) const {
 }
 
 int32_t UnifiedCache::_computeCountOfItemsToEvict() const {
-    int32_t totalItems = uhash_count(fHashtable);
-    int32_t evictableItems = totalItems - fNumValuesInUse;
+    int32_t numValuesInUse = umtx_loadAcquire(fNumValuesInUse);
+    int32_t totalItems = umtx_loadAcquire(fNumKeys);
+    int32_t evictableItems = totalItems - numValuesInUse;
 
-    int32_t unusedLimitByPercentage = fNumValuesInUse * fMaxPercentageOfInUse / 100;
-    int32_t unusedLimit = std::max(unusedLimitByPercentage, fMaxUnused);
+    int32_t unusedLimitByPercentage =
+            numValuesInUse * umtx_loadAcquire(fMaxPercentageOfInUse) / 100;
+    int32_t unusedLimit = std::max(unusedLimitByPercentage, umtx_loadAcquire(fMaxUnused));
     int32_t countOfItemsToEvict = std::max(0, evictableItems - unusedLimit);
     return countOfItemsToEvict;
 }
 
+UBool UnifiedCache::_isOverMemoryLimit() const {
+    int32_t maxBytes = umtx_loadAcquire(fMaxBytes);
+    return maxBytes > 0 && umtx_loadAcquire(fNumBytes) > maxBytes &&
+            umtx_loadAcquire(fNumKeys) > umtx_loadAcquire(fNumValuesInUse);
+}
+
+void UnifiedCache::_removeElement(int32_t shard, const Element *element) const {
+    const CacheKeyBase *key = element->key;
+    const SharedObject *sharedObject = element->value;
+    if (key->fIsMaster) {
+        umtx_atomic_add(&fNumBytes, -key->fValueSize);
+    }
+    delete key;
+    fTables[shard].removeEntry(element);
+    umtx_atomic_dec(&fNumKeys);
+    removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
+}
+
 void UnifiedCache::_runEvictionSlice() const {
+    // Cache hits and releases usually stop here, without taking any lock.
     int32_t maxItemsToEvict = _computeCountOfItemsToEvict();
-    if (maxItemsToEvict <= 0) {
+    if (maxItemsToEvict <= 0 && !_isOverMemoryLimit()) {
         return;
     }
-    for (int32_t i = 0; i < MAX_EVICT_ITERATIONS; ++i) {
-        const UHashElement *element = _nextElement();
-        if (element == nullptr) {
-            break;
-        }
-        if (_isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    (const SharedObject *) element->value.pointer;
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);   // Deletes sharedObject when SoftRefCount goes to zero.
-            ++fAutoEvictedCount;
-            if (--maxItemsToEvict == 0) {
-                break;
+    // Only a memory-bounded cache gives recently used entries a second chance,
+    // see the CLOCK algorithm. Count-bounded eviction stays strictly round robin.
+    UBool secondChance = umtx_loadAcquire(fMaxBytes) > 0;
+    Mutex evictLock(&gCacheEvictMutex);
+    // Examine up to MAX_EVICT_ITERATIONS elements, continuing with the next shard
+    // at the end of each one. Give up after a round of only empty shards.
+    int32_t examined = 0;
+    int32_t emptyShards = 0;
+    while (examined < MAX_EVICT_ITERATIONS && emptyShards < SHARD_COUNT) {
+        int32_t shard = fEvictShard;
+        Table &table = fTables[shard];
+        Mutex lock(&gCacheMutex[shard]);
+        const Element *element;
+        ++emptyShards;
+        while ((element = table.nextEntry(fEvictPos[shard])) != nullptr) {
+            emptyShards = 0;
+            if (secondChance && element->key->fRecentlyUsed) {
+                element->key->fRecentlyUsed = FALSE;
+            } else if (_isEvictable(element)) {
+                _removeElement(shard, element);
+                ++fAutoEvictedCount;
+                if (--maxItemsToEvict <= 0 && !_isOverMemoryLimit()) {
+                    return;
+                }
+            }
+            if (++examined == MAX_EVICT_ITERATIONS) {
+                return;
             }
         }
+        fEvictPos[shard] = UHASH_FIRST;
+        fEvictShard = (shard + 1) & (SHARD_COUNT - 1);
     }
 }
 
 void UnifiedCache::_putNew(
+        int32_t shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -307,14 +380,16 @@ void UnifiedCache::_putNew(
         return;
     }
     keyToAdopt->fCreationStatus = creationStatus;
-    if (value->softRefCount == 0) {
+    if (umtx_loadAcquire(value->softRefCount) == 0) {
         _registerMaster(keyToAdopt, value);
     }
-    void *oldValue = uhash_put(fHashtable, keyToAdopt, (void *) value, &status);
-    U_ASSERT(oldValue == nullptr);
-    (void)oldValue;
+    U_ASSERT(fTables[shard].find(keyToAdopt) == nullptr);
+    fTables[shard].put(keyToAdopt, value, status);
     if (U_SUCCESS(status)) {
-        value->softRefCount++;
+        umtx_atomic_inc(&value->softRefCount);
+        umtx_atomic_inc(&fNumKeys);
+    } else {
+        delete keyToAdopt;
     }
 }
 
@@ -322,18 +397,21 @@ void UnifiedCache::_putIfAbsentAndGet(
         const CacheKeyBase &key,
         const SharedObject *&value,
         UErrorCode &status) const {
-    Mutex lock(&gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
-    if (element != NULL && !_inProgress(element)) {
-        _fetch(element, value, status);
-        return;
-    }
-    if (element == NULL) {
-        UErrorCode putError = U_ZERO_ERROR;
-        // best-effort basis only.
-        _putNew(key, value, status, putError);
-    } else {
-        _put(element, value, status);
+    int32_t shard = _shardOf(key);
+    {
+        Mutex lock(&gCacheMutex[shard]);
+        const Element *element = fTables[shard].find(&key);
+        if (element != NULL && !_inProgress(element)) {
+            _fetch(element, value, status);
+            return;
+        }
+        if (element == NULL) {
+            UErrorCode putError = U_ZERO_ERROR;
+            // best-effort basis only.
+            _putNew(shard, key, value, status, putError);
+        } else {
+            _put(shard, element, value, status);
+        }
     }
     // Run an eviction slice. This will run even if we added a master entry
     // which doesn't increase the unused count, but that is still o.k
@@ -347,28 +425,32 @@ UBool UnifiedCache::_poll(
         UErrorCode &status) const {
     U_ASSERT(value == NULL);
     U_ASSERT(status == U_ZERO_ERROR);
-    Mutex lock(&gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
+    int32_t shard = _shardOf(key);
+    Mutex lock(&gCacheMutex[shard]);
+    const Element *element = fTables[shard].find(&key);
 
     // If the hash table contains an inProgress placeholder entry for this key,
     // this means that another thread is currently constructing the value object.
     // Loop, waiting for that construction to complete.
      while (element != NULL && _inProgress(element)) {
-        umtx_condWait(&gInProgressValueAddedCond, &gCacheMutex);
-        element = uhash_find(fHashtable, &key);
+        umtx_condWait(&gInProgressValueAddedCond[shard], &gCacheMutex[shard]);
+        element = fTables[shard].find(&key);
     }
 
     // If the hash table contains an entry for the key,
     // fetch out the contents and return them.
     if (element != NULL) {
          _fetch(element, value, status);
+        element->key->fRecentlyUsed = TRUE;
+        UTRACE_METRIC_INC(UTRACE_METRIC_UNIFIED_CACHE_HIT);
         return TRUE;
     }
 
     // The hash table contained nothing for this key.
     // Insert an inProgress place holder value.
     // Our caller will create the final value and update the hash table.
-    _putNew(key, fNoValue, U_ZERO_ERROR, status);
+    UTRACE_METRIC_INC(UTRACE_METRIC_UNIFIED_CACHE_MISS);
+    _putNew(shard, key, fNoValue, U_ZERO_ERROR, status);
     return FALSE;
 }
 
@@ -379,6 +461,8 @@ void UnifiedCache::_get(
         UErrorCode &status) const {
     U_ASSERT(value == NULL);
     U_ASSERT(status == U_ZERO_ERROR);
+    // The cache owns its keys and the new object.
+    MemoryScopeSuspender suspender;
     if (_poll(key, value, status)) {
         if (value == fNoValue) {
             SharedObject::clearPtr(value);
@@ -388,7 +472,18 @@ void UnifiedCache::_get(
     if (U_FAILURE(status)) {
         return;
     }
+#if U_ENABLE_TRACING
+    UTRACE_ENTRY_OC(UTRACE_UNIFIED_CACHE_CREATE);
+    if (UTRACE_LEVEL(UTRACE_OPEN_CLOSE)) {
+        char description[200];
+        UTRACE_DATA2(UTRACE_OPEN_CLOSE, "key %s %s", typeid(key).name(),
+                     key.writeDescription(description, UPRV_LENGTHOF(description)));
+    }
     value = key.createObject(creationContext, status);
+    UTRACE_EXIT_PTR_STATUS(value, status);
+#else
+    value = key.createObject(creationContext, status);
+#endif
     U_ASSERT(value == NULL || value->hasHardReferences());
     U_ASSERT(value != NULL || status != U_ZERO_ERROR);
     if (value == NULL) {
@@ -403,50 +498,53 @@ void UnifiedCache::_get(
 void UnifiedCache::_registerMaster(
             const CacheKeyBase *theKey, const SharedObject *value) const {
     theKey->fIsMaster = true;
+    int32_t size = value->getApproximateSize();
+    theKey->fValueSize = size > 0 ? size : DEFAULT_VALUE_SIZE;
+    umtx_atomic_add(&fNumBytes, theKey->fValueSize);
     value->cachePtr = this;
-    ++fNumValuesTotal;
-    ++fNumValuesInUse;
+    umtx_atomic_inc(&fNumValuesTotal);
+    umtx_atomic_inc(&fNumValuesInUse);
 }
 
 void UnifiedCache::_put(
-        const UHashElement *element,
+        int32_t shard,
+        const Element *element,
         const SharedObject *value,
         const UErrorCode status) const {
     U_ASSERT(_inProgress(element));
-    const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
-    const SharedObject *oldValue = (const SharedObject *) element->value.pointer;
+    const CacheKeyBase *theKey = element->key;
+    const SharedObject *oldValue = element->value;
     theKey->fCreationStatus = status;
-    if (value->softRefCount == 0) {
+    if (umtx_loadAcquire(value->softRefCount) == 0) {
         _registerMaster(theKey, value);
     }
-    value->softRefCount++;
-    UHashElement *ptr = const_cast<UHashElement *>(element);
-    ptr->value.pointer = (void *) value;
+    umtx_atomic_inc(&value->softRefCount);
+    const_cast<Element *>(element)->value = value;
     U_ASSERT(oldValue == fNoValue);
     removeSoftRef(oldValue);
 
     // Tell waiting threads that we replace in-progress status with
     // an error.
-    umtx_condBroadcast(&gInProgressValueAddedCond);
+    umtx_condBroadcast(&gInProgressValueAddedCond[shard]);
 }
 
 void UnifiedCache::_fetch(
-        const UHashElement *element,
+        const Element *element,
         const SharedObject *&value,
         UErrorCode &status) const {
-    const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
+    const CacheKeyBase *theKey = element->key;
     status = theKey->fCreationStatus;
 
     // Since we have the cache lock, calling regular SharedObject add/removeRef
     // could cause us to deadlock on ourselves since they may need to lock
     // the cache mutex.
     removeHardRef(value);
-    value = static_cast<const SharedObject *>(element->value.pointer);
+    value = element->value;
     addHardRef(value);
 }
 
 
-UBool UnifiedCache::_inProgress(const UHashElement* element) const {
+UBool UnifiedCache::_inProgress(const Element *element) const {
     UErrorCode status = U_ZERO_ERROR;
     const SharedObject * value = NULL;
     _fetch(element, value, status);
@@ -460,11 +558,10 @@ UBool UnifiedCache::_inProgress(
     return (theValue == fNoValue && creationStatus == U_ZERO_ERROR);
 }
 
-UBool UnifiedCache::_isEvictable(const UHashElement *element) const
+UBool UnifiedCache::_isEvictable(const Element *element) const
 {
-    const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
-    const SharedObject *theValue =
-            (const SharedObject *) element->value.pointer;
+    const CacheKeyBase *theKey = element->key;
+    const SharedObject *theValue = element->value;
 
     // Entries that are under construction are never evictable
     if (_inProgress(theValue, theKey->fCreationStatus)) {
@@ -473,14 +570,15 @@ UBool UnifiedCache::_isEvictable(const UHashElement *element) const
 
     // We can evict entries that are either not a master or have just
     // one reference (The one reference being from the cache itself).
-    return (!theKey->fIsMaster || (theValue->softRefCount == 1 && theValue->noHardReferences()));
+    return (!theKey->fIsMaster ||
+            (umtx_loadAcquire(theValue->softRefCount) == 1 && theValue->noHardReferences()));
 }
 
 void UnifiedCache::removeSoftRef(const SharedObject *value) const {
     U_ASSERT(value->cachePtr == this);
-    U_ASSERT(value->softRefCount > 0);
-    if (--value->softRefCount == 0) {
-        --fNumValuesTotal;
+    U_ASSERT(umtx_loadAcquire(value->softRefCount) > 0);
+    if (umtx_atomic_dec(&value->softRefCount) == 0) {
+        umtx_atomic_dec(&fNumValuesTotal);
         if (value->noHardReferences()) {
             delete value;
         } else {
@@ -498,7 +596,7 @@ int32_t UnifiedCache::removeHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_dec(&value->hardRefCount);
         U_ASSERT(refCount >= 0);
         if (refCount == 0) {
-            --fNumValuesInUse;
+            umtx_atomic_dec(&fNumValuesInUse);
         }
     }
     return refCount;
@@ -510,7 +608,7 @@ int32_t UnifiedCache::addHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_inc(&value->hardRefCount);
         U_ASSERT(refCount >= 1);
         if (refCount == 1) {
-            fNumValuesInUse++;
+            umtx_atomic_inc(&fNumValuesInUse);
         }
     }
     return refCount;
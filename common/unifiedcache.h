@@ -21,9 +21,7 @@
 #include "unicode/unistr.h"
 #include "cstring.h"
 #include "ustr_imp.h"
-
-struct UHashtable;
-struct UHashElement;
+#include "ohashmap.h"
 
 U_NAMESPACE_BEGIN
 
@@ -34,13 +32,14 @@ class UnifiedCache;
  */
 class U_COMMON_API CacheKeyBase : public UObject {
  public:
-   CacheKeyBase() : fCreationStatus(U_ZERO_ERROR), fIsMaster(FALSE) {}
+   CacheKeyBase() : fCreationStatus(U_ZERO_ERROR), fIsMaster(FALSE), fRecentlyUsed(FALSE), fValueSize(0) {}
 
    /**
     * Copy constructor. Needed to support cloning.
     */
    CacheKeyBase(const CacheKeyBase &other) 
-           : UObject(other), fCreationStatus(other.fCreationStatus), fIsMaster(FALSE) { }
+           : UObject(other), fCreationStatus(other.fCreationStatus), fIsMaster(FALSE),
+             fRecentlyUsed(FALSE), fValueSize(0) { }
    virtual ~CacheKeyBase();
 
    /**
@@ -89,9 +88,22 @@ class U_COMMON_API CacheKeyBase : public UObject {
  private:
    mutable UErrorCode fCreationStatus;
    mutable UBool fIsMaster;
+   // Set by cache hits, cleared by the eviction clock hand.
+   mutable UBool fRecentlyUsed;
+   // The size charged for the value of a master key.
+   mutable int32_t fValueSize;
    friend class UnifiedCache;
 };
 
+/**
+ * Hash and equality of cache keys for OpenHashMap.
+ */
+struct CacheKeyTraits {
+    static int32_t hash(const CacheKeyBase *key) { return key->hashCode(); }
+    static UBool equals(const CacheKeyBase *key1, const CacheKeyBase *key2) {
+        return *key1 == *key2;
+    }
+};
 
 
 /**
@@ -327,6 +339,27 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    void setEvictionPolicy(
            int32_t count, int32_t percentageOfInUseItems, UErrorCode &status);
 
+   /**
+    * Configures an approximate limit for the memory used by cached values,
+    * as reported by SharedObject::getApproximateSize(). Values of unknown
+    * size are charged a fixed default. While the limit is exceeded, unused
+    * entries are evicted in addition to those evicted for the count limits
+    * of setEvictionPolicy(). Values that are in use are never evicted, so
+    * the limit can be exceeded while clients hold many of them.
+    *
+    * Eviction uses the CLOCK algorithm: an entry found by a lookup since
+    * the eviction pass last visited it gets a second chance.
+    *
+    * A limit of 0, the default, means no memory limit.
+    * If maxBytes is negative, this sets status to U_ILLEGAL_ARGUMENT_ERROR.
+    */
+   void setMemoryLimit(int32_t maxBytes, UErrorCode &status);
+
+   /**
+    * Returns the approximate number of bytes used by the cached values.
+    */
+   int32_t memoryUsage() const;
+
 
    /**
     * Returns how many entries have been auto evicted during the lifetime
@@ -343,14 +376,35 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
 
    virtual void handleUnreferencedObject() const;
    virtual ~UnifiedCache();
+
+   /**
+    * The number of independently locked parts of the cache.
+    * Must be a power of 2.
+    */
+   static const int32_t SHARD_COUNT = 16;
    
  private:
-   UHashtable *fHashtable;
-   mutable int32_t fEvictPos;
-   mutable int32_t fNumValuesTotal;
-   mutable int32_t fNumValuesInUse;
-   int32_t fMaxUnused;
-   int32_t fMaxPercentageOfInUse;
+   /**
+    * The cache owns its keys: They are deleted when their elements are removed.
+    */
+   typedef OpenHashMap<const CacheKeyBase *, const SharedObject *, CacheKeyTraits> Table;
+   typedef Table::Entry Element;
+
+   /**
+    * Keys are distributed over SHARD_COUNT hash tables by their hash codes.
+    * Each shard has its own mutex, gCacheMutex[shard], so that lookups of
+    * different keys do not contend with each other.
+    */
+   mutable Table fTables[SHARD_COUNT];
+   mutable int32_t fEvictPos[SHARD_COUNT];
+   mutable int32_t fEvictShard;
+   mutable u_atomic_int32_t fNumKeys;
+   mutable u_atomic_int32_t fNumValuesTotal;
+   mutable u_atomic_int32_t fNumValuesInUse;
+   mutable u_atomic_int32_t fMaxUnused;
+   mutable u_atomic_int32_t fMaxPercentageOfInUse;
+   mutable u_atomic_int32_t fNumBytes;
+   mutable u_atomic_int32_t fMaxBytes;
    mutable int64_t fAutoEvictedCount;
    SharedObject *fNoValue;
    
@@ -361,9 +415,10 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * Flushes the contents of the cache. If cache values hold references to other
     * cache values then _flush should be called in a loop until it returns FALSE.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, gCacheMutex[shard] must be held.
     * On exit, those values with are evictable are flushed.
     * 
+    *  @param shard the shard to be flushed.
     *  @param all if false flush evictable items only, which are those with no external
     *                    references, plus those that can be safely recreated.<br>
     *            if true, flush all elements. Any values (sharedObjects) with remaining
@@ -372,7 +427,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     *                     _flush is not thread safe when all is true.
     *   @return TRUE if any value in cache was flushed or FALSE otherwise.
     */
-   UBool _flush(UBool all) const;
+   UBool _flush(int32_t shard, UBool all) const;
    
    /**
     * Gets value out of cache.
@@ -409,11 +464,13 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     
     /**
      * Places a new value and creationStatus in the cache for the given key.
-     * On entry, gCacheMutex must be held. key must not exist in the cache. 
+     * On entry, gCacheMutex[shard] must be held. key must not exist in the cache.
+     * shard must be _shardOf(key).
      * On exit, value and creation status placed under key. Soft reference added
      * to value on successful add. On error sets status.
      */
     void _putNew(
+        int32_t shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -438,11 +495,16 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
            UErrorCode &status) const;
 
     /**
-     * Returns the next element in the cache round robin style.
-     * Returns nullptr if the cache is empty.
-     * On entry, gCacheMutex must be held.
+     * Returns the shard for the given key.
+     */
+    static int32_t _shardOf(const CacheKeyBase &key);
+
+    /**
+     * Returns the next element in the shard round robin style.
+     * Returns nullptr if the shard is empty.
+     * On entry, gCacheMutex[shard] must be held.
      */
-    const UHashElement *_nextElement() const;
+    const Element *_nextElement(int32_t shard) const;
    
    /**
     * Return the number of cache items that would need to be evicted
@@ -450,15 +512,32 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * 
     * An item corresponds to an entry in the hash table, a hash table element.
     * 
-    * On entry, gCacheMutex must be held.
+    * Reads only atomic counters; no mutex needs to be held.
     */
    int32_t _computeCountOfItemsToEvict() const;
+
+   /**
+    * Returns TRUE if the cached values exceed the memory limit
+    * and some entries are unused.
+    * Reads only atomic counters; no mutex needs to be held.
+    */
+   UBool _isOverMemoryLimit() const;
+
+   /**
+    * Removes an element and its key from its shard, and removes the soft
+    * reference to its value, deleting the value if that was the last one.
+    * On entry, gCacheMutex[shard] must be held.
+    */
+   void _removeElement(int32_t shard, const Element *element) const;
    
    /**
     * Run an eviction slice.
-    * On entry, gCacheMutex must be held.
+    * On entry, no gCacheMutex[shard] must be held.
     * _runEvictionSlice runs a slice of the evict pipeline by examining the next
     * 10 entries in the cache round robin style evicting them if they are eligible.
+    * With a memory limit, entries used since the previous round are skipped once.
+    * The round robin visits the shards one after another.
+    * Returns without locking anything if no items need to be evicted.
     */
    void _runEvictionSlice() const;
  
@@ -468,7 +547,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * produce referneces to an already existing SharedObject are not masters -
     * they can be evicted and subsequently recreated.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, gCacheMutex[shard] must be held.
     * On exit, items in use count incremented, entry is marked as a master
     * entry, and value registered with cache so that subsequent calls to
     * addRef() and removeRef() on it correctly interact with the cache.
@@ -477,27 +556,29 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
         
    /**
     * Store a value and creation error status in given hash entry.
-    * On entry, gCacheMutex must be held. Hash entry element must be in progress.
+    * On entry, gCacheMutex[shard] must be held. Hash entry element must be
+    * in progress and be in the given shard.
     * value must be non NULL.
     * On Exit, soft reference added to value. value and status stored in hash
     * entry. Soft reference removed from previous stored value. Waiting
     * threads notified.
     */
    void _put(
-           const UHashElement *element,
+           int32_t shard,
+           const Element *element,
            const SharedObject *value,
            const UErrorCode status) const;
     /**
      * Remove a soft reference, and delete the SharedObject if no references remain.
      * To be used from within the UnifiedCache implementation only.
-     * gCacheMutex must be held by caller.
+     * gCacheMutex[shard] must be held by caller.
      * @param value the SharedObject to be acted on.
      */
    void removeSoftRef(const SharedObject *value) const;
    
    /**
     * Increment the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * gCacheMutex[shard] must be held by the caller.
     * Update numValuesEvictable on transitions between zero and one reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -507,7 +588,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
   /**
     * Decrement the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * gCacheMutex[shard] must be held by the caller.
     * Update numValuesEvictable on transitions between one and zero reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -522,33 +603,33 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
    /**
     *  Fetch value and error code from a particular hash entry.
-    *  On entry, gCacheMutex must be held. value must be either NULL or must be
+    *  On entry, gCacheMutex[shard] must be held. value must be either NULL or must be
     *  included in the ref count of the object to which it points.
     *  On exit, value and status set to what is in the hash entry. Caller must
     *  eventually call removeRef on value.
     *  If hash entry is in progress, value will be set to gNoValue and status will
     *  be set to U_ZERO_ERROR.
     */
-   void _fetch(const UHashElement *element, const SharedObject *&value,
+   void _fetch(const Element *element, const SharedObject *&value,
                        UErrorCode &status) const;
                        
     /**
      * Determine if given hash entry is in progress.
-     * On entry, gCacheMutex must be held.
+     * On entry, gCacheMutex[shard] must be held.
      */
-   UBool _inProgress(const UHashElement *element) const;
+   UBool _inProgress(const Element *element) const;
    
    /**
     * Determine if given hash entry is in progress.
-    * On entry, gCacheMutex must be held.
+    * On entry, gCacheMutex[shard] must be held.
     */
    UBool _inProgress(const SharedObject *theValue, UErrorCode creationStatus) const;
    
    /**
     * Determine if given hash entry is eligible for eviction.
-    * On entry, gCacheMutex must be held.
+    * On entry, gCacheMutex[shard] must be held.
     */
-   UBool _isEvictable(const UHashElement *element) const;
+   UBool _isEvictable(const Element *element) const;
 };
 
 U_NAMESPACE_END
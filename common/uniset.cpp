@@ -836,6 +836,107 @@ UnicodeSet& UnicodeSet::set(UChar32 start, UChar32 end) {
     return *this;
 }
 
+UnicodeSet &UnicodeSet::setToRanges(const UChar32 *ranges, int32_t length, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode) || isFrozen() || isBogus()) {
+        return *this;
+    }
+    if (length < 0 || (length & 1) != 0 || (ranges == NULL && length != 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return *this;
+    }
+    // Validate and count the inversion list values before modifying this set.
+    int32_t newLen = 0;
+    UChar32 prevLimit = -1;
+    for (int32_t i = 0; i < length; i += 2) {
+        UChar32 start = ranges[i];
+        UChar32 end = ranges[i + 1];
+        if (start < 0 || start < prevLimit || start > end || end > 0x10ffff) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return *this;
+        }
+        if (start != prevLimit) {
+            newLen += 2;
+        }  // else merge with the previous range
+        prevLimit = end + 1;
+    }
+    ensureCapacity(newLen + 1, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return *this;
+    }
+    int32_t j = 0;
+    for (int32_t i = 0; i < length; i += 2) {
+        if (j > 0 && ranges[i] == list[j - 1]) {
+            list[j - 1] = ranges[i + 1] + 1;
+        } else {
+            list[j++] = ranges[i];
+            list[j++] = ranges[i + 1] + 1;
+        }
+    }
+    // A range that ends with U+10FFFF is terminated by the final UNICODESET_HIGH.
+    if (j > 0 && list[j - 1] == UNICODESET_HIGH) {
+        --j;
+    }
+    list[j] = UNICODESET_HIGH;
+    len = j + 1;
+    releasePattern();
+    if (strings != NULL) {
+        strings->removeAllElements();
+    }
+    return *this;
+}
+
+UnicodeSet &UnicodeSet::setToSerialized(const USerializedSet &set, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode) || isFrozen() || isBogus()) {
+        return *this;
+    }
+    const uint16_t *array = set.array;
+    int32_t bmpLength = set.bmpLength;
+    int32_t length = set.length;
+    if (bmpLength < 0 || bmpLength > length || ((length - bmpLength) & 1) != 0 ||
+            (array == NULL && length != 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return *this;
+    }
+    // The serialized form is the inversion list without its terminator,
+    // with supplementary values split into pairs of 16-bit units.
+    UChar32 prev = -1;
+    for (int32_t i = 0; i < bmpLength; ++i) {
+        UChar32 c = array[i];
+        if (c <= prev) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return *this;
+        }
+        prev = c;
+    }
+    for (int32_t i = bmpLength; i < length; i += 2) {
+        UChar32 c = ((UChar32)array[i] << 16) | array[i + 1];
+        if (c <= prev || c >= UNICODESET_HIGH) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return *this;
+        }
+        prev = c;
+    }
+    int32_t newLen = bmpLength + (length - bmpLength) / 2;
+    ensureCapacity(newLen + 1, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return *this;
+    }
+    int32_t j = 0;
+    for (int32_t i = 0; i < bmpLength; ++i) {
+        list[j++] = array[i];
+    }
+    for (int32_t i = bmpLength; i < length; i += 2) {
+        list[j++] = ((UChar32)array[i] << 16) | array[i + 1];
+    }
+    list[j] = UNICODESET_HIGH;
+    len = j + 1;
+    releasePattern();
+    if (strings != NULL) {
+        strings->removeAllElements();
+    }
+    return *this;
+}
+
 /**
  * Adds the specified range to this set if it is not already
  * present.  If this set already contains the specified range,
@@ -1489,7 +1590,7 @@ UnicodeSet& UnicodeSet::compact() {
  * Deserialize constructor.
  */
 UnicodeSet::UnicodeSet(const uint16_t data[], int32_t dataLen, ESerialization serialization, UErrorCode &ec)
-  : len(1), capacity(1+START_EXTRA), list(0), bmpSet(0), buffer(0),
+  : len(1), capacity(0), list(0), bmpSet(0), buffer(0),
     bufferCapacity(0), patLen(0), pat(NULL), strings(NULL), stringSpan(NULL),
     fFlags(0) {
 
@@ -1498,9 +1599,9 @@ UnicodeSet::UnicodeSet(const uint16_t data[], int32_t dataLen, ESerialization se
     return;
   }
 
+  USerializedSet set;
   if( (serialization != kSerialized)
-      || (data==NULL)
-      || (dataLen < 1)) {
+      || !uset_getSerializedSet(&set, data, dataLen)) {
     ec = U_ILLEGAL_ARGUMENT_ERROR;
     setToBogus();
     return;
@@ -1512,38 +1613,13 @@ UnicodeSet::UnicodeSet(const uint16_t data[], int32_t dataLen, ESerialization se
     return;
   }
 
-  // bmp?
-  int32_t headerSize = ((data[0]&0x8000)) ?2:1;
-  int32_t bmpLength = (headerSize==1)?data[0]:data[1];
-
-  len = (((data[0]&0x7FFF)-bmpLength)/2)+bmpLength;
 #ifdef DEBUG_SERIALIZE
-  printf("dataLen %d headerSize %d bmpLen %d len %d. data[0]=%X/%X/%X/%X\n", dataLen,headerSize,bmpLength,len, data[0],data[1],data[2],data[3]);
+  printf("dataLen %d bmpLen %d length %d. data[0]=%X\n", dataLen, set.bmpLength, set.length, data[0]);
 #endif
-  capacity = len+1;
-  list = (UChar32*) uprv_malloc(sizeof(UChar32) * capacity);
-  if(!list || U_FAILURE(ec)) {
+  setToSerialized(set, ec);
+  if (U_FAILURE(ec)) {
     setToBogus();
-    return;
-  }
-  // copy bmp
-  int32_t i;
-  for(i = 0; i< bmpLength;i++) {
-    list[i] = data[i+headerSize];
-#ifdef DEBUG_SERIALIZE
-    printf("<<16@%d[%d] %X\n", i+headerSize, i, list[i]);
-#endif
-  }
-  // copy smp
-  for(i=bmpLength;i<len;i++) {
-    list[i] = ((UChar32)data[headerSize+bmpLength+(i-bmpLength)*2+0] << 16) +
-              ((UChar32)data[headerSize+bmpLength+(i-bmpLength)*2+1]);
-#ifdef DEBUG_SERIALIZE
-    printf("<<32@%d+[%d] %lX\n", headerSize+bmpLength+i, i, list[i]);
-#endif
   }
-  // terminator
-  list[len++]=UNICODESET_HIGH;
 }
 
 
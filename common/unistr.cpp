@@ -27,6 +27,7 @@
 #include "cmemory.h"
 #include "unicode/ustring.h"
 #include "unicode/unistr.h"
+#include "unicode/unistrarena.h"
 #include "unicode/utf.h"
 #include "unicode/utf16.h"
 #include "uelement.h"
@@ -118,6 +119,25 @@ operator+ (const UnicodeString &s1, const UnicodeString &s2) {
 //                               have a chance to automatically inline.
 //========================================
 
+namespace {
+
+// A buffer from a UnicodeStringArena has kLongString flags,
+// and its refCount field has this value: It is never shared.
+// The field is preceded by a pointer to the arena,
+// and the two take up kArenaHeaderLength bytes before the characters.
+const int32_t kArenaRefCount = -1;
+const int32_t kArenaHeaderLength = (int32_t)(2 * sizeof(void *));
+
+// Returns the arena of a refCounted buffer, or NULL if it is a heap buffer.
+inline UnicodeStringArena *getArena(const UChar *array) {
+  if(umtx_loadAcquire(*((u_atomic_int32_t *)array - 1)) != kArenaRefCount) {
+    return NULL;
+  }
+  return *(UnicodeStringArena **)((const char *)array - kArenaHeaderLength);
+}
+
+}  // namespace
+
 void
 UnicodeString::addRef() {
   umtx_atomic_inc((u_atomic_int32_t *)fUnion.fFields.fArray - 1);
@@ -130,11 +150,15 @@ UnicodeString::removeRef() {
 
 int32_t
 UnicodeString::refCount() const {
-  return umtx_loadAcquire(*((u_atomic_int32_t *)fUnion.fFields.fArray - 1));
+  int32_t count = umtx_loadAcquire(*((u_atomic_int32_t *)fUnion.fFields.fArray - 1));
+  // An arena buffer is owned by only this string.
+  return count != kArenaRefCount ? count : 1;
 }
 
 void
 UnicodeString::releaseArray() {
+  // An arena buffer is released with its arena:
+  // Decrementing its refCount field never yields 0.
   if((fUnion.fFields.fLengthAndFlags & kRefCounted) && removeRef() == 0) {
     uprv_free((int32_t *)fUnion.fFields.fArray - 1);
   }
@@ -189,6 +213,21 @@ UnicodeString::UnicodeString(int32_t capacity, UChar32 c, int32_t count) {
   }
 }
 
+UnicodeString::UnicodeString(UnicodeStringArena &arena, int32_t capacity) {
+  fUnion.fFields.fLengthAndFlags = 0;
+  // Start with at least the capacity of the stack buffer.
+  // The string would otherwise not remember the arena until it grows.
+  allocate(capacity > US_STACKBUF_SIZE ? capacity : US_STACKBUF_SIZE, &arena);
+}
+
+UnicodeString::UnicodeString(UnicodeStringArena &arena, const UnicodeString &src) {
+  fUnion.fFields.fLengthAndFlags = 0;
+  int32_t srcLength = src.length();
+  if(allocate(srcLength > US_STACKBUF_SIZE ? srcLength : US_STACKBUF_SIZE, &arena)) {
+    doAppend(src, 0, srcLength);
+  }
+}
+
 UnicodeString::UnicodeString(UChar ch) {
   fUnion.fFields.fLengthAndFlags = kLength1 | kShortString;
   fUnion.fStackFields.fBuffer[0] = ch;
@@ -355,6 +394,11 @@ const int32_t kGrowSize = 128;
 // but that does not seem worth it.)
 const int32_t kMaxCapacity = 0x7ffffff5;
 
+// An arena buffer has a header of up to 16 bytes, and its length in bytes,
+// before rounding up to a multiple of 16, must fit into an int32_t.
+// This means that its capacity must be at most (0x7fffffff - 16 - 15) / 2 - 1 = 0x3fffffef.
+const int32_t kMaxArenaCapacity = 0x3fffffef;
+
 int32_t getGrowCapacity(int32_t newLength) {
   int32_t growSize = (newLength >> 2) + kGrowSize;
   if(growSize <= (kMaxCapacity - newLength)) {
@@ -398,6 +442,103 @@ UnicodeString::allocate(int32_t capacity) {
   return FALSE;
 }
 
+UBool
+UnicodeString::allocate(int32_t capacity, UnicodeStringArena *arena) {
+  if(arena == NULL) {
+    return allocate(capacity);
+  }
+  if(capacity <= kMaxArenaCapacity) {
+    ++capacity;  // for the NUL
+    // Arena pointer + refCount field + UChars, rounded up to a multiple of 16.
+    int32_t numBytes = (kArenaHeaderLength + capacity * U_SIZEOF_UCHAR + 15) & ~15;
+    char *block = (char *)arena->allocate(numBytes);
+    if(block != NULL) {
+      *(UnicodeStringArena **)block = arena;
+      int32_t *array = (int32_t *)(block + kArenaHeaderLength);
+      array[-1] = kArenaRefCount;
+      fUnion.fFields.fArray = (UChar *)array;
+      fUnion.fFields.fCapacity = (numBytes - kArenaHeaderLength) / U_SIZEOF_UCHAR;
+      fUnion.fFields.fLengthAndFlags = kLongString;
+      return TRUE;
+    }
+  }
+  fUnion.fFields.fLengthAndFlags = kIsBogus;
+  fUnion.fFields.fArray = 0;
+  fUnion.fFields.fCapacity = 0;
+  return FALSE;
+}
+
+//========================================
+// String arena
+//========================================
+
+namespace {
+
+// A heap block of an arena starts with a pointer to the previous block.
+const int32_t kMinArenaBlockLength = 0x1000;
+const int32_t kMaxArenaBlockLength = 0x10000;
+
+inline char *alignArenaPointer(char *p) {
+  return p + ((0x10 - U_POINTER_MASK_LSB(p, 0xf)) & 0xf);
+}
+
+}  // namespace
+
+UnicodeStringArena::UnicodeStringArena() :
+    fStart(NULL), fLimit(NULL), fHeapBlocks(NULL), fHeapBlockCount(0),
+    fNextBlockLength(kMinArenaBlockLength) {}
+
+UnicodeStringArena::UnicodeStringArena(void *buffer, int32_t capacity) :
+    fStart(NULL), fLimit(NULL), fHeapBlocks(NULL), fHeapBlockCount(0),
+    fNextBlockLength(kMinArenaBlockLength) {
+  if(buffer != NULL && capacity > 0) {
+    fStart = (char *)buffer;
+    fLimit = fStart + capacity;
+  }
+}
+
+UnicodeStringArena::~UnicodeStringArena() {
+  while(fHeapBlocks != NULL) {
+    void *block = fHeapBlocks;
+    fHeapBlocks = *(void **)block;
+    uprv_free(block);
+  }
+}
+
+void *
+UnicodeStringArena::allocate(int32_t length) {
+  if(length < 0) {
+    return NULL;
+  }
+  if(fStart != NULL) {
+    char *p = alignArenaPointer(fStart);
+    if(p <= fLimit && length <= (fLimit - p)) {
+      fStart = p + length;
+      return p;
+    }
+  }
+  // A large request gets a block of its own,
+  // and the rest of the current block remains available.
+  UBool isLarge = length > fNextBlockLength / 2;
+  int32_t capacity = isLarge ? length : fNextBlockLength;
+  char *block = (char *)uprv_malloc(sizeof(void *) + 0xf + (size_t)capacity);
+  if(block == NULL) {
+    return NULL;
+  }
+  *(void **)block = fHeapBlocks;
+  fHeapBlocks = block;
+  ++fHeapBlockCount;
+  char *p = alignArenaPointer(block + sizeof(void *));
+  if(!isLarge) {
+    fStart = p + length;
+    fLimit = p + capacity;
+    if(fNextBlockLength < kMaxArenaBlockLength) {
+      fNextBlockLength *= 2;
+    }
+  }
+  return p;
+}
+
 //========================================
 // Destructor
 //========================================
@@ -518,7 +659,12 @@ UnicodeString::copyFrom(const UnicodeString &src, UBool fastCopy) {
 
   // fLength>0 and not an "open" src.getBuffer(minCapacity)
   fUnion.fFields.fLengthAndFlags = src.fUnion.fFields.fLengthAndFlags;
-  switch(src.fUnion.fFields.fLengthAndFlags & kAllStorageFlags) {
+  int32_t srcStorage = src.fUnion.fFields.fLengthAndFlags & kAllStorageFlags;
+  if(srcStorage == kLongString && getArena(src.fUnion.fFields.fArray) != NULL) {
+    // src uses an arena buffer, which is never shared; copy it like a writable alias
+    srcStorage = kWritableAlias;
+  }
+  switch(srcStorage) {
   case kShortString:
     // short string using the stack buffer, do the same
     uprv_memcpy(fUnion.fStackFields.fBuffer, src.fUnion.fStackFields.fBuffer,
@@ -1842,9 +1988,12 @@ UnicodeString::cloneArrayIfNeeded(int32_t newCapacity,
       U_ASSERT(oldArray!=NULL); /* when stack buffer is not used, oldArray must have a non-NULL reference */
     }
 
+    // an arena string grows within its arena
+    UnicodeStringArena *arena = (flags & kRefCounted) ? getArena(oldArray) : NULL;
+
     // allocate a new array
-    if(allocate(growCapacity) ||
-       (newCapacity < growCapacity && allocate(newCapacity))
+    if(allocate(growCapacity, arena) ||
+       (newCapacity < growCapacity && allocate(newCapacity, arena))
     ) {
       if(doCopyArray) {
         // copy the contents
@@ -1947,7 +2096,8 @@ U_NAMESPACE_USE
 U_CAPI int32_t U_EXPORT2
 uhash_hashUnicodeString(const UElement key) {
     const UnicodeString *str = (const UnicodeString*) key.pointer;
-    return (str == NULL) ? 0 : str->hashCode();
+    // Hash table keys use the faster internal hash, not the stable hashCode().
+    return (str == NULL) ? 0 : ustr_fastHashUCharsN(str->getBuffer(), str->length());
 }
 
 // Moved here from uhash_us.cpp so that using a UVector of UnicodeString*
@@ -49,6 +49,7 @@ UnicodeString::toTitle(BreakIterator *iter, const Locale &locale, uint32_t optio
         return *this;
     }
     caseMap(ustrcase_getCaseLocale(locale.getBaseName()), options, iter, ustrcase_internalToTitle);
+    ustrcase_releaseTitleBreakIterator(&locale, "", options, ownedIter);
     return *this;
 }
 
@@ -29,6 +29,7 @@
 #include "unicode/unorm2.h"
 #include "unicode/uscript.h"
 #include "unicode/ustring.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "normalizer2impl.h"
 #include "umutex.h"
@@ -519,6 +520,166 @@ u_getIntPropertyMaxValue(UProperty which) {
     return -1;  // undefined
 }
 
+namespace {
+
+/**
+ * One property of a u_getIntPropertyValues() call,
+ * resolved once per call rather than once per code point.
+ * Enumerated properties are read from the property's cached UCPTrie
+ * (see u_getIntPropertyMap()), binary properties via their contains() function.
+ */
+struct PropertyGetter {
+    UProperty which;
+    const UCPTrie *trie;  // NULL for binary and mask properties
+    const BinaryProperty *binProp;
+
+    int32_t get(UChar32 c) const {
+        if(trie!=NULL) {
+            int32_t i=trie->type==UCPTRIE_TYPE_FAST ?
+                _UCPTRIE_CP_INDEX(trie, 0xffff, c) :
+                _UCPTRIE_CP_INDEX(trie, UCPTRIE_SMALL_MAX, c);
+            switch(trie->valueWidth) {
+            case UCPTRIE_VALUE_BITS_8:
+                return UCPTRIE_8(trie, i);
+            case UCPTRIE_VALUE_BITS_16:
+                return UCPTRIE_16(trie, i);
+            default:
+                return (int32_t)UCPTRIE_32(trie, i);
+            }
+        } else if(binProp!=NULL) {
+            return binProp->contains(*binProp, c, which);
+        } else {
+            return U_MASK(u_charType(c));  // UCHAR_GENERAL_CATEGORY_MASK
+        }
+    }
+};
+
+class PropertyValuesWriter {
+public:
+    PropertyValuesWriter(const UProperty *which, int32_t whichCount,
+                         int32_t *values, int32_t capacity, UErrorCode &errorCode) :
+            getters(), gettersCount(whichCount), dest(values), destCapacity(capacity), destLength(0) {
+        if(U_FAILURE(errorCode)) { return; }
+        if(gettersCount>getters.getCapacity() && getters.resize(gettersCount)==NULL) {
+            errorCode=U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        for(int32_t i=0; i<gettersCount; ++i) {
+            PropertyGetter &getter=getters[i];
+            UProperty p=which[i];
+            getter.which=p;
+            getter.trie=NULL;
+            getter.binProp=NULL;
+            if(UCHAR_BINARY_START<=p && p<UCHAR_BINARY_LIMIT) {
+                getter.binProp=&binProps[p];
+            } else if(UCHAR_INT_START<=p && p<UCHAR_INT_LIMIT) {
+                getter.trie=reinterpret_cast<const UCPTrie *>(u_getIntPropertyMap(p, &errorCode));
+                if(U_FAILURE(errorCode)) { return; }
+            } else if(p!=UCHAR_GENERAL_CATEGORY_MASK) {
+                errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+        }
+    }
+
+    void append(UChar32 c) {
+        if((destLength+gettersCount)<=destCapacity) {
+            int32_t *p=dest+destLength;
+            for(int32_t i=0; i<gettersCount; ++i) {
+                p[i]=getters[i].get(c);
+            }
+        }
+        destLength+=gettersCount;
+    }
+
+    int32_t finish(int32_t numCodePoints, UErrorCode &errorCode) const {
+        if(U_SUCCESS(errorCode) && destLength>destCapacity) {
+            errorCode=U_BUFFER_OVERFLOW_ERROR;
+        }
+        return numCodePoints;
+    }
+
+private:
+    MaybeStackArray<PropertyGetter, 8> getters;
+    int32_t gettersCount;
+    int32_t *dest;
+    int32_t destCapacity;
+    int32_t destLength;
+};
+
+UBool checkPropertyValuesArgs(int32_t length, const void *s,
+                              const UProperty *which, int32_t whichCount,
+                              int32_t *values, int32_t capacity, UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return FALSE;
+    }
+    if((s==NULL && length!=0) || length<-1 ||
+            which==NULL || whichCount<=0 ||
+            capacity<0 || (values==NULL && capacity>0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertyValues(const UChar *s, int32_t length,
+                       const UProperty *which, int32_t whichCount,
+                       int32_t *values, int32_t capacity, UErrorCode *pErrorCode) {
+    if(!checkPropertyValuesArgs(length, s, which, whichCount, values, capacity, pErrorCode)) {
+        return 0;
+    }
+    PropertyValuesWriter writer(which, whichCount, values, capacity, *pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    int32_t numCodePoints=0;
+    UChar32 c;
+    if(length<0) {
+        int32_t i=0;
+        while((c=s[i])!=0) {
+            ++i;
+            if(U16_IS_LEAD(c) && U16_IS_TRAIL(s[i])) {
+                c=U16_GET_SUPPLEMENTARY(c, s[i++]);
+            }
+            writer.append(c);
+            ++numCodePoints;
+        }
+    } else {
+        for(int32_t i=0; i<length; ++numCodePoints) {
+            U16_NEXT(s, i, length, c);
+            writer.append(c);
+        }
+    }
+    return writer.finish(numCodePoints, *pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertyValuesUTF8(const char *s, int32_t length,
+                           const UProperty *which, int32_t whichCount,
+                           int32_t *values, int32_t capacity, UErrorCode *pErrorCode) {
+    if(!checkPropertyValuesArgs(length, s, which, whichCount, values, capacity, pErrorCode)) {
+        return 0;
+    }
+    PropertyValuesWriter writer(which, whichCount, values, capacity, *pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(length<0) {
+        length=(int32_t)uprv_strlen(s);
+    }
+    const uint8_t *s8=reinterpret_cast<const uint8_t *>(s);
+    int32_t numCodePoints=0;
+    UChar32 c;
+    for(int32_t i=0; i<length; ++numCodePoints) {
+        U8_NEXT_OR_FFFD(s8, i, length, c);
+        writer.append(c);
+    }
+    return writer.finish(numCodePoints, *pErrorCode);
+}
+
 U_CFUNC UPropertySource U_EXPORT2
 uprops_getSource(UProperty which) {
     if(which<UCHAR_BINARY_START) {
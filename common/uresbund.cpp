@@ -37,6 +37,7 @@
 #include "umutex.h"
 #include "putilimp.h"
 #include "uassert.h"
+#include "utracimp.h"
 
 using namespace icu;
 
@@ -48,7 +49,43 @@ TODO: This cache should probably be removed when the deprecated code is
 static UHashtable *cache = NULL;
 static icu::UInitOnce gCacheInitOnce;
 
-static UMutex resbMutex = U_MUTEX_INITIALIZER;
+static UMutex resbMutex = U_NAMED_MUTEX_INITIALIZER("resbMutex");
+
+/*
+ * Lock-free lookup of cached bundles.
+ *
+ * The cache is only changed while holding resbMutex.
+ * After changes, an immutable table (a "snapshot") of the cached entries
+ * that can be returned by entryOpen() and entryOpenDirect() without any more work
+ * is published, so that opening a bundle that is already loaded finds its entry
+ * and increments the atomic reference counters of its fallback chain
+ * without locking the mutex. Closing a bundle only decrements the counters.
+ *
+ * Such an entry has real data, is not an alias, and each entry in its fallback chain
+ * has its parent already set or does not get one (root, or "nofallback"),
+ * so that the chain does not change any more while the entry is cached.
+ *
+ * Two snapshot slots take turns, like in ucnv_bld.cpp. The reader count of each slot
+ * includes one reference for the slot itself while it holds a snapshot.
+ * A reader increments the count of the current slot; if the count was 0, then
+ * the slot has been retired and the reader falls back to the mutex.
+ * A writer fills the other slot and makes it current, then drops the old slot's
+ * own reference and waits for its readers to finish before freeing it.
+ * ures_flushCache() deletes entries only after the snapshots that contained them
+ * have been retired this way, and only if their reference counters are still 0.
+ */
+typedef struct {
+    int32_t mask;                       /* capacity-1, with a power-of-2 capacity */
+    UResourceDataEntry *entries[1];     /* linear probing, NULL where empty */
+} UResourceCacheSnapshot;
+
+static UResourceCacheSnapshot *gCacheSnapshots[2] = { NULL, NULL };
+static u_atomic_int32_t gCacheSnapshotReaders[2] = {
+    ATOMIC_INT32_T_INITIALIZER(0), ATOMIC_INT32_T_INITIALIZER(0)
+};
+static u_atomic_int32_t gCurrentCacheSnapshot = ATOMIC_INT32_T_INITIALIZER(0);
+/* TRUE if the cache changed since the last snapshot. Protected by resbMutex. */
+static UBool gCacheChanged = FALSE;
 
 /* INTERNAL: hashes an entry  */
 static int32_t U_CALLCONV hashEntry(const UHashTok parm) {
@@ -92,13 +129,13 @@ static UBool chopLocale(char *name) {
  *  Internal function
  */
 static void entryIncrease(UResourceDataEntry *entry) {
-    umtx_lock(&resbMutex);
-    entry->fCountExisting++;
+    /* The caller holds a reference or the snapshot with the entry, */
+    /* so that the fallback chain is complete and stays in the cache. */
+    umtx_atomic_inc(&entry->fCountExisting);
     while(entry->fParent != NULL) {
       entry = entry->fParent;
-      entry->fCountExisting++;
+      umtx_atomic_inc(&entry->fCountExisting);
     }
-    umtx_unlock(&resbMutex);
 }
 
 /**
@@ -156,18 +193,126 @@ free_entry(UResourceDataEntry *entry) {
         uprv_free(entry->fPath);
     }
     if(entry->fPool != NULL) {
-        --entry->fPool->fCountExisting;
+        umtx_atomic_dec(&entry->fPool->fCountExisting);
     }
     alias = entry->fAlias;
     if(alias != NULL) {
         while(alias->fAlias != NULL) {
             alias = alias->fAlias;
         }
-        --alias->fCountExisting;
+        umtx_atomic_dec(&alias->fCountExisting);
     }
     uprv_free(entry);
 }
 
+static int32_t hashNameAndPath(const char *name, const char *path) {
+    int32_t hash = ustr_hashCharsN(name, (int32_t)uprv_strlen(name));
+    if (path != NULL) {
+        hash += 37 * ustr_hashCharsN(path, (int32_t)uprv_strlen(path));
+    }
+    return hash;
+}
+
+static UBool isSamePath(const char *path1, const char *path2) {
+    return path1 == path2 ||
+        (path1 != NULL && path2 != NULL && uprv_strcmp(path1, path2) == 0);
+}
+
+/*
+ * Returns TRUE if the entry can be returned by entryOpen() and entryOpenDirect()
+ * as is, and keeps its fallback chain while it is cached.
+ * Must be called with resbMutex held.
+ */
+static UBool isCompleteEntry(const UResourceDataEntry *entry) {
+    if (entry->fBogus != U_ZERO_ERROR || entry->fAlias != NULL) {
+        return FALSE;
+    }
+    for (;;) {
+        if (entry->fParent == NULL) {
+            return entry->fData.noFallback || uprv_strcmp(entry->fName, kRootLocaleName) == 0;
+        }
+        entry = entry->fParent;
+    }
+}
+
+/*
+ * Replaces the current snapshot with one of the complete entries in the cache,
+ * or with none if there are none or there is not enough memory,
+ * and frees the old snapshot when no reader uses it any more.
+ * Must be called with resbMutex held.
+ */
+static void publishCacheSnapshot() {
+    UResourceCacheSnapshot *snapshot = NULL;
+    /* With user override data, entryOpen() changes the parents of cached entries. */
+    int32_t count = (cache != NULL && !U_USE_USRDATA) ? uhash_count(cache) : 0;
+    if (count > 0) {
+        int32_t capacity = 16;
+        while (capacity < 2 * count) {
+            capacity <<= 1;
+        }
+        MemoryScopeSuspender suspender;
+        snapshot = (UResourceCacheSnapshot *)uprv_malloc(
+            sizeof(UResourceCacheSnapshot) + (capacity - 1) * sizeof(UResourceDataEntry *));
+        if (snapshot != NULL) {
+            int32_t pos = UHASH_FIRST;
+            const UHashElement *e;
+            snapshot->mask = capacity - 1;
+            uprv_memset(snapshot->entries, 0, capacity * sizeof(UResourceDataEntry *));
+            while ((e = uhash_nextElement(cache, &pos)) != NULL) {
+                UResourceDataEntry *entry = (UResourceDataEntry *)e->value.pointer;
+                if (isCompleteEntry(entry)) {
+                    int32_t i = hashNameAndPath(entry->fName, entry->fPath) & snapshot->mask;
+                    while (snapshot->entries[i] != NULL) {
+                        i = (i + 1) & snapshot->mask;
+                    }
+                    snapshot->entries[i] = entry;
+                }
+            }
+        }
+    }
+
+    int32_t current = umtx_loadAcquire(gCurrentCacheSnapshot);
+    int32_t next = 1 - current;
+    /* The next slot was drained when it was retired. */
+    if (snapshot != NULL) {
+        gCacheSnapshots[next] = snapshot;
+        umtx_atomic_inc(&gCacheSnapshotReaders[next]);
+    }
+    umtx_storeRelease(gCurrentCacheSnapshot, next);
+    if (gCacheSnapshots[current] != NULL) {
+        umtx_atomic_dec(&gCacheSnapshotReaders[current]);
+        /* Readers hold the count for no longer than one lookup. */
+        while (umtx_loadAcquire(gCacheSnapshotReaders[current]) != 0) {}
+        uprv_free(gCacheSnapshots[current]);
+        gCacheSnapshots[current] = NULL;
+    }
+    gCacheChanged = FALSE;
+}
+
+/*
+ * Looks up a bundle in the current snapshot without locking resbMutex,
+ * and increments the reference counters of its entry and of its parents if it is found.
+ * Returns NULL if it is not found; the caller then loads it with the mutex held.
+ */
+static UResourceDataEntry *retainCachedEntry(const char *name, const char *path) {
+    UResourceDataEntry *entry = NULL;
+    int32_t slot = umtx_loadAcquire(gCurrentCacheSnapshot);
+    if (umtx_atomic_inc(&gCacheSnapshotReaders[slot]) > 1) {
+        const UResourceCacheSnapshot *snapshot = gCacheSnapshots[slot];
+        int32_t i = hashNameAndPath(name, path) & snapshot->mask;
+        while ((entry = snapshot->entries[i]) != NULL &&
+                (uprv_strcmp(entry->fName, name) != 0 || !isSamePath(entry->fPath, path))) {
+            i = (i + 1) & snapshot->mask;
+        }
+        if (entry != NULL) {
+            /* Before releasing the snapshot, so that ures_flushCache() keeps the chain. */
+            entryIncrease(entry);
+        }
+    }
+    umtx_atomic_dec(&gCacheSnapshotReaders[slot]);
+    return entry;
+}
+
 /* Works just like ucnv_flushCache() */
 static int32_t ures_flushCache()
 {
@@ -177,6 +322,13 @@ static int32_t ures_flushCache()
     const UHashElement *e;
     UBool deletedMore;
 
+    /*
+     * Entries may be retained by a lock-free entryOpen() while the mutex is held.
+     * Therefore unused entries are first removed from the table and from the snapshot,
+     * and deleted only if they are still unused once the old snapshot is retired.
+     */
+    MaybeStackArray<UResourceDataEntry *, 32> unused;
+
     /*if shared data hasn't even been lazy evaluated yet
     * return 0
     */
@@ -187,6 +339,8 @@ static int32_t ures_flushCache()
     }
 
     do {
+        int32_t unusedCount = 0;
+        UBool isComplete = TRUE;
         deletedMore = FALSE;
         /*creates an enumeration to iterate through every element in the table */
         pos = UHASH_FIRST;
@@ -202,11 +356,32 @@ static int32_t ures_flushCache()
             /* 04/05/2002 [weiv] fCountExisting should now be accurate. If it's not zero, that means that    */
             /* some resource bundles are still open somewhere. */
 
-            if (resB->fCountExisting == 0) {
+            if (umtx_loadAcquire(resB->fCountExisting) == 0) {
+                if (unusedCount == unused.getCapacity() &&
+                        unused.resize(2 * unused.getCapacity(), unusedCount) == NULL) {
+                    /* Out of memory: Keep all entries, rather than leaving
+                     * a cached child of a deleted parent. */
+                    isComplete = FALSE;
+                    break;
+                }
+                uhash_removeElement(cache, e);
+                unused[unusedCount++] = resB;
+            }
+        }
+        if (unusedCount > 0 && isComplete) {
+            publishCacheSnapshot();
+        }
+        for (int32_t i = 0; i < unusedCount; ++i) {
+            resB = unused[i];
+            if (isComplete && umtx_loadAcquire(resB->fCountExisting) == 0) {
                 rbDeletedNum++;
                 deletedMore = TRUE;
-                uhash_removeElement(cache, e);
                 free_entry(resB);
+            } else {
+                /* Opened again before the snapshot was retired, or out of memory. */
+                UErrorCode status = U_ZERO_ERROR;
+                uhash_put(cache, resB, resB, &status);
+                gCacheChanged = TRUE;
             }
         }
         /*
@@ -214,6 +389,9 @@ static int32_t ures_flushCache()
          * got decremented by free_entry().
          */
     } while(deletedMore);
+    if (gCacheChanged) {
+        publishCacheSnapshot();
+    }
     umtx_unlock(&resbMutex);
 
     return rbDeletedNum;
@@ -240,7 +418,7 @@ U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
       resB = (UResourceDataEntry *) e->value.pointer;
       fprintf(stderr,"%s:%d: RB Cache: Entry @0x%p, refcount %d, name %s:%s.  Pool 0x%p, alias 0x%p, parent 0x%p\n",
               __FILE__, __LINE__,
-              (void*)resB, resB->fCountExisting,
+              (void*)resB, (int)umtx_loadAcquire(resB->fCountExisting),
               resB->fName?resB->fName:"NULL",
               resB->fPath?resB->fPath:"NULL",
               (void*)resB->fPool,
@@ -263,6 +441,7 @@ static UBool U_CALLCONV ures_cleanup(void)
         ures_flushCache();
         uhash_close(cache);
         cache = NULL;
+        publishCacheSnapshot();  /* Frees the snapshot. */
     }
     gCacheInitOnce.reset();
     return TRUE;
@@ -320,6 +499,9 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
         return NULL;
     }
 
+    // The entry is cached beyond the current memory scope.
+    MemoryScopeSuspender suspender;
+
     /* here we try to deduce the right locale name */
     if(localeID == NULL) { /* if localeID is NULL, we're trying to open default locale */
         name = uloc_getDefault();
@@ -340,13 +522,14 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
     r = (UResourceDataEntry *)uhash_get(cache, &find);
     if(r == NULL) {
         /* if the entry is not yet in the hash table, we'll try to construct a new one */
+        UTRACE_METRIC_INC(UTRACE_METRIC_RESBUND_CACHE_MISS);
         r = (UResourceDataEntry *) uprv_malloc(sizeof(UResourceDataEntry));
         if(r == NULL) {
             *status = U_MEMORY_ALLOCATION_ERROR;
             return NULL;
         }
 
-        uprv_memset(r, 0, sizeof(UResourceDataEntry));
+        uprv_memset((void *)r, 0, sizeof(UResourceDataEntry));
         /*r->fHashKey = hashValue;*/
 
         setEntryName(r, name, status);
@@ -416,6 +599,8 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
                     *status = cacheStatus;
                     free_entry(r);
                     r = NULL;
+                } else {
+                    gCacheChanged = TRUE;
                 }
             } else {
                 /* somebody have already inserted it while we were working, discard newly opened data */
@@ -425,13 +610,15 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
             }
         }
 
+    } else {
+        UTRACE_METRIC_INC(UTRACE_METRIC_RESBUND_CACHE_HIT);
     }
     if(r != NULL) {
         /* return the real bundle */
         while(r->fAlias != NULL) {
             r = r->fAlias;
         }
-        r->fCountExisting++; /* we increase its reference count */
+        umtx_atomic_inc(&r->fCountExisting); /* we increase its reference count */
         /* if the resource has a warning */
         /* we don't want to overwrite a status with no error */
         if(r->fBogus != U_ZERO_ERROR && U_SUCCESS(*status)) {
@@ -476,7 +663,7 @@ findFirstExisting(const char* path, char* name,
             /* not to be used - as there might be parent   */
             /* lines in cache from previous openings that  */
             /* are not updated yet. */
-            r->fCountExisting--;
+            umtx_atomic_dec(&r->fCountExisting);
             /*entryCloseInt(r);*/
             r = NULL;
             *status = U_USING_FALLBACK_WARNING;
@@ -549,6 +736,7 @@ loadParentsExceptRoot(UResourceDataEntry *&t1,
             }
         }
 
+        gCacheChanged = TRUE;
         if (usingUSRData && U_SUCCESS(usrStatus) && u2->fBogus == U_ZERO_ERROR) {
             t1->fParent = u2;
             u2->fParent = t2;
@@ -576,6 +764,7 @@ insertRootBundle(UResourceDataEntry *&t1, UErrorCode *status) {
     }
     t1->fParent = t2;
     t1 = t2;
+    gCacheChanged = TRUE;
     return TRUE;
 }
 
@@ -635,6 +824,15 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
     uprv_strncpy(name, localeID, sizeof(name) - 1);
     name[sizeof(name) - 1] = 0;
 
+    /* Most bundles are already loaded, with their fallback chains. */
+    if (!usingUSRData && *name != 0) {
+        r = retainCachedEntry(name, path);
+        if (r != NULL) {
+            UTRACE_METRIC_INC(UTRACE_METRIC_RESBUND_CACHE_HIT);
+            return r;
+        }
+    }
+
     if ( usingUSRData ) {
         if ( path == NULL ) {
             uprv_strcpy(usrDataPath, U_USRDATA_NAME);
@@ -741,11 +939,14 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
 
         // TODO: Does this ever loop?
         while(r != NULL && !isRoot && t1->fParent != NULL) {
-            t1->fParent->fCountExisting++;
+            umtx_atomic_inc(&t1->fParent->fCountExisting);
             t1 = t1->fParent;
         }
     } /* umtx_lock */
 finishUnlock:
+    if (gCacheChanged) {
+        publishCacheSnapshot();
+    }
     umtx_unlock(&resbMutex);
 
     if(U_SUCCESS(*status)) {
@@ -771,12 +972,19 @@ entryOpenDirect(const char* path, const char* localeID, UErrorCode* status) {
         return NULL;
     }
 
+    if(localeID != NULL && *localeID != 0) {
+        UResourceDataEntry *r = retainCachedEntry(localeID, path);
+        if(r != NULL) {
+            return r;
+        }
+    }
+
     umtx_lock(&resbMutex);
     // findFirstExisting() without fallbacks.
     UResourceDataEntry *r = init_entry(localeID, path, status);
     if(U_SUCCESS(*status)) {
         if(r->fBogus != U_ZERO_ERROR) {
-            r->fCountExisting--;
+            umtx_atomic_dec(&r->fCountExisting);
             r = NULL;
         }
     } else {
@@ -805,17 +1013,20 @@ entryOpenDirect(const char* path, const char* localeID, UErrorCode* status) {
     if(r != NULL) {
         // TODO: Does this ever loop?
         while(t1->fParent != NULL) {
-            t1->fParent->fCountExisting++;
+            umtx_atomic_inc(&t1->fParent->fCountExisting);
             t1 = t1->fParent;
         }
     }
+    if (gCacheChanged) {
+        publishCacheSnapshot();
+    }
     umtx_unlock(&resbMutex);
     return r;
 }
 
 /**
  * Functions to create and destroy resource bundles.
- *     CAUTION:  resbMutex must be locked when calling this function.
+ *     Entries are deleted only by ures_flushCache(), so this does not need resbMutex.
  */
 /* INTERNAL: */
 static void entryCloseInt(UResourceDataEntry *resB) {
@@ -823,7 +1034,7 @@ static void entryCloseInt(UResourceDataEntry *resB) {
 
     while(resB != NULL) {
         p = resB->fParent;
-        resB->fCountExisting--;
+        umtx_atomic_dec(&resB->fCountExisting);
 
         /* Entries are left in the cache. TODO: add ures_flushCache() to force a flush
          of the cache. */
@@ -852,9 +1063,7 @@ static void entryCloseInt(UResourceDataEntry *resB) {
  */
 
 static void entryClose(UResourceDataEntry *resB) {
-  umtx_lock(&resbMutex);
   entryCloseInt(resB);
-  umtx_unlock(&resbMutex);
 }
 
 /*
@@ -2226,12 +2435,8 @@ U_CFUNC const char* ures_getPath(const UResourceBundle* resB) {
 #endif
 
 static UResourceBundle*
-ures_openWithType(UResourceBundle *r, const char* path, const char* localeID,
-                  UResOpenType openType, UErrorCode* status) {
-    if(U_FAILURE(*status)) {
-        return NULL;
-    }
-
+ures_doOpenWithType(UResourceBundle *r, const char* path, const char* localeID,
+                    UResOpenType openType, UErrorCode* status) {
     UResourceDataEntry *entry;
     if(openType != URES_OPEN_DIRECT) {
         /* first "canonicalize" the locale ID */
@@ -2280,6 +2485,23 @@ ures_openWithType(UResourceBundle *r, const char* path, const char* localeID,
     return r;
 }
 
+static UResourceBundle*
+ures_openWithType(UResourceBundle *r, const char* path, const char* localeID,
+                  UResOpenType openType, UErrorCode* status) {
+    icu::MemoryTagScope memoryTag(UMEM_TAG_RESOURCES);
+    if(U_FAILURE(*status)) {
+        return NULL;
+    }
+    UTRACE_ENTRY_OC(UTRACE_URES_OPEN);
+    UTRACE_DATA3(UTRACE_OPEN_CLOSE, "package %s locale %s openType %d", path, localeID, openType);
+    r = ures_doOpenWithType(r, path, localeID, openType, status);
+    if(r != NULL) {
+        UTRACE_DATA1(UTRACE_OPEN_CLOSE, "loaded %s", r->fData->fName);
+    }
+    UTRACE_EXIT_PTR_STATUS(r, *status);
+    return r;
+}
+
 U_CAPI UResourceBundle* U_EXPORT2
 ures_open(const char* path, const char* localeID, UErrorCode* status) {
     return ures_openWithType(NULL, path, localeID, URES_OPEN_LOCALE_DEFAULT_ROOT, status);
@@ -13,6 +13,9 @@
 #include "unicode/ures.h"
 
 #include "uresdata.h"
+#ifdef __cplusplus
+#include "umutex.h"
+#endif
 
 #define kRootLocaleName         "root"
 #define kPoolBundleName         "pool"
@@ -51,7 +54,12 @@ struct UResourceDataEntry {
     UResourceDataEntry *fPool;
     ResourceData fData; /* data for low level access */
     char fNameBuffer[3]; /* A small buffer of free space for fName. The free space is due to struct padding. */
-    uint32_t fCountExisting; /* how much is this resource used */
+#ifdef __cplusplus
+    /* how much is this resource used; see the cache snapshots in uresbund.cpp */
+    U_NAMESPACE_QUALIFIER u_atomic_int32_t fCountExisting;
+#else
+    int32_t fCountExisting; /* same size and layout, for C code that only needs sizeof() */
+#endif
     UErrorCode fBogus;
     /* int32_t fHashKey;*/ /* for faster access in the hashtable */
 };
@@ -224,14 +232,6 @@ ures_getStringByKeyWithFallback(const UResourceBundle *resB,
                           int32_t* len,
                           UErrorCode *status);
 
-#ifdef __cplusplus
-
-U_CAPI void U_EXPORT2
-ures_getAllItemsWithFallback(const UResourceBundle *bundle, const char *path,
-                             icu::ResourceSink &sink, UErrorCode &errorCode);
-
-#endif  /* __cplusplus */
-
 /**
  * Get a version number by key
  * @param resB bundle containing version number
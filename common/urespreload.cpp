@@ -0,0 +1,206 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+**********************************************************************
+*   file name:  urespreload.cpp
+*   encoding:   UTF-8
+*   indentation:4
+*
+*   created on: 2026oct14
+*
+*   Parallel preloading of the resource bundles of a list of locales
+*/
+
+#include "unicode/utypes.h"
+#include "unicode/udata.h"
+#include "unicode/uloc.h"
+#include "unicode/ures.h"
+#include "cmemory.h"
+#include "ubrkimpl.h"
+#include "udatamem.h"
+#include "umapfile.h"
+#include "umutex.h"
+#include "ureslocs.h"
+#include "utracimp.h"
+
+U_NAMESPACE_USE
+
+namespace {
+
+/** The trees whose bundles ures_preload() opens for each locale. */
+const char * const gPreloadTrees[] = {
+    NULL,  // main locale data
+    U_ICUDATA_NAME U_TREE_SEPARATOR_STRING "coll",
+    U_ICUDATA_BRKITR,
+    U_ICUDATA_ZONE,
+    U_ICUDATA_CURR
+};
+
+/** Upper limit for the number of threads, in addition to the calling one. */
+const int32_t MAX_PRELOAD_THREADS = 32;
+
+/** Bytes per page touched by prefault(); smaller than or equal to the page size. */
+const int32_t PREFAULT_STRIDE = 4096;
+
+struct PreloadTasks {
+    const char * const *locales;
+    int32_t taskCount;
+    u_atomic_int32_t next;
+    u_atomic_int32_t loaded;
+};
+
+/**
+ * Pages in the data of one bundle and of its parents.
+ * This runs without holding any resource bundle lock, so that the threads
+ * wait for disk reads and page faults in parallel. ures_open() then finds
+ * the data in memory while it holds the lock.
+ */
+void prefault(const char *path, const char *localeID) {
+    char name[ULOC_FULLNAME_CAPACITY];
+    UErrorCode errorCode = U_ZERO_ERROR;
+    uloc_getBaseName(localeID, name, UPRV_LENGTHOF(name), &errorCode);
+    if (U_FAILURE(errorCode) || errorCode == U_STRING_NOT_TERMINATED_WARNING) {
+        return;
+    }
+    for (;;) {
+        const char *itemName = *name != 0 ? name : "root";
+        errorCode = U_ZERO_ERROR;
+        UDataMemory *item = udata_open(path, "res", itemName, &errorCode);
+        if (U_SUCCESS(errorCode)) {
+            const uint8_t *bytes = (const uint8_t *)udata_getMemory(item);
+            int32_t length = udata_getLength(item);
+            if (length > 0) {
+                uprv_adviseMappedData(bytes, length, UPRV_MAP_ADVICE_WILLNEED);
+                volatile uint8_t sum = 0;
+                for (int32_t i = 0; i < length; i += PREFAULT_STRIDE) {
+                    sum += bytes[i];
+                }
+            }
+            udata_close(item);
+        }
+        if (*name == 0) {
+            break;
+        }
+        errorCode = U_ZERO_ERROR;
+        char parent[ULOC_FULLNAME_CAPACITY];
+        uloc_getParent(name, parent, UPRV_LENGTHOF(parent), &errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        uprv_memcpy(name, parent, sizeof(name));
+    }
+}
+
+void preloadWorker(PreloadTasks *tasks) {
+    int32_t treeCount = UPRV_LENGTHOF(gPreloadTrees);
+    int32_t task;
+    while ((task = umtx_atomic_inc(&tasks->next) - 1) < tasks->taskCount) {
+        const char *localeID = tasks->locales[task / treeCount];
+        const char *path = gPreloadTrees[task % treeCount];
+        prefault(path, localeID);
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UResourceBundle *bundle = ures_open(path, localeID, &errorCode);
+        if (U_SUCCESS(errorCode) && errorCode != U_USING_DEFAULT_WARNING) {
+            umtx_atomic_inc(&tasks->loaded);
+        }
+        ures_close(bundle);
+    }
+}
+
+// Threads are started with the same platform API as the mutexes in umutex.h,
+// which also includes its header. Without a known one, the calling thread
+// loads all bundles.
+#if defined(U_USER_MUTEX_H)
+typedef int8_t PreloadThread;
+#define U_HAVE_PRELOAD_THREADS 0
+#elif U_PLATFORM_USES_ONLY_WIN32_API
+typedef HANDLE PreloadThread;
+#define U_HAVE_PRELOAD_THREADS 1
+
+DWORD WINAPI preloadThreadMain(LPVOID tasks) {
+    preloadWorker((PreloadTasks *)tasks);
+    return 0;
+}
+
+UBool startThread(PreloadThread &thread, PreloadTasks *tasks) {
+    thread = CreateThread(NULL, 0, preloadThreadMain, tasks, 0, NULL);
+    return thread != NULL;
+}
+
+void joinThread(PreloadThread &thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+#elif U_PLATFORM_IMPLEMENTS_POSIX
+typedef pthread_t PreloadThread;
+#define U_HAVE_PRELOAD_THREADS 1
+
+extern "C" void *preloadThreadMain(void *tasks) {
+    preloadWorker((PreloadTasks *)tasks);
+    return NULL;
+}
+
+UBool startThread(PreloadThread &thread, PreloadTasks *tasks) {
+    return pthread_create(&thread, NULL, preloadThreadMain, tasks) == 0;
+}
+
+void joinThread(PreloadThread &thread) {
+    pthread_join(thread, NULL);
+}
+#else
+typedef int8_t PreloadThread;
+#define U_HAVE_PRELOAD_THREADS 0
+#endif
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+ures_preload(const char * const *locales, int32_t threadCount, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (locales == NULL || threadCount < 1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UTRACE_ENTRY_OC(UTRACE_URES_PRELOAD);
+    UTRACE_DATA1(UTRACE_OPEN_CLOSE, "threads %d", threadCount);
+    int32_t localeCount = 0;
+    while (locales[localeCount] != NULL) {
+        ++localeCount;
+    }
+    PreloadTasks tasks;
+    tasks.locales = locales;
+    tasks.taskCount = localeCount * UPRV_LENGTHOF(gPreloadTrees);
+    tasks.next = 0;
+    tasks.loaded = 0;
+
+    // The calling thread works on the tasks too.
+    int32_t extraThreads = threadCount - 1;
+    if (extraThreads > tasks.taskCount - 1) {
+        extraThreads = tasks.taskCount - 1;
+    }
+    if (extraThreads > MAX_PRELOAD_THREADS) {
+        extraThreads = MAX_PRELOAD_THREADS;
+    }
+    PreloadThread threads[MAX_PRELOAD_THREADS];
+    int32_t started = 0;
+#if U_HAVE_PRELOAD_THREADS
+    // If a thread cannot be started, then the others do its share.
+    while (started < extraThreads && startThread(threads[started], &tasks)) {
+        ++started;
+    }
+#else
+    (void)threads;
+    (void)extraThreads;
+#endif
+    preloadWorker(&tasks);
+#if U_HAVE_PRELOAD_THREADS
+    for (int32_t i = 0; i < started; ++i) {
+        joinThread(threads[i]);
+    }
+#endif
+    int32_t loaded = umtx_loadAcquire(tasks.loaded);
+    UTRACE_EXIT_VALUE_STATUS(loaded, *status);
+    return loaded;
+}
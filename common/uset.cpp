@@ -24,6 +24,7 @@
 #include "unicode/uobject.h"
 #include "unicode/uset.h"
 #include "unicode/uniset.h"
+#include "unicode/localpointer.h"
 #include "cmemory.h"
 #include "unicode/ustring.h"
 #include "unicode/parsepos.h"
@@ -40,6 +41,48 @@ uset_open(UChar32 start, UChar32 end) {
     return (USet*) new UnicodeSet(start, end);
 }
 
+U_CAPI USet* U_EXPORT2
+uset_openRanges(const UChar32 *ranges, int32_t length, UErrorCode *ec) {
+    if (U_FAILURE(*ec)) {
+        return NULL;
+    }
+    LocalPointer<UnicodeSet> set(new UnicodeSet(), *ec);
+    if (U_SUCCESS(*ec) && set->isBogus()) {
+        *ec = U_MEMORY_ALLOCATION_ERROR;
+    }
+    if (U_FAILURE(*ec)) {
+        return NULL;
+    }
+    set->setToRanges(ranges, length, *ec);
+    if (U_FAILURE(*ec)) {
+        return NULL;
+    }
+    return (USet*) set.orphan();
+}
+
+U_CAPI USet* U_EXPORT2
+uset_openSerialized(const USerializedSet *serialized, UErrorCode *ec) {
+    if (U_FAILURE(*ec)) {
+        return NULL;
+    }
+    if (serialized == NULL) {
+        *ec = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    LocalPointer<UnicodeSet> set(new UnicodeSet(), *ec);
+    if (U_SUCCESS(*ec) && set->isBogus()) {
+        *ec = U_MEMORY_ALLOCATION_ERROR;
+    }
+    if (U_FAILURE(*ec)) {
+        return NULL;
+    }
+    set->setToSerialized(*serialized, *ec);
+    if (U_FAILURE(*ec)) {
+        return NULL;
+    }
+    return (USet*) set.orphan();
+}
+
 U_CAPI void U_EXPORT2
 uset_close(USet* set) {
     delete (UnicodeSet*) set;
@@ -621,6 +621,24 @@ isIsolatedTashkeelChar(UChar ch){
 
 
 
+/*
+ *Name     : hasShapingChars
+ *Function : Returns TRUE if the buffer contains a character in the
+ *           Arabic blocks or in the Arabic Presentation Forms blocks.
+ *           Letter shaping and unshaping leave all other characters
+ *           unchanged, and the buffer length too.
+ */
+static UBool
+hasShapingChars(const UChar *source, int32_t sourceLength) {
+    for(int32_t i = 0; i < sourceLength; i++) {
+        UChar ch = source[i];
+        if( (ch >= 0x0600 && ch <= 0x08FF) || (ch >= 0xFB50 && ch <= 0xFEFF) ) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
 /*
  *Name     : calculateSize
  *Function : This function calculates the destSize to be used in preflighting
@@ -1492,7 +1510,13 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
         shapeVars.tailChar = OLD_TAIL_CHAR;
     }
 
-    if((options&U_SHAPE_LETTERS_MASK)!=U_SHAPE_LETTERS_NOOP) {
+    /*
+     * Text without any Arabic characters, as in most of the mixed-content
+     * strings of a user interface, needs no letter shaping;
+     * it is copied like with U_SHAPE_LETTERS_NOOP.
+     */
+    if((options&U_SHAPE_LETTERS_MASK)!=U_SHAPE_LETTERS_NOOP &&
+            hasShapingChars(source, sourceLength)) {
         UChar buffer[300];
         UChar *tempbuffer, *tempsource = NULL;
         int32_t outputSize, spacesCountl=0, spacesCountr=0;
@@ -1558,10 +1582,19 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
         }
 
         /* Start of Arabic letter shaping part */
-        if(outputSize<=UPRV_LENGTHOF(buffer)) {
+        if(tempsource==NULL && outputSize==sourceLength && sourceLength<destCapacity) {
+            /*
+             * The text keeps its length, and the destination has room for it
+             * and for the NUL that the shaping functions may read after it:
+             * shape in-place in the destination.
+             */
+            tempbuffer=dest;
+        } else if(outputSize<UPRV_LENGTHOF(buffer)) {
             outputSize=UPRV_LENGTHOF(buffer);
             tempbuffer=buffer;
         } else {
+            /* with room for the NUL that the shaping functions may read after the text */
+            ++outputSize;
             tempbuffer = (UChar *)uprv_malloc(outputSize*U_SIZEOF_UCHAR);
 
             /*Test for NULL*/
@@ -1576,7 +1609,9 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
             uprv_free(tempsource);
         }
 
-        if(sourceLength<outputSize) {
+        if(tempbuffer==dest) {
+            dest[sourceLength]=0;
+        } else if(sourceLength<outputSize) {
             uprv_memset(tempbuffer+sourceLength, 0, (outputSize-sourceLength)*U_SIZEOF_UCHAR);
         }
 
@@ -1637,9 +1672,11 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
             countSpaces(tempbuffer,destLength,options,&spacesCountl,&spacesCountr);
             invertBuffer(tempbuffer,destLength,options,spacesCountl,spacesCountr);
         }
-        u_memcpy(dest, tempbuffer, uprv_min(destLength, destCapacity));
+        if(tempbuffer!=dest) {
+            u_memcpy(dest, tempbuffer, uprv_min(destLength, destCapacity));
+        }
 
-        if(tempbuffer!=buffer) {
+        if(tempbuffer!=buffer && tempbuffer!=dest) {
             uprv_free(tempbuffer);
         }
 
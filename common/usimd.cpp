@@ -0,0 +1,1149 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// usimd.cpp
+// created: 2026oct14
+
+#include "unicode/utypes.h"
+#include "unicode/utf16.h"
+#include "cmemory.h"
+#include "uassert.h"
+#include "usimd.h"
+
+#if UPRV_HAVE_SSE2
+#   include <emmintrin.h>
+#   if defined(__AVX2__)
+#       include <immintrin.h>
+#   elif defined(__SSSE3__)
+#       include <tmmintrin.h>
+#   endif
+#elif UPRV_HAVE_NEON
+#   include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+#   include <intrin.h>
+#endif
+
+namespace {
+
+/** Index of the lowest set bit; mask must not be 0. */
+inline int32_t lowestBit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int32_t)index;
+#else
+    int32_t i = 0;
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        ++i;
+    }
+    return i;
+#endif
+}
+
+/** Number of set bits. */
+inline int32_t countBits(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(mask);
+#else
+    mask = mask - ((mask >> 1) & 0x55555555);
+    mask = (mask & 0x33333333) + ((mask >> 2) & 0x33333333);
+    return (int32_t)((((mask + (mask >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24);
+#endif
+}
+
+#if UPRV_HAVE_SIMD
+
+#if defined(__GNUC__) || defined(__clang__)
+#   define UPRV_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+#   define UPRV_NO_SANITIZE_ADDRESS
+#endif
+
+/**
+ * The vector loop of uprv_strFindUChar(); s must be 16-byte-aligned.
+ * An aligned block never crosses a page boundary, so reading the whole block
+ * that contains the terminating NUL is safe, although AddressSanitizer
+ * would report the bytes after the NUL.
+ */
+UPRV_NO_SANITIZE_ADDRESS
+const UChar *strFindUCharAligned(const UChar *s, UChar c) {
+#if UPRV_HAVE_SSE2
+    const __m128i vc = _mm_set1_epi16((short)c);
+    const __m128i zero = _mm_setzero_si128();
+    for (;; s += 8) {
+        __m128i v = _mm_load_si128((const __m128i *)s);
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi16(v, vc), _mm_cmpeq_epi16(v, zero)));
+        if (mask != 0) {
+            return s + lowestBit(mask) / 2;
+        }
+    }
+#else  // UPRV_HAVE_NEON
+    const uint16x8_t vc = vdupq_n_u16(c);
+    for (;; s += 8) {
+        uint16x8_t v = vld1q_u16((const uint16_t *)s);
+        if (vmaxvq_u16(vorrq_u16(vceqq_u16(v, vc), vceqzq_u16(v))) != 0) {
+            break;
+        }
+    }
+    UChar u;
+    while ((u = *s) != c && u != 0) {
+        ++s;
+    }
+    return s;
+#endif
+}
+
+#else
+
+// Word-at-a-time fallback: 8 bytes per step.
+const uint64_t ASCII_MASK_64 = 0x8080808080808080ULL;
+const uint64_t ASCII_UCHARS_MASK_64 = 0xff80ff80ff80ff80ULL;
+
+inline uint64_t load64(const uint8_t *s) {
+    uint64_t w;
+    uprv_memcpy(&w, s, 8);  // unaligned-safe; compiles to a single load
+    return w;
+}
+
+/**
+ * Returns bit 7 of each lane set where the lane is an uppercase ASCII letter.
+ * Each lane (byte, or 16-bit unit for UChars) must be <0x80.
+ * Adding 80-'A' sets bit 7 for lanes >='A', adding 80-'Z'-1 for lanes >'Z';
+ * neither carries into the next lane.
+ * ones has the value 1 in each lane.
+ */
+inline uint64_t asciiUpperBits(uint64_t w, uint64_t ones) {
+    uint64_t geA = w + ones * (0x80 - 0x41);
+    uint64_t gtZ = w + ones * (0x80 - 0x5a - 1);
+    return (geA ^ gtZ) & (ones * 0x80);
+}
+
+const uint64_t ONES_64 = 0x0101010101010101ULL;
+const uint64_t UCHAR_ONES_64 = 0x0001000100010001ULL;
+
+#endif
+
+#if UPRV_HAVE_SSE2
+
+/** Swaps the two bytes in each 16-bit lane. */
+inline __m128i swapBytes16(__m128i v) {
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+/** Returns all ones in each 16-bit lane that holds a surrogate, 0 in the others. */
+inline __m128i surrogateLanes(__m128i v) {
+    return _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xf800)),
+                           _mm_set1_epi16((short)0xd800));
+}
+
+#elif UPRV_HAVE_NEON
+
+inline uint16x8_t surrogateLanes(uint16x8_t v) {
+    return vceqq_u16(vandq_u16(v, vdupq_n_u16(0xf800)), vdupq_n_u16(0xd800));
+}
+
+#endif
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+uprv_asciiSpan(const uint8_t *s, int32_t length) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+#   if defined(__AVX2__)
+    for (; (length - i) >= 32; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(v);
+        if (mask != 0) {
+            return i + lowestBit(mask);
+        }
+    }
+#   endif
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(v);
+        if (mask != 0) {
+            return i + lowestBit(mask);
+        }
+    }
+#elif UPRV_HAVE_NEON
+    for (; (length - i) >= 16; i += 16) {
+        if (vmaxvq_u8(vld1q_u8(s + i)) >= 0x80) {
+            break;  // the scalar loop below finds the exact position
+        }
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        if ((load64(s + i) & ASCII_MASK_64) != 0) {
+            break;
+        }
+    }
+#endif
+    while (i < length && s[i] < 0x80) {
+        ++i;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_spanBytesBelow(const uint8_t *s, int32_t length, uint8_t limit) {
+    if (limit == 0) {
+        return 0;
+    }
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    // There is no unsigned byte comparison: b<limit if max(b, limit-1)==limit-1.
+#   if defined(__AVX2__)
+    const __m256i max2 = _mm256_set1_epi8((char)(limit - 1));
+    for (; (length - i) >= 32; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_max_epu8(v, max2), max2));
+        if (mask != 0) {
+            return i + lowestBit(mask);
+        }
+    }
+#   endif
+    const __m128i max = _mm_set1_epi8((char)(limit - 1));
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        uint32_t mask = 0xffff & ~(uint32_t)_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_max_epu8(v, max), max));
+        if (mask != 0) {
+            return i + lowestBit(mask);
+        }
+    }
+#elif UPRV_HAVE_NEON
+    for (; (length - i) >= 16; i += 16) {
+        if (vmaxvq_u8(vld1q_u8(s + i)) >= limit) {
+            break;  // the scalar loop below finds the exact position
+        }
+    }
+#else
+    // Adding 80-limit to the low 7 bits of each byte sets bit 7 exactly for
+    // the bytes whose low 7 bits are >=limit; adding 100-limit sets it for
+    // those whose low 7 bits are >=limit-80. Neither carries into the next byte.
+    // For limit<=80 all bytes 80..FF end the run as well,
+    // for limit>80 only bytes 80..FF can end it.
+    if (limit <= 0x80) {
+        const uint64_t add = ONES_64 * (uint64_t)(0x80 - limit);
+        for (; (length - i) >= 8; i += 8) {
+            uint64_t w = load64(s + i);
+            if ((((w & ~ASCII_MASK_64) + add) | w) & ASCII_MASK_64) {
+                break;
+            }
+        }
+    } else {
+        const uint64_t add = ONES_64 * (uint64_t)(0x100 - limit);
+        for (; (length - i) >= 8; i += 8) {
+            uint64_t w = load64(s + i);
+            if ((((w & ~ASCII_MASK_64) + add) & w) & ASCII_MASK_64) {
+                break;
+            }
+        }
+    }
+#endif
+    while (i < length && s[i] < limit) {
+        ++i;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_asciiToUChars(const uint8_t *src, UChar *dest, int32_t length) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i *)(dest + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+#elif UPRV_HAVE_NEON
+    for (; (length - i) >= 16; i += 16) {
+        uint8x16_t v = vld1q_u8(src + i);
+        if (vmaxvq_u8(v) >= 0x80) {
+            break;
+        }
+        vst1q_u16((uint16_t *)(dest + i), vmovl_u8(vget_low_u8(v)));
+        vst1q_u16((uint16_t *)(dest + i + 8), vmovl_high_u8(v));
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        if ((load64(src + i) & ASCII_MASK_64) != 0) {
+            break;
+        }
+        for (int32_t j = 0; j < 8; ++j) {
+            dest[i + j] = src[i + j];
+        }
+    }
+#endif
+    uint8_t b;
+    while (i < length && (b = src[i]) < 0x80) {
+        dest[i++] = b;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_asciiFromUChars(const UChar *src, uint8_t *dest, int32_t length) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    const __m128i nonASCII = _mm_set1_epi16((short)0xff80);
+    const __m128i zero = _mm_setzero_si128();
+    for (; (length - i) >= 16; i += 16) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(src + i + 8));
+        __m128i high = _mm_and_si128(_mm_or_si128(lo, hi), nonASCII);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xffff) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest + i), _mm_packus_epi16(lo, hi));
+    }
+#elif UPRV_HAVE_NEON
+    for (; (length - i) >= 16; i += 16) {
+        uint16x8_t lo = vld1q_u16((const uint16_t *)(src + i));
+        uint16x8_t hi = vld1q_u16((const uint16_t *)(src + i + 8));
+        if (vmaxvq_u16(vorrq_u16(lo, hi)) >= 0x80) {
+            break;
+        }
+        vst1q_u8(dest + i, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+    }
+#else
+    for (; (length - i) >= 4; i += 4) {
+        uint64_t w;
+        uprv_memcpy(&w, src + i, 8);
+        if ((w & ASCII_UCHARS_MASK_64) != 0) {
+            break;
+        }
+        for (int32_t j = 0; j < 4; ++j) {
+            dest[i + j] = (uint8_t)src[i + j];
+        }
+    }
+#endif
+    UChar c;
+    while (i < length && (c = src[i]) < 0x80) {
+        dest[i++] = (uint8_t)c;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_asciiToLower(const uint8_t *src, uint8_t *dest, int32_t length) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    // Signed comparisons: bytes 80..FF are negative and never uppercase.
+    const __m128i aMinus1 = _mm_set1_epi8(0x41 - 1);
+    const __m128i zPlus1 = _mm_set1_epi8(0x5a + 1);
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, aMinus1), _mm_cmplt_epi8(v, zPlus1));
+        _mm_storeu_si128((__m128i *)(dest + i), _mm_or_si128(v, _mm_and_si128(upper, caseBit)));
+    }
+#elif UPRV_HAVE_NEON
+    const uint8x16_t upperA = vdupq_n_u8(0x41);
+    const uint8x16_t upperZ = vdupq_n_u8(0x5a);
+    const uint8x16_t caseBit = vdupq_n_u8(0x20);
+    for (; (length - i) >= 16; i += 16) {
+        uint8x16_t v = vld1q_u8(src + i);
+        if (vmaxvq_u8(v) >= 0x80) {
+            break;
+        }
+        uint8x16_t upper = vandq_u8(vcgeq_u8(v, upperA), vcleq_u8(v, upperZ));
+        vst1q_u8(dest + i, vorrq_u8(v, vandq_u8(upper, caseBit)));
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        uint64_t w = load64(src + i);
+        if ((w & ASCII_MASK_64) != 0) {
+            break;
+        }
+        w |= asciiUpperBits(w, ONES_64) >> 2;
+        uprv_memcpy(dest + i, &w, 8);
+    }
+#endif
+    uint8_t b;
+    while (i < length && (b = src[i]) < 0x80) {
+        if (0x41 <= b && b <= 0x5a) {
+            b |= 0x20;
+        }
+        dest[i++] = b;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_asciiToLowerUChars(const UChar *src, UChar *dest, int32_t length) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    const __m128i nonASCII = _mm_set1_epi16((short)0xff80);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i aMinus1 = _mm_set1_epi16(0x41 - 1);
+    const __m128i zPlus1 = _mm_set1_epi16(0x5a + 1);
+    const __m128i caseBit = _mm_set1_epi16(0x20);
+    for (; (length - i) >= 16; i += 16) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(src + i + 8));
+        __m128i high = _mm_and_si128(_mm_or_si128(lo, hi), nonASCII);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xffff) {
+            break;
+        }
+        __m128i upperLo = _mm_and_si128(_mm_cmpgt_epi16(lo, aMinus1), _mm_cmplt_epi16(lo, zPlus1));
+        __m128i upperHi = _mm_and_si128(_mm_cmpgt_epi16(hi, aMinus1), _mm_cmplt_epi16(hi, zPlus1));
+        _mm_storeu_si128((__m128i *)(dest + i), _mm_or_si128(lo, _mm_and_si128(upperLo, caseBit)));
+        _mm_storeu_si128((__m128i *)(dest + i + 8), _mm_or_si128(hi, _mm_and_si128(upperHi, caseBit)));
+    }
+#elif UPRV_HAVE_NEON
+    const uint16x8_t upperA = vdupq_n_u16(0x41);
+    const uint16x8_t upperZ = vdupq_n_u16(0x5a);
+    const uint16x8_t caseBit = vdupq_n_u16(0x20);
+    for (; (length - i) >= 8; i += 8) {
+        uint16x8_t v = vld1q_u16((const uint16_t *)(src + i));
+        if (vmaxvq_u16(v) >= 0x80) {
+            break;
+        }
+        uint16x8_t upper = vandq_u16(vcgeq_u16(v, upperA), vcleq_u16(v, upperZ));
+        vst1q_u16((uint16_t *)(dest + i), vorrq_u16(v, vandq_u16(upper, caseBit)));
+    }
+#else
+    for (; (length - i) >= 4; i += 4) {
+        uint64_t w;
+        uprv_memcpy(&w, src + i, 8);
+        if ((w & ASCII_UCHARS_MASK_64) != 0) {
+            break;
+        }
+        w |= asciiUpperBits(w, UCHAR_ONES_64) >> 2;
+        uprv_memcpy(dest + i, &w, 8);
+    }
+#endif
+    UChar c;
+    while (i < length && (c = src[i]) < 0x80) {
+        if (0x41 <= c && c <= 0x5a) {
+            c |= 0x20;
+        }
+        dest[i++] = c;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_asciiSpanNotUpper(const uint8_t *s, int32_t length) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    const __m128i aMinus1 = _mm_set1_epi8(0x41 - 1);
+    const __m128i zPlus1 = _mm_set1_epi8(0x5a + 1);
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, aMinus1), _mm_cmplt_epi8(v, zPlus1));
+        uint32_t stop = (uint32_t)_mm_movemask_epi8(_mm_or_si128(v, upper));
+        if (stop != 0) {
+            return i + lowestBit(stop);
+        }
+    }
+#elif UPRV_HAVE_NEON
+    const uint8x16_t upperA = vdupq_n_u8(0x41);
+    const uint8x16_t upperZ = vdupq_n_u8(0x5a);
+    for (; (length - i) >= 16; i += 16) {
+        uint8x16_t v = vld1q_u8(s + i);
+        uint8x16_t upper = vandq_u8(vcgeq_u8(v, upperA), vcleq_u8(v, upperZ));
+        if (vmaxvq_u8(vorrq_u8(v, upper)) >= 0x80) {
+            break;  // the scalar loop below finds the exact position
+        }
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        uint64_t w = load64(s + i);
+        if ((w & ASCII_MASK_64) != 0 || asciiUpperBits(w, ONES_64) != 0) {
+            break;
+        }
+    }
+#endif
+    uint8_t b;
+    while (i < length && (b = s[i]) < 0x80 && !(0x41 <= b && b <= 0x5a)) {
+        ++i;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_asciiSpanNotUpperUChars(const UChar *s, int32_t length) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    const __m128i nonASCII = _mm_set1_epi16((short)0xff80);
+    const __m128i aMinus1 = _mm_set1_epi16(0x41 - 1);
+    const __m128i zPlus1 = _mm_set1_epi16(0x5a + 1);
+    for (; (length - i) >= 8; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi16(v, aMinus1), _mm_cmplt_epi16(v, zPlus1));
+        // Both halves of each stop unit are nonzero; take the low byte's bit.
+        __m128i stop16 = _mm_or_si128(upper, _mm_xor_si128(
+            _mm_cmpeq_epi16(_mm_and_si128(v, nonASCII), _mm_setzero_si128()), _mm_set1_epi16(-1)));
+        uint32_t stop = (uint32_t)_mm_movemask_epi8(stop16) & 0x5555;
+        if (stop != 0) {
+            return i + lowestBit(stop) / 2;
+        }
+    }
+#elif UPRV_HAVE_NEON
+    const uint16x8_t upperA = vdupq_n_u16(0x41);
+    const uint16x8_t upperZ = vdupq_n_u16(0x5a);
+    for (; (length - i) >= 8; i += 8) {
+        uint16x8_t v = vld1q_u16((const uint16_t *)(s + i));
+        uint16x8_t upper = vandq_u16(vcgeq_u16(v, upperA), vcleq_u16(v, upperZ));
+        if (vmaxvq_u16(vorrq_u16(v, upper)) >= 0x80) {
+            break;  // the scalar loop below finds the exact position
+        }
+    }
+#else
+    for (; (length - i) >= 4; i += 4) {
+        uint64_t w;
+        uprv_memcpy(&w, s + i, 8);
+        if ((w & ASCII_UCHARS_MASK_64) != 0 || asciiUpperBits(w, UCHAR_ONES_64) != 0) {
+            break;
+        }
+    }
+#endif
+    UChar c;
+    while (i < length && (c = s[i]) < 0x80 && !(0x41 <= c && c <= 0x5a)) {
+        ++i;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_latin1SpanNotControlUChars(const UChar *s, int32_t length) {
+    // A Latin-1 UChar is a C0 or C1 control (00..1F, 80..9F) iff its bits 6..5 are 0.
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    const __m128i nonLatin1 = _mm_set1_epi16((short)0xff00);
+    const __m128i bits65 = _mm_set1_epi16(0x60);
+    const __m128i zero = _mm_setzero_si128();
+    for (; (length - i) >= 8; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i control = _mm_cmpeq_epi16(_mm_and_si128(v, bits65), zero);
+        __m128i ok = _mm_andnot_si128(control, _mm_cmpeq_epi16(_mm_and_si128(v, nonLatin1), zero));
+        // Both bytes of each 16-bit result are equal; take the low byte's bit.
+        uint32_t stop = ~(uint32_t)_mm_movemask_epi8(ok) & 0x5555;
+        if (stop != 0) {
+            return i + lowestBit(stop) / 2;
+        }
+    }
+#elif UPRV_HAVE_NEON
+    const uint16x8_t latin1Max = vdupq_n_u16(0xff);
+    const uint16x8_t bits65 = vdupq_n_u16(0x60);
+    for (; (length - i) >= 8; i += 8) {
+        uint16x8_t v = vld1q_u16((const uint16_t *)(s + i));
+        uint16x8_t ok = vandq_u16(vcleq_u16(v, latin1Max), vtstq_u16(v, bits65));
+        if (vminvq_u16(ok) == 0) {
+            break;  // the scalar loop below finds the exact position
+        }
+    }
+#else
+    for (; (length - i) >= 4; i += 4) {
+        uint64_t w;
+        uprv_memcpy(&w, s + i, 8);
+        // Adding 0x60 to bits 6..5 of a lane sets its bit 7 unless they are 0.
+        if ((w & 0xff00ff00ff00ff00ULL) != 0 ||
+                (((w & (UCHAR_ONES_64 * 0x60)) + UCHAR_ONES_64 * 0x60) & (UCHAR_ONES_64 * 0x80)) !=
+                    UCHAR_ONES_64 * 0x80) {
+            break;
+        }
+    }
+#endif
+    UChar c;
+    while (i < length && (c = s[i]) <= 0xff && (c & 0x60) != 0) {
+        ++i;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_asciiCaseEqualSpanUChars(const UChar *s1, const UChar *s2, int32_t length) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    const __m128i nonASCII = _mm_set1_epi16((short)0xff80);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i aMinus1 = _mm_set1_epi16(0x41 - 1);
+    const __m128i zPlus1 = _mm_set1_epi16(0x5a + 1);
+    const __m128i caseBit = _mm_set1_epi16(0x20);
+    for (; (length - i) >= 8; i += 8) {
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(s1 + i));
+        __m128i v2 = _mm_loadu_si128((const __m128i *)(s2 + i));
+        __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(v1, v2), nonASCII), zero);
+        v1 = _mm_or_si128(v1, _mm_and_si128(caseBit,
+            _mm_and_si128(_mm_cmpgt_epi16(v1, aMinus1), _mm_cmplt_epi16(v1, zPlus1))));
+        v2 = _mm_or_si128(v2, _mm_and_si128(caseBit,
+            _mm_and_si128(_mm_cmpgt_epi16(v2, aMinus1), _mm_cmplt_epi16(v2, zPlus1))));
+        __m128i same = _mm_and_si128(ascii, _mm_cmpeq_epi16(v1, v2));
+        // Both bytes of each 16-bit result are equal; take the low byte's bit.
+        uint32_t stop = ~(uint32_t)_mm_movemask_epi8(same) & 0x5555;
+        if (stop != 0) {
+            return i + lowestBit(stop) / 2;
+        }
+    }
+#elif UPRV_HAVE_NEON
+    const uint16x8_t upperA = vdupq_n_u16(0x41);
+    const uint16x8_t upperZ = vdupq_n_u16(0x5a);
+    const uint16x8_t caseBit = vdupq_n_u16(0x20);
+    for (; (length - i) >= 8; i += 8) {
+        uint16x8_t v1 = vld1q_u16((const uint16_t *)(s1 + i));
+        uint16x8_t v2 = vld1q_u16((const uint16_t *)(s2 + i));
+        if (vmaxvq_u16(vorrq_u16(v1, v2)) >= 0x80) {
+            break;
+        }
+        v1 = vorrq_u16(v1, vandq_u16(caseBit, vandq_u16(vcgeq_u16(v1, upperA), vcleq_u16(v1, upperZ))));
+        v2 = vorrq_u16(v2, vandq_u16(caseBit, vandq_u16(vcgeq_u16(v2, upperA), vcleq_u16(v2, upperZ))));
+        if (vminvq_u16(vceqq_u16(v1, v2)) == 0) {
+            break;  // the scalar loop below finds the exact position
+        }
+    }
+#else
+    for (; (length - i) >= 4; i += 4) {
+        uint64_t w1, w2;
+        uprv_memcpy(&w1, s1 + i, 8);
+        uprv_memcpy(&w2, s2 + i, 8);
+        if (((w1 | w2) & ASCII_UCHARS_MASK_64) != 0 ||
+                (w1 | (asciiUpperBits(w1, UCHAR_ONES_64) >> 2)) !=
+                    (w2 | (asciiUpperBits(w2, UCHAR_ONES_64) >> 2))) {
+            break;
+        }
+    }
+#endif
+    UChar c1, c2;
+    while (i < length && ((c1 = s1[i]) | (c2 = s2[i])) < 0x80) {
+        if (0x41 <= c1 && c1 <= 0x5a) {
+            c1 |= 0x20;
+        }
+        if (0x41 <= c2 && c2 <= 0x5a) {
+            c2 |= 0x20;
+        }
+        if (c1 != c2) {
+            break;
+        }
+        ++i;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_asciiSpanInSet(const uint8_t *s, int32_t length, const uint8_t asciiBits[16], UBool contained) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2 && UPRV_HAVE_SIMD_LOOKUP
+    // Look up the row byte with the low nibble and the column bit with the high nibble.
+    // Bytes 80..FF have high nibbles 8..F which select a zero column bit,
+    // so they are never in the set and need to be excluded separately
+    // only when spanning not-contained bytes.
+    const __m128i rows = _mm_loadu_si128((const __m128i *)asciiBits);
+    const __m128i columns = _mm_setr_epi8(1, 2, 4, 8, 0x10, 0x20, 0x40, (char)0x80,
+                                          0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nibbleMask = _mm_set1_epi8(0xf);
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t flip = contained ? 0 : 0xffff;
+#   if defined(__AVX2__)
+    const __m256i rows2 = _mm256_broadcastsi128_si256(rows);
+    const __m256i columns2 = _mm256_broadcastsi128_si256(columns);
+    const __m256i nibbleMask2 = _mm256_set1_epi8(0xf);
+    uint32_t flip2 = contained ? 0 : 0xffffffff;
+    for (; (length - i) >= 32; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+        __m256i row = _mm256_shuffle_epi8(rows2, _mm256_and_si256(v, nibbleMask2));
+        __m256i column = _mm256_shuffle_epi8(
+            columns2, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibbleMask2));
+        __m256i notIn = _mm256_cmpeq_epi8(_mm256_and_si256(row, column), _mm256_setzero_si256());
+        uint32_t stop = ((uint32_t)_mm256_movemask_epi8(notIn) ^ flip2) |
+            (uint32_t)_mm256_movemask_epi8(v);
+        if (stop != 0) {
+            return i + lowestBit(stop);
+        }
+    }
+#   endif
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i row = _mm_shuffle_epi8(rows, _mm_and_si128(v, nibbleMask));
+        __m128i column = _mm_shuffle_epi8(columns, _mm_and_si128(_mm_srli_epi16(v, 4), nibbleMask));
+        __m128i notIn = _mm_cmpeq_epi8(_mm_and_si128(row, column), zero);
+        uint32_t stop = ((uint32_t)_mm_movemask_epi8(notIn) ^ flip) | (uint32_t)_mm_movemask_epi8(v);
+        if (stop != 0) {
+            return i + lowestBit(stop);
+        }
+    }
+#elif UPRV_HAVE_NEON
+    const uint8x16_t rows = vld1q_u8(asciiBits);
+    static const uint8_t columnBits[16] = { 1, 2, 4, 8, 0x10, 0x20, 0x40, 0x80 };
+    const uint8x16_t columns = vld1q_u8(columnBits);
+    const uint8x16_t nibbleMask = vdupq_n_u8(0xf);
+    const uint8x16_t flip = vdupq_n_u8(contained ? 0 : 0xff);
+    for (; (length - i) >= 16; i += 16) {
+        uint8x16_t v = vld1q_u8(s + i);
+        uint8x16_t row = vqtbl1q_u8(rows, vandq_u8(v, nibbleMask));
+        uint8x16_t column = vqtbl1q_u8(columns, vshrq_n_u8(v, 4));
+        uint8x16_t notIn = vceqq_u8(vandq_u8(row, column), vdupq_n_u8(0));
+        uint8x16_t stop = vorrq_u8(veorq_u8(notIn, flip), vcgeq_u8(v, vdupq_n_u8(0x80)));
+        if (vmaxvq_u8(stop) != 0) {
+            break;  // the scalar loop below finds the exact position
+        }
+    }
+#endif
+    uint8_t b;
+    while (i < length && (b = s[i]) < 0x80 &&
+            (UBool)((asciiBits[b & 0xf] >> (b >> 4)) & 1) == contained) {
+        ++i;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_findUChars(const UChar *s, int32_t length, const UChar *units, int32_t count) {
+    U_ASSERT(1 <= count && count <= 4);
+    // Repeat the first unit for the unused ones.
+    UChar u0 = units[0];
+    UChar u1 = count > 1 ? units[1] : u0;
+    UChar u2 = count > 2 ? units[2] : u0;
+    UChar u3 = count > 3 ? units[3] : u0;
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    const __m128i v0 = _mm_set1_epi16((short)u0);
+    const __m128i v1 = _mm_set1_epi16((short)u1);
+    const __m128i v2 = _mm_set1_epi16((short)u2);
+    const __m128i v3 = _mm_set1_epi16((short)u3);
+    for (; (length - i) >= 16; i += 16) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(s + i + 8));
+        __m128i eqLo = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi16(lo, v0), _mm_cmpeq_epi16(lo, v1)),
+            _mm_or_si128(_mm_cmpeq_epi16(lo, v2), _mm_cmpeq_epi16(lo, v3)));
+        __m128i eqHi = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi16(hi, v0), _mm_cmpeq_epi16(hi, v1)),
+            _mm_or_si128(_mm_cmpeq_epi16(hi, v2), _mm_cmpeq_epi16(hi, v3)));
+        // Pack the 16-bit 0/-1 results into one byte per UChar.
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(eqLo, eqHi));
+        if (mask != 0) {
+            return i + lowestBit(mask);
+        }
+    }
+#elif UPRV_HAVE_NEON
+    const uint16x8_t v0 = vdupq_n_u16(u0);
+    const uint16x8_t v1 = vdupq_n_u16(u1);
+    const uint16x8_t v2 = vdupq_n_u16(u2);
+    const uint16x8_t v3 = vdupq_n_u16(u3);
+    for (; (length - i) >= 8; i += 8) {
+        uint16x8_t v = vld1q_u16((const uint16_t *)(s + i));
+        uint16x8_t eq = vorrq_u16(vorrq_u16(vceqq_u16(v, v0), vceqq_u16(v, v1)),
+                                  vorrq_u16(vceqq_u16(v, v2), vceqq_u16(v, v3)));
+        if (vmaxvq_u16(eq) != 0) {
+            break;  // the scalar loop below finds the exact position
+        }
+    }
+#endif
+    UChar c;
+    while (i < length && (c = s[i]) != u0 && c != u1 && c != u2 && c != u3) {
+        ++i;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_findUCharPair(const UChar *s, int32_t length, UChar first, UChar last, int32_t distance) {
+    U_ASSERT(distance >= 1);
+    int32_t limit = length - distance;  // exclusive limit for i
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    const __m128i vFirst = _mm_set1_epi16((short)first);
+    const __m128i vLast = _mm_set1_epi16((short)last);
+    for (; (limit - i) >= 16; i += 16) {
+        __m128i eqLo = _mm_and_si128(
+            _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)(s + i)), vFirst),
+            _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)(s + i + distance)), vLast));
+        __m128i eqHi = _mm_and_si128(
+            _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)(s + i + 8)), vFirst),
+            _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)(s + i + 8 + distance)), vLast));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(eqLo, eqHi));
+        if (mask != 0) {
+            return i + lowestBit(mask);
+        }
+    }
+#elif UPRV_HAVE_NEON
+    const uint16x8_t vFirst = vdupq_n_u16(first);
+    const uint16x8_t vLast = vdupq_n_u16(last);
+    for (; (limit - i) >= 8; i += 8) {
+        uint16x8_t eq = vandq_u16(
+            vceqq_u16(vld1q_u16((const uint16_t *)(s + i)), vFirst),
+            vceqq_u16(vld1q_u16((const uint16_t *)(s + i + distance)), vLast));
+        if (vmaxvq_u16(eq) != 0) {
+            break;  // the scalar loop below finds the exact position
+        }
+    }
+#endif
+    for (; i < limit; ++i) {
+        if (s[i] == first && s[i + distance] == last) {
+            return i;
+        }
+    }
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_equalPrefixBytes(const uint8_t *s1, const uint8_t *s2, int32_t length) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+#   if defined(__AVX2__)
+    for (; (length - i) >= 32; i += 32) {
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(s1 + i));
+        __m256i v2 = _mm256_loadu_si256((const __m256i *)(s2 + i));
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v1, v2));
+        if (mask != 0) {
+            return i + lowestBit(mask);
+        }
+    }
+#   endif
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(s1 + i));
+        __m128i v2 = _mm_loadu_si128((const __m128i *)(s2 + i));
+        uint32_t mask = 0xffff & ~(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v1, v2));
+        if (mask != 0) {
+            return i + lowestBit(mask);
+        }
+    }
+#elif UPRV_HAVE_NEON
+    for (; (length - i) >= 16; i += 16) {
+        if (vminvq_u8(vceqq_u8(vld1q_u8(s1 + i), vld1q_u8(s2 + i))) == 0) {
+            break;  // the word loop below finds the exact position
+        }
+    }
+#endif
+    // Also after the vector loops: Collators often compare short strings.
+    for (; (length - i) >= 8; i += 8) {
+        uint64_t w1, w2;
+        uprv_memcpy(&w1, s1 + i, 8);
+        uprv_memcpy(&w2, s2 + i, 8);
+        if (w1 != w2) {
+#if U_IS_BIG_ENDIAN
+            break;
+#else
+            // The lowest differing bit is in the first differing byte.
+            uint64_t diff = w1 ^ w2;
+            uint32_t low = (uint32_t)diff;
+            return i + (low != 0 ? lowestBit(low) : 32 + lowestBit((uint32_t)(diff >> 32))) / 8;
+#endif
+        }
+    }
+    while (i < length && s1[i] == s2[i]) {
+        ++i;
+    }
+    return i;
+}
+
+U_CAPI const UChar * U_EXPORT2
+uprv_strFindUChar(const UChar *s, UChar c) {
+#if UPRV_HAVE_SIMD
+    if (((uintptr_t)s & 1) == 0) {
+        // Check the UChars before the first aligned block one at a time.
+        for (; ((uintptr_t)s & 15) != 0; ++s) {
+            UChar u = *s;
+            if (u == c || u == 0) {
+                return s;
+            }
+        }
+        return strFindUCharAligned(s, c);
+    }
+#endif
+    UChar u;
+    while ((u = *s) != c && u != 0) {
+        ++s;
+    }
+    return s;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_countSurrogatePairs(const UChar *s, int32_t length) {
+    int32_t count = 0;
+    int32_t i = 0;
+    // Each vector loop reads the unit after its block as well,
+    // for a trail surrogate after a lead surrogate at the end of the block.
+#if UPRV_HAVE_SSE2
+#   if defined(__AVX2__)
+    const __m256i surrogateBits2 = _mm256_set1_epi16((short)0xfc00);
+    const __m256i lead2 = _mm256_set1_epi16((short)0xd800);
+    const __m256i trail2 = _mm256_set1_epi16((short)0xdc00);
+    for (; (length - i) > 16; i += 16) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+        __m256i next = _mm256_loadu_si256((const __m256i *)(s + i + 1));
+        __m256i pairs = _mm256_and_si256(
+            _mm256_cmpeq_epi16(_mm256_and_si256(v, surrogateBits2), lead2),
+            _mm256_cmpeq_epi16(_mm256_and_si256(next, surrogateBits2), trail2));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(pairs);
+        if (mask != 0) {
+            count += countBits(mask) / 2;  // two mask bits per UChar
+        }
+    }
+#   endif
+    const __m128i surrogateBits = _mm_set1_epi16((short)0xfc00);
+    const __m128i lead = _mm_set1_epi16((short)0xd800);
+    const __m128i trail = _mm_set1_epi16((short)0xdc00);
+    for (; (length - i) > 8; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i next = _mm_loadu_si128((const __m128i *)(s + i + 1));
+        __m128i pairs = _mm_and_si128(
+            _mm_cmpeq_epi16(_mm_and_si128(v, surrogateBits), lead),
+            _mm_cmpeq_epi16(_mm_and_si128(next, surrogateBits), trail));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(pairs);
+        if (mask != 0) {
+            count += countBits(mask) / 2;  // two mask bits per UChar
+        }
+    }
+#elif UPRV_HAVE_NEON
+    const uint16x8_t surrogateBits = vdupq_n_u16(0xfc00);
+    const uint16x8_t lead = vdupq_n_u16(0xd800);
+    const uint16x8_t trail = vdupq_n_u16(0xdc00);
+    for (; (length - i) > 8; i += 8) {
+        uint16x8_t v = vld1q_u16((const uint16_t *)(s + i));
+        uint16x8_t next = vld1q_u16((const uint16_t *)(s + i + 1));
+        uint16x8_t pairs = vandq_u16(
+            vceqq_u16(vandq_u16(v, surrogateBits), lead),
+            vceqq_u16(vandq_u16(next, surrogateBits), trail));
+        count += vaddvq_u16(vshrq_n_u16(pairs, 15));
+    }
+#endif
+    for (; (length - i) > 1; ++i) {
+        if (U16_IS_LEAD(s[i]) && U16_IS_TRAIL(s[i + 1])) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// The vector code for the UTF-16/UTF-32 byte serializations below
+// assumes a little-endian platform; SSE2 implies one,
+// and big-endian AArch64 uses the portable code.
+
+U_CAPI int32_t U_EXPORT2
+uprv_bytesToUCharsNoSurrogates(const uint8_t *src, UChar *dest, int32_t length, UBool bigEndian) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    for (; (length - i) >= 16; i += 16) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(src + 2 * i));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(src + 2 * i + 16));
+        if (bigEndian) {
+            lo = swapBytes16(lo);
+            hi = swapBytes16(hi);
+        }
+        if (_mm_movemask_epi8(_mm_or_si128(surrogateLanes(lo), surrogateLanes(hi))) != 0) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest + i), lo);
+        _mm_storeu_si128((__m128i *)(dest + i + 8), hi);
+    }
+#elif UPRV_HAVE_NEON && !U_IS_BIG_ENDIAN
+    for (; (length - i) >= 16; i += 16) {
+        uint8x16_t lo8 = vld1q_u8(src + 2 * i);
+        uint8x16_t hi8 = vld1q_u8(src + 2 * i + 16);
+        if (bigEndian) {
+            lo8 = vrev16q_u8(lo8);
+            hi8 = vrev16q_u8(hi8);
+        }
+        uint16x8_t lo = vreinterpretq_u16_u8(lo8);
+        uint16x8_t hi = vreinterpretq_u16_u8(hi8);
+        if (vmaxvq_u16(vorrq_u16(surrogateLanes(lo), surrogateLanes(hi))) != 0) {
+            break;
+        }
+        vst1q_u16((uint16_t *)(dest + i), lo);
+        vst1q_u16((uint16_t *)(dest + i + 8), hi);
+    }
+#endif
+    for (; i < length; ++i) {
+        const uint8_t *p = src + 2 * i;
+        UChar c = bigEndian ? (UChar)((p[0] << 8) | p[1]) : (UChar)((p[1] << 8) | p[0]);
+        if (U16_IS_SURROGATE(c)) {
+            break;
+        }
+        dest[i] = c;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_uCharsToBytesNoSurrogates(const UChar *src, uint8_t *dest, int32_t length, UBool bigEndian) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    for (; (length - i) >= 16; i += 16) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(src + i + 8));
+        if (_mm_movemask_epi8(_mm_or_si128(surrogateLanes(lo), surrogateLanes(hi))) != 0) {
+            break;
+        }
+        if (bigEndian) {
+            lo = swapBytes16(lo);
+            hi = swapBytes16(hi);
+        }
+        _mm_storeu_si128((__m128i *)(dest + 2 * i), lo);
+        _mm_storeu_si128((__m128i *)(dest + 2 * i + 16), hi);
+    }
+#elif UPRV_HAVE_NEON && !U_IS_BIG_ENDIAN
+    for (; (length - i) >= 16; i += 16) {
+        uint16x8_t lo = vld1q_u16((const uint16_t *)(src + i));
+        uint16x8_t hi = vld1q_u16((const uint16_t *)(src + i + 8));
+        if (vmaxvq_u16(vorrq_u16(surrogateLanes(lo), surrogateLanes(hi))) != 0) {
+            break;
+        }
+        uint8x16_t lo8 = vreinterpretq_u8_u16(lo);
+        uint8x16_t hi8 = vreinterpretq_u8_u16(hi);
+        if (bigEndian) {
+            lo8 = vrev16q_u8(lo8);
+            hi8 = vrev16q_u8(hi8);
+        }
+        vst1q_u8(dest + 2 * i, lo8);
+        vst1q_u8(dest + 2 * i + 16, hi8);
+    }
+#endif
+    for (; i < length; ++i) {
+        UChar c = src[i];
+        if (U16_IS_SURROGATE(c)) {
+            break;
+        }
+        uint8_t *p = dest + 2 * i;
+        if (bigEndian) {
+            p[0] = (uint8_t)(c >> 8);
+            p[1] = (uint8_t)c;
+        } else {
+            p[0] = (uint8_t)c;
+            p[1] = (uint8_t)(c >> 8);
+        }
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_utf32BytesToUCharsBMP(const uint8_t *src, UChar *dest, int32_t length, UBool bigEndian) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    // A BMP code point has two zero bytes: the high 16 bits of a UTF-32LE lane,
+    // or the low 16 bits of a UTF-32BE lane read on this little-endian platform.
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias32 = _mm_set1_epi32(0x8000);
+    const __m128i bias16 = _mm_set1_epi16((short)0x8000);
+    const __m128i zeroBits = bigEndian ? _mm_set1_epi32(0xffff) : _mm_set1_epi32((int)0xffff0000);
+    for (; (length - i) >= 8; i += 8) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(src + 4 * i));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(src + 4 * i + 16));
+        __m128i nonBMP = _mm_and_si128(_mm_or_si128(lo, hi), zeroBits);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(nonBMP, zero)) != 0xffff) {
+            break;
+        }
+        if (bigEndian) {
+            lo = _mm_srli_epi32(lo, 16);
+            hi = _mm_srli_epi32(hi, 16);
+        }
+        // Narrow the 32-bit lanes 0..FFFF to 16 bits with the signed-saturating pack.
+        __m128i v = _mm_add_epi16(
+            _mm_packs_epi32(_mm_sub_epi32(lo, bias32), _mm_sub_epi32(hi, bias32)), bias16);
+        if (bigEndian) {
+            v = swapBytes16(v);
+        }
+        if (_mm_movemask_epi8(surrogateLanes(v)) != 0) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest + i), v);
+    }
+#elif UPRV_HAVE_NEON && !U_IS_BIG_ENDIAN
+    for (; (length - i) >= 8; i += 8) {
+        uint8x16_t lo8 = vld1q_u8(src + 4 * i);
+        uint8x16_t hi8 = vld1q_u8(src + 4 * i + 16);
+        if (bigEndian) {
+            lo8 = vrev32q_u8(lo8);
+            hi8 = vrev32q_u8(hi8);
+        }
+        uint32x4_t lo = vreinterpretq_u32_u8(lo8);
+        uint32x4_t hi = vreinterpretq_u32_u8(hi8);
+        if (vmaxvq_u32(vorrq_u32(lo, hi)) > 0xffff) {
+            break;
+        }
+        uint16x8_t v = vcombine_u16(vmovn_u32(lo), vmovn_u32(hi));
+        if (vmaxvq_u16(surrogateLanes(v)) != 0) {
+            break;
+        }
+        vst1q_u16((uint16_t *)(dest + i), v);
+    }
+#endif
+    for (; i < length; ++i) {
+        const uint8_t *p = src + 4 * i;
+        uint32_t c = bigEndian ?
+            ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3] :
+            ((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+        if (c > 0xffff || U_IS_SURROGATE(c)) {
+            break;
+        }
+        dest[i] = (UChar)c;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_uCharsToUTF32BytesBMP(const UChar *src, uint8_t *dest, int32_t length, UBool bigEndian) {
+    int32_t i = 0;
+#if UPRV_HAVE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; (length - i) >= 8; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(surrogateLanes(v)) != 0) {
+            break;
+        }
+        __m128i lo, hi;
+        if (bigEndian) {
+            v = swapBytes16(v);
+            lo = _mm_unpacklo_epi16(zero, v);
+            hi = _mm_unpackhi_epi16(zero, v);
+        } else {
+            lo = _mm_unpacklo_epi16(v, zero);
+            hi = _mm_unpackhi_epi16(v, zero);
+        }
+        _mm_storeu_si128((__m128i *)(dest + 4 * i), lo);
+        _mm_storeu_si128((__m128i *)(dest + 4 * i + 16), hi);
+    }
+#elif UPRV_HAVE_NEON && !U_IS_BIG_ENDIAN
+    for (; (length - i) >= 8; i += 8) {
+        uint16x8_t v = vld1q_u16((const uint16_t *)(src + i));
+        if (vmaxvq_u16(surrogateLanes(v)) != 0) {
+            break;
+        }
+        uint8x16_t lo8 = vreinterpretq_u8_u32(vmovl_u16(vget_low_u16(v)));
+        uint8x16_t hi8 = vreinterpretq_u8_u32(vmovl_high_u16(v));
+        if (bigEndian) {
+            lo8 = vrev32q_u8(lo8);
+            hi8 = vrev32q_u8(hi8);
+        }
+        vst1q_u8(dest + 4 * i, lo8);
+        vst1q_u8(dest + 4 * i + 16, hi8);
+    }
+#endif
+    for (; i < length; ++i) {
+        UChar c = src[i];
+        if (U16_IS_SURROGATE(c)) {
+            break;
+        }
+        uint8_t *p = dest + 4 * i;
+        if (bigEndian) {
+            p[0] = 0;
+            p[1] = 0;
+            p[2] = (uint8_t)(c >> 8);
+            p[3] = (uint8_t)c;
+        } else {
+            p[0] = (uint8_t)c;
+            p[1] = (uint8_t)(c >> 8);
+            p[2] = 0;
+            p[3] = 0;
+        }
+    }
+    return i;
+}
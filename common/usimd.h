@@ -0,0 +1,329 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// usimd.h
+// created: 2026oct14
+
+// Internal helpers for scanning and copying long runs of code units
+// several units at a time.
+// The implementations use SSE2/AVX2 on x86, NEON on AArch64, and
+// word-at-a-time ("SWAR") code elsewhere. The code paths are selected
+// at compile time; SSE2 and NEON are part of the baseline instruction sets
+// of x86-64 and AArch64, so no runtime CPU detection is needed for them.
+//
+// These functions are intended for the inner loops of converters and
+// string transformations: the caller handles the end of a run and any
+// non-trivial code units with its regular code.
+
+#ifndef __USIMD_H__
+#define __USIMD_H__
+
+#include "unicode/utypes.h"
+
+/**
+ * Defined to 1 when the usimd functions use vector instructions,
+ * 0 when they use the portable word-at-a-time code.
+ * Define UPRV_SIMD_DISABLE to force the portable code.
+ * @internal
+ */
+#ifdef UPRV_HAVE_SIMD
+    // Use the predefined value.
+#elif defined(UPRV_SIMD_DISABLE)
+#   define UPRV_HAVE_SIMD 0
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define UPRV_HAVE_SIMD 1
+#   define UPRV_HAVE_SSE2 1
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (defined(__aarch64__) || defined(_M_ARM64))
+#   define UPRV_HAVE_SIMD 1
+#   define UPRV_HAVE_NEON 1
+#else
+#   define UPRV_HAVE_SIMD 0
+#endif
+
+/**
+ * Defined to 1 when uprv_asciiSpanInSet() uses vector table lookups:
+ * SSSE3 (pshufb) is not part of the x86-64 baseline and must be enabled
+ * at compile time, while AArch64 NEON always has vqtbl1q_u8.
+ * Otherwise its implementation is equivalent to a simple per-byte loop,
+ * and a caller need not bother calling it.
+ * @internal
+ */
+#if !UPRV_HAVE_SIMD
+#   define UPRV_HAVE_SIMD_LOOKUP 0
+#elif defined(UPRV_HAVE_NEON) || defined(__SSSE3__) || defined(__AVX2__)
+#   define UPRV_HAVE_SIMD_LOOKUP 1
+#else
+#   define UPRV_HAVE_SIMD_LOOKUP 0
+#endif
+
+/**
+ * Input runs shorter than this are not worth a usimd function call;
+ * callers should keep handling them with their own scalar loops.
+ * @internal
+ */
+#define UPRV_SIMD_MIN_LENGTH 16
+
+/**
+ * Returns the length of the initial run of ASCII bytes (00..7F) in s.
+ * @param s byte string
+ * @param length number of bytes at s, must be >=0
+ * @return the number of leading bytes that are <0x80, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_asciiSpan(const uint8_t *s, int32_t length);
+
+/**
+ * Returns the length of the initial run of bytes in s that are less than
+ * the limit byte value.
+ * @param s byte string
+ * @param length number of bytes at s, must be >=0
+ * @param limit the lowest byte value that ends the run
+ * @return the number of leading bytes that are <limit, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_spanBytesBelow(const uint8_t *s, int32_t length, uint8_t limit);
+
+/**
+ * Widens the initial run of ASCII bytes (00..7F) in src to UTF-16.
+ * Stops before the first non-ASCII byte.
+ * @param src source bytes
+ * @param dest destination, must have room for length UChars
+ * @param length number of bytes at src, must be >=0
+ * @return the number of bytes read and UChars written, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_asciiToUChars(const uint8_t *src, UChar *dest, int32_t length);
+
+/**
+ * Narrows the initial run of ASCII UChars (U+0000..U+007F) in src to bytes.
+ * Stops before the first UChar that is not ASCII.
+ * @param src source UChars
+ * @param dest destination, must have room for length bytes
+ * @param length number of UChars at src, must be >=0
+ * @return the number of UChars read and bytes written, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_asciiFromUChars(const UChar *src, uint8_t *dest, int32_t length);
+
+/**
+ * Copies the initial run of ASCII bytes (00..7F) from src to dest,
+ * lowercasing the letters A..Z.
+ * Stops before the first non-ASCII byte.
+ * src and dest may be the same, for lowercasing in place, but must not otherwise overlap.
+ * @param src source bytes
+ * @param dest destination, must have room for length bytes
+ * @param length number of bytes at src, must be >=0
+ * @return the number of bytes read and written, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_asciiToLower(const uint8_t *src, uint8_t *dest, int32_t length);
+
+/**
+ * Copies the initial run of ASCII UChars (U+0000..U+007F) from src to dest,
+ * lowercasing the letters A..Z.
+ * Stops before the first UChar that is not ASCII.
+ * @param src source UChars
+ * @param dest destination, must have room for length UChars
+ * @param length number of UChars at src, must be >=0
+ * @return the number of UChars read and written, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_asciiToLowerUChars(const UChar *src, UChar *dest, int32_t length);
+
+/**
+ * Returns the length of the initial run of ASCII bytes in s
+ * other than the uppercase letters A..Z,
+ * that is, of bytes that lowercasing and case folding do not change.
+ * @param s byte string
+ * @param length number of bytes at s, must be >=0
+ * @return the number of leading bytes in 00..7F except 41..5A, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_asciiSpanNotUpper(const uint8_t *s, int32_t length);
+
+/**
+ * Returns the length of the initial run of ASCII UChars in s
+ * other than the uppercase letters A..Z.
+ * @param s UChars
+ * @param length number of UChars at s, must be >=0
+ * @return the number of leading UChars in U+0000..U+007F except U+0041..U+005A, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_asciiSpanNotUpperUChars(const UChar *s, int32_t length);
+
+/**
+ * Returns the length of the initial run of Latin-1 UChars in s
+ * other than the C0 and C1 controls,
+ * that is, of UChars in U+0020..U+007F and U+00A0..U+00FF.
+ * @param s UChars
+ * @param length number of UChars at s, must be >=0
+ * @return the number of leading UChars in that range, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_latin1SpanNotControlUChars(const UChar *s, int32_t length);
+
+/**
+ * Returns the length of the initial run where s1 and s2 both have ASCII UChars
+ * (U+0000..U+007F) which are equal when ignoring the case of the letters A..Z.
+ * @param s1 UChars
+ * @param s2 UChars
+ * @param length number of UChars at each of s1 and s2, must be >=0
+ * @return the number of leading indexes i with ASCII s1[i] and s2[i]
+ *         and lower(s1[i])==lower(s2[i]), 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_asciiCaseEqualSpanUChars(const UChar *s1, const UChar *s2, int32_t length);
+
+/**
+ * Returns the length of the initial run of ASCII bytes b in s
+ * for which the set membership equals the contained flag.
+ * The set of ASCII characters is passed in as a 16-byte table
+ * where bit (b>>4) in asciiBits[b&0xf] is set if b is in the set.
+ * @param s byte string
+ * @param length number of bytes at s, must be >=0
+ * @param asciiBits the ASCII set, see above
+ * @param contained TRUE to span bytes in the set, FALSE to span bytes not in it
+ * @return the number of leading ASCII bytes with contains(b)==contained, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_asciiSpanInSet(const uint8_t *s, int32_t length, const uint8_t asciiBits[16], UBool contained);
+
+/**
+ * Returns the index of the first UChar in s that is equal to one of
+ * 1 to 4 given code units, like a multi-character memchr().
+ * @param s UChars
+ * @param length number of UChars at s, must be >=0
+ * @param units the code units to look for
+ * @param count number of units, 1..4
+ * @return the index of the first one of the units in s, or length if there is none
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_findUChars(const UChar *s, int32_t length, const UChar *units, int32_t count);
+
+/**
+ * Returns the first index i in s where s[i]==first and s[i+distance]==last,
+ * for example at which a string with that first and last code unit might start.
+ * @param s UChars
+ * @param length number of UChars at s, must be >=0
+ * @param first the code unit to look for at i
+ * @param last the code unit to look for at i+distance
+ * @param distance the distance between the two, must be >=1
+ * @return the first such index i with i+distance<length, or length if there is none
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_findUCharPair(const UChar *s, int32_t length, UChar first, UChar last, int32_t distance);
+
+/**
+ * Returns the length of the initial run where s1 and s2 have equal bytes,
+ * like the position of the first difference found by memcmp().
+ * For UChar strings, pass the byte lengths and divide the result by 2
+ * to get the number of equal leading UChars.
+ * @param s1 bytes
+ * @param s2 bytes
+ * @param length number of bytes at each of s1 and s2, must be >=0
+ * @return the number of leading indexes i with s1[i]==s2[i], 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_equalPrefixBytes(const uint8_t *s1, const uint8_t *s2, int32_t length);
+
+/**
+ * Returns a pointer to the first UChar in the NUL-terminated string s
+ * that is equal to c, or to the terminating NUL if there is none.
+ * With c==0, returns a pointer to the terminating NUL, like s+u_strlen(s).
+ * The vector code reads whole aligned blocks, which may extend past the
+ * terminating NUL but never into another memory page.
+ * @param s NUL-terminated UChars
+ * @param c the code unit to look for
+ * @return a pointer to the first c or NUL in s
+ * @internal
+ */
+U_CAPI const UChar * U_EXPORT2
+uprv_strFindUChar(const UChar *s, UChar c);
+
+/**
+ * Returns the number of surrogate pairs in s, that is, of indexes i with
+ * a lead surrogate at s[i] and a trail surrogate at s[i+1].
+ * length minus this number is the number of code points in s,
+ * with each unpaired surrogate counting as one.
+ * @param s UChars
+ * @param length number of UChars at s, must be >=0
+ * @return the number of surrogate pairs, 0..length/2
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_countSurrogatePairs(const UChar *s, int32_t length);
+
+/**
+ * Reads the initial run of UTF-16 code units in src that are not surrogates,
+ * and writes them to dest.
+ * The source is a byte sequence in UTF-16BE or UTF-16LE, unaligned,
+ * as in the UTF-16 converters' input.
+ * Stops before the first lead or trail surrogate.
+ * @param src source bytes, two per code unit
+ * @param dest destination, must have room for length UChars
+ * @param length number of code units (not bytes) at src, must be >=0
+ * @param bigEndian TRUE if src is in UTF-16BE, FALSE for UTF-16LE
+ * @return the number of code units read and UChars written, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_bytesToUCharsNoSurrogates(const uint8_t *src, UChar *dest, int32_t length, UBool bigEndian);
+
+/**
+ * Writes the initial run of UChars in src that are not surrogates
+ * as UTF-16BE or UTF-16LE bytes to dest.
+ * Stops before the first lead or trail surrogate.
+ * @param src source UChars
+ * @param dest destination, must have room for 2*length bytes
+ * @param length number of UChars at src, must be >=0
+ * @param bigEndian TRUE to write UTF-16BE, FALSE for UTF-16LE
+ * @return the number of UChars read and code units written, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_uCharsToBytesNoSurrogates(const UChar *src, uint8_t *dest, int32_t length, UBool bigEndian);
+
+/**
+ * Reads the initial run of UTF-32BE or UTF-32LE code units in src
+ * that are BMP code points other than surrogates, and writes them to dest.
+ * Stops before the first supplementary code point, surrogate,
+ * or value above U+10FFFF.
+ * @param src source bytes, four per code unit
+ * @param dest destination, must have room for length UChars
+ * @param length number of code units (not bytes) at src, must be >=0
+ * @param bigEndian TRUE if src is in UTF-32BE, FALSE for UTF-32LE
+ * @return the number of code units read and UChars written, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_utf32BytesToUCharsBMP(const uint8_t *src, UChar *dest, int32_t length, UBool bigEndian);
+
+/**
+ * Writes the initial run of UChars in src that are not surrogates
+ * as UTF-32BE or UTF-32LE bytes to dest.
+ * Stops before the first lead or trail surrogate.
+ * @param src source UChars
+ * @param dest destination, must have room for 4*length bytes
+ * @param length number of UChars at src, must be >=0
+ * @param bigEndian TRUE to write UTF-32BE, FALSE for UTF-32LE
+ * @return the number of UChars read and code units written, 0..length
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_uCharsToUTF32BytesBMP(const UChar *src, uint8_t *dest, int32_t length, UBool bigEndian);
+
+#endif  // __USIMD_H__
@@ -73,6 +73,15 @@ static const char * const PROFILE_NAMES[] = {
     "rfc4518ci",    /* USPREP_RFC4518_LDAP_CI */
 };
 
+/*
+Profiles of the built-in types, loaded once and held until cleanup.
+Opening them needs neither usprepMutex nor a hash table lookup.
+*/
+static UStringPrepProfile *gTypeProfiles[UPRV_LENGTHOF(PROFILE_NAMES)] = { NULL };
+static icu::UInitOnce gTypeProfilesInitOnce[UPRV_LENGTHOF(PROFILE_NAMES)] = {};
+
+static void initASCIIMap(UStringPrepProfile *profile);
+
 static UBool U_CALLCONV
 isSPrepAcceptable(void * /* context */,
              const char * /* type */, 
@@ -194,6 +203,10 @@ usprep_flushCache(){
 */
 
 static UBool U_CALLCONV usprep_cleanup(void){
+    for (int32_t i = 0; i < UPRV_LENGTHOF(PROFILE_NAMES); ++i) {
+        gTypeProfiles[i] = NULL;
+        gTypeProfilesInitOnce[i].reset();
+    }
     if (SHARED_DATA_HASHTABLE != NULL) {
         usprep_internal_flushCache(TRUE);
         if (SHARED_DATA_HASHTABLE != NULL && uhash_count(SHARED_DATA_HASHTABLE) == 0) {
@@ -348,6 +361,7 @@ usprep_getProfile(const char* path,
         /* get the options */
         newProfile->doNFKC = (UBool)((newProfile->indexes[_SPREP_OPTIONS] & _SPREP_NORMALIZATION_ON) > 0);
         newProfile->checkBiDi = (UBool)((newProfile->indexes[_SPREP_OPTIONS] & _SPREP_CHECK_BIDI_ON) > 0);
+        initASCIIMap(newProfile.getAlias());
 
         LocalMemory<UStringPrepKey> key;
         LocalMemory<char> keyName;
@@ -389,6 +403,25 @@ usprep_getProfile(const char* path,
     return profile;
 }
 
+static void U_CALLCONV
+initTypeProfile(int32_t index, UErrorCode &status) {
+    const char *name = PROFILE_NAMES[index];
+    /* types with the same data share one profile */
+    for (int32_t i = 0; i < index; ++i) {
+        if (uprv_strcmp(PROFILE_NAMES[i], name) == 0) {
+            umtx_initOnce(gTypeProfilesInitOnce[i], &initTypeProfile, i, status);
+            gTypeProfiles[index] = gTypeProfiles[i];
+            return;
+        }
+    }
+    UStringPrepProfile *profile = usprep_getProfile(NULL, name, &status);
+    if (U_SUCCESS(status)) {
+        /* the reference from usprep_getProfile() is released by usprep_cleanup() */
+        profile->isShared = TRUE;
+        gTypeProfiles[index] = profile;
+    }
+}
+
 U_CAPI UStringPrepProfile* U_EXPORT2
 usprep_open(const char* path, 
             const char* name,
@@ -397,6 +430,15 @@ usprep_open(const char* path,
     if(status == NULL || U_FAILURE(*status)){
         return NULL;
     }
+
+    /* profiles from the ICU data are shared with usprep_openByType() */
+    if(path == NULL && name != NULL){
+        for (int32_t i = 0; i < UPRV_LENGTHOF(PROFILE_NAMES); ++i) {
+            if (uprv_strcmp(PROFILE_NAMES[i], name) == 0) {
+                return usprep_openByType((UStringPrepProfileType)i, status);
+            }
+        }
+    }
        
     /* initialize the profile struct members */
     return usprep_getProfile(path,name,status);
@@ -413,12 +455,16 @@ usprep_openByType(UStringPrepProfileType type,
         *status = U_ILLEGAL_ARGUMENT_ERROR;
         return NULL;
     }
-    return usprep_open(NULL, PROFILE_NAMES[index], status);
+    umtx_initOnce(gTypeProfilesInitOnce[index], &initTypeProfile, index, *status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    return gTypeProfiles[index];
 }
 
 U_CAPI void U_EXPORT2
 usprep_close(UStringPrepProfile* profile){
-    if(profile==NULL){
+    if(profile==NULL || profile->isShared){
         return;
     }
 
@@ -503,6 +549,74 @@ getValues(uint16_t trieWord, int16_t& value, UBool& isIndex){
     return type;
 }
 
+static inline UBool
+isProhibited(const UStringPrepProfile* profile, UChar32 ch) {
+    uint16_t result;
+    UTRIE_GET16(&profile->sprepTrie,ch,result);
+    int16_t value;
+    UBool isIndex;
+    UStringPrepType type = getValues(result, value, isIndex);
+    return type == USPREP_PROHIBITED ||
+        ((result < _SPREP_TYPE_THRESHOLD) && (result & 0x01) /* first bit says it the code point is prohibited*/);
+}
+
+/*
+ * Most strings that are prepared are ASCII. An ASCII character that is mapped
+ * to an ASCII character, which is not prohibited, is not changed by NFKC,
+ * and has no RandALCat bidi class, so that usprep_prepare() only needs to map it.
+ */
+static void
+initASCIIMap(UStringPrepProfile *profile) {
+    for (UChar32 c = 0; c < 0x80; ++c) {
+        profile->asciiMap[c] = _SPREP_NOT_ASCII;
+
+        uint16_t result;
+        UTRIE_GET16(&profile->sprepTrie,c,result);
+        int16_t value;
+        UBool isIndex;
+        UStringPrepType type = getValues(result, value, isIndex);
+        UChar32 mapped = c;
+        if (type == USPREP_MAP && !isIndex) {
+            mapped = c - value;
+        } else if (type != USPREP_TYPE_LIMIT) {
+            // unassigned, prohibited, deleted, or mapped to a string
+            continue;
+        }
+        if (0 <= mapped && mapped < 0x80 && !isProhibited(profile, mapped)) {
+            profile->asciiMap[c] = (uint8_t)mapped;
+        }
+    }
+}
+
+/*
+ * Writes the results of src to dest, or only counts them if they do not fit,
+ * if src is ASCII and all of its characters are mapped by asciiMap.
+ * Returns the result length, or -1 if src needs the full processing.
+ */
+template<typename CharType>
+static int32_t
+prepareASCII(const UStringPrepProfile* profile,
+             const CharType* src, int32_t srcLength,
+             CharType* dest, int32_t destCapacity) {
+    if (srcLength > destCapacity) {
+        dest = NULL;
+    }
+    for (int32_t i = 0; i < srcLength; ++i) {
+        CharType c = src[i];
+        if ((uint32_t)c >= 0x80) {
+            return -1;
+        }
+        uint8_t mapped = profile->asciiMap[(uint8_t)c];
+        if (mapped == _SPREP_NOT_ASCII) {
+            return -1;
+        }
+        if (dest != NULL) {
+            dest[i] = (CharType)mapped;
+        }
+    }
+    return srcLength;
+}
+
 // TODO: change to writing to UnicodeString not UChar *
 static int32_t 
 usprep_map(  const UStringPrepProfile* profile, 
@@ -636,37 +750,19 @@ usprep_map(  const UStringPrepProfile* profile,
           character MUST be the first character of the string, and a
           RandALCat character MUST be the last character of the string.
 */
-U_CAPI int32_t U_EXPORT2
-usprep_prepare(   const UStringPrepProfile* profile,
-                  const UChar* src, int32_t srcLength, 
-                  UChar* dest, int32_t destCapacity,
-                  int32_t options,
-                  UParseError* parseError,
-                  UErrorCode* status ){
-
-    // check error status
-    if(U_FAILURE(*status)){
-        return 0;
-    }
-
-    //check arguments
-    if(profile==NULL ||
-            (src==NULL ? srcLength!=0 : srcLength<-1) ||
-            (dest==NULL ? destCapacity!=0 : destCapacity<0)) {
-        *status=U_ILLEGAL_ARGUMENT_ERROR;
-        return 0;
-    }
-
-    //get the string length
-    if(srcLength < 0){
-        srcLength = u_strlen(src);
-    }
+static void
+usprep_prepareToString(const UStringPrepProfile* profile,
+                       const UChar* src, int32_t srcLength,
+                       UnicodeString &s2,
+                       int32_t options,
+                       UParseError* parseError,
+                       UErrorCode* status ){
     // map
     UnicodeString s1;
     UChar *b1 = s1.getBuffer(srcLength);
     if(b1==NULL){
         *status = U_MEMORY_ALLOCATION_ERROR;
-        return 0;
+        return;
     }
     int32_t b1Len = usprep_map(profile, src, srcLength,
                                b1, s1.getCapacity(), options, parseError, status);
@@ -678,7 +774,7 @@ usprep_prepare(   const UStringPrepProfile* profile,
         b1 = s1.getBuffer(b1Len);
         if(b1==NULL){
             *status = U_MEMORY_ALLOCATION_ERROR;
-            return 0;
+            return;
         }
 
         *status = U_ZERO_ERROR; // reset error
@@ -687,23 +783,22 @@ usprep_prepare(   const UStringPrepProfile* profile,
         s1.releaseBuffer(U_SUCCESS(*status) ? b1Len : 0);
     }
     if(U_FAILURE(*status)){
-        return 0;
+        return;
     }
 
     // normalize
-    UnicodeString s2;
     if(profile->doNFKC){
         const Normalizer2 *n2 = Normalizer2::getNFKCInstance(*status);
         FilteredNormalizer2 fn2(*n2, *uniset_getUnicode32Instance(*status));
         if(U_FAILURE(*status)){
-            return 0;
+            return;
         }
         fn2.normalize(s1, s2, *status);
     }else{
         s2.fastCopyFrom(s1);
     }
     if(U_FAILURE(*status)){
-        return 0;
+        return;
     }
 
     // Prohibit and checkBiDi in one pass
@@ -729,7 +824,7 @@ usprep_prepare(   const UStringPrepProfile* profile,
            ){
             *status = U_STRINGPREP_PROHIBITED_ERROR;
             uprv_syntaxError(b2, b2Index-U16_LENGTH(ch), b2Len, parseError);
-            return 0;
+            return;
         }
 
         if(profile->checkBiDi) {
@@ -752,7 +847,7 @@ usprep_prepare(   const UStringPrepProfile* profile,
         if( leftToRight == TRUE && rightToLeft == TRUE){
             *status = U_STRINGPREP_CHECK_BIDI_ERROR;
             uprv_syntaxError(b2,(rtlPos>ltrPos) ? rtlPos : ltrPos, b2Len, parseError);
-            return 0;
+            return;
         }
 
         //satisfy 3
@@ -762,12 +857,102 @@ usprep_prepare(   const UStringPrepProfile* profile,
            ){
             *status = U_STRINGPREP_CHECK_BIDI_ERROR;
             uprv_syntaxError(b2, rtlPos, b2Len, parseError);
-            return FALSE;
+            return;
         }
     }
+}
+
+U_CAPI int32_t U_EXPORT2
+usprep_prepare(   const UStringPrepProfile* profile,
+                  const UChar* src, int32_t srcLength, 
+                  UChar* dest, int32_t destCapacity,
+                  int32_t options,
+                  UParseError* parseError,
+                  UErrorCode* status ){
+
+    // check error status
+    if(U_FAILURE(*status)){
+        return 0;
+    }
+
+    //check arguments
+    if(profile==NULL ||
+            (src==NULL ? srcLength!=0 : srcLength<-1) ||
+            (dest==NULL ? destCapacity!=0 : destCapacity<0)) {
+        *status=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    //get the string length
+    if(srcLength < 0){
+        srcLength = u_strlen(src);
+    }
+    int32_t length = prepareASCII(profile, src, srcLength, dest, destCapacity);
+    if(length >= 0){
+        return u_terminateUChars(dest, destCapacity, length, status);
+    }
+
+    UnicodeString s2;
+    usprep_prepareToString(profile, src, srcLength, s2, options, parseError, status);
+    if(U_FAILURE(*status)){
+        return 0;
+    }
     return s2.extract(dest, destCapacity, *status);
 }
 
+U_CAPI int32_t U_EXPORT2
+usprep_prepareUTF8(const UStringPrepProfile* profile,
+                   const char* src, int32_t srcLength,
+                   char* dest, int32_t destCapacity,
+                   int32_t options,
+                   UParseError* parseError,
+                   UErrorCode* status ){
+
+    // check error status
+    if(U_FAILURE(*status)){
+        return 0;
+    }
+
+    //check arguments
+    if(profile==NULL ||
+            (src==NULL ? srcLength!=0 : srcLength<-1) ||
+            (dest==NULL ? destCapacity!=0 : destCapacity<0)) {
+        *status=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    //get the string length
+    if(srcLength < 0){
+        srcLength = static_cast<int32_t>(uprv_strlen(src));
+    }
+    int32_t length = prepareASCII(profile, src, srcLength, dest, destCapacity);
+    if(length >= 0){
+        return u_terminateChars(dest, destCapacity, length, status);
+    }
+
+    // The UTF-16 string has at most as many units as the UTF-8 string has bytes.
+    UnicodeString s16;
+    UChar *b16 = s16.getBuffer(srcLength);
+    if(b16==NULL){
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    int32_t b16Len = 0;
+    u_strFromUTF8(b16, s16.getCapacity(), &b16Len, src, srcLength, status);
+    s16.releaseBuffer(U_SUCCESS(*status) ? b16Len : 0);
+    if(U_FAILURE(*status)){
+        return 0;
+    }
+
+    UnicodeString s2;
+    usprep_prepareToString(profile, s16.getBuffer(), s16.length(), s2, options, parseError, status);
+    if(U_FAILURE(*status)){
+        return 0;
+    }
+    u_strToUTF8(dest, destCapacity, &length, s2.getBuffer(), s2.length(), status);
+    return length;
+}
+
 
 /* data swapping ------------------------------------------------------------ */
 
@@ -46,6 +46,18 @@ ustr_hashCharsN(const char *str, int32_t length);
 U_CAPI int32_t U_EXPORT2
 ustr_hashICharsN(const char *str, int32_t length);
 
+/**
+ * Hash functions for in-memory hash tables: faster and better distributed
+ * than ustr_hashUCharsN() and ustr_hashCharsN(), which they do not match.
+ * They read every code unit. Their values may change between ICU versions,
+ * so they must not be stored or used for the public hashCode() functions.
+ */
+U_CAPI int32_t U_EXPORT2
+ustr_fastHashUCharsN(const UChar *str, int32_t length);
+
+U_CAPI int32_t U_EXPORT2
+ustr_fastHashCharsN(const char *str, int32_t length);
+
 /**
  * NUL-terminate a UChar * string if possible.
  * If length  < destCapacity then NUL-terminate.
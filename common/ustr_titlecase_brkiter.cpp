@@ -26,6 +26,7 @@
 #include "unicode/chariter.h"
 #include "unicode/localpointer.h"
 #include "unicode/ubrk.h"
+#include "unicode/uchar.h"
 #include "unicode/ucasemap.h"
 #include "unicode/utext.h"
 #include "cmemory.h"
@@ -136,6 +137,133 @@ BreakIterator &WholeStringBreakIterator::refreshInputText(
     return *this;
 }
 
+/**
+ * BreakIterator that returns the start of each word after white space,
+ * for U_TITLECASE_WHITE_SPACE_WORDS.
+ * Titlecasing only calls setText(), first(), and next().
+ * We implement the rest only to satisfy the abstract interface.
+ */
+class WhiteSpaceBreakIterator : public BreakIterator {
+public:
+    WhiteSpaceBreakIterator() : BreakIterator(), text(UTEXT_INITIALIZER) {}
+    ~WhiteSpaceBreakIterator() U_OVERRIDE;
+    UBool operator==(const BreakIterator&) const U_OVERRIDE;
+    BreakIterator *clone() const U_OVERRIDE;
+    static UClassID U_EXPORT2 getStaticClassID();
+    UClassID getDynamicClassID() const U_OVERRIDE;
+    CharacterIterator &getText() const U_OVERRIDE;
+    UText *getUText(UText *fillIn, UErrorCode &errorCode) const U_OVERRIDE;
+    void  setText(const UnicodeString &text) U_OVERRIDE;
+    void  setText(UText *text, UErrorCode &errorCode) U_OVERRIDE;
+    void  adoptText(CharacterIterator* it) U_OVERRIDE;
+    int32_t first() U_OVERRIDE;
+    int32_t last() U_OVERRIDE;
+    int32_t previous() U_OVERRIDE;
+    int32_t next() U_OVERRIDE;
+    int32_t current() const U_OVERRIDE;
+    int32_t following(int32_t offset) U_OVERRIDE;
+    int32_t preceding(int32_t offset) U_OVERRIDE;
+    UBool isBoundary(int32_t offset) U_OVERRIDE;
+    int32_t next(int32_t n) U_OVERRIDE;
+    BreakIterator *createBufferClone(void *stackBuffer, int32_t &BufferSize,
+                                     UErrorCode &errorCode) U_OVERRIDE;
+    BreakIterator &refreshInputText(UText *input, UErrorCode &errorCode) U_OVERRIDE;
+
+private:
+    // Shallow clone of the text; its native index is the current boundary.
+    UText text;
+};
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(WhiteSpaceBreakIterator)
+
+WhiteSpaceBreakIterator::~WhiteSpaceBreakIterator() {
+    utext_close(&text);
+}
+UBool WhiteSpaceBreakIterator::operator==(const BreakIterator&) const { return FALSE; }
+BreakIterator *WhiteSpaceBreakIterator::clone() const { return nullptr; }
+
+CharacterIterator &WhiteSpaceBreakIterator::getText() const {
+    U_ASSERT(FALSE);  // really should not be called
+    // Returns a null reference, as in WholeStringBreakIterator.
+    CharacterIterator *none = nullptr;
+    return *none;
+}
+UText *WhiteSpaceBreakIterator::getUText(UText *fillIn, UErrorCode &errorCode) const {
+    return utext_clone(fillIn, &text, FALSE, TRUE, &errorCode);
+}
+
+void  WhiteSpaceBreakIterator::setText(const UnicodeString &s) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    utext_openConstUnicodeString(&text, &s, &errorCode);
+}
+void  WhiteSpaceBreakIterator::setText(UText *t, UErrorCode &errorCode) {
+    utext_clone(&text, t, FALSE, TRUE, &errorCode);
+}
+void  WhiteSpaceBreakIterator::adoptText(CharacterIterator* it) {
+    U_ASSERT(FALSE);  // should not be called
+    delete it;
+}
+
+int32_t WhiteSpaceBreakIterator::first() {
+    UTEXT_SETNATIVEINDEX(&text, 0);
+    return 0;
+}
+int32_t WhiteSpaceBreakIterator::last() {
+    int32_t length = (int32_t)utext_nativeLength(&text);
+    UTEXT_SETNATIVEINDEX(&text, length);
+    return length;
+}
+int32_t WhiteSpaceBreakIterator::previous() { return 0; }
+int32_t WhiteSpaceBreakIterator::next() {
+    UChar32 c = UTEXT_NEXT32(&text);
+    if (c < 0) {
+        return UBRK_DONE;
+    }
+    // Skip the rest of the word and the white space after it.
+    UBool isSpace = u_isUWhiteSpace(c);
+    while ((c = UTEXT_NEXT32(&text)) >= 0) {
+        if (u_isUWhiteSpace(c)) {
+            isSpace = TRUE;
+        } else if (isSpace) {
+            UTEXT_PREVIOUS32(&text);
+            break;
+        }
+    }
+    return (int32_t)UTEXT_GETNATIVEINDEX(&text);
+}
+int32_t WhiteSpaceBreakIterator::current() const {
+    return (int32_t)utext_getNativeIndex(&text);
+}
+int32_t WhiteSpaceBreakIterator::following(int32_t offset) {
+    UTEXT_SETNATIVEINDEX(&text, offset);
+    return next();
+}
+int32_t WhiteSpaceBreakIterator::preceding(int32_t /*offset*/) { return 0; }
+UBool WhiteSpaceBreakIterator::isBoundary(int32_t /*offset*/) { return FALSE; }
+int32_t WhiteSpaceBreakIterator::next(int32_t n) {
+    int32_t result = current();
+    while (n > 0 && result != UBRK_DONE) {
+        result = next();
+        --n;
+    }
+    return result;
+}
+
+BreakIterator *WhiteSpaceBreakIterator::createBufferClone(
+        void * /*stackBuffer*/, int32_t & /*BufferSize*/, UErrorCode &errorCode) {
+    if (U_SUCCESS(errorCode)) {
+        errorCode = U_UNSUPPORTED_ERROR;
+    }
+    return nullptr;
+}
+BreakIterator &WhiteSpaceBreakIterator::refreshInputText(
+        UText *input, UErrorCode &errorCode) {
+    int64_t index = utext_getNativeIndex(&text);
+    utext_clone(&text, input, FALSE, TRUE, &errorCode);
+    UTEXT_SETNATIVEINDEX(&text, index);
+    return *this;
+}
+
 U_CFUNC
 BreakIterator *ustrcase_getTitleBreakIterator(
         const Locale *locale, const char *locID, uint32_t options, BreakIterator *iter,
@@ -149,8 +277,9 @@ BreakIterator *ustrcase_getTitleBreakIterator(
     if (iter == nullptr) {
         switch (options) {
         case 0:
-            iter = BreakIterator::createWordInstance(
-                locale != nullptr ? *locale : Locale(locID), errorCode);
+            // Reuse the word iterator of an earlier call, if possible.
+            iter = BreakIterator::acquireInstance(
+                locale != nullptr ? *locale : Locale(locID), UBRK_WORD, errorCode);
             break;
         case U_TITLECASE_WHOLE_STRING:
             iter = new WholeStringBreakIterator();
@@ -162,6 +291,12 @@ BreakIterator *ustrcase_getTitleBreakIterator(
             iter = BreakIterator::createSentenceInstance(
                 locale != nullptr ? *locale : Locale(locID), errorCode);
             break;
+        case U_TITLECASE_WHITE_SPACE_WORDS:
+            iter = new WhiteSpaceBreakIterator();
+            if (iter == nullptr) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+            }
+            break;
         default:
             errorCode = U_ILLEGAL_ARGUMENT_ERROR;
             break;
@@ -171,6 +306,16 @@ BreakIterator *ustrcase_getTitleBreakIterator(
     return iter;
 }
 
+U_CFUNC
+void ustrcase_releaseTitleBreakIterator(
+        const Locale *locale, const char *locID, uint32_t options,
+        LocalPointer<BreakIterator> &ownedIter) {
+    if (ownedIter.isValid() && (options & U_TITLECASE_ITERATOR_MASK) == 0) {
+        BreakIterator::releaseInstance(
+            ownedIter.orphan(), locale != nullptr ? *locale : Locale(locID), UBRK_WORD);
+    }
+}
+
 int32_t CaseMap::toTitle(
         const char *locale, uint32_t options, BreakIterator *iter,
         const UChar *src, int32_t srcLength,
@@ -183,11 +328,13 @@ int32_t CaseMap::toTitle(
     }
     UnicodeString s(srcLength<0, src, srcLength);
     iter->setText(s);
-    return ustrcase_map(
+    int32_t length = ustrcase_map(
         ustrcase_getCaseLocale(locale), options, iter,
         dest, destCapacity,
         src, srcLength,
         ustrcase_internalToTitle, edits, errorCode);
+    ustrcase_releaseTitleBreakIterator(nullptr, locale, options, ownedIter);
+    return length;
 }
 
 U_NAMESPACE_END
@@ -209,11 +356,13 @@ u_strToTitle(UChar *dest, int32_t destCapacity,
     }
     UnicodeString s(srcLength<0, src, srcLength);
     iter->setText(s);
-    return ustrcase_mapWithOverlap(
+    int32_t length = ustrcase_mapWithOverlap(
         ustrcase_getCaseLocale(locale), 0, iter,
         dest, destCapacity,
         src, srcLength,
         ustrcase_internalToTitle, *pErrorCode);
+    ustrcase_releaseTitleBreakIterator(nullptr, locale, 0, ownedIter);
+    return length;
 }
 
 U_CAPI int32_t U_EXPORT2
@@ -35,6 +35,7 @@
 #include "ucasemap_imp.h"
 #include "ustr_imp.h"
 #include "uassert.h"
+#include "usimd.h"
 
 U_NAMESPACE_BEGIN
 
@@ -212,7 +213,11 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
     } else {
         latinToLower = LatinCase::TO_LOWER_TR_LT;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    // Without Edits, ASCII runs are lowercased in bulk directly into dest.
+    // Otherwise, and for tr/lt (special I), only runs of unchanged ASCII are skipped in bulk.
+    UBool asciiToLower = latinToLower == LatinCase::TO_LOWER_NORMAL && edits == nullptr &&
+        (options & U_OMIT_UNCHANGED_TEXT) == 0;
+    const UCPTrie *trie = ucase_getTrie();
     int32_t destIndex = 0;
     int32_t prev = srcStart;
     int32_t srcIndex = srcStart;
@@ -222,6 +227,35 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
         while (srcIndex < srcLimit) {
             lead = src[srcIndex];
             int32_t delta;
+            if (lead < 0x80 && (srcLimit - srcIndex) >= UPRV_SIMD_MIN_LENGTH &&
+                    src[srcIndex + UPRV_SIMD_MIN_LENGTH - 1] < 0x80) {
+                // probably a long ASCII run
+                int32_t length;
+                if (asciiToLower) {
+                    destIndex = appendUnchanged(dest, destIndex, destCapacity,
+                                                src + prev, srcIndex - prev, options, edits);
+                    if (destIndex < 0) {
+                        errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+                        return 0;
+                    }
+                    prev = srcIndex;
+                    length = destCapacity - destIndex;
+                    if (length > (srcLimit - srcIndex)) {
+                        length = srcLimit - srcIndex;
+                    }
+                    if (length > 0) {
+                        length = uprv_asciiToLowerUChars(src + srcIndex, dest + destIndex, length);
+                        destIndex += length;
+                        prev += length;
+                    }
+                } else {
+                    length = uprv_asciiSpanNotUpperUChars(src + srcIndex, srcLimit - srcIndex);
+                }
+                if (length > 0) {
+                    srcIndex += length;
+                    continue;
+                }
+            }
             if (lead < LatinCase::LONG_S) {
                 int8_t d = latinToLower[lead];
                 if (d == LatinCase::EXC) { break; }
@@ -231,7 +265,7 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
             } else if (lead >= 0xd800) {
                 break;  // surrogate or higher
             } else {
-                uint16_t props = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(trie, lead);
+                uint16_t props = UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, lead);
                 if (UCASE_HAS_EXCEPTION(props)) { break; }
                 ++srcIndex;
                 if (!UCASE_IS_UPPER_OR_TITLE(props) || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -307,7 +341,7 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
     } else {
         latinToUpper = LatinCase::TO_UPPER_NORMAL;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    const UCPTrie *trie = ucase_getTrie();
     int32_t destIndex = 0;
     int32_t prev = 0;
     int32_t srcIndex = 0;
@@ -326,7 +360,7 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
             } else if (lead >= 0xd800) {
                 break;  // surrogate or higher
             } else {
-                uint16_t props = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(trie, lead);
+                uint16_t props = UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, lead);
                 if (UCASE_HAS_EXCEPTION(props)) { break; }
                 ++srcIndex;
                 if (UCASE_GET_TYPE(props) != UCASE_LOWER || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -1362,6 +1396,94 @@ U_NAMESPACE_END
 
 /* case-insensitive string comparisons -------------------------------------- */
 
+namespace {
+
+/**
+ * Returns the simple case folding of c if it is a single code unit
+ * and the same as the full case folding, according to the Latin table
+ * or to the case properties without exceptions.
+ * Returns -1 for NUL, surrogates and code units with exceptions.
+ */
+inline int32_t getSimpleFold(UChar c, const int8_t *latinFold, const UCPTrie *trie) {
+    if (c < LatinCase::LIMIT) {
+        int8_t d = latinFold[c];
+        return (c == 0 || d == LatinCase::EXC) ? -1 : c + d;
+    } else if (U16_IS_SURROGATE(c)) {
+        return -1;
+    }
+    uint16_t props = UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, c);
+    if (UCASE_HAS_EXCEPTION(props)) {
+        return -1;
+    }
+    return UCASE_IS_UPPER_OR_TITLE(props) ? c + UCASE_GET_DELTA(props) : c;
+}
+
+/**
+ * Fast path for _cmpFold():
+ * Compares the strings code unit by code unit while both have only code units
+ * with simple 1:1 case foldings (see getSimpleFold()),
+ * with ASCII runs compared several units at a time.
+ * In such a prefix the result is the difference of the first unequal case foldings,
+ * just like the full comparison returns it.
+ * NUL, surrogates and complex case foldings stop the fast path;
+ * the full comparison continues from there.
+ *
+ * @param index receives the length of the compared prefix
+ * @param result receives the comparison result if the strings differ in the prefix
+ * @return TRUE if the strings differ in the prefix
+ */
+UBool cmpSimpleFold(const UChar *s1, int32_t length1, const UChar *s2, int32_t length2,
+                    uint32_t options, int32_t &index, int32_t &result) {
+    const int8_t *latinFold;
+    if ((options & _FOLD_CASE_OPTIONS_MASK) == U_FOLD_CASE_DEFAULT) {
+        latinFold = LatinCase::TO_LOWER_NORMAL;
+    } else {
+        latinFold = LatinCase::TO_LOWER_TR_LT;
+    }
+    int32_t limit;
+    if (length1 >= 0 && (length2 < 0 || length1 <= length2)) {
+        limit = length1;
+    } else if (length2 >= 0) {
+        limit = length2;
+    } else {
+        limit = INT32_MAX;  // NUL-terminated, see getSimpleFold()
+    }
+    int32_t i = 0;
+    if (length1 >= 0 && length2 >= 0 && (options & _STRNCMP_STYLE) == 0 &&
+            latinFold == LatinCase::TO_LOWER_NORMAL && limit >= UPRV_SIMD_MIN_LENGTH) {
+        // NUL is an ordinary character here.
+        i = uprv_asciiCaseEqualSpanUChars(s1, s2, limit);
+    }
+    const UCPTrie *trie = ucase_getTrie();
+    for (; i < limit; ++i) {
+        UChar c1 = s1[i];
+        UChar c2 = s2[i];
+        if (c1 == c2) {
+            if (c1 == 0 || U16_IS_SURROGATE(c1)) {
+                break;
+            }
+            continue;
+        }
+        int32_t f1 = getSimpleFold(c1, latinFold, trie);
+        if (f1 < 0) {
+            break;
+        }
+        int32_t f2 = getSimpleFold(c2, latinFold, trie);
+        if (f2 < 0) {
+            break;
+        }
+        if (f1 != f2) {
+            index = i;
+            result = f1 - f2;
+            return TRUE;
+        }
+    }
+    index = i;
+    return FALSE;
+}
+
+}  // namespace
+
 /*
  * This function is a copy of unorm_cmpEquivFold() minus the parts for
  * canonical equivalence.
@@ -1455,6 +1577,20 @@ static int32_t _cmpFold(
         limit2=s2+length2;
     }
 
+    /* compare the prefix with simple case foldings quickly */
+    int32_t prefixLength;
+    if(cmpSimpleFold(s1, length1, s2, length2, options, prefixLength, cmpRes)) {
+        if(matchLen1) {
+            *matchLen1=prefixLength;
+            *matchLen2=prefixLength;
+        }
+        return cmpRes;
+    }
+    s1+=prefixLength;
+    s2+=prefixLength;
+    m1=s1;
+    m2=s2;
+
     level1=level2=0;
     c1=c2=-1;
 
@@ -1562,6 +1698,20 @@ static int32_t _cmpFold(
                 }
             }
             c1=c2=-1;       /* make us fetch new code units */
+            if(level1==0 && level2==0) {
+                /* back in both original strings: resume the fast path */
+                if(cmpSimpleFold(s1, limit1==NULL ? -1 : (int32_t)(limit1-s1),
+                                 s2, limit2==NULL ? -1 : (int32_t)(limit2-s2),
+                                 options, prefixLength, cmpRes)) {
+                    m1=s1+prefixLength;
+                    m2=s2+prefixLength;
+                    break;
+                }
+                s1+=prefixLength;
+                s2+=prefixLength;
+                m1=s1;
+                m2=s2;
+            }
             continue;
         } else if(c1<0) {
             cmpRes=-1;      /* string 1 ends before string 2 */
@@ -26,6 +26,11 @@
 #include "cwchar.h"
 #include "cmemory.h"
 #include "ustr_imp.h"
+#include "usimd.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>  // _umul128()
+#endif
 
 /* ANSI string.h - style functions ------------------------------------------ */
 
@@ -77,28 +82,26 @@ u_strFindFirst(const UChar *s, int32_t length,
             return u_strchr(s, cs);
         }
 
-        while((c=*s++)!=0) {
-            if(c==cs) {
-                /* found first substring UChar, compare rest */
-                p=s;
-                q=sub;
-                for(;;) {
-                    if((cq=*q)==0) {
-                        if(isMatchAtCPBoundary(start, s-1, p, NULL)) {
-                            return (UChar *)(s-1); /* well-formed match */
-                        } else {
-                            break; /* no match because surrogate pair is split */
-                        }
-                    }
-                    if((c=*p)==0) {
-                        return NULL; /* no match, and none possible after s */
-                    }
-                    if(c!=cq) {
-                        break; /* no match */
+        while(*(s=uprv_strFindUChar(s, cs))!=0) {
+            /* found first substring UChar, compare rest */
+            p=++s;
+            q=sub;
+            for(;;) {
+                if((cq=*q)==0) {
+                    if(isMatchAtCPBoundary(start, s-1, p, NULL)) {
+                        return (UChar *)(s-1); /* well-formed match */
+                    } else {
+                        break; /* no match because surrogate pair is split */
                     }
-                    ++p;
-                    ++q;
                 }
+                if((c=*p)==0) {
+                    return NULL; /* no match, and none possible after s */
+                }
+                if(c!=cq) {
+                    break; /* no match */
+                }
+                ++p;
+                ++q;
             }
         }
 
@@ -125,28 +128,26 @@ u_strFindFirst(const UChar *s, int32_t length,
 
     if(length<0) {
         /* s is NUL-terminated */
-        while((c=*s++)!=0) {
-            if(c==cs) {
-                /* found first substring UChar, compare rest */
-                p=s;
-                q=sub;
-                for(;;) {
-                    if(q==subLimit) {
-                        if(isMatchAtCPBoundary(start, s-1, p, NULL)) {
-                            return (UChar *)(s-1); /* well-formed match */
-                        } else {
-                            break; /* no match because surrogate pair is split */
-                        }
-                    }
-                    if((c=*p)==0) {
-                        return NULL; /* no match, and none possible after s */
-                    }
-                    if(c!=*q) {
-                        break; /* no match */
+        while(*(s=uprv_strFindUChar(s, cs))!=0) {
+            /* found first substring UChar, compare rest */
+            p=++s;
+            q=sub;
+            for(;;) {
+                if(q==subLimit) {
+                    if(isMatchAtCPBoundary(start, s-1, p, NULL)) {
+                        return (UChar *)(s-1); /* well-formed match */
+                    } else {
+                        break; /* no match because surrogate pair is split */
                     }
-                    ++p;
-                    ++q;
                 }
+                if((c=*p)==0) {
+                    return NULL; /* no match, and none possible after s */
+                }
+                if(c!=*q) {
+                    break; /* no match */
+                }
+                ++p;
+                ++q;
             }
         }
     } else {
@@ -163,25 +164,35 @@ u_strFindFirst(const UChar *s, int32_t length,
         preLimit=limit-subLength;
 
         while(s!=preLimit) {
-            c=*s++;
-            if(c==cs) {
-                /* found first substring UChar, compare rest */
-                p=s;
-                q=sub;
-                for(;;) {
-                    if(q==subLimit) {
-                        if(isMatchAtCPBoundary(start, s-1, p, limit)) {
-                            return (UChar *)(s-1); /* well-formed match */
-                        } else {
-                            break; /* no match because surrogate pair is split */
-                        }
-                    }
-                    if(*p!=*q) {
-                        break; /* no match */
+            /*
+             * find the next position with the first substring UChar,
+             * and with its last one at the end of the substring
+             */
+            int32_t n=(int32_t)(preLimit-s);
+            int32_t i=subLength==0 ?
+                uprv_findUChars(s, n, &cs, 1) :
+                uprv_findUCharPair(s, (int32_t)(limit-s), cs, *(subLimit-1), subLength);
+            if(i>=n) {
+                break;
+            }
+            s+=i+1;
+
+            /* compare rest */
+            p=s;
+            q=sub;
+            for(;;) {
+                if(q==subLimit) {
+                    if(isMatchAtCPBoundary(start, s-1, p, limit)) {
+                        return (UChar *)(s-1); /* well-formed match */
+                    } else {
+                        break; /* no match because surrogate pair is split */
                     }
-                    ++p;
-                    ++q;
                 }
+                if(*p!=*q) {
+                    break; /* no match */
+                }
+                ++p;
+                ++q;
             }
         }
     }
@@ -201,18 +212,9 @@ u_strchr(const UChar *s, UChar c) {
         /* make sure to not find half of a surrogate pair */
         return u_strFindFirst(s, -1, &c, 1);
     } else {
-        UChar cs;
-
         /* trivial search for a BMP code point */
-        for(;;) {
-            if((cs=*s)==c) {
-                return (UChar *)s;
-            }
-            if(cs==0) {
-                return NULL;
-            }
-            ++s;
-        }
+        s=uprv_strFindUChar(s, c);
+        return *s==c ? (UChar *)s : NULL;
     }
 }
 
@@ -223,10 +225,10 @@ u_strchr32(const UChar *s, UChar32 c) {
         return u_strchr(s, (UChar)c);
     } else if((uint32_t)c<=UCHAR_MAX_VALUE) {
         /* find supplementary code point as surrogate pair */
-        UChar cs, lead=U16_LEAD(c), trail=U16_TRAIL(c);
+        UChar lead=U16_LEAD(c), trail=U16_TRAIL(c);
 
-        while((cs=*s++)!=0) {
-            if(cs==lead && *s==trail) {
+        while(*(s=uprv_strFindUChar(s, lead))!=0) {
+            if(*++s==trail) {
                 return (UChar *)(s-1);
             }
         }
@@ -244,6 +246,9 @@ u_memchr(const UChar *s, UChar c, int32_t count) {
     } else if(U16_IS_SURROGATE(c)) {
         /* make sure to not find half of a surrogate pair */
         return u_strFindFirst(s, count, &c, 1);
+    } else if(count>=UPRV_SIMD_MIN_LENGTH) {
+        int32_t i=uprv_findUChars(s, count, &c, 1);
+        return i<count ? (UChar *)(s+i) : NULL;
     } else {
         /* trivial search for a BMP code point */
         const UChar *limit=s+count;
@@ -266,15 +271,8 @@ u_memchr32(const UChar *s, UChar32 c, int32_t count) {
         return NULL;
     } else if((uint32_t)c<=UCHAR_MAX_VALUE) {
         /* find supplementary code point as surrogate pair */
-        const UChar *limit=s+count-1; /* -1 so that we do not need a separate check for the trail unit */
-        UChar lead=U16_LEAD(c), trail=U16_TRAIL(c);
-
-        do {
-            if(*s==lead && *(s+1)==trail) {
-                return (UChar *)s;
-            }
-        } while(++s!=limit);
-        return NULL;
+        int32_t i=uprv_findUCharPair(s, count, U16_LEAD(c), U16_TRAIL(c), 1);
+        return i<count ? (UChar *)(s+i) : NULL;
     } else {
         /* not a Unicode code point, not findable */
         return NULL;
@@ -996,53 +994,21 @@ u_strlen(const UChar *s)
 #if U_SIZEOF_WCHAR_T == U_SIZEOF_UCHAR
     return (int32_t)uprv_wcslen((const wchar_t *)s);
 #else
-    const UChar *t = s;
-    while(*t != 0) {
-      ++t;
-    }
-    return t - s;
+    return (int32_t)(uprv_strFindUChar(s, 0) - s);
 #endif
 }
 
 U_CAPI int32_t U_EXPORT2
 u_countChar32(const UChar *s, int32_t length) {
-    int32_t count;
-
     if(s==NULL || length<-1) {
         return 0;
     }
 
-    count=0;
-    if(length>=0) {
-        while(length>0) {
-            ++count;
-            if(U16_IS_LEAD(*s) && length>=2 && U16_IS_TRAIL(*(s+1))) {
-                s+=2;
-                length-=2;
-            } else {
-                ++s;
-                --length;
-            }
-        }
-    } else /* length==-1 */ {
-        UChar c;
-
-        for(;;) {
-            if((c=*s++)==0) {
-                break;
-            }
-            ++count;
-
-            /*
-             * sufficient to look ahead one because of UTF-16;
-             * safe to look ahead one because at worst that would be the terminating NUL
-             */
-            if(U16_IS_LEAD(c) && U16_IS_TRAIL(*s)) {
-                ++s;
-            }
-        }
+    if(length<0) {
+        length=u_strlen(s);
     }
-    return count;
+    /* each surrogate pair is one code point, each other UChar is one */
+    return length-uprv_countSurrogatePairs(s, length);
 }
 
 U_CAPI UBool U_EXPORT2
@@ -1074,7 +1040,6 @@ u_strHasMoreChar32Than(const UChar *s, int32_t length, int32_t number) {
         }
     } else {
         /* length>=0 known */
-        const UChar *limit;
         int32_t maxSupplementary;
 
         /* s contains at least (length+1)/2 code points: <=2 UChars per cp */
@@ -1090,26 +1055,10 @@ u_strHasMoreChar32Than(const UChar *s, int32_t length, int32_t number) {
         /* there are maxSupplementary=length-number more UChars than asked-for code points */
 
         /*
-         * count code points until they exceed and also check that there are
-         * no more than maxSupplementary supplementary code points (UChar pairs)
+         * here length<=2*number+1, so counting all code points
+         * costs at most about twice as much as stopping when they exceed
          */
-        limit=s+length;
-        for(;;) {
-            if(s==limit) {
-                return FALSE;
-            }
-            if(number==0) {
-                return TRUE;
-            }
-            if(U16_IS_LEAD(*s++) && s!=limit && U16_IS_TRAIL(*s)) {
-                ++s;
-                if(--maxSupplementary<=0) {
-                    /* too many pairs - too few code points */
-                    return FALSE;
-                }
-            }
-            --number;
-        }
+        return uprv_countSurrogatePairs(s, length)<maxSupplementary;
     }
 }
 
@@ -1517,3 +1466,109 @@ U_CAPI int32_t U_EXPORT2
 ustr_hashICharsN(const char *str, int32_t length) {
     STRING_HASH(char, str, length, (uint8_t)uprv_tolower(*p));
 }
+
+/*
+  The hash for in-memory hash tables reads every code unit, 16 bytes at a time,
+  and mixes each pair of 64-bit words with a 64x64->128-bit multiplication,
+  after wyhash (Wang Yi, public domain).
+  Code units are combined into words in little-endian order on all platforms,
+  so that the hash values do not depend on the byte order.
+  Unlike the functions above, this hash may change between ICU versions.
+*/
+
+namespace {
+
+const uint64_t HASH_SECRET0 = 0xa0761d6478bd642full;
+const uint64_t HASH_SECRET1 = 0xe7037ed1a0b428dbull;
+const uint64_t HASH_SECRET2 = 0x8ebc6af09c88c6e3ull;
+const uint64_t HASH_SECRET3 = 0x589965cc75374cc3ull;
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 HashUInt128;
+#endif
+
+inline uint64_t hashMix(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    HashUInt128 r = (HashUInt128)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    uint64_t high;
+    uint64_t low = _umul128(a, b, &high);
+    return low ^ high;
+#else
+    uint64_t aHigh = a >> 32, aLow = (uint32_t)a;
+    uint64_t bHigh = b >> 32, bLow = (uint32_t)b;
+    uint64_t hh = aHigh * bHigh, hl = aHigh * bLow, lh = aLow * bHigh, ll = aLow * bLow;
+    uint64_t middle = (ll >> 32) + (uint32_t)hl + (uint32_t)lh;
+    uint64_t low = (middle << 32) | (uint32_t)ll;
+    uint64_t high = hh + (hl >> 32) + (lh >> 32) + (middle >> 32);
+    return low ^ high;
+#endif
+}
+
+/** Combines up to 8 bytes worth of code units, starting at p, into a word. */
+inline uint64_t hashWord(const UChar *p, int32_t count) {
+    uint64_t word = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        word |= (uint64_t)p[i] << (16 * i);
+    }
+    return word;
+}
+
+inline uint64_t hashWord(const uint8_t *p, int32_t count) {
+    uint64_t word = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        word |= (uint64_t)p[i] << (8 * i);
+    }
+    return word;
+}
+
+template<typename Unit>
+int32_t fastHash(const Unit *p, int32_t length) {
+    const int32_t unitsPerWord = 8 / (int32_t)sizeof(Unit);
+    uint64_t seed = HASH_SECRET0 ^ hashMix((uint64_t)length ^ HASH_SECRET1, HASH_SECRET0);
+    if (length > 6 * unitsPerWord) {
+        // Three independent lanes, so that the multiplications overlap.
+        uint64_t seed1 = seed, seed2 = seed;
+        do {
+            seed = hashMix(hashWord(p, unitsPerWord) ^ HASH_SECRET1,
+                           hashWord(p + unitsPerWord, unitsPerWord) ^ seed);
+            seed1 = hashMix(hashWord(p + 2 * unitsPerWord, unitsPerWord) ^ HASH_SECRET2,
+                            hashWord(p + 3 * unitsPerWord, unitsPerWord) ^ seed1);
+            seed2 = hashMix(hashWord(p + 4 * unitsPerWord, unitsPerWord) ^ HASH_SECRET3,
+                            hashWord(p + 5 * unitsPerWord, unitsPerWord) ^ seed2);
+            p += 6 * unitsPerWord;
+            length -= 6 * unitsPerWord;
+        } while (length > 6 * unitsPerWord);
+        seed ^= seed1 ^ seed2;
+    }
+    while (length > 2 * unitsPerWord) {
+        seed = hashMix(hashWord(p, unitsPerWord) ^ HASH_SECRET1,
+                       hashWord(p + unitsPerWord, unitsPerWord) ^ seed);
+        p += 2 * unitsPerWord;
+        length -= 2 * unitsPerWord;
+    }
+    // The last 1..16 bytes, or none.
+    uint64_t a, b;
+    if (length > unitsPerWord) {
+        a = hashWord(p, unitsPerWord);
+        b = hashWord(p + unitsPerWord, length - unitsPerWord);
+    } else {
+        a = hashWord(p, length);
+        b = 0;
+    }
+    uint64_t hash = hashMix(HASH_SECRET2 ^ seed, hashMix(a ^ HASH_SECRET1, b ^ seed));
+    return (int32_t)(uint32_t)(hash ^ (hash >> 32));
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+ustr_fastHashUCharsN(const UChar *str, int32_t length) {
+    return fastHash(str, str != NULL ? length : 0);
+}
+
+U_CAPI int32_t U_EXPORT2
+ustr_fastHashCharsN(const char *str, int32_t length) {
+    return fastHash((const uint8_t *)str, str != NULL ? length : 0);
+}
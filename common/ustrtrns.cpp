@@ -33,6 +33,7 @@
 #include "unicode/utf16.h"
 #include "cstring.h"
 #include "cmemory.h"
+#include "usimd.h"
 #include "ustr_imp.h"
 #include "uassert.h"
 
@@ -403,6 +404,25 @@ u_strFromUTF8WithSub(UChar *dest,
                 c = (uint8_t)src[i++];
                 if(U8_IS_SINGLE(c)) {
                     *pDest++=(UChar)c;
+                    if(count > UPRV_SIMD_MIN_LENGTH) {
+                        /*
+                         * Widen the rest of an ASCII run in bulk.
+                         * Each ASCII byte uses up one loop iteration's worth
+                         * of source and destination budget.
+                         */
+                        int32_t length = (int32_t)(pDestLimit - pDest);
+                        if(length > (srcLength - i)) {
+                            length = srcLength - i;
+                        }
+                        length = uprv_asciiToUChars((const uint8_t *)src + i, pDest, length);
+                        i += length;
+                        pDest += length;
+                        if(length < count) {
+                            count -= length;
+                        } else {
+                            break;  // recompute count
+                        }
+                    }
                 } else {
                     uint8_t __t1, __t2;
                     if( /* handle U+0800..U+FFFF inline */
@@ -492,6 +512,11 @@ u_strFromUTF8WithSub(UChar *dest,
             c = (uint8_t)src[i++];
             if(U8_IS_SINGLE(c)) {
                 ++reqLength;
+                if((srcLength - i) >= UPRV_SIMD_MIN_LENGTH) {
+                    int32_t length = uprv_asciiSpan((const uint8_t *)src + i, srcLength - i);
+                    i += length;
+                    reqLength += length;
+                }
             } else {
                 uint8_t __t1, __t2;
                 if( /* handle U+0800..U+FFFF inline */
@@ -921,6 +946,25 @@ u_strToUTF8WithSub(char *dest,
                 ch=*pSrc++;
                 if(ch <= 0x7f) {
                     *pDest++ = (uint8_t)ch;
+                    if(count > UPRV_SIMD_MIN_LENGTH) {
+                        /*
+                         * Narrow the rest of an ASCII run in bulk.
+                         * Each ASCII UChar uses up one loop iteration's worth
+                         * of source and destination budget.
+                         */
+                        int32_t length = (int32_t)(pDestLimit - pDest);
+                        if(length > (pSrcLimit - pSrc)) {
+                            length = (int32_t)(pSrcLimit - pSrc);
+                        }
+                        length = uprv_asciiFromUChars(pSrc, pDest, length);
+                        pSrc += length;
+                        pDest += length;
+                        if(length < count) {
+                            count -= length;
+                        } else {
+                            break;  // recompute count
+                        }
+                    }
                 } else if(ch <= 0x7ff) {
                     *pDest++=(uint8_t)((ch>>6)|0xc0);
                     *pDest++=(uint8_t)((ch&0x3f)|0x80);
@@ -843,17 +843,29 @@ U_CDECL_END
 //                           (for optimizing finding length of zero terminated strings.)
 //              utext.p    pointer to the current buffer
 //              utext.q    pointer to the other buffer.
+//              utext.a    number of times a buffer was filled from the UTF-8 text,
+//                           see utext_getUTF8RefillCount().
 //
 //------------------------------------------------------------------------------
 
-// Chunk size.
-//     Must be less than 85 (256/3), because of byte mapping from UChar indexes to native indexes.
+// Chunk size, in UChars.
+//     Can be set at build time, for example with CPPFLAGS=-DUTEXT_UTF8_CHUNK_SIZE=256.
+//     Larger chunks make sequential iteration refill less often, at the cost of
+//     more memory per UText and more work for each random access outside of the buffers;
+//     with the unmapped ASCII runs, sequential iteration is not faster with larger chunks.
+//     Must be less than 21845 (65536/3), because of the 16-bit mapping from UChar indexes
+//     to native indexes.
 //     Worst case is three native bytes to one UChar.  (Supplemenaries are 4 native bytes
 //     to two UChars.)
 //     The longest illegal byte sequence treated as a single error (and converted to U+FFFD)
 //     is a three-byte sequence (truncated four-byte sequence).
 //
-enum { UTF8_TEXT_CHUNK_SIZE=32 };
+#ifndef UTEXT_UTF8_CHUNK_SIZE
+#define UTEXT_UTF8_CHUNK_SIZE 32
+#endif
+enum { UTF8_TEXT_CHUNK_SIZE=UTEXT_UTF8_CHUNK_SIZE };
+static_assert(UTF8_TEXT_CHUNK_SIZE >= 8 && UTF8_TEXT_CHUNK_SIZE*3+6 <= 0x10000,
+              "UTF8_TEXT_CHUNK_SIZE must fit the 16-bit index maps");
 
 //
 // UTF8Buf  Two of these structs will be set up in the UText's extra allocated space.
@@ -868,6 +880,10 @@ enum { UTF8_TEXT_CHUNK_SIZE=32 };
 //     the last character added being a supplementary, and thus requiring a surrogate
 //     pair.  Doing this is simpler than checking for the edge case.
 //
+//     The run of ASCII characters at the start of a buffer, up to bufNILimit, maps
+//     one to one to native indexes.  The maps have no entries for it, so that filling
+//     an all-ASCII buffer only copies the characters.
+//
 
 struct UTF8Buf {
     int32_t   bufNativeStart;                        // Native index of first char in UChar buf
@@ -886,16 +902,34 @@ struct UTF8Buf {
                                                      //   because of the way indexing works when the array is
                                                      //   filled backwards during a reverse iteration.  Thus,
                                                      //   the additional extra size.
-    uint8_t   mapToNative[UTF8_TEXT_CHUNK_SIZE+4];   // map UChar index in buf to
+    uint16_t  mapToNative[UTF8_TEXT_CHUNK_SIZE+4];   // map UChar index in buf to
                                                      //  native offset from bufNativeStart.
                                                      //  Requires two extra slots,
                                                      //    one for a supplementary starting in the last normal position,
                                                      //    and one for an entry for the buffer limit position.
-    uint8_t   mapToUChars[UTF8_TEXT_CHUNK_SIZE*3+6]; // Map native offset from bufNativeStart to
+    uint16_t  mapToUChars[UTF8_TEXT_CHUNK_SIZE*3+6]; // Map native offset from bufNativeStart to
                                                      //   correspoding offset in filled part of buf.
     int32_t   align;
 };
 
+//
+//  utf8BufChunkOffset
+//
+//        Map a native index within a buffer to the offset in its chunk.
+//
+static inline int32_t
+utf8BufChunkOffset(const UTF8Buf *u8b, int32_t ix) {
+    int32_t nativeOffset = ix - u8b->bufNativeStart;
+    if (nativeOffset <= u8b->bufNILimit) {
+        // In the ASCII run at the start of the buffer.
+        return nativeOffset;
+    }
+    int32_t mapIndex = ix - u8b->toUCharsMapStart;
+    U_ASSERT(mapIndex>=0);
+    U_ASSERT(mapIndex < UPRV_LENGTHOF(u8b->mapToUChars));
+    return u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+}
+
 U_CDECL_BEGIN
 
 //
@@ -942,7 +976,6 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
     UTF8Buf *u8b = NULL;
     int32_t  length = ut->b;         // Length of original utf-8
     int32_t  ix= (int32_t)index;     // Requested index, trimmed to 32 bits.
-    int32_t  mapIndex = 0;
     if (index<0) {
         ix=0;
     } else if (index > 0x7fffffff) {
@@ -1033,9 +1066,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
 
             // Requested index is in this buffer.
             u8b = (UTF8Buf *)ut->p;   // the current buffer
-            mapIndex = ix - u8b->toUCharsMapStart;
-            U_ASSERT(mapIndex < (int32_t)sizeof(UTF8Buf::mapToUChars));
-            ut->chunkOffset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+            ut->chunkOffset = utf8BufChunkOffset(u8b, ix);
             return TRUE;
 
         }
@@ -1098,8 +1129,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
     // Requested index is in this buffer.
     //   Set the utf16 buffer index.
     u8b = (UTF8Buf *)ut->p;
-    mapIndex = ix - u8b->toUCharsMapStart;
-    ut->chunkOffset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+    ut->chunkOffset = utf8BufChunkOffset(u8b, ix);
     if (ut->chunkOffset==0) {
         // This occurs when the first character in the text is
         //   a multi-byte UTF-8 char, and the requested index is to
@@ -1132,10 +1162,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
         //    to check whether native indexing can be used.
         U_ASSERT(ix>=u8b->bufNativeStart);
         U_ASSERT(ix<=u8b->bufNativeLimit);
-        mapIndex = ix - u8b->toUCharsMapStart;
-        U_ASSERT(mapIndex>=0);
-        U_ASSERT(mapIndex<(int32_t)sizeof(u8b->mapToUChars));
-        ut->chunkOffset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+        ut->chunkOffset = utf8BufChunkOffset(u8b, ix);
 
         return TRUE;
     }
@@ -1207,32 +1234,40 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
             nulTerminated = TRUE;
         }
 
-        UChar   *buf = u8b_swap->buf;
-        uint8_t *mapToNative  = u8b_swap->mapToNative;
-        uint8_t *mapToUChars  = u8b_swap->mapToUChars;
+        UChar    *buf = u8b_swap->buf;
+        uint16_t *mapToNative  = u8b_swap->mapToNative;
+        uint16_t *mapToUChars  = u8b_swap->mapToUChars;
         int32_t  destIx       = 0;
         int32_t  srcIx        = ix;
-        UBool    seenNonAscii = FALSE;
         UChar32  c = 0;
 
-        // Fill the chunk buffer and mapping arrays.
-        while (destIx<UTF8_TEXT_CHUNK_SIZE) {
+        ++ut->a;
+
+        // Copy the ASCII run at the start of the chunk, which needs no map entries.
+        //   zero is excluded to simplify bounds checking.
+        while (destIx<UTF8_TEXT_CHUNK_SIZE && srcIx<strLen) {
+            c = s8[srcIx];
+            if (c<=0 || c>=0x80) {
+                break;
+            }
+            buf[destIx++] = (UChar)c;
+            srcIx++;
+        }
+        u8b_swap->bufNILimit = destIx;
+
+        // Fill the rest of the chunk buffer and the mapping arrays.
+        while (destIx<UTF8_TEXT_CHUNK_SIZE && srcIx<strLen) {
             c = s8[srcIx];
             if (c>0 && c<0x80) {
                 // Special case ASCII range for speed.
                 //   zero is excluded to simplify bounds checking.
                 buf[destIx] = (UChar)c;
-                mapToNative[destIx]    = (uint8_t)(srcIx - ix);
-                mapToUChars[srcIx-ix]  = (uint8_t)destIx;
+                mapToNative[destIx]    = (uint16_t)(srcIx - ix);
+                mapToUChars[srcIx-ix]  = (uint16_t)destIx;
                 srcIx++;
                 destIx++;
             } else {
                 // General case, handle everything.
-                if (seenNonAscii == FALSE) {
-                    seenNonAscii = TRUE;
-                    u8b_swap->bufNILimit = destIx;
-                }
-
                 int32_t  cIx      = srcIx;
                 int32_t  dIx      = destIx;
                 int32_t  dIxSaved = destIx;
@@ -1244,32 +1279,25 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
 
                 U16_APPEND_UNSAFE(buf, destIx, c);
                 do {
-                    mapToNative[dIx++] = (uint8_t)(cIx - ix);
+                    mapToNative[dIx++] = (uint16_t)(cIx - ix);
                 } while (dIx < destIx);
 
                 do {
-                    mapToUChars[cIx++ - ix] = (uint8_t)dIxSaved;
+                    mapToUChars[cIx++ - ix] = (uint16_t)dIxSaved;
                 } while (cIx < srcIx);
             }
-            if (srcIx>=strLen) {
-                break;
-            }
-
         }
 
         //  store Native <--> Chunk Map entries for the end of the buffer.
         //    There is no actual character here, but the index position is valid.
-        mapToNative[destIx]     = (uint8_t)(srcIx - ix);
-        mapToUChars[srcIx - ix] = (uint8_t)destIx;
+        mapToNative[destIx]     = (uint16_t)(srcIx - ix);
+        mapToUChars[srcIx - ix] = (uint16_t)destIx;
 
         //  fill in Buffer descriptor
         u8b_swap->bufNativeStart     = ix;
         u8b_swap->bufNativeLimit     = srcIx;
         u8b_swap->bufStartIdx        = 0;
         u8b_swap->bufLimitIdx        = destIx;
-        if (seenNonAscii == FALSE) {
-            u8b_swap->bufNILimit     = destIx;
-        }
         u8b_swap->toUCharsMapStart   = u8b_swap->bufNativeStart;
 
         // Set UText chunk to refer to this buffer.
@@ -1315,10 +1343,10 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
         ut->q = ut->p;
         ut->p = u8b_swap;
 
-        UChar   *buf = u8b_swap->buf;
-        uint8_t *mapToNative = u8b_swap->mapToNative;
-        uint8_t *mapToUChars = u8b_swap->mapToUChars;
-        int32_t  toUCharsMapStart = ix - sizeof(UTF8Buf::mapToUChars) + 1;
+        UChar    *buf = u8b_swap->buf;
+        uint16_t *mapToNative = u8b_swap->mapToNative;
+        uint16_t *mapToUChars = u8b_swap->mapToUChars;
+        int32_t  toUCharsMapStart = ix - UPRV_LENGTHOF(u8b_swap->mapToUChars) + 1;
         // Note that toUCharsMapStart can be negative. Happens when the remaining
         // text from current position to the beginning is less than the buffer size.
         // + 1 because mapToUChars must have a slot at the end for the bufNativeLimit entry.
@@ -1328,13 +1356,16 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
                                                     //   buffer start.
         int32_t  srcIx  = ix;
         int32_t  bufNILimit = destIx;
+        UBool    seenNonAscii = FALSE;
         UChar32   c;
 
+        ++ut->a;
+
         // Map to/from Native Indexes, fill in for the position at the end of
         //   the buffer.
         //
-        mapToNative[destIx] = (uint8_t)(srcIx - toUCharsMapStart);
-        mapToUChars[srcIx - toUCharsMapStart] = (uint8_t)destIx;
+        mapToNative[destIx] = (uint16_t)(srcIx - toUCharsMapStart);
+        mapToUChars[srcIx - toUCharsMapStart] = (uint16_t)destIx;
 
         // Fill the chunk buffer
         // Work backwards, filling from the end of the buffer towards the front.
@@ -1347,15 +1378,30 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
             c = s8[srcIx];
             if (c<0x80) {
                 // Special case ASCII range for speed.
+                //   Map entries are only needed once there is a non-ASCII character
+                //   before this one.  Until then, they are filled in afterwards.
                 buf[destIx] = (UChar)c;
-                U_ASSERT(toUCharsMapStart <= srcIx);
-                mapToUChars[srcIx - toUCharsMapStart] = (uint8_t)destIx;
-                mapToNative[destIx] = (uint8_t)(srcIx - toUCharsMapStart);
+                if (seenNonAscii) {
+                    U_ASSERT(toUCharsMapStart <= srcIx);
+                    mapToUChars[srcIx - toUCharsMapStart] = (uint16_t)destIx;
+                    mapToNative[destIx] = (uint16_t)(srcIx - toUCharsMapStart);
+                }
             } else {
                 // General case, handle everything non-ASCII.
 
                 int32_t  sIx      = srcIx;  // ix of last byte of multi-byte u8 char
 
+                if (!seenNonAscii) {
+                    // Map the ASCII characters that follow this one.
+                    int32_t  aIx = srcIx + 1;
+                    int32_t  dIx = destIx + 1;
+                    for (; aIx < ix; ++aIx, ++dIx) {
+                        mapToUChars[aIx - toUCharsMapStart] = (uint16_t)dIx;
+                        mapToNative[dIx] = (uint16_t)(aIx - toUCharsMapStart);
+                    }
+                    seenNonAscii = TRUE;
+                }
+
                 // Get the full character from the UTF8 string.
                 //   use code derived from tbe macros in utf8.h
                 //   Leaves srcIx pointing at the first byte of the UTF-8 char.
@@ -1366,17 +1412,17 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
                 // Store the character in UTF-16 buffer.
                 if (c<0x10000) {
                     buf[destIx] = (UChar)c;
-                    mapToNative[destIx] = (uint8_t)(srcIx - toUCharsMapStart);
+                    mapToNative[destIx] = (uint16_t)(srcIx - toUCharsMapStart);
                 } else {
                     buf[destIx]         = U16_TRAIL(c);
-                    mapToNative[destIx] = (uint8_t)(srcIx - toUCharsMapStart);
+                    mapToNative[destIx] = (uint16_t)(srcIx - toUCharsMapStart);
                     buf[--destIx]       = U16_LEAD(c);
-                    mapToNative[destIx] = (uint8_t)(srcIx - toUCharsMapStart);
+                    mapToNative[destIx] = (uint16_t)(srcIx - toUCharsMapStart);
                 }
 
                 // Fill in the map from native indexes to UChars buf index.
                 do {
-                    mapToUChars[sIx-- - toUCharsMapStart] = (uint8_t)destIx;
+                    mapToUChars[sIx-- - toUCharsMapStart] = (uint16_t)destIx;
                 } while (sIx >= srcIx);
                 U_ASSERT(toUCharsMapStart <= (srcIx+1));
 
@@ -1552,9 +1598,7 @@ utf8TextMapIndexToUTF16(const UText *ut, int64_t index64) {
     UTF8Buf *u8b = (UTF8Buf *)ut->p;
     U_ASSERT(index>=ut->chunkNativeStart+ut->nativeIndexingLimit);
     U_ASSERT(index<=ut->chunkNativeLimit);
-    int32_t mapIndex = index - u8b->toUCharsMapStart;
-    U_ASSERT(mapIndex < (int32_t)sizeof(UTF8Buf::mapToUChars));
-    int32_t offset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+    int32_t offset = utf8BufChunkOffset(u8b, index);
     U_ASSERT(offset>=0 && offset<=ut->chunkLength);
     return offset;
 }
@@ -1646,6 +1690,7 @@ utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status) {
 
     ut->pFuncs  = &utf8Funcs;
     ut->context = s;
+    ut->a       = 0;
     ut->b       = (int32_t)length;
     ut->c       = (int32_t)length;
     if (ut->c < 0) {
@@ -1658,6 +1703,22 @@ utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status) {
 
 }
 
+U_CAPI const char * U_EXPORT2
+utext_getUTF8(const UText *ut) {
+    if (ut == NULL || ut->pFuncs != &utf8Funcs) {
+        return NULL;
+    }
+    return (const char *)ut->context;
+}
+
+U_CAPI int64_t U_EXPORT2
+utext_getUTF8RefillCount(const UText *ut) {
+    if (ut == NULL || ut->pFuncs != &utf8Funcs) {
+        return -1;
+    }
+    return ut->a;
+}
+
 
 
 
@@ -2873,3 +2934,537 @@ utext_openCharacterIterator(UText *ut, CharacterIterator *ci, UErrorCode *status
     }
     return ut;
 }
+
+
+//------------------------------------------------------------------------------
+//
+//     UText implementation for text stored in several UTF-8 or UTF-16 segments
+//
+//         Use of UText data members:
+//            context    pointer to the SegText header, in the extra storage.
+//            a          length of the full text.
+//            p          pointer to the array of segment pointers, in the extra storage.
+//            q          pointer to the array of segment native start indexes,
+//                         in the extra storage.  It has count+1 entries, the last
+//                         one is the length of the text.
+//            r          UTF-8 only: pointer to the SegUTF8Chunk conversion buffer,
+//                         in the extra storage.
+//
+//         UTF-16 chunks are the segments themselves.
+//         UTF-8 segments are converted into a buffer of up to SEG_UTF8_CHUNK_SIZE
+//         UChars; a character that is split across segments is put back together
+//         while converting.
+//
+//------------------------------------------------------------------------------
+
+enum { SEG_UTF8_CHUNK_SIZE=64 };
+
+struct SegText {
+    void     *ownedText;   // The copied text of a deep clone, or NULL.
+    int32_t   count;       // Number of segments.
+    int32_t   current;     // Index of the segment that was last accessed.
+    UBool     isUTF8;
+};
+
+struct SegUTF8Chunk {
+    int32_t   map[SEG_UTF8_CHUNK_SIZE+3];   // Native offset from the chunk start of each UChar,
+                                           //   and of the chunk limit.
+    UChar     buf[SEG_UTF8_CHUNK_SIZE+2];   // Room for a surrogate pair at the end.
+};
+
+U_CDECL_BEGIN
+
+//
+//  segContains    Is a native index within a segment,
+//                 taking the character after the index when going forward
+//                 and the one before it when going backward.
+//
+static inline UBool
+segContains(const int32_t *starts, int32_t seg, int32_t ix, UBool forward) {
+    return forward ? (starts[seg] <= ix && ix < starts[seg+1]) :
+                     (starts[seg] < ix && ix <= starts[seg+1]);
+}
+
+//
+//  segFind        Find the segment for a native index.
+//                 Going forward, 0 <= ix < length; going backward, 0 < ix <= length.
+//
+static int32_t
+segFind(SegText *st, const int32_t *starts, int32_t ix, UBool forward) {
+    // Iteration usually stays in the current segment or moves to a neighbor.
+    int32_t seg = st->current;
+    if (segContains(starts, seg, ix, forward)) {
+        return seg;
+    }
+    if (seg+1 < st->count && segContains(starts, seg+1, ix, forward)) {
+        return st->current = seg+1;
+    }
+    if (seg > 0 && segContains(starts, seg-1, ix, forward)) {
+        return st->current = seg-1;
+    }
+
+    // Binary search for the last segment that starts at or before ix (forward)
+    //   or before ix (backward).  starts[0] is zero, and qualifies.
+    int32_t start = 0;
+    int32_t limit = st->count;
+    while (limit - start > 1) {
+        int32_t mid = (start + limit) / 2;
+        if (forward ? starts[mid] <= ix : starts[mid] < ix) {
+            start = mid;
+        } else {
+            limit = mid;
+        }
+    }
+    U_ASSERT(segContains(starts, start, ix, forward));
+    return st->current = start;
+}
+
+static int64_t U_CALLCONV
+segTextLength(UText *ut) {
+    return ut->a;
+}
+
+static UText * U_CALLCONV
+segTextClone(UText *dest, const UText *src, UBool deep, UErrorCode *status) {
+    dest = shallowTextClone(dest, src, status);
+    if (deep && U_SUCCESS(*status)) {
+        // Copy the text of all segments into one block, and point the segments there.
+        SegText *st = (SegText *)dest->context;
+        const void **segs = (const void **)dest->p;
+        const int32_t *starts = (const int32_t *)dest->q;
+        int32_t unitSize = st->isUTF8 ? 1 : U_SIZEOF_UCHAR;
+        char *copy = (char *)uprv_malloc(dest->a * unitSize + 1);
+        if (copy == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return dest;
+        }
+        for (int32_t i = 0; i < st->count; ++i) {
+            if (starts[i+1] > starts[i]) {
+                uprv_memcpy(copy + starts[i] * unitSize, segs[i], (starts[i+1] - starts[i]) * unitSize);
+            }
+            segs[i] = copy + starts[i] * unitSize;
+        }
+        if (!st->isUTF8 && dest->chunkLength > 0) {
+            // The current chunk is one of the segments.
+            dest->chunkContents = (const UChar *)copy + dest->chunkNativeStart;
+        }
+        st->ownedText = copy;
+        dest->providerProperties |= I32_FLAG(UTEXT_PROVIDER_OWNS_TEXT);
+    }
+    return dest;
+}
+
+static void U_CALLCONV
+segTextClose(UText *ut) {
+    // Most of the work of close is done by the generic UText framework close.
+    // All that needs to be done here is to delete the text copied by a deep clone.
+    SegText *st = (SegText *)ut->context;
+    if (ut->providerProperties & I32_FLAG(UTEXT_PROVIDER_OWNS_TEXT)) {
+        uprv_free(st->ownedText);
+    }
+    st->ownedText = NULL;
+}
+
+static int32_t U_CALLCONV
+segTextExtract(UText *ut,
+               int64_t start, int64_t limit,
+               UChar *dest, int32_t destCapacity,
+               UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return 0;
+    }
+    if(destCapacity<0 || (dest==NULL && destCapacity>0) || start>limit) {
+        *status=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t  length  = (int32_t)ut->a;
+    int32_t  start32 = pinIndex(start, length);
+    int32_t  limit32 = pinIndex(limit, length);
+    int32_t  desti   = 0;
+
+    utext_setNativeIndex(ut, start32);   // Moves to a code point boundary, if needed.
+    int64_t  ix = utext_getNativeIndex(ut);
+    int64_t  copyLimit = ix;
+    while (ix<limit32) {
+        UChar32 c = utext_next32(ut);
+        if (c<0) {
+            break;
+        }
+        ix = utext_getNativeIndex(ut);
+        int32_t  len = U16_LENGTH(c);
+        if (desti+len <= destCapacity) {
+            U16_APPEND_UNSAFE(dest, desti, c);
+            copyLimit = ix;
+        } else {
+            desti += len;
+            *status = U_BUFFER_OVERFLOW_ERROR;
+        }
+    }
+    utext_setNativeIndex(ut, copyLimit);
+
+    u_terminateUChars(dest, destCapacity, desti, status);
+    return desti;
+}
+
+//
+//  UTF-16 segments
+//
+static UBool U_CALLCONV
+segUCharsTextAccess(UText *ut, int64_t index, UBool forward) {
+    int32_t  length = (int32_t)ut->a;
+    int32_t  ix = pinIndex(index, length);
+    if (length == 0) {
+        // Empty text, the chunk stays empty.
+        return FALSE;
+    }
+
+    // At the end of the text going forward, or at its start going backward,
+    //   fail but leave the chunk on the adjacent segment.
+    UBool success = forward ? ix<length : ix>0;
+    int32_t seg = segFind((SegText *)ut->context, (const int32_t *)ut->q, ix,
+                          success ? forward : !forward);
+    const UChar * const *segs = (const UChar * const *)ut->p;
+    const int32_t *starts = (const int32_t *)ut->q;
+    ut->chunkContents       = segs[seg];
+    ut->chunkNativeStart    = starts[seg];
+    ut->chunkNativeLimit    = starts[seg+1];
+    ut->chunkLength         = starts[seg+1] - starts[seg];
+    ut->nativeIndexingLimit = ut->chunkLength;
+    ut->chunkOffset         = ix - starts[seg];
+    return success;
+}
+
+//
+//  UTF-8 segments
+//
+
+//  Move seg to the segment containing the byte at pos.  0 <= pos < length.
+static inline void
+segUTF8Seek(const int32_t *starts, int32_t &seg, int32_t pos) {
+    while (pos < starts[seg]) {
+        --seg;
+    }
+    while (pos >= starts[seg+1]) {
+        ++seg;
+    }
+}
+
+//  Get the character starting at pos, and move pos past it.
+static UChar32
+segUTF8Next(const UText *ut, int32_t &seg, int32_t &pos) {
+    const uint8_t * const *segs = (const uint8_t * const *)ut->p;
+    const int32_t *starts = (const int32_t *)ut->q;
+    int32_t  length = (int32_t)ut->a;
+    segUTF8Seek(starts, seg, pos);
+    const uint8_t *s = segs[seg];
+    int32_t  segStart = starts[seg];
+    int32_t  segLimit = starts[seg+1];
+    UChar32  c = s[pos - segStart];
+    if (c < 0x80) {
+        ++pos;
+    } else if (segLimit - pos >= 4 || segLimit == length) {
+        // The whole character is in this segment.
+        int32_t  i = pos - segStart;
+        U8_NEXT_OR_FFFD(s, i, segLimit - segStart, c);
+        pos = segStart + i;
+    } else {
+        // The character may continue in the following segments.
+        uint8_t  bytes[4];
+        int32_t  n = 0;
+        for (int32_t bSeg = seg, bPos = pos; n < 4 && bPos < length; ++bPos) {
+            segUTF8Seek(starts, bSeg, bPos);
+            bytes[n++] = segs[bSeg][bPos - starts[bSeg]];
+        }
+        int32_t  i = 0;
+        U8_NEXT_OR_FFFD(bytes, i, n, c);
+        pos += i;
+    }
+    return c;
+}
+
+//  Move ix back to the start of the character that contains it.  0 <= ix < length.
+static int32_t
+segUTF8CodePointStart(const UText *ut, int32_t ix) {
+    const uint8_t * const *segs = (const uint8_t * const *)ut->p;
+    const int32_t *starts = (const int32_t *)ut->q;
+    int32_t  seg = segFind((SegText *)ut->context, starts, ix, TRUE);
+    if (!U8_IS_TRAIL(segs[seg][ix - starts[seg]])) {
+        return ix;
+    }
+    // Find a non-trail byte among the three before ix; it starts a character.
+    //   If there is none, ix is not part of a longer sequence.
+    int32_t  pos = ix;
+    for (int32_t back = ix - 1; back >= 0 && back >= ix - 3; --back) {
+        segUTF8Seek(starts, seg, back);
+        if (!U8_IS_TRAIL(segs[seg][back - starts[seg]])) {
+            pos = back;
+            break;
+        }
+    }
+    // Go forward to the character that contains ix.
+    while (pos < ix) {
+        int32_t  start = pos;
+        segUTF8Next(ut, seg, pos);
+        if (pos > ix) {
+            return start;
+        }
+    }
+    return ix;
+}
+
+//  Convert the text from start, which is on a character boundary, to the chunk buffer,
+//    up to stopAt or until the buffer is full.
+static void
+segUTF8Fill(UText *ut, int32_t start, int32_t stopAt) {
+    SegUTF8Chunk *chunk = (SegUTF8Chunk *)ut->r;
+    int32_t  seg = segFind((SegText *)ut->context, (const int32_t *)ut->q, start, TRUE);
+    int32_t  pos = start;
+    int32_t  destIx = 0;
+    int32_t  nativeIndexingLimit = -1;
+    while (destIx < SEG_UTF8_CHUNK_SIZE && pos < stopAt) {
+        int32_t  cStart = pos;
+        UChar32  c = segUTF8Next(ut, seg, pos);
+        if (c >= 0x80 && nativeIndexingLimit < 0) {
+            nativeIndexingLimit = destIx;
+        }
+        chunk->map[destIx] = cStart - start;
+        if (c <= 0xffff) {
+            chunk->buf[destIx++] = (UChar)c;
+        } else {
+            chunk->buf[destIx++] = U16_LEAD(c);
+            chunk->map[destIx]   = cStart - start;
+            chunk->buf[destIx++] = U16_TRAIL(c);
+        }
+    }
+    chunk->map[destIx] = pos - start;
+
+    ut->chunkContents       = chunk->buf;
+    ut->chunkNativeStart    = start;
+    ut->chunkNativeLimit    = pos;
+    ut->chunkLength         = destIx;
+    ut->nativeIndexingLimit = nativeIndexingLimit < 0 ? destIx : nativeIndexingLimit;
+}
+
+//  Fill the chunk buffer with the text that ends at ix, which is on a character boundary.
+static void
+segUTF8FillBackward(UText *ut, int32_t ix) {
+    // Going back fewer bytes than the buffer size allows for moving back
+    //   to a character boundary.
+    int32_t  start = ix - (SEG_UTF8_CHUNK_SIZE - 4);
+    start = start <= 0 ? 0 : segUTF8CodePointStart(ut, start);
+    segUTF8Fill(ut, start, ix);
+    U_ASSERT(ut->chunkNativeLimit == ix);
+}
+
+static int32_t U_CALLCONV
+segUTF8TextMapIndexToUTF16(const UText *ut, int64_t index64) {
+    const SegUTF8Chunk *chunk = (const SegUTF8Chunk *)ut->r;
+    int32_t  offset = (int32_t)(index64 - ut->chunkNativeStart);
+    U_ASSERT(offset >= 0 && index64 <= ut->chunkNativeLimit);
+    if (offset <= ut->nativeIndexingLimit) {
+        return offset;
+    }
+    // Binary search for the last UChar that starts at or before the index.
+    int32_t  start = ut->nativeIndexingLimit;
+    int32_t  limit = ut->chunkLength + 1;
+    while (limit - start > 1) {
+        int32_t mid = (start + limit) / 2;
+        if (chunk->map[mid] <= offset) {
+            start = mid;
+        } else {
+            limit = mid;
+        }
+    }
+    if (start > 0 && chunk->map[start-1] == chunk->map[start]) {
+        // Trail surrogate, go to the start of the pair.
+        --start;
+    }
+    return start;
+}
+
+static int64_t U_CALLCONV
+segUTF8TextMapOffsetToNative(const UText *ut) {
+    const SegUTF8Chunk *chunk = (const SegUTF8Chunk *)ut->r;
+    U_ASSERT(ut->chunkOffset>ut->nativeIndexingLimit && ut->chunkOffset<=ut->chunkLength);
+    return ut->chunkNativeStart + chunk->map[ut->chunkOffset];
+}
+
+static UBool U_CALLCONV
+segUTF8TextAccess(UText *ut, int64_t index, UBool forward) {
+    int32_t  length = (int32_t)ut->a;
+    int32_t  ix = pinIndex(index, length);
+    if (length == 0) {
+        // Empty text, the chunk stays empty.
+        return FALSE;
+    }
+
+    if (forward) {
+        if (ix >= length) {
+            // At the end.  Fail, leaving the chunk on the end of the text.
+            if (ut->chunkNativeLimit != length) {
+                segUTF8FillBackward(ut, length);
+            }
+            ut->chunkOffset = ut->chunkLength;
+            return FALSE;
+        }
+        if (ix >= ut->chunkNativeStart && ix < ut->chunkNativeLimit) {
+            ut->chunkOffset = segUTF8TextMapIndexToUTF16(ut, ix);
+            return TRUE;
+        }
+        segUTF8Fill(ut, segUTF8CodePointStart(ut, ix), length);
+        ut->chunkOffset = 0;
+        return TRUE;
+    }
+
+    // Backward.
+    if (ix > ut->chunkNativeStart && ix <= ut->chunkNativeLimit) {
+        ut->chunkOffset = segUTF8TextMapIndexToUTF16(ut, ix);
+        if (ut->chunkOffset > 0) {
+            return TRUE;
+        }
+        // ix is within the first character of the chunk.
+    }
+    if (ix < length) {
+        ix = segUTF8CodePointStart(ut, ix);
+    }
+    if (ix == 0) {
+        // At the start.  Fail, leaving the chunk on the start of the text.
+        if (ut->chunkNativeStart != 0 || ut->chunkNativeLimit == 0) {
+            segUTF8Fill(ut, 0, length);
+        }
+        ut->chunkOffset = 0;
+        return FALSE;
+    }
+    segUTF8FillBackward(ut, ix);
+    ut->chunkOffset = ut->chunkLength;
+    return TRUE;
+}
+
+static const struct UTextFuncs segUCharsFuncs =
+{
+    sizeof(UTextFuncs),
+    0, 0, 0,             // Reserved alignment padding
+    segTextClone,
+    segTextLength,
+    segUCharsTextAccess,
+    segTextExtract,
+    NULL,                // Replace
+    NULL,                // Copy
+    NULL,                // MapOffsetToNative,
+    NULL,                // MapIndexToUTF16,
+    segTextClose,
+    NULL,                // spare 1
+    NULL,                // spare 2
+    NULL                 // spare 3
+};
+
+static const struct UTextFuncs segUTF8Funcs =
+{
+    sizeof(UTextFuncs),
+    0, 0, 0,             // Reserved alignment padding
+    segTextClone,
+    segTextLength,
+    segUTF8TextAccess,
+    segTextExtract,
+    NULL,                // Replace
+    NULL,                // Copy
+    segUTF8TextMapOffsetToNative,
+    segUTF8TextMapIndexToUTF16,
+    segTextClose,
+    NULL,                // spare 1
+    NULL,                // spare 2
+    NULL                 // spare 3
+};
+
+U_CDECL_END
+
+
+static UText *
+segTextOpen(UText *ut, const void * const *segments, const int32_t *lengths,
+            int32_t count, UBool isUTF8, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return ut;
+    }
+    if (count < 0 || (count > 0 && (segments == NULL || lengths == NULL))) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return ut;
+    }
+    // Room in the extra storage for the header, the segment pointers and starts,
+    //   and for UTF-8 the conversion buffer.
+    int64_t extraSpace = (int64_t)sizeof(SegText) +
+        (int64_t)count * (int64_t)sizeof(void *) + ((int64_t)count + 1) * (int64_t)sizeof(int32_t);
+    if (isUTF8) {
+        extraSpace += sizeof(SegUTF8Chunk);
+    }
+    int64_t length = 0;
+    for (int32_t i = 0; i < count && length <= INT32_MAX; ++i) {
+        int32_t len = lengths[i];
+        if (len < 0) {
+            len = segments[i] == NULL ? -1 :
+                isUTF8 ? (int32_t)uprv_strlen((const char *)segments[i]) : u_strlen((const UChar *)segments[i]);
+        }
+        if (len < 0 || (len > 0 && segments[i] == NULL)) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return ut;
+        }
+        length += len;
+    }
+    if (length > INT32_MAX || extraSpace > INT32_MAX) {
+        // Texts with 64 bit lengths are not supported.
+        *status = U_INDEX_OUTOFBOUNDS_ERROR;
+        return ut;
+    }
+
+    ut = utext_setup(ut, (int32_t)extraSpace, status);
+    if (U_FAILURE(*status)) {
+        return ut;
+    }
+    SegText *st = (SegText *)ut->pExtra;
+    const void **segs = (const void **)(st + 1);
+    int32_t *starts = (int32_t *)(segs + count);
+    st->ownedText = NULL;
+    st->count     = count;
+    st->current   = 0;
+    st->isUTF8    = isUTF8;
+    int32_t start = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        int32_t len = lengths[i];
+        if (len < 0) {
+            len = isUTF8 ? (int32_t)uprv_strlen((const char *)segments[i]) : u_strlen((const UChar *)segments[i]);
+        }
+        segs[i]   = segments[i];
+        starts[i] = start;
+        start += len;
+    }
+    starts[count] = start;
+
+    ut->pFuncs  = isUTF8 ? &segUTF8Funcs : &segUCharsFuncs;
+    ut->context = st;
+    ut->a       = length;
+    ut->p       = segs;
+    ut->q       = starts;
+    ut->r       = isUTF8 ? starts + count + 1 : NULL;
+    ut->providerProperties = isUTF8 ? 0 : I32_FLAG(UTEXT_PROVIDER_STABLE_CHUNKS);
+
+    // Start with an empty chunk; the first access fills it.
+    ut->chunkContents       = isUTF8 ? ((SegUTF8Chunk *)ut->r)->buf : gEmptyUString;
+    ut->chunkNativeStart    = 0;
+    ut->chunkNativeLimit    = 0;
+    ut->chunkLength         = 0;
+    ut->chunkOffset         = 0;
+    ut->nativeIndexingLimit = 0;
+    return ut;
+}
+
+U_CAPI UText * U_EXPORT2
+utext_openUTF8Segments(UText *ut, const char * const *segments, const int32_t *lengths,
+                       int32_t count, UErrorCode *status) {
+    return segTextOpen(ut, (const void * const *)segments, lengths, count, TRUE, status);
+}
+
+U_CAPI UText * U_EXPORT2
+utext_openUCharsSegments(UText *ut, const UChar * const *segments, const int32_t *lengths,
+                         int32_t count, UErrorCode *status) {
+    return segTextOpen(ut, (const void * const *)segments, lengths, count, FALSE, status);
+}
@@ -11,6 +11,8 @@
 *   indentation:4
 */
 
+#include <atomic>
+
 #include "unicode/utrace.h"
 #include "utracimp.h"
 #include "cstring.h"
@@ -477,6 +479,26 @@ trCollNames[] = {
     NULL
 };
 
+
+static const char * const
+trResNames[] = {
+    "ures_open",
+    "udata_open",
+    "udata_mapFile",
+    "ures_preload",
+    NULL
+};
+
+
+static const char * const
+trServiceNames[] = {
+    "BreakIterator::createInstance",
+    "LocalizedNumberFormatter::compile",
+    "UnifiedCache::createObject",
+    "u_initServices",
+    NULL
+};
+
                 
 U_CAPI const char * U_EXPORT2
 utrace_functionName(int32_t fnNumber) {
@@ -486,8 +508,100 @@ utrace_functionName(int32_t fnNumber) {
         return trConvNames[fnNumber - UTRACE_CONVERSION_START];
     } else if(UTRACE_COLLATION_START <= fnNumber && fnNumber < UTRACE_COLLATION_LIMIT){
         return trCollNames[fnNumber - UTRACE_COLLATION_START];
+    } else if(UTRACE_RESOURCE_START <= fnNumber && fnNumber < UTRACE_RESOURCE_LIMIT){
+        return trResNames[fnNumber - UTRACE_RESOURCE_START];
+    } else if(UTRACE_SERVICE_START <= fnNumber && fnNumber < UTRACE_SERVICE_LIMIT){
+        return trServiceNames[fnNumber - UTRACE_SERVICE_START];
     } else {
         return "[BOGUS Trace Function Number]";
     }
 }
 
+
+/* Metrics ------------------------------------------------------------------ */
+
+/*
+ * The metrics counters are sharded so that threads on different cores
+ * rarely update the same cache line.
+ * Each thread picks a shard when it first updates a counter.
+ * Relaxed atomic operations suffice because the counters do not guard other data.
+ */
+#define METRICS_SHARD_COUNT 16
+
+struct alignas(64) MetricsShard {
+    std::atomic<int64_t> values[UTRACE_METRIC_LIMIT];
+};
+
+static MetricsShard gMetricsShards[METRICS_SHARD_COUNT];
+static std::atomic<int32_t> gNextMetricsShard(0);
+static thread_local int32_t gMetricsShard = -1;
+
+U_CAPI void U_EXPORT2
+utrace_addMetric(int32_t metric, int64_t delta) {
+    U_ASSERT(0 <= metric && metric < UTRACE_METRIC_LIMIT);
+    int32_t shard = gMetricsShard;
+    if (shard < 0) {
+        shard = gMetricsShard =
+            gNextMetricsShard.fetch_add(1, std::memory_order_relaxed) % METRICS_SHARD_COUNT;
+    }
+    gMetricsShards[shard].values[metric].fetch_add(delta, std::memory_order_relaxed);
+}
+
+U_CAPI int32_t U_EXPORT2
+utrace_getMetrics(int64_t *metrics, int32_t capacity, UErrorCode *status) {
+    if (status == NULL || U_FAILURE(*status)) {
+        return 0;
+    }
+    if (capacity < 0 || (metrics == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (capacity > UTRACE_METRIC_LIMIT) {
+        capacity = UTRACE_METRIC_LIMIT;
+    }
+    for (int32_t i = 0; i < capacity; ++i) {
+        int64_t sum = 0;
+        for (int32_t shard = 0; shard < METRICS_SHARD_COUNT; ++shard) {
+            sum += gMetricsShards[shard].values[i].load(std::memory_order_relaxed);
+        }
+        metrics[i] = sum;
+    }
+    return UTRACE_METRIC_LIMIT;
+}
+
+U_CAPI void U_EXPORT2
+utrace_resetMetrics() {
+    for (int32_t shard = 0; shard < METRICS_SHARD_COUNT; ++shard) {
+        for (int32_t i = 0; i < UTRACE_METRIC_LIMIT; ++i) {
+            gMetricsShards[shard].values[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+
+static const char * const
+trMetricNames[] = {
+    "unifiedCacheHit",
+    "unifiedCacheMiss",
+    "udataCacheHit",
+    "udataCacheMiss",
+    "resbundCacheHit",
+    "resbundCacheMiss",
+    "converterCacheHit",
+    "converterCacheMiss",
+    "allocCount",
+    "allocBytes",
+    "freeCount",
+    "mutexWaitCount",
+    "mutexWaitNanos",
+    NULL
+};
+
+U_CAPI const char * U_EXPORT2
+utrace_metricName(int32_t metric) {
+    if(0 <= metric && metric < UTRACE_METRIC_LIMIT) {
+        return trMetricNames[metric];
+    } else {
+        return "[BOGUS Trace Metric]";
+    }
+}
@@ -105,6 +105,18 @@ utrace_exit(int32_t fnNumber, int32_t returnType, ...);
 U_CAPI void U_EXPORT2
 utrace_data(int32_t utraceFnNumber, int32_t level, const char *fmt, ...);
 
+/**
+ * Adds delta to a metrics counter.
+ * Do not use directly, use UTRACE_METRIC_INC() and UTRACE_METRIC_ADD() instead.
+ *
+ * @param metric The UTraceMetric to be updated.
+ * @param delta The value to be added.
+ *
+ * @internal
+ */
+U_CAPI void U_EXPORT2
+utrace_addMetric(int32_t metric, int64_t delta);
+
 U_CDECL_END
 
 #if U_ENABLE_TRACING
@@ -116,6 +128,19 @@ U_CDECL_END
  */
 #define UTRACE_LEVEL(level) (utrace_getLevel()>=(level))
 
+/**
+ * Increments a metrics counter, see UTraceMetric.
+ * Unlike the other trace macros, this does not depend on the trace level.
+ * @internal
+ */
+#define UTRACE_METRIC_INC(metric) utrace_addMetric((metric), 1)
+
+/**
+ * Adds delta to a metrics counter, see UTraceMetric.
+ * @internal
+ */
+#define UTRACE_METRIC_ADD(metric, delta) utrace_addMetric((metric), (delta))
+
 /**
   *  Flag bit in utraceFnNumber, the local variable added to each function 
   *  with tracing code to contains the function number.
@@ -349,6 +374,8 @@ U_CDECL_END
  */
 
 #define UTRACE_LEVEL(level) 0
+#define UTRACE_METRIC_INC(metric)
+#define UTRACE_METRIC_ADD(metric, delta)
 #define UTRACE_ENTRY(fnNumber)
 #define UTRACE_ENTRY_OC(fnNumber)
 #define UTRACE_EXIT()
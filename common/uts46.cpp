@@ -28,6 +28,7 @@
 #include "punycode.h"
 #include "ubidi_props.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 
 // Note about tests for UIDNA_ERROR_DOMAIN_NAME_TOO_LONG:
 //
@@ -298,6 +299,62 @@ static const int8_t asciiData[128]={
      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -1, -1, -1, -1
 };
 
+// The lowercase LDH characters and the dot: 002D..002E, 0030..0039, 0061..007A.
+// Bit (b>>4) of ldhDotBits[b&0xf] is set for each byte b in the set,
+// as for uprv_asciiSpanInSet().
+static const uint8_t ldhDotBits[16]={
+    0x88, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8,
+    0xc8, 0xc8, 0xc0, 0x40, 0x40, 0x44, 0x44, 0x40
+};
+
+/**
+ * Returns TRUE if name is a domain name of only lowercase LDH labels
+ * which toASCII passes through unchanged and without any errors:
+ * No mapping, no empty labels (except for a trailing dot),
+ * no leading or trailing hyphens, no "??--" labels (which might be Punycode),
+ * and no label or domain name that is too long.
+ */
+static UBool
+isOkLowercaseLDHName(const char *name, int32_t length) {
+    // A trailing dot does not count toward the 253-byte limit.
+    if(length==0 || length>254 || (length==254 && name[253]!=0x2e)) {
+        return FALSE;
+    }
+    const uint8_t *s=reinterpret_cast<const uint8_t *>(name);
+    int32_t i=0;
+#if UPRV_HAVE_SIMD_LOOKUP
+    if(length>=UPRV_SIMD_MIN_LENGTH) {
+        i=uprv_asciiSpanInSet(s, length, ldhDotBits, TRUE);
+    }
+#endif
+    for(; i<length; ++i) {
+        uint8_t b=s[i];
+        if(b>0x7f || (ldhDotBits[b&0xf]&(1<<(b>>4)))==0) {
+            return FALSE;
+        }
+    }
+    // Check each label only at its boundaries.
+    const char *label=name;
+    const char *limit=name+length;
+    for(;;) {
+        const char *dot=(const char *)uprv_memchr(label, 0x2e, limit-label);
+        const char *labelLimit= dot!=NULL ? dot : limit;
+        int32_t labelLength=(int32_t)(labelLimit-label);
+        if(labelLength==0) {
+            // Only a trailing dot after a non-empty label is allowed.
+            return dot==NULL && label!=name;
+        }
+        if(labelLength>63 || label[0]==0x2d || labelLimit[-1]==0x2d ||
+                (labelLength>=4 && label[2]==0x2d && label[3]==0x2d)) {
+            return FALSE;
+        }
+        if(dot==NULL) {
+            return TRUE;
+        }
+        label=dot+1;
+    }
+}
+
 UnicodeString &
 UTS46::process(const UnicodeString &src,
                UBool isLabel, UBool toASCII,
@@ -423,6 +480,15 @@ UTS46::processUTF8(StringPiece src,
         dest.Flush();
         return;
     }
+    if(toASCII && !isLabel && isOkLowercaseLDHName(srcArray, srcLength)) {
+        // The common case of a valid, already-lowercase host name:
+        // Output it unchanged, without the per-character ASCII fastpath loop
+        // and without copying into a scratch buffer.
+        // (CheckedArrayByteSink does not even copy when src is its own buffer.)
+        dest.Append(srcArray, srcLength);
+        dest.Flush();
+        return;
+    }
     UnicodeString destString;
     int32_t labelStart=0;
     if(srcLength<=256) {  // length of stackArray[]
@@ -124,12 +124,6 @@ UBool UVector::operator==(const UVector& other) {
     return TRUE;
 }
 
-void UVector::addElement(void* obj, UErrorCode &status) {
-    if (ensureCapacity(count + 1, status)) {
-        elements[count++].pointer = obj;
-    }
-}
-
 void UVector::addElement(int32_t elem, UErrorCode &status) {
     if (ensureCapacity(count + 1, status)) {
         elements[count].pointer = NULL;     // Pointers may be bigger than ints.
@@ -185,14 +179,6 @@ void UVector::insertElementAt(int32_t elem, int32_t index, UErrorCode &status) {
     /* else index out of range */
 }
 
-void* UVector::elementAt(int32_t index) const {
-    return (0 <= index && index < count) ? elements[index].pointer : 0;
-}
-
-int32_t UVector::elementAti(int32_t index) const {
-    return (0 <= index && index < count) ? elements[index].integer : 0;
-}
-
 UBool UVector::containsAll(const UVector& other) const {
     for (int32_t i=0; i<other.size(); ++i) {
         if (indexOf(other.elements[i]) < 0) {
@@ -124,7 +124,7 @@ class U_COMMON_API UVector : public UObject {
     // java.util.Vector API
     //------------------------------------------------------------
 
-    void addElement(void* obj, UErrorCode &status);
+    inline void addElement(void* obj, UErrorCode &status);
 
     void addElement(int32_t elem, UErrorCode &status);
 
@@ -136,9 +136,9 @@ class U_COMMON_API UVector : public UObject {
 
     void insertElementAt(int32_t elem, int32_t index, UErrorCode &status);
     
-    void* elementAt(int32_t index) const;
+    inline void* elementAt(int32_t index) const;
 
-    int32_t elementAti(int32_t index) const;
+    inline int32_t elementAti(int32_t index) const;
 
     UBool equals(const UVector &other) const;
 
@@ -350,6 +350,20 @@ class U_COMMON_API UStack : public UVector {
 
 // UVector inlines
 
+inline void UVector::addElement(void* obj, UErrorCode &status) {
+    if (count < capacity || ensureCapacity(count + 1, status)) {
+        elements[count++].pointer = obj;
+    }
+}
+
+inline void* UVector::elementAt(int32_t index) const {
+    return (0 <= index && index < count) ? elements[index].pointer : 0;
+}
+
+inline int32_t UVector::elementAti(int32_t index) const {
+    return (0 <= index && index < count) ? elements[index].integer : 0;
+}
+
 inline int32_t UVector::size(void) const {
     return count;
 }
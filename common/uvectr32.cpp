@@ -95,13 +95,6 @@ UBool UVector32::operator==(const UVector32& other) {
 }
 
 
-void UVector32::setElementAt(int32_t elem, int32_t index) {
-    if (0 <= index && index < count) {
-        elements[index] = elem;
-    }
-    /* else index out of range */
-}
-
 void UVector32::insertElementAt(int32_t elem, int32_t index, UErrorCode &status) {
     // must have 0 <= index <= count
     if (0 <= index && index <= count && ensureCapacity(count + 1, status)) {
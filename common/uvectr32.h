@@ -99,7 +99,7 @@ class U_COMMON_API UVector32 : public UObject {
 
     void addElement(int32_t elem, UErrorCode &status);
 
-    void setElementAt(int32_t elem, int32_t index);
+    inline void setElementAt(int32_t elem, int32_t index);
 
     void insertElementAt(int32_t elem, int32_t index, UErrorCode &status);
     
@@ -220,6 +220,13 @@ inline UBool UVector32::ensureCapacity(int32_t minimumCapacity, UErrorCode &stat
     }
 }
 
+inline void UVector32::setElementAt(int32_t elem, int32_t index) {
+    if (0 <= index && index < count) {
+        elements[index] = elem;
+    }
+    /* else index out of range */
+}
+
 inline int32_t UVector32::elementAti(int32_t index) const {
     return (index >= 0 && count > 0 && count - index > 0) ? elements[index] : 0;
 }
@@ -27,7 +27,9 @@ UVector64::UVector64(UErrorCode &status) :
     count(0),
     capacity(0),
     maxCapacity(0),
-    elements(NULL)
+    elements(NULL),
+    isExternal(FALSE),
+    allocationCount(0)
 {
     _init(DEFAULT_CAPACITY, status);
 }
@@ -36,7 +38,9 @@ UVector64::UVector64(int32_t initialCapacity, UErrorCode &status) :
     count(0),
     capacity(0),
     maxCapacity(0),
-    elements(0)
+    elements(NULL),
+    isExternal(FALSE),
+    allocationCount(0)
 {
     _init(initialCapacity, status);
 }
@@ -59,11 +63,14 @@ void UVector64::_init(int32_t initialCapacity, UErrorCode &status) {
         status = U_MEMORY_ALLOCATION_ERROR;
     } else {
         capacity = initialCapacity;
+        ++allocationCount;
     }
 }
 
 UVector64::~UVector64() {
-    uprv_free(elements);
+    if (!isExternal) {
+        uprv_free(elements);
+    }
     elements = 0;
 }
 
@@ -92,13 +99,6 @@ UBool UVector64::operator==(const UVector64& other) {
 }
 
 
-void UVector64::setElementAt(int64_t elem, int32_t index) {
-    if (0 <= index && index < count) {
-        elements[index] = elem;
-    }
-    /* else index out of range */
-}
-
 void UVector64::insertElementAt(int64_t elem, int32_t index, UErrorCode &status) {
     // must have 0 <= index <= count
     if (0 <= index && index <= count && ensureCapacity(count + 1, status)) {
@@ -154,6 +154,7 @@ UBool UVector64::expandCapacity(int32_t minimumCapacity, UErrorCode &status) {
     }
     elements = newElems;
     capacity = newCap;
+    ++allocationCount;
     return TRUE;
 }
 
@@ -166,6 +167,10 @@ void UVector64::setMaxCapacity(int32_t limit) {
         //  Something is very wrong, don't realloc, leave capacity and maxCapacity unchanged
         return;
     }
+    if (isExternal) {
+        // The capacity of a caller's buffer is fixed.
+        return;
+    }
     maxCapacity = limit;
     if (capacity <= maxCapacity || maxCapacity == 0) {
         // Current capacity is within the new limit.
@@ -182,11 +187,40 @@ void UVector64::setMaxCapacity(int32_t limit) {
     }
     elements = newElems;
     capacity = maxCapacity;
+    ++allocationCount;
     if (count > capacity) {
         count = capacity;
     }
 }
 
+void UVector64::setBuffer(int64_t *buffer, int32_t bufferCapacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (buffer != NULL && bufferCapacity <= 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (buffer == NULL) {
+        if (!isExternal) {
+            maxCapacity = 0;
+            return;
+        }
+        elements = NULL;
+        count = capacity = maxCapacity = 0;
+        isExternal = FALSE;
+        _init(DEFAULT_CAPACITY, status);
+        return;
+    }
+    if (!isExternal) {
+        uprv_free(elements);
+    }
+    elements = buffer;
+    count = 0;
+    capacity = maxCapacity = bufferCapacity;
+    isExternal = TRUE;
+}
+
 /**
  * Change the size of this vector as follows: If newSize is smaller,
  * then truncate the array, possibly deleting held elements for i >=
@@ -67,6 +67,10 @@ class U_COMMON_API UVector64 : public UObject {
 
     int64_t*  elements;
 
+    UBool     isExternal;    // elements is a caller's buffer, not owned by this vector.
+
+    int32_t   allocationCount;   // Number of successful heap (re)allocations of elements.
+
 public:
     UVector64(UErrorCode &status);
 
@@ -98,7 +102,7 @@ class U_COMMON_API UVector64 : public UObject {
 
     void addElement(int64_t elem, UErrorCode &status);
 
-    void setElementAt(int64_t elem, int32_t index);
+    inline void setElementAt(int64_t elem, int32_t index);
 
     void insertElementAt(int64_t elem, int32_t index, UErrorCode &status);
     
@@ -162,6 +166,22 @@ class U_COMMON_API UVector64 : public UObject {
      */
     void setMaxCapacity(int32_t limit);
 
+    /**
+     * Use a caller-provided buffer for the elements, instead of heap memory.
+     * The vector is emptied, and its capacity and maximum capacity become the
+     * buffer capacity; the buffer is never reallocated or freed, and must
+     * outlive the vector or the next call to setBuffer().
+     * A NULL buffer returns the vector to heap memory without a capacity limit.
+     * Units are vector elements (64 bits each), not bytes.
+     */
+    void setBuffer(int64_t *buffer, int32_t bufferCapacity, UErrorCode &status);
+
+    /**
+     * Returns the number of times that heap memory has been allocated or
+     * reallocated for the elements since the vector was constructed.
+     */
+    inline int32_t getAllocationCount() const { return allocationCount; }
+
     /**
      * ICU "poor man's RTTI", returns a UClassID for this class.
      */
@@ -209,6 +229,13 @@ inline UBool UVector64::ensureCapacity(int32_t minimumCapacity, UErrorCode &stat
     }
 }
 
+inline void UVector64::setElementAt(int64_t elem, int32_t index) {
+    if (0 <= index && index < count) {
+        elements[index] = elem;
+    }
+    /* else index out of range */
+}
+
 inline int64_t UVector64::elementAti(int32_t index) const {
     return (0 <= index && index < count) ? elements[index] : 0;
 }
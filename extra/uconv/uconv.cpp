@@ -28,6 +28,7 @@
 #include <unicode/translit.h>
 #include <unicode/uset.h>
 #include <unicode/uclean.h>
+#include <unicode/utf8.h>
 #include <unicode/utf16.h>
 
 #include <stdio.h>
@@ -61,6 +62,23 @@ U_NAMESPACE_USE
 #endif
 #endif
 
+// Regular input files are mapped into memory rather than read into a buffer,
+// which also allows converting them in parallel pieces.
+#if U_PLATFORM_IMPLEMENTS_POSIX && !U_PLATFORM_USES_ONLY_WIN32_API
+#define UCONV_HAVE_MMAP 1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#else
+#define UCONV_HAVE_MMAP 0
+#endif
+
 #ifdef UCONVMSG_LINK
 /* below from the README */
 #include "unicode/utypes.h"
@@ -69,6 +87,7 @@ U_CFUNC char uconvmsg_dat[];
 #endif
 
 #define DEFAULT_BUFSZ   4096
+#define OUTPUT_BUFSZ    (1024 * 1024)
 #define UCONVMSG "uconvmsg"
 
 static UResourceBundle *gBundle = 0;    /* Bundle containing messages. */
@@ -531,11 +550,207 @@ cnvSigType(UConverter *cnv) {
     return result;
 }
 
+#if UCONV_HAVE_MMAP
+
+// Number of input bytes that are converted by one thread at a time with --jobs.
+static const size_t PIECE_SIZE = 1024 * 1024;
+
+// Is this a converter that keeps no state from one character to the next,
+// and whose character boundaries can be found from the bytes alone?
+// Input in such an encoding can be split at any character boundary,
+// and the pieces be converted independently of each other.
+static UBool
+isSplittable(const UConverter *cnv) {
+    switch (ucnv_getType(cnv)) {
+    case UCNV_SBCS:
+    case UCNV_LATIN_1:
+    case UCNV_US_ASCII:
+    case UCNV_UTF8:
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian:
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+// Returns the first character boundary at or after index,
+// or length if there is none before the end of the input.
+static size_t
+nextCharBoundary(UConverterType type, const uint8_t *bytes, size_t length, size_t index) {
+    switch (type) {
+    case UCNV_UTF8:
+        while (index < length && U8_IS_TRAIL(bytes[index])) {
+            ++index;
+        }
+        break;
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian:
+        index = (index + 1) & ~(size_t)1;
+        if (index + 1 < length) {
+            // do not split a surrogate pair
+            UChar unit = type == UCNV_UTF16_BigEndian ?
+                (UChar)((bytes[index] << 8) | bytes[index + 1]) :
+                (UChar)((bytes[index + 1] << 8) | bytes[index]);
+            if (U16_IS_TRAIL(unit)) {
+                index += 2;
+            }
+        }
+        break;
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+        index = (index + 3) & ~(size_t)3;
+        break;
+    default:
+        break;
+    }
+    return index < length ? index : length;
+}
+
+// Converts one piece of input with reset converters.
+// Returns FALSE if the conversion stopped at invalid or unmappable input.
+static UBool
+convertPiece(UConverter *convfrom, UConverter *convto,
+             const char *source, const char *sourceLimit,
+             std::string &output) {
+    UChar pivot[1024];
+    UChar *pivotSource = pivot, *pivotTarget = pivot;
+    char outbuf[16384];
+    UBool reset = TRUE;
+    UErrorCode err;
+
+    output.clear();
+    do {
+        char *target = outbuf;
+        err = U_ZERO_ERROR;
+        ucnv_convertEx(convto, convfrom, &target, outbuf + sizeof(outbuf),
+                       &source, sourceLimit,
+                       pivot, &pivotSource, &pivotTarget, pivot + UPRV_LENGTHOF(pivot),
+                       reset, TRUE, &err);
+        output.append(outbuf, target - outbuf);
+        reset = FALSE;
+    } while (err == U_BUFFER_OVERFLOW_ERROR);
+    return (UBool)U_SUCCESS(err);
+}
+
+// Converts the pieces of mapped input between the given boundaries
+// on worker threads, and writes their output in order.
+// The workers convert at most a window of pieces ahead of the writer,
+// which bounds the memory for the output that is not written yet.
+class ParallelConversion {
+public:
+    ParallelConversion(const char *input, const std::vector<size_t> &bounds, size_t window) :
+        input(input), bounds(bounds), pieces(window),
+        next(0), written(0), stopped(FALSE) {}
+
+    // Worker thread function: converts pieces with clones of the converters.
+    void work(const UConverter *convfrom, const UConverter *convto);
+
+    // Writes the output of the pieces in order until all are written,
+    // a piece could not be converted, or writing fails.
+    // Sets index to that of the first piece that was not written, and
+    // returns FALSE if writing failed.
+    UBool write(FILE *outfile, size_t &index);
+
+private:
+    struct Piece {
+        Piece() : state(PENDING) {}
+
+        std::string output;
+        enum { PENDING, CONVERTED, FAILED } state;
+    };
+
+    const char *input;
+    const std::vector<size_t> &bounds;
+    std::vector<Piece> pieces;  // piece i is converted into pieces[i % window]
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    size_t next;                // the next piece to be converted
+    size_t written;             // number of pieces written
+    UBool stopped;
+};
+
+void
+ParallelConversion::work(const UConverter *convfrom, const UConverter *convto) {
+    UErrorCode err = U_ZERO_ERROR;
+    UConverter *from = ucnv_safeClone(convfrom, NULL, NULL, &err);
+    UConverter *to = ucnv_safeClone(convto, NULL, NULL, &err);
+    size_t count = bounds.size() - 1;
+
+    for (;;) {
+        size_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [&] {
+                return stopped || next >= count || next < written + pieces.size();
+            });
+            if (stopped || next >= count) {
+                break;
+            }
+            index = next++;
+        }
+
+        // If the converters could not be cloned, then the writer
+        // falls back to the serial conversion at the first piece.
+        Piece &piece = pieces[index % pieces.size()];
+        UBool ok = U_SUCCESS(err) &&
+            convertPiece(from, to, input + bounds[index], input + bounds[index + 1], piece.output);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            piece.state = ok ? Piece::CONVERTED : Piece::FAILED;
+        }
+        changed.notify_all();
+    }
+
+    ucnv_close(from);
+    ucnv_close(to);
+}
+
+UBool
+ParallelConversion::write(FILE *outfile, size_t &index) {
+    size_t count = bounds.size() - 1;
+    UBool ok = TRUE;
+
+    for (index = 0; index < count; ++index) {
+        Piece &piece = pieces[index % pieces.size()];
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [&] { return piece.state != Piece::PENDING; });
+        }
+        if (piece.state == Piece::FAILED) {
+            break;
+        }
+        size_t length = piece.output.length();
+        if (fwrite(piece.output.data(), 1, length, outfile) != length) {
+            ok = FALSE;
+            break;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            piece.state = Piece::PENDING;
+            ++written;
+        }
+        changed.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopped = TRUE;
+    }
+    changed.notify_all();
+    return ok;
+}
+
+#endif
+
 class ConvertFile {
 public:
     ConvertFile() :
         buf(NULL), outbuf(NULL), fromoffsets(NULL),
-        bufsz(0), signature(0) {}
+        bufsz(0), signature(0), jobs(1) {}
 
     void
     setBufferSize(size_t bufferSize) {
@@ -572,6 +787,7 @@ class ConvertFile {
 
     size_t bufsz;
     int8_t signature; // add (1) or remove (-1) a U+FEFF Unicode signature character
+    int32_t jobs;     // number of threads for converting a mapped input file
 };
 
 // Convert a file from one encoding to another
@@ -595,9 +811,13 @@ ConvertFile::convertFile(const char *pname,
     UErrorCode err = U_ZERO_ERROR;
     UBool flush;
     UBool closeFile = FALSE;
-    const char *cbufp, *prevbufp;
+    const char *inbuf, *cbufp, *prevbufp;
     char *bufp;
 
+    // The input file mapped into memory, if possible; read with fread() otherwise.
+    const char *mapping = NULL;
+    size_t mapLength = 0, mappos = 0;
+
     uint32_t infoffset = 0, outfoffset = 0;   /* Where we are in the file, for error reporting. */
 
     const UChar *unibuf, *unibufbp;
@@ -631,6 +851,21 @@ ConvertFile::convertFile(const char *pname,
             return FALSE;
         }
         closeFile = TRUE;
+
+#if UCONV_HAVE_MMAP
+        struct stat st;
+        if (fstat(fileno(infile), &st) == 0 && S_ISREG(st.st_mode) &&
+                st.st_size > 0 && (uint64_t)st.st_size <= (uint64_t)SIZE_MAX) {
+            void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fileno(infile), 0);
+            if (p != MAP_FAILED) {
+                mapping = (const char *)p;
+                mapLength = (size_t)st.st_size;
+#ifdef MADV_SEQUENTIAL
+                madvise(p, mapLength, MADV_SEQUENTIAL);
+#endif
+            }
+        }
+#endif
     } else {
         infilestr = "-";
         infile = stdin;
@@ -728,6 +963,52 @@ ConvertFile::convertFile(const char *pname,
     UBool willexit, fromSawEndOfBytes, toSawEndOfUnicode;
     int8_t sig;
 
+#if UCONV_HAVE_MMAP
+    // Convert pieces of the input on several threads if their output
+    // is the same as that of converting all of the input at once.
+    // The offsets are needed only for error messages; there are none without
+    // a transliterator or signature handling.
+    if (jobs > 1 && mapLength > PIECE_SIZE && useOffsets && signature == 0 &&
+            isSplittable(convfrom) && isSplittable(convto)) {
+        UConverterType fromType = ucnv_getType(convfrom);
+        std::vector<size_t> bounds;
+        bounds.push_back(0);
+        while (bounds.back() < mapLength) {
+            bounds.push_back(nextCharBoundary(fromType, (const uint8_t *)mapping,
+                                              mapLength, bounds.back() + PIECE_SIZE));
+        }
+
+        ParallelConversion conversion(mapping, bounds, 2 * (size_t)jobs);
+        std::vector<std::thread> threads;
+        for (int32_t i = 0; i < jobs && i < (int32_t)bounds.size() - 1; ++i) {
+            try {
+                threads.push_back(std::thread(&ParallelConversion::work, &conversion, convfrom, convto));
+            } catch (const std::system_error &) {
+                break;
+            }
+        }
+
+        if (!threads.empty()) {
+            size_t index;
+            UBool written = conversion.write(outfile, index);
+            for (size_t i = 0; i < threads.size(); ++i) {
+                threads[i].join();
+            }
+            if (!written) {
+                UnicodeString str(strerror(errno));
+                initMsg(pname);
+                u_wmsg(stderr, "cantWrite", str.getTerminatedBuffer());
+                goto error_exit;
+            }
+
+            // Continue serially with the first piece that was not written:
+            // It has invalid or unmappable input, which is reported there.
+            mappos = bounds[index];
+            infoffset = (uint32_t)mappos;
+        }
+    }
+#endif
+
     // OK, we can convert now.
     sig = signature;
     rd = 0;
@@ -738,12 +1019,19 @@ ConvertFile::convertFile(const char *pname,
         // input file offset at the beginning of the next buffer
         infoffset += rd;
 
-        rd = fread(buf, 1, bufsz, infile);
-        if (ferror(infile) != 0) {
-            UnicodeString str(strerror(errno));
-            initMsg(pname);
-            u_wmsg(stderr, "cantRead", str.getTerminatedBuffer());
-            goto error_exit;
+        if (mapping != NULL) {
+            inbuf = mapping + mappos;
+            rd = mapLength - mappos < bufsz ? mapLength - mappos : bufsz;
+            mappos += rd;
+        } else {
+            inbuf = buf;
+            rd = fread(buf, 1, bufsz, infile);
+            if (ferror(infile) != 0) {
+                UnicodeString str(strerror(errno));
+                initMsg(pname);
+                u_wmsg(stderr, "cantRead", str.getTerminatedBuffer());
+                goto error_exit;
+            }
         }
 
         // Convert the read buffer into the new encoding via Unicode.
@@ -757,7 +1045,7 @@ ConvertFile::convertFile(const char *pname,
         // The converter must be flushed at the end of conversion so
         // that characters on hold also will be written.
 
-        cbufp = buf;
+        cbufp = inbuf;
         flush = (UBool)(rd != bufsz);
 
         // convert until the input is consumed
@@ -770,7 +1058,7 @@ ConvertFile::convertFile(const char *pname,
             // Use bufsz instead of u.getCapacity() for the targetLimit
             // so that we don't overflow fromoffsets[].
             ucnv_toUnicode(convfrom, &unibufp, unibuf + bufsz, &cbufp,
-                buf + rd, useOffsets ? fromoffsets : NULL, flush, &err);
+                inbuf + rd, useOffsets ? fromoffsets : NULL, flush, &err);
 
             ulen = (int32_t)(unibufp - unibuf);
             u.releaseBuffer(U_SUCCESS(err) ? ulen : 0);
@@ -805,7 +1093,7 @@ ConvertFile::convertFile(const char *pname,
                 // length of the error bytes
                 length =
                     (int8_t)sprintf(pos, "%d",
-                        (int)(infoffset + (cbufp - buf) - errorLength));
+                        (int)(infoffset + (cbufp - inbuf) - errorLength));
 
                 // output the bytes that caused the error
                 UnicodeString str;
@@ -974,7 +1262,7 @@ ConvertFile::convertFile(const char *pname,
                         // input file offset of the current byte buffer +
                         // byte buffer offset of where the current Unicode buffer is converted from +
                         // fromoffsets[Unicode offset]
-                        ferroffset = infoffset + (prevbufp - buf) + fromoffset;
+                        ferroffset = infoffset + (prevbufp - inbuf) + fromoffset;
                         errtag = "problemCvtFromU";
                     } else {
                         // Do not use fromoffsets if (t != NULL) because the Unicode text may
@@ -1054,6 +1342,11 @@ ConvertFile::convertFile(const char *pname,
     delete t;
 #endif
 
+#if UCONV_HAVE_MMAP
+    if (mapping != NULL) {
+        munmap((void *)mapping, mapLength);
+    }
+#endif
     if (closeFile) {
         fclose(infile);
     }
@@ -1190,6 +1483,19 @@ main(int argc, char **argv)
             } else {
                 usage(pname, 1);
             }
+        } else if (strcmp("-j", *iter) == 0 || !strcmp("--jobs", *iter)) {
+            iter++;
+            if (iter != end) {
+                cf.jobs = atoi(*iter);
+                if (cf.jobs <= 0) {
+                    UnicodeString str(*iter);
+                    initMsg(pname);
+                    u_wmsg(stderr, "badJobCount", str.getTerminatedBuffer());
+                    return 3;
+                }
+            } else {
+                usage(pname, 1);
+            }
         } else if (strcmp("-l", *iter) == 0 || !strcmp("--list", *iter)) {
             if (printTranslits) {
                 usage(pname, 1);
@@ -1343,6 +1649,16 @@ main(int argc, char **argv)
 #endif
     }
 
+    // Buffer the output in large blocks, except on a terminal.
+#if UCONV_HAVE_MMAP
+    UBool bufferOutput = !isatty(fileno(outfile));
+#else
+    UBool bufferOutput = outfile != stdout;
+#endif
+    if (bufferOutput) {
+        setvbuf(outfile, NULL, _IOFBF, OUTPUT_BUFSZ);
+    }
+
     /* Loop again on the arguments to find all the input files, and
     convert them. */
 
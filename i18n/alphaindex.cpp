@@ -125,12 +125,14 @@ int32_t binarySearch(const UVector &list, const UnicodeString &s, const Collator
 // However, we also don't need U_I18N_API because it is not used from outside the i18n library.
 class BucketList : public UObject {
 public:
-    BucketList(UVector *bucketList, UVector *publicBucketList)
+    BucketList(UVector *bucketList, UVector *publicBucketList,
+               const RuleBasedCollator &collatorPrimaryOnly, UErrorCode &errorCode)
             : bucketList_(bucketList), immutableVisibleList_(publicBucketList) {
         int32_t displayIndex = 0;
         for (int32_t i = 0; i < publicBucketList->size(); ++i) {
             getBucket(*publicBucketList, i)->displayIndex_ = displayIndex++;
         }
+        initBoundaryPrimaries(collatorPrimaryOnly, errorCode);
     }
 
     // The virtual destructor must not be inline.
@@ -141,20 +143,47 @@ class BucketList : public UObject {
         return immutableVisibleList_->size();
     }
 
-    int32_t getBucketIndex(const UnicodeString &name, const Collator &collatorPrimaryOnly,
-                           UErrorCode &errorCode) {
+    static uint64_t getPrimaryPrefix(const UnicodeString &name,
+                                     const RuleBasedCollator &collatorPrimaryOnly,
+                                     UErrorCode &errorCode) {
+        UBool isComplete;
+        return collatorPrimaryOnly.internalGetPrimaryPrefix(
+            name.getBuffer(), name.length(), isComplete, errorCode);
+    }
+
+    /**
+     * Returns TRUE if the name sorts at or above the lower boundary of the i-th bucket.
+     * Compares the first primary weights of the name and of the boundary,
+     * and calls the collator only if they are equal but the boundary has more weights.
+     */
+    UBool isAtOrAboveBoundary(const UnicodeString &name, uint64_t namePrimaries, int32_t i,
+                              const RuleBasedCollator &collatorPrimaryOnly,
+                              UErrorCode &errorCode) const {
+        const BoundaryPrimaries &boundary = boundaryPrimaries_[i];
+        if (namePrimaries != boundary.primaries) {
+            return namePrimaries > boundary.primaries;
+        }
+        if (boundary.isComplete) {
+            // The boundary's primary weights are a prefix of the name's.
+            return TRUE;
+        }
+        return collatorPrimaryOnly.compare(
+            name, getBucket(*bucketList_, i)->lowerBoundary_, errorCode) >= 0;
+    }
+
+    int32_t getBucketIndex(const UnicodeString &name, const RuleBasedCollator &collatorPrimaryOnly,
+                           UErrorCode &errorCode) const {
+        uint64_t namePrimaries = getPrimaryPrefix(name, collatorPrimaryOnly, errorCode);
+        if (U_FAILURE(errorCode)) { return 0; }
         // binary search
         int32_t start = 0;
         int32_t limit = bucketList_->size();
         while ((start + 1) < limit) {
             int32_t i = (start + limit) / 2;
-            const AlphabeticIndex::Bucket *bucket = getBucket(*bucketList_, i);
-            UCollationResult nameVsBucket =
-                collatorPrimaryOnly.compare(name, bucket->lowerBoundary_, errorCode);
-            if (nameVsBucket < 0) {
-                limit = i;
-            } else {
+            if (isAtOrAboveBoundary(name, namePrimaries, i, collatorPrimaryOnly, errorCode)) {
                 start = i;
+            } else {
+                limit = i;
             }
         }
         const AlphabeticIndex::Bucket *bucket = getBucket(*bucketList_, start);
@@ -164,10 +193,52 @@ class BucketList : public UObject {
         return bucket->displayIndex_;
     }
 
+    void getBucketIndices(const UnicodeString names[], int32_t count, int32_t indexes[],
+                          const RuleBasedCollator &collatorPrimaryOnly, UErrorCode &errorCode) const {
+        if (U_FAILURE(errorCode)) { return; }
+        if (count < 0 || (count > 0 && (names == NULL || indexes == NULL))) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        for (int32_t i = 0; i < count && U_SUCCESS(errorCode); ++i) {
+            indexes[i] = getBucketIndex(names[i], collatorPrimaryOnly, errorCode);
+        }
+    }
+
     /** All of the buckets, visible and invisible. */
     UVector *bucketList_;
     /** Just the visible buckets. */
     UVector *immutableVisibleList_;
+
+private:
+    struct BoundaryPrimaries {
+        /** getPrimaryPrefix() of the bucket's lower boundary. */
+        uint64_t primaries;
+        /**
+         * TRUE if the boundary has no further primary weights
+         * and there is no case level that could make an equal-primary name sort lower.
+         */
+        UBool isComplete;
+    };
+
+    void initBoundaryPrimaries(const RuleBasedCollator &collatorPrimaryOnly, UErrorCode &errorCode) {
+        UBool caseLevel = collatorPrimaryOnly.getAttribute(UCOL_CASE_LEVEL, errorCode) == UCOL_ON;
+        if (U_FAILURE(errorCode)) { return; }
+        int32_t size = bucketList_->size();
+        if (boundaryPrimaries_.allocateInsteadAndReset(size) == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        for (int32_t i = 0; i < size; ++i) {
+            const UnicodeString &boundary = getBucket(*bucketList_, i)->lowerBoundary_;
+            UBool isComplete;
+            boundaryPrimaries_[i].primaries = collatorPrimaryOnly.internalGetPrimaryPrefix(
+                boundary.getBuffer(), boundary.length(), isComplete, errorCode);
+            boundaryPrimaries_[i].isComplete = isComplete && !caseLevel;
+        }
+    }
+
+    LocalMemory<BoundaryPrimaries> boundaryPrimaries_;
 };
 
 BucketList::~BucketList() {
@@ -193,6 +264,13 @@ AlphabeticIndex::ImmutableIndex::getBucketIndex(
     return buckets_->getBucketIndex(name, *collatorPrimaryOnly_, errorCode);
 }
 
+void
+AlphabeticIndex::ImmutableIndex::getBucketIndices(
+        const UnicodeString names[], int32_t count, int32_t indexes[],
+        UErrorCode &errorCode) const {
+    buckets_->getBucketIndices(names, count, indexes, *collatorPrimaryOnly_, errorCode);
+}
+
 const AlphabeticIndex::Bucket *
 AlphabeticIndex::ImmutableIndex::getBucket(int32_t index) const {
     if (0 <= index && index < buckets_->getBucketCount()) {
@@ -544,12 +622,17 @@ BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
     if (U_FAILURE(errorCode)) { return NULL; }
     if (bucketList->size() == 1) {
         // No real labels, show only the underflow label.
-        BucketList *bl = new BucketList(bucketList.getAlias(), bucketList.getAlias());
+        BucketList *bl = new BucketList(bucketList.getAlias(), bucketList.getAlias(),
+                                        *collatorPrimaryOnly_, errorCode);
         if (bl == NULL) {
             errorCode = U_MEMORY_ALLOCATION_ERROR;
             return NULL;
         }
         bucketList.orphan();
+        if (U_FAILURE(errorCode)) {
+            delete bl;
+            return NULL;
+        }
         return bl;
     }
     // overflow bucket
@@ -576,12 +659,17 @@ BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
 
     if (U_FAILURE(errorCode)) { return NULL; }
     if (!hasInvisibleBuckets) {
-        BucketList *bl = new BucketList(bucketList.getAlias(), bucketList.getAlias());
+        BucketList *bl = new BucketList(bucketList.getAlias(), bucketList.getAlias(),
+                                        *collatorPrimaryOnly_, errorCode);
         if (bl == NULL) {
             errorCode = U_MEMORY_ALLOCATION_ERROR;
             return NULL;
         }
         bucketList.orphan();
+        if (U_FAILURE(errorCode)) {
+            delete bl;
+            return NULL;
+        }
         return bl;
     }
     // Merge inflow buckets that are visually adjacent.
@@ -615,13 +703,18 @@ BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
         }
     }
     if (U_FAILURE(errorCode)) { return NULL; }
-    BucketList *bl = new BucketList(bucketList.getAlias(), publicBucketList.getAlias());
+    BucketList *bl = new BucketList(bucketList.getAlias(), publicBucketList.getAlias(),
+                                    *collatorPrimaryOnly_, errorCode);
     if (bl == NULL) {
         errorCode = U_MEMORY_ALLOCATION_ERROR;
         return NULL;
     }
     bucketList.orphan();
     publicBucketList.orphan();
+    if (U_FAILURE(errorCode)) {
+        delete bl;
+        return NULL;
+    }
     return bl;
 }
 
@@ -647,30 +740,23 @@ void AlphabeticIndex::initBuckets(UErrorCode &errorCode) {
     // However, if the user adds an item at a time and then gets the buckets, this isn't efficient, so
     // we need to improve it for that case.
 
+    // The record names are compared with the bucket boundaries
+    // via their first primary weights; see BucketList::isAtOrAboveBoundary().
     Bucket *currentBucket = getBucket(*buckets_->bucketList_, 0);
-    int32_t bucketIndex = 1;
-    Bucket *nextBucket;
-    const UnicodeString *upperBoundary;
-    if (bucketIndex < buckets_->bucketList_->size()) {
-        nextBucket = getBucket(*buckets_->bucketList_, bucketIndex++);
-        upperBoundary = &nextBucket->lowerBoundary_;
-    } else {
-        nextBucket = NULL;
-        upperBoundary = NULL;
-    }
+    int32_t bucketCount = buckets_->bucketList_->size();
+    int32_t nextBucketIndex = 1;
     for (int32_t i = 0; i < inputList_->size(); ++i) {
         Record *r = getRecord(*inputList_, i);
         // if the current bucket isn't the right one, find the one that is
         // We have a special flag for the last bucket so that we don't look any further
-        while (upperBoundary != NULL &&
-                collatorPrimaryOnly_->compare(r->name_, *upperBoundary, errorCode) >= 0) {
-            currentBucket = nextBucket;
-            // now reset the boundary that we compare against
-            if (bucketIndex < buckets_->bucketList_->size()) {
-                nextBucket = getBucket(*buckets_->bucketList_, bucketIndex++);
-                upperBoundary = &nextBucket->lowerBoundary_;
-            } else {
-                upperBoundary = NULL;
+        if (nextBucketIndex < bucketCount) {
+            uint64_t namePrimaries =
+                BucketList::getPrimaryPrefix(r->name_, *collatorPrimaryOnly_, errorCode);
+            if (U_FAILURE(errorCode)) { return; }
+            while (nextBucketIndex < bucketCount &&
+                    buckets_->isAtOrAboveBoundary(r->name_, namePrimaries, nextBucketIndex,
+                                                  *collatorPrimaryOnly_, errorCode)) {
+                currentBucket = getBucket(*buckets_->bucketList_, nextBucketIndex++);
             }
         }
         // now put the record into the bucket.
@@ -1105,6 +1191,15 @@ int32_t AlphabeticIndex::getBucketIndex(const UnicodeString &name, UErrorCode &s
     return buckets_->getBucketIndex(name, *collatorPrimaryOnly_, status);
 }
 
+void AlphabeticIndex::getBucketIndices(const UnicodeString names[], int32_t count,
+                                       int32_t indexes[], UErrorCode &status) {
+    initBuckets(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    buckets_->getBucketIndices(names, count, indexes, *collatorPrimaryOnly_, status);
+}
+
 
 int32_t AlphabeticIndex::getBucketIndex() const {
     return labelsIterIndex_;
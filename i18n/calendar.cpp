@@ -2212,6 +2212,32 @@ void Calendar::add(UCalendarDateFields field, int32_t amount, UErrorCode& status
     int32_t prevOffset = 0;
     int32_t prevWallTime = 0;
     if (keepWallTimeInvariant) {
+        // Fast path: If the UTC offset is the same before and after the
+        // add, then the wall time cannot have changed. Compare the offsets
+        // alone rather than computing all of the fields for the new time.
+        UDate t = getTimeInMillis(status);
+        UDate newTime = t + delta;
+        if (U_FAILURE(status)) {
+            return;
+        }
+        if (newTime >= MIN_MILLIS && newTime <= MAX_MILLIS) {
+            int32_t rawOffset, dstOffset;
+            const TimeZone& zone = getTimeZone();
+            if (fAreFieldsSet) {
+                prevOffset = internalGet(UCAL_DST_OFFSET) + internalGet(UCAL_ZONE_OFFSET);
+            } else {
+                zone.getOffset(t, FALSE, rawOffset, dstOffset, status);
+                prevOffset = rawOffset + dstOffset;
+            }
+            zone.getOffset(newTime, FALSE, rawOffset, dstOffset, status);
+            if (U_FAILURE(status)) {
+                return;
+            }
+            if (rawOffset + dstOffset == prevOffset) {
+                setTimeInMillis(newTime, status);
+                return;
+            }
+        }
         prevOffset = get(UCAL_DST_OFFSET, status) + get(UCAL_ZONE_OFFSET, status);
         prevWallTime = get(UCAL_MILLISECONDS_IN_DAY, status);
     }
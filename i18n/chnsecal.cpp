@@ -26,6 +26,7 @@
 #include "unicode/simpletz.h"
 #include "uhash.h"
 #include "ucln_in.h"
+#include "cmemory.h"
 
 // Debugging
 #ifdef U_DEBUG_CHNSECAL
@@ -83,6 +84,65 @@ static const int32_t CHINA_OFFSET = 8 * kOneHour;
  */
 static const int32_t SYNODIC_GAP = 25;
 
+/*
+ * Precomputed astronomical data for the Gregorian years 1900..2100,
+ * relative to CHINA_OFFSET.
+ * The values are the results of the CalendarAstronomer computations further below,
+ * at each day in that range, so using the tables does not change any result.
+ * Looking up a table avoids the astroLock and the mutex of the CalendarCache.
+ */
+// Winter solstices, as days of December, for the Gregorian years 1899..2101.
+static const int32_t CHINESE_TABLE_SOLSTICE_YEAR_START = 1899;
+static const int32_t CHINESE_TABLE_SOLSTICE_YEAR_END = 2101;
+static const uint8_t CHINESE_WINTER_SOLSTICE_DAY[] = {
+    /* 1899 */ 22, 22, 22, 23, 23, 22, 22, 23, 23, 22, 22, 23, 23, 22, 22, 23, 23, 22, 22, 23,
+    /* 1919 */ 23, 22, 22, 22, 23, 22, 22, 22, 23, 22, 22, 22, 23, 22, 22, 22, 23, 22, 22, 22,
+    /* 1939 */ 23, 22, 22, 22, 23, 22, 22, 22, 23, 22, 22, 22, 23, 22, 22, 22, 22, 22, 22, 22,
+    /* 1959 */ 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    /* 1979 */ 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 22, 22, 22, 21, 22, 22, 22, 21, 22, 22,
+    /* 1999 */ 22, 21, 22, 22, 22, 21, 22, 22, 22, 21, 22, 22, 22, 21, 22, 22, 22, 21, 21, 22,
+    /* 2019 */ 22, 21, 21, 22, 22, 21, 21, 22, 22, 21, 21, 22, 22, 21, 21, 22, 22, 21, 21, 22,
+    /* 2039 */ 22, 21, 21, 22, 22, 21, 21, 22, 22, 21, 21, 21, 22, 21, 21, 21, 22, 21, 21, 21,
+    /* 2059 */ 22, 21, 21, 21, 22, 21, 21, 21, 22, 21, 21, 21, 22, 21, 21, 21, 22, 21, 21, 21,
+    /* 2079 */ 22, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    /* 2099 */ 21, 22, 22,
+};
+
+static const int32_t CHINESE_TABLE_FIRST_NEW_MOON = -25626;
+static const int32_t CHINESE_TABLE_NEW_MOON_COUNT = 2503;
+static const uint16_t CHINESE_MONTH_LENGTHS[] = {
+    0xA96D, 0x4AEA, 0x5752, 0x6E93, 0x6CAB, 0x5555, 0xAA6B, 0x52BA, 0x95D4, 0x9BA4,
+    0xDD25, 0xD52D, 0xAA6B, 0x54B6, 0xA56D, 0x26E9, 0x2F49, 0x764B, 0x6A56, 0xD4AD,
+    0xA95B, 0x4ABA, 0x4BD2, 0x5D92, 0xDA95, 0xD4AD, 0xA95A, 0xD2B6, 0x9374, 0x9764,
+    0xB725, 0x752B, 0x6956, 0xAAAD, 0x555B, 0x25D9, 0x2DC9, 0x5D4A, 0xDA55, 0xB2AD,
+    0x5556, 0xA9B6, 0x4B72, 0x5752, 0xBA95, 0x74AB, 0x5556, 0xAAAD, 0x52DA, 0x95D4,
+    0xAEA4, 0xDD26, 0xD955, 0xAAAB, 0x54B6, 0xA575, 0x2B69, 0x3749, 0xBA4B, 0xAA5B,
+    0x54B6, 0xA96D, 0x4ADA, 0x4DD2, 0x5E92, 0xEC96, 0xD4AD, 0xA95B, 0x4AB6, 0x9574,
+    0x97A4, 0xBB25, 0xB52B, 0xA95A, 0xCAB5, 0x956D, 0x26E9, 0x2EC9, 0x6D4A, 0xEA56,
+    0xD2AD, 0x555A, 0xAAB6, 0x4BB2, 0x5B92, 0xBA95, 0xB4AB, 0x6556, 0xAAAD, 0x52EA,
+    0x96D4, 0xAEA4, 0xF526, 0xE956, 0xAAAD, 0x54DA, 0xA5B5, 0x2BA9, 0x3D49, 0xBA4D,
+    0xAA5B, 0x54D6, 0xA96D, 0x4AEA, 0x56D2, 0x6E92, 0xF497, 0x54B6, 0xA96B, 0x4ADA,
+    0x95B4, 0x9BA4, 0xBD25, 0xD52D, 0xA95B, 0x4AB6, 0x956D, 0x26E9, 0x2F49, 0x764B,
+    0x6A57, 0x52B5, 0x955B, 0x2ABA, 0x4BB2, 0x5D92, 0xDA95, 0xD4AD, 0xA55A, 0xAAB5,
+    0x536A, 0x9764, 0xB6A5, 0x752B, 0x6956, 0xAAAD, 0x555A, 0xA5D5, 0x2DA9, 0x5D49,
+    0xDA4D, 0xCA6D, 0x555A, 0xA9B5, 0x4B6A, 0x5752, 0x768B, 0x749B, 0x54B6, 0xA9AD,
+    0x4ADA, 0x95D4, 0x9DA2, 0xDD15, 0xD92E, 0xA96B, 0x4800,
+};
+static const uint16_t CHINESE_NO_MAJOR_SOLAR_TERM[] = {
+    11, 45, 81, 116, 145, 181, 216, 245, 281, 316, 351, 380,
+    416, 451, 480, 516, 551, 586, 616, 651, 686, 716, 751, 786,
+    822, 851, 886, 922, 951, 986, 1021, 1052, 1055, 1086, 1121, 1156,
+    1186, 1220, 1256, 1291, 1321, 1356, 1392, 1422, 1456, 1491, 1526, 1555,
+    1591, 1626, 1655, 1659, 1661, 1691, 1727, 1761, 1791, 1826, 1861, 1891,
+    1896, 1926, 1961, 1997, 2026, 2061, 2097, 2126, 2161, 2196, 2232, 2261,
+    2296, 2332, 2361, 2396, 2431, 2466, 2496,
+};
+
+// The days of the new moons, decoded from CHINESE_MONTH_LENGTHS
+// (a 1 bit is a month with 30 days, 0 one with 29 days).
+static int32_t gChineseNewMoons[CHINESE_TABLE_NEW_MOON_COUNT];
+static icu::UInitOnce gChineseNewMoonsInitOnce = U_INITONCE_INITIALIZER;
+
 
 U_CDECL_BEGIN
 static UBool calendar_chinese_cleanup(void) {
@@ -165,6 +225,49 @@ const TimeZone* ChineseCalendar::getChineseCalZoneAstroCalc(void) const {
     return gChineseCalendarZoneAstroCalc;
 }
 
+static void U_CALLCONV initChineseNewMoons() {
+    int32_t day = CHINESE_TABLE_FIRST_NEW_MOON;
+    gChineseNewMoons[0] = day;
+    for (int32_t i = 1; i < CHINESE_TABLE_NEW_MOON_COUNT; ++i) {
+        day += 29 + ((CHINESE_MONTH_LENGTHS[(i - 1) >> 4] >> (15 - ((i - 1) & 15))) & 1);
+        gChineseNewMoons[i] = day;
+    }
+}
+
+/**
+ * Return true if the precomputed tables apply to the given astronomical zone,
+ * which is the case for the Chinese calendar but not for the Dangi calendar.
+ */
+static inline UBool usesChineseTables(const TimeZone *zoneAstroCalc) {
+    return zoneAstroCalc != NULL && zoneAstroCalc == gChineseCalendarZoneAstroCalc;
+}
+
+/**
+ * Return the index in gChineseNewMoons of the new moon on or after the given
+ * date, or the new moon before it, like ChineseCalendar::newMoonNear(),
+ * or -1 if the table does not cover the date.
+ */
+static int32_t findChineseNewMoon(double days, UBool after) {
+    umtx_initOnce(gChineseNewMoonsInitOnce, &initChineseNewMoons);
+    int32_t day = (int32_t)days;
+    if (day != days || day <= gChineseNewMoons[0] ||
+            day > gChineseNewMoons[CHINESE_TABLE_NEW_MOON_COUNT - 1]) {
+        return -1;
+    }
+    // Binary search for the first new moon on or after the day.
+    int32_t start = 1;
+    int32_t limit = CHINESE_TABLE_NEW_MOON_COUNT - 1;
+    while (start < limit) {
+        int32_t mid = (start + limit) / 2;
+        if (gChineseNewMoons[mid] < day) {
+            start = mid + 1;
+        } else {
+            limit = mid;
+        }
+    }
+    return after ? start : start - 1;
+}
+
 //-------------------------------------------------------------------------
 // Minimum / Maximum access functions
 //-------------------------------------------------------------------------
@@ -525,6 +628,12 @@ double ChineseCalendar::millisToDays(double millis) const {
  */
 int32_t ChineseCalendar::winterSolstice(int32_t gyear) const {
 
+    if (CHINESE_TABLE_SOLSTICE_YEAR_START <= gyear && gyear <= CHINESE_TABLE_SOLSTICE_YEAR_END &&
+            usesChineseTables(fZoneAstroCalc)) {
+        return Grego::fieldsToDay(gyear, UCAL_DECEMBER,
+                                  CHINESE_WINTER_SOLSTICE_DAY[gyear - CHINESE_TABLE_SOLSTICE_YEAR_START]);
+    }
+
     UErrorCode status = U_ZERO_ERROR;
     int32_t cacheValue = CalendarCache::get(&gChineseCalendarWinterSolsticeCache, gyear, status);
 
@@ -564,7 +673,14 @@ int32_t ChineseCalendar::winterSolstice(int32_t gyear) const {
  * new moon after or before <code>days</code>
  */
 int32_t ChineseCalendar::newMoonNear(double days, UBool after) const {
-    
+
+    if (usesChineseTables(fZoneAstroCalc)) {
+        int32_t index = findChineseNewMoon(days, after);
+        if (index >= 0) {
+            return gChineseNewMoons[index];
+        }
+    }
+
     umtx_lock(&astroLock);
     if(gChineseCalendarAstro == NULL) {
         gChineseCalendarAstro = new CalendarAstronomer();
@@ -620,6 +736,23 @@ int32_t ChineseCalendar::majorSolarTerm(int32_t days) const {
  * moon
  */
 UBool ChineseCalendar::hasNoMajorSolarTerm(int32_t newMoon) const {
+    if (usesChineseTables(fZoneAstroCalc)) {
+        int32_t index = findChineseNewMoon(newMoon, TRUE);
+        if (index >= 0 && index < CHINESE_TABLE_NEW_MOON_COUNT - 1 && gChineseNewMoons[index] == newMoon) {
+            int32_t start = 0;
+            int32_t limit = UPRV_LENGTHOF(CHINESE_NO_MAJOR_SOLAR_TERM);
+            while (start < limit) {
+                int32_t mid = (start + limit) / 2;
+                if (CHINESE_NO_MAJOR_SOLAR_TERM[mid] < index) {
+                    start = mid + 1;
+                } else {
+                    limit = mid;
+                }
+            }
+            return start < UPRV_LENGTHOF(CHINESE_NO_MAJOR_SOLAR_TERM) &&
+                CHINESE_NO_MAJOR_SOLAR_TERM[start] == index;
+        }
+    }
     return majorSolarTerm(newMoon) ==
         majorSolarTerm(newMoonNear(newMoon + SYNODIC_GAP, TRUE));
 }
@@ -758,7 +891,11 @@ void ChineseCalendar::computeChineseFields(int32_t days, int32_t gyear, int32_t
  */
 int32_t ChineseCalendar::newYear(int32_t gyear) const {
     UErrorCode status = U_ZERO_ERROR;
-    int32_t cacheValue = CalendarCache::get(&gChineseCalendarNewYearCache, gyear, status);
+    // With the precomputed tables, the new year is computed faster
+    // than it is looked up in the CalendarCache.
+    UBool useTables = CHINESE_TABLE_SOLSTICE_YEAR_START < gyear && gyear <= CHINESE_TABLE_SOLSTICE_YEAR_END &&
+            usesChineseTables(fZoneAstroCalc);
+    int32_t cacheValue = useTables ? 0 : CalendarCache::get(&gChineseCalendarNewYearCache, gyear, status);
 
     if (cacheValue == 0) {
 
@@ -775,7 +912,9 @@ int32_t ChineseCalendar::newYear(int32_t gyear) const {
             cacheValue = newMoon2;
         }
 
-        CalendarCache::put(&gChineseCalendarNewYearCache, gyear, cacheValue, status);
+        if (!useTables) {
+            CalendarCache::put(&gChineseCalendarNewYearCache, gyear, cacheValue, status);
+        }
     }
     if(U_FAILURE(status)) {
         cacheValue = 0;
@@ -49,6 +49,7 @@
 #include "unicode/coll.h"
 #include "unicode/tblcoll.h"
 #include "collationdata.h"
+#include "collationsort.h"
 #include "collationroot.h"
 #include "collationtailoring.h"
 #include "ucol_imp.h"
@@ -431,6 +432,7 @@ Collator* U_EXPORT2 Collator::createInstance(UErrorCode& success)
 Collator* U_EXPORT2 Collator::createInstance(const Locale& desiredLocale,
                                    UErrorCode& status)
 {
+    MemoryTagScope memoryTag(UMEM_TAG_COLLATION);
     if (U_FAILURE(status)) 
         return 0;
     if (desiredLocale.isBogus()) {
@@ -537,6 +539,12 @@ UCollationResult Collator::compareUTF8(const StringPiece &source,
     return compare(sIter, tIter, status);
 }
 
+CollationKey &Collator::getCollationKeyUTF8(const StringPiece &source,
+                                            CollationKey &key,
+                                            UErrorCode &status) const {
+    return getCollationKey(UnicodeString::fromUTF8(source), key, status);
+}
+
 UBool Collator::equals(const UnicodeString& source, 
                        const UnicodeString& target) const
 {
@@ -972,6 +980,50 @@ Collator::getEquivalentReorderCodes(int32_t reorderCode,
     return baseData->getEquivalentScripts(reorderCode, dest, capacity, errorCode);
 }
 
+void
+Collator::sort(UnicodeString *strings, int32_t count, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    if(count < 0 || (strings == NULL && count > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if(count <= 1) { return; }
+    LocalMemory<const UChar *> buffers;
+    LocalMemory<int32_t> lengths;
+    LocalMemory<int32_t> indexes;
+    if(buffers.allocateInsteadAndCopy(count) == NULL ||
+            lengths.allocateInsteadAndCopy(count) == NULL ||
+            indexes.allocateInsteadAndCopy(count) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        buffers[i] = strings[i].getBuffer();  // NULL if bogus, and then the length is 0
+        lengths[i] = strings[i].length();
+    }
+    CollationSort::sortIndexes(*this, buffers.getAlias(), lengths.getAlias(), count,
+                               indexes.getAlias(), errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    // Apply the permutation in place, one cycle at a time,
+    // moving the strings with swap() rather than copying them.
+    for(int32_t start = 0; start < count; ++start) {
+        if(indexes[start] < 0 || indexes[start] == start) { continue; }
+        UnicodeString temp;
+        temp.swap(strings[start]);
+        int32_t i = start;
+        for(;;) {
+            int32_t from = indexes[i];
+            indexes[i] = -1;  // done
+            if(from == start) {
+                strings[i].swap(temp);
+                break;
+            }
+            strings[i].swap(strings[from]);
+            i = from;
+        }
+    }
+}
+
 int32_t
 Collator::internalGetShortDefinitionString(const char * /*locale*/,
                                                              char * /*buffer*/,
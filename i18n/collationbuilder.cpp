@@ -46,6 +46,7 @@
 #include "normalizer2impl.h"
 #include "uassert.h"
 #include "ucol_imp.h"
+#include "unifiedcache.h"
 #include "utf16collationiterator.h"
 
 U_NAMESPACE_BEGIN
@@ -72,6 +73,99 @@ BundleImporter::getRules(
     CollationLoader::loadRules(localeID, collationType, rules, errorCode);
 }
 
+/**
+ * Where createObject() reports parse errors while building a tailoring for the cache.
+ */
+struct RulesBuildContext {
+    UParseError *outParseError;
+    UnicodeString *outReason;
+    UBool didBuild;
+};
+
+/**
+ * Cache key for tailorings built from rule strings.
+ * Applications that create collators from the same rules repeatedly,
+ * for example per request, share one tailoring instead of building it each time.
+ */
+class CollationRulesCacheKey : public CacheKey<CollationCacheEntry> {
+public:
+    CollationRulesCacheKey(const UnicodeString &r) : rules(r) {}
+    CollationRulesCacheKey(const CollationRulesCacheKey &other)
+            : CacheKey<CollationCacheEntry>(other), rules(other.rules) {}
+    virtual ~CollationRulesCacheKey();
+
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)CacheKey<CollationCacheEntry>::hashCode() +
+                         (uint32_t)rules.hashCode());
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!CacheKey<CollationCacheEntry>::operator==(other)) {
+            return FALSE;
+        }
+        return rules == static_cast<const CollationRulesCacheKey &>(other).rules;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new CollationRulesCacheKey(*this);
+    }
+    virtual const CollationCacheEntry *createObject(
+            const void *creationContext, UErrorCode &errorCode) const;
+    virtual char *writeDescription(char *buffer, int32_t bufLen) const {
+        uprv_strncpy(buffer, "collation rules", bufLen);
+        buffer[bufLen - 1] = 0;
+        return buffer;
+    }
+
+private:
+    UnicodeString rules;
+};
+
+CollationRulesCacheKey::~CollationRulesCacheKey() {}
+
+CollationTailoring *
+buildTailoring(const UnicodeString &rules,
+               UParseError *outParseError, UnicodeString *outReason,
+               UErrorCode &errorCode) {
+    const CollationTailoring *base = CollationRoot::getRoot(errorCode);
+    if(U_FAILURE(errorCode)) { return NULL; }
+    CollationBuilder builder(base, errorCode);
+    UVersionInfo noVersion = { 0, 0, 0, 0 };
+    BundleImporter importer;
+    LocalPointer<CollationTailoring> t(builder.parseAndBuild(rules, noVersion,
+                                                             &importer,
+                                                             outParseError, errorCode));
+    if(U_FAILURE(errorCode)) {
+        const char *reason = builder.getErrorReason();
+        if(reason != NULL && outReason != NULL) {
+            *outReason = UnicodeString(reason, -1, US_INV);
+        }
+        return NULL;
+    }
+    t->actualLocale.setToBogus();
+    return t.orphan();
+}
+
+const CollationCacheEntry *
+CollationRulesCacheKey::createObject(const void *creationContext, UErrorCode &errorCode) const {
+    RulesBuildContext *context =
+            reinterpret_cast<RulesBuildContext *>(const_cast<void *>(creationContext));
+    context->didBuild = TRUE;
+    CollationTailoring *t =
+            buildTailoring(rules, context->outParseError, context->outReason, errorCode);
+    if(U_FAILURE(errorCode)) { return NULL; }
+    CollationCacheEntry *entry = new CollationCacheEntry(t->actualLocale, t);
+    if(entry == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        t->deleteIfZeroRefCount();
+        return NULL;
+    }
+    // createObject() must return an entry with a reference for the caller.
+    entry->addRef();
+    return entry;
+}
+
 }  // namespace
 
 // RuleBasedCollator implementation ---------------------------------------- ***
@@ -161,24 +255,42 @@ RuleBasedCollator::internalBuildTailoring(const UnicodeString &rules,
                                           UColAttributeValue decompositionMode,
                                           UParseError *outParseError, UnicodeString *outReason,
                                           UErrorCode &errorCode) {
-    const CollationTailoring *base = CollationRoot::getRoot(errorCode);
+    MemoryTagScope memoryTag(UMEM_TAG_COLLATION);
     if(U_FAILURE(errorCode)) { return; }
     if(outReason != NULL) { outReason->remove(); }
-    CollationBuilder builder(base, errorCode);
-    UVersionInfo noVersion = { 0, 0, 0, 0 };
-    BundleImporter importer;
-    LocalPointer<CollationTailoring> t(builder.parseAndBuild(rules, noVersion,
-                                                             &importer,
-                                                             outParseError, errorCode));
+    const UnifiedCache *cache = UnifiedCache::getInstance(errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    // The tailoring depends only on the rules.
+    // The strength and decomposition mode are applied as attributes below.
+    CollationRulesCacheKey key(rules);
+    RulesBuildContext context = { outParseError, outReason, FALSE };
+    const CollationCacheEntry *entry = NULL;
+    cache->get(key, &context, entry, errorCode);
     if(U_FAILURE(errorCode)) {
-        const char *reason = builder.getErrorReason();
-        if(reason != NULL && outReason != NULL) {
-            *outReason = UnicodeString(reason, -1, US_INV);
+        if(context.didBuild || (outParseError == NULL && outReason == NULL)) { return; }
+        // The cache remembers the failure but not its details: Build again for those.
+        errorCode = U_ZERO_ERROR;
+        CollationTailoring *t = buildTailoring(rules, outParseError, outReason, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        adoptTailoring(t, errorCode);
+    } else {
+        if(!context.didBuild && outParseError != NULL) {
+            // Same as the rule parser leaves it after a successful parse.
+            outParseError->line = 0;
+            outParseError->offset = -1;
+            outParseError->preContext[0] = 0;
+            outParseError->postContext[0] = 0;
         }
-        return;
+        // Same as the RuleBasedCollator(const CollationCacheEntry *) constructor,
+        // but cache->get() already added the reference to the entry.
+        data = entry->tailoring->data;
+        settings = entry->tailoring->settings;
+        settings->addRef();
+        tailoring = entry->tailoring;
+        cacheEntry = entry;
+        validLocale = entry->validLocale;
+        actualLocaleIsSameAsValid = FALSE;
     }
-    t->actualLocale.setToBogus();
-    adoptTailoring(t.orphan(), errorCode);
     // Set attributes after building the collator,
     // to keep the default settings consistent with the rule string.
     if(strength != UCOL_DEFAULT) {
@@ -283,7 +283,7 @@ CollationDataBuilder::CollationDataBuilder(UErrorCode &errorCode)
           trie(NULL),
           ce32s(errorCode), ce64s(errorCode), conditionalCE32s(errorCode),
           modified(FALSE),
-          fastLatinEnabled(FALSE), fastLatinBuilder(NULL),
+          fastLatinEnabled(FALSE), fastLatinTailored(FALSE), fastLatinBuilder(NULL),
           collIter(NULL) {
     // Reserve the first CE32 for U+0000.
     ce32s.addElement(0, errorCode);
@@ -525,6 +525,16 @@ CollationDataBuilder::addConditionalCE32(const UnicodeString &context, uint32_t
     return index;
 }
 
+namespace {
+
+inline UBool
+isFastLatinChar(UChar32 c) {
+    return c < CollationFastLatin::LATIN_LIMIT ||
+        (CollationFastLatin::PUNCT_START <= c && c < CollationFastLatin::PUNCT_LIMIT);
+}
+
+}  // namespace
+
 void
 CollationDataBuilder::add(const UnicodeString &prefix, const UnicodeString &s,
                           const int64_t ces[], int32_t cesLength,
@@ -549,6 +559,7 @@ CollationDataBuilder::addCE32(const UnicodeString &prefix, const UnicodeString &
     int32_t cLength = U16_LENGTH(c);
     uint32_t oldCE32 = utrie2_get32(trie, c);
     UBool hasContext = !prefix.isEmpty() || s.length() > cLength;
+    if(isFastLatinChar(c)) { fastLatinTailored = TRUE; }
     if(oldCE32 == Collation::FALLBACK_CE32) {
         // First tailoring for c.
         // If c has contextual base mappings or if we add a contextual mapping,
@@ -1040,6 +1051,7 @@ CollationDataBuilder::copyFrom(const CollationDataBuilder &src, const CEModifier
     // in case a character had conditional mappings in the source builder
     // and they were removed later.
     modified |= src.modified;
+    fastLatinTailored |= src.fastLatinTailored;
 }
 
 void
@@ -1070,6 +1082,7 @@ CollationDataBuilder::suppressContractions(const UnicodeSet &set, UErrorCode &er
             if(Collation::ce32HasContext(ce32)) {
                 ce32 = copyFromBaseCE32(c, ce32, FALSE /* without context */, errorCode);
                 utrie2_set32(trie, c, ce32, &errorCode);
+                if(isFastLatinChar(c)) { fastLatinTailored = TRUE; }
             }
         } else if(isBuilderContextCE32(ce32)) {
             ce32 = getConditionalCE32ForCE32(ce32)->ce32;
@@ -1078,6 +1091,7 @@ CollationDataBuilder::suppressContractions(const UnicodeSet &set, UErrorCode &er
             // eliminating unreachable data.
             utrie2_set32(trie, c, ce32, &errorCode);
             contextChars.remove(c);
+            if(isFastLatinChar(c)) { fastLatinTailored = TRUE; }
         }
     }
     modified = TRUE;
@@ -1481,6 +1495,15 @@ CollationDataBuilder::buildFastLatinTable(CollationData &data, UErrorCode &error
     if(U_FAILURE(errorCode) || !fastLatinEnabled) { return; }
 
     delete fastLatinBuilder;
+    fastLatinBuilder = NULL;
+    if(base != NULL && base->fastLatinTable != NULL && !fastLatinTailored) {
+        // The fast Latin table would be the same as in the base,
+        // for example when only non-Latin characters are tailored.
+        // Use the base table without building a copy.
+        data.fastLatinTable = base->fastLatinTable;
+        data.fastLatinTableLength = base->fastLatinTableLength;
+        return;
+    }
     fastLatinBuilder = new CollationFastLatinBuilder(errorCode);
     if(fastLatinBuilder == NULL) {
         errorCode = U_MEMORY_ALLOCATION_ERROR;
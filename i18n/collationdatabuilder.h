@@ -248,6 +248,11 @@ class U_I18N_API CollationDataBuilder : public UObject {
     UBool modified;
 
     UBool fastLatinEnabled;
+    /**
+     * TRUE if a mapping was added for a character in the fast Latin table.
+     * Mappings that optimize() copies from the base data do not count.
+     */
+    UBool fastLatinTailored;
     CollationFastLatinBuilder *fastLatinBuilder;
 
     DataBuilderCollationIterator *collIter;
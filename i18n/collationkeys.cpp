@@ -198,6 +198,46 @@ UBool SortKeyLevel::ensureCapacity(int32_t appendCapacity) {
     return TRUE;
 }
 
+/**
+ * Appends the bytes for a primary weight, with compression of
+ * runs of the same compressible lead byte.
+ * prevReorderedPrimary is 0 or the previous compressible primary.
+ */
+inline void appendPrimary(uint32_t p, const UBool *compressibleBytes,
+                          const CollationSettings &settings,
+                          uint32_t &prevReorderedPrimary, SortKeyByteSink &sink) {
+    // Test the un-reordered primary for compressibility.
+    UBool isCompressible = compressibleBytes[p >> 24];
+    if(settings.hasReordering()) {
+        p = settings.reorder(p);
+    }
+    uint32_t p1 = p >> 24;
+    if(!isCompressible || p1 != (prevReorderedPrimary >> 24)) {
+        if(prevReorderedPrimary != 0) {
+            if(p < prevReorderedPrimary) {
+                // No primary compression terminator
+                // at the end of the level or merged segment.
+                if(p1 > Collation::MERGE_SEPARATOR_BYTE) {
+                    sink.Append(Collation::PRIMARY_COMPRESSION_LOW_BYTE);
+                }
+            } else {
+                sink.Append(Collation::PRIMARY_COMPRESSION_HIGH_BYTE);
+            }
+        }
+        sink.Append(p1);
+        if(isCompressible) {
+            prevReorderedPrimary = p;
+        } else {
+            prevReorderedPrimary = 0;
+        }
+    }
+    char p2 = (char)(p >> 16);
+    if(p2 != 0) {
+        char buffer[3] = { p2, (char)(p >> 8), (char)p };
+        sink.Append(buffer, (buffer[1] == 0) ? 1 : (buffer[2] == 0) ? 2 : 3);
+    }
+}
+
 }  // namespace
 
 CollationKeys::LevelCallback::~LevelCallback() {}
@@ -306,36 +346,7 @@ CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
         // If ce==NO_CE, then write nothing for the primary level but
         // terminate compression on all levels and then exit the loop.
         if(p > Collation::NO_CE_PRIMARY && (levels & Collation::PRIMARY_LEVEL_FLAG) != 0) {
-            // Test the un-reordered primary for compressibility.
-            UBool isCompressible = compressibleBytes[p >> 24];
-            if(settings.hasReordering()) {
-                p = settings.reorder(p);
-            }
-            uint32_t p1 = p >> 24;
-            if(!isCompressible || p1 != (prevReorderedPrimary >> 24)) {
-                if(prevReorderedPrimary != 0) {
-                    if(p < prevReorderedPrimary) {
-                        // No primary compression terminator
-                        // at the end of the level or merged segment.
-                        if(p1 > Collation::MERGE_SEPARATOR_BYTE) {
-                            sink.Append(Collation::PRIMARY_COMPRESSION_LOW_BYTE);
-                        }
-                    } else {
-                        sink.Append(Collation::PRIMARY_COMPRESSION_HIGH_BYTE);
-                    }
-                }
-                sink.Append(p1);
-                if(isCompressible) {
-                    prevReorderedPrimary = p;
-                } else {
-                    prevReorderedPrimary = 0;
-                }
-            }
-            char p2 = (char)(p >> 16);
-            if(p2 != 0) {
-                char buffer[3] = { p2, (char)(p >> 8), (char)p };
-                sink.Append(buffer, (buffer[1] == 0) ? 1 : (buffer[2] == 0) ? 2 : 3);
-            }
+            appendPrimary(p, compressibleBytes, settings, prevReorderedPrimary, sink);
             // Optimization for internalNextSortKeyPart():
             // When the primary level overflows we can stop because we need not
             // calculate (preflight) the whole sort key length.
@@ -668,6 +679,42 @@ CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
     }
 }
 
+UBool
+CollationKeys::writePrimaryPrefix(CollationIterator &iter,
+                                  const UBool *compressibleBytes,
+                                  const CollationSettings &settings,
+                                  SortKeyByteSink &sink, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return FALSE; }
+
+    uint32_t variableTop;
+    if((settings.options & CollationSettings::ALTERNATE_MASK) == 0) {
+        variableTop = 0;
+    } else {
+        // +1 so that we can use "<" and primary ignorables test out early.
+        variableTop = settings.variableTop + 1;
+    }
+
+    uint32_t prevReorderedPrimary = 0;  // 0==no compression
+    for(;;) {
+        iter.clearCEsIfNoneRemaining();
+        uint32_t p = (uint32_t)(iter.nextCE(errorCode) >> 32);
+        if(p <= Collation::NO_CE_PRIMARY) {
+            if(p == 0) { continue; }  // primary ignorable
+            return FALSE;  // end of the input
+        }
+        if(p < variableTop && p > Collation::MERGE_SEPARATOR_PRIMARY) {
+            continue;  // variable CE, shifted to the quaternary level
+        }
+        appendPrimary(p, compressibleBytes, settings, prevReorderedPrimary, sink);
+        if(sink.Overflowed()) {
+            if(U_SUCCESS(errorCode) && !sink.IsOk()) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+            }
+            return TRUE;
+        }
+    }
+}
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_COLLATION
@@ -113,6 +113,21 @@ class U_I18N_API CollationKeys /* not : public UObject because all methods are s
                                            SortKeyByteSink &sink,
                                            Collation::Level minLevel, LevelCallback &callback,
                                            UBool preflight, UErrorCode &errorCode);
+
+    /**
+     * Writes only the primary level of the sort key,
+     * and stops as soon as the sink overflows.
+     * This is much faster than writeSortKeyUpToQuaternary() for short prefixes
+     * of sort keys because it does not collect the other levels.
+     * @return TRUE if the sink overflowed, that is, if the written bytes
+     *         fill the sink and match the beginning of the full sort key;
+     *         FALSE if the primary level is shorter than the sink
+     *         and the lower levels are needed as well
+     */
+    static UBool writePrimaryPrefix(CollationIterator &iter,
+                                    const UBool *compressibleBytes,
+                                    const CollationSettings &settings,
+                                    SortKeyByteSink &sink, UErrorCode &errorCode);
 private:
     friend struct CollationDataReader;
 
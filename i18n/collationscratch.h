@@ -0,0 +1,72 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// collationscratch.h
+// created: 2026oct14
+
+#ifndef __COLLATIONSCRATCH_H__
+#define __COLLATIONSCRATCH_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/localpointer.h"
+#include "unicode/uobject.h"
+#include "utf16collationiterator.h"
+
+U_NAMESPACE_BEGIN
+
+struct CollationData;
+
+/**
+ * Implements UCollatorScratch:
+ * A pair of UTF-16 collation iterators that are reused for many comparisons.
+ * Their CE buffers, normalization buffers and discontiguous-contraction state
+ * keep their capacities, so that after a few comparisons of long or unnormalized
+ * strings, further comparisons do not allocate any memory.
+ *
+ * The iterators are created on first use, and again when a comparison
+ * uses collation data or a numeric setting different from the previous one.
+ * Not thread-safe: Each thread needs its own scratch object.
+ */
+class U_I18N_API CollationScratch : public UMemory {
+public:
+    CollationScratch() : data(NULL), numeric(FALSE), checkFCD(FALSE) {}
+    ~CollationScratch();
+
+    /**
+     * Sets the iterators to the two strings, starting after their equal prefix.
+     * @return FALSE if memory allocation failed
+     */
+    UBool setText(const CollationData *d, UBool isNumeric, UBool fcd,
+                  const UChar *left, const UChar *leftLimit,
+                  const UChar *right, const UChar *rightLimit,
+                  int32_t equalPrefixLength, UErrorCode &errorCode);
+
+    /** The left-string iterator after a successful setText(). */
+    CollationIterator &getLeft() const {
+        return checkFCD ? *static_cast<CollationIterator *>(fcdLeftIter.getAlias()) : *leftIter;
+    }
+    /** The right-string iterator after a successful setText(). */
+    CollationIterator &getRight() const {
+        return checkFCD ? *static_cast<CollationIterator *>(fcdRightIter.getAlias()) : *rightIter;
+    }
+
+private:
+    CollationScratch(const CollationScratch &) = delete;
+    CollationScratch &operator=(const CollationScratch &) = delete;
+
+    const CollationData *data;
+    UBool numeric;
+    UBool checkFCD;
+    LocalPointer<UTF16CollationIterator> leftIter;
+    LocalPointer<UTF16CollationIterator> rightIter;
+    LocalPointer<FCDUTF16CollationIterator> fcdLeftIter;
+    LocalPointer<FCDUTF16CollationIterator> fcdRightIter;
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
+#endif  // __COLLATIONSCRATCH_H__
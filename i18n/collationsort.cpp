@@ -0,0 +1,130 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// collationsort.cpp
+// created: 2026oct14
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/coll.h"
+#include "unicode/tblcoll.h"
+#include "unicode/ustring.h"
+#include "cmemory.h"
+#include "collationsort.h"
+#include "cstring.h"
+#include "uarrsort.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+struct SortKeys {
+    const uint8_t *keys;
+    const int32_t *offsets;
+};
+
+int32_t U_CALLCONV
+compareSortKeys(const void *context, const void *left, const void *right) {
+    const SortKeys &sortKeys = *static_cast<const SortKeys *>(context);
+    // Sort keys contain no zero bytes other than their terminators.
+    return uprv_strcmp(
+        reinterpret_cast<const char *>(
+            sortKeys.keys + sortKeys.offsets[*static_cast<const int32_t *>(left)]),
+        reinterpret_cast<const char *>(
+            sortKeys.keys + sortKeys.offsets[*static_cast<const int32_t *>(right)]));
+}
+
+}  // namespace
+
+int32_t
+CollationSort::getSortKeys(const Collator &coll,
+                           const UChar *const *strings, const int32_t *lengths, int32_t count,
+                           uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                           UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return 0; }
+    const RuleBasedCollator *rbc = dynamic_cast<const RuleBasedCollator *>(&coll);
+    if(rbc != NULL) {
+        return rbc->internalGetSortKeys(strings, lengths, count,
+                                        dest, destCapacity, offsets, errorCode);
+    }
+    if(count < 0 || (strings == NULL && count > 0) || offsets == NULL ||
+            destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    // Not a RuleBasedCollator: Fetch the keys one at a time.
+    int32_t length = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = length;
+        int32_t sourceLength = (lengths != NULL) ? lengths[i] : -1;
+        int32_t keyLength = (length < destCapacity) ?
+            coll.getSortKey(strings[i], sourceLength, dest + length, destCapacity - length) :
+            coll.getSortKey(strings[i], sourceLength, NULL, 0);
+        if(keyLength == 0) {
+            errorCode = U_INTERNAL_PROGRAM_ERROR;
+            return 0;
+        }
+        length += keyLength;
+    }
+    offsets[count] = length;
+    if(length > destCapacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
+void
+CollationSort::sortIndexes(const Collator &coll,
+                           const UChar *const *strings, const int32_t *lengths, int32_t count,
+                           int32_t *indexes, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+    if(count < 0 || (count > 0 && (strings == NULL || indexes == NULL))) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        indexes[i] = i;
+    }
+    if(count <= 1) { return; }
+
+    LocalMemory<int32_t> offsets;
+    if(offsets.allocateInsteadAndCopy(count + 1) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    // A sort key takes a few bytes per UTF-16 code unit.
+    // The estimate needs to be good enough only to usually avoid a second pass.
+    int64_t estimate = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        int32_t length = (lengths != NULL) ? lengths[i] : -1;
+        if(length < 0) {
+            length = (strings[i] != NULL) ? u_strlen(strings[i]) : 0;
+        }
+        estimate += 4 * (int64_t)length + 8;
+    }
+    int32_t capacity = estimate <= INT32_MAX ? (int32_t)estimate : INT32_MAX;
+    MaybeStackArray<uint8_t, 1024> keys;
+    for(;;) {
+        if(capacity > keys.getCapacity() && keys.resize(capacity) == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        int32_t length = getSortKeys(coll, strings, lengths, count,
+                                     keys.getAlias(), keys.getCapacity(), offsets.getAlias(),
+                                     errorCode);
+        if(errorCode != U_BUFFER_OVERFLOW_ERROR) { break; }
+        // The keys did not fit: Try again with the exact length.
+        errorCode = U_ZERO_ERROR;
+        capacity = length;
+    }
+    if(U_FAILURE(errorCode)) { return; }
+    SortKeys sortKeys = { keys.getAlias(), offsets.getAlias() };
+    uprv_sortArray(indexes, count, (int32_t)sizeof(int32_t),
+                   compareSortKeys, &sortKeys, TRUE, &errorCode);
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
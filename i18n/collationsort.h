@@ -0,0 +1,59 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// collationsort.h
+// created: 2026oct14
+
+#ifndef __COLLATIONSORT_H__
+#define __COLLATIONSORT_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+U_NAMESPACE_BEGIN
+
+class Collator;
+
+/**
+ * Sorts arrays of strings via their sort keys:
+ * The keys for all strings are written into one buffer,
+ * and only the keys are compared while sorting,
+ * rather than running the collation algorithm for O(n log n) string comparisons.
+ */
+class U_I18N_API CollationSort /* not : public UObject because all methods are static */ {
+public:
+    /**
+     * Sets indexes[0..count-1] to the order of the strings according to the collator:
+     * strings[indexes[i]] comes before strings[indexes[i+1]].
+     * The sort is stable.
+     * @param coll the collator
+     * @param strings count strings; a string can be NULL if its length is 0
+     * @param lengths count string lengths, -1 for NUL-terminated strings;
+     *        or NULL if all of the strings are NUL-terminated
+     * @param count number of strings
+     * @param indexes receives the order; must have room for count indexes
+     * @param errorCode ICU error code
+     */
+    /**
+     * Implements ucol_getSortKeys().
+     * Uses RuleBasedCollator::internalGetSortKeys() if coll is a RuleBasedCollator,
+     * otherwise calls coll.getSortKey() for one string at a time.
+     */
+    static int32_t getSortKeys(const Collator &coll,
+                               const UChar *const *strings, const int32_t *lengths, int32_t count,
+                               uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                               UErrorCode &errorCode);
+
+    static void sortIndexes(const Collator &coll,
+                            const UChar *const *strings, const int32_t *lengths, int32_t count,
+                            int32_t *indexes, UErrorCode &errorCode);
+
+private:
+    CollationSort();  // no instantiation
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
+#endif  // __COLLATIONSORT_H__
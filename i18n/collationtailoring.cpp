@@ -17,6 +17,7 @@
 
 #include "unicode/udata.h"
 #include "unicode/unistr.h"
+#include "unicode/uniset.h"
 #include "unicode/ures.h"
 #include "unicode/uversion.h"
 #include "unicode/uvernum.h"
@@ -104,10 +105,40 @@ CollationTailoring::getUCAVersion() const {
     return ((int32_t)version[1] << 4) | (version[2] >> 6);
 }
 
+int32_t
+CollationTailoring::getApproximateSize() const {
+    int32_t size = (int32_t)sizeof(*this) + rules.length() * 2;
+    if(ownedData != NULL) {
+        size += (int32_t)sizeof(CollationData);
+        if(builder != NULL) {
+            // Built from rules: The data arrays and the trie are on the heap,
+            // rather than in memory-mapped data.
+            size += ownedData->ce32sLength * 4 + ownedData->cesLength * 8 +
+                    ownedData->contextsLength * 2 + ownedData->fastLatinTableLength * 2;
+            if(trie != NULL) {
+                size += trie->length;
+            }
+        }
+    }
+    if(unsafeBackwardSet != NULL) {
+        size += (int32_t)sizeof(UnicodeSet) + unsafeBackwardSet->getRangeCount() * 8;
+    }
+    return size;
+}
+
 CollationCacheEntry::~CollationCacheEntry() {
     SharedObject::clearPtr(tailoring);
 }
 
+int32_t
+CollationCacheEntry::getApproximateSize() const {
+    int32_t size = (int32_t)sizeof(*this);
+    if(tailoring != NULL) {
+        size += tailoring->getApproximateSize();
+    }
+    return size;
+}
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_COLLATION
@@ -60,6 +60,8 @@ struct U_I18N_API CollationTailoring : public SharedObject {
     void setVersion(const UVersionInfo baseVersion, const UVersionInfo rulesVersion);
     int32_t getUCAVersion() const;
 
+    virtual int32_t getApproximateSize() const;
+
     // data for sorting etc.
     const CollationData *data;  // == base data or ownedData
     const CollationSettings *settings;  // reference-counted
@@ -101,6 +103,8 @@ struct CollationCacheEntry : public SharedObject {
     }
     ~CollationCacheEntry();
 
+    virtual int32_t getApproximateSize() const;
+
     Locale validLocale;
     const CollationTailoring *tailoring;
 };
@@ -16,6 +16,7 @@
 
 #include "unicode/unifilt.h"
 #include "unicode/uniset.h"
+#include "unicode/utf16.h"
 #include "cpdtrans.h"
 #include "uvector.h"
 #include "tridpars.h"
@@ -28,6 +29,10 @@ static const UChar NEWLINE  = 10;
 
 static const UChar COLON_COLON[] = {0x3A, 0x3A, 0}; //"::"
 
+// Number of UTF-16 units that a fused non-incremental transliteration
+// pushes through all transliterators at a time.
+static const int32_t FUSED_CHUNK_LENGTH = 1024;
+
 U_NAMESPACE_BEGIN
 
 const UChar CompoundTransliterator::PASS_STRING[] = { 0x0025, 0x0050, 0x0061, 0x0073, 0x0073, 0 }; // "%Pass"
@@ -536,6 +541,11 @@ void CompoundTransliterator::handleTransliterate(Replaceable& text, UTransPositi
         return; // Short circuit for empty compound transliterators
     }
 
+    if (!incremental && count > 1 && (index.limit - index.start) > 2 * FUSED_CHUNK_LENGTH &&
+            fusedTransliterate(text, index)) {
+        return;
+    }
+
     // compoundLimit is the limit value for the entire compound
     // operation.  We overwrite index.limit with the previous
     // index.start.  After each transliteration, we update
@@ -594,6 +604,99 @@ void CompoundTransliterator::handleTransliterate(Replaceable& text, UTransPositi
     index.limit = compoundLimit;
 }
 
+/**
+ * Instead of running each transliterator over the whole range in turn,
+ * run all of them over one chunk at a time, in incremental mode.
+ * Each transliterator commits output up to stageStart[i] and sees only
+ * text that the previous one has committed, exactly as if the text
+ * were typed in chunk by chunk; contextStart and the text before each
+ * stageStart stay available as preceding context.  Finally, each
+ * transliterator finishes its uncommitted text non-incrementally.
+ *
+ * While chunking, the text after the current chunk is moved out of the
+ * string, so that replacements do not move the rest of a long text
+ * around and the working end of the string stays in the cache.
+ * The transliterators see at most the chunk limit as their context
+ * limit, so they do not notice.
+ *
+ * If the transliterators fall more than a chunk behind (a pending
+ * partial match that only the end of the text can resolve), stop
+ * chunking and finish right away, so that no text is rescanned for
+ * every chunk.
+ */
+UBool CompoundTransliterator::fusedTransliterate(Replaceable& text, UTransPosition& index) const {
+    if (text.getDynamicClassID() != UnicodeString::getStaticClassID()) {
+        return FALSE;
+    }
+    UnicodeString &str = static_cast<UnicodeString &>(text);
+    MaybeStackArray<int32_t, 8> stageStart;
+    UnicodeString rest;
+    if ((count > stageStart.getCapacity() && stageStart.resize(count) == NULL) ||
+            rest.setTo(str, index.start).isBogus()) {
+        return FALSE;
+    }
+    str.truncate(index.start);
+    int32_t restStart = 0;
+
+    for (int32_t i=0; i<count; ++i) {
+        stageStart[i] = index.start;
+    }
+    // limit and contextLimit follow insertions and deletions.
+    int32_t limit = index.limit;
+    int32_t contextLimit = index.contextLimit;
+    int32_t chunkLimit = index.start;
+    while ((limit - chunkLimit) > FUSED_CHUNK_LENGTH &&
+           (chunkLimit - stageStart[count - 1]) <= 2 * FUSED_CHUNK_LENGTH) {
+        int32_t chunkLength = FUSED_CHUNK_LENGTH;
+        // Do not split a surrogate pair.
+        if (U16_IS_LEAD(rest.charAt(restStart + chunkLength - 1)) &&
+                U16_IS_TRAIL(rest.charAt(restStart + chunkLength))) {
+            ++chunkLength;
+        }
+        str.append(rest, restStart, chunkLength);
+        restStart += chunkLength;
+        chunkLimit += chunkLength;
+        int32_t stageLimit = chunkLimit;
+        for (int32_t i=0; i<count; ++i) {
+            if (stageStart[i] == stageLimit) {
+                break;  // Nothing new for this and the following transliterators.
+            }
+            UTransPosition pos;
+            pos.contextStart = index.contextStart;
+            pos.contextLimit = stageLimit;
+            pos.start = stageStart[i];
+            pos.limit = stageLimit;
+            trans[i]->filteredTransliterate(text, pos, TRUE);
+            // Text after this transliterator's input moves with its
+            // insertions and deletions.
+            int32_t delta = pos.limit - stageLimit;
+            for (int32_t j=0; j<i; ++j) {
+                stageStart[j] += delta;
+            }
+            chunkLimit += delta;
+            limit += delta;
+            contextLimit += delta;
+            stageStart[i] = stageLimit = pos.start;
+        }
+    }
+    str.append(rest, restStart, rest.length() - restStart);
+
+    // Finish each transliterator, in order, through the end of the range.
+    for (int32_t i=0; i<count; ++i) {
+        UTransPosition pos;
+        pos.contextStart = index.contextStart;
+        pos.contextLimit = contextLimit;
+        pos.start = stageStart[i];
+        pos.limit = limit;
+        trans[i]->filteredTransliterate(text, pos, FALSE);
+        contextLimit = pos.contextLimit;
+        limit = pos.limit;
+    }
+    index.contextLimit = contextLimit;
+    index.start = index.limit = limit;
+    return TRUE;
+}
+
 /**
  * Sets the length of the longest context required by this transliterator.
  * This is <em>preceding</em> context.
@@ -223,6 +223,14 @@ class U_I18N_API CompoundTransliterator : public Transliterator {
     void freeTransliterators(void);
 
     void computeMaximumContextLength(void);
+
+    /**
+     * Non-incremental transliteration of a long range, pushing chunks
+     * of text through all of the transliterators in turn.
+     * Returns FALSE without doing anything if the text is not a UnicodeString
+     * or if it cannot allocate its per-transliterator state.
+     */
+    UBool fusedTransliterate(Replaceable& text, UTransPosition& index) const;
 };
 
 U_NAMESPACE_END
@@ -36,12 +36,26 @@ U_NAMESPACE_BEGIN
 
 struct CSRecognizerInfo : public UMemory {
     CSRecognizerInfo(CharsetRecognizer *recognizer, UBool isDefaultEnabled)
-        : recognizer(recognizer), isDefaultEnabled(isDefaultEnabled) {};
+        : recognizer(recognizer), isDefaultEnabled(isDefaultEnabled),
+          isUnicode(FALSE), needsNUL(FALSE), needsESC(FALSE) {
+        if (recognizer != NULL) {
+            const char *name = recognizer->getName();
+            isUnicode = uprv_strncmp(name, "UTF-", 4) == 0;
+            needsNUL = uprv_strncmp(name, "UTF-32", 6) == 0;
+            needsESC = uprv_strncmp(name, "ISO-2022-", 9) == 0;
+        }
+    };
 
     ~CSRecognizerInfo() {delete recognizer;};
 
     CharsetRecognizer *recognizer;
     UBool isDefaultEnabled;
+
+    // Prefiltering: A recognizer that needs some byte value cannot match
+    //   input without it, and is skipped.
+    UBool isUnicode;    // UTF-8, UTF-16 or UTF-32.
+    UBool needsNUL;     // UTF-32 has a NUL byte in every character.
+    UBool needsESC;     // ISO-2022 needs at least one escape sequence.
 };
 
 U_NAMESPACE_END
@@ -150,7 +164,7 @@ void CharsetDetector::setRecognizers(UErrorCode &status)
 CharsetDetector::CharsetDetector(UErrorCode &status)
   : textIn(new InputText(status)), resultArray(NULL),
     resultCount(0), fStripTags(FALSE), fFreshTextSet(FALSE),
-    fEnabledRecognizers(NULL)
+    fStopConfidence(0), fEnabledRecognizers(NULL)
 {
     if (U_FAILURE(status)) {
         return;
@@ -213,6 +227,32 @@ UBool CharsetDetector::getStripTagsFlag() const
     return fStripTags;
 }
 
+void CharsetDetector::setSampleLength(int32_t length, UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (length < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    textIn->fSampleLimit = length;
+    fFreshTextSet = TRUE;
+}
+
+void CharsetDetector::setStopConfidence(int32_t confidence, UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (confidence < 0 || confidence > 100) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fStopConfidence = confidence;
+    fFreshTextSet = TRUE;
+}
+
 void CharsetDetector::setDeclaredEncoding(const char *encoding, int32_t len) const
 {
     textIn->setDeclaredEncoding(encoding,len);
@@ -252,13 +292,27 @@ const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound,
 
         textIn->MungeInput(fStripTags);
 
+        // With early termination, a byte order mark settles the question
+        // among the Unicode charsets.
+        UBool onlyUnicode = fStopConfidence > 0 && textIn->fRawHasBOM;
+
         // Iterate over all possible charsets, remember all that
         // give a match quality > 0.
         resultCount = 0;
         for (i = 0; i < fCSRecognizers_size; i += 1) {
-            csr = fCSRecognizers[i]->recognizer;
+            const CSRecognizerInfo *csrinfo = fCSRecognizers[i];
+            if ((onlyUnicode && !csrinfo->isUnicode) ||
+                    (csrinfo->needsNUL && !textIn->fRawHasNUL) ||
+                    (csrinfo->needsESC && textIn->fByteStats[0x1B] == 0)) {
+                continue;
+            }
+            csr = csrinfo->recognizer;
             if (csr->match(textIn, resultArray[resultCount])) {
                 resultCount++;
+                if (fStopConfidence > 0 &&
+                        resultArray[resultCount - 1]->getConfidence() >= fStopConfidence) {
+                    break;
+                }
             }
         }
 
@@ -273,6 +327,34 @@ const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound,
     return resultArray;
 }
 
+void CharsetDetector::detectBatch(const char *const texts[], const int32_t lengths[], int32_t count,
+                                  const char *names[], int32_t confidences[], UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (count < 0 || (count > 0 && (texts == NULL || lengths == NULL || names == NULL))) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    for (int32_t i = 0; i < count; i += 1) {
+        if (texts[i] == NULL) {
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        setText(texts[i], lengths[i]);
+        const CharsetMatch *match = detect(status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        names[i] = match != NULL ? match->getName() : NULL;
+        if (confidences != NULL) {
+            confidences[i] = match != NULL ? match->getConfidence() : 0;
+        }
+    }
+}
+
 void CharsetDetector::setDetectableCharset(const char *encoding, UBool enabled, UErrorCode &status)
 {
     if (U_FAILURE(status)) {
@@ -30,6 +30,8 @@ class CharsetDetector : public UMemory
     int32_t resultCount;
     UBool fStripTags;   // If true, setText() will strip tags from input text.
     UBool fFreshTextSet;
+    int32_t fStopConfidence;    // If positive, detection stops at the first match with
+                                // at least this confidence. See setStopConfidence().
     static void setRecognizers(UErrorCode &status);
 
     UBool *fEnabledRecognizers;  // If not null, active set of charset recognizers had
@@ -53,6 +55,13 @@ class CharsetDetector : public UMemory
 
     UBool getStripTagsFlag() const;
 
+    void setSampleLength(int32_t length, UErrorCode &status);
+
+    void setStopConfidence(int32_t confidence, UErrorCode &status);
+
+    void detectBatch(const char *const texts[], const int32_t lengths[], int32_t count,
+                     const char *names[], int32_t confidences[], UErrorCode &status);
+
 //    const char *getCharsetName(int32_t index, UErrorCode& status) const;
 
     static int32_t getDetectableCount();
@@ -13,6 +13,7 @@
 
 #include "cmemory.h"
 #include "csmatch.h"
+#include "uassert.h"
 #include "csrmbcs.h"
 
 #include <math.h>
@@ -92,26 +93,44 @@ static const uint16_t commonChars_gb_18030[] = {
 0xcfb5, 0xcfc2, 0xcfd6, 0xd0c2, 0xd0c5, 0xd0d0, 0xd0d4, 0xd1a7, 0xd2aa, 0xd2b2,
 0xd2b5, 0xd2bb, 0xd2d4, 0xd3c3, 0xd3d0, 0xd3fd, 0xd4c2, 0xd4da, 0xd5e2, 0xd6d0};
 
-static int32_t binarySearch(const uint16_t *array, int32_t len, uint16_t value)
+/*
+ * The common characters are looked up in a hash set that match_mbcs()
+ * builds from the sorted list. With at most 128 characters the load factor
+ * is at most 1/2, and 0 marks empty slots since all of the characters
+ * are double-byte values.
+ */
+#define COMMON_CHARS_HASH_SIZE 256
+
+static inline int32_t commonCharHash(uint16_t value)
 {
-    int32_t start = 0, end = len-1;
-    int32_t mid = (start+end)/2;
+    return (int32_t)(((uint32_t)value * 0x9E3779B1u) >> 24);
+}
 
-    while(start <= end) {
-        if(array[mid] == value) {
-            return mid;
-        }
+static void buildCommonCharSet(const uint16_t *array, int32_t len, uint16_t *set)
+{
+    U_ASSERT(len <= COMMON_CHARS_HASH_SIZE / 2);
+    uprv_memset(set, 0, COMMON_CHARS_HASH_SIZE * sizeof(set[0]));
 
-        if(array[mid] < value){
-            start = mid+1;
-        } else {
-            end = mid-1;
+    for (int32_t i = 0; i < len; i += 1) {
+        int32_t index = commonCharHash(array[i]);
+        while (set[index] != 0) {
+            index = (index + 1) & (COMMON_CHARS_HASH_SIZE - 1);
         }
-
-        mid = (start+end)/2;
+        set[index] = array[i];
     }
+}
 
-    return -1;
+static inline UBool containsCommonChar(const uint16_t *set, uint16_t value)
+{
+    int32_t index = commonCharHash(value);
+    uint16_t c;
+    while ((c = set[index]) != 0) {
+        if (c == value) {
+            return TRUE;
+        }
+        index = (index + 1) & (COMMON_CHARS_HASH_SIZE - 1);
+    }
+    return FALSE;
 }
 
 IteratedChar::IteratedChar() : 
@@ -131,7 +150,7 @@ charValue(0), index(-1), nextIndex(0), error(FALSE), done(FALSE)
 
 int32_t IteratedChar::nextByte(InputText *det)
 {
-    if (nextIndex >= det->fRawLength) {
+    if (nextIndex >= det->fRawSampleLength) {
         done = TRUE;
 
         return -1;
@@ -153,6 +172,11 @@ int32_t CharsetRecog_mbcs::match_mbcs(InputText *det, const uint16_t commonChars
     int32_t totalCharCount      = 0;
     int32_t confidence          = 0;
     IteratedChar iter;
+    uint16_t commonCharSet[COMMON_CHARS_HASH_SIZE];
+
+    if (commonChars != 0) {
+        buildCommonCharSet(commonChars, commonCharsLen, commonCharSet);
+    }
 
     while (nextChar(&iter, det)) {
         totalCharCount++;
@@ -166,7 +190,7 @@ int32_t CharsetRecog_mbcs::match_mbcs(InputText *det, const uint16_t commonChars
                 doubleByteCharCount++;
 
                 if (commonChars != 0) {
-                    if (binarySearch(commonChars, commonCharsLen, static_cast<uint16_t>(iter.charValue)) >= 0){
+                    if (containsCommonChar(commonCharSet, static_cast<uint16_t>(iter.charValue))) {
                         commonCharCount += 1;
                     }
                 }
@@ -10,6 +10,7 @@
 #include "unicode/utypes.h"
 
 #include "cmemory.h"
+#include "uassert.h"
 
 #if !UCONFIG_NO_CONVERSION
 #include "csrsbcs.h"
@@ -23,67 +24,82 @@ U_NAMESPACE_BEGIN
 NGramParser::NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap)
  : ngram(0), byteIndex(0)
 {
-    ngramList = theNgramList;
     charMap   = theCharMap;
+    init(&theNgramList, 1);
+}
 
-    ngramCount = hitCount = 0;
+NGramParser::NGramParser(const int32_t *const theNgramLists[], int32_t theListCount,
+                         const uint8_t *theCharMap)
+ : ngram(0), byteIndex(0)
+{
+    charMap   = theCharMap;
+    init(theNgramLists, theListCount);
 }
 
 NGramParser::~NGramParser()
 {
 }
 
-/*
- * Binary search for value in table, which must have exactly 64 entries.
- */
-
-int32_t NGramParser::search(const int32_t *table, int32_t value)
+void NGramParser::init(const int32_t *const theNgramLists[], int32_t theListCount)
 {
-    int32_t index = 0;
-
-    if (table[index + 32] <= value) {
-        index += 32;
-    }
-
-    if (table[index + 16] <= value) {
-        index += 16;
-    }
-
-    if (table[index + 8] <= value) {
-        index += 8;
-    }
+    U_ASSERT(0 < theListCount && theListCount <= MAX_NGRAM_LISTS);
+    listCount = theListCount;
+    ngramCount = 0;
+    uprv_memset(hitCounts, 0, sizeof(hitCounts));
 
-    if (table[index + 4] <= value) {
-        index += 4;
+    // Smallest power of 2 that keeps the load factor at or below 1/2.
+    int32_t size = 2 * NGRAM_LIST_LENGTH;
+    while (size < 2 * NGRAM_LIST_LENGTH * listCount) {
+        size *= 2;
     }
-
-    if (table[index + 2] <= value) {
-        index += 2;
-    }
-
-    if (table[index + 1] <= value) {
-        index += 1;
-    }
-
-    if (table[index] > value) {
-        index -= 1;
-    }
-
-    if (index < 0 || table[index] != value) {
-        return -1;
+    hashMask = size - 1;
+    uprv_memset(hashKeys, 0xff, size * sizeof(hashKeys[0]));
+
+    for (int32_t list = 0; list < listCount; ++list) {
+        const int32_t *ngramList = theNgramLists[list];
+        for (int32_t i = 0; i < NGRAM_LIST_LENGTH; ++i) {
+            int32_t value = ngramList[i];
+            int32_t index = hash(value) & hashMask;
+            while (hashKeys[index] >= 0 && hashKeys[index] != value) {
+                index = (index + 1) & hashMask;
+            }
+            if (hashKeys[index] < 0) {
+                hashKeys[index] = value;
+                hashLists[index] = 0;
+            }
+            hashLists[index] |= (uint16_t)(1 << list);
+        }
     }
+}
 
-    return index;
+/*
+ * Multiplicative hash for a 24-bit n-gram, with well-mixed low bits.
+ */
+int32_t NGramParser::hash(int32_t value)
+{
+    return (int32_t)(((uint32_t)value * 0x9E3779B1u) >> 16);
 }
 
 void NGramParser::lookup(int32_t thisNgram)
 {
     ngramCount += 1;
 
-    if (search(ngramList, thisNgram) >= 0) {
-        hitCount += 1;
+    int32_t index = hash(thisNgram) & hashMask;
+    int32_t key;
+    while ((key = hashKeys[index]) >= 0) {
+        if (key == thisNgram) {
+            uint32_t lists = hashLists[index];
+            if (lists == 1) {
+                hitCounts[0] += 1;
+            } else {
+                for (int32_t list = 0; lists != 0; ++list, lists >>= 1) {
+                    hitCounts[list] += lists & 1;
+                }
+            }
+            break;
+        }
+        index = (index + 1) & hashMask;
     }
-
 }
 
 void NGramParser::addByte(int32_t b)
@@ -127,7 +143,24 @@ int32_t NGramParser::parse(InputText *det)
     // TODO: Is this OK? The buffer could have ended in the middle of a word...
     addByte(0x20);
 
-    double rawPercent = (double) hitCount / (double) ngramCount;
+    return getConfidence(0);
+}
+
+void NGramParser::parse(InputText *det, int32_t confidences[])
+{
+    parseCharacters(det);
+
+    // TODO: Is this OK? The buffer could have ended in the middle of a word...
+    addByte(0x20);
+
+    for (int32_t list = 0; list < listCount; ++list) {
+        confidences[list] = getConfidence(list);
+    }
+}
+
+int32_t NGramParser::getConfidence(int32_t list) const
+{
+    double rawPercent = (double) hitCounts[list] / (double) ngramCount;
 
     //            if (rawPercent <= 2.0) {
     //                return 0;
@@ -261,6 +294,14 @@ int32_t CharsetRecog_sbcs::match_sbcs(InputText *det, const int32_t ngrams[],  c
     return result;
 }
 
+void CharsetRecog_sbcs::match_sbcs(InputText *det, const int32_t *const ngramLists[], int32_t listCount,
+                                   const uint8_t byteMap[], int32_t confidences[]) const
+{
+    NGramParser parser(ngramLists, listCount, byteMap);
+
+    parser.parse(det, confidences);
+}
+
 static const uint8_t charMap_8859_1[] = {
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -891,12 +932,17 @@ CharsetRecog_8859_1::~CharsetRecog_8859_1()
 
 UBool CharsetRecog_8859_1::match(InputText *textIn, CharsetMatch *results) const {
     const char *name = textIn->fC1Bytes? "windows-1252" : "ISO-8859-1";
+    const int32_t *ngramLists[UPRV_LENGTHOF(ngrams_8859_1)];
+    int32_t confidences[UPRV_LENGTHOF(ngrams_8859_1)];
     uint32_t i;
+    for (i=0; i < UPRV_LENGTHOF(ngrams_8859_1) ; i++) {
+        ngramLists[i] = ngrams_8859_1[i].ngrams;
+    }
+    match_sbcs(textIn, ngramLists, UPRV_LENGTHOF(ngrams_8859_1), charMap_8859_1, confidences);
     int32_t bestConfidenceSoFar = -1;
     for (i=0; i < UPRV_LENGTHOF(ngrams_8859_1) ; i++) {
-        const int32_t *ngrams = ngrams_8859_1[i].ngrams;
         const char    *lang   = ngrams_8859_1[i].lang;
-        int32_t confidence = match_sbcs(textIn, ngrams, charMap_8859_1);
+        int32_t confidence = confidences[i];
         if (confidence > bestConfidenceSoFar) {
             results->set(textIn, this, confidence, name, lang);
             bestConfidenceSoFar = confidence;
@@ -918,12 +964,17 @@ CharsetRecog_8859_2::~CharsetRecog_8859_2()
 
 UBool CharsetRecog_8859_2::match(InputText *textIn, CharsetMatch *results) const {
     const char *name = textIn->fC1Bytes? "windows-1250" : "ISO-8859-2";
+    const int32_t *ngramLists[UPRV_LENGTHOF(ngrams_8859_2)];
+    int32_t confidences[UPRV_LENGTHOF(ngrams_8859_2)];
     uint32_t i;
+    for (i=0; i < UPRV_LENGTHOF(ngrams_8859_2) ; i++) {
+        ngramLists[i] = ngrams_8859_2[i].ngrams;
+    }
+    match_sbcs(textIn, ngramLists, UPRV_LENGTHOF(ngrams_8859_2), charMap_8859_2, confidences);
     int32_t bestConfidenceSoFar = -1;
     for (i=0; i < UPRV_LENGTHOF(ngrams_8859_2) ; i++) {
-        const int32_t *ngrams = ngrams_8859_2[i].ngrams;
         const char    *lang   = ngrams_8859_2[i].lang;
-        int32_t confidence = match_sbcs(textIn, ngrams, charMap_8859_2);
+        int32_t confidence = confidences[i];
         if (confidence > bestConfidenceSoFar) {
             results->set(textIn, this, confidence, name, lang);
             bestConfidenceSoFar = confidence;
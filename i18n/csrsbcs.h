@@ -18,14 +18,36 @@
 
 U_NAMESPACE_BEGIN
 
+/*
+ * Counts how many of the 3-grams of the input are in each of one or more
+ * lists of 64 common 3-grams.
+ * The lists are combined into one hash table, built when the parser is
+ * constructed, that maps each 3-gram to the set of lists which contain it,
+ * so that each 3-gram of the input is looked up once for all of the lists.
+ */
 class NGramParser : public UMemory
 {
+public:
+    enum {
+        NGRAM_LIST_LENGTH = 64,
+        MAX_NGRAM_LISTS = 16
+    };
+
 private:
+    enum {
+        // Large enough for MAX_NGRAM_LISTS at a load factor below 1/2.
+        MAX_HASH_SIZE = 2048
+    };
+
     int32_t ngram;
-    const int32_t *ngramList;    
+
+    int32_t hashMask;                   // Hash table size - 1.
+    int32_t hashKeys[MAX_HASH_SIZE];    // 3-grams, or -1 for empty slots.
+    uint16_t hashLists[MAX_HASH_SIZE];  // Bit set of the lists with the 3-gram in the same slot.
+    int32_t listCount;
 
     int32_t ngramCount;
-    int32_t hitCount;
+    int32_t hitCounts[MAX_NGRAM_LISTS];
 
 protected:
 	int32_t byteIndex;
@@ -35,22 +57,31 @@ class NGramParser : public UMemory
 
 public:
     NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap);
+    NGramParser(const int32_t *const theNgramLists[], int32_t theListCount, const uint8_t *theCharMap);
     virtual ~NGramParser();
 
 private:
-    /*
-    * Binary search for value in table, which must have exactly 64 entries.
-    */
-    int32_t search(const int32_t *table, int32_t value);
+    void init(const int32_t *const theNgramLists[], int32_t theListCount);
+    static int32_t hash(int32_t value);
 
     void lookup(int32_t thisNgram);
     
     virtual int32_t nextByte(InputText *det);
 	virtual void parseCharacters(InputText *det);
 
+    int32_t getConfidence(int32_t list) const;
+
 public:
+    /*
+     * Parses the input and returns the confidence for the first list.
+     */
     int32_t parse(InputText *det);
 
+    /*
+     * Parses the input and sets the confidence for each list.
+     */
+    void parse(InputText *det, int32_t confidences[]);
+
 };
 
 #if !UCONFIG_ONLY_HTML_CONVERSION
@@ -77,6 +108,12 @@ class CharsetRecog_sbcs : public CharsetRecognizer
     virtual const char *getName() const = 0;
     virtual UBool match(InputText *det, CharsetMatch *results) const = 0;
     virtual int32_t match_sbcs(InputText *det, const int32_t ngrams[], const uint8_t charMap[]) const;
+
+    /*
+     * Sets the confidences for several lists of n-grams with one parse of the input.
+     */
+    void match_sbcs(InputText *det, const int32_t *const ngramLists[], int32_t listCount,
+                    const uint8_t charMap[], int32_t confidences[]) const;
 };
 
 class CharsetRecog_8859_1 : public CharsetRecog_sbcs
@@ -35,13 +35,13 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
     int32_t trailBytes = 0;
     int32_t confidence;
 
-    if (input->fRawLength >= 3 && 
+    if (input->fRawSampleLength >= 3 && 
         inputBytes[0] == 0xEF && inputBytes[1] == 0xBB && inputBytes[2] == 0xBF) {
             hasBOM = TRUE;
     }
 
     // Scan for multi-byte sequences
-    for (i=0; i < input->fRawLength; i += 1) {
+    for (i=0; i < input->fRawSampleLength; i += 1) {
         int32_t b = inputBytes[i];
 
         if ((b & 0x80) == 0) {
@@ -64,7 +64,7 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
         for (;;) {
             i += 1;
 
-            if (i >= input->fRawLength) {
+            if (i >= input->fRawSampleLength) {
                 break;
             }
 
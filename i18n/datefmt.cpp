@@ -29,10 +29,12 @@
 #include "unicode/dtptngen.h"
 #include "unicode/udisplaycontext.h"
 #include "reldtfmt.h"
+#include "fphdlimp.h"
 #include "sharedobject.h"
 #include "unifiedcache.h"
 #include "uarrsort.h"
 
+#include "cmemory.h"
 #include "cstring.h"
 #include "windtfmt.h"
 
@@ -279,6 +281,16 @@ DateFormat::format(Calendar& /* unused cal */,
 
 UnicodeString&
 DateFormat::format(UDate date, UnicodeString& appendTo, FieldPosition& fieldPosition) const {
+    if (getDynamicClassID() == SimpleDateFormat::getStaticClassID()) {
+        const SimpleDateFormat* sdf = static_cast<const SimpleDateFormat*>(this);
+        if (sdf->canFormatGregorian(date)) {
+            // Format without a Calendar clone
+            UErrorCode ec = U_ZERO_ERROR;
+            FieldPositionOnlyHandler handler(fieldPosition);
+            sdf->formatGregorian(date, appendTo, handler, ec);
+            return appendTo;
+        }
+    }
     if (fCalendar != NULL) {
         // Use a clone of our calendar instance
         Calendar* calClone = fCalendar->clone();
@@ -299,6 +311,15 @@ DateFormat::format(UDate date, UnicodeString& appendTo, FieldPosition& fieldPosi
 UnicodeString&
 DateFormat::format(UDate date, UnicodeString& appendTo, FieldPositionIterator* posIter,
                    UErrorCode& status) const {
+    if (getDynamicClassID() == SimpleDateFormat::getStaticClassID()) {
+        const SimpleDateFormat* sdf = static_cast<const SimpleDateFormat*>(this);
+        if (sdf->canFormatGregorian(date)) {
+            // Format without a Calendar clone
+            FieldPositionIteratorHandler handler(posIter, status);
+            sdf->formatGregorian(date, appendTo, handler, status);
+            return appendTo;
+        }
+    }
     if (fCalendar != NULL) {
         Calendar* calClone = fCalendar->clone();
         if (calClone != NULL) {
@@ -325,12 +346,48 @@ DateFormat::format(UDate date, UnicodeString& appendTo) const
 
 //----------------------------------------------------------------------
 
+UnicodeString&
+DateFormat::formatBatch(const UDate* dates, int32_t count,
+                        UnicodeString& appendTo, int32_t* offsets,
+                        UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+    if (count < 0 || (count > 0 && dates == NULL)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return appendTo;
+    }
+    if (getDynamicClassID() == SimpleDateFormat::getStaticClassID()) {
+        static_cast<const SimpleDateFormat*>(this)->_formatBatch(dates, count, appendTo, offsets, status);
+        return appendTo;
+    }
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    for (int32_t i = 0; i < count; ++i) {
+        format(dates[i], appendTo, pos);
+        if (offsets != NULL) {
+            offsets[i] = appendTo.length();
+        }
+    }
+    return appendTo;
+}
+
+//----------------------------------------------------------------------
+
 UDate
 DateFormat::parse(const UnicodeString& text,
                   ParsePosition& pos) const
 {
     UDate d = 0; // Error return UDate is 0 (the epoch)
     if (fCalendar != NULL) {
+        if (getDynamicClassID() == SimpleDateFormat::getStaticClassID()) {
+            // A fixed numeric pattern needs no Calendar clone.
+            int32_t zoneOffset;
+            UBool hasZoneOffset;
+            if (static_cast<const SimpleDateFormat*>(this)->parseFixedNumeric(
+                    text, pos, *fCalendar, d, zoneOffset, hasZoneOffset)) {
+                return d;
+            }
+        }
         Calendar* calClone = fCalendar->clone();
         if (calClone != NULL) {
             int32_t start = pos.getIndex();
@@ -497,6 +554,7 @@ DateFormat::createInstanceForSkeleton(
 DateFormat* U_EXPORT2
 DateFormat::create(EStyle timeStyle, EStyle dateStyle, const Locale& locale)
 {
+    MemoryTagScope memoryTag(UMEM_TAG_FORMATTING);
     UErrorCode status = U_ZERO_ERROR;
 #if U_PLATFORM_USES_ONLY_WIN32_API
     char buffer[8];
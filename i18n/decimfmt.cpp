@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include "unicode/errorcode.h"
 #include "unicode/decimfmt.h"
+#include "unicode/numberparser.h"
 #include "number_decimalquantity.h"
 #include "number_types.h"
 #include "numparse_impl.h"
@@ -551,40 +552,50 @@ void DecimalFormat::parse(const UnicodeString& text, Formattable& output,
     }
 
     ErrorCode status;
-    ParsedNumber result;
     // Note: if this is a currency instance, currencies will be matched despite the fact that we are not in the
     // parseCurrency method (backwards compatibility)
-    int32_t startIndex = parsePosition.getIndex();
     const NumberParserImpl* parser = getParser(status);
     if (U_FAILURE(status)) { return; }
-    parser->parse(text, startIndex, true, result, status);
+    parseWith(*parser, text, output, parsePosition);
+}
+
+CurrencyAmount* DecimalFormat::parseCurrency(const UnicodeString& text, ParsePosition& parsePosition) const {
+    if (parsePosition.getIndex() < 0 || parsePosition.getIndex() >= text.length()) {
+        return nullptr;
+    }
+
+    ErrorCode status;
+    const NumberParserImpl* parser = getCurrencyParser(status);
+    if (U_FAILURE(status)) { return nullptr; }
+    return parseCurrencyWith(*parser, text, parsePosition);
+}
+
+void DecimalFormat::parseWith(const NumberParserImpl& parser, const UnicodeString& text,
+                              Formattable& output, ParsePosition& parsePosition) {
+    ErrorCode status;
+    ParsedNumber result;
+    int32_t startIndex = parsePosition.getIndex();
+    parser.parse(text, startIndex, true, result, status);
     // TODO: Do we need to check for fImpl->properties->parseAllInput (UCONFIG_HAVE_PARSEALLINPUT) here?
     if (result.success()) {
         parsePosition.setIndex(result.charEnd);
-        result.populateFormattable(output, parser->getParseFlags());
+        result.populateFormattable(output, parser.getParseFlags());
     } else {
         parsePosition.setErrorIndex(startIndex + result.charEnd);
     }
 }
 
-CurrencyAmount* DecimalFormat::parseCurrency(const UnicodeString& text, ParsePosition& parsePosition) const {
-    if (parsePosition.getIndex() < 0 || parsePosition.getIndex() >= text.length()) {
-        return nullptr;
-    }
-
+CurrencyAmount* DecimalFormat::parseCurrencyWith(const NumberParserImpl& parser, const UnicodeString& text,
+                                                 ParsePosition& parsePosition) {
     ErrorCode status;
     ParsedNumber result;
-    // Note: if this is a currency instance, currencies will be matched despite the fact that we are not in the
-    // parseCurrency method (backwards compatibility)
     int32_t startIndex = parsePosition.getIndex();
-    const NumberParserImpl* parser = getCurrencyParser(status);
-    if (U_FAILURE(status)) { return nullptr; }
-    parser->parse(text, startIndex, true, result, status);
+    parser.parse(text, startIndex, true, result, status);
     // TODO: Do we need to check for fImpl->properties->parseAllInput (UCONFIG_HAVE_PARSEALLINPUT) here?
     if (result.success()) {
         parsePosition.setIndex(result.charEnd);
         Formattable formattable;
-        result.populateFormattable(formattable, parser->getParseFlags());
+        result.populateFormattable(formattable, parser.getParseFlags());
         return new CurrencyAmount(formattable, result.currencyCode, status);
     } else {
         parsePosition.setErrorIndex(startIndex + result.charEnd);
@@ -592,6 +603,65 @@ CurrencyAmount* DecimalFormat::parseCurrency(const UnicodeString& text, ParsePos
     }
 }
 
+NumberParser DecimalFormat::toNumberParser(UErrorCode& status) const {
+    NumberParser result;
+    if (U_FAILURE(status)) { return result; }
+    LocalPointer<const NumberParserImpl> parser(
+            NumberParserImpl::createParserFromProperties(*fields->properties, *fields->symbols, false, status),
+            status);
+    LocalPointer<const NumberParserImpl> currencyParser(
+            NumberParserImpl::createParserFromProperties(*fields->properties, *fields->symbols, true, status),
+            status);
+    if (U_FAILURE(status)) { return result; }
+    result.fParser = parser.orphan();
+    result.fCurrencyParser = currencyParser.orphan();
+    return result;
+}
+
+NumberParser::NumberParser(NumberParser&& src) U_NOEXCEPT
+        : fParser(src.fParser), fCurrencyParser(src.fCurrencyParser) {
+    src.fParser = nullptr;
+    src.fCurrencyParser = nullptr;
+}
+
+NumberParser& NumberParser::operator=(NumberParser&& src) U_NOEXCEPT {
+    if (this == &src) { return *this; }
+    delete fParser;
+    delete fCurrencyParser;
+    fParser = src.fParser;
+    fCurrencyParser = src.fCurrencyParser;
+    src.fParser = nullptr;
+    src.fCurrencyParser = nullptr;
+    return *this;
+}
+
+NumberParser::~NumberParser() {
+    delete fParser;
+    delete fCurrencyParser;
+}
+
+void NumberParser::parse(const UnicodeString& text, Formattable& result, ParsePosition& parsePosition) const {
+    if (parsePosition.getIndex() < 0 || parsePosition.getIndex() >= text.length()) {
+        return;
+    }
+    if (fParser == nullptr) {
+        parsePosition.setErrorIndex(parsePosition.getIndex());
+        return;
+    }
+    DecimalFormat::parseWith(*fParser, text, result, parsePosition);
+}
+
+CurrencyAmount* NumberParser::parseCurrency(const UnicodeString& text, ParsePosition& parsePosition) const {
+    if (parsePosition.getIndex() < 0 || parsePosition.getIndex() >= text.length()) {
+        return nullptr;
+    }
+    if (fCurrencyParser == nullptr) {
+        parsePosition.setErrorIndex(parsePosition.getIndex());
+        return nullptr;
+    }
+    return DecimalFormat::parseCurrencyWith(*fCurrencyParser, text, parsePosition);
+}
+
 const DecimalFormatSymbols* DecimalFormat::getDecimalFormatSymbols(void) const {
     return fields->symbols.getAlias();
 }
@@ -1369,6 +1439,14 @@ bool DecimalFormat::fastFormatInt64(int64_t input, UnicodeString& output) const
     return true;
 }
 
+UBool DecimalFormat::formatIntegerFast(int32_t number, UnicodeString& appendTo) const {
+    // With fewer than 10 maximum integer digits, high-order digits could be dropped.
+    if (fields == nullptr || !fields->canUseFastFormat || fields->fastData.maxInt < 10) {
+        return FALSE;
+    }
+    return fastFormatInt64(number, appendTo);
+}
+
 void DecimalFormat::doFastFormatInt32(int32_t input, bool isNegative, UnicodeString& output) const {
     U_ASSERT(fields->canUseFastFormat);
     if (isNegative) {
@@ -232,7 +232,7 @@ static const char gDayPeriodTag[]="dayPeriod";
 
 static const char gContextTransformsTag[]="contextTransforms";
 
-static UMutex LOCK = U_MUTEX_INITIALIZER;
+static UMutex LOCK = U_NAMED_MUTEX_INITIALIZER("DateFormatSymbols");
 
 /**
  * Jitterbug 2974: MSVC has a bug whereby new X[0] behaves badly.
@@ -295,6 +295,14 @@ DateFormatSymbols::DateFormatSymbols(const DateFormatSymbols& other)
     copyData(other);
 }
 
+DateFormatSymbols::DateFormatSymbols()
+    : UObject()
+{
+    initializeEmpty();
+    validLocale[0] = 0;
+    actualLocale[0] = 0;
+}
+
 void
 DateFormatSymbols::assignArray(UnicodeString*& dstArray,
                                int32_t& dstCount,
@@ -2022,10 +2030,8 @@ UnicodeString* loadDayPeriodStrings(CalendarDataSink &sink, CharString &path,
 
 
 void
-DateFormatSymbols::initializeData(const Locale& locale, const char *type, UErrorCode& status, UBool useLastResortData)
+DateFormatSymbols::initializeEmpty()
 {
-    int32_t len = 0;
-    /* In case something goes wrong, initialize all of the data to NULL. */
     fEras = NULL;
     fErasCount = 0;
     fEraNames = NULL;
@@ -2096,6 +2102,14 @@ DateFormatSymbols::initializeData(const Locale& locale, const char *type, UError
     fStandaloneNarrowDayPeriods = NULL;
     fStandaloneNarrowDayPeriodsCount = 0;
     uprv_memset(fCapitalization, 0, sizeof(fCapitalization));
+}
+
+void
+DateFormatSymbols::initializeData(const Locale& locale, const char *type, UErrorCode& status, UBool useLastResortData)
+{
+    int32_t len = 0;
+    /* In case something goes wrong, initialize all of the data to NULL. */
+    initializeEmpty();
 
     // We need to preserve the requested locale for
     // lazy ZoneStringFormat instantiation.  ZoneStringFormat
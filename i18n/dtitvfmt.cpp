@@ -26,7 +26,7 @@
 #include "cmemory.h"
 #include "cstring.h"
 #include "dtitv_impl.h"
-#include "mutex.h"
+#include "umutex.h"
 #include "uresimp.h"
 
 #ifdef DTITVFMT_DEBUG
@@ -67,10 +67,63 @@ static const UChar gEarlierFirstPrefix[] = {LOW_E, LOW_A, LOW_R, LOW_L, LOW_I, L
 
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(DateIntervalFormat)
 
-// Mutex, protects access to fDateFormat, fFromCalendar and fToCalendar.
-//        Needed because these data members are modified by const methods of DateIntervalFormat.
+/**
+ * The date formatters that formatting uses besides fDateFormat: one for each part
+ * of each interval pattern, and ones for the date and time patterns of the fallback.
+ * Each is a clone of fDateFormat with its pattern applied, created on first use.
+ * Formatting never applies a pattern to a shared formatter, so concurrent calls of
+ * the const methods need no lock.
+ */
+struct DateIntervalFormat::CompiledFormats : public UMemory {
+    enum {
+        // 2 * interval pattern index + 0 for the first and 1 for the second part
+        DATE_PATTERN_INDEX = 2 * DateIntervalInfo::kIPI_MAX_INDEX,
+        TIME_PATTERN_INDEX,
+        FORMAT_COUNT
+    };
+
+    CompiledFormats() {
+        for (int32_t i = 0; i < FORMAT_COUNT; ++i) {
+            formats[i] = NULL;
+            initOnce[i].reset();
+            initOnce[i].fErrCode = U_ZERO_ERROR;
+        }
+        calendarUsers = 0;
+    }
+
+    ~CompiledFormats() {
+        for (int32_t i = 0; i < FORMAT_COUNT; ++i) {
+            delete formats[i];
+        }
+    }
+
+    SimpleDateFormat* formats[FORMAT_COUNT];
+    UInitOnce initOnce[FORMAT_COUNT];
+
+    // Number of format(DateInterval) calls that want to use fFromCalendar and fToCalendar.
+    // Only the first one does; the others use their own calendars.
+    u_atomic_int32_t calendarUsers;
+};
+
+namespace {
+
+struct CompileRequest {
+    const SimpleDateFormat* dateFormat;
+    const UnicodeString* pattern;
+    SimpleDateFormat** result;
+};
 
-static UMutex gFormatterMutex = U_MUTEX_INITIALIZER;
+void U_CALLCONV compileFormat(const CompileRequest* request, UErrorCode& status) {
+    SimpleDateFormat* format = static_cast<SimpleDateFormat*>(request->dateFormat->clone());
+    if (format == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    format->applyPattern(*request->pattern);
+    *request->result = format;
+}
+
+}  // namespace
 
 DateIntervalFormat* U_EXPORT2
 DateIntervalFormat::createInstance(const UnicodeString& skeleton,
@@ -124,6 +177,7 @@ DateIntervalFormat::DateIntervalFormat()
     fDateFormat(NULL),
     fFromCalendar(NULL),
     fToCalendar(NULL),
+    fCompiledFormats(NULL),
     fLocale(Locale::getRoot()),
     fDatePattern(NULL),
     fTimePattern(NULL),
@@ -137,6 +191,7 @@ DateIntervalFormat::DateIntervalFormat(const DateIntervalFormat& itvfmt)
     fDateFormat(NULL),
     fFromCalendar(NULL),
     fToCalendar(NULL),
+    fCompiledFormats(NULL),
     fLocale(itvfmt.fLocale),
     fDatePattern(NULL),
     fTimePattern(NULL),
@@ -155,23 +210,19 @@ DateIntervalFormat::operator=(const DateIntervalFormat& itvfmt) {
         delete fDatePattern;
         delete fTimePattern;
         delete fDateTimeFormat;
-        {
-            Mutex lock(&gFormatterMutex);
-            if ( itvfmt.fDateFormat ) {
-                fDateFormat = (SimpleDateFormat*)itvfmt.fDateFormat->clone();
-            } else {
-                fDateFormat = NULL;
-            }
-            if ( itvfmt.fFromCalendar ) {
-                fFromCalendar = itvfmt.fFromCalendar->clone();
-            } else {
-                fFromCalendar = NULL;
-            }
-            if ( itvfmt.fToCalendar ) {
-                fToCalendar = itvfmt.fToCalendar->clone();
-            } else {
-                fToCalendar = NULL;
-            }
+        if ( itvfmt.fDateFormat ) {
+            fDateFormat = (SimpleDateFormat*)itvfmt.fDateFormat->clone();
+        } else {
+            fDateFormat = NULL;
+        }
+        // Clone the master calendar rather than the work calendars,
+        // which another thread may be using.
+        if ( fDateFormat && fDateFormat->getCalendar() ) {
+            fFromCalendar = fDateFormat->getCalendar()->clone();
+            fToCalendar = fDateFormat->getCalendar()->clone();
+        } else {
+            fFromCalendar = NULL;
+            fToCalendar = NULL;
         }
         if ( itvfmt.fInfo ) {
             fInfo = itvfmt.fInfo->clone();
@@ -187,6 +238,7 @@ DateIntervalFormat::operator=(const DateIntervalFormat& itvfmt) {
         fDatePattern    = (itvfmt.fDatePattern)?    (UnicodeString*)itvfmt.fDatePattern->clone(): NULL;
         fTimePattern    = (itvfmt.fTimePattern)?    (UnicodeString*)itvfmt.fTimePattern->clone(): NULL;
         fDateTimeFormat = (itvfmt.fDateTimeFormat)? (UnicodeString*)itvfmt.fDateTimeFormat->clone(): NULL;
+        resetCompiledFormats();
     }
     return *this;
 }
@@ -197,6 +249,7 @@ DateIntervalFormat::~DateIntervalFormat() {
     delete fDateFormat;
     delete fFromCalendar;
     delete fToCalendar;
+    delete fCompiledFormats;
     delete fDatePattern;
     delete fTimePattern;
     delete fDateTimeFormat;
@@ -217,12 +270,10 @@ DateIntervalFormat::operator==(const Format& other) const {
     if (!Format::operator==(other)) {return FALSE;}
     if ((fInfo != fmt->fInfo) && (fInfo == NULL || fmt->fInfo == NULL)) {return FALSE;}
     if (fInfo && fmt->fInfo && (*fInfo != *fmt->fInfo )) {return FALSE;}
-    {
-        Mutex lock(&gFormatterMutex);
-        if (fDateFormat != fmt->fDateFormat && (fDateFormat == NULL || fmt->fDateFormat == NULL)) {return FALSE;}
-        if (fDateFormat && fmt->fDateFormat && (*fDateFormat != *fmt->fDateFormat)) {return FALSE;}
-    }
-    // note: fFromCalendar and fToCalendar hold no persistent state, and therefore do not participate in operator ==.
+    if (fDateFormat != fmt->fDateFormat && (fDateFormat == NULL || fmt->fDateFormat == NULL)) {return FALSE;}
+    if (fDateFormat && fmt->fDateFormat && (*fDateFormat != *fmt->fDateFormat)) {return FALSE;}
+    // note: fFromCalendar, fToCalendar and fCompiledFormats hold no persistent state,
+    //       and therefore do not participate in operator ==.
     //       fDateFormat has the master calendar for the DateIntervalFormat.
     if (fSkeleton != fmt->fSkeleton) {return FALSE;}
     if (fDatePattern != fmt->fDatePattern && (fDatePattern == NULL || fmt->fDatePattern == NULL)) {return FALSE;}
@@ -271,15 +322,28 @@ DateIntervalFormat::format(const DateInterval* dtInterval,
     if ( U_FAILURE(status) ) {
         return appendTo;
     }
-    if (fFromCalendar == NULL || fToCalendar == NULL || fDateFormat == NULL || fInfo == NULL) {
+    if (fFromCalendar == NULL || fToCalendar == NULL || fDateFormat == NULL || fInfo == NULL ||
+            fCompiledFormats == NULL) {
         status = U_INVALID_STATE_ERROR;
         return appendTo;
     }
 
-    Mutex lock(&gFormatterMutex);
-    fFromCalendar->setTime(dtInterval->getFromDate(), status);
-    fToCalendar->setTime(dtInterval->getToDate(), status);
-    return formatImpl(*fFromCalendar, *fToCalendar, appendTo,fieldPosition, status);
+    // Use the work calendars, unless another thread is using them.
+    if (umtx_atomic_inc(&fCompiledFormats->calendarUsers) == 1) {
+        fFromCalendar->setTime(dtInterval->getFromDate(), status);
+        fToCalendar->setTime(dtInterval->getToDate(), status);
+        formatImpl(*fFromCalendar, *fToCalendar, appendTo, fieldPosition, status);
+    } else {
+        LocalPointer<Calendar> fromCalendar(fDateFormat->getCalendar()->clone(), status);
+        LocalPointer<Calendar> toCalendar(fDateFormat->getCalendar()->clone(), status);
+        if (U_SUCCESS(status)) {
+            fromCalendar->setTime(dtInterval->getFromDate(), status);
+            toCalendar->setTime(dtInterval->getToDate(), status);
+            formatImpl(*fromCalendar, *toCalendar, appendTo, fieldPosition, status);
+        }
+    }
+    umtx_atomic_dec(&fCompiledFormats->calendarUsers);
+    return appendTo;
 }
 
 
@@ -289,7 +353,6 @@ DateIntervalFormat::format(Calendar& fromCalendar,
                            UnicodeString& appendTo,
                            FieldPosition& pos,
                            UErrorCode& status) const {
-    Mutex lock(&gFormatterMutex);
     return formatImpl(fromCalendar, toCalendar, appendTo, pos, status);
 }
 
@@ -303,6 +366,10 @@ DateIntervalFormat::formatImpl(Calendar& fromCalendar,
     if ( U_FAILURE(status) ) {
         return appendTo;
     }
+    if (fDateFormat == NULL || fInfo == NULL || fCompiledFormats == NULL) {
+        status = U_INVALID_STATE_ERROR;
+        return appendTo;
+    }
 
     // not support different calendar types and time zones
     //if ( fromCalendar.getType() != toCalendar.getType() ) {
@@ -365,19 +432,19 @@ DateIntervalFormat::formatImpl(Calendar& fromCalendar,
              */
             return fDateFormat->format(fromCalendar, appendTo, pos);
         }
-        return fallbackFormat(fromCalendar, toCalendar, fromToOnSameDay, appendTo, pos, status);
+        return fallbackFormat(fromCalendar, toCalendar, fromToOnSameDay, *fDateFormat, appendTo, pos, status);
     }
     // If the first part in interval pattern is empty,
     // the 2nd part of it saves the full-pattern used in fall-back.
     // For a 'real' interval pattern, the first part will never be empty.
     if ( intervalPattern.firstPart.isEmpty() ) {
         // fall back
-        UnicodeString originalPattern;
-        fDateFormat->toPattern(originalPattern);
-        fDateFormat->applyPattern(intervalPattern.secondPart);
-        appendTo = fallbackFormat(fromCalendar, toCalendar, fromToOnSameDay, appendTo, pos, status);
-        fDateFormat->applyPattern(originalPattern);
-        return appendTo;
+        const SimpleDateFormat* fullFormat =
+            getCompiledFormat(2 * itvPtnIndex + 1, intervalPattern.secondPart, status);
+        if ( U_FAILURE(status) ) {
+            return appendTo;
+        }
+        return fallbackFormat(fromCalendar, toCalendar, fromToOnSameDay, *fullFormat, appendTo, pos, status);
     }
     Calendar* firstCal;
     Calendar* secondCal;
@@ -388,26 +455,50 @@ DateIntervalFormat::formatImpl(Calendar& fromCalendar,
         firstCal = &fromCalendar;
         secondCal = &toCalendar;
     }
-    // break the interval pattern into 2 parts,
+    // the interval pattern is broken into 2 parts,
     // first part should not be empty,
-    UnicodeString originalPattern;
-    fDateFormat->toPattern(originalPattern);
-    fDateFormat->applyPattern(intervalPattern.firstPart);
-    fDateFormat->format(*firstCal, appendTo, pos);
+    const SimpleDateFormat* firstFormat =
+        getCompiledFormat(2 * itvPtnIndex, intervalPattern.firstPart, status);
+    const SimpleDateFormat* secondFormat = NULL;
     if ( !intervalPattern.secondPart.isEmpty() ) {
-        fDateFormat->applyPattern(intervalPattern.secondPart);
+        secondFormat = getCompiledFormat(2 * itvPtnIndex + 1, intervalPattern.secondPart, status);
+    }
+    if ( U_FAILURE(status) ) {
+        return appendTo;
+    }
+    firstFormat->format(*firstCal, appendTo, pos);
+    if ( secondFormat != NULL ) {
         FieldPosition otherPos;
         otherPos.setField(pos.getField());
-        fDateFormat->format(*secondCal, appendTo, otherPos);
+        secondFormat->format(*secondCal, appendTo, otherPos);
         if (pos.getEndIndex() == 0 && otherPos.getEndIndex() > 0) {
             pos = otherPos;
         }
     }
-    fDateFormat->applyPattern(originalPattern);
     return appendTo;
 }
 
 
+const SimpleDateFormat*
+DateIntervalFormat::getCompiledFormat(int32_t index,
+                                      const UnicodeString& pattern,
+                                      UErrorCode& status) const {
+    const CompileRequest request = { fDateFormat, &pattern, &fCompiledFormats->formats[index] };
+    umtx_initOnce(fCompiledFormats->initOnce[index], &compileFormat, &request, status);
+    if ( U_FAILURE(status) ) {
+        return NULL;
+    }
+    return fCompiledFormats->formats[index];
+}
+
+
+void
+DateIntervalFormat::resetCompiledFormats() {
+    delete fCompiledFormats;
+    fCompiledFormats = new CompiledFormats();
+}
+
+
 
 void
 DateIntervalFormat::parseObject(const UnicodeString& /* source */,
@@ -444,6 +535,7 @@ DateIntervalFormat::setDateIntervalInfo(const DateIntervalInfo& newItvPattern,
     if (fDateFormat) {
         initializePattern(status);
     }
+    resetCompiledFormats();
 }
 
 
@@ -470,6 +562,7 @@ DateIntervalFormat::adoptTimeZone(TimeZone* zone)
     if (fToCalendar) {
         fToCalendar->setTimeZone(*zone);
     }
+    resetCompiledFormats();
 }
 
 void
@@ -486,13 +579,13 @@ DateIntervalFormat::setTimeZone(const TimeZone& zone)
     if (fToCalendar) {
         fToCalendar->setTimeZone(zone);
     }
+    resetCompiledFormats();
 }
 
 const TimeZone&
 DateIntervalFormat::getTimeZone() const
 {
     if (fDateFormat != NULL) {
-        Mutex lock(&gFormatterMutex);
         return fDateFormat->getTimeZone();
     }
     // If fDateFormat is NULL (unexpected), create default timezone.
@@ -507,6 +600,7 @@ DateIntervalFormat::DateIntervalFormat(const Locale& locale,
     fDateFormat(NULL),
     fFromCalendar(NULL),
     fToCalendar(NULL),
+    fCompiledFormats(NULL),
     fLocale(locale),
     fDatePattern(NULL),
     fTimePattern(NULL),
@@ -529,6 +623,7 @@ DateIntervalFormat::DateIntervalFormat(const Locale& locale,
         fToCalendar = fDateFormat->getCalendar()->clone();
     }
     initializePattern(status);
+    resetCompiledFormats();
 }
 
 DateIntervalFormat* U_EXPORT2
@@ -1335,25 +1430,28 @@ UnicodeString&
 DateIntervalFormat::fallbackFormat(Calendar& fromCalendar,
                                    Calendar& toCalendar,
                                    UBool fromToOnSameDay, // new
+                                   const SimpleDateFormat& dateFormat,
                                    UnicodeString& appendTo,
                                    FieldPosition& pos,
                                    UErrorCode& status) const {
     if ( U_FAILURE(status) ) {
         return appendTo;
     }
-    UnicodeString fullPattern; // for saving the pattern in fDateFormat
     UBool formatDatePlusTimeRange = (fromToOnSameDay && fDatePattern && fTimePattern);
     // the fall back
+    const SimpleDateFormat* rangeFormat = &dateFormat;
     if (formatDatePlusTimeRange) {
-        fDateFormat->toPattern(fullPattern); // save current pattern, restore later
-        fDateFormat->applyPattern(*fTimePattern);
+        rangeFormat = getCompiledFormat(CompiledFormats::TIME_PATTERN_INDEX, *fTimePattern, status);
+        if ( U_FAILURE(status) ) {
+            return appendTo;
+        }
     }
     FieldPosition otherPos;
     otherPos.setField(pos.getField());
     UnicodeString earlierDate;
-    fDateFormat->format(fromCalendar, earlierDate, pos);
+    rangeFormat->format(fromCalendar, earlierDate, pos);
     UnicodeString laterDate;
-    fDateFormat->format(toCalendar, laterDate, otherPos);
+    rangeFormat->format(toCalendar, laterDate, otherPos);
     UnicodeString fallbackPattern;
     fInfo->getFallbackIntervalPattern(fallbackPattern);
     adjustPosition(fallbackPattern, earlierDate, pos, laterDate, otherPos, pos);
@@ -1362,11 +1460,15 @@ DateIntervalFormat::fallbackFormat(Calendar& fromCalendar,
             format(earlierDate, laterDate, fallbackRange, status);
     if ( U_SUCCESS(status) && formatDatePlusTimeRange ) {
         // fallbackRange has just the time range, need to format the date part and combine that
-        fDateFormat->applyPattern(*fDatePattern);
+        const SimpleDateFormat* dateOnlyFormat =
+            getCompiledFormat(CompiledFormats::DATE_PATTERN_INDEX, *fDatePattern, status);
+        if ( U_FAILURE(status) ) {
+            return appendTo;
+        }
         UnicodeString datePortion;
         otherPos.setBeginIndex(0);
         otherPos.setEndIndex(0);
-        fDateFormat->format(fromCalendar, datePortion, otherPos);
+        dateOnlyFormat->format(fromCalendar, datePortion, otherPos);
         adjustPosition(*fDateTimeFormat, fallbackRange, pos, datePortion, otherPos, pos);
         const UnicodeString *values[2] = {
             &fallbackRange,  // {0} is time range
@@ -1378,10 +1480,6 @@ DateIntervalFormat::fallbackFormat(Calendar& fromCalendar,
     if ( U_SUCCESS(status) ) {
         appendTo.append(fallbackRange);
     }
-    if (formatDatePlusTimeRange) {
-        // restore full pattern
-        fDateFormat->applyPattern(fullPattern);
-    }
     return appendTo;
 }
 
@@ -41,6 +41,8 @@
 #include "ucln_in.h"
 #include "charstr.h"
 #include "uassert.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
 
 #if U_CHARSET_FAMILY==U_EBCDIC_FAMILY
 /**
@@ -300,8 +302,59 @@ DateTimePatternGenerator::createInstance(UErrorCode& status) {
     return createInstance(Locale::getDefault(), status);
 }
 
+// The generator for a locale is created only once, and then shared through the
+// unified cache. It is never modified: createInstance() returns copies of it.
+class SharedDateTimePatternGenerator : public SharedObject {
+public:
+    const DateTimePatternGenerator *ptr;
+
+    SharedDateTimePatternGenerator(DateTimePatternGenerator *dtpgToAdopt) : ptr(dtpgToAdopt) { }
+    virtual ~SharedDateTimePatternGenerator();
+};
+
+SharedDateTimePatternGenerator::~SharedDateTimePatternGenerator() {
+    delete ptr;
+}
+
+template<> U_I18N_API
+const SharedDateTimePatternGenerator *LocaleCacheKey<SharedDateTimePatternGenerator>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    LocalPointer<DateTimePatternGenerator> dtpg(
+            DateTimePatternGenerator::internalMakeInstance(fLoc, status), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    SharedDateTimePatternGenerator *result = new SharedDateTimePatternGenerator(dtpg.getAlias());
+    if (result == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    dtpg.orphan();
+    result->addRef();
+    return result;
+}
+
 DateTimePatternGenerator* U_EXPORT2
 DateTimePatternGenerator::createInstance(const Locale& locale, UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    const SharedDateTimePatternGenerator *shared = nullptr;
+    UnifiedCache::getByLocale(locale, shared, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    LocalPointer<DateTimePatternGenerator> result(
+            new DateTimePatternGenerator(*shared->ptr), status);
+    shared->removeRef();
+    if (U_SUCCESS(status) && U_FAILURE(result->internalErrorCode)) {
+        status = result->internalErrorCode;
+    }
+    return U_SUCCESS(status) ? result.orphan() : nullptr;
+}
+
+DateTimePatternGenerator* U_EXPORT2
+DateTimePatternGenerator::internalMakeInstance(const Locale& locale, UErrorCode& status) {
     if (U_FAILURE(status)) {
         return nullptr;
     }
@@ -376,6 +429,7 @@ DateTimePatternGenerator::operator=(const DateTimePatternGenerator& other) {
     internalErrorCode = other.internalErrorCode;
     pLocale = other.pLocale;
     fDefaultHourFormatChar = other.fDefaultHourFormatChar;
+    uprv_memcpy(fAllowedHourFormats, other.fAllowedHourFormats, sizeof(fAllowedHourFormats));
     *fp = *(other.fp);
     dtMatcher->copyFrom(other.dtMatcher->skeleton);
     *distanceInfo = *(other.distanceInfo);
@@ -904,8 +904,27 @@ GregorianCalendar::roll(UCalendarDateFields field, int32_t amount, UErrorCode& s
                             }
 
     case UCAL_DAY_OF_MONTH:
-        if( !inCutoverMonth ) { 
-            Calendar::roll(field, amount, status);
+        if( !inCutoverMonth ) {
+            // Same as Calendar::roll(), but the fields are already complete,
+            // so take the month length from them rather than from
+            // getActualMaximum(), which computes it on a clone.
+            // With non-default wall time options, midnight of the first of
+            // the month can resolve into the previous month on the clone,
+            // so leave those to Calendar::roll().
+            if (getSkippedWallTimeOption() != UCAL_WALLTIME_LAST ||
+                    getRepeatedWallTimeOption() != UCAL_WALLTIME_LAST) {
+                Calendar::roll(field, amount, status);
+                return;
+            }
+            if (U_FAILURE(status)) {
+                return;
+            }
+            int32_t max = monthLength(internalGet(UCAL_MONTH));
+            int32_t dom = (internalGet(UCAL_DAY_OF_MONTH) - 1 + amount % max) % max;
+            if (dom < 0) {
+                dom += max;
+            }
+            set(UCAL_DAY_OF_MONTH, dom + 1);
             return;
         } else {
             // [j81] 1582 special case for DOM
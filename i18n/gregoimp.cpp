@@ -16,6 +16,7 @@
 #if !UCONFIG_NO_FORMATTING
 
 #include "unicode/ucal.h"
+#include "unicode/timezone.h"
 #include "uresimp.h"
 #include "cstring.h"
 #include "uassert.h"
@@ -142,6 +143,24 @@ void Grego::timeToFields(UDate time, int32_t& year, int32_t& month,
     dayToFields(day, year, month, dom, dow, doy);
 }
 
+void Grego::timeToFields(UDate time, const TimeZone& zone, GregorianFields& fields, UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    fields.time = time;
+    zone.getOffset(time, FALSE, fields.rawOffset, fields.dstOffset, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    double millisInDay;
+    double day = ClockMath::floorDivide(time + fields.rawOffset + fields.dstOffset,
+                                        (double)U_MILLIS_PER_DAY, millisInDay);
+    fields.millisInDay = (int32_t)millisInDay;
+    fields.julianDay = (int32_t)day + kEpochStartAsJulianDay;
+    dayToFields(day, fields.extendedYear, fields.month, fields.dayOfMonth,
+                fields.dayOfWeek, fields.dayOfYear);
+}
+
 int32_t Grego::dayOfWeek(double day) {
     int32_t dow;
     ClockMath::floorDivide(day + UCAL_THURSDAY, 7, dow);
@@ -160,6 +179,64 @@ int32_t Grego::dayOfWeekInMonth(int32_t year, int32_t month, int32_t dom) {
     return weekInMonth;
 }
 
+int32_t GregorianFields::get(UCalendarDateFields field) const {
+    switch (field) {
+    case UCAL_ERA:
+        return extendedYear >= 1 ? 1 : 0;  // GregorianCalendar::AD : GregorianCalendar::BC
+    case UCAL_YEAR:
+        return extendedYear >= 1 ? extendedYear : 1 - extendedYear;
+    case UCAL_EXTENDED_YEAR:
+        return extendedYear;
+    case UCAL_MONTH:
+        return month;
+    case UCAL_DATE:
+        return dayOfMonth;
+    case UCAL_DAY_OF_YEAR:
+        return dayOfYear;
+    case UCAL_DAY_OF_WEEK:
+        return dayOfWeek;
+    case UCAL_DAY_OF_WEEK_IN_MONTH:
+        return (dayOfMonth - 1) / 7 + 1;
+    case UCAL_AM_PM:
+        return millisInDay / (12 * U_MILLIS_PER_HOUR);
+    case UCAL_HOUR:
+        return (millisInDay / U_MILLIS_PER_HOUR) % 12;
+    case UCAL_HOUR_OF_DAY:
+        return millisInDay / U_MILLIS_PER_HOUR;
+    case UCAL_MINUTE:
+        return (millisInDay / U_MILLIS_PER_MINUTE) % 60;
+    case UCAL_SECOND:
+        return (millisInDay / U_MILLIS_PER_SECOND) % 60;
+    case UCAL_MILLISECOND:
+        return millisInDay % U_MILLIS_PER_SECOND;
+    case UCAL_MILLISECONDS_IN_DAY:
+        return millisInDay;
+    case UCAL_JULIAN_DAY:
+        return julianDay;
+    case UCAL_ZONE_OFFSET:
+        return rawOffset;
+    case UCAL_DST_OFFSET:
+        return dstOffset;
+    case UCAL_IS_LEAP_MONTH:
+        return 0;
+    default:
+        U_ASSERT(FALSE);
+        return 0;
+    }
+}
+
+UBool GregorianFields::isSupported(UCalendarDateFields field) {
+    switch (field) {
+    case UCAL_WEEK_OF_YEAR:
+    case UCAL_WEEK_OF_MONTH:
+    case UCAL_YEAR_WOY:
+    case UCAL_DOW_LOCAL:
+        return FALSE;
+    default:
+        return 0 <= field && field < UCAL_FIELD_COUNT;
+    }
+}
+
 U_NAMESPACE_END
 
 #endif
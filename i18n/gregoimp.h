@@ -16,12 +16,56 @@
 #include "unicode/utypes.h"
 #if !UCONFIG_NO_FORMATTING
 
+#include "unicode/ucal.h"
 #include "unicode/ures.h"
 #include "unicode/locid.h"
 #include "putilimp.h"
 
 U_NAMESPACE_BEGIN
 
+class TimeZone;
+
+/**
+ * The calendar fields of a time in the proleptic Gregorian calendar and a time zone,
+ * as computed all at once by Grego::timeToFields(UDate, const TimeZone&, GregorianFields&, UErrorCode&).
+ * This is a lightweight alternative to setting the time of a GregorianCalendar
+ * when only the date and the time of day are needed.
+ * Week-based fields are not available because they depend on locale-specific settings.
+ * @internal
+ */
+struct GregorianFields : public UMemory {
+    /** The UTC time. */
+    UDate time;
+    /** The raw and daylight savings offsets of the time zone, in milliseconds. */
+    int32_t rawOffset;
+    int32_t dstOffset;
+    /** The extended year, with 0 == 1 BCE, -1 == 2 BCE, etc. */
+    int32_t extendedYear;
+    /** 0-based month, with 0==Jan */
+    int32_t month;
+    /** 1-based day of month */
+    int32_t dayOfMonth;
+    /** 1-based day of week, with 1==Sun */
+    int32_t dayOfWeek;
+    /** 1-based day of year */
+    int32_t dayOfYear;
+    /** Milliseconds in the local day */
+    int32_t millisInDay;
+    /** The local Julian day number */
+    int32_t julianDay;
+
+    /**
+     * Returns the value of a calendar field, as Calendar::get() would return it.
+     * @param field a field for which isSupported() returns TRUE
+     */
+    int32_t get(UCalendarDateFields field) const;
+
+    /**
+     * Returns TRUE if get() can return the value of the field.
+     */
+    static UBool isSupported(UCalendarDateFields field);
+};
+
 /**
  * A utility class providing mathematical functions used by time zone
  * and calendar code.  Do not instantiate.  Formerly just named 'Math'.
@@ -219,6 +263,18 @@ class Grego {
     static void timeToFields(UDate time, int32_t& year, int32_t& month,
                             int32_t& dom, int32_t& dow, int32_t& doy, int32_t& mid);
 
+    /**
+     * Convert a 1970-epoch milliseconds to the proleptic Gregorian fields
+     * of the local time in the given time zone.
+     * Unlike Calendar::setTime(), this computes only the fields that do not
+     * depend on the week rules, and it makes just one time zone call.
+     * @param time 1970-epoch milliseconds (UTC)
+     * @param zone the time zone
+     * @param fields output parameter to receive the fields
+     * @param status receives an error if the time zone offset could not be computed
+     */
+    static void timeToFields(UDate time, const TimeZone& zone, GregorianFields& fields, UErrorCode& status);
+
     /**
      * Return the day of week on the 1970-epoch day
      * @param day the 1970-epoch day (integral value)
@@ -134,16 +134,6 @@ static const int16_t  LEAP_MONTH_START[][3] = {
     {  383,        384,        385  },          // Elul
 };
 
-static icu::CalendarCache *gCache =  NULL;
-
-U_CDECL_BEGIN
-static UBool calendar_hebrew_cleanup(void) {
-    delete gCache;
-    gCache = NULL;
-    return TRUE;
-}
-U_CDECL_END
-
 U_NAMESPACE_BEGIN
 //-------------------------------------------------------------------------
 // Constructors...
@@ -387,38 +377,34 @@ static const int32_t BAHARAD = 11*HOUR_PARTS + 204;
 *      http://www.faqs.org/faqs/calendars/faq/</a>
 * </ul>
 */
-int32_t HebrewCalendar::startOfYear(int32_t year, UErrorCode &status)
+int32_t HebrewCalendar::startOfYear(int32_t year, UErrorCode &/*status*/)
 {
-    ucln_i18n_registerCleanup(UCLN_I18N_HEBREW_CALENDAR, calendar_hebrew_cleanup);
-    int32_t day = CalendarCache::get(&gCache, year, status);
-
-    if (day == 0) {
-        int32_t months = (235 * year - 234) / 19;           // # of months before year
+    // This takes only a few integer operations, so the result is not cached:
+    // A CalendarCache lookup would be slower, and it would lock a mutex.
+    int32_t months = (235 * year - 234) / 19;           // # of months before year
 
-        int64_t frac = (int64_t)months * MONTH_FRACT + BAHARAD;  // Fractional part of day #
-        day  = months * 29 + (int32_t)(frac / DAY_PARTS);        // Whole # part of calculation
-        frac = frac % DAY_PARTS;                        // Time of day
+    int64_t frac = (int64_t)months * MONTH_FRACT + BAHARAD;  // Fractional part of day #
+    int32_t day = months * 29 + (int32_t)(frac / DAY_PARTS); // Whole # part of calculation
+    frac = frac % DAY_PARTS;                        // Time of day
 
-        int32_t wd = (day % 7);                        // Day of week (0 == Monday)
+    int32_t wd = (day % 7);                        // Day of week (0 == Monday)
 
-        if (wd == 2 || wd == 4 || wd == 6) {
-            // If the 1st is on Sun, Wed, or Fri, postpone to the next day
-            day += 1;
-            wd = (day % 7);
-        }
-        if (wd == 1 && frac > 15*HOUR_PARTS+204 && !isLeapYear(year) ) {
-            // If the new moon falls after 3:11:20am (15h204p from the previous noon)
-            // on a Tuesday and it is not a leap year, postpone by 2 days.
-            // This prevents 356-day years.
-            day += 2;
-        }
-        else if (wd == 0 && frac > 21*HOUR_PARTS+589 && isLeapYear(year-1) ) {
-            // If the new moon falls after 9:32:43 1/3am (21h589p from yesterday noon)
-            // on a Monday and *last* year was a leap year, postpone by 1 day.
-            // Prevents 382-day years.
-            day += 1;
-        }
-        CalendarCache::put(&gCache, year, day, status);
+    if (wd == 2 || wd == 4 || wd == 6) {
+        // If the 1st is on Sun, Wed, or Fri, postpone to the next day
+        day += 1;
+        wd = (day % 7);
+    }
+    if (wd == 1 && frac > 15*HOUR_PARTS+204 && !isLeapYear(year) ) {
+        // If the new moon falls after 3:11:20am (15h204p from the previous noon)
+        // on a Tuesday and it is not a leap year, postpone by 2 days.
+        // This prevents 356-day years.
+        day += 2;
+    }
+    else if (wd == 0 && frac > 21*HOUR_PARTS+589 && isLeapYear(year-1) ) {
+        // If the new moon falls after 9:32:43 1/3am (21h589p from yesterday noon)
+        // on a Monday and *last* year was a leap year, postpone by 1 day.
+        // Prevents 382-day years.
+        day += 1;
     }
     return day;
 }
@@ -32,7 +32,11 @@ InputText::InputText(UErrorCode &status)
                                                  //   Value is percent, not absolute.
       fDeclaredEncoding(0),
       fRawInput(0),
-      fRawLength(0)
+      fRawLength(0),
+      fSampleLimit(0),
+      fRawSampleLength(0),
+      fRawHasNUL(FALSE),
+      fRawHasBOM(FALSE)
 {
     if (fInputBytes == NULL || fByteStats == NULL) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -87,6 +91,14 @@ void InputText::MungeInput(UBool fStripTags) {
     int32_t openTags = 0;
     int32_t badTags  = 0;
 
+    //
+    //  Limit the raw input to the sample size, if one was set.
+    //
+    fRawSampleLength = fRawLength;
+    if (fSampleLimit > 0 && fRawSampleLength > fSampleLimit) {
+        fRawSampleLength = fSampleLimit;
+    }
+
     //
     //  html / xml markup stripping.
     //     quick and dirty, not 100% accurate, but hopefully good enough, statistically.
@@ -95,7 +107,7 @@ void InputText::MungeInput(UBool fStripTags) {
     //     guess as to whether the input was actually marked up at all.
     // TODO: Think about how this interacts with EBCDIC charsets that are detected.
     if (fStripTags) {
-        for (srci = 0; srci < fRawLength && dsti < BUFFER_SIZE; srci += 1) {
+        for (srci = 0; srci < fRawSampleLength && dsti < BUFFER_SIZE; srci += 1) {
             b = fRawInput[srci];
 
             if (b == (uint8_t)0x3C) { /* Check for the ASCII '<' */
@@ -125,9 +137,9 @@ void InputText::MungeInput(UBool fStripTags) {
     //    Detection will have to work on the unstripped input.
     //
     if (openTags<5 || openTags/5 < badTags || 
-        (fInputLen < 100 && fRawLength>600))
+        (fInputLen < 100 && fRawSampleLength>600))
     {
-        int32_t limit = fRawLength;
+        int32_t limit = fRawSampleLength;
 
         if (limit > BUFFER_SIZE) {
             limit = BUFFER_SIZE;
@@ -157,6 +169,21 @@ void InputText::MungeInput(UBool fStripTags) {
             break;
         }
     }
+
+    //
+    // Properties of the raw sample that let the detector skip
+    // recognizers which cannot match.
+    //
+    fRawHasNUL = fRawSampleLength > 0 &&
+        uprv_memchr(fRawInput, 0, fRawSampleLength) != NULL;
+    fRawHasBOM =
+        (fRawSampleLength >= 3 &&
+            fRawInput[0] == 0xEF && fRawInput[1] == 0xBB && fRawInput[2] == 0xBF) ||
+        (fRawSampleLength >= 2 &&
+            ((fRawInput[0] == 0xFE && fRawInput[1] == 0xFF) ||
+             (fRawInput[0] == 0xFF && fRawInput[1] == 0xFE))) ||
+        (fRawSampleLength >= 4 &&
+            fRawInput[0] == 0 && fRawInput[1] == 0 && fRawInput[2] == 0xFE && fRawInput[3] == 0xFF);
 }
 
 U_NAMESPACE_END
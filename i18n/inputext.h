@@ -55,6 +55,11 @@ class InputText : public UMemory
     //   buffer here.
     int32_t                  fRawLength;    // Length of data in fRawInput array.
 
+    int32_t   fSampleLimit;      // Maximum number of raw input bytes to be examined, or 0 for all.
+    int32_t   fRawSampleLength;  // Length of the prefix of fRawInput that the recognizers examine.
+    UBool     fRawHasNUL;        // True if there are any NUL bytes in the raw sample.
+    UBool     fRawHasBOM;        // True if the raw sample starts with a Unicode byte order mark.
+
 };
 
 U_NAMESPACE_END
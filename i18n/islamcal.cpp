@@ -202,6 +202,119 @@ int32_t getUmalqura_MonthLength(int32_t y, int32_t m) {
 
 }
 
+/*
+ * Precomputed month lengths of the astronomical (true lunar) Islamic calendar
+ * for the years 1317..1526 AH, about 1900..2100 CE, in the format of UMALQURA_MONTHLENGTH.
+ * They are the results of trueMonthStart() with the CalendarAstronomer,
+ * so using the table does not change any result.
+ * Looking up the table avoids the astroLock and the mutex of the CalendarCache.
+ */
+static const int32_t ASTRONOMICAL_TABLE_YEAR_START = 1317;
+static const int32_t ASTRONOMICAL_TABLE_YEAR_END = 1526;
+static const int32_t ASTRONOMICAL_TABLE_START_DAY = 466345;
+static const int ASTRONOMICAL_MONTHLENGTH[] = {
+    //* 1317 -1321 */ "1011 0110 1001", "0101 0111 0100", "1001 0111 0110", "0100 1011 0111", "0010 0101 0111",
+                            0x0B69,           0x0574,           0x0976,           0x04B7,           0x0257,
+    //* 1322 -1326 */ "0101 0010 1011", "0110 1001 0101", "0110 1100 1010", "1010 1101 0101", "0101 0101 1011",
+                            0x052B,           0x0695,           0x06CA,           0x0AD5,           0x055B,
+    //* 1327 -1331 */ "0010 0101 1101", "1001 0010 1101", "1100 1001 0101", "1101 0100 1010", "1110 1010 0101",
+                            0x025D,           0x092D,           0x0C95,           0x0D4A,           0x0EA5,
+    //* 1332 -1336 */ "0101 1101 0010", "1010 1101 0101", "0101 0101 1010", "1010 1010 1011", "0101 0100 1011",
+                            0x05D2,           0x0AD5,           0x055A,           0x0AAB,           0x054B,
+    //* 1337 -1341 */ "0110 1010 0101", "0111 0101 0010", "1011 1010 1001", "0011 0111 0100", "1001 1011 0110",
+                            0x06A5,           0x0752,           0x0BA9,           0x0374,           0x09B6,
+    //* 1342 -1346 */ "0101 0101 0110", "1010 1010 1010", "1101 0101 0010", "1101 1010 1001", "0101 1101 0100",
+                            0x0556,           0x0AAA,           0x0D52,           0x0DA9,           0x05D4,
+    //* 1347 -1351 */ "1010 1110 1010", "0100 1101 1101", "0010 0110 1110", "1001 0010 1110", "1010 1010 0110",
+                            0x0AEA,           0x04DD,           0x026E,           0x092E,           0x0AA6,
+    //* 1352 -1356 */ "1101 0101 0100", "1101 1010 1010", "0101 1011 0101", "0010 1011 0110", "1001 0011 0111",
+                            0x0D54,           0x0DAA,           0x05B5,           0x02B6,           0x0937,
+    //* 1357 -1361 */ "0100 1001 0111", "1010 0100 1011", "1011 0010 0101", "1011 0101 0010", "1011 0110 1010",
+                            0x0497,           0x0A4B,           0x0B25,           0x0B52,           0x0B6A,
+    //* 1362 -1366 */ "0101 0110 1101", "0100 1010 1101", "1010 0101 0101", "1101 0010 0101", "1110 1001 0010",
+                            0x056D,           0x04AD,           0x0A55,           0x0D25,           0x0E92,
+    //* 1367 -1371 */ "1110 1100 1001", "0110 1101 0100", "1010 1110 1010", "0101 0110 1011", "0100 1010 1011",
+                            0x0EC9,           0x06D4,           0x0AEA,           0x056B,           0x04AB,
+    //* 1372 -1376 */ "0110 1001 0101", "1011 0100 1001", "1011 1010 0100", "1011 1011 0010", "0101 1011 1001",
+                            0x0695,           0x0B49,           0x0BA4,           0x0BB2,           0x05B9,
+    //* 1377 -1381 */ "0010 1011 1010", "1001 0101 1011", "0100 1010 1011", "0101 0101 0101", "0110 1101 0010",
+                            0x02BA,           0x095B,           0x04AB,           0x0555,           0x06D2,
+    //* 1382 -1386 */ "0110 1101 1001", "0010 1110 1100", "1001 0110 1110", "0100 1010 1110", "1010 0101 0110",
+                            0x06D9,           0x02EC,           0x096E,           0x04AE,           0x0A56,
+    //* 1387 -1391 */ "1101 0010 1010", "1101 1001 0101", "0101 1010 1010", "1010 1011 0101", "0100 1011 1011",
+                            0x0D2A,           0x0D95,           0x05AA,           0x0AB5,           0x04BB,
+    //* 1392 -1396 */ "0010 0101 1011", "1001 0010 1011", "1010 1001 0101", "1011 0100 1010", "1011 1010 0101",
+                            0x025B,           0x092B,           0x0A95,           0x0B4A,           0x0BA5,
+    //* 1397 -1401 */ "0101 1010 1010", "1010 1011 0101", "0101 0011 0110", "1010 1001 0110", "1101 0100 1010",
+                            0x05AA,           0x0AB5,           0x0536,           0x0A96,           0x0D4A,
+    //* 1402 -1406 */ "1110 1010 0100", "1111 0101 0010", "0110 1110 1001", "0011 0110 1100", "1010 1010 1101",
+                            0x0EA4,           0x0F52,           0x06E9,           0x036C,           0x0AAD,
+    //* 1407 -1411 */ "0101 0101 0101", "1010 1010 0101", "1011 0101 0010", "1011 1010 1001", "0101 1011 0100",
+                            0x0555,           0x0AA5,           0x0B52,           0x0BA9,           0x05B4,
+    //* 1412 -1416 */ "1001 1011 1010", "0100 1101 1011", "0010 0101 1101", "0101 0010 1101", "1010 1010 0101",
+                            0x09BA,           0x04DB,           0x025D,           0x052D,           0x0AA5,
+    //* 1417 -1421 */ "1010 1101 0100", "1010 1110 1010", "0101 0110 1101", "0010 0110 1110", "1001 0010 1111",
+                            0x0AD4,           0x0AEA,           0x056D,           0x026E,           0x092F,
+    //* 1422 -1426 */ "0100 1001 0111", "0101 0100 1011", "0110 1010 0101", "0110 1101 0100", "1010 1101 1010",
+                            0x0497,           0x054B,           0x06A5,           0x06D4,           0x0ADA,
+    //* 1427 -1431 */ "1001 0101 1011", "0100 1001 1011", "1010 0100 1011", "1101 0010 0101", "1101 1001 0010",
+                            0x095B,           0x049B,           0x0A4B,           0x0D25,           0x0D92,
+    //* 1432 -1436 */ "1101 1010 1001", "0101 1011 0100", "1010 1101 0110", "1001 0101 0110", "1100 1010 1011",
+                            0x0DA9,           0x05B4,           0x0AD6,           0x0956,           0x0CAB,
+    //* 1437 -1441 */ "0110 1001 0011", "0111 0100 1001", "0111 0110 0100", "1011 0110 1010", "0101 0111 0101",
+                            0x0693,           0x0749,           0x0764,           0x0B6A,           0x0575,
+    //* 1442 -1446 */ "0010 1011 0110", "1001 0101 0110", "1010 1010 1010", "1101 0101 0100", "1101 1011 0010",
+                            0x02B6,           0x0956,           0x0AAA,           0x0D54,           0x0DB2,
+    //* 1447 -1451 */ "0101 1101 1001", "0010 1101 1100", "1001 0101 1101", "0100 1010 1101", "1010 0101 0101",
+                            0x05D9,           0x02DC,           0x095D,           0x04AD,           0x0A55,
+    //* 1452 -1456 */ "1010 1010 1010", "1011 0101 0101", "0101 0110 1010", "1001 0111 0101", "0100 1011 0110",
+                            0x0AAA,           0x0B55,           0x056A,           0x0975,           0x04B6,
+    //* 1457 -1461 */ "1010 0101 0111", "0101 0010 1011", "0110 1001 0011", "0111 0100 1010", "1011 0101 0101",
+                            0x0A57,           0x052B,           0x0693,           0x074A,           0x0B55,
+    //* 1462 -1466 */ "0101 0110 1010", "1010 0110 1101", "0101 0010 1101", "1010 1001 0101", "1101 0100 1001",
+                            0x056A,           0x0A6D,           0x052D,           0x0A95,           0x0D49,
+    //* 1467 -1471 */ "1101 1010 0100", "1101 1101 0010", "0110 1101 0101", "0011 0101 1010", "1010 1010 1011",
+                            0x0DA4,           0x0DD2,           0x06D5,           0x035A,           0x0AAB,
+    //* 1472 -1476 */ "0101 0100 1011", "0110 1010 0101", "0111 0101 0010", "0111 0110 1001", "0011 0111 0100",
+                            0x054B,           0x06A5,           0x0752,           0x0769,           0x0374,
+    //* 1477 -1481 */ "1001 0111 0110", "0100 1011 0110", "1010 0101 1010", "1101 0100 1011", "0101 1010 1001",
+                            0x0976,           0x04B6,           0x0A5A,           0x0D4B,           0x05A9,
+    //* 1482 -1486 */ "0101 1101 0100", "1010 1101 1010", "0100 1101 1101", "0010 0101 1110", "1001 0010 1110",
+                            0x05D4,           0x0ADA,           0x04DD,           0x025E,           0x092E,
+    //* 1487 -1491 */ "1010 1001 0110", "1101 0100 1010", "1101 1010 1001", "0101 1011 0100", "1010 1011 0110",
+                            0x0A96,           0x0D4A,           0x0DA9,           0x05B4,           0x0AB6,
+    //* 1492 -1496 */ "1001 0011 0111", "0100 1001 0111", "1010 0100 1011", "1011 0010 0101", "1011 0101 0010",
+                            0x0937,           0x0497,           0x0A4B,           0x0B25,           0x0B52,
+    //* 1497 -1501 */ "1011 0110 1001", "0101 0110 1010", "1010 1010 1101", "1001 0101 0101", "1101 0010 0101",
+                            0x0B69,           0x056A,           0x0AAD,           0x0955,           0x0D25,
+    //* 1502 -1506 */ "1101 1001 0010", "1110 1100 1001", "0110 1101 0100", "1010 1110 1010", "0101 0110 1011",
+                            0x0D92,           0x0EC9,           0x06D4,           0x0AEA,           0x056B,
+    //* 1507 -1511 */ "0010 1010 1101", "0101 0101 0101", "1010 1010 1001", "1011 0110 0100", "1011 1011 0010",
+                            0x02AD,           0x0555,           0x0AA9,           0x0B64,           0x0BB2,
+    //* 1512 -1516 */ "0101 1011 0101", "0010 1011 1010", "1001 0101 1011", "0100 1010 1011", "0101 0101 0101",
+                            0x05B5,           0x02BA,           0x095B,           0x04AB,           0x0555,
+    //* 1517 -1521 */ "0110 1010 1010", "0110 1101 0101", "0010 1110 1010", "1001 0110 1101", "0100 1010 1110",
+                            0x06AA,           0x06D5,           0x02EA,           0x096D,           0x04AE,
+    //* 1522 -1526 */ "1010 0100 1110", "1101 0010 0110", "1101 0101 0101", "0110 1010 1010", "1010 1011 0101",
+                            0x0A4E,           0x0D26,           0x0D55,           0x06AA,           0x0AB5,
+};
+
+static const int32_t ASTRONOMICAL_TABLE_MONTH_COUNT =
+    12 * (ASTRONOMICAL_TABLE_YEAR_END - ASTRONOMICAL_TABLE_YEAR_START + 1);
+
+// The start days of the months of the table, and of the month after it.
+static int32_t gAstronomicalMonthStarts[ASTRONOMICAL_TABLE_MONTH_COUNT + 1];
+static icu::UInitOnce gAstronomicalMonthStartsInitOnce = U_INITONCE_INITIALIZER;
+
+static void U_CALLCONV initAstronomicalMonthStarts() {
+    int32_t day = ASTRONOMICAL_TABLE_START_DAY;
+    for (int32_t i = 0; i < ASTRONOMICAL_TABLE_MONTH_COUNT; ++i) {
+        gAstronomicalMonthStarts[i] = day;
+        day += 29 + ((ASTRONOMICAL_MONTHLENGTH[i / 12] >> (11 - (i % 12))) & 1);
+    }
+    gAstronomicalMonthStarts[ASTRONOMICAL_TABLE_MONTH_COUNT] = day;
+}
+
 //-------------------------------------------------------------------------
 // Constructors...
 //-------------------------------------------------------------------------
@@ -416,6 +529,12 @@ int32_t IslamicCalendar::monthStart(int32_t year, int32_t month) const {
 */
 int32_t IslamicCalendar::trueMonthStart(int32_t month) const
 {
+    int32_t index = month - 12 * (ASTRONOMICAL_TABLE_YEAR_START - 1);
+    if (0 <= index && index <= ASTRONOMICAL_TABLE_MONTH_COUNT) {
+        umtx_initOnce(gAstronomicalMonthStartsInitOnce, &initAstronomicalMonthStarts);
+        return gAstronomicalMonthStarts[index];
+    }
+
     UErrorCode status = U_ZERO_ERROR;
     int32_t start = CalendarCache::get(&gMonthCache, month, status);
 
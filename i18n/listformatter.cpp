@@ -17,6 +17,7 @@
 */
 
 #include "cmemory.h"
+#include "unicode/appendable.h"
 #include "unicode/fpositer.h"  // FieldPositionIterator
 #include "unicode/listformatter.h"
 #include "unicode/simpleformatter.h"
@@ -34,12 +35,49 @@
 
 U_NAMESPACE_BEGIN
 
+/**
+ * The literal text of a list pattern around its {0} and {1},
+ * for patterns with {0} before {1} and each exactly once.
+ */
+struct ListPatternParts {
+    UnicodeString prefix;
+    UnicodeString infix;
+    UnicodeString suffix;
+
+    // Returns FALSE if the pattern does not have the required form.
+    UBool split(const SimpleFormatter &pattern, UErrorCode &errorCode) {
+        if (U_FAILURE(errorCode)) {
+            return FALSE;
+        }
+        UnicodeString marker((UChar)0xffff);
+        const UnicodeString *params[2] = {&marker, &marker};
+        int32_t offsets[2];
+        UnicodeString text;
+        pattern.formatAndAppend(params, 2, text, offsets, 2, errorCode);
+        if (U_FAILURE(errorCode) || offsets[0] < 0 || offsets[1] <= offsets[0] ||
+                text.length() != pattern.getTextWithNoArguments().length() + 2) {
+            return FALSE;
+        }
+        prefix.setTo(text, 0, offsets[0]);
+        infix.setTo(text, offsets[0] + 1, offsets[1] - offsets[0] - 1);
+        suffix.setTo(text, offsets[1] + 1);
+        return TRUE;
+    }
+};
+
 struct ListFormatInternal : public UMemory {
     SimpleFormatter twoPattern;
     SimpleFormatter startPattern;
     SimpleFormatter middlePattern;
     SimpleFormatter endPattern;
 
+    // For formatting in a single pass, see formatInOrder().
+    ListPatternParts twoParts;
+    ListPatternParts startParts;
+    ListPatternParts middleParts;
+    ListPatternParts endParts;
+    UBool inOrder;
+
 ListFormatInternal(
         const UnicodeString& two,
         const UnicodeString& start,
@@ -49,19 +87,36 @@ ListFormatInternal(
         twoPattern(two, 2, 2, errorCode),
         startPattern(start, 2, 2, errorCode),
         middlePattern(middle, 2, 2, errorCode),
-        endPattern(end, 2, 2, errorCode) {}
+        endPattern(end, 2, 2, errorCode) {
+    splitPatterns(errorCode);
+}
 
 ListFormatInternal(const ListFormatData &data, UErrorCode &errorCode) :
         twoPattern(data.twoPattern, errorCode),
         startPattern(data.startPattern, errorCode),
         middlePattern(data.middlePattern, errorCode),
-        endPattern(data.endPattern, errorCode) { }
+        endPattern(data.endPattern, errorCode) {
+    splitPatterns(errorCode);
+}
 
 ListFormatInternal(const ListFormatInternal &other) :
     twoPattern(other.twoPattern),
     startPattern(other.startPattern),
     middlePattern(other.middlePattern),
-    endPattern(other.endPattern) { }
+    endPattern(other.endPattern),
+    twoParts(other.twoParts),
+    startParts(other.startParts),
+    middleParts(other.middleParts),
+    endParts(other.endParts),
+    inOrder(other.inOrder) { }
+
+void splitPatterns(UErrorCode &errorCode) {
+    // Patterns that reorder the items use the pairwise joining in format_().
+    inOrder = twoParts.split(twoPattern, errorCode) &&
+            startParts.split(startPattern, errorCode) &&
+            middleParts.split(middlePattern, errorCode) &&
+            endParts.split(endPattern, errorCode);
+}
 };
 
 
@@ -390,6 +445,129 @@ UnicodeString& ListFormatter::format(
   return format_(items, nItems, appendTo, index, offset, nullptr, errorCode);
 }
 
+Appendable& ListFormatter::format(
+        const UnicodeString items[],
+        int32_t nItems,
+        Appendable& appendTo,
+        UErrorCode& errorCode) const {
+#if !UCONFIG_NO_FORMATTING
+    if (U_FAILURE(errorCode)) {
+        return appendTo;
+    }
+    if (data == nullptr) {
+        errorCode = U_INVALID_STATE_ERROR;
+        return appendTo;
+    }
+    if (data->inOrder || nItems <= 1) {
+        int32_t offset;
+        formatInOrder(*data, items, nItems, appendTo, 0, -1, offset, nullptr);
+        return appendTo;
+    }
+#endif
+    UnicodeString result;
+    format(items, nItems, result, errorCode);
+    if (U_SUCCESS(errorCode)) {
+        appendTo.appendString(result.getBuffer(), result.length());
+    }
+    return appendTo;
+}
+
+#if !UCONFIG_NO_FORMATTING
+/**
+ * Writes the list in one pass, for patterns with {0} before {1}.
+ * The nested patterns wrap items[0] in all their prefixes, and each
+ * following item is preceded by an infix and followed by a suffix:
+ *   end.prefix middle.prefix* start.prefix items[0]
+ *   start.infix items[1] start.suffix (middle.infix items[i] middle.suffix)*
+ *   end.infix items[n-1] end.suffix
+ * start is the index of the output in the whole string,
+ * for offset and the handler's field positions.
+ */
+void ListFormatter::formatInOrder(
+        const ListFormatInternal& data,
+        const UnicodeString items[],
+        int32_t nItems,
+        Appendable& appendTo,
+        int32_t start,
+        int32_t index,
+        int32_t &offset,
+        FieldPositionHandler* handler) {
+    offset = -1;
+    if (nItems <= 0) {
+        return;
+    }
+    const ListPatternParts &first = nItems == 2 ? data.twoParts : data.startParts;
+    const ListPatternParts &last = nItems == 2 ? data.twoParts : data.endParts;
+
+    // Reserve the whole length up front.
+    int32_t length = items[0].length();
+    if (nItems >= 2) {
+        length += first.prefix.length() + first.infix.length() + items[1].length() + first.suffix.length();
+        if (nItems >= 3) {
+            length += last.prefix.length() + last.infix.length() +
+                    items[nItems - 1].length() + last.suffix.length();
+            const ListPatternParts &middle = data.middleParts;
+            int32_t middleLength = middle.prefix.length() + middle.infix.length() + middle.suffix.length();
+            for (int32_t i = 2; i < nItems - 1; ++i) {
+                length += middleLength + items[i].length();
+            }
+        }
+    }
+    appendTo.reserveAppendCapacity(length);
+
+    // Item start positions, for the handler's literal fields.
+    MaybeStackArray<int32_t, 10> itemStarts(handler != nullptr ? nItems : 0);
+    int32_t position = start;
+    if (nItems >= 3) {
+        appendTo.appendString(last.prefix.getBuffer(), last.prefix.length());
+        position += last.prefix.length();
+        for (int32_t i = 2; i < nItems - 1; ++i) {
+            const UnicodeString &prefix = data.middleParts.prefix;
+            appendTo.appendString(prefix.getBuffer(), prefix.length());
+            position += prefix.length();
+        }
+    }
+    if (nItems >= 2) {
+        appendTo.appendString(first.prefix.getBuffer(), first.prefix.length());
+        position += first.prefix.length();
+    }
+    for (int32_t i = 0; i < nItems; ++i) {
+        const ListPatternParts *parts = nullptr;
+        if (i > 0) {
+            parts = i == 1 ? &first : (i == nItems - 1 ? &last : &data.middleParts);
+            appendTo.appendString(parts->infix.getBuffer(), parts->infix.length());
+            position += parts->infix.length();
+        }
+        if (i == index) {
+            offset = position;
+        }
+        appendTo.appendString(items[i].getBuffer(), items[i].length());
+        if (handler != nullptr) {
+            itemStarts[i] = position;
+            handler->addAttribute(ULISTFMT_ELEMENT_FIELD, position, position + items[i].length());
+        }
+        position += items[i].length();
+        if (parts != nullptr) {
+            appendTo.appendString(parts->suffix.getBuffer(), parts->suffix.length());
+            position += parts->suffix.length();
+        }
+    }
+    if (handler != nullptr) {
+        // Like format_(), add the literal fields after all of the elements.
+        int32_t literalStart = start;
+        for (int32_t i = 0; i <= nItems; ++i) {
+            int32_t literalLimit = i < nItems ? itemStarts[i] : position;
+            if (literalStart != literalLimit) {
+                handler->addAttribute(ULISTFMT_LITERAL_FIELD, literalStart, literalLimit);
+            }
+            if (i < nItems) {
+                literalStart = itemStarts[i] + items[i].length();
+            }
+        }
+    }
+}
+#endif
+
 UnicodeString& ListFormatter::format_(
         const UnicodeString items[],
         int32_t nItems,
@@ -411,6 +589,11 @@ UnicodeString& ListFormatter::format_(
     if (nItems <= 0) {
         return appendTo;
     }
+    if (data->inOrder) {
+        UnicodeStringAppendable appendable(appendTo);
+        formatInOrder(*data, items, nItems, appendable, appendTo.length(), index, offset, handler);
+        return appendTo;
+    }
     if (nItems == 1) {
         if (index == 0) {
             offset = appendTo.length();
@@ -43,9 +43,11 @@
 #include "messageimpl.h"
 #include "msgfmt_impl.h"
 #include "plurrule_impl.h"
+#include "sharedmsgfmt.h"
 #include "uassert.h"
 #include "uelement.h"
 #include "uhash.h"
+#include "unifiedcache.h"
 #include "ustrfmt.h"
 #include "util.h"
 #include "uvector.h"
@@ -244,6 +246,8 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  compiledOps(NULL),
+  compiledOpCount(0),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -266,6 +270,8 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  compiledOps(NULL),
+  compiledOpCount(0),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -289,6 +295,8 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  compiledOps(NULL),
+  compiledOpCount(0),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -311,6 +319,8 @@ MessageFormat::MessageFormat(const MessageFormat& that)
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  compiledOps(NULL),
+  compiledOpCount(0),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -319,6 +329,8 @@ MessageFormat::MessageFormat(const MessageFormat& that)
     copyObjects(that, ec);
     if (U_FAILURE(ec)) {
         resetPattern();
+    } else {
+        compileMessage();
     }
 }
 
@@ -329,6 +341,7 @@ MessageFormat::~MessageFormat()
 
     uprv_free(argTypes);
     uprv_free(formatAliases);
+    uprv_free(compiledOps);
     delete defaultNumberFormat;
     delete defaultDateFormat;
 }
@@ -384,6 +397,8 @@ MessageFormat::operator=(const MessageFormat& that)
         copyObjects(that, ec);
         if (U_FAILURE(ec)) {
             resetPattern();
+        } else {
+            compileMessage();
         }
     }
     return *this;
@@ -494,6 +509,8 @@ MessageFormat::applyPattern(const UnicodeString& pattern,
 
     if (U_FAILURE(ec)) {
         resetPattern();
+    } else {
+        compileMessage();
     }
 }
 
@@ -505,6 +522,7 @@ void MessageFormat::resetPattern() {
     customFormatArgStarts = NULL;
     argTypeCount = 0;
     hasArgTypeConflicts = FALSE;
+    clearCompiledMessage();
 }
 
 void
@@ -512,6 +530,7 @@ MessageFormat::applyPattern(const UnicodeString& pattern,
                             UMessagePatternApostropheMode aposMode,
                             UParseError* parseError,
                             UErrorCode& status) {
+    MemoryTagScope memoryTag(UMEM_TAG_FORMATTING);
     if (aposMode != msgPattern.getApostropheMode()) {
         msgPattern.clearPatternAndSetApostropheMode(aposMode);
     }
@@ -588,6 +607,7 @@ void MessageFormat::setCustomArgStartFormat(int32_t argStart,
                                          NULL, &status);
     }
     uhash_iputi(customFormatArgStarts, argStart, 1, &status);
+    compileMessage();
 }
 
 Format* MessageFormat::getCachedFormatter(int32_t argumentNumber) const {
@@ -613,6 +633,7 @@ MessageFormat::adoptFormats(Format** newFormats,
         return;
     }
     // Throw away any cached formatters.
+    clearCompiledMessage();
     if (cachedFormatters != NULL) {
         uhash_removeAll(cachedFormatters);
     }
@@ -646,6 +667,7 @@ MessageFormat::setFormats(const Format** newFormats,
         return;
     }
     // Throw away any cached formatters.
+    clearCompiledMessage();
     if (cachedFormatters != NULL) {
         uhash_removeAll(cachedFormatters);
     }
@@ -955,6 +977,218 @@ MessageFormat::format(const Formattable* arguments,
     return appendTo;
 }
 
+MessageArgument::MessageArgument(const UChar *s, int32_t length) : fType(Formattable::kString) {
+    fValue.fString.fBuffer = s;
+    fValue.fString.fLength = length < 0 ? u_strlen(s) : length;
+}
+
+/**
+ * One operation of a compiled top-level message: either a literal
+ * segment of the pattern string, or a numbered argument.
+ */
+struct MessageFormat::CompiledOp {
+    enum Kind {
+        LITERAL,
+        /** Argument without a formatter: formatted by its type. */
+        DEFAULT_ARG,
+        /** Argument with a cached (explicit or custom) formatter. */
+        FORMAT_ARG
+    };
+    Kind kind;
+    /**
+     * LITERAL: the pattern substring to append.
+     * Arguments: the argument number substring, written as "{n}" if the argument is missing.
+     */
+    int32_t start;
+    int32_t length;
+    int32_t argNumber;
+    const Format* formatter;
+    /** The formatter if it is a NumberFormat, for formatting numbers directly. */
+    const NumberFormat* numberFormat;
+    /** The formatter if it is a DateFormat, for formatting dates directly. */
+    const DateFormat* dateFormat;
+};
+
+void MessageFormat::clearCompiledMessage() {
+    uprv_free(compiledOps);
+    compiledOps = NULL;
+    compiledOpCount = 0;
+}
+
+// Compiles the top-level message if it only contains literal text and
+// numbered arguments that format() handles without a sub-message; the
+// loop mirrors the one in format(). Otherwise leaves compiledOps NULL so that
+// the typed-argument format() falls back to the general code.
+void MessageFormat::compileMessage() {
+    clearCompiledMessage();
+    int32_t partCount = msgPattern.countParts();
+    if (partCount == 0) {
+        return;
+    }
+    // Each top-level part yields at most one literal and one argument operation.
+    CompiledOp* ops = (CompiledOp*)uprv_malloc(2 * partCount * sizeof(CompiledOp));
+    if (ops == NULL) {
+        return;
+    }
+    int32_t count = 0;
+    int32_t prevIndex = msgPattern.getPart(0).getLimit();
+    for (int32_t i = 1;; ++i) {
+        const MessagePattern::Part* part = &msgPattern.getPart(i);
+        const UMessagePatternPartType type = part->getType();
+        int32_t index = part->getIndex();
+        if (index > prevIndex) {
+            CompiledOp& op = ops[count++];
+            op.kind = CompiledOp::LITERAL;
+            op.start = prevIndex;
+            op.length = index - prevIndex;
+        }
+        if (type == UMSGPAT_PART_TYPE_MSG_LIMIT) {
+            break;
+        }
+        prevIndex = part->getLimit();
+        if (type != UMSGPAT_PART_TYPE_ARG_START) {
+            continue;
+        }
+        int32_t argLimit = msgPattern.getLimitPartIndex(i);
+        UMessagePatternArgType argType = part->getArgType();
+        part = &msgPattern.getPart(i + 1);
+        if (part->getType() != UMSGPAT_PART_TYPE_ARG_NUMBER) {
+            uprv_free(ops);
+            return;
+        }
+        CompiledOp& op = ops[count];
+        op.start = part->getIndex();
+        op.length = part->getLength();
+        op.argNumber = part->getValue();
+        op.formatter = getCachedFormatter(i);
+        op.numberFormat = NULL;
+        op.dateFormat = NULL;
+        if (op.formatter != NULL) {
+            if (dynamic_cast<const ChoiceFormat*>(op.formatter) ||
+                dynamic_cast<const PluralFormat*>(op.formatter) ||
+                dynamic_cast<const SelectFormat*>(op.formatter)) {
+                // Custom formats with sub-messages need the general code.
+                uprv_free(ops);
+                return;
+            }
+            op.kind = CompiledOp::FORMAT_ARG;
+            op.numberFormat = dynamic_cast<const NumberFormat*>(op.formatter);
+            op.dateFormat = dynamic_cast<const DateFormat*>(op.formatter);
+        } else if (argType == UMSGPAT_ARG_TYPE_NONE || (cachedFormatters && uhash_iget(cachedFormatters, i))) {
+            op.kind = CompiledOp::DEFAULT_ARG;
+        } else {
+            // choice, plural, select or selectordinal argument
+            uprv_free(ops);
+            return;
+        }
+        ++count;
+        prevIndex = msgPattern.getPart(argLimit).getLimit();
+        i = argLimit;
+    }
+    compiledOps = ops;
+    compiledOpCount = count;
+}
+
+void MessageFormat::toFormattable(const MessageArgument& arg, Formattable& result) {
+    switch (arg.fType) {
+    case Formattable::kLong:
+        result.setLong((int32_t)arg.fValue.fInt64);
+        break;
+    case Formattable::kInt64:
+        result.setInt64(arg.fValue.fInt64);
+        break;
+    case Formattable::kDate:
+        result.setDate(arg.fValue.fDouble);
+        break;
+    case Formattable::kString:
+        result.setString(UnicodeString(FALSE, arg.fValue.fString.fBuffer, arg.fValue.fString.fLength));
+        break;
+    default:
+        result.setDouble(arg.fValue.fDouble);
+        break;
+    }
+}
+
+UnicodeString&
+MessageFormat::format(const MessageArgument* arguments,
+                      int32_t count,
+                      UnicodeString& appendTo,
+                      UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+    if (count < 0 || (arguments == NULL && count > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return appendTo;
+    }
+    if (compiledOps == NULL) {
+        // Not a simple message: convert the arguments for the general code.
+        LocalArray<Formattable> formattables(new Formattable[count > 0 ? count : 1]);
+        if (formattables.isNull()) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return appendTo;
+        }
+        for (int32_t i = 0; i < count; ++i) {
+            toFormattable(arguments[i], formattables[i]);
+        }
+        return format(formattables.getAlias(), NULL, count, appendTo, NULL, status);
+    }
+
+    const UnicodeString& msgString = msgPattern.getPatternString();
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    for (int32_t i = 0; i < compiledOpCount && U_SUCCESS(status); ++i) {
+        const CompiledOp& op = compiledOps[i];
+        if (op.kind == CompiledOp::LITERAL) {
+            appendTo.append(msgString, op.start, op.length);
+            continue;
+        }
+        if (op.argNumber >= count) {
+            appendTo.append(LEFT_CURLY_BRACE).append(msgString, op.start, op.length).
+                append(RIGHT_CURLY_BRACE);
+            continue;
+        }
+        const MessageArgument& arg = arguments[op.argNumber];
+        const Formattable::Type type = arg.fType;
+        const UBool isNumeric = type == Formattable::kLong || type == Formattable::kInt64 ||
+                                type == Formattable::kDouble;
+        const NumberFormat* nf = op.numberFormat;
+        const DateFormat* df = op.dateFormat;
+        if (op.kind == CompiledOp::DEFAULT_ARG) {
+            if (type == Formattable::kString) {
+                appendTo.append(arg.fValue.fString.fBuffer, arg.fValue.fString.fLength);
+                continue;
+            } else if (isNumeric) {
+                nf = getDefaultNumberFormat(status);
+            } else {
+                df = getDefaultDateFormat(status);
+            }
+            if (U_FAILURE(status)) {
+                break;
+            }
+        }
+        if (nf != NULL && isNumeric) {
+            if (type == Formattable::kDouble) {
+                nf->format(arg.fValue.fDouble, appendTo, pos, status);
+            } else if (type == Formattable::kLong) {
+                nf->format((int32_t)arg.fValue.fInt64, appendTo, pos, status);
+            } else {
+                nf->format(arg.fValue.fInt64, appendTo, pos, status);
+            }
+        } else if (df != NULL && type == Formattable::kDate) {
+            df->format(arg.fValue.fDouble, appendTo, pos);
+        } else {
+            Formattable formattable;
+            toFormattable(arg, formattable);
+            UnicodeString s;
+            op.formatter->format(formattable, s, status);
+            if (U_SUCCESS(status)) {
+                appendTo.append(s);
+            }
+        }
+    }
+    return appendTo;
+}
+
 namespace {
 
 /**
@@ -1940,12 +2174,9 @@ UnicodeString MessageFormat::PluralSelectorProvider::select(void *ctx, double nu
     if (U_FAILURE(ec)) {
         return UnicodeString(FALSE, OTHER_STRING, 5);
     }
-    MessageFormat::PluralSelectorProvider* t = const_cast<MessageFormat::PluralSelectorProvider*>(this);
-    if(rules == NULL) {
-        t->rules = PluralRules::forLocale(msgFormat.fLocale, type, ec);
-        if (U_FAILURE(ec)) {
-            return UnicodeString(FALSE, OTHER_STRING, 5);
-        }
+    loadRules(ec);
+    if (U_FAILURE(ec)) {
+        return UnicodeString(FALSE, OTHER_STRING, 5);
     }
     // Select a sub-message according to how the number is formatted,
     // which is specified in the selected sub-message.
@@ -1987,6 +2218,124 @@ void MessageFormat::PluralSelectorProvider::reset() {
     rules = NULL;
 }
 
+void MessageFormat::PluralSelectorProvider::loadRules(UErrorCode& ec) const {
+    if (rules == NULL && U_SUCCESS(ec)) {
+        MessageFormat::PluralSelectorProvider* t = const_cast<MessageFormat::PluralSelectorProvider*>(this);
+        t->rules = PluralRules::forLocale(msgFormat.fLocale, type, ec);
+    }
+}
+
+// -------------------------------------
+// Shared, cached MessageFormat instances.
+
+SharedMessageFormat::~SharedMessageFormat() {
+    delete ptr;
+}
+
+template<> U_I18N_API
+const SharedMessageFormat *LocaleCacheKey<SharedMessageFormat>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return NULL;
+}
+
+// Cache key for a MessageFormat parsed from a pattern for a locale.
+class MessageFormatCacheKey : public LocaleCacheKey<SharedMessageFormat> {
+private:
+    UnicodeString fPattern;
+public:
+    MessageFormatCacheKey(const Locale &loc, const UnicodeString &pattern)
+            : LocaleCacheKey<SharedMessageFormat>(loc), fPattern(pattern) {}
+    MessageFormatCacheKey(const MessageFormatCacheKey &other)
+            : LocaleCacheKey<SharedMessageFormat>(other), fPattern(other.fPattern) {}
+    virtual ~MessageFormatCacheKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)LocaleCacheKey<SharedMessageFormat>::hashCode() +
+                         (uint32_t)fPattern.hashCode());
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<SharedMessageFormat>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const MessageFormatCacheKey &realOther = static_cast<const MessageFormatCacheKey &>(other);
+        return realOther.fPattern == fPattern;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new MessageFormatCacheKey(*this);
+    }
+    virtual const SharedMessageFormat *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        LocalPointer<MessageFormat> mf(new MessageFormat(fPattern, fLoc, status), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        mf->prepareForSharing(status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        SharedMessageFormat *result = new SharedMessageFormat(mf.getAlias());
+        if (result == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        mf.orphan();
+        result->addRef();
+        return result;
+    }
+};
+
+MessageFormatCacheKey::~MessageFormatCacheKey() {}
+
+void MessageFormat::prepareForSharing(UErrorCode& status) {
+    UBool needsNumberFormat = FALSE;
+    UBool needsDateFormat = FALSE;
+    int32_t partCount = msgPattern.countParts();
+    for (int32_t i = 0; i < partCount && U_SUCCESS(status); ++i) {
+        const MessagePattern::Part& part = msgPattern.getPart(i);
+        if (part.getType() != UMSGPAT_PART_TYPE_ARG_START) {
+            continue;
+        }
+        switch (part.getArgType()) {
+        case UMSGPAT_ARG_TYPE_NONE:
+            // Formats a number or a date with a default format.
+            needsNumberFormat = needsDateFormat = TRUE;
+            break;
+        case UMSGPAT_ARG_TYPE_PLURAL:
+            needsNumberFormat = TRUE;
+            pluralProvider.loadRules(status);
+            break;
+        case UMSGPAT_ARG_TYPE_SELECTORDINAL:
+            needsNumberFormat = TRUE;
+            ordinalProvider.loadRules(status);
+            break;
+        default:
+            break;
+        }
+    }
+    if (needsNumberFormat) {
+        getDefaultNumberFormat(status);
+    }
+    if (needsDateFormat) {
+        getDefaultDateFormat(status);
+    }
+}
+
+const SharedMessageFormat* U_EXPORT2
+MessageFormat::createSharedInstance(const UnicodeString& pattern, const Locale& locale,
+                                    UErrorCode& status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedMessageFormat *result = NULL;
+    cache->get(MessageFormatCacheKey(locale, pattern), result, status);
+    return result;
+}
+
 
 U_NAMESPACE_END
 
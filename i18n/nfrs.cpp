@@ -141,6 +141,9 @@ NFRuleSet::NFRuleSet(RuleBasedNumberFormat *_owner, UnicodeString* descriptions,
   , fIsFractionRuleSet(FALSE)
   , fIsPublic(FALSE)
   , fIsParseable(TRUE)
+  , fRuleTable(NULL)
+  , fRuleTableLength(0)
+  , fLeastCommonMultiple(0)
 {
     for (int32_t i = 0; i < NON_NUMERICAL_RULE_LENGTH; ++i) {
         nonNumericalRules[i] = NULL;
@@ -329,6 +332,7 @@ NFRuleSet::~NFRuleSet()
         }
         // else it will be deleted via NFRuleList fractionRules
     }
+    uprv_free(fRuleTable);
 }
 
 static UBool
@@ -394,6 +398,44 @@ NFRuleSet::setDecimalFormatSymbols(const DecimalFormatSymbols &newSymbols, UErro
     }
 }
 
+// Integers below this limit select their rule by a table lookup.
+// One byte per integer, so that spelling out a number below one thousand,
+// and each group of three digits of larger numbers, needs no search.
+static const int32_t kRuleTableLimit = 1000;
+static const uint8_t kNoRuleIndex = 0xff;
+
+void
+NFRuleSet::buildRuleTable(UErrorCode& status)
+{
+    if (U_FAILURE(status) || rules.size() == 0) {
+        return;
+    }
+    if (fIsFractionRuleSet) {
+        // findFractionRuleSetRule() works with fractions of this denominator.
+        fLeastCommonMultiple = rules[0]->getBaseValue();
+        for (uint32_t i = 1; i < rules.size(); ++i) {
+            fLeastCommonMultiple = util_lcm(fLeastCommonMultiple, rules[i]->getBaseValue());
+        }
+        return;
+    }
+    if (rules.size() >= kNoRuleIndex) {
+        return;
+    }
+    // Beyond the last base value, the last rule (or its rollback) applies.
+    int64_t lastBaseValue = rules[rules.size() - 1]->getBaseValue();
+    int32_t length = lastBaseValue < kRuleTableLimit ? (int32_t)lastBaseValue + 1 : kRuleTableLimit;
+    fRuleTable = (uint8_t *)uprv_malloc(length);
+    if (fRuleTable == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t n = 0; n < length; ++n) {
+        int32_t index = findNormalRuleIndex(n);
+        fRuleTable[n] = index >= 0 ? (uint8_t)index : kNoRuleIndex;
+    }
+    fRuleTableLength = length;
+}
+
 #define RECURSION_LIMIT 64
 
 void
@@ -515,46 +557,59 @@ NFRuleSet::findNormalRule(int64_t number) const
     // {dlf} unfortunately this fails if there are no rules except
     // special rules.  If there are no rules, use the master rule.
 
+    if (0 <= number && number < fRuleTableLength) {
+        uint8_t index = fRuleTable[number];
+        return index != kNoRuleIndex ? rules[index] : NULL;
+    }
+    if (rules.size() > 0) {
+        int32_t index = findNormalRuleIndex(number);
+        return index >= 0 ? rules[index] : NULL;
+    }
+    // else use the master rule
+    return nonNumericalRules[MASTER_RULE_INDEX];
+}
+
+/**
+ * Binary-searches the rules for the one that applies to a non-negative
+ * integer, and returns its index, or -1 for a bad rule set.
+ */
+int32_t
+NFRuleSet::findNormalRuleIndex(int64_t number) const
+{
     // binary-search the rule list for the applicable rule
     // (a rule is used for all values from its base value to
     // the next rule's base value)
     int32_t hi = rules.size();
-    if (hi > 0) {
-        int32_t lo = 0;
+    int32_t lo = 0;
 
-        while (lo < hi) {
-            int32_t mid = (lo + hi) / 2;
-            if (rules[mid]->getBaseValue() == number) {
-                return rules[mid];
-            }
-            else if (rules[mid]->getBaseValue() > number) {
-                hi = mid;
-            }
-            else {
-                lo = mid + 1;
-            }
+    while (lo < hi) {
+        int32_t mid = (lo + hi) / 2;
+        if (rules[mid]->getBaseValue() == number) {
+            return mid;
         }
-        if (hi == 0) { // bad rule set, minimum base > 0
-            return NULL; // want to throw exception here
+        else if (rules[mid]->getBaseValue() > number) {
+            hi = mid;
         }
+        else {
+            lo = mid + 1;
+        }
+    }
+    if (hi == 0) { // bad rule set, minimum base > 0
+        return -1; // want to throw exception here
+    }
 
-        NFRule *result = rules[hi - 1];
-
-        // use shouldRollBack() to see whether we need to invoke the
-        // rollback rule (see shouldRollBack()'s documentation for
-        // an explanation of the rollback rule).  If we do, roll back
-        // one rule and return that one instead of the one we'd normally
-        // return
-        if (result->shouldRollBack(number)) {
-            if (hi == 1) { // bad rule set, no prior rule to rollback to from this base
-                return NULL;
-            }
-            result = rules[hi - 2];
+    // use shouldRollBack() to see whether we need to invoke the
+    // rollback rule (see shouldRollBack()'s documentation for
+    // an explanation of the rollback rule).  If we do, roll back
+    // one rule and return that one instead of the one we'd normally
+    // return
+    if (rules[hi - 1]->shouldRollBack(number)) {
+        if (hi == 1) { // bad rule set, no prior rule to rollback to from this base
+            return -1;
         }
-        return result;
+        return hi - 2;
     }
-    // else use the master rule
-    return nonNumericalRules[MASTER_RULE_INDEX];
+    return hi - 1;
 }
 
 /**
@@ -584,14 +639,15 @@ NFRuleSet::findFractionRuleSetRule(double number) const
     // and multiply this by the number being formatted.  This is
     // all the precision we need, and we can do all of the rest
     // of the math using integer arithmetic
-    int64_t leastCommonMultiple = rules[0]->getBaseValue();
-    int64_t numerator;
-    {
+    int64_t leastCommonMultiple = fLeastCommonMultiple;
+    if (leastCommonMultiple == 0) {
+        // not precomputed by buildRuleTable()
+        leastCommonMultiple = rules[0]->getBaseValue();
         for (uint32_t i = 1; i < rules.size(); ++i) {
             leastCommonMultiple = util_lcm(leastCommonMultiple, rules[i]->getBaseValue());
         }
-        numerator = util64_fromDouble(number * (double)leastCommonMultiple + 0.5);
     }
+    int64_t numerator = util64_fromDouble(number * (double)leastCommonMultiple + 0.5);
     // for each rule, do the following...
     int64_t tempDifference;
     int64_t difference = util64_fromDouble(uprv_maxMantissa());
@@ -37,6 +37,8 @@ class NFRuleSet : public UMemory {
     void setNonNumericalRule(NFRule *rule);
     void setBestFractionRule(int32_t originalIndex, NFRule *newRule, UBool rememberRule);
     void makeIntoFractionRuleSet() { fIsFractionRuleSet = TRUE; }
+    // Precomputes the rule selection; called once all rule sets are parsed.
+    void buildRuleTable(UErrorCode& status);
 
     ~NFRuleSet();
 
@@ -64,6 +66,7 @@ class NFRuleSet : public UMemory {
     const RuleBasedNumberFormat *getOwner() const { return owner; }
 private:
     const NFRule * findNormalRule(int64_t number) const;
+    int32_t findNormalRuleIndex(int64_t number) const;
     const NFRule * findDoubleRule(double number) const;
     const NFRule * findFractionRuleSetRule(double number) const;
     
@@ -79,6 +82,13 @@ class NFRuleSet : public UMemory {
     UBool fIsPublic;
     UBool fIsParseable;
 
+    // For each integer below fRuleTableLength, the index in rules of the rule
+    // that findNormalRule() binary-searches for, or kNoRuleIndex.
+    uint8_t *fRuleTable;
+    int32_t fRuleTableLength;
+    // The least common multiple of the base values of a fraction rule set, or 0.
+    int64_t fLeastCommonMultiple;
+
     NFRuleSet(const NFRuleSet &other); // forbid copying of this class
     NFRuleSet &operator=(const NFRuleSet &other); // forbid copying of this class
 };
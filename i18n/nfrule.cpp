@@ -726,6 +726,35 @@ int64_t NFRule::getDivisor() const
 // formatting
 //-----------------------------------------------------------------------
 
+/**
+* Appends the rule text with the substitutions, in text order, when the
+* rule's output goes at the end of toAppendTo. Each substitution inserts
+* its result at (pos + its own position), which is then the end of the
+* string, so no text ever needs to be moved.
+* @return FALSE if the substitutions are not in text order
+*/
+template<typename T>
+static UBool
+appendRuleText(const UnicodeString &ruleText, const NFSubstitution *sub1, const NFSubstitution *sub2,
+               T number, UnicodeString &toAppendTo, int32_t recursionCount, UErrorCode &status)
+{
+    if (sub1 != NULL && sub2 != NULL && sub1->getPos() > sub2->getPos()) {
+        return FALSE;
+    }
+    const NFSubstitution *subs[2] = { sub1, sub2 };
+    int32_t start = 0;
+    for (int32_t i = 0; i < 2; ++i) {
+        const NFSubstitution *sub = subs[i];
+        if (sub != NULL) {
+            toAppendTo.append(ruleText, start, sub->getPos() - start);
+            start = sub->getPos();
+            sub->doSubstitution(number, toAppendTo, toAppendTo.length() - start, recursionCount, status);
+        }
+    }
+    toAppendTo.append(ruleText, start, ruleText.length() - start);
+    return TRUE;
+}
+
 /**
 * Formats the number, and inserts the resulting text into
 * toInsertInto.
@@ -743,6 +772,10 @@ NFRule::doFormat(int64_t number, UnicodeString& toInsertInto, int32_t pos, int32
     // into the right places in toInsertInto (notice we do the
     // substitutions in reverse order so that the offsets don't get
     // messed up)
+    if (!rulePatternFormat && pos == toInsertInto.length() &&
+            appendRuleText(fRuleText, sub1, sub2, number, toInsertInto, recursionCount, status)) {
+        return;
+    }
     int32_t pluralRuleStart = fRuleText.length();
     int32_t lengthOffset = 0;
     if (!rulePatternFormat) {
@@ -789,6 +822,10 @@ NFRule::doFormat(double number, UnicodeString& toInsertInto, int32_t pos, int32_
     // [again, we have two copies of this routine that do the same thing
     // so that we don't sacrifice precision in a long by casting it
     // to a double]
+    if (!rulePatternFormat && pos == toInsertInto.length() &&
+            appendRuleText(fRuleText, sub1, sub2, number, toInsertInto, recursionCount, status)) {
+        return;
+    }
     int32_t pluralRuleStart = fRuleText.length();
     int32_t lengthOffset = 0;
     if (!rulePatternFormat) {
@@ -46,6 +46,11 @@ class NormalizationTransliterator : public Transliterator {
      */
     virtual Transliterator* clone(void) const;
 
+    /**
+     * Returns the normalizer that this transliterator applies.
+     */
+    const Normalizer2 &getNormalizer2() const { return fNorm2; }
+
     /**
      * ICU "poor man's RTTI", returns a UClassID for the actual class.
      */
@@ -144,6 +144,15 @@ unumf_formatDecimal(const UNumberFormatter* uformatter, const char* value, int32
     formatter->fFormatter.formatImpl(result, *ec);
 }
 
+U_CAPI int32_t U_EXPORT2
+unumf_formatDoubleBatch(const UNumberFormatter* uformatter, const double* values, int32_t count,
+                        UChar* buffer, int32_t bufferCapacity, int32_t* offsets, UErrorCode* ec) {
+    const UNumberFormatterData* formatter = UNumberFormatterData::validate(uformatter, *ec);
+    if (U_FAILURE(*ec)) { return 0; }
+
+    return formatter->fFormatter.formatBatch(values, count, buffer, bufferCapacity, offsets, *ec);
+}
+
 U_CAPI int32_t U_EXPORT2
 unumf_resultToString(const UFormattedNumber* uresult, UChar* buffer, int32_t bufferCapacity,
                      UErrorCode* ec) {
@@ -12,12 +12,24 @@
 #include "resource.h"
 #include "number_compact.h"
 #include "number_microprops.h"
+#include "unifiedcache.h"
 #include "uresimp.h"
 
 using namespace icu;
 using namespace icu::number;
 using namespace icu::number::impl;
 
+U_NAMESPACE_BEGIN
+
+template<> U_I18N_API
+const CompactData *LocaleCacheKey<CompactData>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return nullptr;
+}
+
+U_NAMESPACE_END
+
 namespace {
 
 // A dummy object used when a "0" compact decimal entry is encountered. This is necessary
@@ -52,12 +64,67 @@ int32_t countZeros(const UChar *patternString, int32_t patternLength) {
     return numZeros;
 }
 
+/** Cache key for CompactData: the locale, numbering system, compact style and compact type. */
+class CompactDataKey : public LocaleCacheKey<CompactData> {
+  public:
+    CompactDataKey(const Locale &loc, const char *nsName, CompactStyle compactStyle,
+                   CompactType compactType)
+            : LocaleCacheKey<CompactData>(loc), fNsName(nsName, -1, US_INV),
+              fCompactStyle(compactStyle), fCompactType(compactType) {}
+
+    CompactDataKey(const CompactDataKey &other) = default;
+
+    ~CompactDataKey() U_OVERRIDE = default;
+
+    int32_t hashCode() const U_OVERRIDE {
+        return static_cast<int32_t>(37u * static_cast<uint32_t>(LocaleCacheKey::hashCode()) +
+                                    static_cast<uint32_t>(fNsName.hashCode()) +
+                                    3u * fCompactStyle + fCompactType);
+    }
+
+    UBool operator==(const CacheKeyBase &other) const U_OVERRIDE {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const auto &otherKey = static_cast<const CompactDataKey &>(other);
+        return otherKey.fNsName == fNsName && otherKey.fCompactStyle == fCompactStyle &&
+               otherKey.fCompactType == fCompactType;
+    }
+
+    CacheKeyBase *clone() const U_OVERRIDE {
+        return new CompactDataKey(*this);
+    }
+
+    const CompactData *createObject(const void * /*creationContext*/, UErrorCode &status) const U_OVERRIDE {
+        LocalPointer<CompactData> result(new CompactData(), status);
+        if (U_FAILURE(status)) { return nullptr; }
+        CharString nsName;
+        nsName.appendInvariantChars(fNsName, status);
+        if (U_FAILURE(status)) { return nullptr; }
+        result->populate(fLoc, nsName.data(), fCompactStyle, fCompactType, status);
+        if (U_FAILURE(status)) { return nullptr; }
+        result->addRef();
+        return result.orphan();
+    }
+
+  private:
+    UnicodeString fNsName;
+    CompactStyle fCompactStyle;
+    CompactType fCompactType;
+};
+
 } // namespace
 
 // NOTE: patterns and multipliers both get zero-initialized.
 CompactData::CompactData() : patterns(), multipliers(), largestMagnitude(0), isEmpty(TRUE) {
 }
 
+CompactData::~CompactData() = default;
+
 void CompactData::populate(const Locale &locale, const char *nsName, CompactStyle compactStyle,
                            CompactType compactType, UErrorCode &status) {
     CompactDataSink sink(*this);
@@ -220,7 +287,11 @@ CompactHandler::CompactHandler(CompactStyle compactStyle, const Locale &locale,
                                MutablePatternModifier *buildReference, const MicroPropsGenerator *parent,
                                UErrorCode &status)
         : rules(rules), parent(parent) {
-    data.populate(locale, nsName, compactStyle, compactType, status);
+    // The patterns are the same for all formatters, so take them from the cache.
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) { return; }
+    cache->get(CompactDataKey(locale, nsName, compactStyle, compactType), data, status);
+    if (U_FAILURE(status)) { return; }
     if (buildReference != nullptr) {
         // Safe code path
         precomputeAllModifiers(*buildReference, status);
@@ -235,6 +306,7 @@ CompactHandler::~CompactHandler() {
     for (int32_t i = 0; i < precomputedModsLength; i++) {
         delete precomputedMods[i].mod;
     }
+    SharedObject::clearPtr(data);
 }
 
 void CompactHandler::precomputeAllModifiers(MutablePatternModifier &buildReference, UErrorCode &status) {
@@ -243,7 +315,7 @@ void CompactHandler::precomputeAllModifiers(MutablePatternModifier &buildReferen
     // Initial capacity of 12 for 0K, 00K, 000K, ...M, ...B, and ...T
     UVector allPatterns(12, status);
     if (U_FAILURE(status)) { return; }
-    data.getUniquePatterns(allPatterns, status);
+    data->getUniquePatterns(allPatterns, status);
     if (U_FAILURE(status)) { return; }
 
     // C++ only: ensure that precomputedMods has room.
@@ -279,13 +351,13 @@ void CompactHandler::processQuantity(DecimalQuantity &quantity, MicroProps &micr
         micros.rounder.apply(quantity, status);
     } else {
         // TODO: Revisit chooseMultiplierAndApply
-        int32_t multiplier = micros.rounder.chooseMultiplierAndApply(quantity, data, status);
+        int32_t multiplier = micros.rounder.chooseMultiplierAndApply(quantity, *data, status);
         magnitude = quantity.isZero() ? 0 : quantity.getMagnitude();
         magnitude -= multiplier;
     }
 
     StandardPlural::Form plural = utils::getStandardPlural(rules, quantity);
-    const UChar *patternString = data.getPattern(magnitude, plural);
+    const UChar *patternString = data->getPattern(magnitude, plural);
     if (patternString == nullptr) {
         // Use the default (non-compact) modifier.
         // No need to take any action.
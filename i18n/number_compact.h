@@ -13,16 +13,24 @@
 #include "uvector.h"
 #include "resource.h"
 #include "number_patternmodifier.h"
+#include "sharedobject.h"
 
 U_NAMESPACE_BEGIN namespace number {
 namespace impl {
 
 static const int32_t COMPACT_MAX_DIGITS = 15;
 
-class CompactData : public MultiplierProducer {
+/**
+ * The compact patterns of a locale, numbering system, style and type.
+ * CompactHandlers share it through the UnifiedCache, so creating one after the first
+ * does no resource lookups.
+ */
+class U_I18N_API CompactData : public MultiplierProducer, public SharedObject {
   public:
     CompactData();
 
+    ~CompactData() U_OVERRIDE;
+
     void populate(const Locale &locale, const char *nsName, CompactStyle compactStyle,
                   CompactType compactType, UErrorCode &status);
 
@@ -72,7 +80,7 @@ class CompactHandler : public MicroPropsGenerator, public UMemory {
     // Initial capacity of 12 for 0K, 00K, 000K, ...M, ...B, and ...T
     MaybeStackArray<CompactModInfo, 12> precomputedMods;
     int32_t precomputedModsLength = 0;
-    CompactData data;
+    const CompactData *data = nullptr;
     ParsedPatternInfo unsafePatternInfo;
     UBool safe;
 
@@ -16,17 +16,24 @@
 #include "putilimp.h"
 #include "number_decimalquantity.h"
 #include "number_roundingutils.h"
+#include "number_ryu.h"
 #include "double-conversion.h"
+#include "double-conversion-strtod.h"
 #include "charstr.h"
 #include "number_utils.h"
 #include "uassert.h"
 
+#if defined(_MSC_VER)
+#   include <intrin.h>
+#endif
+
 using namespace icu;
 using namespace icu::number;
 using namespace icu::number::impl;
 
 using icu::double_conversion::DoubleToStringConverter;
-using icu::double_conversion::StringToDoubleConverter;
+using icu::double_conversion::Strtod;
+using icu::double_conversion::Vector;
 
 namespace {
 
@@ -43,6 +50,118 @@ inline int32_t safeSubtract(int32_t a, int32_t b) {
     return diff;
 }
 
+/** The number of digits in the packed form of the BCD: 16 in each of the two longs. */
+const int32_t MAX_PACKED_DIGITS = 32;
+
+/** Returns x with the lowest bit of each nonzero nibble set, and all other bits cleared. */
+inline uint64_t nonzeroNibbles(uint64_t x) {
+    x |= x >> 2;
+    x |= x >> 1;
+    return x & 0x1111111111111111ULL;
+}
+
+/** Returns the number of zero nibbles below the lowest nonzero nibble of x; x must not be 0. */
+inline int32_t trailingZeroNibbles(uint64_t x) {
+    uint64_t mask = nonzeroNibbles(x);
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(mask) / 4;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return static_cast<int32_t>(index) / 4;
+#else
+    int32_t n = 0;
+    if ((mask & 0xffffffffULL) == 0) { n += 8; mask >>= 32; }
+    if ((mask & 0xffffULL) == 0) { n += 4; mask >>= 16; }
+    if ((mask & 0xffULL) == 0) { n += 2; mask >>= 8; }
+    if ((mask & 0xfULL) == 0) { n += 1; }
+    return n;
+#endif
+}
+
+/** Returns the number of zero nibbles above the highest nonzero nibble of x; x must not be 0. */
+inline int32_t leadingZeroNibbles(uint64_t x) {
+    uint64_t mask = nonzeroNibbles(x);
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(mask) / 4;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanReverse64(&index, mask);
+    return 15 - static_cast<int32_t>(index) / 4;
+#else
+    int32_t n = 0;
+    if ((mask >> 32) == 0) { n += 8; mask <<= 32; }
+    if ((mask >> 48) == 0) { n += 4; mask <<= 16; }
+    if ((mask >> 56) == 0) { n += 2; mask <<= 8; }
+    if ((mask >> 60) == 0) { n += 1; }
+    return n;
+#endif
+}
+
+/** Returns the number of digits in the packed BCD, up to the most significant nonzero digit. */
+inline int32_t packedPrecision(const uint64_t* bcd) {
+    if (bcd[1] != 0) {
+        return MAX_PACKED_DIGITS - leadingZeroNibbles(bcd[1]);
+    } else if (bcd[0] != 0) {
+        return 16 - leadingZeroNibbles(bcd[0]);
+    } else {
+        return 0;
+    }
+}
+
+/** Shifts the packed BCD toward the more significant digits; the digits shifted out are lost. */
+inline void shiftPackedLeft(uint64_t* bcd, int32_t numDigits) {
+    if (numDigits >= MAX_PACKED_DIGITS) {
+        bcd[1] = 0;
+        bcd[0] = 0;
+    } else if (numDigits >= 16) {
+        bcd[1] = bcd[0] << ((numDigits - 16) * 4);
+        bcd[0] = 0;
+    } else if (numDigits > 0) {
+        bcd[1] = (bcd[1] << (numDigits * 4)) | (bcd[0] >> (64 - numDigits * 4));
+        bcd[0] <<= numDigits * 4;
+    }
+}
+
+/** Shifts the packed BCD toward the less significant digits; the digits shifted out are lost. */
+inline void shiftPackedRight(uint64_t* bcd, int32_t numDigits) {
+    if (numDigits >= MAX_PACKED_DIGITS) {
+        bcd[0] = 0;
+        bcd[1] = 0;
+    } else if (numDigits >= 16) {
+        bcd[0] = bcd[1] >> ((numDigits - 16) * 4);
+        bcd[1] = 0;
+    } else if (numDigits > 0) {
+        bcd[0] = (bcd[0] >> (numDigits * 4)) | (bcd[1] << (64 - numDigits * 4));
+        bcd[1] >>= numDigits * 4;
+    }
+}
+
+/**
+ * Converts 0 <= v < 10^8 to packed BCD, without a loop over the digits:
+ * Each step splits all of the lanes of the word at once, with a multiplication by the inverse
+ * of the divisor, first into two lanes of 4 digits, then 2, then 1.
+ */
+inline uint64_t toPackedBcd8(uint32_t v) {
+    uint64_t x = (v % 10000) | (static_cast<uint64_t>(v / 10000) << 32);
+    // (x * 10486) >> 20 == x / 100 for x < 10^4
+    uint64_t hundreds = ((x * 10486) >> 20) & 0x0000007f0000007fULL;
+    x = (hundreds << 16) | (x - 100 * hundreds);
+    // (x * 103) >> 10 == x / 10 for x < 100
+    uint64_t tens = ((x * 103) >> 10) & 0x000f000f000f000fULL;
+    x = (tens << 8) | (x - 10 * tens);
+    // Now there is one digit per byte; pack them into nibbles.
+    x = (x | (x >> 4)) & 0x00ff00ff00ff00ffULL;
+    x = (x | (x >> 8)) & 0x0000ffff0000ffffULL;
+    return (x | (x >> 16)) & 0xffffffffULL;
+}
+
+/** Converts 0 <= v < 10^16 to packed BCD. */
+inline uint64_t toPackedBcd16(uint64_t v) {
+    return toPackedBcd8(static_cast<uint32_t>(v % 100000000)) |
+        (toPackedBcd8(static_cast<uint32_t>(v / 100000000)) << 32);
+}
+
 static double DOUBLE_MULTIPLIERS[] = {
         1e0,
         1e1,
@@ -67,6 +186,27 @@ static double DOUBLE_MULTIPLIERS[] = {
         1e20,
         1e21};
 
+static const uint64_t UINT64_POWERS_OF_TEN[] = {
+        1ULL,
+        10ULL,
+        100ULL,
+        1000ULL,
+        10000ULL,
+        100000ULL,
+        1000000ULL,
+        10000000ULL,
+        100000000ULL,
+        1000000000ULL,
+        10000000000ULL,
+        100000000000ULL,
+        1000000000000ULL,
+        10000000000000ULL,
+        100000000000000ULL,
+        1000000000000000ULL,
+        10000000000000000ULL,
+        100000000000000000ULL,
+        1000000000000000000ULL};
+
 }  // namespace
 
 icu::IFixedDecimal::~IFixedDecimal() = default;
@@ -172,9 +312,12 @@ uint64_t DecimalQuantity::getPositionFingerprint() const {
 
 void DecimalQuantity::roundToIncrement(double roundingIncrement, RoundingMode roundingMode,
                                        int32_t maxFrac, UErrorCode& status) {
+    roundToInfinity();
+    if (roundToIncrementExact(roundingIncrement, roundingMode, maxFrac, status)) {
+        return;
+    }
     // TODO(13701): This is innefficient.  Improve?
     // TODO(13701): Should we convert to decNumber instead?
-    roundToInfinity();
     double temp = toDouble();
     temp /= roundingIncrement;
     // Use another DecimalQuantity to perform the actual rounding...
@@ -190,10 +333,93 @@ void DecimalQuantity::roundToIncrement(double roundingIncrement, RoundingMode ro
     roundToMagnitude(-maxFrac, roundingMode, status);
 }
 
+bool DecimalQuantity::roundToIncrementExact(double roundingIncrement, RoundingMode roundingMode,
+                                            int32_t maxFrac, UErrorCode& status) {
+    if (isInfinite() || isNaN() || maxFrac < -15 || maxFrac > 15 || !(roundingIncrement > 0)) {
+        return false;
+    }
+    // The increment is a short decimal like 0.05 = 5E-2 = incrementDigits * 10^-maxFrac.
+    // (maxFrac is negative for increments like 1000 = 1E3.)
+    double incrementDigits;
+    if (maxFrac >= 0) {
+        incrementDigits = std::floor(roundingIncrement * DOUBLE_MULTIPLIERS[maxFrac] + 0.5);
+        if (incrementDigits / DOUBLE_MULTIPLIERS[maxFrac] != roundingIncrement) {
+            return false;
+        }
+    } else {
+        incrementDigits = std::floor(roundingIncrement / DOUBLE_MULTIPLIERS[-maxFrac] + 0.5);
+        if (incrementDigits * DOUBLE_MULTIPLIERS[-maxFrac] != roundingIncrement) {
+            return false;
+        }
+    }
+    if (incrementDigits < 1 || incrementDigits >= 1e15) {
+        return false;
+    }
+    uint64_t value;
+    if (!getDigitsAsInteger(value, 18)) {
+        return false;
+    }
+    if (precision == 0) {
+        return true;
+    }
+
+    // Align the value and the increment to the smaller of their exponents.
+    uint64_t increment = static_cast<uint64_t>(incrementDigits);
+    int32_t exponent = std::min(scale, -maxFrac);
+    int32_t valueShift = scale - exponent;
+    int32_t incrementShift = -maxFrac - exponent;
+    if (valueShift > 18 - precision || incrementShift > 18 ||
+            increment >= UINT64_POWERS_OF_TEN[18 - incrementShift]) {
+        return false;
+    }
+    value *= UINT64_POWERS_OF_TEN[valueShift];
+    increment *= UINT64_POWERS_OF_TEN[incrementShift];
+
+    // Both are below 10^18, so neither the doubled remainder nor the rounded-up value overflows.
+    uint64_t quotient = value / increment;
+    uint64_t remainder = value % increment;
+    if (remainder != 0) {
+        roundingutils::Section section;
+        if (remainder * 2 < increment) {
+            section = roundingutils::SECTION_LOWER;
+        } else if (remainder * 2 == increment) {
+            section = roundingutils::SECTION_MIDPOINT;
+        } else {
+            section = roundingutils::SECTION_UPPER;
+        }
+        bool roundDown = roundingutils::getRoundingDirection(
+                (quotient % 2) == 0, isNegative(), section, roundingMode, status);
+        if (U_FAILURE(status)) {
+            return true;
+        }
+        if (!roundDown) {
+            quotient++;
+        }
+    }
+    setDigitsFromInteger(quotient * increment, exponent);
+    return true;
+}
+
 void DecimalQuantity::multiplyBy(const DecNum& multiplicand, UErrorCode& status) {
     if (isInfinite() || isZero() || isNaN()) {
         return;
     }
+    // Short multipliers like 3 or 1.5 are applied to short values without decNumber:
+    // the product of the coefficients is below 10^18.
+    const decNumber* dn = multiplicand.getRawDecNumber();
+    uint64_t digits;
+    if (dn->digits <= 9 && (dn->bits & DECSPECIAL) == 0 && !decNumberIsZero(dn) &&
+            getDigitsAsInteger(digits, 9)) {
+        uint64_t factor = 0;
+        for (int32_t i = dn->digits - 1; i >= 0; i--) {
+            factor = factor * 10 + dn->lsu[i];
+        }
+        setDigitsFromInteger(digits * factor, scale + dn->exponent);
+        if (multiplicand.isNegative()) {
+            flags ^= NEGATIVE_FLAG;
+        }
+        return;
+    }
     // Convert to DecNum, multiply, and convert back.
     DecNum decnum;
     toDecNum(decnum, status);
@@ -443,21 +669,26 @@ void DecimalQuantity::convertToAccurateDouble() {
     U_ASSERT(origDouble != 0);
     int32_t delta = origDelta;
 
-    // Call the slow oracle function (Double.toString in Java, DoubleToAscii in C++).
+    // Compute the shortest round-trip digits (Double.toString in Java).
+    // Ryu is faster than DoubleToAscii, which falls back to bignum arithmetic when Grisu3 fails.
     char buffer[DoubleToStringConverter::kBase10MaximalLength + 1];
-    bool sign; // unused; always positive
     int32_t length;
     int32_t point;
-    DoubleToStringConverter::DoubleToAscii(
-        origDouble,
-        DoubleToStringConverter::DtoaMode::SHORTEST,
-        0,
-        buffer,
-        sizeof(buffer),
-        &sign,
-        &length,
-        &point
-    );
+    if (std::numeric_limits<double>::is_iec559) {
+        doubleToShortestDigits(origDouble, buffer, length, point);
+    } else {
+        bool sign; // unused; always positive
+        DoubleToStringConverter::DoubleToAscii(
+            origDouble,
+            DoubleToStringConverter::DtoaMode::SHORTEST,
+            0,
+            buffer,
+            sizeof(buffer),
+            &sign,
+            &length,
+            &point
+        );
+    }
 
     setBcdToZero();
     readDoubleConversionToBcd(buffer, length, point);
@@ -496,6 +727,47 @@ void DecimalQuantity::_setToDecNum(const DecNum& decnum, UErrorCode& status) {
     }
 }
 
+DecimalQuantity &DecimalQuantity::setToFixedPoint(int64_t mantissa, int32_t scale) {
+    setToLong(mantissa);
+    // Note: adjustMagnitude() is a no-op for zero, which keeps the scale of zero at 0.
+    adjustMagnitude(-scale);
+    return *this;
+}
+
+DecimalQuantity &DecimalQuantity::setToDecimal128(uint64_t high, uint64_t low) {
+    setBcdToZero();
+    flags = 0;
+    if ((high >> 63) != 0) {
+        flags |= NEGATIVE_FLAG;
+    }
+    if (((high >> 61) & 3) == 3) {
+        // The combination field starts with 11: infinity, NaN, or a coefficient of
+        // 2^113 or more, which is larger than the maximum of 10^34-1 and therefore non-canonical.
+        if (((high >> 58) & 0x1f) == 0x1f) {
+            flags |= NAN_FLAG;
+        } else if (((high >> 58) & 0x1f) == 0x1e) {
+            flags |= INFINITY_FLAG;
+        }
+        return *this;
+    }
+    auto biasedExponent = static_cast<int32_t>((high >> 49) & 0x3fff);
+    uint64_t coefficientHigh = high & ((static_cast<uint64_t>(1) << 49) - 1);
+    // The high and low words of 10^34
+    static const uint64_t kMaxCoefficientHigh = 0x1ed09bead87c0ULL;
+    static const uint64_t kMaxCoefficientLow = 0x378d8e6400000000ULL;
+    if (coefficientHigh > kMaxCoefficientHigh ||
+            (coefficientHigh == kMaxCoefficientHigh && low >= kMaxCoefficientLow)) {
+        return *this;
+    }
+    if (coefficientHigh != 0 || low != 0) {
+        readUInt128ToBcd(coefficientHigh, low);
+        // The exponent bias of decimal128 is 6176.
+        scale = biasedExponent - 6176;
+        compact();
+    }
+    return *this;
+}
+
 int64_t DecimalQuantity::toLong(bool truncateIfOverflow) const {
     // NOTE: Call sites should be guarded by fitsInLong(), like this:
     // if (dq.fitsInLong()) { /* use dq.toLong() */ } else { /* use some fallback */ }
@@ -573,14 +845,43 @@ double DecimalQuantity::toDouble() const {
         return isNegative() ? -INFINITY : INFINITY;
     }
 
-    // We are processing well-formed input, so we don't need any special options to StringToDoubleConverter.
-    StringToDoubleConverter converter(0, 0, 0, "", "");
-    UnicodeString numberString = this->toScientificString();
-    int32_t count;
-    return converter.StringToDouble(
-            reinterpret_cast<const uint16_t*>(numberString.getBuffer()),
-            numberString.length(),
-            &count);
+    // Use the same digits as toScientificString(): the value is the integer formed by the digits
+    // from upperPos down to lowerPos, times 10^exponent.
+    int32_t upperPos = std::min(precision + scale, lOptPos) - scale - 1;
+    int32_t lowerPos = std::max(scale, rOptPos) - scale;
+    if (lowerPos > upperPos) {
+        lowerPos = upperPos;  // toScientificString() always writes the leading digit
+    }
+    int32_t numDigits = upperPos - lowerPos + 1;
+    int32_t exponent = lowerPos + scale;
+
+    double result;
+    if (numDigits <= 15 && exponent >= -21 && exponent <= 21) {
+        // Fast path: The digits form an integer below 2^53, and the power of ten is exact,
+        // so a single multiplication or division gives the correctly rounded result.
+        int64_t mantissa = 0;
+        for (int32_t p = upperPos; p >= lowerPos; p--) {
+            mantissa = mantissa * 10 + getDigitPos(p);
+        }
+        result = static_cast<double>(mantissa);
+        if (exponent > 0) {
+            result *= DOUBLE_MULTIPLIERS[exponent];
+        } else if (exponent < 0) {
+            result /= DOUBLE_MULTIPLIERS[-exponent];
+        }
+    } else {
+        // Pass the digits and the exponent straight to double-conversion, which computes the
+        // correctly rounded value, rather than formatting and re-parsing a number string.
+        MaybeStackArray<char, 40> digits(numDigits);
+        if (digits.getAlias() == nullptr || digits.getCapacity() < numDigits) {
+            return NAN;
+        }
+        for (int32_t i = 0; i < numDigits; i++) {
+            digits[i] = static_cast<char>('0' + getDigitPos(upperPos - i));
+        }
+        result = Strtod(Vector<const char>(digits.getAlias(), numDigits), exponent);
+    }
+    return isNegative() ? -result : result;
 }
 
 void DecimalQuantity::toDecNum(DecNum& output, UErrorCode& status) const {
@@ -635,46 +936,29 @@ void DecimalQuantity::roundToMagnitude(int32_t magnitude, RoundingMode roundingM
                 section = roundingutils::SECTION_LOWER;
             } else if (leadingDigit > 5) {
                 section = roundingutils::SECTION_UPPER;
-            } else {
-                for (int p = safeSubtract(position, 2); p >= 0; p--) {
-                    if (getDigitPos(p) != 0) {
-                        section = roundingutils::SECTION_UPPER;
-                        break;
-                    }
-                }
+            } else if (!digitsEqual(0, safeSubtract(position, 2), 0)) {
+                section = roundingutils::SECTION_UPPER;
             }
         } else {
             int32_t p = safeSubtract(position, 2);
             int32_t minP = uprv_max(0, precision - 14);
             if (leadingDigit == 0) {
                 section = roundingutils::SECTION_LOWER_EDGE;
-                for (; p >= minP; p--) {
-                    if (getDigitPos(p) != 0) {
-                        section = roundingutils::SECTION_LOWER;
-                        break;
-                    }
+                if (!digitsEqual(minP, p, 0)) {
+                    section = roundingutils::SECTION_LOWER;
                 }
             } else if (leadingDigit == 4) {
-                for (; p >= minP; p--) {
-                    if (getDigitPos(p) != 9) {
-                        section = roundingutils::SECTION_LOWER;
-                        break;
-                    }
+                if (!digitsEqual(minP, p, 9)) {
+                    section = roundingutils::SECTION_LOWER;
                 }
             } else if (leadingDigit == 5) {
-                for (; p >= minP; p--) {
-                    if (getDigitPos(p) != 0) {
-                        section = roundingutils::SECTION_UPPER;
-                        break;
-                    }
+                if (!digitsEqual(minP, p, 0)) {
+                    section = roundingutils::SECTION_UPPER;
                 }
             } else if (leadingDigit == 9) {
                 section = roundingutils::SECTION_UPPER_EDGE;
-                for (; p >= minP; p--) {
-                    if (getDigitPos(p) != 9) {
-                        section = roundingutils::SECTION_UPPER;
-                        break;
-                    }
+                if (!digitsEqual(minP, p, 9)) {
+                    section = roundingutils::SECTION_UPPER;
                 }
             } else if (leadingDigit < 5) {
                 section = roundingutils::SECTION_LOWER;
@@ -728,11 +1012,9 @@ void DecimalQuantity::roundToMagnitude(int32_t magnitude, RoundingMode roundingM
         // Bubble the result to the higher digits
         if (!roundDown) {
             if (trailingDigit == 9) {
-                int bubblePos = 0;
-                // Note: in the long implementation, the most digits BCD can have at this point is 15,
-                // so bubblePos <= 15 and getDigitPos(bubblePos) is safe.
-                for (; getDigitPos(bubblePos) == 9; bubblePos++) {}
-                shiftRight(bubblePos); // shift off the trailing 9s
+                // Note: in the packed implementation, the most digits BCD can have at this point is 31,
+                // so there is at least one digit that is not a 9.
+                shiftRight(countTrailingNines()); // shift off the trailing 9s
             }
             int8_t digit0 = getDigitPos(0);
             U_ASSERT(digit0 != 9);
@@ -848,8 +1130,8 @@ int8_t DecimalQuantity::getDigitPos(int32_t position) const {
         if (position < 0 || position >= precision) { return 0; }
         return fBCD.bcdBytes.ptr[position];
     } else {
-        if (position < 0 || position >= 16) { return 0; }
-        return (int8_t) ((fBCD.bcdLong >> (position * 4)) & 0xf);
+        if (position < 0 || position >= MAX_PACKED_DIGITS) { return 0; }
+        return (int8_t) ((fBCD.bcdLong[position >> 4] >> ((position & 15) * 4)) & 0xf);
     }
 }
 
@@ -858,18 +1140,75 @@ void DecimalQuantity::setDigitPos(int32_t position, int8_t value) {
     if (usingBytes) {
         ensureCapacity(position + 1);
         fBCD.bcdBytes.ptr[position] = value;
-    } else if (position >= 16) {
+    } else if (position >= MAX_PACKED_DIGITS) {
         switchStorage();
         ensureCapacity(position + 1);
         fBCD.bcdBytes.ptr[position] = value;
     } else {
-        int shift = position * 4;
-        fBCD.bcdLong = (fBCD.bcdLong & ~(0xfL << shift)) | ((long) value << shift);
+        int shift = (position & 15) * 4;
+        uint64_t& word = fBCD.bcdLong[position >> 4];
+        word = (word & ~(static_cast<uint64_t>(0xf) << shift)) | (static_cast<uint64_t>(value) << shift);
+    }
+}
+
+bool DecimalQuantity::digitsEqual(int32_t lower, int32_t upper, int8_t digit) const {
+    lower = uprv_max(lower, 0);
+    // All digits above the ones that are stored are zero.
+    int32_t limit = usingBytes ? precision : MAX_PACKED_DIGITS;
+    if (lower > upper) {
+        return true;
+    } else if (upper >= limit) {
+        if (digit != 0) {
+            return false;
+        }
+        upper = limit - 1;
+        if (lower > upper) {
+            return true;
+        }
+    }
+    if (usingBytes) {
+        for (int32_t p = lower; p <= upper; p++) {
+            if (fBCD.bcdBytes.ptr[p] != digit) {
+                return false;
+            }
+        }
+        return true;
+    }
+    // Compare all of the digits in each of the two longs at once.
+    uint64_t pattern = static_cast<uint64_t>(digit) * 0x1111111111111111ULL;
+    for (int32_t w = lower >> 4; w <= upper >> 4; w++) {
+        int32_t lowNibble = (w == (lower >> 4)) ? (lower & 15) : 0;
+        int32_t highNibble = (w == (upper >> 4)) ? (upper & 15) : 15;
+        uint64_t mask = ~static_cast<uint64_t>(0) << (lowNibble * 4);
+        if (highNibble < 15) {
+            mask &= (static_cast<uint64_t>(1) << ((highNibble + 1) * 4)) - 1;
+        }
+        if (((fBCD.bcdLong[w] ^ pattern) & mask) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t DecimalQuantity::countTrailingNines() const {
+    if (usingBytes) {
+        int32_t count = 0;
+        for (; count < precision && fBCD.bcdBytes.ptr[count] == 9; count++) {}
+        return count;
+    }
+    // XOR turns the 9s into zero nibbles; the digits above the precision are zero, not 9.
+    static const uint64_t NINES = 0x9999999999999999ULL;
+    if (fBCD.bcdLong[0] != NINES) {
+        return trailingZeroNibbles(fBCD.bcdLong[0] ^ NINES);
+    } else if (fBCD.bcdLong[1] != NINES) {
+        return 16 + trailingZeroNibbles(fBCD.bcdLong[1] ^ NINES);
+    } else {
+        return MAX_PACKED_DIGITS;
     }
 }
 
 void DecimalQuantity::shiftLeft(int32_t numDigits) {
-    if (!usingBytes && precision + numDigits > 16) {
+    if (!usingBytes && precision + numDigits > MAX_PACKED_DIGITS) {
         switchStorage();
     }
     if (usingBytes) {
@@ -882,7 +1221,7 @@ void DecimalQuantity::shiftLeft(int32_t numDigits) {
             fBCD.bcdBytes.ptr[i] = 0;
         }
     } else {
-        fBCD.bcdLong <<= (numDigits * 4);
+        shiftPackedLeft(fBCD.bcdLong, numDigits);
     }
     scale -= numDigits;
     precision += numDigits;
@@ -898,7 +1237,7 @@ void DecimalQuantity::shiftRight(int32_t numDigits) {
             fBCD.bcdBytes.ptr[i] = 0;
         }
     } else {
-        fBCD.bcdLong >>= (numDigits * 4);
+        shiftPackedRight(fBCD.bcdLong, numDigits);
     }
     scale += numDigits;
     precision -= numDigits;
@@ -910,7 +1249,8 @@ void DecimalQuantity::setBcdToZero() {
         fBCD.bcdBytes.ptr = nullptr;
         usingBytes = false;
     }
-    fBCD.bcdLong = 0L;
+    fBCD.bcdLong[0] = 0L;
+    fBCD.bcdLong[1] = 0L;
     scale = 0;
     precision = 0;
     isApproximate = false;
@@ -919,77 +1259,126 @@ void DecimalQuantity::setBcdToZero() {
 }
 
 void DecimalQuantity::readIntToBcd(int32_t n) {
-    U_ASSERT(n != 0);
+    U_ASSERT(n > 0);
     // ints always fit inside the long implementation.
-    uint64_t result = 0L;
-    int i = 16;
-    for (; n != 0; n /= 10, i--) {
-        result = (result >> 4) + ((static_cast<uint64_t>(n) % 10) << 60);
-    }
     U_ASSERT(!usingBytes);
-    fBCD.bcdLong = result >> (i * 4);
+    fBCD.bcdLong[0] = toPackedBcd16(static_cast<uint64_t>(n));
+    fBCD.bcdLong[1] = 0L;
     scale = 0;
-    precision = 16 - i;
+    precision = packedPrecision(fBCD.bcdLong);
 }
 
 void DecimalQuantity::readLongToBcd(int64_t n) {
-    U_ASSERT(n != 0);
-    if (n >= 10000000000000000L) {
-        ensureCapacity();
-        int i = 0;
-        for (; n != 0L; n /= 10L, i++) {
-            fBCD.bcdBytes.ptr[i] = static_cast<int8_t>(n % 10);
-        }
-        U_ASSERT(usingBytes);
-        scale = 0;
-        precision = i;
-    } else {
-        uint64_t result = 0L;
-        int i = 16;
-        for (; n != 0L; n /= 10L, i--) {
-            result = (result >> 4) + ((n % 10) << 60);
-        }
-        U_ASSERT(i >= 0);
-        U_ASSERT(!usingBytes);
-        fBCD.bcdLong = result >> (i * 4);
-        scale = 0;
-        precision = 16 - i;
+    U_ASSERT(n > 0);
+    // longs have at most 19 digits, so they also fit inside the long implementation.
+    U_ASSERT(!usingBytes);
+    auto u = static_cast<uint64_t>(n);
+    fBCD.bcdLong[0] = toPackedBcd16(u % 10000000000000000ULL);
+    fBCD.bcdLong[1] = toPackedBcd8(static_cast<uint32_t>(u / 10000000000000000ULL));
+    scale = 0;
+    precision = packedPrecision(fBCD.bcdLong);
+}
+
+bool DecimalQuantity::getDigitsAsInteger(uint64_t& result, int32_t maxDigits) const {
+    U_ASSERT(maxDigits <= 18);
+    if (precision > maxDigits) {
+        return false;
+    }
+    result = 0;
+    for (int32_t p = precision - 1; p >= 0; p--) {
+        result = result * 10 + getDigitPos(p);
+    }
+    return true;
+}
+
+void DecimalQuantity::setDigitsFromInteger(uint64_t digits, int32_t newScale) {
+    setBcdToZero();
+    if (digits != 0) {
+        _setToLong(static_cast<int64_t>(digits));
+        scale = newScale;
+        compact();
     }
 }
 
 void DecimalQuantity::readDecNumberToBcd(const DecNum& decnum) {
     const decNumber* dn = decnum.getRawDecNumber();
-    if (dn->digits > 16) {
+    if (dn->digits > MAX_PACKED_DIGITS) {
         ensureCapacity(dn->digits);
         for (int32_t i = 0; i < dn->digits; i++) {
             fBCD.bcdBytes.ptr[i] = dn->lsu[i];
         }
     } else {
-        uint64_t result = 0L;
+        uint64_t result[2] = {0L, 0L};
         for (int32_t i = 0; i < dn->digits; i++) {
-            result |= static_cast<uint64_t>(dn->lsu[i]) << (4 * i);
+            result[i >> 4] |= static_cast<uint64_t>(dn->lsu[i]) << (4 * (i & 15));
         }
-        fBCD.bcdLong = result;
+        fBCD.bcdLong[0] = result[0];
+        fBCD.bcdLong[1] = result[1];
     }
     scale = dn->exponent;
     precision = dn->digits;
 }
 
+void DecimalQuantity::readUInt128ToBcd(uint64_t high, uint64_t low) {
+    U_ASSERT(high != 0 || low != 0);
+    // Long division of the four 32-bit words by 10^9 yields base-10^9 chunks, least significant first.
+    // The coefficient is less than 10^34, so there are at most four chunks.
+    uint32_t words[4] = {
+        static_cast<uint32_t>(high >> 32), static_cast<uint32_t>(high),
+        static_cast<uint32_t>(low >> 32), static_cast<uint32_t>(low)};
+    int8_t digits[36];
+    int32_t length = 0;
+    bool isZero;
+    do {
+        uint64_t remainder = 0;
+        isZero = true;
+        for (int32_t i = 0; i < 4; i++) {
+            uint64_t dividend = (remainder << 32) | words[i];
+            words[i] = static_cast<uint32_t>(dividend / 1000000000);
+            remainder = dividend % 1000000000;
+            isZero = isZero && words[i] == 0;
+        }
+        auto chunk = static_cast<uint32_t>(remainder);
+        for (int32_t i = 0; i < 9; i++, chunk /= 10) {
+            digits[length++] = static_cast<int8_t>(chunk % 10);
+        }
+    } while (!isZero);
+    while (digits[length - 1] == 0) {
+        length--;
+    }
+    if (length > MAX_PACKED_DIGITS) {
+        ensureCapacity(length);
+        for (int32_t i = 0; i < length; i++) {
+            fBCD.bcdBytes.ptr[i] = digits[i];
+        }
+    } else {
+        uint64_t result[2] = {0L, 0L};
+        for (int32_t i = 0; i < length; i++) {
+            result[i >> 4] |= static_cast<uint64_t>(digits[i]) << (4 * (i & 15));
+        }
+        fBCD.bcdLong[0] = result[0];
+        fBCD.bcdLong[1] = result[1];
+    }
+    scale = 0;
+    precision = length;
+}
+
 void DecimalQuantity::readDoubleConversionToBcd(
         const char* buffer, int32_t length, int32_t point) {
     // NOTE: Despite the fact that double-conversion's API is called
     // "DoubleToAscii", they actually use '0' (as opposed to u8'0').
-    if (length > 16) {
+    if (length > MAX_PACKED_DIGITS) {
         ensureCapacity(length);
         for (int32_t i = 0; i < length; i++) {
             fBCD.bcdBytes.ptr[i] = buffer[length-i-1] - '0';
         }
     } else {
-        uint64_t result = 0L;
+        uint64_t result[2] = {0L, 0L};
         for (int32_t i = 0; i < length; i++) {
-            result |= static_cast<uint64_t>(buffer[length-i-1] - '0') << (4 * i);
+            result[i >> 4] |= static_cast<uint64_t>(buffer[length-i-1] - '0') << (4 * (i & 15));
         }
-        fBCD.bcdLong = result;
+        fBCD.bcdLong[0] = result[0];
+        fBCD.bcdLong[1] = result[1];
     }
     scale = point - length;
     precision = length;
@@ -1014,28 +1403,26 @@ void DecimalQuantity::compact() {
         precision = leading + 1;
 
         // Switch storage mechanism if possible
-        if (precision <= 16) {
+        if (precision <= MAX_PACKED_DIGITS) {
             switchStorage();
         }
 
     } else {
-        if (fBCD.bcdLong == 0L) {
+        if (fBCD.bcdLong[0] == 0L && fBCD.bcdLong[1] == 0L) {
             // Number is zero
             setBcdToZero();
             return;
         }
 
-        // Compact the number (remove trailing zeros)
-        // TODO: Use a more efficient algorithm here and below. There is a logarithmic one.
-        int32_t delta = 0;
-        for (; delta < precision && getDigitPos(delta) == 0; delta++);
-        fBCD.bcdLong >>= delta * 4;
+        // Compact the number (remove trailing zeros), counting the zero digits of a long at once
+        int32_t delta = fBCD.bcdLong[0] != 0L
+            ? trailingZeroNibbles(fBCD.bcdLong[0])
+            : 16 + trailingZeroNibbles(fBCD.bcdLong[1]);
+        shiftPackedRight(fBCD.bcdLong, delta);
         scale += delta;
 
         // Compute precision
-        int32_t leading = precision - 1;
-        for (; leading >= 0 && getDigitPos(leading) == 0; leading--);
-        precision = leading + 1;
+        precision = packedPrecision(fBCD.bcdLong);
     }
 }
 
@@ -1069,23 +1456,23 @@ void DecimalQuantity::ensureCapacity(int32_t capacity) {
 void DecimalQuantity::switchStorage() {
     if (usingBytes) {
         // Change from bytes to long
-        uint64_t bcdLong = 0L;
+        U_ASSERT(precision <= MAX_PACKED_DIGITS);
+        uint64_t bcdLong[2] = {0L, 0L};
         for (int i = precision - 1; i >= 0; i--) {
-            bcdLong <<= 4;
-            bcdLong |= fBCD.bcdBytes.ptr[i];
+            bcdLong[i >> 4] |= static_cast<uint64_t>(fBCD.bcdBytes.ptr[i]) << (4 * (i & 15));
         }
         uprv_free(fBCD.bcdBytes.ptr);
         fBCD.bcdBytes.ptr = nullptr;
-        fBCD.bcdLong = bcdLong;
+        fBCD.bcdLong[0] = bcdLong[0];
+        fBCD.bcdLong[1] = bcdLong[1];
         usingBytes = false;
     } else {
         // Change from long to bytes
-        // Copy the long into a local variable since it will get munged when we allocate the bytes
-        uint64_t bcdLong = fBCD.bcdLong;
+        // Copy the longs into a local variable since they will get munged when we allocate the bytes
+        uint64_t bcdLong[2] = {fBCD.bcdLong[0], fBCD.bcdLong[1]};
         ensureCapacity();
         for (int i = 0; i < precision; i++) {
-            fBCD.bcdBytes.ptr[i] = static_cast<int8_t>(bcdLong & 0xf);
-            bcdLong >>= 4;
+            fBCD.bcdBytes.ptr[i] = static_cast<int8_t>((bcdLong[i >> 4] >> (4 * (i & 15))) & 0xf);
         }
         U_ASSERT(usingBytes);
     }
@@ -1097,7 +1484,8 @@ void DecimalQuantity::copyBcdFrom(const DecimalQuantity &other) {
         ensureCapacity(other.precision);
         uprv_memcpy(fBCD.bcdBytes.ptr, other.fBCD.bcdBytes.ptr, other.precision * sizeof(int8_t));
     } else {
-        fBCD.bcdLong = other.fBCD.bcdLong;
+        fBCD.bcdLong[0] = other.fBCD.bcdLong[0];
+        fBCD.bcdLong[1] = other.fBCD.bcdLong[1];
     }
 }
 
@@ -1111,7 +1499,8 @@ void DecimalQuantity::moveBcdFrom(DecimalQuantity &other) {
         other.fBCD.bcdBytes.ptr = nullptr;
         other.usingBytes = false;
     } else {
-        fBCD.bcdLong = other.fBCD.bcdLong;
+        fBCD.bcdLong[0] = other.fBCD.bcdLong[0];
+        fBCD.bcdLong[1] = other.fBCD.bcdLong[1];
     }
 }
 
@@ -1130,10 +1519,10 @@ const char16_t* DecimalQuantity::checkHealth() const {
             if (getDigitPos(i) != 0) { return u"Nonzero digits outside of range in byte array"; }
         }
     } else {
-        if (precision == 0 && fBCD.bcdLong != 0) {
+        if (precision == 0 && (fBCD.bcdLong[0] != 0 || fBCD.bcdLong[1] != 0)) {
             return u"Value in bcdLong even though precision is zero";
         }
-        if (precision > 16) { return u"Precision exceeds length of long"; }
+        if (precision > MAX_PACKED_DIGITS) { return u"Precision exceeds length of long"; }
         if (precision != 0 && getDigitPos(precision - 1) == 0) {
             return u"Most significant digit is zero in long mode";
         }
@@ -1144,7 +1533,7 @@ const char16_t* DecimalQuantity::checkHealth() const {
             if (getDigitPos(i) >= 10) { return u"Digit exceeding 10 in long"; }
             if (getDigitPos(i) < 0) { return u"Digit below 0 in long (?!)"; }
         }
-        for (int i = precision; i < 16; i++) {
+        for (int i = precision; i < MAX_PACKED_DIGITS; i++) {
             if (getDigitPos(i) != 0) { return u"Nonzero digits outside of range in long"; }
         }
     }
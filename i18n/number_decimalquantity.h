@@ -100,7 +100,8 @@ class U_I18N_API DecimalQuantity : public IFixedDecimal, public UMemory {
     void roundToInfinity();
 
     /**
-     * Multiply the internal value. Uses decNumber.
+     * Multiply the internal value. Uses decNumber, except for a multiplicand with up to 9 digits
+     * and a value with up to 9 digits, which are multiplied as integers.
      *
      * @param multiplicand The value by which to multiply.
      */
@@ -175,6 +176,19 @@ class U_I18N_API DecimalQuantity : public IFixedDecimal, public UMemory {
     /** Internal method if the caller already has a DecNum. */
     DecimalQuantity &setToDecNum(const DecNum& n, UErrorCode& status);
 
+    /**
+     * Sets the value to mantissa * 10^(-scale), such as a count of cents with a scale of 2.
+     * The digits go straight into the BCD, without a detour through a string or a DecNum.
+     */
+    DecimalQuantity &setToFixedPoint(int64_t mantissa, int32_t scale);
+
+    /**
+     * Sets the value to an IEEE 754 decimal128 number in the binary integer decimal (BID) encoding,
+     * given as its high and low 64 bits. The coefficient goes straight into the BCD.
+     * Non-canonical coefficients are read as zero, as in the standard.
+     */
+    DecimalQuantity &setToDecimal128(uint64_t high, uint64_t low);
+
     /**
      * Appends a digit, optionally with one or more leading zeros, to the end of the value represented
      * by this DecimalQuantity.
@@ -285,7 +299,7 @@ class U_I18N_API DecimalQuantity : public IFixedDecimal, public UMemory {
 
     /**
      * The number of digits in the BCD. For example, "1007" has BCD "0x1007" and precision 4. The
-     * maximum precision is 16 since a long can hold only 16 digits.
+     * maximum precision of the packed form is 32 since two longs can hold only 32 digits.
      *
      * <p>This value must be re-calculated whenever the value in bcd changes by using {@link
      * #computePrecisionAndCompact()}.
@@ -359,8 +373,9 @@ class U_I18N_API DecimalQuantity : public IFixedDecimal, public UMemory {
     int32_t rOptPos = INT32_MIN;
 
     /**
-     * The BCD of the 16 digits of the number represented by this object. Every 4 bits of the long map
-     * to one digit. For example, the number "12345" in BCD is "0x12345".
+     * The BCD of the up to 32 digits of the number represented by this object. Every 4 bits of the two
+     * longs map to one digit; bcdLong[0] holds the 16 least significant digits. For example, the number
+     * "12345" in BCD is "0x12345".
      *
      * <p>Whenever bcd changes internally, {@link #compact()} must be called, except in special cases
      * like setting the digit to zero.
@@ -370,7 +385,7 @@ class U_I18N_API DecimalQuantity : public IFixedDecimal, public UMemory {
             int8_t *ptr;
             int32_t len;
         } bcdBytes;
-        uint64_t bcdLong;
+        uint64_t bcdLong[2];
     } fBCD;
 
     bool usingBytes = false;
@@ -402,6 +417,16 @@ class U_I18N_API DecimalQuantity : public IFixedDecimal, public UMemory {
      */
     void setDigitPos(int32_t position, int8_t value);
 
+    /**
+     * Returns whether all of the digits from position lower through position upper, inclusive,
+     * are equal to the given digit. Returns true if the range is empty.
+     * The packed form compares up to 16 digits at a time.
+     */
+    bool digitsEqual(int32_t lower, int32_t upper, int8_t digit) const;
+
+    /** Returns the number of consecutive 9s at the least significant end of the BCD. */
+    int32_t countTrailingNines() const;
+
     /**
      * Adds zeros to the end of the BCD list. This will result in an invalid BCD representation; it is
      * the caller's responsibility to do further manipulation and then call {@link #compact}.
@@ -436,8 +461,31 @@ class U_I18N_API DecimalQuantity : public IFixedDecimal, public UMemory {
 
     void readDecNumberToBcd(const DecNum& dn);
 
+    /** Reads a coefficient of 113 bits or less, from its high 49 and low 64 bits. */
+    void readUInt128ToBcd(uint64_t high, uint64_t low);
+
     void readDoubleConversionToBcd(const char* buffer, int32_t length, int32_t point);
 
+    /**
+     * Returns the digits as an integer, without the scale and the sign.
+     * Returns false if there are more than maxDigits digits (at most 18).
+     */
+    bool getDigitsAsInteger(uint64_t& result, int32_t maxDigits) const;
+
+    /**
+     * Sets the digits to the given integer below 2^63, times 10^newScale.
+     * Keeps the sign and the display positions.
+     */
+    void setDigitsFromInteger(uint64_t digits, int32_t newScale);
+
+    /**
+     * Implements roundToIncrement() in integer arithmetic on the digits, for an increment
+     * with up to maxFrac fraction digits and a value with up to 18 digits.
+     * Returns false without changing the value if that does not apply.
+     */
+    bool roundToIncrementExact(double roundingIncrement, RoundingMode roundingMode,
+                               int32_t maxFrac, UErrorCode& status);
+
     void copyFieldsFrom(const DecimalQuantity& other);
 
     void copyBcdFrom(const DecimalQuantity &other);
@@ -6,7 +6,10 @@
 #if !UCONFIG_NO_FORMATTING
 
 #include "uassert.h"
+#include "cmemory.h"
 #include "unicode/numberformatter.h"
+#include "unicode/ustring.h"
+#include "ustr_imp.h"
 #include "number_decimalquantity.h"
 #include "number_formatimpl.h"
 #include "umutex.h"
@@ -16,6 +19,7 @@
 #include "number_utypes.h"
 #include "util.h"
 #include "fphdlimp.h"
+#include "utracimp.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -386,7 +390,12 @@ UnlocalizedNumberFormatter& UnlocalizedNumberFormatter::operator=(UNF&& src) U_N
 
 // Make default copy constructor call the NumberFormatterSettings copy constructor.
 LocalizedNumberFormatter::LocalizedNumberFormatter(const LNF& other)
-        : LNF(static_cast<const NFS<LNF>&>(other)) {}
+        : LNF(static_cast<const NFS<LNF>&>(other)) {
+    // Share a compiled formatter from compile(); a lazily compiled one is not copied.
+    if (other.fCompiledShared) {
+        lnfShareHelper(other.fCompiled);
+    }
+}
 
 LocalizedNumberFormatter::LocalizedNumberFormatter(const NFS<LNF>& other)
         : NFS<LNF>(other) {
@@ -407,8 +416,12 @@ LocalizedNumberFormatter::LocalizedNumberFormatter(NFS<LNF>&& src) U_NOEXCEPT
 
 LocalizedNumberFormatter& LocalizedNumberFormatter::operator=(const LNF& other) {
     NFS<LNF>::operator=(static_cast<const NFS<LNF>&>(other));
-    // Reset to default values.
-    clear();
+    if (other.fCompiledShared) {
+        lnfShareHelper(other.fCompiled);
+    } else {
+        // Reset to default values.
+        clear();
+    }
     return *this;
 }
 
@@ -429,8 +442,11 @@ void LocalizedNumberFormatter::clear() {
     // Reset to default values.
     auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
     umtx_storeRelease(*callCount, 0);
-    delete fCompiled;
+    if (fCompiled != nullptr) {
+        fCompiled->removeRef();
+    }
     fCompiled = nullptr;
+    fCompiledShared = false;
 }
 
 void LocalizedNumberFormatter::lnfMoveHelper(LNF&& src) {
@@ -439,17 +455,33 @@ void LocalizedNumberFormatter::lnfMoveHelper(LNF&& src) {
     // The bits themselves appear to be platform-dependent, so copying them might not be safe.
     auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
     umtx_storeRelease(*callCount, INT32_MIN);
-    delete fCompiled;
+    if (fCompiled != nullptr) {
+        fCompiled->removeRef();
+    }
     fCompiled = src.fCompiled;
+    fCompiledShared = src.fCompiledShared;
     // Reset the source object to leave it in a safe state.
     auto* srcCallCount = reinterpret_cast<u_atomic_int32_t*>(src.fUnsafeCallCount);
     umtx_storeRelease(*srcCallCount, 0);
     src.fCompiled = nullptr;
+    src.fCompiledShared = false;
+}
+
+void LocalizedNumberFormatter::lnfShareHelper(const NumberFormatterImpl* compiled) {
+    // Add the reference before releasing the old one, in case of self-assignment.
+    compiled->addRef();
+    clear();
+    auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
+    umtx_storeRelease(*callCount, INT32_MIN);
+    fCompiled = compiled;
+    fCompiledShared = true;
 }
 
 
 LocalizedNumberFormatter::~LocalizedNumberFormatter() {
-    delete fCompiled;
+    if (fCompiled != nullptr) {
+        fCompiled->removeRef();
+    }
 }
 
 LocalizedNumberFormatter::LocalizedNumberFormatter(const MacroProps& macros, const Locale& locale) {
@@ -594,8 +626,7 @@ FormattedNumber LocalizedNumberFormatter::formatInt(int64_t value, UErrorCode& s
         status = U_MEMORY_ALLOCATION_ERROR;
         return FormattedNumber(status);
     }
-    results->quantity.setToLong(value);
-    formatImpl(results, status);
+    formatIntImpl(value, results, true, status);
 
     // Do not save the results object if we encountered a failure.
     if (U_SUCCESS(status)) {
@@ -606,6 +637,36 @@ FormattedNumber LocalizedNumberFormatter::formatInt(int64_t value, UErrorCode& s
     }
 }
 
+int32_t LocalizedNumberFormatter::formatInt(int64_t value, char16_t* dest, int32_t capacity,
+                                           UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    if (capacity < 0 || (dest == nullptr && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    // The results object lives on the stack, with the NumberStringBuilder's inline buffer.
+    UFormattedNumberData results;
+    formatIntImpl(value, &results, false, status);
+    if (U_FAILURE(status)) { return 0; }
+    return results.string.toTempUnicodeString().extract(dest, capacity, status);
+}
+
+int32_t LocalizedNumberFormatter::formatIntToUTF8(int64_t value, char* dest, int32_t capacity,
+                                                  UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    if (capacity < 0 || (dest == nullptr && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UFormattedNumberData results;
+    formatIntImpl(value, &results, false, status);
+    if (U_FAILURE(status)) { return 0; }
+    UnicodeString temp = results.string.toTempUnicodeString();
+    int32_t length = 0;
+    u_strToUTF8(dest, capacity, &length, temp.getBuffer(), temp.length(), &status);
+    return length;
+}
+
 FormattedNumber LocalizedNumberFormatter::formatDouble(double value, UErrorCode& status) const {
     if (U_FAILURE(status)) { return FormattedNumber(U_ILLEGAL_ARGUMENT_ERROR); }
     auto results = new UFormattedNumberData();
@@ -644,6 +705,46 @@ FormattedNumber LocalizedNumberFormatter::formatDecimal(StringPiece value, UErro
     }
 }
 
+FormattedNumber LocalizedNumberFormatter::formatFixedPoint(int64_t mantissa, int32_t scale,
+                                                           UErrorCode& status) const {
+    if (U_FAILURE(status)) { return FormattedNumber(U_ILLEGAL_ARGUMENT_ERROR); }
+    auto results = new UFormattedNumberData();
+    if (results == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return FormattedNumber(status);
+    }
+    results->quantity.setToFixedPoint(mantissa, scale);
+    formatImpl(results, status);
+
+    // Do not save the results object if we encountered a failure.
+    if (U_SUCCESS(status)) {
+        return FormattedNumber(results);
+    } else {
+        delete results;
+        return FormattedNumber(status);
+    }
+}
+
+FormattedNumber LocalizedNumberFormatter::formatDecimal128(uint64_t high, uint64_t low,
+                                                           UErrorCode& status) const {
+    if (U_FAILURE(status)) { return FormattedNumber(U_ILLEGAL_ARGUMENT_ERROR); }
+    auto results = new UFormattedNumberData();
+    if (results == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return FormattedNumber(status);
+    }
+    results->quantity.setToDecimal128(high, low);
+    formatImpl(results, status);
+
+    // Do not save the results object if we encountered a failure.
+    if (U_SUCCESS(status)) {
+        return FormattedNumber(results);
+    } else {
+        delete results;
+        return FormattedNumber(status);
+    }
+}
+
 FormattedNumber
 LocalizedNumberFormatter::formatDecimalQuantity(const DecimalQuantity& dq, UErrorCode& status) const {
     if (U_FAILURE(status)) { return FormattedNumber(U_ILLEGAL_ARGUMENT_ERROR); }
@@ -665,6 +766,7 @@ LocalizedNumberFormatter::formatDecimalQuantity(const DecimalQuantity& dq, UErro
 }
 
 void LocalizedNumberFormatter::formatImpl(impl::UFormattedNumberData* results, UErrorCode& status) const {
+    MemoryTagScope memoryTag(UMEM_TAG_FORMATTING);
     if (computeCompiled(status)) {
         fCompiled->format(results->quantity, results->string, status);
     } else {
@@ -672,6 +774,24 @@ void LocalizedNumberFormatter::formatImpl(impl::UFormattedNumberData* results, U
     }
 }
 
+void LocalizedNumberFormatter::formatIntImpl(int64_t value, impl::UFormattedNumberData* results,
+                                             bool needsQuantity, UErrorCode& status) const {
+    if (computeCompiled(status)) {
+        if (fCompiled->hasIntegerFastPath()) {
+            if (needsQuantity) {
+                results->quantity.setToLong(value);
+            }
+            fCompiled->formatInt(value, results->string, status);
+        } else {
+            results->quantity.setToLong(value);
+            fCompiled->format(results->quantity, results->string, status);
+        }
+    } else {
+        results->quantity.setToLong(value);
+        NumberFormatterImpl::formatStatic(fMacros, results->quantity, results->string, status);
+    }
+}
+
 void LocalizedNumberFormatter::getAffixImpl(bool isPrefix, bool isNegative, UnicodeString& result,
                                             UErrorCode& status) const {
     NumberStringBuilder string;
@@ -693,6 +813,7 @@ void LocalizedNumberFormatter::getAffixImpl(bool isPrefix, bool isNegative, Unic
 }
 
 bool LocalizedNumberFormatter::computeCompiled(UErrorCode& status) const {
+    MemoryTagScope memoryTag(UMEM_TAG_FORMATTING);
     // fUnsafeCallCount contains memory to be interpreted as an atomic int, most commonly
     // std::atomic<int32_t>.  Since the type of atomic int is platform-dependent, we cast the
     // bytes in fUnsafeCallCount to u_atomic_int32_t, a typedef for the platform-dependent
@@ -715,11 +836,15 @@ bool LocalizedNumberFormatter::computeCompiled(UErrorCode& status) const {
 
     if (currentCount == fMacros.threshold && fMacros.threshold > 0) {
         // Build the data structure and then use it (slow to fast path).
+        UTRACE_ENTRY_OC(UTRACE_UNUMF_COMPILE);
+        UTRACE_DATA1(UTRACE_OPEN_CLOSE, "locale %s", fMacros.locale.getName());
         const NumberFormatterImpl* compiled = new NumberFormatterImpl(fMacros, status);
+        UTRACE_EXIT_PTR_STATUS(compiled, status);
         if (compiled == nullptr) {
             status = U_MEMORY_ALLOCATION_ERROR;
             return false;
         }
+        compiled->addRef();
         U_ASSERT(fCompiled == nullptr);
         const_cast<LocalizedNumberFormatter*>(this)->fCompiled = compiled;
         umtx_storeRelease(*callCount, INT32_MIN);
@@ -734,6 +859,67 @@ bool LocalizedNumberFormatter::computeCompiled(UErrorCode& status) const {
     }
 }
 
+int32_t LocalizedNumberFormatter::formatBatch(const double* values, int32_t count, char16_t* dest,
+                                              int32_t capacity, int32_t* offsets, UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    if (count < 0 || (values == nullptr && count > 0) || capacity < 0 ||
+            (dest == nullptr && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    // The batch always uses a safe compiled formatter. If this object does not have one yet,
+    // build one for the batch: That costs about as much as one call on the unsafe static path.
+    LocalPointer<const NumberFormatterImpl> batchCompiled;
+    const NumberFormatterImpl* compiled;
+    if (computeCompiled(status)) {
+        compiled = fCompiled;
+    } else {
+        batchCompiled.adoptInsteadAndCheckErrorCode(new NumberFormatterImpl(fMacros, status), status);
+        compiled = batchCompiled.getAlias();
+    }
+    if (U_FAILURE(status)) { return 0; }
+
+    DecimalQuantity quantity;
+    MicroProps micros;
+    NumberStringBuilder string;
+    int32_t length = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        string.clear();
+        quantity.setToDouble(values[i]);
+        compiled->format(quantity, micros, string, status);
+        if (U_FAILURE(status)) { return 0; }
+        int32_t valueLength = string.length();
+        if (valueLength > INT32_MAX - length) {
+            status = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        if (offsets != nullptr) {
+            offsets[i] = length;
+        }
+        if (valueLength <= capacity - length) {
+            string.toTempUnicodeString().extract(0, valueLength, dest, length);
+        }
+        length += valueLength;
+    }
+    if (offsets != nullptr) {
+        offsets[count] = length;
+    }
+    return u_terminateUChars(dest, capacity, length, &status);
+}
+
+LocalizedNumberFormatter LocalizedNumberFormatter::compile(UErrorCode& status) const {
+    LocalizedNumberFormatter result(*this);
+    if (U_FAILURE(status) || result.fCompiled != nullptr) {
+        return result;
+    }
+    LocalPointer<const NumberFormatterImpl> compiled(new NumberFormatterImpl(fMacros, status), status);
+    if (U_FAILURE(status)) {
+        return result;
+    }
+    result.lnfShareHelper(compiled.orphan());
+    return result;
+}
+
 const impl::NumberFormatterImpl* LocalizedNumberFormatter::getCompiled() const {
     return fCompiled;
 }
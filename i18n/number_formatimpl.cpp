@@ -26,6 +26,18 @@ using namespace icu::number::impl;
 
 namespace {
 
+// "00" "01" ... "99": the decimal digits of each value below 100, for the integer fast path.
+static const char kDigitPairs[] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+}  // namespace
+
+namespace {
+
 struct CurrencyFormatInfoResult {
     bool exists;
     const char16_t* pattern;
@@ -96,6 +108,11 @@ int32_t NumberFormatterImpl::getPrefixSuffixStatic(const MacroProps& macros, int
 int32_t NumberFormatterImpl::format(DecimalQuantity& inValue, NumberStringBuilder& outString,
                                 UErrorCode& status) const {
     MicroProps micros;
+    return format(inValue, micros, outString, status);
+}
+
+int32_t NumberFormatterImpl::format(DecimalQuantity& inValue, MicroProps& micros,
+                                    NumberStringBuilder& outString, UErrorCode& status) const {
     preProcess(inValue, micros, status);
     if (U_FAILURE(status)) { return 0; }
     int32_t length = writeNumber(micros, inValue, outString, 0, status);
@@ -103,6 +120,68 @@ int32_t NumberFormatterImpl::format(DecimalQuantity& inValue, NumberStringBuilde
     return length;
 }
 
+int32_t NumberFormatterImpl::formatInt(int64_t value, NumberStringBuilder& outString,
+                                       UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    U_ASSERT(fIntegerFastPath);
+    auto signum = static_cast<int8_t>(value < 0 ? -1 : (value > 0 ? 1 : 0));
+    // Negate in unsigned arithmetic so that INT64_MIN works too.
+    uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+
+    // Write the digits from the right end of the buffer, two at a time.
+    // Longest: "9223372036854775808" (19 digits)
+    static constexpr int32_t localCapacity = 20;
+    char16_t localBuffer[localCapacity];
+    char16_t* ptr = localBuffer + localCapacity;
+    while (magnitude >= 100) {
+        const char* pair = kDigitPairs + 2 * (magnitude % 100);
+        magnitude /= 100;
+        *(--ptr) = static_cast<char16_t>(fIntegerZero + (pair[1] - '0'));
+        *(--ptr) = static_cast<char16_t>(fIntegerZero + (pair[0] - '0'));
+    }
+    if (magnitude >= 10) {
+        const char* pair = kDigitPairs + 2 * magnitude;
+        *(--ptr) = static_cast<char16_t>(fIntegerZero + (pair[1] - '0'));
+        *(--ptr) = static_cast<char16_t>(fIntegerZero + (pair[0] - '0'));
+    } else {
+        *(--ptr) = static_cast<char16_t>(fIntegerZero + magnitude);
+    }
+    int32_t digitCount = localCapacity - static_cast<int32_t>(ptr - localBuffer);
+    UnicodeString digits(FALSE, ptr, digitCount);  // read-only alias
+
+    // Same separator positions as Grouper::groupAtPosition() with the upper display magnitude
+    // digitCount-1: after the primary group, then after every secondary group.
+    int32_t length = 0;
+    const Grouper& grouping = fMicros.grouping;
+    if (grouping.fGrouping1 > 0 && digitCount > grouping.fGrouping1 &&
+            digitCount - grouping.fGrouping1 >= grouping.fMinGrouping) {
+        const UnicodeString& separator = fMicros.symbols->getConstSymbol(
+                fMicros.useCurrency
+                        ? DecimalFormatSymbols::ENumberFormatSymbol::kMonetaryGroupingSeparatorSymbol
+                        : DecimalFormatSymbols::ENumberFormatSymbol::kGroupingSeparatorSymbol);
+        // The position (number of digits to its right) of the leftmost separator.
+        int32_t position = grouping.fGrouping1 +
+                (digitCount - 1 - grouping.fGrouping1) / grouping.fGrouping2 * grouping.fGrouping2;
+        int32_t start = 0;
+        for (;;) {
+            int32_t limit = digitCount - position;
+            length += outString.insert(length, digits, start, limit, UNUM_INTEGER_FIELD, status);
+            length += outString.insert(length, separator, UNUM_GROUPING_SEPARATOR_FIELD, status);
+            start = limit;
+            if (position == grouping.fGrouping1) { break; }
+            position -= grouping.fGrouping2;
+        }
+        length += outString.insert(length, digits, start, digitCount, UNUM_INTEGER_FIELD, status);
+    } else {
+        length += outString.insert(length, digits, UNUM_INTEGER_FIELD, status);
+    }
+
+    // The inner and outer modifiers are empty; the pattern modifier does not need plural forms.
+    const Modifier* modMiddle = fImmutablePatternModifier->getModifier(signum, StandardPlural::Form::COUNT);
+    length += modMiddle->apply(outString, 0, length, status);
+    return length;
+}
+
 void NumberFormatterImpl::preProcess(DecimalQuantity& inValue, MicroProps& microsOut,
                                      UErrorCode& status) const {
     if (U_FAILURE(status)) { return; }
@@ -355,7 +434,23 @@ NumberFormatterImpl::macrosToMicroGenerator(const MacroProps& macros, bool safe,
     } else {
         patternModifier->setSymbols(fMicros.symbols, currencySymbols, unitWidth, nullptr);
     }
-    if (safe) {
+    if (safe && macros.affixProvider == nullptr && macros.currencySymbols == nullptr &&
+            !macros.symbols.isDecimalFormatSymbols()) {
+        // The pattern, symbols, and currency symbols all come from locale data,
+        // so the modifiers can be shared with other formatters with the same settings.
+        UnicodeString cacheKey(pattern);
+        cacheKey.append(u'\uFFFF')
+                .append(UnicodeString(nsName, -1, US_INV))
+                .append(u'|')
+                .append(currency.getISOCurrency(), -1)
+                .append(u'|')
+                .append(static_cast<char16_t>(u'0' + fMicros.sign))
+                .append(isPermille ? u'1' : u'0')
+                .append(static_cast<char16_t>(u'0' + unitWidth));
+        fImmutablePatternModifier.adoptInstead(
+                patternModifier->createSharedImmutableAndChain(chain, macros.locale, cacheKey, status));
+        chain = fImmutablePatternModifier.getAlias();
+    } else if (safe) {
         fImmutablePatternModifier.adoptInstead(patternModifier->createImmutableAndChain(chain, status));
         chain = fImmutablePatternModifier.getAlias();
     } else {
@@ -408,9 +503,42 @@ NumberFormatterImpl::macrosToMicroGenerator(const MacroProps& macros, bool safe,
         chain = fCompactHandler.getAlias();
     }
 
+    if (safe) {
+        setupIntegerFastPath(macros, precision, chain, patternModifier->needsPlurals());
+    }
+
     return chain;
 }
 
+void NumberFormatterImpl::setupIntegerFastPath(const MacroProps& macros, const Precision& precision,
+                                               const MicroPropsGenerator* chain, bool needsPlurals) {
+    // The pattern modifier must be the last link, with nothing but the base MicroProps before it:
+    // no multiplier, scientific notation, long names or compact notation.
+    if (chain != fImmutablePatternModifier.getAlias() || macros.scale.isValid() ||
+            fScientificHandler.isValid() || needsPlurals) {
+        return;
+    }
+    // The rounder must not add fraction digits.
+    bool integerPrecision = precision.fType == Precision::RND_NONE ||
+            (precision.fType == Precision::RND_FRACTION && precision.fUnion.fracSig.fMinFrac == 0);
+    // The integer width must neither pad nor truncate an int64 value.
+    const IntegerWidth& width = fMicros.integerWidth;
+    bool standardWidth = !width.fHasError && width.fUnion.minMaxInt.fMinInt == 1 &&
+            (width.fUnion.minMaxInt.fMaxInt == -1 || width.fUnion.minMaxInt.fMaxInt >= 19);
+    if (!integerPrecision || !standardWidth || fMicros.padding.isValid() ||
+            fMicros.decimal != UNUM_DECIMAL_SEPARATOR_AUTO ||
+            (fMicros.grouping.fGrouping1 > 0 && fMicros.grouping.fGrouping2 <= 0)) {
+        return;
+    }
+    // The digits must be contiguous BMP code points.
+    UChar32 codePointZero = fMicros.symbols->getCodePointZero();
+    if (codePointZero == -1 || U16_LENGTH(codePointZero) != 1) {
+        return;
+    }
+    fIntegerZero = static_cast<char16_t>(codePointZero);
+    fIntegerFastPath = true;
+}
+
 const PluralRules*
 NumberFormatterImpl::resolvePluralRules(const PluralRules* rulesPtr, const Locale& locale,
                                         UErrorCode& status) {
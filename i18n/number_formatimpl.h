@@ -15,6 +15,7 @@
 #include "number_longnames.h"
 #include "number_compact.h"
 #include "number_microprops.h"
+#include "sharedobject.h"
 
 U_NAMESPACE_BEGIN namespace number {
 namespace impl {
@@ -22,8 +23,11 @@ namespace impl {
 /**
  * This is the "brain" of the number formatting pipeline. It ties all the pieces together, taking in a MacroProps and a
  * DecimalQuantity and outputting a properly formatted number string.
+ *
+ * A "safe" instance owned by a LocalizedNumberFormatter is reference-counted, so that it can be shared by copies
+ * of a formatter returned by LocalizedNumberFormatter::compile().
  */
-class NumberFormatterImpl : public UMemory {
+class NumberFormatterImpl : public SharedObject {
   public:
     /**
      * Builds a "safe" MicroPropsGenerator, which is thread-safe and can be used repeatedly.
@@ -53,6 +57,24 @@ class NumberFormatterImpl : public UMemory {
      */
     int32_t format(DecimalQuantity& inValue, NumberStringBuilder& outString, UErrorCode& status) const;
 
+    /**
+     * Like format(), but with a MicroProps from the caller, which can be reused for a batch of values.
+     */
+    int32_t format(DecimalQuantity& inValue, MicroProps& micros, NumberStringBuilder& outString,
+                   UErrorCode& status) const;
+
+    /**
+     * Returns true if formatInt() can be used: the formatter was built with settings for which an int64
+     * value is written as plain localized digits with grouping, plus the affixes.
+     */
+    bool hasIntegerFastPath() const { return fIntegerFastPath; }
+
+    /**
+     * Like format(), but for an int64 value, without a DecimalQuantity or the MicroPropsGenerator chain.
+     * Must be called only if hasIntegerFastPath() returns true.
+     */
+    int32_t formatInt(int64_t value, NumberStringBuilder& outString, UErrorCode& status) const;
+
     /**
      * Like format(), but saves the result into an output MicroProps without additional processing.
      */
@@ -100,6 +122,9 @@ class NumberFormatterImpl : public UMemory {
         CurrencySymbols fCurrencySymbols;
     } fWarehouse;
 
+    // Integer fast path, for the "safe" formatter only:
+    bool fIntegerFastPath = false;
+    char16_t fIntegerZero = u'0';
 
     NumberFormatterImpl(const MacroProps &macros, bool safe, UErrorCode &status);
 
@@ -131,6 +156,13 @@ class NumberFormatterImpl : public UMemory {
     const MicroPropsGenerator *
     macrosToMicroGenerator(const MacroProps &macros, bool safe, UErrorCode &status);
 
+    /**
+     * Sets fIntegerFastPath if the MicroPropsGenerator chain has no effect on int64 values
+     * other than the sign-dependent pattern modifier.
+     */
+    void setupIntegerFastPath(const MacroProps &macros, const Precision &precision,
+                              const MicroPropsGenerator *chain, bool needsPlurals);
+
     static int32_t
     writeIntegerDigits(const MicroProps &micros, DecimalQuantity &quantity, NumberStringBuilder &string,
                        int32_t index, UErrorCode &status);
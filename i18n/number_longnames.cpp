@@ -14,11 +14,23 @@
 #include "number_microprops.h"
 #include <algorithm>
 #include "cstring.h"
+#include "unifiedcache.h"
 
 using namespace icu;
 using namespace icu::number;
 using namespace icu::number::impl;
 
+U_NAMESPACE_BEGIN
+
+template<> U_I18N_API
+const LongNameData *LocaleCacheKey<LongNameData>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return nullptr;
+}
+
+U_NAMESPACE_END
+
 namespace {
 
 constexpr int32_t DNAM_INDEX = StandardPlural::Form::COUNT;
@@ -154,13 +166,15 @@ UnicodeString getPerUnitFormat(const Locale& locale, const UNumberUnitWidth &wid
 /// END DATA LOADING ///
 ////////////////////////
 
-} // namespace
-
-LongNameHandler*
-LongNameHandler::forMeasureUnit(const Locale &loc, const MeasureUnit &unitRef, const MeasureUnit &perUnit,
-                                const UNumberUnitWidth &width, const PluralRules *rules,
-                                const MicroPropsGenerator *parent, UErrorCode &status) {
+/**
+ * Computes the simple format for each plural form of a measure unit, or of a unit per another unit.
+ * NOTE: outFormats MUST have room for all StandardPlural values.
+ */
+void getMeasureUnitFormats(const Locale &loc, const MeasureUnit &unitRef, const MeasureUnit &perUnit,
+                           const UNumberUnitWidth &width, UnicodeString *outFormats, UErrorCode &status) {
     MeasureUnit unit = unitRef;
+    bool isCompound = false;
+    UnicodeString perUnitFormat;
     if (uprv_strcmp(perUnit.getType(), "none") != 0) {
         // Compound unit: first try to simplify (e.g., meters per second is its own unit).
         bool isResolved = false;
@@ -169,59 +183,166 @@ LongNameHandler::forMeasureUnit(const Locale &loc, const MeasureUnit &unitRef, c
             unit = resolved;
         } else {
             // No simplified form is available.
-            return forCompoundUnit(loc, unit, perUnit, width, rules, parent, status);
+            isCompound = true;
+            UnicodeString secondaryData[ARRAY_LENGTH];
+            getMeasureData(loc, perUnit, width, secondaryData, status);
+            if (U_FAILURE(status)) { return; }
+            if (!secondaryData[PER_INDEX].isBogus()) {
+                perUnitFormat = secondaryData[PER_INDEX];
+            } else {
+                UnicodeString rawPerUnitFormat = getPerUnitFormat(loc, width, status);
+                if (U_FAILURE(status)) { return; }
+                // rawPerUnitFormat is something like "{0}/{1}"; we need to substitute in the secondary unit.
+                SimpleFormatter compiled(rawPerUnitFormat, 2, 2, status);
+                if (U_FAILURE(status)) { return; }
+                UnicodeString secondaryFormat = getWithPlural(secondaryData, StandardPlural::Form::ONE, status);
+                if (U_FAILURE(status)) { return; }
+                SimpleFormatter secondaryCompiled(secondaryFormat, 1, 1, status);
+                if (U_FAILURE(status)) { return; }
+                UnicodeString secondaryString = secondaryCompiled.getTextWithNoArguments().trim();
+                // TODO: Why does UnicodeString need to be explicit in the following line?
+                compiled.format(UnicodeString(u"{0}"), secondaryString, perUnitFormat, status);
+                if (U_FAILURE(status)) { return; }
+            }
         }
     }
 
-    auto* result = new LongNameHandler(rules, parent);
-    if (result == nullptr) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-        return nullptr;
+    UnicodeString primaryData[ARRAY_LENGTH];
+    getMeasureData(loc, unit, width, primaryData, status);
+    if (U_FAILURE(status)) { return; }
+    if (!isCompound) {
+        for (int32_t i = 0; i < StandardPlural::Form::COUNT; i++) {
+            outFormats[i] = getWithPlural(primaryData, static_cast<StandardPlural::Form>(i), status);
+        }
+        return;
+    }
+    SimpleFormatter trailCompiled(perUnitFormat, 1, 1, status);
+    if (U_FAILURE(status)) { return; }
+    for (int32_t i = 0; i < StandardPlural::Form::COUNT; i++) {
+        UnicodeString leadFormat = getWithPlural(primaryData, static_cast<StandardPlural::Form>(i), status);
+        if (U_FAILURE(status)) { return; }
+        trailCompiled.format(leadFormat, outFormats[i], status);
     }
+}
+
+/**
+ * Computes the simple format for each plural form of a currency long name.
+ * NOTE: outFormats MUST have room for all StandardPlural values.
+ */
+void getCurrencyLongNameFormats(const Locale &loc, const CurrencyUnit &currency, UnicodeString *outFormats,
+                                UErrorCode &status) {
     UnicodeString simpleFormats[ARRAY_LENGTH];
-    getMeasureData(loc, unit, width, simpleFormats, status);
-    if (U_FAILURE(status)) { return result; }
-    // TODO: What field to use for units?
-    result->simpleFormatsToModifiers(simpleFormats, UNUM_FIELD_COUNT, status);
-    return result;
+    getCurrencyLongNameData(loc, currency, simpleFormats, status);
+    if (U_FAILURE(status)) { return; }
+    for (int32_t i = 0; i < StandardPlural::Form::COUNT; i++) {
+        outFormats[i] = getWithPlural(simpleFormats, static_cast<StandardPlural::Form>(i), status);
+    }
+}
+
+/** The arguments for loading the data of a LongNameHandler; the creation context of a LongNameDataKey. */
+struct LongNameDataRequest {
+    // nullptr for currency long names
+    const MeasureUnit *unit;
+    const MeasureUnit *perUnit;
+    UNumberUnitWidth width;
+    // nullptr for measure units
+    const CurrencyUnit *currency;
+    // The field of the modifiers
+    Field field;
+};
+
+/** Cache key for LongNameData. The detail string identifies the unit or currency and the width. */
+class LongNameDataKey : public LocaleCacheKey<LongNameData> {
+  public:
+    LongNameDataKey(const Locale &loc, const UnicodeString &detail)
+            : LocaleCacheKey<LongNameData>(loc), fDetail(detail) {}
+
+    LongNameDataKey(const LongNameDataKey &other) = default;
+
+    ~LongNameDataKey() U_OVERRIDE = default;
+
+    int32_t hashCode() const U_OVERRIDE {
+        return static_cast<int32_t>(37u * static_cast<uint32_t>(LocaleCacheKey::hashCode()) +
+                                    static_cast<uint32_t>(fDetail.hashCode()));
+    }
+
+    UBool operator==(const CacheKeyBase &other) const U_OVERRIDE {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        return static_cast<const LongNameDataKey &>(other).fDetail == fDetail;
+    }
+
+    CacheKeyBase *clone() const U_OVERRIDE {
+        return new LongNameDataKey(*this);
+    }
+
+    const LongNameData *createObject(const void *creationContext, UErrorCode &status) const U_OVERRIDE {
+        const auto *request = static_cast<const LongNameDataRequest *>(creationContext);
+        LocalPointer<LongNameData> result(new LongNameData(), status);
+        if (U_FAILURE(status)) { return nullptr; }
+        UnicodeString formats[StandardPlural::Form::COUNT];
+        if (request->currency != nullptr) {
+            getCurrencyLongNameFormats(fLoc, *request->currency, formats, status);
+        } else {
+            getMeasureUnitFormats(fLoc, *request->unit, *request->perUnit, request->width,
+                                  formats, status);
+        }
+        if (U_FAILURE(status)) { return nullptr; }
+        for (int32_t i = 0; i < StandardPlural::Form::COUNT; i++) {
+            StandardPlural::Form plural = static_cast<StandardPlural::Form>(i);
+            SimpleFormatter compiledFormatter(formats[i], 0, 1, status);
+            if (U_FAILURE(status)) { return nullptr; }
+            result->modifiers[i] = SimpleModifier(
+                    compiledFormatter, request->field, false, {result.getAlias(), 0, plural});
+        }
+        result->addRef();
+        return result.orphan();
+    }
+
+  private:
+    UnicodeString fDetail;
+};
+
+UnicodeString unitToDetail(const MeasureUnit &unit) {
+    UnicodeString detail(unit.getType(), -1, US_INV);
+    return detail.append(u'-').append(UnicodeString(unit.getSubtype(), -1, US_INV));
+}
+
+} // namespace
+
+LongNameData::~LongNameData() = default;
+
+const Modifier* LongNameData::getModifier(int8_t /*signum*/, StandardPlural::Form plural) const {
+    return &modifiers[plural];
+}
+
+LongNameHandler::~LongNameHandler() {
+    SharedObject::clearPtr(fData);
 }
 
 LongNameHandler*
-LongNameHandler::forCompoundUnit(const Locale &loc, const MeasureUnit &unit, const MeasureUnit &perUnit,
-                                 const UNumberUnitWidth &width, const PluralRules *rules,
-                                 const MicroPropsGenerator *parent, UErrorCode &status) {
+LongNameHandler::forMeasureUnit(const Locale &loc, const MeasureUnit &unit, const MeasureUnit &perUnit,
+                                const UNumberUnitWidth &width, const PluralRules *rules,
+                                const MicroPropsGenerator *parent, UErrorCode &status) {
     auto* result = new LongNameHandler(rules, parent);
     if (result == nullptr) {
         status = U_MEMORY_ALLOCATION_ERROR;
         return nullptr;
     }
-    UnicodeString primaryData[ARRAY_LENGTH];
-    getMeasureData(loc, unit, width, primaryData, status);
-    if (U_FAILURE(status)) { return result; }
-    UnicodeString secondaryData[ARRAY_LENGTH];
-    getMeasureData(loc, perUnit, width, secondaryData, status);
-    if (U_FAILURE(status)) { return result; }
-
-    UnicodeString perUnitFormat;
-    if (!secondaryData[PER_INDEX].isBogus()) {
-        perUnitFormat = secondaryData[PER_INDEX];
-    } else {
-        UnicodeString rawPerUnitFormat = getPerUnitFormat(loc, width, status);
-        if (U_FAILURE(status)) { return result; }
-        // rawPerUnitFormat is something like "{0}/{1}"; we need to substitute in the secondary unit.
-        SimpleFormatter compiled(rawPerUnitFormat, 2, 2, status);
-        if (U_FAILURE(status)) { return result; }
-        UnicodeString secondaryFormat = getWithPlural(secondaryData, StandardPlural::Form::ONE, status);
-        if (U_FAILURE(status)) { return result; }
-        SimpleFormatter secondaryCompiled(secondaryFormat, 1, 1, status);
-        if (U_FAILURE(status)) { return result; }
-        UnicodeString secondaryString = secondaryCompiled.getTextWithNoArguments().trim();
-        // TODO: Why does UnicodeString need to be explicit in the following line?
-        compiled.format(UnicodeString(u"{0}"), secondaryString, perUnitFormat, status);
-        if (U_FAILURE(status)) { return result; }
-    }
+    UnicodeString detail(u"unit:");
+    detail.append(unitToDetail(unit))
+            .append(u'/')
+            .append(unitToDetail(perUnit))
+            .append(u':')
+            .append(static_cast<char16_t>(u'0' + width));
     // TODO: What field to use for units?
-    result->multiSimpleFormatsToModifiers(primaryData, perUnitFormat, UNUM_FIELD_COUNT, status);
+    LongNameDataRequest request = {&unit, &perUnit, width, nullptr, UNUM_FIELD_COUNT};
+    result->loadModifiers(loc, detail, &request, status);
     return result;
 }
 
@@ -234,40 +355,20 @@ LongNameHandler* LongNameHandler::forCurrencyLongNames(const Locale &loc, const
         status = U_MEMORY_ALLOCATION_ERROR;
         return nullptr;
     }
-    UnicodeString simpleFormats[ARRAY_LENGTH];
-    getCurrencyLongNameData(loc, currency, simpleFormats, status);
-    if (U_FAILURE(status)) { return nullptr; }
-    result->simpleFormatsToModifiers(simpleFormats, UNUM_CURRENCY_FIELD, status);
+    UnicodeString detail(u"currency:");
+    detail.append(currency.getISOCurrency(), -1);
+    LongNameDataRequest request = {nullptr, nullptr, UNUM_UNIT_WIDTH_FULL_NAME, &currency,
+                                   UNUM_CURRENCY_FIELD};
+    result->loadModifiers(loc, detail, &request, status);
     return result;
 }
 
-void LongNameHandler::simpleFormatsToModifiers(const UnicodeString *simpleFormats, Field field,
-                                               UErrorCode &status) {
-    for (int32_t i = 0; i < StandardPlural::Form::COUNT; i++) {
-        StandardPlural::Form plural = static_cast<StandardPlural::Form>(i);
-        UnicodeString simpleFormat = getWithPlural(simpleFormats, plural, status);
-        if (U_FAILURE(status)) { return; }
-        SimpleFormatter compiledFormatter(simpleFormat, 0, 1, status);
-        if (U_FAILURE(status)) { return; }
-        fModifiers[i] = SimpleModifier(compiledFormatter, field, false, {this, 0, plural});
-    }
-}
-
-void LongNameHandler::multiSimpleFormatsToModifiers(const UnicodeString *leadFormats, UnicodeString trailFormat,
-                                                    Field field, UErrorCode &status) {
-    SimpleFormatter trailCompiled(trailFormat, 1, 1, status);
+void LongNameHandler::loadModifiers(const Locale &loc, const UnicodeString &detail, const void *request,
+                                    UErrorCode &status) {
+    // The modifiers for a unit or currency are the same for all formatters, so take them from the cache.
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
     if (U_FAILURE(status)) { return; }
-    for (int32_t i = 0; i < StandardPlural::Form::COUNT; i++) {
-        StandardPlural::Form plural = static_cast<StandardPlural::Form>(i);
-        UnicodeString leadFormat = getWithPlural(leadFormats, plural, status);
-        if (U_FAILURE(status)) { return; }
-        UnicodeString compoundFormat;
-        trailCompiled.format(leadFormat, compoundFormat, status);
-        if (U_FAILURE(status)) { return; }
-        SimpleFormatter compoundCompiled(compoundFormat, 0, 1, status);
-        if (U_FAILURE(status)) { return; }
-        fModifiers[i] = SimpleModifier(compoundCompiled, field, false, {this, 0, plural});
-    }
+    cache->get(LongNameDataKey(loc, detail), request, fData, status);
 }
 
 void LongNameHandler::processQuantity(DecimalQuantity &quantity, MicroProps &micros,
@@ -276,11 +377,11 @@ void LongNameHandler::processQuantity(DecimalQuantity &quantity, MicroProps &mic
     // TODO: Avoid the copy here?
     DecimalQuantity copy(quantity);
     micros.rounder.apply(copy, status);
-    micros.modOuter = &fModifiers[utils::getStandardPlural(rules, copy)];
+    micros.modOuter = &fData->modifiers[utils::getStandardPlural(rules, copy)];
 }
 
-const Modifier* LongNameHandler::getModifier(int8_t /*signum*/, StandardPlural::Form plural) const {
-    return &fModifiers[plural];
+const Modifier* LongNameHandler::getModifier(int8_t signum, StandardPlural::Form plural) const {
+    return fData->getModifier(signum, plural);
 }
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -8,12 +8,27 @@
 #define __NUMBER_LONGNAMES_H__
 
 #include "unicode/uversion.h"
+#include "sharedobject.h"
 #include "number_utils.h"
 #include "number_modifiers.h"
 
 U_NAMESPACE_BEGIN namespace number {
 namespace impl {
 
+/**
+ * The modifier for each plural form of a unit or currency long name, compiled from the
+ * unit display patterns. LongNameHandlers share it through the UnifiedCache, so creating
+ * one after the first does no resource lookups and no pattern compilation.
+ */
+class U_I18N_API LongNameData : public SharedObject, public ModifierStore {
+  public:
+    ~LongNameData() U_OVERRIDE;
+
+    const Modifier* getModifier(int8_t signum, StandardPlural::Form plural) const U_OVERRIDE;
+
+    SimpleModifier modifiers[StandardPlural::Form::COUNT];
+};
+
 class LongNameHandler : public MicroPropsGenerator, public ModifierStore, public UMemory {
   public:
     static LongNameHandler*
@@ -25,27 +40,26 @@ class LongNameHandler : public MicroPropsGenerator, public ModifierStore, public
                    const UNumberUnitWidth &width, const PluralRules *rules,
                    const MicroPropsGenerator *parent, UErrorCode &status);
 
+    ~LongNameHandler() U_OVERRIDE;
+
     void
     processQuantity(DecimalQuantity &quantity, MicroProps &micros, UErrorCode &status) const U_OVERRIDE;
 
     const Modifier* getModifier(int8_t signum, StandardPlural::Form plural) const U_OVERRIDE;
 
   private:
-    SimpleModifier fModifiers[StandardPlural::Form::COUNT];
+    const LongNameData *fData = nullptr;
     const PluralRules *rules;
     const MicroPropsGenerator *parent;
 
     LongNameHandler(const PluralRules *rules, const MicroPropsGenerator *parent)
             : rules(rules), parent(parent) {}
 
-    static LongNameHandler*
-    forCompoundUnit(const Locale &loc, const MeasureUnit &unit, const MeasureUnit &perUnit,
-                    const UNumberUnitWidth &width, const PluralRules *rules,
-                    const MicroPropsGenerator *parent, UErrorCode &status);
+    LongNameHandler(const LongNameHandler &other) = delete;
+    LongNameHandler &operator=(const LongNameHandler &other) = delete;
 
-    void simpleFormatsToModifiers(const UnicodeString *simpleFormats, Field field, UErrorCode &status);
-    void multiSimpleFormatsToModifiers(const UnicodeString *leadFormats, UnicodeString trailFormat,
-                                       Field field, UErrorCode &status);
+    void loadModifiers(const Locale &loc, const UnicodeString &detail, const void *request,
+                       UErrorCode &status);
 };
 
 }  // namespace impl
@@ -11,6 +11,7 @@
 #include <cstdint>
 #include "unicode/uniset.h"
 #include "unicode/simpleformatter.h"
+#include "sharedobject.h"
 #include "standardplural.h"
 #include "number_stringbuilder.h"
 #include "number_types.h"
@@ -274,8 +275,11 @@ class U_I18N_API EmptyModifier : public Modifier, public UMemory {
 
 /**
  * This implementation of ModifierStore adopts Modifer pointers.
+ *
+ * It is reference-counted so that ImmutablePatternModifiers of different formatters
+ * can share it through the UnifiedCache.
  */
-class U_I18N_API AdoptingModifierStore : public ModifierStore, public UMemory {
+class U_I18N_API AdoptingModifierStore : public ModifierStore, public SharedObject {
   public:
     virtual ~AdoptingModifierStore();
 
@@ -11,11 +11,72 @@
 #include "unicode/ucurr.h"
 #include "unicode/unistr.h"
 #include "number_microprops.h"
+#include "unifiedcache.h"
 
 using namespace icu;
 using namespace icu::number;
 using namespace icu::number::impl;
 
+U_NAMESPACE_BEGIN
+
+template<> U_I18N_API
+const AdoptingModifierStore *LocaleCacheKey<AdoptingModifierStore>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return nullptr;
+}
+
+U_NAMESPACE_END
+
+namespace {
+
+/**
+ * Cache key for the modifiers of a MutablePatternModifier. The creation context is the
+ * MutablePatternModifier; the caller makes sure that the locale and the detail string
+ * together determine its settings.
+ */
+class ModifierStoreKey : public LocaleCacheKey<AdoptingModifierStore> {
+  public:
+    ModifierStoreKey(const Locale& loc, const UnicodeString& detail)
+            : LocaleCacheKey<AdoptingModifierStore>(loc), fDetail(detail) {}
+
+    ModifierStoreKey(const ModifierStoreKey& other) = default;
+
+    ~ModifierStoreKey() U_OVERRIDE = default;
+
+    int32_t hashCode() const U_OVERRIDE {
+        return static_cast<int32_t>(37u * static_cast<uint32_t>(LocaleCacheKey::hashCode()) +
+                                    static_cast<uint32_t>(fDetail.hashCode()));
+    }
+
+    UBool operator==(const CacheKeyBase& other) const U_OVERRIDE {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        return static_cast<const ModifierStoreKey&>(other).fDetail == fDetail;
+    }
+
+    CacheKeyBase* clone() const U_OVERRIDE {
+        return new ModifierStoreKey(*this);
+    }
+
+    const AdoptingModifierStore* createObject(const void* creationContext,
+                                              UErrorCode& status) const U_OVERRIDE {
+        // The builder is not const: It sets the number properties for each modifier.
+        auto* builder = static_cast<MutablePatternModifier*>(const_cast<void*>(creationContext));
+        return builder->createModifierStore(status);
+    }
+
+  private:
+    UnicodeString fDetail;
+};
+
+} // namespace
+
 
 AffixPatternProvider::~AffixPatternProvider() = default;
 
@@ -59,6 +120,40 @@ ImmutablePatternModifier* MutablePatternModifier::createImmutable(UErrorCode& st
 
 ImmutablePatternModifier*
 MutablePatternModifier::createImmutableAndChain(const MicroPropsGenerator* parent, UErrorCode& status) {
+    const AdoptingModifierStore* pm = createModifierStore(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    auto* result = new ImmutablePatternModifier(pm, needsPlurals() ? fRules : nullptr, parent);
+    if (result == nullptr) {
+        pm->removeRef();
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return result;
+}
+
+ImmutablePatternModifier*
+MutablePatternModifier::createSharedImmutableAndChain(const MicroPropsGenerator* parent,
+                                                      const Locale& locale, const UnicodeString& cacheKey,
+                                                      UErrorCode& status) {
+    const UnifiedCache* cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    const AdoptingModifierStore* pm = nullptr;
+    cache->get(ModifierStoreKey(locale, cacheKey), this, pm, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    auto* result = new ImmutablePatternModifier(pm, needsPlurals() ? fRules : nullptr, parent);
+    if (result == nullptr) {
+        pm->removeRef();
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return result;
+}
+
+const AdoptingModifierStore* MutablePatternModifier::createModifierStore(UErrorCode& status) {
 
     // TODO: Move StandardPlural VALUES to standardplural.h
     static const StandardPlural::Form STANDARD_PLURAL_VALUES[] = {
@@ -69,9 +164,11 @@ MutablePatternModifier::createImmutableAndChain(const MicroPropsGenerator* paren
             StandardPlural::Form::MANY,
             StandardPlural::Form::OTHER};
 
-    auto pm = new AdoptingModifierStore();
-    if (pm == nullptr) {
-        status = U_MEMORY_ALLOCATION_ERROR;
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    LocalPointer<AdoptingModifierStore> pm(new AdoptingModifierStore(), status);
+    if (U_FAILURE(status)) {
         return nullptr;
     }
 
@@ -85,11 +182,6 @@ MutablePatternModifier::createImmutableAndChain(const MicroPropsGenerator* paren
             setNumberProperties(-1, plural);
             pm->adoptModifier(-1, plural, createConstantModifier(status));
         }
-        if (U_FAILURE(status)) {
-            delete pm;
-            return nullptr;
-        }
-        return new ImmutablePatternModifier(pm, fRules, parent);  // adopts pm
     } else {
         // Faster path when plural keyword is not needed.
         setNumberProperties(1, StandardPlural::Form::COUNT);
@@ -98,12 +190,12 @@ MutablePatternModifier::createImmutableAndChain(const MicroPropsGenerator* paren
         pm->adoptModifierWithoutPlural(0, createConstantModifier(status));
         setNumberProperties(-1, StandardPlural::Form::COUNT);
         pm->adoptModifierWithoutPlural(-1, createConstantModifier(status));
-        if (U_FAILURE(status)) {
-            delete pm;
-            return nullptr;
-        }
-        return new ImmutablePatternModifier(pm, nullptr, parent);  // adopts pm
     }
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    pm->addRef();
+    return pm.orphan();
 }
 
 ConstantMultiFieldModifier* MutablePatternModifier::createConstantModifier(UErrorCode& status) {
@@ -119,10 +211,14 @@ ConstantMultiFieldModifier* MutablePatternModifier::createConstantModifier(UErro
     }
 }
 
-ImmutablePatternModifier::ImmutablePatternModifier(AdoptingModifierStore* pm, const PluralRules* rules,
+ImmutablePatternModifier::ImmutablePatternModifier(const AdoptingModifierStore* pm, const PluralRules* rules,
                                                    const MicroPropsGenerator* parent)
         : pm(pm), rules(rules), parent(parent) {}
 
+ImmutablePatternModifier::~ImmutablePatternModifier() {
+    pm->removeRef();
+}
+
 void ImmutablePatternModifier::processQuantity(DecimalQuantity& quantity, MicroProps& micros,
                                                UErrorCode& status) const {
     parent->processQuantity(quantity, micros, status);
@@ -17,16 +17,6 @@
 
 U_NAMESPACE_BEGIN
 
-// Export an explicit template instantiation of the LocalPointer that is used as a
-// data member of AdoptingModifierStore.
-// (When building DLLs for Windows this is required.)
-#if U_PF_WINDOWS <= U_PLATFORM && U_PLATFORM <= U_PF_CYGWIN
-// Ignore warning 4661 as LocalPointerBase does not use operator== or operator!=
-#pragma warning(suppress: 4661)
-template class U_I18N_API LocalPointerBase<number::impl::AdoptingModifierStore>;
-template class U_I18N_API LocalPointer<number::impl::AdoptingModifierStore>;
-#endif
-
 namespace number {
 namespace impl {
 
@@ -36,7 +26,7 @@ class MutablePatternModifier;
 // Exported as U_I18N_API because it is needed for the unit test PatternModifierTest
 class U_I18N_API ImmutablePatternModifier : public MicroPropsGenerator, public UMemory {
   public:
-    ~ImmutablePatternModifier() U_OVERRIDE = default;
+    ~ImmutablePatternModifier() U_OVERRIDE;
 
     void processQuantity(DecimalQuantity&, MicroProps& micros, UErrorCode& status) const U_OVERRIDE;
 
@@ -45,10 +35,11 @@ class U_I18N_API ImmutablePatternModifier : public MicroPropsGenerator, public U
     const Modifier* getModifier(int8_t signum, StandardPlural::Form plural) const;
 
   private:
-    ImmutablePatternModifier(AdoptingModifierStore* pm, const PluralRules* rules,
+    // Takes over the caller's reference to pm.
+    ImmutablePatternModifier(const AdoptingModifierStore* pm, const PluralRules* rules,
                              const MicroPropsGenerator* parent);
 
-    const LocalPointer<AdoptingModifierStore> pm;
+    const AdoptingModifierStore* const pm;
     const PluralRules* rules;
     const MicroPropsGenerator* parent;
 
@@ -171,6 +162,34 @@ class U_I18N_API MutablePatternModifier
     ImmutablePatternModifier *
     createImmutableAndChain(const MicroPropsGenerator *parent, UErrorCode &status);
 
+    /**
+     * Same as {@link #createImmutableAndChain}, except that the modifiers are shared with other formatters
+     * through the process-wide UnifiedCache. When a formatter with the same cache key was created before,
+     * this is only a cache lookup.
+     *
+     * <p>
+     * CREATES A NEW HEAP OBJECT; THE CALLER GETS OWNERSHIP.
+     *
+     * @param parent
+     *            The QuantityChain to which to chain this immutable.
+     * @param locale
+     *            The locale of the symbols, the currency symbols, and the plural rules.
+     * @param cacheKey
+     *            Together with the locale, this must determine everything else that was passed into the
+     *            setters of this instance: the pattern, the sign display, the numbering system, the currency,
+     *            and the unit width.
+     * @return An immutable that supports both positive and negative numbers.
+     */
+    ImmutablePatternModifier *
+    createSharedImmutableAndChain(const MicroPropsGenerator *parent, const Locale &locale,
+                                  const UnicodeString &cacheKey, UErrorCode &status);
+
+    /**
+     * Creates the store of the modifiers for all signum and plural combinations, with one reference
+     * for the caller. Used by {@link #createImmutableAndChain} and by the UnifiedCache.
+     */
+    const AdoptingModifierStore *createModifierStore(UErrorCode &status);
+
     MicroPropsGenerator &addToChain(const MicroPropsGenerator *parent);
 
     void processQuantity(DecimalQuantity &, MicroProps &micros, UErrorCode &status) const U_OVERRIDE;
@@ -0,0 +1,42 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING
+#ifndef __NUMBER_RYU_H__
+#define __NUMBER_RYU_H__
+
+U_NAMESPACE_BEGIN namespace number {
+namespace impl {
+
+/** The maximum number of digits written by doubleToShortestDigits(). */
+static constexpr int32_t kMaxShortestDigits = 17;
+
+/**
+ * Computes the shortest decimal digits that round-trip to the given double,
+ * with the Ryu algorithm (Ulf Adams, "Ryū: Fast Float-to-String Conversion", PLDI 2018).
+ * Unlike the Grisu3 implementation in double-conversion, it never needs a bignum fallback.
+ *
+ * The output has the format of DoubleToStringConverter::DoubleToAscii() in SHORTEST mode:
+ * ASCII digits without leading or trailing zeros, such that the value is
+ * 0.d<sub>1</sub>d<sub>2</sub>...d<sub>length</sub> times 10 to the power of point.
+ *
+ * The double must be finite and positive, in IEEE 754 binary64 format.
+ *
+ * @param value The double to convert.
+ * @param buffer Receives the digits; must have room for kMaxShortestDigits characters.
+ *               The digits are not NUL-terminated.
+ * @param length Receives the number of digits.
+ * @param point Receives the position of the decimal point relative to the digits.
+ */
+// Exported as U_I18N_API for tests
+U_I18N_API void doubleToShortestDigits(double value, char* buffer, int32_t& length, int32_t& point);
+
+} // namespace impl
+} // namespace number
+U_NAMESPACE_END
+
+#endif //__NUMBER_RYU_H__
+
+#endif /* #if !UCONFIG_NO_FORMATTING */
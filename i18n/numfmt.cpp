@@ -1031,6 +1031,7 @@ enum { kKeyValueLenMax = 32 };
 
 NumberFormat*
 NumberFormat::internalCreateInstance(const Locale& loc, UNumberFormatStyle kind, UErrorCode& status) {
+    MemoryTagScope memoryTag(UMEM_TAG_FORMATTING);
     if (kind == UNUM_CURRENCY) {
         char cfKeyValue[kKeyValueLenMax] = {0};
         UErrorCode kvStatus = U_ZERO_ERROR;
@@ -1366,6 +1367,8 @@ NumberFormat::makeInstance(const Locale& desiredLocale,
         Mutex lock(&nscacheMutex);
         ns = (NumberingSystem *)uhash_iget(NumberingSystem_cache, hashKey);
         if (ns == NULL) {
+            // The cached numbering system outlives the current memory scope.
+            MemoryScopeSuspender suspender;
             ns = NumberingSystem::createInstance(desiredLocale,status);
             uhash_iput(NumberingSystem_cache, hashKey, (void*)ns, &status);
         }
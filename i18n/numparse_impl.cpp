@@ -21,6 +21,7 @@
 #include "cstr.h"
 #include "number_mapper.h"
 #include "static_unicode_sets.h"
+#include "unicode/ustring.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -74,6 +75,8 @@ NumberParserImpl::createSimpleParser(const Locale& locale, const UnicodeString&
     parser->addMatcher(parser->fLocalMatchers.currency = {currencySymbols, symbols, parseFlags, status});
 //    parser.addMatcher(new RequireNumberMatcher());
 
+    // The currency matcher is always present, so there is no fast path here.
+
     parser->freeze();
     return parser.orphan();
 }
@@ -144,12 +147,14 @@ NumberParserImpl::createParserFromProperties(const number::impl::DecimalFormatPr
     parser->fLocalMatchers.affixMatcherWarehouse = {&parser->fLocalMatchers.affixTokenMatcherWarehouse};
     parser->fLocalMatchers.affixMatcherWarehouse.createAffixMatchers(
             *affixProvider, *parser, ignorables, parseFlags, status);
+    bool hasAffixMatchers = parser->fNumMatchers > 0;
 
     ////////////////////////
     /// CURRENCY MATCHER ///
     ////////////////////////
 
-    if (parseCurrency || affixProvider->hasCurrencySign()) {
+    bool hasCurrencyMatcher = parseCurrency || affixProvider->hasCurrencySign();
+    if (hasCurrencyMatcher) {
         parser->addMatcher(parser->fLocalMatchers.currency = {currencySymbols, symbols, parseFlags, status});
     }
 
@@ -209,6 +214,11 @@ NumberParserImpl::createParserFromProperties(const number::impl::DecimalFormatPr
         parser->addMatcher(parser->fLocalValidators.multiplier = {multiplier});
     }
 
+    // The validators and the multiplier also run after the fast path, in postProcess().
+    if (!isStrict && !hasCurrencyMatcher) {
+        parser->setUpAsciiFastPath(symbols, hasAffixMatchers, padString);
+    }
+
     parser->freeze();
     return parser.orphan();
 }
@@ -248,13 +258,15 @@ void NumberParserImpl::parse(const UnicodeString& input, int32_t start, bool gre
         return;
     }
     U_ASSERT(fFrozen);
-    // TODO: Check start >= 0 and start < input.length()
-    StringSegment segment(input, 0 != (fParseFlags & PARSE_FLAG_IGNORE_CASE));
-    segment.adjustOffset(start);
-    if (greedy) {
-        parseGreedyRecursive(segment, result, status);
-    } else {
-        parseLongestRecursive(segment, result, status);
+    if (!parseAsciiFastPath(input, start, result)) {
+        // TODO: Check start >= 0 and start < input.length()
+        StringSegment segment(input, 0 != (fParseFlags & PARSE_FLAG_IGNORE_CASE));
+        segment.adjustOffset(start);
+        if (greedy) {
+            parseGreedyRecursive(segment, result, status);
+        } else {
+            parseLongestRecursive(segment, result, status);
+        }
     }
     for (int32_t i = 0; i < fNumMatchers; i++) {
         fMatchers[i]->postProcess(result);
@@ -262,6 +274,97 @@ void NumberParserImpl::parse(const UnicodeString& input, int32_t start, bool gre
     result.postProcess();
 }
 
+void NumberParserImpl::setUpAsciiFastPath(const DecimalFormatSymbols& symbols, bool hasAffixMatchers,
+                                          const UnicodeString& padString) {
+    fFastPathDecimalSeparator = 0;
+    // With affix matchers, even "-" may belong to an affix.
+    if (hasAffixMatchers || symbols.getConstSymbol(DecimalFormatSymbols::kMinusSignSymbol) != u"-") {
+        return;
+    }
+    // Same choice of separators as in the DecimalMatcher.
+    bool monetary = 0 != (fParseFlags & PARSE_FLAG_MONETARY_SEPARATORS);
+    const UnicodeString& decimal = symbols.getConstSymbol(
+            monetary ? DecimalFormatSymbols::kMonetarySeparatorSymbol
+                     : DecimalFormatSymbols::kDecimalSeparatorSymbol);
+    const UnicodeString& grouping = symbols.getConstSymbol(
+            monetary ? DecimalFormatSymbols::kMonetaryGroupingSeparatorSymbol
+                     : DecimalFormatSymbols::kGroupingSeparatorSymbol);
+    if (decimal.length() != 1 || (decimal[0] != u'.' && decimal[0] != u',') || grouping == decimal) {
+        return;
+    }
+    // No other matcher may consume any of the characters of the fast path.
+    static const UChar fastPathChars[] = u"-.,0123456789";
+    const UnicodeString& exponent = symbols.getConstSymbol(DecimalFormatSymbols::kExponentialSymbol);
+    if ((!padString.isBogus() && !padString.isEmpty() &&
+            u_strchr(fastPathChars, padString.charAt(0)) != nullptr) ||
+            (!exponent.isEmpty() && u_strchr(fastPathChars, exponent.charAt(0)) != nullptr)) {
+        return;
+    }
+    fFastPathDecimalSeparator = decimal[0];
+}
+
+bool NumberParserImpl::parseAsciiFastPath(const UnicodeString& input, int32_t start,
+                                          ParsedNumber& result) const {
+    if (fFastPathDecimalSeparator == 0 || start < 0 || start >= input.length()) {
+        return false;
+    }
+    const UChar* p = input.getBuffer() + start;
+    const UChar* limit = input.getBuffer() + input.length();
+    bool negative = *p == u'-';
+    if (negative) {
+        ++p;
+    }
+    // All characters must be ASCII digits, with at most one decimal separator.
+    // Up to 18 digits are collected in an int64_t; longer numbers go digit by digit
+    // into the DecimalQuantity as in the DecimalMatcher.
+    int64_t value = 0;
+    int32_t numDigits = 0;
+    int32_t digitsAfterDecimalPlace = 0;
+    bool seenDecimal = false;
+    const UChar* digitsStart = p;
+    for (; p < limit; ++p) {
+        UChar c = *p;
+        if (u'0' <= c && c <= u'9') {
+            if (numDigits < 18) {
+                value = value * 10 + (c - u'0');
+            }
+            numDigits++;
+            if (seenDecimal) {
+                digitsAfterDecimalPlace++;
+            }
+        } else if (c == fFastPathDecimalSeparator && !seenDecimal &&
+                   0 == (fParseFlags & PARSE_FLAG_INTEGER_ONLY)) {
+            seenDecimal = true;
+        } else {
+            return false;
+        }
+    }
+    if (numDigits == 0) {
+        return false;
+    }
+
+    result.quantity.bogus = false;
+    result.quantity.clear();
+    if (numDigits <= 18) {
+        result.quantity.setToLong(value);
+    } else {
+        for (p = digitsStart; p < limit; ++p) {
+            if (*p != fFastPathDecimalSeparator) {
+                result.quantity.appendDigit(static_cast<int8_t>(*p - u'0'), 0, true);
+            }
+        }
+    }
+    result.quantity.adjustMagnitude(-digitsAfterDecimalPlace);
+    if (negative) {
+        result.flags |= FLAG_NEGATIVE;
+    }
+    if (seenDecimal) {
+        result.flags |= FLAG_HAS_DECIMAL_SEPARATOR;
+    }
+    result.charEnd = input.length();
+    return true;
+}
+
 void NumberParserImpl::parseGreedyRecursive(StringSegment& segment, ParsedNumber& result,
                                             UErrorCode& status) const {
     // Base Case
@@ -68,6 +68,9 @@ class U_I18N_API NumberParserImpl : public MutableMatcherCollection, public UMem
     MaybeStackArray<const NumberParseMatcher*, 10> fMatchers;
     bool fFrozen = false;
 
+    // The decimal separator accepted by parseAsciiFastPath(), or 0 if the fast path is disabled.
+    char16_t fFastPathDecimalSeparator = 0;
+
     // WARNING: All of these matchers start in an undefined state (default-constructed).
     // You must use an assignment operator on them before using.
     struct {
@@ -95,6 +98,20 @@ class U_I18N_API NumberParserImpl : public MutableMatcherCollection, public UMem
 
     explicit NumberParserImpl(parse_flags_t parseFlags);
 
+    /**
+     * Enables parseAsciiFastPath() if the matchers would parse plain ASCII numbers like "-1234.5"
+     * with only the minus sign matcher and the decimal matcher.
+     */
+    void setUpAsciiFastPath(const DecimalFormatSymbols& symbols, bool hasAffixMatchers,
+                            const UnicodeString& padString);
+
+    /**
+     * If the input from start consists only of an optional ASCII minus sign, ASCII digits,
+     * and at most one decimal separator, sets the result like the matchers would and returns true.
+     * Otherwise returns false without touching the result.
+     */
+    bool parseAsciiFastPath(const UnicodeString& input, int32_t start, ParsedNumber& result) const;
+
     void parseGreedyRecursive(StringSegment& segment, ParsedNumber& result, UErrorCode& status) const;
 
     void parseLongestRecursive(StringSegment& segment, ParsedNumber& result, UErrorCode& status) const;
@@ -12,6 +12,7 @@
 #include "unicode/numberrangeformatter.h"
 #include "numrange_impl.h"
 #include "patternprops.h"
+#include "unifiedcache.h"
 #include "uresimp.h"
 #include "util.h"
 
@@ -27,11 +28,6 @@ constexpr int8_t identity2d(UNumberRangeIdentityFallback a, UNumberRangeIdentity
 }
 
 
-struct NumberRangeData {
-    SimpleFormatter rangePattern;
-    SimpleFormatter approximatelyPattern;
-};
-
 class NumberRangeDataSink : public ResourceSink {
   public:
     NumberRangeDataSink(NumberRangeData& data) : fData(data) {}
@@ -138,6 +134,37 @@ void getPluralRangesData(const Locale& locale, StandardPluralRanges& output, UEr
 } // namespace
 
 
+U_NAMESPACE_BEGIN
+
+template<> U_I18N_API
+const NumberRangeData *LocaleCacheKey<NumberRangeData>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    LocalPointer<NumberRangeData> result(new NumberRangeData(), status);
+    if (U_FAILURE(status)) { return nullptr; }
+
+    // TODO: As of this writing (ICU 63), there is no locale that has different number miscPatterns
+    // based on numbering system.  Therefore, data is loaded only from latn.  If this changes,
+    // this part of the code should be updated to load from the local numbering system.
+    // The numbering system could come from the one specified in the NumberFormatter passed to
+    // numberFormatterBoth() or similar.
+    // See ICU-20144
+    getNumberRangeData(fLoc.getName(), "latn", *result, status);
+    if (U_FAILURE(status)) { return nullptr; }
+
+    // TODO: Get locale from PluralRules instead?
+    result->pluralRanges.initialize(fLoc, status);
+    if (U_FAILURE(status)) { return nullptr; }
+
+    result->addRef();
+    return result.orphan();
+}
+
+U_NAMESPACE_END
+
+
+NumberRangeData::~NumberRangeData() = default;
+
+
 void StandardPluralRanges::initialize(const Locale& locale, UErrorCode& status) {
     getPluralRangesData(locale, *this, status);
 }
@@ -177,22 +204,17 @@ NumberRangeFormatterImpl::NumberRangeFormatterImpl(const RangeMacroProps& macros
       fCollapse(macros.collapse),
       fIdentityFallback(macros.identityFallback) {
 
-    // TODO: As of this writing (ICU 63), there is no locale that has different number miscPatterns
-    // based on numbering system.  Therefore, data is loaded only from latn.  If this changes,
-    // this part of the code should be updated to load from the local numbering system.
-    // The numbering system could come from the one specified in the NumberFormatter passed to
-    // numberFormatterBoth() or similar.
-    // See ICU-20144
-
-    NumberRangeData data;
-    getNumberRangeData(macros.locale.getName(), "latn", data, status);
+    // The range data is the same for all formatters of a locale, so take it from the cache.
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
     if (U_FAILURE(status)) { return; }
-    fRangeFormatter = data.rangePattern;
-    fApproximatelyModifier = {data.approximatelyPattern, UNUM_FIELD_COUNT, false};
-
-    // TODO: Get locale from PluralRules instead?
-    fPluralRanges.initialize(macros.locale, status);
+    cache->get(LocaleCacheKey<NumberRangeData>(macros.locale.getName()), fData, status);
     if (U_FAILURE(status)) { return; }
+    fRangeFormatter = fData->rangePattern;
+    fApproximatelyModifier = {fData->approximatelyPattern, UNUM_FIELD_COUNT, false};
+}
+
+NumberRangeFormatterImpl::~NumberRangeFormatterImpl() {
+    SharedObject::clearPtr(fData);
 }
 
 void NumberRangeFormatterImpl::format(UFormattedNumberRangeData& data, bool equalBeforeRounding, UErrorCode& status) const {
@@ -473,7 +495,7 @@ NumberRangeFormatterImpl::resolveModifierPlurals(const Modifier& first, const Mo
     StandardPlural::Form secondPlural = parameters.plural;
 
     // Get the required plural form from data
-    StandardPlural::Form resultPlural = fPluralRanges.resolve(firstPlural, secondPlural);
+    StandardPlural::Form resultPlural = fData->pluralRanges.resolve(firstPlural, secondPlural);
 
     // Get and return the new Modifier
     const Modifier* mod = parameters.obj->getModifier(parameters.signum, resultPlural);
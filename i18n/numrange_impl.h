@@ -14,6 +14,7 @@
 #include "number_decimalquantity.h"
 #include "number_formatimpl.h"
 #include "number_stringbuilder.h"
+#include "sharedobject.h"
 
 U_NAMESPACE_BEGIN namespace number {
 namespace impl {
@@ -71,10 +72,27 @@ class StandardPluralRanges : public UMemory {
 };
 
 
+/**
+ * The range data of a locale: the range and approximately patterns, and the plural ranges.
+ * NumberRangeFormatterImpls share it through the UnifiedCache, so creating one after the first
+ * for a locale does no resource lookups for it.
+ */
+class U_I18N_API NumberRangeData : public SharedObject {
+  public:
+    ~NumberRangeData() U_OVERRIDE;
+
+    SimpleFormatter rangePattern;
+    SimpleFormatter approximatelyPattern;
+    StandardPluralRanges pluralRanges;
+};
+
+
 class NumberRangeFormatterImpl : public UMemory {
   public:
     NumberRangeFormatterImpl(const RangeMacroProps& macros, UErrorCode& status);
 
+    ~NumberRangeFormatterImpl();
+
     void format(UFormattedNumberRangeData& data, bool equalBeforeRounding, UErrorCode& status) const;
 
   private:
@@ -88,7 +106,10 @@ class NumberRangeFormatterImpl : public UMemory {
     SimpleFormatter fRangeFormatter;
     SimpleModifier fApproximatelyModifier;
 
-    StandardPluralRanges fPluralRanges;
+    const NumberRangeData* fData = nullptr;
+
+    NumberRangeFormatterImpl(const NumberRangeFormatterImpl& other) = delete;
+    NumberRangeFormatterImpl& operator=(const NumberRangeFormatterImpl& other) = delete;
 
     void formatSingleValue(UFormattedNumberRangeData& data,
                            MicroProps& micros1, MicroProps& micros2,
@@ -19,6 +19,7 @@
 
 #include "unicode/ures.h"
 #include "unicode/simpletz.h"
+#include "unicode/tztrans.h"
 #include "unicode/gregocal.h"
 #include "gregoimp.h"
 #include "cmemory.h"
@@ -99,8 +100,9 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(OlsonTimeZone)
 void OlsonTimeZone::constructEmpty() {
     canonicalID = NULL;
 
-    transitionCountPre32 = transitionCount32 = transitionCountPost32 = 0;
+    transitionCountPre32 = transitionCount32 = transitionCountPost32 = transitionCount64 = 0;
     transitionTimesPre32 = transitionTimes32 = transitionTimesPost32 = NULL;
+    transitionTimes64 = NULL;
 
     typeMapData = NULL;
 
@@ -124,6 +126,8 @@ OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
   BasicTimeZone(tzid), finalZone(NULL)
 {
     clearTransitionRules();
+    transitionCount64 = 0;
+    transitionTimes64 = NULL;
     U_DEBUG_TZ_MSG(("OlsonTimeZone(%s)\n", ures_getKey((UResourceBundle*)res)));
     if ((top == NULL || res == NULL) && U_SUCCESS(ec)) {
         ec = U_ILLEGAL_ARGUMENT_ERROR;
@@ -208,41 +212,7 @@ OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
             UResourceBundle *rule = TimeZone::loadRule(top, ruleID, NULL, ec);
             const int32_t *ruleData = ures_getIntVector(rule, &len, &ec); 
             if (U_SUCCESS(ec) && len == 11) {
-                UnicodeString emptyStr;
-                finalZone = new SimpleTimeZone(
-                    ruleRaw * U_MILLIS_PER_SECOND,
-                    emptyStr,
-                    (int8_t)ruleData[0], (int8_t)ruleData[1], (int8_t)ruleData[2],
-                    ruleData[3] * U_MILLIS_PER_SECOND,
-                    (SimpleTimeZone::TimeMode) ruleData[4],
-                    (int8_t)ruleData[5], (int8_t)ruleData[6], (int8_t)ruleData[7],
-                    ruleData[8] * U_MILLIS_PER_SECOND,
-                    (SimpleTimeZone::TimeMode) ruleData[9],
-                    ruleData[10] * U_MILLIS_PER_SECOND, ec);
-                if (finalZone == NULL) {
-                    ec = U_MEMORY_ALLOCATION_ERROR;
-                } else {
-                    finalStartYear = ruleYear;
-
-                    // Note: Setting finalStartYear to the finalZone is problematic.  When a date is around
-                    // year boundary, SimpleTimeZone may return false result when DST is observed at the 
-                    // beginning of year.  We could apply safe margin (day or two), but when one of recurrent
-                    // rules falls around year boundary, it could return false result.  Without setting the
-                    // start year, finalZone works fine around the year boundary of the start year.
-
-                    // finalZone->setStartYear(finalStartYear);
-
-
-                    // Compute the millis for Jan 1, 0:00 GMT of the finalYear
-
-                    // Note: finalStartMillis is used for detecting either if
-                    // historic transition data or finalZone to be used.  In an
-                    // extreme edge case - for example, two transitions fall into
-                    // small windows of time around the year boundary, this may
-                    // result incorrect offset computation.  But I think it will
-                    // never happen practically.  Yoshito - Feb 20, 2010
-                    finalStartMillis = Grego::fieldsToDay(finalStartYear, 0, 1) * U_MILLIS_PER_DAY;
-                }
+                initFinalZone(ruleData, ruleRaw, ruleYear, ec);
             } else {
                 ec = U_INVALID_FORMAT_ERROR;
             }
@@ -262,6 +232,95 @@ OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
     }
 }
 
+/**
+ * Construct from a zone in zoneinfo64.tzb
+ * @param record the zone data, followed by its arrays
+ * @param tzid the time zone ID
+ * @param ec input-output error code
+ */
+OlsonTimeZone::OlsonTimeZone(const OlsonZoneRecord* record,
+                             const UnicodeString& tzid,
+                             UErrorCode& ec) :
+  BasicTimeZone(tzid), finalZone(NULL)
+{
+    clearTransitionRules();
+    if (record == NULL && U_SUCCESS(ec)) {
+        ec = U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    if (U_SUCCESS(ec)) {
+        int32_t transCount = record->transitionCount;
+        int32_t typeCnt = record->typeCount;
+        if (transCount < 0 || transCount > 0x7FFF || typeCnt < 1 || typeCnt > 0x3FFF) {
+            ec = U_INVALID_FORMAT_ERROR;
+        } else {
+            // The arrays follow the record, the transitions first since they
+            // are the ones that need 8-byte alignment.
+            const int64_t *times = reinterpret_cast<const int64_t *>(record + 1);
+            transitionCountPre32 = transitionCount32 = transitionCountPost32 = 0;
+            transitionTimesPre32 = transitionTimes32 = transitionTimesPost32 = NULL;
+            transitionCount64 = static_cast<int16_t>(transCount);
+            transitionTimes64 = transCount > 0 ? times : NULL;
+            typeCount = static_cast<int16_t>(typeCnt);
+            typeOffsets = reinterpret_cast<const int32_t *>(times + transCount);
+            typeMapData = transCount > 0 ?
+                reinterpret_cast<const uint8_t *>(typeOffsets + 2 * typeCnt) : NULL;
+        }
+    }
+    if (U_SUCCESS(ec) && record->finalYear >= 0) {
+        initFinalZone(record->finalRule, record->finalRaw, record->finalYear, ec);
+    }
+    if (U_SUCCESS(ec)) {
+        canonicalID = ZoneMeta::getCanonicalCLDRID(tzid, ec);
+    }
+
+    if (U_FAILURE(ec)) {
+        constructEmpty();
+    }
+}
+
+/**
+ * Create the finalZone from the 11 integers of a rule in the Rules data
+ * and the zone's finalRaw and finalYear.
+ */
+void OlsonTimeZone::initFinalZone(const int32_t *ruleData, int32_t ruleRaw, int32_t ruleYear,
+                                  UErrorCode& ec) {
+    UnicodeString emptyStr;
+    finalZone = new SimpleTimeZone(
+        ruleRaw * U_MILLIS_PER_SECOND,
+        emptyStr,
+        (int8_t)ruleData[0], (int8_t)ruleData[1], (int8_t)ruleData[2],
+        ruleData[3] * U_MILLIS_PER_SECOND,
+        (SimpleTimeZone::TimeMode) ruleData[4],
+        (int8_t)ruleData[5], (int8_t)ruleData[6], (int8_t)ruleData[7],
+        ruleData[8] * U_MILLIS_PER_SECOND,
+        (SimpleTimeZone::TimeMode) ruleData[9],
+        ruleData[10] * U_MILLIS_PER_SECOND, ec);
+    if (finalZone == NULL) {
+        ec = U_MEMORY_ALLOCATION_ERROR;
+    } else {
+        finalStartYear = ruleYear;
+
+        // Note: Setting finalStartYear to the finalZone is problematic.  When a date is around
+        // year boundary, SimpleTimeZone may return false result when DST is observed at the 
+        // beginning of year.  We could apply safe margin (day or two), but when one of recurrent
+        // rules falls around year boundary, it could return false result.  Without setting the
+        // start year, finalZone works fine around the year boundary of the start year.
+
+        // finalZone->setStartYear(finalStartYear);
+
+
+        // Compute the millis for Jan 1, 0:00 GMT of the finalYear
+
+        // Note: finalStartMillis is used for detecting either if
+        // historic transition data or finalZone to be used.  In an
+        // extreme edge case - for example, two transitions fall into
+        // small windows of time around the year boundary, this may
+        // result incorrect offset computation.  But I think it will
+        // never happen practically.  Yoshito - Feb 20, 2010
+        finalStartMillis = Grego::fieldsToDay(finalStartYear, 0, 1) * U_MILLIS_PER_DAY;
+    }
+}
+
 /**
  * Copy constructor
  */
@@ -279,10 +338,12 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
     transitionTimesPre32 = other.transitionTimesPre32;
     transitionTimes32 = other.transitionTimes32;
     transitionTimesPost32 = other.transitionTimesPost32;
+    transitionTimes64 = other.transitionTimes64;
 
     transitionCountPre32 = other.transitionCountPre32;
     transitionCount32 = other.transitionCount32;
     transitionCountPost32 = other.transitionCountPost32;
+    transitionCount64 = other.transitionCount64;
 
     typeCount = other.typeCount;
     typeOffsets = other.typeOffsets;
@@ -296,6 +357,13 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
     finalStartMillis = other.finalStartMillis;
 
     clearTransitionRules();
+    deleteFinalTransitions();
+    // Share the other zone's table if it is complete.
+    if (umtx_loadAcquire(const_cast<OlsonTimeZone&>(other).finalTransitionsInitOnce.fState) == 2 &&
+            other.finalTransitions != NULL) {
+        finalTransitions = other.finalTransitions;
+        finalTransitions->addRef();
+    }
 
     return *this;
 }
@@ -305,6 +373,7 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
  */
 OlsonTimeZone::~OlsonTimeZone() {
     deleteTransitionRules();
+    deleteFinalTransitions();
     delete finalZone;
 }
 
@@ -394,7 +463,9 @@ void OlsonTimeZone::getOffset(UDate date, UBool local, int32_t& rawoff,
         return;
     }
     if (finalZone != NULL && date >= finalStartMillis) {
-        finalZone->getOffset(date, local, rawoff, dstoff, ec);
+        if (local || !getFinalOffset(date, rawoff, dstoff)) {
+            finalZone->getOffset(date, local, rawoff, dstoff, ec);
+        }
     } else {
         getHistoricalOffset(date, local, kFormer, kLatter, rawoff, dstoff);
     }
@@ -451,6 +522,10 @@ int64_t
 OlsonTimeZone::transitionTimeInSeconds(int16_t transIdx) const {
     U_ASSERT(transIdx >= 0 && transIdx < transitionCount()); 
 
+    if (transitionTimes64 != NULL) {
+        return transitionTimes64[transIdx];
+    }
+
     if (transIdx < transitionCountPre32) {
         return (((int64_t)((uint32_t)transitionTimesPre32[transIdx << 1])) << 32)
             | ((int64_t)((uint32_t)transitionTimesPre32[(transIdx << 1) + 1]));
@@ -471,6 +546,41 @@ OlsonTimeZone::transitionTimeInSeconds(int16_t transIdx) const {
 // quick zone transition checking.
 #define MAX_OFFSET_SECONDS 86400
 
+int16_t
+OlsonTimeZone::findTransitionIndex(double sec) const {
+    int16_t transCount = transitionCount();
+    U_ASSERT(transCount > 0);
+
+    // Check the interval of the previous lookup and the one after it.
+    int32_t hint = umtx_loadAcquire(transitionIndexHint);
+    if (hint >= -1 && hint < transCount) {
+        for (int16_t transIdx = (int16_t)hint; transIdx <= hint + 1 && transIdx < transCount; transIdx++) {
+            if ((transIdx < 0 || sec >= transitionTimeInSeconds(transIdx)) &&
+                    (transIdx + 1 == transCount || sec < transitionTimeInSeconds(transIdx + 1))) {
+                if (transIdx != hint) {
+                    umtx_storeRelease(transitionIndexHint, transIdx);
+                }
+                return transIdx;
+            }
+        }
+    }
+
+    // Binary search for the last transition at or before sec.
+    int16_t start = 0;  // transitions before start are at or before sec
+    int16_t limit = transCount;  // transitions at or after limit are after sec
+    while (start < limit) {
+        int16_t mid = (int16_t)((start + limit) / 2);
+        if (sec >= transitionTimeInSeconds(mid)) {
+            start = (int16_t)(mid + 1);
+        } else {
+            limit = mid;
+        }
+    }
+    int16_t transIdx = (int16_t)(start - 1);
+    umtx_storeRelease(transitionIndexHint, transIdx);
+    return transIdx;
+}
+
 void
 OlsonTimeZone::getHistoricalOffset(UDate date, UBool local,
                                    int32_t NonExistingTimeOpt, int32_t DuplicatedTimeOpt,
@@ -489,10 +599,13 @@ OlsonTimeZone::getHistoricalOffset(UDate date, UBool local,
             rawoff = initialRawOffset() * U_MILLIS_PER_SECOND;
             dstoff = initialDstOffset() * U_MILLIS_PER_SECOND;
         } else {
-            // Linear search from the end is the fastest approach, since
-            // most lookups will happen at/near the end.
-            int16_t transIdx;
-            for (transIdx = transCount - 1; transIdx >= 0; transIdx--) {
+            // Find the last transition that can apply:
+            // Whether a local time is before or after a transition depends on
+            // the offsets around it, but later transitions are more than
+            // MAX_OFFSET_SECONDS away and cannot apply.
+            // Search backward from there.
+            int16_t transIdx = findTransitionIndex(local ? sec + MAX_OFFSET_SECONDS : sec);
+            for (; transIdx >= 0; transIdx--) {
                 int64_t transition = transitionTimeInSeconds(transIdx);
 
                 if (local && (sec >= (transition - MAX_OFFSET_SECONDS))) {
@@ -636,15 +749,30 @@ OlsonTimeZone::hasSameRules(const TimeZone &other) const {
             return FALSE;
         }
     }
-    if (typeCount != z->typeCount
-        || transitionCountPre32 != z->transitionCountPre32
+    if (typeCount != z->typeCount || transitionCount() != z->transitionCount()) {
+        return FALSE;
+    }
+
+    if ((transitionTimes64 != NULL) != (z->transitionTimes64 != NULL)) {
+        // One zone is from zoneinfo64.tzb and the other from the resource bundle.
+        for (int16_t i = 0; i < transitionCount(); ++i) {
+            if (transitionTimeInSeconds(i) != z->transitionTimeInSeconds(i)) {
+                return FALSE;
+            }
+        }
+        return
+            arrayEqual(typeOffsets, z->typeOffsets, sizeof(typeOffsets[0]) * typeCount << 1)
+            && arrayEqual(typeMapData, z->typeMapData, sizeof(typeMapData[0]) * transitionCount());
+    }
+    if (transitionCountPre32 != z->transitionCountPre32
         || transitionCount32 != z->transitionCount32
         || transitionCountPost32 != z->transitionCountPost32) {
         return FALSE;
     }
 
     return
-        arrayEqual(transitionTimesPre32, z->transitionTimesPre32, sizeof(transitionTimesPre32[0]) * transitionCountPre32 << 1)
+        arrayEqual(transitionTimes64, z->transitionTimes64, sizeof(transitionTimes64[0]) * transitionCount64)
+        && arrayEqual(transitionTimesPre32, z->transitionTimesPre32, sizeof(transitionTimesPre32[0]) * transitionCountPre32 << 1)
         && arrayEqual(transitionTimes32, z->transitionTimes32, sizeof(transitionTimes32[0]) * transitionCount32)
         && arrayEqual(transitionTimesPost32, z->transitionTimesPost32, sizeof(transitionTimesPost32[0]) * transitionCountPost32 << 1)
         && arrayEqual(typeOffsets, z->typeOffsets, sizeof(typeOffsets[0]) * typeCount << 1)
@@ -688,6 +816,108 @@ OlsonTimeZone::deleteTransitionRules(void) {
     clearTransitionRules();
 }
 
+// initFinalTransitions() tabulates the finalZone transitions until the start of this year.
+#define FINAL_TRANSITIONS_LIMIT_YEAR 2100
+
+static void U_CALLCONV initFinalTransitionsOnce(OlsonTimeZone *This, UErrorCode &status) {
+    This->initFinalTransitions(status);
+}
+
+OlsonTimeZone::FinalTransitions::~FinalTransitions() {
+    uprv_free(table);
+}
+
+void
+OlsonTimeZone::initFinalTransitions(UErrorCode& status) {
+    // finalTransitions may have been copied from another zone.
+    if (U_FAILURE(status) || finalTransitions != NULL ||
+            finalZone == NULL || finalStartYear >= FINAL_TRANSITIONS_LIMIT_YEAR) {
+        return;
+    }
+    double limit = Grego::fieldsToDay(FINAL_TRANSITIONS_LIMIT_YEAR, 0, 1) * U_MILLIS_PER_DAY;
+    // The final rule has at most two transitions per year.
+    int32_t capacity = 2 * (FINAL_TRANSITIONS_LIMIT_YEAR - finalStartYear) + 3;
+    FinalTransition *table = (FinalTransition *)uprv_malloc(capacity * sizeof(FinalTransition));
+    if (table == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t count = 0;
+    table[count].time = finalStartMillis;
+    finalZone->getOffset(finalStartMillis, FALSE, table[count].rawOffset, table[count].dstOffset, status);
+    ++count;
+    TimeZoneTransition trans;
+    UDate time = finalStartMillis;
+    while (U_SUCCESS(status) && finalZone->getNextTransition(time, FALSE, trans)) {
+        time = trans.getTime();
+        if (time >= limit) {
+            break;
+        }
+        if (count == capacity) {
+            // Not the kind of rule that we expect
+            status = U_INTERNAL_PROGRAM_ERROR;
+            break;
+        }
+        table[count].time = time;
+        table[count].rawOffset = trans.getTo()->getRawOffset();
+        table[count].dstOffset = trans.getTo()->getDSTSavings();
+        ++count;
+    }
+    FinalTransitions *shared = NULL;
+    if (U_SUCCESS(status)) {
+        shared = new FinalTransitions(table, count, limit);
+        if (shared == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+    }
+    if (U_FAILURE(status)) {
+        uprv_free(table);
+        return;
+    }
+    shared->addRef();
+    finalTransitions = shared;
+}
+
+void
+OlsonTimeZone::deleteFinalTransitions() {
+    if (finalTransitions != NULL) {
+        finalTransitions->removeRef();
+        finalTransitions = NULL;
+    }
+    finalTransitionsInitOnce.reset();
+}
+
+void
+OlsonTimeZone::checkFinalTransitions(UErrorCode& status) const {
+    OlsonTimeZone *ncThis = const_cast<OlsonTimeZone *>(this);
+    umtx_initOnce(ncThis->finalTransitionsInitOnce, &initFinalTransitionsOnce, ncThis, status);
+}
+
+UBool
+OlsonTimeZone::getFinalOffset(UDate date, int32_t& rawoff, int32_t& dstoff) const {
+    UErrorCode status = U_ZERO_ERROR;
+    checkFinalTransitions(status);
+    if (U_FAILURE(status) || finalTransitions == NULL || !(date < finalTransitions->limit)) {
+        return FALSE;
+    }
+    const FinalTransition *table = finalTransitions->table;
+    U_ASSERT(finalTransitions->count > 0 && date >= table[0].time);
+    // Binary search for the last transition at or before date.
+    int32_t start = 1;
+    int32_t limit = finalTransitions->count;
+    while (start < limit) {
+        int32_t mid = (start + limit) / 2;
+        if (date >= table[mid].time) {
+            start = mid + 1;
+        } else {
+            limit = mid;
+        }
+    }
+    rawoff = table[start - 1].rawOffset;
+    dstoff = table[start - 1].dstOffset;
+    return TRUE;
+}
+
 /*
  * Lazy transition rules initializer
  */
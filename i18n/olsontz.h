@@ -18,6 +18,7 @@
 #if !UCONFIG_NO_FORMATTING
 
 #include "unicode/basictz.h"
+#include "sharedobject.h"
 #include "umutex.h"
 
 struct UResourceBundle;
@@ -112,7 +113,58 @@ class SimpleTimeZone;
  * Each item is either a 2-letter ISO country code or "001"
  * (UN M.49 - World).  This data is generated from "zone.tab"
  * in the tz database.
+ *
+ * The zone data may also come from an optional binary file
+ * "zoneinfo64.tzb", which tz2icu writes alongside zoneinfo64.txt,
+ * in the byte order of the platform it runs on.  It is used instead
+ * of the Zones in the resource bundle when its tz version matches
+ * TZVersion; the IDs, Regions and Rules are still taken from the
+ * resource bundle.  Its data format is "TzBn" and it consists of
+ * the indexes below (int32_t's; the offsets are in bytes from the
+ * start of the indexes):
+ *
+ * - OLSONTZB_IX_INDEXES_LENGTH: the number of indexes (>= OLSONTZB_IX_COUNT)
+ * - OLSONTZB_IX_ZONE_COUNT: the number of zone IDs, n
+ * - OLSONTZB_IX_NAMES_OFFSET: the offset of int32_t[n], the offsets of the
+ *   zone IDs as NUL-terminated invariant-character strings, in sorted order
+ * - OLSONTZB_IX_ZONES_OFFSET: the offset of int32_t[n], the offsets of the
+ *   OlsonZoneRecord of each ID, where a Link points to its target's record
+ * - OLSONTZB_IX_VERSION_OFFSET: the offset of the tz version string
+ * - OLSONTZB_IX_TOTAL_SIZE: the size of the data from the start of the indexes
+ *
+ * Each OlsonZoneRecord starts at a multiple of 8 bytes and is followed by
+ * its transition times as int64_t's, its typeOffsets and its typeMap, so that
+ * an OlsonTimeZone points into the data without copying or parsing anything.
  */
+enum {
+    OLSONTZB_IX_INDEXES_LENGTH,
+    OLSONTZB_IX_ZONE_COUNT,
+    OLSONTZB_IX_NAMES_OFFSET,
+    OLSONTZB_IX_ZONES_OFFSET,
+    OLSONTZB_IX_VERSION_OFFSET,
+    OLSONTZB_IX_TOTAL_SIZE,
+    OLSONTZB_IX_RESERVED6,
+    OLSONTZB_IX_RESERVED7,
+    OLSONTZB_IX_COUNT
+};
+
+/**
+ * The fixed part of a zone in zoneinfo64.tzb.
+ * It is followed by int64_t transitions[transitionCount],
+ * int32_t typeOffsets[typeCount * 2] and uint8_t typeMap[transitionCount].
+ */
+struct OlsonZoneRecord {
+    int32_t transitionCount;
+    int32_t typeCount;
+    /** finalRaw, or 0 if there is no final rule */
+    int32_t finalRaw;
+    /** finalYear, or -1 if there is no final rule */
+    int32_t finalYear;
+    /** The 11 integers of the final rule, as in the Rules */
+    int32_t finalRule[11];
+    int32_t reserved;
+};
+
 class U_I18N_API OlsonTimeZone: public BasicTimeZone {
  public:
     /**
@@ -128,6 +180,17 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
                   const UnicodeString& tzid,
                   UErrorCode& ec);
 
+    /**
+     * Construct from a zone in zoneinfo64.tzb.  The zone aliases the data,
+     * which must stay loaded.
+     * @param record the zone data
+     * @param tzid the time zone ID
+     * @param ec input-output error code
+     */
+    OlsonTimeZone(const OlsonZoneRecord* record,
+                  const UnicodeString& tzid,
+                  UErrorCode& ec);
+
     /**
      * Copy constructor
      */
@@ -293,12 +356,29 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
 
     void constructEmpty();
 
+    void initFinalZone(const int32_t *ruleData, int32_t ruleRaw, int32_t ruleYear,
+                       UErrorCode& ec);
+
     void getHistoricalOffset(UDate date, UBool local,
         int32_t NonExistingTimeOpt, int32_t DuplicatedTimeOpt,
         int32_t& rawoff, int32_t& dstoff) const;
 
     int16_t transitionCount() const;
 
+    /*
+     * Returns the index of the last transition at or before the given time,
+     * or -1 if the time is before the first transition.
+     * The zone must have at least one transition.
+     */
+    int16_t findTransitionIndex(double sec) const;
+
+    /*
+     * Gets the offsets of finalZone at a UTC time at or after finalStartMillis
+     * from the table of its transitions.
+     * Returns FALSE if the time is beyond the table, or if the table could not be built.
+     */
+    UBool getFinalOffset(UDate date, int32_t& rawoff, int32_t& dstoff) const;
+
     int64_t transitionTimeInSeconds(int16_t transIdx) const;
     double transitionTime(int16_t transIdx) const;
 
@@ -322,6 +402,7 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
     int16_t transitionCountPre32;
     int16_t transitionCount32;
     int16_t transitionCountPost32;
+    int16_t transitionCount64;
 
     /**
      * Time of each transition in seconds from 1970 epoch before 32bit second range (<= 1900).
@@ -343,6 +424,13 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
      */
     const int32_t *transitionTimesPost32; // alias into res; do not delete
 
+    /**
+     * Time of each transition in seconds from 1970 epoch, for a zone from
+     * zoneinfo64.tzb, which has only these and none of the three above.
+     * Length is transitionCount64 int64_t's.  NULL if no transitions.
+     */
+    const int64_t *transitionTimes64; // alias into data; do not delete
+
     /**
      * Number of types, 1..255
      */
@@ -389,6 +477,14 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
 
   public:    // Internal, for access from plain C code
     void initTransitionRules(UErrorCode& status);
+    void initFinalTransitions(UErrorCode& status);
+
+    /*
+     * Builds the table of finalZone transitions unless that is done already.
+     * Copies that are made of this zone afterwards share the table,
+     * for example the clones of the zones in the cache of createTimeZone().
+     */
+    void checkFinalTransitions(UErrorCode& status) const;
   private:
 
     InitialTimeZoneRule *initialRule;
@@ -399,11 +495,44 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
     int16_t             historicRuleCount;
     SimpleTimeZone      *finalZoneWithStartYear; // hack
     UInitOnce           transitionRulesInitOnce;
+
+    /*
+     * The result of the last findTransitionIndex() call, which is checked first
+     * on the next call, because successive lookups are usually for nearby times.
+     * It is only a hint: Threads sharing the zone may overwrite each other's values.
+     */
+    mutable u_atomic_int32_t transitionIndexHint = ATOMIC_INT32_T_INITIALIZER(-1);
+
+    /*
+     * The offsets of finalZone, each from its time until the next entry's time,
+     * and the last one until the limit.
+     * Built lazily by initFinalTransitions(), starting at finalStartMillis,
+     * so that getOffset() need not evaluate the finalZone rules for each call.
+     * Immutable once built, and shared with copies.
+     */
+    struct FinalTransition {
+        double time;
+        int32_t rawOffset;
+        int32_t dstOffset;
+    };
+    class FinalTransitions : public SharedObject {
+      public:
+        FinalTransitions(FinalTransition *tableToAdopt, int32_t tableCount, double tableLimit) :
+            table(tableToAdopt), count(tableCount), limit(tableLimit) {}
+        virtual ~FinalTransitions();
+        FinalTransition *table; // owned
+        int32_t count;
+        double limit;
+    };
+    const FinalTransitions *finalTransitions = nullptr;
+    UInitOnce           finalTransitionsInitOnce = U_INITONCE_INITIALIZER;
+
+    void deleteFinalTransitions();
 };
 
 inline int16_t
 OlsonTimeZone::transitionCount() const {
-    return transitionCountPre32 + transitionCount32 + transitionCountPost32;
+    return transitionCountPre32 + transitionCount32 + transitionCountPost32 + transitionCount64;
 }
 
 inline double
@@ -66,6 +66,7 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(PluralKeywordEnumeration)
 PluralRules::PluralRules(UErrorCode& /*status*/)
 :   UObject(),
     mRules(nullptr),
+    mProgram(nullptr),
     mInternalStatus(U_ZERO_ERROR)
 {
 }
@@ -73,12 +74,14 @@ PluralRules::PluralRules(UErrorCode& /*status*/)
 PluralRules::PluralRules(const PluralRules& other)
 : UObject(other),
     mRules(nullptr),
+    mProgram(nullptr),
     mInternalStatus(U_ZERO_ERROR)
 {
     *this=other;
 }
 
 PluralRules::~PluralRules() {
+    SharedObject::clearPtr(mProgram);
     delete mRules;
 }
 
@@ -101,6 +104,7 @@ PluralRules::clone() const {
 PluralRules&
 PluralRules::operator=(const PluralRules& other) {
     if (this != &other) {
+        SharedObject::clearPtr(mProgram);
         delete mRules;
         mRules = nullptr;
         mInternalStatus = other.mInternalStatus;
@@ -118,6 +122,10 @@ PluralRules::operator=(const PluralRules& other) {
                 mInternalStatus = mRules->fInternalStatus;
             }
         }
+        if (U_SUCCESS(mInternalStatus)) {
+            // The program is immutable; share it instead of compiling it again.
+            SharedObject::copyPtr(other.mProgram, mProgram);
+        }
     }
     return *this;
 }
@@ -147,6 +155,8 @@ PluralRules::createRules(const UnicodeString& description, UErrorCode& status) {
     parser.parse(description, newRules.getAlias(), status);
     if (U_FAILURE(status)) {
         newRules.adoptInstead(nullptr);
+    } else {
+        newRules->compileRules();
     }
     return newRules.orphan();
 }
@@ -251,16 +261,28 @@ PluralRules::internalForLocale(const Locale& locale, UPluralType type, UErrorCod
         //        Original impl used default rules.
         //        Ask the question to ICU Core.
 
+    newObj->compileRules();
     return newObj.orphan();
 }
 
+// Integers of smaller magnitude are exact as doubles; their operands are n = i and v = f = t = 0.
+static const double kMaxExactInteger = 9007199254740992.0;  // 2^53
+
 UnicodeString
 PluralRules::select(int32_t number) const {
+    if (mProgram != nullptr) {
+        const UnicodeString *keyword = mProgram->selectInteger(number);
+        return keyword != nullptr ? *keyword : UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
+    }
     return select(FixedDecimal(number));
 }
 
 UnicodeString
 PluralRules::select(double number) const {
+    if (mProgram != nullptr && number == uprv_floor(number) && fabs(number) < kMaxExactInteger) {
+        const UnicodeString *keyword = mProgram->selectInteger((int64_t)number);
+        return keyword != nullptr ? *keyword : UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
+    }
     return select(FixedDecimal(number));
 }
 
@@ -269,11 +291,25 @@ PluralRules::select(const IFixedDecimal &number) const {
     if (mRules == nullptr) {
         return UnicodeString(TRUE, PLURAL_DEFAULT_RULE, -1);
     }
+    else if (mProgram != nullptr) {
+        const UnicodeString *keyword = mProgram->select(number);
+        return keyword != nullptr ? *keyword : UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
+    }
     else {
         return mRules->select(number);
     }
 }
 
+// Compiles mRules for select(). Without a program, select() walks the RuleChain.
+void
+PluralRules::compileRules() {
+    SharedObject::clearPtr(mProgram);
+    if (mRules != nullptr && U_SUCCESS(mInternalStatus)) {
+        UErrorCode status = U_ZERO_ERROR;
+        mProgram = PluralRuleProgram::compile(mRules, status);
+    }
+}
+
 
 
 StringEnumeration*
@@ -960,6 +996,219 @@ RuleChain::select(const IFixedDecimal &number) const {
     return UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
 }
 
+struct PluralRuleProgram::Condition {
+    PluralOperand operand;
+    int32_t modulus;        // 0 if there is no "mod"
+    int32_t rangeStart;     // index of the first [low, high] pair in fRanges
+    int32_t rangeLimit;     // rangeStart == rangeLimit for a constant condition
+    int32_t failTarget;     // the condition to test next if this one fails
+    int32_t keywordIndex;   // >= 0 if this condition completes an "and" chain
+    UBool negated;
+    UBool integerOnly;      // "within": n must be an integer
+    UBool constant;         // the result if rangeStart == rangeLimit
+};
+
+PluralRuleProgram::~PluralRuleProgram() {
+    uprv_free(fConditions);
+    uprv_free(fRanges);
+    delete[] fKeywords;
+    uprv_free(fIntegerCategories);
+}
+
+const PluralRuleProgram *
+PluralRuleProgram::compile(const RuleChain *rules, UErrorCode &status) {
+    if (U_FAILURE(status) || rules == nullptr) {
+        return nullptr;
+    }
+    // Count the conditions and ranges first.
+    // An "or" chain without an "and" constraint gets one constant condition.
+    int32_t conditionCount = 0, rangeCount = 0, keywordCount = 0;
+    for (const RuleChain *chain = rules; chain != nullptr; chain = chain->fNext) {
+        if (chain->ruleHeader == nullptr) {
+            return nullptr;
+        }
+        ++keywordCount;
+        for (const OrConstraint *orRule = chain->ruleHeader; orRule != nullptr; orRule = orRule->next) {
+            if (orRule->childNode == nullptr) {
+                ++conditionCount;
+            }
+            for (const AndConstraint *andRule = orRule->childNode; andRule != nullptr; andRule = andRule->next) {
+                if (andRule->op == AndConstraint::MOD && andRule->opNum == 0) {
+                    return nullptr;  // "mod 0" never matches; leave that to the RuleChain.
+                }
+                ++conditionCount;
+                if (andRule->rangeList != nullptr) {
+                    rangeCount += andRule->rangeList->size();
+                } else if (andRule->value != -1) {
+                    rangeCount += 2;
+                }
+            }
+        }
+    }
+    LocalPointer<PluralRuleProgram> program(new PluralRuleProgram(), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    program->fConditions = (Condition *)uprv_malloc(conditionCount * sizeof(Condition));
+    program->fRanges = (int32_t *)uprv_malloc((rangeCount > 0 ? rangeCount : 1) * sizeof(int32_t));
+    program->fKeywords = new UnicodeString[keywordCount];
+    if (program->fConditions == nullptr || program->fRanges == nullptr || program->fKeywords == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+
+    int32_t c = 0, r = 0, k = 0;
+    for (const RuleChain *chain = rules; chain != nullptr; chain = chain->fNext, ++k) {
+        program->fKeywords[k] = chain->fKeyword;
+        for (const OrConstraint *orRule = chain->ruleHeader; orRule != nullptr; orRule = orRule->next) {
+            int32_t start = c;
+            const AndConstraint *andRule = orRule->childNode;
+            do {
+                Condition &cond = program->fConditions[c++];
+                cond.operand = PLURAL_OPERAND_N;
+                cond.modulus = 0;
+                cond.rangeStart = cond.rangeLimit = r;
+                cond.keywordIndex = -1;
+                cond.negated = FALSE;
+                cond.integerOnly = FALSE;
+                cond.constant = TRUE;
+                if (andRule == nullptr || andRule->digitsType == none) {
+                    // Empty constraint, see AndConstraint::isFulfilled().
+                } else {
+                    cond.operand = tokenTypeToPluralOperand(andRule->digitsType);
+                    cond.modulus = andRule->op == AndConstraint::MOD ? andRule->opNum : 0;
+                    cond.negated = andRule->negated;
+                    cond.integerOnly = andRule->integerOnly;
+                    if (andRule->rangeList != nullptr) {
+                        for (int32_t i = 0; i < andRule->rangeList->size(); ++i) {
+                            program->fRanges[r++] = andRule->rangeList->elementAti(i);
+                        }
+                    } else if (andRule->value != -1) {
+                        program->fRanges[r++] = andRule->value;
+                        program->fRanges[r++] = andRule->value;
+                    }
+                    cond.rangeLimit = r;
+                    if (cond.rangeStart == cond.rangeLimit) {
+                        cond.constant = !cond.negated;
+                    }
+                }
+                if (andRule != nullptr) {
+                    andRule = andRule->next;
+                }
+            } while (andRule != nullptr);
+            program->fConditions[c - 1].keywordIndex = k;
+            for (int32_t i = start; i < c; ++i) {
+                program->fConditions[i].failTarget = c;
+            }
+        }
+    }
+    U_ASSERT(c == conditionCount && r == rangeCount);
+    program->fConditionCount = conditionCount;
+
+    if (U_PLURAL_INTEGER_TABLE_SIZE > 0 && keywordCount < OTHER_INDEX) {
+        program->fIntegerCategories = (uint8_t *)uprv_malloc(U_PLURAL_INTEGER_TABLE_SIZE);
+        if (program->fIntegerCategories == nullptr) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return nullptr;
+        }
+        for (int32_t i = 0; i < U_PLURAL_INTEGER_TABLE_SIZE; ++i) {
+            int32_t index = program->evaluateInteger(i);
+            program->fIntegerCategories[i] = index >= 0 ? (uint8_t)index : OTHER_INDEX;
+        }
+        program->fIntegerTableSize = U_PLURAL_INTEGER_TABLE_SIZE;
+    }
+    program->addRef();
+    return program.orphan();
+}
+
+const UnicodeString *
+PluralRuleProgram::select(const IFixedDecimal &number) const {
+    if (number.isNaN() || number.isInfinite()) {
+        return nullptr;
+    }
+    for (int32_t c = 0; c < fConditionCount;) {
+        const Condition &cond = fConditions[c];
+        UBool result = cond.constant;
+        if (cond.rangeStart != cond.rangeLimit) {
+            double n = number.getPluralOperand(cond.operand);
+            if (cond.integerOnly && n != uprv_floor(n)) {
+                result = FALSE;
+            } else {
+                if (cond.modulus != 0) {
+                    n = fmod(n, cond.modulus);
+                }
+                result = FALSE;
+                for (int32_t r = cond.rangeStart; r < cond.rangeLimit; r += 2) {
+                    if (fRanges[r] <= n && n <= fRanges[r + 1]) {
+                        result = TRUE;
+                        break;
+                    }
+                }
+            }
+            if (cond.negated) {
+                result = !result;
+            }
+        }
+        if (!result) {
+            c = cond.failTarget;
+        } else if (cond.keywordIndex >= 0) {
+            return fKeywords + cond.keywordIndex;
+        } else {
+            ++c;
+        }
+    }
+    return nullptr;
+}
+
+const UnicodeString *
+PluralRuleProgram::selectInteger(int64_t number) const {
+    if (number < 0) {
+        number = -number;
+    }
+    int32_t index;
+    if (number < fIntegerTableSize) {
+        uint8_t category = fIntegerCategories[number];
+        index = category != OTHER_INDEX ? category : -1;
+    } else {
+        index = evaluateInteger(number);
+    }
+    return index >= 0 ? fKeywords + index : nullptr;
+}
+
+// Returns the index of the keyword for the non-negative integer, or -1 for "other".
+int32_t
+PluralRuleProgram::evaluateInteger(int64_t number) const {
+    for (int32_t c = 0; c < fConditionCount;) {
+        const Condition &cond = fConditions[c];
+        UBool result = cond.constant;
+        if (cond.rangeStart != cond.rangeLimit) {
+            // n and i are the number, all fraction operands are 0.
+            int64_t n = (cond.operand == PLURAL_OPERAND_N || cond.operand == PLURAL_OPERAND_I) ? number : 0;
+            if (cond.modulus != 0) {
+                n %= cond.modulus;
+            }
+            result = FALSE;
+            for (int32_t r = cond.rangeStart; r < cond.rangeLimit; r += 2) {
+                if (fRanges[r] <= n && n <= fRanges[r + 1]) {
+                    result = TRUE;
+                    break;
+                }
+            }
+            if (cond.negated) {
+                result = !result;
+            }
+        }
+        if (!result) {
+            c = cond.failTarget;
+        } else if (cond.keywordIndex >= 0) {
+            return cond.keywordIndex;
+        } else {
+            ++c;
+        }
+    }
+    return -1;
+}
+
 static UnicodeString tokenString(tokenType tok) {
     UnicodeString s;
     switch (tok) {
@@ -983,7 +1232,17 @@ void
 RuleChain::dumpRules(UnicodeString& result) {
     UChar digitString[16];
 
-    if ( ruleHeader != nullptr ) {
+    // A rule without any constraints, as for "other", is left out:
+    // The parser does not accept it, and it applies anyway to numbers that match no other rule.
+    UBool isEmptyRule = ruleHeader == nullptr ||
+        (ruleHeader->next == nullptr && ruleHeader->childNode != nullptr &&
+         ruleHeader->childNode->next == nullptr &&
+         ruleHeader->childNode->op == AndConstraint::NONE &&
+         ruleHeader->childNode->rangeList == nullptr && ruleHeader->childNode->value == -1);
+    if ( !isEmptyRule ) {
+        if ( !result.isEmpty() ) {
+            result += UNICODE_STRING_SIMPLE("; ");
+        }
         result +=  fKeyword;
         result += COLON;
         result += SPACE;
@@ -1063,7 +1322,6 @@ RuleChain::dumpRules(UnicodeString& result) {
         }
     }
     if ( fNext != nullptr ) {
-        result += UNICODE_STRING_SIMPLE("; ");
         fNext->dumpRules(result);
     }
 }
@@ -28,8 +28,19 @@
 #include "unicode/ures.h"
 #include "uvector.h"
 #include "hash.h"
+#include "sharedobject.h"
 #include "uassert.h"
 
+/**
+ * PluralRules precompute the categories of the integers from 0 to
+ * U_PLURAL_INTEGER_TABLE_SIZE-1, one byte each, so that selecting them
+ * is an array lookup. Define as 0 to turn the table off.
+ * @internal
+ */
+#ifndef U_PLURAL_INTEGER_TABLE_SIZE
+#define U_PLURAL_INTEGER_TABLE_SIZE 1001
+#endif
+
 class PluralRulesTest;
 
 U_NAMESPACE_BEGIN
@@ -366,6 +377,60 @@ class RuleChain : public UMemory  {
     UBool         isKeyword(const UnicodeString& keyword) const;
 };
 
+/**
+ * A RuleChain compiled into a flat array of conditions for PluralRules::select().
+ *
+ * Each condition tests one AndConstraint. When it is fulfilled and it is the last one
+ * of its "and" chain, its keyword is selected; when it is fulfilled otherwise,
+ * evaluation continues with the next condition; when it fails, evaluation
+ * continues with the first condition of the next "or" chain.
+ * Integer operands are evaluated without a FixedDecimal, and small
+ * integers are looked up in a table built by compile().
+ *
+ * A program is immutable, and copies of a PluralRules share it, so that the
+ * instances cloned from a SharedPluralRules do not compile the rules again.
+ */
+class PluralRuleProgram : public SharedObject {
+public:
+    /**
+     * Compiles the rules, or returns nullptr if there are none
+     * or if status is set to a failure.
+     * The caller must call removeRef() on the non-null result.
+     */
+    static const PluralRuleProgram *compile(const RuleChain *rules, UErrorCode &status);
+    virtual ~PluralRuleProgram();
+
+    /**
+     * Returns the keyword for the number, or nullptr for "other".
+     */
+    const UnicodeString *select(const IFixedDecimal &number) const;
+
+    /**
+     * Returns the keyword for the integer, or nullptr for "other".
+     * The absolute value must be less than 2^53 so that it is exact as a double.
+     */
+    const UnicodeString *selectInteger(int64_t number) const;
+
+private:
+    struct Condition;
+
+    Condition *fConditions = nullptr;
+    int32_t fConditionCount = 0;
+    int32_t *fRanges = nullptr;  // [low, high] pairs
+    UnicodeString *fKeywords = nullptr;
+    // Keyword index per integer, or OTHER_INDEX.
+    uint8_t *fIntegerCategories = nullptr;
+    int32_t fIntegerTableSize = 0;
+
+    static const uint8_t OTHER_INDEX = 0xff;
+
+    int32_t evaluateInteger(int64_t number) const;
+
+    PluralRuleProgram() = default;
+    PluralRuleProgram(const PluralRuleProgram &other) = delete;
+    PluralRuleProgram &operator=(const PluralRuleProgram &other) = delete;
+};
+
 class PluralKeywordEnumeration : public StringEnumeration {
 public:
     PluralKeywordEnumeration(RuleChain *header, UErrorCode& status);
@@ -1656,6 +1656,11 @@ RuleBasedNumberFormat::init(const UnicodeString& rules, LocalizationInfo* locali
         for (int i = 0; i < numRuleSets; i++) {
             fRuleSets[i]->parseRules(ruleSetDescriptions[i], status);
         }
+        // Parsing a rule set can turn another one into a fraction rule set,
+        // so the rule tables can only be built after all of them are parsed.
+        for (int i = 0; i < numRuleSets; i++) {
+            fRuleSets[i]->buildRuleTable(status);
+        }
     }
 
     // Now that the rules are initialized, the 'real' default rule
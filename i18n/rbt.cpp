@@ -20,16 +20,11 @@
 #include "rbt_data.h"
 #include "rbt_rule.h"
 #include "rbt.h"
-#include "mutex.h"
-#include "umutex.h"
 
 U_NAMESPACE_BEGIN
 
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(RuleBasedTransliterator)
 
-static UMutex transliteratorDataMutex = U_MUTEX_INITIALIZER;
-static Replaceable *gLockedText = NULL;
-
 void RuleBasedTransliterator::_construct(const UnicodeString& rules,
                                          UTransDirection direction,
                                          UParseError& parseError,
@@ -235,36 +230,10 @@ RuleBasedTransliterator::handleTransliterate(Replaceable& text, UTransPosition&
         loopLimit <<= 4;
     }
 
-    // Transliterator locking.  Rule-based Transliterators are not thread safe; concurrent
-    //   operations must be prevented.  
-    // A Complication: compound transliterators can result in recursive entries to this
-    //   function, sometimes with different "This" objects, always with the same text. 
-    //   Double-locking must be prevented in these cases.
-    //   
-
-    UBool    lockedMutexAtThisLevel = FALSE;
+    // No lock is needed: the shared rule data is not modified while
+    //   transliterating.  Segment matches are recorded in a per-call
+    //   SegmentMatchScope (see TransliterationRule::matchAndReplace()).
 
-    // Test whether this request is operating on the same text string as
-    //   some other transliteration that is still in progress and holding the 
-    //   transliteration mutex.  If so, do not lock the transliteration
-    //    mutex again.
-    //
-    //  gLockedText variable is protected by the global ICU mutex.
-    //  Shared RBT data protected by transliteratorDataMutex.
-    //
-    // TODO(andy): Need a better scheme for handling this.
-    UBool needToLock;
-    {
-        Mutex m;
-        needToLock = (&text != gLockedText);
-    }
-    if (needToLock) {
-        umtx_lock(&transliteratorDataMutex);  // Contention, longish waits possible here.
-        Mutex m;
-        gLockedText = &text;
-        lockedMutexAtThisLevel = TRUE;
-    }
-    
     // Check to make sure we don't dereference a null pointer.
     if (fData != NULL) {
 	    while (index.start < index.limit &&
@@ -273,13 +242,6 @@ RuleBasedTransliterator::handleTransliterate(Replaceable& text, UTransPosition&
 	        ++loopCount;
 	    }
     }
-    if (lockedMutexAtThisLevel) {
-        {
-            Mutex m;
-            gLockedText = NULL;
-        }
-        umtx_unlock(&transliteratorDataMutex);
-    }
 }
 
 UnicodeString& RuleBasedTransliterator::toRules(UnicodeString& rulesSource,
@@ -245,6 +245,41 @@ UBool TransliterationRule::matchesIndexValue(uint8_t v) const {
     return (m != NULL) ? m->matchesIndexValue(v) : TRUE;
 }
 
+/**
+ * Internal method.  Writes the literal code units at the start of
+ * the key, up to its first matcher stand-in, and returns their number.
+ * Stand-ins are always in the BMP, and the key is matched literally
+ * 16 bits at a time, so this works with code units.
+ */
+int32_t TransliterationRule::getKeyPrefix(UChar *dest, int32_t capacity) const {
+    int32_t length = 0;
+    int32_t limit = anteContextLength + keyLength;
+    for (int32_t i=anteContextLength; i<limit && length<capacity; ++i) {
+        UChar c = pattern.charAt(i);
+        if (data->lookupMatcher(c) != NULL) {
+            break;
+        }
+        dest[length++] = c;
+    }
+    return length;
+}
+
+/**
+ * Internal method.  Returns the UnicodeSet that the key starts with,
+ * or NULL if the key is empty or starts with a literal or another
+ * kind of matcher.
+ */
+const UnicodeSet* TransliterationRule::getFirstKeySet() const {
+    if (keyLength == 0) {
+        return NULL;
+    }
+    UnicodeFunctor* f = data->lookup(pattern.charAt(anteContextLength));
+    if (f == NULL || f->getDynamicClassID() != UnicodeSet::getStaticClassID()) {
+        return NULL;
+    }
+    return (const UnicodeSet*) f;
+}
+
 /**
  * Return true if this rule masks another rule.  If r1 masks r2 then
  * r1 matches any input string that r2 matches.  If r1 masks r2 and r2 masks
@@ -360,12 +395,9 @@ UMatchDegree TransliterationRule::matchAndReplace(Replaceable& text,
 
     // ============================ MATCH ===========================
 
-    // Reset segment match data
-    if (segments != NULL) {
-        for (int32_t i=0; i<segmentsCount; ++i) {
-            ((StringMatcher*) segments[i])->resetMatch();
-        }
-    }
+    // Segment match data lives on the stack for this call only, so that
+    // the shared rule data is not modified while matching.
+    SegmentMatchScope segmentMatches(segments != NULL ? segmentsCount : 0);
 
 //    int32_t lenDelta, keyLimit;
     int32_t keyLimit;
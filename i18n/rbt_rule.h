@@ -242,6 +242,25 @@ class TransliterationRule : public UMemory {
      */
     UBool matchesIndexValue(uint8_t v) const;
 
+    /**
+     * Internal method.  Writes the literal code units at the start of
+     * the key, up to its first matcher stand-in, and returns their number.
+     * Text that differs from them within the key limit cannot match this rule.
+     * @param dest       receives up to capacity code units
+     * @param capacity   the maximum number of code units to write
+     * @return           the length of the literal prefix, 0..capacity
+     */
+    int32_t getKeyPrefix(UChar *dest, int32_t capacity) const;
+
+    /**
+     * Internal method.  Returns the UnicodeSet that the key starts with,
+     * or NULL if the key is empty or starts with a literal or another
+     * kind of matcher.  Text whose first code point the set does not
+     * contain, nor start one of its strings with, cannot match this rule.
+     * @return    the first key set, or NULL
+     */
+    const UnicodeSet* getFirstKeySet() const;
+
     /**
      * Return true if this rule masks another rule.  If r1 masks r2 then
      * r1 matches any input string that r2 matches.  If r1 masks r2 and r2 masks
@@ -15,11 +15,15 @@
 #if !UCONFIG_NO_TRANSLITERATION
 
 #include "unicode/unistr.h"
+#include "unicode/codepointtrie.h"
 #include "unicode/uniset.h"
+#include "unicode/usetiter.h"
 #include "unicode/utf16.h"
 #include "rbt_set.h"
 #include "rbt_rule.h"
 #include "cmemory.h"
+#include "uarrsort.h"
+#include "uvectr32.h"
 #include "putilimp.h"
 
 U_CDECL_BEGIN
@@ -173,6 +177,11 @@ TransliterationRuleSet::TransliterationRuleSet(UErrorCode& status) : UMemory() {
     }
     rules = NULL;
     maxContextLength = 0;
+    keyTrie = NULL;
+    trieRules = NULL;
+    trieRuleOrder = NULL;
+    firstSetTrie = NULL;
+    setLists = NULL;
 }
 
 /**
@@ -182,6 +191,11 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
     UMemory(other),
     ruleVector(0),
     rules(0),
+    keyTrie(NULL),
+    trieRules(NULL),
+    trieRuleOrder(NULL),
+    firstSetTrie(NULL),
+    setLists(NULL),
     maxContextLength(other.maxContextLength) {
 
     int32_t i, len;
@@ -215,6 +229,7 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
 TransliterationRuleSet::~TransliterationRuleSet() {
     delete ruleVector; // This deletes the contained rules
     uprv_free(rules);
+    freeKeyTrie();
 }
 
 void TransliterationRuleSet::setData(const TransliterationRuleData* d) {
@@ -260,6 +275,7 @@ void TransliterationRuleSet::addRule(TransliterationRule* adoptedRule,
 
     uprv_free(rules);
     rules = 0;
+    freeKeyTrie();
 }
 
 /**
@@ -386,6 +402,283 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
     //if (errors != null) {
     //    throw new IllegalArgumentException(errors.toString());
     //}
+
+    freezeKeyTrie(status);
+}
+
+namespace {
+
+// Longer literal key prefixes are truncated in the trie;
+// matchAndReplace() still checks the whole key.
+const int32_t MAX_KEY_PREFIX_LENGTH = 16;
+
+struct KeyPrefix {
+    int32_t order;
+    int32_t length;
+    UChar units[MAX_KEY_PREFIX_LENGTH];
+};
+
+// Sorts by prefix, shorter before longer, then by rule order.
+int32_t U_CALLCONV
+compareKeyPrefixes(const void * /*context*/, const void *left, const void *right) {
+    const KeyPrefix &l = *static_cast<const KeyPrefix *>(left);
+    const KeyPrefix &r = *static_cast<const KeyPrefix *>(right);
+    int32_t minLength = uprv_min(l.length, r.length);
+    for (int32_t i=0; i<minLength; ++i) {
+        if (l.units[i] != r.units[i]) {
+            return (int32_t)l.units[i] - (int32_t)r.units[i];
+        }
+    }
+    if (l.length != r.length) {
+        return l.length - r.length;
+    }
+    return l.order - r.order;
+}
+
+}  // namespace
+
+/**
+ * Builds a trie that maps each code point to a list of the rules whose
+ * first key set can match text starting with it, for the rules at
+ * positions j with sets[j]!=NULL.  Each list is in rule order.
+ * A list is the list of an earlier rule plus one rule, so while adding
+ * rule j, it rewrites each value v by the list "v plus j", creating
+ * that once per v.  Only the lists still in use are written, as
+ * start/limit pairs into listRules in listRanges.
+ */
+static CodePointTrie* buildFirstSetLists(const UnicodeSet* const* sets, int32_t count,
+                                         UVector32& listRules, UVector32& listRanges,
+                                         UErrorCode& status) {
+    MutableCodePointTrie mutableTrie(0, 0, status);
+    // List k is list parents[k] plus rule lastRules[k]. List 0 is empty.
+    UVector32 parents(status), lastRules(status), memoRules(status), memoLists(status);
+    parents.addElement(-1, status);
+    lastRules.addElement(-1, status);
+    memoRules.addElement(-1, status);
+    memoLists.addElement(0, status);
+    UnicodeSet starts;
+    for (int32_t j=0; j<count && U_SUCCESS(status); ++j) {
+        if (sets[j] == NULL) {
+            continue;
+        }
+        // The code points of the set, and the first code point (and lead unit) of each string.
+        starts = *sets[j];
+        UnicodeSetIterator iter(*sets[j]);
+        while (iter.next()) {
+            if (iter.isString()) {
+                UChar32 c = iter.getString().char32At(0);
+                starts.add(c);
+                if (c > 0xffff) {
+                    starts.add(U16_LEAD(c));
+                }
+            }
+        }
+        for (int32_t i=0; i<starts.getRangeCount() && U_SUCCESS(status); ++i) {
+            UChar32 start = starts.getRangeStart(i), end = starts.getRangeEnd(i);
+            while (start <= end) {
+                uint32_t v;
+                UChar32 runEnd = mutableTrie.getRange(start, UCPMAP_RANGE_NORMAL, 0,
+                                                      NULL, NULL, &v);
+                if (runEnd > end) {
+                    runEnd = end;
+                }
+                if (memoRules.elementAti(v) != j) {
+                    memoRules.setElementAt(j, v);
+                    memoLists.setElementAt(parents.size(), v);
+                    parents.addElement(v, status);
+                    lastRules.addElement(j, status);
+                    memoRules.addElement(-1, status);
+                    memoLists.addElement(0, status);
+                }
+                mutableTrie.setRange(start, runEnd, memoLists.elementAti(v), status);
+                start = runEnd + 1;
+            }
+        }
+    }
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    // Write the lists that are still used, and empty ranges for the others.
+    int32_t listCount = parents.size();
+    for (int32_t k=0; k<2*listCount; ++k) {
+        listRanges.addElement(0, status);
+    }
+    // Reuse memoRules for whether a list has been written.
+    for (int32_t k=0; k<listCount; ++k) {
+        memoRules.setElementAt(0, k);
+    }
+    UChar32 start = 0, end;
+    uint32_t v;
+    while ((end = mutableTrie.getRange(start, UCPMAP_RANGE_NORMAL, 0, NULL, NULL, &v)) >= 0 &&
+            U_SUCCESS(status)) {
+        if (v != 0 && memoRules.elementAti(v) == 0) {
+            memoRules.setElementAt(1, v);
+            int32_t listStart = listRules.size();
+            for (int32_t k=v; k!=0; k=parents.elementAti(k)) {
+                listRules.addElement(lastRules.elementAti(k), status);
+            }
+            // The rules were added from last to first.
+            for (int32_t lo=listStart, hi=listRules.size()-1; lo<hi; ++lo, --hi) {
+                int32_t rule = listRules.elementAti(lo);
+                listRules.setElementAt(listRules.elementAti(hi), lo);
+                listRules.setElementAt(rule, hi);
+            }
+            listRanges.setElementAt(listStart, 2 * v);
+            listRanges.setElementAt(listRules.size(), 2 * v + 1);
+        }
+        start = end + 1;
+    }
+    return mutableTrie.buildImmutable(UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_32, status);
+}
+
+/**
+ * Build the key trie from the sorted literal key prefixes of all rules.
+ * Each node covers the range of prefixes that share its path;
+ * the ones that end at the node come first in that range.
+ * Nodes are created breadth-first so that siblings are contiguous.
+ */
+void TransliterationRuleSet::freezeKeyTrie(UErrorCode& status) {
+    freeKeyTrie();
+    int32_t n = ruleVector->size();
+    if (U_FAILURE(status) || n == 0) {
+        return;
+    }
+    LocalMemory<KeyPrefix> prefixes((KeyPrefix*) uprv_malloc(n * sizeof(KeyPrefix)));
+    if (prefixes.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t j, x, maxNodes = 1;
+    for (j=0; j<n; ++j) {
+        TransliterationRule* r = (TransliterationRule*) ruleVector->elementAt(j);
+        KeyPrefix &p = prefixes[j];
+        p.order = j;
+        p.length = r->getKeyPrefix(p.units, MAX_KEY_PREFIX_LENGTH);
+        maxNodes += p.length;
+    }
+    uprv_sortArray(prefixes.getAlias(), n, (int32_t)sizeof(KeyPrefix),
+                   compareKeyPrefixes, NULL, FALSE, &status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    // The rules without a literal prefix sort first.
+    // List those whose key starts with a set per code point, and bin the others.
+    int32_t rootCount = 0;
+    while (rootCount < n && prefixes[rootCount].length == 0) {
+        ++rootCount;
+    }
+    LocalMemory<const UnicodeSet*> sets((const UnicodeSet**)
+        uprv_malloc((rootCount > 0 ? rootCount : 1) * sizeof(const UnicodeSet*)));
+    if (sets.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t setCount = 0, binnedCount = 0;
+    for (j=0; j<rootCount; ++j) {
+        TransliterationRule* r =
+            (TransliterationRule*) ruleVector->elementAt(prefixes[j].order);
+        if ((sets[j] = r->getFirstKeySet()) != NULL) {
+            ++setCount;
+        } else {
+            for (x=0; x<256; ++x) {
+                if (r->matchesIndexValue((uint8_t)x)) {
+                    ++binnedCount;
+                }
+            }
+        }
+    }
+    UVector32 listRules(status), listRanges(status);
+    if (setCount > 0) {
+        firstSetTrie = buildFirstSetLists(sets.getAlias(), rootCount,
+                                          listRules, listRanges, status);
+        if (U_FAILURE(status)) {
+            freeKeyTrie();
+            return;
+        }
+    }
+
+    int32_t trieRuleCount = n + binnedCount + listRules.size();
+    keyTrie = (KeyTrieNode*) uprv_malloc(maxNodes * sizeof(KeyTrieNode));
+    trieRules = (TransliterationRule**) uprv_malloc(trieRuleCount * sizeof(TransliterationRule*));
+    trieRuleOrder = (int32_t*) uprv_malloc(trieRuleCount * sizeof(int32_t));
+    if (firstSetTrie != NULL) {
+        setLists = (int32_t*) uprv_malloc(listRanges.size() * sizeof(int32_t));
+    }
+    // Temporary per-node limit of the prefix range, and node depth.
+    LocalMemory<int32_t> nodeLimits((int32_t*) uprv_malloc(maxNodes * 2 * sizeof(int32_t)));
+    if (keyTrie == NULL || trieRules == NULL || trieRuleOrder == NULL ||
+            (firstSetTrie != NULL && setLists == NULL) || nodeLimits.isNull()) {
+        freeKeyTrie();
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t* nodeDepths = nodeLimits.getAlias() + maxNodes;
+    for (j=0; j<n; ++j) {
+        trieRules[j] = (TransliterationRule*) ruleVector->elementAt(prefixes[j].order);
+        trieRuleOrder[j] = prefixes[j].order;
+    }
+    int32_t k = n;
+    for (x=0; x<256; ++x) {
+        rootIndex[x] = k;
+        for (j=0; j<rootCount; ++j) {
+            if (sets[j] == NULL && trieRules[j]->matchesIndexValue((uint8_t)x)) {
+                trieRules[k] = trieRules[j];
+                trieRuleOrder[k++] = trieRuleOrder[j];
+            }
+        }
+    }
+    rootIndex[256] = k;
+    for (int32_t i=0; i<listRanges.size(); ++i) {
+        setLists[i] = k + listRanges.elementAti(i);
+    }
+    for (int32_t i=0; i<listRules.size(); ++i) {
+        j = listRules.elementAti(i);
+        trieRules[k] = trieRules[j];
+        trieRuleOrder[k++] = trieRuleOrder[j];
+    }
+
+    keyTrie[0].unit = 0;
+    keyTrie[0].rulesStart = 0;
+    nodeLimits[0] = n;
+    nodeDepths[0] = 0;
+    int32_t nodeCount = 1;
+    for (int32_t i=0; i<nodeCount; ++i) {
+        KeyTrieNode &node = keyTrie[i];
+        int32_t start = node.rulesStart, limit = nodeLimits[i], depth = nodeDepths[i];
+        while (start < limit && prefixes[start].length == depth) {
+            ++start;
+        }
+        node.rulesLimit = start;
+        node.firstChild = nodeCount;
+        while (start < limit) {
+            UChar unit = prefixes[start].units[depth];
+            KeyTrieNode &child = keyTrie[nodeCount];
+            child.unit = unit;
+            child.rulesStart = start;
+            nodeDepths[nodeCount] = depth + 1;
+            do {
+                ++start;
+            } while (start < limit && prefixes[start].units[depth] == unit);
+            nodeLimits[nodeCount++] = start;
+        }
+        node.childCount = nodeCount - node.firstChild;
+    }
+    // The root's rules are found via rootIndex[] and firstSetTrie.
+    keyTrie[0].rulesLimit = keyTrie[0].rulesStart;
+}
+
+void TransliterationRuleSet::freeKeyTrie() {
+    uprv_free(keyTrie);
+    uprv_free(trieRules);
+    uprv_free(trieRuleOrder);
+    delete firstSetTrie;
+    uprv_free(setLists);
+    keyTrie = NULL;
+    trieRules = NULL;
+    trieRuleOrder = NULL;
+    firstSetTrie = NULL;
+    setLists = NULL;
 }
 
 /**
@@ -404,7 +697,79 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
 UBool TransliterationRuleSet::transliterate(Replaceable& text,
                                             UTransPosition& pos,
                                             UBool incremental) {
-    int16_t indexByte = (int16_t) (text.char32At(pos.start) & 0xFF);
+    UChar32 c32 = text.char32At(pos.start);
+    int16_t indexByte = (int16_t) (c32 & 0xFF);
+    if (keyTrie != NULL) {
+        // Collect the rule ranges along the trie path that matches the text.
+        int32_t starts[MAX_KEY_PREFIX_LENGTH + 2], limits[MAX_KEY_PREFIX_LENGTH + 2];
+        starts[0] = rootIndex[indexByte];
+        limits[0] = rootIndex[indexByte + 1];
+        int32_t depth = 1;
+        if (firstSetTrie != NULL) {
+            uint32_t list = firstSetTrie->get(c32);
+            starts[1] = setLists[2 * list];
+            limits[1] = setLists[2 * list + 1];
+            depth = 2;
+        }
+        UBool usePath = TRUE;
+        const KeyTrieNode* node = keyTrie;
+        for (int32_t t=pos.start; node->childCount > 0; ++t) {
+            if (t >= pos.limit) {
+                // Rules with longer prefixes mismatch, unless incremental,
+                // where they may match partially. Leave that case to index[].
+                usePath = !incremental;
+                break;
+            }
+            // Binary search for the child with the text code unit.
+            UChar c = text.charAt(t);
+            const KeyTrieNode* children = keyTrie + node->firstChild;
+            int32_t lo = 0, hi = node->childCount;
+            while (lo < hi) {
+                int32_t mid = (lo + hi) / 2;
+                if (children[mid].unit < c) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            if (lo == node->childCount || children[lo].unit != c) {
+                break;
+            }
+            node = children + lo;
+            if (node->rulesStart < node->rulesLimit) {
+                starts[depth] = node->rulesStart;
+                limits[depth++] = node->rulesLimit;
+            }
+        }
+        if (usePath) {
+            // Try the candidate rules in rule order, merging the ranges.
+            for (;;) {
+                int32_t best = -1;
+                for (int32_t d=0; d<depth; ++d) {
+                    if (starts[d] < limits[d] &&
+                            (best < 0 || trieRuleOrder[starts[d]] < trieRuleOrder[starts[best]])) {
+                        best = d;
+                    }
+                }
+                if (best < 0) {
+                    break;
+                }
+                TransliterationRule* r = trieRules[starts[best]++];
+                UMatchDegree m = r->matchAndReplace(text, pos, incremental);
+                if (m == U_MATCH) {
+                    _debugOut("match", r, text, pos);
+                    return TRUE;
+                } else if (m == U_PARTIAL_MATCH) {
+                    _debugOut("partial match", r, text, pos);
+                    return FALSE;
+                }
+            }
+            // No match or partial match from any rule
+            pos.start += U16_LENGTH(c32);
+            _debugOut("no match", NULL, text, pos);
+            return TRUE;
+        }
+    }
     for (int32_t i=index[indexByte]; i<index[indexByte+1]; ++i) {
         UMatchDegree m = rules[i]->matchAndReplace(text, pos, incremental);
         switch (m) {
@@ -22,6 +22,7 @@
 
 U_NAMESPACE_BEGIN
 
+class CodePointTrie;
 class Replaceable;
 class TransliterationRule;
 class TransliterationRuleData;
@@ -58,6 +59,40 @@ class TransliterationRuleSet : public UMemory {
      */
     int32_t index[257];
 
+    /**
+     * Trie over the literal key prefixes of the rules, created by
+     * freeze() together with index[].  Node 0 is the root.  The
+     * children of each node are contiguous and sorted by code unit.
+     * Each non-root node lists in trieRules[rulesStart..rulesLimit-1]
+     * the rules whose literal key prefix ends there, in rule order.
+     * The rules without a literal key prefix whose key starts with a
+     * UnicodeSet are listed per first code point: firstSetTrie maps
+     * each code point to a list number k, for the rules at
+     * trieRules[setLists[2*k]..setLists[2*k+1]-1].  The other rules
+     * without a literal key prefix are binned like in index[], at
+     * trieRules[rootIndex[x]..rootIndex[x+1]-1].
+     * At a text position, only the rules listed for its code point and
+     * along the path of nodes that matches the text can match.
+     */
+    struct KeyTrieNode {
+        int32_t firstChild;
+        int32_t childCount;
+        int32_t rulesStart;
+        int32_t rulesLimit;
+        UChar unit;
+    };
+    KeyTrieNode* keyTrie;
+
+    /**
+     * Alias pointers to the rules in the trie nodes and root bins,
+     * and for each the index of the rule in ruleVector.
+     */
+    TransliterationRule** trieRules;
+    int32_t* trieRuleOrder;
+    int32_t rootIndex[257];
+    CodePointTrie* firstSetTrie;
+    int32_t* setLists;
+
     /**
      * Length of the longest preceding context
      */
@@ -157,6 +192,10 @@ class TransliterationRuleSet : public UMemory {
 
 private:
 
+    void freezeKeyTrie(UErrorCode& status);
+
+    void freeKeyTrie();
+
     TransliterationRuleSet &operator=(const TransliterationRuleSet &other); // forbid copying of this class
 };
 
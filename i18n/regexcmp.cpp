@@ -39,6 +39,7 @@
 #include "regexcst.h"   // Contains state table for the regex pattern parser.
                         //   generated by a Perl script.
 #include "regexcmp.h"
+#include "regexdfa.h"
 #include "regexst.h"
 #include "regextxt.h"
 
@@ -319,6 +320,16 @@ void    RegexCompile::compile(
     //
     matchStartType();
 
+    //
+    // Optimization pass 3: find() can skip input without matches using a DFA
+    //   if the pattern is simple enough.  Not for patterns that can match
+    //   an empty string, which match anywhere, nor for those that start with
+    //   a literal, for which find() has a faster scan of its own.
+    //
+    fRXPat->fUseDFA = fRXPat->fMinMatchLen > 0 &&
+        fRXPat->fStartType != START_CHAR && fRXPat->fStartType != START_STRING &&
+        RegexDFA::isSupported(*fRXPat);
+
     //
     // Set up fast latin-1 range sets
     //
@@ -2672,6 +2683,7 @@ void   RegexCompile::matchStartType() {
     int32_t    opType;                 // The opcode type of the op
     int32_t    currentLen = 0;         // Minimum length of a match to this point (loc) in the pattern
     int32_t    numInitialStrings = 0;  // Number of strings encountered that could match at start.
+    UBool      backRefAtStart = FALSE; // True if a back reference could match before an initial string.
 
     UBool      atStart = TRUE;         // True if no part of the pattern yet encountered
                                        //   could have advanced the position in a match.
@@ -2723,6 +2735,11 @@ void   RegexCompile::matchStartType() {
         case URX_STO_INP_LOC:
         case URX_BACKREF:         // BackRef.  Must assume that it might be a zero length match
         case URX_BACKREF_I:
+            if (currentLen == 0) {
+                // But it might also match text before an initial string.
+                backRefAtStart = TRUE;
+            }
+            break;
 
         case URX_STO_SP:          // Setup for atomic or possessive blocks.  Doesn't change what can match.
         case URX_LD_SP:
@@ -3162,6 +3179,52 @@ void   RegexCompile::matchStartType() {
         fRXPat->fStartType = START_NO_INFO;
     }
 
+    // Collect the distinct first code units of the characters that can start a match,
+    //   if there are few of them, for find() to skip to the next one with a vectorized scan.
+    //   A trail surrogate could be found in the middle of a surrogate pair, where
+    //   find() would not otherwise start a match, so those are left out.
+    fRXPat->fInitialUnitsLength = 0;
+    fRXPat->fInitialStringDistance = 0;
+    if (fRXPat->fStartType == START_CHAR || fRXPat->fStartType == START_STRING) {
+        UChar32 c = fRXPat->fInitialChar;
+        if (!U_IS_TRAIL(c)) {
+            fRXPat->fInitialUnits[0] = c <= 0xffff ? (UChar)c : U16_LEAD(c);
+            fRXPat->fInitialUnitsLength = 1;
+            if (fRXPat->fStartType == START_STRING && !backRefAtStart) {
+                // Matches begin with the whole string, so its last code unit can be
+                //   checked at the same time.
+                fRXPat->fInitialStringDistance = fRXPat->fInitialStringLen - 1;
+            }
+        }
+    } else if (fRXPat->fStartType == START_SET) {
+        int32_t length = 0;
+        for (int32_t i = 0; i < fRXPat->fInitialChars->getRangeCount() && length >= 0; ++i) {
+            UChar32 start = fRXPat->fInitialChars->getRangeStart(i);
+            UChar32 end = fRXPat->fInitialChars->getRangeEnd(i);
+            if (start <= 0xdfff && end >= 0xdc00) {
+                length = -1;
+                break;
+            }
+            for (UChar32 c = start; c <= end && length >= 0; ++c) {
+                UChar unit = c <= 0xffff ? (UChar)c : U16_LEAD(c);
+                int32_t j = 0;
+                while (j < length && fRXPat->fInitialUnits[j] != unit) {
+                    ++j;
+                }
+                if (j < length) {
+                    // Already added.
+                } else if (length < UPRV_LENGTHOF(fRXPat->fInitialUnits)) {
+                    fRXPat->fInitialUnits[length++] = unit;
+                } else {
+                    length = -1;  // Too many.
+                }
+            }
+        }
+        if (length > 0) {
+            fRXPat->fInitialUnitsLength = length;
+        }
+    }
+
     return;
 }
 
@@ -3755,14 +3818,18 @@ void RegexCompile::stripNOPs() {
     }
 
     int32_t    end = fRXPat->fCompiledPat->size();
-    UVector32  deltas(end, *fStatus);
+    MaybeStackArray<int32_t, 128> deltas(end);
+    if (deltas.getCapacity() < end) {
+        *fStatus = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
 
     // Make a first pass over the code, computing the amount that things
     //   will be offset at each location in the original code.
     int32_t   loc;
     int32_t   d = 0;
     for (loc=0; loc<end; loc++) {
-        deltas.addElement(d, *fStatus);
+        deltas[loc] = d;
         int32_t op = (int32_t)fRXPat->fCompiledPat->elementAti(loc);
         if (URX_TYPE(op) == URX_NOP) {
             d++;
@@ -3795,8 +3862,8 @@ void RegexCompile::stripNOPs() {
             // These are instructions with operands that refer to code locations.
             {
                 int32_t  operandAddress = URX_VAL(op);
-                U_ASSERT(operandAddress>=0 && operandAddress<deltas.size());
-                int32_t fixedOperandAddress = operandAddress - deltas.elementAti(operandAddress);
+                U_ASSERT(operandAddress>=0 && operandAddress<end);
+                int32_t fixedOperandAddress = operandAddress - deltas[operandAddress];
                 op = buildOp(opType, fixedOperandAddress);
                 fRXPat->fCompiledPat->setElementAt(op, dst);
                 dst++;
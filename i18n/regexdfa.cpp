@@ -0,0 +1,567 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  regexdfa.cpp
+//  created: 2026oct14
+//
+//  Lazily built DFA for RegexMatcher::find(), see regexdfa.h.
+//
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/localpointer.h"
+#include "unicode/regex.h"
+#include "unicode/uchar.h"
+#include "unicode/uniset.h"
+#include "unicode/utf16.h"
+#include "cmemory.h"
+#include "regexdfa.h"
+#include "regeximp.h"
+#include "uarrsort.h"
+#include "uvector.h"
+#include "uvectr64.h"
+
+U_NAMESPACE_BEGIN
+
+UBool RegexDFA::isSupported(const RegexPattern &pattern) {
+    const UVector64 &pat = *pattern.fCompiledPat;
+    int32_t length = pat.size();
+    for (int32_t patIdx = 0; patIdx < length; ++patIdx) {
+        int32_t op = (int32_t)pat.elementAti(patIdx);
+        switch (URX_TYPE(op)) {
+        case URX_NOP:
+        case URX_BACKTRACK:
+        case URX_FAIL:
+        case URX_END:
+        case URX_START_CAPTURE:
+        case URX_END_CAPTURE:
+        case URX_STO_INP_LOC:
+        case URX_JMP:
+        case URX_STATE_SAVE:
+        case URX_JMP_SAV:
+        case URX_JMP_SAV_X:
+        case URX_ONECHAR:
+        case URX_ONECHAR_I:
+        case URX_SETREF:
+        case URX_STATIC_SETREF:
+        case URX_STAT_SETREF_N:
+        case URX_DOTANY:
+        case URX_DOTANY_UNIX:
+        case URX_BACKSLASH_D:
+        case URX_BACKSLASH_H:
+        case URX_BACKSLASH_V:
+            break;
+        case URX_STRING:
+            // The string length is the operand of the following URX_STRING_LEN.
+            ++patIdx;
+            break;
+        case URX_LOOP_DOT_I:
+            if ((URX_VAL(op) & 1) != 0) {
+                // In dot-matches-all mode, the loop backs up over a CR/LF pair as a unit.
+                return FALSE;
+            }
+            U_FALLTHROUGH;
+        case URX_LOOP_SR_I:
+            // Skip the URX_LOOP_C that must follow.
+            ++patIdx;
+            break;
+        default:
+            // Back references, look-around, anchors and word boundaries,
+            //   atomic groups, counted loops, and case-insensitive strings.
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+RegexDFA::RegexDFA(const RegexPattern &pattern, UErrorCode &status) :
+        fPatternCount(1), fPatBase(status), fPosToPattern(status),
+        fPatToId(status), fIdToPat(status), fMatchIds(status),
+        fWork(status), fPending(status), fMarks(status), fVisited(status), fGeneration(0),
+        fStateCount(0), fMaxStates(MAX_STATES), fStartState(-1), fScanCount(0),
+        fSetData(status), fStateMap(NULL) {
+    fPatterns[0] = &pattern;
+    init(status);
+}
+
+RegexDFA::RegexDFA(const RegexPattern *const *patterns, int32_t count, int32_t maxStates,
+                   UErrorCode &status) :
+        fPatternCount(0), fPatBase(status), fPosToPattern(status),
+        fPatToId(status), fIdToPat(status), fMatchIds(status),
+        fWork(status), fPending(status), fMarks(status), fVisited(status), fGeneration(0),
+        fStateCount(0), fMaxStates(maxStates), fStartState(-1), fScanCount(0),
+        fSetData(status), fStateMap(NULL) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (count > 1 && fPatterns.resize(count) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < count; ++i) {
+        fPatterns[i] = patterns[i];
+    }
+    fPatternCount = count;
+    init(status);
+}
+
+void RegexDFA::init(UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    // Number the positions and the automaton states.
+    for (int32_t i = 0; i < fPatternCount; ++i) {
+        const int64_t *pat = fPatterns[i]->fCompiledPat->getBuffer();
+        int32_t patLength = fPatterns[i]->fCompiledPat->size();
+        fPatBase.addElement(fPosToPattern.size(), status);
+        fMatchIds.addElement(-1, status);
+        for (int32_t patIdx = 0; patIdx < patLength; ++patIdx) {
+            int32_t op = (int32_t)pat[patIdx];
+            int32_t count;
+            switch (URX_TYPE(op)) {
+            case URX_END:
+                fMatchIds.setElementAt(fIdToPat.size(), i);
+                count = 1;
+                break;
+            case URX_STRING:
+                count = URX_VAL(pat[patIdx + 1]);
+                break;
+            case URX_ONECHAR:
+            case URX_ONECHAR_I:
+            case URX_SETREF:
+            case URX_STATIC_SETREF:
+            case URX_STAT_SETREF_N:
+            case URX_DOTANY:
+            case URX_DOTANY_UNIX:
+            case URX_BACKSLASH_D:
+            case URX_BACKSLASH_H:
+            case URX_BACKSLASH_V:
+            case URX_LOOP_SR_I:
+            case URX_LOOP_DOT_I:
+                count = 1;
+                break;
+            default:
+                count = 0;
+                break;
+            }
+            int32_t pos = fPosToPattern.size();
+            fPosToPattern.addElement(i, status);
+            fPatToId.addElement(count > 0 ? fIdToPat.size() : -1, status);
+            for (int32_t j = 0; j < count; ++j) {
+                fIdToPat.addElement(pos, status);
+            }
+        }
+    }
+    fPatBase.addElement(fPosToPattern.size(), status);
+    fMarks.setSize(fIdToPat.size());
+    fVisited.setSize(fPosToPattern.size());
+    if (U_SUCCESS(status) &&
+            (fMarks.size() != fIdToPat.size() || fVisited.size() != fPosToPattern.size())) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    fStateMap = uhash_open(uhash_hashUnicodeString, uhash_compareUnicodeString,
+                           uhash_compareLong, &status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    uhash_setKeyDeleter(fStateMap, uprv_deleteUObject);
+
+    beginState();
+    for (int32_t i = 0; i < fPatternCount; ++i) {
+        addClosure(fPatBase.elementAti(i), status);
+    }
+    fStartState = addState(status);
+}
+
+RegexDFA::~RegexDFA() {
+    for (int32_t i = 0; i < fStateCount; ++i) {
+        delete fStates[i];
+    }
+    uhash_close(fStateMap);
+}
+
+RegexDFA::EResult RegexDFA::search(UText *input, int64_t start, int64_t limit,
+                                  UErrorCode &status) {
+    if (U_FAILURE(status) || fStartState < 0) {
+        return UNKNOWN;
+    }
+    State *state = fStates[fStartState];
+    if (state->isMatch) {
+        return MATCH;
+    }
+    UTEXT_SETNATIVEINDEX(input, start);
+    while (UTEXT_GETNATIVEINDEX(input) < limit) {
+        UChar32 c = UTEXT_NEXT32(input);
+        int32_t next = c < 0x100 ? state->next[c] : UNCOMPUTED;
+        if (next < 0) {
+            next = nextState(state, c, status);
+            if (next < 0) {
+                return UNKNOWN;
+            }
+        }
+        state = fStates[next];
+        if (state->isMatch) {
+            return MATCH;
+        }
+    }
+    return NO_MATCH;
+}
+
+RegexDFA::EResult RegexDFA::search(const UChar *input, int32_t start, int32_t limit,
+                                  UErrorCode &status) {
+    if (U_FAILURE(status) || fStartState < 0) {
+        return UNKNOWN;
+    }
+    State *state = fStates[fStartState];
+    if (state->isMatch) {
+        return MATCH;
+    }
+    int32_t i = start;
+    while (i < limit) {
+        UChar32 c = input[i++];
+        int32_t next;
+        if (c < 0x100) {
+            next = state->next[c];
+        } else {
+            if (U16_IS_LEAD(c) && i < limit && U16_IS_TRAIL(input[i])) {
+                c = U16_GET_SUPPLEMENTARY(c, input[i++]);
+            }
+            next = UNCOMPUTED;
+        }
+        if (next < 0) {
+            next = nextState(state, c, status);
+            if (next < 0) {
+                return UNKNOWN;
+            }
+        }
+        state = fStates[next];
+        if (state->isMatch) {
+            return MATCH;
+        }
+    }
+    return NO_MATCH;
+}
+
+RegexDFA::EResult RegexDFA::searchAll(UText *input, int64_t start, int64_t limit,
+                                     UBool *found, int32_t &foundCount, UErrorCode &status) {
+    if (U_FAILURE(status) || fStartState < 0) {
+        return UNKNOWN;
+    }
+    ++fScanCount;
+    State *state = fStates[fStartState];
+    UTEXT_SETNATIVEINDEX(input, start);
+    for (;;) {
+        if (state->isMatch && recordMatches(state, found, foundCount)) {
+            return MATCH;
+        }
+        if (UTEXT_GETNATIVEINDEX(input) >= limit) {
+            break;
+        }
+        UChar32 c = UTEXT_NEXT32(input);
+        int32_t next = c < 0x100 ? state->next[c] : UNCOMPUTED;
+        if (next < 0) {
+            next = nextState(state, c, status);
+            if (next < 0) {
+                return UNKNOWN;
+            }
+        }
+        state = fStates[next];
+    }
+    return foundCount > 0 ? MATCH : NO_MATCH;
+}
+
+RegexDFA::EResult RegexDFA::searchAll(const UChar *input, int32_t start, int32_t limit,
+                                     UBool *found, int32_t &foundCount, UErrorCode &status) {
+    if (U_FAILURE(status) || fStartState < 0) {
+        return UNKNOWN;
+    }
+    ++fScanCount;
+    State *state = fStates[fStartState];
+    int32_t i = start;
+    for (;;) {
+        if (state->isMatch && recordMatches(state, found, foundCount)) {
+            return MATCH;
+        }
+        if (i >= limit) {
+            break;
+        }
+        UChar32 c = input[i++];
+        int32_t next;
+        if (c < 0x100) {
+            next = state->next[c];
+        } else {
+            if (U16_IS_LEAD(c) && i < limit && U16_IS_TRAIL(input[i])) {
+                c = U16_GET_SUPPLEMENTARY(c, input[i++]);
+            }
+            next = UNCOMPUTED;
+        }
+        if (next < 0) {
+            next = nextState(state, c, status);
+            if (next < 0) {
+                return UNKNOWN;
+            }
+        }
+        state = fStates[next];
+    }
+    return foundCount > 0 ? MATCH : NO_MATCH;
+}
+
+// Sets found[] for the patterns that match in the state.
+// Returns TRUE if all patterns have been found.
+UBool RegexDFA::recordMatches(State *state, UBool *found, int32_t &foundCount) {
+    if (state->recorded != fScanCount) {
+        // The same state recurs often, for example while a pattern ending with .* keeps
+        //   matching, and the result will be the same while found[] is.
+        state->recorded = fScanCount;
+        const int32_t *matchList = fSetData.getBuffer() + state->setStart + state->setLength;
+        for (int32_t i = 0; i < state->matchLength; ++i) {
+            if (!found[matchList[i]]) {
+                found[matchList[i]] = TRUE;
+                ++foundCount;
+            }
+        }
+    }
+    return foundCount == fPatternCount;
+}
+
+int32_t RegexDFA::nextState(State *state, UChar32 c, UErrorCode &status) {
+    if (c >= 0x100 && c == state->lastChar) {
+        return state->lastNext;
+    }
+    beginState();
+    const int32_t *ids = fSetData.getBuffer() + state->setStart;
+    for (int32_t i = 0; i < state->setLength; ++i) {
+        addNext(ids[i], c, status);
+    }
+    // A match may also start at the following position.
+    for (int32_t i = 0; i < fPatternCount; ++i) {
+        addClosure(fPatBase.elementAti(i), status);
+    }
+    int32_t next = addState(status);
+    if (next >= 0) {
+        if (c < 0x100) {
+            state->next[c] = next;
+        } else {
+            state->lastChar = c;
+            state->lastNext = next;
+        }
+    }
+    return next;
+}
+
+void RegexDFA::beginState() {
+    fWork.removeAllElements();
+    if (++fGeneration == INT32_MAX) {
+        // Start the marks over rather than let them wrap around.
+        for (int32_t i = 0; i < fMarks.size(); ++i) {
+            fMarks.setElementAt(0, i);
+        }
+        for (int32_t i = 0; i < fVisited.size(); ++i) {
+            fVisited.setElementAt(0, i);
+        }
+        fGeneration = 1;
+    }
+}
+
+int32_t RegexDFA::addState(UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    int32_t length = fWork.size();
+    int32_t *ids = fWork.getBuffer();
+    uprv_sortArray(ids, length, (int32_t)sizeof(int32_t),
+                   uprv_int32Comparator, NULL, FALSE, &status);
+    UnicodeString key;
+    for (int32_t i = 0; i < length; ++i) {
+        key.append((UChar)(ids[i] >> 16)).append((UChar)ids[i]);
+    }
+    int32_t index = uhash_geti(fStateMap, &key) - 1;
+    if (index >= 0) {
+        return index;
+    }
+    if (fStateCount == fMaxStates) {
+        return -1;
+    }
+    if (fStateCount == fStates.getCapacity()) {
+        int32_t capacity = fStateCount * 2 < fMaxStates ? fStateCount * 2 : fMaxStates;
+        if (fStates.resize(capacity, fStateCount) == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return -1;
+        }
+    }
+    LocalPointer<State> state(new State, status);
+    LocalPointer<UnicodeString> ownedKey(new UnicodeString(key), status);
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    state->setStart = fSetData.size();
+    state->setLength = length;
+    state->matchLength = 0;
+    state->recorded = 0;
+    state->lastChar = U_SENTINEL;
+    state->lastNext = UNCOMPUTED;
+    for (int32_t c = 0; c < 0x100; ++c) {
+        state->next[c] = UNCOMPUTED;
+    }
+    for (int32_t i = 0; i < length; ++i) {
+        fSetData.addElement(ids[i], status);
+    }
+    for (int32_t i = 0; i < fPatternCount; ++i) {
+        int32_t matchId = fMatchIds.elementAti(i);
+        if (matchId >= 0 && fMarks.elementAti(matchId) == fGeneration) {
+            fSetData.addElement(i, status);
+            ++state->matchLength;
+        }
+    }
+    state->isMatch = state->matchLength > 0;
+    uhash_puti(fStateMap, ownedKey.orphan(), fStateCount + 1, &status);
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    fStates[fStateCount] = state.orphan();
+    return fStateCount++;
+}
+
+void RegexDFA::addId(int32_t id, UErrorCode &status) {
+    if (fMarks.elementAti(id) != fGeneration) {
+        fMarks.setElementAt(fGeneration, id);
+        fWork.push(id, status);
+    }
+}
+
+// Returns the op at a position, and the number of the pattern it is in.
+int32_t RegexDFA::getOp(int32_t pos, int32_t &patternIndex) const {
+    patternIndex = fPosToPattern.elementAti(pos);
+    return (int32_t)fPatterns[patternIndex]->fCompiledPat->elementAti(
+        pos - fPatBase.elementAti(patternIndex));
+}
+
+// Adds the automaton states that are reachable from pos without consuming input.
+void RegexDFA::addClosure(int32_t pos, UErrorCode &status) {
+    fPending.push(pos, status);
+    while (!fPending.empty() && U_SUCCESS(status)) {
+        pos = fPending.popi();
+        if (fVisited.elementAti(pos) == fGeneration) {
+            continue;
+        }
+        fVisited.setElementAt(fGeneration, pos);
+        int32_t patternIndex;
+        int32_t op = getOp(pos, patternIndex);
+        int32_t opValue = URX_VAL(op);
+        switch (URX_TYPE(op)) {
+        case URX_NOP:
+        case URX_START_CAPTURE:
+        case URX_END_CAPTURE:
+        case URX_STO_INP_LOC:
+        case URX_LOOP_C:
+            fPending.push(pos + 1, status);
+            break;
+        case URX_JMP:
+            fPending.push(fPatBase.elementAti(patternIndex) + opValue, status);
+            break;
+        case URX_STATE_SAVE:
+        case URX_JMP_SAV:
+        case URX_JMP_SAV_X:
+            // Both branches. Where the backtracking engine declines to repeat
+            //   a loop that made no progress, the same states would be reached again.
+            fPending.push(fPatBase.elementAti(patternIndex) + opValue, status);
+            fPending.push(pos + 1, status);
+            break;
+        case URX_BACKTRACK:
+        case URX_FAIL:
+            break;
+        case URX_LOOP_SR_I:
+        case URX_LOOP_DOT_I:
+            // Zero or more iterations: Continue after the URX_LOOP_C.
+            addId(fPatToId.elementAti(pos), status);
+            fPending.push(pos + 2, status);
+            break;
+        default:
+            // An op that consumes input, or URX_END.
+            addId(fPatToId.elementAti(pos), status);
+            break;
+        }
+    }
+}
+
+// Adds the automaton states that follow the state id after consuming c.
+void RegexDFA::addNext(int32_t id, UChar32 c, UErrorCode &status) {
+    int32_t pos = fIdToPat.elementAti(id);
+    int32_t patternIndex;
+    int32_t op = getOp(pos, patternIndex);
+    const RegexPattern &pattern = *fPatterns[patternIndex];
+    switch (URX_TYPE(op)) {
+    case URX_END:
+        break;
+    case URX_STRING:
+        {
+            const UChar *s = pattern.fLiteralText.getBuffer() + URX_VAL(op);
+            int32_t length = URX_VAL(getOp(pos + 1, patternIndex));
+            int32_t offset = id - fPatToId.elementAti(pos);
+            UChar32 expected;
+            U16_NEXT(s, offset, length, expected);
+            if (c == expected) {
+                if (offset == length) {
+                    addClosure(pos + 2, status);
+                } else {
+                    addId(fPatToId.elementAti(pos) + offset, status);
+                }
+            }
+        }
+        break;
+    case URX_LOOP_SR_I:
+    case URX_LOOP_DOT_I:
+        if (matches(pattern, op, c)) {
+            addClosure(pos, status);  // another iteration, or continue after the loop
+        }
+        break;
+    default:
+        if (matches(pattern, op, c)) {
+            addClosure(pos + 1, status);
+        }
+        break;
+    }
+}
+
+// Tests c against a single-code point op, with the same results as
+// RegexMatcher::MatchAt() and MatchChunkAt().
+UBool RegexDFA::matches(const RegexPattern &pattern, int32_t op, UChar32 c) const {
+    int32_t opValue = URX_VAL(op);
+    switch (URX_TYPE(op)) {
+    case URX_ONECHAR:
+        return c == opValue;
+    case URX_ONECHAR_I:
+        return u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue;
+    case URX_SETREF:
+    case URX_LOOP_SR_I:
+        return ((const UnicodeSet *)pattern.fSets->elementAt(opValue))->contains(c);
+    case URX_STATIC_SETREF:
+        {
+            UBool negated = (opValue & URX_NEG_SET) != 0;
+            return pattern.fStaticSets[opValue & ~URX_NEG_SET]->contains(c) != negated;
+        }
+    case URX_STAT_SETREF_N:
+        return !pattern.fStaticSets[opValue]->contains(c);
+    case URX_DOTANY:
+        return !isLineTerminator(c);
+    case URX_DOTANY_UNIX:
+        return c != 0x0a;
+    case URX_LOOP_DOT_I:
+        return (opValue & 2) != 0 ? c != 0x0a : !isLineTerminator(c);
+    case URX_BACKSLASH_D:
+        return (u_charType(c) == U_DECIMAL_DIGIT_NUMBER) != (opValue != 0);
+    case URX_BACKSLASH_H:
+        return (u_charType(c) == U_SPACE_SEPARATOR || c == 9) != (opValue != 0);
+    case URX_BACKSLASH_V:
+        return isLineTerminator(c) != (opValue != 0);
+    default:
+        U_ASSERT(FALSE);
+        return FALSE;
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
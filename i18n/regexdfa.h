@@ -0,0 +1,182 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  regexdfa.h
+//  created: 2026oct14
+//
+//  This file contains declarations for the class RegexDFA, a lazily built
+//  deterministic automaton that RegexMatcher::find() uses to skip input
+//  that cannot contain a match of a simple pattern.
+//
+//  This class is internal to the regular expression implementation.
+//  For the public Regular Expression API, see the file "unicode/regex.h"
+//
+
+#ifndef REGEXDFA_H
+#define REGEXDFA_H
+
+#include "unicode/utypes.h"
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/uobject.h"
+#include "unicode/utext.h"
+#include "cmemory.h"
+#include "uhash.h"
+#include "uvectr32.h"
+
+U_NAMESPACE_BEGIN
+
+class RegexPattern;
+
+//--------------------------------------------------------------------------------
+//
+//  class RegexDFA
+//
+//  The compiled pattern of a "simple" regular expression, one without
+//  back references, look-around, anchors, atomic groups or counted loops,
+//  is read as a nondeterministic automaton: each op either consumes one
+//  code point or is an epsilon transition to one or two other ops.
+//  Sets of automaton states are combined into DFA states on demand
+//  while the input is scanned, and the transitions for code points below
+//  U+0100 are cached in the DFA states.
+//
+//  The DFA answers only whether some match ends within the input,
+//  in a single pass without backtracking. It does not know where a match
+//  begins or which of several matches the backtracking engine would find,
+//  so matches themselves are still found by RegexMatcher::MatchAt().
+//
+//  The pattern is shared by matchers on several threads, but the DFA states
+//  are not, so each RegexMatcher has its own RegexDFA.
+//
+//  A RegexDFA can also be built for several patterns at once, for RegexSet.
+//  Its states then record which of the patterns have a match ending at
+//  the current position, and searchAll() reports all patterns that match
+//  somewhere in the input in one pass.
+//
+//--------------------------------------------------------------------------------
+class RegexDFA : public UMemory {
+public:
+    enum EResult {
+        NO_MATCH,       // There is no match in the input.
+        MATCH,          // There is at least one match.
+        UNKNOWN         // The DFA grew too large, or out of memory.
+    };
+
+    /**
+     * Returns TRUE if the compiled pattern contains only ops that RegexDFA supports.
+     * Called by the pattern compiler.
+     */
+    static UBool isSupported(const RegexPattern &pattern);
+
+    /**
+     * The pattern must be supported, and must outlive the RegexDFA.
+     */
+    RegexDFA(const RegexPattern &pattern, UErrorCode &status);
+
+    /**
+     * A DFA for several patterns, with at most maxStates states.
+     * The patterns must be supported, and must outlive the RegexDFA.
+     * The array itself is copied.
+     */
+    RegexDFA(const RegexPattern *const *patterns, int32_t count, int32_t maxStates,
+             UErrorCode &status);
+    ~RegexDFA();
+
+    /**
+     * Scans the input from start up to limit for a match that begins at or after start.
+     * Stops at the end of the first match that is found.
+     */
+    EResult search(UText *input, int64_t start, int64_t limit, UErrorCode &status);
+
+    /**
+     * Same as search(), for UTF-16 text in memory.
+     */
+    EResult search(const UChar *input, int32_t start, int32_t limit, UErrorCode &status);
+
+    /**
+     * Scans the input from start up to limit and sets found[i] to TRUE for each pattern i
+     * that has a match beginning at or after start. foundCount is the number of TRUE
+     * elements in found, and is updated. Stops when all patterns have been found.
+     * @return MATCH or NO_MATCH depending on whether foundCount is positive,
+     *         or UNKNOWN if the DFA grew too large before the end of the input;
+     *         the patterns that were found up to that point are still set.
+     */
+    EResult searchAll(UText *input, int64_t start, int64_t limit,
+                      UBool *found, int32_t &foundCount, UErrorCode &status);
+
+    /**
+     * Same as searchAll(), for UTF-16 text in memory.
+     */
+    EResult searchAll(const UChar *input, int32_t start, int32_t limit,
+                      UBool *found, int32_t &foundCount, UErrorCode &status);
+
+    /**
+     * Returns the number of DFA states built so far. Each one is a heap allocation.
+     */
+    int32_t getStateCount() const { return fStateCount; }
+
+private:
+    struct State : public UMemory {
+        int32_t setStart;       // Start of the sorted automaton state set in fSetData,
+        int32_t setLength;      //   followed by the numbers of the matching patterns.
+        int32_t matchLength;
+        UBool   isMatch;        // Contains the state for the end of some pattern.
+        uint32_t recorded;      // Equal to fScanCount if searchAll() recorded its matches.
+        UChar32 lastChar;       // The most recent code point >=U+0100 seen in this state,
+        int32_t lastNext;       //   and the transition for it.
+        int32_t next[256];      // Cached transitions for code points U+0000..U+00FF.
+    };
+
+    enum {
+        UNCOMPUTED = -1,        // A transition that has not been computed yet.
+        // Limit on the memory used for DFA states of a single pattern, about 1kB each.
+        MAX_STATES = 256
+    };
+
+    void init(UErrorCode &status);
+    int32_t getOp(int32_t pos, int32_t &patternIndex) const;
+    UBool recordMatches(State *state, UBool *found, int32_t &foundCount);
+    void beginState();
+    int32_t addState(UErrorCode &status);
+    int32_t nextState(State *state, UChar32 c, UErrorCode &status);
+    void addId(int32_t id, UErrorCode &status);
+    void addClosure(int32_t patIdx, UErrorCode &status);
+    void addNext(int32_t id, UChar32 c, UErrorCode &status);
+    UBool matches(const RegexPattern &pattern, int32_t op, UChar32 c) const;
+
+    MaybeStackArray<const RegexPattern *, 1> fPatterns;
+    int32_t fPatternCount;
+
+    // The compiled patterns are numbered one after the other by "positions":
+    //   The op at index patIdx of pattern i has position fPatBase[i] + patIdx.
+    UVector32 fPatBase;             // First position of each pattern; one extra at the end.
+    UVector32 fPosToPattern;        // Pattern number for each position.
+
+    // Automaton states are numbered by "ids": one for each op that consumes input,
+    //   or one per code unit for literal strings, and one for each URX_END op.
+    UVector32 fPatToId;             // First id for each position, or -1.
+    UVector32 fIdToPat;             // Position for each id.
+    UVector32 fMatchIds;            // The id of the URX_END op of each pattern.
+
+    // Work area for computing one DFA state.
+    UVector32 fWork;                // Ids in the set under construction, unsorted.
+    UVector32 fPending;             // Pattern indexes whose closures remain to be added.
+    UVector32 fMarks;               // Per id: equal to fGeneration if in fWork.
+    UVector32 fVisited;             // Per pattern index: fGeneration if its closure was added.
+    int32_t fGeneration;
+
+    MaybeStackArray<State *, 16> fStates;   // The DFA states, owned.
+    int32_t fStateCount;
+    int32_t fMaxStates;
+    int32_t fStartState;            // Negative if the constructor failed.
+    uint32_t fScanCount;            // Number of calls to searchAll().
+    UVector32 fSetData;             // The automaton state sets of all DFA states.
+    UHashtable *fStateMap;          // Maps a state set, as a UnicodeString key, to index+1.
+
+    RegexDFA(const RegexDFA &other); // forbid copying of this class
+    RegexDFA &operator=(const RegexDFA &other); // forbid copying of this class
+};
+
+U_NAMESPACE_END
+#endif   // !UCONFIG_NO_REGULAR_EXPRESSIONS
+#endif   // REGEXDFA_H
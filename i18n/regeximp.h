@@ -52,6 +52,8 @@ U_NAMESPACE_BEGIN
 //
 //  Opcode types     In the compiled form of the regexp, these are the type, or opcodes,
 //                   of the entries.
+//                   Compiled patterns are saved by RegexPattern::toBinary():
+//                   Changes here require a new REGEX_BINARY_FORMAT_VERSION.
 //
 enum {
      URX_RESERVED_OP   = 0,    // For multi-operand ops, most non-first words.
@@ -279,6 +281,14 @@ enum {
 };
 
 
+// Test for any of the Unicode line terminating characters.
+static inline UBool isLineTerminator(UChar32 c) {
+    if (c & ~(0x0a | 0x0b | 0x0c | 0x0d | 0x85 | 0x2028 | 0x2029)) {
+        return false;
+    }
+    return (c<=0x0d && c>=0x0a) || c==0x85 || c==0x2028 || c==0x2029;
+}
+
 //
 //  Match Engine State Stack Frame Layout.
 //
@@ -317,6 +327,51 @@ enum StartOfMatch {
                                (v)==START_STRING?  "START_STRING"  : \
                                                    "ILLEGAL")
 
+//
+//  Binary form of a compiled pattern, from RegexPattern::toBinary().
+//    The header is followed by these arrays, in this order:
+//      int64_t  compiled pattern[compiledPatLength]
+//      int32_t  group map[groupMapLength]
+//      int32_t  named capture groups[2*namedCaptureCount]: number, name length
+//      Regex8BitSet sets8[setCount+1]: fSets8, then fInitialChars8
+//      UChar    pattern[patternLength], literal text[literalLength],
+//               names of the capture groups, each name's length from above
+//      uint16_t sets[setsLength]: UnicodeSet::serialize() of fSets[1..setCount-1],
+//               then of fInitialChars
+//    All in platform endianness; a pattern saved on a machine with other endianness
+//    or by another version of the format is rejected.
+//
+#define REGEX_BINARY_SIGNATURE 0x52656758   // "RegX"
+#define REGEX_BINARY_FORMAT_VERSION 1
+
+struct RegexBinaryHeader {
+    uint32_t signature;
+    int32_t  formatVersion;
+    int32_t  length;                // Of the whole binary, in bytes.
+    uint32_t flags;
+    int32_t  minMatchLen;
+    int32_t  frameSize;
+    int32_t  dataSize;
+    int32_t  startType;
+    int32_t  initialStringIdx;
+    int32_t  initialStringLen;
+    UChar32  initialChar;
+    int32_t  initialUnitsLength;
+    int32_t  initialStringDistance;
+    int32_t  needsAltInput;
+    int32_t  useDFA;
+    UChar    initialUnits[4];
+    int32_t  compiledPatLength;
+    int32_t  groupMapLength;
+    int32_t  namedCaptureCount;
+    int32_t  setCount;              // Including the reserved set zero.
+    int32_t  patternLength;
+    int32_t  literalLength;
+    int32_t  namesLength;
+    int32_t  setsLength;
+    int32_t  reserved;              // 0, for alignment of the compiled pattern.
+};
+
 //
 //  8 bit set, to fast-path latin-1 set membership tests.
 //
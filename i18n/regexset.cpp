@@ -0,0 +1,242 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  regexset.cpp
+//  created: 2026oct14
+//
+//  RegexSet: which of a number of patterns match an input, in one pass.
+//
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/localpointer.h"
+#include "unicode/regex.h"
+#include "unicode/regexset.h"
+#include "cmemory.h"
+#include "regexdfa.h"
+#include "regextxt.h"
+#include "uvector.h"
+#include "uvectr32.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Limit on the memory used for the DFA states of a set, about 1kB each.
+const int32_t MAX_SET_STATES = 2048;
+
+}  // namespace
+
+RegexSet::RegexSet(UErrorCode &status) :
+        fPatterns(NULL), fMatchers(NULL), fDFAPatterns(NULL), fDFA(NULL), fDFAFailed(FALSE) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    LocalPointer<UVector> patterns(new UVector(uprv_deleteUObject, NULL, status), status);
+    LocalPointer<UVector> matchers(new UVector(uprv_deleteUObject, NULL, status), status);
+    LocalPointer<UVector32> dfaPatterns(new UVector32(status), status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    fPatterns = patterns.orphan();
+    fMatchers = matchers.orphan();
+    fDFAPatterns = dfaPatterns.orphan();
+}
+
+RegexSet::~RegexSet() {
+    delete fDFA;
+    delete fMatchers;
+    delete fPatterns;
+    delete fDFAPatterns;
+}
+
+int32_t RegexSet::add(const UnicodeString &regex, uint32_t flags, UErrorCode &status) {
+    UParseError pe;
+    return add(regex, flags, pe, status);
+}
+
+int32_t RegexSet::add(const UnicodeString &regex, uint32_t flags, UParseError &pe,
+                      UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    if (fPatterns == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return -1;
+    }
+    LocalPointer<RegexPattern> pattern(RegexPattern::compile(regex, flags, pe, status));
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    int32_t index = fPatterns->size();
+    int32_t dfaCount = fDFAPatterns->size();
+    fMatchers->addElement((void *)NULL, status);
+    if (RegexDFA::isSupported(*pattern)) {
+        fDFAPatterns->addElement(index, status);
+    }
+    fPatterns->addElement(pattern.getAlias(), status);
+    if (U_FAILURE(status)) {
+        // Undo whichever additions succeeded.
+        if (fMatchers->size() > index) {
+            fMatchers->removeElementAt(index);
+        }
+        fDFAPatterns->setSize(dfaCount);
+        if (fPatterns->size() > index) {
+            fPatterns->orphanElementAt(index);
+        }
+        return -1;
+    }
+    pattern.orphan();
+    // The DFA is rebuilt for the new set of patterns.
+    delete fDFA;
+    fDFA = NULL;
+    fDFAFailed = FALSE;
+    return index;
+}
+
+int32_t RegexSet::size() const {
+    return fPatterns != NULL ? fPatterns->size() : 0;
+}
+
+const RegexPattern &RegexSet::getPattern(int32_t index) const {
+    return *static_cast<const RegexPattern *>(fPatterns->elementAt(index));
+}
+
+RegexMatcher *RegexSet::getMatcher(int32_t index, UErrorCode &status) {
+    RegexMatcher *matcher = static_cast<RegexMatcher *>(fMatchers->elementAt(index));
+    if (matcher == NULL && U_SUCCESS(status)) {
+        matcher = static_cast<RegexPattern *>(fPatterns->elementAt(index))->matcher(status);
+        if (U_FAILURE(status)) {
+            delete matcher;
+            return NULL;
+        }
+        fMatchers->setElementAt(matcher, index);
+    }
+    return matcher;
+}
+
+int32_t RegexSet::find(const UnicodeString &input, int32_t *dest, int32_t destCapacity,
+                       UErrorCode &status) {
+    UText text = UTEXT_INITIALIZER;
+    utext_openConstUnicodeString(&text, &input, &status);
+    int32_t count = find(&text, dest, destCapacity, status);
+    utext_close(&text);
+    return count;
+}
+
+int32_t RegexSet::find(UText *input, int32_t *dest, int32_t destCapacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (input == NULL || destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (fPatterns == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    int32_t patternCount = fPatterns->size();
+    int32_t dfaCount = fDFAPatterns->size();
+    MaybeStackArray<UBool, 64> found;
+    MaybeStackArray<UBool, 64> dfaFound;
+    if ((patternCount > found.getCapacity() && found.resize(patternCount) == NULL) ||
+            (dfaCount > dfaFound.getCapacity() && dfaFound.resize(dfaCount) == NULL)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    uprv_memset(found.getAlias(), 0, patternCount * sizeof(UBool));
+    uprv_memset(dfaFound.getAlias(), 0, dfaCount * sizeof(UBool));
+
+    // First, the patterns that the DFA supports, all in one pass.
+    UBool dfaComplete = FALSE;
+    if (dfaCount > 0 && !fDFAFailed) {
+        if (fDFA == NULL) {
+            MaybeStackArray<const RegexPattern *, 64> patterns;
+            if (dfaCount > patterns.getCapacity() && patterns.resize(dfaCount) == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return 0;
+            }
+            for (int32_t i = 0; i < dfaCount; ++i) {
+                patterns[i] = &getPattern(fDFAPatterns->elementAti(i));
+            }
+            fDFA = new RegexDFA(patterns.getAlias(), dfaCount, MAX_SET_STATES, status);
+            if (fDFA == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            }
+            if (U_FAILURE(status)) {
+                delete fDFA;
+                fDFA = NULL;
+                return 0;
+            }
+        }
+        int64_t length = utext_nativeLength(input);
+        int32_t dfaFoundCount = 0;
+        RegexDFA::EResult result;
+        if (UTEXT_FULL_TEXT_IN_CHUNK(input, length)) {
+            result = fDFA->searchAll(input->chunkContents, 0, (int32_t)length,
+                                     dfaFound.getAlias(), dfaFoundCount, status);
+        } else {
+            result = fDFA->searchAll(input, 0, length, dfaFound.getAlias(), dfaFoundCount, status);
+        }
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        if (result == RegexDFA::UNKNOWN) {
+            // The patterns interact to make too many DFA states.
+            //   Do not waste another partial pass on them.
+            fDFAFailed = TRUE;
+            delete fDFA;
+            fDFA = NULL;
+        } else {
+            dfaComplete = TRUE;
+        }
+        for (int32_t i = 0; i < dfaCount; ++i) {
+            if (dfaFound[i]) {
+                found[fDFAPatterns->elementAti(i)] = TRUE;
+            }
+        }
+    }
+
+    // Then each of the other patterns on its own.
+    int32_t dfaIndex = 0;
+    for (int32_t i = 0; i < patternCount; ++i) {
+        if (dfaIndex < dfaCount && fDFAPatterns->elementAti(dfaIndex) == i) {
+            ++dfaIndex;
+            if (dfaComplete || found[i]) {
+                continue;
+            }
+        }
+        RegexMatcher *matcher = getMatcher(i, status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        matcher->reset(input);
+        found[i] = matcher->find(status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+    }
+
+    int32_t count = 0;
+    for (int32_t i = 0; i < patternCount; ++i) {
+        if (found[i]) {
+            if (count < destCapacity) {
+                dest[count] = i;
+            }
+            ++count;
+        }
+    }
+    if (count > destCapacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(RegexSet)
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
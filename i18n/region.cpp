@@ -27,6 +27,7 @@
 #include "unicode/ures.h"
 #include "unicode/decimfmt.h"
 #include "ucln_in.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "mutex.h"
 #include "uhash.h"
@@ -66,6 +67,17 @@ static UHashtable *regionIDMap = NULL;
 static UHashtable *numericCodeMap = NULL;
 static UVector *allRegions = NULL;
 
+// Region indexes and the transitive containment of each region as a bit set:
+// containmentBits[index*containmentWordCount ...] has bit i set
+// if that region contains the region with index i anywhere in the hierarchy.
+static int32_t regionIndexLimit = 0;
+static int32_t containmentWordCount = 0;
+static const Region **regionsByIndex = NULL;
+static uint32_t *containmentBits = NULL;
+
+// getInstance() results for the two-letter codes "AA".."ZZ", NULL if not a region.
+static const Region *twoLetterRegions[26*26];
+
 static const UChar UNKNOWN_REGION_ID [] = { 0x5A, 0x5A, 0 };  /* "ZZ" */
 static const UChar OUTLYING_OCEANIA_REGION_ID [] = { 0x51, 0x4F, 0 };  /* "QO" */
 static const UChar WORLD_ID [] = { 0x30, 0x30, 0x31, 0 };  /* "001" */
@@ -371,8 +383,73 @@ void U_CALLCONV Region::loadRegionData(UErrorCode &status) {
         }
     }
 
-    // Create the availableRegions lists
+    // Assign the region indexes and compute the transitive containment bit sets.
+    int32_t indexLimit = uhash_count(newRegionIDMap.getAlias());
+    int32_t wordCount = (indexLimit + 31) / 32;
+    LocalMemory<const Region *> newRegionsByIndex;
+    LocalMemory<uint32_t> newContainmentBits;
+    if (newRegionsByIndex.allocateInsteadAndReset(indexLimit) == NULL ||
+            newContainmentBits.allocateInsteadAndReset(indexLimit * wordCount) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
     int32_t pos = UHASH_FIRST;
+    int32_t index = 0;
+    while ( const UHashElement* element = uhash_nextElement(newRegionIDMap.getAlias(),&pos)) {
+        Region *ar = (Region *)element->value.pointer;
+        ar->fIndex = index;
+        newRegionsByIndex[index++] = ar;
+    }
+    // Propagate the children's bits until nothing changes;
+    // this takes as many passes as the hierarchy is deep.
+    UBool changed;
+    do {
+        changed = FALSE;
+        for ( int32_t i = 0 ; i < indexLimit ; i++ ) {
+            const Region *parentRegion = newRegionsByIndex[i];
+            if ( parentRegion->containedRegions == NULL ) {
+                continue;
+            }
+            uint32_t *parentBits = newContainmentBits.getAlias() + i * wordCount;
+            for ( int32_t j = 0 ; j < parentRegion->containedRegions->size() ; j++ ) {
+                const Region *childRegion = (const Region *) uhash_get(newRegionIDMap.getAlias(),
+                                                                       parentRegion->containedRegions->elementAt(j));
+                if ( childRegion == NULL ) {
+                    continue;
+                }
+                const uint32_t *childBits = newContainmentBits.getAlias() + childRegion->fIndex * wordCount;
+                for ( int32_t k = 0 ; k < wordCount ; k++ ) {
+                    uint32_t bits = parentBits[k] | childBits[k];
+                    if ( k == (childRegion->fIndex >> 5) ) {
+                        bits |= (uint32_t)1 << (childRegion->fIndex & 0x1f);
+                    }
+                    if ( bits != parentBits[k] ) {
+                        parentBits[k] = bits;
+                        changed = TRUE;
+                    }
+                }
+            }
+        }
+    } while (changed);
+
+    // Resolve the two-letter codes the same way as getInstance().
+    UChar code[2];
+    for ( int32_t i = 0 ; i < 26*26 ; i++ ) {
+        code[0] = (UChar)(0x41 + i / 26);
+        code[1] = (UChar)(0x41 + i % 26);
+        UnicodeString codeString(FALSE, code, 2);
+        Region *cr = (Region *) uhash_get(newRegionIDMap.getAlias(),(void *)&codeString);
+        if ( !cr ) {
+            cr = (Region *) uhash_get(newRegionAliases.getAlias(),(void *)&codeString);
+        }
+        if ( cr && cr->fType == URGN_DEPRECATED && cr->preferredValues->size() == 1) {
+            cr = (Region *) uhash_get(newRegionIDMap.getAlias(),cr->preferredValues->elementAt(0));
+        }
+        twoLetterRegions[i] = cr;
+    }
+
+    // Create the availableRegions lists
+    pos = UHASH_FIRST;
     while ( const UHashElement* element = uhash_nextElement(newRegionIDMap.getAlias(),&pos)) {
         Region *ar = (Region *)element->value.pointer;
         if ( availableRegions[ar->fType] == NULL ) {
@@ -391,6 +468,10 @@ void U_CALLCONV Region::loadRegionData(UErrorCode &status) {
     numericCodeMap = newNumericCodeMap.orphan();
     regionIDMap = newRegionIDMap.orphan();
     regionAliases = newRegionAliases.orphan();
+    regionIndexLimit = indexLimit;
+    containmentWordCount = wordCount;
+    regionsByIndex = newRegionsByIndex.orphan();
+    containmentBits = newContainmentBits.orphan();
 }
 
 void Region::cleanupRegionData() {
@@ -419,6 +500,13 @@ void Region::cleanupRegionData() {
 
     regionAliases = numericCodeMap = regionIDMap = NULL;
 
+    uprv_free(regionsByIndex);
+    uprv_free(containmentBits);
+    regionsByIndex = NULL;
+    containmentBits = NULL;
+    regionIndexLimit = containmentWordCount = 0;
+    uprv_memset(twoLetterRegions, 0, sizeof(twoLetterRegions));
+
     gRegionDataInitOnce.reset();
 }
 
@@ -427,7 +515,8 @@ Region::Region ()
           fType(URGN_UNKNOWN),
           containingRegion(NULL),
           containedRegions(NULL),
-          preferredValues(NULL) {
+          preferredValues(NULL),
+          fIndex(-1) {
     id[0] = 0;
 }
 
@@ -477,6 +566,14 @@ Region::getInstance(const char *region_code, UErrorCode &status) {
         return NULL;
     }
 
+    if ( (uint8_t)(region_code[0] - 0x41) < 26 && (uint8_t)(region_code[1] - 0x41) < 26 && region_code[2] == 0 ) {
+        const Region *tr = twoLetterRegions[(region_code[0] - 0x41) * 26 + (region_code[1] - 0x41)];
+        if ( !tr ) { // Unknown region code
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        return tr;
+    }
+
     UnicodeString regionCodeString = UnicodeString(region_code, -1, US_INV);
     Region *r = (Region *)uhash_get(regionIDMap,(void *)&regionCodeString);
 
@@ -622,28 +719,28 @@ Region::getContainedRegions( URegionType type, UErrorCode &status ) const {
     }
 
     UVector *result = new UVector(NULL, uhash_compareChars, status);
+    appendContainedRegions(type, *result, status);
+    StringEnumeration* resultEnumeration = new RegionNameEnumeration(result,status);
+    delete result;
+    return resultEnumeration;
+}
 
-    StringEnumeration *cr = getContainedRegions(status);
-
-    for ( int32_t i = 0 ; i < cr->count(status) ; i++ ) {
-        const char *regionId = cr->next(NULL,status);
-        const Region *r = Region::getInstance(regionId,status);
-        if ( r->getType() == type) {
-            result->addElement((void *)&r->idStr,status);
+void
+Region::appendContainedRegions(URegionType type, UVector &result, UErrorCode &status) const {
+    if ( containedRegions == NULL ) {
+        return;
+    }
+    for ( int32_t i = 0 ; i < containedRegions->size() && U_SUCCESS(status) ; i++ ) {
+        const Region *r = (const Region *) uhash_get(regionIDMap,containedRegions->elementAt(i));
+        if ( r->fType == URGN_DEPRECATED && r->preferredValues->size() == 1) { // as in getInstance()
+            r = (const Region *) uhash_get(regionIDMap,r->preferredValues->elementAt(0));
+        }
+        if ( r->fType == type) {
+            result.addElement((void *)&r->idStr,status);
         } else {
-            StringEnumeration *children = r->getContainedRegions(type, status);
-            for ( int32_t j = 0 ; j < children->count(status) ; j++ ) {
-                const char *id2 = children->next(NULL,status);
-                const Region *r2 = Region::getInstance(id2,status);
-                result->addElement((void *)&r2->idStr,status);
-            }
-            delete children;
+            r->appendContainedRegions(type, result, status);
         }
     }
-    delete cr;
-    StringEnumeration* resultEnumeration = new RegionNameEnumeration(result,status);
-    delete result;
-    return resultEnumeration;
 }
 
 /**
@@ -654,22 +751,10 @@ Region::contains(const Region &other) const {
     UErrorCode status = U_ZERO_ERROR;
     umtx_initOnce(gRegionDataInitOnce, &loadRegionData, status);
 
-    if (!containedRegions) {
-          return FALSE;
-    }
-    if (containedRegions->contains((void *)&other.idStr)) {
-        return TRUE;
-    } else {
-        for ( int32_t i = 0 ; i < containedRegions->size() ; i++ ) {
-            UnicodeString *crStr = (UnicodeString *)containedRegions->elementAt(i);
-            Region *cr = (Region *) uhash_get(regionIDMap,(void *)crStr);
-            if ( cr && cr->contains(other) ) {
-                return TRUE;
-            }
-        }
+    if (U_FAILURE(status)) {
+        return FALSE;
     }
-
-    return FALSE;
+    return containsIndex(fIndex, other.fIndex);
 }
 
 /**
@@ -708,6 +793,50 @@ Region::getType() const {
     return fType;
 }
 
+int32_t
+Region::getIndex() const {
+    return fIndex;
+}
+
+int32_t U_EXPORT2
+Region::getIndexLimit(UErrorCode &status) {
+    umtx_initOnce(gRegionDataInitOnce, &loadRegionData, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    return regionIndexLimit;
+}
+
+const Region* U_EXPORT2
+Region::getInstanceByIndex(int32_t index, UErrorCode &status) {
+    umtx_initOnce(gRegionDataInitOnce, &loadRegionData, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    if ( index < 0 || index >= regionIndexLimit ) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    return regionsByIndex[index];
+}
+
+/**
+ * Returns true if the region with index containerIndex contains the region with index regionIndex
+ * anywhere in the region hierarchy.
+ */
+UBool U_EXPORT2
+Region::containsIndex(int32_t containerIndex, int32_t regionIndex) {
+    UErrorCode status = U_ZERO_ERROR;
+    umtx_initOnce(gRegionDataInitOnce, &loadRegionData, status);
+    if ( U_FAILURE(status) ||
+            (uint32_t)containerIndex >= (uint32_t)regionIndexLimit ||
+            (uint32_t)regionIndex >= (uint32_t)regionIndexLimit ) {
+        return FALSE;
+    }
+    return (containmentBits[containerIndex * containmentWordCount + (regionIndex >> 5)] >>
+            (regionIndex & 0x1f)) & 1;
+}
+
 RegionNameEnumeration::RegionNameEnumeration(UVector *fNameList, UErrorCode& status) {
     pos=0;
     if (fNameList && U_SUCCESS(status)) {
@@ -48,6 +48,13 @@ static UMutex gBrkIterMutex = U_MUTEX_INITIALIZER;
 
 U_NAMESPACE_BEGIN
 
+// A relative unit pattern with a single argument, split around it so that
+// an integer can be formatted directly between the two parts.
+struct RelativeUnitAffixes : public UMemory {
+    UnicodeString prefix;
+    UnicodeString suffix;
+};
+
 // RelativeDateTimeFormatter specific data for a single locale
 class RelativeDateTimeCacheData: public SharedObject {
 public:
@@ -58,6 +65,8 @@ class RelativeDateTimeCacheData: public SharedObject {
                 for (int32_t pl = 0; pl < StandardPlural::COUNT; ++pl) {
                     relativeUnitsFormatters[style][relUnit][0][pl] = nullptr;
                     relativeUnitsFormatters[style][relUnit][1][pl] = nullptr;
+                    relativeUnitsAffixes[style][relUnit][0][pl] = nullptr;
+                    relativeUnitsAffixes[style][relUnit][1][pl] = nullptr;
                 }
             }
         }
@@ -76,6 +85,14 @@ class RelativeDateTimeCacheData: public SharedObject {
     SimpleFormatter *relativeUnitsFormatters[UDAT_STYLE_COUNT]
         [UDAT_REL_UNIT_COUNT][2][StandardPlural::COUNT];
 
+    // The relativeUnitsFormatters split into prefix and suffix,
+    // nullptr where a pattern does not have exactly one argument.
+    RelativeUnitAffixes *relativeUnitsAffixes[UDAT_STYLE_COUNT]
+        [UDAT_REL_UNIT_COUNT][2][StandardPlural::COUNT];
+
+    // Fills in relativeUnitsAffixes once all formatters are loaded.
+    void splitRelativeUnitFormatters(UErrorCode &status);
+
     const UnicodeString& getAbsoluteUnitString(int32_t fStyle,
                                                UDateAbsoluteUnit unit,
                                                UDateDirection direction) const;
@@ -87,6 +104,11 @@ class RelativeDateTimeCacheData: public SharedObject {
                                                     URelativeDateTimeUnit unit,
                                                     int32_t pastFutureIndex,
                                                     int32_t pluralUnit) const;
+    // Same style fallback as getRelativeDateTimeUnitFormatter().
+    const RelativeUnitAffixes* getRelativeDateTimeUnitAffixes(int32_t fStyle,
+                                                    URelativeDateTimeUnit unit,
+                                                    int32_t pastFutureIndex,
+                                                    int32_t pluralUnit) const;
 
     const UnicodeString emptyString;
 
@@ -115,6 +137,8 @@ RelativeDateTimeCacheData::~RelativeDateTimeCacheData() {
             for (int32_t pl = 0; pl < StandardPlural::COUNT; ++pl) {
                 delete relativeUnitsFormatters[style][relUnit][0][pl];
                 delete relativeUnitsFormatters[style][relUnit][1][pl];
+                delete relativeUnitsAffixes[style][relUnit][0][pl];
+                delete relativeUnitsAffixes[style][relUnit][1][pl];
             }
         }
     }
@@ -135,22 +159,30 @@ const UnicodeString& RelativeDateTimeCacheData::getAbsoluteUnitString(
     return emptyString;
 }
 
+// Maps a UDateRelativeUnit to its URelativeDateTimeUnit,
+// or to UDAT_REL_UNIT_COUNT if there is none.
+static URelativeDateTimeUnit relativeDateTimeUnitFrom(UDateRelativeUnit unit) {
+   switch (unit) {
+       case UDAT_RELATIVE_YEARS:   return UDAT_REL_UNIT_YEAR;
+       case UDAT_RELATIVE_MONTHS:  return UDAT_REL_UNIT_MONTH;
+       case UDAT_RELATIVE_WEEKS:   return UDAT_REL_UNIT_WEEK;
+       case UDAT_RELATIVE_DAYS:    return UDAT_REL_UNIT_DAY;
+       case UDAT_RELATIVE_HOURS:   return UDAT_REL_UNIT_HOUR;
+       case UDAT_RELATIVE_MINUTES: return UDAT_REL_UNIT_MINUTE;
+       case UDAT_RELATIVE_SECONDS: return UDAT_REL_UNIT_SECOND;
+       default: // a unit that the above method does not handle
+            return UDAT_REL_UNIT_COUNT;
+   }
+}
+
  const SimpleFormatter* RelativeDateTimeCacheData::getRelativeUnitFormatter(
         int32_t fStyle,
         UDateRelativeUnit unit,
         int32_t pastFutureIndex,
         int32_t pluralUnit) const {
-   URelativeDateTimeUnit rdtunit = UDAT_REL_UNIT_COUNT;
-   switch (unit) {
-       case UDAT_RELATIVE_YEARS:   rdtunit = UDAT_REL_UNIT_YEAR; break;
-       case UDAT_RELATIVE_MONTHS:  rdtunit = UDAT_REL_UNIT_MONTH; break;
-       case UDAT_RELATIVE_WEEKS:   rdtunit = UDAT_REL_UNIT_WEEK; break;
-       case UDAT_RELATIVE_DAYS:    rdtunit = UDAT_REL_UNIT_DAY; break;
-       case UDAT_RELATIVE_HOURS:   rdtunit = UDAT_REL_UNIT_HOUR; break;
-       case UDAT_RELATIVE_MINUTES: rdtunit = UDAT_REL_UNIT_MINUTE; break;
-       case UDAT_RELATIVE_SECONDS: rdtunit = UDAT_REL_UNIT_SECOND; break;
-       default: // a unit that the above method does not handle
-            return nullptr;
+   URelativeDateTimeUnit rdtunit = relativeDateTimeUnitFrom(unit);
+   if (rdtunit == UDAT_REL_UNIT_COUNT) {
+       return nullptr;
    }
 
    return getRelativeDateTimeUnitFormatter(fStyle, rdtunit, pastFutureIndex, pluralUnit);
@@ -172,6 +204,58 @@ const UnicodeString& RelativeDateTimeCacheData::getAbsoluteUnitString(
     return nullptr;  // No formatter found.
  }
 
+const RelativeUnitAffixes* RelativeDateTimeCacheData::getRelativeDateTimeUnitAffixes(
+        int32_t fStyle,
+        URelativeDateTimeUnit unit,
+        int32_t pastFutureIndex,
+        int32_t pluralUnit) const {
+    int32_t style = fStyle;
+    do {
+        if (relativeUnitsFormatters[style][unit][pastFutureIndex][pluralUnit] != nullptr) {
+            return relativeUnitsAffixes[style][unit][pastFutureIndex][pluralUnit];
+        }
+        style = fallBackCache[style];
+    } while (style != -1);
+    return nullptr;
+}
+
+void RelativeDateTimeCacheData::splitRelativeUnitFormatters(UErrorCode &status) {
+    // Format each pattern with a noncharacter as the argument
+    // and split the result where that single noncharacter ended up.
+    static const UChar marker = 0xffff;
+    const UnicodeString markerString(marker);
+    for (int32_t style = 0; style < UDAT_STYLE_COUNT; ++style) {
+        for (int32_t relUnit = 0; relUnit < UDAT_REL_UNIT_COUNT; ++relUnit) {
+            for (int32_t pastFuture = 0; pastFuture < 2; ++pastFuture) {
+                for (int32_t pl = 0; pl < StandardPlural::COUNT; ++pl) {
+                    const SimpleFormatter *formatter =
+                        relativeUnitsFormatters[style][relUnit][pastFuture][pl];
+                    if (formatter == nullptr || formatter->getArgumentLimit() != 1) {
+                        continue;
+                    }
+                    UnicodeString text;
+                    formatter->format(markerString, text, status);
+                    if (U_FAILURE(status)) {
+                        return;
+                    }
+                    int32_t index = text.indexOf(marker);
+                    if (index < 0 || text.indexOf(marker, index + 1) >= 0) {
+                        continue;
+                    }
+                    RelativeUnitAffixes *affixes = new RelativeUnitAffixes();
+                    if (affixes == nullptr) {
+                        status = U_MEMORY_ALLOCATION_ERROR;
+                        return;
+                    }
+                    affixes->prefix.setTo(text, 0, index);
+                    affixes->suffix.setTo(text, index + 1);
+                    relativeUnitsAffixes[style][relUnit][pastFuture][pl] = affixes;
+                }
+            }
+        }
+    }
+}
+
 static UBool getStringWithFallback(
         const UResourceBundle *resource,
         const char *key,
@@ -697,6 +781,10 @@ const RelativeDateTimeCacheData *LocaleCacheKey<RelativeDateTimeCacheData>::crea
             status)) {
         return nullptr;
     }
+    result->splitRelativeUnitFormatters(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
     UnicodeString dateTimePattern;
     if (!getDateTimePattern(topLevel.getAlias(), dateTimePattern, status)) {
         return nullptr;
@@ -845,6 +933,11 @@ UnicodeString& RelativeDateTimeFormatter::format(
         return appendTo;
     }
     int32_t bFuture = direction == UDAT_DIRECTION_NEXT ? 1 : 0;
+    URelativeDateTimeUnit rdtunit = relativeDateTimeUnitFrom(unit);
+    if (rdtunit != UDAT_REL_UNIT_COUNT &&
+            formatIntegerFast(quantity, rdtunit, bFuture, appendTo)) {
+        return appendTo;
+    }
     FieldPosition pos(FieldPosition::DONT_CARE);
 
     UnicodeString result;
@@ -882,6 +975,9 @@ UnicodeString& RelativeDateTimeFormatter::formatNumeric(
         return appendTo;
     }
     int32_t bFuture = direction == UDAT_DIRECTION_NEXT ? 1 : 0;
+    if (formatIntegerFast(offset, unit, bFuture, appendTo)) {
+        return appendTo;
+    }
     FieldPosition pos(FieldPosition::DONT_CARE);
 
     UnicodeString result;
@@ -903,6 +999,41 @@ UnicodeString& RelativeDateTimeFormatter::formatNumeric(
     return appendTo.append(result);
 }
 
+UBool RelativeDateTimeFormatter::formatIntegerFast(
+        double quantity, URelativeDateTimeUnit unit, int32_t bFuture,
+        UnicodeString& appendTo) const {
+    // Capitalization looks at the whole result, and -0.0 formats as "-0".
+    if (fOptBreakIterator != nullptr || !(quantity >= 0 && quantity <= INT32_MAX) ||
+            std::signbit(quantity)) {
+        return FALSE;
+    }
+    int32_t number = static_cast<int32_t>(quantity);
+    if (number != quantity) {
+        return FALSE;
+    }
+    // Without fraction digits or rounding, the plural form of the formatted
+    // number is that of the integer itself.
+    const DecimalFormat *decFmt = dynamic_cast<const DecimalFormat *>(&**fNumberFormat);
+    if (decFmt == nullptr) {
+        return FALSE;
+    }
+    StandardPlural::Form pluralIndex =
+        StandardPlural::orOtherFromString((*fPluralRules)->select(number));
+    const RelativeUnitAffixes *affixes =
+        fCache->getRelativeDateTimeUnitAffixes(fStyle, unit, bFuture, pluralIndex);
+    if (affixes == nullptr) {
+        return FALSE;
+    }
+    int32_t start = appendTo.length();
+    appendTo.append(affixes->prefix);
+    if (!decFmt->formatIntegerFast(number, appendTo)) {
+        appendTo.truncate(start);
+        return FALSE;
+    }
+    appendTo.append(affixes->suffix);
+    return TRUE;
+}
+
 UnicodeString& RelativeDateTimeFormatter::format(
         UDateDirection direction, UDateAbsoluteUnit unit,
         UnicodeString& appendTo, UErrorCode& status) const {
@@ -23,16 +23,19 @@
 #include "unicode/rbbi.h"
 #include "unicode/utf.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "uassert.h"
 #include "cmemory.h"
 #include "cstr.h"
 #include "uvector.h"
 #include "uvectr32.h"
 #include "uvectr64.h"
+#include "regexdfa.h"
 #include "regeximp.h"
 #include "regexst.h"
 #include "regextxt.h"
 #include "ucase.h"
+#include "usimd.h"
 
 // #include <malloc.h>        // Needed for heapcheck testing
 
@@ -54,14 +57,6 @@ static const int32_t DEFAULT_BACKTRACK_STACK_CAPACITY = 8000000;
 static const int32_t TIMER_INITIAL_VALUE = 10000;
 
 
-// Test for any of the Unicode line terminating characters.
-static inline UBool isLineTerminator(UChar32 c) {
-    if (c & ~(0x0a | 0x0b | 0x0c | 0x0d | 0x85 | 0x2028 | 0x2029)) {
-        return false;
-    }
-    return (c<=0x0d && c>=0x0a) || c==0x85 || c==0x2028 || c==0x2029;
-}
-
 //-----------------------------------------------------------------------------
 //
 //   Constructor and Destructor
@@ -178,6 +173,7 @@ RegexMatcher::~RegexMatcher() {
     #if UCONFIG_NO_BREAK_ITERATION==0
     delete fWordBreakItr;
     #endif
+    delete fDFA;
 }
 
 //
@@ -214,6 +210,8 @@ void RegexMatcher::init(UErrorCode &status) {
     fTime              = 0;
     fTickCounter       = 0;
     fStackLimit        = DEFAULT_BACKTRACK_STACK_CAPACITY;
+    fStackArena        = FALSE;
+    fAllocationCount   = 0;
     fCallbackFn        = NULL;
     fCallbackContext   = NULL;
     fFindProgressCallbackFn      = NULL;
@@ -222,12 +220,14 @@ void RegexMatcher::init(UErrorCode &status) {
     fDeferredStatus    = status;
     fData              = fSmallData;
     fWordBreakItr      = NULL;
+    fDFA               = NULL;
 
     fStack             = NULL;
     fInputText         = NULL;
     fAltInputText      = NULL;
     fInput             = NULL;
     fInputLength       = 0;
+    fInputUTF8         = NULL;
     fInputUniStrMaybeMutable = FALSE;
 }
 
@@ -236,6 +236,7 @@ void RegexMatcher::init(UErrorCode &status) {
 //            This handles the common setup to be done after the Pattern is available.
 //
 void RegexMatcher::init2(UText *input, UErrorCode &status) {
+    MemoryTagScope memoryTag(UMEM_TAG_REGEX);
     if (U_FAILURE(status)) {
         fDeferredStatus = status;
         return;
@@ -638,6 +639,9 @@ UBool RegexMatcher::find(UErrorCode &status) {
     if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
         return findUsingChunk(status);
     }
+    if (fInputUTF8 != NULL) {
+        return findUsingUTF8(status);
+    }
 
     int64_t startPos = fMatchEnd;
     if (startPos==0) {
@@ -689,6 +693,10 @@ UBool RegexMatcher::find(UErrorCode &status) {
         testStartLimit = fActiveLimit - (fPattern->fMinMatchLen > 0 ? 1 : 0);
     }
 
+    if (noMatchUsingDFA(startPos, status) || U_FAILURE(status)) {
+        return FALSE;
+    }
+
     UChar32  c;
     U_ASSERT(startPos >= 0);
 
@@ -737,8 +745,18 @@ UBool RegexMatcher::find(UErrorCode &status) {
         {
             // Match may start on any char from a pre-computed set.
             U_ASSERT(fPattern->fMinMatchLen > 0);
+            UBool scan = fPattern->fInitialUnitsLength > 0 && fFindProgressCallbackFn == NULL;
             UTEXT_SETNATIVEINDEX(fInputText, startPos);
             for (;;) {
+                if (scan) {
+                    skipToInitialUnit(fActiveLimit);
+                    startPos = UTEXT_GETNATIVEINDEX(fInputText);
+                    if (startPos > testStartLimit) {
+                        fMatch = FALSE;
+                        fHitEnd = TRUE;
+                        return FALSE;
+                    }
+                }
                 int64_t pos = startPos;
                 c = UTEXT_NEXT32(fInputText);
                 startPos = UTEXT_GETNATIVEINDEX(fInputText);
@@ -754,7 +772,7 @@ UBool RegexMatcher::find(UErrorCode &status) {
                     if (fMatch) {
                         return TRUE;
                     }
-                    UTEXT_SETNATIVEINDEX(fInputText, pos);
+                    UTEXT_SETNATIVEINDEX(fInputText, startPos);
                 }
                 if (startPos > testStartLimit) {
                     fMatch = FALSE;
@@ -773,8 +791,18 @@ UBool RegexMatcher::find(UErrorCode &status) {
             // Match starts on exactly one char.
             U_ASSERT(fPattern->fMinMatchLen > 0);
             UChar32 theChar = fPattern->fInitialChar;
+            UBool scan = fPattern->fInitialUnitsLength > 0 && fFindProgressCallbackFn == NULL;
             UTEXT_SETNATIVEINDEX(fInputText, startPos);
             for (;;) {
+                if (scan) {
+                    skipToInitialUnit(fActiveLimit);
+                    startPos = UTEXT_GETNATIVEINDEX(fInputText);
+                    if (startPos > testStartLimit) {
+                        fMatch = FALSE;
+                        fHitEnd = TRUE;
+                        return FALSE;
+                    }
+                }
                 int64_t pos = startPos;
                 c = UTEXT_NEXT32(fInputText);
                 startPos = UTEXT_GETNATIVEINDEX(fInputText);
@@ -911,6 +939,75 @@ UBool RegexMatcher::find(int64_t start, UErrorCode &status) {
 }
 
 
+//--------------------------------------------------------------------------------
+//
+//   noMatchUsingDFA() -- for simple patterns, scan the rest of the input once,
+//                        without backtracking, for whether it contains any match.
+//                        Most of the input to a typical find() loop does not,
+//                        and trying a match at each position costs much more.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::noMatchUsingDFA(int64_t startPos, UErrorCode &status) {
+    if (!fPattern->fUseDFA || fFindProgressCallbackFn != NULL || fCallbackFn != NULL) {
+        // A find progress callback expects to be called for each position,
+        //   and a match progress callback for the matching steps.
+        return FALSE;
+    }
+    int32_t stateCount = 0;
+    if (fDFA == NULL) {
+        fDFA = new RegexDFA(*fPattern, status);
+        if (fDFA == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+        ++fAllocationCount;
+    } else {
+        stateCount = fDFA->getStateCount();
+    }
+    RegexDFA::EResult result;
+    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+        result = fDFA->search(fInputText->chunkContents, (int32_t)startPos, (int32_t)fActiveLimit,
+                              status);
+    } else {
+        result = fDFA->search(fInputText, startPos, fActiveLimit, status);
+    }
+    fAllocationCount += fDFA->getStateCount() - stateCount;
+    if (result != RegexDFA::NO_MATCH) {
+        return FALSE;
+    }
+    fMatch = FALSE;
+    fHitEnd = TRUE;
+    return TRUE;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   skipToInitialUnit() -- for find() with UText input that is not all in one chunk,
+//                          for example UTF-8. Moves the input position forward to the
+//                          next code unit in fPattern->fInitialUnits, scanning the
+//                          UTF-16 chunks several units at a time, or to the end of
+//                          the chunk containing the limit if there is none.
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::skipToInitialUnit(int64_t limit) {
+    for (;;) {
+        int32_t offset = fInputText->chunkOffset;
+        int32_t length = fInputText->chunkLength;
+        offset += uprv_findUChars(fInputText->chunkContents + offset, length - offset,
+                                  fPattern->fInitialUnits, fPattern->fInitialUnitsLength);
+        fInputText->chunkOffset = offset;
+        if (offset < length || fInputText->chunkNativeLimit >= limit) {
+            return;
+        }
+        // Access the next chunk.
+        if (UTEXT_CURRENT32(fInputText) < 0) {
+            return;
+        }
+    }
+}
+
+
 //--------------------------------------------------------------------------------
 //
 //   findUsingChunk() -- like find(), but with the advance knowledge that the
@@ -966,6 +1063,10 @@ UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
         return FALSE;
     }
 
+    if (noMatchUsingDFA(startPos, status) || U_FAILURE(status)) {
+        return FALSE;
+    }
+
     UChar32  c;
     U_ASSERT(startPos >= 0);
 
@@ -1012,7 +1113,18 @@ UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
     {
         // Match may start on any char from a pre-computed set.
         U_ASSERT(fPattern->fMinMatchLen > 0);
+        UBool scan = fPattern->fInitialUnitsLength > 0 && fFindProgressCallbackFn == NULL;
         for (;;) {
+            if (scan) {
+                // Skip the positions that cannot start a match, several at a time.
+                startPos += uprv_findUChars(inputBuf + startPos, fActiveLimit - startPos,
+                                            fPattern->fInitialUnits, fPattern->fInitialUnitsLength);
+                if (startPos > testLen) {
+                    fMatch = FALSE;
+                    fHitEnd = TRUE;
+                    return FALSE;
+                }
+            }
             int32_t pos = startPos;
             U16_NEXT(inputBuf, startPos, fActiveLimit, c);  // like c = inputBuf[startPos++];
             if ((c<256 && fPattern->fInitialChars8->contains(c)) ||
@@ -1042,7 +1154,26 @@ UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
         // Match starts on exactly one char.
         U_ASSERT(fPattern->fMinMatchLen > 0);
         UChar32 theChar = fPattern->fInitialChar;
+        UBool scan = fPattern->fInitialUnitsLength > 0 && fFindProgressCallbackFn == NULL;
+        // For a literal string, look for its first and last code units together.
+        int32_t distance = fPattern->fInitialStringDistance;
+        const UChar *literal = fPattern->fLiteralText.getBuffer() + fPattern->fInitialStringIdx;
         for (;;) {
+            if (scan) {
+                // Skip the positions that cannot start a match, several at a time.
+                if (distance > 0) {
+                    startPos += uprv_findUCharPair(inputBuf + startPos, fActiveLimit - startPos,
+                                                   literal[0], literal[distance], distance);
+                } else {
+                    startPos += uprv_findUChars(inputBuf + startPos, fActiveLimit - startPos,
+                                                fPattern->fInitialUnits, 1);
+                }
+                if (startPos > testLen) {
+                    fMatch = FALSE;
+                    fHitEnd = TRUE;
+                    return FALSE;
+                }
+            }
             int32_t pos = startPos;
             U16_NEXT(inputBuf, startPos, fActiveLimit, c);  // like c = inputBuf[startPos++];
             if (c == theChar) {
@@ -1145,287 +1276,608 @@ UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
 
 //--------------------------------------------------------------------------------
 //
-//  group()
+//   Code point access for findUsingUTF8() and MatchUTF8At(), with the same results
+//   as the UText functions for a UTF-8 UText: U+FFFD for each ill-formed sequence,
+//   and U_SENTINEL before the start or at the end of the text.
 //
 //--------------------------------------------------------------------------------
-UnicodeString RegexMatcher::group(UErrorCode &status) const {
-    return group(0, status);
+static inline UChar32 utf8Next(const uint8_t *s, int64_t &i, int64_t length) {
+    if (i >= length) {
+        return U_SENTINEL;
+    }
+    UChar32 c;
+    U8_NEXT_OR_FFFD(s, i, length, c);
+    return c;
 }
 
-//  Return immutable shallow clone
-UText *RegexMatcher::group(UText *dest, int64_t &group_len, UErrorCode &status) const {
-    return group(0, dest, group_len, status);
+static inline UChar32 utf8Current(const uint8_t *s, int64_t i, int64_t length) {
+    return utf8Next(s, i, length);
 }
 
-//  Return immutable shallow clone
-UText *RegexMatcher::group(int32_t groupNum, UText *dest, int64_t &group_len, UErrorCode &status) const {
-    group_len = 0;
-    if (U_FAILURE(status)) {
-        return dest;
-    }
-    if (U_FAILURE(fDeferredStatus)) {
-        status = fDeferredStatus;
-    } else if (fMatch == FALSE) {
-        status = U_REGEX_INVALID_STATE;
-    } else if (groupNum < 0 || groupNum > fPattern->fGroupMap->size()) {
-        status = U_INDEX_OUTOFBOUNDS_ERROR;
-    }
-
-    if (U_FAILURE(status)) {
-        return dest;
-    }
-
-    int64_t s, e;
-    if (groupNum == 0) {
-        s = fMatchStart;
-        e = fMatchEnd;
-    } else {
-        int32_t groupOffset = fPattern->fGroupMap->elementAti(groupNum-1);
-        U_ASSERT(groupOffset < fPattern->fFrameSize);
-        U_ASSERT(groupOffset >= 0);
-        s = fFrame->fExtra[groupOffset];
-        e = fFrame->fExtra[groupOffset+1];
-    }
-
-    if (s < 0) {
-        // A capture group wasn't part of the match
-        return utext_clone(dest, fInputText, FALSE, TRUE, &status);
+static inline UChar32 utf8Previous(const uint8_t *s, int64_t &i) {
+    if (i <= 0) {
+        return U_SENTINEL;
     }
-    U_ASSERT(s <= e);
-    group_len = e - s;
-
-    dest = utext_clone(dest, fInputText, FALSE, TRUE, &status);
-    if (dest)
-        UTEXT_SETNATIVEINDEX(dest, s);
-    return dest;
+    int32_t j = (int32_t)i;
+    UChar32 c;
+    U8_PREV_OR_FFFD(s, 0, j, c);
+    i = j;
+    return c;
 }
 
-UnicodeString RegexMatcher::group(int32_t groupNum, UErrorCode &status) const {
-    UnicodeString result;
-    int64_t groupStart = start64(groupNum, status);
-    int64_t groupEnd = end64(groupNum, status);
-    if (U_FAILURE(status) || groupStart == -1 || groupStart == groupEnd) {
-        return result;
-    }
-
-    // Get the group length using a utext_extract preflight.
-    //    UText is actually pretty efficient at this when underlying encoding is UTF-16.
-    int32_t length = utext_extract(fInputText, groupStart, groupEnd, NULL, 0, &status);
-    if (status != U_BUFFER_OVERFLOW_ERROR) {
-        return result;
+// Like utext_setNativeIndex(): Moves i back to the start of a code point if it is inside one.
+static inline int64_t utf8Boundary(const uint8_t *s, int64_t i, int64_t length) {
+    if (i <= 0) {
+        return 0;
     }
-
-    status = U_ZERO_ERROR;
-    UChar *buf = result.getBuffer(length);
-    if (buf == NULL) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-    } else {
-        int32_t extractLength = utext_extract(fInputText, groupStart, groupEnd, buf, length, &status);
-        result.releaseBuffer(extractLength);
-        U_ASSERT(length == extractLength);
+    if (i >= length) {
+        return length;
     }
-    return result;
+    int32_t j = (int32_t)i;
+    U8_SET_CP_START(s, 0, j);
+    return j;
 }
 
 
 //--------------------------------------------------------------------------------
 //
-//  appendGroup() -- currently internal only, appends a group to a UText rather
-//                   than replacing its contents
+//   findUsingUTF8() -- like find(), but for UTF-8 input in memory,
+//                      which is read directly instead of through the UText.
 //
 //--------------------------------------------------------------------------------
+UBool RegexMatcher::findUsingUTF8(UErrorCode &status) {
+    const uint8_t *inputBuf = fInputUTF8;
+    const int64_t inputLength = fInputLength;
+    int64_t textIdx;    // Where UTF-8 code points are read.
 
-int64_t RegexMatcher::appendGroup(int32_t groupNum, UText *dest, UErrorCode &status) const {
-    if (U_FAILURE(status)) {
-        return 0;
-    }
-    if (U_FAILURE(fDeferredStatus)) {
-        status = fDeferredStatus;
-        return 0;
+    // Start at the position of the last match end.  (Will be zero if the
+    //   matcher has been reset.)
+    //
+    int64_t startPos = fMatchEnd;
+    if (startPos==0) {
+        startPos = fActiveStart;
     }
-    int64_t destLen = utext_nativeLength(dest);
 
-    if (fMatch == FALSE) {
-        status = U_REGEX_INVALID_STATE;
-        return utext_replace(dest, destLen, destLen, NULL, 0, &status);
-    }
-    if (groupNum < 0 || groupNum > fPattern->fGroupMap->size()) {
-        status = U_INDEX_OUTOFBOUNDS_ERROR;
-        return utext_replace(dest, destLen, destLen, NULL, 0, &status);
-    }
+    if (fMatch) {
+        // Save the position of any previous successful match.
+        fLastMatchEnd = fMatchEnd;
 
-    int64_t s, e;
-    if (groupNum == 0) {
-        s = fMatchStart;
-        e = fMatchEnd;
+        if (fMatchStart == fMatchEnd) {
+            // Previous match had zero length.  Move start position up one position
+            //  to avoid sending find() into a loop on zero-length matches.
+            if (startPos >= fActiveLimit) {
+                fMatch = FALSE;
+                fHitEnd = TRUE;
+                return FALSE;
+            }
+            textIdx = startPos;
+            (void)utf8Next(inputBuf, textIdx, inputLength);
+            startPos = textIdx;
+        }
     } else {
-        int32_t groupOffset = fPattern->fGroupMap->elementAti(groupNum-1);
-        U_ASSERT(groupOffset < fPattern->fFrameSize);
-        U_ASSERT(groupOffset >= 0);
-        s = fFrame->fExtra[groupOffset];
-        e = fFrame->fExtra[groupOffset+1];
+        if (fLastMatchEnd >= 0) {
+            // A previous find() failed to match.  Don't try again.
+            //   (without this test, a pattern with a zero-length match
+            //    could match again at the end of an input string.)
+            fHitEnd = TRUE;
+            return FALSE;
+        }
     }
 
-    if (s < 0) {
-        // A capture group wasn't part of the match
-        return utext_replace(dest, destLen, destLen, NULL, 0, &status);
-    }
-    U_ASSERT(s <= e);
 
-    int64_t deltaLen;
-    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
-        U_ASSERT(e <= fInputLength);
-        deltaLen = utext_replace(dest, destLen, destLen, fInputText->chunkContents+s, (int32_t)(e-s), &status);
-    } else {
-        int32_t len16;
-        if (UTEXT_USES_U16(fInputText)) {
-            len16 = (int32_t)(e-s);
-        } else {
-            UErrorCode lengthStatus = U_ZERO_ERROR;
-            len16 = utext_extract(fInputText, s, e, NULL, 0, &lengthStatus);
-        }
-        UChar *groupChars = (UChar *)uprv_malloc(sizeof(UChar)*(len16+1));
-        if (groupChars == NULL) {
-            status = U_MEMORY_ALLOCATION_ERROR;
-            return 0;
-        }
-        utext_extract(fInputText, s, e, groupChars, len16+1, &status);
+    // Compute the position in the input string beyond which a match can not begin, because
+    //   the minimum length match would extend past the end of the input.
+    //   Note:  some patterns that cannot match anything will have fMinMatchLength==Max Int.
+    //          Be aware of possible overflows if making changes here.
+    // We don't know exactly how long the minimum match length is in bytes.
+    // Treat anything > 0 as 1.
+    int64_t testStartLimit = fActiveLimit - (fPattern->fMinMatchLen > 0 ? 1 : 0);
 
-        deltaLen = utext_replace(dest, destLen, destLen, groupChars, len16, &status);
-        uprv_free(groupChars);
+    if (noMatchUsingDFA(startPos, status) || U_FAILURE(status)) {
+        return FALSE;
     }
-    return deltaLen;
-}
-
 
+    UChar32  c;
+    U_ASSERT(startPos >= 0);
 
-//--------------------------------------------------------------------------------
-//
-//  groupCount()
-//
-//--------------------------------------------------------------------------------
-int32_t RegexMatcher::groupCount() const {
-    return fPattern->fGroupMap->size();
-}
+    switch (fPattern->fStartType) {
+    case START_NO_INFO:
+        // No optimization was found.
+        //  Try a match at each input position.
+        for (;;) {
+            MatchUTF8At(startPos, FALSE, status);
+            if (U_FAILURE(status)) {
+                return FALSE;
+            }
+            if (fMatch) {
+                return TRUE;
+            }
+            if (startPos >= testStartLimit) {
+                fHitEnd = TRUE;
+                return FALSE;
+            }
+            textIdx = startPos;
+            (void)utf8Next(inputBuf, textIdx, inputLength);
+            startPos = textIdx;
+            // Note that it's perfectly OK for a pattern to have a zero-length
+            //   match at the end of a string, so we must make sure that the loop
+            //   runs with startPos == testStartLimit the last time through.
+            if  (findProgressInterrupt(startPos, status))
+                return FALSE;
+        }
+        U_ASSERT(FALSE);
 
-//--------------------------------------------------------------------------------
-//
-//  hasAnchoringBounds()
-//
-//--------------------------------------------------------------------------------
-UBool RegexMatcher::hasAnchoringBounds() const {
-    return fAnchoringBounds;
-}
-
-
-//--------------------------------------------------------------------------------
-//
-//  hasTransparentBounds()
-//
-//--------------------------------------------------------------------------------
-UBool RegexMatcher::hasTransparentBounds() const {
-    return fTransparentBounds;
-}
+    case START_START:
+        // Matches are only possible at the start of the input string
+        //   (pattern begins with ^ or \A)
+        if (startPos > fActiveStart) {
+            fMatch = FALSE;
+            return FALSE;
+        }
+        MatchUTF8At(startPos, FALSE, status);
+        if (U_FAILURE(status)) {
+            return FALSE;
+        }
+        return fMatch;
 
 
+    case START_SET:
+        {
+            // Match may start on any char from a pre-computed set.
+            U_ASSERT(fPattern->fMinMatchLen > 0);
+            textIdx = startPos;
+            for (;;) {
+                int64_t pos = startPos;
+                c = utf8Next(inputBuf, textIdx, inputLength);
+                startPos = textIdx;
+                // c will be -1 (U_SENTINEL) at end of text, in which case we
+                // skip this next block (so we don't have a negative array index)
+                // and handle end of text in the following block.
+                if (c >= 0 && ((c<256 && fPattern->fInitialChars8->contains(c)) ||
+                              (c>=256 && fPattern->fInitialChars->contains(c)))) {
+                    MatchUTF8At(pos, FALSE, status);
+                    if (U_FAILURE(status)) {
+                        return FALSE;
+                    }
+                    if (fMatch) {
+                        return TRUE;
+                    }
+                    textIdx = startPos;
+                }
+                if (startPos > testStartLimit) {
+                    fMatch = FALSE;
+                    fHitEnd = TRUE;
+                    return FALSE;
+                }
+                if  (findProgressInterrupt(startPos, status))
+                    return FALSE;
+            }
+        }
+        U_ASSERT(FALSE);
 
-//--------------------------------------------------------------------------------
-//
-//  hitEnd()
-//
-//--------------------------------------------------------------------------------
-UBool RegexMatcher::hitEnd() const {
-    return fHitEnd;
-}
+    case START_STRING:
+    case START_CHAR:
+        {
+            // Match starts on exactly one char.
+            U_ASSERT(fPattern->fMinMatchLen > 0);
+            UChar32 theChar = fPattern->fInitialChar;
+            // Skip to the next occurrence of the first byte of theChar, which is
+            //   always at a code point boundary. U+FFFD also stands for ill-formed
+            //   sequences, which do not start with its first byte.
+            uint8_t theBytes[U8_MAX_LENGTH];
+            int32_t theLength = 0;
+            U8_APPEND_UNSAFE(theBytes, theLength, theChar);
+            UBool scan = theChar != 0xfffd && fFindProgressCallbackFn == NULL;
+            textIdx = startPos;
+            for (;;) {
+                if (scan) {
+                    const uint8_t *p = NULL;
+                    if (textIdx < fActiveLimit) {
+                        p = (const uint8_t *)uprv_memchr(inputBuf + textIdx, theBytes[0],
+                                                         (size_t)(fActiveLimit - textIdx));
+                    }
+                    textIdx = p != NULL ? p - inputBuf : fActiveLimit;
+                    startPos = textIdx;
+                    if (startPos > testStartLimit) {
+                        fMatch = FALSE;
+                        fHitEnd = TRUE;
+                        return FALSE;
+                    }
+                }
+                int64_t pos = startPos;
+                c = utf8Next(inputBuf, textIdx, inputLength);
+                startPos = textIdx;
+                if (c == theChar) {
+                    MatchUTF8At(pos, FALSE, status);
+                    if (U_FAILURE(status)) {
+                        return FALSE;
+                    }
+                    if (fMatch) {
+                        return TRUE;
+                    }
+                    textIdx = startPos;
+                }
+                if (startPos > testStartLimit) {
+                    fMatch = FALSE;
+                    fHitEnd = TRUE;
+                    return FALSE;
+                }
+                if  (findProgressInterrupt(startPos, status))
+                    return FALSE;
+           }
+        }
+        U_ASSERT(FALSE);
 
+    case START_LINE:
+        {
+            UChar32 ch;
+            if (startPos == fAnchorStart) {
+                MatchUTF8At(startPos, FALSE, status);
+                if (U_FAILURE(status)) {
+                    return FALSE;
+                }
+                if (fMatch) {
+                    return TRUE;
+                }
+                textIdx = startPos;
+                ch = utf8Next(inputBuf, textIdx, inputLength);
+                startPos = textIdx;
+            } else {
+                textIdx = startPos;
+                ch = utf8Previous(inputBuf, textIdx);
+                textIdx = startPos;
+            }
 
-//--------------------------------------------------------------------------------
-//
-//  input()
-//
-//--------------------------------------------------------------------------------
-const UnicodeString &RegexMatcher::input() const {
-    if (!fInput) {
-        UErrorCode status = U_ZERO_ERROR;
-        int32_t len16;
-        if (UTEXT_USES_U16(fInputText)) {
-            len16 = (int32_t)fInputLength;
-        } else {
-            len16 = utext_extract(fInputText, 0, fInputLength, NULL, 0, &status);
-            status = U_ZERO_ERROR; // overflow, length status
+            if (fPattern->fFlags & UREGEX_UNIX_LINES) {
+                for (;;) {
+                    if (ch == 0x0a) {
+                            MatchUTF8At(startPos, FALSE, status);
+                            if (U_FAILURE(status)) {
+                                return FALSE;
+                            }
+                            if (fMatch) {
+                                return TRUE;
+                            }
+                            textIdx = startPos;
+                    }
+                    if (startPos >= testStartLimit) {
+                        fMatch = FALSE;
+                        fHitEnd = TRUE;
+                        return FALSE;
+                    }
+                    ch = utf8Next(inputBuf, textIdx, inputLength);
+                    startPos = textIdx;
+                    // Note that it's perfectly OK for a pattern to have a zero-length
+                    //   match at the end of a string, so we must make sure that the loop
+                    //   runs with startPos == testStartLimit the last time through.
+                    if  (findProgressInterrupt(startPos, status))
+                        return FALSE;
+                }
+            } else {
+                for (;;) {
+                    if (isLineTerminator(ch)) {
+                        if (ch == 0x0d && startPos < fActiveLimit && utf8Current(inputBuf, textIdx, inputLength) == 0x0a) {
+                            (void)utf8Next(inputBuf, textIdx, inputLength);
+                            startPos = textIdx;
+                        }
+                        MatchUTF8At(startPos, FALSE, status);
+                        if (U_FAILURE(status)) {
+                            return FALSE;
+                        }
+                        if (fMatch) {
+                            return TRUE;
+                        }
+                        textIdx = startPos;
+                    }
+                    if (startPos >= testStartLimit) {
+                        fMatch = FALSE;
+                        fHitEnd = TRUE;
+                        return FALSE;
+                    }
+                    ch = utf8Next(inputBuf, textIdx, inputLength);
+                    startPos = textIdx;
+                    // Note that it's perfectly OK for a pattern to have a zero-length
+                    //   match at the end of a string, so we must make sure that the loop
+                    //   runs with startPos == testStartLimit the last time through.
+                    if  (findProgressInterrupt(startPos, status))
+                        return FALSE;
+                }
+            }
         }
-        UnicodeString *result = new UnicodeString(len16, 0, 0);
-
-        UChar *inputChars = result->getBuffer(len16);
-        utext_extract(fInputText, 0, fInputLength, inputChars, len16, &status); // unterminated warning
-        result->releaseBuffer(len16);
 
-        (*(const UnicodeString **)&fInput) = result; // pointer assignment, rather than operator=
+    default:
+        U_ASSERT(FALSE);
     }
 
-    return *fInput;
+    U_ASSERT(FALSE);
+    return FALSE;
 }
 
+
+
 //--------------------------------------------------------------------------------
 //
-//  inputText()
+//  group()
 //
 //--------------------------------------------------------------------------------
-UText *RegexMatcher::inputText() const {
-    return fInputText;
+UnicodeString RegexMatcher::group(UErrorCode &status) const {
+    return group(0, status);
 }
 
+//  Return immutable shallow clone
+UText *RegexMatcher::group(UText *dest, int64_t &group_len, UErrorCode &status) const {
+    return group(0, dest, group_len, status);
+}
 
-//--------------------------------------------------------------------------------
-//
-//  getInput() -- like inputText(), but makes a clone or copies into another UText
-//
-//--------------------------------------------------------------------------------
-UText *RegexMatcher::getInput (UText *dest, UErrorCode &status) const {
+//  Return immutable shallow clone
+UText *RegexMatcher::group(int32_t groupNum, UText *dest, int64_t &group_len, UErrorCode &status) const {
+    group_len = 0;
     if (U_FAILURE(status)) {
         return dest;
     }
     if (U_FAILURE(fDeferredStatus)) {
         status = fDeferredStatus;
-        return dest;
+    } else if (fMatch == FALSE) {
+        status = U_REGEX_INVALID_STATE;
+    } else if (groupNum < 0 || groupNum > fPattern->fGroupMap->size()) {
+        status = U_INDEX_OUTOFBOUNDS_ERROR;
     }
 
-    if (dest) {
-        if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
-            utext_replace(dest, 0, utext_nativeLength(dest), fInputText->chunkContents, (int32_t)fInputLength, &status);
-        } else {
-            int32_t input16Len;
-            if (UTEXT_USES_U16(fInputText)) {
-                input16Len = (int32_t)fInputLength;
-            } else {
-                UErrorCode lengthStatus = U_ZERO_ERROR;
-                input16Len = utext_extract(fInputText, 0, fInputLength, NULL, 0, &lengthStatus); // buffer overflow error
-            }
-            UChar *inputChars = (UChar *)uprv_malloc(sizeof(UChar)*(input16Len));
-            if (inputChars == NULL) {
-                return dest;
-            }
-
-            status = U_ZERO_ERROR;
-            utext_extract(fInputText, 0, fInputLength, inputChars, input16Len, &status); // not terminated warning
-            status = U_ZERO_ERROR;
-            utext_replace(dest, 0, utext_nativeLength(dest), inputChars, input16Len, &status);
-
-            uprv_free(inputChars);
-        }
+    if (U_FAILURE(status)) {
         return dest;
+    }
+
+    int64_t s, e;
+    if (groupNum == 0) {
+        s = fMatchStart;
+        e = fMatchEnd;
     } else {
-        return utext_clone(NULL, fInputText, FALSE, TRUE, &status);
+        int32_t groupOffset = fPattern->fGroupMap->elementAti(groupNum-1);
+        U_ASSERT(groupOffset < fPattern->fFrameSize);
+        U_ASSERT(groupOffset >= 0);
+        s = fFrame->fExtra[groupOffset];
+        e = fFrame->fExtra[groupOffset+1];
     }
-}
 
+    if (s < 0) {
+        // A capture group wasn't part of the match
+        return utext_clone(dest, fInputText, FALSE, TRUE, &status);
+    }
+    U_ASSERT(s <= e);
+    group_len = e - s;
 
-static UBool compat_SyncMutableUTextContents(UText *ut);
-static UBool compat_SyncMutableUTextContents(UText *ut) {
-    UBool retVal = FALSE;
+    dest = utext_clone(dest, fInputText, FALSE, TRUE, &status);
+    if (dest)
+        UTEXT_SETNATIVEINDEX(dest, s);
+    return dest;
+}
 
-    //  In the following test, we're really only interested in whether the UText should switch
-    //  between heap and stack allocation.  If length hasn't changed, we won't, so the chunkContents
+UnicodeString RegexMatcher::group(int32_t groupNum, UErrorCode &status) const {
+    UnicodeString result;
+    int64_t groupStart = start64(groupNum, status);
+    int64_t groupEnd = end64(groupNum, status);
+    if (U_FAILURE(status) || groupStart == -1 || groupStart == groupEnd) {
+        return result;
+    }
+
+    // Get the group length using a utext_extract preflight.
+    //    UText is actually pretty efficient at this when underlying encoding is UTF-16.
+    int32_t length = utext_extract(fInputText, groupStart, groupEnd, NULL, 0, &status);
+    if (status != U_BUFFER_OVERFLOW_ERROR) {
+        return result;
+    }
+
+    status = U_ZERO_ERROR;
+    UChar *buf = result.getBuffer(length);
+    if (buf == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    } else {
+        int32_t extractLength = utext_extract(fInputText, groupStart, groupEnd, buf, length, &status);
+        result.releaseBuffer(extractLength);
+        U_ASSERT(length == extractLength);
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//  appendGroup() -- currently internal only, appends a group to a UText rather
+//                   than replacing its contents
+//
+//--------------------------------------------------------------------------------
+
+int64_t RegexMatcher::appendGroup(int32_t groupNum, UText *dest, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return 0;
+    }
+    int64_t destLen = utext_nativeLength(dest);
+
+    if (fMatch == FALSE) {
+        status = U_REGEX_INVALID_STATE;
+        return utext_replace(dest, destLen, destLen, NULL, 0, &status);
+    }
+    if (groupNum < 0 || groupNum > fPattern->fGroupMap->size()) {
+        status = U_INDEX_OUTOFBOUNDS_ERROR;
+        return utext_replace(dest, destLen, destLen, NULL, 0, &status);
+    }
+
+    int64_t s, e;
+    if (groupNum == 0) {
+        s = fMatchStart;
+        e = fMatchEnd;
+    } else {
+        int32_t groupOffset = fPattern->fGroupMap->elementAti(groupNum-1);
+        U_ASSERT(groupOffset < fPattern->fFrameSize);
+        U_ASSERT(groupOffset >= 0);
+        s = fFrame->fExtra[groupOffset];
+        e = fFrame->fExtra[groupOffset+1];
+    }
+
+    if (s < 0) {
+        // A capture group wasn't part of the match
+        return utext_replace(dest, destLen, destLen, NULL, 0, &status);
+    }
+    U_ASSERT(s <= e);
+
+    int64_t deltaLen;
+    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+        U_ASSERT(e <= fInputLength);
+        deltaLen = utext_replace(dest, destLen, destLen, fInputText->chunkContents+s, (int32_t)(e-s), &status);
+    } else {
+        int32_t len16;
+        if (UTEXT_USES_U16(fInputText)) {
+            len16 = (int32_t)(e-s);
+        } else {
+            UErrorCode lengthStatus = U_ZERO_ERROR;
+            len16 = utext_extract(fInputText, s, e, NULL, 0, &lengthStatus);
+        }
+        UChar *groupChars = (UChar *)uprv_malloc(sizeof(UChar)*(len16+1));
+        if (groupChars == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+        utext_extract(fInputText, s, e, groupChars, len16+1, &status);
+
+        deltaLen = utext_replace(dest, destLen, destLen, groupChars, len16, &status);
+        uprv_free(groupChars);
+    }
+    return deltaLen;
+}
+
+
+
+//--------------------------------------------------------------------------------
+//
+//  groupCount()
+//
+//--------------------------------------------------------------------------------
+int32_t RegexMatcher::groupCount() const {
+    return fPattern->fGroupMap->size();
+}
+
+//--------------------------------------------------------------------------------
+//
+//  hasAnchoringBounds()
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::hasAnchoringBounds() const {
+    return fAnchoringBounds;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//  hasTransparentBounds()
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::hasTransparentBounds() const {
+    return fTransparentBounds;
+}
+
+
+
+//--------------------------------------------------------------------------------
+//
+//  hitEnd()
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::hitEnd() const {
+    return fHitEnd;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//  input()
+//
+//--------------------------------------------------------------------------------
+const UnicodeString &RegexMatcher::input() const {
+    if (!fInput) {
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t len16;
+        if (UTEXT_USES_U16(fInputText)) {
+            len16 = (int32_t)fInputLength;
+        } else {
+            len16 = utext_extract(fInputText, 0, fInputLength, NULL, 0, &status);
+            status = U_ZERO_ERROR; // overflow, length status
+        }
+        UnicodeString *result = new UnicodeString(len16, 0, 0);
+
+        UChar *inputChars = result->getBuffer(len16);
+        utext_extract(fInputText, 0, fInputLength, inputChars, len16, &status); // unterminated warning
+        result->releaseBuffer(len16);
+
+        (*(const UnicodeString **)&fInput) = result; // pointer assignment, rather than operator=
+    }
+
+    return *fInput;
+}
+
+//--------------------------------------------------------------------------------
+//
+//  inputText()
+//
+//--------------------------------------------------------------------------------
+UText *RegexMatcher::inputText() const {
+    return fInputText;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//  getInput() -- like inputText(), but makes a clone or copies into another UText
+//
+//--------------------------------------------------------------------------------
+UText *RegexMatcher::getInput (UText *dest, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return dest;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return dest;
+    }
+
+    if (dest) {
+        if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+            utext_replace(dest, 0, utext_nativeLength(dest), fInputText->chunkContents, (int32_t)fInputLength, &status);
+        } else {
+            int32_t input16Len;
+            if (UTEXT_USES_U16(fInputText)) {
+                input16Len = (int32_t)fInputLength;
+            } else {
+                UErrorCode lengthStatus = U_ZERO_ERROR;
+                input16Len = utext_extract(fInputText, 0, fInputLength, NULL, 0, &lengthStatus); // buffer overflow error
+            }
+            UChar *inputChars = (UChar *)uprv_malloc(sizeof(UChar)*(input16Len));
+            if (inputChars == NULL) {
+                return dest;
+            }
+
+            status = U_ZERO_ERROR;
+            utext_extract(fInputText, 0, fInputLength, inputChars, input16Len, &status); // not terminated warning
+            status = U_ZERO_ERROR;
+            utext_replace(dest, 0, utext_nativeLength(dest), inputChars, input16Len, &status);
+
+            uprv_free(inputChars);
+        }
+        return dest;
+    } else {
+        return utext_clone(NULL, fInputText, FALSE, TRUE, &status);
+    }
+}
+
+
+static UBool compat_SyncMutableUTextContents(UText *ut);
+static UBool compat_SyncMutableUTextContents(UText *ut) {
+    UBool retVal = FALSE;
+
+    //  In the following test, we're really only interested in whether the UText should switch
+    //  between heap and stack allocation.  If length hasn't changed, we won't, so the chunkContents
     //  will still point to the correct data.
     if (utext_nativeLength(ut) != ut->nativeIndexingLimit) {
         UnicodeString *us=(UnicodeString *)ut->context;
@@ -1471,6 +1923,8 @@ UBool RegexMatcher::lookingAt(UErrorCode &status) {
     }
     if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
         MatchChunkAt((int32_t)fActiveStart, FALSE, status);
+    } else if (fInputUTF8 != NULL) {
+        MatchUTF8At(fActiveStart, FALSE, status);
     } else {
         MatchAt(fActiveStart, FALSE, status);
     }
@@ -1509,6 +1963,8 @@ UBool RegexMatcher::lookingAt(int64_t start, UErrorCode &status) {
 
     if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
         MatchChunkAt((int32_t)nativeStart, FALSE, status);
+    } else if (fInputUTF8 != NULL) {
+        MatchUTF8At(nativeStart, FALSE, status);
     } else {
         MatchAt(nativeStart, FALSE, status);
     }
@@ -1543,6 +1999,8 @@ UBool RegexMatcher::matches(UErrorCode &status) {
 
     if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
         MatchChunkAt((int32_t)fActiveStart, TRUE, status);
+    } else if (fInputUTF8 != NULL) {
+        MatchUTF8At(fActiveStart, TRUE, status);
     } else {
         MatchAt(fActiveStart, TRUE, status);
     }
@@ -1581,6 +2039,8 @@ UBool RegexMatcher::matches(int64_t start, UErrorCode &status) {
 
     if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
         MatchChunkAt((int32_t)nativeStart, TRUE, status);
+    } else if (fInputUTF8 != NULL) {
+        MatchUTF8At(nativeStart, TRUE, status);
     } else {
         MatchAt(nativeStart, TRUE, status);
     }
@@ -1847,6 +2307,7 @@ RegexMatcher &RegexMatcher::reset(const UnicodeString &input) {
         return *this;
     }
     fInputLength = utext_nativeLength(fInputText);
+    fInputUTF8 = NULL;
 
     reset();
     delete fInput;
@@ -1874,6 +2335,7 @@ RegexMatcher &RegexMatcher::reset(UText *input) {
             return *this;
         }
         fInputLength = utext_nativeLength(fInputText);
+        fInputUTF8 = (const uint8_t *)utext_getUTF8(fInputText);
 
         delete fInput;
         fInput = NULL;
@@ -1934,6 +2396,7 @@ RegexMatcher &RegexMatcher::refreshInputText(UText *input, UErrorCode &status) {
     if (U_FAILURE(status)) {
         return *this;
     }
+    fInputUTF8 = (const uint8_t *)utext_getUTF8(fInputText);
     utext_setNativeIndex(fInputText, pos);
 
     if (fAltInputText != NULL) {
@@ -2387,6 +2850,13 @@ void RegexMatcher::setStackLimit(int32_t limit, UErrorCode &status) {
     //    would be lost by resizing to a smaller stack size.
     reset();
 
+    if (fStackArena) {
+        fStack->setBuffer(NULL, 0, status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        fStackArena = FALSE;
+    }
     if (limit == 0) {
         // Unlimited stack expansion
         fStack->setMaxCapacity(0);
@@ -2416,30 +2886,78 @@ int32_t RegexMatcher::getStackLimit() const {
 
 //--------------------------------------------------------------------------------
 //
-//     setMatchCallback
+//     setStackArena
 //
 //--------------------------------------------------------------------------------
-void RegexMatcher::setMatchCallback(URegexMatchCallback     *callback,
-                                    const void              *context,
-                                    UErrorCode              &status) {
+void RegexMatcher::setStackArena(void *arena, int32_t capacity, UErrorCode &status) {
     if (U_FAILURE(status)) {
         return;
     }
-    fCallbackFn = callback;
-    fCallbackContext = context;
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return;
+    }
+    if (arena == NULL) {
+        setStackLimit(DEFAULT_BACKTRACK_STACK_CAPACITY, status);
+        return;
+    }
+    // The arena must hold at least the initial stack frame, which every match
+    //   operation pushes before it begins.
+    int32_t elementCapacity = capacity / (int32_t)sizeof(int64_t);
+    if (U_POINTER_MASK_LSB(arena, sizeof(int64_t) - 1) != 0 ||
+            elementCapacity < fPattern->fFrameSize) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    // Reset the matcher, as for setStackLimit(): a current match's final stack frame
+    //   would be lost by changing to the new memory.
+    reset();
+    fStack->setBuffer((int64_t *)arena, elementCapacity, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    fStackArena = TRUE;
+    fStackLimit = capacity;
 }
 
 
 //--------------------------------------------------------------------------------
 //
-//     getMatchCallback
+//     getHeapAllocationCount
 //
 //--------------------------------------------------------------------------------
-void RegexMatcher::getMatchCallback(URegexMatchCallback   *&callback,
-                                  const void              *&context,
-                                  UErrorCode              &status) {
-    if (U_FAILURE(status)) {
-       return;
+int32_t RegexMatcher::getHeapAllocationCount() const {
+    return fAllocationCount + (fStack != NULL ? fStack->getAllocationCount() : 0);
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//     setMatchCallback
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::setMatchCallback(URegexMatchCallback     *callback,
+                                    const void              *context,
+                                    UErrorCode              &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    fCallbackFn = callback;
+    fCallbackContext = context;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//     getMatchCallback
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::getMatchCallback(URegexMatchCallback   *&callback,
+                                  const void              *&context,
+                                  UErrorCode              &status) {
+    if (U_FAILURE(status)) {
+       return;
     }
     callback = fCallbackFn;
     context  = fCallbackContext;
@@ -2571,187 +3089,1801 @@ UBool RegexMatcher::isChunkWordBoundary(int32_t pos) {
 
     const UChar *inputBuf = fInputText->chunkContents;
 
-    if (pos >= fLookLimit) {
-        fHitEnd = TRUE;
-    } else {
-        // Determine whether char c at current position is a member of the word set of chars.
-        // If we're off the end of the string, behave as though we're not at a word char.
-        UChar32 c;
-        U16_GET(inputBuf, fLookStart, pos, fLookLimit, c);
-        if (u_hasBinaryProperty(c, UCHAR_GRAPHEME_EXTEND) || u_charType(c) == U_FORMAT_CHAR) {
-            // Current char is a combining one.  Not a boundary.
-            return FALSE;
-        }
-        cIsWord = fPattern->fStaticSets[URX_ISWORD_SET]->contains(c);
-    }
+    if (pos >= fLookLimit) {
+        fHitEnd = TRUE;
+    } else {
+        // Determine whether char c at current position is a member of the word set of chars.
+        // If we're off the end of the string, behave as though we're not at a word char.
+        UChar32 c;
+        U16_GET(inputBuf, fLookStart, pos, fLookLimit, c);
+        if (u_hasBinaryProperty(c, UCHAR_GRAPHEME_EXTEND) || u_charType(c) == U_FORMAT_CHAR) {
+            // Current char is a combining one.  Not a boundary.
+            return FALSE;
+        }
+        cIsWord = fPattern->fStaticSets[URX_ISWORD_SET]->contains(c);
+    }
+
+    // Back up until we come to a non-combining char, determine whether
+    //  that char is a word char.
+    UBool prevCIsWord = FALSE;
+    for (;;) {
+        if (pos <= fLookStart) {
+            break;
+        }
+        UChar32 prevChar;
+        U16_PREV(inputBuf, fLookStart, pos, prevChar);
+        if (!(u_hasBinaryProperty(prevChar, UCHAR_GRAPHEME_EXTEND)
+              || u_charType(prevChar) == U_FORMAT_CHAR)) {
+            prevCIsWord = fPattern->fStaticSets[URX_ISWORD_SET]->contains(prevChar);
+            break;
+        }
+    }
+    isBoundary = cIsWord ^ prevCIsWord;
+    return isBoundary;
+}
+
+UBool RegexMatcher::isUTF8WordBoundary(int64_t pos) {
+    UBool isBoundary = FALSE;
+    UBool cIsWord    = FALSE;
+
+    const uint8_t *inputBuf = fInputUTF8;
+
+    if (pos >= fLookLimit) {
+        fHitEnd = TRUE;
+    } else {
+        // Determine whether char c at current position is a member of the word set of chars.
+        // If we're off the end of the string, behave as though we're not at a word char.
+        UChar32 c = utf8Current(inputBuf, pos, fInputLength);
+        if (u_hasBinaryProperty(c, UCHAR_GRAPHEME_EXTEND) || u_charType(c) == U_FORMAT_CHAR) {
+            // Current char is a combining one.  Not a boundary.
+            return FALSE;
+        }
+        cIsWord = fPattern->fStaticSets[URX_ISWORD_SET]->contains(c);
+    }
+
+    // Back up until we come to a non-combining char, determine whether
+    //  that char is a word char.
+    UBool prevCIsWord = FALSE;
+    for (;;) {
+        if (pos <= fLookStart) {
+            break;
+        }
+        UChar32 prevChar = utf8Previous(inputBuf, pos);
+        if (!(u_hasBinaryProperty(prevChar, UCHAR_GRAPHEME_EXTEND)
+              || u_charType(prevChar) == U_FORMAT_CHAR)) {
+            prevCIsWord = fPattern->fStaticSets[URX_ISWORD_SET]->contains(prevChar);
+            break;
+        }
+    }
+    isBoundary = cIsWord ^ prevCIsWord;
+    return isBoundary;
+}
+
+//--------------------------------------------------------------------------------
+//
+//   isUWordBoundary
+//
+//         Test for a word boundary using RBBI word break.
+//
+//          parameters:   pos   - the current position in the input buffer
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::isUWordBoundary(int64_t pos) {
+    UBool       returnVal = FALSE;
+#if UCONFIG_NO_BREAK_ITERATION==0
+
+    // If we haven't yet created a break iterator for this matcher, do it now.
+    if (fWordBreakItr == NULL) {
+        fWordBreakItr =
+            (RuleBasedBreakIterator *)BreakIterator::createWordInstance(Locale::getEnglish(), fDeferredStatus);
+        if (U_FAILURE(fDeferredStatus)) {
+            return FALSE;
+        }
+        ++fAllocationCount;
+        fWordBreakItr->setText(fInputText, fDeferredStatus);
+    }
+
+    if (pos >= fLookLimit) {
+        fHitEnd = TRUE;
+        returnVal = TRUE;   // With Unicode word rules, only positions within the interior of "real"
+                            //    words are not boundaries.  All non-word chars stand by themselves,
+                            //    with word boundaries on both sides.
+    } else {
+        if (!UTEXT_USES_U16(fInputText)) {
+            // !!!: Would like a better way to do this!
+            UErrorCode status = U_ZERO_ERROR;
+            pos = utext_extract(fInputText, 0, pos, NULL, 0, &status);
+        }
+        returnVal = fWordBreakItr->isBoundary((int32_t)pos);
+    }
+#endif
+    return   returnVal;
+}
+
+//--------------------------------------------------------------------------------
+//
+//   IncrementTime     This function is called once each TIMER_INITIAL_VALUE state
+//                     saves. Increment the "time" counter, and call the
+//                     user callback function if there is one installed.
+//
+//                     If the match operation needs to be aborted, either for a time-out
+//                     or because the user callback asked for it, just set an error status.
+//                     The engine will pick that up and stop in its outer loop.
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::IncrementTime(UErrorCode &status) {
+    fTickCounter = TIMER_INITIAL_VALUE;
+    fTime++;
+    if (fCallbackFn != NULL) {
+        if ((*fCallbackFn)(fCallbackContext, fTime) == FALSE) {
+            status = U_REGEX_STOPPED_BY_CALLER;
+            return;
+        }
+    }
+    if (fTimeLimit > 0 && fTime >= fTimeLimit) {
+        status = U_REGEX_TIME_OUT;
+    }
+}
+
+//--------------------------------------------------------------------------------
+//
+//   StateSave
+//       Make a new stack frame, initialized as a copy of the current stack frame.
+//       Set the pattern index in the original stack frame from the operand value
+//       in the opcode.  Execution of the engine continues with the state in
+//       the newly created stack frame
+//
+//       Note that reserveBlock() may grow the stack, resulting in the
+//       whole thing being relocated in memory.
+//
+//    Parameters:
+//       fp           The top frame pointer when called.  At return, a new
+//                    fame will be present
+//       savePatIdx   An index into the compiled pattern.  Goes into the original
+//                    (not new) frame.  If execution ever back-tracks out of the
+//                    new frame, this will be where we continue from in the pattern.
+//    Return
+//                    The new frame pointer.
+//
+//--------------------------------------------------------------------------------
+inline REStackFrame *RegexMatcher::StateSave(REStackFrame *fp, int64_t savePatIdx, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return fp;
+    }
+    // push storage for a new frame.
+    int64_t *newFP = fStack->reserveBlock(fFrameSize, status);
+    if (U_FAILURE(status)) {
+        // Failure on attempted stack expansion.
+        //   Stack function set some other error code, change it to a more
+        //   specific one for regular expressions.
+        status = U_REGEX_STACK_OVERFLOW;
+        // We need to return a writable stack frame, so just return the
+        //    previous frame.  The match operation will stop quickly
+        //    because of the error status, after which the frame will never
+        //    be looked at again.
+        return fp;
+    }
+    fp = (REStackFrame *)(newFP - fFrameSize);  // in case of realloc of stack.
+
+    // New stack frame = copy of old top frame.
+    int64_t *source = (int64_t *)fp;
+    int64_t *dest   = newFP;
+    for (;;) {
+        *dest++ = *source++;
+        if (source == newFP) {
+            break;
+        }
+    }
+
+    fTickCounter--;
+    if (fTickCounter <= 0) {
+       IncrementTime(status);    // Re-initializes fTickCounter
+    }
+    fp->fPatIdx = savePatIdx;
+    return (REStackFrame *)newFP;
+}
+
+#if defined(REGEX_DEBUG)
+namespace {
+UnicodeString StringFromUText(UText *ut) {
+    UnicodeString result;
+    for (UChar32 c = utext_next32From(ut, 0); c != U_SENTINEL; c = UTEXT_NEXT32(ut)) {
+        result.append(c);
+    }
+    return result;
+}
+}
+#endif // REGEX_DEBUG
+
+
+//--------------------------------------------------------------------------------
+//
+//   MatchAt      This is the actual matching engine.
+//
+//                  startIdx:    begin matching a this index.
+//                  toEnd:       if true, match must extend to end of the input region
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
+    UBool       isMatch  = FALSE;      // True if the we have a match.
+
+    int64_t     backSearchIndex = U_INT64_MAX; // used after greedy single-character matches for searching backwards
+
+    int32_t     op;                    // Operation from the compiled pattern, split into
+    int32_t     opType;                //    the opcode
+    int32_t     opValue;               //    and the operand value.
+
+#ifdef REGEX_RUN_DEBUG
+    if (fTraceDebug) {
+        printf("MatchAt(startIdx=%ld)\n", startIdx);
+        printf("Original Pattern: \"%s\"\n", CStr(StringFromUText(fPattern->fPattern))());
+        printf("Input String:     \"%s\"\n\n", CStr(StringFromUText(fInputText))());
+    }
+#endif
+
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    //  Cache frequently referenced items from the compiled pattern
+    //
+    int64_t             *pat           = fPattern->fCompiledPat->getBuffer();
+
+    const UChar         *litText       = fPattern->fLiteralText.getBuffer();
+    UVector             *fSets         = fPattern->fSets;
+
+    fFrameSize = fPattern->fFrameSize;
+    REStackFrame        *fp            = resetStack();
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return;
+    }
+
+    fp->fPatIdx   = 0;
+    fp->fInputIdx = startIdx;
+
+    // Zero out the pattern's static data
+    int32_t i;
+    for (i = 0; i<fPattern->fDataSize; i++) {
+        fData[i] = 0;
+    }
+
+    //
+    //  Main loop for interpreting the compiled pattern.
+    //  One iteration of the loop per pattern operation performed.
+    //
+    for (;;) {
+        op      = (int32_t)pat[fp->fPatIdx];
+        opType  = URX_TYPE(op);
+        opValue = URX_VAL(op);
+#ifdef REGEX_RUN_DEBUG
+        if (fTraceDebug) {
+            UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+            printf("inputIdx=%ld   inputChar=%x   sp=%3ld   activeLimit=%ld  ", fp->fInputIdx,
+                UTEXT_CURRENT32(fInputText), (int64_t *)fp-fStack->getBuffer(), fActiveLimit);
+            fPattern->dumpOp(fp->fPatIdx);
+        }
+#endif
+        fp->fPatIdx++;
+
+        switch (opType) {
+
+
+        case URX_NOP:
+            break;
+
+
+        case URX_BACKTRACK:
+            // Force a backtrack.  In some circumstances, the pattern compiler
+            //   will notice that the pattern can't possibly match anything, and will
+            //   emit one of these at that point.
+            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            break;
+
+
+        case URX_ONECHAR:
+            if (fp->fInputIdx < fActiveLimit) {
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                if (c == opValue) {
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    break;
+                }
+            } else {
+                fHitEnd = TRUE;
+            }
+            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            break;
+
+
+        case URX_STRING:
+            {
+                // Test input against a literal string.
+                // Strings require two slots in the compiled pattern, one for the
+                //   offset to the string text, and one for the length.
+
+                int32_t   stringStartIdx = opValue;
+                op      = (int32_t)pat[fp->fPatIdx];     // Fetch the second operand
+                fp->fPatIdx++;
+                opType    = URX_TYPE(op);
+                int32_t stringLen = URX_VAL(op);
+                U_ASSERT(opType == URX_STRING_LEN);
+                U_ASSERT(stringLen >= 2);
+
+                const UChar *patternString = litText+stringStartIdx;
+                int32_t patternStringIndex = 0;
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                UChar32 inputChar;
+                UChar32 patternChar;
+                UBool success = TRUE;
+                while (patternStringIndex < stringLen) {
+                    if (UTEXT_GETNATIVEINDEX(fInputText) >= fActiveLimit) {
+                        success = FALSE;
+                        fHitEnd = TRUE;
+                        break;
+                    }
+                    inputChar = UTEXT_NEXT32(fInputText);
+                    U16_NEXT(patternString, patternStringIndex, stringLen, patternChar);
+                    if (patternChar != inputChar) {
+                        success = FALSE;
+                        break;
+                    }
+                }
+
+                if (success) {
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                } else {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
+
+
+        case URX_STATE_SAVE:
+            fp = StateSave(fp, opValue, status);
+            break;
+
+
+        case URX_END:
+            // The match loop will exit via this path on a successful match,
+            //   when we reach the end of the pattern.
+            if (toEnd && fp->fInputIdx != fActiveLimit) {
+                // The pattern matched, but not to the end of input.  Try some more.
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                break;
+            }
+            isMatch = TRUE;
+            goto  breakFromLoop;
+
+        // Start and End Capture stack frame variables are laid out out like this:
+            //  fp->fExtra[opValue]  - The start of a completed capture group
+            //             opValue+1 - The end   of a completed capture group
+            //             opValue+2 - the start of a capture group whose end
+            //                          has not yet been reached (and might not ever be).
+        case URX_START_CAPTURE:
+            U_ASSERT(opValue >= 0 && opValue < fFrameSize-3);
+            fp->fExtra[opValue+2] = fp->fInputIdx;
+            break;
+
+
+        case URX_END_CAPTURE:
+            U_ASSERT(opValue >= 0 && opValue < fFrameSize-3);
+            U_ASSERT(fp->fExtra[opValue+2] >= 0);            // Start pos for this group must be set.
+            fp->fExtra[opValue]   = fp->fExtra[opValue+2];   // Tentative start becomes real.
+            fp->fExtra[opValue+1] = fp->fInputIdx;           // End position
+            U_ASSERT(fp->fExtra[opValue] <= fp->fExtra[opValue+1]);
+            break;
+
+
+        case URX_DOLLAR:                   //  $, test for End of line
+                                           //     or for position before new line at end of input
+            {
+                if (fp->fInputIdx >= fAnchorLimit) {
+                    // We really are at the end of input.  Success.
+                    fHitEnd = TRUE;
+                    fRequireEnd = TRUE;
+                    break;
+                }
+
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+
+                // If we are positioned just before a new-line that is located at the
+                //   end of input, succeed.
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                if (UTEXT_GETNATIVEINDEX(fInputText) >= fAnchorLimit) {
+                    if (isLineTerminator(c)) {
+                        // If not in the middle of a CR/LF sequence
+                        if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && ((void)UTEXT_PREVIOUS32(fInputText), UTEXT_PREVIOUS32(fInputText))==0x0d)) {
+                            // At new-line at end of input. Success
+                            fHitEnd = TRUE;
+                            fRequireEnd = TRUE;
+
+                            break;
+                        }
+                    }
+                } else {
+                    UChar32 nextC = UTEXT_NEXT32(fInputText);
+                    if (c == 0x0d && nextC == 0x0a && UTEXT_GETNATIVEINDEX(fInputText) >= fAnchorLimit) {
+                        fHitEnd = TRUE;
+                        fRequireEnd = TRUE;
+                        break;                         // At CR/LF at end of input.  Success
+                    }
+                }
+
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            }
+            break;
+
+
+         case URX_DOLLAR_D:                   //  $, test for End of Line, in UNIX_LINES mode.
+            if (fp->fInputIdx >= fAnchorLimit) {
+                // Off the end of input.  Success.
+                fHitEnd = TRUE;
+                fRequireEnd = TRUE;
+                break;
+            } else {
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                // Either at the last character of input, or off the end.
+                if (c == 0x0a && UTEXT_GETNATIVEINDEX(fInputText) == fAnchorLimit) {
+                    fHitEnd = TRUE;
+                    fRequireEnd = TRUE;
+                    break;
+                }
+            }
+
+            // Not at end of input.  Back-track out.
+            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            break;
+
+
+         case URX_DOLLAR_M:                //  $, test for End of line in multi-line mode
+             {
+                 if (fp->fInputIdx >= fAnchorLimit) {
+                     // We really are at the end of input.  Success.
+                     fHitEnd = TRUE;
+                     fRequireEnd = TRUE;
+                     break;
+                 }
+                 // If we are positioned just before a new-line, succeed.
+                 // It makes no difference where the new-line is within the input.
+                 UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                 UChar32 c = UTEXT_CURRENT32(fInputText);
+                 if (isLineTerminator(c)) {
+                     // At a line end, except for the odd chance of  being in the middle of a CR/LF sequence
+                     //  In multi-line mode, hitting a new-line just before the end of input does not
+                     //   set the hitEnd or requireEnd flags
+                     if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && UTEXT_PREVIOUS32(fInputText)==0x0d)) {
+                        break;
+                     }
+                 }
+                 // not at a new line.  Fail.
+                 fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+             }
+             break;
+
+
+         case URX_DOLLAR_MD:                //  $, test for End of line in multi-line and UNIX_LINES mode
+             {
+                 if (fp->fInputIdx >= fAnchorLimit) {
+                     // We really are at the end of input.  Success.
+                     fHitEnd = TRUE;
+                     fRequireEnd = TRUE;  // Java set requireEnd in this case, even though
+                     break;               //   adding a new-line would not lose the match.
+                 }
+                 // If we are not positioned just before a new-line, the test fails; backtrack out.
+                 // It makes no difference where the new-line is within the input.
+                 UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                 if (UTEXT_CURRENT32(fInputText) != 0x0a) {
+                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                 }
+             }
+             break;
+
+
+       case URX_CARET:                    //  ^, test for start of line
+            if (fp->fInputIdx != fAnchorStart) {
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            }
+            break;
+
+
+       case URX_CARET_M:                   //  ^, test for start of line in mulit-line mode
+           {
+               if (fp->fInputIdx == fAnchorStart) {
+                   // We are at the start input.  Success.
+                   break;
+               }
+               // Check whether character just before the current pos is a new-line
+               //   unless we are at the end of input
+               UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+               UChar32  c = UTEXT_PREVIOUS32(fInputText);
+               if ((fp->fInputIdx < fAnchorLimit) && isLineTerminator(c)) {
+                   //  It's a new-line.  ^ is true.  Success.
+                   //  TODO:  what should be done with positions between a CR and LF?
+                   break;
+               }
+               // Not at the start of a line.  Fail.
+               fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+           }
+           break;
+
+
+       case URX_CARET_M_UNIX:       //  ^, test for start of line in mulit-line + Unix-line mode
+           {
+               U_ASSERT(fp->fInputIdx >= fAnchorStart);
+               if (fp->fInputIdx <= fAnchorStart) {
+                   // We are at the start input.  Success.
+                   break;
+               }
+               // Check whether character just before the current pos is a new-line
+               U_ASSERT(fp->fInputIdx <= fAnchorLimit);
+               UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+               UChar32  c = UTEXT_PREVIOUS32(fInputText);
+               if (c != 0x0a) {
+                   // Not at the start of a line.  Back-track out.
+                   fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+               }
+           }
+           break;
+
+        case URX_BACKSLASH_B:          // Test for word boundaries
+            {
+                UBool success = isWordBoundary(fp->fInputIdx);
+                success ^= (UBool)(opValue != 0);     // flip sense for \B
+                if (!success) {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
+
+
+        case URX_BACKSLASH_BU:          // Test for word boundaries, Unicode-style
+            {
+                UBool success = isUWordBoundary(fp->fInputIdx);
+                success ^= (UBool)(opValue != 0);     // flip sense for \B
+                if (!success) {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
+
+
+        case URX_BACKSLASH_D:            // Test for decimal digit
+            {
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                int8_t ctype = u_charType(c);     // TODO:  make a unicode set for this.  Will be faster.
+                UBool success = (ctype == U_DECIMAL_DIGIT_NUMBER);
+                success ^= (UBool)(opValue != 0);        // flip sense for \D
+                if (success) {
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                } else {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
+
+
+        case URX_BACKSLASH_G:          // Test for position at end of previous match
+            if (!((fMatch && fp->fInputIdx==fMatchEnd) || (fMatch==FALSE && fp->fInputIdx==fActiveStart))) {
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            }
+            break;
+
+
+        case URX_BACKSLASH_H:            // Test for \h, horizontal white space.
+            {
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                int8_t ctype = u_charType(c);
+                UBool success = (ctype == U_SPACE_SEPARATOR || c == 9);  // SPACE_SEPARATOR || TAB
+                success ^= (UBool)(opValue != 0);        // flip sense for \H
+                if (success) {
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                } else {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
+
+
+        case URX_BACKSLASH_R:            // Test for \R, any line break sequence.
+            {
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                if (isLineTerminator(c)) {
+                    if (c == 0x0d && utext_current32(fInputText) == 0x0a) {
+                        utext_next32(fInputText);
+                    }
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                } else {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
+
+
+        case URX_BACKSLASH_V:            // \v, any single line ending character.
+            {
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                UBool success = isLineTerminator(c);
+                success ^= (UBool)(opValue != 0);        // flip sense for \V
+                if (success) {
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                } else {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
+
+
+        case URX_BACKSLASH_X:
+            //  Match a Grapheme, as defined by Unicode TR 29.
+            //  Differs slightly from Perl, which consumes combining marks independently
+            //    of context.
+            {
+
+                // Fail if at end of input
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+
+                // Examine (and consume) the current char.
+                //   Dispatch into a little state machine, based on the char.
+                UChar32  c;
+                c = UTEXT_NEXT32(fInputText);
+                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                UnicodeSet **sets = fPattern->fStaticSets;
+                if (sets[URX_GC_NORMAL]->contains(c))  goto GC_Extend;
+                if (sets[URX_GC_CONTROL]->contains(c)) goto GC_Control;
+                if (sets[URX_GC_L]->contains(c))       goto GC_L;
+                if (sets[URX_GC_LV]->contains(c))      goto GC_V;
+                if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
+                if (sets[URX_GC_V]->contains(c))       goto GC_V;
+                if (sets[URX_GC_T]->contains(c))       goto GC_T;
+                goto GC_Extend;
+
+
+
+GC_L:
+                if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
+                c = UTEXT_NEXT32(fInputText);
+                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                if (sets[URX_GC_L]->contains(c))       goto GC_L;
+                if (sets[URX_GC_LV]->contains(c))      goto GC_V;
+                if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
+                if (sets[URX_GC_V]->contains(c))       goto GC_V;
+                (void)UTEXT_PREVIOUS32(fInputText);
+                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                goto GC_Extend;
+
+GC_V:
+                if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
+                c = UTEXT_NEXT32(fInputText);
+                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                if (sets[URX_GC_V]->contains(c))       goto GC_V;
+                if (sets[URX_GC_T]->contains(c))       goto GC_T;
+                (void)UTEXT_PREVIOUS32(fInputText);
+                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                goto GC_Extend;
+
+GC_T:
+                if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
+                c = UTEXT_NEXT32(fInputText);
+                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                if (sets[URX_GC_T]->contains(c))       goto GC_T;
+                (void)UTEXT_PREVIOUS32(fInputText);
+                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                goto GC_Extend;
+
+GC_Extend:
+                // Combining characters are consumed here
+                for (;;) {
+                    if (fp->fInputIdx >= fActiveLimit) {
+                        break;
+                    }
+                    c = UTEXT_CURRENT32(fInputText);
+                    if (sets[URX_GC_EXTEND]->contains(c) == FALSE) {
+                        break;
+                    }
+                    (void)UTEXT_NEXT32(fInputText);
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                }
+                goto GC_Done;
+
+GC_Control:
+                // Most control chars stand alone (don't combine with combining chars),
+                //   except for that CR/LF sequence is a single grapheme cluster.
+                if (c == 0x0d && fp->fInputIdx < fActiveLimit && UTEXT_CURRENT32(fInputText) == 0x0a) {
+                    c = UTEXT_NEXT32(fInputText);
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                }
+
+GC_Done:
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                }
+                break;
+            }
+
+
+
+
+        case URX_BACKSLASH_Z:          // Test for end of Input
+            if (fp->fInputIdx < fAnchorLimit) {
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            } else {
+                fHitEnd = TRUE;
+                fRequireEnd = TRUE;
+            }
+            break;
+
+
+
+        case URX_STATIC_SETREF:
+            {
+                // Test input character against one of the predefined sets
+                //    (Word Characters, for example)
+                // The high bit of the op value is a flag for the match polarity.
+                //    0:   success if input char is in set.
+                //    1:   success if input char is not in set.
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+
+                UBool success = ((opValue & URX_NEG_SET) == URX_NEG_SET);
+                opValue &= ~URX_NEG_SET;
+                U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
+
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                if (c < 256) {
+                    Regex8BitSet *s8 = &fPattern->fStaticSets8[opValue];
+                    if (s8->contains(c)) {
+                        success = !success;
+                    }
+                } else {
+                    const UnicodeSet *s = fPattern->fStaticSets[opValue];
+                    if (s->contains(c)) {
+                        success = !success;
+                    }
+                }
+                if (success) {
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                } else {
+                    // the character wasn't in the set.
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
+
+
+        case URX_STAT_SETREF_N:
+            {
+                // Test input character for NOT being a member of  one of
+                //    the predefined sets (Word Characters, for example)
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+
+                U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
+
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                if (c < 256) {
+                    Regex8BitSet *s8 = &fPattern->fStaticSets8[opValue];
+                    if (s8->contains(c) == FALSE) {
+                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        break;
+                    }
+                } else {
+                    const UnicodeSet *s = fPattern->fStaticSets[opValue];
+                    if (s->contains(c) == FALSE) {
+                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        break;
+                    }
+                }
+                // the character wasn't in the set.
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            }
+            break;
+
+
+        case URX_SETREF:
+            if (fp->fInputIdx >= fActiveLimit) {
+                fHitEnd = TRUE;
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                break;
+            } else {
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+
+                // There is input left.  Pick up one char and test it for set membership.
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                U_ASSERT(opValue > 0 && opValue < fSets->size());
+                if (c<256) {
+                    Regex8BitSet *s8 = &fPattern->fSets8[opValue];
+                    if (s8->contains(c)) {
+                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        break;
+                    }
+                } else {
+                    UnicodeSet *s = (UnicodeSet *)fSets->elementAt(opValue);
+                    if (s->contains(c)) {
+                        // The character is in the set.  A Match.
+                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        break;
+                    }
+                }
+
+                // the character wasn't in the set.
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            }
+            break;
+
+
+        case URX_DOTANY:
+            {
+                // . matches anything, but stops at end-of-line.
+                if (fp->fInputIdx >= fActiveLimit) {
+                    // At end of input.  Match failed.  Backtrack out.
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+
+                // There is input left.  Advance over one char, unless we've hit end-of-line
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                if (isLineTerminator(c)) {
+                    // End of line in normal mode.   . does not match.
+                        fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+            }
+            break;
+
+
+        case URX_DOTANY_ALL:
+            {
+                // ., in dot-matches-all (including new lines) mode
+                if (fp->fInputIdx >= fActiveLimit) {
+                    // At end of input.  Match failed.  Backtrack out.
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+
+                // There is input left.  Advance over one char, except if we are
+                //   at a cr/lf, advance over both of them.
+                UChar32 c;
+                c = UTEXT_NEXT32(fInputText);
+                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                if (c==0x0d && fp->fInputIdx < fActiveLimit) {
+                    // In the case of a CR/LF, we need to advance over both.
+                    UChar32 nextc = UTEXT_CURRENT32(fInputText);
+                    if (nextc == 0x0a) {
+                        (void)UTEXT_NEXT32(fInputText);
+                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    }
+                }
+            }
+            break;
+
+
+        case URX_DOTANY_UNIX:
+            {
+                // '.' operator, matches all, but stops at end-of-line.
+                //   UNIX_LINES mode, so 0x0a is the only recognized line ending.
+                if (fp->fInputIdx >= fActiveLimit) {
+                    // At end of input.  Match failed.  Backtrack out.
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+
+                // There is input left.  Advance over one char, unless we've hit end-of-line
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                if (c == 0x0a) {
+                    // End of line in normal mode.   '.' does not match the \n
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                } else {
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                }
+            }
+            break;
+
+
+        case URX_JMP:
+            fp->fPatIdx = opValue;
+            break;
+
+        case URX_FAIL:
+            isMatch = FALSE;
+            goto breakFromLoop;
+
+        case URX_JMP_SAV:
+            U_ASSERT(opValue < fPattern->fCompiledPat->size());
+            fp = StateSave(fp, fp->fPatIdx, status);       // State save to loc following current
+            fp->fPatIdx = opValue;                         // Then JMP.
+            break;
+
+        case URX_JMP_SAV_X:
+            // This opcode is used with (x)+, when x can match a zero length string.
+            // Same as JMP_SAV, except conditional on the match having made forward progress.
+            // Destination of the JMP must be a URX_STO_INP_LOC, from which we get the
+            //   data address of the input position at the start of the loop.
+            {
+                U_ASSERT(opValue > 0 && opValue < fPattern->fCompiledPat->size());
+                int32_t  stoOp = (int32_t)pat[opValue-1];
+                U_ASSERT(URX_TYPE(stoOp) == URX_STO_INP_LOC);
+                int32_t  frameLoc = URX_VAL(stoOp);
+                U_ASSERT(frameLoc >= 0 && frameLoc < fFrameSize);
+                int64_t prevInputIdx = fp->fExtra[frameLoc];
+                U_ASSERT(prevInputIdx <= fp->fInputIdx);
+                if (prevInputIdx < fp->fInputIdx) {
+                    // The match did make progress.  Repeat the loop.
+                    fp = StateSave(fp, fp->fPatIdx, status);  // State save to loc following current
+                    fp->fPatIdx = opValue;
+                    fp->fExtra[frameLoc] = fp->fInputIdx;
+                }
+                // If the input position did not advance, we do nothing here,
+                //   execution will fall out of the loop.
+            }
+            break;
+
+        case URX_CTR_INIT:
+            {
+                U_ASSERT(opValue >= 0 && opValue < fFrameSize-2);
+                fp->fExtra[opValue] = 0;                 //  Set the loop counter variable to zero
+
+                // Pick up the three extra operands that CTR_INIT has, and
+                //    skip the pattern location counter past
+                int32_t instrOperandLoc = (int32_t)fp->fPatIdx;
+                fp->fPatIdx += 3;
+                int32_t loopLoc  = URX_VAL(pat[instrOperandLoc]);
+                int32_t minCount = (int32_t)pat[instrOperandLoc+1];
+                int32_t maxCount = (int32_t)pat[instrOperandLoc+2];
+                U_ASSERT(minCount>=0);
+                U_ASSERT(maxCount>=minCount || maxCount==-1);
+                U_ASSERT(loopLoc>=fp->fPatIdx);
+
+                if (minCount == 0) {
+                    fp = StateSave(fp, loopLoc+1, status);
+                }
+                if (maxCount == -1) {
+                    fp->fExtra[opValue+1] = fp->fInputIdx;   //  For loop breaking.
+                } else if (maxCount == 0) {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
+
+        case URX_CTR_LOOP:
+            {
+                U_ASSERT(opValue>0 && opValue < fp->fPatIdx-2);
+                int32_t initOp = (int32_t)pat[opValue];
+                U_ASSERT(URX_TYPE(initOp) == URX_CTR_INIT);
+                int64_t *pCounter = &fp->fExtra[URX_VAL(initOp)];
+                int32_t minCount  = (int32_t)pat[opValue+2];
+                int32_t maxCount  = (int32_t)pat[opValue+3];
+                (*pCounter)++;
+                if ((uint64_t)*pCounter >= (uint32_t)maxCount && maxCount != -1) {
+                    U_ASSERT(*pCounter == maxCount);
+                    break;
+                }
+                if (*pCounter >= minCount) {
+                    if (maxCount == -1) {
+                        // Loop has no hard upper bound.
+                        // Check that it is progressing through the input, break if it is not.
+                        int64_t *pLastInputIdx =  &fp->fExtra[URX_VAL(initOp) + 1];
+                        if (fp->fInputIdx == *pLastInputIdx) {
+                            break;
+                        } else {
+                            *pLastInputIdx = fp->fInputIdx;
+                        }
+                    }
+                    fp = StateSave(fp, fp->fPatIdx, status);
+                } else {
+                    // Increment time-out counter. (StateSave() does it if count >= minCount)
+                    fTickCounter--;
+                    if (fTickCounter <= 0) {
+                        IncrementTime(status);    // Re-initializes fTickCounter
+                    }
+                }
+
+                fp->fPatIdx = opValue + 4;    // Loop back.
+            }
+            break;
+
+        case URX_CTR_INIT_NG:
+            {
+                // Initialize a non-greedy loop
+                U_ASSERT(opValue >= 0 && opValue < fFrameSize-2);
+                fp->fExtra[opValue] = 0;                 //  Set the loop counter variable to zero
+
+                // Pick up the three extra operands that CTR_INIT_NG has, and
+                //    skip the pattern location counter past
+                int32_t instrOperandLoc = (int32_t)fp->fPatIdx;
+                fp->fPatIdx += 3;
+                int32_t loopLoc  = URX_VAL(pat[instrOperandLoc]);
+                int32_t minCount = (int32_t)pat[instrOperandLoc+1];
+                int32_t maxCount = (int32_t)pat[instrOperandLoc+2];
+                U_ASSERT(minCount>=0);
+                U_ASSERT(maxCount>=minCount || maxCount==-1);
+                U_ASSERT(loopLoc>fp->fPatIdx);
+                if (maxCount == -1) {
+                    fp->fExtra[opValue+1] = fp->fInputIdx;   //  Save initial input index for loop breaking.
+                }
+
+                if (minCount == 0) {
+                    if (maxCount != 0) {
+                        fp = StateSave(fp, fp->fPatIdx, status);
+                    }
+                    fp->fPatIdx = loopLoc+1;   // Continue with stuff after repeated block
+                }
+            }
+            break;
+
+        case URX_CTR_LOOP_NG:
+            {
+                // Non-greedy {min, max} loops
+                U_ASSERT(opValue>0 && opValue < fp->fPatIdx-2);
+                int32_t initOp = (int32_t)pat[opValue];
+                U_ASSERT(URX_TYPE(initOp) == URX_CTR_INIT_NG);
+                int64_t *pCounter = &fp->fExtra[URX_VAL(initOp)];
+                int32_t minCount  = (int32_t)pat[opValue+2];
+                int32_t maxCount  = (int32_t)pat[opValue+3];
+
+                (*pCounter)++;
+                if ((uint64_t)*pCounter >= (uint32_t)maxCount && maxCount != -1) {
+                    // The loop has matched the maximum permitted number of times.
+                    //   Break out of here with no action.  Matching will
+                    //   continue with the following pattern.
+                    U_ASSERT(*pCounter == maxCount);
+                    break;
+                }
+
+                if (*pCounter < minCount) {
+                    // We haven't met the minimum number of matches yet.
+                    //   Loop back for another one.
+                    fp->fPatIdx = opValue + 4;    // Loop back.
+                    // Increment time-out counter. (StateSave() does it if count >= minCount)
+                    fTickCounter--;
+                    if (fTickCounter <= 0) {
+                        IncrementTime(status);    // Re-initializes fTickCounter
+                    }
+                } else {
+                    // We do have the minimum number of matches.
+
+                    // If there is no upper bound on the loop iterations, check that the input index
+                    // is progressing, and stop the loop if it is not.
+                    if (maxCount == -1) {
+                        int64_t *pLastInputIdx =  &fp->fExtra[URX_VAL(initOp) + 1];
+                        if (fp->fInputIdx == *pLastInputIdx) {
+                            break;
+                        }
+                        *pLastInputIdx = fp->fInputIdx;
+                    }
+
+                    // Loop Continuation: we will fall into the pattern following the loop
+                    //   (non-greedy, don't execute loop body first), but first do
+                    //   a state save to the top of the loop, so that a match failure
+                    //   in the following pattern will try another iteration of the loop.
+                    fp = StateSave(fp, opValue + 4, status);
+                }
+            }
+            break;
+
+        case URX_STO_SP:
+            U_ASSERT(opValue >= 0 && opValue < fPattern->fDataSize);
+            fData[opValue] = fStack->size();
+            break;
+
+        case URX_LD_SP:
+            {
+                U_ASSERT(opValue >= 0 && opValue < fPattern->fDataSize);
+                int32_t newStackSize = (int32_t)fData[opValue];
+                U_ASSERT(newStackSize <= fStack->size());
+                int64_t *newFP = fStack->getBuffer() + newStackSize - fFrameSize;
+                if (newFP == (int64_t *)fp) {
+                    break;
+                }
+                int32_t j;
+                for (j=0; j<fFrameSize; j++) {
+                    newFP[j] = ((int64_t *)fp)[j];
+                }
+                fp = (REStackFrame *)newFP;
+                fStack->setSize(newStackSize);
+            }
+            break;
+
+        case URX_BACKREF:
+            {
+                U_ASSERT(opValue < fFrameSize);
+                int64_t groupStartIdx = fp->fExtra[opValue];
+                int64_t groupEndIdx   = fp->fExtra[opValue+1];
+                U_ASSERT(groupStartIdx <= groupEndIdx);
+                if (groupStartIdx < 0) {
+                    // This capture group has not participated in the match thus far,
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
+                    break;
+                }
+                UTEXT_SETNATIVEINDEX(fAltInputText, groupStartIdx);
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+
+                //   Note: if the capture group match was of an empty string the backref
+                //         match succeeds.  Verified by testing:  Perl matches succeed
+                //         in this case, so we do too.
+
+                UBool success = TRUE;
+                for (;;) {
+                    if (utext_getNativeIndex(fAltInputText) >= groupEndIdx) {
+                        success = TRUE;
+                        break;
+                    }
+                    if (utext_getNativeIndex(fInputText) >= fActiveLimit) {
+                        success = FALSE;
+                        fHitEnd = TRUE;
+                        break;
+                    }
+                    UChar32 captureGroupChar = utext_next32(fAltInputText);
+                    UChar32 inputChar = utext_next32(fInputText);
+                    if (inputChar != captureGroupChar) {
+                        success = FALSE;
+                        break;
+                    }
+                }
+
+                if (success) {
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                } else {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
+
+
+
+        case URX_BACKREF_I:
+            {
+                U_ASSERT(opValue < fFrameSize);
+                int64_t groupStartIdx = fp->fExtra[opValue];
+                int64_t groupEndIdx   = fp->fExtra[opValue+1];
+                U_ASSERT(groupStartIdx <= groupEndIdx);
+                if (groupStartIdx < 0) {
+                    // This capture group has not participated in the match thus far,
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
+                    break;
+                }
+                utext_setNativeIndex(fAltInputText, groupStartIdx);
+                utext_setNativeIndex(fInputText, fp->fInputIdx);
+                CaseFoldingUTextIterator captureGroupItr(*fAltInputText);
+                CaseFoldingUTextIterator inputItr(*fInputText);
+
+                //   Note: if the capture group match was of an empty string the backref
+                //         match succeeds.  Verified by testing:  Perl matches succeed
+                //         in this case, so we do too.
+
+                UBool success = TRUE;
+                for (;;) {
+                    if (!captureGroupItr.inExpansion() && utext_getNativeIndex(fAltInputText) >= groupEndIdx) {
+                        success = TRUE;
+                        break;
+                    }
+                    if (!inputItr.inExpansion() && utext_getNativeIndex(fInputText) >= fActiveLimit) {
+                        success = FALSE;
+                        fHitEnd = TRUE;
+                        break;
+                    }
+                    UChar32 captureGroupChar = captureGroupItr.next();
+                    UChar32 inputChar = inputItr.next();
+                    if (inputChar != captureGroupChar) {
+                        success = FALSE;
+                        break;
+                    }
+                }
+
+                if (success && inputItr.inExpansion()) {
+                    // We otained a match by consuming part of a string obtained from
+                    // case-folding a single code point of the input text.
+                    // This does not count as an overall match.
+                    success = FALSE;
+                }
+
+                if (success) {
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                } else {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+
+            }
+            break;
+
+        case URX_STO_INP_LOC:
+            {
+                U_ASSERT(opValue >= 0 && opValue < fFrameSize);
+                fp->fExtra[opValue] = fp->fInputIdx;
+            }
+            break;
+
+        case URX_JMPX:
+            {
+                int32_t instrOperandLoc = (int32_t)fp->fPatIdx;
+                fp->fPatIdx += 1;
+                int32_t dataLoc  = URX_VAL(pat[instrOperandLoc]);
+                U_ASSERT(dataLoc >= 0 && dataLoc < fFrameSize);
+                int64_t savedInputIdx = fp->fExtra[dataLoc];
+                U_ASSERT(savedInputIdx <= fp->fInputIdx);
+                if (savedInputIdx < fp->fInputIdx) {
+                    fp->fPatIdx = opValue;                               // JMP
+                } else {
+                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no progress in loop.
+                }
+            }
+            break;
+
+        case URX_LA_START:
+            {
+                // Entering a lookahead block.
+                // Save Stack Ptr, Input Pos.
+                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
+                fData[opValue]   = fStack->size();
+                fData[opValue+1] = fp->fInputIdx;
+                fActiveStart     = fLookStart;          // Set the match region change for
+                fActiveLimit     = fLookLimit;          //   transparent bounds.
+            }
+            break;
+
+        case URX_LA_END:
+            {
+                // Leaving a look-ahead block.
+                //  restore Stack Ptr, Input Pos to positions they had on entry to block.
+                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
+                int32_t stackSize = fStack->size();
+                int32_t newStackSize =(int32_t)fData[opValue];
+                U_ASSERT(stackSize >= newStackSize);
+                if (stackSize > newStackSize) {
+                    // Copy the current top frame back to the new (cut back) top frame.
+                    //   This makes the capture groups from within the look-ahead
+                    //   expression available.
+                    int64_t *newFP = fStack->getBuffer() + newStackSize - fFrameSize;
+                    int32_t j;
+                    for (j=0; j<fFrameSize; j++) {
+                        newFP[j] = ((int64_t *)fp)[j];
+                    }
+                    fp = (REStackFrame *)newFP;
+                    fStack->setSize(newStackSize);
+                }
+                fp->fInputIdx = fData[opValue+1];
+
+                // Restore the active region bounds in the input string; they may have
+                //    been changed because of transparent bounds on a Region.
+                fActiveStart = fRegionStart;
+                fActiveLimit = fRegionLimit;
+            }
+            break;
+
+        case URX_ONECHAR_I:
+            // Case insensitive one char.  The char from the pattern is already case folded.
+            // Input text is not, but case folding the input can not reduce two or more code
+            // points to one.
+            if (fp->fInputIdx < fActiveLimit) {
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                if (u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    break;
+                }
+            } else {
+                fHitEnd = TRUE;
+            }
+
+            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            break;
+
+        case URX_STRING_I:
+            {
+                // Case-insensitive test input against a literal string.
+                // Strings require two slots in the compiled pattern, one for the
+                //   offset to the string text, and one for the length.
+                //   The compiled string has already been case folded.
+                {
+                    const UChar *patternString = litText + opValue;
+                    int32_t      patternStringIdx  = 0;
+
+                    op      = (int32_t)pat[fp->fPatIdx];
+                    fp->fPatIdx++;
+                    opType  = URX_TYPE(op);
+                    opValue = URX_VAL(op);
+                    U_ASSERT(opType == URX_STRING_LEN);
+                    int32_t patternStringLen = opValue;  // Length of the string from the pattern.
+
+
+                    UChar32   cPattern;
+                    UChar32   cText;
+                    UBool     success = TRUE;
+
+                    UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                    CaseFoldingUTextIterator inputIterator(*fInputText);
+                    while (patternStringIdx < patternStringLen) {
+                        if (!inputIterator.inExpansion() && UTEXT_GETNATIVEINDEX(fInputText) >= fActiveLimit) {
+                            success = FALSE;
+                            fHitEnd = TRUE;
+                            break;
+                        }
+                        U16_NEXT(patternString, patternStringIdx, patternStringLen, cPattern);
+                        cText = inputIterator.next();
+                        if (cText != cPattern) {
+                            success = FALSE;
+                            break;
+                        }
+                    }
+                    if (inputIterator.inExpansion()) {
+                        success = FALSE;
+                    }
+
+                    if (success) {
+                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    } else {
+                        fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    }
+                }
+            }
+            break;
+
+        case URX_LB_START:
+            {
+                // Entering a look-behind block.
+                // Save Stack Ptr, Input Pos.
+                //   TODO:  implement transparent bounds.  Ticket #6067
+                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
+                fData[opValue]   = fStack->size();
+                fData[opValue+1] = fp->fInputIdx;
+                // Init the variable containing the start index for attempted matches.
+                fData[opValue+2] = -1;
+                // Save input string length, then reset to pin any matches to end at
+                //   the current position.
+                fData[opValue+3] = fActiveLimit;
+                fActiveLimit     = fp->fInputIdx;
+            }
+            break;
+
+
+        case URX_LB_CONT:
+            {
+                // Positive Look-Behind, at top of loop checking for matches of LB expression
+                //    at all possible input starting positions.
+
+                // Fetch the min and max possible match lengths.  They are the operands
+                //   of this op in the pattern.
+                int32_t minML = (int32_t)pat[fp->fPatIdx++];
+                int32_t maxML = (int32_t)pat[fp->fPatIdx++];
+                if (!UTEXT_USES_U16(fInputText)) {
+                    // utf-8 fix to maximum match length. The pattern compiler assumes utf-16.
+                    // The max length need not be exact; it just needs to be >= actual maximum.
+                    maxML *= 3;
+                }
+                U_ASSERT(minML <= maxML);
+                U_ASSERT(minML >= 0);
+
+                // Fetch (from data) the last input index where a match was attempted.
+                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
+                int64_t  &lbStartIdx = fData[opValue+2];
+                if (lbStartIdx < 0) {
+                    // First time through loop.
+                    lbStartIdx = fp->fInputIdx - minML;
+                    if (lbStartIdx > 0) {
+                        // move index to a code point boudary, if it's not on one already.
+                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
+                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    }
+                } else {
+                    // 2nd through nth time through the loop.
+                    // Back up start position for match by one.
+                    if (lbStartIdx == 0) {
+                        (lbStartIdx)--;
+                    } else {
+                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
+                        (void)UTEXT_PREVIOUS32(fInputText);
+                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    }
+                }
+
+                if (lbStartIdx < 0 || lbStartIdx < fp->fInputIdx - maxML) {
+                    // We have tried all potential match starting points without
+                    //  getting a match.  Backtrack out, and out of the
+                    //   Look Behind altogether.
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    int64_t restoreInputLen = fData[opValue+3];
+                    U_ASSERT(restoreInputLen >= fActiveLimit);
+                    U_ASSERT(restoreInputLen <= fInputLength);
+                    fActiveLimit = restoreInputLen;
+                    break;
+                }
+
+                //    Save state to this URX_LB_CONT op, so failure to match will repeat the loop.
+                //      (successful match will fall off the end of the loop.)
+                fp = StateSave(fp, fp->fPatIdx-3, status);
+                fp->fInputIdx = lbStartIdx;
+            }
+            break;
+
+        case URX_LB_END:
+            // End of a look-behind block, after a successful match.
+            {
+                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
+                if (fp->fInputIdx != fActiveLimit) {
+                    //  The look-behind expression matched, but the match did not
+                    //    extend all the way to the point that we are looking behind from.
+                    //  FAIL out of here, which will take us back to the LB_CONT, which
+                    //     will retry the match starting at another position or fail
+                    //     the look-behind altogether, whichever is appropriate.
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+
+                // Look-behind match is good.  Restore the orignal input string length,
+                //   which had been truncated to pin the end of the lookbehind match to the
+                //   position being looked-behind.
+                int64_t originalInputLen = fData[opValue+3];
+                U_ASSERT(originalInputLen >= fActiveLimit);
+                U_ASSERT(originalInputLen <= fInputLength);
+                fActiveLimit = originalInputLen;
+            }
+            break;
+
+
+        case URX_LBN_CONT:
+            {
+                // Negative Look-Behind, at top of loop checking for matches of LB expression
+                //    at all possible input starting positions.
+
+                // Fetch the extra parameters of this op.
+                int32_t minML       = (int32_t)pat[fp->fPatIdx++];
+                int32_t maxML       = (int32_t)pat[fp->fPatIdx++];
+                if (!UTEXT_USES_U16(fInputText)) {
+                    // utf-8 fix to maximum match length. The pattern compiler assumes utf-16.
+                    // The max length need not be exact; it just needs to be >= actual maximum.
+                    maxML *= 3;
+                }
+                int32_t continueLoc = (int32_t)pat[fp->fPatIdx++];
+                        continueLoc = URX_VAL(continueLoc);
+                U_ASSERT(minML <= maxML);
+                U_ASSERT(minML >= 0);
+                U_ASSERT(continueLoc > fp->fPatIdx);
+
+                // Fetch (from data) the last input index where a match was attempted.
+                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
+                int64_t  &lbStartIdx = fData[opValue+2];
+                if (lbStartIdx < 0) {
+                    // First time through loop.
+                    lbStartIdx = fp->fInputIdx - minML;
+                    if (lbStartIdx > 0) {
+                        // move index to a code point boudary, if it's not on one already.
+                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
+                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    }
+                } else {
+                    // 2nd through nth time through the loop.
+                    // Back up start position for match by one.
+                    if (lbStartIdx == 0) {
+                        (lbStartIdx)--;
+                    } else {
+                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
+                        (void)UTEXT_PREVIOUS32(fInputText);
+                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    }
+                }
+
+                if (lbStartIdx < 0 || lbStartIdx < fp->fInputIdx - maxML) {
+                    // We have tried all potential match starting points without
+                    //  getting a match, which means that the negative lookbehind as
+                    //  a whole has succeeded.  Jump forward to the continue location
+                    int64_t restoreInputLen = fData[opValue+3];
+                    U_ASSERT(restoreInputLen >= fActiveLimit);
+                    U_ASSERT(restoreInputLen <= fInputLength);
+                    fActiveLimit = restoreInputLen;
+                    fp->fPatIdx = continueLoc;
+                    break;
+                }
+
+                //    Save state to this URX_LB_CONT op, so failure to match will repeat the loop.
+                //      (successful match will cause a FAIL out of the loop altogether.)
+                fp = StateSave(fp, fp->fPatIdx-4, status);
+                fp->fInputIdx = lbStartIdx;
+            }
+            break;
+
+        case URX_LBN_END:
+            // End of a negative look-behind block, after a successful match.
+            {
+                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
+                if (fp->fInputIdx != fActiveLimit) {
+                    //  The look-behind expression matched, but the match did not
+                    //    extend all the way to the point that we are looking behind from.
+                    //  FAIL out of here, which will take us back to the LB_CONT, which
+                    //     will retry the match starting at another position or succeed
+                    //     the look-behind altogether, whichever is appropriate.
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
+
+                // Look-behind expression matched, which means look-behind test as
+                //   a whole Fails
+
+                //   Restore the orignal input string length, which had been truncated
+                //   inorder to pin the end of the lookbehind match
+                //   to the position being looked-behind.
+                int64_t originalInputLen = fData[opValue+3];
+                U_ASSERT(originalInputLen >= fActiveLimit);
+                U_ASSERT(originalInputLen <= fInputLength);
+                fActiveLimit = originalInputLen;
+
+                // Restore original stack position, discarding any state saved
+                //   by the successful pattern match.
+                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
+                int32_t newStackSize = (int32_t)fData[opValue];
+                U_ASSERT(fStack->size() > newStackSize);
+                fStack->setSize(newStackSize);
+
+                //  FAIL, which will take control back to someplace
+                //  prior to entering the look-behind test.
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            }
+            break;
+
+
+        case URX_LOOP_SR_I:
+            // Loop Initialization for the optimized implementation of
+            //     [some character set]*
+            //   This op scans through all matching input.
+            //   The following LOOP_C op emulates stack unwinding if the following pattern fails.
+            {
+                U_ASSERT(opValue > 0 && opValue < fSets->size());
+                Regex8BitSet *s8 = &fPattern->fSets8[opValue];
+                UnicodeSet   *s  = (UnicodeSet *)fSets->elementAt(opValue);
+
+                // Loop through input, until either the input is exhausted or
+                //   we reach a character that is not a member of the set.
+                int64_t ix = fp->fInputIdx;
+                UTEXT_SETNATIVEINDEX(fInputText, ix);
+                for (;;) {
+                    if (ix >= fActiveLimit) {
+                        fHitEnd = TRUE;
+                        break;
+                    }
+                    UChar32 c = UTEXT_NEXT32(fInputText);
+                    if (c<256) {
+                        if (s8->contains(c) == FALSE) {
+                            break;
+                        }
+                    } else {
+                        if (s->contains(c) == FALSE) {
+                            break;
+                        }
+                    }
+                    ix = UTEXT_GETNATIVEINDEX(fInputText);
+                }
+
+                // If there were no matching characters, skip over the loop altogether.
+                //   The loop doesn't run at all, a * op always succeeds.
+                if (ix == fp->fInputIdx) {
+                    fp->fPatIdx++;   // skip the URX_LOOP_C op.
+                    break;
+                }
+
+                // Peek ahead in the compiled pattern, to the URX_LOOP_C that
+                //   must follow.  It's operand is the stack location
+                //   that holds the starting input index for the match of this [set]*
+                int32_t loopcOp = (int32_t)pat[fp->fPatIdx];
+                U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
+                int32_t stackLoc = URX_VAL(loopcOp);
+                U_ASSERT(stackLoc >= 0 && stackLoc < fFrameSize);
+                fp->fExtra[stackLoc] = fp->fInputIdx;
+                fp->fInputIdx = ix;
+
+                // Save State to the URX_LOOP_C op that follows this one,
+                //   so that match failures in the following code will return to there.
+                //   Then bump the pattern idx so the LOOP_C is skipped on the way out of here.
+                fp = StateSave(fp, fp->fPatIdx, status);
+                fp->fPatIdx++;
+            }
+            break;
+
+
+        case URX_LOOP_DOT_I:
+            // Loop Initialization for the optimized implementation of .*
+            //   This op scans through all remaining input.
+            //   The following LOOP_C op emulates stack unwinding if the following pattern fails.
+            {
+                // Loop through input until the input is exhausted (we reach an end-of-line)
+                // In DOTALL mode, we can just go straight to the end of the input.
+                int64_t ix;
+                if ((opValue & 1) == 1) {
+                    // Dot-matches-All mode.  Jump straight to the end of the string.
+                    ix = fActiveLimit;
+                    fHitEnd = TRUE;
+                } else {
+                    // NOT DOT ALL mode.  Line endings do not match '.'
+                    // Scan forward until a line ending or end of input.
+                    ix = fp->fInputIdx;
+                    UTEXT_SETNATIVEINDEX(fInputText, ix);
+                    for (;;) {
+                        if (ix >= fActiveLimit) {
+                            fHitEnd = TRUE;
+                            break;
+                        }
+                        UChar32 c = UTEXT_NEXT32(fInputText);
+                        if ((c & 0x7f) <= 0x29) {          // Fast filter of non-new-line-s
+                            if ((c == 0x0a) ||             //  0x0a is newline in both modes.
+                               (((opValue & 2) == 0) &&    // IF not UNIX_LINES mode
+                                    isLineTerminator(c))) {
+                                //  char is a line ending.  Exit the scanning loop.
+                                break;
+                            }
+                        }
+                        ix = UTEXT_GETNATIVEINDEX(fInputText);
+                    }
+                }
+
+                // If there were no matching characters, skip over the loop altogether.
+                //   The loop doesn't run at all, a * op always succeeds.
+                if (ix == fp->fInputIdx) {
+                    fp->fPatIdx++;   // skip the URX_LOOP_C op.
+                    break;
+                }
+
+                // Peek ahead in the compiled pattern, to the URX_LOOP_C that
+                //   must follow.  It's operand is the stack location
+                //   that holds the starting input index for the match of this .*
+                int32_t loopcOp = (int32_t)pat[fp->fPatIdx];
+                U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
+                int32_t stackLoc = URX_VAL(loopcOp);
+                U_ASSERT(stackLoc >= 0 && stackLoc < fFrameSize);
+                fp->fExtra[stackLoc] = fp->fInputIdx;
+                fp->fInputIdx = ix;
+
+                // Save State to the URX_LOOP_C op that follows this one,
+                //   so that match failures in the following code will return to there.
+                //   Then bump the pattern idx so the LOOP_C is skipped on the way out of here.
+                fp = StateSave(fp, fp->fPatIdx, status);
+                fp->fPatIdx++;
+            }
+            break;
+
+
+        case URX_LOOP_C:
+            {
+                U_ASSERT(opValue>=0 && opValue<fFrameSize);
+                backSearchIndex = fp->fExtra[opValue];
+                U_ASSERT(backSearchIndex <= fp->fInputIdx);
+                if (backSearchIndex == fp->fInputIdx) {
+                    // We've backed up the input idx to the point that the loop started.
+                    // The loop is done.  Leave here without saving state.
+                    //  Subsequent failures won't come back here.
+                    break;
+                }
+                // Set up for the next iteration of the loop, with input index
+                //   backed up by one from the last time through,
+                //   and a state save to this instruction in case the following code fails again.
+                //   (We're going backwards because this loop emulates stack unwinding, not
+                //    the initial scan forward.)
+                U_ASSERT(fp->fInputIdx > 0);
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                UChar32 prevC = UTEXT_PREVIOUS32(fInputText);
+                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+
+                UChar32 twoPrevC = UTEXT_PREVIOUS32(fInputText);
+                if (prevC == 0x0a &&
+                    fp->fInputIdx > backSearchIndex &&
+                    twoPrevC == 0x0d) {
+                    int32_t prevOp = (int32_t)pat[fp->fPatIdx-2];
+                    if (URX_TYPE(prevOp) == URX_LOOP_DOT_I) {
+                        // .*, stepping back over CRLF pair.
+                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    }
+                }
+
 
-    // Back up until we come to a non-combining char, determine whether
-    //  that char is a word char.
-    UBool prevCIsWord = FALSE;
-    for (;;) {
-        if (pos <= fLookStart) {
-            break;
-        }
-        UChar32 prevChar;
-        U16_PREV(inputBuf, fLookStart, pos, prevChar);
-        if (!(u_hasBinaryProperty(prevChar, UCHAR_GRAPHEME_EXTEND)
-              || u_charType(prevChar) == U_FORMAT_CHAR)) {
-            prevCIsWord = fPattern->fStaticSets[URX_ISWORD_SET]->contains(prevChar);
+                fp = StateSave(fp, fp->fPatIdx-1, status);
+            }
             break;
-        }
-    }
-    isBoundary = cIsWord ^ prevCIsWord;
-    return isBoundary;
-}
 
-//--------------------------------------------------------------------------------
-//
-//   isUWordBoundary
-//
-//         Test for a word boundary using RBBI word break.
-//
-//          parameters:   pos   - the current position in the input buffer
-//
-//--------------------------------------------------------------------------------
-UBool RegexMatcher::isUWordBoundary(int64_t pos) {
-    UBool       returnVal = FALSE;
-#if UCONFIG_NO_BREAK_ITERATION==0
 
-    // If we haven't yet created a break iterator for this matcher, do it now.
-    if (fWordBreakItr == NULL) {
-        fWordBreakItr =
-            (RuleBasedBreakIterator *)BreakIterator::createWordInstance(Locale::getEnglish(), fDeferredStatus);
-        if (U_FAILURE(fDeferredStatus)) {
-            return FALSE;
-        }
-        fWordBreakItr->setText(fInputText, fDeferredStatus);
-    }
 
-    if (pos >= fLookLimit) {
-        fHitEnd = TRUE;
-        returnVal = TRUE;   // With Unicode word rules, only positions within the interior of "real"
-                            //    words are not boundaries.  All non-word chars stand by themselves,
-                            //    with word boundaries on both sides.
-    } else {
-        if (!UTEXT_USES_U16(fInputText)) {
-            // !!!: Would like a better way to do this!
-            UErrorCode status = U_ZERO_ERROR;
-            pos = utext_extract(fInputText, 0, pos, NULL, 0, &status);
+        default:
+            // Trouble.  The compiled pattern contains an entry with an
+            //           unrecognized type tag.
+            U_ASSERT(FALSE);
         }
-        returnVal = fWordBreakItr->isBoundary((int32_t)pos);
-    }
-#endif
-    return   returnVal;
-}
 
-//--------------------------------------------------------------------------------
-//
-//   IncrementTime     This function is called once each TIMER_INITIAL_VALUE state
-//                     saves. Increment the "time" counter, and call the
-//                     user callback function if there is one installed.
-//
-//                     If the match operation needs to be aborted, either for a time-out
-//                     or because the user callback asked for it, just set an error status.
-//                     The engine will pick that up and stop in its outer loop.
-//
-//--------------------------------------------------------------------------------
-void RegexMatcher::IncrementTime(UErrorCode &status) {
-    fTickCounter = TIMER_INITIAL_VALUE;
-    fTime++;
-    if (fCallbackFn != NULL) {
-        if ((*fCallbackFn)(fCallbackContext, fTime) == FALSE) {
-            status = U_REGEX_STOPPED_BY_CALLER;
-            return;
+        if (U_FAILURE(status)) {
+            isMatch = FALSE;
+            break;
         }
     }
-    if (fTimeLimit > 0 && fTime >= fTimeLimit) {
-        status = U_REGEX_TIME_OUT;
-    }
-}
 
-//--------------------------------------------------------------------------------
-//
-//   StateSave
-//       Make a new stack frame, initialized as a copy of the current stack frame.
-//       Set the pattern index in the original stack frame from the operand value
-//       in the opcode.  Execution of the engine continues with the state in
-//       the newly created stack frame
-//
-//       Note that reserveBlock() may grow the stack, resulting in the
-//       whole thing being relocated in memory.
-//
-//    Parameters:
-//       fp           The top frame pointer when called.  At return, a new
-//                    fame will be present
-//       savePatIdx   An index into the compiled pattern.  Goes into the original
-//                    (not new) frame.  If execution ever back-tracks out of the
-//                    new frame, this will be where we continue from in the pattern.
-//    Return
-//                    The new frame pointer.
-//
-//--------------------------------------------------------------------------------
-inline REStackFrame *RegexMatcher::StateSave(REStackFrame *fp, int64_t savePatIdx, UErrorCode &status) {
-    if (U_FAILURE(status)) {
-        return fp;
-    }
-    // push storage for a new frame.
-    int64_t *newFP = fStack->reserveBlock(fFrameSize, status);
-    if (U_FAILURE(status)) {
-        // Failure on attempted stack expansion.
-        //   Stack function set some other error code, change it to a more
-        //   specific one for regular expressions.
-        status = U_REGEX_STACK_OVERFLOW;
-        // We need to return a writable stack frame, so just return the
-        //    previous frame.  The match operation will stop quickly
-        //    because of the error status, after which the frame will never
-        //    be looked at again.
-        return fp;
+breakFromLoop:
+    fMatch = isMatch;
+    if (isMatch) {
+        fLastMatchEnd = fMatchEnd;
+        fMatchStart   = startIdx;
+        fMatchEnd     = fp->fInputIdx;
     }
-    fp = (REStackFrame *)(newFP - fFrameSize);  // in case of realloc of stack.
 
-    // New stack frame = copy of old top frame.
-    int64_t *source = (int64_t *)fp;
-    int64_t *dest   = newFP;
-    for (;;) {
-        *dest++ = *source++;
-        if (source == newFP) {
-            break;
+#ifdef REGEX_RUN_DEBUG
+    if (fTraceDebug) {
+        if (isMatch) {
+            printf("Match.  start=%ld   end=%ld\n\n", fMatchStart, fMatchEnd);
+        } else {
+            printf("No match\n\n");
         }
     }
+#endif
 
-    fTickCounter--;
-    if (fTickCounter <= 0) {
-       IncrementTime(status);    // Re-initializes fTickCounter
-    }
-    fp->fPatIdx = savePatIdx;
-    return (REStackFrame *)newFP;
-}
-
-#if defined(REGEX_DEBUG)
-namespace {
-UnicodeString StringFromUText(UText *ut) {
-    UnicodeString result;
-    for (UChar32 c = utext_next32From(ut, 0); c != U_SENTINEL; c = UTEXT_NEXT32(ut)) {
-        result.append(c);
-    }
-    return result;
-}
+    fFrame = fp;                // The active stack frame when the engine stopped.
+                                //   Contains the capture group results that we need to
+                                //    access later.
+    return;
 }
-#endif // REGEX_DEBUG
 
 
 //--------------------------------------------------------------------------------
 //
-//   MatchAt      This is the actual matching engine.
+//   MatchChunkAt   This is the actual matching engine. Like MatchAt, but with the
+//                  assumption that the entire string is available in the UText's
+//                  chunk buffer. For now, that means we can use int32_t indexes,
+//                  except for anything that needs to be saved (like group starts
+//                  and ends).
 //
 //                  startIdx:    begin matching a this index.
 //                  toEnd:       if true, match must extend to end of the input region
 //
 //--------------------------------------------------------------------------------
-void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
+void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &status) {
     UBool       isMatch  = FALSE;      // True if the we have a match.
 
-    int64_t     backSearchIndex = U_INT64_MAX; // used after greedy single-character matches for searching backwards
+    int32_t     backSearchIndex = INT32_MAX; // used after greedy single-character matches for searching backwards
 
     int32_t     op;                    // Operation from the compiled pattern, split into
     int32_t     opType;                //    the opcode
@@ -2759,7 +4891,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
 #ifdef REGEX_RUN_DEBUG
     if (fTraceDebug) {
-        printf("MatchAt(startIdx=%ld)\n", startIdx);
+        printf("MatchAt(startIdx=%d)\n", startIdx);
         printf("Original Pattern: \"%s\"\n", CStr(StringFromUText(fPattern->fPattern))());
         printf("Input String:     \"%s\"\n\n", CStr(StringFromUText(fInputText))());
     }
@@ -2776,6 +4908,8 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
     const UChar         *litText       = fPattern->fLiteralText.getBuffer();
     UVector             *fSets         = fPattern->fSets;
 
+    const UChar         *inputBuf      = fInputText->chunkContents;
+
     fFrameSize = fPattern->fFrameSize;
     REStackFrame        *fp            = resetStack();
     if (U_FAILURE(fDeferredStatus)) {
@@ -2804,7 +4938,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
         if (fTraceDebug) {
             UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
             printf("inputIdx=%ld   inputChar=%x   sp=%3ld   activeLimit=%ld  ", fp->fInputIdx,
-                UTEXT_CURRENT32(fInputText), (int64_t *)fp-fStack->getBuffer(), fActiveLimit);
+                   UTEXT_CURRENT32(fInputText), (int64_t *)fp-fStack->getBuffer(), fActiveLimit);
             fPattern->dumpOp(fp->fPatIdx);
         }
 #endif
@@ -2827,10 +4961,9 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
         case URX_ONECHAR:
             if (fp->fInputIdx < fActiveLimit) {
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 if (c == opValue) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                     break;
                 }
             } else {
@@ -2845,37 +4978,35 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 // Test input against a literal string.
                 // Strings require two slots in the compiled pattern, one for the
                 //   offset to the string text, and one for the length.
-
                 int32_t   stringStartIdx = opValue;
+                int32_t   stringLen;
+
                 op      = (int32_t)pat[fp->fPatIdx];     // Fetch the second operand
                 fp->fPatIdx++;
                 opType    = URX_TYPE(op);
-                int32_t stringLen = URX_VAL(op);
+                stringLen = URX_VAL(op);
                 U_ASSERT(opType == URX_STRING_LEN);
                 U_ASSERT(stringLen >= 2);
 
-                const UChar *patternString = litText+stringStartIdx;
-                int32_t patternStringIndex = 0;
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 inputChar;
-                UChar32 patternChar;
+                const UChar * pInp = inputBuf + fp->fInputIdx;
+                const UChar * pInpLimit = inputBuf + fActiveLimit;
+                const UChar * pPat = litText+stringStartIdx;
+                const UChar * pEnd = pInp + stringLen;
                 UBool success = TRUE;
-                while (patternStringIndex < stringLen) {
-                    if (UTEXT_GETNATIVEINDEX(fInputText) >= fActiveLimit) {
-                        success = FALSE;
+                while (pInp < pEnd) {
+                    if (pInp >= pInpLimit) {
                         fHitEnd = TRUE;
+                        success = FALSE;
                         break;
                     }
-                    inputChar = UTEXT_NEXT32(fInputText);
-                    U16_NEXT(patternString, patternStringIndex, stringLen, patternChar);
-                    if (patternChar != inputChar) {
+                    if (*pInp++ != *pPat++) {
                         success = FALSE;
                         break;
                     }
                 }
 
                 if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx += stringLen;
                 } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
@@ -2899,7 +5030,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             isMatch = TRUE;
             goto  breakFromLoop;
 
-        // Start and End Capture stack frame variables are laid out out like this:
+            // Start and End Capture stack frame variables are laid out out like this:
             //  fp->fExtra[opValue]  - The start of a completed capture group
             //             opValue+1 - The end   of a completed capture group
             //             opValue+2 - the start of a capture group whose end
@@ -2920,56 +5051,58 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
 
         case URX_DOLLAR:                   //  $, test for End of line
-                                           //     or for position before new line at end of input
-            {
-                if (fp->fInputIdx >= fAnchorLimit) {
-                    // We really are at the end of input.  Success.
-                    fHitEnd = TRUE;
-                    fRequireEnd = TRUE;
-                    break;
-                }
-
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-
-                // If we are positioned just before a new-line that is located at the
-                //   end of input, succeed.
-                UChar32 c = UTEXT_NEXT32(fInputText);
-                if (UTEXT_GETNATIVEINDEX(fInputText) >= fAnchorLimit) {
-                    if (isLineTerminator(c)) {
-                        // If not in the middle of a CR/LF sequence
-                        if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && ((void)UTEXT_PREVIOUS32(fInputText), UTEXT_PREVIOUS32(fInputText))==0x0d)) {
-                            // At new-line at end of input. Success
-                            fHitEnd = TRUE;
-                            fRequireEnd = TRUE;
+            //     or for position before new line at end of input
+            if (fp->fInputIdx < fAnchorLimit-2) {
+                // We are no where near the end of input.  Fail.
+                //   This is the common case.  Keep it first.
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                break;
+            }
+            if (fp->fInputIdx >= fAnchorLimit) {
+                // We really are at the end of input.  Success.
+                fHitEnd = TRUE;
+                fRequireEnd = TRUE;
+                break;
+            }
 
-                            break;
-                        }
-                    }
-                } else {
-                    UChar32 nextC = UTEXT_NEXT32(fInputText);
-                    if (c == 0x0d && nextC == 0x0a && UTEXT_GETNATIVEINDEX(fInputText) >= fAnchorLimit) {
+            // If we are positioned just before a new-line that is located at the
+            //   end of input, succeed.
+            if (fp->fInputIdx == fAnchorLimit-1) {
+                UChar32 c;
+                U16_GET(inputBuf, fAnchorStart, fp->fInputIdx, fAnchorLimit, c);
+
+                if (isLineTerminator(c)) {
+                    if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && inputBuf[fp->fInputIdx-1]==0x0d)) {
+                        // At new-line at end of input. Success
                         fHitEnd = TRUE;
                         fRequireEnd = TRUE;
-                        break;                         // At CR/LF at end of input.  Success
+                        break;
                     }
                 }
-
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            } else if (fp->fInputIdx == fAnchorLimit-2 &&
+                inputBuf[fp->fInputIdx]==0x0d && inputBuf[fp->fInputIdx+1]==0x0a) {
+                    fHitEnd = TRUE;
+                    fRequireEnd = TRUE;
+                    break;                         // At CR/LF at end of input.  Success
             }
+
+            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+
             break;
 
 
-         case URX_DOLLAR_D:                   //  $, test for End of Line, in UNIX_LINES mode.
-            if (fp->fInputIdx >= fAnchorLimit) {
-                // Off the end of input.  Success.
-                fHitEnd = TRUE;
-                fRequireEnd = TRUE;
-                break;
-            } else {
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+        case URX_DOLLAR_D:                   //  $, test for End of Line, in UNIX_LINES mode.
+            if (fp->fInputIdx >= fAnchorLimit-1) {
                 // Either at the last character of input, or off the end.
-                if (c == 0x0a && UTEXT_GETNATIVEINDEX(fInputText) == fAnchorLimit) {
+                if (fp->fInputIdx == fAnchorLimit-1) {
+                    // At last char of input.  Success if it's a new line.
+                    if (inputBuf[fp->fInputIdx] == 0x0a) {
+                        fHitEnd = TRUE;
+                        fRequireEnd = TRUE;
+                        break;
+                    }
+                } else {
+                    // Off the end of input.  Success.
                     fHitEnd = TRUE;
                     fRequireEnd = TRUE;
                     break;
@@ -2981,99 +5114,96 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             break;
 
 
-         case URX_DOLLAR_M:                //  $, test for End of line in multi-line mode
-             {
-                 if (fp->fInputIdx >= fAnchorLimit) {
-                     // We really are at the end of input.  Success.
-                     fHitEnd = TRUE;
-                     fRequireEnd = TRUE;
-                     break;
-                 }
-                 // If we are positioned just before a new-line, succeed.
-                 // It makes no difference where the new-line is within the input.
-                 UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                 UChar32 c = UTEXT_CURRENT32(fInputText);
-                 if (isLineTerminator(c)) {
-                     // At a line end, except for the odd chance of  being in the middle of a CR/LF sequence
-                     //  In multi-line mode, hitting a new-line just before the end of input does not
-                     //   set the hitEnd or requireEnd flags
-                     if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && UTEXT_PREVIOUS32(fInputText)==0x0d)) {
+        case URX_DOLLAR_M:                //  $, test for End of line in multi-line mode
+            {
+                if (fp->fInputIdx >= fAnchorLimit) {
+                    // We really are at the end of input.  Success.
+                    fHitEnd = TRUE;
+                    fRequireEnd = TRUE;
+                    break;
+                }
+                // If we are positioned just before a new-line, succeed.
+                // It makes no difference where the new-line is within the input.
+                UChar32 c = inputBuf[fp->fInputIdx];
+                if (isLineTerminator(c)) {
+                    // At a line end, except for the odd chance of  being in the middle of a CR/LF sequence
+                    //  In multi-line mode, hitting a new-line just before the end of input does not
+                    //   set the hitEnd or requireEnd flags
+                    if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && inputBuf[fp->fInputIdx-1]==0x0d)) {
                         break;
-                     }
-                 }
-                 // not at a new line.  Fail.
-                 fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-             }
-             break;
+                    }
+                }
+                // not at a new line.  Fail.
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            }
+            break;
 
 
-         case URX_DOLLAR_MD:                //  $, test for End of line in multi-line and UNIX_LINES mode
-             {
-                 if (fp->fInputIdx >= fAnchorLimit) {
-                     // We really are at the end of input.  Success.
-                     fHitEnd = TRUE;
-                     fRequireEnd = TRUE;  // Java set requireEnd in this case, even though
-                     break;               //   adding a new-line would not lose the match.
-                 }
-                 // If we are not positioned just before a new-line, the test fails; backtrack out.
-                 // It makes no difference where the new-line is within the input.
-                 UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                 if (UTEXT_CURRENT32(fInputText) != 0x0a) {
-                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                 }
-             }
-             break;
+        case URX_DOLLAR_MD:                //  $, test for End of line in multi-line and UNIX_LINES mode
+            {
+                if (fp->fInputIdx >= fAnchorLimit) {
+                    // We really are at the end of input.  Success.
+                    fHitEnd = TRUE;
+                    fRequireEnd = TRUE;  // Java set requireEnd in this case, even though
+                    break;               //   adding a new-line would not lose the match.
+                }
+                // If we are not positioned just before a new-line, the test fails; backtrack out.
+                // It makes no difference where the new-line is within the input.
+                if (inputBuf[fp->fInputIdx] != 0x0a) {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
 
 
-       case URX_CARET:                    //  ^, test for start of line
+        case URX_CARET:                    //  ^, test for start of line
             if (fp->fInputIdx != fAnchorStart) {
                 fp = (REStackFrame *)fStack->popFrame(fFrameSize);
             }
             break;
 
 
-       case URX_CARET_M:                   //  ^, test for start of line in mulit-line mode
-           {
-               if (fp->fInputIdx == fAnchorStart) {
-                   // We are at the start input.  Success.
-                   break;
-               }
-               // Check whether character just before the current pos is a new-line
-               //   unless we are at the end of input
-               UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-               UChar32  c = UTEXT_PREVIOUS32(fInputText);
-               if ((fp->fInputIdx < fAnchorLimit) && isLineTerminator(c)) {
-                   //  It's a new-line.  ^ is true.  Success.
-                   //  TODO:  what should be done with positions between a CR and LF?
-                   break;
-               }
-               // Not at the start of a line.  Fail.
-               fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-           }
-           break;
+        case URX_CARET_M:                   //  ^, test for start of line in mulit-line mode
+            {
+                if (fp->fInputIdx == fAnchorStart) {
+                    // We are at the start input.  Success.
+                    break;
+                }
+                // Check whether character just before the current pos is a new-line
+                //   unless we are at the end of input
+                UChar  c = inputBuf[fp->fInputIdx - 1];
+                if ((fp->fInputIdx < fAnchorLimit) &&
+                    isLineTerminator(c)) {
+                    //  It's a new-line.  ^ is true.  Success.
+                    //  TODO:  what should be done with positions between a CR and LF?
+                    break;
+                }
+                // Not at the start of a line.  Fail.
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            }
+            break;
 
 
-       case URX_CARET_M_UNIX:       //  ^, test for start of line in mulit-line + Unix-line mode
-           {
-               U_ASSERT(fp->fInputIdx >= fAnchorStart);
-               if (fp->fInputIdx <= fAnchorStart) {
-                   // We are at the start input.  Success.
-                   break;
-               }
-               // Check whether character just before the current pos is a new-line
-               U_ASSERT(fp->fInputIdx <= fAnchorLimit);
-               UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-               UChar32  c = UTEXT_PREVIOUS32(fInputText);
-               if (c != 0x0a) {
-                   // Not at the start of a line.  Back-track out.
-                   fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-               }
-           }
-           break;
+        case URX_CARET_M_UNIX:       //  ^, test for start of line in mulit-line + Unix-line mode
+            {
+                U_ASSERT(fp->fInputIdx >= fAnchorStart);
+                if (fp->fInputIdx <= fAnchorStart) {
+                    // We are at the start input.  Success.
+                    break;
+                }
+                // Check whether character just before the current pos is a new-line
+                U_ASSERT(fp->fInputIdx <= fAnchorLimit);
+                UChar  c = inputBuf[fp->fInputIdx - 1];
+                if (c != 0x0a) {
+                    // Not at the start of a line.  Back-track out.
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                }
+            }
+            break;
 
         case URX_BACKSLASH_B:          // Test for word boundaries
             {
-                UBool success = isWordBoundary(fp->fInputIdx);
+                UBool success = isChunkWordBoundary((int32_t)fp->fInputIdx);
                 success ^= (UBool)(opValue != 0);     // flip sense for \B
                 if (!success) {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
@@ -3101,15 +5231,12 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     break;
                 }
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 int8_t ctype = u_charType(c);     // TODO:  make a unicode set for this.  Will be faster.
                 UBool success = (ctype == U_DECIMAL_DIGIT_NUMBER);
                 success ^= (UBool)(opValue != 0);        // flip sense for \D
-                if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                } else {
+                if (!success) {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
@@ -3130,14 +5257,12 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                     break;
                 }
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 int8_t ctype = u_charType(c);
                 UBool success = (ctype == U_SPACE_SEPARATOR || c == 9);  // SPACE_SEPARATOR || TAB
                 success ^= (UBool)(opValue != 0);        // flip sense for \H
-                if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                } else {
+                if (!success) {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
@@ -3151,13 +5276,17 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                     break;
                 }
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 if (isLineTerminator(c)) {
-                    if (c == 0x0d && utext_current32(fInputText) == 0x0a) {
-                        utext_next32(fInputText);
+                    if (c == 0x0d && fp->fInputIdx < fActiveLimit) {
+                        // Check for CR/LF sequence. Consume both together when found.
+                        UChar c2;
+                        U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c2);
+                        if (c2 != 0x0a) {
+                            U16_PREV(inputBuf, 0, fp->fInputIdx, c2);
+                        }
                     }
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                 } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
@@ -3165,118 +5294,106 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             break;
 
 
-        case URX_BACKSLASH_V:            // \v, any single line ending character.
+        case URX_BACKSLASH_V:         // Any single code point line ending.
             {
                 if (fp->fInputIdx >= fActiveLimit) {
                     fHitEnd = TRUE;
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                     break;
                 }
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 UBool success = isLineTerminator(c);
                 success ^= (UBool)(opValue != 0);        // flip sense for \V
-                if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                } else {
+                if (!success) {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
             break;
 
 
-        case URX_BACKSLASH_X:
-            //  Match a Grapheme, as defined by Unicode TR 29.
-            //  Differs slightly from Perl, which consumes combining marks independently
-            //    of context.
-            {
 
-                // Fail if at end of input
-                if (fp->fInputIdx >= fActiveLimit) {
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
+        case URX_BACKSLASH_X:
+        //  Match a Grapheme, as defined by Unicode TR 29.
+        //  Differs slightly from Perl, which consumes combining marks independently
+        //    of context.
+        {
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+            // Fail if at end of input
+            if (fp->fInputIdx >= fActiveLimit) {
+                fHitEnd = TRUE;
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                break;
+            }
 
-                // Examine (and consume) the current char.
-                //   Dispatch into a little state machine, based on the char.
-                UChar32  c;
-                c = UTEXT_NEXT32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                UnicodeSet **sets = fPattern->fStaticSets;
-                if (sets[URX_GC_NORMAL]->contains(c))  goto GC_Extend;
-                if (sets[URX_GC_CONTROL]->contains(c)) goto GC_Control;
-                if (sets[URX_GC_L]->contains(c))       goto GC_L;
-                if (sets[URX_GC_LV]->contains(c))      goto GC_V;
-                if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
-                if (sets[URX_GC_V]->contains(c))       goto GC_V;
-                if (sets[URX_GC_T]->contains(c))       goto GC_T;
-                goto GC_Extend;
+            // Examine (and consume) the current char.
+            //   Dispatch into a little state machine, based on the char.
+            UChar32  c;
+            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+            UnicodeSet **sets = fPattern->fStaticSets;
+            if (sets[URX_GC_NORMAL]->contains(c))  goto GC_Extend;
+            if (sets[URX_GC_CONTROL]->contains(c)) goto GC_Control;
+            if (sets[URX_GC_L]->contains(c))       goto GC_L;
+            if (sets[URX_GC_LV]->contains(c))      goto GC_V;
+            if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
+            if (sets[URX_GC_V]->contains(c))       goto GC_V;
+            if (sets[URX_GC_T]->contains(c))       goto GC_T;
+            goto GC_Extend;
 
 
 
 GC_L:
-                if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-                c = UTEXT_NEXT32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                if (sets[URX_GC_L]->contains(c))       goto GC_L;
-                if (sets[URX_GC_LV]->contains(c))      goto GC_V;
-                if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
-                if (sets[URX_GC_V]->contains(c))       goto GC_V;
-                (void)UTEXT_PREVIOUS32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                goto GC_Extend;
+            if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
+            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+            if (sets[URX_GC_L]->contains(c))       goto GC_L;
+            if (sets[URX_GC_LV]->contains(c))      goto GC_V;
+            if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
+            if (sets[URX_GC_V]->contains(c))       goto GC_V;
+            U16_PREV(inputBuf, 0, fp->fInputIdx, c);
+            goto GC_Extend;
 
 GC_V:
-                if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-                c = UTEXT_NEXT32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                if (sets[URX_GC_V]->contains(c))       goto GC_V;
-                if (sets[URX_GC_T]->contains(c))       goto GC_T;
-                (void)UTEXT_PREVIOUS32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                goto GC_Extend;
+            if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
+            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+            if (sets[URX_GC_V]->contains(c))       goto GC_V;
+            if (sets[URX_GC_T]->contains(c))       goto GC_T;
+            U16_PREV(inputBuf, 0, fp->fInputIdx, c);
+            goto GC_Extend;
 
 GC_T:
-                if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-                c = UTEXT_NEXT32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                if (sets[URX_GC_T]->contains(c))       goto GC_T;
-                (void)UTEXT_PREVIOUS32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                goto GC_Extend;
+            if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
+            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+            if (sets[URX_GC_T]->contains(c))       goto GC_T;
+            U16_PREV(inputBuf, 0, fp->fInputIdx, c);
+            goto GC_Extend;
 
 GC_Extend:
-                // Combining characters are consumed here
-                for (;;) {
-                    if (fp->fInputIdx >= fActiveLimit) {
-                        break;
-                    }
-                    c = UTEXT_CURRENT32(fInputText);
-                    if (sets[URX_GC_EXTEND]->contains(c) == FALSE) {
-                        break;
-                    }
-                    (void)UTEXT_NEXT32(fInputText);
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+            // Combining characters are consumed here
+            for (;;) {
+                if (fp->fInputIdx >= fActiveLimit) {
+                    break;
                 }
-                goto GC_Done;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                if (sets[URX_GC_EXTEND]->contains(c) == FALSE) {
+                    U16_BACK_1(inputBuf, 0, fp->fInputIdx);
+                    break;
+                }
+            }
+            goto GC_Done;
 
 GC_Control:
-                // Most control chars stand alone (don't combine with combining chars),
-                //   except for that CR/LF sequence is a single grapheme cluster.
-                if (c == 0x0d && fp->fInputIdx < fActiveLimit && UTEXT_CURRENT32(fInputText) == 0x0a) {
-                    c = UTEXT_NEXT32(fInputText);
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                }
+            // Most control chars stand alone (don't combine with combining chars),
+            //   except for that CR/LF sequence is a single grapheme cluster.
+            if (c == 0x0d && fp->fInputIdx < fActiveLimit && inputBuf[fp->fInputIdx] == 0x0a) {
+                fp->fInputIdx++;
+            }
 
 GC_Done:
-                if (fp->fInputIdx >= fActiveLimit) {
-                    fHitEnd = TRUE;
-                }
-                break;
+            if (fp->fInputIdx >= fActiveLimit) {
+                fHitEnd = TRUE;
             }
+            break;
+        }
 
 
 
@@ -3309,8 +5426,8 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 opValue &= ~URX_NEG_SET;
                 U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 if (c < 256) {
                     Regex8BitSet *s8 = &fPattern->fStaticSets8[opValue];
                     if (s8->contains(c)) {
@@ -3322,10 +5439,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                         success = !success;
                     }
                 }
-                if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                } else {
-                    // the character wasn't in the set.
+                if (!success) {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
@@ -3344,50 +5458,47 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
                 U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32  c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 if (c < 256) {
                     Regex8BitSet *s8 = &fPattern->fStaticSets8[opValue];
                     if (s8->contains(c) == FALSE) {
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                         break;
                     }
                 } else {
                     const UnicodeSet *s = fPattern->fStaticSets[opValue];
                     if (s->contains(c) == FALSE) {
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                         break;
                     }
                 }
-                // the character wasn't in the set.
                 fp = (REStackFrame *)fStack->popFrame(fFrameSize);
             }
             break;
 
 
         case URX_SETREF:
-            if (fp->fInputIdx >= fActiveLimit) {
-                fHitEnd = TRUE;
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                break;
-            } else {
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+            {
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
 
-                // There is input left.  Pick up one char and test it for set membership.
-                UChar32 c = UTEXT_NEXT32(fInputText);
                 U_ASSERT(opValue > 0 && opValue < fSets->size());
+
+                // There is input left.  Pick up one char and test it for set membership.
+                UChar32  c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 if (c<256) {
                     Regex8BitSet *s8 = &fPattern->fSets8[opValue];
                     if (s8->contains(c)) {
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        // The character is in the set.  A Match.
                         break;
                     }
                 } else {
                     UnicodeSet *s = (UnicodeSet *)fSets->elementAt(opValue);
                     if (s->contains(c)) {
                         // The character is in the set.  A Match.
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                         break;
                     }
                 }
@@ -3408,23 +5519,21 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     break;
                 }
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-
                 // There is input left.  Advance over one char, unless we've hit end-of-line
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32  c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 if (isLineTerminator(c)) {
                     // End of line in normal mode.   . does not match.
-                        fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                     break;
                 }
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
             }
             break;
 
 
         case URX_DOTANY_ALL:
             {
-                // ., in dot-matches-all (including new lines) mode
+                // . in dot-matches-all (including new lines) mode
                 if (fp->fInputIdx >= fActiveLimit) {
                     // At end of input.  Match failed.  Backtrack out.
                     fHitEnd = TRUE;
@@ -3432,19 +5541,14 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     break;
                 }
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-
                 // There is input left.  Advance over one char, except if we are
                 //   at a cr/lf, advance over both of them.
                 UChar32 c;
-                c = UTEXT_NEXT32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 if (c==0x0d && fp->fInputIdx < fActiveLimit) {
                     // In the case of a CR/LF, we need to advance over both.
-                    UChar32 nextc = UTEXT_CURRENT32(fInputText);
-                    if (nextc == 0x0a) {
-                        (void)UTEXT_NEXT32(fInputText);
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    if (inputBuf[fp->fInputIdx] == 0x0a) {
+                        U16_FWD_1(inputBuf, fp->fInputIdx, fActiveLimit);
                     }
                 }
             }
@@ -3462,15 +5566,12 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     break;
                 }
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-
                 // There is input left.  Advance over one char, unless we've hit end-of-line
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 if (c == 0x0a) {
                     // End of line in normal mode.   '.' does not match the \n
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                } else {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                 }
             }
             break;
@@ -3501,7 +5602,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 U_ASSERT(URX_TYPE(stoOp) == URX_STO_INP_LOC);
                 int32_t  frameLoc = URX_VAL(stoOp);
                 U_ASSERT(frameLoc >= 0 && frameLoc < fFrameSize);
-                int64_t prevInputIdx = fp->fExtra[frameLoc];
+                int32_t prevInputIdx = (int32_t)fp->fExtra[frameLoc];
                 U_ASSERT(prevInputIdx <= fp->fInputIdx);
                 if (prevInputIdx < fp->fInputIdx) {
                     // The match did make progress.  Repeat the loop.
@@ -3573,7 +5674,6 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                         IncrementTime(status);    // Re-initializes fTickCounter
                     }
                 }
-
                 fp->fPatIdx = opValue + 4;    // Loop back.
             }
             break;
@@ -3630,7 +5730,6 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     // We haven't met the minimum number of matches yet.
                     //   Loop back for another one.
                     fp->fPatIdx = opValue + 4;    // Loop back.
-                    // Increment time-out counter. (StateSave() does it if count >= minCount)
                     fTickCounter--;
                     if (fTickCounter <= 0) {
                         IncrementTime(status);    // Re-initializes fTickCounter
@@ -3686,47 +5785,38 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 int64_t groupStartIdx = fp->fExtra[opValue];
                 int64_t groupEndIdx   = fp->fExtra[opValue+1];
                 U_ASSERT(groupStartIdx <= groupEndIdx);
+                int64_t inputIndex = fp->fInputIdx;
                 if (groupStartIdx < 0) {
                     // This capture group has not participated in the match thus far,
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
                     break;
                 }
-                UTEXT_SETNATIVEINDEX(fAltInputText, groupStartIdx);
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-
-                //   Note: if the capture group match was of an empty string the backref
-                //         match succeeds.  Verified by testing:  Perl matches succeed
-                //         in this case, so we do too.
-
                 UBool success = TRUE;
-                for (;;) {
-                    if (utext_getNativeIndex(fAltInputText) >= groupEndIdx) {
-                        success = TRUE;
-                        break;
-                    }
-                    if (utext_getNativeIndex(fInputText) >= fActiveLimit) {
+                for (int64_t groupIndex = groupStartIdx; groupIndex < groupEndIdx; ++groupIndex,++inputIndex) {
+                    if (inputIndex >= fActiveLimit) {
                         success = FALSE;
                         fHitEnd = TRUE;
                         break;
                     }
-                    UChar32 captureGroupChar = utext_next32(fAltInputText);
-                    UChar32 inputChar = utext_next32(fInputText);
-                    if (inputChar != captureGroupChar) {
+                    if (inputBuf[groupIndex] != inputBuf[inputIndex]) {
                         success = FALSE;
                         break;
                     }
                 }
-
+                if (success && groupStartIdx < groupEndIdx && U16_IS_LEAD(inputBuf[groupEndIdx-1]) &&
+                        inputIndex < fActiveLimit && U16_IS_TRAIL(inputBuf[inputIndex])) {
+                    // Capture group ended with an unpaired lead surrogate.
+                    // Back reference is not permitted to match lead only of a surrogatge pair.
+                    success = FALSE;
+                }
                 if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = inputIndex;
                 } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
             break;
 
-
-
         case URX_BACKREF_I:
             {
                 U_ASSERT(opValue < fFrameSize);
@@ -3738,10 +5828,8 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
                     break;
                 }
-                utext_setNativeIndex(fAltInputText, groupStartIdx);
-                utext_setNativeIndex(fInputText, fp->fInputIdx);
-                CaseFoldingUTextIterator captureGroupItr(*fAltInputText);
-                CaseFoldingUTextIterator inputItr(*fInputText);
+                CaseFoldingUCharIterator captureGroupItr(inputBuf, groupStartIdx, groupEndIdx);
+                CaseFoldingUCharIterator inputItr(inputBuf, fp->fInputIdx, fActiveLimit);
 
                 //   Note: if the capture group match was of an empty string the backref
                 //         match succeeds.  Verified by testing:  Perl matches succeed
@@ -3749,17 +5837,17 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
                 UBool success = TRUE;
                 for (;;) {
-                    if (!captureGroupItr.inExpansion() && utext_getNativeIndex(fAltInputText) >= groupEndIdx) {
+                    UChar32 captureGroupChar = captureGroupItr.next();
+                    if (captureGroupChar == U_SENTINEL) {
                         success = TRUE;
                         break;
                     }
-                    if (!inputItr.inExpansion() && utext_getNativeIndex(fInputText) >= fActiveLimit) {
+                    UChar32 inputChar = inputItr.next();
+                    if (inputChar == U_SENTINEL) {
                         success = FALSE;
                         fHitEnd = TRUE;
                         break;
                     }
-                    UChar32 captureGroupChar = captureGroupItr.next();
-                    UChar32 inputChar = inputItr.next();
                     if (inputChar != captureGroupChar) {
                         success = FALSE;
                         break;
@@ -3774,11 +5862,10 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 }
 
                 if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = inputItr.getIndex();
                 } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
-
             }
             break;
 
@@ -3795,12 +5882,12 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 fp->fPatIdx += 1;
                 int32_t dataLoc  = URX_VAL(pat[instrOperandLoc]);
                 U_ASSERT(dataLoc >= 0 && dataLoc < fFrameSize);
-                int64_t savedInputIdx = fp->fExtra[dataLoc];
+                int32_t savedInputIdx = (int32_t)fp->fExtra[dataLoc];
                 U_ASSERT(savedInputIdx <= fp->fInputIdx);
                 if (savedInputIdx < fp->fInputIdx) {
                     fp->fPatIdx = opValue;                               // JMP
                 } else {
-                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no progress in loop.
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no progress in loop.
                 }
             }
             break;
@@ -3823,7 +5910,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 //  restore Stack Ptr, Input Pos to positions they had on entry to block.
                 U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
                 int32_t stackSize = fStack->size();
-                int32_t newStackSize =(int32_t)fData[opValue];
+                int32_t newStackSize = (int32_t)fData[opValue];
                 U_ASSERT(stackSize >= newStackSize);
                 if (stackSize > newStackSize) {
                     // Copy the current top frame back to the new (cut back) top frame.
@@ -3847,70 +5934,57 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             break;
 
         case URX_ONECHAR_I:
-            // Case insensitive one char.  The char from the pattern is already case folded.
-            // Input text is not, but case folding the input can not reduce two or more code
-            // points to one.
-            if (fp->fInputIdx < fActiveLimit) {
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-
-                UChar32 c = UTEXT_NEXT32(fInputText);
+            if (fp->fInputIdx < fActiveLimit) {
+                UChar32 c;
+                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
                 if (u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                     break;
                 }
             } else {
                 fHitEnd = TRUE;
             }
-
             fp = (REStackFrame *)fStack->popFrame(fFrameSize);
             break;
 
         case URX_STRING_I:
+            // Case-insensitive test input against a literal string.
+            // Strings require two slots in the compiled pattern, one for the
+            //   offset to the string text, and one for the length.
+            //   The compiled string has already been case folded.
             {
-                // Case-insensitive test input against a literal string.
-                // Strings require two slots in the compiled pattern, one for the
-                //   offset to the string text, and one for the length.
-                //   The compiled string has already been case folded.
-                {
-                    const UChar *patternString = litText + opValue;
-                    int32_t      patternStringIdx  = 0;
-
-                    op      = (int32_t)pat[fp->fPatIdx];
-                    fp->fPatIdx++;
-                    opType  = URX_TYPE(op);
-                    opValue = URX_VAL(op);
-                    U_ASSERT(opType == URX_STRING_LEN);
-                    int32_t patternStringLen = opValue;  // Length of the string from the pattern.
-
+                const UChar *patternString = litText + opValue;
 
-                    UChar32   cPattern;
-                    UChar32   cText;
-                    UBool     success = TRUE;
+                op      = (int32_t)pat[fp->fPatIdx];
+                fp->fPatIdx++;
+                opType  = URX_TYPE(op);
+                opValue = URX_VAL(op);
+                U_ASSERT(opType == URX_STRING_LEN);
+                int32_t patternStringLen = opValue;  // Length of the string from the pattern.
 
-                    UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                    CaseFoldingUTextIterator inputIterator(*fInputText);
-                    while (patternStringIdx < patternStringLen) {
-                        if (!inputIterator.inExpansion() && UTEXT_GETNATIVEINDEX(fInputText) >= fActiveLimit) {
-                            success = FALSE;
+                UChar32      cText;
+                UChar32      cPattern;
+                UBool        success = TRUE;
+                int32_t      patternStringIdx  = 0;
+                CaseFoldingUCharIterator inputIterator(inputBuf, fp->fInputIdx, fActiveLimit);
+                while (patternStringIdx < patternStringLen) {
+                    U16_NEXT(patternString, patternStringIdx, patternStringLen, cPattern);
+                    cText = inputIterator.next();
+                    if (cText != cPattern) {
+                        success = FALSE;
+                        if (cText == U_SENTINEL) {
                             fHitEnd = TRUE;
-                            break;
-                        }
-                        U16_NEXT(patternString, patternStringIdx, patternStringLen, cPattern);
-                        cText = inputIterator.next();
-                        if (cText != cPattern) {
-                            success = FALSE;
-                            break;
                         }
+                        break;
                     }
-                    if (inputIterator.inExpansion()) {
-                        success = FALSE;
-                    }
+                }
+                if (inputIterator.inExpansion()) {
+                    success = FALSE;
+                }
 
-                    if (success) {
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
-                    } else {
-                        fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    }
+                if (success) {
+                    fp->fInputIdx = inputIterator.getIndex();
+                } else {
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
             break;
@@ -3942,11 +6016,6 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 //   of this op in the pattern.
                 int32_t minML = (int32_t)pat[fp->fPatIdx++];
                 int32_t maxML = (int32_t)pat[fp->fPatIdx++];
-                if (!UTEXT_USES_U16(fInputText)) {
-                    // utf-8 fix to maximum match length. The pattern compiler assumes utf-16.
-                    // The max length need not be exact; it just needs to be >= actual maximum.
-                    maxML *= 3;
-                }
                 U_ASSERT(minML <= maxML);
                 U_ASSERT(minML >= 0);
 
@@ -3956,20 +6025,16 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 if (lbStartIdx < 0) {
                     // First time through loop.
                     lbStartIdx = fp->fInputIdx - minML;
-                    if (lbStartIdx > 0) {
-                        // move index to a code point boudary, if it's not on one already.
-                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
-                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    if (lbStartIdx > 0 && lbStartIdx < fInputLength) {
+                        U16_SET_CP_START(inputBuf, 0, lbStartIdx);
                     }
                 } else {
                     // 2nd through nth time through the loop.
                     // Back up start position for match by one.
                     if (lbStartIdx == 0) {
-                        (lbStartIdx)--;
+                        lbStartIdx--;
                     } else {
-                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
-                        (void)UTEXT_PREVIOUS32(fInputText);
-                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        U16_BACK_1(inputBuf, 0, lbStartIdx);
                     }
                 }
 
@@ -3988,7 +6053,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 //    Save state to this URX_LB_CONT op, so failure to match will repeat the loop.
                 //      (successful match will fall off the end of the loop.)
                 fp = StateSave(fp, fp->fPatIdx-3, status);
-                fp->fInputIdx = lbStartIdx;
+                fp->fInputIdx =  lbStartIdx;
             }
             break;
 
@@ -4025,13 +6090,8 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 // Fetch the extra parameters of this op.
                 int32_t minML       = (int32_t)pat[fp->fPatIdx++];
                 int32_t maxML       = (int32_t)pat[fp->fPatIdx++];
-                if (!UTEXT_USES_U16(fInputText)) {
-                    // utf-8 fix to maximum match length. The pattern compiler assumes utf-16.
-                    // The max length need not be exact; it just needs to be >= actual maximum.
-                    maxML *= 3;
-                }
                 int32_t continueLoc = (int32_t)pat[fp->fPatIdx++];
-                        continueLoc = URX_VAL(continueLoc);
+                continueLoc = URX_VAL(continueLoc);
                 U_ASSERT(minML <= maxML);
                 U_ASSERT(minML >= 0);
                 U_ASSERT(continueLoc > fp->fPatIdx);
@@ -4042,20 +6102,16 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 if (lbStartIdx < 0) {
                     // First time through loop.
                     lbStartIdx = fp->fInputIdx - minML;
-                    if (lbStartIdx > 0) {
-                        // move index to a code point boudary, if it's not on one already.
-                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
-                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    if (lbStartIdx > 0 && lbStartIdx < fInputLength) {
+                        U16_SET_CP_START(inputBuf, 0, lbStartIdx);
                     }
                 } else {
                     // 2nd through nth time through the loop.
                     // Back up start position for match by one.
                     if (lbStartIdx == 0) {
-                        (lbStartIdx)--;
+                        lbStartIdx--;   // Because U16_BACK is unsafe starting at 0.
                     } else {
-                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
-                        (void)UTEXT_PREVIOUS32(fInputText);
-                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        U16_BACK_1(inputBuf, 0, lbStartIdx);
                     }
                 }
 
@@ -4074,7 +6130,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 //    Save state to this URX_LB_CONT op, so failure to match will repeat the loop.
                 //      (successful match will cause a FAIL out of the loop altogether.)
                 fp = StateSave(fp, fp->fPatIdx-4, status);
-                fp->fInputIdx = lbStartIdx;
+                fp->fInputIdx =  lbStartIdx;
             }
             break;
 
@@ -4129,24 +6185,25 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
                 // Loop through input, until either the input is exhausted or
                 //   we reach a character that is not a member of the set.
-                int64_t ix = fp->fInputIdx;
-                UTEXT_SETNATIVEINDEX(fInputText, ix);
+                int32_t ix = (int32_t)fp->fInputIdx;
                 for (;;) {
                     if (ix >= fActiveLimit) {
                         fHitEnd = TRUE;
                         break;
                     }
-                    UChar32 c = UTEXT_NEXT32(fInputText);
+                    UChar32   c;
+                    U16_NEXT(inputBuf, ix, fActiveLimit, c);
                     if (c<256) {
                         if (s8->contains(c) == FALSE) {
+                            U16_BACK_1(inputBuf, 0, ix);
                             break;
                         }
                     } else {
                         if (s->contains(c) == FALSE) {
+                            U16_BACK_1(inputBuf, 0, ix);
                             break;
                         }
                     }
-                    ix = UTEXT_GETNATIVEINDEX(fInputText);
                 }
 
                 // If there were no matching characters, skip over the loop altogether.
@@ -4182,31 +6239,32 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             {
                 // Loop through input until the input is exhausted (we reach an end-of-line)
                 // In DOTALL mode, we can just go straight to the end of the input.
-                int64_t ix;
+                int32_t ix;
                 if ((opValue & 1) == 1) {
                     // Dot-matches-All mode.  Jump straight to the end of the string.
-                    ix = fActiveLimit;
+                    ix = (int32_t)fActiveLimit;
                     fHitEnd = TRUE;
                 } else {
                     // NOT DOT ALL mode.  Line endings do not match '.'
                     // Scan forward until a line ending or end of input.
-                    ix = fp->fInputIdx;
-                    UTEXT_SETNATIVEINDEX(fInputText, ix);
+                    ix = (int32_t)fp->fInputIdx;
                     for (;;) {
                         if (ix >= fActiveLimit) {
                             fHitEnd = TRUE;
                             break;
                         }
-                        UChar32 c = UTEXT_NEXT32(fInputText);
+                        UChar32   c;
+                        U16_NEXT(inputBuf, ix, fActiveLimit, c);   // c = inputBuf[ix++]
                         if ((c & 0x7f) <= 0x29) {          // Fast filter of non-new-line-s
                             if ((c == 0x0a) ||             //  0x0a is newline in both modes.
-                               (((opValue & 2) == 0) &&    // IF not UNIX_LINES mode
-                                    isLineTerminator(c))) {
-                                //  char is a line ending.  Exit the scanning loop.
+                                (((opValue & 2) == 0) &&    // IF not UNIX_LINES mode
+                                   isLineTerminator(c))) {
+                                //  char is a line ending.  Put the input pos back to the
+                                //    line ending char, and exit the scanning loop.
+                                U16_BACK_1(inputBuf, 0, ix);
                                 break;
                             }
                         }
-                        ix = UTEXT_GETNATIVEINDEX(fInputText);
                     }
                 }
 
@@ -4239,7 +6297,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
         case URX_LOOP_C:
             {
                 U_ASSERT(opValue>=0 && opValue<fFrameSize);
-                backSearchIndex = fp->fExtra[opValue];
+                backSearchIndex = (int32_t)fp->fExtra[opValue];
                 U_ASSERT(backSearchIndex <= fp->fInputIdx);
                 if (backSearchIndex == fp->fInputIdx) {
                     // We've backed up the input idx to the point that the loop started.
@@ -4253,18 +6311,16 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 //   (We're going backwards because this loop emulates stack unwinding, not
                 //    the initial scan forward.)
                 U_ASSERT(fp->fInputIdx > 0);
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 prevC = UTEXT_PREVIOUS32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                UChar32 prevC;
+                U16_PREV(inputBuf, 0, fp->fInputIdx, prevC); // !!!: should this 0 be one of f*Limit?
 
-                UChar32 twoPrevC = UTEXT_PREVIOUS32(fInputText);
                 if (prevC == 0x0a &&
                     fp->fInputIdx > backSearchIndex &&
-                    twoPrevC == 0x0d) {
+                    inputBuf[fp->fInputIdx-1] == 0x0d) {
                     int32_t prevOp = (int32_t)pat[fp->fPatIdx-2];
                     if (URX_TYPE(prevOp) == URX_LOOP_DOT_I) {
                         // .*, stepping back over CRLF pair.
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        U16_BACK_1(inputBuf, 0, fp->fInputIdx);
                     }
                 }
 
@@ -4308,26 +6364,29 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
     fFrame = fp;                // The active stack frame when the engine stopped.
                                 //   Contains the capture group results that we need to
                                 //    access later.
+
     return;
 }
 
 
+
 //--------------------------------------------------------------------------------
 //
-//   MatchChunkAt   This is the actual matching engine. Like MatchAt, but with the
-//                  assumption that the entire string is available in the UText's
-//                  chunk buffer. For now, that means we can use int32_t indexes,
-//                  except for anything that needs to be saved (like group starts
-//                  and ends).
+//   MatchUTF8At  This is the actual matching engine. Like MatchAt, but for UTF-8
+//                input in memory, from a UText opened with utext_openUTF8().
+//                The indexes are byte offsets, as they are for MatchAt with that
+//                UText, but the bytes are read directly rather than through the UText.
+//                Only case-insensitive strings and back references still use it,
+//                for its case folding iterator.
 //
 //                  startIdx:    begin matching a this index.
 //                  toEnd:       if true, match must extend to end of the input region
 //
 //--------------------------------------------------------------------------------
-void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &status) {
+void RegexMatcher::MatchUTF8At(int64_t startIdx, UBool toEnd, UErrorCode &status) {
     UBool       isMatch  = FALSE;      // True if the we have a match.
 
-    int32_t     backSearchIndex = INT32_MAX; // used after greedy single-character matches for searching backwards
+    int64_t     backSearchIndex = U_INT64_MAX; // used after greedy single-character matches for searching backwards
 
     int32_t     op;                    // Operation from the compiled pattern, split into
     int32_t     opType;                //    the opcode
@@ -4335,7 +6394,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
 #ifdef REGEX_RUN_DEBUG
     if (fTraceDebug) {
-        printf("MatchAt(startIdx=%d)\n", startIdx);
+        printf("MatchUTF8At(startIdx=%ld)\n", startIdx);
         printf("Original Pattern: \"%s\"\n", CStr(StringFromUText(fPattern->fPattern))());
         printf("Input String:     \"%s\"\n\n", CStr(StringFromUText(fInputText))());
     }
@@ -4352,7 +6411,10 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
     const UChar         *litText       = fPattern->fLiteralText.getBuffer();
     UVector             *fSets         = fPattern->fSets;
 
-    const UChar         *inputBuf      = fInputText->chunkContents;
+    const uint8_t       *inputBuf      = fInputUTF8;
+    const int64_t        inputLength   = fInputLength;
+    int64_t              textIdx       = 0;  // Where UTF-8 code points are read, for
+                                             //   one pattern op at a time.
 
     fFrameSize = fPattern->fFrameSize;
     REStackFrame        *fp            = resetStack();
@@ -4380,9 +6442,9 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
         opValue = URX_VAL(op);
 #ifdef REGEX_RUN_DEBUG
         if (fTraceDebug) {
-            UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+            textIdx = fp->fInputIdx;
             printf("inputIdx=%ld   inputChar=%x   sp=%3ld   activeLimit=%ld  ", fp->fInputIdx,
-                   UTEXT_CURRENT32(fInputText), (int64_t *)fp-fStack->getBuffer(), fActiveLimit);
+                utf8Current(inputBuf, textIdx, inputLength), (int64_t *)fp-fStack->getBuffer(), fActiveLimit);
             fPattern->dumpOp(fp->fPatIdx);
         }
 #endif
@@ -4405,9 +6467,10 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
         case URX_ONECHAR:
             if (fp->fInputIdx < fActiveLimit) {
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                textIdx = fp->fInputIdx;
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 if (c == opValue) {
+                    fp->fInputIdx = textIdx;
                     break;
                 }
             } else {
@@ -4422,35 +6485,37 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 // Test input against a literal string.
                 // Strings require two slots in the compiled pattern, one for the
                 //   offset to the string text, and one for the length.
-                int32_t   stringStartIdx = opValue;
-                int32_t   stringLen;
 
+                int32_t   stringStartIdx = opValue;
                 op      = (int32_t)pat[fp->fPatIdx];     // Fetch the second operand
                 fp->fPatIdx++;
                 opType    = URX_TYPE(op);
-                stringLen = URX_VAL(op);
+                int32_t stringLen = URX_VAL(op);
                 U_ASSERT(opType == URX_STRING_LEN);
                 U_ASSERT(stringLen >= 2);
 
-                const UChar * pInp = inputBuf + fp->fInputIdx;
-                const UChar * pInpLimit = inputBuf + fActiveLimit;
-                const UChar * pPat = litText+stringStartIdx;
-                const UChar * pEnd = pInp + stringLen;
+                const UChar *patternString = litText+stringStartIdx;
+                int32_t patternStringIndex = 0;
+                textIdx = fp->fInputIdx;
+                UChar32 inputChar;
+                UChar32 patternChar;
                 UBool success = TRUE;
-                while (pInp < pEnd) {
-                    if (pInp >= pInpLimit) {
-                        fHitEnd = TRUE;
+                while (patternStringIndex < stringLen) {
+                    if (textIdx >= fActiveLimit) {
                         success = FALSE;
+                        fHitEnd = TRUE;
                         break;
                     }
-                    if (*pInp++ != *pPat++) {
+                    inputChar = utf8Next(inputBuf, textIdx, inputLength);
+                    U16_NEXT(patternString, patternStringIndex, stringLen, patternChar);
+                    if (patternChar != inputChar) {
                         success = FALSE;
                         break;
                     }
                 }
 
                 if (success) {
-                    fp->fInputIdx += stringLen;
+                    fp->fInputIdx = textIdx;
                 } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
@@ -4474,7 +6539,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
             isMatch = TRUE;
             goto  breakFromLoop;
 
-            // Start and End Capture stack frame variables are laid out out like this:
+        // Start and End Capture stack frame variables are laid out out like this:
             //  fp->fExtra[opValue]  - The start of a completed capture group
             //             opValue+1 - The end   of a completed capture group
             //             opValue+2 - the start of a capture group whose end
@@ -4495,58 +6560,56 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
 
         case URX_DOLLAR:                   //  $, test for End of line
-            //     or for position before new line at end of input
-            if (fp->fInputIdx < fAnchorLimit-2) {
-                // We are no where near the end of input.  Fail.
-                //   This is the common case.  Keep it first.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                break;
-            }
-            if (fp->fInputIdx >= fAnchorLimit) {
-                // We really are at the end of input.  Success.
-                fHitEnd = TRUE;
-                fRequireEnd = TRUE;
-                break;
-            }
+                                           //     or for position before new line at end of input
+            {
+                if (fp->fInputIdx >= fAnchorLimit) {
+                    // We really are at the end of input.  Success.
+                    fHitEnd = TRUE;
+                    fRequireEnd = TRUE;
+                    break;
+                }
 
-            // If we are positioned just before a new-line that is located at the
-            //   end of input, succeed.
-            if (fp->fInputIdx == fAnchorLimit-1) {
-                UChar32 c;
-                U16_GET(inputBuf, fAnchorStart, fp->fInputIdx, fAnchorLimit, c);
+                textIdx = fp->fInputIdx;
 
-                if (isLineTerminator(c)) {
-                    if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && inputBuf[fp->fInputIdx-1]==0x0d)) {
-                        // At new-line at end of input. Success
+                // If we are positioned just before a new-line that is located at the
+                //   end of input, succeed.
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
+                if (textIdx >= fAnchorLimit) {
+                    if (isLineTerminator(c)) {
+                        // If not in the middle of a CR/LF sequence
+                        if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && ((void)utf8Previous(inputBuf, textIdx), utf8Previous(inputBuf, textIdx))==0x0d)) {
+                            // At new-line at end of input. Success
+                            fHitEnd = TRUE;
+                            fRequireEnd = TRUE;
+
+                            break;
+                        }
+                    }
+                } else {
+                    UChar32 nextC = utf8Next(inputBuf, textIdx, inputLength);
+                    if (c == 0x0d && nextC == 0x0a && textIdx >= fAnchorLimit) {
                         fHitEnd = TRUE;
                         fRequireEnd = TRUE;
-                        break;
+                        break;                         // At CR/LF at end of input.  Success
                     }
                 }
-            } else if (fp->fInputIdx == fAnchorLimit-2 &&
-                inputBuf[fp->fInputIdx]==0x0d && inputBuf[fp->fInputIdx+1]==0x0a) {
-                    fHitEnd = TRUE;
-                    fRequireEnd = TRUE;
-                    break;                         // At CR/LF at end of input.  Success
-            }
-
-            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
 
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            }
             break;
 
 
-        case URX_DOLLAR_D:                   //  $, test for End of Line, in UNIX_LINES mode.
-            if (fp->fInputIdx >= fAnchorLimit-1) {
+         case URX_DOLLAR_D:                   //  $, test for End of Line, in UNIX_LINES mode.
+            if (fp->fInputIdx >= fAnchorLimit) {
+                // Off the end of input.  Success.
+                fHitEnd = TRUE;
+                fRequireEnd = TRUE;
+                break;
+            } else {
+                textIdx = fp->fInputIdx;
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 // Either at the last character of input, or off the end.
-                if (fp->fInputIdx == fAnchorLimit-1) {
-                    // At last char of input.  Success if it's a new line.
-                    if (inputBuf[fp->fInputIdx] == 0x0a) {
-                        fHitEnd = TRUE;
-                        fRequireEnd = TRUE;
-                        break;
-                    }
-                } else {
-                    // Off the end of input.  Success.
+                if (c == 0x0a && textIdx == fAnchorLimit) {
                     fHitEnd = TRUE;
                     fRequireEnd = TRUE;
                     break;
@@ -4558,96 +6621,99 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
             break;
 
 
-        case URX_DOLLAR_M:                //  $, test for End of line in multi-line mode
-            {
-                if (fp->fInputIdx >= fAnchorLimit) {
-                    // We really are at the end of input.  Success.
-                    fHitEnd = TRUE;
-                    fRequireEnd = TRUE;
-                    break;
-                }
-                // If we are positioned just before a new-line, succeed.
-                // It makes no difference where the new-line is within the input.
-                UChar32 c = inputBuf[fp->fInputIdx];
-                if (isLineTerminator(c)) {
-                    // At a line end, except for the odd chance of  being in the middle of a CR/LF sequence
-                    //  In multi-line mode, hitting a new-line just before the end of input does not
-                    //   set the hitEnd or requireEnd flags
-                    if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && inputBuf[fp->fInputIdx-1]==0x0d)) {
+         case URX_DOLLAR_M:                //  $, test for End of line in multi-line mode
+             {
+                 if (fp->fInputIdx >= fAnchorLimit) {
+                     // We really are at the end of input.  Success.
+                     fHitEnd = TRUE;
+                     fRequireEnd = TRUE;
+                     break;
+                 }
+                 // If we are positioned just before a new-line, succeed.
+                 // It makes no difference where the new-line is within the input.
+                 textIdx = fp->fInputIdx;
+                 UChar32 c = utf8Current(inputBuf, textIdx, inputLength);
+                 if (isLineTerminator(c)) {
+                     // At a line end, except for the odd chance of  being in the middle of a CR/LF sequence
+                     //  In multi-line mode, hitting a new-line just before the end of input does not
+                     //   set the hitEnd or requireEnd flags
+                     if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && utf8Previous(inputBuf, textIdx)==0x0d)) {
                         break;
-                    }
-                }
-                // not at a new line.  Fail.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            }
-            break;
+                     }
+                 }
+                 // not at a new line.  Fail.
+                 fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+             }
+             break;
 
 
-        case URX_DOLLAR_MD:                //  $, test for End of line in multi-line and UNIX_LINES mode
-            {
-                if (fp->fInputIdx >= fAnchorLimit) {
-                    // We really are at the end of input.  Success.
-                    fHitEnd = TRUE;
-                    fRequireEnd = TRUE;  // Java set requireEnd in this case, even though
-                    break;               //   adding a new-line would not lose the match.
-                }
-                // If we are not positioned just before a new-line, the test fails; backtrack out.
-                // It makes no difference where the new-line is within the input.
-                if (inputBuf[fp->fInputIdx] != 0x0a) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
+         case URX_DOLLAR_MD:                //  $, test for End of line in multi-line and UNIX_LINES mode
+             {
+                 if (fp->fInputIdx >= fAnchorLimit) {
+                     // We really are at the end of input.  Success.
+                     fHitEnd = TRUE;
+                     fRequireEnd = TRUE;  // Java set requireEnd in this case, even though
+                     break;               //   adding a new-line would not lose the match.
+                 }
+                 // If we are not positioned just before a new-line, the test fails; backtrack out.
+                 // It makes no difference where the new-line is within the input.
+                 textIdx = fp->fInputIdx;
+                 if (utf8Current(inputBuf, textIdx, inputLength) != 0x0a) {
+                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                 }
+             }
+             break;
 
 
-        case URX_CARET:                    //  ^, test for start of line
+       case URX_CARET:                    //  ^, test for start of line
             if (fp->fInputIdx != fAnchorStart) {
                 fp = (REStackFrame *)fStack->popFrame(fFrameSize);
             }
             break;
 
 
-        case URX_CARET_M:                   //  ^, test for start of line in mulit-line mode
-            {
-                if (fp->fInputIdx == fAnchorStart) {
-                    // We are at the start input.  Success.
-                    break;
-                }
-                // Check whether character just before the current pos is a new-line
-                //   unless we are at the end of input
-                UChar  c = inputBuf[fp->fInputIdx - 1];
-                if ((fp->fInputIdx < fAnchorLimit) &&
-                    isLineTerminator(c)) {
-                    //  It's a new-line.  ^ is true.  Success.
-                    //  TODO:  what should be done with positions between a CR and LF?
-                    break;
-                }
-                // Not at the start of a line.  Fail.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            }
-            break;
+       case URX_CARET_M:                   //  ^, test for start of line in mulit-line mode
+           {
+               if (fp->fInputIdx == fAnchorStart) {
+                   // We are at the start input.  Success.
+                   break;
+               }
+               // Check whether character just before the current pos is a new-line
+               //   unless we are at the end of input
+               textIdx = fp->fInputIdx;
+               UChar32  c = utf8Previous(inputBuf, textIdx);
+               if ((fp->fInputIdx < fAnchorLimit) && isLineTerminator(c)) {
+                   //  It's a new-line.  ^ is true.  Success.
+                   //  TODO:  what should be done with positions between a CR and LF?
+                   break;
+               }
+               // Not at the start of a line.  Fail.
+               fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+           }
+           break;
 
 
-        case URX_CARET_M_UNIX:       //  ^, test for start of line in mulit-line + Unix-line mode
-            {
-                U_ASSERT(fp->fInputIdx >= fAnchorStart);
-                if (fp->fInputIdx <= fAnchorStart) {
-                    // We are at the start input.  Success.
-                    break;
-                }
-                // Check whether character just before the current pos is a new-line
-                U_ASSERT(fp->fInputIdx <= fAnchorLimit);
-                UChar  c = inputBuf[fp->fInputIdx - 1];
-                if (c != 0x0a) {
-                    // Not at the start of a line.  Back-track out.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
+       case URX_CARET_M_UNIX:       //  ^, test for start of line in mulit-line + Unix-line mode
+           {
+               U_ASSERT(fp->fInputIdx >= fAnchorStart);
+               if (fp->fInputIdx <= fAnchorStart) {
+                   // We are at the start input.  Success.
+                   break;
+               }
+               // Check whether character just before the current pos is a new-line
+               U_ASSERT(fp->fInputIdx <= fAnchorLimit);
+               textIdx = fp->fInputIdx;
+               UChar32  c = utf8Previous(inputBuf, textIdx);
+               if (c != 0x0a) {
+                   // Not at the start of a line.  Back-track out.
+                   fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+               }
+           }
+           break;
 
         case URX_BACKSLASH_B:          // Test for word boundaries
             {
-                UBool success = isChunkWordBoundary((int32_t)fp->fInputIdx);
+                UBool success = isUTF8WordBoundary(fp->fInputIdx);
                 success ^= (UBool)(opValue != 0);     // flip sense for \B
                 if (!success) {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
@@ -4675,12 +6741,15 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     break;
                 }
 
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                textIdx = fp->fInputIdx;
+
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 int8_t ctype = u_charType(c);     // TODO:  make a unicode set for this.  Will be faster.
                 UBool success = (ctype == U_DECIMAL_DIGIT_NUMBER);
                 success ^= (UBool)(opValue != 0);        // flip sense for \D
-                if (!success) {
+                if (success) {
+                    fp->fInputIdx = textIdx;
+                } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
@@ -4701,12 +6770,14 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                     break;
                 }
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                textIdx = fp->fInputIdx;
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 int8_t ctype = u_charType(c);
                 UBool success = (ctype == U_SPACE_SEPARATOR || c == 9);  // SPACE_SEPARATOR || TAB
                 success ^= (UBool)(opValue != 0);        // flip sense for \H
-                if (!success) {
+                if (success) {
+                    fp->fInputIdx = textIdx;
+                } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
@@ -4720,17 +6791,13 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                     break;
                 }
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                textIdx = fp->fInputIdx;
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 if (isLineTerminator(c)) {
-                    if (c == 0x0d && fp->fInputIdx < fActiveLimit) {
-                        // Check for CR/LF sequence. Consume both together when found.
-                        UChar c2;
-                        U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c2);
-                        if (c2 != 0x0a) {
-                            U16_PREV(inputBuf, 0, fp->fInputIdx, c2);
-                        }
+                    if (c == 0x0d && utf8Current(inputBuf, textIdx, inputLength) == 0x0a) {
+                        utf8Next(inputBuf, textIdx, inputLength);
                     }
+                    fp->fInputIdx = textIdx;
                 } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
@@ -4738,106 +6805,118 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
             break;
 
 
-        case URX_BACKSLASH_V:         // Any single code point line ending.
+        case URX_BACKSLASH_V:            // \v, any single line ending character.
             {
                 if (fp->fInputIdx >= fActiveLimit) {
                     fHitEnd = TRUE;
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                     break;
                 }
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                textIdx = fp->fInputIdx;
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 UBool success = isLineTerminator(c);
                 success ^= (UBool)(opValue != 0);        // flip sense for \V
-                if (!success) {
+                if (success) {
+                    fp->fInputIdx = textIdx;
+                } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
             break;
 
 
-
         case URX_BACKSLASH_X:
-        //  Match a Grapheme, as defined by Unicode TR 29.
-        //  Differs slightly from Perl, which consumes combining marks independently
-        //    of context.
-        {
+            //  Match a Grapheme, as defined by Unicode TR 29.
+            //  Differs slightly from Perl, which consumes combining marks independently
+            //    of context.
+            {
 
-            // Fail if at end of input
-            if (fp->fInputIdx >= fActiveLimit) {
-                fHitEnd = TRUE;
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                break;
-            }
+                // Fail if at end of input
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    break;
+                }
 
-            // Examine (and consume) the current char.
-            //   Dispatch into a little state machine, based on the char.
-            UChar32  c;
-            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-            UnicodeSet **sets = fPattern->fStaticSets;
-            if (sets[URX_GC_NORMAL]->contains(c))  goto GC_Extend;
-            if (sets[URX_GC_CONTROL]->contains(c)) goto GC_Control;
-            if (sets[URX_GC_L]->contains(c))       goto GC_L;
-            if (sets[URX_GC_LV]->contains(c))      goto GC_V;
-            if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
-            if (sets[URX_GC_V]->contains(c))       goto GC_V;
-            if (sets[URX_GC_T]->contains(c))       goto GC_T;
-            goto GC_Extend;
+                textIdx = fp->fInputIdx;
+
+                // Examine (and consume) the current char.
+                //   Dispatch into a little state machine, based on the char.
+                UChar32  c;
+                c = utf8Next(inputBuf, textIdx, inputLength);
+                fp->fInputIdx = textIdx;
+                UnicodeSet **sets = fPattern->fStaticSets;
+                if (sets[URX_GC_NORMAL]->contains(c))  goto GC_Extend;
+                if (sets[URX_GC_CONTROL]->contains(c)) goto GC_Control;
+                if (sets[URX_GC_L]->contains(c))       goto GC_L;
+                if (sets[URX_GC_LV]->contains(c))      goto GC_V;
+                if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
+                if (sets[URX_GC_V]->contains(c))       goto GC_V;
+                if (sets[URX_GC_T]->contains(c))       goto GC_T;
+                goto GC_Extend;
 
 
 
 GC_L:
-            if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-            if (sets[URX_GC_L]->contains(c))       goto GC_L;
-            if (sets[URX_GC_LV]->contains(c))      goto GC_V;
-            if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
-            if (sets[URX_GC_V]->contains(c))       goto GC_V;
-            U16_PREV(inputBuf, 0, fp->fInputIdx, c);
-            goto GC_Extend;
+                if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
+                c = utf8Next(inputBuf, textIdx, inputLength);
+                fp->fInputIdx = textIdx;
+                if (sets[URX_GC_L]->contains(c))       goto GC_L;
+                if (sets[URX_GC_LV]->contains(c))      goto GC_V;
+                if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
+                if (sets[URX_GC_V]->contains(c))       goto GC_V;
+                (void)utf8Previous(inputBuf, textIdx);
+                fp->fInputIdx = textIdx;
+                goto GC_Extend;
 
 GC_V:
-            if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-            if (sets[URX_GC_V]->contains(c))       goto GC_V;
-            if (sets[URX_GC_T]->contains(c))       goto GC_T;
-            U16_PREV(inputBuf, 0, fp->fInputIdx, c);
-            goto GC_Extend;
+                if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
+                c = utf8Next(inputBuf, textIdx, inputLength);
+                fp->fInputIdx = textIdx;
+                if (sets[URX_GC_V]->contains(c))       goto GC_V;
+                if (sets[URX_GC_T]->contains(c))       goto GC_T;
+                (void)utf8Previous(inputBuf, textIdx);
+                fp->fInputIdx = textIdx;
+                goto GC_Extend;
 
 GC_T:
-            if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-            if (sets[URX_GC_T]->contains(c))       goto GC_T;
-            U16_PREV(inputBuf, 0, fp->fInputIdx, c);
-            goto GC_Extend;
+                if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
+                c = utf8Next(inputBuf, textIdx, inputLength);
+                fp->fInputIdx = textIdx;
+                if (sets[URX_GC_T]->contains(c))       goto GC_T;
+                (void)utf8Previous(inputBuf, textIdx);
+                fp->fInputIdx = textIdx;
+                goto GC_Extend;
 
 GC_Extend:
-            // Combining characters are consumed here
-            for (;;) {
-                if (fp->fInputIdx >= fActiveLimit) {
-                    break;
-                }
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (sets[URX_GC_EXTEND]->contains(c) == FALSE) {
-                    U16_BACK_1(inputBuf, 0, fp->fInputIdx);
-                    break;
+                // Combining characters are consumed here
+                for (;;) {
+                    if (fp->fInputIdx >= fActiveLimit) {
+                        break;
+                    }
+                    c = utf8Current(inputBuf, textIdx, inputLength);
+                    if (sets[URX_GC_EXTEND]->contains(c) == FALSE) {
+                        break;
+                    }
+                    (void)utf8Next(inputBuf, textIdx, inputLength);
+                    fp->fInputIdx = textIdx;
                 }
-            }
-            goto GC_Done;
+                goto GC_Done;
 
 GC_Control:
-            // Most control chars stand alone (don't combine with combining chars),
-            //   except for that CR/LF sequence is a single grapheme cluster.
-            if (c == 0x0d && fp->fInputIdx < fActiveLimit && inputBuf[fp->fInputIdx] == 0x0a) {
-                fp->fInputIdx++;
-            }
+                // Most control chars stand alone (don't combine with combining chars),
+                //   except for that CR/LF sequence is a single grapheme cluster.
+                if (c == 0x0d && fp->fInputIdx < fActiveLimit && utf8Current(inputBuf, textIdx, inputLength) == 0x0a) {
+                    c = utf8Next(inputBuf, textIdx, inputLength);
+                    fp->fInputIdx = textIdx;
+                }
 
 GC_Done:
-            if (fp->fInputIdx >= fActiveLimit) {
-                fHitEnd = TRUE;
+                if (fp->fInputIdx >= fActiveLimit) {
+                    fHitEnd = TRUE;
+                }
+                break;
             }
-            break;
-        }
 
 
 
@@ -4870,8 +6949,8 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 opValue &= ~URX_NEG_SET;
                 U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
 
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                textIdx = fp->fInputIdx;
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 if (c < 256) {
                     Regex8BitSet *s8 = &fPattern->fStaticSets8[opValue];
                     if (s8->contains(c)) {
@@ -4883,7 +6962,10 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                         success = !success;
                     }
                 }
-                if (!success) {
+                if (success) {
+                    fp->fInputIdx = textIdx;
+                } else {
+                    // the character wasn't in the set.
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
@@ -4902,47 +6984,50 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
                 U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
 
-                UChar32  c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                textIdx = fp->fInputIdx;
+
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 if (c < 256) {
                     Regex8BitSet *s8 = &fPattern->fStaticSets8[opValue];
                     if (s8->contains(c) == FALSE) {
+                        fp->fInputIdx = textIdx;
                         break;
                     }
                 } else {
                     const UnicodeSet *s = fPattern->fStaticSets[opValue];
                     if (s->contains(c) == FALSE) {
+                        fp->fInputIdx = textIdx;
                         break;
                     }
                 }
+                // the character wasn't in the set.
                 fp = (REStackFrame *)fStack->popFrame(fFrameSize);
             }
             break;
 
 
         case URX_SETREF:
-            {
-                if (fp->fInputIdx >= fActiveLimit) {
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-
-                U_ASSERT(opValue > 0 && opValue < fSets->size());
+            if (fp->fInputIdx >= fActiveLimit) {
+                fHitEnd = TRUE;
+                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                break;
+            } else {
+                textIdx = fp->fInputIdx;
 
                 // There is input left.  Pick up one char and test it for set membership.
-                UChar32  c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
+                U_ASSERT(opValue > 0 && opValue < fSets->size());
                 if (c<256) {
                     Regex8BitSet *s8 = &fPattern->fSets8[opValue];
                     if (s8->contains(c)) {
-                        // The character is in the set.  A Match.
+                        fp->fInputIdx = textIdx;
                         break;
                     }
                 } else {
                     UnicodeSet *s = (UnicodeSet *)fSets->elementAt(opValue);
                     if (s->contains(c)) {
                         // The character is in the set.  A Match.
+                        fp->fInputIdx = textIdx;
                         break;
                     }
                 }
@@ -4963,21 +7048,23 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     break;
                 }
 
+                textIdx = fp->fInputIdx;
+
                 // There is input left.  Advance over one char, unless we've hit end-of-line
-                UChar32  c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 if (isLineTerminator(c)) {
                     // End of line in normal mode.   . does not match.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                        fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                     break;
                 }
+                fp->fInputIdx = textIdx;
             }
             break;
 
 
         case URX_DOTANY_ALL:
             {
-                // . in dot-matches-all (including new lines) mode
+                // ., in dot-matches-all (including new lines) mode
                 if (fp->fInputIdx >= fActiveLimit) {
                     // At end of input.  Match failed.  Backtrack out.
                     fHitEnd = TRUE;
@@ -4985,14 +7072,19 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     break;
                 }
 
+                textIdx = fp->fInputIdx;
+
                 // There is input left.  Advance over one char, except if we are
                 //   at a cr/lf, advance over both of them.
                 UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                c = utf8Next(inputBuf, textIdx, inputLength);
+                fp->fInputIdx = textIdx;
                 if (c==0x0d && fp->fInputIdx < fActiveLimit) {
                     // In the case of a CR/LF, we need to advance over both.
-                    if (inputBuf[fp->fInputIdx] == 0x0a) {
-                        U16_FWD_1(inputBuf, fp->fInputIdx, fActiveLimit);
+                    UChar32 nextc = utf8Current(inputBuf, textIdx, inputLength);
+                    if (nextc == 0x0a) {
+                        (void)utf8Next(inputBuf, textIdx, inputLength);
+                        fp->fInputIdx = textIdx;
                     }
                 }
             }
@@ -5010,12 +7102,15 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     break;
                 }
 
+                textIdx = fp->fInputIdx;
+
                 // There is input left.  Advance over one char, unless we've hit end-of-line
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 if (c == 0x0a) {
                     // End of line in normal mode.   '.' does not match the \n
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                } else {
+                    fp->fInputIdx = textIdx;
                 }
             }
             break;
@@ -5046,7 +7141,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 U_ASSERT(URX_TYPE(stoOp) == URX_STO_INP_LOC);
                 int32_t  frameLoc = URX_VAL(stoOp);
                 U_ASSERT(frameLoc >= 0 && frameLoc < fFrameSize);
-                int32_t prevInputIdx = (int32_t)fp->fExtra[frameLoc];
+                int64_t prevInputIdx = fp->fExtra[frameLoc];
                 U_ASSERT(prevInputIdx <= fp->fInputIdx);
                 if (prevInputIdx < fp->fInputIdx) {
                     // The match did make progress.  Repeat the loop.
@@ -5118,6 +7213,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                         IncrementTime(status);    // Re-initializes fTickCounter
                     }
                 }
+
                 fp->fPatIdx = opValue + 4;    // Loop back.
             }
             break;
@@ -5174,6 +7270,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     // We haven't met the minimum number of matches yet.
                     //   Loop back for another one.
                     fp->fPatIdx = opValue + 4;    // Loop back.
+                    // Increment time-out counter. (StateSave() does it if count >= minCount)
                     fTickCounter--;
                     if (fTickCounter <= 0) {
                         IncrementTime(status);    // Re-initializes fTickCounter
@@ -5229,38 +7326,47 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 int64_t groupStartIdx = fp->fExtra[opValue];
                 int64_t groupEndIdx   = fp->fExtra[opValue+1];
                 U_ASSERT(groupStartIdx <= groupEndIdx);
-                int64_t inputIndex = fp->fInputIdx;
                 if (groupStartIdx < 0) {
                     // This capture group has not participated in the match thus far,
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
                     break;
                 }
+                int64_t groupIdx = groupStartIdx;
+                textIdx = fp->fInputIdx;
+
+                //   Note: if the capture group match was of an empty string the backref
+                //         match succeeds.  Verified by testing:  Perl matches succeed
+                //         in this case, so we do too.
+
                 UBool success = TRUE;
-                for (int64_t groupIndex = groupStartIdx; groupIndex < groupEndIdx; ++groupIndex,++inputIndex) {
-                    if (inputIndex >= fActiveLimit) {
+                for (;;) {
+                    if (groupIdx >= groupEndIdx) {
+                        success = TRUE;
+                        break;
+                    }
+                    if (textIdx >= fActiveLimit) {
                         success = FALSE;
                         fHitEnd = TRUE;
                         break;
                     }
-                    if (inputBuf[groupIndex] != inputBuf[inputIndex]) {
+                    UChar32 captureGroupChar = utf8Next(inputBuf, groupIdx, inputLength);
+                    UChar32 inputChar = utf8Next(inputBuf, textIdx, inputLength);
+                    if (inputChar != captureGroupChar) {
                         success = FALSE;
                         break;
                     }
                 }
-                if (success && groupStartIdx < groupEndIdx && U16_IS_LEAD(inputBuf[groupEndIdx-1]) &&
-                        inputIndex < fActiveLimit && U16_IS_TRAIL(inputBuf[inputIndex])) {
-                    // Capture group ended with an unpaired lead surrogate.
-                    // Back reference is not permitted to match lead only of a surrogatge pair.
-                    success = FALSE;
-                }
+
                 if (success) {
-                    fp->fInputIdx = inputIndex;
+                    fp->fInputIdx = textIdx;
                 } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
             }
             break;
 
+
+
         case URX_BACKREF_I:
             {
                 U_ASSERT(opValue < fFrameSize);
@@ -5272,8 +7378,10 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
                     break;
                 }
-                CaseFoldingUCharIterator captureGroupItr(inputBuf, groupStartIdx, groupEndIdx);
-                CaseFoldingUCharIterator inputItr(inputBuf, fp->fInputIdx, fActiveLimit);
+                utext_setNativeIndex(fAltInputText, groupStartIdx);
+                utext_setNativeIndex(fInputText, fp->fInputIdx);
+                CaseFoldingUTextIterator captureGroupItr(*fAltInputText);
+                CaseFoldingUTextIterator inputItr(*fInputText);
 
                 //   Note: if the capture group match was of an empty string the backref
                 //         match succeeds.  Verified by testing:  Perl matches succeed
@@ -5281,17 +7389,17 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
                 UBool success = TRUE;
                 for (;;) {
-                    UChar32 captureGroupChar = captureGroupItr.next();
-                    if (captureGroupChar == U_SENTINEL) {
+                    if (!captureGroupItr.inExpansion() && utext_getNativeIndex(fAltInputText) >= groupEndIdx) {
                         success = TRUE;
                         break;
                     }
-                    UChar32 inputChar = inputItr.next();
-                    if (inputChar == U_SENTINEL) {
+                    if (!inputItr.inExpansion() && utext_getNativeIndex(fInputText) >= fActiveLimit) {
                         success = FALSE;
                         fHitEnd = TRUE;
                         break;
                     }
+                    UChar32 captureGroupChar = captureGroupItr.next();
+                    UChar32 inputChar = inputItr.next();
                     if (inputChar != captureGroupChar) {
                         success = FALSE;
                         break;
@@ -5306,10 +7414,11 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 }
 
                 if (success) {
-                    fp->fInputIdx = inputItr.getIndex();
+                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                 } else {
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
                 }
+
             }
             break;
 
@@ -5326,12 +7435,12 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 fp->fPatIdx += 1;
                 int32_t dataLoc  = URX_VAL(pat[instrOperandLoc]);
                 U_ASSERT(dataLoc >= 0 && dataLoc < fFrameSize);
-                int32_t savedInputIdx = (int32_t)fp->fExtra[dataLoc];
+                int64_t savedInputIdx = fp->fExtra[dataLoc];
                 U_ASSERT(savedInputIdx <= fp->fInputIdx);
                 if (savedInputIdx < fp->fInputIdx) {
                     fp->fPatIdx = opValue;                               // JMP
                 } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no progress in loop.
+                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no progress in loop.
                 }
             }
             break;
@@ -5354,7 +7463,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 //  restore Stack Ptr, Input Pos to positions they had on entry to block.
                 U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
                 int32_t stackSize = fStack->size();
-                int32_t newStackSize = (int32_t)fData[opValue];
+                int32_t newStackSize =(int32_t)fData[opValue];
                 U_ASSERT(stackSize >= newStackSize);
                 if (stackSize > newStackSize) {
                     // Copy the current top frame back to the new (cut back) top frame.
@@ -5378,57 +7487,70 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
             break;
 
         case URX_ONECHAR_I:
+            // Case insensitive one char.  The char from the pattern is already case folded.
+            // Input text is not, but case folding the input can not reduce two or more code
+            // points to one.
             if (fp->fInputIdx < fActiveLimit) {
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                textIdx = fp->fInputIdx;
+
+                UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                 if (u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
+                    fp->fInputIdx = textIdx;
                     break;
                 }
             } else {
                 fHitEnd = TRUE;
             }
+
             fp = (REStackFrame *)fStack->popFrame(fFrameSize);
             break;
 
         case URX_STRING_I:
-            // Case-insensitive test input against a literal string.
-            // Strings require two slots in the compiled pattern, one for the
-            //   offset to the string text, and one for the length.
-            //   The compiled string has already been case folded.
             {
-                const UChar *patternString = litText + opValue;
+                // Case-insensitive test input against a literal string.
+                // Strings require two slots in the compiled pattern, one for the
+                //   offset to the string text, and one for the length.
+                //   The compiled string has already been case folded.
+                {
+                    const UChar *patternString = litText + opValue;
+                    int32_t      patternStringIdx  = 0;
 
-                op      = (int32_t)pat[fp->fPatIdx];
-                fp->fPatIdx++;
-                opType  = URX_TYPE(op);
-                opValue = URX_VAL(op);
-                U_ASSERT(opType == URX_STRING_LEN);
-                int32_t patternStringLen = opValue;  // Length of the string from the pattern.
+                    op      = (int32_t)pat[fp->fPatIdx];
+                    fp->fPatIdx++;
+                    opType  = URX_TYPE(op);
+                    opValue = URX_VAL(op);
+                    U_ASSERT(opType == URX_STRING_LEN);
+                    int32_t patternStringLen = opValue;  // Length of the string from the pattern.
 
-                UChar32      cText;
-                UChar32      cPattern;
-                UBool        success = TRUE;
-                int32_t      patternStringIdx  = 0;
-                CaseFoldingUCharIterator inputIterator(inputBuf, fp->fInputIdx, fActiveLimit);
-                while (patternStringIdx < patternStringLen) {
-                    U16_NEXT(patternString, patternStringIdx, patternStringLen, cPattern);
-                    cText = inputIterator.next();
-                    if (cText != cPattern) {
-                        success = FALSE;
-                        if (cText == U_SENTINEL) {
+
+                    UChar32   cPattern;
+                    UChar32   cText;
+                    UBool     success = TRUE;
+
+                    UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                    CaseFoldingUTextIterator inputIterator(*fInputText);
+                    while (patternStringIdx < patternStringLen) {
+                        if (!inputIterator.inExpansion() && UTEXT_GETNATIVEINDEX(fInputText) >= fActiveLimit) {
+                            success = FALSE;
                             fHitEnd = TRUE;
+                            break;
+                        }
+                        U16_NEXT(patternString, patternStringIdx, patternStringLen, cPattern);
+                        cText = inputIterator.next();
+                        if (cText != cPattern) {
+                            success = FALSE;
+                            break;
                         }
-                        break;
                     }
-                }
-                if (inputIterator.inExpansion()) {
-                    success = FALSE;
-                }
+                    if (inputIterator.inExpansion()) {
+                        success = FALSE;
+                    }
 
-                if (success) {
-                    fp->fInputIdx = inputIterator.getIndex();
-                } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    if (success) {
+                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    } else {
+                        fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    }
                 }
             }
             break;
@@ -5460,6 +7582,9 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 //   of this op in the pattern.
                 int32_t minML = (int32_t)pat[fp->fPatIdx++];
                 int32_t maxML = (int32_t)pat[fp->fPatIdx++];
+                // utf-8 fix to maximum match length. The pattern compiler assumes utf-16.
+                // The max length need not be exact; it just needs to be >= actual maximum.
+                maxML *= 3;
                 U_ASSERT(minML <= maxML);
                 U_ASSERT(minML >= 0);
 
@@ -5469,16 +7594,19 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 if (lbStartIdx < 0) {
                     // First time through loop.
                     lbStartIdx = fp->fInputIdx - minML;
-                    if (lbStartIdx > 0 && lbStartIdx < fInputLength) {
-                        U16_SET_CP_START(inputBuf, 0, lbStartIdx);
+                    if (lbStartIdx > 0) {
+                        // move index to a code point boudary, if it's not on one already.
+                        lbStartIdx = utf8Boundary(inputBuf, lbStartIdx, inputLength);
                     }
                 } else {
                     // 2nd through nth time through the loop.
                     // Back up start position for match by one.
                     if (lbStartIdx == 0) {
-                        lbStartIdx--;
+                        (lbStartIdx)--;
                     } else {
-                        U16_BACK_1(inputBuf, 0, lbStartIdx);
+                        textIdx = lbStartIdx;
+                        (void)utf8Previous(inputBuf, textIdx);
+                        lbStartIdx = textIdx;
                     }
                 }
 
@@ -5497,7 +7625,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 //    Save state to this URX_LB_CONT op, so failure to match will repeat the loop.
                 //      (successful match will fall off the end of the loop.)
                 fp = StateSave(fp, fp->fPatIdx-3, status);
-                fp->fInputIdx =  lbStartIdx;
+                fp->fInputIdx = lbStartIdx;
             }
             break;
 
@@ -5534,8 +7662,11 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 // Fetch the extra parameters of this op.
                 int32_t minML       = (int32_t)pat[fp->fPatIdx++];
                 int32_t maxML       = (int32_t)pat[fp->fPatIdx++];
+                // utf-8 fix to maximum match length. The pattern compiler assumes utf-16.
+                // The max length need not be exact; it just needs to be >= actual maximum.
+                maxML *= 3;
                 int32_t continueLoc = (int32_t)pat[fp->fPatIdx++];
-                continueLoc = URX_VAL(continueLoc);
+                        continueLoc = URX_VAL(continueLoc);
                 U_ASSERT(minML <= maxML);
                 U_ASSERT(minML >= 0);
                 U_ASSERT(continueLoc > fp->fPatIdx);
@@ -5546,16 +7677,19 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 if (lbStartIdx < 0) {
                     // First time through loop.
                     lbStartIdx = fp->fInputIdx - minML;
-                    if (lbStartIdx > 0 && lbStartIdx < fInputLength) {
-                        U16_SET_CP_START(inputBuf, 0, lbStartIdx);
+                    if (lbStartIdx > 0) {
+                        // move index to a code point boudary, if it's not on one already.
+                        lbStartIdx = utf8Boundary(inputBuf, lbStartIdx, inputLength);
                     }
                 } else {
                     // 2nd through nth time through the loop.
                     // Back up start position for match by one.
                     if (lbStartIdx == 0) {
-                        lbStartIdx--;   // Because U16_BACK is unsafe starting at 0.
+                        (lbStartIdx)--;
                     } else {
-                        U16_BACK_1(inputBuf, 0, lbStartIdx);
+                        textIdx = lbStartIdx;
+                        (void)utf8Previous(inputBuf, textIdx);
+                        lbStartIdx = textIdx;
                     }
                 }
 
@@ -5574,7 +7708,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 //    Save state to this URX_LB_CONT op, so failure to match will repeat the loop.
                 //      (successful match will cause a FAIL out of the loop altogether.)
                 fp = StateSave(fp, fp->fPatIdx-4, status);
-                fp->fInputIdx =  lbStartIdx;
+                fp->fInputIdx = lbStartIdx;
             }
             break;
 
@@ -5629,25 +7763,24 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
                 // Loop through input, until either the input is exhausted or
                 //   we reach a character that is not a member of the set.
-                int32_t ix = (int32_t)fp->fInputIdx;
+                int64_t ix = fp->fInputIdx;
+                textIdx = ix;
                 for (;;) {
                     if (ix >= fActiveLimit) {
                         fHitEnd = TRUE;
                         break;
                     }
-                    UChar32   c;
-                    U16_NEXT(inputBuf, ix, fActiveLimit, c);
+                    UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                     if (c<256) {
                         if (s8->contains(c) == FALSE) {
-                            U16_BACK_1(inputBuf, 0, ix);
                             break;
                         }
                     } else {
                         if (s->contains(c) == FALSE) {
-                            U16_BACK_1(inputBuf, 0, ix);
                             break;
                         }
                     }
+                    ix = textIdx;
                 }
 
                 // If there were no matching characters, skip over the loop altogether.
@@ -5683,32 +7816,31 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
             {
                 // Loop through input until the input is exhausted (we reach an end-of-line)
                 // In DOTALL mode, we can just go straight to the end of the input.
-                int32_t ix;
+                int64_t ix;
                 if ((opValue & 1) == 1) {
                     // Dot-matches-All mode.  Jump straight to the end of the string.
-                    ix = (int32_t)fActiveLimit;
+                    ix = fActiveLimit;
                     fHitEnd = TRUE;
                 } else {
                     // NOT DOT ALL mode.  Line endings do not match '.'
                     // Scan forward until a line ending or end of input.
-                    ix = (int32_t)fp->fInputIdx;
+                    ix = fp->fInputIdx;
+                    textIdx = ix;
                     for (;;) {
                         if (ix >= fActiveLimit) {
                             fHitEnd = TRUE;
                             break;
                         }
-                        UChar32   c;
-                        U16_NEXT(inputBuf, ix, fActiveLimit, c);   // c = inputBuf[ix++]
+                        UChar32 c = utf8Next(inputBuf, textIdx, inputLength);
                         if ((c & 0x7f) <= 0x29) {          // Fast filter of non-new-line-s
                             if ((c == 0x0a) ||             //  0x0a is newline in both modes.
-                                (((opValue & 2) == 0) &&    // IF not UNIX_LINES mode
-                                   isLineTerminator(c))) {
-                                //  char is a line ending.  Put the input pos back to the
-                                //    line ending char, and exit the scanning loop.
-                                U16_BACK_1(inputBuf, 0, ix);
+                               (((opValue & 2) == 0) &&    // IF not UNIX_LINES mode
+                                    isLineTerminator(c))) {
+                                //  char is a line ending.  Exit the scanning loop.
                                 break;
                             }
                         }
+                        ix = textIdx;
                     }
                 }
 
@@ -5741,7 +7873,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
         case URX_LOOP_C:
             {
                 U_ASSERT(opValue>=0 && opValue<fFrameSize);
-                backSearchIndex = (int32_t)fp->fExtra[opValue];
+                backSearchIndex = fp->fExtra[opValue];
                 U_ASSERT(backSearchIndex <= fp->fInputIdx);
                 if (backSearchIndex == fp->fInputIdx) {
                     // We've backed up the input idx to the point that the loop started.
@@ -5755,16 +7887,18 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 //   (We're going backwards because this loop emulates stack unwinding, not
                 //    the initial scan forward.)
                 U_ASSERT(fp->fInputIdx > 0);
-                UChar32 prevC;
-                U16_PREV(inputBuf, 0, fp->fInputIdx, prevC); // !!!: should this 0 be one of f*Limit?
+                textIdx = fp->fInputIdx;
+                UChar32 prevC = utf8Previous(inputBuf, textIdx);
+                fp->fInputIdx = textIdx;
 
+                UChar32 twoPrevC = utf8Previous(inputBuf, textIdx);
                 if (prevC == 0x0a &&
                     fp->fInputIdx > backSearchIndex &&
-                    inputBuf[fp->fInputIdx-1] == 0x0d) {
+                    twoPrevC == 0x0d) {
                     int32_t prevOp = (int32_t)pat[fp->fPatIdx-2];
                     if (URX_TYPE(prevOp) == URX_LOOP_DOT_I) {
                         // .*, stepping back over CRLF pair.
-                        U16_BACK_1(inputBuf, 0, fp->fInputIdx);
+                        fp->fInputIdx = textIdx;
                     }
                 }
 
@@ -5808,7 +7942,6 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
     fFrame = fp;                // The active stack frame when the engine stopped.
                                 //   Contains the capture group results that we need to
                                 //    access later.
-
     return;
 }
 
@@ -14,8 +14,10 @@
 
 #if !UCONFIG_NO_REGULAR_EXPRESSIONS
 
+#include "unicode/localpointer.h"
 #include "unicode/regex.h"
 #include "unicode/uclean.h"
+#include "unicode/uniset.h"
 #include "cmemory.h"
 #include "cstr.h"
 #include "uassert.h"
@@ -106,7 +108,11 @@ RegexPattern &RegexPattern::operator = (const RegexPattern &other) {
     *fInitialChars    = *other.fInitialChars;
     fInitialChar      = other.fInitialChar;
     *fInitialChars8   = *other.fInitialChars8;
+    uprv_memcpy(fInitialUnits, other.fInitialUnits, sizeof(fInitialUnits));
+    fInitialUnitsLength = other.fInitialUnitsLength;
+    fInitialStringDistance = other.fInitialStringDistance;
     fNeedsAltInput    = other.fNeedsAltInput;
+    fUseDFA           = other.fUseDFA;
 
     //  Copy the pattern.  It's just values, nothing deep to copy.
     fCompiledPat->assign(*other.fCompiledPat, fDeferredStatus);
@@ -181,7 +187,10 @@ void RegexPattern::init() {
     fInitialChars     = NULL;
     fInitialChar      = 0;
     fInitialChars8    = NULL;
+    fInitialUnitsLength = 0;
+    fInitialStringDistance = 0;
     fNeedsAltInput    = FALSE;
+    fUseDFA           = FALSE;
     fNamedCaptureMap  = NULL;
 
     fPattern          = NULL; // will be set later
@@ -308,6 +317,7 @@ RegexPattern::compile(const UnicodeString &regex,
                       UParseError          &pe,
                       UErrorCode           &status)
 {
+    MemoryTagScope memoryTag(UMEM_TAG_REGEX);
     if (U_FAILURE(status)) {
         return NULL;
     }
@@ -359,6 +369,7 @@ RegexPattern::compile(UText                *regex,
                       UParseError          &pe,
                       UErrorCode           &status)
 {
+    MemoryTagScope memoryTag(UMEM_TAG_REGEX);
     if (U_FAILURE(status)) {
         return NULL;
     }
@@ -460,6 +471,335 @@ uint32_t RegexPattern::flags() const {
 }
 
 
+//---------------------------------------------------------------------
+//
+//   toBinary, createFromBinary      Save and restore the compiled pattern.
+//                                   See RegexBinaryHeader in regeximp.h.
+//
+//---------------------------------------------------------------------
+namespace {
+
+// The length in units of the UnicodeSet::serialize() data that begins with unit0.
+inline int32_t serializedSetLength(uint16_t unit0) {
+    return (unit0 & 0x8000) != 0 ? (unit0 & 0x7fff) + 2 : unit0 + 1;
+}
+
+// The offsets of the arrays that follow the header, and the total length;
+//   -1 if the lengths in the header are not valid.
+struct RegexBinaryLayout {
+    int64_t compiledPat, groupMap, namedCaptures, sets8, uchars, sets, length;
+
+    RegexBinaryLayout(const RegexBinaryHeader &h) {
+        compiledPat = sizeof(RegexBinaryHeader);
+        groupMap = compiledPat + (int64_t)h.compiledPatLength * 8;
+        namedCaptures = groupMap + (int64_t)h.groupMapLength * 4;
+        sets8 = namedCaptures + (int64_t)h.namedCaptureCount * 8;
+        uchars = sets8 + ((int64_t)h.setCount + 1) * (int64_t)sizeof(Regex8BitSet);
+        sets = uchars +
+            ((int64_t)h.patternLength + h.literalLength + h.namesLength) * U_SIZEOF_UCHAR;
+        length = sets + (int64_t)h.setsLength * 2;
+        if (h.compiledPatLength < 0 || h.groupMapLength < 0 || h.namedCaptureCount < 0 ||
+                h.setCount < 1 || h.patternLength < 0 || h.literalLength < 0 ||
+                h.namesLength < 0 || h.setsLength < 0 || length > INT32_MAX) {
+            length = -1;
+        }
+    }
+};
+
+}  // namespace
+
+int32_t RegexPattern::toBinary(void *dest, int32_t capacity, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return 0;
+    }
+    if (capacity < 0 || (dest == NULL && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UnicodeString patternString = pattern();
+    int32_t setCount = fSets->size();
+
+    RegexBinaryHeader header;
+    uprv_memset(&header, 0, sizeof(header));
+    header.signature = REGEX_BINARY_SIGNATURE;
+    header.formatVersion = REGEX_BINARY_FORMAT_VERSION;
+    header.flags = fFlags;
+    header.minMatchLen = fMinMatchLen;
+    header.frameSize = fFrameSize;
+    header.dataSize = fDataSize;
+    header.startType = fStartType;
+    header.initialStringIdx = fInitialStringIdx;
+    header.initialStringLen = fInitialStringLen;
+    header.initialChar = fInitialChar;
+    header.initialUnitsLength = fInitialUnitsLength;
+    header.initialStringDistance = fInitialStringDistance;
+    header.needsAltInput = fNeedsAltInput;
+    header.useDFA = fUseDFA;
+    uprv_memcpy(header.initialUnits, fInitialUnits, sizeof(fInitialUnits));
+    header.compiledPatLength = fCompiledPat->size();
+    header.groupMapLength = fGroupMap->size();
+    header.namedCaptureCount = uhash_count(fNamedCaptureMap);
+    header.setCount = setCount;
+    header.patternLength = patternString.length();
+    header.literalLength = fLiteralText.length();
+    int32_t hashPos = UHASH_FIRST;
+    while (const UHashElement *hashEl = uhash_nextElement(fNamedCaptureMap, &hashPos)) {
+        header.namesLength += ((const UnicodeString *)hashEl->key.pointer)->length();
+    }
+    for (int32_t i = 1; i <= setCount; ++i) {
+        const UnicodeSet *set =
+            i < setCount ? (const UnicodeSet *)fSets->elementAt(i) : fInitialChars;
+        UErrorCode preflightStatus = U_ZERO_ERROR;
+        header.setsLength += set->serialize(NULL, 0, preflightStatus);
+        if (preflightStatus != U_BUFFER_OVERFLOW_ERROR) {
+            status = U_FAILURE(preflightStatus) ? preflightStatus : U_INTERNAL_PROGRAM_ERROR;
+            return 0;
+        }
+    }
+    RegexBinaryLayout layout(header);
+    if (layout.length < 0) {
+        status = U_INDEX_OUTOFBOUNDS_ERROR;
+        return 0;
+    }
+    header.length = (int32_t)layout.length;
+    if (header.length > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+        return header.length;
+    }
+
+    uint8_t *bytes = (uint8_t *)dest;
+    uprv_memcpy(bytes, &header, sizeof(header));
+    if (header.compiledPatLength > 0) {
+        uprv_memcpy(bytes + layout.compiledPat, fCompiledPat->getBuffer(),
+                    (size_t)header.compiledPatLength * 8);
+    }
+    if (header.groupMapLength > 0) {
+        uprv_memcpy(bytes + layout.groupMap, fGroupMap->getBuffer(),
+                    (size_t)header.groupMapLength * 4);
+    }
+    int64_t captureOffset = layout.namedCaptures;
+    int64_t ucharOffset = layout.uchars;
+    uprv_memcpy(bytes + ucharOffset, patternString.getBuffer(),
+                (size_t)header.patternLength * U_SIZEOF_UCHAR);
+    ucharOffset += (int64_t)header.patternLength * U_SIZEOF_UCHAR;
+    uprv_memcpy(bytes + ucharOffset, fLiteralText.getBuffer(),
+                (size_t)header.literalLength * U_SIZEOF_UCHAR);
+    ucharOffset += (int64_t)header.literalLength * U_SIZEOF_UCHAR;
+    hashPos = UHASH_FIRST;
+    while (const UHashElement *hashEl = uhash_nextElement(fNamedCaptureMap, &hashPos)) {
+        const UnicodeString *name = (const UnicodeString *)hashEl->key.pointer;
+        int32_t capture[2] = { hashEl->value.integer, name->length() };
+        uprv_memcpy(bytes + captureOffset, capture, sizeof(capture));
+        captureOffset += sizeof(capture);
+        uprv_memcpy(bytes + ucharOffset, name->getBuffer(), (size_t)name->length() * U_SIZEOF_UCHAR);
+        ucharOffset += (int64_t)name->length() * U_SIZEOF_UCHAR;
+    }
+    int64_t setOffset = layout.sets;
+    for (int32_t i = 0; i <= setCount; ++i) {
+        const Regex8BitSet *set8 = i < setCount ? &fSets8[i] : fInitialChars8;
+        uprv_memcpy(bytes + layout.sets8 + (int64_t)i * sizeof(Regex8BitSet), set8->d,
+                    sizeof(Regex8BitSet));
+        if (i == 0) {
+            continue;   // Set zero is reserved, and has no UnicodeSet.
+        }
+        const UnicodeSet *set =
+            i < setCount ? (const UnicodeSet *)fSets->elementAt(i) : fInitialChars;
+        // dest need not be aligned for uint16_t, so the set is serialized separately.
+        MaybeStackArray<uint16_t, 256> serialized;
+        UErrorCode preflightStatus = U_ZERO_ERROR;
+        int32_t serializedLength = set->serialize(NULL, 0, preflightStatus);
+        if (serializedLength > serialized.getCapacity() &&
+                serialized.resize(serializedLength) == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+        set->serialize(serialized.getAlias(), serializedLength, status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        uprv_memcpy(bytes + setOffset, serialized.getAlias(), (size_t)serializedLength * 2);
+        setOffset += (int64_t)serializedLength * 2;
+    }
+    return header.length;
+}
+
+RegexPattern * U_EXPORT2
+RegexPattern::createFromBinary(const void *data, int32_t length, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    if (data == NULL || length < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    RegexBinaryHeader header;
+    if (length < (int32_t)sizeof(header)) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    uprv_memcpy(&header, data, sizeof(header));
+    RegexBinaryLayout layout(header);
+    if (header.signature != REGEX_BINARY_SIGNATURE ||
+            header.formatVersion != REGEX_BINARY_FORMAT_VERSION ||
+            layout.length < 0 || layout.length != header.length || header.length > length ||
+            header.initialUnitsLength < 0 || header.initialUnitsLength > 4) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+
+    RegexStaticSets::initGlobals(&status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    LocalPointer<RegexPattern> This(new RegexPattern, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    if (U_FAILURE(This->fDeferredStatus)) {
+        status = This->fDeferredStatus;
+        return NULL;
+    }
+    const uint8_t *bytes = (const uint8_t *)data;
+    This->fFlags = header.flags;
+    This->fMinMatchLen = header.minMatchLen;
+    This->fFrameSize = header.frameSize;
+    This->fDataSize = header.dataSize;
+    This->fStartType = header.startType;
+    This->fInitialStringIdx = header.initialStringIdx;
+    This->fInitialStringLen = header.initialStringLen;
+    This->fInitialChar = header.initialChar;
+    This->fInitialUnitsLength = header.initialUnitsLength;
+    This->fInitialStringDistance = header.initialStringDistance;
+    This->fNeedsAltInput = (UBool)header.needsAltInput;
+    This->fUseDFA = (UBool)header.useDFA;
+    uprv_memcpy(This->fInitialUnits, header.initialUnits, sizeof(This->fInitialUnits));
+    This->fStaticSets = RegexStaticSets::gStaticSets->fPropSets;
+    This->fStaticSets8 = RegexStaticSets::gStaticSets->fPropSets8;
+
+    if (header.compiledPatLength > 0) {
+        int64_t *ops = This->fCompiledPat->reserveBlock(header.compiledPatLength, status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        uprv_memcpy(ops, bytes + layout.compiledPat, (size_t)header.compiledPatLength * 8);
+    }
+    if (header.groupMapLength > 0) {
+        int32_t *groupMap = This->fGroupMap->reserveBlock(header.groupMapLength, status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        uprv_memcpy(groupMap, bytes + layout.groupMap, (size_t)header.groupMapLength * 4);
+    }
+
+    // The strings are copied first, because the data need not be aligned for UChars.
+    UnicodeString uchars;
+    int32_t ucharsLength = header.patternLength + header.literalLength + header.namesLength;
+    UChar *ucharsBuffer = uchars.getBuffer(ucharsLength);
+    if (ucharsBuffer == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    uprv_memcpy(ucharsBuffer, bytes + layout.uchars, (size_t)ucharsLength * U_SIZEOF_UCHAR);
+    uchars.releaseBuffer(ucharsLength);
+    const UChar *nextUChar = uchars.getBuffer();
+    This->fPatternString = new UnicodeString(nextUChar, header.patternLength);
+    if (This->fPatternString == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    This->fPattern = utext_openConstUnicodeString(NULL, This->fPatternString, &status);
+    nextUChar += header.patternLength;
+    This->fLiteralText.setTo(nextUChar, header.literalLength);
+    nextUChar += header.literalLength;
+    const UChar *ucharsLimit = uchars.getBuffer() + ucharsLength;
+    for (int32_t i = 0; i < header.namedCaptureCount && U_SUCCESS(status); ++i) {
+        int32_t capture[2];
+        uprv_memcpy(capture, bytes + layout.namedCaptures + (int64_t)i * sizeof(capture),
+                    sizeof(capture));
+        if (capture[1] < 0 || capture[1] > ucharsLimit - nextUChar) {
+            status = U_INVALID_FORMAT_ERROR;
+            return NULL;
+        }
+        UnicodeString *key = new UnicodeString(nextUChar, capture[1]);
+        if (key == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        uhash_puti(This->fNamedCaptureMap, key, capture[0], &status);
+        nextUChar += capture[1];
+    }
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    if (nextUChar != ucharsLimit) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+
+    This->fSets8 = new Regex8BitSet[header.setCount];
+    if (This->fSets8 == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    int64_t setOffset = layout.sets;
+    for (int32_t i = 0; i <= header.setCount; ++i) {
+        Regex8BitSet *set8 = i < header.setCount ? &This->fSets8[i] : This->fInitialChars8;
+        uprv_memcpy(set8->d, bytes + layout.sets8 + (int64_t)i * sizeof(Regex8BitSet),
+                    sizeof(Regex8BitSet));
+        if (i == 0) {
+            continue;
+        }
+        uint16_t unit0;
+        if (setOffset + 2 > layout.length) {
+            status = U_INVALID_FORMAT_ERROR;
+            return NULL;
+        }
+        uprv_memcpy(&unit0, bytes + setOffset, 2);
+        int32_t serializedLength = serializedSetLength(unit0);
+        if (setOffset + (int64_t)serializedLength * 2 > layout.length) {
+            status = U_INVALID_FORMAT_ERROR;
+            return NULL;
+        }
+        MaybeStackArray<uint16_t, 256> serialized;
+        if (serializedLength > serialized.getCapacity() &&
+                serialized.resize(serializedLength) == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        uprv_memcpy(serialized.getAlias(), bytes + setOffset, (size_t)serializedLength * 2);
+        setOffset += (int64_t)serializedLength * 2;
+        if (i == header.setCount) {
+            *This->fInitialChars = UnicodeSet(serialized.getAlias(), serializedLength,
+                                              UnicodeSet::kSerialized, status);
+        } else {
+            UnicodeSet *set = new UnicodeSet(serialized.getAlias(), serializedLength,
+                                             UnicodeSet::kSerialized, status);
+            if (set == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return NULL;
+            }
+            This->fSets->addElement(set, status);
+            if (U_FAILURE(status)) {
+                delete set;
+                return NULL;
+            }
+        }
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+    }
+    if (setOffset != layout.length) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    return This.orphan();
+}
+
+
 //---------------------------------------------------------------------
 //
 //   matcher(UnicodeString, err)
@@ -502,6 +842,43 @@ RegexMatcher *RegexPattern::matcher(UErrorCode &status)  const {
 
 
 
+//---------------------------------------------------------------------
+//
+//   matchOnce      Find the first match, with the working storage kept in
+//                  the result rather than in a matcher owned by the caller.
+//
+//---------------------------------------------------------------------
+UBool RegexPattern::matchOnce(const UnicodeString &input, RegexMatchResult &result,
+                              UErrorCode &status) const {
+    UText text = UTEXT_INITIALIZER;
+    utext_openConstUnicodeString(&text, &input, &status);
+    UBool found = matchOnce(&text, result, status);
+    utext_close(&text);
+    return found;
+}
+
+UBool RegexPattern::matchOnce(UText *input, RegexMatchResult &result, UErrorCode &status) const {
+    result.fIsMatch = FALSE;
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    if (input == NULL) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    if (result.fMatcher == NULL || &result.fMatcher->pattern() != this) {
+        delete result.fMatcher;
+        result.fMatcher = matcher(status);
+        if (U_FAILURE(status)) {
+            return FALSE;
+        }
+    }
+    result.fMatcher->reset(input);
+    result.fIsMatch = result.fMatcher->find(status);
+    return result.fIsMatch;
+}
+
+
 //---------------------------------------------------------------------
 //
 //   matches        Convenience function to test for a match, starting
@@ -858,6 +1235,58 @@ void RegexPattern::dumpPattern() const {
 
 
 
+//---------------------------------------------------------------------
+//
+//   RegexMatchResult
+//
+//---------------------------------------------------------------------
+RegexMatchResult::RegexMatchResult() : fMatcher(NULL), fIsMatch(FALSE) {
+}
+
+RegexMatchResult::~RegexMatchResult() {
+    delete fMatcher;
+}
+
+UBool RegexMatchResult::isMatch() const {
+    return fIsMatch;
+}
+
+int32_t RegexMatchResult::groupCount() const {
+    return fIsMatch ? fMatcher->groupCount() : 0;
+}
+
+int32_t RegexMatchResult::start(int32_t group, UErrorCode &status) const {
+    return (int32_t)start64(group, status);
+}
+
+int64_t RegexMatchResult::start64(int32_t group, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    if (!fIsMatch) {
+        status = U_REGEX_INVALID_STATE;
+        return -1;
+    }
+    return fMatcher->start64(group, status);
+}
+
+int32_t RegexMatchResult::end(int32_t group, UErrorCode &status) const {
+    return (int32_t)end64(group, status);
+}
+
+int64_t RegexMatchResult::end64(int32_t group, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    if (!fIsMatch) {
+        status = U_REGEX_INVALID_STATE;
+        return -1;
+    }
+    return fMatcher->end64(group, status);
+}
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(RegexMatchResult)
+
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(RegexPattern)
 
 U_NAMESPACE_END
@@ -27,6 +27,7 @@
 #include "unicode/uiter.h"
 #include "unicode/uloc.h"
 #include "unicode/uniset.h"
+#include "unicode/ustring.h"
 #include "unicode/unistr.h"
 #include "unicode/usetiter.h"
 #include "unicode/utf8.h"
@@ -42,6 +43,7 @@
 #include "collationiterator.h"
 #include "collationkeys.h"
 #include "collationroot.h"
+#include "collationscratch.h"
 #include "collationsets.h"
 #include "collationsettings.h"
 #include "collationtailoring.h"
@@ -50,6 +52,7 @@
 #include "ucol_imp.h"
 #include "uhash.h"
 #include "uitercollationiterator.h"
+#include "usimd.h"
 #include "ustr_imp.h"
 #include "utf16collationiterator.h"
 #include "utf8collationiterator.h"
@@ -159,6 +162,7 @@ RuleBasedCollator::RuleBasedCollator(const uint8_t *bin, int32_t length,
           validLocale(""),
           explicitlySetAttributes(0),
           actualLocaleIsSameAsValid(FALSE) {
+    MemoryTagScope memoryTag(UMEM_TAG_COLLATION);
     if(U_FAILURE(errorCode)) { return; }
     if(bin == NULL || length == 0 || base == NULL) {
         errorCode = U_ILLEGAL_ARGUMENT_ERROR;
@@ -498,7 +502,20 @@ RuleBasedCollator::setAttribute(UColAttribute attr, UColAttributeValue value,
         break;
     }
     if(U_FAILURE(errorCode)) { return; }
-    setFastLatinOptions(*ownedSettings);
+    if(attr == UCOL_ALTERNATE_HANDLING || attr == UCOL_NUMERIC_COLLATION) {
+        setFastLatinOptions(*ownedSettings);
+    } else if(ownedSettings->fastLatinOptions >= 0) {
+        // The other attributes do not affect the fast-Latin mini primaries,
+        // only the options bits, which are the low 16 bits of fastLatinOptions.
+        // Threads that each configure a clone for their own strength etc.
+        // need not recompute the primaries table.
+        U_ASSERT(ownedSettings->options <= 0xffff);
+        ownedSettings->fastLatinOptions =
+            (ownedSettings->fastLatinOptions & ~0xffff) | ownedSettings->options;
+        U_ASSERT(ownedSettings->fastLatinOptions == CollationFastLatin::getOptions(
+            data, *ownedSettings,
+            ownedSettings->fastLatinPrimaries, UPRV_LENGTHOF(ownedSettings->fastLatinPrimaries)));
+    }
     if(value == UCOL_DEFAULT) {
         setAttributeDefault(attr);
     } else {
@@ -701,7 +718,7 @@ RuleBasedCollator::compare(const UnicodeString &left, const UnicodeString &right
                            UErrorCode &errorCode) const {
     if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
     return doCompare(left.getBuffer(), left.length(),
-                     right.getBuffer(), right.length(), errorCode);
+                     right.getBuffer(), right.length(), NULL, errorCode);
 }
 
 UCollationResult
@@ -717,7 +734,7 @@ RuleBasedCollator::compare(const UnicodeString &left, const UnicodeString &right
     if(leftLength > length) { leftLength = length; }
     if(rightLength > length) { rightLength = length; }
     return doCompare(left.getBuffer(), leftLength,
-                     right.getBuffer(), rightLength, errorCode);
+                     right.getBuffer(), rightLength, NULL, errorCode);
 }
 
 UCollationResult
@@ -736,7 +753,25 @@ RuleBasedCollator::compare(const UChar *left, int32_t leftLength,
     } else {
         if(rightLength >= 0) { leftLength = u_strlen(left); }
     }
-    return doCompare(left, leftLength, right, rightLength, errorCode);
+    return doCompare(left, leftLength, right, rightLength, NULL, errorCode);
+}
+
+UCollationResult
+RuleBasedCollator::internalCompareWithScratch(const UChar *left, int32_t leftLength,
+                                              const UChar *right, int32_t rightLength,
+                                              CollationScratch &scratch,
+                                              UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
+    if((left == NULL && leftLength != 0) || (right == NULL && rightLength != 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    if(leftLength >= 0) {
+        if(rightLength < 0) { rightLength = u_strlen(right); }
+    } else {
+        if(rightLength >= 0) { leftLength = u_strlen(left); }
+    }
+    return doCompare(left, leftLength, right, rightLength, &scratch, errorCode);
 }
 
 UCollationResult
@@ -967,7 +1002,7 @@ UCollationResult compareNFDIter(const Normalizer2Impl &nfcImpl,
 UCollationResult
 RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
                              const UChar *right, int32_t rightLength,
-                             UErrorCode &errorCode) const {
+                             CollationScratch *scratch, UErrorCode &errorCode) const {
     // U_FAILURE(errorCode) checked by caller.
     if(left == right && leftLength == rightLength) {
         return UCOL_EQUAL;
@@ -988,15 +1023,13 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     } else {
         leftLimit = left + leftLength;
         rightLimit = right + rightLength;
-        for(;;) {
-            if(equalPrefixLength == leftLength) {
-                if(equalPrefixLength == rightLength) { return UCOL_EQUAL; }
-                break;
-            } else if(equalPrefixLength == rightLength ||
-                      left[equalPrefixLength] != right[equalPrefixLength]) {
-                break;
-            }
-            ++equalPrefixLength;
+        int32_t minLength = leftLength < rightLength ? leftLength : rightLength;
+        // Sorted strings often share long prefixes, like URLs and file paths.
+        equalPrefixLength = uprv_equalPrefixBytes(
+            reinterpret_cast<const uint8_t *>(left), reinterpret_cast<const uint8_t *>(right),
+            minLength * U_SIZEOF_UCHAR) / U_SIZEOF_UCHAR;
+        if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+            return UCOL_EQUAL;
         }
     }
 
@@ -1046,7 +1079,16 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     }
 
     if(result == CollationFastLatin::BAIL_OUT_RESULT) {
-        if(settings->dontCheckFCD()) {
+        if(scratch != NULL) {
+            // Reuse the scratch iterators and their buffers.
+            if(!scratch->setText(data, numeric, !settings->dontCheckFCD(),
+                                 left, leftLimit, right, rightLimit,
+                                 equalPrefixLength, errorCode)) {
+                return UCOL_EQUAL;
+            }
+            result = CollationCompare::compareUpToQuaternary(
+                scratch->getLeft(), scratch->getRight(), *settings, errorCode);
+        } else if(settings->dontCheckFCD()) {
             UTF16CollationIterator leftIter(data, numeric,
                                             left, left + equalPrefixLength, leftLimit);
             UTF16CollationIterator rightIter(data, numeric,
@@ -1101,15 +1143,10 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
             ++equalPrefixLength;
         }
     } else {
-        for(;;) {
-            if(equalPrefixLength == leftLength) {
-                if(equalPrefixLength == rightLength) { return UCOL_EQUAL; }
-                break;
-            } else if(equalPrefixLength == rightLength ||
-                      left[equalPrefixLength] != right[equalPrefixLength]) {
-                break;
-            }
-            ++equalPrefixLength;
+        int32_t minLength = leftLength < rightLength ? leftLength : rightLength;
+        equalPrefixLength = uprv_equalPrefixBytes(left, right, minLength);
+        if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+            return UCOL_EQUAL;
         }
     }
     // Back up to the start of a partially-equal code point.
@@ -1304,6 +1341,25 @@ RuleBasedCollator::getCollationKey(const UChar *s, int32_t length, CollationKey&
     return key;
 }
 
+CollationKey &
+RuleBasedCollator::getCollationKeyUTF8(const StringPiece &s, CollationKey &key,
+                                       UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) {
+        return key.setToBogus();
+    }
+    key.reset();  // resets the "bogus" state
+    CollationKeyByteSink sink(key);
+    writeSortKeyUTF8(s.data(), s.length(), sink, errorCode);
+    if(U_FAILURE(errorCode)) {
+        key.setToBogus();
+    } else if(key.isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    } else {
+        key.setLength(sink.NumberOfBytesAppended());
+    }
+    return key;
+}
+
 int32_t
 RuleBasedCollator::getSortKey(const UnicodeString &s,
                               uint8_t *dest, int32_t capacity) const {
@@ -1353,6 +1409,315 @@ RuleBasedCollator::writeSortKey(const UChar *s, int32_t length,
     sink.Append(&terminator, 1);
 }
 
+int32_t
+RuleBasedCollator::internalGetSortKeyUTF8(const char *s, int32_t length,
+                                          uint8_t *dest, int32_t capacity) const {
+    if((s == NULL && length != 0) || capacity < 0 || (dest == NULL && capacity > 0)) {
+        return 0;
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == NULL) {
+        // Distinguish pure preflighting from an allocation error.
+        dest = noDest;
+        capacity = 0;
+    }
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), capacity);
+    UErrorCode errorCode = U_ZERO_ERROR;
+    writeSortKeyUTF8(s, length, sink, errorCode);
+    return U_SUCCESS(errorCode) ? sink.NumberOfBytesAppended() : 0;
+}
+
+void
+RuleBasedCollator::writeSortKeyUTF8(const char *s, int32_t length,
+                                    SortKeyByteSink &sink, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    static const char empty[1] = { 0 };
+    if(s == NULL) { s = empty; }
+    const uint8_t *s8 = reinterpret_cast<const uint8_t *>(s);
+    UBool numeric = settings->isNumeric();
+    CollationKeys::LevelCallback callback;
+    if(settings->dontCheckFCD()) {
+        UTF8CollationIterator iter(data, numeric, s8, 0, length);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, TRUE, errorCode);
+    } else {
+        FCDUTF8CollationIterator iter(data, numeric, s8, 0, length);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, TRUE, errorCode);
+    }
+    if(settings->getStrength() == UCOL_IDENTICAL) {
+        UnicodeString s16;
+        writeIdenticalLevelUTF8(s, length, s16, sink, errorCode);
+    }
+    sink.Append(Collation::TERMINATOR_BYTE);
+}
+
+void
+RuleBasedCollator::writeIdenticalLevelUTF8(const char *s, int32_t length, UnicodeString &s16,
+                                           SortKeyByteSink &sink, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    if(length < 0) {
+        length = static_cast<int32_t>(uprv_strlen(s));
+    }
+    // The UTF-16 string is never longer than the UTF-8 string.
+    UChar *buffer = s16.getBuffer(length + 1);
+    if(buffer == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t length16 = 0;
+    u_strFromUTF8WithSub(buffer, s16.getCapacity(), &length16, s, length,
+                         0xfffd, NULL, &errorCode);
+    s16.releaseBuffer(U_SUCCESS(errorCode) ? length16 : 0);
+    const UChar *s16Array = s16.getBuffer();
+    writeIdenticalLevel(s16Array, s16Array + s16.length(), sink, errorCode);
+}
+
+int32_t
+RuleBasedCollator::internalGetBoundedSortKey(const UChar *s, int32_t length,
+                                             uint8_t *dest, int32_t maxLength,
+                                             UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == NULL && length != 0) || length < -1 || dest == NULL || maxLength <= 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    // The sort key is already tiered: All primary weights come first,
+    // followed by the compressed secondary & tertiary (etc.) levels.
+    // Every prefix of it is therefore the best order-preserving key of that length.
+    // Most keys that exceed the budget do so within the primary level.
+    // Write just the primary weights first, without collecting the other levels,
+    // unless the string is so short that its primary weights probably do not fill the budget.
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), maxLength);
+    const UChar *limit = (length >= 0) ? s + length : NULL;
+    UBool numeric = settings->isNumeric();
+    UBool isFull;
+    if(0 <= length && length < maxLength) {
+        isFull = FALSE;
+    } else if(settings->dontCheckFCD()) {
+        UTF16CollationIterator iter(data, numeric, s, s, limit);
+        isFull = CollationKeys::writePrimaryPrefix(iter, data->compressibleBytes, *settings,
+                                                   sink, errorCode);
+    } else {
+        FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
+        isFull = CollationKeys::writePrimaryPrefix(iter, data->compressibleBytes, *settings,
+                                                   sink, errorCode);
+    }
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(isFull) { return maxLength; }
+    // The primary level is shorter than the budget: Write the whole sort key,
+    // keeping as many of the lower-level bytes as fit.
+    FixedSortKeyByteSink keySink(reinterpret_cast<char *>(dest), maxLength);
+    writeSortKey(s, length, keySink, errorCode);
+    if(U_FAILURE(errorCode)) { return 0; }
+    int32_t keyLength = keySink.NumberOfBytesAppended();
+    return keyLength <= maxLength ? keyLength : maxLength;
+}
+
+int32_t
+RuleBasedCollator::internalGetSortKeyPrefix(const UChar *s, int32_t length,
+                                            uint8_t *dest, int32_t prefixLength,
+                                            UErrorCode &errorCode) const {
+    int32_t keyLength = internalGetBoundedSortKey(s, length, dest, prefixLength, errorCode);
+    if(U_FAILURE(errorCode)) { return 0; }
+    // Only a complete sort key ends with a zero byte.
+    if(dest[keyLength - 1] == 0) {
+        --keyLength;  // without the terminating zero byte
+    }
+    if(keyLength < prefixLength) {
+        uprv_memset(dest + keyLength, 0, prefixLength - keyLength);
+    }
+    return keyLength;
+}
+
+namespace {
+
+uint64_t getPrimaryPrefix(CollationIterator &iter, const CollationSettings &settings,
+                          UBool &isComplete, UErrorCode &errorCode) {
+    // Same variable-weight test as in CollationCompare::compareUpToQuaternary().
+    uint32_t variableTop;
+    if((settings.options & CollationSettings::ALTERNATE_MASK) == 0) {
+        variableTop = 0;
+    } else {
+        variableTop = settings.variableTop + 1;
+    }
+    uint32_t primaries[2] = { 0, 0 };
+    int32_t count = 0;
+    isComplete = TRUE;
+    for(;;) {
+        uint32_t p = (uint32_t)(iter.nextCE(errorCode) >> 32);
+        if(p == Collation::NO_CE_PRIMARY || U_FAILURE(errorCode)) { break; }
+        if(p == 0 || (p < variableTop && p > Collation::MERGE_SEPARATOR_PRIMARY)) {
+            continue;
+        }
+        if(count == UPRV_LENGTHOF(primaries)) {
+            isComplete = FALSE;
+            break;
+        }
+        if(settings.hasReordering()) {
+            p = settings.reorder(p);
+        }
+        primaries[count++] = p;
+    }
+    return ((uint64_t)primaries[0] << 32) | primaries[1];
+}
+
+}  // namespace
+
+uint64_t
+RuleBasedCollator::internalGetPrimaryPrefix(const UChar *s, int32_t length,
+                                            UBool &isComplete, UErrorCode &errorCode) const {
+    isComplete = TRUE;
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == NULL && length != 0) || length < -1) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const UChar *limit = (length >= 0) ? s + length : NULL;
+    UBool numeric = settings->isNumeric();
+    uint64_t prefix;
+    if(settings->dontCheckFCD()) {
+        UTF16CollationIterator iter(data, numeric, s, s, limit);
+        prefix = getPrimaryPrefix(iter, *settings, isComplete, errorCode);
+    } else {
+        FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
+        prefix = getPrimaryPrefix(iter, *settings, isComplete, errorCode);
+    }
+    return U_SUCCESS(errorCode) ? prefix : 0;
+}
+
+namespace {
+
+UBool checkSortKeysArgs(const void *sources, int32_t count,
+                        uint8_t *&dest, int32_t &destCapacity, uint8_t *noDest,
+                        int32_t *offsets, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return FALSE; }
+    if(count < 0 || (sources == NULL && count > 0) || offsets == NULL ||
+            destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    if(dest == NULL) {
+        // Distinguish pure preflighting from an allocation error.
+        dest = noDest;
+        destCapacity = 0;
+    }
+    return TRUE;
+}
+
+int32_t finishSortKeys(const SortKeyByteSink &sink, int32_t *offsets, int32_t count,
+                       UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return 0; }
+    int32_t length = sink.NumberOfBytesAppended();
+    offsets[count] = length;
+    if(sink.Overflowed()) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
+}  // namespace
+
+int32_t
+RuleBasedCollator::internalGetSortKeys(const UChar *const *sources, const int32_t *sourceLengths,
+                                       int32_t count, uint8_t *dest, int32_t destCapacity,
+                                       int32_t *offsets, UErrorCode &errorCode) const {
+    uint8_t noDest[1] = { 0 };
+    if(!checkSortKeysArgs(sources, count, dest, destCapacity, noDest, offsets, errorCode)) {
+        return 0;
+    }
+    // All of the keys are appended to one sink, and one iterator is reset for each string,
+    // rather than setting up both for each key as in writeSortKey().
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), destCapacity);
+    UBool numeric = settings->isNumeric();
+    UBool identical = settings->getStrength() == UCOL_IDENTICAL;
+    CollationKeys::LevelCallback callback;
+    UTF16CollationIterator iter(data, numeric, NULL, NULL, NULL);
+    FCDUTF16CollationIterator fcdIter(data, numeric, NULL, NULL, NULL);
+    static const UChar empty[1] = { 0 };
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = sink.NumberOfBytesAppended();
+        const UChar *s = sources[i];
+        int32_t length = (sourceLengths != NULL) ? sourceLengths[i] : -1;
+        if(s == NULL) {
+            if(length != 0) {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return 0;
+            }
+            s = empty;
+        }
+        const UChar *limit = (length >= 0) ? s + length : NULL;
+        CollationIterator *ci;
+        if(settings->dontCheckFCD()) {
+            iter.setText(s, limit);
+            ci = &iter;
+        } else {
+            fcdIter.setText(s, limit);
+            ci = &fcdIter;
+        }
+        CollationKeys::writeSortKeyUpToQuaternary(*ci, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, TRUE, errorCode);
+        if(identical) {
+            writeIdenticalLevel(s, limit, sink, errorCode);
+        }
+        sink.Append(Collation::TERMINATOR_BYTE);
+        if(U_FAILURE(errorCode)) { return 0; }
+    }
+    return finishSortKeys(sink, offsets, count, errorCode);
+}
+
+int32_t
+RuleBasedCollator::internalGetSortKeysUTF8(const char *const *sources, const int32_t *sourceLengths,
+                                           int32_t count, uint8_t *dest, int32_t destCapacity,
+                                           int32_t *offsets, UErrorCode &errorCode) const {
+    uint8_t noDest[1] = { 0 };
+    if(!checkSortKeysArgs(sources, count, dest, destCapacity, noDest, offsets, errorCode)) {
+        return 0;
+    }
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), destCapacity);
+    UBool numeric = settings->isNumeric();
+    UBool identical = settings->getStrength() == UCOL_IDENTICAL;
+    CollationKeys::LevelCallback callback;
+    UTF8CollationIterator iter(data, numeric, NULL, 0, 0);
+    FCDUTF8CollationIterator fcdIter(data, numeric, NULL, 0, 0);
+    // The identical level is computed from UTF-16 text; the buffer is reused.
+    UnicodeString s16;
+    static const char empty[1] = { 0 };
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = sink.NumberOfBytesAppended();
+        const char *s = sources[i];
+        int32_t length = (sourceLengths != NULL) ? sourceLengths[i] : -1;
+        if(s == NULL) {
+            if(length != 0) {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return 0;
+            }
+            s = empty;
+        }
+        const uint8_t *s8 = reinterpret_cast<const uint8_t *>(s);
+        CollationIterator *ci;
+        if(settings->dontCheckFCD()) {
+            iter.setText(s8, length);
+            ci = &iter;
+        } else {
+            fcdIter.setText(s8, length);
+            ci = &fcdIter;
+        }
+        CollationKeys::writeSortKeyUpToQuaternary(*ci, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, TRUE, errorCode);
+        if(identical) {
+            writeIdenticalLevelUTF8(s, length, s16, sink, errorCode);
+        }
+        sink.Append(Collation::TERMINATOR_BYTE);
+        if(U_FAILURE(errorCode)) { return 0; }
+    }
+    return finishSortKeys(sink, offsets, count, errorCode);
+}
+
 void
 RuleBasedCollator::writeIdenticalLevel(const UChar *s, const UChar *limit,
                                        SortKeyByteSink &sink, UErrorCode &errorCode) const {
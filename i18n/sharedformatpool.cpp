@@ -0,0 +1,170 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// sharedformatpool.cpp
+// created: 2026oct14
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING
+
+#include "unicode/decimfmt.h"
+#include "unicode/dcfmtsym.h"
+#include "unicode/localpointer.h"
+#include "unicode/smpdtfmt.h"
+#include "mutex.h"
+#include "sharedformatpool.h"
+#include "umutex.h"
+#include "unifiedcache.h"
+
+// Protects the idle lists of all pools. It is held only to pop or push
+// one pointer.
+static UMutex gFormatPoolMutex = U_MUTEX_INITIALIZER;
+
+U_NAMESPACE_BEGIN
+
+SharedFormatPool::SharedFormatPool(Format *prototypeToAdopt)
+        : fPrototype(prototypeToAdopt), fIdleCount(0) {}
+
+SharedFormatPool::~SharedFormatPool() {
+    for (int32_t i = 0; i < fIdleCount; ++i) {
+        delete fIdle[i];
+    }
+    delete fPrototype;
+}
+
+Format *SharedFormatPool::acquire(UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    {
+        Mutex lock(&gFormatPoolMutex);
+        if (fIdleCount > 0) {
+            return fIdle[--fIdleCount];
+        }
+    }
+    Format *format = fPrototype->clone();
+    if (format == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return format;
+}
+
+void SharedFormatPool::release(Format *format) const {
+    if (format == NULL) {
+        return;
+    }
+    // Compare outside the lock; the prototype is never modified.
+    if (*format == *fPrototype) {
+        Mutex lock(&gFormatPoolMutex);
+        if (fIdleCount < MAX_IDLE) {
+            fIdle[fIdleCount++] = format;
+            return;
+        }
+    }
+    delete format;
+}
+
+int32_t SharedFormatPool::idleCount() const {
+    Mutex lock(&gFormatPoolMutex);
+    return fIdleCount;
+}
+
+template<> U_I18N_API
+const SharedFormatPool *LocaleCacheKey<SharedFormatPool>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return NULL;
+}
+
+enum FormatPoolType {
+    POOL_SIMPLE_DATE_FORMAT,
+    POOL_DECIMAL_FORMAT
+};
+
+class U_I18N_API FormatPoolKey : public LocaleCacheKey<SharedFormatPool> {
+private:
+    FormatPoolType fType;
+    UnicodeString fPattern;
+public:
+    FormatPoolKey(const Locale &loc, FormatPoolType type, const UnicodeString &pattern)
+            : LocaleCacheKey<SharedFormatPool>(loc), fType(type), fPattern(pattern) {}
+    FormatPoolKey(const FormatPoolKey &other)
+            : LocaleCacheKey<SharedFormatPool>(other),
+              fType(other.fType), fPattern(other.fPattern) {}
+    virtual ~FormatPoolKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (37u * (uint32_t)LocaleCacheKey<SharedFormatPool>::hashCode() +
+                                (uint32_t)fType) +
+                         (uint32_t)fPattern.hashCode());
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<SharedFormatPool>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const FormatPoolKey &realOther = static_cast<const FormatPoolKey &>(other);
+        return realOther.fType == fType && realOther.fPattern == fPattern;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new FormatPoolKey(*this);
+    }
+    virtual const SharedFormatPool *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        LocalPointer<Format> prototype;
+        if (fType == POOL_SIMPLE_DATE_FORMAT) {
+            prototype.adoptInsteadAndCheckErrorCode(
+                    new SimpleDateFormat(fPattern, fLoc, status), status);
+        } else {
+            LocalPointer<DecimalFormatSymbols> symbols(
+                    new DecimalFormatSymbols(fLoc, status), status);
+            if (U_FAILURE(status)) {
+                return NULL;
+            }
+            prototype.adoptInsteadAndCheckErrorCode(
+                    new DecimalFormat(fPattern, symbols.orphan(), status), status);
+        }
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        SharedFormatPool *result = new SharedFormatPool(prototype.getAlias());
+        if (result == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        prototype.orphan();
+        result->addRef();
+        return result;
+    }
+};
+
+FormatPoolKey::~FormatPoolKey() {}
+
+static const SharedFormatPool *getPool(
+        const Locale &locale, FormatPoolType type,
+        const UnicodeString &pattern, UErrorCode &status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedFormatPool *pool = NULL;
+    cache->get(FormatPoolKey(locale, type, pattern), pool, status);
+    return pool;
+}
+
+const SharedFormatPool *SharedFormatPool::getDateFormatPool(
+        const Locale &locale, const UnicodeString &pattern, UErrorCode &status) {
+    return getPool(locale, POOL_SIMPLE_DATE_FORMAT, pattern, status);
+}
+
+const SharedFormatPool *SharedFormatPool::getDecimalFormatPool(
+        const Locale &locale, const UnicodeString &pattern, UErrorCode &status) {
+    return getPool(locale, POOL_DECIMAL_FORMAT, pattern, status);
+}
+
+U_NAMESPACE_END
+
+#endif /* !UCONFIG_NO_FORMATTING */
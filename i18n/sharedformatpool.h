@@ -0,0 +1,156 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// sharedformatpool.h
+// created: 2026oct14
+
+#ifndef __SHAREDFORMATPOOL_H__
+#define __SHAREDFORMATPOOL_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING
+
+#include "unicode/format.h"
+#include "unicode/locid.h"
+#include "unicode/unistr.h"
+#include "sharedobject.h"
+
+U_NAMESPACE_BEGIN
+
+class DecimalFormat;
+class SimpleDateFormat;
+
+/**
+ * A pool of interchangeable, mutable formatters for one locale and pattern.
+ *
+ * Pools are cached in the UnifiedCache. acquire() hands out an idle formatter
+ * if there is one, so that a thread can use a formatter of its own without
+ * paying for its construction or clone() each time; only when all of them
+ * are in use is the prototype cloned.
+ *
+ * A released formatter is recycled only if it is still equal to the prototype.
+ * Formatters whose settings were changed while they were acquired
+ * are deleted instead.
+ */
+class U_I18N_API SharedFormatPool : public SharedObject {
+public:
+    /**
+     * The maximum number of idle formatters kept per pool.
+     */
+    static const int32_t MAX_IDLE = 32;
+
+    /**
+     * Adopts the prototype formatter, which must not be NULL.
+     */
+    SharedFormatPool(Format *prototypeToAdopt);
+    virtual ~SharedFormatPool();
+
+    /**
+     * Returns the cached pool of SimpleDateFormat instances for the locale and pattern.
+     * Caller must call removeRef() on the non-NULL result.
+     */
+    static const SharedFormatPool *getDateFormatPool(
+            const Locale &locale, const UnicodeString &pattern, UErrorCode &status);
+
+    /**
+     * Returns the cached pool of DecimalFormat instances for the locale and pattern.
+     * Caller must call removeRef() on the non-NULL result.
+     */
+    static const SharedFormatPool *getDecimalFormatPool(
+            const Locale &locale, const UnicodeString &pattern, UErrorCode &status);
+
+    /**
+     * Returns a formatter equal to the prototype, for use by one thread at a time.
+     * The caller owns it until passing it back to release().
+     * @return the formatter, or NULL if status is set to a failure
+     */
+    Format *acquire(UErrorCode &status) const;
+
+    /**
+     * Returns a formatter obtained from acquire() to the pool,
+     * or deletes it if the pool is full or the formatter was modified.
+     * NULL is ignored.
+     */
+    void release(Format *format) const;
+
+    /**
+     * Returns the number of idle formatters in the pool. For testing only.
+     */
+    int32_t idleCount() const;
+
+private:
+    Format *fPrototype;
+    mutable Format *fIdle[MAX_IDLE];
+    mutable int32_t fIdleCount;
+
+    SharedFormatPool(const SharedFormatPool &);
+    SharedFormatPool &operator=(const SharedFormatPool &);
+};
+
+/**
+ * Holds a formatter acquired from a SharedFormatPool and the reference
+ * to the pool, and releases both on destruction. Use it on the stack:
+ * \code
+ *   PooledSimpleDateFormat fmt(locale, pattern, status);
+ *   if (U_SUCCESS(status)) {
+ *       fmt->format(date, result);
+ *   }
+ * \endcode
+ * T must be the type of the pool's formatters.
+ */
+template<typename T>
+class PooledFormat : public UMemory {
+public:
+    /**
+     * Takes over the caller's reference to pool, which may be NULL
+     * if status is a failure.
+     */
+    PooledFormat(const SharedFormatPool *pool, UErrorCode &status) : fPool(pool), fFormat(NULL) {
+        if (U_SUCCESS(status) && fPool != NULL) {
+            fFormat = static_cast<T *>(fPool->acquire(status));
+        }
+    }
+    ~PooledFormat() {
+        if (fPool != NULL) {
+            fPool->release(fFormat);
+            fPool->removeRef();
+        }
+    }
+    UBool isValid() const { return fFormat != NULL; }
+    T *getAlias() const { return fFormat; }
+    T *operator->() const { return fFormat; }
+    T &operator*() const { return *fFormat; }
+private:
+    const SharedFormatPool *fPool;
+    T *fFormat;
+
+    PooledFormat(const PooledFormat &);
+    PooledFormat &operator=(const PooledFormat &);
+};
+
+/**
+ * A SimpleDateFormat for the locale and pattern from the cached pool.
+ */
+class PooledSimpleDateFormat : public PooledFormat<SimpleDateFormat> {
+public:
+    PooledSimpleDateFormat(const Locale &locale, const UnicodeString &pattern, UErrorCode &status)
+            : PooledFormat<SimpleDateFormat>(
+                    SharedFormatPool::getDateFormatPool(locale, pattern, status), status) {}
+};
+
+/**
+ * A DecimalFormat for the locale and pattern from the cached pool.
+ */
+class PooledDecimalFormat : public PooledFormat<DecimalFormat> {
+public:
+    PooledDecimalFormat(const Locale &locale, const UnicodeString &pattern, UErrorCode &status)
+            : PooledFormat<DecimalFormat>(
+                    SharedFormatPool::getDecimalFormatPool(locale, pattern, status), status) {}
+};
+
+U_NAMESPACE_END
+
+#endif /* !UCONFIG_NO_FORMATTING */
+
+#endif
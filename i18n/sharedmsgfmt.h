@@ -0,0 +1,38 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+* sharedmsgfmt.h
+*/
+
+#ifndef __SHARED_MSGFMT_H__
+#define __SHARED_MSGFMT_H__
+
+#include "unicode/utypes.h"
+#include "sharedobject.h"
+
+U_NAMESPACE_BEGIN
+
+class MessageFormat;
+
+/**
+ * An immutable MessageFormat shared through the UnifiedCache.
+ * Its default formats and plural rules are created up front,
+ * so that several threads may call its const format() methods concurrently.
+ */
+class U_I18N_API SharedMessageFormat : public SharedObject {
+public:
+    SharedMessageFormat(MessageFormat *mfToAdopt) : ptr(mfToAdopt) { }
+    virtual ~SharedMessageFormat();
+    const MessageFormat *get() const { return ptr; }
+    const MessageFormat *operator->() const { return ptr; }
+    const MessageFormat &operator*() const { return *ptr; }
+private:
+    MessageFormat *ptr;
+    SharedMessageFormat(const SharedMessageFormat &);
+    SharedMessageFormat &operator=(const SharedMessageFormat &);
+};
+
+U_NAMESPACE_END
+
+#endif
@@ -58,6 +58,7 @@
 #include "olsontz.h"
 #include "patternprops.h"
 #include "fphdlimp.h"
+#include "gregoimp.h"
 #include "hebrwcal.h"
 #include "cstring.h"
 #include "uassert.h"
@@ -73,6 +74,7 @@
 #include "cstr.h"
 #include "dayperiodrules.h"
 #include "tznames_impl.h"   // ZONE_NAME_U16_MAX
+#include "zonemeta.h"
 #include "number_utypes.h"
 
 #if defined( U_DEBUG_CALSVC ) || defined (U_DEBUG_CAL)
@@ -114,6 +116,19 @@ typedef enum GmtPatSize {
     kUtcLen = 3
 } GmtPatSize;
 
+// The latest date that SimpleDateFormat::formatGregorian() handles, about the year 300000,
+// which keeps the Julian day and the year of GregorianFields well within int32_t.
+static const UDate kMaxGregorianFieldsMillis = 1.0e16;
+
+/**
+ * Returns a field value from the precomputed Gregorian fields if there are any,
+ * otherwise from the calendar.
+ */
+static inline int32_t getFieldValue(Calendar& cal, const GregorianFields* gregorianFields,
+                                    UCalendarDateFields field, UErrorCode& status) {
+    return (gregorianFields != NULL)? gregorianFields->get(field): cal.get(field, status);
+}
+
 // Stuff needed for numbering system overrides
 
 typedef enum OvrStrType {
@@ -230,7 +245,7 @@ static const int32_t gFieldRangeBias[] = {
 static const int32_t HEBREW_CAL_CUR_MILLENIUM_START_YEAR = 5000;
 static const int32_t HEBREW_CAL_CUR_MILLENIUM_END_YEAR = 6000;
 
-static UMutex LOCK = U_MUTEX_INITIALIZER;
+static UMutex LOCK = U_NAMED_MUTEX_INITIALIZER("SimpleDateFormat");
 
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(SimpleDateFormat)
 
@@ -580,8 +595,11 @@ SimpleDateFormat& SimpleDateFormat::operator=(const SimpleDateFormat& other)
     fHaveDefaultCentury          = other.fHaveDefaultCentury;
 
     fPattern = other.fPattern;
+    fCompiledPattern = other.fCompiledPattern;
     fHasMinute = other.fHasMinute;
     fHasSecond = other.fHasSecond;
+    fHasOnlyGregorianFields = other.fHasOnlyGregorianFields;
+    fIsFixedNumericPattern = other.fIsFixedNumericPattern;
 
     // TimeZoneFormat in ICU4C only depends on a locale for now
     if (fLocale != other.fLocale) {
@@ -653,6 +671,7 @@ void SimpleDateFormat::construct(EStyle timeStyle,
                                  const Locale& locale,
                                  UErrorCode& status)
 {
+    MemoryTagScope memoryTag(UMEM_TAG_FORMATTING);
     // called by several constructors to load pattern data from the resources
     if (U_FAILURE(status)) return;
 
@@ -854,6 +873,7 @@ void
 SimpleDateFormat::initialize(const Locale& locale,
                              UErrorCode& status)
 {
+    MemoryTagScope memoryTag(UMEM_TAG_FORMATTING);
     if (U_FAILURE(status)) return;
 
     // We don't need to check that the row count is >= 1, since all 2d arrays have at
@@ -980,6 +1000,13 @@ SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
     int32_t fieldNum = 0;
     UDisplayContext capitalizationContext = getContext(UDISPCTX_TYPE_CAPITALIZATION, status);
 
+    if (!fCompiledPattern.isBogus()) {
+        formatCompiledPattern(0, fCompiledPattern.length(), 0, appendTo, capitalizationContext,
+                              handler, *workCal, NULL, status);
+        delete calClone;
+        return appendTo;
+    }
+
     // loop through the pattern string character by character
     for (int32_t i = 0; i < fPattern.length() && U_SUCCESS(status); ++i) {
         UChar ch = fPattern[i];
@@ -987,7 +1014,7 @@ SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
         // Use subFormat() to format a repeated pattern character
         // when a different pattern or non-pattern character is seen
         if (ch != prevCh && count > 0) {
-            subFormat(appendTo, prevCh, count, capitalizationContext, fieldNum++, handler, *workCal, status);
+            subFormat(appendTo, prevCh, count, capitalizationContext, fieldNum++, handler, *workCal, NULL, status);
             count = 0;
         }
         if (ch == QUOTE) {
@@ -1014,7 +1041,7 @@ SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
 
     // Format the last item in the pattern, if any
     if (count > 0) {
-        subFormat(appendTo, prevCh, count, capitalizationContext, fieldNum++, handler, *workCal, status);
+        subFormat(appendTo, prevCh, count, capitalizationContext, fieldNum++, handler, *workCal, NULL, status);
     }
 
     if (calClone != NULL) {
@@ -1026,6 +1053,174 @@ SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
 
 //----------------------------------------------------------------------
 
+int32_t
+SimpleDateFormat::formatCompiledPattern(int32_t start, int32_t limit, int32_t fieldNum,
+                                        UnicodeString &appendTo,
+                                        UDisplayContext capitalizationContext,
+                                        FieldPositionHandler& handler,
+                                        Calendar& cal,
+                                        const GregorianFields* gregorianFields,
+                                        UErrorCode& status) const
+{
+    // Run the ops that parsePattern() compiled from the pattern
+    const UChar* ops = fCompiledPattern.getBuffer();
+    for (int32_t i = start; i < limit && U_SUCCESS(status);) {
+        UChar op = ops[i++];
+        int32_t length = ops[i++];
+        if (op == 0) {
+            appendTo.append(fCompiledPattern, i, length);
+            i += length;
+        } else {
+            subFormat(appendTo, op, length, capitalizationContext, fieldNum++, handler,
+                      cal, gregorianFields, status);
+        }
+    }
+    return fieldNum;
+}
+
+//----------------------------------------------------------------------
+
+UBool
+SimpleDateFormat::canFormatGregorian(UDate date) const
+{
+    if (!fHasOnlyGregorianFields || fCompiledPattern.isBogus() || fCalendar == NULL ||
+            fCalendar->getDynamicClassID() != GregorianCalendar::getStaticClassID()) {
+        return FALSE;
+    }
+    // Start after the year of the Gregorian cutover, whose day of year counts differently,
+    // with another day for the time zone offset; and avoid the far future
+    // where the fields would overflow.
+    const GregorianCalendar* gc = static_cast<const GregorianCalendar*>(fCalendar);
+    return gc->getGregorianChange() + 368.0 * U_MILLIS_PER_DAY <= date && date <= kMaxGregorianFieldsMillis;
+}
+
+//----------------------------------------------------------------------
+
+void
+SimpleDateFormat::formatGregorian(UDate date, UnicodeString& appendTo,
+                                  FieldPositionHandler& handler, UErrorCode& status) const
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    GregorianFields fields;
+    Grego::timeToFields(date, fCalendar->getTimeZone(), fields, status);
+    UDisplayContext capitalizationContext = getContext(UDISPCTX_TYPE_CAPITALIZATION, status);
+    if (U_SUCCESS(status)) {
+        formatCompiledPattern(0, fCompiledPattern.length(), 0, appendTo, capitalizationContext,
+                              handler, *fCalendar, &fields, status);
+    }
+}
+
+//----------------------------------------------------------------------
+
+void
+SimpleDateFormat::_formatBatch(const UDate* dates, int32_t count, UnicodeString& appendTo,
+                               int32_t* offsets, UErrorCode& status) const
+{
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    FieldPositionOnlyHandler handler(pos);
+    UDisplayContext capitalizationContext = getContext(UDISPCTX_TYPE_CAPITALIZATION, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    // Find the leading ops that depend only on the local date (dayLimit),
+    // and those that depend only on the local date, hour and minute (minuteLimit).
+    // Their text is the same as for the previous date if that had the same local day or minute.
+    int32_t dayLimit = 0, minuteLimit = 0;
+    int32_t dayFieldNum = 0, minuteFieldNum = 0;
+    if (fHasOnlyGregorianFields && !fCompiledPattern.isBogus()) {
+        const UChar* ops = fCompiledPattern.getBuffer();
+        int32_t opsLength = fCompiledPattern.length();
+        UBool inDayOps = TRUE;
+        int32_t fieldNum = 0;
+        int32_t i = 0;
+        for (; i < opsLength; i += 2) {
+            UChar op = ops[i];
+            if (op == 0) {
+                i += ops[i + 1];
+                continue;
+            }
+            UDateFormatField patternCharIndex = DateFormatSymbols::getPatternCharIndex(op);
+            UCalendarDateFields field = (patternCharIndex == UDAT_TIME_SEPARATOR_FIELD) ?
+                UCAL_ERA : fgPatternIndexToCalendarField[patternCharIndex];  // constant like the era
+            UBool isDayField = field == UCAL_ERA || field == UCAL_YEAR || field == UCAL_EXTENDED_YEAR ||
+                field == UCAL_MONTH || field == UCAL_DATE || field == UCAL_DAY_OF_YEAR ||
+                field == UCAL_DAY_OF_WEEK || field == UCAL_DAY_OF_WEEK_IN_MONTH || field == UCAL_JULIAN_DAY;
+            // The day periods 'b' and 'B' may also depend on the seconds.
+            UBool isMinuteField = (field == UCAL_AM_PM && patternCharIndex == UDAT_AM_PM_FIELD) ||
+                field == UCAL_HOUR || field == UCAL_HOUR_OF_DAY || field == UCAL_MINUTE;
+            if (inDayOps && !isDayField) {
+                dayLimit = i;
+                dayFieldNum = fieldNum;
+                inDayOps = FALSE;
+            }
+            if (!isDayField && !isMinuteField) {
+                break;
+            }
+            ++fieldNum;
+        }
+        if (inDayOps) {
+            dayLimit = i;
+            dayFieldNum = fieldNum;
+        }
+        minuteLimit = i;
+        minuteFieldNum = fieldNum;
+    }
+
+    // The text of the ops before minuteLimit for the previous date,
+    // of which the first prefixDayLength characters are for the ops before dayLimit
+    UnicodeString prefix;
+    int32_t prefixDayLength = 0;
+    int32_t prefixJulianDay = 0;
+    int32_t prefixMinute = -1;
+    LocalPointer<Calendar> cal;
+    for (int32_t i = 0; i < count && U_SUCCESS(status); ++i) {
+        int32_t start = appendTo.length();
+        if (canFormatGregorian(dates[i])) {
+            GregorianFields fields;
+            Grego::timeToFields(dates[i], fCalendar->getTimeZone(), fields, status);
+            if (U_FAILURE(status)) {
+                break;
+            }
+            int32_t minute = fields.millisInDay / U_MILLIS_PER_MINUTE;
+            if (prefixMinute >= 0 && fields.julianDay == prefixJulianDay && minute == prefixMinute) {
+                appendTo.append(prefix);
+            } else {
+                if (prefixMinute >= 0 && fields.julianDay == prefixJulianDay) {
+                    appendTo.append(prefix, 0, prefixDayLength);
+                } else {
+                    formatCompiledPattern(0, dayLimit, 0, appendTo, capitalizationContext,
+                                          handler, *fCalendar, &fields, status);
+                    prefixDayLength = appendTo.length() - start;
+                }
+                formatCompiledPattern(dayLimit, minuteLimit, dayFieldNum, appendTo, capitalizationContext,
+                                      handler, *fCalendar, &fields, status);
+                prefix.setTo(appendTo, start);
+                prefixJulianDay = fields.julianDay;
+                prefixMinute = minute;
+            }
+            formatCompiledPattern(minuteLimit, fCompiledPattern.length(), minuteFieldNum, appendTo,
+                                  capitalizationContext, handler, *fCalendar, &fields, status);
+        } else {
+            // Use one calendar for all of the dates that need one.
+            if (cal.isNull()) {
+                cal.adoptInsteadAndCheckErrorCode(fCalendar->clone(), status);
+                if (U_FAILURE(status)) {
+                    break;
+                }
+            }
+            cal->setTime(dates[i], status);
+            _format(*cal, appendTo, handler, status);
+            prefixMinute = -1;
+        }
+        if (offsets != NULL) {
+            offsets[i] = appendTo.length();
+        }
+    }
+}
+
 /* Map calendar field into calendar field level.
  * the larger the level, the smaller the field unit.
  * For example, UCAL_ERA level is 0, UCAL_YEAR level is 10,
@@ -1230,6 +1425,27 @@ void SimpleDateFormat::initFastNumberFormatters(UErrorCode& status) {
     fFastNumberFormatters[SMPDTFMT_NF_3x10] = createFastFormatter(df, 3, 10);
     fFastNumberFormatters[SMPDTFMT_NF_4x10] = createFastFormatter(df, 4, 10);
     fFastNumberFormatters[SMPDTFMT_NF_2x2] = createFastFormatter(df, 2, 2);
+
+    // If the number format adds nothing but the digits to a nonnegative integer,
+    // then zeroPaddingNumber() can write the digits without calling it.
+    const DecimalFormatSymbols* dfs = df->getDecimalFormatSymbols();
+    UnicodeString affix;
+    if (df->getDynamicClassID() == DecimalFormat::getStaticClassID() &&
+            dfs != nullptr &&
+            !df->isGroupingUsed() &&
+            !df->isDecimalSeparatorAlwaysShown() &&
+            !df->isSignAlwaysShown() &&
+            !df->isScientificNotation() &&
+            !df->areSignificantDigitsUsed() &&
+            df->getMinimumFractionDigits() == 0 &&
+            df->getMultiplier() == 1 &&
+            df->getMultiplierScale() == 0 &&
+            df->getRoundingIncrement() == 0.0 &&
+            df->getFormatWidth() <= 0 &&  // -1 if not set
+            df->getPositivePrefix(affix).isEmpty() &&
+            df->getPositiveSuffix(affix).isEmpty()) {
+        fFastZeroDigit = dfs->getCodePointZero();
+    }
 }
 
 void SimpleDateFormat::freeFastNumberFormatters() {
@@ -1243,6 +1459,7 @@ void SimpleDateFormat::freeFastNumberFormatters() {
     fFastNumberFormatters[SMPDTFMT_NF_3x10] = nullptr;
     fFastNumberFormatters[SMPDTFMT_NF_4x10] = nullptr;
     fFastNumberFormatters[SMPDTFMT_NF_2x2] = nullptr;
+    fFastZeroDigit = -1;
 }
 
 
@@ -1395,6 +1612,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
                             int32_t fieldNum,
                             FieldPositionHandler& handler,
                             Calendar& cal,
+                            const GregorianFields* gregorianFields,
                             UErrorCode& status) const
 {
     if (U_FAILURE(status)) {
@@ -1426,7 +1644,8 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
     int32_t value = 0;
     // Don't get value unless it is useful
     if (field < UCAL_FIELD_COUNT) {
-        value = (patternCharIndex != UDAT_RELATED_YEAR_FIELD)? cal.get(field, status): cal.getRelatedYear(status);
+        value = (patternCharIndex != UDAT_RELATED_YEAR_FIELD)?
+                getFieldValue(cal, gregorianFields, field, status): cal.getRelatedYear(status);
     }
     if (U_FAILURE(status)) {
         return;
@@ -1503,7 +1722,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
         }
         {
             int32_t isLeapMonth = (fSymbols->fLeapMonthPatterns != NULL && fSymbols->fLeapMonthPatternsCount >= DateFormatSymbols::kMonthPatternsCount)?
-                        cal.get(UCAL_IS_LEAP_MONTH, status): 0;
+                        getFieldValue(cal, gregorianFields, UCAL_IS_LEAP_MONTH, status): 0;
             // should consolidate the next section by using arrays of pointers & counts for the right symbols...
             if (count == 5) {
                 if (patternCharIndex == UDAT_MONTH_FIELD) {
@@ -1579,7 +1798,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
         }
         // fall through to EEEEE-EEE handling, but for that we don't want local day-of-week,
         // we want standard day-of-week, so first fix value to work for EEEEE-EEE.
-        value = cal.get(UCAL_DAY_OF_WEEK, status);
+        value = getFieldValue(cal, gregorianFields, UCAL_DAY_OF_WEEK, status);
         if (U_FAILURE(status)) {
             return;
         }
@@ -1616,7 +1835,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
         }
         // fall through to alpha DOW handling, but for that we don't want local day-of-week,
         // we want standard day-of-week, so first fix value.
-        value = cal.get(UCAL_DAY_OF_WEEK, status);
+        value = getFieldValue(cal, gregorianFields, UCAL_DAY_OF_WEEK, status);
         if (U_FAILURE(status)) {
             return;
         }
@@ -1679,7 +1898,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
             UChar zsbuf[ZONE_NAME_U16_MAX];
             UnicodeString zoneString(zsbuf, 0, UPRV_LENGTHOF(zsbuf));
             const TimeZone& tz = cal.getTimeZone();
-            UDate date = cal.getTime(status);
+            UDate date = (gregorianFields != NULL)? gregorianFields->time: cal.getTime(status);
             const TimeZoneFormat *tzfmt = tzFormat(status);
             if (U_SUCCESS(status)) {
                 if (patternCharIndex == UDAT_TIMEZONE_FIELD) {
@@ -1810,7 +2029,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
     case UDAT_AM_PM_MIDNIGHT_NOON_FIELD:
     {
         const UnicodeString *toAppend = NULL;
-        int32_t hour = cal.get(UCAL_HOUR_OF_DAY, status);
+        int32_t hour = getFieldValue(cal, gregorianFields, UCAL_HOUR_OF_DAY, status);
 
         // Note: "midnight" can be ambiguous as to whether it refers to beginning of day or end of day.
         // For ICU 57 output of "midnight" is temporarily suppressed.
@@ -1819,12 +2038,12 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
         // Time, as displayed, must be exactly noon or midnight.
         // This means minutes and seconds, if present, must be zero.
         if ((/*hour == 0 ||*/ hour == 12) &&
-                (!fHasMinute || cal.get(UCAL_MINUTE, status) == 0) &&
-                (!fHasSecond || cal.get(UCAL_SECOND, status) == 0)) {
+                (!fHasMinute || getFieldValue(cal, gregorianFields, UCAL_MINUTE, status) == 0) &&
+                (!fHasSecond || getFieldValue(cal, gregorianFields, UCAL_SECOND, status) == 0)) {
             // Stealing am/pm value to use as our array index.
             // It works out: am/midnight are both 0, pm/noon are both 1,
             // 12 am is 12 midnight, and 12 pm is 12 noon.
-            int32_t val = cal.get(UCAL_AM_PM, status);
+            int32_t val = getFieldValue(cal, gregorianFields, UCAL_AM_PM, status);
 
             if (count <= 3) {
                 toAppend = &fSymbols->fAbbreviatedDayPeriods[val];
@@ -1841,7 +2060,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
         if (toAppend == NULL || toAppend->isBogus()) {
             // Reformat with identical arguments except ch, now changed to 'a'.
             subFormat(appendTo, 0x61, count, capitalizationContext, fieldNum,
-                      handler, cal, status);
+                      handler, cal, gregorianFields, status);
         } else {
             appendTo += *toAppend;
         }
@@ -1862,19 +2081,19 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
             // Data doesn't exist for the locale we're looking for.
             // Falling back to am/pm.
             subFormat(appendTo, 0x61, count, capitalizationContext, fieldNum,
-                      handler, cal, status);
+                      handler, cal, gregorianFields, status);
             break;
         }
 
         // Get current display time.
-        int32_t hour = cal.get(UCAL_HOUR_OF_DAY, status);
+        int32_t hour = getFieldValue(cal, gregorianFields, UCAL_HOUR_OF_DAY, status);
         int32_t minute = 0;
         if (fHasMinute) {
-            minute = cal.get(UCAL_MINUTE, status);
+            minute = getFieldValue(cal, gregorianFields, UCAL_MINUTE, status);
         }
         int32_t second = 0;
         if (fHasSecond) {
-            second = cal.get(UCAL_SECOND, status);
+            second = getFieldValue(cal, gregorianFields, UCAL_SECOND, status);
         }
 
         // Determine day period.
@@ -1933,7 +2152,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
             periodType == DayPeriodRules::DAYPERIOD_PM ||
             toAppend->isBogus()) {
             subFormat(appendTo, 0x61, count, capitalizationContext, fieldNum,
-                      handler, cal, status);
+                      handler, cal, gregorianFields, status);
         }
         else {
             appendTo += *toAppend;
@@ -2050,6 +2269,32 @@ SimpleDateFormat::zeroPaddingNumber(
         UnicodeString &appendTo,
         int32_t value, int32_t minDigits, int32_t maxDigits) const
 {
+    if (currentNumberFormat == fNumberFormat && fFastZeroDigit != -1 && value >= 0 &&
+            1 <= minDigits && minDigits <= maxDigits && maxDigits <= 10) {
+        // Write the digits like the number format would:
+        // Keep the maxDigits least significant digits, and pad with zeros to minDigits.
+        int8_t digits[10];
+        int32_t length = 0;
+        for (; value != 0 && length < maxDigits; value /= 10) {
+            digits[length++] = static_cast<int8_t>(value % 10);
+        }
+        for (; length < minDigits; ++length) {
+            digits[length] = 0;
+        }
+        if (fFastZeroDigit <= 0xffff) {
+            UChar buffer[10];
+            for (int32_t i = 0; i < length; ++i) {
+                buffer[i] = static_cast<UChar>(fFastZeroDigit + digits[length - 1 - i]);
+            }
+            appendTo.append(buffer, 0, length);
+        } else {
+            for (int32_t i = length - 1; i >= 0; --i) {
+                appendTo.append(static_cast<UChar32>(fFastZeroDigit + digits[i]));
+            }
+        }
+        return;
+    }
+
     const number::LocalizedNumberFormatter* fastFormatter = nullptr;
     // NOTE: This uses the heuristic that these five min/max int settings account for the vast majority
     // of SimpleDateFormat number formatting cases at the time of writing (ICU 62).
@@ -2156,6 +2401,36 @@ SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition&
     }
     int32_t start = pos;
 
+    // A cleared calendar, as from DateFormat::parse(), has no other field values
+    // that could combine with the parsed ones; then a fixed numeric pattern
+    // sets the calendar's time in one step.
+    if (fIsFixedNumericPattern) {
+        UBool isCleared = TRUE;
+        for (int32_t field = 0; field < UCAL_FIELD_COUNT && isCleared; ++field) {
+            isCleared = !cal.isSet((UCalendarDateFields)field);
+        }
+        UDate fixedDate;
+        int32_t zoneOffset;
+        UBool hasZoneOffset;
+        if (isCleared && parseFixedNumeric(text, parsePos, cal, fixedDate, zoneOffset, hasZoneOffset)) {
+            if (hasZoneOffset) {
+                // Like TimeZoneFormat::parse() for an ISO 8601 offset
+                static const UChar TZID_GMT[] = {0x0045, 0x0074, 0x0063, 0x002F, 0x0047, 0x004D, 0x0054, 0};    // Etc/GMT
+                TimeZone* tz = (zoneOffset == 0) ?
+                    TimeZone::createTimeZone(UnicodeString(TRUE, TZID_GMT, -1)) :
+                    ZoneMeta::createCustomTimeZone(zoneOffset);
+                if (tz == NULL) {
+                    parsePos.setIndex(start);
+                    parsePos.setErrorIndex(start);
+                    return;
+                }
+                cal.adoptTimeZone(tz);
+            }
+            cal.setTime(fixedDate, status);
+            return;
+        }
+    }
+
     // Hold the day period until everything else is parsed, because we need
     // the hour to interpret time correctly.
     int32_t dayPeriodInt = -1;
@@ -3883,6 +4158,7 @@ SimpleDateFormat::applyLocalizedPattern(const UnicodeString& pattern,
     translatePattern(pattern, fPattern,
                      fSymbols->fLocalPatternChars,
                      UnicodeString(DateFormatSymbols::getPatternUChars()), status);
+    parsePattern();
 }
 
 //----------------------------------------------------------------------
@@ -4192,11 +4468,10 @@ SimpleDateFormat::tzFormat(UErrorCode &status) const {
         {
             if (fTimeZoneFormat == NULL) {
                 TimeZoneFormat *tzfmt = TimeZoneFormat::createInstance(fLocale, status);
-                if (U_FAILURE(status)) {
-                    return NULL;
+                // Do not return while holding the lock: fTimeZoneFormat stays NULL on failure.
+                if (U_SUCCESS(status)) {
+                    const_cast<SimpleDateFormat *>(this)->fTimeZoneFormat = tzfmt;
                 }
-
-                const_cast<SimpleDateFormat *>(this)->fTimeZoneFormat = tzfmt;
             }
         }
         umtx_unlock(&LOCK);
@@ -4224,6 +4499,280 @@ void SimpleDateFormat::parsePattern() {
             }
         }
     }
+
+    // Compile the pattern the same way that _format() would interpret it.
+    fCompiledPattern.remove();
+    fHasOnlyGregorianFields = TRUE;
+    fIsFixedNumericPattern = FALSE;
+    UChar prevCh = 0;
+    int32_t count = 0;
+    int32_t literalStart = -1;
+    inQuote = FALSE;
+    for (int32_t i = 0; i <= len; ++i) {
+        UChar ch = i < len ? fPattern[i] : 0;
+        if (ch != prevCh && count > 0) {
+            if (count > 0xffff) {
+                fCompiledPattern.setToBogus();
+                return;
+            }
+            fCompiledPattern.append(prevCh).append((UChar)count);
+            UDateFormatField patternCharIndex = DateFormatSymbols::getPatternCharIndex(prevCh);
+            if (patternCharIndex == UDAT_FIELD_COUNT || patternCharIndex == UDAT_RELATED_YEAR_FIELD ||
+                    (fgPatternIndexToCalendarField[patternCharIndex] != UCAL_FIELD_COUNT &&
+                     !GregorianFields::isSupported(fgPatternIndexToCalendarField[patternCharIndex]))) {
+                fHasOnlyGregorianFields = FALSE;
+            }
+            count = 0;
+        }
+        if (i == len) {
+            break;
+        }
+        UBool isLiteral = FALSE;
+        if (ch == QUOTE) {
+            // Consecutive single quotes are a single quote literal,
+            // either outside of quotes or between quotes
+            if ((i+1) < len && fPattern[i+1] == QUOTE) {
+                isLiteral = TRUE;
+                ++i;
+            } else {
+                inQuote = !inQuote;
+            }
+        } else if (!inQuote && isSyntaxChar(ch)) {
+            prevCh = ch;
+            ++count;
+        } else {
+            isLiteral = TRUE;
+        }
+        if (isLiteral) {
+            // Append to the current literal op if it immediately precedes, otherwise start a new one.
+            if (literalStart < 0 || fCompiledPattern[literalStart + 1] == 0xffff ||
+                    literalStart + 2 + fCompiledPattern[literalStart + 1] != fCompiledPattern.length()) {
+                literalStart = fCompiledPattern.length();
+                fCompiledPattern.append((UChar)0).append((UChar)0);
+            }
+            fCompiledPattern.append(ch);
+            fCompiledPattern.setCharAt(literalStart + 1, fCompiledPattern[literalStart + 1] + 1);
+        }
+    }
+
+    // Check for a fixed-width numeric pattern like yyyy-MM-dd'T'HH:mm:ss.SSSXXX.
+    const UChar* ops = fCompiledPattern.getBuffer();
+    int32_t opsLength = fCompiledPattern.length();
+    uint32_t seen = 0;
+    for (int32_t i = 0; i < opsLength; i += 2) {
+        UChar op = ops[i];
+        int32_t opCount = ops[i + 1];
+        if (op == 0) {
+            i += opCount;
+            continue;
+        }
+        UDateFormatField patternCharIndex = DateFormatSymbols::getPatternCharIndex(op);
+        UBool isFixed;
+        switch (patternCharIndex) {
+        case UDAT_YEAR_FIELD:
+            isFixed = opCount == 4;
+            break;
+        case UDAT_MONTH_FIELD:
+        case UDAT_DATE_FIELD:
+        case UDAT_HOUR_OF_DAY0_FIELD:
+        case UDAT_MINUTE_FIELD:
+        case UDAT_SECOND_FIELD:
+            isFixed = opCount == 2;
+            break;
+        case UDAT_FRACTIONAL_SECOND_FIELD:
+            isFixed = opCount <= 9;
+            break;
+        case UDAT_TIMEZONE_ISO_FIELD:
+        case UDAT_TIMEZONE_ISO_LOCAL_FIELD:
+            isFixed = opCount == 2 || opCount == 3;
+            patternCharIndex = UDAT_TIMEZONE_ISO_FIELD;  // only one zone field
+            break;
+        default:
+            isFixed = FALSE;
+            break;
+        }
+        uint32_t bit = (uint32_t)1 << (patternCharIndex & 31);
+        if (!isFixed || (seen & bit) != 0) {
+            return;
+        }
+        seen |= bit;
+    }
+    uint32_t dateBits = ((uint32_t)1 << UDAT_YEAR_FIELD) | ((uint32_t)1 << UDAT_MONTH_FIELD) |
+        ((uint32_t)1 << UDAT_DATE_FIELD);
+    fIsFixedNumericPattern = (seen & dateBits) == dateBits;
+}
+
+UBool
+SimpleDateFormat::parseFixedNumeric(const UnicodeString& text, ParsePosition& parsePos, const Calendar& cal,
+                                    UDate& date, int32_t& zoneOffset, UBool& hasZoneOffset) const
+{
+    // The general parser accepts any decimal digits, and it may use other number formats per field;
+    // here, only the ASCII digits of a plain number format.
+    int32_t pos = parsePos.getIndex();
+    if (!fIsFixedNumericPattern || fFastZeroDigit != 0x30 || fSharedNumberFormatters != NULL ||
+            cal.getDynamicClassID() != GregorianCalendar::getStaticClassID() || pos < 0) {
+        return FALSE;
+    }
+    // Values for a cleared calendar, as for fields that the pattern does not have.
+    int32_t year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0, millis = 0;
+    zoneOffset = 0;
+    hasZoneOffset = FALSE;
+
+    const UChar* s = text.getBuffer();
+    int32_t textLength = text.length();
+    const UChar* ops = fCompiledPattern.getBuffer();
+    int32_t opsLength = fCompiledPattern.length();
+    UChar lastOp = 0;
+    for (int32_t i = 0; i < opsLength; i += 2) {
+        UChar op = ops[i];
+        int32_t count = ops[i + 1];
+        lastOp = op;
+        if (op == 0) {
+            // Literal text must match exactly; the general parser handles lenient matches.
+            if (textLength - pos < count || u_memcmp(s + pos, ops + i + 2, count) != 0) {
+                return FALSE;
+            }
+            pos += count;
+            i += count;
+            continue;
+        }
+        if (op == 0x58 || op == 0x78) {  // 'X' or 'x': "Z", +HHMM or +HH:MM
+            hasZoneOffset = TRUE;
+            if (op == 0x58 && pos < textLength && s[pos] == 0x5A) {
+                ++pos;
+            } else {
+                int32_t need = (count == 3) ? 6 : 5;
+                if (textLength - pos < need || (s[pos] != 0x2B && s[pos] != 0x2D) ||
+                        (count == 3 && s[pos + 3] != 0x3A)) {
+                    return FALSE;
+                }
+                const UChar* p = s + pos + 1;
+                const UChar* q = p + need - 3;
+                if (!(0x30 <= p[0] && p[0] <= 0x32 && 0x30 <= p[1] && p[1] <= 0x39 &&
+                        0x30 <= q[0] && q[0] <= 0x35 && 0x30 <= q[1] && q[1] <= 0x39)) {
+                    return FALSE;
+                }
+                int32_t offsetHour = (p[0] - 0x30) * 10 + (p[1] - 0x30);
+                if (offsetHour > 23) {
+                    return FALSE;
+                }
+                zoneOffset = (offsetHour * 60 + (q[0] - 0x30) * 10 + (q[1] - 0x30)) * U_MILLIS_PER_MINUTE;
+                if (s[pos] == 0x2D) {
+                    zoneOffset = -zoneOffset;
+                }
+                pos += need;
+            }
+            // The general parser would read further offset digits or seconds.
+            if (pos < textLength && (s[pos] == 0x3A || u_isdigit(text.char32At(pos)))) {
+                return FALSE;
+            }
+            continue;
+        }
+        if (textLength - pos < count) {
+            return FALSE;
+        }
+        int32_t value = 0;
+        for (int32_t k = 0; k < count; ++k) {
+            UChar c = s[pos + k];
+            if (c < 0x30 || 0x39 < c) {
+                return FALSE;
+            }
+            value = value * 10 + (c - 0x30);
+        }
+        pos += count;
+        // Unless another numeric field abuts this one, the general parser would read more digits.
+        UChar nextOp = (i + 2 < opsLength) ? ops[i + 2] : 0;
+        if ((nextOp == 0 || nextOp == 0x58 || nextOp == 0x78) &&
+                pos < textLength && u_isdigit(text.char32At(pos))) {
+            return FALSE;
+        }
+        // Out-of-range values are left to the general parser, for the calendar's leniency.
+        switch (op) {
+        case 0x79:  // 'y'
+            year = value;
+            break;
+        case 0x4D:  // 'M'
+            if (value < 1 || value > 12) {
+                return FALSE;
+            }
+            month = value - 1;
+            break;
+        case 0x64:  // 'd'
+            if (value < 1) {
+                return FALSE;
+            }
+            day = value;
+            break;
+        case 0x48:  // 'H'
+            if (value > 23) {
+                return FALSE;
+            }
+            hour = value;
+            break;
+        case 0x6D:  // 'm'
+        case 0x73:  // 's'
+            if (value > 59) {
+                return FALSE;
+            }
+            (op == 0x6D ? minute : second) = value;
+            break;
+        default:  // 'S' is left-justified to milliseconds
+            for (; count < 3; ++count) {
+                value *= 10;
+            }
+            for (; count > 3; --count) {
+                value /= 10;
+            }
+            millis = value;
+            break;
+        }
+    }
+    // The general parser skips a '.' after a trailing zone offset.
+    if ((lastOp == 0x58 || lastOp == 0x78) && pos < textLength && s[pos] == 0x2E) {
+        return FALSE;
+    }
+    if (day > Grego::monthLength(year, month)) {
+        return FALSE;
+    }
+
+    UDate localMillis = Grego::fieldsToDay(year, month, day) * U_MILLIS_PER_DAY +
+        (double)(((hour * 60 + minute) * 60 + second) * 1000 + millis);
+    if (hasZoneOffset) {
+        date = localMillis - zoneOffset;
+    } else {
+        // Resolve the local time like Calendar::computeZoneOffset(),
+        // leaving skipped wall times of strict calendars to the general parser.
+        const TimeZone& tz = cal.getTimeZone();
+        const BasicTimeZone* btz = NULL;
+        if (dynamic_cast<const OlsonTimeZone *>(&tz) != NULL
+            || dynamic_cast<const SimpleTimeZone *>(&tz) != NULL
+            || dynamic_cast<const RuleBasedTimeZone *>(&tz) != NULL
+            || dynamic_cast<const VTimeZone *>(&tz) != NULL) {
+            btz = (const BasicTimeZone*)&tz;
+        }
+        if (btz == NULL || !cal.isLenient() || cal.getSkippedWallTimeOption() == UCAL_WALLTIME_NEXT_VALID) {
+            return FALSE;
+        }
+        int32_t duplicatedTimeOpt = (cal.getRepeatedWallTimeOption() == UCAL_WALLTIME_FIRST) ?
+            BasicTimeZone::kFormer : BasicTimeZone::kLatter;
+        int32_t nonExistingTimeOpt = (cal.getSkippedWallTimeOption() == UCAL_WALLTIME_FIRST) ?
+            BasicTimeZone::kLatter : BasicTimeZone::kFormer;
+        int32_t rawOffset, dstOffset;
+        UErrorCode status = U_ZERO_ERROR;
+        btz->getOffsetFromLocal(localMillis, nonExistingTimeOpt, duplicatedTimeOpt,
+                                rawOffset, dstOffset, status);
+        if (U_FAILURE(status)) {
+            return FALSE;
+        }
+        date = localMillis - (rawOffset + dstOffset);
+    }
+    // As in canFormatGregorian(), stay clear of the Gregorian cutover year.
+    const GregorianCalendar& gc = static_cast<const GregorianCalendar&>(cal);
+    if (!(gc.getGregorianChange() + 368.0 * U_MILLIS_PER_DAY <= date && date <= kMaxGregorianFieldsMillis)) {
+        return FALSE;
+    }
+    parsePos.setIndex(pos);
+    return TRUE;
 }
 
 U_NAMESPACE_END
@@ -0,0 +1,673 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* startupsnapshot.cpp
+*
+* created on: 2026oct14
+*
+* Writing and reading snapshots of service objects.
+*******************************************************************************
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING && !UCONFIG_NO_COLLATION && !UCONFIG_NO_BREAK_ITERATION
+
+#include "unicode/brkiter.h"
+#include "unicode/dcfmtsym.h"
+#include "unicode/dtfmtsym.h"
+#include "unicode/localpointer.h"
+#include "unicode/locid.h"
+#include "unicode/plurrule.h"
+#include "unicode/rbbi.h"
+#include "unicode/startupsnapshot.h"
+#include "unicode/tblcoll.h"
+#include "unicode/udata.h"
+#include "unicode/uversion.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "ucmndata.h"
+#include "udatamem.h"
+#include "uvectr32.h"
+
+/*
+ * Format of a snapshot:
+ *
+ * A standard ICU data header with dataFormat "Snap" and formatVersion 1.
+ * The dataVersion is the ICU version; a snapshot is only read
+ * by the same ICU version because the items mirror internal data structures.
+ * The header is padded to 32 bytes.
+ *
+ * The data after the header starts with
+ *   int32_t indexes[2 + 3 * itemCount];
+ *     indexes[0]  the number of items
+ *     indexes[1]  the length of the data after the header, in bytes
+ *   followed by the type, offset and length of each item.
+ *   Offsets are from the start of the data after the header,
+ *   and each item starts at a multiple of 16 bytes.
+ *
+ * A collator item is the output of RuleBasedCollator::cloneBinary().
+ * A break iterator item is the output of RuleBasedBreakIterator::getBinaryRules().
+ * The other items are lists of values:
+ *   int32_t count;
+ *   int32_t values[count];
+ *   char16_t units[];
+ * A string is stored as its length in values, -1 for a bogus string,
+ * and its code units followed by a NUL in units.
+ * An array of strings is stored as its length, -1 for a NULL array,
+ * followed by its strings.
+ */
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+enum {
+    ITEM_COLLATOR = 1,
+    ITEM_BREAK_ITERATOR,
+    ITEM_DECIMAL_FORMAT_SYMBOLS,
+    ITEM_DATE_FORMAT_SYMBOLS,
+    ITEM_PLURAL_RULES
+};
+
+const int32_t HEADER_LENGTH = 32;
+const int32_t ITEM_ALIGNMENT = 16;
+
+// The indexes of the first item in the indexes array.
+const int32_t IX_ITEMS = 2;
+
+const UDataInfo dataInfo = {
+    sizeof(UDataInfo),
+    0,
+
+    U_IS_BIG_ENDIAN,
+    U_CHARSET_FAMILY,
+    U_SIZEOF_UCHAR,
+    0,
+
+    { 0x53, 0x6e, 0x61, 0x70 },         // dataFormat="Snap"
+    { 1, 0, 0, 0 },                     // formatVersion
+    { U_ICU_VERSION_MAJOR_NUM, U_ICU_VERSION_MINOR_NUM, U_ICU_VERSION_PATCHLEVEL_NUM, 0 }
+};
+
+UBool U_CALLCONV
+isAcceptable(void * /*context*/,
+             const char * /*type*/, const char * /*name*/,
+             const UDataInfo *pInfo) {
+    return
+        pInfo->size >= 20 &&
+        pInfo->isBigEndian == dataInfo.isBigEndian &&
+        pInfo->charsetFamily == dataInfo.charsetFamily &&
+        pInfo->sizeofUChar == dataInfo.sizeofUChar &&
+        uprv_memcmp(pInfo->dataFormat, dataInfo.dataFormat, 4) == 0 &&
+        pInfo->formatVersion[0] == dataInfo.formatVersion[0] &&
+        uprv_memcmp(pInfo->dataVersion, dataInfo.dataVersion, 3) == 0;
+}
+
+/**
+ * Collects the values and strings of one item.
+ */
+class ItemWriter : public UMemory {
+public:
+    ItemWriter(UErrorCode &errorCode) : values(errorCode) {}
+
+    void appendInt(int32_t value, UErrorCode &errorCode) {
+        values.addElement(value, errorCode);
+    }
+
+    void appendString(const UnicodeString &s, UErrorCode &errorCode) {
+        if(s.isBogus()) {
+            appendInt(-1, errorCode);
+        } else {
+            appendInt(s.length(), errorCode);
+            units.append(s).append((UChar)0);
+        }
+    }
+
+    void appendInvariantChars(const char *s, UErrorCode &errorCode) {
+        appendString(UnicodeString(s, -1, US_INV), errorCode);
+    }
+
+    void appendArray(const UnicodeString *array, int32_t count, UErrorCode &errorCode) {
+        if(array == NULL) {
+            appendInt(-1, errorCode);
+            return;
+        }
+        appendInt(count, errorCode);
+        for(int32_t i = 0; i < count; ++i) {
+            appendString(array[i], errorCode);
+        }
+    }
+
+    void write(CharString &dest, UErrorCode &errorCode) const {
+        if(U_FAILURE(errorCode)) { return; }
+        if(units.isBogus()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        int32_t count = values.size();
+        dest.append(reinterpret_cast<const char *>(&count), 4, errorCode);
+        dest.append(reinterpret_cast<const char *>(values.getBuffer()), count * 4, errorCode);
+        dest.append(reinterpret_cast<const char *>(units.getBuffer()),
+                    units.length() * U_SIZEOF_UCHAR, errorCode);
+    }
+
+private:
+    UVector32 values;
+    UnicodeString units;
+};
+
+/**
+ * Reads back the values and strings of one item, in the order in which they were written.
+ * Sets U_INVALID_FORMAT_ERROR if the item is truncated or inconsistent.
+ */
+class ItemReader : public UMemory {
+public:
+    ItemReader(const uint8_t *item, int32_t length, UErrorCode &errorCode)
+            : values(NULL), valuesLength(0), valuesIndex(0),
+              units(NULL), unitsLength(0), unitsIndex(0) {
+        if(U_FAILURE(errorCode)) { return; }
+        const int32_t *ints = reinterpret_cast<const int32_t *>(item);
+        if(length < 4 || ints[0] < 0 || ints[0] > (length - 4) / 4) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return;
+        }
+        values = ints + 1;
+        valuesLength = ints[0];
+        units = reinterpret_cast<const UChar *>(values + valuesLength);
+        unitsLength = (length - 4 - valuesLength * 4) / U_SIZEOF_UCHAR;
+    }
+
+    int32_t readInt(UErrorCode &errorCode) {
+        if(U_FAILURE(errorCode)) { return 0; }
+        if(valuesIndex >= valuesLength) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return 0;
+        }
+        return values[valuesIndex++];
+    }
+
+    void readString(UnicodeString &dest, UErrorCode &errorCode) {
+        int32_t length = readInt(errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        if(length < 0) {
+            dest.setToBogus();
+            return;
+        }
+        if(length >= unitsLength - unitsIndex || units[unitsIndex + length] != 0) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return;
+        }
+        dest.setTo(units + unitsIndex, length);
+        if(dest.isBogus()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+        }
+        unitsIndex += length + 1;
+    }
+
+    void readInvariantChars(char *dest, int32_t capacity, UErrorCode &errorCode) {
+        UnicodeString s;
+        readString(s, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        if(s.isBogus() || s.length() >= capacity) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return;
+        }
+        s.extract(0, s.length(), dest, capacity, US_INV);
+    }
+
+    /**
+     * Returns a new array, or NULL if a NULL array was written.
+     * The array is allocated the way DateFormatSymbols allocates its arrays.
+     */
+    UnicodeString *readArray(int32_t &count, UErrorCode &errorCode) {
+        count = 0;
+        int32_t length = readInt(errorCode);
+        if(U_FAILURE(errorCode) || length < 0) { return NULL; }
+        // Each string has a value of its own.
+        if(length > valuesLength - valuesIndex) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return NULL;
+        }
+        LocalArray<UnicodeString> array(new UnicodeString[length != 0 ? length : 1], errorCode);
+        for(int32_t i = 0; i < length; ++i) {
+            readString(array[i], errorCode);
+        }
+        if(U_FAILURE(errorCode)) { return NULL; }
+        count = length;
+        return array.orphan();
+    }
+
+private:
+    const int32_t *values;
+    int32_t valuesLength;
+    int32_t valuesIndex;
+    const UChar *units;
+    int32_t unitsLength;
+    int32_t unitsIndex;
+};
+
+struct StringArrayRef {
+    UnicodeString **array;
+    int32_t *count;
+};
+
+}  // namespace
+
+/*
+ * The string arrays of a DateFormatSymbols object, in snapshot order.
+ * A macro rather than a function because it needs the friend access
+ * of StartupSnapshot and StartupSnapshotBuilder.
+ */
+#define DATE_FORMAT_SYMBOLS_ARRAYS(s) { \
+    { &s.fEras, &s.fErasCount }, \
+    { &s.fEraNames, &s.fEraNamesCount }, \
+    { &s.fNarrowEras, &s.fNarrowErasCount }, \
+    { &s.fMonths, &s.fMonthsCount }, \
+    { &s.fShortMonths, &s.fShortMonthsCount }, \
+    { &s.fNarrowMonths, &s.fNarrowMonthsCount }, \
+    { &s.fStandaloneMonths, &s.fStandaloneMonthsCount }, \
+    { &s.fStandaloneShortMonths, &s.fStandaloneShortMonthsCount }, \
+    { &s.fStandaloneNarrowMonths, &s.fStandaloneNarrowMonthsCount }, \
+    { &s.fWeekdays, &s.fWeekdaysCount }, \
+    { &s.fShortWeekdays, &s.fShortWeekdaysCount }, \
+    { &s.fShorterWeekdays, &s.fShorterWeekdaysCount }, \
+    { &s.fNarrowWeekdays, &s.fNarrowWeekdaysCount }, \
+    { &s.fStandaloneWeekdays, &s.fStandaloneWeekdaysCount }, \
+    { &s.fStandaloneShortWeekdays, &s.fStandaloneShortWeekdaysCount }, \
+    { &s.fStandaloneShorterWeekdays, &s.fStandaloneShorterWeekdaysCount }, \
+    { &s.fStandaloneNarrowWeekdays, &s.fStandaloneNarrowWeekdaysCount }, \
+    { &s.fAmPms, &s.fAmPmsCount }, \
+    { &s.fNarrowAmPms, &s.fNarrowAmPmsCount }, \
+    { &s.fQuarters, &s.fQuartersCount }, \
+    { &s.fShortQuarters, &s.fShortQuartersCount }, \
+    { &s.fStandaloneQuarters, &s.fStandaloneQuartersCount }, \
+    { &s.fStandaloneShortQuarters, &s.fStandaloneShortQuartersCount }, \
+    { &s.fLeapMonthPatterns, &s.fLeapMonthPatternsCount }, \
+    { &s.fShortYearNames, &s.fShortYearNamesCount }, \
+    { &s.fShortZodiacNames, &s.fShortZodiacNamesCount }, \
+    { &s.fAbbreviatedDayPeriods, &s.fAbbreviatedDayPeriodsCount }, \
+    { &s.fWideDayPeriods, &s.fWideDayPeriodsCount }, \
+    { &s.fNarrowDayPeriods, &s.fNarrowDayPeriodsCount }, \
+    { &s.fStandaloneAbbreviatedDayPeriods, &s.fStandaloneAbbreviatedDayPeriodsCount }, \
+    { &s.fStandaloneWideDayPeriods, &s.fStandaloneWideDayPeriodsCount }, \
+    { &s.fStandaloneNarrowDayPeriods, &s.fStandaloneNarrowDayPeriodsCount } \
+}
+
+// StartupSnapshotBuilder -------------------------------------------------- ***
+
+StartupSnapshotBuilder::StartupSnapshotBuilder(UErrorCode &status)
+        : fItems(NULL), fData(NULL) {
+    if(U_FAILURE(status)) { return; }
+    LocalPointer<UVector32> items(new UVector32(status), status);
+    LocalPointer<CharString> data(new CharString(), status);
+    if(U_FAILURE(status)) { return; }
+    fItems = items.orphan();
+    fData = data.orphan();
+}
+
+StartupSnapshotBuilder::~StartupSnapshotBuilder() {
+    delete fItems;
+    delete fData;
+}
+
+int32_t
+StartupSnapshotBuilder::addItem(int32_t type, const char *bytes, int32_t length,
+                                UErrorCode &status) {
+    if(U_FAILURE(status)) { return -1; }
+    if(fItems == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return -1;
+    }
+    int32_t index = fItems->size() / 3;
+    int32_t offset = fData->length();
+    fData->append(bytes, length, status);
+    static const char padding[ITEM_ALIGNMENT] = { 0 };
+    fData->append(padding, (ITEM_ALIGNMENT - length % ITEM_ALIGNMENT) % ITEM_ALIGNMENT, status);
+    fItems->addElement(type, status);
+    fItems->addElement(offset, status);
+    fItems->addElement(length, status);
+    if(U_FAILURE(status)) {
+        fItems->setSize(index * 3);
+        fData->truncate(offset);
+        return -1;
+    }
+    return index;
+}
+
+int32_t
+StartupSnapshotBuilder::addCollator(const Collator &collator, UErrorCode &status) {
+    if(U_FAILURE(status)) { return -1; }
+    const RuleBasedCollator *rbc = dynamic_cast<const RuleBasedCollator *>(&collator);
+    if(rbc == NULL) {
+        status = U_UNSUPPORTED_ERROR;
+        return -1;
+    }
+    int32_t length = rbc->cloneBinary(NULL, 0, status);
+    if(status != U_BUFFER_OVERFLOW_ERROR) {
+        return -1;
+    }
+    status = U_ZERO_ERROR;
+    LocalMemory<uint8_t> bytes;
+    if(bytes.allocateInsteadAndReset(length) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return -1;
+    }
+    rbc->cloneBinary(bytes.getAlias(), length, status);
+    return addItem(ITEM_COLLATOR, reinterpret_cast<const char *>(bytes.getAlias()), length, status);
+}
+
+int32_t
+StartupSnapshotBuilder::addBreakIterator(const BreakIterator &bi, UErrorCode &status) {
+    if(U_FAILURE(status)) { return -1; }
+    const RuleBasedBreakIterator *rbbi = dynamic_cast<const RuleBasedBreakIterator *>(&bi);
+    if(rbbi == NULL) {
+        status = U_UNSUPPORTED_ERROR;
+        return -1;
+    }
+    uint32_t length = 0;
+    // getBinaryRules() does not modify the iterator, but it is not declared const.
+    const uint8_t *rules = const_cast<RuleBasedBreakIterator *>(rbbi)->getBinaryRules(length);
+    if(rules == NULL) {
+        status = U_UNSUPPORTED_ERROR;
+        return -1;
+    }
+    return addItem(ITEM_BREAK_ITERATOR, reinterpret_cast<const char *>(rules), (int32_t)length, status);
+}
+
+int32_t
+StartupSnapshotBuilder::addDecimalFormatSymbols(const DecimalFormatSymbols &symbols,
+                                                UErrorCode &status) {
+    if(U_FAILURE(status)) { return -1; }
+    ItemWriter writer(status);
+    writer.appendInt(DecimalFormatSymbols::kFormatSymbolCount, status);
+    for(int32_t i = 0; i < DecimalFormatSymbols::kFormatSymbolCount; ++i) {
+        writer.appendString(symbols.fSymbols[i], status);
+    }
+    writer.appendInt(UNUM_CURRENCY_SPACING_COUNT, status);
+    for(int32_t i = 0; i < UNUM_CURRENCY_SPACING_COUNT; ++i) {
+        writer.appendString(symbols.currencySpcBeforeSym[i], status);
+        writer.appendString(symbols.currencySpcAfterSym[i], status);
+    }
+    writer.appendInt(symbols.fIsCustomCurrencySymbol, status);
+    writer.appendInt(symbols.fIsCustomIntlCurrencySymbol, status);
+    writer.appendInt(symbols.fCodePointZero, status);
+    writer.appendInvariantChars(symbols.locale.getName(), status);
+    writer.appendInvariantChars(symbols.validLocale, status);
+    writer.appendInvariantChars(symbols.actualLocale, status);
+    CharString bytes;
+    writer.write(bytes, status);
+    return addItem(ITEM_DECIMAL_FORMAT_SYMBOLS, bytes.data(), bytes.length(), status);
+}
+
+int32_t
+StartupSnapshotBuilder::addDateFormatSymbols(const DateFormatSymbols &symbols,
+                                             UErrorCode &status) {
+    if(U_FAILURE(status)) { return -1; }
+    DateFormatSymbols &s = const_cast<DateFormatSymbols &>(symbols);
+    const StringArrayRef arrays[] = DATE_FORMAT_SYMBOLS_ARRAYS(s);
+    ItemWriter writer(status);
+    writer.appendInt(UPRV_LENGTHOF(arrays), status);
+    for(int32_t i = 0; i < UPRV_LENGTHOF(arrays); ++i) {
+        writer.appendArray(*arrays[i].array, *arrays[i].count, status);
+    }
+    writer.appendString(symbols.fTimeSeparator, status);
+    writer.appendString(symbols.fLocalPatternChars, status);
+    writer.appendInt(DateFormatSymbols::kCapContextUsageTypeCount, status);
+    for(int32_t i = 0; i < DateFormatSymbols::kCapContextUsageTypeCount; ++i) {
+        writer.appendInt(symbols.fCapitalization[i][0], status);
+        writer.appendInt(symbols.fCapitalization[i][1], status);
+    }
+    writer.appendInvariantChars(symbols.fZSFLocale.getName(), status);
+    writer.appendInvariantChars(symbols.validLocale, status);
+    writer.appendInvariantChars(symbols.actualLocale, status);
+    CharString bytes;
+    writer.write(bytes, status);
+    return addItem(ITEM_DATE_FORMAT_SYMBOLS, bytes.data(), bytes.length(), status);
+}
+
+int32_t
+StartupSnapshotBuilder::addPluralRules(const PluralRules &rules, UErrorCode &status) {
+    if(U_FAILURE(status)) { return -1; }
+    ItemWriter writer(status);
+    writer.appendString(rules.getRules(), status);
+    CharString bytes;
+    writer.write(bytes, status);
+    return addItem(ITEM_PLURAL_RULES, bytes.data(), bytes.length(), status);
+}
+
+int32_t
+StartupSnapshotBuilder::build(uint8_t *dest, int32_t capacity, UErrorCode &status) const {
+    if(U_FAILURE(status)) { return 0; }
+    if(capacity < 0 || (dest == NULL && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(fItems == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    int32_t itemCount = fItems->size() / 3;
+    int32_t indexesLength = (IX_ITEMS + 3 * itemCount) * 4;
+    indexesLength = (indexesLength + ITEM_ALIGNMENT - 1) & ~(ITEM_ALIGNMENT - 1);
+    int32_t dataLength = indexesLength + fData->length();
+    int32_t totalLength = HEADER_LENGTH + dataLength;
+    if(totalLength > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+        return totalLength;
+    }
+
+    uprv_memset(dest, 0, HEADER_LENGTH + indexesLength);
+    DataHeader *header = reinterpret_cast<DataHeader *>(dest);
+    header->dataHeader.headerSize = (uint16_t)HEADER_LENGTH;
+    header->dataHeader.magic1 = 0xda;
+    header->dataHeader.magic2 = 0x27;
+    uprv_memcpy(&header->info, &dataInfo, sizeof(UDataInfo));
+
+    int32_t *indexes = reinterpret_cast<int32_t *>(dest + HEADER_LENGTH);
+    indexes[0] = itemCount;
+    indexes[1] = dataLength;
+    for(int32_t i = 0; i < itemCount; ++i) {
+        indexes[IX_ITEMS + 3 * i] = fItems->elementAti(3 * i);
+        indexes[IX_ITEMS + 3 * i + 1] = indexesLength + fItems->elementAti(3 * i + 1);
+        indexes[IX_ITEMS + 3 * i + 2] = fItems->elementAti(3 * i + 2);
+    }
+    uprv_memcpy(dest + HEADER_LENGTH + indexesLength, fData->data(), fData->length());
+    return totalLength;
+}
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(StartupSnapshotBuilder)
+
+// StartupSnapshot --------------------------------------------------------- ***
+
+StartupSnapshot::StartupSnapshot(const uint8_t *data, int32_t length, UErrorCode &status)
+        : fMemory(NULL), fIndexes(NULL), fData(NULL), fItemCount(0) {
+    if(U_FAILURE(status)) { return; }
+    if(data == NULL || length < HEADER_LENGTH || U_POINTER_MASK_LSB(data, ITEM_ALIGNMENT - 1) != 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    const DataHeader *header = reinterpret_cast<const DataHeader *>(data);
+    if(!(header->dataHeader.magic1 == 0xda && header->dataHeader.magic2 == 0x27 &&
+            isAcceptable(NULL, NULL, NULL, &header->info))) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    int32_t headerLength = header->dataHeader.headerSize;
+    if(headerLength > length) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    init(data + headerLength, length - headerLength, status);
+}
+
+StartupSnapshot::StartupSnapshot(const char *path, const char *name, UErrorCode &status)
+        : fMemory(NULL), fIndexes(NULL), fData(NULL), fItemCount(0) {
+    if(U_FAILURE(status)) { return; }
+    fMemory = udata_openChoice(path, "snap", name, isAcceptable, NULL, &status);
+    if(U_FAILURE(status)) { return; }
+    // The length is not known for all kinds of data files.
+    const uint8_t *data = static_cast<const uint8_t *>(udata_getMemory(fMemory));
+    if(U_POINTER_MASK_LSB(data, ITEM_ALIGNMENT - 1) != 0) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    init(data, udata_getLength(fMemory), status);
+}
+
+StartupSnapshot::~StartupSnapshot() {
+    udata_close(fMemory);
+}
+
+void
+StartupSnapshot::init(const uint8_t *data, int32_t length, UErrorCode &status) {
+    const int32_t *indexes = reinterpret_cast<const int32_t *>(data);
+    if((0 <= length && length < IX_ITEMS * 4) ||
+            indexes[0] < 0 ||
+            (0 <= length && length < indexes[1]) ||
+            indexes[0] > (indexes[1] / 4 - IX_ITEMS) / 3) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    int32_t dataLength = indexes[1];
+    for(int32_t i = 0; i < indexes[0]; ++i) {
+        int32_t offset = indexes[IX_ITEMS + 3 * i + 1];
+        int32_t itemLength = indexes[IX_ITEMS + 3 * i + 2];
+        if(offset < 0 || (offset & (ITEM_ALIGNMENT - 1)) != 0 ||
+                itemLength < 0 || itemLength > dataLength - offset) {
+            status = U_INVALID_FORMAT_ERROR;
+            return;
+        }
+    }
+    fIndexes = indexes;
+    fData = data;
+    fItemCount = indexes[0];
+}
+
+const uint8_t *
+StartupSnapshot::getItem(int32_t index, int32_t type, int32_t &length, UErrorCode &status) const {
+    length = 0;
+    if(U_FAILURE(status)) { return NULL; }
+    if(index < 0 || index >= fItemCount || fIndexes[IX_ITEMS + 3 * index] != type) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    length = fIndexes[IX_ITEMS + 3 * index + 2];
+    return fData + fIndexes[IX_ITEMS + 3 * index + 1];
+}
+
+Collator *
+StartupSnapshot::createCollator(int32_t index, UErrorCode &status) const {
+    int32_t length;
+    const uint8_t *item = getItem(index, ITEM_COLLATOR, length, status);
+    // The root collator comes from the collation root cache entry, without loading a tailoring.
+    LocalPointer<Collator> root(Collator::createInstance(Locale::getRoot(), status));
+    if(U_FAILURE(status)) { return NULL; }
+    LocalPointer<RuleBasedCollator> coll(
+        new RuleBasedCollator(item, length,
+                              dynamic_cast<const RuleBasedCollator *>(root.getAlias()), status),
+        status);
+    if(U_FAILURE(status)) { return NULL; }
+    return coll.orphan();
+}
+
+BreakIterator *
+StartupSnapshot::createBreakIterator(int32_t index, UErrorCode &status) const {
+    int32_t length;
+    const uint8_t *item = getItem(index, ITEM_BREAK_ITERATOR, length, status);
+    if(U_FAILURE(status)) { return NULL; }
+    // This constructor uses the rules in place, without copying them.
+    LocalPointer<RuleBasedBreakIterator> bi(
+        new RuleBasedBreakIterator(item, (uint32_t)length, status), status);
+    if(U_FAILURE(status)) { return NULL; }
+    return bi.orphan();
+}
+
+DecimalFormatSymbols *
+StartupSnapshot::createDecimalFormatSymbols(int32_t index, UErrorCode &status) const {
+    int32_t length;
+    const uint8_t *item = getItem(index, ITEM_DECIMAL_FORMAT_SYMBOLS, length, status);
+    ItemReader reader(item, length, status);
+    if(U_FAILURE(status)) { return NULL; }
+    if(reader.readInt(status) != DecimalFormatSymbols::kFormatSymbolCount) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    LocalPointer<DecimalFormatSymbols> symbols(DecimalFormatSymbols::createWithLastResortData(status));
+    if(U_FAILURE(status)) { return NULL; }
+    for(int32_t i = 0; i < DecimalFormatSymbols::kFormatSymbolCount; ++i) {
+        reader.readString(symbols->fSymbols[i], status);
+    }
+    if(reader.readInt(status) != UNUM_CURRENCY_SPACING_COUNT) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    for(int32_t i = 0; i < UNUM_CURRENCY_SPACING_COUNT; ++i) {
+        reader.readString(symbols->currencySpcBeforeSym[i], status);
+        reader.readString(symbols->currencySpcAfterSym[i], status);
+    }
+    symbols->fIsCustomCurrencySymbol = (UBool)reader.readInt(status);
+    symbols->fIsCustomIntlCurrencySymbol = (UBool)reader.readInt(status);
+    symbols->fCodePointZero = reader.readInt(status);
+    char localeID[ULOC_FULLNAME_CAPACITY];
+    reader.readInvariantChars(localeID, ULOC_FULLNAME_CAPACITY, status);
+    reader.readInvariantChars(symbols->validLocale, ULOC_FULLNAME_CAPACITY, status);
+    reader.readInvariantChars(symbols->actualLocale, ULOC_FULLNAME_CAPACITY, status);
+    if(U_FAILURE(status)) { return NULL; }
+    symbols->locale = Locale(localeID);
+    return symbols.orphan();
+}
+
+DateFormatSymbols *
+StartupSnapshot::createDateFormatSymbols(int32_t index, UErrorCode &status) const {
+    int32_t length;
+    const uint8_t *item = getItem(index, ITEM_DATE_FORMAT_SYMBOLS, length, status);
+    ItemReader reader(item, length, status);
+    if(U_FAILURE(status)) { return NULL; }
+    LocalPointer<DateFormatSymbols> symbols(new DateFormatSymbols(), status);
+    if(U_FAILURE(status)) { return NULL; }
+    DateFormatSymbols &s = *symbols;
+    const StringArrayRef arrays[] = DATE_FORMAT_SYMBOLS_ARRAYS(s);
+    if(reader.readInt(status) != UPRV_LENGTHOF(arrays)) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    for(int32_t i = 0; i < UPRV_LENGTHOF(arrays); ++i) {
+        *arrays[i].array = reader.readArray(*arrays[i].count, status);
+    }
+    reader.readString(s.fTimeSeparator, status);
+    reader.readString(s.fLocalPatternChars, status);
+    if(reader.readInt(status) != DateFormatSymbols::kCapContextUsageTypeCount) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    for(int32_t i = 0; i < DateFormatSymbols::kCapContextUsageTypeCount; ++i) {
+        s.fCapitalization[i][0] = (UBool)reader.readInt(status);
+        s.fCapitalization[i][1] = (UBool)reader.readInt(status);
+    }
+    char zsfLocaleID[ULOC_FULLNAME_CAPACITY];
+    reader.readInvariantChars(zsfLocaleID, ULOC_FULLNAME_CAPACITY, status);
+    reader.readInvariantChars(s.validLocale, ULOC_FULLNAME_CAPACITY, status);
+    reader.readInvariantChars(s.actualLocale, ULOC_FULLNAME_CAPACITY, status);
+    if(U_FAILURE(status)) { return NULL; }
+    s.fZSFLocale = Locale(zsfLocaleID);
+    return symbols.orphan();
+}
+
+PluralRules *
+StartupSnapshot::createPluralRules(int32_t index, UErrorCode &status) const {
+    int32_t length;
+    const uint8_t *item = getItem(index, ITEM_PLURAL_RULES, length, status);
+    ItemReader reader(item, length, status);
+    UnicodeString rules;
+    reader.readString(rules, status);
+    if(U_FAILURE(status)) { return NULL; }
+    return PluralRules::createRules(rules, status);
+}
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(StartupSnapshot)
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_FORMATTING && !UCONFIG_NO_COLLATION && !UCONFIG_NO_BREAK_ITERATION
@@ -31,10 +31,10 @@ StringMatcher::StringMatcher(const UnicodeString& theString,
                              const TransliterationRuleData& theData) :
     data(&theData),
     segmentNumber(segmentNum),
-    matchStart(-1),
-    matchLimit(-1)
+    matchPositions()
 {
     theString.extractBetween(start, limit, pattern);
+    resetMatch();
 }
 
 StringMatcher::StringMatcher(const StringMatcher& o) :
@@ -44,9 +44,10 @@ StringMatcher::StringMatcher(const StringMatcher& o) :
     pattern(o.pattern),
     data(o.data),
     segmentNumber(o.segmentNumber),
-    matchStart(o.matchStart),
-    matchLimit(o.matchLimit)
+    matchPositions()
 {
+    matchPositions[0] = o.matchPositions[0];
+    matchPositions[1] = o.matchPositions[1];
 }
 
 /**
@@ -116,9 +117,10 @@ UMatchDegree StringMatcher::matches(const Replaceable& text,
         // Record the match position, but adjust for a normal
         // forward start, limit, and only if a prior match does not
         // exist -- we want the rightmost match.
-        if (matchStart < 0) {
-            matchStart = cursor+1;
-            matchLimit = offset+1;
+        int32_t *match = getMatchPositions();
+        if (match[0] < 0) {
+            match[0] = cursor+1;
+            match[1] = offset+1;
         }
     } else {
         for (i=0; i<pattern.length(); ++i) {
@@ -148,8 +150,9 @@ UMatchDegree StringMatcher::matches(const Replaceable& text,
             }
         }
         // Record the match position
-        matchStart = offset;
-        matchLimit = cursor;
+        int32_t *match = getMatchPositions();
+        match[0] = offset;
+        match[1] = cursor;
     }
 
     offset = cursor;
@@ -228,10 +231,11 @@ int32_t StringMatcher::replace(Replaceable& text,
     int32_t dest = limit;
     // If there was no match, that means that a quantifier
     // matched zero-length.  E.g., x (a)* y matched "xy".
-    if (matchStart >= 0) {
-        if (matchStart != matchLimit) {
-            text.copy(matchStart, matchLimit, dest);
-            outLen = matchLimit - matchStart;
+    const int32_t *match = getMatchPositions();
+    if (match[0] >= 0) {
+        if (match[0] != match[1]) {
+            text.copy(match[0], match[1], dest);
+            outLen = match[1] - match[0];
         }
     }
     
@@ -257,7 +261,15 @@ UnicodeString& StringMatcher::toReplacerPattern(UnicodeString& rule,
  * set of matches with this segment.
  */
  void StringMatcher::resetMatch() {
-    matchStart = matchLimit = -1;
+    matchPositions[0] = matchPositions[1] = -1;
+}
+
+int32_t *StringMatcher::getMatchPositions() {
+    int32_t *match = NULL;
+    if (segmentNumber > 0) {
+        match = SegmentMatchScope::getCurrentPositions(segmentNumber);
+    }
+    return match != NULL ? match : matchPositions;
 }
 
 /**
@@ -289,6 +301,42 @@ void StringMatcher::setData(const TransliterationRuleData* d) {
     }
 }
 
+/*
+ * Innermost segment match scope of this thread.
+ */
+static thread_local SegmentMatchScope *gSegmentMatchScope = NULL;
+
+SegmentMatchScope::SegmentMatchScope(int32_t segmentCount) : previous(NULL), count(0) {
+    if (segmentCount <= 0) {
+        return;
+    }
+    if (segmentCount * 2 > positions.getCapacity() &&
+            positions.resize(segmentCount * 2) == NULL) {
+        // Out of memory: the segment matchers keep using their own fields.
+        return;
+    }
+    for (int32_t i = 0; i < segmentCount * 2; ++i) {
+        positions[i] = -1;
+    }
+    count = segmentCount;
+    previous = gSegmentMatchScope;
+    gSegmentMatchScope = this;
+}
+
+SegmentMatchScope::~SegmentMatchScope() {
+    if (count > 0) {
+        gSegmentMatchScope = previous;
+    }
+}
+
+int32_t *SegmentMatchScope::getCurrentPositions(int32_t segmentNumber) {
+    SegmentMatchScope *scope = gSegmentMatchScope;
+    if (scope == NULL || segmentNumber > scope->count) {
+        return NULL;
+    }
+    return scope->positions.getAlias() + (segmentNumber - 1) * 2;
+}
+
 U_NAMESPACE_END
 
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
@@ -19,6 +19,7 @@
 #include "unicode/unifunct.h"
 #include "unicode/unimatch.h"
 #include "unicode/unirepl.h"
+#include "cmemory.h"
 
 U_NAMESPACE_BEGIN
 
@@ -192,7 +193,7 @@ class StringMatcher : public UnicodeFunctor, public UnicodeMatcher, public Unico
 
     /**
      * Remove any match data.  This must be called before performing a
-     * set of matches with this segment.
+     * set of matches with this segment outside of a SegmentMatchScope.
      */
     void resetMatch();
 
@@ -232,19 +233,57 @@ class StringMatcher : public UnicodeFunctor, public UnicodeMatcher, public Unico
     int32_t segmentNumber;
 
     /**
-     * Start offset, in the match text, of the <em>rightmost</em>
-     * match.
+     * Returns the start/limit pair in which this segment records its
+     * match: in the innermost SegmentMatchScope of this thread if there
+     * is one, otherwise in matchPositions.
      */
-    int32_t matchStart;
+    int32_t *getMatchPositions();
 
     /**
-     * Limit offset, in the match text, of the <em>rightmost</em>
-     * match.
+     * Start and limit offsets, in the match text, of the
+     * <em>rightmost</em> match.  Used only when no SegmentMatchScope
+     * is active.
      */
-    int32_t matchLimit;
+    int32_t matchPositions[2];
 
 };
 
+/**
+ * The segment match positions of one rule application.
+ * TransliterationRule::matchAndReplace() creates one on the stack, and
+ * while it is in scope the segment StringMatchers of the rule record and
+ * copy their matches here rather than in their own fields.  The rule data
+ * can therefore be shared by concurrent transliterations without a lock.
+ * Scopes nest per thread, for rules applied by nested transliterators.
+ */
+class SegmentMatchScope : public UMemory {
+public:
+    /**
+     * Makes this the current scope of this thread, with no segment matched.
+     * Does nothing if segmentCount is 0.
+     */
+    SegmentMatchScope(int32_t segmentCount);
+
+    /**
+     * Restores the previous scope of this thread.
+     */
+    ~SegmentMatchScope();
+
+    /**
+     * Returns the start/limit pair for the 1-based segment number
+     * in the current scope of this thread, or NULL if there is none.
+     */
+    static int32_t *getCurrentPositions(int32_t segmentNumber);
+
+private:
+    SegmentMatchScope(const SegmentMatchScope &other); // forbid copying of this class
+    SegmentMatchScope &operator=(const SegmentMatchScope &other); // forbid copying of this class
+
+    SegmentMatchScope *previous;
+    int32_t count;
+    MaybeStackArray<int32_t, 20> positions;
+};
+
 U_NAMESPACE_END
 
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
@@ -43,7 +43,7 @@ StringReplacer::StringReplacer(const UnicodeString& theOutput,
     cursorPos = theCursorPos;
     hasCursor = TRUE;
     data = theData;
-    isComplex = TRUE;
+    umtx_storeRelease(complexity, -1);
 }
 
 /**
@@ -61,7 +61,7 @@ StringReplacer::StringReplacer(const UnicodeString& theOutput,
     cursorPos = 0;
     hasCursor = FALSE;
     data = theData;
-    isComplex = TRUE;
+    umtx_storeRelease(complexity, -1);
 }
 
 /**
@@ -75,7 +75,7 @@ StringReplacer::StringReplacer(const StringReplacer& other) :
     cursorPos = other.cursorPos;
     hasCursor = other.hasCursor;
     data = other.data;
-    isComplex = other.isComplex;
+    umtx_storeRelease(complexity, umtx_loadAcquire(const_cast<StringReplacer &>(other).complexity));
 }
 
 /**
@@ -112,6 +112,18 @@ int32_t StringReplacer::replace(Replaceable& text,
     // processing code; just slower.  If not, then there is a bug
     // in the complex processing code.
 
+    int32_t isComplex = umtx_loadAcquire(complexity);
+    if (isComplex < 0) {
+        isComplex = 0;
+        for (int32_t i = 0; i < output.length(); i += U16_LENGTH(output.char32At(i))) {
+            if (data->lookupReplacer(output.char32At(i)) != NULL) {
+                isComplex = 1;
+                break;
+            }
+        }
+        umtx_storeRelease(complexity, isComplex);
+    }
+
     // Simple (no nested replacers) Processing Code :
     if (!isComplex) {
         text.handleReplaceBetween(start, limit, output);
@@ -131,7 +143,6 @@ int32_t StringReplacer::replace(Replaceable& text,
          */
         UnicodeString buf;
         int32_t oOutput; // offset into 'output'
-        isComplex = FALSE;
 
         // The temporary buffer starts at tempStart, and extends
         // to destLimit.  The start of the buffer has a single
@@ -166,8 +177,6 @@ int32_t StringReplacer::replace(Replaceable& text,
                 // Accumulate straight (non-segment) text.
                 buf.append(c);
             } else {
-                isComplex = TRUE;
-
                 // Insert any accumulated straight text.
                 if (buf.length() > 0) {
                     text.handleReplaceBetween(destLimit, destLimit, buf);
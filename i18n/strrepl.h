@@ -20,6 +20,7 @@
 #include "unicode/unifunct.h"
 #include "unicode/unirepl.h"
 #include "unicode/unistr.h"
+#include "umutex.h"
 
 U_NAMESPACE_BEGIN
 
@@ -56,12 +57,13 @@ class StringReplacer : public UnicodeFunctor, public UnicodeReplacer {
 
     /**
      * A complex object contains nested replacers and requires more
-     * complex processing.  StringReplacers are initially assumed to
-     * be complex.  If no nested replacers are seen during processing,
-     * then isComplex is set to false, and future replacements are
-     * short circuited for better performance.
+     * complex processing.  Whether this object is complex is not known
+     * until the first replacement, when all stand-ins are defined:
+     * -1 while unknown, then 0 (simple) or 1 (complex).  Simple
+     * replacements are short circuited for better performance.
+     * Concurrent first replacements compute and store the same value.
      */
-    UBool isComplex;
+    u_atomic_int32_t complexity;
 
     /**
      * Object that translates stand-in characters in 'output' to
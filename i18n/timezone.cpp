@@ -84,9 +84,11 @@ static char gStrBuf[256];
 #include "ucln_in.h"
 #include "cstring.h"
 #include "cmemory.h"
+#include "uinvchar.h"
 #include "unicode/strenum.h"
 #include "uassert.h"
 #include "zonemeta.h"
+#include "unifiedcache.h"
 
 #define kZONEINFO "zoneinfo64"
 #define kREGIONS  "Regions"
@@ -122,6 +124,11 @@ static icu::UInitOnce gStaticZonesInitOnce = U_INITONCE_INITIALIZER;
 static char TZDATA_VERSION[16];
 static icu::UInitOnce gTZDataVersionInitOnce = U_INITONCE_INITIALIZER;
 
+// zoneinfo64.tzb, if it is available and matches TZDATA_VERSION
+static UDataMemory* gZoneBinaryData = NULL;
+static const int32_t* gZoneBinaryIndexes = NULL;
+static icu::UInitOnce gZoneBinaryDataInitOnce = U_INITONCE_INITIALIZER;
+
 static int32_t* MAP_SYSTEM_ZONES = NULL;
 static int32_t* MAP_CANONICAL_SYSTEM_ZONES = NULL;
 static int32_t* MAP_CANONICAL_SYSTEM_LOCATION_ZONES = NULL;
@@ -151,6 +158,11 @@ static UBool U_CALLCONV timeZone_cleanup(void)
     uprv_memset(TZDATA_VERSION, 0, sizeof(TZDATA_VERSION));
     gTZDataVersionInitOnce.reset();
 
+    udata_close(gZoneBinaryData);
+    gZoneBinaryData = NULL;
+    gZoneBinaryIndexes = NULL;
+    gZoneBinaryDataInitOnce.reset();
+
     LEN_SYSTEM_ZONES = 0;
     uprv_free(MAP_SYSTEM_ZONES);
     MAP_SYSTEM_ZONES = 0;
@@ -376,29 +388,195 @@ TimeZone::operator==(const TimeZone& that) const
 // -------------------------------------
 
 namespace {
+
+UBool U_CALLCONV
+isAcceptableZoneBinary(void * /*context*/,
+                       const char * /*type*/, const char * /*name*/,
+                       const UDataInfo *pInfo) {
+    return
+        pInfo->size >= 20 &&
+        pInfo->isBigEndian == U_IS_BIG_ENDIAN &&
+        pInfo->charsetFamily == U_CHARSET_FAMILY &&
+        pInfo->dataFormat[0] == 0x54 &&   // dataFormat="TzBn"
+        pInfo->dataFormat[1] == 0x7a &&
+        pInfo->dataFormat[2] == 0x42 &&
+        pInfo->dataFormat[3] == 0x6e &&
+        pInfo->formatVersion[0] == 1;
+}
+
+void U_CALLCONV initZoneBinaryData() {
+    ucln_i18n_registerCleanup(UCLN_I18N_TIMEZONE, timeZone_cleanup);
+    UErrorCode ec = U_ZERO_ERROR;
+    // Without the binary data, or with data for another tz version than
+    // the resource bundle's (which may have been updated separately),
+    // zones are loaded from the resource bundle.
+    const char *version = TimeZone::getTZDataVersion(ec);
+    UDataMemory *data = udata_openChoice(NULL, "tzb", kZONEINFO, isAcceptableZoneBinary, NULL, &ec);
+    if (U_FAILURE(ec)) {
+        return;
+    }
+    const int32_t *indexes = static_cast<const int32_t *>(udata_getMemory(data));
+    int32_t indexesLength = indexes[OLSONTZB_IX_INDEXES_LENGTH];
+    if (indexesLength < OLSONTZB_IX_COUNT ||
+            uprv_strcmp(reinterpret_cast<const char *>(indexes) + indexes[OLSONTZB_IX_VERSION_OFFSET],
+                        version) != 0) {
+        udata_close(data);
+        return;
+    }
+    gZoneBinaryData = data;
+    gZoneBinaryIndexes = indexes;
+}
+
+/**
+ * Returns the zone with the given ID in zoneinfo64.tzb,
+ * or NULL if the binary data is not used or does not have the ID.
+ */
+const OlsonZoneRecord *findZoneBinary(const UnicodeString &id) {
+    umtx_initOnce(gZoneBinaryDataInitOnce, &initZoneBinaryData);
+    const int32_t *indexes = gZoneBinaryIndexes;
+    if (indexes == NULL) {
+        return NULL;
+    }
+    char buf[128];
+    int32_t length = id.extract(0, id.length(), buf, (int32_t)sizeof(buf), US_INV);
+    if (length <= 0 || length >= (int32_t)sizeof(buf) || !uprv_isInvariantUString(id.getBuffer(), id.length())) {
+        return NULL;
+    }
+    const char *base = reinterpret_cast<const char *>(indexes);
+    const int32_t *names = reinterpret_cast<const int32_t *>(base + indexes[OLSONTZB_IX_NAMES_OFFSET]);
+    int32_t start = 0;
+    int32_t limit = indexes[OLSONTZB_IX_ZONE_COUNT];
+    while (start < limit) {
+        int32_t mid = (start + limit) / 2;
+        int32_t cmp = uprv_strcmp(buf, base + names[mid]);
+        if (cmp == 0) {
+            const int32_t *zones = reinterpret_cast<const int32_t *>(base + indexes[OLSONTZB_IX_ZONES_OFFSET]);
+            return reinterpret_cast<const OlsonZoneRecord *>(base + zones[mid]);
+        } else if (cmp < 0) {
+            limit = mid;
+        } else {
+            start = mid + 1;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * A system time zone in the UnifiedCache.
+ * createSystemTimeZone() returns clones of it, which share its transition data,
+ * so that only the first request for a zone ID reads the resource bundle.
+ */
+class SharedOlsonTimeZone : public SharedObject {
+public:
+    SharedOlsonTimeZone(OlsonTimeZone *zoneToAdopt) : ptr(zoneToAdopt) {}
+    virtual ~SharedOlsonTimeZone();
+    const OlsonTimeZone *ptr;
+};
+
+SharedOlsonTimeZone::~SharedOlsonTimeZone() {
+    delete ptr;
+}
+
+/**
+ * Cache key for a system time zone by its ID, as requested (not canonicalized).
+ * A failure to create the zone is cached as well.
+ */
+class OlsonTimeZoneKey : public CacheKey<SharedOlsonTimeZone> {
+private:
+    UnicodeString fID;
+public:
+    OlsonTimeZoneKey(const UnicodeString &id) : fID(id) {}
+    OlsonTimeZoneKey(const OlsonTimeZoneKey &other)
+            : CacheKey<SharedOlsonTimeZone>(other), fID(other.fID) {}
+    virtual ~OlsonTimeZoneKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)CacheKey<SharedOlsonTimeZone>::hashCode() +
+                         (uint32_t)fID.hashCode());
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!CacheKey<SharedOlsonTimeZone>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        return static_cast<const OlsonTimeZoneKey &>(other).fID == fID;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new OlsonTimeZoneKey(*this);
+    }
+    virtual const SharedOlsonTimeZone *createObject(
+            const void * /*unused*/, UErrorCode &ec) const {
+        OlsonTimeZone* z = NULL;
+        const OlsonZoneRecord *record = findZoneBinary(fID);
+        if (record != NULL) {
+            z = new OlsonTimeZone(record, fID, ec);
+            if (z == NULL) {
+                ec = U_MEMORY_ALLOCATION_ERROR;
+            }
+        } else {
+            UResourceBundle res;
+            ures_initStackObject(&res);
+            U_DEBUG_TZ_MSG(("pre-err=%s\n", u_errorName(ec)));
+            UResourceBundle *top = openOlsonResource(fID, res, ec);
+            U_DEBUG_TZ_MSG(("post-err=%s\n", u_errorName(ec)));
+            if (U_SUCCESS(ec)) {
+                z = new OlsonTimeZone(top, &res, fID, ec);
+                if (z == NULL) {
+                    U_DEBUG_TZ_MSG(("cstz: olson time zone failed to initialize - err %s\n", u_errorName(ec)));
+                    ec = U_MEMORY_ALLOCATION_ERROR;
+                }
+            }
+            ures_close(&res);
+            ures_close(top);
+        }
+        if (U_SUCCESS(ec)) {
+            // Build the table now so that all clones share it.
+            z->checkFinalTransitions(ec);
+        }
+        SharedOlsonTimeZone *result = NULL;
+        if (U_SUCCESS(ec)) {
+            result = new SharedOlsonTimeZone(z);
+            if (result == NULL) {
+                ec = U_MEMORY_ALLOCATION_ERROR;
+            }
+        }
+        if (U_FAILURE(ec)) {
+            U_DEBUG_TZ_MSG(("cstz: failed to create, err %s\n", u_errorName(ec)));
+            delete z;
+            return NULL;
+        }
+        result->addRef();
+        return result;
+    }
+    virtual char *writeDescription(char *buffer, int32_t bufLen) const {
+        fID.extract(0, fID.length(), buffer, bufLen, US_INV);
+        buffer[bufLen - 1] = 0;
+        return buffer;
+    }
+};
+
+OlsonTimeZoneKey::~OlsonTimeZoneKey() {}
+
 TimeZone*
 createSystemTimeZone(const UnicodeString& id, UErrorCode& ec) {
     if (U_FAILURE(ec)) {
         return NULL;
     }
-    TimeZone* z = 0;
-    UResourceBundle res;
-    ures_initStackObject(&res);
-    U_DEBUG_TZ_MSG(("pre-err=%s\n", u_errorName(ec)));
-    UResourceBundle *top = openOlsonResource(id, res, ec);
-    U_DEBUG_TZ_MSG(("post-err=%s\n", u_errorName(ec)));
-    if (U_SUCCESS(ec)) {
-        z = new OlsonTimeZone(top, &res, id, ec);
-        if (z == NULL) {
-          U_DEBUG_TZ_MSG(("cstz: olson time zone failed to initialize - err %s\n", u_errorName(ec)));
-        }
+    const UnifiedCache *cache = UnifiedCache::getInstance(ec);
+    if (U_FAILURE(ec)) {
+        return NULL;
     }
-    ures_close(&res);
-    ures_close(top);
+    const SharedOlsonTimeZone *shared = NULL;
+    cache->get(OlsonTimeZoneKey(id), shared, ec);
     if (U_FAILURE(ec)) {
-        U_DEBUG_TZ_MSG(("cstz: failed to create, err %s\n", u_errorName(ec)));
-        delete z;
-        z = 0;
+        return NULL;
+    }
+    TimeZone* z = shared->ptr->clone();
+    shared->removeRef();
+    if (z == NULL) {
+        ec = U_MEMORY_ALLOCATION_ERROR;
     }
     return z;
 }
@@ -91,7 +91,7 @@ static const char RB_RULE_BASED_IDS[] = "RuleBasedTransliteratorIDs";
 /**
  * The mutex controlling access to registry object.
  */
-static UMutex registryMutex = U_MUTEX_INITIALIZER;
+static UMutex registryMutex = U_NAMED_MUTEX_INITIALIZER("transliteratorRegistry");
 
 /**
  * System transliterator registry; non-null when initialized.
@@ -147,7 +147,7 @@ static icu::UInitOnce gZoneIdTrieInitOnce = U_INITONCE_INITIALIZER;
 static TextTrieMap *gShortZoneIdTrie = NULL;
 static icu::UInitOnce gShortZoneIdTrieInitOnce = U_INITONCE_INITIALIZER;
 
-static UMutex gLock = U_MUTEX_INITIALIZER;
+static UMutex gLock = U_NAMED_MUTEX_INITIALIZER("TimeZoneFormat");
 
 U_CDECL_BEGIN
 /**
@@ -811,6 +811,20 @@ TimeZoneFormat::parse(UTimeZoneFormatStyle style, const UnicodeString& text, Par
     return parse(style, text, pos, getDefaultParseOptions(), timeType);
 }
 
+void
+TimeZoneFormat::preload(UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (fTimeZoneNames != NULL) {
+        fTimeZoneNames->prepareFind(status);
+    }
+    const TimeZoneGenericNames *gnames = getTimeZoneGenericNames(status);
+    if (U_SUCCESS(status)) {
+        gnames->prepareFind(status);
+    }
+}
+
 TimeZone*
 TimeZoneFormat::parse(UTimeZoneFormatStyle style, const UnicodeString& text, ParsePosition& pos,
         int32_t parseOptions, UTimeZoneFormatTimeType* timeType /* = NULL */) const {
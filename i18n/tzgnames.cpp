@@ -284,6 +284,8 @@ class TZGNCore : public UMemory {
     int32_t findBestMatch(const UnicodeString& text, int32_t start, uint32_t types,
         UnicodeString& tzID, UTimeZoneFormatTimeType& timeType, UErrorCode& status) const;
 
+    void prepareFind(UErrorCode& status);
+
 private:
     Locale fLocale;
     const TimeZoneNames* fTimeZoneNames;
@@ -299,12 +301,22 @@ class TZGNCore : public UMemory {
     TextTrieMap fGNamesTrie;
     UBool fGNamesTrieFullyLoaded;
 
+    // Set to 1 once fGNamesTrie holds all names and is built.
+    // It is then never modified again, and findLocal() searches it without locking.
+    // Names that are created after that go into fGNamesLateTrie,
+    // which is searched with gLock held, and only when fHasLateGNames is 1.
+    mutable u_atomic_int32_t fGNamesTrieReady;
+    TextTrieMap fGNamesLateTrie;
+    mutable u_atomic_int32_t fHasLateGNames;
+
     char fTargetRegion[ULOC_COUNTRY_CAPACITY];
 
     void initialize(const Locale& locale, UErrorCode& status);
     void cleanup();
 
     void loadStrings(const UnicodeString& tzCanonicalID);
+    void putIntoTrie(const UChar* name, GNameInfo* nameinfo, UErrorCode& status);
+    void internalPrepareFind(UErrorCode& status);
 
     const UChar* getGenericLocationName(const UnicodeString& tzCanonicalID);
 
@@ -339,7 +351,10 @@ TZGNCore::TZGNCore(const Locale& locale, UErrorCode& status)
   fLocaleDisplayNames(NULL),
   fStringPool(status),
   fGNamesTrie(TRUE, deleteGNameInfo),
-  fGNamesTrieFullyLoaded(FALSE) {
+  fGNamesTrieFullyLoaded(FALSE),
+  fGNamesTrieReady(0),
+  fGNamesLateTrie(TRUE, deleteGNameInfo),
+  fHasLateGNames(0) {
     initialize(locale, status);
 }
 
@@ -578,7 +593,7 @@ TZGNCore::getGenericLocationName(const UnicodeString& tzCanonicalID) {
                 if (nameinfo != NULL) {
                     nameinfo->type = UTZGNM_LOCATION;
                     nameinfo->tzID = cacheID;
-                    fGNamesTrie.put(locname, nameinfo, status);
+                    putIntoTrie(locname, nameinfo, status);
                 }
             }
         }
@@ -827,7 +842,7 @@ TZGNCore::getPartialLocationName(const UnicodeString& tzCanonicalID,
                 if (nameinfo != NULL) {
                     nameinfo->type = isLong ? UTZGNM_LONG : UTZGNM_SHORT;
                     nameinfo->tzID = key.tzID;
-                    fGNamesTrie.put(uplname, nameinfo, status);
+                    putIntoTrie(uplname, nameinfo, status);
                 }
             }
         }
@@ -1007,83 +1022,137 @@ TZGNCore::findLocal(const UnicodeString& text, int32_t start, uint32_t types, UE
 
     TZGNCore *nonConstThis = const_cast<TZGNCore *>(this);
 
-    umtx_lock(&gLock);
-    {
-        fGNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+    TimeZoneGenericNameMatchInfo *gmatchInfo = NULL;
+    int32_t maxLen = 0;
+    UVector *results;
+
+    if (umtx_loadAcquire(fGNamesTrieReady) == 0) {
+        umtx_lock(&gLock);
+        {
+            fGNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+        }
+        umtx_unlock(&gLock);
+
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+
+        results = handler.getMatches(maxLen);
+        if (results != NULL && ((maxLen == (text.length() - start)) || fGNamesTrieFullyLoaded)) {
+            // perfect match
+            gmatchInfo = new TimeZoneGenericNameMatchInfo(results);
+            if (gmatchInfo == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                delete results;
+                return NULL;
+            }
+            return gmatchInfo;
+        }
+
+        if (results != NULL) {
+            delete results;
+        }
+
+        // All names are not yet loaded into the local trie.
+        // Load all available names into the trie. This could be very heavy.
+        umtx_lock(&gLock);
+        {
+            nonConstThis->internalPrepareFind(status);
+        }
+        umtx_unlock(&gLock);
+
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+    }
+
+    // now try it again; all names are in the trie,
+    // and it is not modified any more, so it is searched without locking
+    fGNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+    if (umtx_loadAcquire(fHasLateGNames) != 0) {
+        umtx_lock(&gLock);
+        {
+            fGNamesLateTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+        }
+        umtx_unlock(&gLock);
     }
-    umtx_unlock(&gLock);
 
+    results = handler.getMatches(maxLen);
     if (U_FAILURE(status)) {
+        delete results;
         return NULL;
     }
-
-    TimeZoneGenericNameMatchInfo *gmatchInfo = NULL;
-
-    int32_t maxLen = 0;
-    UVector *results = handler.getMatches(maxLen);
-    if (results != NULL && ((maxLen == (text.length() - start)) || fGNamesTrieFullyLoaded)) {
-        // perfect match
+    if (results != NULL && maxLen > 0) {
         gmatchInfo = new TimeZoneGenericNameMatchInfo(results);
         if (gmatchInfo == NULL) {
             status = U_MEMORY_ALLOCATION_ERROR;
             delete results;
             return NULL;
         }
-        return gmatchInfo;
     }
 
-    if (results != NULL) {
-        delete results;
-    }
+    return gmatchInfo;
+}
 
-    // All names are not yet loaded into the local trie.
-    // Load all available names into the trie. This could be very heavy.
-    umtx_lock(&gLock);
-    {
-        if (!fGNamesTrieFullyLoaded) {
-            StringEnumeration *tzIDs = TimeZone::createTimeZoneIDEnumeration(UCAL_ZONE_TYPE_CANONICAL, NULL, NULL, status);
-            if (U_SUCCESS(status)) {
-                const UnicodeString *tzID;
-                while ((tzID = tzIDs->snext(status)) != NULL) {
-                    if (U_FAILURE(status)) {
-                        break;
-                    }
-                    nonConstThis->loadStrings(*tzID);
+/*
+ * Loads all available names into the trie, and publishes it for searching
+ * without locking. Must be called with gLock held.
+ */
+void
+TZGNCore::internalPrepareFind(UErrorCode& status) {
+    if (U_FAILURE(status) || umtx_loadAcquire(fGNamesTrieReady) != 0) {
+        return;
+    }
+    if (!fGNamesTrieFullyLoaded) {
+        StringEnumeration *tzIDs = TimeZone::createTimeZoneIDEnumeration(UCAL_ZONE_TYPE_CANONICAL, NULL, NULL, status);
+        if (U_SUCCESS(status)) {
+            const UnicodeString *tzID;
+            while ((tzID = tzIDs->snext(status)) != NULL) {
+                if (U_FAILURE(status)) {
+                    break;
                 }
+                loadStrings(*tzID);
             }
-            if (tzIDs != NULL) {
-                delete tzIDs;
-            }
+        }
+        if (tzIDs != NULL) {
+            delete tzIDs;
+        }
 
-            if (U_SUCCESS(status)) {
-                nonConstThis->fGNamesTrieFullyLoaded = TRUE;
-            }
+        if (U_SUCCESS(status)) {
+            fGNamesTrieFullyLoaded = TRUE;
         }
     }
-    umtx_unlock(&gLock);
+    fGNamesTrie.build(status);
+    if (U_SUCCESS(status)) {
+        umtx_storeRelease(fGNamesTrieReady, 1);
+    }
+}
 
-    if (U_FAILURE(status)) {
-        return NULL;
+/*
+ * Adds a name for parsing. Must be called with gLock held, except initializer.
+ */
+void
+TZGNCore::putIntoTrie(const UChar* name, GNameInfo* nameinfo, UErrorCode& status) {
+    if (umtx_loadAcquire(fGNamesTrieReady) == 0) {
+        fGNamesTrie.put(name, nameinfo, status);
+    } else {
+        // Other threads may be searching fGNamesTrie without locking.
+        fGNamesLateTrie.put(name, nameinfo, status);
+        umtx_storeRelease(fHasLateGNames, 1);
     }
+}
 
+void
+TZGNCore::prepareFind(UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    const_cast<TimeZoneNames *>(fTimeZoneNames)->prepareFind(status);
     umtx_lock(&gLock);
     {
-        // now try it again
-        fGNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+        internalPrepareFind(status);
     }
     umtx_unlock(&gLock);
-
-    results = handler.getMatches(maxLen);
-    if (results != NULL && maxLen > 0) {
-        gmatchInfo = new TimeZoneGenericNameMatchInfo(results);
-        if (gmatchInfo == NULL) {
-            status = U_MEMORY_ALLOCATION_ERROR;
-            delete results;
-            return NULL;
-        }
-    }
-
-    return gmatchInfo;
 }
 
 TimeZoneNames::MatchInfoCollection*
@@ -1320,5 +1389,10 @@ TimeZoneGenericNames::findBestMatch(const UnicodeString& text, int32_t start, ui
     return fRef->obj->findBestMatch(text, start, types, tzID, timeType, status);
 }
 
+void
+TimeZoneGenericNames::prepareFind(UErrorCode& status) const {
+    fRef->obj->prepareFind(status);
+}
+
 U_NAMESPACE_END
 #endif
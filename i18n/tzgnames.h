@@ -57,6 +57,12 @@ class U_I18N_API TimeZoneGenericNames : public UMemory {
     int32_t findBestMatch(const UnicodeString& text, int32_t start, uint32_t types,
         UnicodeString& tzID, UTimeZoneFormatTimeType& timeType, UErrorCode& status) const;
 
+    /**
+     * Loads all names, so that findBestMatch() does not load data,
+     * and searches them without locking.
+     */
+    void prepareFind(UErrorCode& status) const;
+
 private:
     TimeZoneGenericNames();
     TZGNCoreRef* fRef;
@@ -29,7 +29,7 @@
 U_NAMESPACE_BEGIN
 
 // TimeZoneNames object cache handling
-static UMutex gTimeZoneNamesLock = U_MUTEX_INITIALIZER;
+static UMutex gTimeZoneNamesLock = U_NAMED_MUTEX_INITIALIZER("TimeZoneNames");
 static UHashtable *gTimeZoneNamesCache = NULL;
 static UBool gTimeZoneNamesCacheInitialized = FALSE;
 
@@ -120,6 +120,7 @@ class TimeZoneNamesDelegate : public TimeZoneNames {
 
     void loadAllDisplayNames(UErrorCode& status);
     void getDisplayNames(const UnicodeString& tzID, const UTimeZoneNameType types[], int32_t numTypes, UDate date, UnicodeString dest[], UErrorCode& status) const;
+    void prepareFind(UErrorCode& status);
 
     MatchInfoCollection* find(const UnicodeString& text, int32_t start, uint32_t types, UErrorCode& status) const;
 private:
@@ -132,6 +133,8 @@ TimeZoneNamesDelegate::TimeZoneNamesDelegate()
 }
 
 TimeZoneNamesDelegate::TimeZoneNamesDelegate(const Locale& locale, UErrorCode& status) {
+    // The cached names outlive the current memory scope.
+    MemoryScopeSuspender suspender;
     Mutex lock(&gTimeZoneNamesLock);
     if (!gTimeZoneNamesCacheInitialized) {
         // Create empty hashtable if it is not already initialized.
@@ -293,6 +296,11 @@ TimeZoneNamesDelegate::getDisplayNames(const UnicodeString& tzID, const UTimeZon
     fTZnamesCacheEntry->names->getDisplayNames(tzID, types, numTypes, date, dest, status);
 }
 
+void
+TimeZoneNamesDelegate::prepareFind(UErrorCode& status) {
+    fTZnamesCacheEntry->names->prepareFind(status);
+}
+
 TimeZoneNames::MatchInfoCollection*
 TimeZoneNamesDelegate::find(const UnicodeString& text, int32_t start, uint32_t types, UErrorCode& status) const {
     return fTZnamesCacheEntry->names->find(text, start, types, status);
@@ -350,6 +358,11 @@ void
 TimeZoneNames::loadAllDisplayNames(UErrorCode& /*status*/) {
 }
 
+// Empty default implementation, to be overriden in tznames_impl.cpp.
+void
+TimeZoneNames::prepareFind(UErrorCode& /*status*/) {
+}
+
 // A default, lightweight implementation of getDisplayNames.
 // Overridden in tznames_impl.cpp.
 void
@@ -173,7 +173,7 @@ TextTrieMapSearchResultHandler::~TextTrieMapSearchResultHandler(){
 // ---------------------------------------------------
 TextTrieMap::TextTrieMap(UBool ignoreCase, UObjectDeleter *valueDeleter)
 : fIgnoreCase(ignoreCase), fNodes(NULL), fNodesCapacity(0), fNodesCount(0), 
-  fLazyContents(NULL), fIsEmpty(TRUE), fValueDeleter(valueDeleter) {
+  fLazyContents(NULL), fIsEmpty(TRUE), fIsBuilt(1), fValueDeleter(valueDeleter) {
 }
 
 TextTrieMap::~TextTrieMap() {
@@ -216,6 +216,7 @@ TextTrieMap::put(const UnicodeString &key, void *value, ZNStringPool &sp, UError
 void
 TextTrieMap::put(const UChar *key, void *value, UErrorCode &status) {
     fIsEmpty = FALSE;
+    umtx_storeRelease(fIsBuilt, 0);
     if (fLazyContents == NULL) {
         fLazyContents = new UVector(status);
         if (fLazyContents == NULL) {
@@ -375,23 +376,26 @@ void TextTrieMap::buildTrie(UErrorCode &status) {
         delete fLazyContents;
         fLazyContents = NULL; 
     }
+    umtx_storeRelease(fIsBuilt, 1);
 }
 
 void
-TextTrieMap::search(const UnicodeString &text, int32_t start,
-                  TextTrieMapSearchResultHandler *handler, UErrorCode &status) const {
-    {
-        // TODO: if locking the mutex for each check proves to be a performance problem,
-        //       add a flag of type atomic_int32_t to class TextTrieMap, and use only
-        //       the ICU atomic safe functions for assigning and testing.
-        //       Don't test the pointer fLazyContents.
-        //       Don't do unless it's really required.
+TextTrieMap::build(UErrorCode &status) const {
+    // Test the atomic flag, not the pointer fLazyContents,
+    // so that searching a trie that is already built does not lock the mutex.
+    if (umtx_loadAcquire(fIsBuilt) == 0) {
         Mutex lock(&TextTrieMutex);
         if (fLazyContents != NULL) {
             TextTrieMap *nonConstThis = const_cast<TextTrieMap *>(this);
             nonConstThis->buildTrie(status);
         }
     }
+}
+
+void
+TextTrieMap::search(const UnicodeString &text, int32_t start,
+                  TextTrieMapSearchResultHandler *handler, UErrorCode &status) const {
+    build(status);
     if (fNodes == NULL) {
         return;
     }
@@ -1020,7 +1024,10 @@ TimeZoneNamesImpl::TimeZoneNamesImpl(const Locale& locale, UErrorCode& status)
   fMZNamesMap(NULL),
   fNamesTrieFullyLoaded(FALSE),
   fNamesFullyLoaded(FALSE),
-  fNamesTrie(TRUE, deleteZNameInfo) {
+  fNamesTrie(TRUE, deleteZNameInfo),
+  fNamesTrieReady(0),
+  fLateNamesTrie(TRUE, deleteZNameInfo),
+  fHasLateNames(0) {
     initialize(locale, status);
 }
 
@@ -1351,6 +1358,27 @@ TimeZoneNamesImpl::find(const UnicodeString& text, int32_t start, uint32_t types
     TimeZoneNames::MatchInfoCollection* matches;
     TimeZoneNamesImpl* nonConstThis = const_cast<TimeZoneNamesImpl*>(this);
 
+    if (umtx_loadAcquire(fNamesTrieReady) != 0) {
+        // All names are in the trie, and it is not modified any more.
+        // Look them up without locking.
+        if (umtx_loadAcquire(fHasLateNames) == 0) {
+            matches = doFind(handler, text, start, status);
+            if (U_FAILURE(status)) { return NULL; }
+            if (matches != NULL) {
+                return matches;
+            }
+        }
+
+        // Names may have been loaded since then, for zones without resource data.
+        Mutex lock(&gDataMutex);
+        nonConstThis->addAllNamesIntoTrie(status);
+        if (U_FAILURE(status)) { return NULL; }
+        if (umtx_loadAcquire(fHasLateNames) != 0) {
+            fLateNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+        }
+        return doFind(handler, text, start, status);
+    }
+
     // Synchronize so that data is not loaded multiple times.
     // TODO: Consider more fine-grained synchronization.
     {
@@ -1378,9 +1406,7 @@ TimeZoneNamesImpl::find(const UnicodeString& text, int32_t start, uint32_t types
 
         // There are still some names we haven't loaded into the trie yet.
         // Load everything now.
-        nonConstThis->internalLoadAllDisplayNames(status);
-        nonConstThis->addAllNamesIntoTrie(status);
-        nonConstThis->fNamesTrieFullyLoaded = TRUE;
+        nonConstThis->internalPrepareFind(status);
         if (U_FAILURE(status)) { return NULL; }
 
         // Third try: we must return this one.
@@ -1410,13 +1436,15 @@ void TimeZoneNamesImpl::addAllNamesIntoTrie(UErrorCode& status) {
     if (U_FAILURE(status)) return;
     int32_t pos;
     const UHashElement* element;
+    // Threads may be searching fNamesTrie without locking once it is ready.
+    TextTrieMap& trie = umtx_loadAcquire(fNamesTrieReady) != 0 ? fLateNamesTrie : fNamesTrie;
 
     pos = UHASH_FIRST;
     while ((element = uhash_nextElement(fMZNamesMap, &pos)) != NULL) {
         if (element->value.pointer == EMPTY) { continue; }
         UChar* mzID = (UChar*) element->key.pointer;
         ZNames* znames = (ZNames*) element->value.pointer;
-        znames->addAsMetaZoneIntoTrie(mzID, fNamesTrie, status);
+        znames->addAsMetaZoneIntoTrie(mzID, trie, status);
         if (U_FAILURE(status)) { return; }
     }
 
@@ -1425,9 +1453,24 @@ void TimeZoneNamesImpl::addAllNamesIntoTrie(UErrorCode& status) {
         if (element->value.pointer == EMPTY) { continue; }
         UChar* tzID = (UChar*) element->key.pointer;
         ZNames* znames = (ZNames*) element->value.pointer;
-        znames->addAsTimeZoneIntoTrie(tzID, fNamesTrie, status);
+        znames->addAsTimeZoneIntoTrie(tzID, trie, status);
         if (U_FAILURE(status)) { return; }
     }
+    if (&trie == &fLateNamesTrie && !fLateNamesTrie.isEmpty()) {
+        umtx_storeRelease(fHasLateNames, 1);
+    }
+}
+
+// Caller must synchronize.
+void TimeZoneNamesImpl::internalPrepareFind(UErrorCode& status) {
+    if (U_FAILURE(status) || umtx_loadAcquire(fNamesTrieReady) != 0) return;
+    internalLoadAllDisplayNames(status);
+    addAllNamesIntoTrie(status);
+    fNamesTrieFullyLoaded = TRUE;
+    fNamesTrie.build(status);
+    if (U_SUCCESS(status)) {
+        umtx_storeRelease(fNamesTrieReady, 1);
+    }
 }
 
 U_CDECL_BEGIN
@@ -1586,6 +1629,15 @@ void TimeZoneNamesImpl::loadAllDisplayNames(UErrorCode& status) {
     }
 }
 
+void TimeZoneNamesImpl::prepareFind(UErrorCode& status) {
+    if (U_FAILURE(status)) return;
+
+    {
+        Mutex lock(&gDataMutex);
+        internalPrepareFind(status);
+    }
+}
+
 void TimeZoneNamesImpl::getDisplayNames(const UnicodeString& tzID,
         const UTimeZoneNameType types[], int32_t numTypes,
         UDate date, UnicodeString dest[], UErrorCode& status) const {
@@ -2046,7 +2098,7 @@ deleteTZDBNameInfo(void *obj) {
     }
 }
 
-static void U_CALLCONV prepareFind(UErrorCode &status) {
+static void U_CALLCONV prepareTZDBNamesTrie(UErrorCode &status) {
     if (U_FAILURE(status)) {
         return;
     }
@@ -2215,7 +2267,7 @@ TZDBTimeZoneNames::getTimeZoneDisplayName(const UnicodeString& /* tzID */, UTime
 
 TZDBTimeZoneNames::MatchInfoCollection*
 TZDBTimeZoneNames::find(const UnicodeString& text, int32_t start, uint32_t types, UErrorCode& status) const {
-    umtx_initOnce(gTZDBNamesTrieInitOnce, &prepareFind, status);
+    umtx_initOnce(gTZDBNamesTrieInitOnce, &prepareTZDBNamesTrie, status);
     if (U_FAILURE(status)) {
         return NULL;
     }
@@ -141,6 +141,14 @@ class U_I18N_API TextTrieMap : public UMemory {
         TextTrieMapSearchResultHandler *handler, UErrorCode& status) const;
     int32_t isEmpty() const;
 
+    /**
+     * Builds the node structure from the contents added by put(), if that has not happened yet.
+     * search() does this on its first call.
+     * Once the trie is built, and as long as put() is not called again,
+     * search() does not lock any mutex.
+     */
+    void build(UErrorCode &status) const;
+
 private:
     UBool           fIgnoreCase;
     CharacterNode   *fNodes;
@@ -149,6 +157,8 @@ class U_I18N_API TextTrieMap : public UMemory {
 
     UVector         *fLazyContents;
     UBool           fIsEmpty;
+    // 0 while fLazyContents has not been moved into the node structure yet.
+    mutable u_atomic_int32_t fIsBuilt;
     UObjectDeleter  *fValueDeleter;
 
     UBool growNodes();
@@ -190,6 +200,7 @@ class TimeZoneNamesImpl : public TimeZoneNames {
     TimeZoneNames::MatchInfoCollection* find(const UnicodeString& text, int32_t start, uint32_t types, UErrorCode& status) const;
 
     void loadAllDisplayNames(UErrorCode& status);
+    void prepareFind(UErrorCode& status);
     void getDisplayNames(const UnicodeString& tzID, const UTimeZoneNameType types[], int32_t numTypes, UDate date, UnicodeString dest[], UErrorCode& status) const;
 
     static UnicodeString& getDefaultExemplarLocationName(const UnicodeString& tzID, UnicodeString& name);
@@ -212,6 +223,14 @@ class TimeZoneNamesImpl : public TimeZoneNames {
     UBool fNamesFullyLoaded;
     TextTrieMap fNamesTrie;
 
+    // Set to 1 once fNamesTrie holds all names and is built.
+    // It is then never modified again, and find() searches it without locking.
+    // Names that are loaded after that go into fLateNamesTrie,
+    // which is searched with the lock held, and only when fHasLateNames is 1.
+    mutable u_atomic_int32_t fNamesTrieReady;
+    TextTrieMap fLateNamesTrie;
+    mutable u_atomic_int32_t fHasLateNames;
+
     void initialize(const Locale& locale, UErrorCode& status);
     void cleanup();
 
@@ -222,6 +241,7 @@ class TimeZoneNamesImpl : public TimeZoneNames {
     TimeZoneNames::MatchInfoCollection* doFind(ZNameSearchHandler& handler,
         const UnicodeString& text, int32_t start, UErrorCode& status) const;
     void addAllNamesIntoTrie(UErrorCode& errorCode);
+    void internalPrepareFind(UErrorCode& status);
 
     void internalLoadAllDisplayNames(UErrorCode& status);
 
@@ -31,6 +31,8 @@
 #include "unicode/ustring.h"
 #include "cmemory.h"
 #include "collation.h"
+#include "collationscratch.h"
+#include "collationsort.h"
 #include "cstring.h"
 #include "putilimp.h"
 #include "uassert.h"
@@ -209,6 +211,245 @@ ucol_getSortKey(const    UCollator    *coll,
     return keySize;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyUTF8(const UCollator *coll,
+                    const char *source, int32_t sourceLength,
+                    uint8_t *result, int32_t resultLength)
+{
+    UTRACE_ENTRY(UTRACE_UCOL_GET_SORTKEY);
+    if (UTRACE_LEVEL(UTRACE_VERBOSE)) {
+        UTRACE_DATA3(UTRACE_VERBOSE, "coll=%p, source string = %vb ", coll, source,
+            ((sourceLength==-1 && source!=NULL) ? (int32_t)uprv_strlen(source) : sourceLength));
+    }
+
+    int32_t keySize;
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != NULL) {
+        keySize = rbc->internalGetSortKeyUTF8(source, sourceLength, result, resultLength);
+    } else if(source == NULL && sourceLength != 0) {
+        keySize = 0;
+    } else {
+        // Not a RuleBasedCollator: Convert the string to UTF-16.
+        if(source == NULL) {
+            source = "";
+        } else if(sourceLength < 0) {
+            sourceLength = (int32_t)uprv_strlen(source);
+        }
+        UnicodeString s16 = UnicodeString::fromUTF8(StringPiece(source, sourceLength));
+        keySize = Collator::fromUCollator(coll)->getSortKey(s16, result, resultLength);
+    }
+
+    UTRACE_DATA2(UTRACE_VERBOSE, "Sort Key = %vb", result, keySize);
+    UTRACE_EXIT_VALUE(keySize);
+    return keySize;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const *sources, const int32_t *sourceLengths, int32_t count,
+                 uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                 UErrorCode *status)
+{
+    if(status==NULL || U_FAILURE(*status)) {
+        return 0;
+    }
+    UTRACE_ENTRY(UTRACE_UCOL_GET_SORTKEY);
+    UTRACE_DATA4(UTRACE_VERBOSE, "coll=%p, count=%d, dest=%p, destCapacity=%d",
+                 coll, count, dest, destCapacity);
+    int32_t length = CollationSort::getSortKeys(*Collator::fromUCollator(coll),
+                                                sources, sourceLengths, count,
+                                                dest, destCapacity, offsets, *status);
+    UTRACE_EXIT_VALUE_STATUS(length, *status);
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeysUTF8(const UCollator *coll,
+                     const char *const *sources, const int32_t *sourceLengths, int32_t count,
+                     uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                     UErrorCode *status)
+{
+    if(status==NULL || U_FAILURE(*status)) {
+        return 0;
+    }
+    UTRACE_ENTRY(UTRACE_UCOL_GET_SORTKEY);
+    UTRACE_DATA4(UTRACE_VERBOSE, "coll=%p, count=%d, dest=%p, destCapacity=%d",
+                 coll, count, dest, destCapacity);
+    int32_t length;
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != NULL) {
+        length = rbc->internalGetSortKeysUTF8(sources, sourceLengths, count,
+                                              dest, destCapacity, offsets, *status);
+    } else if(count < 0 || (sources == NULL && count > 0) || offsets == NULL ||
+            destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        length = 0;
+    } else {
+        // Not a RuleBasedCollator: Convert each string and fetch the keys one at a time.
+        const Collator *c = Collator::fromUCollator(coll);
+        length = 0;
+        for(int32_t i = 0; i < count; ++i) {
+            offsets[i] = length;
+            const char *s = sources[i];
+            int32_t sourceLength = (sourceLengths != NULL) ? sourceLengths[i] : -1;
+            if(s == NULL) {
+                if(sourceLength != 0) {
+                    *status = U_ILLEGAL_ARGUMENT_ERROR;
+                    length = 0;
+                    break;
+                }
+                s = "";
+            } else if(sourceLength < 0) {
+                sourceLength = (int32_t)uprv_strlen(s);
+            }
+            UnicodeString s16 = UnicodeString::fromUTF8(StringPiece(s, sourceLength));
+            int32_t keyLength = (length < destCapacity) ?
+                c->getSortKey(s16, dest + length, destCapacity - length) :
+                c->getSortKey(s16, NULL, 0);
+            if(keyLength == 0) {
+                *status = U_INTERNAL_PROGRAM_ERROR;
+                length = 0;
+                break;
+            }
+            length += keyLength;
+        }
+        if(U_SUCCESS(*status)) {
+            offsets[count] = length;
+            if(length > destCapacity) {
+                *status = U_BUFFER_OVERFLOW_ERROR;
+            }
+        }
+    }
+    UTRACE_EXIT_VALUE_STATUS(length, *status);
+    return length;
+}
+
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar **strings, int32_t *lengths, int32_t count,
+                 UErrorCode *status)
+{
+    if(status==NULL || U_FAILURE(*status)) {
+        return;
+    }
+    UTRACE_ENTRY(UTRACE_UCOL_GET_SORTKEY);
+    UTRACE_DATA2(UTRACE_VERBOSE, "coll=%p, count=%d", coll, count);
+    LocalMemory<int32_t> indexes;
+    if(count > 1) {
+        if(indexes.allocateInsteadAndCopy(count) == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        CollationSort::sortIndexes(*Collator::fromUCollator(coll),
+                                   strings, lengths, count, indexes.getAlias(), *status);
+        // Permute the strings and lengths into a copy and then back into place.
+        LocalMemory<const UChar *> sortedStrings;
+        LocalMemory<int32_t> sortedLengths;
+        if(U_SUCCESS(*status) &&
+                (sortedStrings.allocateInsteadAndCopy(count) == NULL ||
+                    (lengths != NULL && sortedLengths.allocateInsteadAndCopy(count) == NULL))) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        if(U_SUCCESS(*status)) {
+            for(int32_t i = 0; i < count; ++i) {
+                sortedStrings[i] = strings[indexes[i]];
+            }
+            uprv_memcpy(strings, sortedStrings.getAlias(), (size_t)count * sizeof(*strings));
+            if(lengths != NULL) {
+                for(int32_t i = 0; i < count; ++i) {
+                    sortedLengths[i] = lengths[indexes[i]];
+                }
+                uprv_memcpy(lengths, sortedLengths.getAlias(), (size_t)count * sizeof(*lengths));
+            }
+        }
+    } else if(count < 0 || (count > 0 && strings == NULL)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    UTRACE_EXIT_STATUS(*status);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyPrefix(const UCollator *coll,
+                      const UChar *source, int32_t sourceLength,
+                      uint8_t *dest, int32_t prefixLength,
+                      UErrorCode *status)
+{
+    if(status==NULL || U_FAILURE(*status)) {
+        return 0;
+    }
+    if((source==NULL && sourceLength!=0) || sourceLength<-1 ||
+            dest==NULL || prefixLength<=0) {
+        *status=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UTRACE_ENTRY(UTRACE_UCOL_GET_SORTKEY);
+    UTRACE_DATA4(UTRACE_VERBOSE, "coll=%p, source=%p, dest=%p, prefixLength=%d",
+                 coll, source, dest, prefixLength);
+
+    int32_t length;
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != NULL) {
+        length = rbc->internalGetSortKeyPrefix(source, sourceLength, dest, prefixLength, *status);
+    } else {
+        // ucol_nextSortKeyPart() stops computing the key once the part is full,
+        // and its bytes are the same as those of the ucol_getSortKey() key.
+        UCharIterator iter;
+        uiter_setString(&iter, source, sourceLength);
+        uint32_t state[2] = { 0, 0 };
+        length = Collator::fromUCollator(coll)->
+                internalNextSortKeyPart(&iter, state, dest, prefixLength, *status);
+        if(U_SUCCESS(*status)) {
+            uprv_memset(dest + length, 0, prefixLength - length);
+        } else {
+            length = 0;
+        }
+    }
+
+    UTRACE_DATA2(UTRACE_VERBOSE, "prefix = %vb", dest, length);
+    UTRACE_EXIT_VALUE_STATUS(length, *status);
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getBoundedSortKey(const UCollator *coll,
+                       const UChar *source, int32_t sourceLength,
+                       uint8_t *dest, int32_t maxLength,
+                       UErrorCode *status)
+{
+    if(status==NULL || U_FAILURE(*status)) {
+        return 0;
+    }
+    if((source==NULL && sourceLength!=0) || sourceLength<-1 ||
+            dest==NULL || maxLength<=0) {
+        *status=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UTRACE_ENTRY(UTRACE_UCOL_GET_SORTKEY);
+    UTRACE_DATA4(UTRACE_VERBOSE, "coll=%p, source=%p, dest=%p, maxLength=%d",
+                 coll, source, dest, maxLength);
+
+    int32_t length;
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != NULL) {
+        length = rbc->internalGetBoundedSortKey(source, sourceLength, dest, maxLength, *status);
+    } else {
+        // ucol_nextSortKeyPart() writes the key without its terminating zero byte.
+        UCharIterator iter;
+        uiter_setString(&iter, source, sourceLength);
+        uint32_t state[2] = { 0, 0 };
+        length = Collator::fromUCollator(coll)->
+                internalNextSortKeyPart(&iter, state, dest, maxLength, *status);
+        if(U_FAILURE(*status)) {
+            length = 0;
+        } else if(length < maxLength) {
+            dest[length++] = 0;
+        }
+    }
+
+    UTRACE_DATA2(UTRACE_VERBOSE, "key = %vb", dest, length);
+    UTRACE_EXIT_VALUE_STATUS(length, *status);
+    return length;
+}
+
 U_CAPI int32_t U_EXPORT2
 ucol_nextSortKeyPart(const UCollator *coll,
                      UCharIterator *iter,
@@ -486,6 +727,56 @@ ucol_strcollUTF8(
     return returnVal;
 }
 
+U_CAPI UCollatorScratch * U_EXPORT2
+ucol_openScratch(UErrorCode *status) {
+    if(U_FAILURE(*status)) { return NULL; }
+    CollationScratch *scratch = new CollationScratch();
+    if(scratch == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return reinterpret_cast<UCollatorScratch *>(scratch);
+}
+
+U_CAPI void U_EXPORT2
+ucol_closeScratch(UCollatorScratch *scratch) {
+    delete reinterpret_cast<CollationScratch *>(scratch);
+}
+
+U_CAPI UCollationResult U_EXPORT2
+ucol_strcollWithScratch(const UCollator *coll, UCollatorScratch *scratch,
+                        const UChar *source, int32_t sourceLength,
+                        const UChar *target, int32_t targetLength,
+                        UErrorCode *status) {
+    UTRACE_ENTRY(UTRACE_UCOL_STRCOLL);
+    if (UTRACE_LEVEL(UTRACE_VERBOSE)) {
+        UTRACE_DATA3(UTRACE_VERBOSE, "coll=%p, source=%p, target=%p", coll, source, target);
+        UTRACE_DATA2(UTRACE_VERBOSE, "source string = %vh ", source, sourceLength);
+        UTRACE_DATA2(UTRACE_VERBOSE, "target string = %vh ", target, targetLength);
+    }
+
+    if (U_FAILURE(*status)) {
+        UTRACE_EXIT_VALUE_STATUS(UCOL_EQUAL, *status);
+        return UCOL_EQUAL;
+    }
+    if (scratch == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        UTRACE_EXIT_VALUE_STATUS(UCOL_EQUAL, *status);
+        return UCOL_EQUAL;
+    }
+
+    UCollationResult returnVal;
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if (rbc != NULL) {
+        returnVal = rbc->internalCompareWithScratch(
+            source, sourceLength, target, targetLength,
+            *reinterpret_cast<CollationScratch *>(scratch), *status);
+    } else {
+        returnVal = Collator::fromUCollator(coll)->
+                compare(source, sourceLength, target, targetLength, *status);
+    }
+    UTRACE_EXIT_VALUE_STATUS(returnVal, *status);
+    return returnVal;
+}
 
 /* convenience function for comparing strings */
 U_CAPI UBool U_EXPORT2
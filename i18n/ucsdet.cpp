@@ -170,6 +170,38 @@ ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter)
     return prev;
 }
 
+U_CAPI void U_EXPORT2
+ucsdet_setSampleLength(UCharsetDetector *ucsd, int32_t length, UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return;
+    }
+
+    ((CharsetDetector *) ucsd)->setSampleLength(length, *status);
+}
+
+U_CAPI void U_EXPORT2
+ucsdet_setStopConfidence(UCharsetDetector *ucsd, int32_t confidence, UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return;
+    }
+
+    ((CharsetDetector *) ucsd)->setStopConfidence(confidence, *status);
+}
+
+U_CAPI void U_EXPORT2
+ucsdet_detectBatch(UCharsetDetector *ucsd,
+                   const char *const texts[], const int32_t lengths[], int32_t count,
+                   const char *names[], int32_t confidences[], UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return;
+    }
+
+    ((CharsetDetector *) ucsd)->detectBatch(texts, lengths, count, names, confidences, *status);
+}
+
 U_CAPI  int32_t U_EXPORT2
 ucsdet_getUChars(const UCharsetMatch *ucsm,
                  UChar *buf, int32_t cap, UErrorCode *status)
@@ -246,6 +246,38 @@ udat_format(    const    UDateFormat*    format,
     return res.extract(result, resultLength, *status);
 }
 
+U_CAPI int32_t U_EXPORT2
+udat_formatBatch(const UDateFormat* format,
+        const UDate*    dates,
+        int32_t         count,
+        UChar*          result,
+        int32_t         resultLength,
+        int32_t*        offsets,
+        UErrorCode*     status)
+{
+    if(U_FAILURE(*status)) {
+        return -1;
+    }
+    if (result == NULL ? resultLength != 0 : resultLength < 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return -1;
+    }
+
+    UnicodeString res;
+    if (result != NULL) {
+        // NULL destination for pure preflighting: empty dummy string
+        // otherwise, alias the destination buffer
+        res.setTo(result, 0, resultLength);
+    }
+
+    ((const DateFormat*)format)->formatBatch(dates, count, res, offsets, *status);
+    if(U_FAILURE(*status)) {
+        return -1;
+    }
+
+    return res.extract(result, resultLength, *status);
+}
+
 U_CAPI int32_t U_EXPORT2
 udat_formatCalendar(const UDateFormat*  format,
         UCalendar*      calendar,
@@ -0,0 +1,185 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+**********************************************************************
+*   file name:  uinitsvc.cpp
+*   encoding:   UTF-8
+*   indentation:4
+*
+*   created on: 2026oct14
+*
+*   Eager initialization of ICU services
+*/
+
+#include "unicode/utypes.h"
+#include "unicode/brkiter.h"
+#include "unicode/calendar.h"
+#include "unicode/coll.h"
+#include "unicode/datefmt.h"
+#include "unicode/locid.h"
+#include "unicode/normalizer2.h"
+#include "unicode/numberformatter.h"
+#include "unicode/uclean.h"
+#include "unicode/ucnv.h"
+#include "unicode/uinitsvc.h"
+#include "unicode/uniset.h"
+#include "unicode/ures.h"
+#include "unicode/timezone.h"
+#include "regexst.h"
+#include "utracimp.h"
+
+U_NAMESPACE_USE
+
+namespace {
+
+/**
+ * Locale-independent parts of a service.
+ * Returns FALSE if they could not be loaded.
+ */
+UBool initGlobal(uint32_t service) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    switch (service) {
+    case UINIT_LOCALE:
+        Locale::getDefault();
+        u_init(&errorCode);
+        break;
+    case UINIT_CONVERSION:
+#if !UCONFIG_NO_CONVERSION
+    {
+        // Opens and caches the default converter.
+        UConverter *cnv = ucnv_open(NULL, &errorCode);
+        ucnv_close(cnv);
+        break;
+    }
+#else
+        return FALSE;
+#endif
+    case UINIT_TIME_ZONE:
+#if !UCONFIG_NO_FORMATTING
+        delete TimeZone::createDefault();
+        break;
+#else
+        return FALSE;
+#endif
+    case UINIT_PROPERTIES:
+        Normalizer2::getNFCInstance(errorCode);
+        Normalizer2::getNFKCInstance(errorCode);
+        {
+            // Loads the property data and inclusions used by property sets.
+            UnicodeSet set(UNICODE_STRING_SIMPLE("[[:L:][:Nd:][:White_Space:][:Script=Latn:]]"), errorCode);
+        }
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+        RegexStaticSets::initGlobals(&errorCode);
+#endif
+        break;
+    case UINIT_COLLATION:
+#if !UCONFIG_NO_COLLATION
+        delete Collator::createInstance(Locale::getRoot(), errorCode);
+        break;
+#else
+        return FALSE;
+#endif
+    default:
+        break;
+    }
+    return U_SUCCESS(errorCode);
+}
+
+/**
+ * Loads the data of one service for one locale.
+ * Creating a service object is the simplest way to reach all of its data,
+ * which then stays in ICU's caches after the object is deleted.
+ * Returns FALSE if the data could not be loaded.
+ */
+UBool initForLocale(uint32_t service, const Locale &locale) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    switch (service) {
+    case UINIT_LOCALE:
+    {
+        Locale maximized(locale);
+        maximized.addLikelySubtags(errorCode);
+        UResourceBundle *bundle = ures_open(NULL, locale.getName(), &errorCode);
+        ures_close(bundle);
+        break;
+    }
+#if !UCONFIG_NO_FORMATTING
+    case UINIT_TIME_ZONE:
+        delete Calendar::createInstance(locale, errorCode);
+        break;
+#endif
+#if !UCONFIG_NO_COLLATION
+    case UINIT_COLLATION:
+        delete Collator::createInstance(locale, errorCode);
+        break;
+#endif
+#if !UCONFIG_NO_FORMATTING
+    case UINIT_NUMBER_FORMAT:
+        number::NumberFormatter::withLocale(locale).formatInt(1, errorCode);
+        break;
+    case UINIT_DATE_FORMAT:
+    {
+        DateFormat *fmt = DateFormat::createDateTimeInstance(
+            DateFormat::kDefault, DateFormat::kDefault, locale);
+        if (fmt == NULL) {
+            return FALSE;
+        }
+        UnicodeString result;
+        fmt->format((UDate)0, result);
+        delete fmt;
+        break;
+    }
+#endif
+#if !UCONFIG_NO_BREAK_ITERATION
+    case UINIT_BREAK_ITERATION:
+        delete BreakIterator::createCharacterInstance(locale, errorCode);
+        delete BreakIterator::createWordInstance(locale, errorCode);
+        delete BreakIterator::createLineInstance(locale, errorCode);
+        delete BreakIterator::createSentenceInstance(locale, errorCode);
+        break;
+#endif
+    case UINIT_CONVERSION:
+    case UINIT_PROPERTIES:
+        // Locale-independent.
+        break;
+    default:
+        return FALSE;
+    }
+    return U_SUCCESS(errorCode);
+}
+
+}  // namespace
+
+U_CAPI uint32_t U_EXPORT2
+u_initServices(const char * const *locales, uint32_t services, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if ((services & ~(uint32_t)UINIT_ALL) != 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UTRACE_ENTRY_OC(UTRACE_U_INIT_SERVICES);
+    UTRACE_DATA1(UTRACE_OPEN_CLOSE, "services 0x%x", services);
+    uint32_t loaded = 0;
+    for (uint32_t service = 1; service <= services; service <<= 1) {
+        if ((services & service) == 0 || !initGlobal(service)) {
+            continue;
+        }
+        UBool ok = TRUE;
+        if (locales == NULL) {
+            ok = initForLocale(service, Locale::getDefault());
+        } else {
+            for (int32_t i = 0; locales[i] != NULL; ++i) {
+                // Keep going after a failure, so that the other locales are still loaded.
+                if (!initForLocale(service, Locale(locales[i]))) {
+                    ok = FALSE;
+                }
+            }
+        }
+        if (ok) {
+            loaded |= service;
+        }
+    }
+    UTRACE_EXIT_VALUE_STATUS(loaded, *status);
+    return loaded;
+}
@@ -273,6 +273,23 @@ class U_I18N_API AlphabeticIndex: public UObject {
          */
         int32_t getBucketIndex(const UnicodeString &name, UErrorCode &errorCode) const;
 
+#ifndef U_HIDE_DRAFT_API
+        /**
+         * Finds the index buckets for an array of names, like calling getBucketIndex()
+         * for each of them.
+         *
+         * @param names the strings to be sorted into index buckets
+         * @param count the number of names
+         * @param indexes receives the bucket number for each name;
+         *                must have room for count values
+         * @param errorCode Error code, will be set with the reason if the
+         *                  operation fails.
+         * @draft ICU 64
+         */
+        void getBucketIndices(const UnicodeString names[], int32_t count, int32_t indexes[],
+                              UErrorCode &errorCode) const;
+#endif  /* U_HIDE_DRAFT_API */
+
         /**
          * Returns the index-th bucket. Returns NULL if the index is out of range.
          *
@@ -285,11 +302,11 @@ class U_I18N_API AlphabeticIndex: public UObject {
     private:
         friend class AlphabeticIndex;
 
-        ImmutableIndex(BucketList *bucketList, Collator *collatorPrimaryOnly)
+        ImmutableIndex(BucketList *bucketList, RuleBasedCollator *collatorPrimaryOnly)
                 : buckets_(bucketList), collatorPrimaryOnly_(collatorPrimaryOnly) {}
 
         BucketList *buckets_;
-        Collator *collatorPrimaryOnly_;
+        RuleBasedCollator *collatorPrimaryOnly_;
     };
 
     /**
@@ -535,6 +552,22 @@ class U_I18N_API AlphabeticIndex: public UObject {
      */
     virtual int32_t  getBucketIndex(const UnicodeString &itemName, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     *   Given an array of record names, returns the zero-based index of the Bucket
+     *   for each of them, like calling getBucketIndex() for each name.
+     *   The names need not be in the index, and no Records are added.
+     *
+     * @param names   The names whose bucket positions in the index are to be determined.
+     * @param count   The number of names.
+     * @param indexes Receives the bucket number for each name; must have room for count values.
+     * @param status  Error code, will be set with the reason if the operation fails.
+     * @draft ICU 64
+     */
+    void getBucketIndices(const UnicodeString names[], int32_t count, int32_t indexes[],
+                          UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
     /**
      *   Get the zero based index of the current Bucket from an iteration
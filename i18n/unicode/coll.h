@@ -521,6 +521,29 @@ class U_I18N_API Collator : public UObject {
                                           int32_t sourceLength,
                                           CollationKey& key,
                                           UErrorCode& status) const = 0;
+
+    /* Cannot use #ifndef U_HIDE_DRAFT_API for the following draft method since it is virtual. */
+    /**
+     * Transforms the UTF-8 string into a series of characters that can be compared
+     * with CollationKey::compareTo.
+     * Same as getCollationKey() for the equivalent UTF-16 string.
+     * Ill-formed UTF-8 sequences are treated like U+FFFD.
+     *
+     * The base class implementation converts the string to UTF-16.
+     * Note that a StringPiece can be implicitly constructed
+     * from a std::string or a NUL-terminated const char * string.
+     *
+     * @param source the UTF-8 source string to be transformed into a sort key.
+     * @param key the collation key to be filled in
+     * @param status the error code status.
+     * @return the collation key of the string based on the collation rules.
+     * @see CollationKey#compare
+     * @draft ICU 64
+     */
+    virtual CollationKey &getCollationKeyUTF8(const StringPiece &source,
+                                              CollationKey &key,
+                                              UErrorCode &status) const;
+
     /**
      * Generates the hash code for the collation object
      * @stable ICU 2.0
@@ -1023,6 +1046,22 @@ class U_I18N_API Collator : public UObject {
     virtual int32_t getSortKey(const char16_t*source, int32_t sourceLength,
                                uint8_t*result, int32_t resultLength) const = 0;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Sorts an array of strings according to this collator.
+     * The result is the same as for a stable sort with compare() as the comparison
+     * function, but the sort key for each string is computed only once
+     * and the keys are sorted, which is much faster for large arrays.
+     *
+     * @param strings The array of strings, sorted in place.
+     * @param count The number of strings, must be >=0.
+     * @param status ICU error code.
+     * @see ucol_sortStrings
+     * @draft ICU 64
+     */
+    void sort(UnicodeString *strings, int32_t count, UErrorCode &status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Produce a bound for a given sortkey and a number of levels.
      * Return value is always the number of bytes needed, regardless of
@@ -388,6 +388,31 @@ class U_I18N_API DateFormat : public Format {
      */
     UnicodeString& format(UDate date, UnicodeString& appendTo) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Formats an array of UDates, appending the results one after the other,
+     * as if by calling format(UDate, UnicodeString&) for each date.
+     * This is faster for many dates: SimpleDateFormat uses one calendar for all of them,
+     * and reuses the text of leading date and time fields from the previous date
+     * when the local day or minute did not change, which is common for
+     * monotonic input like log timestamps.
+     *
+     * @param dates     The UDate values to be formatted.
+     * @param count     The number of dates.
+     * @param appendTo  Output parameter to receive result.
+     *                  Results are appended to existing contents.
+     * @param offsets   If not NULL, must have room for count values:
+     *                  offsets[i] receives the index in appendTo just after
+     *                  the text for dates[i].
+     * @param status    Input/output error code.
+     * @return          Reference to 'appendTo' parameter.
+     * @draft ICU 64
+     */
+    UnicodeString& formatBatch(const UDate* dates, int32_t count,
+                               UnicodeString& appendTo, int32_t* offsets,
+                               UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Parse a date/time string. For example, a time text "07/10/96 4:5 PM, PDT"
      * will be parsed into a UDate that is equivalent to Date(837039928046).
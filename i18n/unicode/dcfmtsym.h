@@ -350,6 +350,9 @@ class U_I18N_API DecimalFormatSymbols : public UObject {
     static UClassID U_EXPORT2 getStaticClassID();
 
 private:
+    friend class StartupSnapshot;
+    friend class StartupSnapshotBuilder;
+
     DecimalFormatSymbols();
 
     /**
@@ -50,6 +50,7 @@ class CompactDecimalFormat;
 
 namespace number {
 class LocalizedNumberFormatter;
+class NumberParser;
 class FormattedNumber;
 namespace impl {
 class DecimalQuantity;
@@ -2058,6 +2059,16 @@ class U_I18N_API DecimalFormat : public NumberFormat {
     void formatToDecimalQuantity(const Formattable& number, number::impl::DecimalQuantity& output,
                                  UErrorCode& status) const;
 
+    /**
+     *  Append an integer formatted with the fast path, if this DecimalFormat
+     *  has one that shows all of its digits and no fraction digits.
+     *  The plural form of the output is then that of the integer itself.
+     *  Internal, not intended for public use.
+     *  @return TRUE if the number was appended, FALSE if it must be formatted normally.
+     *  @internal
+     */
+    UBool formatIntegerFast(int32_t number, UnicodeString& appendTo) const;
+
 #endif  /* U_HIDE_INTERNAL_API */
 
 #ifndef U_HIDE_DRAFT_API
@@ -2084,6 +2095,19 @@ class U_I18N_API DecimalFormat : public NumberFormat {
      * @draft ICU 62
      */
     const number::LocalizedNumberFormatter& toNumberFormatter() const;
+
+    /**
+     * Creates an immutable NumberParser that parses like this DecimalFormat.
+     * Unlike this DecimalFormat, the NumberParser can be shared by many threads,
+     * and it stays valid when this DecimalFormat is changed or deleted.
+     *
+     * To use the return value, include unicode/numberparser.h.
+     *
+     * @param status Set if an error occurs while building the parser.
+     * @return The parser; empty if an error occurred.
+     * @draft ICU 64
+     */
+    number::NumberParser toNumberParser(UErrorCode& status) const;
 #endif  /* U_HIDE_DRAFT_API */
 
     /**
@@ -2138,6 +2162,14 @@ class U_I18N_API DecimalFormat : public NumberFormat {
 
     const numparse::impl::NumberParserImpl* getCurrencyParser(UErrorCode& status) const;
 
+    /** The body of parse(), shared with NumberParser. */
+    static void parseWith(const numparse::impl::NumberParserImpl& parser, const UnicodeString& text,
+                          Formattable& output, ParsePosition& parsePosition);
+
+    /** The body of parseCurrency(), shared with NumberParser. */
+    static CurrencyAmount* parseCurrencyWith(const numparse::impl::NumberParserImpl& parser,
+                                             const UnicodeString& text, ParsePosition& parsePosition);
+
     static void fieldPositionHelper(const number::FormattedNumber& formatted, FieldPosition& fieldPosition,
                                     int32_t offset, UErrorCode& status);
 
@@ -2162,6 +2194,9 @@ class U_I18N_API DecimalFormat : public NumberFormat {
     // Allow child class CompactDecimalFormat to access fProperties:
     friend class CompactDecimalFormat;
 
+    // Allow NumberParser to share the parse code:
+    friend class number::NumberParser;
+
 };
 
 U_NAMESPACE_END
@@ -641,6 +641,8 @@ class U_I18N_API DateFormatSymbols U_FINAL : public UObject  {
 
     friend class SimpleDateFormat;
     friend class DateFormatSymbolsSingleSetter; // see udat.cpp
+    friend class StartupSnapshot;
+    friend class StartupSnapshotBuilder;
 
     /**
      * Abbreviated era strings. For example: "AD" and "BC".
@@ -906,7 +908,15 @@ class U_I18N_API DateFormatSymbols U_FINAL : public UObject  {
     char validLocale[ULOC_FULLNAME_CAPACITY];
     char actualLocale[ULOC_FULLNAME_CAPACITY];
 
-    DateFormatSymbols(); // default constructor not implemented
+    /**
+     * Creates an object without any data, for StartupSnapshot to fill in.
+     */
+    DateFormatSymbols();
+
+    /**
+     * Sets all of the data to NULL or empty.
+     */
+    void initializeEmpty();
 
     /**
      * Called by the constructors to actually load data from the resources
@@ -507,11 +507,8 @@ class U_I18N_API DateIntervalFormat : public Format {
 
     /**
      * Gets the date formatter. The DateIntervalFormat instance continues to own
-     * the returned DateFormatter object, and will use and possibly modify it
-     * during format operations. In a multi-threaded environment, the returned
-     * DateFormat can only be used if it is certain that no other threads are
-     * concurrently using this DateIntervalFormatter, even for nominally const
-     * functions.
+     * the returned DateFormatter object, and uses it during format operations
+     * without modifying it.
      *
      * @return the date formatter associated with this date interval formatter.
      * @stable ICU 4.0
@@ -691,9 +688,7 @@ class U_I18N_API DateIntervalFormat : public Format {
      * Format 2 Calendars using fall-back interval pattern
      *
      * The full pattern used in this fall-back format is the
-     * full pattern of the date formatter.
-     *
-     * gFormatterMutex must already be locked when calling this function.
+     * pattern of the given date formatter.
      *
      * @param fromCalendar      calendar set to the from date in date interval
      *                          to be formatted into date interval string
@@ -701,6 +696,7 @@ class U_I18N_API DateIntervalFormat : public Format {
      *                          to be formatted into date interval string
      * @param fromToOnSameDay   TRUE iff from and to dates are on the same day
      *                          (any difference is in ampm/hours or below)
+     * @param dateFormat        the date formatter with the full pattern
      * @param appendTo          Output parameter to receive result.
      *                          Result is appended to existing contents.
      * @param pos               On input: an alignment field, if desired.
@@ -712,6 +708,7 @@ class U_I18N_API DateIntervalFormat : public Format {
     UnicodeString& fallbackFormat(Calendar& fromCalendar,
                                   Calendar& toCalendar,
                                   UBool fromToOnSameDay,
+                                  const SimpleDateFormat& dateFormat,
                                   UnicodeString& appendTo,
                                   FieldPosition& pos,
                                   UErrorCode& status) const;
@@ -966,8 +963,6 @@ class U_I18N_API DateIntervalFormat : public Format {
     /**
      * Format 2 Calendars to produce a string.
      * Implementation of the similar public format function.
-     * Must be called with gFormatterMutex already locked.
-     *
      * Note: "fromCalendar" and "toCalendar" are not const,
      * since calendar is not const in  SimpleDateFormat::format(Calendar&),
      *
@@ -994,6 +989,27 @@ class U_I18N_API DateIntervalFormat : public Format {
                               FieldPosition& fieldPosition,
                               UErrorCode& status) const ;
 
+    /**
+     * Gets a clone of fDateFormat with the given pattern applied,
+     * created on first use and kept in fCompiledFormats.
+     *
+     * @param index             the index of the compiled format
+     * @param pattern           the pattern; must be the same for each call with this index
+     *                          until resetCompiledFormats()
+     * @param status            output param set to success/failure code on exit
+     * @return                  the date formatter, or NULL on failure
+     * @internal (private)
+     */
+    const SimpleDateFormat* getCompiledFormat(int32_t index,
+                                              const UnicodeString& pattern,
+                                              UErrorCode& status) const;
+
+    /**
+     * Discards the compiled formats, after a change of the patterns or of fDateFormat.
+     * @internal (private)
+     */
+    void resetCompiledFormats();
+
 
     // from calendar field to pattern letter
     static const char16_t fgCalendarFieldToPatternLetter[];
@@ -1017,6 +1033,13 @@ class U_I18N_API DateIntervalFormat : public Format {
     Calendar* fFromCalendar;
     Calendar* fToCalendar;
 
+    /**
+     * Date formatters for the parts of the interval patterns and for the fallback
+     * patterns, so that formatting does not apply patterns to fDateFormat.
+     */
+    struct CompiledFormats;
+    CompiledFormats* fCompiledFormats;
+
     Locale fLocale;
 
     /**
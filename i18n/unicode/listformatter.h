@@ -26,6 +26,7 @@
 
 U_NAMESPACE_BEGIN
 
+class Appendable;
 class FieldPositionIterator;
 class FieldPositionHandler;
 
@@ -159,6 +160,21 @@ class U_I18N_API ListFormatter : public UObject{
     UnicodeString& format(const UnicodeString items[], int32_t n_items,
         UnicodeString & appendTo, FieldPositionIterator* posIter,
         UErrorCode& errorCode) const;
+
+    /**
+     * Formats a list of strings into an Appendable.
+     * The list is written in a single pass, without intermediate strings,
+     * unless the locale's patterns reorder the items.
+     *
+     * @param items     An array of strings to be combined and formatted.
+     * @param n_items   Length of the array items.
+     * @param appendTo  The Appendable to which the formatted result is appended.
+     * @param errorCode ICU error code returned here.
+     * @return          appendTo
+     * @draft ICU 64
+     */
+    Appendable& format(const UnicodeString items[], int32_t n_items,
+        Appendable& appendTo, UErrorCode& errorCode) const;
 #endif  /* U_HIDE_DRAFT_API */
 
 #ifndef U_HIDE_INTERNAL_API
@@ -192,6 +208,11 @@ class U_I18N_API ListFormatter : public UObject{
         const UnicodeString items[], int32_t n_items, UnicodeString& appendTo,
         int32_t index, int32_t &offset, FieldPositionHandler* handler, UErrorCode& errorCode) const;
 
+    static void formatInOrder(
+        const ListFormatInternal& data, const UnicodeString items[], int32_t n_items,
+        Appendable& appendTo, int32_t start, int32_t index, int32_t &offset,
+        FieldPositionHandler* handler);
+
     ListFormatter();
 
     ListFormatInternal* owned;
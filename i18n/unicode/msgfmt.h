@@ -46,6 +46,93 @@ U_NAMESPACE_BEGIN
 class AppendableWrapper;
 class DateFormat;
 class NumberFormat;
+class SharedMessageFormat;
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * A lightweight, typed argument value for
+ * MessageFormat::format(const MessageArgument*, int32_t, UnicodeString&, UErrorCode&).
+ * Unlike a Formattable, it neither allocates nor copies: a string argument
+ * only aliases the caller's buffer, which must remain valid while the
+ * message is formatted.
+ *
+ * @draft ICU 64
+ */
+class U_I18N_API MessageArgument : public UMemory {
+public:
+    /**
+     * Creates a numeric argument.
+     * @param value the value
+     * @draft ICU 64
+     */
+    MessageArgument(int32_t value) : fType(Formattable::kLong) { fValue.fInt64 = value; }
+
+    /**
+     * Creates a numeric argument.
+     * @param value the value
+     * @draft ICU 64
+     */
+    MessageArgument(int64_t value) : fType(Formattable::kInt64) { fValue.fInt64 = value; }
+
+    /**
+     * Creates a numeric argument.
+     * @param value the value
+     * @draft ICU 64
+     */
+    MessageArgument(double value) : fType(Formattable::kDouble) { fValue.fDouble = value; }
+
+    /**
+     * Creates a string argument that aliases the contents of s.
+     * @param s the string, must outlive the formatting call
+     * @draft ICU 64
+     */
+    MessageArgument(const UnicodeString &s) : fType(Formattable::kString) {
+        fValue.fString.fBuffer = s.getBuffer();
+        fValue.fString.fLength = s.length();
+    }
+
+    /**
+     * Creates a string argument that aliases a UChar buffer.
+     * @param s the string, must outlive the formatting call
+     * @param length the length of s, or -1 if it is NUL-terminated
+     * @draft ICU 64
+     */
+    MessageArgument(const UChar *s, int32_t length);
+
+    /**
+     * Creates a date argument.
+     * @param date the date
+     * @return the argument
+     * @draft ICU 64
+     */
+    static MessageArgument forDate(UDate date) {
+        MessageArgument arg(date);
+        arg.fType = Formattable::kDate;
+        return arg;
+    }
+
+    /**
+     * Returns the type of this argument: Formattable::kLong, kInt64, kDouble,
+     * kString or kDate.
+     * @return the type
+     * @draft ICU 64
+     */
+    Formattable::Type getType() const { return fType; }
+
+private:
+    friend class MessageFormat;
+
+    Formattable::Type fType;
+    union {
+        int64_t fInt64;
+        double  fDouble;
+        struct {
+            const UChar *fBuffer;
+            int32_t      fLength;
+        } fString;
+    } fValue;
+};
+#endif  /* U_HIDE_DRAFT_API */
 
 /**
  * <p>MessageFormat prepares strings for display to users,
@@ -723,6 +810,34 @@ class U_I18N_API MessageFormat : public Format {
                           int32_t count,
                           UnicodeString& appendTo,
                           UErrorCode& status) const;
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Formats the given array of typed arguments into a user-readable string.
+     * Produces the same result as format() with an equivalent array of
+     * Formattable objects.
+     *
+     * <p>Messages whose top level consists only of literal text and numbered
+     * arguments without a complex (choice, plural, select) style, such as
+     * "{0} has {1,number} new messages", are formatted from a list of
+     * operations precompiled when the pattern is applied, with their
+     * formatters already resolved and without converting the arguments
+     * to Formattable objects. Other messages fall back to the general
+     * formatting code.
+     *
+     * @param arguments An array of arguments to be formatted.
+     * @param count     The number of elements of 'arguments'.
+     * @param appendTo  Output parameter to receive result.
+     *                  Result is appended to existing contents.
+     * @param status    Input/output error code.
+     * @return          Reference to 'appendTo' parameter.
+     * @draft ICU 64
+     */
+    UnicodeString& format(const MessageArgument* arguments,
+                          int32_t count,
+                          UnicodeString& appendTo,
+                          UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Parses the given string into an array of output arguments.
      *
@@ -807,6 +922,21 @@ class U_I18N_API MessageFormat : public Format {
      */
     UBool usesNamedArguments() const;
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * ICU use only.
+     * Returns handle to the shared, cached MessageFormat instance for the given
+     * pattern and locale. The pattern is parsed only once per cache entry, and
+     * unlike other MessageFormat objects, the shared instance may be used for
+     * formatting by several threads concurrently.
+     * On success, caller must call removeRef() on returned value
+     * once it is done with the shared instance.
+     * @internal
+     */
+    static const SharedMessageFormat* U_EXPORT2 createSharedInstance(
+            const UnicodeString& pattern, const Locale& locale, UErrorCode& status);
+#endif  /* U_HIDE_INTERNAL_API */
+
 
 #ifndef U_HIDE_INTERNAL_API
     /**
@@ -884,6 +1014,11 @@ class U_I18N_API MessageFormat : public Format {
         virtual UnicodeString select(void *ctx, double number, UErrorCode& ec) const;
 
         void reset();
+
+        /**
+         * Creates the PluralRules now rather than on the first select().
+         */
+        void loadRules(UErrorCode& ec) const;
     private:
         const MessageFormat &msgFormat;
         PluralRules* rules;
@@ -925,6 +1060,16 @@ class U_I18N_API MessageFormat : public Format {
     UHashtable* cachedFormatters;
     UHashtable* customFormatArgStarts;
 
+    /**
+     * The top-level message compiled into literal-text and argument operations
+     * with resolved formatters, for the typed-argument format() fast path.
+     * NULL if the message is not simple enough. Rebuilt by compileMessage()
+     * whenever the pattern or the formatters change.
+     */
+    struct CompiledOp;
+    CompiledOp* compiledOps;
+    int32_t     compiledOpCount;
+
     PluralSelectorProvider pluralProvider;
     PluralSelectorProvider ordinalProvider;
 
@@ -994,6 +1139,20 @@ class U_I18N_API MessageFormat : public Format {
 
     void cacheExplicitFormats(UErrorCode& status);
 
+    void compileMessage();
+
+    void clearCompiledMessage();
+
+    /**
+     * Creates the lazily-initialized objects that format() may need,
+     * so that a cached instance is not modified while it is shared.
+     */
+    void prepareForSharing(UErrorCode& status);
+
+#ifndef U_HIDE_DRAFT_API
+    static void toFormattable(const MessageArgument& arg, Formattable& result);
+#endif  /* U_HIDE_DRAFT_API */
+
     Format* createAppropriateFormat(UnicodeString& type,
                                     UnicodeString& style,
                                     Formattable::Type& formattableType,
@@ -1088,6 +1247,7 @@ class U_I18N_API MessageFormat : public Format {
     };
 
     friend class MessageFormatAdapter; // getFormatTypeList() access
+    friend class MessageFormatCacheKey; // prepareForSharing() access
 };
 
 U_NAMESPACE_END
@@ -2271,6 +2271,50 @@ class U_I18N_API LocalizedNumberFormatter
      */
     FormattedNumber formatInt(int64_t value, UErrorCode &status) const;
 
+    /**
+     * Format the given integer number into a caller-provided buffer, using the settings specified in the
+     * NumberFormatter fluent setting chain.
+     *
+     * Unlike formatInt(int64_t, UErrorCode &), this function does not allocate a results object. Once the
+     * formatter has compiled its settings (after a few calls), formatting typical numbers does not allocate
+     * any heap memory.
+     *
+     * The result is NUL-terminated if there is space for the NUL. If the buffer is too small, then
+     * status is set to U_BUFFER_OVERFLOW_ERROR, and the full length is returned (preflighting).
+     *
+     * @param value
+     *            The number to format.
+     * @param dest
+     *            The destination buffer. Can be nullptr if capacity is 0.
+     * @param capacity
+     *            The number of char16_ts at dest.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The length of the formatted number, not counting the terminating NUL.
+     * @draft ICU 64
+     */
+    int32_t formatInt(int64_t value, char16_t *dest, int32_t capacity, UErrorCode &status) const;
+
+    /**
+     * Format the given integer number into a caller-provided buffer as UTF-8, using the settings specified
+     * in the NumberFormatter fluent setting chain.
+     *
+     * Like formatInt(int64_t, char16_t *, int32_t, UErrorCode &), this does not allocate heap memory
+     * in steady state, and it supports preflighting.
+     *
+     * @param value
+     *            The number to format.
+     * @param dest
+     *            The destination buffer. Can be nullptr if capacity is 0.
+     * @param capacity
+     *            The number of bytes at dest.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The length of the formatted number in bytes, not counting the terminating NUL.
+     * @draft ICU 64
+     */
+    int32_t formatIntToUTF8(int64_t value, char *dest, int32_t capacity, UErrorCode &status) const;
+
     /**
      * Format the given float or double to a string using the settings specified in the NumberFormatter fluent setting
      * chain.
@@ -2300,6 +2344,102 @@ class U_I18N_API LocalizedNumberFormatter
      */
     FormattedNumber formatDecimal(StringPiece value, UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Returns a copy of this formatter whose settings are already compiled into the efficient
+     * internal form, regardless of the threshold setting. Formatting with the returned formatter
+     * never takes the slower code path that is used for the first few calls otherwise.
+     *
+     * The compiled form is immutable and reference-counted: Copies of the returned formatter,
+     * made with the copy constructor or the copy assignment operator, share it instead of
+     * compiling it again, so they are cheap to hand to other threads.
+     * Changing a setting on the returned formatter yields a formatter that is not compiled.
+     *
+     * <pre>
+     * static const LocalizedNumberFormatter formatter =
+     *     NumberFormatter::withLocale("de").compile(status);
+     * </pre>
+     *
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during compilation.
+     * @return A compiled LocalizedNumberFormatter, or a copy of this formatter if an error occurred.
+     * @draft ICU 64
+     */
+    LocalizedNumberFormatter compile(UErrorCode& status) const;
+
+    /**
+     * Formats an array of doubles with the settings of this formatter, and writes the results
+     * one after the other into a single buffer, without separators or NUL characters between them.
+     * This is cheaper than calling formatDouble() for each value: No FormattedNumber objects are created,
+     * and the compiled form of the settings and the intermediate objects are reused for the whole batch.
+     *
+     * Field positions are not available for batch results.
+     *
+     * <pre>
+     * int32_t offsets[count + 1];
+     * int32_t length = formatter.formatBatch(values, count, buffer, capacity, offsets, status);
+     * // The result for values[i] is at buffer+offsets[i] and has a length of offsets[i+1]-offsets[i].
+     * </pre>
+     *
+     * @param values
+     *            The numbers to format.
+     * @param count
+     *            The number of values.
+     * @param dest
+     *            Receives the formatted values; can be nullptr if capacity is 0, for preflighting.
+     *            The whole output is NUL-terminated if there is space for it.
+     * @param capacity
+     *            The size of dest in char16_t units.
+     * @param offsets
+     *            If not nullptr, receives count+1 indexes into dest: the start of each result,
+     *            followed by the total length. Filled even in case of a U_BUFFER_OVERFLOW_ERROR.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting,
+     *            or to U_BUFFER_OVERFLOW_ERROR if the results do not fit into dest.
+     * @return The total length of the results.
+     * @draft ICU 64
+     */
+    int32_t formatBatch(const double* values, int32_t count, char16_t* dest, int32_t capacity,
+                        int32_t* offsets, UErrorCode& status) const;
+
+    /**
+     * Format the fixed-point number mantissa * 10^(-scale) to a string using the settings specified
+     * in the NumberFormatter fluent setting chain. For example, 12345 with a scale of 2 is 123.45.
+     *
+     * Unlike formatDouble(), this is exact, and unlike formatDecimal(), the number does not have to
+     * be converted to a string first.
+     *
+     * @param mantissa
+     *            The digits of the number, as an integer.
+     * @param scale
+     *            The number of digits of the mantissa after the decimal point; can be negative.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return A FormattedNumber object; call .toString() to get the string.
+     * @draft ICU 64
+     */
+    FormattedNumber formatFixedPoint(int64_t mantissa, int32_t scale, UErrorCode& status) const;
+
+    /**
+     * Format the given IEEE 754 decimal128 number to a string using the settings specified
+     * in the NumberFormatter fluent setting chain.
+     *
+     * The number must be in the binary integer decimal (BID) encoding, which is used by most
+     * software implementations and compilers, and it is passed as its high and low 64 bits.
+     * Numbers in the densely packed decimal (DPD) encoding must be converted first.
+     *
+     * @param high
+     *            The upper 64 bits of the decimal128, with the sign bit.
+     * @param low
+     *            The lower 64 bits of the decimal128.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return A FormattedNumber object; call .toString() to get the string.
+     * @draft ICU 64
+     */
+    FormattedNumber formatDecimal128(uint64_t high, uint64_t low, UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 
     /** Internal method.
@@ -2403,6 +2543,8 @@ class U_I18N_API LocalizedNumberFormatter
     // header, and LocalPointer needs the full class definition in order to delete the instance.
     const impl::NumberFormatterImpl* fCompiled {nullptr};
     char fUnsafeCallCount[8] {};  // internally cast to u_atomic_int32_t
+    // true if fCompiled was built by compile() and is shared with copies of this object
+    bool fCompiledShared {false};
 
     explicit LocalizedNumberFormatter(const NumberFormatterSettings<LocalizedNumberFormatter>& other);
 
@@ -2416,11 +2558,20 @@ class U_I18N_API LocalizedNumberFormatter
 
     void lnfMoveHelper(LocalizedNumberFormatter&& src);
 
+    void lnfShareHelper(const impl::NumberFormatterImpl* compiled);
+
     /**
      * @return true if the compiled formatter is available.
      */
     bool computeCompiled(UErrorCode& status) const;
 
+    /**
+     * Like formatImpl(), for an int64 value. Uses the integer fast path of the compiled formatter if it has one,
+     * in which case the quantity in the results object is set only if needsQuantity is true.
+     */
+    void formatIntImpl(int64_t value, impl::UFormattedNumberData *results, bool needsQuantity,
+                       UErrorCode &status) const;
+
     // To give the fluent setters access to this class's constructor:
     friend class NumberFormatterSettings<UnlocalizedNumberFormatter>;
     friend class NumberFormatterSettings<LocalizedNumberFormatter>;
@@ -0,0 +1,131 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING
+#ifndef __NUMBERPARSER_H__
+#define __NUMBERPARSER_H__
+
+#include "unicode/curramt.h"
+#include "unicode/fmtable.h"
+#include "unicode/parsepos.h"
+#include "unicode/uobject.h"
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * \file
+ * \brief C++ API: Immutable number parser that can be shared between threads.
+ *
+ * A NumberParser parses like the DecimalFormat that it was created from:
+ *
+ * <pre>
+ * LocalPointer<DecimalFormat> df(...);
+ * const NumberParser parser = df->toNumberParser(status);
+ * // Many threads may now share the parser:
+ * Formattable result;
+ * ParsePosition ppos;
+ * parser.parse(u"1,234.5", result, ppos);
+ * </pre>
+ */
+
+U_NAMESPACE_BEGIN
+
+// Forward declarations:
+class DecimalFormat;
+
+namespace numparse {
+namespace impl {
+
+// Forward declarations:
+class NumberParserImpl;
+
+} // namespace impl
+} // namespace numparse
+
+namespace number {  // icu::number
+
+/**
+ * An immutable number parser with precompiled matchers.
+ *
+ * A NumberParser is a snapshot of the parsing settings of a DecimalFormat:
+ * Later changes to the DecimalFormat do not affect it, and it does not depend on the
+ * DecimalFormat staying alive.
+ *
+ * NumberParser is immutable, and therefore thread-safe:
+ * Any number of threads may call parse() and parseCurrency() on the same object at the same time.
+ * Each call keeps its intermediate state on its own stack.
+ *
+ * @see DecimalFormat#toNumberParser
+ * @draft ICU 64
+ */
+class U_I18N_API NumberParser : public UMemory {
+  public:
+    /**
+     * Creates an empty parser that does not accept any input.
+     * Move the result of DecimalFormat#toNumberParser into it to make it useful.
+     * @draft ICU 64
+     */
+    NumberParser() = default;
+
+    /**
+     * Move constructor: The source is left empty.
+     * @draft ICU 64
+     */
+    NumberParser(NumberParser&& src) U_NOEXCEPT;
+
+    /**
+     * Move assignment: The source is left empty.
+     * @draft ICU 64
+     */
+    NumberParser& operator=(NumberParser&& src) U_NOEXCEPT;
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    ~NumberParser();
+
+    /**
+     * Parses text from the given position, like DecimalFormat#parse(const UnicodeString&, Formattable&, ParsePosition&).
+     *
+     * @param text The text to be parsed.
+     * @param result Receives the parsed number if the parse succeeds.
+     * @param parsePosition On input, the position at which to start parsing; on output,
+     *                      the position after the parsed text, or the error index if the parse fails.
+     * @draft ICU 64
+     */
+    void parse(const UnicodeString& text, Formattable& result, ParsePosition& parsePosition) const;
+
+    /**
+     * Parses text from the given position as a currency amount,
+     * like DecimalFormat#parseCurrency(const UnicodeString&, ParsePosition&).
+     *
+     * @param text The text to be parsed.
+     * @param parsePosition On input, the position at which to start parsing; on output,
+     *                      the position after the parsed text, or the error index if the parse fails.
+     * @return A new CurrencyAmount that the caller owns, or nullptr if the parse fails.
+     * @draft ICU 64
+     */
+    CurrencyAmount* parseCurrency(const UnicodeString& text, ParsePosition& parsePosition) const;
+
+  private:
+    const numparse::impl::NumberParserImpl* fParser = nullptr;
+    const numparse::impl::NumberParserImpl* fCurrencyParser = nullptr;
+
+    NumberParser(const NumberParser& other) = delete;
+    NumberParser& operator=(const NumberParser& other) = delete;
+
+    // To give DecimalFormat access to the fields
+    friend class ::icu::DecimalFormat;
+};
+
+}  // namespace number
+U_NAMESPACE_END
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif // __NUMBERPARSER_H__
+
+#endif /* #if !UCONFIG_NO_FORMATTING */
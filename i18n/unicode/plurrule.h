@@ -45,6 +45,7 @@ U_NAMESPACE_BEGIN
 class Hashtable;
 class IFixedDecimal;
 class RuleChain;
+class PluralRuleProgram;
 class PluralRuleParser;
 class PluralKeywordEnumeration;
 class AndConstraint;
@@ -490,12 +491,14 @@ class U_I18N_API PluralRules : public UObject {
 
 private:
     RuleChain  *mRules;
+    const PluralRuleProgram *mProgram;
 
     PluralRules();   // default constructor not implemented
     void            parseDescription(const UnicodeString& ruleData, UErrorCode &status);
     int32_t         getNumberValue(const UnicodeString& token) const;
     UnicodeString   getRuleFromResource(const Locale& locale, UPluralType type, UErrorCode& status);
     RuleChain      *rulesForKeyword(const UnicodeString &keyword) const;
+    void            compileRules();
 
     /**
     * An internal status variable used to indicate that the object is in an 'invalid' state.
@@ -63,7 +63,9 @@ U_NAMESPACE_BEGIN
 
 struct Regex8BitSet;
 class  RegexCImpl;
+class  RegexDFA;
 class  RegexMatcher;
+class  RegexMatchResult;
 class  RegexPattern;
 struct REStackFrame;
 class  RuleBasedBreakIterator;
@@ -320,6 +322,47 @@ class U_I18N_API RegexPattern U_FINAL : public UObject {
         uint32_t             flags,
         UErrorCode           &status);
 
+#ifndef U_HIDE_DRAFT_API
+   /**
+    * Creates a RegexPattern from the binary form of a compiled pattern that was
+    * written by <code>toBinary()</code>, without compiling the regular expression again.
+    * This is much faster than <code>compile()</code>, for applications that load many
+    * patterns at startup, for example from a memory-mapped file.
+    *
+    * <p>The binary form must have been written by the same version of ICU, on
+    * a platform with the same endianness. Other data is rejected with
+    * U_INVALID_FORMAT_ERROR. Only the sizes of the data are checked: The binary form
+    * must come unchanged from toBinary().</p>
+    *
+    * @param data    The binary form of the pattern. It need not be aligned,
+    *                and is not used after this function returns.
+    * @param length  The length of the data in bytes. It can be longer than the
+    *                binary form of the pattern.
+    * @param status  A reference to a UErrorCode to receive any errors.
+    * @return        A RegexPattern object for the pattern; the caller owns it.
+    *
+    * @draft ICU 64
+    */
+    static RegexPattern * U_EXPORT2 createFromBinary(const void *data, int32_t length,
+                                                     UErrorCode &status);
+
+   /**
+    * Writes the binary form of this compiled pattern, which
+    * <code>createFromBinary()</code> reads.
+    *
+    * @param dest      The buffer for the binary form. Can be NULL if capacity is 0.
+    * @param capacity  The capacity of the buffer in bytes.
+    * @param status    A reference to a UErrorCode to receive any errors.
+    *                  Set to U_BUFFER_OVERFLOW_ERROR if capacity is too small,
+    *                  and to U_INDEX_OUTOFBOUNDS_ERROR if one of the sets of the pattern
+    *                  has too many ranges to be serialized.
+    * @return          The length of the binary form in bytes.
+    *
+    * @draft ICU 64
+    */
+    int32_t toBinary(void *dest, int32_t capacity, UErrorCode &status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
    /**
     * Get the match mode flags that were used when compiling this pattern.
     * @return  the match mode flags
@@ -378,6 +421,44 @@ class U_I18N_API RegexPattern U_FINAL : public UObject {
     */
     virtual RegexMatcher *matcher(UErrorCode  &status) const;
 
+#ifndef U_HIDE_DRAFT_API
+   /**
+    * Finds the first match of this pattern in the input, as the first call to
+    * <code>RegexMatcher::find()</code> after a reset would, and sets the result to it.
+    * <p>
+    * The pattern is not modified, so any number of threads can match against one
+    * RegexPattern at the same time, each with a RegexMatchResult of its own.
+    * The result holds the working storage for matching, which is reused by later calls
+    * with the same pattern, so that repeated matches do not need a RegexMatcher
+    * to be created for each of them.
+    *
+    * @param input    The input string. It is not retained after the call returns.
+    * @param result   Receives the match, if there is one.
+    * @param status   A reference to a UErrorCode to receive any errors.
+    * @return         TRUE if a match was found.
+    *
+    * @draft ICU 64
+    */
+    UBool matchOnce(const UnicodeString &input, RegexMatchResult &result,
+                    UErrorCode &status) const;
+
+   /**
+    * Finds the first match of this pattern in the input, as the first call to
+    * <code>RegexMatcher::find()</code> after a reset would, and sets the result to it.
+    * Like the UnicodeString overload, safe to call from several threads at once
+    * with RegexMatchResult objects of their own.
+    *
+    * @param input    The input text. It is not retained after the call returns,
+    *                 and its iteration position is changed.
+    * @param result   Receives the match, if there is one. Its offsets are native indexes.
+    * @param status   A reference to a UErrorCode to receive any errors.
+    * @return         TRUE if a match was found.
+    *
+    * @draft ICU 64
+    */
+    UBool matchOnce(UText *input, RegexMatchResult &result, UErrorCode &status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
 
    /**
     * Test whether a string matches a regular expression.  This convenience function
@@ -624,13 +705,19 @@ class U_I18N_API RegexPattern U_FINAL : public UObject {
     UnicodeSet     *fInitialChars;
     UChar32         fInitialChar;
     Regex8BitSet   *fInitialChars8;
+    UChar           fInitialUnits[4];     // The first code units of all possible match starts,
+    int32_t         fInitialUnitsLength;  //   for find() to scan for; 0 if there are too many.
+    int32_t         fInitialStringDistance; // From the first to the last code unit of the
+                                          //   literal string that begins all matches, or 0.
     UBool           fNeedsAltInput;
+    UBool           fUseDFA;       // find() can use a RegexDFA to skip input that has no matches.
 
     UHashtable     *fNamedCaptureMap;  // Map from capture group names to numbers.
 
     friend class RegexCompile;
     friend class RegexMatcher;
     friend class RegexCImpl;
+    friend class RegexDFA;
 
     //
     //  Implementation Methods
@@ -1668,6 +1755,48 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
     */
     virtual int32_t  getStackLimit() const;
 
+#ifndef U_HIDE_DRAFT_API
+  /**
+    *  Use caller-provided memory, instead of the heap, for the match backtracking stack.
+    *  The matcher is also reset, discarding any results from previous matches.
+    *  <p>
+    *  The arena both holds the stack and limits its size: a match that needs more
+    *  backtracking state than fits results in a U_REGEX_STACK_OVERFLOW error.
+    *  Together with reusing the matcher for many inputs, this lets loops of
+    *  find(), matches() and lookingAt() run without heap allocation once the
+    *  matcher has been warmed up; see getHeapAllocationCount().
+    *  <p>
+    *  getStackLimit() returns the arena capacity while an arena is in use.
+    *  A call to setStackLimit(), or to this function with a NULL arena,
+    *  returns to heap storage for the stack.
+    *  <p>
+    *  @param arena     The memory for the stack, aligned for int64_t values.
+    *                   It must remain valid, and must not be used by anything else,
+    *                   while the matcher uses it.  NULL to return to heap storage.
+    *  @param capacity  The size of the arena, in bytes. It must be large enough
+    *                   for at least one backtracking frame of the pattern.
+    *  @param status    A reference to a UErrorCode to receive any errors.
+    *                   U_ILLEGAL_ARGUMENT_ERROR if the arena is misaligned or too small.
+    *
+    *  @draft ICU 64
+    */
+    virtual void setStackArena(void *arena, int32_t capacity, UErrorCode &status);
+
+  /**
+    *  Returns the number of heap allocations that matching operations of this
+    *  matcher have made since it was created: growing the backtracking stack,
+    *  building states of the automaton that find() uses for simple patterns, and
+    *  creating the break iterator for Unicode word boundaries (UREGEX_UWORD).
+    *  <p>
+    *  A value that does not change across repeated matching operations confirms
+    *  that they run without heap allocation.
+    *
+    *  @return the number of heap allocations made by matching operations.
+    *  @draft ICU 64
+    */
+    virtual int32_t getHeapAllocationCount() const;
+#endif  /* U_HIDE_DRAFT_API */
+
 
   /**
     * Set a callback function for use with this Matcher.
@@ -1794,8 +1923,14 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
     int64_t              appendGroup(int32_t groupNum, UText *dest, UErrorCode &status) const;
     
     UBool                findUsingChunk(UErrorCode &status);
+    // Return TRUE if the pattern's DFA shows that no match starts at or after startPos.
+    UBool                noMatchUsingDFA(int64_t startPos, UErrorCode &status);
+    void                 skipToInitialUnit(int64_t limit);
     void                 MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &status);
     UBool                isChunkWordBoundary(int32_t pos);
+    UBool                isUTF8WordBoundary(int64_t pos);
+    UBool                findUsingUTF8(UErrorCode &status);
+    void                 MatchUTF8At(int64_t startIdx, UBool toEnd, UErrorCode &status);
 
     const RegexPattern  *fPattern;
     RegexPattern        *fPatternOwned;    // Non-NULL if this matcher owns the pattern, and
@@ -1806,6 +1941,8 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
     UText               *fAltInputText;    // A shallow copy of the text being matched.
                                            //   Only created if the pattern contains backreferences.
     int64_t              fInputLength;     // Full length of the input text.
+    const uint8_t       *fInputUTF8;       // The bytes of fInputText if it is a UTF-8 UText
+                                           //   from utext_openUTF8(), otherwise NULL.
     int32_t              fFrameSize;       // The size of a frame in the backtrack stack.
     
     int64_t              fRegionStart;     // Start of the input region, default = 0.
@@ -1861,6 +1998,10 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
     int32_t             fStackLimit;       // Maximum memory size to use for the backtrack
                                            //   stack, in bytes.  Zero for unlimited.
 
+    UBool               fStackArena;       // fStack uses caller-provided memory, of fStackLimit bytes.
+
+    int32_t             fAllocationCount;  // Heap allocations by matching, other than for fStack.
+
     URegexMatchCallback *fCallbackFn;       // Pointer to match progress callback funct.
                                            //   NULL if there is no callback.
     const void         *fCallbackContext;  // User Context ptr for callback function.
@@ -1878,7 +2019,117 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
                                            //   reported, or that permanently disables this matcher.
 
     RuleBasedBreakIterator  *fWordBreakItr;
+
+    RegexDFA            *fDFA;             // Created on the first find() if the pattern allows it.
+};
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Class <code>RegexMatchResult</code> receives the result of
+ * <code>RegexPattern::matchOnce()</code>: whether there was a match, and the
+ * offsets of the match and of its capture groups in the input.
+ *
+ * <p>A RegexMatchResult also keeps the working storage used for matching, and reuses it
+ * when it is passed to matchOnce() again with the same pattern. It is not thread safe;
+ * each thread should use a RegexMatchResult of its own, while sharing the RegexPattern.
+ * Note that a RegexPattern object must not be deleted while a RegexMatchResult
+ * that was last used with it still exists and might possibly be used again.</p>
+ *
+ * @draft ICU 64
+ */
+class U_I18N_API RegexMatchResult U_FINAL : public UObject {
+public:
+    /**
+     * Constructs an empty result, with no match.
+     * @draft ICU 64
+     */
+    RegexMatchResult();
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    virtual ~RegexMatchResult();
+
+    /**
+     * Returns TRUE if the last call to <code>RegexPattern::matchOnce()</code>
+     * with this result found a match.
+     * @draft ICU 64
+     */
+    UBool isMatch() const;
+
+    /**
+     * Returns the number of capture groups in the pattern of the last match,
+     * or 0 if there is no match.
+     * @draft ICU 64
+     */
+    int32_t groupCount() const;
+
+    /**
+     * Returns the index in the input of the start of a capture group of the match.
+     * Group 0 is the whole match.
+     *
+     * @param group   The capture group number.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     *                U_REGEX_INVALID_STATE if there is no match,
+     *                U_INDEX_OUTOFBOUNDS_ERROR for a bad capture group number.
+     * @return        The start index, or -1 if the group did not take part in the match.
+     * @draft ICU 64
+     */
+    int32_t start(int32_t group, UErrorCode &status) const;
+
+    /**
+     * Returns the index in the input of the start of a capture group of the match,
+     * as a 64 bit native index.
+     * @see start
+     * @draft ICU 64
+     */
+    int64_t start64(int32_t group, UErrorCode &status) const;
+
+    /**
+     * Returns the index in the input following the end of a capture group of the match.
+     * Group 0 is the whole match.
+     *
+     * @param group   The capture group number.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     *                U_REGEX_INVALID_STATE if there is no match,
+     *                U_INDEX_OUTOFBOUNDS_ERROR for a bad capture group number.
+     * @return        The end index, or -1 if the group did not take part in the match.
+     * @draft ICU 64
+     */
+    int32_t end(int32_t group, UErrorCode &status) const;
+
+    /**
+     * Returns the index in the input following the end of a capture group of the match,
+     * as a 64 bit native index.
+     * @see end
+     * @draft ICU 64
+     */
+    int64_t end64(int32_t group, UErrorCode &status) const;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for the actual class.
+     * @draft ICU 64
+     */
+    virtual UClassID getDynamicClassID() const;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for this class.
+     * @draft ICU 64
+     */
+    static UClassID U_EXPORT2 getStaticClassID();
+
+private:
+    RegexMatchResult(const RegexMatchResult &other); // forbid copying of this class
+    RegexMatchResult &operator=(const RegexMatchResult &other); // forbid copying of this class
+
+    friend class RegexPattern;
+
+    RegexMatcher *fMatcher;     // The working storage: a matcher for the pattern of
+                                //   the last match, owned, or NULL.
+    UBool         fIsMatch;
 };
+#endif  /* U_HIDE_DRAFT_API */
 
 U_NAMESPACE_END
 #endif  // UCONFIG_NO_REGULAR_EXPRESSIONS
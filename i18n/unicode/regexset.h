@@ -0,0 +1,183 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+**********************************************************************
+*   file name:  regexset.h
+*   encoding:   UTF-8
+*   indentation:4
+*
+*   created on: 2026oct14
+*
+*   ICU Regular Expressions, matching a set of patterns at once
+*/
+
+#ifndef REGEXSET_H
+#define REGEXSET_H
+
+/**
+ * \file
+ * \brief  C++ API:  Sets of Regular Expressions
+ *
+ * <p>Class <code>RegexSet</code> holds a number of regular expressions and
+ *  determines which of them have a match in an input text, scanning the
+ *  input once rather than once per pattern.</p>
+ */
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/uobject.h"
+#include "unicode/unistr.h"
+#include "unicode/utext.h"
+#include "unicode/parseerr.h"
+#include "unicode/regex.h"
+
+#ifndef U_HIDE_DRAFT_API
+
+U_NAMESPACE_BEGIN
+
+class RegexDFA;
+class UVector;
+class UVector32;
+
+/**
+ * Class <code>RegexSet</code> matches an input text against a collection of
+ * regular expressions and reports which of the patterns match.
+ *
+ * <p>The result for each pattern is the same as whether
+ * <code>RegexMatcher::find()</code> would find a match for it in the whole input.
+ * Patterns without back references, look-around assertions, anchors, word boundaries,
+ * atomic or possessive groups, bounded repetition counts and case-insensitive
+ * literal strings are combined into one automaton that is built while the input is scanned,
+ * so that the input is scanned once for all of them. Other patterns, and all patterns
+ * when the automaton would grow too large, are matched one at a time with a
+ * <code>RegexMatcher</code>.</p>
+ *
+ * <p>A RegexSet is not thread safe: Like a <code>RegexMatcher</code>, it keeps state
+ * between calls to find(). Each thread should use a RegexSet of its own.</p>
+ *
+ * @draft ICU 64
+ */
+class U_I18N_API RegexSet U_FINAL : public UObject {
+public:
+
+    /**
+     * Constructs an empty set of patterns.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     * @draft ICU 64
+     */
+    RegexSet(UErrorCode &status);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    virtual ~RegexSet();
+
+    /**
+     * Compiles a regular expression and adds it to the set.
+     *
+     * @param regex   The regular expression to be compiled.
+     * @param flags   The <code>URegexpFlag</code> match mode flags to be used,
+     *                as for <code>RegexPattern::compile()</code>.
+     * @param pe      Receives the position (line and column numbers) of any syntax
+     *                error within the regular expression.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     * @return        The index of the new pattern in the set, or -1 if an error occurred.
+     * @draft ICU 64
+     */
+    int32_t add(const UnicodeString &regex, uint32_t flags, UParseError &pe,
+                UErrorCode &status);
+
+    /**
+     * Compiles a regular expression and adds it to the set.
+     *
+     * @param regex   The regular expression to be compiled.
+     * @param flags   The <code>URegexpFlag</code> match mode flags to be used,
+     *                as for <code>RegexPattern::compile()</code>.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     * @return        The index of the new pattern in the set, or -1 if an error occurred.
+     * @draft ICU 64
+     */
+    int32_t add(const UnicodeString &regex, uint32_t flags, UErrorCode &status);
+
+    /**
+     * Returns the number of patterns in the set.
+     * @return the number of patterns
+     * @draft ICU 64
+     */
+    int32_t size() const;
+
+    /**
+     * Returns the compiled pattern at an index.
+     * @param index  The index of the pattern, from 0 to size()-1.
+     * @return the pattern, owned by the set
+     * @draft ICU 64
+     */
+    const RegexPattern &getPattern(int32_t index) const;
+
+    /**
+     * Finds the patterns that have a match anywhere in the input text.
+     * Their indexes are written to dest in ascending order.
+     *
+     * @param input        The input text.
+     * @param dest         Receives the indexes of the matching patterns.
+     *                     Can be NULL if destCapacity is 0.
+     * @param destCapacity The capacity of dest.
+     * @param status       A reference to a UErrorCode to receive any errors.
+     *                     Set to U_BUFFER_OVERFLOW_ERROR if there are more
+     *                     matching patterns than destCapacity.
+     * @return The number of matching patterns.
+     * @draft ICU 64
+     */
+    int32_t find(const UnicodeString &input, int32_t *dest, int32_t destCapacity,
+                 UErrorCode &status);
+
+    /**
+     * Finds the patterns that have a match anywhere in the input text.
+     * Their indexes are written to dest in ascending order.
+     *
+     * @param input        The input text. Its iteration position is changed.
+     * @param dest         Receives the indexes of the matching patterns.
+     *                     Can be NULL if destCapacity is 0.
+     * @param destCapacity The capacity of dest.
+     * @param status       A reference to a UErrorCode to receive any errors.
+     *                     Set to U_BUFFER_OVERFLOW_ERROR if there are more
+     *                     matching patterns than destCapacity.
+     * @return The number of matching patterns.
+     * @draft ICU 64
+     */
+    int32_t find(UText *input, int32_t *dest, int32_t destCapacity, UErrorCode &status);
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for the actual class.
+     * @draft ICU 64
+     */
+    virtual UClassID getDynamicClassID() const;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for this class.
+     * @draft ICU 64
+     */
+    static UClassID U_EXPORT2 getStaticClassID();
+
+private:
+    RegexSet(const RegexSet &other); // forbid copying of this class
+    RegexSet &operator=(const RegexSet &other); // forbid copying of this class
+
+    RegexMatcher *getMatcher(int32_t index, UErrorCode &status);
+
+    UVector    *fPatterns;      // The RegexPatterns, owned.
+    UVector    *fMatchers;      // A RegexMatcher for each pattern, owned, or NULL
+                                //   until the pattern has to be matched on its own.
+    UVector32  *fDFAPatterns;   // The indexes of the patterns that fDFA combines.
+    RegexDFA   *fDFA;           // Created by find(), for the patterns that it supports.
+    UBool       fDFAFailed;     // The DFA for these patterns grew too large before.
+};
+
+U_NAMESPACE_END
+
+#endif  // U_HIDE_DRAFT_API
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
+#endif  // REGEXSET_H
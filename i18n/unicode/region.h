@@ -180,6 +180,42 @@ class U_I18N_API Region : public UObject {
      */
     URegionType getType() const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Returns this region's index, a small non-negative integer that identifies the region
+     * and is less than getIndexLimit(). Each Region object has its own index, including
+     * deprecated regions. Indexes are assigned when the region data is loaded; they may differ
+     * between ICU versions and should not be persisted.
+     * @draft ICU 64
+     */
+    int32_t getIndex() const;
+
+    /**
+     * Returns one more than the highest region index.
+     * @param status  ICU error code
+     * @return the number of regions, or 0 if the region data cannot be loaded
+     * @draft ICU 64
+     */
+    static int32_t U_EXPORT2 getIndexLimit(UErrorCode &status);
+
+    /**
+     * Returns a pointer to the region with the given index.
+     * If the index is not less than getIndexLimit(), U_ILLEGAL_ARGUMENT_ERROR is set.
+     * @draft ICU 64
+     */
+    static const Region* U_EXPORT2 getInstanceByIndex(int32_t index, UErrorCode &status);
+
+    /**
+     * Returns true if the region with index containerIndex contains the region with index
+     * regionIndex anywhere in the region hierarchy; same as contains() on the Region objects.
+     * Takes constant time and does not allocate memory.
+     * Returns false if either index is out of range.
+     * @see getIndex
+     * @draft ICU 64
+     */
+    static UBool U_EXPORT2 containsIndex(int32_t containerIndex, int32_t regionIndex);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
     /**
      * Cleans up statically allocated memory.
@@ -196,12 +232,18 @@ class U_I18N_API Region : public UObject {
     Region *containingRegion;
     UVector *containedRegions;
     UVector *preferredValues;
+    int32_t fIndex;
 
     /**
      * Default Constructor. Internal - use factory methods only.
      */
     Region();
 
+    /**
+     * Appends the idStr of each region below this one that has the given type,
+     * without descending into the matching regions. Implements getContainedRegions(type).
+     */
+    void appendContainedRegions(URegionType type, UVector &result, UErrorCode &status) const;
 
     /*
      * Initializes the region data from the ICU resource bundles.  The region data
@@ -521,6 +521,11 @@ class U_I18N_API RelativeDateTimeFormatter : public UObject {
             BreakIterator *brkIter,
             UErrorCode &status);
     void adjustForContext(UnicodeString &) const;
+    UBool formatIntegerFast(
+            double quantity,
+            URelativeDateTimeUnit unit,
+            int32_t bFuture,
+            UnicodeString &appendTo) const;
 };
 
 U_NAMESPACE_END
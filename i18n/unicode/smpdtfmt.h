@@ -49,6 +49,7 @@ class FieldPositionHandler;
 class TimeZoneFormat;
 class SharedNumberFormat;
 class SimpleDateFormatMutableNFs;
+struct GregorianFields;
 
 namespace number {
 class LocalizedNumberFormatter;
@@ -1249,6 +1250,60 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
      */
     UnicodeString& _format(Calendar& cal, UnicodeString& appendTo, FieldPositionHandler& handler, UErrorCode& status) const;
 
+    /**
+     * Used by DateFormat::format(UDate ...) to decide whether it can call formatGregorian()
+     * instead of formatting a Calendar clone:
+     * TRUE if the calendar is a GregorianCalendar, the date is well after its Gregorian cutover,
+     * and the pattern has only fields that GregorianFields supports.
+     */
+    UBool canFormatGregorian(UDate date) const;
+
+    /**
+     * Hook called by DateFormat::format(UDate ...) if canFormatGregorian(date):
+     * Formats the date from its GregorianFields, without a Calendar.
+     */
+    void formatGregorian(UDate date, UnicodeString& appendTo, FieldPositionHandler& handler, UErrorCode& status) const;
+
+    /**
+     * Formats the ops of fCompiledPattern, which must not be bogus,
+     * from index start to index limit.
+     * The other parameters are as for subFormat().
+     * @return the fieldNum after the last field that was formatted
+     */
+    int32_t formatCompiledPattern(int32_t start, int32_t limit, int32_t fieldNum,
+                                  UnicodeString &appendTo,
+                                  UDisplayContext capitalizationContext,
+                                  FieldPositionHandler& handler,
+                                  Calendar& cal,
+                                  const GregorianFields* gregorianFields,
+                                  UErrorCode& status) const;
+
+    /**
+     * Hook called by DateFormat::formatBatch().
+     */
+    void _formatBatch(const UDate* dates, int32_t count, UnicodeString& appendTo,
+                      int32_t* offsets, UErrorCode& status) const;
+
+    /**
+     * Parses text in the format of a fixed numeric pattern (see fIsFixedNumericPattern)
+     * with a digit scanner, and computes the date in one step, as for a cleared calendar.
+     * Used by DateFormat::parse(const UnicodeString&, ParsePosition&) and by
+     * parse(const UnicodeString&, Calendar&, ParsePosition&).
+     *
+     * @param text      The text to be parsed.
+     * @param parsePos  The position to start parsing at; set to the end of the
+     *                  parsed text if this function returns TRUE.
+     * @param cal       Supplies the time zone and its options for a pattern
+     *                  without a zone offset field; its fields are ignored.
+     * @param date      Receives the parsed date.
+     * @param zoneOffset Receives the parsed zone offset in milliseconds if hasZoneOffset.
+     * @param hasZoneOffset Receives TRUE if the pattern has a zone offset field.
+     * @return TRUE if the text was parsed; FALSE if the general parser must be used,
+     *         which also handles any error.
+     */
+    UBool parseFixedNumeric(const UnicodeString& text, ParsePosition& parsePos, const Calendar& cal,
+                            UDate& date, int32_t& zoneOffset, UBool& hasZoneOffset) const;
+
     /**
      * Called by format() to format a single field.
      *
@@ -1262,6 +1317,8 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
      * @param fieldNum  Zero-based numbering of current field within the overall format.
      * @param handler   Records information about field positions.
      * @param cal       Calendar to use
+     * @param gregorianFields If not NULL, the field values to use instead of those of cal;
+     *                  cal then only supplies the calendar type, field limits and time zone.
      * @param status    Receives a status code, which will be U_ZERO_ERROR if the operation
      *                  succeeds.
      */
@@ -1272,6 +1329,7 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
                    int32_t fieldNum,
                    FieldPositionHandler& handler,
                    Calendar& cal,
+                   const GregorianFields* gregorianFields,
                    UErrorCode& status) const; // in case of illegal argument
 
     /**
@@ -1599,7 +1657,28 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
     UBool                fHasSecond;
 
     /**
-     * Sets fHasMinutes and fHasSeconds.
+     * TRUE if all of the pattern fields can be formatted from GregorianFields.
+     */
+    UBool                fHasOnlyGregorianFields = FALSE;
+
+    /**
+     * fPattern compiled by parsePattern(), so that format() need not rescan it:
+     * a sequence of ops, each either a pattern character followed by its repeat count,
+     * or 0 followed by a length and that many characters of literal text.
+     * Bogus if the pattern could not be compiled; format() then interprets fPattern.
+     */
+    UnicodeString        fCompiledPattern;
+
+    /**
+     * TRUE if fCompiledPattern has only fixed-width numeric fields yyyy, MM, dd, HH, mm, ss, S..S,
+     * and ISO zone offsets XX, XXX, xx, xxx, each at most once and with at least the date fields,
+     * so that parseFixedNumeric() can handle it.
+     */
+    UBool                fIsFixedNumericPattern = FALSE;
+
+    /**
+     * Sets fHasMinutes, fHasSeconds, fHasOnlyGregorianFields, fCompiledPattern
+     * and fIsFixedNumericPattern.
      */
     void                 parsePattern();
 
@@ -1638,6 +1717,12 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
      */
     const number::LocalizedNumberFormatter* fFastNumberFormatters[SMPDTFMT_NF_COUNT] = {};
 
+    /**
+     * The zero digit of fNumberFormat if its numeric fields are plain zero-padded digits,
+     * which zeroPaddingNumber() then writes itself; otherwise -1.
+     */
+    UChar32 fFastZeroDigit = -1;
+
     UBool fHaveDefaultCentury;
 
     BreakIterator* fCapitalizationBrkIter;
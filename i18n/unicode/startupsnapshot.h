@@ -0,0 +1,293 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+**********************************************************************
+*   file name:  startupsnapshot.h
+*   encoding:   UTF-8
+*   indentation:4
+*
+*   created on: 2026oct14
+*
+*   Snapshots of service objects, for restoring them at startup
+*/
+
+#ifndef STARTUPSNAPSHOT_H
+#define STARTUPSNAPSHOT_H
+
+/**
+ * \file
+ * \brief  C++ API: Snapshots of service objects
+ *
+ * <p>Class <code>StartupSnapshotBuilder</code> writes the immutable data of
+ *  collators, break iterators, number and date format symbols and plural rules
+ *  into one block of memory that can be saved to a file.
+ *  Class <code>StartupSnapshot</code> recreates the objects from such a block,
+ *  usually memory-mapped from the file by a later process,
+ *  without loading and parsing locale data.</p>
+ */
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING && !UCONFIG_NO_COLLATION && !UCONFIG_NO_BREAK_ITERATION
+
+#include "unicode/uobject.h"
+#include "unicode/udata.h"
+
+#ifndef U_HIDE_DRAFT_API
+
+U_NAMESPACE_BEGIN
+
+class BreakIterator;
+class CharString;
+class Collator;
+class DateFormatSymbols;
+class DecimalFormatSymbols;
+class PluralRules;
+class UVector32;
+
+/**
+ * Class <code>StartupSnapshotBuilder</code> collects the data of service objects
+ * and writes it in the format that <code>StartupSnapshot</code> reads.
+ *
+ * <p>Each add...() function appends one item and returns its index,
+ * which is later passed to the matching create...() function of the snapshot.</p>
+ *
+ * <p>A snapshot is only valid for the ICU version that wrote it.</p>
+ *
+ * @draft ICU 64
+ */
+class U_I18N_API StartupSnapshotBuilder U_FINAL : public UObject {
+public:
+    /**
+     * Constructs a builder without items.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     * @draft ICU 64
+     */
+    StartupSnapshotBuilder(UErrorCode &status);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    virtual ~StartupSnapshotBuilder();
+
+    /**
+     * Adds the tailoring and the attribute settings of a collator.
+     * @param collator  Must be a RuleBasedCollator; otherwise
+     *                  the status is set to U_UNSUPPORTED_ERROR.
+     * @param status    A reference to a UErrorCode to receive any errors.
+     * @return the index of the new item, or -1 if an error occurred
+     * @draft ICU 64
+     */
+    int32_t addCollator(const Collator &collator, UErrorCode &status);
+
+    /**
+     * Adds the compiled rules of a break iterator.
+     * @param bi      Must be a RuleBasedBreakIterator; otherwise
+     *                the status is set to U_UNSUPPORTED_ERROR.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     * @return the index of the new item, or -1 if an error occurred
+     * @draft ICU 64
+     */
+    int32_t addBreakIterator(const BreakIterator &bi, UErrorCode &status);
+
+    /**
+     * Adds number format symbols.
+     * @param symbols  The symbols.
+     * @param status   A reference to a UErrorCode to receive any errors.
+     * @return the index of the new item, or -1 if an error occurred
+     * @draft ICU 64
+     */
+    int32_t addDecimalFormatSymbols(const DecimalFormatSymbols &symbols, UErrorCode &status);
+
+    /**
+     * Adds date format symbols. Time zone names are not included;
+     * the restored symbols load them from locale data when they are needed,
+     * as usual.
+     * @param symbols  The symbols.
+     * @param status   A reference to a UErrorCode to receive any errors.
+     * @return the index of the new item, or -1 if an error occurred
+     * @draft ICU 64
+     */
+    int32_t addDateFormatSymbols(const DateFormatSymbols &symbols, UErrorCode &status);
+
+    /**
+     * Adds plural rules.
+     * @param rules   The rules.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     * @return the index of the new item, or -1 if an error occurred
+     * @draft ICU 64
+     */
+    int32_t addPluralRules(const PluralRules &rules, UErrorCode &status);
+
+    /**
+     * Writes the snapshot with all of the items added so far.
+     * The result starts with a standard ICU data header, with data format "Snap",
+     * so that it can be saved in a file and opened with
+     * StartupSnapshot(const char *, const char *, UErrorCode &).
+     *
+     * @param dest      Receives the snapshot. Can be NULL if capacity is 0 for preflighting.
+     * @param capacity  The capacity of dest, in bytes.
+     * @param status    A reference to a UErrorCode to receive any errors.
+     *                  Set to U_BUFFER_OVERFLOW_ERROR if the capacity is too small.
+     * @return the length of the snapshot, in bytes
+     * @draft ICU 64
+     */
+    int32_t build(uint8_t *dest, int32_t capacity, UErrorCode &status) const;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for the actual class.
+     * @draft ICU 64
+     */
+    virtual UClassID getDynamicClassID() const;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for this class.
+     * @draft ICU 64
+     */
+    static UClassID U_EXPORT2 getStaticClassID();
+
+private:
+    StartupSnapshotBuilder(const StartupSnapshotBuilder &other); // forbid copying of this class
+    StartupSnapshotBuilder &operator=(const StartupSnapshotBuilder &other); // forbid copying of this class
+
+    int32_t addItem(int32_t type, const char *bytes, int32_t length, UErrorCode &status);
+
+    UVector32  *fItems;     // Type, offset and length of each item.
+    CharString *fData;      // The items, each padded to a multiple of 16 bytes.
+};
+
+/**
+ * Class <code>StartupSnapshot</code> recreates service objects from a snapshot
+ * that was written by <code>StartupSnapshotBuilder</code>.
+ *
+ * <p>The snapshot data is not copied: Collators and break iterators that are created
+ * from it, and their clones, refer to it, so the StartupSnapshot (and the memory
+ * that it was constructed with) must outlive them. Format symbols and plural rules
+ * copy their strings and do not refer to the snapshot.</p>
+ *
+ * <p>The create...() functions are thread safe.</p>
+ *
+ * @draft ICU 64
+ */
+class U_I18N_API StartupSnapshot U_FINAL : public UObject {
+public:
+    /**
+     * Constructs a snapshot from memory, for example a mapped file.
+     * The memory must be aligned to at least 16 bytes and is not copied.
+     *
+     * @param data    The snapshot written by StartupSnapshotBuilder::build().
+     * @param length  The length of the data, in bytes.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     *                Set to U_INVALID_FORMAT_ERROR if the data is not a snapshot
+     *                for this version of ICU.
+     * @draft ICU 64
+     */
+    StartupSnapshot(const uint8_t *data, int32_t length, UErrorCode &status);
+
+    /**
+     * Constructs a snapshot from a file, which is memory-mapped where the platform supports it.
+     * The file is found like other ICU data with udata_openChoice(),
+     * with a data type of "snap".
+     *
+     * @param path    The directory of the file, or an ICU package path.
+     * @param name    The name of the file without the ".snap" suffix.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     * @draft ICU 64
+     */
+    StartupSnapshot(const char *path, const char *name, UErrorCode &status);
+
+    /**
+     * Destructor. Unmaps the file, if the snapshot was opened from a file.
+     * @draft ICU 64
+     */
+    virtual ~StartupSnapshot();
+
+    /**
+     * Returns the number of items in the snapshot.
+     * @return the number of items
+     * @draft ICU 64
+     */
+    int32_t getItemCount() const { return fItemCount; }
+
+    /**
+     * Creates a collator from an item that was added with addCollator().
+     * Its actual locale is not known.
+     * @param index   The index of the item.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     *                Set to U_ILLEGAL_ARGUMENT_ERROR if the item is not a collator.
+     * @return a new collator, to be deleted by the caller
+     * @draft ICU 64
+     */
+    Collator *createCollator(int32_t index, UErrorCode &status) const;
+
+    /**
+     * Creates a break iterator from an item that was added with addBreakIterator().
+     * @param index   The index of the item.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     *                Set to U_ILLEGAL_ARGUMENT_ERROR if the item is not a break iterator.
+     * @return a new break iterator, to be deleted by the caller
+     * @draft ICU 64
+     */
+    BreakIterator *createBreakIterator(int32_t index, UErrorCode &status) const;
+
+    /**
+     * Creates number format symbols from an item that was added with addDecimalFormatSymbols().
+     * @param index   The index of the item.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     *                Set to U_ILLEGAL_ARGUMENT_ERROR if the item is not number format symbols.
+     * @return new symbols, to be deleted by the caller
+     * @draft ICU 64
+     */
+    DecimalFormatSymbols *createDecimalFormatSymbols(int32_t index, UErrorCode &status) const;
+
+    /**
+     * Creates date format symbols from an item that was added with addDateFormatSymbols().
+     * @param index   The index of the item.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     *                Set to U_ILLEGAL_ARGUMENT_ERROR if the item is not date format symbols.
+     * @return new symbols, to be deleted by the caller
+     * @draft ICU 64
+     */
+    DateFormatSymbols *createDateFormatSymbols(int32_t index, UErrorCode &status) const;
+
+    /**
+     * Creates plural rules from an item that was added with addPluralRules().
+     * @param index   The index of the item.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     *                Set to U_ILLEGAL_ARGUMENT_ERROR if the item is not plural rules.
+     * @return new rules, to be deleted by the caller
+     * @draft ICU 64
+     */
+    PluralRules *createPluralRules(int32_t index, UErrorCode &status) const;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for the actual class.
+     * @draft ICU 64
+     */
+    virtual UClassID getDynamicClassID() const;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for this class.
+     * @draft ICU 64
+     */
+    static UClassID U_EXPORT2 getStaticClassID();
+
+private:
+    StartupSnapshot(const StartupSnapshot &other); // forbid copying of this class
+    StartupSnapshot &operator=(const StartupSnapshot &other); // forbid copying of this class
+
+    void init(const uint8_t *data, int32_t length, UErrorCode &status);
+    const uint8_t *getItem(int32_t index, int32_t type, int32_t &length, UErrorCode &status) const;
+
+    UDataMemory    *fMemory;        // The mapped file, or NULL.
+    const int32_t  *fIndexes;       // Type, offset and length of each item.
+    const uint8_t  *fData;          // The data after the header.
+    int32_t         fItemCount;
+};
+
+U_NAMESPACE_END
+
+#endif  // U_HIDE_DRAFT_API
+#endif  // !UCONFIG_NO_FORMATTING && !UCONFIG_NO_COLLATION && !UCONFIG_NO_BREAK_ITERATION
+#endif  // STARTUPSNAPSHOT_H
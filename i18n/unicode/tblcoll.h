@@ -75,6 +75,7 @@ U_NAMESPACE_BEGIN
 
 struct CollationCacheEntry;
 struct CollationData;
+class CollationScratch;
 struct CollationSettings;
 struct CollationTailoring;
 /**
@@ -382,6 +383,23 @@ class U_I18N_API RuleBasedCollator : public Collator {
                                           CollationKey& key,
                                           UErrorCode& status) const;
 
+    /**
+     * Transforms the UTF-8 string into a series of characters
+     * that can be compared with CollationKey.compare().
+     * Works directly on the UTF-8 text, without converting it to UTF-16,
+     * except for the identical level.
+     *
+     * @param source the UTF-8 source string.
+     * @param key the transformed key of the source string.
+     * @param status the error code status.
+     * @return the transformed key.
+     * @see CollationKey
+     * @draft ICU 64
+     */
+    virtual CollationKey &getCollationKeyUTF8(const StringPiece &source,
+                                              CollationKey &key,
+                                              UErrorCode &status) const;
+
     /**
      * Generates the hash code for the rule-based collation object.
      * @return the hash code.
@@ -790,6 +808,70 @@ class U_I18N_API RuleBasedCollator : public Collator {
      * @internal for tests & tools
      */
     void internalGetCEs(const UnicodeString &str, UVector64 &ces, UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_getSortKeys().
+     * @internal
+     */
+    int32_t internalGetSortKeys(const char16_t *const *sources, const int32_t *sourceLengths,
+                                int32_t count, uint8_t *dest, int32_t destCapacity,
+                                int32_t *offsets, UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_getSortKeyUTF8().
+     * @internal
+     */
+    int32_t internalGetSortKeyUTF8(const char *s, int32_t length,
+                                   uint8_t *dest, int32_t capacity) const;
+
+    /**
+     * Implements ucol_getSortKeysUTF8().
+     * @internal
+     */
+    int32_t internalGetSortKeysUTF8(const char *const *sources, const int32_t *sourceLengths,
+                                    int32_t count, uint8_t *dest, int32_t destCapacity,
+                                    int32_t *offsets, UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_strcollWithScratch().
+     * Same as compare(left, leftLength, right, rightLength, errorCode) but
+     * uses the scratch object's collation iterators and their buffers.
+     * @internal
+     */
+    UCollationResult internalCompareWithScratch(const char16_t *left, int32_t leftLength,
+                                                const char16_t *right, int32_t rightLength,
+                                                CollationScratch &scratch,
+                                                UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_getBoundedSortKey().
+     * @internal
+     */
+    int32_t internalGetBoundedSortKey(const char16_t *s, int32_t length,
+                                      uint8_t *dest, int32_t maxLength,
+                                      UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_getSortKeyPrefix().
+     * @internal
+     */
+    int32_t internalGetSortKeyPrefix(const char16_t *s, int32_t length,
+                                     uint8_t *dest, int32_t prefixLength,
+                                     UErrorCode &errorCode) const;
+
+    /**
+     * Returns the string's first two primary weights as they are compared
+     * at the primary level: Without variable weights if they are shifted,
+     * and with script reordering.
+     * The first weight is in the upper 32 bits, and missing weights are 0,
+     * so that comparing the results of two strings yields their primary-level order,
+     * unless both strings have the same two primary weights.
+     * Used for AlphabeticIndex bucketing.
+     * @param isComplete set to TRUE if the string has no further primary weights
+     * @internal
+     */
+    uint64_t internalGetPrimaryPrefix(const char16_t *s, int32_t length,
+                                      UBool &isComplete, UErrorCode &errorCode) const;
 #endif  // U_HIDE_INTERNAL_API
 
 protected:
@@ -821,18 +903,24 @@ class U_I18N_API RuleBasedCollator : public Collator {
     void adoptTailoring(CollationTailoring *t, UErrorCode &errorCode);
 
     // Both lengths must be <0 or else both must be >=0.
+    // scratch can be NULL.
     UCollationResult doCompare(const char16_t *left, int32_t leftLength,
                                const char16_t *right, int32_t rightLength,
-                               UErrorCode &errorCode) const;
+                               CollationScratch *scratch, UErrorCode &errorCode) const;
     UCollationResult doCompare(const uint8_t *left, int32_t leftLength,
                                const uint8_t *right, int32_t rightLength,
                                UErrorCode &errorCode) const;
 
     void writeSortKey(const char16_t *s, int32_t length,
                       SortKeyByteSink &sink, UErrorCode &errorCode) const;
+    void writeSortKeyUTF8(const char *s, int32_t length,
+                          SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
     void writeIdenticalLevel(const char16_t *s, const char16_t *limit,
                              SortKeyByteSink &sink, UErrorCode &errorCode) const;
+    // Converts the UTF-8 string into s16 for writeIdenticalLevel().
+    void writeIdenticalLevelUTF8(const char *s, int32_t length, UnicodeString &s16,
+                                 SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
     const CollationSettings &getDefaultSettings() const;
 
@@ -618,6 +618,25 @@ class U_I18N_API TimeZoneFormat : public Format {
     TimeZone* parse(UTimeZoneFormatStyle style, const UnicodeString& text, ParsePosition& pos,
         UTimeZoneFormatTimeType* timeType = NULL) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Loads all of the time zone display names of this object's locale
+     * and prepares them for parsing.
+     * Otherwise this happens on the first parse that needs the names,
+     * which can take a long time and blocks other threads that parse time zone names.
+     * Once the names are prepared, many threads can parse them at the same time without
+     * waiting for each other.
+     *
+     * The prepared names are shared with the other <code>TimeZoneFormat</code> and
+     * <code>SimpleDateFormat</code> objects for the same locale.
+     * They stay loaded at least while this object exists.
+     *
+     * @param status Output param filled with success/failure status.
+     * @draft ICU 64
+     */
+    void preload(UErrorCode& status) const;
+#endif  // U_HIDE_DRAFT_API
+
     /* ----------------------------------------------
      * Format APIs
      * ---------------------------------------------- */
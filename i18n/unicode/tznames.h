@@ -300,6 +300,13 @@ class U_I18N_API TimeZoneNames : public UObject {
      */
     virtual void getDisplayNames(const UnicodeString& tzID, const UTimeZoneNameType types[], int32_t numTypes, UDate date, UnicodeString dest[], UErrorCode& status) const;
 
+    /**
+     * Loads all display names and prepares the data structures for find(),
+     * so that later calls to find() do not load data, and can run on many threads without locking.
+     * @internal ICU internal only, for specific users only until proposed publicly.
+     */
+    virtual void prepareFind(UErrorCode& status);
+
     /**
      * <code>MatchInfoCollection</code> represents a collection of time zone name matches used by
      * {@link TimeZoneNames#find}.
@@ -590,6 +590,82 @@ ucol_strcollUTF8(
         int32_t         targetLength,
         UErrorCode      *status);
 
+#ifndef U_HIDE_DRAFT_API
+
+struct UCollatorScratch;
+/**
+ * Opaque scratch space for ucol_strcollWithScratch().
+ * @draft ICU 64
+ */
+typedef struct UCollatorScratch UCollatorScratch;
+
+/**
+ * Opens scratch space for ucol_strcollWithScratch().
+ * A scratch object can be used with any collator, but it is most effective
+ * when it is used for many comparisons with the same one.
+ * It must not be used in several threads at the same time.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return the scratch object, or NULL if an error occurred
+ * @see ucol_strcollWithScratch
+ * @draft ICU 64
+ */
+U_DRAFT UCollatorScratch * U_EXPORT2
+ucol_openScratch(UErrorCode *status);
+
+/**
+ * Closes scratch space that was opened with ucol_openScratch().
+ * @param scratch the scratch object; can be NULL
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucol_closeScratch(UCollatorScratch *scratch);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUCollatorScratchPointer
+ * "Smart pointer" class, closes a UCollatorScratch via ucol_closeScratch().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 64
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUCollatorScratchPointer, UCollatorScratch, ucol_closeScratch);
+
+U_NAMESPACE_END
+
+#endif
+
+/**
+ * Compares two strings like ucol_strcoll(), reusing the buffers in the scratch object.
+ * The collation iterators that ucol_strcoll() sets up for each comparison
+ * allocate memory for long strings, long expansions and unnormalized text.
+ * With a scratch object that is reused, for example for all comparisons
+ * while sorting, these buffers keep their capacity,
+ * so that the comparisons normally do not allocate memory.
+ * @param coll The UCollator containing the comparison rules.
+ * @param scratch Scratch space from ucol_openScratch().
+ * @param source The source string.
+ * @param sourceLength The length of source, or -1 if NUL-terminated.
+ * @param target The target string.
+ * @param targetLength The length of target, or -1 if NUL-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The result of comparing the strings; one of UCOL_EQUAL,
+ *         UCOL_GREATER, UCOL_LESS
+ * @see ucol_strcoll
+ * @draft ICU 64
+ */
+U_DRAFT UCollationResult U_EXPORT2
+ucol_strcollWithScratch(const UCollator *coll, UCollatorScratch *scratch,
+                        const UChar *source, int32_t sourceLength,
+                        const UChar *target, int32_t targetLength,
+                        UErrorCode *status);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Determine if one string is greater than another.
  * This function is equivalent to {@link #ucol_strcoll } == UCOL_GREATER
@@ -1020,6 +1096,192 @@ ucol_getSortKey(const    UCollator    *coll,
         int32_t        resultLength);
 
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Get a sort key for a UTF-8 string from a UCollator.
+ * Same as ucol_getSortKey() for the equivalent UTF-16 string,
+ * but the key is computed directly from the UTF-8 text.
+ * Ill-formed UTF-8 sequences are treated like U+FFFD.
+ * @param coll The UCollator containing the collation rules.
+ * @param source The UTF-8 string to transform.
+ * @param sourceLength The length of source, or -1 if NUL-terminated.
+ * @param result A pointer to a buffer to receive the sort key.
+ * @param resultLength The maximum size of result.
+ * @return The size needed to fully store the sort key.
+ *      If there was an internal error generating the sort key,
+ *      a zero value is returned.
+ * @see ucol_getSortKey
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getSortKeyUTF8(const UCollator *coll,
+                    const char *source, int32_t sourceLength,
+                    uint8_t *result, int32_t resultLength);
+
+/**
+ * Gets the sort keys for an array of strings, written one after another
+ * into one buffer. Each sort key is the same as the one returned by
+ * ucol_getSortKey() for the string, including its terminating zero byte,
+ * but the setup for key generation is done once for the whole array
+ * and no memory is allocated per key.
+ *
+ * The sort key for sources[i] starts at dest+offsets[i] and has length
+ * offsets[i+1]-offsets[i].
+ * If the keys do not fit into destCapacity bytes, then
+ * the function sets U_BUFFER_OVERFLOW_ERROR and the buffer contents is undefined,
+ * but the offsets and the return value are still set,
+ * so that the caller can allocate a large enough buffer and call the function again.
+ * @param coll The UCollator containing the collation rules.
+ * @param sources An array of count strings.
+ *        A string may be NULL if its length is 0.
+ * @param sourceLengths An array of count lengths, where -1 means that the string
+ *        is NUL-terminated; or NULL if all strings are NUL-terminated.
+ * @param count The number of strings, must be >=0.
+ * @param dest A buffer to receive the sort keys. Can be NULL if destCapacity==0.
+ * @param destCapacity The size of the dest buffer, in bytes.
+ * @param offsets An array with room for count+1 offsets into dest.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The total length of all of the sort keys.
+ * @see ucol_getSortKey
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const *sources, const int32_t *sourceLengths, int32_t count,
+                 uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                 UErrorCode *status);
+
+/**
+ * Gets the sort keys for an array of UTF-8 strings, written one after another
+ * into one buffer. Same as ucol_getSortKeys() except that the strings are in UTF-8.
+ * Ill-formed UTF-8 sequences are treated like U+FFFD.
+ * @param coll The UCollator containing the collation rules.
+ * @param sources An array of count UTF-8 strings.
+ *        A string may be NULL if its length is 0.
+ * @param sourceLengths An array of count lengths, where -1 means that the string
+ *        is NUL-terminated; or NULL if all strings are NUL-terminated.
+ * @param count The number of strings, must be >=0.
+ * @param dest A buffer to receive the sort keys. Can be NULL if destCapacity==0.
+ * @param destCapacity The size of the dest buffer, in bytes.
+ * @param offsets An array with room for count+1 offsets into dest.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The total length of all of the sort keys.
+ * @see ucol_getSortKeys
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getSortKeysUTF8(const UCollator *coll,
+                     const char *const *sources, const int32_t *sourceLengths, int32_t count,
+                     uint8_t *dest, int32_t destCapacity, int32_t *offsets,
+                     UErrorCode *status);
+
+/**
+ * Sorts an array of strings according to the collator.
+ * The result is the same as for a stable sort with ucol_strcoll() as the comparison
+ * function, but the sort key for each string is computed only once
+ * and the keys are sorted, which is much faster for large arrays.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param strings An array of count strings. The pointers are sorted in place.
+ *        A string may be NULL if its length is 0.
+ * @param lengths An array of count lengths, where -1 means that the string
+ *        is NUL-terminated; or NULL if all strings are NUL-terminated.
+ *        If not NULL, the lengths are rearranged together with the strings.
+ * @param count The number of strings, must be >=0.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @see ucol_getSortKeys
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar **strings, int32_t *lengths, int32_t count,
+                 UErrorCode *status);
+
+/**
+ * Writes a fixed-width prefix of the sort key for the string.
+ * The prefix consists of the first prefixLength bytes of the sort key
+ * that ucol_getSortKey() returns, without its terminating zero byte,
+ * padded with zero bytes if the key is shorter.
+ * Only as much of the sort key is computed as is needed for the prefix,
+ * which makes this much faster than ucol_getSortKey() for long strings.
+ *
+ * Prefixes preserve the order of the strings: If ucol_strcoll(a, b) is UCOL_LESS,
+ * then the prefix for a compares less than or equal to the prefix for b
+ * with memcmp(). They are equal only if the keys share their first prefixLength bytes;
+ * strings with equal prefixes need to be compared with ucol_strcoll() or their full sort keys,
+ * unless the prefixes are complete (see the return value).
+ * For prefixLength 8 or 16, the prefixes read as big-endian unsigned integers
+ * of that size compare the same way.
+ *
+ * This makes it possible to store sort key prefixes on disk as an index
+ * that can be memory-mapped and binary-searched without any parsing:
+ * An array of fixed-size records, each starting with the prefixLength bytes,
+ * sorted by memcmp() of those bytes.
+ * Sort keys change with the collator's version and attribute settings.
+ * Such an index should therefore also record ucol_getVersion() and the settings
+ * (for example, with the result of ucol_cloneBinary()) and be rebuilt when they differ.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param source The string to transform.
+ * @param sourceLength The length of source, or -1 if NUL-terminated.
+ * @param dest Buffer for the prefix; must have room for prefixLength bytes.
+ * @param prefixLength The number of prefix bytes to write, must be >0.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The number of sort key bytes in the prefix, not counting the padding.
+ *         If this is less than prefixLength, then the prefix contains the complete sort key,
+ *         and equal complete prefixes mean that the strings compare equal.
+ * @see ucol_getSortKey
+ * @see ucol_nextSortKeyPart
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getSortKeyPrefix(const UCollator *coll,
+                      const UChar *source, int32_t sourceLength,
+                      uint8_t *dest, int32_t prefixLength,
+                      UErrorCode *status);
+
+/**
+ * Writes a sort key that is at most maxLength bytes long,
+ * for storage in database key columns with a limited length.
+ * If the complete sort key that ucol_getSortKey() returns fits,
+ * including its terminating zero byte, then that is returned.
+ * Otherwise the key is bounded to its first maxLength bytes.
+ * The levels of a sort key are already in the order of significance:
+ * All primary weights first, then the compressed secondary and tertiary levels, and so on.
+ * The bounded key thus keeps as many lower-level weights as fit after the primary weights,
+ * which is the best order-preserving key of that length.
+ * Only as much of the sort key is computed as is needed,
+ * and the result is well-defined even when the complete key would be longer.
+ *
+ * Bounded keys preserve the order of the strings: If ucol_strcoll(a, b) is UCOL_LESS,
+ * then the bounded key for a compares less than or equal to the bounded key for b
+ * with memcmp() of the shorter length, then by length.
+ * A key is complete if and only if it ends with a zero byte;
+ * sort keys do not contain zero bytes otherwise.
+ * Strings with equal, incomplete bounded keys need to be compared with ucol_strcoll()
+ * or their full sort keys.
+ *
+ * Unlike ucol_getSortKeyPrefix() this does not pad the key to a fixed width.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param source The string to transform.
+ * @param sourceLength The length of source, or -1 if NUL-terminated.
+ * @param dest Buffer for the key; must have room for maxLength bytes.
+ * @param maxLength The maximum number of bytes to write, must be >0.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The length of the key, at most maxLength.
+ * @see ucol_getSortKey
+ * @see ucol_getSortKeyPrefix
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getBoundedSortKey(const UCollator *coll,
+                       const UChar *source, int32_t sourceLength,
+                       uint8_t *dest, int32_t maxLength,
+                       UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
+
 /** Gets the next count bytes of a sort key. Caller needs
  *  to preserve state array between calls and to provide
  *  the same type of UCharIterator set with the same string.
@@ -379,6 +379,71 @@ ucsdet_isInputFilterEnabled(const UCharsetDetector *ucsd);
 U_STABLE  UBool U_EXPORT2
 ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Limit the number of input bytes that are examined.
+ * Detection looks only at the start of the input, and the time it takes
+ * is proportional to the number of bytes examined.
+ * The limit does not affect ucsdet_getUChars(), which converts all of the input.
+ *
+ * @param ucsd   the charset detector to be modified.
+ * @param length the maximum number of bytes to be examined,
+ *               or 0 to examine all of the input (the default).
+ * @param status any error conditions are reported back in this variable.
+ *               U_ILLEGAL_ARGUMENT_ERROR if length is negative.
+ *
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucsdet_setSampleLength(UCharsetDetector *ucsd, int32_t length, UErrorCode *status);
+
+/**
+ * Make detection stop as soon as one of the recognizers reports a match
+ * with at least the given confidence.
+ * The charsets are tried in a fixed order, Unicode charsets first, and
+ * ucsdet_detectAll() returns only the matches that were found up to that point.
+ * Also, when the input starts with a Unicode byte order mark,
+ * only the Unicode charsets are tried.
+ *
+ * This makes detection faster, especially for input in Unicode charsets,
+ * but the best match may differ from the one without early termination
+ * if a charset that is tried later would have reported a higher confidence.
+ *
+ * @param ucsd       the charset detector to be modified.
+ * @param confidence the confidence at which to stop, from 1 to 100,
+ *                   or 0 to always try all charsets (the default).
+ * @param status     any error conditions are reported back in this variable.
+ *                   U_ILLEGAL_ARGUMENT_ERROR if confidence is not in 0..100.
+ *
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucsdet_setStopConfidence(UCharsetDetector *ucsd, int32_t confidence, UErrorCode *status);
+
+/**
+ * Detect the charsets of a number of input texts, one after the other.
+ * This is equivalent to calling ucsdet_setText() and ucsdet_detect() for each text,
+ * and reuses the detector's buffers without allocating memory for each text.
+ * Afterwards, the detector's input text is the last one of the texts.
+ *
+ * @param ucsd        the charset detector to be used.
+ * @param texts       the input texts of unknown encoding.
+ * @param lengths     the length of each input text, or -1 if that text is NUL terminated.
+ * @param count       the number of input texts.
+ * @param names       receives for each text the name of the best matching charset,
+ *                    as from ucsdet_getName(), or NULL if no charset matches.
+ * @param confidences receives for each text the confidence of the best match,
+ *                    or 0 if no charset matches. Can be NULL.
+ * @param status      any error conditions are reported back in this variable.
+ *
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucsdet_detectBatch(UCharsetDetector *ucsd,
+                   const char *const texts[], const int32_t lengths[], int32_t count,
+                   const char *names[], int32_t confidences[], UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 /**
   *  Get an iterator over the set of detectable charsets -
@@ -994,6 +994,34 @@ udat_format(    const    UDateFormat*    format,
                         UFieldPosition* position,
                         UErrorCode*     status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Format an array of dates using a UDateFormat, writing the results one after the other.
+* This is equivalent to, and for many dates faster than, calling udat_format()
+* for each date and concatenating the results.
+* @param format The formatter to use
+* @param dates The dates to format
+* @param count The number of dates
+* @param result A pointer to a buffer to receive the formatted dates.
+* @param resultLength The maximum size of result.
+* @param offsets If not NULL, must have room for count values:
+* offsets[i] receives the index in the full result just after the text for dates[i].
+* The offsets are set even if the result is truncated.
+* @param status A pointer to an UErrorCode to receive any errors
+* @return The total buffer size needed; if greater than resultLength, the output was truncated.
+* @see udat_format
+* @draft ICU 64
+*/
+U_CAPI int32_t U_EXPORT2
+udat_formatBatch(const UDateFormat* format,
+                 const UDate*       dates,
+                 int32_t            count,
+                 UChar*             result,
+                 int32_t            resultLength,
+                 int32_t*           offsets,
+                 UErrorCode*        status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
 * Format a date using an UDateFormat.
 * The date will be formatted using the conventions specified in {@link #udat_open }
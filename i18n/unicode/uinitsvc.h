@@ -0,0 +1,119 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+**********************************************************************
+*   file name:  uinitsvc.h
+*   encoding:   UTF-8
+*   indentation:4
+*
+*   created on: 2026oct14
+*
+*   Eager initialization of ICU services
+*/
+
+#ifndef UINITSVC_H
+#define UINITSVC_H
+
+#include "unicode/utypes.h"
+
+/**
+ * \file
+ * \brief C API: Eager initialization of ICU services
+ *
+ * Most ICU services load their data lazily, on first use: the default locale
+ * and converter, the default time zone, property data, the root collator,
+ * and the data of each locale. The first calls after process start therefore
+ * take much longer than later ones.
+ * u_initServices() does that work up front, for example at application startup,
+ * so that it stays off the path of the first requests.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Bit flags for the services that u_initServices() initializes.
+ * @see u_initServices
+ * @draft ICU 64
+ */
+typedef enum UInitService {
+    /**
+     * The default locale, likely subtags, and the main resource bundle of each locale.
+     * @draft ICU 64
+     */
+    UINIT_LOCALE = 1,
+    /**
+     * The default converter and the converter alias table.
+     * @draft ICU 64
+     */
+    UINIT_CONVERSION = 2,
+    /**
+     * The default time zone, and the calendar of each locale.
+     * @draft ICU 64
+     */
+    UINIT_TIME_ZONE = 4,
+    /**
+     * Normalization data and the property sets that UnicodeSet patterns
+     * and regular expressions use.
+     * @draft ICU 64
+     */
+    UINIT_PROPERTIES = 8,
+    /**
+     * The root collator and the collator of each locale.
+     * @draft ICU 64
+     */
+    UINIT_COLLATION = 0x10,
+    /**
+     * The number format data of each locale.
+     * @draft ICU 64
+     */
+    UINIT_NUMBER_FORMAT = 0x20,
+    /**
+     * The date format data of each locale.
+     * @draft ICU 64
+     */
+    UINIT_DATE_FORMAT = 0x40,
+    /**
+     * The character, word, line and sentence break rules of each locale.
+     * @draft ICU 64
+     */
+    UINIT_BREAK_ITERATION = 0x80,
+    /**
+     * All of the above services.
+     * @draft ICU 64
+     */
+    UINIT_ALL = 0xff
+} UInitService;
+
+/**
+ * Initializes ICU services eagerly, rather than on first use.
+ * Loads the data of the requested services, and of each of the locales for
+ * the services that use locale data, into ICU's caches.
+ * Service objects created later find that data and are created quickly.
+ *
+ * This function is thread-safe. It can be called from a background thread
+ * while other threads already use ICU; they then wait for or share the
+ * data it loads, as with lazy initialization.
+ * For many locales, ures_preload() can first load their resource bundles
+ * on several threads.
+ *
+ * A service that fails to load for some locale, for example because its data
+ * is missing, is not included in the return value. It does not set an error,
+ * since that service may work for other locales, or may not be needed at all.
+ * Services that are excluded by the build configuration,
+ * for example with UCONFIG_NO_COLLATION, are also not included.
+ *
+ * @param locales   NULL-terminated array of locale IDs.
+ *                  If NULL, then only the default locale is initialized.
+ * @param services  Bit set of UInitService values.
+ * @param status    Receives errors. U_ILLEGAL_ARGUMENT_ERROR if services
+ *                  has bits other than those of UINIT_ALL.
+ * @return the bit set of the requested services that were initialized
+ *         for all of the locales
+ * @draft ICU 64
+ */
+U_DRAFT uint32_t U_EXPORT2
+u_initServices(const char * const *locales, uint32_t services, UErrorCode *status);
+
+#endif  /* U_HIDE_DRAFT_API */
+
+#endif  /* UINITSVC_H */
@@ -531,6 +531,33 @@ unumf_formatDecimal(const UNumberFormatter* uformatter, const char* value, int32
                     UFormattedNumber* uresult, UErrorCode* ec);
 
 
+/**
+ * Uses a UNumberFormatter to format an array of doubles, for example a column of a table,
+ * and writes the results one after the other into one UChar buffer, without separators
+ * or NUL characters between them. This is faster than calling unumf_formatDouble for each value.
+ * Field positions are not available for batch results.
+ *
+ * The UNumberFormatter can be shared between threads.
+ *
+ * NOTE: This is a C-compatible API; C++ users should build against numberformatter.h instead.
+ *
+ * @param uformatter A formatter object created by unumf_openForSkeletonAndLocale or similar.
+ * @param values The numbers to be formatted.
+ * @param count The number of values.
+ * @param buffer Receives the results; can be NULL if bufferCapacity is 0, for preflighting.
+ *               The whole output is NUL-terminated if there is space for it.
+ * @param bufferCapacity The size of the buffer in UChars.
+ * @param offsets If not NULL, receives count+1 indexes into the buffer: the start of each result,
+ *                followed by the total length. Filled even in case of a U_BUFFER_OVERFLOW_ERROR.
+ * @param ec Set if an error occurs, or to U_BUFFER_OVERFLOW_ERROR if the results do not fit.
+ * @return The total length of the results.
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+unumf_formatDoubleBatch(const UNumberFormatter* uformatter, const double* values, int32_t count,
+                        UChar* buffer, int32_t bufferCapacity, int32_t* offsets, UErrorCode* ec);
+
+
 /**
  * Extracts the result number string out of a UFormattedNumber to a UChar buffer if possible.
  * If bufferCapacity is greater than the required length, a terminating NUL is written.
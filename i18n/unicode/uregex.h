@@ -1476,6 +1476,51 @@ U_STABLE int32_t U_EXPORT2
 uregex_getStackLimit(const URegularExpression      *regexp,
                            UErrorCode              *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Use caller-provided memory, instead of the heap, for the match backtracking stack.
+ * The arena both holds the stack and limits its size: a match that needs more
+ * backtracking state than fits results in a U_REGEX_STACK_OVERFLOW error.
+ * Once the regular expression has been warmed up, repeated matching operations
+ * then run without heap allocation; see uregex_getHeapAllocationCount().
+ *
+ * uregex_getStackLimit() returns the arena capacity while an arena is in use.
+ * A call to uregex_setStackLimit(), or to this function with a NULL arena,
+ * returns to heap storage for the stack.
+ *
+ * @param   regexp      The compiled regular expression.
+ * @param   arena       The memory for the stack, aligned for int64_t values.
+ *                      It must remain valid, and must not be used by anything else,
+ *                      while the regular expression uses it.  NULL to return to heap storage.
+ * @param   capacity    The size of the arena, in bytes. It must be large enough
+ *                      for at least one backtracking frame of the pattern.
+ * @param   status      A reference to a UErrorCode to receive any errors.
+ *                      U_ILLEGAL_ARGUMENT_ERROR if the arena is misaligned or too small.
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+uregex_setStackArena(URegularExpression      *regexp,
+                     void                    *arena,
+                     int32_t                  capacity,
+                     UErrorCode              *status);
+
+/**
+ * Get the number of heap allocations that matching operations have made since
+ * the regular expression was opened or cloned, for growing the backtracking stack
+ * and for other internal structures that are built on first use.
+ * A value that does not change across repeated matching operations confirms
+ * that they run without heap allocation.
+ *
+ * @param   regexp      The compiled regular expression.
+ * @param   status      A reference to a UErrorCode to receive any errors.
+ * @return  the number of heap allocations made by matching operations.
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+uregex_getHeapAllocationCount(const URegularExpression      *regexp,
+                                    UErrorCode              *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /**
  * Function pointer for a regular expression matching callback function.
@@ -763,6 +763,121 @@ U_STABLE int32_t U_EXPORT2 usearch_previous(UStringSearch *strsrch,
 */
 U_STABLE void U_EXPORT2 usearch_reset(UStringSearch *strsrch);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Data structure for searching a text for many patterns at once.
+* @draft ICU 64
+*/
+struct UMultiStringSearch;
+/**
+* Data structure for searching a text for many patterns at once.
+* @draft ICU 64
+*/
+typedef struct UMultiStringSearch UMultiStringSearch;
+
+/**
+* A match reported by <tt>usearch_findAllMulti</tt>.
+* @draft ICU 64
+*/
+typedef struct UMultiSearchMatch {
+    /** Index of the matched pattern in the array passed to usearch_openMulti. @draft ICU 64 */
+    int32_t patternIndex;
+    /** Start index of the match in the text. @draft ICU 64 */
+    int32_t start;
+    /** Limit index of the match in the text. @draft ICU 64 */
+    int32_t limit;
+} UMultiSearchMatch;
+
+/**
+* Creates a searcher that finds all occurrences of any of a set of patterns
+* in a single pass over a text.
+* <p>
+* Each pattern is turned into its sequence of collation elements, processed
+* for the strength and alternate handling of the collator, and all of the
+* sequences are merged into one Aho-Corasick automaton over collation element
+* weights. A primary strength collator thus gives accent- and case-insensitive
+* matching for every pattern.
+* <p>
+* Matches obey the same constraints as those of a <tt>UStringSearch</tt>
+* created with the same collator and no break iterator: a match must not
+* start or end inside a combining sequence or inside the expansion of a
+* character. The user retains ownership of the collator, and of the pattern
+* strings, which are only read during this call.
+* @param patterns array of pattern strings
+* @param patternLengths array of pattern lengths, -1 for a null-terminated
+*               pattern; if NULL, all patterns are null-terminated
+* @param patternCount number of patterns, must be greater than 0
+* @param collator used for the language rules
+* @param status for errors if it occurs. If patterns or collator is NULL,
+*               patternCount is not positive, or a pattern has no collation
+*               elements at the collator's strength then an
+*               U_ILLEGAL_ARGUMENT_ERROR is returned. If the collator has
+*               numeric collation turned on then U_UNSUPPORTED_ERROR is
+*               returned.
+* @return the multi-pattern searcher, or NULL if there is an error.
+* @see #usearch_findAllMulti
+* @draft ICU 64
+*/
+U_DRAFT UMultiStringSearch * U_EXPORT2 usearch_openMulti(
+                                  const UChar *const *patterns,
+                                  const int32_t      *patternLengths,
+                                        int32_t       patternCount,
+                                  const UCollator    *collator,
+                                        UErrorCode   *status);
+
+/**
+* Destroys and cleans up the multi-pattern searcher.
+* @param msrch the multi-pattern searcher, may be NULL
+* @draft ICU 64
+*/
+U_DRAFT void U_EXPORT2 usearch_closeMulti(UMultiStringSearch *msrch);
+
+/**
+* Finds all matches of all the patterns in the text, including overlapping
+* ones, in a single pass. Matches are reported in the order in which they end
+* in the text's collation elements; matches ending at the same place are
+* reported longest pattern first.
+* <p>
+* This function uses preflighting: if the matches do not fit into the array,
+* the first <tt>capacity</tt> of them are written, the total number is
+* returned and U_BUFFER_OVERFLOW_ERROR is set.
+* @param msrch the multi-pattern searcher
+* @param text text string
+* @param textLength length of the text string, -1 for null-termination
+* @param matches array receiving the matches, may be NULL if capacity is 0
+* @param capacity number of UMultiSearchMatch items in matches
+* @param status for errors if it occurs
+* @return the number of matches found
+* @draft ICU 64
+*/
+U_DRAFT int32_t U_EXPORT2 usearch_findAllMulti(UMultiStringSearch *msrch,
+                                         const UChar              *text,
+                                               int32_t             textLength,
+                                               UMultiSearchMatch  *matches,
+                                               int32_t             capacity,
+                                               UErrorCode         *status);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUMultiStringSearchPointer
+ * "Smart pointer" class, closes a UMultiStringSearch via usearch_closeMulti().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 64
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUMultiStringSearchPointer, UMultiStringSearch, usearch_closeMulti);
+
+U_NAMESPACE_END
+
+#endif
+
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 /**
   *  Simple forward search for the pattern, starting at a specified index,
@@ -1135,6 +1135,64 @@ uspoof_check2UTF8(const USpoofChecker *sc,
     USpoofCheckResult* checkResult,
     UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Check an array of identifiers for possible security issues.
+ * The result for each identifier is the same as the return value of
+ * uspoof_check2() with a NULL checkResult.
+ *
+ * This is faster than calling uspoof_check2() for each identifier:
+ * Scratch state is shared by all of the identifiers, and an identifier that
+ * consists only of ASCII characters which are also in the set of allowed
+ * characters passes all checks without further work.
+ *
+ * @param sc      The USpoofChecker
+ * @param ids     An array of count identifiers, in UTF-16 format.
+ * @param lengths An array of count identifier lengths, where -1 means that the
+ *                identifier is zero terminated; or NULL if all of the identifiers
+ *                are zero terminated.
+ * @param count   The number of identifiers.
+ * @param results An array of count integers, each set to the bitmask of
+ *                potential security or spoofing issues detected for the
+ *                corresponding identifier.  See uspoof_check2().
+ * @param status  The error code, set if an error occurred while attempting to
+ *                perform the checks.
+ * @return        The number of identifiers that failed at least one of the
+ *                enabled checks.
+ * @see uspoof_check2
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+uspoof_checkBatch(const USpoofChecker *sc,
+                  const UChar *const *ids, const int32_t *lengths, int32_t count,
+                  int32_t *results, UErrorCode *status);
+
+/**
+ * Check an array of UTF-8 identifiers for possible security issues.
+ * Same as uspoof_checkBatch() except for the string encoding.
+ *
+ * @param sc      The USpoofChecker
+ * @param ids     An array of count identifiers, in UTF-8 format.
+ * @param lengths An array of count identifier lengths in bytes, where -1 means that the
+ *                identifier is zero terminated; or NULL if all of the identifiers
+ *                are zero terminated.
+ * @param count   The number of identifiers.
+ * @param results An array of count integers, each set to the bitmask of
+ *                potential security or spoofing issues detected for the
+ *                corresponding identifier.  See uspoof_check2UTF8().
+ * @param status  The error code, set if an error occurred while attempting to
+ *                perform the checks.
+ * @return        The number of identifiers that failed at least one of the
+ *                enabled checks.
+ * @see uspoof_checkBatch
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+uspoof_checkBatchUTF8(const USpoofChecker *sc,
+                      const char *const *ids, const int32_t *lengths, int32_t count,
+                      int32_t *results, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #if U_SHOW_CPLUSPLUS_API
 /**
  * Check the specified string for possible security issues.
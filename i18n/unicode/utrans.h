@@ -559,6 +559,39 @@ utrans_getSourceSet(const UTransliterator* trans,
                     USet* fillIn,
                     UErrorCode* status);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Transliterates a UTF-8 string into a separate destination buffer.
+ * The whole source string is transliterated, as with utrans_transUChars().
+ * Case mapping and normalization transliterators without a filter
+ * work directly on the UTF-8 text; other transliterators convert
+ * through a temporary UTF-16 buffer internally.
+ *
+ * The source and destination buffers must not overlap.
+ * The result is NUL-terminated if there is space for it.
+ *
+ * @param trans     The transliterator.
+ * @param src       The source UTF-8 string.
+ * @param srcLength The length of the source string, or -1 if it is NUL-terminated.
+ * @param dest      A buffer for the result string.
+ *                  Can be NULL if destCapacity is 0 for pure preflighting.
+ * @param destCapacity The size of the dest buffer in bytes.
+ * @param status    A pointer to the UErrorCode. Set to U_INVALID_CHAR_FOUND
+ *                  if the source string is not well-formed UTF-8, and to
+ *                  U_BUFFER_OVERFLOW_ERROR if the result does not fit.
+ * @return The length of the result string in bytes, not counting the NUL.
+ *         It may be greater than destCapacity.
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+utrans_transUTF8(const UTransliterator* trans,
+                 const char* src, int32_t srcLength,
+                 char* dest, int32_t destCapacity,
+                 UErrorCode* status);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /* deprecated API ----------------------------------------------------------- */
 
 #ifndef U_HIDE_DEPRECATED_API
@@ -1074,6 +1074,40 @@ uregex_getStackLimit(const  URegularExpression   *regexp2,
 }
 
 
+//------------------------------------------------------------------------------
+//
+//    uregex_setStackArena
+//
+//------------------------------------------------------------------------------
+U_CAPI void U_EXPORT2
+uregex_setStackArena(URegularExpression   *regexp2,
+                     void                 *arena,
+                     int32_t               capacity,
+                     UErrorCode           *status) {
+    RegularExpression *regexp = (RegularExpression*)regexp2;
+    if (validateRE(regexp, FALSE, status)) {
+        regexp->fMatcher->setStackArena(arena, capacity, *status);
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//
+//    uregex_getHeapAllocationCount
+//
+//------------------------------------------------------------------------------
+U_CAPI int32_t U_EXPORT2
+uregex_getHeapAllocationCount(const  URegularExpression   *regexp2,
+                                     UErrorCode           *status) {
+    int32_t retVal = 0;
+    RegularExpression *regexp = (RegularExpression*)regexp2;
+    if (validateRE(regexp, FALSE, status)) {
+        retVal = regexp->fMatcher->getHeapAllocationCount();
+    }
+    return retVal;
+}
+
+
 //------------------------------------------------------------------------------
 //
 //    uregex_setMatchCallback
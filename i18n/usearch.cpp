@@ -23,6 +23,9 @@
 #include "ucln_in.h"
 #include "uassert.h"
 #include "ustr_imp.h"
+#include "uarrsort.h"
+#include "uvectr32.h"
+#include "uvectr64.h"
 
 U_NAMESPACE_USE
 
@@ -95,6 +98,17 @@ inline int hashFromCE32(uint32_t ce)
     return hc;
 }
 
+/**
+* Getting the hash value of a processed (64-bit) collation element.
+* @param ce processed collation element
+* @return hash code
+*/
+static
+inline int hashFromCE64(int64_t ce)
+{
+    return hashFromCE32((uint32_t)((uint64_t)ce >> 32) ^ (uint32_t)ce);
+}
+
 U_CDECL_BEGIN
 static UBool U_CALLCONV
 usearch_cleanup(void) {
@@ -422,6 +436,22 @@ inline uint16_t initializePatternPCETable(UStringSearch *strsrch,
     pattern->pces       = pcetable;
     pattern->pcesLength = offset;
 
+    // Horspool shift table: a window whose last target CE equals pces[i]
+    // (i < offset - 1) can move by offset - 1 - i, any other by offset.
+    // Hash collisions keep the smaller shift, which is always safe.
+    int32_t maxShift = offset < INT16_MAX ? offset : INT16_MAX;
+    int32_t count;
+    for (count = 0; count < MAX_TABLE_SIZE_; count ++) {
+        pattern->pceShift[count] = (int16_t)maxShift;
+    }
+    for (count = 0; count + 1 < offset; count ++) {
+        int32_t shift = offset - 1 - count;
+        int16_t *entry = &pattern->pceShift[hashFromCE64(pcetable[count])];
+        if (shift < *entry) {
+            *entry = (int16_t)shift;
+        }
+    }
+
     return result;
 }
 
@@ -3616,14 +3646,14 @@ U_NAMESPACE_END
 #endif
 
 /*
- * Find the next break boundary after startIndex. If the UStringSearch object
+ * Find the next break boundary after startIndex. If the USearch object
  * has an external break iterator, use that. Otherwise use the internal character
  * break iterator.
  */
-static int32_t nextBoundaryAfter(UStringSearch *strsrch, int32_t startIndex) {
+static int32_t nextBoundaryAfter(const USearch *search, int32_t startIndex) {
 #if 0
-    const UChar *text = strsrch->search->text;
-    int32_t textLen   = strsrch->search->textLength;
+    const UChar *text = search->text;
+    int32_t textLen   = search->textLength;
 
     U_ASSERT(startIndex>=0);
     U_ASSERT(startIndex<=textLen);
@@ -3659,10 +3689,10 @@ static int32_t nextBoundaryAfter(UStringSearch *strsrch, int32_t startIndex) {
     }
     return indexOfLastCharChecked;
 #elif !UCONFIG_NO_BREAK_ITERATION
-    UBreakIterator *breakiterator = strsrch->search->breakIter;
+    UBreakIterator *breakiterator = search->breakIter;
 
     if (breakiterator == NULL) {
-        breakiterator = strsrch->search->internalBreakIter;
+        breakiterator = search->internalBreakIter;
     }
 
     if (breakiterator != NULL) {
@@ -3678,14 +3708,14 @@ static int32_t nextBoundaryAfter(UStringSearch *strsrch, int32_t startIndex) {
 }
 
 /*
- * Returns TRUE if index is on a break boundary. If the UStringSearch
+ * Returns TRUE if index is on a break boundary. If the USearch
  * has an external break iterator, test using that, otherwise test
  * using the internal character break iterator.
  */
-static UBool isBreakBoundary(UStringSearch *strsrch, int32_t index) {
+static UBool isBreakBoundary(const USearch *search, int32_t index) {
 #if 0
-    const UChar *text = strsrch->search->text;
-    int32_t textLen   = strsrch->search->textLength;
+    const UChar *text = search->text;
+    int32_t textLen   = search->textLength;
 
     U_ASSERT(index>=0);
     U_ASSERT(index<=textLen);
@@ -3710,10 +3740,10 @@ static UBool isBreakBoundary(UStringSearch *strsrch, int32_t index) {
     UBool combining =  !(gcProperty==U_GCB_CONTROL || gcProperty==U_GCB_LF || gcProperty==U_GCB_CR);
     return !combining;
 #elif !UCONFIG_NO_BREAK_ITERATION
-    UBreakIterator *breakiterator = strsrch->search->breakIter;
+    UBreakIterator *breakiterator = search->breakIter;
 
     if (breakiterator == NULL) {
-        breakiterator = strsrch->search->internalBreakIter;
+        breakiterator = search->internalBreakIter;
     }
 
     return (breakiterator != NULL && ubrk_isBoundary(breakiterator, index));
@@ -3833,6 +3863,111 @@ UChar32 codePointBefore(const USearch &search, int32_t index) {
 
 }  // namespace
 
+/*
+ * Checks the text bounds of a forward match that was found in CE space and
+ * computes its limit. firstCEI and lastCEI are the first and last matched
+ * CEs, nextCEI is the CE following the match and maxLimit its low index.
+ * Returns FALSE if the match must be rejected.
+ * Shared by usearch_search() and the multi-pattern search.
+ */
+static UBool checkForwardMatchBounds(const USearch *search, const Normalizer2 *nfd,
+                                     const CEI *firstCEI, const CEI *lastCEI,
+                                     const CEI *nextCEI, int32_t maxLimit,
+                                     int32_t *mLimit) {
+    int32_t mStart   = firstCEI->lowIndex;
+    int32_t minLimit = lastCEI->lowIndex;
+
+    // Check for the start of the match being within a combining sequence.
+    //   This can happen if the pattern itself begins with a combining char, and
+    //   the match found combining marks in the target text that were attached
+    //    to something else.
+    //   This type of match should be rejected for not completely consuming a
+    //   combining sequence.
+    if (!isBreakBoundary(search, mStart)) {
+        return FALSE;
+    }
+
+    // Check for the start of the match being within an Collation Element Expansion,
+    //   meaning that the first char of the match is only partially matched.
+    //   With exapnsions, the first CE will report the index of the source
+    //   character, and all subsequent (expansions) CEs will report the source index of the
+    //    _following_ character.
+    int32_t secondIx = firstCEI->highIndex;
+    if (mStart == secondIx) {
+        return FALSE;
+    }
+
+    // Allow matches to end in the middle of a grapheme cluster if the following
+    // conditions are met; this is needed to make prefix search work properly in
+    // Indic, see #11750
+    // * the default breakIter is being used
+    // * the next collation element after this combining sequence
+    //   - has non-zero primary weight
+    //   - corresponds to a separate character following the one at end of the current match
+    //   (the second of these conditions, and perhaps both, may be redundant given the
+    //   subsequent check for normalization boundary; however they are likely much faster
+    //   tests in any case)
+    // * the match limit is a normalization boundary
+    UBool allowMidclusterMatch = FALSE;
+    if (search->text != NULL && search->textLength > maxLimit) {
+        allowMidclusterMatch =
+                search->breakIter == NULL &&
+                nextCEI != NULL && (((nextCEI->ce) >> 32) & 0xFFFF0000UL) != 0 &&
+                maxLimit >= lastCEI->highIndex && nextCEI->highIndex > maxLimit &&
+                (nfd->hasBoundaryBefore(codePointAt(*search, maxLimit)) ||
+                    nfd->hasBoundaryAfter(codePointBefore(*search, maxLimit)));
+    }
+    // If those conditions are met, then:
+    // * do NOT advance the candidate match limit (mLimit) to a break boundary; however
+    //   the match limit may be backed off to a previous break boundary. This handles
+    //   cases in which mLimit includes target characters that are ignorable with current
+    //   settings (such as space) and which extend beyond the pattern match.
+    // * do NOT require that end of the combining sequence not extend beyond the match in CE space
+    // * do NOT require that match limit be on a breakIter boundary
+
+    //  Advance the match end position to the first acceptable match boundary.
+    //    This advances the index over any combining charcters.
+    *mLimit = maxLimit;
+    if (minLimit < maxLimit) {
+        // When the last CE's low index is same with its high index, the CE is likely
+        // a part of expansion. In this case, the index is located just after the
+        // character corresponding to the CEs compared above. If the index is right
+        // at the break boundary, move the position to the next boundary will result
+        // incorrect match length when there are ignorable characters exist between
+        // the position and the next character produces CE(s). See ticket#8482.
+        if (minLimit == lastCEI->highIndex && isBreakBoundary(search, minLimit)) {
+            *mLimit = minLimit;
+        } else {
+            int32_t nba = nextBoundaryAfter(search, minLimit);
+            // Note that we can have nba < maxLimit && nba >= minLImit, in which
+            // case we want to set mLimit to nba regardless of allowMidclusterMatch
+            // (i.e. we back off mLimit to the previous breakIterator boundary).
+            if (nba >= lastCEI->highIndex && (!allowMidclusterMatch || nba < maxLimit)) {
+                *mLimit = nba;
+            }
+        }
+    }
+
+#ifdef USEARCH_DEBUG
+    if (getenv("USEARCH_DEBUG") != NULL) {
+        printf("minLimit, maxLimit, mLimit = %d, %d, %d\n", minLimit, maxLimit, *mLimit);
+    }
+#endif
+
+    if (!allowMidclusterMatch) {
+        // If advancing to the end of a combining sequence in character indexing space
+        //   advanced us beyond the end of the match in CE space, reject this match.
+        if (*mLimit > maxLimit) {
+            return FALSE;
+        }
+
+        if (!isBreakBoundary(search, *mLimit)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
 U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
                                        int32_t        startIdx,
                                        int32_t        *matchStart,
@@ -3881,9 +4016,15 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
 
     int32_t  mStart = -1;
     int32_t  mLimit = -1;
-    int32_t  minLimit;
     int32_t  maxLimit;
 
+    // With the standard element comparison, a match in CE space needs
+    // exactly pcesLength target CEs, each equal to its pattern CE.
+    // Then the last CE of each candidate window is checked first, and
+    // like in Boyer-Moore-Horspool it tells how many starts can be skipped.
+    const int32_t patLength = strsrch->pattern.pcesLength;
+    const UBool   useShift = strsrch->search->elementComparisonType == 0 && patLength > 1;
+    const int64_t lastPatCE = useShift ? strsrch->pattern.pces[patLength - 1] : 0;
 
 
     // Outer loop moves over match starting positions in the
@@ -3902,6 +4043,35 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     //
     for(targetIx=0; ; targetIx++)
     {
+        if (useShift) {
+            // Fetch the CEs through the end of this window; the buffer hands them out
+            // only in sequence, and it holds more than patLength of them.
+            const int32_t windowEndIx = targetIx + patLength - 1;
+            const CEI *windowEndCEI = NULL;
+            if (windowEndIx < ceb.limitIx) {
+                windowEndCEI = ceb.get(windowEndIx);
+            } else {
+                do {
+                    windowEndCEI = ceb.get(ceb.limitIx);
+                } while (windowEndCEI != NULL && windowEndCEI->ce != UCOL_PROCESSED_NULLORDER &&
+                         ceb.limitIx <= windowEndIx);
+            }
+            if (windowEndCEI == NULL) {
+                *status = U_INTERNAL_PROGRAM_ERROR;
+                found = FALSE;
+                break;
+            }
+            if (windowEndCEI->ce == UCOL_PROCESSED_NULLORDER) {
+                // Fewer than patLength CEs are left.
+                found = FALSE;
+                break;
+            }
+            if (windowEndCEI->ce != lastPatCE) {
+                targetIx += strsrch->pattern.pceShift[hashFromCE64(windowEndCEI->ce)] - 1;
+                continue;
+            }
+        }
+
         found = TRUE;
         //  Inner loop checks for a match beginning at each
         //  position from the outer loop.
@@ -3959,7 +4129,6 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
         const CEI *lastCEI  = ceb.get(targetIx + targetIxOffset - 1);
 
         mStart   = firstCEI->lowIndex;
-        minLimit = lastCEI->lowIndex;
 
         // Look at the CE following the match.  If it is UCOL_NULLORDER the match
         //   extended to the end of input, and the match is good.
@@ -4006,96 +4175,12 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
         }
 
 
-        // Check for the start of the match being within a combining sequence.
-        //   This can happen if the pattern itself begins with a combining char, and
-        //   the match found combining marks in the target text that were attached
-        //    to something else.
-        //   This type of match should be rejected for not completely consuming a
-        //   combining sequence.
-        if (!isBreakBoundary(strsrch, mStart)) {
-            found = FALSE;
-        }
-
-        // Check for the start of the match being within an Collation Element Expansion,
-        //   meaning that the first char of the match is only partially matched.
-        //   With exapnsions, the first CE will report the index of the source
-        //   character, and all subsequent (expansions) CEs will report the source index of the
-        //    _following_ character.
-        int32_t secondIx = firstCEI->highIndex;
-        if (mStart == secondIx) {
+        if (!checkForwardMatchBounds(strsrch->search, strsrch->nfd,
+                                     firstCEI, lastCEI, nextCEI, maxLimit, &mLimit)) {
             found = FALSE;
         }
 
-        // Allow matches to end in the middle of a grapheme cluster if the following
-        // conditions are met; this is needed to make prefix search work properly in
-        // Indic, see #11750
-        // * the default breakIter is being used
-        // * the next collation element after this combining sequence
-        //   - has non-zero primary weight
-        //   - corresponds to a separate character following the one at end of the current match
-        //   (the second of these conditions, and perhaps both, may be redundant given the
-        //   subsequent check for normalization boundary; however they are likely much faster
-        //   tests in any case)
-        // * the match limit is a normalization boundary
-        UBool allowMidclusterMatch = FALSE;
-        if (strsrch->search->text != NULL && strsrch->search->textLength > maxLimit) {
-            allowMidclusterMatch =
-                    strsrch->search->breakIter == NULL &&
-                    nextCEI != NULL && (((nextCEI->ce) >> 32) & 0xFFFF0000UL) != 0 &&
-                    maxLimit >= lastCEI->highIndex && nextCEI->highIndex > maxLimit &&
-                    (strsrch->nfd->hasBoundaryBefore(codePointAt(*strsrch->search, maxLimit)) ||
-                        strsrch->nfd->hasBoundaryAfter(codePointBefore(*strsrch->search, maxLimit)));
-        }
-        // If those conditions are met, then:
-        // * do NOT advance the candidate match limit (mLimit) to a break boundary; however
-        //   the match limit may be backed off to a previous break boundary. This handles
-        //   cases in which mLimit includes target characters that are ignorable with current
-        //   settings (such as space) and which extend beyond the pattern match.
-        // * do NOT require that end of the combining sequence not extend beyond the match in CE space
-        // * do NOT require that match limit be on a breakIter boundary
-
-        //  Advance the match end position to the first acceptable match boundary.
-        //    This advances the index over any combining charcters.
-        mLimit = maxLimit;
-        if (minLimit < maxLimit) {
-            // When the last CE's low index is same with its high index, the CE is likely
-            // a part of expansion. In this case, the index is located just after the
-            // character corresponding to the CEs compared above. If the index is right
-            // at the break boundary, move the position to the next boundary will result
-            // incorrect match length when there are ignorable characters exist between
-            // the position and the next character produces CE(s). See ticket#8482.
-            if (minLimit == lastCEI->highIndex && isBreakBoundary(strsrch, minLimit)) {
-                mLimit = minLimit;
-            } else {
-                int32_t nba = nextBoundaryAfter(strsrch, minLimit);
-                // Note that we can have nba < maxLimit && nba >= minLImit, in which
-                // case we want to set mLimit to nba regardless of allowMidclusterMatch
-                // (i.e. we back off mLimit to the previous breakIterator boundary).
-                if (nba >= lastCEI->highIndex && (!allowMidclusterMatch || nba < maxLimit)) {
-                    mLimit = nba;
-                }
-            }
-        }
-
-    #ifdef USEARCH_DEBUG
-        if (getenv("USEARCH_DEBUG") != NULL) {
-            printf("minLimit, maxLimit, mLimit = %d, %d, %d\n", minLimit, maxLimit, mLimit);
-        }
-    #endif
-
-        if (!allowMidclusterMatch) {
-            // If advancing to the end of a combining sequence in character indexing space
-            //   advanced us beyond the end of the match in CE space, reject this match.
-            if (mLimit > maxLimit) {
-                found = FALSE;
-            }
-
-            if (!isBreakBoundary(strsrch, mLimit)) {
-                found = FALSE;
-            }
-        }
-
-        if (! checkIdentical(strsrch, mStart, mLimit)) {
+        if (found && !checkIdentical(strsrch, mStart, mLimit)) {
             found = FALSE;
         }
 
@@ -4279,7 +4364,7 @@ U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
         //    to something else.
         //   This type of match should be rejected for not completely consuming a
         //   combining sequence.
-        if (!isBreakBoundary(strsrch, mStart)) {
+        if (!isBreakBoundary(strsrch->search, mStart)) {
             found = FALSE;
         }
 
@@ -4340,7 +4425,7 @@ U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
             //  Advance the match end position to the first acceptable match boundary.
             //    This advances the index over any combining characters.
             if (minLimit < maxLimit) {
-                int32_t nba = nextBoundaryAfter(strsrch, minLimit);
+                int32_t nba = nextBoundaryAfter(strsrch->search, minLimit);
                 // Note that we can have nba < maxLimit && nba >= minLImit, in which
                 // case we want to set mLimit to nba regardless of allowMidclusterMatch
                 // (i.e. we back off mLimit to the previous breakIterator boundary).
@@ -4357,7 +4442,7 @@ U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
                 }
 
                 // Make sure the end of the match is on a break boundary
-                if (!isBreakBoundary(strsrch, mLimit)) {
+                if (!isBreakBoundary(strsrch->search, mLimit)) {
                     found = FALSE;
                 }
             }
@@ -4367,7 +4452,7 @@ U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
             // The maximum position is detected by boundary after
             // the last non-ignorable CE. Combining sequence
             // across the start index will be truncated.
-            int32_t nba = nextBoundaryAfter(strsrch, minLimit);
+            int32_t nba = nextBoundaryAfter(strsrch->search, minLimit);
             mLimit = maxLimit = (nba > 0) && (startIdx > nba) ? nba : startIdx;
         }
 
@@ -4945,4 +5030,439 @@ UBool usearch_handlePreviousCanonical(UStringSearch *strsrch,
 #endif
 }
 
+
+// Multi-pattern search ---------------------------------------------------
+
+/*
+ * An Aho-Corasick automaton over the processed CEs of all patterns.
+ * The trie is built from the patterns in sorted CE order, so that the
+ * children of each node are created with increasing CEs; its edges are then
+ * stored per node (edgeStart[node]..edgeStart[node+1]) and found by binary search.
+ */
+struct UMultiStringSearch : public UMemory {
+    UMultiStringSearch(UErrorCode &status) :
+            collator(NULL), strength(UCOL_TERTIARY), nfd(NULL),
+            patternCount(0), maxPatternLength(0), nfdPatterns(NULL),
+            patternCEs(status), patternStart(status), patternNext(status),
+            nodeFail(status), nodeOutput(status), nodeDictLink(status),
+            edgeStart(status), edgeCEs(status), edgeTargets(status),
+            textIter(NULL) {
+        uprv_memset(&search, 0, sizeof(search));
+    }
+    ~UMultiStringSearch() {
+        delete[] nfdPatterns;
+        ucol_closeElements(textIter);
+#if !UCONFIG_NO_BREAK_ITERATION
+        ubrk_close(search.internalBreakIter);
+#endif
+    }
+
+    int32_t patternLength(int32_t p) const {
+        return patternStart.elementAti(p + 1) - patternStart.elementAti(p);
+    }
+    int32_t nextNode(int32_t node, int64_t ce) const;
+
+    const UCollator    *collator;
+    UCollationStrength  strength;
+    const Normalizer2  *nfd;
+    int32_t             patternCount;
+    int32_t             maxPatternLength;
+    // NFD forms of the patterns, only for identical strength
+    UnicodeString      *nfdPatterns;
+    // pattern p has the CEs patternCEs[patternStart[p]..patternStart[p+1]-1]
+    UVector64           patternCEs;
+    UVector32           patternStart;
+    // next pattern with the same CEs, or -1
+    UVector32           patternNext;
+    UVector32           nodeFail;
+    // first pattern ending at the node, or -1
+    UVector32           nodeOutput;
+    // nearest node on the failure chain with an output, or -1
+    UVector32           nodeDictLink;
+    UVector32           edgeStart;
+    UVector64           edgeCEs;
+    UVector32           edgeTargets;
+    UCollationElements *textIter;
+    // text and internal break iterator for the match bounds checks
+    USearch             search;
+};
+
+int32_t UMultiStringSearch::nextNode(int32_t node, int64_t ce) const {
+    const int64_t *ces = edgeCEs.getBuffer();
+    int32_t start = edgeStart.elementAti(node);
+    int32_t limit = edgeStart.elementAti(node + 1);
+    while (start < limit) {
+        int32_t i = (start + limit) / 2;
+        if ((uint64_t)ces[i] < (uint64_t)ce) {
+            start = i + 1;
+        } else if ((uint64_t)ces[i] > (uint64_t)ce) {
+            limit = i;
+        } else {
+            return edgeTargets.elementAti(i);
+        }
+    }
+    return -1;
+}
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+int32_t U_CALLCONV
+compareMultiPatterns(const void *context, const void *left, const void *right) {
+    const UMultiStringSearch *msrch = static_cast<const UMultiStringSearch *>(context);
+    const int64_t *ces = msrch->patternCEs.getBuffer();
+    int32_t l = *static_cast<const int32_t *>(left);
+    int32_t r = *static_cast<const int32_t *>(right);
+    int32_t li = msrch->patternStart.elementAti(l), lLimit = msrch->patternStart.elementAti(l + 1);
+    int32_t ri = msrch->patternStart.elementAti(r), rLimit = msrch->patternStart.elementAti(r + 1);
+    for (; li < lLimit && ri < rLimit; ++li, ++ri) {
+        if ((uint64_t)ces[li] != (uint64_t)ces[ri]) {
+            return (uint64_t)ces[li] < (uint64_t)ces[ri] ? -1 : 1;
+        }
+    }
+    if (li < lLimit) {
+        return 1;
+    }
+    return ri < rLimit ? -1 : 0;
+}
+
+void buildMultiAutomaton(UMultiStringSearch &msrch, UErrorCode &status) {
+    int32_t patternCount = msrch.patternCount;
+    MaybeStackArray<int32_t, 64> order;
+    if (order.resize(patternCount) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t p = 0; p < patternCount; ++p) {
+        order[p] = p;
+    }
+    uprv_sortArray(order.getAlias(), patternCount, (int32_t)sizeof(int32_t),
+                   compareMultiPatterns, &msrch, FALSE, &status);
+
+    // Build the trie. path holds the nodes along the previous pattern
+    // in sorted order; the next pattern shares its common prefix with it.
+    const int64_t *ces = msrch.patternCEs.getBuffer();
+    UVector32 path(status);
+    UVector32 edgeParents(status);
+    UVector64 edgeCEs(status);
+    msrch.nodeOutput.addElement(-1, status);
+    path.addElement(0, status);
+    int32_t nodeCount = 1;
+    int32_t previous = -1;
+    for (int32_t i = 0; i < patternCount && U_SUCCESS(status); ++i) {
+        int32_t p = order[i];
+        int32_t start = msrch.patternStart.elementAti(p);
+        int32_t length = msrch.patternLength(p);
+        int32_t common = 0;
+        if (previous >= 0) {
+            int32_t previousStart = msrch.patternStart.elementAti(previous);
+            int32_t previousLength = msrch.patternLength(previous);
+            while (common < length && common < previousLength &&
+                    ces[start + common] == ces[previousStart + common]) {
+                ++common;
+            }
+        }
+        path.setSize(common + 1);
+        for (int32_t k = common; k < length; ++k) {
+            edgeParents.addElement(path.elementAti(k), status);
+            edgeCEs.addElement(ces[start + k], status);
+            msrch.nodeOutput.addElement(-1, status);
+            path.addElement(nodeCount++, status);
+        }
+        if (U_FAILURE(status)) {
+            return;
+        }
+        int32_t node = path.elementAti(length);
+        msrch.patternNext.setElementAt(msrch.nodeOutput.elementAti(node), p);
+        msrch.nodeOutput.setElementAt(p, node);
+        previous = p;
+    }
+
+    // The child of edge e is node e+1. Store the edges per parent; a stable
+    // counting sort keeps each node's edges in increasing CE order.
+    int32_t edgeCount = nodeCount - 1;
+    msrch.edgeStart.setSize(nodeCount + 1);
+    msrch.edgeCEs.setSize(edgeCount);
+    msrch.edgeTargets.setSize(edgeCount);
+    msrch.nodeFail.setSize(nodeCount);
+    msrch.nodeDictLink.setSize(nodeCount);
+    if (U_FAILURE(status) || msrch.edgeStart.size() != nodeCount + 1 ||
+            msrch.edgeCEs.size() != edgeCount || msrch.edgeTargets.size() != edgeCount ||
+            msrch.nodeFail.size() != nodeCount || msrch.nodeDictLink.size() != nodeCount) {
+        if (U_SUCCESS(status)) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        return;
+    }
+    int32_t *edgeStart = msrch.edgeStart.getBuffer();
+    uprv_memset(edgeStart, 0, (nodeCount + 1) * sizeof(int32_t));
+    for (int32_t e = 0; e < edgeCount; ++e) {
+        ++edgeStart[edgeParents.elementAti(e) + 1];
+    }
+    for (int32_t n = 0; n < nodeCount; ++n) {
+        edgeStart[n + 1] += edgeStart[n];
+    }
+    MaybeStackArray<int32_t, 64> fill;
+    if (fill.resize(nodeCount) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memcpy(fill.getAlias(), edgeStart, nodeCount * sizeof(int32_t));
+    for (int32_t e = 0; e < edgeCount; ++e) {
+        int32_t i = fill[edgeParents.elementAti(e)]++;
+        msrch.edgeCEs.setElementAt(edgeCEs.elementAti(e), i);
+        msrch.edgeTargets.setElementAt(e + 1, i);
+    }
+
+    // Compute the failure and dictionary links breadth-first.
+    // fill is reused as the queue.
+    int32_t *fail = msrch.nodeFail.getBuffer();
+    int32_t *dictLink = msrch.nodeDictLink.getBuffer();
+    int32_t *queue = fill.getAlias();
+    int32_t queueStart = 0, queueLimit = 0;
+    fail[0] = 0;
+    dictLink[0] = -1;
+    queue[queueLimit++] = 0;
+    while (queueStart < queueLimit) {
+        int32_t node = queue[queueStart++];
+        for (int32_t i = edgeStart[node]; i < edgeStart[node + 1]; ++i) {
+            int64_t ce = msrch.edgeCEs.elementAti(i);
+            int32_t child = msrch.edgeTargets.elementAti(i);
+            int32_t target = 0;
+            if (node != 0) {
+                for (int32_t f = fail[node];; f = fail[f]) {
+                    int32_t next = msrch.nextNode(f, ce);
+                    if (next >= 0) {
+                        target = next;
+                        break;
+                    }
+                    if (f == 0) {
+                        break;
+                    }
+                }
+            }
+            fail[child] = target;
+            dictLink[child] = msrch.nodeOutput.elementAti(target) >= 0 ? target : dictLink[target];
+            queue[queueLimit++] = child;
+        }
+    }
+}
+
+}  // namespace
+
+U_NAMESPACE_END
+
+U_CAPI UMultiStringSearch * U_EXPORT2 usearch_openMulti(
+                                  const UChar *const *patterns,
+                                  const int32_t      *patternLengths,
+                                        int32_t       patternCount,
+                                  const UCollator    *collator,
+                                        UErrorCode   *status)
+{
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    if (patterns == NULL || patternCount <= 0 || collator == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+
+    // string search does not really work when numeric collation is turned on
+    if (ucol_getAttribute(collator, UCOL_NUMERIC_COLLATION, status) == UCOL_ON) {
+        *status = U_UNSUPPORTED_ERROR;
+        return NULL;
+    }
+    initializeFCD(status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+
+    LocalPointer<UMultiStringSearch> result(new UMultiStringSearch(*status), *status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    result->collator     = collator;
+    result->strength     = ucol_getStrength(collator);
+    result->nfd          = Normalizer2::getNFDInstance(*status);
+    result->patternCount = patternCount;
+    if (result->strength == UCOL_IDENTICAL) {
+        result->nfdPatterns = new UnicodeString[patternCount];
+        if (result->nfdPatterns == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+    }
+
+    UCollationElements *patternIter = ucol_openElements(collator, NULL, 0, status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    result->patternStart.addElement(0, *status);
+    for (int32_t p = 0; p < patternCount && U_SUCCESS(*status); ++p) {
+        const UChar *pattern = patterns[p];
+        int32_t length = patternLengths == NULL ? -1 : patternLengths[p];
+        if (pattern == NULL || length < -1) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            break;
+        }
+        if (length == -1) {
+            length = u_strlen(pattern);
+        }
+        ucol_setText(patternIter, pattern, length, status);
+        UCollationPCE iter(patternIter);
+        int64_t pce;
+        while ((pce = iter.nextProcessed(NULL, NULL, status)) != UCOL_PROCESSED_NULLORDER &&
+                U_SUCCESS(*status)) {
+            result->patternCEs.addElement(pce, *status);
+        }
+        int32_t cesLength = result->patternCEs.size() - result->patternStart.elementAti(p);
+        if (U_SUCCESS(*status) && cesLength == 0) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        if (cesLength > result->maxPatternLength) {
+            result->maxPatternLength = cesLength;
+        }
+        result->patternStart.addElement(result->patternCEs.size(), *status);
+        result->patternNext.addElement(-1, *status);
+        if (result->nfdPatterns != NULL) {
+            result->nfd->normalize(UnicodeString(FALSE, pattern, length),
+                                   result->nfdPatterns[p], *status);
+        }
+    }
+    ucol_closeElements(patternIter);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+
+    buildMultiAutomaton(*result, *status);
+
+#if !UCONFIG_NO_BREAK_ITERATION
+    result->search.internalBreakIter = ubrk_open(UBRK_CHARACTER,
+            ucol_getLocaleByType(collator, ULOC_VALID_LOCALE, status), NULL, 0, status);
+#endif
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    return result.orphan();
+}
+
+U_CAPI void U_EXPORT2 usearch_closeMulti(UMultiStringSearch *msrch)
+{
+    delete msrch;
+}
+
+U_CAPI int32_t U_EXPORT2 usearch_findAllMulti(UMultiStringSearch *msrch,
+                                        const UChar              *text,
+                                              int32_t             textLength,
+                                              UMultiSearchMatch  *matches,
+                                              int32_t             capacity,
+                                              UErrorCode         *status)
+{
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (msrch == NULL || text == NULL || textLength < -1 || capacity < 0 ||
+            (matches == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (textLength == -1) {
+        textLength = u_strlen(text);
+    }
+
+    if (msrch->textIter == NULL) {
+        msrch->textIter = ucol_openElements(msrch->collator, text, textLength, status);
+    } else {
+        ucol_setText(msrch->textIter, text, textLength, status);
+    }
+    msrch->search.text       = text;
+    msrch->search.textLength = textLength;
+#if !UCONFIG_NO_BREAK_ITERATION
+    ubrk_setText(msrch->search.internalBreakIter, text, textLength, status);
+#endif
+    // Match verification looks one CE back beyond the longest pattern.
+    int32_t ringSize = msrch->maxPatternLength + 1;
+    MaybeStackArray<CEI, DEFAULT_CEBUFFER_SIZE> ring;
+    if (U_SUCCESS(*status) && ring.resize(ringSize) == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+
+    UCollationPCE iter(msrch->textIter);
+    const int32_t *nodeOutput = msrch->nodeOutput.getBuffer();
+    const int32_t *nodeDictLink = msrch->nodeDictLink.getBuffer();
+    const int32_t *nodeFail = msrch->nodeFail.getBuffer();
+    const int32_t *patternNext = msrch->patternNext.getBuffer();
+    int32_t count = 0;
+    int32_t state = 0;
+    for (int32_t ceIndex = 0;; ++ceIndex) {
+        CEI *nextCEI = &ring[ceIndex % ringSize];
+        nextCEI->ce = iter.nextProcessed(&nextCEI->lowIndex, &nextCEI->highIndex, status);
+        if (U_FAILURE(*status)) {
+            return 0;
+        }
+
+        // Report the patterns ending with the previous CE, now that the
+        // CE following them is known.
+        int32_t node = nodeOutput[state] >= 0 ? state : nodeDictLink[state];
+        for (; node >= 0; node = nodeDictLink[node]) {
+            const CEI *lastCEI = &ring[(ceIndex + ringSize - 1) % ringSize];
+            for (int32_t p = nodeOutput[node]; p >= 0; p = patternNext[p]) {
+                const CEI *firstCEI = &ring[(ceIndex + ringSize - msrch->patternLength(p)) % ringSize];
+                int32_t maxLimit = nextCEI->lowIndex;
+                int32_t mLimit;
+                if (nextCEI->lowIndex == nextCEI->highIndex &&
+                        nextCEI->ce != UCOL_PROCESSED_NULLORDER) {
+                    continue;
+                }
+                if (!checkForwardMatchBounds(&msrch->search, msrch->nfd,
+                                             firstCEI, lastCEI, nextCEI, maxLimit, &mLimit)) {
+                    continue;
+                }
+                int32_t mStart = firstCEI->lowIndex;
+                if (msrch->nfdPatterns != NULL) {
+                    UnicodeString nfdText;
+                    msrch->nfd->normalize(UnicodeString(FALSE, text + mStart, mLimit - mStart),
+                                          nfdText, *status);
+                    if (U_FAILURE(*status)) {
+                        return 0;
+                    }
+                    if (nfdText != msrch->nfdPatterns[p]) {
+                        continue;
+                    }
+                }
+                if (count < capacity) {
+                    matches[count].patternIndex = p;
+                    matches[count].start = mStart;
+                    matches[count].limit = mLimit;
+                }
+                ++count;
+            }
+        }
+
+        if (nextCEI->ce == UCOL_PROCESSED_NULLORDER) {
+            break;
+        }
+        for (;;) {
+            int32_t next = msrch->nextNode(state, nextCEI->ce);
+            if (next >= 0) {
+                state = next;
+                break;
+            }
+            if (state == 0) {
+                break;
+            }
+            state = nodeFail[state];
+        }
+    }
+
+    if (count > capacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
 #endif /* #if !UCONFIG_NO_COLLATION */
@@ -20,13 +20,16 @@
 #include "unicode/uspoof.h"
 #include "unicode/ustring.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "mutex.h"
+#include "normalizer2impl.h"
 #include "scriptset.h"
 #include "uassert.h"
 #include "ucln_in.h"
 #include "uspoof_impl.h"
+#include "ustr_imp.h"
 #include "umutex.h"
 
 
@@ -41,6 +44,7 @@ U_NAMESPACE_USE
 static UnicodeSet *gInclusionSet = NULL;
 static UnicodeSet *gRecommendedSet = NULL;
 static const Normalizer2 *gNfdNormalizer = NULL;
+static const Normalizer2Impl *gNfdImpl = NULL;
 static UInitOnce gSpoofInitStaticsOnce = U_INITONCE_INITIALIZER;
 
 static UBool U_CALLCONV
@@ -50,6 +54,7 @@ uspoof_cleanup(void) {
     delete gRecommendedSet;
     gRecommendedSet = NULL;
     gNfdNormalizer = NULL;
+    gNfdImpl = NULL;
     gSpoofInitStaticsOnce.reset();
     return TRUE;
 }
@@ -147,6 +152,7 @@ static void U_CALLCONV initializeStatics(UErrorCode &status) {
     }
     gRecommendedSet->freeze();
     gNfdNormalizer = Normalizer2::getNFDInstance(status);
+    gNfdImpl = Normalizer2Factory::getNFCImpl(status);
     ucln_i18n_registerCleanup(UCLN_I18N_SPOOF, uspoof_cleanup);
 }
 
@@ -562,12 +568,11 @@ int32_t checkImpl(const SpoofImpl* This, const UnicodeString& id, CheckResult* c
     }
 
     if (0 != (This->fChecks & USPOOF_MIXED_NUMBERS)) {
-        UnicodeSet numerics;
-        This->getNumerics(id, numerics, *status);
-        if (numerics.size() > 1) {
+        // Collect directly into the result, reusing its set's memory.
+        This->getNumerics(id, checkResult->fNumerics, *status);
+        if (checkResult->fNumerics.size() > 1) {
             result |= USPOOF_MIXED_NUMBERS;
         }
-        checkResult->fNumerics = numerics;  // UnicodeSet::operator=
     }
 
     if (0 != (This->fChecks & USPOOF_HIDDEN_OVERLAY)) {
@@ -662,6 +667,244 @@ uspoof_check2UnicodeString(const USpoofChecker *sc,
     }
 }
 
+namespace {
+
+// Scratch state shared by the identifiers of one uspoof_checkBatch() call.
+class BatchChecker : public UMemory {
+public:
+    BatchChecker(const SpoofImpl *impl) : This(impl) {
+        uprv_memset(asciiAllowed, 0, sizeof(asciiAllowed));
+        for (UChar32 c = 0; c < 0x80; ++c) {
+            if (This->fAllowedCharsSet->contains(c)) {
+                asciiAllowed[c >> 5] |= (uint32_t)1 << (c & 0x1f);
+            }
+        }
+        // All of the checks pass for an identifier that contains only allowed ASCII characters:
+        // It is single-script with restriction level ASCII, has only ASCII digits,
+        // and contains no combining marks.
+        if ((This->fChecks & USPOOF_AUX_INFO) != 0 && (This->fChecks & USPOOF_RESTRICTION_LEVEL) != 0) {
+            asciiResult = USPOOF_ASCII;
+        } else {
+            asciiResult = 0;
+        }
+    }
+
+    int32_t check(const UChar *id, int32_t length, UErrorCode &status) {
+        if (isAllowedASCII(id, length)) {
+            return asciiResult;
+        }
+        idStr.setTo(length == -1, ConstChar16Ptr(id), length);  // Read-only alias.
+        return checkImpl(This, idStr, &checkResult, &status);
+    }
+
+    int32_t check(const char *id, int32_t length, UErrorCode &status) {
+        if (isAllowedASCII(id, length)) {
+            return asciiResult;
+        }
+        if (length < 0) {
+            length = static_cast<int32_t>(uprv_strlen(id));
+        }
+        // Convert into the reused string buffer; the UTF-16 length is at most the UTF-8 length.
+        UChar *buffer = idStr.getBuffer(length);
+        if (buffer == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+        int32_t length16 = 0;
+        u_strFromUTF8WithSub(buffer, idStr.getCapacity(), &length16, id, length, 0xfffd, NULL, &status);
+        idStr.releaseBuffer(U_SUCCESS(status) ? length16 : 0);
+        return checkImpl(This, idStr, &checkResult, &status);
+    }
+
+private:
+    template<typename Char>
+    UBool isAllowedASCII(const Char *id, int32_t length) const {
+        for (int32_t i = 0; length < 0 || i < length; ++i) {
+            uint32_t c = (uint32_t)id[i];
+            if (c == 0 && length < 0) {
+                break;
+            }
+            if (c >= 0x80 || (asciiAllowed[c >> 5] & ((uint32_t)1 << (c & 0x1f))) == 0) {
+                return FALSE;
+            }
+        }
+        return TRUE;
+    }
+
+    const SpoofImpl *This;
+    CheckResult checkResult;
+    UnicodeString idStr;
+    uint32_t asciiAllowed[4];
+    int32_t asciiResult;
+};
+
+template<typename Char>
+int32_t checkBatch(const USpoofChecker *sc,
+                   const Char *const *ids, const int32_t *lengths, int32_t count,
+                   int32_t *results, UErrorCode *status) {
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
+    if (This == NULL) {
+        return 0;
+    }
+    if (count < 0 || (count > 0 && (ids == NULL || results == NULL))) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    BatchChecker checker(This);
+    int32_t numFailed = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        int32_t length = lengths != NULL ? lengths[i] : -1;
+        if (length < -1) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        results[i] = checker.check(ids[i], length, *status);
+        if (U_FAILURE(*status)) {
+            return 0;
+        }
+        if ((results[i] & USPOOF_ALL_CHECKS) != 0) {
+            ++numFailed;
+        }
+    }
+    return numFailed;
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+uspoof_checkBatch(const USpoofChecker *sc,
+                  const UChar *const *ids, const int32_t *lengths, int32_t count,
+                  int32_t *results, UErrorCode *status) {
+    return checkBatch(sc, ids, lengths, count, results, status);
+}
+
+U_CAPI int32_t U_EXPORT2
+uspoof_checkBatchUTF8(const USpoofChecker *sc,
+                      const char *const *ids, const int32_t *lengths, int32_t count,
+                      int32_t *results, UErrorCode *status) {
+    return checkBatch(sc, ids, lengths, count, results, status);
+}
+
+
+namespace {
+
+// Skeleton output into a caller-provided UTF-16 buffer.
+// Counts the full length for preflighting.
+class SkeletonBuffer16 {
+public:
+    SkeletonBuffer16(UChar *dest, int32_t capacity) : dest(dest), capacity(capacity), length(0) {}
+    void append(UChar32 c) {
+        if (c <= 0xffff) {
+            if (length < capacity) {
+                dest[length] = (UChar)c;
+            }
+            ++length;
+        } else {
+            if ((length + 2) <= capacity) {
+                dest[length] = U16_LEAD(c);
+                dest[length + 1] = U16_TRAIL(c);
+            }
+            length += 2;
+        }
+    }
+    void append(const UChar *s, int32_t sLength) {
+        if ((length + sLength) <= capacity) {
+            u_memcpy(dest + length, s, sLength);
+        }
+        length += sLength;
+    }
+
+    UChar *dest;
+    int32_t capacity;
+    int32_t length;
+};
+
+// Skeleton output into a caller-provided UTF-8 buffer.
+// Counts the full length for preflighting.
+class SkeletonBuffer8 {
+public:
+    SkeletonBuffer8(char *dest, int32_t capacity) : dest(dest), capacity(capacity), length(0) {}
+    void append(UChar32 c) {
+        if ((length + U8_LENGTH(c)) <= capacity) {
+            U8_APPEND_UNSAFE(dest, length, c);
+        } else {
+            length += U8_LENGTH(c);
+        }
+    }
+    void append(const UChar *s, int32_t sLength) {
+        for (int32_t i = 0; i < sLength;) {
+            UChar32 c;
+            U16_NEXT(s, i, sLength, c);
+            append(c);
+        }
+    }
+
+    char *dest;
+    int32_t capacity;
+    int32_t length;
+};
+
+// Skeleton output into a UnicodeString.
+class SkeletonString {
+public:
+    SkeletonString(UnicodeString &dest) : dest(dest) {}
+    void append(UChar32 c) { dest.append(c); }
+    void append(const UChar *s, int32_t sLength) { dest.append(s, sLength); }
+
+    UnicodeString &dest;
+};
+
+// Fast path for skeleton computation:
+// When neither the identifier nor the skeleton strings of its characters
+// contain any character that NFD changes or that has a non-zero combining class,
+// then both NFD passes are no-ops, and the skeleton is just the concatenation
+// of the per-character skeleton strings.
+// Appends the skeleton for c and returns TRUE,
+// or returns FALSE if the identifier needs the full normalizing code path.
+template<typename Sink>
+inline UBool appendInertSkeleton(const SpoofData &data, UChar32 c, Sink &sink) {
+    if (!gNfdImpl->isDecompInert(c)) {
+        return FALSE;
+    }
+    uint32_t value = data.lookupValue(c);
+    if (value == 0) {
+        sink.append(c);
+    } else if ((value & SpoofData::LOOKUP_VALUE_IS_INERT) != 0) {
+        int32_t length;
+        const UChar *skeleton = data.getSkeletonString(value, length);
+        sink.append(skeleton, length);
+    } else {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+template<typename Sink>
+UBool getInertSkeleton(const SpoofData &data, const UChar *id, int32_t length, Sink &sink) {
+    for (int32_t i = 0; i < length;) {
+        UChar32 c;
+        U16_NEXT(id, i, length, c);
+        if (!appendInertSkeleton(data, c, sink)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+// Ill-formed UTF-8 is treated like U+FFFD, like UnicodeString::fromUTF8() does.
+UBool getInertSkeletonUTF8(const SpoofData &data, const char *id, int32_t length,
+                           SkeletonBuffer8 &sink) {
+    for (int32_t i = 0; i < length;) {
+        UChar32 c;
+        U8_NEXT_OR_FFFD(id, i, length, c);
+        if (!appendInertSkeleton(data, c, sink)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+}  // namespace
 
 U_CAPI int32_t U_EXPORT2
 uspoof_getSkeleton(const USpoofChecker *sc,
@@ -670,7 +913,7 @@ uspoof_getSkeleton(const USpoofChecker *sc,
                    UChar *dest, int32_t destCapacity,
                    UErrorCode *status) {
 
-    SpoofImpl::validateThis(sc, *status);
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
     if (U_FAILURE(*status)) {
         return 0;
     }
@@ -679,7 +922,15 @@ uspoof_getSkeleton(const USpoofChecker *sc,
         return 0;
     }
 
-    UnicodeString idStr((length==-1), id, length);  // Aliasing constructor
+    if (length == -1) {
+        length = u_strlen(id);
+    }
+    SkeletonBuffer16 sink(dest, destCapacity);
+    if (getInertSkeleton(*This->fSpoofData, id, length, sink)) {
+        return u_terminateUChars(dest, destCapacity, sink.length, status);
+    }
+
+    UnicodeString idStr(FALSE, id, length);  // Aliasing constructor
     UnicodeString destStr;
     uspoof_getSkeletonUnicodeString(sc, type, idStr, destStr, status);
     destStr.extract(dest, destCapacity, *status);
@@ -699,6 +950,15 @@ uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
         return dest;
     }
 
+    // The fast path writes into dest while reading id; the normalizer handles aliasing.
+    if (&dest != &id && !id.isBogus()) {
+        dest.remove();
+        SkeletonString sink(dest);
+        if (getInertSkeleton(*This->fSpoofData, id.getBuffer(), id.length(), sink)) {
+            return dest;
+        }
+    }
+
     UnicodeString nfdId;
     gNfdNormalizer->normalize(id, nfdId, *status);
 
@@ -724,7 +984,7 @@ uspoof_getSkeletonUTF8(const USpoofChecker *sc,
                        const char *id,  int32_t length,
                        char *dest, int32_t destCapacity,
                        UErrorCode *status) {
-    SpoofImpl::validateThis(sc, *status);
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
     if (U_FAILURE(*status)) {
         return 0;
     }
@@ -733,7 +993,15 @@ uspoof_getSkeletonUTF8(const USpoofChecker *sc,
         return 0;
     }
 
-    UnicodeString srcStr = UnicodeString::fromUTF8(StringPiece(id, length>=0 ? length : static_cast<int32_t>(uprv_strlen(id))));
+    if (length == -1) {
+        length = static_cast<int32_t>(uprv_strlen(id));
+    }
+    SkeletonBuffer8 sink(dest, destCapacity);
+    if (getInertSkeletonUTF8(*This->fSpoofData, id, length, sink)) {
+        return u_terminateChars(dest, destCapacity, sink.length, status);
+    }
+
+    UnicodeString srcStr = UnicodeString::fromUTF8(StringPiece(id, length));
     UnicodeString destStr;
     uspoof_getSkeletonUnicodeString(sc, type, srcStr, destStr, status);
     if (U_FAILURE(*status)) {
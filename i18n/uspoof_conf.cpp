@@ -471,6 +471,8 @@ void ConfusabledataBuilder::outputData(UErrorCode &status) {
     rawData->fCFUStringTable = (int32_t)((char *)strings - (char *)rawData);
     rawData->fCFUStringTableLen = stringsLength;
     fSpoofImpl->fSpoofData->fCFUStrings = strings;
+
+    fSpoofImpl->fSpoofData->initLookupTrie(status);
 }
 
 #endif
@@ -12,9 +12,11 @@
 #include "unicode/uchar.h"
 #include "unicode/uniset.h"
 #include "unicode/utf16.h"
+#include "unicode/umutablecptrie.h"
 #include "utrie2.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "normalizer2impl.h"
 #include "scriptset.h"
 #include "umutex.h"
 #include "udataswp.h"
@@ -615,6 +617,7 @@ SpoofData::SpoofData(UDataMemory *udm, UErrorCode &status)
             const_cast<void *>(udata_getMemory(udm)));
     validateDataVersion(status);
     initPtrs(status);
+    initLookupTrie(status);
 }
 
 
@@ -640,6 +643,7 @@ SpoofData::SpoofData(const void *data, int32_t length, UErrorCode &status)
     }
     validateDataVersion(status);
     initPtrs(status);
+    initLookupTrie(status);
 }
 
 
@@ -685,6 +689,7 @@ void SpoofData::reset() {
    fCFUKeys = NULL;
    fCFUValues = NULL;
    fCFUStrings = NULL;
+   fLookupTrie = NULL;
 }
 
 
@@ -727,6 +732,7 @@ SpoofData::~SpoofData() {
         uprv_free(fRawData);
     }
     fRawData = NULL;
+    ucptrie_close(fLookupTrie);
     if (fUDM != NULL) {
         udata_close(fUDM);
     }
@@ -788,32 +794,59 @@ int32_t SpoofData::size() const {
 //-------------------------------
 
 int32_t SpoofData::confusableLookup(UChar32 inChar, UnicodeString &dest) const {
-    // Perform a binary search.
-    // [lo, hi), i.e lo is inclusive, hi is exclusive.
-    // The result after the loop will be in lo.
-    int32_t lo = 0;
-    int32_t hi = length();
-    do {
-        int32_t mid = (lo + hi) / 2;
-        if (codePointAt(mid) > inChar) {
-            hi = mid;
-        } else if (codePointAt(mid) < inChar) {
-            lo = mid;
-        } else {
-            // Found result.  Break early.
-            lo = mid;
-            break;
-        }
-    } while (hi - lo > 1);
+    uint32_t value = lookupValue(inChar);
 
     // Did we find an entry?  If not, the char maps to itself.
-    if (codePointAt(lo) != inChar) {
+    if (value == 0) {
         dest.append(inChar);
         return 1;
     }
 
     // Add the element to the string builder and return.
-    return appendValueTo(lo, dest);
+    return appendValueTo((int32_t)(value & ~LOOKUP_VALUE_IS_INERT) - 1, dest);
+}
+
+const UChar *SpoofData::getSkeletonString(uint32_t lookupValue, int32_t &length) const {
+    int32_t index = (int32_t)(lookupValue & ~LOOKUP_VALUE_IS_INERT) - 1;
+    length = ConfusableDataUtils::keyToLength(fCFUKeys[index]);
+    // A single-unit skeleton is stored directly in the values table.
+    if (length == 1) {
+        return reinterpret_cast<const UChar *>(fCFUValues + index);
+    } else {
+        return fCFUStrings + fCFUValues[index];
+    }
+}
+
+void SpoofData::initLookupTrie(UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    const Normalizer2Impl *nfcImpl = Normalizer2Factory::getNFCImpl(status);
+    LocalUMutableCPTriePointer mutableTrie(umutablecptrie_open(0, 0, &status));
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t numKeys = length();
+    for (int32_t i = 0; i < numKeys && U_SUCCESS(status); ++i) {
+        uint32_t value = (uint32_t)i + 1;
+        int32_t skeletonLength;
+        const UChar *skeleton = getSkeletonString(value, skeletonLength);
+        UBool isInert = TRUE;
+        for (int32_t j = 0; j < skeletonLength;) {
+            UChar32 c;
+            U16_NEXT(skeleton, j, skeletonLength, c);
+            if (!nfcImpl->isDecompInert(c)) {
+                isInert = FALSE;
+                break;
+            }
+        }
+        if (isInert) {
+            value |= LOOKUP_VALUE_IS_INERT;
+        }
+        umutablecptrie_set(mutableTrie.getAlias(), codePointAt(i), value, &status);
+    }
+    fLookupTrie = umutablecptrie_buildImmutable(
+        mutableTrie.getAlias(), UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_32, &status);
 }
 
 int32_t SpoofData::length() const {
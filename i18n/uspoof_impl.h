@@ -20,6 +20,7 @@
 #include "unicode/uspoof.h"
 #include "unicode/uscript.h"
 #include "unicode/udata.h"
+#include "unicode/ucptrie.h"
 #include "udataswp.h"
 #include "utrie2.h"
 
@@ -147,7 +148,8 @@ class CheckResult : public UObject {
 //        The key table is sorted in ascending code point order.  (not on the
 //        32 bit int value, the flag bits do not participate in the sorting.)
 //
-//        Lookup is done by means of a binary search in the key table.
+//        At load time, SpoofData builds a UCPTrie from the key table,
+//        which maps each code point directly to its key index.
 //
 //    The corresponding values are kept in a parallel array of 16 bit ints.
 //        If the value string is of length 1, it is literally in the value array.
@@ -260,6 +262,25 @@ class SpoofData: public UMemory {
     // @return   The length in UTF-16 code units of the skeleton string.
     int32_t appendValueTo(int32_t index, UnicodeString& dest) const;
 
+    // Flag in a lookupValue(): NFD leaves the skeleton string unchanged,
+    // and all of its characters have combining class 0.
+    static const uint32_t LOOKUP_VALUE_IS_INERT = 0x80000000;
+
+    // Get the lookup trie value for a code point:
+    // 0 if the code point maps to itself, otherwise the index of its
+    // confusable entry plus 1, possibly with LOOKUP_VALUE_IS_INERT set.
+    inline uint32_t lookupValue(UChar32 c) const {
+        return UCPTRIE_FAST_GET(fLookupTrie, UCPTRIE_32, c);
+    }
+
+    // Get the confusable skeleton for a non-zero lookupValue().
+    // @return   A pointer to the skeleton string; not NUL-terminated.
+    const UChar *getSkeletonString(uint32_t lookupValue, int32_t &length) const;
+
+    // Build the lookup trie from the keys table.
+    // Called once the keys, values and strings tables are complete.
+    void initLookupTrie(UErrorCode &status);
+
   private:
     // Reserve space in the raw data.  For use by builder when putting together a
     //   new set of data.  Init the new storage to zero, to prevent inconsistent
@@ -286,6 +307,10 @@ class SpoofData: public UMemory {
     uint16_t                    *fCFUValues;
     UChar                       *fCFUStrings;
 
+    // Direct code point lookup for the confusable entries, built at load time
+    // instead of binary-searching the keys table.
+    UCPTrie                     *fLookupTrie;
+
     friend class ConfusabledataBuilder;
 };
 
@@ -163,6 +163,9 @@ struct UPattern {
           int16_t             defaultShiftSize;
           int16_t             shift[MAX_TABLE_SIZE_];
           int16_t             backShift[MAX_TABLE_SIZE_];
+          // Horspool shifts over pces, indexed by hashFromCE64() of the
+          // target CE at the end of a window; see usearch_search()
+          int16_t             pceShift[MAX_TABLE_SIZE_];
 };
 
 struct UStringSearch {
@@ -21,6 +21,7 @@
 #include "collationdata.h"
 #include "collationfcd.h"
 #include "collationiterator.h"
+#include "collationscratch.h"
 #include "normalizer2impl.h"
 #include "uassert.h"
 #include "utf16collationiterator.h"
@@ -489,6 +490,55 @@ FCDUTF16CollationIterator::normalize(const UChar *from, const UChar *to, UErrorC
     return TRUE;
 }
 
+CollationScratch::~CollationScratch() {}
+
+UBool
+CollationScratch::setText(const CollationData *d, UBool isNumeric, UBool fcd,
+                          const UChar *left, const UChar *leftLimit,
+                          const UChar *right, const UChar *rightLimit,
+                          int32_t equalPrefixLength, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return FALSE; }
+    if(d != data || isNumeric != numeric) {
+        // The iterators cannot switch their data, but the next ones will be
+        // reused again while the same collator is used.
+        leftIter.adoptInstead(NULL);
+        rightIter.adoptInstead(NULL);
+        fcdLeftIter.adoptInstead(NULL);
+        fcdRightIter.adoptInstead(NULL);
+        data = d;
+        numeric = isNumeric;
+    }
+    checkFCD = fcd;
+    const UChar *leftStart = left + equalPrefixLength;
+    const UChar *rightStart = right + equalPrefixLength;
+    if(fcd) {
+        if(fcdLeftIter.isNull()) {
+            fcdLeftIter.adoptInstead(new FCDUTF16CollationIterator(d, isNumeric, NULL, NULL, NULL));
+            fcdRightIter.adoptInstead(new FCDUTF16CollationIterator(d, isNumeric, NULL, NULL, NULL));
+            if(fcdLeftIter.isNull() || fcdRightIter.isNull()) {
+                fcdLeftIter.adoptInstead(NULL);
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return FALSE;
+            }
+        }
+        fcdLeftIter->setText(left, leftStart, leftLimit);
+        fcdRightIter->setText(right, rightStart, rightLimit);
+    } else {
+        if(leftIter.isNull()) {
+            leftIter.adoptInstead(new UTF16CollationIterator(d, isNumeric, NULL, NULL, NULL));
+            rightIter.adoptInstead(new UTF16CollationIterator(d, isNumeric, NULL, NULL, NULL));
+            if(leftIter.isNull() || rightIter.isNull()) {
+                leftIter.adoptInstead(NULL);
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return FALSE;
+            }
+        }
+        leftIter->setText(left, leftStart, leftLimit);
+        rightIter->setText(right, rightStart, rightLimit);
+    }
+    return TRUE;
+}
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_COLLATION
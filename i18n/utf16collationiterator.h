@@ -49,8 +49,14 @@ class U_I18N_API UTF16CollationIterator : public CollationIterator {
     virtual int32_t getOffset() const;
 
     void setText(const UChar *s, const UChar *lim) {
+        setText(s, s, lim);
+    }
+
+    /** Like the constructor: Starts iterating at p, and s..p[ can be used for context. */
+    void setText(const UChar *s, const UChar *p, const UChar *lim) {
         reset();
-        start = pos = s;
+        start = s;
+        pos = p;
         limit = lim;
     }
 
@@ -95,6 +101,19 @@ class U_I18N_API FCDUTF16CollationIterator : public UTF16CollationIterator {
 
     virtual ~FCDUTF16CollationIterator();
 
+    void setText(const UChar *s, const UChar *lim) {
+        setText(s, s, lim);
+    }
+
+    void setText(const UChar *s, const UChar *p, const UChar *lim) {
+        UTF16CollationIterator::setText(s, p, lim);
+        rawStart = s;
+        segmentStart = p;
+        segmentLimit = NULL;
+        rawLimit = lim;
+        checkDir = 1;
+    }
+
     virtual UBool operator==(const CollationIterator &other) const;
 
     virtual void resetToOffset(int32_t newOffset);
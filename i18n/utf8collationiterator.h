@@ -40,6 +40,13 @@ class U_I18N_API UTF8CollationIterator : public CollationIterator {
 
     virtual ~UTF8CollationIterator();
 
+    void setText(const uint8_t *s, int32_t len) {
+        reset();
+        u8 = s;
+        pos = 0;
+        length = len;
+    }
+
     virtual void resetToOffset(int32_t newOffset);
 
     virtual int32_t getOffset() const;
@@ -87,6 +94,12 @@ class U_I18N_API FCDUTF8CollationIterator : public UTF8CollationIterator {
 
     virtual ~FCDUTF8CollationIterator();
 
+    void setText(const uint8_t *s, int32_t len) {
+        UTF8CollationIterator::setText(s, len);
+        state = CHECK_FWD;
+        start = 0;
+    }
+
     virtual void resetToOffset(int32_t newOffset);
 
     virtual int32_t getOffset() const;
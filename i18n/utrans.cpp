@@ -21,11 +21,21 @@
 #include "unicode/unifilt.h"
 #include "unicode/uniset.h"
 #include "unicode/ustring.h"
+#include "unicode/bytestream.h"
+#include "unicode/casemap.h"
+#include "unicode/normalizer2.h"
+#include "unicode/utf8.h"
 #include "unicode/uenum.h"
 #include "unicode/uset.h"
 #include "uenumimp.h"
 #include "cpputils.h"
 #include "rbt.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "nortrans.h"
+#include "tolowtrn.h"
+#include "toupptrn.h"
+#include "ustr_imp.h"
 
 // Following macro is to be followed by <return value>';' or just ';'
 #define utrans_ENTRY(s) if ((s)==NULL || U_FAILURE(*(s))) return
@@ -530,4 +540,87 @@ utrans_getSourceSet(const UTransliterator* trans,
     return fillIn;
 }
 
+static UBool isWellFormedUTF8(const char *s, int32_t length) {
+    int32_t i = 0;
+    while (i < length) {
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if (c < 0) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+U_CAPI int32_t U_EXPORT2
+utrans_transUTF8(const UTransliterator* trans,
+                 const char* src, int32_t srcLength,
+                 char* dest, int32_t destCapacity,
+                 UErrorCode* status) {
+    utrans_ENTRY(status) 0;
+
+    if (trans == NULL || src == NULL || srcLength < -1 ||
+            destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (srcLength < 0) {
+        srcLength = (int32_t)uprv_strlen(src);
+    }
+    // Do not allow overlapping source and destination buffers.
+    if (dest != NULL &&
+            ((src >= dest && src < (dest + destCapacity)) ||
+             (dest >= src && dest < (src + srcLength)))) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const Transliterator *t = reinterpret_cast<const Transliterator *>(trans);
+
+    // Unfiltered case mapping and normalization work on UTF-8 directly.
+    if (t->getFilter() == NULL) {
+        UClassID id = t->getDynamicClassID();
+        if (id == LowercaseTransliterator::getStaticClassID() ||
+                id == UppercaseTransliterator::getStaticClassID() ||
+                id == NormalizationTransliterator::getStaticClassID()) {
+            if (!isWellFormedUTF8(src, srcLength)) {
+                *status = U_INVALID_CHAR_FOUND;
+                return 0;
+            }
+            if (id == LowercaseTransliterator::getStaticClassID()) {
+                return CaseMap::utf8ToLower("", 0, src, srcLength, dest, destCapacity, NULL, *status);
+            } else if (id == UppercaseTransliterator::getStaticClassID()) {
+                return CaseMap::utf8ToUpper("", 0, src, srcLength, dest, destCapacity, NULL, *status);
+            } else {
+                CheckedArrayByteSink sink(dest, destCapacity);
+                static_cast<const NormalizationTransliterator *>(t)->getNormalizer2().normalizeUTF8(
+                    0, StringPiece(src, srcLength), sink, NULL, *status);
+                if (U_FAILURE(*status)) {
+                    return 0;
+                }
+                return u_terminateChars(dest, destCapacity, sink.NumberOfBytesAppended(), status);
+            }
+        }
+    }
+
+    // Other transliterators work on UTF-16 text.
+    // A UTF-8 string never has fewer bytes than its UTF-16 form has units.
+    UnicodeString str;
+    UChar *buffer = str.getBuffer(srcLength);
+    if (buffer == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    int32_t length16 = 0;
+    u_strFromUTF8(buffer, str.getCapacity(), &length16, src, srcLength, status);
+    str.releaseBuffer(U_SUCCESS(*status) ? length16 : 0);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    t->transliterate(str);
+    int32_t length8 = 0;
+    u_strToUTF8WithSub(dest, destCapacity, &length8, str.getBuffer(), str.length(),
+                       0xfffd, NULL, status);
+    return length8;
+}
+
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
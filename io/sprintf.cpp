@@ -258,5 +258,55 @@ u_vsnprintf_u(UChar    *buffer,
     return written;
 }
 
+U_CAPI int32_t U_EXPORT2
+u_snprintf_format(UChar                 *buffer,
+                  int32_t               count,
+                  const UPrintfFormat   *format,
+                  ... )
+{
+    va_list ap;
+    int32_t written;
+
+    va_start(ap, format);
+    written = u_vsnprintf_format(buffer, count, format, ap);
+    va_end(ap);
+
+    return written;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_vsnprintf_format(UChar                *buffer,
+                   int32_t              count,
+                   const UPrintfFormat  *format,
+                   va_list              ap)
+{
+    int32_t          written = 0;   /* haven't written anything yet */
+    int32_t          result = 0;
+
+    u_localized_print_string outStr;
+
+    if (count < 0) {
+        count = INT32_MAX;
+    }
+
+    outStr.str = buffer;
+    outStr.len = count;
+    outStr.available = count;
+
+    /* print the compiled format; it brings its own formatters */
+    result = u_printf_format_compiled(&g_sprintf_stream_handler, format, &outStr, &outStr, &written, ap);
+
+    /* Terminate the buffer, if there's room. */
+    if (outStr.available > 0) {
+        buffer[outStr.len - outStr.available] = 0x0000;
+    }
+
+    if (result < 0) {
+        return result;
+    }
+    /* return # of UChars written */
+    return written;
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
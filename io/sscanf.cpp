@@ -105,10 +105,12 @@ u_vsscanf_u(const UChar *buffer,
 
     inStr.fConverter = NULL;
     inStr.fFile = NULL;
+    inStr.fMapping = NULL;
     inStr.fOwnFile = FALSE;
 #if !UCONFIG_NO_TRANSLITERATION
     inStr.fTranslit = NULL;
 #endif
+    inStr.fUCBuffer = inStr.fUCBufferStorage;
     inStr.fUCBuffer[0] = 0;
     inStr.str.fBuffer = (UChar *)buffer;
     inStr.str.fPos = (UChar *)buffer;
@@ -20,6 +20,10 @@
 ******************************************************************************
 */
 
+/* Defines _XOPEN_SOURCE for access to POSIX functions.
+ * Must be before any other #includes. */
+#include "uposixdefs.h"
+
 #include "unicode/platform.h"
 #if defined(__GNUC__) && !defined(__clang__) && defined(__STRICT_ANSI__)
 // g++, fileno isn't defined                  if     __STRICT_ANSI__ is defined.
@@ -42,6 +46,18 @@
 #include "unicode/ustring.h"
 #include "cstring.h"
 #include "cmemory.h"
+#include "umapfile.h"
+
+#if MAP_IMPLEMENTATION==MAP_POSIX
+#   include <unistd.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+
+#   ifndef MAP_FAILED
+#       define MAP_FAILED ((void*)-1)
+#   endif
+#endif
 
 #if U_PLATFORM_USES_ONLY_WIN32_API && !defined(fileno)
 /* Windows likes to rename Unix-like functions */
@@ -50,6 +66,7 @@
 
 static UFILE*
 finit_owner(FILE         *f,
+              UFILEMapping *mapping,
               const char *locale,
               const char *codepage,
               UBool       takeOwnership
@@ -57,7 +74,7 @@ finit_owner(FILE         *f,
 {
     UErrorCode status = U_ZERO_ERROR;
     UFILE     *result;
-    if(f == NULL) {
+    if(f == NULL && mapping == NULL) {
         return 0;
     }
     result = (UFILE*) uprv_malloc(sizeof(UFILE));
@@ -66,9 +83,13 @@ finit_owner(FILE         *f,
     }
 
     uprv_memset(result, 0, sizeof(UFILE));
-    result->fFileno = fileno(f);
+    /* A mapped file is never stdin. */
+    result->fFileno = f != NULL ? fileno(f) : -1;
     result->fFile = f;
+    result->fMapping = mapping;
 
+    result->fUCBuffer = result->fUCBufferStorage;
+    result->fUCBufferCapacity = UFILE_UCHARBUFFER_SIZE;
     result->str.fBuffer = result->fUCBuffer;
     result->str.fPos    = result->fUCBuffer;
     result->str.fLimit  = result->fUCBuffer;
@@ -108,7 +129,7 @@ u_finit(FILE          *f,
         const char    *locale,
         const char    *codepage)
 {
-    return finit_owner(f, locale, codepage, FALSE);
+    return finit_owner(f, NULL, locale, codepage, FALSE);
 }
 
 U_CAPI UFILE* U_EXPORT2
@@ -116,7 +137,7 @@ u_fadopt(FILE         *f,
         const char    *locale,
         const char    *codepage)
 {
-    return finit_owner(f, locale, codepage, TRUE);
+    return finit_owner(f, NULL, locale, codepage, TRUE);
 }
 
 U_CAPI UFILE* U_EXPORT2 /* U_CAPI ... U_EXPORT2 added by Peter Kirk 17 Nov 2001 */
@@ -131,7 +152,7 @@ u_fopen(const char    *filename,
         return 0;
     }
 
-    result = finit_owner(systemFile, locale, codepage, TRUE);
+    result = finit_owner(systemFile, NULL, locale, codepage, TRUE);
 
     if (!result) {
         /* Something bad happened.
@@ -163,7 +184,7 @@ u_fopen_u(const UChar   *filename,
         mbstowcs_s(&retVal, wperm, UPRV_LENGTHOF(wperm), perm, _TRUNCATE);
         FILE *systemFile = _wfopen((const wchar_t *)filename, wperm);
         if (systemFile) {
-            result = finit_owner(systemFile, locale, codepage, TRUE);
+            result = finit_owner(systemFile, NULL, locale, codepage, TRUE);
         }
         if (!result) {
             /* Something bad happened.
@@ -175,6 +196,73 @@ u_fopen_u(const UChar   *filename,
     return result; /* not a file leak */
 }
 
+static void
+ufile_unmap(UFILEMapping *mapping)
+{
+#if MAP_IMPLEMENTATION==MAP_POSIX
+    if (mapping->start != NULL) {
+        munmap((void *)mapping->start, (size_t)(mapping->limit - mapping->start));
+    }
+#endif
+    uprv_free(mapping);
+}
+
+U_CAPI UFILE* U_EXPORT2
+u_fopen_mapped(const char    *filename,
+               const char    *locale,
+               const char    *codepage)
+{
+#if MAP_IMPLEMENTATION==MAP_POSIX
+    UFILEMapping *mapping;
+    UFILE        *result;
+    struct stat  mystat;
+    void         *data = NULL;
+    int          fd;
+
+    fd = open(filename, O_RDONLY);
+    if (fd == -1) {
+        return 0;
+    }
+    if (fstat(fd, &mystat) != 0 || !S_ISREG(mystat.st_mode)) {
+        /* Pipes and devices cannot be mapped. */
+        close(fd);
+        return u_fopen(filename, "r", locale, codepage);
+    }
+    if (mystat.st_size > 0) {
+        data = mmap(0, (size_t)mystat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd); /* no longer needed */
+    if (data == MAP_FAILED) {
+        return u_fopen(filename, "r", locale, codepage);
+    }
+#if defined(POSIX_MADV_SEQUENTIAL)
+    if (data != NULL) {
+        posix_madvise(data, (size_t)mystat.st_size, POSIX_MADV_SEQUENTIAL);
+    }
+#endif
+
+    mapping = (UFILEMapping*) uprv_malloc(sizeof(UFILEMapping));
+    if (mapping == NULL) {
+        if (data != NULL) {
+            munmap(data, (size_t)mystat.st_size);
+        }
+        return 0;
+    }
+    mapping->start = (const char *)data;
+    mapping->pos   = mapping->start;
+    mapping->limit = mapping->start + (data != NULL ? mystat.st_size : 0);
+
+    result = finit_owner(NULL, mapping, locale, codepage, FALSE);
+    if (!result) {
+        ufile_unmap(mapping);
+    }
+    return result;
+#else
+    /* No memory mapping on this platform: read through stdio instead. */
+    return u_fopen(filename, "r", locale, codepage);
+#endif
+}
+
 U_CAPI UFILE* U_EXPORT2
 u_fstropen(UChar *stringBuf,
            int32_t      capacity,
@@ -219,6 +307,9 @@ u_feof(UFILE  *f)
     if (f->fFile != NULL) {
         return endOfBuffer && feof(f->fFile);
     }
+    if (f->fMapping != NULL) {
+        return endOfBuffer && f->fMapping->pos >= f->fMapping->limit;
+    }
     return endOfBuffer;
 }
 
@@ -230,6 +321,9 @@ u_fflush(UFILE *file)
     if (file->fFile) {
         fflush(file->fFile);
     }
+    else if (file->fMapping) {
+        /* Nothing is ever written to a mapped file. */
+    }
     else if (file->str.fPos < file->str.fLimit) {
         *(file->str.fPos++) = 0;
     }
@@ -246,6 +340,11 @@ u_frewind(UFILE *file)
         file->str.fLimit = file->fUCBuffer;
         file->str.fPos   = file->fUCBuffer;
     }
+    else if (file->fMapping) {
+        file->fMapping->pos = file->fMapping->start;
+        file->str.fLimit = file->fUCBuffer;
+        file->str.fPos   = file->fUCBuffer;
+    }
     else {
         file->str.fPos = file->str.fBuffer;
     }
@@ -260,6 +359,11 @@ u_fclose(UFILE *file)
 
         if(file->fOwnFile)
             fclose(file->fFile);
+        if(file->fMapping)
+            ufile_unmap(file->fMapping);
+        if(file->fUCBuffer != file->fUCBufferStorage)
+            uprv_free(file->fUCBuffer);
+        uprv_free(file->fCharBuffer);
 
 #if !UCONFIG_NO_FORMATTING
         u_locbund_close(&file->str.fBundle);
@@ -327,6 +431,57 @@ u_fsetcodepage(    const char    *codepage,
     return retVal;
 }
 
+U_CAPI void U_EXPORT2
+u_fsetbuffersize(UFILE      *file,
+                 int32_t    capacity,
+                 UErrorCode *status)
+{
+    UChar *ucBuffer;
+    char  *charBuffer;
+
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (file == NULL || capacity < UFILE_MIN_BUFFER_SIZE
+        || (file->fFile == NULL && file->fMapping == NULL))
+    {
+        /* A string UFILE reads and writes the caller's buffer directly. */
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if ((file->str.fPos != file->str.fBuffer) || (file->str.fLimit != file->str.fBuffer)) {
+        /* Buffered input would be lost. */
+        *status = U_INVALID_STATE_ERROR;
+        return;
+    }
+
+    if (capacity == UFILE_UCHARBUFFER_SIZE) {
+        ucBuffer = file->fUCBufferStorage;
+        charBuffer = NULL;
+    }
+    else {
+        ucBuffer = (UChar *)uprv_malloc(capacity * sizeof(UChar));
+        charBuffer = (char *)uprv_malloc(capacity);
+        if (ucBuffer == NULL || charBuffer == NULL) {
+            uprv_free(ucBuffer);
+            uprv_free(charBuffer);
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+
+    if (file->fUCBuffer != file->fUCBufferStorage) {
+        uprv_free(file->fUCBuffer);
+    }
+    uprv_free(file->fCharBuffer);
+    file->fUCBuffer = ucBuffer;
+    file->fUCBufferCapacity = capacity;
+    file->fCharBuffer = charBuffer;
+    file->fCharBufferCapacity = charBuffer != NULL ? capacity : 0;
+    file->str.fBuffer = ucBuffer;
+    file->str.fPos    = ucBuffer;
+    file->str.fLimit  = ucBuffer;
+}
 
 U_CAPI UConverter * U_EXPORT2 /* U_CAPI ... U_EXPORT2 added by Peter Kirk 17 Nov 2001 */
 u_fgetConverter(UFILE *file)
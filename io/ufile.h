@@ -37,6 +37,9 @@
 /* The buffer size for toUnicode calls */
 #define UFILE_UCHARBUFFER_SIZE 1024
 
+/* The smallest capacity accepted by u_fsetbuffersize() */
+#define UFILE_MIN_BUFFER_SIZE 64
+
 /* A UFILE */
 
 #if !UCONFIG_NO_TRANSLITERATION
@@ -51,6 +54,12 @@ typedef struct {
 
 #endif
 
+typedef struct {
+    const char  *start;         /* Beginning of the mapped file, or NULL if it is empty */
+    const char  *pos;           /* Beginning of unconverted data */
+    const char  *limit;         /* End of the mapped file */
+} UFILEMapping;
+
 typedef struct u_localized_string {
     UChar       *fPos;          /* current pos in fUCBuffer */
     const UChar *fLimit;        /* data limit in fUCBuffer */
@@ -68,11 +77,21 @@ struct UFILE {
 
     FILE        *fFile;         /* the actual filesystem interface */
 
+    UFILEMapping *fMapping;     /* read-only file mapping used instead of fFile, or NULL */
+
     UConverter  *fConverter;    /* for codeset conversion */
 
     u_localized_string str;     /* struct to handle strings for number formatting */
 
-    UChar       fUCBuffer[UFILE_UCHARBUFFER_SIZE];/* buffer used for toUnicode */
+    UChar       *fUCBuffer;     /* buffer used for toUnicode: fUCBufferStorage or heap-allocated */
+
+    int32_t     fUCBufferCapacity;
+
+    char        *fCharBuffer;   /* heap buffer for codepage bytes, or NULL to use the stack */
+
+    int32_t     fCharBufferCapacity;
+
+    UChar       fUCBufferStorage[UFILE_UCHARBUFFER_SIZE];
 
     UBool       fOwnFile;       /* TRUE if fFile should be closed */
 
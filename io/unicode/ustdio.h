@@ -268,6 +268,30 @@ u_fopen_u(const UChar    *filename,
     const char    *locale,
     const char    *codepage);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Open a UFILE for reading through a read-only memory mapping of the file.
+ * Input is converted to Unicode directly from the mapped bytes, without
+ * intermediate reads into a stdio buffer, which suits large sequential reads.
+ * Nothing can be written to the returned UFILE, and <TT>u_fgetfile</TT>
+ * returns NULL for it.
+ * Where the file cannot be mapped, for example on platforms without memory
+ * mapping or for pipes, this behaves like <TT>u_fopen(filename, "r", ...)</TT>.
+ * @param filename The name of the file to open.
+ * @param locale The locale whose conventions will be used to parse input.
+ * If this parameter is NULL, the default locale will be used.
+ * @param codepage The codepage in which data will be read from the file.
+ * If this paramter is NULL the system default codepage will be used.
+ * @return A new UFILE, or NULL if an error occurred.
+ * @see u_fopen
+ * @draft ICU 64
+ */
+U_DRAFT UFILE* U_EXPORT2
+u_fopen_mapped(const char    *filename,
+    const char    *locale,
+    const char    *codepage);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Open a UFILE on top of an existing FILE* stream. The FILE* stream
  * ownership remains with the caller. To have the UFILE take over
@@ -456,6 +480,28 @@ U_STABLE int32_t U_EXPORT2
 u_fsetcodepage(const char   *codepage,
                UFILE        *file);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Set the size of the buffers used to convert data read from and written
+ * to the UFILE. The default is 1024; larger buffers mean fewer conversion
+ * and stdio calls per amount of data. Like <TT>u_fsetcodepage</TT>, this
+ * should only be called right after opening the <TT>UFile</TT>, or after
+ * calling <TT>u_frewind</TT>.
+ * @param file The UFILE to set. It must not have been opened with
+ * <TT>u_fstropen</TT>.
+ * @param capacity The number of UChars buffered for input, and the number
+ * of bytes converted at a time for output. Must be at least 64.
+ * @param status ICU error code. Set to U_ILLEGAL_ARGUMENT_ERROR for a string
+ * UFILE or a capacity that is too small, and to U_INVALID_STATE_ERROR if
+ * input has already been buffered.
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+u_fsetbuffersize(UFILE      *file,
+                 int32_t    capacity,
+                 UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /**
  * Returns an alias to the converter being used for this file.
@@ -565,6 +611,98 @@ U_STABLE int32_t U_EXPORT2
 u_vfprintf_u(UFILE      *f,
             const UChar *patternSpecification,
             va_list     ap);
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * A u_printf pattern that has been parsed once, for repeated formatting
+ * with <TT>u_snprintf_format</TT> or <TT>u_fprintf_format</TT>.
+ * @draft ICU 64
+ */
+typedef struct UPrintfFormat UPrintfFormat;
+
+/**
+ * Compile a u_printf pattern. The pattern is parsed once, and the number
+ * formatters for the %d, %i, %u and %f conversions are built up front, so
+ * that formatting with the result does not reparse the pattern or adjust a
+ * shared number format for each conversion.
+ * Positional and sequential arguments can not be mixed, and every positional
+ * argument up to the highest one must be used.
+ * A UPrintfFormat is not modified by formatting, and can be used from
+ * several threads at once.
+ * @param pattern The u_printf pattern.
+ * @param patternLength The length of the pattern, or -1 if it is NUL-terminated.
+ * @param locale The locale whose formatting conventions are used for all
+ * conversions, or NULL to format like <TT>u_sprintf</TT> does.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The compiled format, or NULL on failure.
+ * It must be closed with <TT>u_printf_closeFormat</TT>.
+ * @see u_snprintf_format
+ * @see u_fprintf_format
+ * @draft ICU 64
+ */
+U_DRAFT UPrintfFormat * U_EXPORT2
+u_printf_openFormat(const UChar *pattern,
+                    int32_t     patternLength,
+                    const char  *locale,
+                    UErrorCode  *status);
+
+/**
+ * Close a compiled u_printf pattern.
+ * @param format The UPrintfFormat to close. May be NULL.
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+u_printf_closeFormat(UPrintfFormat *format);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUPrintfFormatPointer
+ * "Smart pointer" class, closes a UPrintfFormat via u_printf_closeFormat().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 64
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUPrintfFormatPointer, UPrintfFormat, u_printf_closeFormat);
+
+U_NAMESPACE_END
+
+#endif
+
+/**
+ * Write formatted data to a UFILE, using a compiled pattern.
+ * The conversions use the locale of the compiled pattern, not the one of the UFILE.
+ * @param f The UFILE to which to write.
+ * @param format The compiled pattern, see <TT>u_printf_openFormat</TT>.
+ * @return The number of Unicode characters written to <TT>f</TT>.
+ * @see u_fprintf_u
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+u_fprintf_format(UFILE                  *f,
+                 const UPrintfFormat    *format,
+                 ... );
+
+/**
+ * Write formatted data to a UFILE, using a compiled pattern.
+ * This is identical to <TT>u_fprintf_format</TT>, except that it will
+ * <EM>not</EM> call <TT>va_start</TT> and <TT>va_end</TT>.
+ * @param f The UFILE to which to write.
+ * @param format The compiled pattern, see <TT>u_printf_openFormat</TT>.
+ * @param ap The argument list to use.
+ * @return The number of Unicode characters written to <TT>f</TT>.
+ * @see u_fprintf_format
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+u_vfprintf_format(UFILE                 *f,
+                  const UPrintfFormat   *format,
+                  va_list               ap);
+#endif  /* U_HIDE_DRAFT_API */
 #endif
 /**
  * Write a Unicode to a UFILE.  The null (U+0000) terminated UChar*
@@ -607,6 +745,27 @@ u_file_write(const UChar    *ustring,
              int32_t        count, 
              UFILE          *f);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Write UTF-8 text to a UFILE.
+ * If the UFILE's codepage is UTF-8 and no transliterator is set, the bytes
+ * are written to the underlying FILE* unchanged, without a round trip
+ * through UTF-16; ill-formed sequences are then written as they are.
+ * Otherwise the text is converted to Unicode, with ill-formed sequences
+ * replaced by U+FFFD, and written as with <TT>u_file_write</TT>.
+ * @param s A pointer to the UTF-8 data to write.
+ * @param length The number of bytes to write, or -1 if s is NUL-terminated.
+ * @param f The UFILE to which to write.
+ * @return The number of bytes of s that were written.
+ * @see u_file_write
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+u_file_write_utf8(const char    *s,
+                  int32_t       length,
+                  UFILE         *f);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /* Input functions */
 #if !UCONFIG_NO_FORMATTING
@@ -940,6 +1099,48 @@ u_vsnprintf_u(UChar *buffer,
         const UChar     *patternSpecification,
         va_list         ap);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Write formatted data to a Unicode string, using a compiled pattern.
+ * When the number of code units required to store the data exceeds
+ * <TT>count</TT>, then <TT>count</TT> code units of data are stored in
+ * <TT>buffer</TT> and a negative value is returned, as with <TT>u_snprintf_u</TT>.
+ *
+ * @param buffer The Unicode string to which to write.
+ * @param count The number of code units to read.
+ * @param format The compiled pattern, see <TT>u_printf_openFormat</TT>.
+ * @return The number of Unicode characters that would have been written to
+ * <TT>buffer</TT> had count been sufficiently large.
+ * @see u_snprintf_u
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+u_snprintf_format(UChar                 *buffer,
+                  int32_t               count,
+                  const UPrintfFormat   *format,
+                  ... );
+
+/**
+ * Write formatted data to a Unicode string, using a compiled pattern.
+ * This is identical to <TT>u_snprintf_format</TT>, except that it will
+ * <EM>not</EM> call <TT>va_start</TT> and <TT>va_end</TT>.
+ *
+ * @param buffer The Unicode string to which to write.
+ * @param count The number of code units to read.
+ * @param format The compiled pattern, see <TT>u_printf_openFormat</TT>.
+ * @param ap The argument list to use.
+ * @return The number of Unicode characters that would have been written to
+ * <TT>buffer</TT> had count been sufficiently large.
+ * @see u_snprintf_format
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+u_vsnprintf_format(UChar                *buffer,
+                   int32_t              count,
+                   const UPrintfFormat  *format,
+                   va_list              ap);
+#endif  /* U_HIDE_DRAFT_API */
+
 /* Input string functions */
 
 /**
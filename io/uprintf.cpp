@@ -215,5 +215,34 @@ u_vfprintf_u(    UFILE        *f,
     return written;
 }
 
+U_CAPI int32_t U_EXPORT2
+u_fprintf_format(UFILE                  *f,
+                 const UPrintfFormat    *format,
+                 ...)
+{
+    va_list ap;
+    int32_t count;
+
+    va_start(ap, format);
+    count = u_vfprintf_format(f, format, ap);
+    va_end(ap);
+
+    return count;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_vfprintf_format(UFILE                 *f,
+                  const UPrintfFormat   *format,
+                  va_list               ap)
+{
+    int32_t          written = 0;   /* haven't written anything yet */
+
+    /* print the compiled format; it brings its own formatters */
+    u_printf_format_compiled(&g_stream_handler, format, f, NULL, &written, ap);
+
+    /* return # of UChars written */
+    return written;
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
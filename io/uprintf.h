@@ -98,6 +98,24 @@ u_printf_parse(const u_printf_stream_handler *streamHandler,
                int32_t         *written,
                va_list         ap);
 
+/**
+ * Format a u_printf format string that was compiled with u_printf_openFormat().
+ * The arguments are read as by u_printf_parse(), and the same handlers are used,
+ * except that %d, %i, %u and %f use the number formatters bound at compile time.
+ * Conversions that need a ULocaleBundle use one for the format's locale.
+ * @param format The compiled format.
+ * @param locStringContext If present, will make sure that it will only write
+ *          to the buffer when space is available.
+ * @return 0, or a negative value if the arguments could not be read.
+ */
+U_CFUNC int32_t
+u_printf_format_compiled(const u_printf_stream_handler *streamHandler,
+                         const UPrintfFormat *format,
+                         void            *context,
+                         u_localized_print_string *locStringContext,
+                         int32_t         *written,
+                         va_list         ap);
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 #endif
@@ -25,11 +25,17 @@
 
 #include "unicode/ustring.h"
 #include "unicode/utf16.h"
+#include "unicode/decimfmt.h"
+#include "unicode/localpointer.h"
+#include "unicode/numberformatter.h"
 #include "uprintf.h"
 #include "ufmt_cmn.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "putilimp.h"
 
+U_NAMESPACE_USE
+
 /* ANSI style formatting */
 /* Use US-ASCII characters only for formatting */
 
@@ -1217,267 +1223,278 @@ static ufmt_args* parseArguments(const UChar *alias, va_list ap, UErrorCode *sta
     return arglist;
 }
 
-/* We parse the argument list in Unicode */
-U_CFUNC int32_t
-u_printf_parse(const u_printf_stream_handler *streamHandler,
-               const UChar     *fmt,
-               void            *context,
-               u_localized_print_string *locStringContext,
-               ULocaleBundle   *formatBundle,
-               int32_t         *written,
-               va_list         ap)
+/* Parses one format specification, starting after its '%'. Returns the position after the specifier letter. */
+static const UChar *
+u_printf_parse_spec(const UChar *alias, u_printf_spec *spec)
 {
-    uint16_t         handlerNum;
-    ufmt_args        args;
-    ufmt_type_info   argType;
-    u_printf_handler *handler;
-    u_printf_spec    spec;
-    u_printf_spec_info *info = &(spec.fInfo);
-
-    const UChar *alias = fmt;
+    u_printf_spec_info *info = &(spec->fInfo);
     const UChar *backup;
-    const UChar *lastAlias;
-    const UChar *orgAlias = fmt;
-    /* parsed argument list */
-    ufmt_args *arglist = NULL; /* initialized it to avoid compiler warnings */
-    UErrorCode status = U_ZERO_ERROR;
-    if (!locStringContext || locStringContext->available >= 0) {
-        /* get the parsed list of argument types */
-        arglist = parseArguments(orgAlias, ap, &status);
 
-        /* Return error if parsing failed. */
-        if (U_FAILURE(status)) {
-            return -1;
-        }
-    }
-    
-    /* iterate through the pattern */
-    while(!locStringContext || locStringContext->available >= 0) {
+    /* initialize spec to default values */
+    spec->fWidthPos     = -1;
+    spec->fPrecisionPos = -1;
+    spec->fArgPos       = -1;
 
-        /* find the next '%' */
-        lastAlias = alias;
-        while(*alias != UP_PERCENT && *alias != 0x0000) {
-            alias++;
+    uprv_memset(info, 0, sizeof(*info));
+    info->fPrecision    = -1;
+    info->fWidth        = -1;
+    info->fPadChar      = 0x0020;
+
+
+    /* Check for positional argument */
+    if(ISDIGIT(*alias)) {
+
+        /* Save the current position */
+        backup = alias;
+
+        /* handle positional parameters */
+        if(ISDIGIT(*alias)) {
+            spec->fArgPos = (int) (*alias++ - DIGIT_ZERO);
+
+            while(ISDIGIT(*alias)) {
+                spec->fArgPos *= 10;
+                spec->fArgPos += (int) (*alias++ - DIGIT_ZERO);
+            }
         }
 
-        /* write any characters before the '%' */
-        if(alias > lastAlias) {
-            *written += (streamHandler->write)(context, lastAlias, (int32_t)(alias - lastAlias));
+        /* if there is no '$', don't read anything */
+        if(*alias != SPEC_DOLLARSIGN) {
+            spec->fArgPos = -1;
+            alias = backup;
         }
+        /* munge the '$' */
+        else
+            alias++;
+    }
 
-        /* break if at end of string */
-        if(*alias == 0x0000) {
+    /* Get any format flags */
+    while(ISFLAG(*alias)) {
+        switch(*alias++) {
+
+            /* left justify */
+        case FLAG_MINUS:
+            info->fLeft = TRUE;
             break;
-        }
 
-        /* initialize spec to default values */
-        spec.fWidthPos     = -1;
-        spec.fPrecisionPos = -1;
-        spec.fArgPos       = -1;
+            /* always show sign */
+        case FLAG_PLUS:
+            info->fShowSign = TRUE;
+            break;
 
-        uprv_memset(info, 0, sizeof(*info));
-        info->fPrecision    = -1;
-        info->fWidth        = -1;
-        info->fPadChar      = 0x0020;
+            /* use space if no sign present */
+        case FLAG_SPACE:
+            info->fShowSign = TRUE;
+            info->fSpace = TRUE;
+            break;
 
-        /* skip over the initial '%' */
-        alias++;
+            /* use alternate form */
+        case FLAG_POUND:
+            info->fAlt = TRUE;
+            break;
 
-        /* Check for positional argument */
-        if(ISDIGIT(*alias)) {
+            /* pad with leading zeroes */
+        case FLAG_ZERO:
+            info->fZero = TRUE;
+            info->fPadChar = 0x0030;
+            break;
 
-            /* Save the current position */
-            backup = alias;
+            /* pad character specified */
+        case FLAG_PAREN:
 
-            /* handle positional parameters */
-            if(ISDIGIT(*alias)) {
-                spec.fArgPos = (int) (*alias++ - DIGIT_ZERO);
+            /* TODO test that all four are numbers */
+            /* first four characters are hex values for pad char */
+            info->fPadChar = (UChar)ufmt_digitvalue(*alias++);
+            info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
+            info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
+            info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
 
-                while(ISDIGIT(*alias)) {
-                    spec.fArgPos *= 10;
-                    spec.fArgPos += (int) (*alias++ - DIGIT_ZERO);
-                }
-            }
+            /* final character is ignored */
+            alias++;
 
-            /* if there is no '$', don't read anything */
-            if(*alias != SPEC_DOLLARSIGN) {
-                spec.fArgPos = -1;
-                alias = backup;
-            }
-            /* munge the '$' */
-            else
-                alias++;
+            break;
         }
+    }
 
-        /* Get any format flags */
-        while(ISFLAG(*alias)) {
-            switch(*alias++) {
+    /* Get the width */
 
-                /* left justify */
-            case FLAG_MINUS:
-                info->fLeft = TRUE;
-                break;
-
-                /* always show sign */
-            case FLAG_PLUS:
-                info->fShowSign = TRUE;
-                break;
-
-                /* use space if no sign present */
-            case FLAG_SPACE:
-                info->fShowSign = TRUE;
-                info->fSpace = TRUE;
-                break;
-
-                /* use alternate form */
-            case FLAG_POUND:
-                info->fAlt = TRUE;
-                break;
-
-                /* pad with leading zeroes */
-            case FLAG_ZERO:
-                info->fZero = TRUE;
-                info->fPadChar = 0x0030;
-                break;
-
-                /* pad character specified */
-            case FLAG_PAREN:
-
-                /* TODO test that all four are numbers */
-                /* first four characters are hex values for pad char */
-                info->fPadChar = (UChar)ufmt_digitvalue(*alias++);
-                info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
-                info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
-                info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
-
-                /* final character is ignored */
-                alias++;
+    /* width is specified out of line */
+    if(*alias == SPEC_ASTERISK) {
 
-                break;
+        info->fWidth = -2;
+
+        /* Skip the '*' */
+        alias++;
+
+        /* Save the current position */
+        backup = alias;
+
+        /* handle positional parameters */
+        if(ISDIGIT(*alias)) {
+            spec->fWidthPos = (int) (*alias++ - DIGIT_ZERO);
+
+            while(ISDIGIT(*alias)) {
+                spec->fWidthPos *= 10;
+                spec->fWidthPos += (int) (*alias++ - DIGIT_ZERO);
             }
         }
 
-        /* Get the width */
+        /* if there is no '$', don't read anything */
+        if(*alias != SPEC_DOLLARSIGN) {
+            spec->fWidthPos = -1;
+            alias = backup;
+        }
+        /* munge the '$' */
+        else
+            alias++;
+    }
+    /* read the width, if present */
+    else if(ISDIGIT(*alias)){
+        info->fWidth = (int) (*alias++ - DIGIT_ZERO);
+
+        while(ISDIGIT(*alias)) {
+            info->fWidth *= 10;
+            info->fWidth += (int) (*alias++ - DIGIT_ZERO);
+        }
+    }
+
+    /* Get the precision */
+
+    if(*alias == SPEC_PERIOD) {
+
+        /* eat up the '.' */
+        alias++;
 
-        /* width is specified out of line */
+        /* precision is specified out of line */
         if(*alias == SPEC_ASTERISK) {
 
-            info->fWidth = -2;
+            info->fPrecision = -2;
 
             /* Skip the '*' */
             alias++;
 
-            /* Save the current position */
+            /* save the current position */
             backup = alias;
 
             /* handle positional parameters */
             if(ISDIGIT(*alias)) {
-                spec.fWidthPos = (int) (*alias++ - DIGIT_ZERO);
+                spec->fPrecisionPos = (int) (*alias++ - DIGIT_ZERO);
 
                 while(ISDIGIT(*alias)) {
-                    spec.fWidthPos *= 10;
-                    spec.fWidthPos += (int) (*alias++ - DIGIT_ZERO);
+                    spec->fPrecisionPos *= 10;
+                    spec->fPrecisionPos += (int) (*alias++ - DIGIT_ZERO);
                 }
-            }
 
-            /* if there is no '$', don't read anything */
-            if(*alias != SPEC_DOLLARSIGN) {
-                spec.fWidthPos = -1;
-                alias = backup;
+                /* if there is no '$', don't read anything */
+                if(*alias != SPEC_DOLLARSIGN) {
+                    spec->fPrecisionPos = -1;
+                    alias = backup;
+                }
+                else {
+                    /* munge the '$' */
+                    alias++;
+                }
             }
-            /* munge the '$' */
-            else
-                alias++;
         }
-        /* read the width, if present */
+        /* read the precision */
         else if(ISDIGIT(*alias)){
-            info->fWidth = (int) (*alias++ - DIGIT_ZERO);
+            info->fPrecision = (int) (*alias++ - DIGIT_ZERO);
 
             while(ISDIGIT(*alias)) {
-                info->fWidth *= 10;
-                info->fWidth += (int) (*alias++ - DIGIT_ZERO);
+                info->fPrecision *= 10;
+                info->fPrecision += (int) (*alias++ - DIGIT_ZERO);
             }
         }
+    }
 
-        /* Get the precision */
-
-        if(*alias == SPEC_PERIOD) {
-
-            /* eat up the '.' */
-            alias++;
-
-            /* precision is specified out of line */
-            if(*alias == SPEC_ASTERISK) {
+    /* Get any modifiers */
+    if(ISMOD(*alias)) {
+        switch(*alias++) {
 
-                info->fPrecision = -2;
+            /* short */
+        case MOD_H:
+            info->fIsShort = TRUE;
+            break;
 
-                /* Skip the '*' */
+            /* long or long long */
+        case MOD_LOWERL:
+            if(*alias == MOD_LOWERL) {
+                info->fIsLongLong = TRUE;
+                /* skip over the next 'l' */
                 alias++;
+            }
+            else
+                info->fIsLong = TRUE;
+            break;
 
-                /* save the current position */
-                backup = alias;
+            /* long double */
+        case MOD_L:
+            info->fIsLongDouble = TRUE;
+            break;
+        }
+    }
 
-                /* handle positional parameters */
-                if(ISDIGIT(*alias)) {
-                    spec.fPrecisionPos = (int) (*alias++ - DIGIT_ZERO);
+    /* finally, get the specifier letter */
+    info->fSpec = *alias++;
+    info->fOrigSpec = info->fSpec;
 
-                    while(ISDIGIT(*alias)) {
-                        spec.fPrecisionPos *= 10;
-                        spec.fPrecisionPos += (int) (*alias++ - DIGIT_ZERO);
-                    }
+    return alias;
+}
 
-                    /* if there is no '$', don't read anything */
-                    if(*alias != SPEC_DOLLARSIGN) {
-                        spec.fPrecisionPos = -1;
-                        alias = backup;
-                    }
-                    else {
-                        /* munge the '$' */
-                        alias++;
-                    }
-                }
-            }
-            /* read the precision */
-            else if(ISDIGIT(*alias)){
-                info->fPrecision = (int) (*alias++ - DIGIT_ZERO);
+/* We parse the argument list in Unicode */
+U_CFUNC int32_t
+u_printf_parse(const u_printf_stream_handler *streamHandler,
+               const UChar     *fmt,
+               void            *context,
+               u_localized_print_string *locStringContext,
+               ULocaleBundle   *formatBundle,
+               int32_t         *written,
+               va_list         ap)
+{
+    uint16_t         handlerNum;
+    ufmt_args        args;
+    ufmt_type_info   argType;
+    u_printf_handler *handler;
+    u_printf_spec    spec;
+    u_printf_spec_info *info = &(spec.fInfo);
 
-                while(ISDIGIT(*alias)) {
-                    info->fPrecision *= 10;
-                    info->fPrecision += (int) (*alias++ - DIGIT_ZERO);
-                }
-            }
+    const UChar *alias = fmt;
+    const UChar *lastAlias;
+    const UChar *orgAlias = fmt;
+    /* parsed argument list */
+    ufmt_args *arglist = NULL; /* initialized it to avoid compiler warnings */
+    UErrorCode status = U_ZERO_ERROR;
+    if (!locStringContext || locStringContext->available >= 0) {
+        /* get the parsed list of argument types */
+        arglist = parseArguments(orgAlias, ap, &status);
+
+        /* Return error if parsing failed. */
+        if (U_FAILURE(status)) {
+            return -1;
         }
+    }
+    
+    /* iterate through the pattern */
+    while(!locStringContext || locStringContext->available >= 0) {
 
-        /* Get any modifiers */
-        if(ISMOD(*alias)) {
-            switch(*alias++) {
+        /* find the next '%' */
+        lastAlias = alias;
+        while(*alias != UP_PERCENT && *alias != 0x0000) {
+            alias++;
+        }
 
-                /* short */
-            case MOD_H:
-                info->fIsShort = TRUE;
-                break;
+        /* write any characters before the '%' */
+        if(alias > lastAlias) {
+            *written += (streamHandler->write)(context, lastAlias, (int32_t)(alias - lastAlias));
+        }
 
-                /* long or long long */
-            case MOD_LOWERL:
-                if(*alias == MOD_LOWERL) {
-                    info->fIsLongLong = TRUE;
-                    /* skip over the next 'l' */
-                    alias++;
-                }
-                else
-                    info->fIsLong = TRUE;
-                break;
-
-                /* long double */
-            case MOD_L:
-                info->fIsLongDouble = TRUE;
-                break;
-            }
+        /* break if at end of string */
+        if(*alias == 0x0000) {
+            break;
         }
 
-        /* finally, get the specifier letter */
-        info->fSpec = *alias++;
-        info->fOrigSpec = info->fSpec;
+        /* skip over the initial '%' */
+        alias++;
+        alias = u_printf_parse_spec(alias, &spec);
 
         /* fill in the precision and width, if specified out of line */
 
@@ -1603,4 +1620,521 @@ u_printf_parse(const u_printf_stream_handler *streamHandler,
     return (int32_t)(alias - fmt);
 }
 
+/* Compiled formats --------------------------------------------------------- */
+
+/**
+ * One conversion of a compiled format, together with the literal text
+ * in front of it. The last segment may have literal text only.
+ */
+typedef struct u_printf_segment {
+    int32_t         fLiteralStart;  /* Offset of the literal text in the pattern */
+    int32_t         fLiteralLength;
+    int32_t         fSpecStart;     /* Offset of the '%', for echoing unknown tags */
+    int32_t         fSpecLength;    /* 0 if there is no conversion */
+    u_printf_spec   fSpec;
+    int32_t         fArgSlot;       /* Argument list index of the value, or -1 */
+    int32_t         fWidthSlot;     /* Argument list index of a '*' width, or -1 */
+    int32_t         fPrecisionSlot; /* Argument list index of a '*' precision, or -1 */
+    const u_printf_info *fInfo;     /* NULL for unknown tags */
+    number::LocalizedNumberFormatter *fFormatter; /* Bound number formatter, or NULL */
+    UNumberFormat   *fNumberFormat; /* The DecimalFormat that fFormatter refers to */
+} u_printf_segment;
+
+struct UPrintfFormat : public UMemory {
+    UPrintfFormat() : fPattern(NULL), fSegments(NULL), fSegmentCount(0),
+        fArgTypes(NULL), fArgIsLongLong(NULL), fArgCount(0), fNeedsBundle(FALSE) {
+        fLocale[0] = 0;
+    }
+    ~UPrintfFormat();
+
+    void compile(const UChar *pattern, int32_t patternLength, const char *locale,
+                 UErrorCode &status);
+
+    UChar               *fPattern;
+    u_printf_segment    *fSegments;
+    int32_t             fSegmentCount;
+    ufmt_type_info      *fArgTypes;
+    UBool               *fArgIsLongLong;
+    int32_t             fArgCount;
+    char                fLocale[ULOC_FULLNAME_CAPACITY];
+    /* TRUE if a conversion is not bound at compile time and needs the ULocaleBundle */
+    UBool               fNeedsBundle;
+};
+
+UPrintfFormat::~UPrintfFormat() {
+    for (int32_t i = 0; i < fSegmentCount; i++) {
+        delete fSegments[i].fFormatter;
+        unum_close(fSegments[i].fNumberFormat);
+    }
+    uprv_free(fPattern);
+    uprv_free(fSegments);
+    uprv_free(fArgTypes);
+    uprv_free(fArgIsLongLong);
+}
+
+/* Whether a conversion of this type reads a value from the argument list. */
+static UBool
+u_printf_consumesArgument(ufmt_type_info argType)
+{
+    switch(argType) {
+    case ufmt_count:
+    case ufmt_string:
+    case ufmt_ustring:
+    case ufmt_pointer:
+    case ufmt_char:
+    case ufmt_uchar:
+    case ufmt_int:
+    case ufmt_float:
+    case ufmt_double:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+/* Whether the handler formats with one of the ULocaleBundle's number formats. */
+static UBool
+u_printf_usesBundle(u_printf_handler *handler)
+{
+    return (UBool)(handler == u_printf_integer_handler
+        || handler == u_printf_uinteger_handler
+        || handler == u_printf_double_handler
+        || handler == u_printf_scientific_handler
+        || handler == u_printf_scidbl_handler
+        || handler == u_printf_percent_handler
+        || handler == u_printf_spellout_handler);
+}
+
+/* Records the type of an argument list slot. The same slot may not be used with two types. */
+static void
+u_printf_setArgType(UPrintfFormat *format, int32_t slot, ufmt_type_info argType, UBool isLongLong,
+                    UErrorCode &status)
+{
+    if (format->fArgTypes[slot] != ufmt_empty &&
+        (format->fArgTypes[slot] != argType || format->fArgIsLongLong[slot] != isLongLong)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    format->fArgTypes[slot] = argType;
+    format->fArgIsLongLong[slot] = isLongLong;
+}
+
+/**
+ * Binds the number formatter for a %d, %i, %u or %f conversion, configured the way
+ * its handler configures the bundle's formatter on every call.
+ * The formatter refers to the segment's own clone of the bundle's DecimalFormat.
+ * Leaves the segment unbound if the conversion has to be formatted through the bundle.
+ */
+static void
+u_printf_bindNumberFormatter(ULocaleBundle *bundle, u_printf_segment *segment,
+                             u_printf_handler *handler, UErrorCode &status)
+{
+    const u_printf_spec_info *info = &segment->fSpec.fInfo;
+    if (info->fPrecision == -2) {
+        /* The precision is only known when formatting. */
+        return;
+    }
+
+    UNumberFormat *format = u_locbund_getNumberFormat(bundle, UNUM_DECIMAL);
+    if (format == NULL) {
+        return;
+    }
+    LocalUNumberFormatPointer clone(unum_clone(format, &status));
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    if (handler == u_printf_double_handler) {
+        /* # of decimal digits is 6 if precision not specified regardless of locale */
+        unum_setAttribute(clone.getAlias(), UNUM_FRACTION_DIGITS,
+            info->fPrecision != -1 ? info->fPrecision : 6);
+    }
+    else if (info->fPrecision != -1) {
+        unum_setAttribute(clone.getAlias(), UNUM_MIN_INTEGER_DIGITS, info->fPrecision);
+    }
+
+    /* %u ignores the sign argument */
+    if (info->fShowSign && handler != u_printf_uinteger_handler) {
+        UChar prefixBuffer[UPRINTF_BUFFER_SIZE];
+        int32_t prefixBufferLen = UPRV_LENGTHOF(prefixBuffer);
+        u_printf_set_sign(clone.getAlias(), info, prefixBuffer, &prefixBufferLen, &status);
+    }
+
+    const DecimalFormat *decimalFormat =
+        dynamic_cast<const DecimalFormat *>(reinterpret_cast<const NumberFormat *>(clone.getAlias()));
+    if (U_FAILURE(status) || decimalFormat == NULL) {
+        return;
+    }
+    LocalPointer<number::LocalizedNumberFormatter> formatter(
+        new number::LocalizedNumberFormatter(decimalFormat->toNumberFormatter().compile(status)), status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    segment->fFormatter = formatter.orphan();
+    segment->fNumberFormat = clone.orphan();
+}
+
+void
+UPrintfFormat::compile(const UChar *pattern, int32_t patternLength, const char *locale,
+                       UErrorCode &status)
+{
+    int32_t i;
+    int32_t maxSegments = 1;
+    int32_t sequentialSlots = 0;
+    int32_t maxPosition = 0;
+    UBool isPositional = FALSE;
+
+    uprv_strncpy(fLocale, locale, UPRV_LENGTHOF(fLocale) - 1);
+    fLocale[UPRV_LENGTHOF(fLocale) - 1] = 0;
+
+    /* The spec parser relies on the terminating NUL. */
+    fPattern = (UChar *)uprv_malloc((patternLength + 1) * sizeof(UChar));
+    if (fPattern == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    u_memcpy(fPattern, pattern, patternLength);
+    fPattern[patternLength] = 0;
+    for (i = 0; i < patternLength; i++) {
+        if (fPattern[i] == UP_PERCENT) {
+            maxSegments++;
+        }
+    }
+    fSegments = (u_printf_segment *)uprv_malloc(maxSegments * sizeof(u_printf_segment));
+    if (fSegments == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+
+    /* Split the pattern into literal text and parsed conversions. */
+    const UChar *alias = fPattern;
+    const UChar *limit = fPattern + patternLength;
+    for (;;) {
+        const UChar *lastAlias = alias;
+        while (alias < limit && *alias != UP_PERCENT) {
+            alias++;
+        }
+
+        u_printf_segment *segment = &fSegments[fSegmentCount++];
+        segment->fLiteralStart = (int32_t)(lastAlias - fPattern);
+        segment->fLiteralLength = (int32_t)(alias - lastAlias);
+        segment->fSpecStart = (int32_t)(alias - fPattern);
+        segment->fSpecLength = 0;
+        segment->fArgSlot = -1;
+        segment->fWidthSlot = -1;
+        segment->fPrecisionSlot = -1;
+        segment->fInfo = NULL;
+        segment->fFormatter = NULL;
+        segment->fNumberFormat = NULL;
+
+        if (alias == limit) {
+            break;
+        }
+
+        const UChar *specEnd = u_printf_parse_spec(alias + 1, &segment->fSpec);
+        const u_printf_spec_info *info = &segment->fSpec.fInfo;
+        if (info->fSpec == 0 || specEnd > limit) {
+            /* The pattern ends inside this conversion; it is echoed like an unknown tag. */
+            specEnd = limit;
+        }
+        else {
+            uint16_t handlerNum = (uint16_t)(info->fSpec - UPRINTF_BASE_FMT_HANDLERS);
+            if (handlerNum < UPRINTF_NUM_FMT_HANDLERS && g_u_printf_infos[handlerNum].handler != NULL) {
+                segment->fInfo = &g_u_printf_infos[handlerNum];
+            }
+        }
+        segment->fSpecLength = (int32_t)(specEnd - alias);
+        alias = specEnd;
+
+        /* Count the argument list slots this conversion reads. */
+        const u_printf_spec *spec = &segment->fSpec;
+        if (info->fWidth == -2) {
+            if (spec->fWidthPos > 0) {
+                isPositional = TRUE;
+                maxPosition = uprv_max(maxPosition, spec->fWidthPos);
+            } else {
+                sequentialSlots++;
+            }
+        }
+        if (info->fPrecision == -2) {
+            if (spec->fPrecisionPos > 0) {
+                isPositional = TRUE;
+                maxPosition = uprv_max(maxPosition, spec->fPrecisionPos);
+            } else {
+                sequentialSlots++;
+            }
+        }
+        if (segment->fInfo != NULL && u_printf_consumesArgument(segment->fInfo->info)) {
+            if (spec->fArgPos > 0) {
+                isPositional = TRUE;
+                maxPosition = uprv_max(maxPosition, spec->fArgPos);
+            } else {
+                sequentialSlots++;
+            }
+        }
+    }
+
+    /* Positional and sequential arguments can not be mixed. */
+    if (isPositional && sequentialSlots > 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fArgCount = isPositional ? maxPosition : sequentialSlots;
+    if (fArgCount > 0) {
+        fArgTypes = (ufmt_type_info *)uprv_malloc(fArgCount * sizeof(ufmt_type_info));
+        fArgIsLongLong = (UBool *)uprv_malloc(fArgCount * sizeof(UBool));
+        if (fArgTypes == NULL || fArgIsLongLong == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        for (i = 0; i < fArgCount; i++) {
+            fArgTypes[i] = ufmt_empty;
+            fArgIsLongLong[i] = FALSE;
+        }
+    }
+
+    /* Assign the slots in the order the arguments are read, and bind the number formatters. */
+    ULocaleBundle bundle;
+    if (u_locbund_init(&bundle, fLocale) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t nextSlot = 0;
+    for (i = 0; i < fSegmentCount && U_SUCCESS(status); i++) {
+        u_printf_segment *segment = &fSegments[i];
+        const u_printf_spec *spec = &segment->fSpec;
+        const u_printf_spec_info *info = &spec->fInfo;
+        if (segment->fSpecLength == 0) {
+            continue;
+        }
+        if (info->fWidth == -2) {
+            segment->fWidthSlot = isPositional ? spec->fWidthPos - 1 : nextSlot++;
+            u_printf_setArgType(this, segment->fWidthSlot, ufmt_int, FALSE, status);
+        }
+        if (info->fPrecision == -2) {
+            segment->fPrecisionSlot = isPositional ? spec->fPrecisionPos - 1 : nextSlot++;
+            u_printf_setArgType(this, segment->fPrecisionSlot, ufmt_int, FALSE, status);
+        }
+        if (segment->fInfo == NULL) {
+            continue;
+        }
+        if (u_printf_consumesArgument(segment->fInfo->info)) {
+            segment->fArgSlot = isPositional ? spec->fArgPos - 1 : nextSlot++;
+            u_printf_setArgType(this, segment->fArgSlot, segment->fInfo->info,
+                info->fIsLongLong, status);
+        }
+
+        u_printf_handler *handler = segment->fInfo->handler;
+        if (handler == u_printf_integer_handler
+            || handler == u_printf_uinteger_handler
+            || handler == u_printf_double_handler)
+        {
+            u_printf_bindNumberFormatter(&bundle, segment, handler, status);
+        }
+        if (segment->fFormatter == NULL && u_printf_usesBundle(handler)) {
+            fNeedsBundle = TRUE;
+        }
+    }
+    u_locbund_close(&bundle);
+
+    /* Every positional argument must be used, or the ones after it can not be read. */
+    for (i = 0; i < fArgCount && U_SUCCESS(status); i++) {
+        if (fArgTypes[i] == ufmt_empty) {
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+        }
+    }
+}
+
+U_CAPI UPrintfFormat * U_EXPORT2
+u_printf_openFormat(const UChar *pattern,
+                    int32_t     patternLength,
+                    const char  *locale,
+                    UErrorCode  *status)
+{
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    if (pattern == NULL || patternLength < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    if (patternLength < 0) {
+        patternLength = u_strlen(pattern);
+    }
+    LocalPointer<UPrintfFormat> format(new UPrintfFormat(), *status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    format->compile(pattern, patternLength, locale != NULL ? locale : "en_US_POSIX", *status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    return format.orphan();
+}
+
+U_CAPI void U_EXPORT2
+u_printf_closeFormat(UPrintfFormat *format)
+{
+    delete format;
+}
+
+/* Formats a %d, %i, %u or %f conversion with the number formatter bound at compile time. */
+static int32_t
+u_printf_compiled_number(const u_printf_stream_handler  *handler,
+                         void                           *context,
+                         const u_printf_segment         *segment,
+                         const u_printf_spec_info       *info,
+                         const ufmt_args                *args)
+{
+    UChar           result[UPRINTF_BUFFER_SIZE];
+    int32_t         resultLen;
+    UErrorCode      status        = U_ZERO_ERROR;
+
+    if (segment->fInfo->handler == u_printf_double_handler) {
+        resultLen = segment->fFormatter->formatBatch(&args[0].doubleValue, 1,
+            result, UPRINTF_BUFFER_SIZE, NULL, status);
+    }
+    else {
+        int64_t num = args[0].int64Value;
+
+        /* mask off any necessary bits, as the handlers do */
+        if (segment->fInfo->handler == u_printf_uinteger_handler) {
+            if (info->fIsShort)
+                num &= UINT16_MAX;
+            else if (!info->fIsLongLong)
+                num &= UINT32_MAX;
+        }
+        else {
+            if (info->fIsShort)
+                num = (int16_t)num;
+            else if (!info->fIsLongLong)
+                num = (int32_t)num;
+        }
+        resultLen = segment->fFormatter->formatInt(num, result, UPRINTF_BUFFER_SIZE, status);
+    }
+
+    if (U_FAILURE(status)) {
+        resultLen = 0;
+    }
+
+    return handler->pad_and_justify(context, info, result, resultLen);
+}
+
+U_CFUNC int32_t
+u_printf_format_compiled(const u_printf_stream_handler *streamHandler,
+                         const UPrintfFormat *format,
+                         void            *context,
+                         u_localized_print_string *locStringContext,
+                         int32_t         *written,
+                         va_list         ap)
+{
+    MaybeStackArray<ufmt_args, 16> arglist;
+    ULocaleBundle bundle;
+    ufmt_args args;
+    int32_t i;
+
+    /* read the whole argument list up front, in slot order */
+    if (format->fArgCount > arglist.getCapacity() && arglist.resize(format->fArgCount) == NULL) {
+        return -1;
+    }
+    for (i = 0; i < format->fArgCount; i++) {
+        switch (format->fArgTypes[i]) {
+        case ufmt_count:
+        case ufmt_string:
+        case ufmt_ustring:
+        case ufmt_pointer:
+            arglist[i].ptrValue = va_arg(ap, void*);
+            break;
+        case ufmt_char:
+        case ufmt_uchar:
+        case ufmt_int:
+            if (format->fArgIsLongLong[i]) {
+                arglist[i].int64Value = va_arg(ap, int64_t);
+            }
+            else {
+                arglist[i].int64Value = va_arg(ap, int32_t);
+            }
+            break;
+        case ufmt_float:
+            arglist[i].floatValue = (float) va_arg(ap, double);
+            break;
+        case ufmt_double:
+            arglist[i].doubleValue = va_arg(ap, double);
+            break;
+        default:
+            arglist[i].ptrValue = NULL;
+            break;
+        }
+    }
+
+    if (format->fNeedsBundle && u_locbund_init(&bundle, format->fLocale) == NULL) {
+        return -1;
+    }
+
+    for (i = 0; i < format->fSegmentCount; i++) {
+        if (locStringContext && locStringContext->available < 0) {
+            break;
+        }
+        const u_printf_segment *segment = &format->fSegments[i];
+
+        /* write any characters before the '%' */
+        if (segment->fLiteralLength > 0) {
+            *written += (streamHandler->write)(context,
+                format->fPattern + segment->fLiteralStart, segment->fLiteralLength);
+        }
+        if (segment->fSpecLength == 0) {
+            continue;
+        }
+
+        /* fill in the precision and width, if specified out of line */
+        u_printf_spec_info info = segment->fSpec.fInfo;
+        if (segment->fWidthSlot >= 0) {
+            info.fWidth = (int32_t)arglist[segment->fWidthSlot].int64Value;
+
+            /* if it's negative, take the absolute value and set left alignment */
+            if (info.fWidth < 0) {
+                info.fWidth *= -1; /* Make positive */
+                info.fLeft = TRUE;
+            }
+        }
+        if (segment->fPrecisionSlot >= 0) {
+            info.fPrecision = (int32_t)arglist[segment->fPrecisionSlot].int64Value;
+
+            /* if it's negative, set it to zero */
+            if (info.fPrecision < 0)
+                info.fPrecision = 0;
+        }
+
+        if (segment->fInfo == NULL) {
+            /* just echo unknown tags */
+            *written += (streamHandler->write)(context,
+                format->fPattern + segment->fSpecStart, segment->fSpecLength);
+            continue;
+        }
+
+        if (segment->fArgSlot >= 0) {
+            args = arglist[segment->fArgSlot];
+        }
+        else {
+            args.ptrValue = NULL;
+        }
+        if (segment->fInfo->info == ufmt_count) {
+            /* set the spec's width to the # of chars written */
+            info.fWidth = *written;
+        }
+
+        if (segment->fFormatter != NULL) {
+            *written += u_printf_compiled_number(streamHandler, context, segment, &info, &args);
+        }
+        else {
+            *written += (*segment->fInfo->handler)(streamHandler, context, &bundle, &info, &args);
+        }
+    }
+
+    if (format->fNeedsBundle) {
+        u_locbund_close(&bundle);
+    }
+    return 0;
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -30,6 +30,7 @@
 #include "ufmt_cmn.h"
 #include "unicode/ucnv.h"
 #include "unicode/ustring.h"
+#include "unicode/utf8.h"
 
 #include <string.h>
 
@@ -318,11 +319,18 @@ u_file_write_flush(const UChar *chars,
     const UChar *mySource    = chars;
     const UChar *mySourceBegin; 
     const UChar *mySourceEnd;
-    char        charBuffer[UFILE_CHARBUFFER_SIZE];
+    char        stackBuffer[UFILE_CHARBUFFER_SIZE];
+    char        *charBuffer = f->fCharBuffer != NULL ? f->fCharBuffer : stackBuffer;
+    int32_t     charBufferSize = f->fCharBuffer != NULL ? f->fCharBufferCapacity : UFILE_CHARBUFFER_SIZE;
     char        *myTarget   = charBuffer;
     int32_t     written      = 0;
     int32_t     numConverted = 0;
 
+    if (f->fMapping != NULL) {
+        /* A mapped file is read-only. */
+        return 0;
+    }
+
     if (count < 0) {
         count = u_strlen(chars);
     }
@@ -356,7 +364,7 @@ u_file_write_flush(const UChar *chars,
         if(f->fConverter != NULL) { /* We have a valid converter */
             ucnv_fromUnicode(f->fConverter,
                 &myTarget,
-                charBuffer + UFILE_CHARBUFFER_SIZE,
+                charBuffer + charBufferSize,
                 &mySource,
                 mySourceEnd,
                 NULL,
@@ -364,8 +372,8 @@ u_file_write_flush(const UChar *chars,
                 &status);
         } else { /*weiv: do the invariant conversion */
             int32_t convertChars = (int32_t) (mySourceEnd - mySource); 
-            if (convertChars > UFILE_CHARBUFFER_SIZE) { 
-                convertChars = UFILE_CHARBUFFER_SIZE; 
+            if (convertChars > charBufferSize) { 
+                convertChars = charBufferSize; 
                 status = U_BUFFER_OVERFLOW_ERROR; 
             } 
             u_UCharsToChars(mySource, myTarget, convertChars); 
@@ -399,6 +407,92 @@ u_file_write(    const UChar     *chars,
     return u_file_write_flush(chars,count,f,FALSE,FALSE);
 }
 
+U_CAPI int32_t U_EXPORT2
+u_file_write_utf8(const char    *s,
+                  int32_t       length,
+                  UFILE         *f)
+{
+    UChar       buffer[256];
+    UErrorCode  status = U_ZERO_ERROR;
+    int32_t     written = 0;
+
+    if (length < 0) {
+        length = (int32_t)uprv_strlen(s);
+    }
+
+    /* Write the bytes unchanged when they would only be converted to UTF-16 and back. */
+    if (f->fFile != NULL && f->fConverter != NULL
+        && ucnv_getType(f->fConverter) == UCNV_UTF8
+#if !UCONFIG_NO_TRANSLITERATION
+        && (f->fTranslit == NULL || f->fTranslit->translit == NULL)
+#endif
+        && ucnv_fromUCountPending(f->fConverter, &status) == 0
+        && U_SUCCESS(status))
+    {
+        return (int32_t)fwrite(s, sizeof(char), length, f->fFile);
+    }
+
+    while (written < length) {
+        const uint8_t *chunk = (const uint8_t *)s + written;
+        int32_t chunkLength = length - written;
+        int32_t ucLength;
+        if (chunkLength > UPRV_LENGTHOF(buffer)) {
+            /* Do not split a character between chunks. */
+            chunkLength = UPRV_LENGTHOF(buffer);
+            U8_TRUNCATE_IF_INCOMPLETE(chunk, 0, chunkLength);
+        }
+        status = U_ZERO_ERROR;
+        u_strFromUTF8WithSub(buffer, UPRV_LENGTHOF(buffer), &ucLength,
+                             (const char *)chunk, chunkLength, 0xfffd, NULL, &status);
+        if (U_FAILURE(status) || u_file_write(buffer, ucLength, f) != ucLength) {
+            break;
+        }
+        written += chunkLength;
+    }
+    return written;
+}
+
+
+/* Convert directly from the mapped bytes instead of reading them into a buffer first. */
+static void
+ufile_fill_uchar_buffer_from_mapping(UFILE *f)
+{
+    UErrorCode  status = U_ZERO_ERROR;
+    UFILEMapping *mapping = f->fMapping;
+    u_localized_string *str = &f->str;
+    int32_t     dataSize = (int32_t)(str->fLimit - str->fPos);
+    UChar       *myTarget;
+    const UChar *targetLimit;
+
+    if(dataSize != 0) {
+        u_memmove(f->fUCBuffer, str->fPos, dataSize);
+    }
+    myTarget    = f->fUCBuffer + dataSize;
+    targetLimit = f->fUCBuffer + f->fUCBufferCapacity;
+
+    if(f->fConverter != NULL) {
+        /* Stops with U_BUFFER_OVERFLOW_ERROR when the target is full. */
+        ucnv_toUnicode(f->fConverter,
+            &myTarget,
+            targetLimit,
+            &mapping->pos,
+            mapping->limit,
+            NULL,
+            TRUE,
+            &status);
+    } else { /* invariant conversion */
+        int32_t convertChars = (int32_t)(targetLimit - myTarget);
+        if ((mapping->limit - mapping->pos) < convertChars) {
+            convertChars = (int32_t)(mapping->limit - mapping->pos);
+        }
+        u_charsToUChars(mapping->pos, myTarget, convertChars);
+        mapping->pos += convertChars;
+        myTarget += convertChars;
+    }
+
+    str->fPos    = str->fBuffer;
+    str->fLimit  = myTarget;
+}
 
 /* private function used for buffering input */
 void
@@ -413,11 +507,16 @@ ufile_fill_uchar_buffer(UFILE *f)
     int32_t     bytesRead;
     int32_t     availLength;
     int32_t     dataSize;
-    char        charBuffer[UFILE_CHARBUFFER_SIZE];
+    char        stackBuffer[UFILE_CHARBUFFER_SIZE];
+    char        *charBuffer = f->fCharBuffer != NULL ? f->fCharBuffer : stackBuffer;
+    int32_t     charBufferSize = f->fCharBuffer != NULL ? f->fCharBufferCapacity : UFILE_CHARBUFFER_SIZE;
     u_localized_string *str;
 
     if (f->fFile == NULL) {
-        /* There is nothing to do. It's a string. */
+        if (f->fMapping != NULL) {
+            ufile_fill_uchar_buffer_from_mapping(f);
+        }
+        /* Otherwise there is nothing to do. It's a string. */
         return;
     }
 
@@ -435,7 +534,7 @@ ufile_fill_uchar_buffer(UFILE *f)
 
 
     /* record how much buffer space is available */
-    availLength = UFILE_UCHARBUFFER_SIZE - dataSize;
+    availLength = f->fUCBufferCapacity - dataSize;
 
     /* Determine the # of codepage bytes needed to fill our UChar buffer */
     /* weiv: if converter is NULL, we use invariant converter with charwidth = 1)*/
@@ -444,14 +543,14 @@ ufile_fill_uchar_buffer(UFILE *f)
     /* Read in the data to convert */
     if (f->fFileno == 0) {
         /* Special case. Read from stdin one line at a time. */
-        char *retStr = fgets(charBuffer, ufmt_min(maxCPBytes, UFILE_CHARBUFFER_SIZE), f->fFile);
+        char *retStr = fgets(charBuffer, ufmt_min(maxCPBytes, charBufferSize), f->fFile);
         bytesRead = (int32_t)(retStr ? uprv_strlen(charBuffer) : 0);
     }
     else {
         /* A normal file */
         bytesRead = (int32_t)fread(charBuffer,
             sizeof(char),
-            ufmt_min(maxCPBytes, UFILE_CHARBUFFER_SIZE),
+            ufmt_min(maxCPBytes, charBufferSize),
             f->fFile);
     }
 
@@ -460,7 +559,7 @@ ufile_fill_uchar_buffer(UFILE *f)
     mySource    = charBuffer;
     mySourceEnd = charBuffer + bytesRead;
     myTarget    = f->fUCBuffer + dataSize;
-    bufferSize  = UFILE_UCHARBUFFER_SIZE;
+    bufferSize  = f->fUCBufferCapacity;
 
     if(f->fConverter != NULL) { /* We have a valid converter */
         /* Perform the conversion */
@@ -22,9 +22,13 @@
 #include "unicode/ustream.h"
 #include "unicode/ucnv.h"
 #include "unicode/uchar.h"
+#include "unicode/ustring.h"
 #include "unicode/utf16.h"
-#include "ustr_cnv.h"
+#include "ucnv_imp.h"
+#include "ucln_io.h"
 #include "cmemory.h"
+#include "cstring.h"
+#include "umutex.h"
 #include <string.h>
 
 // console IO
@@ -36,16 +40,111 @@
 
 U_NAMESPACE_BEGIN
 
+// Number of UTF-16 code units converted to UTF-8 at a time.
+#define UTF8_CHUNK_LENGTH 256
+
+// Bumped by the io cleanup, so that threads drop converters opened before u_cleanup().
+static u_atomic_int32_t gStreamConverterGeneration = ATOMIC_INT32_T_INITIALIZER(0);
+
+U_CDECL_BEGIN
+static UBool U_CALLCONV ustream_cleanup(void) {
+    umtx_atomic_inc(&gStreamConverterGeneration);
+    return TRUE;
+}
+U_CDECL_END
+
+/**
+ * The default converter of one thread, kept between stream insertions and
+ * extractions so that they neither open a converter nor take the lock of the
+ * shared default converter (see u_getDefaultConverter()).
+ * It is reopened when the default converter name changes.
+ */
+class StreamConverterCache : public UMemory {
+public:
+    ~StreamConverterCache() {
+        ucnv_close(fConverter);
+    }
+
+    /* Returns the thread's default converter, which must be passed to release(). */
+    UConverter *take(UErrorCode &errorCode) {
+        UConverter *converter = fConverter;
+        const char *defaultName = ucnv_getDefaultName();
+        int32_t generation = umtx_loadAcquire(gStreamConverterGeneration);
+        fConverter = NULL;
+        if (converter != NULL) {
+            if (generation == fGeneration && uprv_strcmp(defaultName, fName) == 0) {
+                return converter;
+            }
+            ucnv_close(converter);
+        }
+        converter = ucnv_open(NULL, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            ucnv_close(converter);
+            return NULL;
+        }
+        uprv_strncpy(fName, defaultName, UPRV_LENGTHOF(fName) - 1);
+        fName[UPRV_LENGTHOF(fName) - 1] = 0;
+        fGeneration = generation;
+        ucln_io_registerCleanup(UCLN_IO_USTREAM, ustream_cleanup);
+        return converter;
+    }
+
+    void release(UConverter *converter) {
+        ucnv_reset(converter);
+        if (fConverter == NULL) {
+            fConverter = converter;
+        } else {
+            ucnv_close(converter);
+        }
+    }
+
+private:
+    UConverter *fConverter = NULL;
+    int32_t fGeneration = 0;
+    char fName[UCNV_MAX_CONVERTER_NAME_LENGTH] = "";
+};
+
+static thread_local StreamConverterCache gStreamConverter;
+
 U_IO_API STD_OSTREAM & U_EXPORT2
 operator<<(STD_OSTREAM& stream, const UnicodeString& str)
 {
     if(str.length() > 0) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+
+        if(UCNV_FAST_IS_UTF8(ucnv_getDefaultName())) {
+            // convert to UTF-8 directly, as the default converter would,
+            // without splitting surrogate pairs between chunks
+            char buffer[UTF8_CHUNK_LENGTH * 3 + 1];
+            const UChar *us = str.getBuffer();
+            int32_t length = str.length();
+            int32_t start = 0;
+            while(start < length) {
+                int32_t limit = length - start > UTF8_CHUNK_LENGTH ? start + UTF8_CHUNK_LENGTH : length;
+                int32_t length8 = 0;
+                if(limit < length && U16_IS_LEAD(us[limit - 1])) {
+                    --limit;
+                }
+                errorCode = U_ZERO_ERROR;
+                u_strToUTF8WithSub(buffer, UPRV_LENGTHOF(buffer) - 1, &length8,
+                                   us + start, limit - start, 0xfffd, NULL, &errorCode);
+                if(U_FAILURE(errorCode)) {
+                    break;
+                }
+                buffer[length8] = 0;
+
+                // write this chunk
+                stream << buffer;
+                start = limit;
+            }
+            return stream;
+        }
+
         char buffer[200];
         UConverter *converter;
-        UErrorCode errorCode = U_ZERO_ERROR;
 
         // use the default converter to convert chunks of text
-        converter = u_getDefaultConverter(&errorCode);
+        converter = gStreamConverter.take(errorCode);
         if(U_SUCCESS(errorCode)) {
             const UChar *us = str.getBuffer();
             const UChar *uLimit = us + str.length();
@@ -61,7 +160,7 @@ operator<<(STD_OSTREAM& stream, const UnicodeString& str)
                     stream << buffer;
                 }
             } while(errorCode == U_BUFFER_OVERFLOW_ERROR);
-            u_releaseDefaultConverter(converter);
+            gStreamConverter.release(converter);
         }
     }
 
@@ -85,7 +184,7 @@ operator>>(STD_ISTREAM& stream, UnicodeString& str)
     UErrorCode errorCode = U_ZERO_ERROR;
 
     // use the default converter to convert chunks of text
-    converter = u_getDefaultConverter(&errorCode);
+    converter = gStreamConverter.take(errorCode);
     if(U_SUCCESS(errorCode)) {
         UChar *us = uBuffer;
         const UChar *uLimit = uBuffer + UPRV_LENGTHOF(uBuffer);
@@ -158,7 +257,7 @@ operator>>(STD_ISTREAM& stream, UnicodeString& str)
             }
         }
 STOP_READING:
-        u_releaseDefaultConverter(converter);
+        gStreamConverter.release(converter);
     }
 
 /*    stream.flush();*/
@@ -277,6 +277,8 @@ static const le_bool complexTable[scriptCodeCount] = {
 
 const char ParagraphLayout::fgClassID = 0;
 
+#define INITIAL_LINE_CAPACITY 16
+
 static void fillMissingCharToGlyphMapValues(le_int32 *charToGlyphMap,
                                             le_int32 charCount) {
     le_int32 lastValidGlyph = -1;
@@ -290,6 +292,68 @@ static void fillMissingCharToGlyphMapValues(le_int32 *charToGlyphMap,
     }
 }
 
+struct ParagraphLayout::CachedRuns
+{
+    UBiDi        *paraBidi;
+    StyleRunInfo *styleRunInfo;
+    le_int32      styleRunCount;
+    le_int32     *glyphToCharMap;
+    float        *glyphWidths;
+
+    // For each new style run, the index of the cached run whose glyphs it took over, or -1.
+    le_int32     *reusedRuns;
+
+    le_int32      editStart;
+    le_int32      oldEditLimit;
+    le_int32      newEditLimit;
+
+    le_int32 findRun(const StyleRunInfo &run) const;
+};
+
+/*
+ * Returns the index of the cached run which has the same characters and style as the
+ * given new run, or -1 if there is none. Runs next to the edit aren't reused either,
+ * since their layout may depend on the characters around them.
+ */
+le_int32 ParagraphLayout::CachedRuns::findRun(const StyleRunInfo &run) const
+{
+    le_int32 delta;
+
+    if (run.runLimit < editStart) {
+        delta = 0;
+    } else if (run.runBase > newEditLimit) {
+        delta = newEditLimit - oldEditLimit;
+    } else {
+        return -1;
+    }
+
+    le_int32 runBase = run.runBase - delta;
+    le_int32 start = 0, limit = styleRunCount;
+
+    while (start < limit) {
+        le_int32 mid = (start + limit) / 2;
+
+        if (styleRunInfo[mid].runBase < runBase) {
+            start = mid + 1;
+        } else {
+            limit = mid;
+        }
+    }
+
+    if (start < styleRunCount) {
+        const StyleRunInfo &cachedRun = styleRunInfo[start];
+
+        if (cachedRun.runBase == runBase && cachedRun.runLimit == run.runLimit - delta &&
+            cachedRun.font == run.font && cachedRun.script == run.script &&
+            cachedRun.level == run.level && cachedRun.locale == run.locale &&
+            cachedRun.glyphs != NULL) {
+            return start;
+        }
+    }
+
+    return -1;
+}
+
 /*
  * How to deal with composite fonts:
  *
@@ -323,10 +387,11 @@ ParagraphLayout::ParagraphLayout(const LEUnicode chars[], le_int32 count,
                                    fAscent(0), fDescent(0), fLeading(0),
                                    fGlyphToCharMap(NULL), fCharToMinGlyphMap(NULL), fCharToMaxGlyphMap(NULL), fGlyphWidths(NULL), fGlyphCount(0),
                                    fParaBidi(NULL), fLineBidi(NULL),
-                                   fStyleRunLimits(NULL), fStyleIndices(NULL), fStyleRunCount(0),
+                                   fStyleRunLimits(NULL), fStyleIndices(NULL), fStyleRunInfo(NULL), fStyleRunCount(0),
                                    fBreakIterator(NULL), fLineStart(-1), fLineEnd(0),
                                  /*fVisualRuns(NULL), fStyleRunInfo(NULL), fVisualRunCount(-1),
-                                   fFirstVisualRun(-1), fLastVisualRun(-1),*/ fVisualRunLastX(0), fVisualRunLastY(0)
+                                   fFirstVisualRun(-1), fLastVisualRun(-1),*/ fVisualRunLastX(0), fVisualRunLastY(0),
+                                   fLineRecords(NULL), fLineCount(0), fLineCapacity(0)
 {
 
     if (LE_FAILURE(status)) {
@@ -337,15 +402,25 @@ ParagraphLayout::ParagraphLayout(const LEUnicode chars[], le_int32 count,
     (void)copyright;  // Suppress unused variable warning.
     (void)fVertical;  // Suppress warning for unused field fVertical.
 
+    layoutText(fontRuns, paragraphLevel, NULL, status);
+}
+
+/*
+ * Lays out the text, and builds the glyph arrays and maps. If cache is not NULL,
+ * then it has the layout of the text before an edit, and the style runs which
+ * the edit did not affect take their glyphs and positions from it.
+ */
+void ParagraphLayout::layoutText(const FontRuns *fontRuns, UBiDiLevel paragraphLevel, CachedRuns *cache, LEErrorCode &status)
+{
     // FIXME: should check the limit arrays for consistency...
 
     computeLevels(paragraphLevel);
 
-    if (scriptRuns == NULL) {
+    if (fScriptRuns == NULL) {
         computeScripts();
     }
 
-    if (localeRuns == NULL) {
+    if (fLocaleRuns == NULL) {
         computeLocales();
     }
 
@@ -374,6 +449,14 @@ ParagraphLayout::ParagraphLayout(const LEUnicode chars[], le_int32 count,
 
     styleRuns.getRuns(fStyleRunLimits, fStyleIndices);
 
+    if (cache != NULL) {
+        cache->reusedRuns = LE_NEW_ARRAY(le_int32, fStyleRunCount);
+        if (cache->reusedRuns == NULL) {
+            status = LE_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+
     // now build a LayoutEngine for each style run...
     le_int32 *styleIndices = fStyleIndices;
     le_int32 run, runStart;
@@ -410,18 +493,30 @@ ParagraphLayout::ParagraphLayout(const LEUnicode chars[], le_int32 count,
         fStyleRunInfo[run].level     = (UBiDiLevel) fLevelRuns->getValue(styleIndices[1]);
         fStyleRunInfo[run].glyphBase = fGlyphCount;
 
-        fStyleRunInfo[run].engine = LayoutEngine::layoutEngineFactory(fStyleRunInfo[run].font,
-            fStyleRunInfo[run].script, getLanguageCode(fStyleRunInfo[run].locale), layoutStatus);
-        if (LE_FAILURE(layoutStatus)) {
-            status = layoutStatus;
-            return;
-        }
+        if (cache != NULL && (cache->reusedRuns[run] = cache->findRun(fStyleRunInfo[run])) >= 0) {
+            // The edit didn't affect this run, so take over its glyphs and positions.
+            StyleRunInfo &cachedRun = cache->styleRunInfo[cache->reusedRuns[run]];
 
-        fStyleRunInfo[run].glyphCount = fStyleRunInfo[run].engine->layoutChars(fChars, runStart, fStyleRunLimits[run] - runStart, fCharCount,
-            fStyleRunInfo[run].level & 1, 0, 0, layoutStatus);
-        if (LE_FAILURE(layoutStatus)) {
-            status = layoutStatus;
-            return;
+            fStyleRunInfo[run].glyphCount = cachedRun.glyphCount;
+            fStyleRunInfo[run].glyphs     = cachedRun.glyphs;
+            fStyleRunInfo[run].positions  = cachedRun.positions;
+
+            cachedRun.glyphs    = NULL;
+            cachedRun.positions = NULL;
+        } else {
+            fStyleRunInfo[run].engine = LayoutEngine::layoutEngineFactory(fStyleRunInfo[run].font,
+                fStyleRunInfo[run].script, getLanguageCode(fStyleRunInfo[run].locale), layoutStatus);
+            if (LE_FAILURE(layoutStatus)) {
+                status = layoutStatus;
+                return;
+            }
+
+            fStyleRunInfo[run].glyphCount = fStyleRunInfo[run].engine->layoutChars(fChars, runStart, fStyleRunLimits[run] - runStart, fCharCount,
+                fStyleRunInfo[run].level & 1, 0, 0, layoutStatus);
+            if (LE_FAILURE(layoutStatus)) {
+                status = layoutStatus;
+                return;
+            }
         }
 
         runStart = fStyleRunLimits[run];
@@ -453,6 +548,20 @@ ParagraphLayout::ParagraphLayout(const LEUnicode chars[], le_int32 count,
         le_int32 glyphCount  = fStyleRunInfo[run].glyphCount;
         le_int32 glyphBase   = fStyleRunInfo[run].glyphBase;
 
+        if (engine == NULL) {
+            // A cached run: copy its glyph widths and glyph-to-char map, moved to the new run start.
+            const StyleRunInfo &cachedRun = cache->styleRunInfo[cache->reusedRuns[run]];
+            le_int32 delta = runStart - cachedRun.runBase;
+
+            for (glyph = 0; glyph < glyphCount; glyph += 1) {
+                fGlyphWidths[glyphBase + glyph]    = cache->glyphWidths[cachedRun.glyphBase + glyph];
+                fGlyphToCharMap[glyphBase + glyph] = cache->glyphToCharMap[cachedRun.glyphBase + glyph] + delta;
+            }
+
+            runStart = fStyleRunLimits[run];
+            continue;
+        }
+
         fStyleRunInfo[run].glyphs = LE_NEW_ARRAY(LEGlyphID, glyphCount);
         fStyleRunInfo[run].positions = LE_NEW_ARRAY(float, glyphCount * 2 + 2);
         if ((fStyleRunInfo[run].glyphs == NULL) ||
@@ -526,8 +635,26 @@ ParagraphLayout::ParagraphLayout(const LEUnicode chars[], le_int32 count,
 }
 
 ParagraphLayout::~ParagraphLayout()
+{
+    deleteLayout();
+
+    if (fBreakIterator != NULL) {
+        delete fBreakIterator;
+        fBreakIterator = NULL;
+    }
+
+    LE_DELETE_ARRAY(fLineRecords);
+    fLineRecords = NULL;
+}
+
+/*
+ * Deletes everything that layoutText() computes,
+ * except for the pointers which are NULL.
+ */
+void ParagraphLayout::deleteLayout()
 {
     delete (FontRuns *) fFontRuns;
+    fFontRuns = NULL;
 
     if (! fClientLevels) {
         delete (ValueRuns *) fLevelRuns;
@@ -591,15 +718,17 @@ ParagraphLayout::~ParagraphLayout()
         LE_DELETE_ARRAY(fStyleRunLimits);
         LE_DELETE_ARRAY(fStyleIndices);
 
-        for (run = 0; run < fStyleRunCount; run += 1) {
-            LE_DELETE_ARRAY(fStyleRunInfo[run].glyphs);
-            LE_DELETE_ARRAY(fStyleRunInfo[run].positions);
+        if (fStyleRunInfo != NULL) {
+            for (run = 0; run < fStyleRunCount; run += 1) {
+                LE_DELETE_ARRAY(fStyleRunInfo[run].glyphs);
+                LE_DELETE_ARRAY(fStyleRunInfo[run].positions);
 
-            fStyleRunInfo[run].glyphs    = NULL;
-            fStyleRunInfo[run].positions = NULL;
-        }
+                fStyleRunInfo[run].glyphs    = NULL;
+                fStyleRunInfo[run].positions = NULL;
+            }
 
-        LE_DELETE_ARRAY(fStyleRunInfo);
+            LE_DELETE_ARRAY(fStyleRunInfo);
+        }
 
         fStyleRunLimits = NULL;
         fStyleIndices   = NULL;
@@ -607,12 +736,204 @@ ParagraphLayout::~ParagraphLayout()
         fStyleRunCount  = 0;
     }
 
+    fAscent  = 0;
+    fDescent = 0;
+    fLeading = 0;
+}
+
+
+le_int32 ParagraphLayout::updateText(const LEUnicode chars[], le_int32 count,
+                                     le_int32 editStart, le_int32 oldEditLimit,
+                                     const FontRuns *fontRuns,
+                                     const ValueRuns *levelRuns,
+                                     const ValueRuns *scriptRuns,
+                                     const LocaleRuns *localeRuns,
+                                     UBiDiLevel paragraphLevel,
+                                     LEErrorCode &status)
+{
+    if (LE_FAILURE(status)) {
+        return 0;
+    }
+
+    if (fCharCount < 0 || fStyleRunInfo == NULL || editStart < 0 || oldEditLimit < editStart ||
+        oldEditLimit > fCharCount || count - (fCharCount - oldEditLimit) < editStart) {
+        status = LE_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    // Keep the previous layout, and delete everything else.
+    CachedRuns cache;
+
+    cache.paraBidi       = fParaBidi;
+    cache.styleRunInfo   = fStyleRunInfo;
+    cache.styleRunCount  = fStyleRunCount;
+    cache.glyphToCharMap = fGlyphToCharMap;
+    cache.glyphWidths    = fGlyphWidths;
+    cache.reusedRuns     = NULL;
+    cache.editStart      = editStart;
+    cache.oldEditLimit   = oldEditLimit;
+    cache.newEditLimit   = count - (fCharCount - oldEditLimit);
+
+    fParaBidi       = NULL;
+    fStyleRunInfo   = NULL;
+    fGlyphToCharMap = NULL;
+    fGlyphWidths    = NULL;
+
+    deleteLayout();
+
+    fChars      = chars;
+    fCharCount  = count;
+    fLevelRuns  = levelRuns;
+    fScriptRuns = scriptRuns;
+    fLocaleRuns = localeRuns;
+
     if (fBreakIterator != NULL) {
-        delete fBreakIterator;
-        fBreakIterator = NULL;
+        fBreakIterator->adoptText(new UCharCharacterIterator(fChars, fCharCount));
     }
+
+    layoutText(fontRuns, paragraphLevel, &cache, status);
+
+    le_int32 keptLines = 0;
+
+    if (LE_SUCCESS(status) && fCharCount >= 0) {
+        le_int32 firstChange = findFirstChange(cache);
+
+        while (keptLines < fLineCount && keptLines < fLineCapacity &&
+               fLineRecords[keptLines].lookahead < firstChange) {
+            keptLines += 1;
+        }
+    }
+
+    fLineCount = keptLines;
+    fLineEnd   = keptLines > 0? fLineRecords[keptLines - 1].limit : 0;
+
+    ubidi_close(cache.paraBidi);
+
+    for (le_int32 run = 0; run < cache.styleRunCount; run += 1) {
+        LE_DELETE_ARRAY(cache.styleRunInfo[run].glyphs);
+        LE_DELETE_ARRAY(cache.styleRunInfo[run].positions);
+    }
+
+    LE_DELETE_ARRAY(cache.styleRunInfo);
+    LE_DELETE_ARRAY(cache.glyphToCharMap);
+    LE_DELETE_ARRAY(cache.glyphWidths);
+    LE_DELETE_ARRAY(cache.reusedRuns);
+
+    return keptLines;
 }
 
+/*
+ * Returns the index of the first character whose layout may differ
+ * from the cached one: the levels, style runs and glyphs of the
+ * characters before it are the same.
+ */
+le_int32 ParagraphLayout::findFirstChange(const CachedRuns &cache) const
+{
+    UErrorCode bidiStatus = U_ZERO_ERROR;
+    le_int32 firstChange = cache.editStart;
+
+    // With another paragraph level, the trailing whitespace of all lines may move.
+    if (ubidi_getParaLevel(fParaBidi) != ubidi_getParaLevel(cache.paraBidi)) {
+        return 0;
+    }
+
+    const UBiDiLevel *levels = ubidi_getLevels(fParaBidi, &bidiStatus);
+    const UBiDiLevel *cachedLevels = ubidi_getLevels(cache.paraBidi, &bidiStatus);
+
+    if (U_FAILURE(bidiStatus)) {
+        return 0;
+    }
+
+    le_int32 ch, run, glyph;
+
+    for (ch = 0; ch < firstChange; ch += 1) {
+        if (levels[ch] != cachedLevels[ch]) {
+            firstChange = ch;
+            break;
+        }
+    }
+
+    // The style runs before the change have the same limits and styles.
+    for (run = 0; run < fStyleRunCount && fStyleRunInfo[run].runBase < firstChange; run += 1) {
+        const StyleRunInfo &info = fStyleRunInfo[run];
+
+        if (run >= cache.styleRunCount) {
+            firstChange = info.runBase;
+            break;
+        }
+
+        const StyleRunInfo &cachedInfo = cache.styleRunInfo[run];
+
+        if (info.font != cachedInfo.font || info.script != cachedInfo.script ||
+            info.level != cachedInfo.level || info.locale != cachedInfo.locale) {
+            firstChange = info.runBase;
+            break;
+        }
+
+        if (info.runLimit != cachedInfo.runLimit) {
+            le_int32 limit = info.runLimit < cachedInfo.runLimit? info.runLimit : cachedInfo.runLimit;
+
+            if (limit < firstChange) {
+                firstChange = limit;
+            }
+
+            break;
+        }
+    }
+
+    // The runs which were laid out again have the same glyphs before the change.
+    for (run = 0; run < fStyleRunCount && fStyleRunInfo[run].runBase < firstChange; run += 1) {
+        if (cache.reusedRuns[run] >= 0) {
+            continue;
+        }
+
+        const StyleRunInfo &info = fStyleRunInfo[run];
+        const StyleRunInfo &cachedInfo = cache.styleRunInfo[run];
+
+        if (cachedInfo.glyphs == NULL) {
+            firstChange = info.runBase;
+            break;
+        }
+
+        le_int32 glyphCount = info.glyphCount < cachedInfo.glyphCount? info.glyphCount : cachedInfo.glyphCount;
+        le_bool rtl = (info.level & 1) != 0;
+
+        // Compare the glyphs in logical order, like the glyph-to-char maps.
+        for (glyph = 0; glyph < glyphCount; glyph += 1) {
+            le_int32 index  = info.glyphBase + glyph;
+            le_int32 cachedIndex = cachedInfo.glyphBase + glyph;
+            LEGlyphID glyphID = info.glyphs[rtl? info.glyphCount - 1 - glyph : glyph];
+            LEGlyphID cachedGlyphID = cachedInfo.glyphs[rtl? cachedInfo.glyphCount - 1 - glyph : glyph];
+
+            if (fGlyphToCharMap[index] != cache.glyphToCharMap[cachedIndex] ||
+                fGlyphWidths[index] != cache.glyphWidths[cachedIndex] || glyphID != cachedGlyphID) {
+                break;
+            }
+        }
+
+        if (glyph < info.glyphCount || glyph < cachedInfo.glyphCount) {
+            // The characters of the remaining glyphs may have changed.
+            // (They need not be in order, because of reordering.)
+            le_int32 g;
+
+            for (g = glyph; g < info.glyphCount; g += 1) {
+                if (fGlyphToCharMap[info.glyphBase + g] < firstChange) {
+                    firstChange = fGlyphToCharMap[info.glyphBase + g];
+                }
+            }
+
+            for (g = glyph; g < cachedInfo.glyphCount; g += 1) {
+                if (cache.glyphToCharMap[cachedInfo.glyphBase + g] < firstChange) {
+                    firstChange = cache.glyphToCharMap[cachedInfo.glyphBase + g];
+                }
+            }
+
+            break;
+        }
+    }
+
+    return firstChange;
+}
 
 le_bool ParagraphLayout::isComplex(const LEUnicode chars[], le_int32 count)
 {
@@ -672,6 +993,8 @@ ParagraphLayout::Line *ParagraphLayout::nextLine(float width)
 
     fLineStart = fLineEnd;
 
+    le_int32 lookahead = fCharCount;
+
     if (width > 0) {
         le_int32 glyph    = fCharToMinGlyphMap[fLineStart];
         float widthSoFar  = 0;
@@ -691,7 +1014,8 @@ ParagraphLayout::Line *ParagraphLayout::nextLine(float width)
             glyph += 1;
         }
 
-        fLineEnd = previousBreak(fGlyphToCharMap[glyph]);
+        fLineEnd  = previousBreak(fGlyphToCharMap[glyph]);
+        lookahead = fGlyphToCharMap[glyph];
 
         // If this break is at or before the last one,
         // find a glyph, starting at the one which didn't
@@ -699,13 +1023,47 @@ ParagraphLayout::Line *ParagraphLayout::nextLine(float width)
         while (fLineEnd <= fLineStart) {
             fLineEnd = fGlyphToCharMap[glyph++];
         }
+
+        // The break depends on the text up to the end
+        // of the word which didn't fit.
+        if (lookahead < fLineEnd) {
+            lookahead = fLineEnd;
+        }
+
+        if (lookahead < fCharCount) {
+            lookahead = fBreakIterator->following(lookahead);
+        }
     } else {
         fLineEnd = fCharCount;
     }
 
+    recordLine(lookahead);
+
     return computeVisualRuns();
 }
 
+void ParagraphLayout::recordLine(le_int32 lookahead)
+{
+    if (fLineCount == fLineCapacity) {
+        le_int32 capacity = fLineCapacity == 0? INITIAL_LINE_CAPACITY : fLineCapacity * 2;
+        LineRecord *records = (LineRecord *) LE_GROW_ARRAY(fLineRecords, capacity);
+
+        if (records != NULL) {
+            fLineRecords  = records;
+            fLineCapacity = capacity;
+        }
+    }
+
+    // If the array can't grow, the line isn't recorded, and
+    // updateText() won't keep it or any of the following lines.
+    if (fLineCount < fLineCapacity) {
+        fLineRecords[fLineCount].limit     = fLineEnd;
+        fLineRecords[fLineCount].lookahead = lookahead;
+    }
+
+    fLineCount += 1;
+}
+
 void ParagraphLayout::computeLevels(UBiDiLevel paragraphLevel)
 {
     UErrorCode bidiStatus = U_ZERO_ERROR;
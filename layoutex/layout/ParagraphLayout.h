@@ -506,6 +506,63 @@ class U_LAYOUTEX_API ParagraphLayout : public UObject
      */
     inline void reflow();
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Update the paragraph after an edit of its text. The characters
+     * from <code>editStart</code> up to <code>oldEditLimit</code> of the previous text
+     * were replaced, and <code>chars</code> is the complete new text. The run objects
+     * are specified as for the constructor, and must cover the new text.
+     *
+     * Only the style runs which touch the edit, or whose font, script, level or locale
+     * changed, are laid out again; the others keep their glyphs and positions.
+     * The line break iterator is kept as well.
+     *
+     * Line breaking continues with the first line which may have changed:
+     * the lines returned by <code>nextLine()</code> since the last <code>reflow()</code>
+     * which were not affected by the edit are still valid, and the next call to
+     * <code>nextLine()</code> returns the line after them. This assumes that
+     * <code>nextLine()</code> is called with the same widths as before for those lines.
+     *
+     * @param chars is an array of the characters in the paragraph after the edit
+     *
+     * @param count is the number of characters in the paragraph after the edit.
+     *
+     * @param editStart is the index of the first edited character.
+     *
+     * @param oldEditLimit is the index after the last edited character, in the previous text.
+     *
+     * @param fontRuns a pointer to a <code>FontRuns</code> object representing the font runs.
+     *
+     * @param levelRuns is a pointer to a <code>ValueRuns</code> object representing the directional levels,
+     *        or <code>NULL</code>.
+     *
+     * @param scriptRuns is a pointer to a <code>ValueRuns</code> object representing script runs,
+     *        or <code>NULL</code>.
+     *
+     * @param localeRuns is a pointer to a <code>LocaleRuns</code> object representing locale runs,
+     *        or <code>NULL</code>.
+     *
+     * @param paragraphLevel is the directionality of the paragraph, as in the UBiDi object.
+     *
+     * @param status will be set to any error code encountered during the update.
+     *        <code>LE_ILLEGAL_ARGUMENT_ERROR</code> if the edit range is not valid.
+     *
+     * @return the number of lines, from the start of the paragraph, which are not changed by the edit.
+     *
+     * @see ParagraphLayout::nextLine
+     *
+     * @draft ICU 64
+     */
+    le_int32 updateText(const LEUnicode chars[], le_int32 count,
+                        le_int32 editStart, le_int32 oldEditLimit,
+                        const FontRuns *fontRuns,
+                        const ValueRuns *levelRuns,
+                        const ValueRuns *scriptRuns,
+                        const LocaleRuns *localeRuns,
+                        UBiDiLevel paragraphLevel,
+                        LEErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
     /**
      *
@@ -576,10 +633,33 @@ class U_LAYOUTEX_API ParagraphLayout : public UObject
           le_int32        glyphCount;
     };
 
+    /**
+     * The layout of the previous text, during updateText().
+     */
+    struct CachedRuns;
+
+    /**
+     * Where a line returned by nextLine() ends, and the end of the text that
+     * the choice of that line break depended on.
+     */
+    struct LineRecord
+    {
+        le_int32 limit;
+        le_int32 lookahead;
+    };
+
     ParagraphLayout() {};
     ParagraphLayout(const ParagraphLayout & /*other*/) : UObject( ){};
     inline ParagraphLayout &operator=(const ParagraphLayout & /*other*/) { return *this; };
 
+    void layoutText(const FontRuns *fontRuns, UBiDiLevel paragraphLevel, CachedRuns *cache, LEErrorCode &status);
+
+    void deleteLayout();
+
+    le_int32 findFirstChange(const CachedRuns &cache) const;
+
+    void recordLine(le_int32 lookahead);
+
     void computeLevels(UBiDiLevel paragraphLevel);
 
     Line *computeVisualRuns();
@@ -643,6 +723,10 @@ class U_LAYOUTEX_API ParagraphLayout : public UObject
           le_int32       fLastVisualRun;
           float          fVisualRunLastX;
           float          fVisualRunLastY;
+
+          LineRecord    *fLineRecords;
+          le_int32       fLineCount;
+          le_int32       fLineCapacity;
 };
 
 inline UBiDiLevel ParagraphLayout::getParagraphLevel()
@@ -658,6 +742,7 @@ inline UBiDiDirection ParagraphLayout::getTextDirection()
 inline void ParagraphLayout::reflow()
 {
     fLineEnd = 0;
+    fLineCount = 0;
 }
 
 inline ParagraphLayout::Line::Line()
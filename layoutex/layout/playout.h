@@ -217,6 +217,48 @@ pl_getLeading(const pl_paragraph *paragraph);
 U_INTERNAL void U_EXPORT2
 pl_reflow(pl_paragraph *paragraph);
 
+/**
+ * Update the paragraph after an edit of its text. The characters
+ * from <code>editStart</code> up to <code>oldEditLimit</code> of the previous text
+ * were replaced, and <code>chars</code> is the complete new text.
+ * Only the runs affected by the edit are laid out again.
+ * The next call to <code>pl_nextLine</code> returns the first line
+ * which may have changed.
+ *
+ * @param paragraph the <code>pl_paragraph</code>
+ * @param chars is an array of the characters in the paragraph after the edit
+ * @param count is the number of characters in the paragraph after the edit.
+ * @param editStart is the index of the first edited character.
+ * @param oldEditLimit is the index after the last edited character, in the previous text.
+ * @param fontRuns a pointer to a <code>pl_fontRuns</code> object representing the font runs.
+ * @param levelRuns is a pointer to a <code>pl_valueRuns</code> object representing the directional levels,
+ *        or <code>NULL</code>.
+ * @param scriptRuns is a pointer to a <code>pl_valueRuns</code> object representing script runs,
+ *        or <code>NULL</code>.
+ * @param localeRuns is a pointer to a <code>pl_localeRuns</code> object representing locale runs,
+ *        or <code>NULL</code>.
+ * @param paragraphLevel is the directionality of the paragraph, as in the UBiDi object.
+ * @param status will be set to any error code encountered during the update.
+ *
+ * @return the number of lines, from the start of the paragraph, which are not changed by the edit.
+ *
+ * @see pl_nextLine
+ *
+ * @internal
+ */
+U_INTERNAL le_int32 U_EXPORT2
+pl_updateText(pl_paragraph *paragraph,
+              const LEUnicode chars[],
+              le_int32 count,
+              le_int32 editStart,
+              le_int32 oldEditLimit,
+              const pl_fontRuns *fontRuns,
+              const pl_valueRuns *levelRuns,
+              const pl_valueRuns *scriptRuns,
+              const pl_localeRuns *localeRuns,
+              UBiDiLevel paragraphLevel,
+              LEErrorCode *status);
+
 /**
  * Return a <code>pl_line</code> object which represents next line
  * in the paragraph. The width of the line is specified each time so that it can
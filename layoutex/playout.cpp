@@ -129,6 +129,30 @@ pl_reflow(pl_paragraph *paragraph)
     return pl->reflow();
 }
 
+U_CAPI le_int32 U_EXPORT2
+pl_updateText(pl_paragraph *paragraph,
+              const LEUnicode chars[],
+              le_int32 count,
+              le_int32 editStart,
+              le_int32 oldEditLimit,
+              const pl_fontRuns *fontRuns,
+              const pl_valueRuns *levelRuns,
+              const pl_valueRuns *scriptRuns,
+              const pl_localeRuns *localeRuns,
+              UBiDiLevel paragraphLevel,
+              LEErrorCode *status)
+{
+    ParagraphLayout *pl = (ParagraphLayout *) paragraph;
+
+    if (pl == NULL) {
+        return 0;
+    }
+
+    return pl->updateText(chars, count, editStart, oldEditLimit, (const FontRuns *) fontRuns,
+        (const ValueRuns *) levelRuns, (const ValueRuns *) scriptRuns, (const LocaleRuns *) localeRuns,
+        paragraphLevel, *status);
+}
+
 U_CAPI pl_line * U_EXPORT2
 pl_nextLine(pl_paragraph *paragraph, float width)
 {
@@ -39,6 +39,10 @@ static void TestAttribute(void);
 static void TestDefault(void);
 static void TestDefaultKeyword(void);
 static void TestBengaliSortKey(void);
+static void TestGetSortKeys(void);
+static void TestSortStrings(void);
+static void TestGetSortKeyPrefix(void);
+static void TestStrcollWithScratch(void);
 
 
 static char* U_EXPORT2 ucol_sortKeyToString(const UCollator *coll, const uint8_t *sortkey, char *buffer, uint32_t len) {
@@ -77,6 +81,10 @@ void addCollAPITest(TestNode** root)
     addTest(root, &TestBounds, "tscoll/capitst/TestBounds");
     addTest(root, &TestGetLocale, "tscoll/capitst/TestGetLocale");
     addTest(root, &TestSortKeyBufferOverrun, "tscoll/capitst/TestSortKeyBufferOverrun");
+    addTest(root, &TestGetSortKeys, "tscoll/capitst/TestGetSortKeys");
+    addTest(root, &TestSortStrings, "tscoll/capitst/TestSortStrings");
+    addTest(root, &TestGetSortKeyPrefix, "tscoll/capitst/TestGetSortKeyPrefix");
+    addTest(root, &TestStrcollWithScratch, "tscoll/capitst/TestStrcollWithScratch");
     addTest(root, &TestAttribute, "tscoll/capitst/TestAttribute");
     addTest(root, &TestGetTailoredSet, "tscoll/capitst/TestGetTailoredSet");
     addTest(root, &TestMergeSortKeys, "tscoll/capitst/TestMergeSortKeys");
@@ -1739,6 +1747,428 @@ void TestSortKeyBufferOverrun(void) {
     ucol_close(coll);
 }
 
+/* Compares the batch sort keys with the ones from ucol_getSortKey(). */
+static void doGetSortKeysTest(const UCollator *coll, const char *name) {
+    static const char *const strings8[] = {
+        "", "a", "A", "ab", "a-b", "co-op", "coop", "\xC3\xA4pfel", "A\xCC\x88pfel",
+        "\xE1\xBA\xA0\xCC\x82", "13 apples", "2 apples", "\xF0\x9F\x98\x80!",
+        "a very Merry liTTle-lamB..", "\xE0\xA6\x95\xE0\xA7\x8D\xE0\xA6\xB7"
+    };
+    enum { COUNT = UPRV_LENGTHOF(strings8) };
+    UChar buffers16[COUNT][40];
+    const UChar *strings16[COUNT];
+    int32_t lengths[COUNT];
+    const char *stringsWithNull8[COUNT + 1];
+    int32_t lengthsWithNull[COUNT + 1];
+    uint8_t dest[2000];
+    uint8_t expected[200];
+    int32_t offsets[COUNT + 2];
+    int32_t totalLength, length, expectedLength, i;
+    UErrorCode status = U_ZERO_ERROR;
+
+    for(i = 0; i < COUNT; ++i) {
+        u_strFromUTF8(buffers16[i], UPRV_LENGTHOF(buffers16[i]), &lengths[i],
+                      strings8[i], -1, &status);
+        strings16[i] = buffers16[i];
+    }
+    if(U_FAILURE(status)) {
+        log_err("%s: u_strFromUTF8() failed - %s\n", name, u_errorName(status));
+        return;
+    }
+
+    /* Preflight, then write into a large enough buffer. */
+    totalLength = ucol_getSortKeys(coll, strings16, lengths, COUNT, NULL, 0, offsets, &status);
+    if(status != U_BUFFER_OVERFLOW_ERROR || totalLength <= 0 || offsets[COUNT] != totalLength) {
+        log_err("%s: ucol_getSortKeys(preflighting) failed - %s, length %d\n",
+                name, u_errorName(status), (int)totalLength);
+        return;
+    }
+    if(totalLength > (int32_t)sizeof(dest)) {
+        log_err("%s: sort keys too long for the test buffer: %d\n", name, (int)totalLength);
+        return;
+    }
+    status = U_ZERO_ERROR;
+    length = ucol_getSortKeys(coll, strings16, lengths, COUNT, dest, (int32_t)sizeof(dest),
+                              offsets, &status);
+    if(U_FAILURE(status) || length != totalLength) {
+        log_err("%s: ucol_getSortKeys() failed - %s, length %d != %d\n",
+                name, u_errorName(status), (int)length, (int)totalLength);
+        return;
+    }
+    for(i = 0; i < COUNT; ++i) {
+        expectedLength = ucol_getSortKey(coll, strings16[i], lengths[i],
+                                         expected, (int32_t)sizeof(expected));
+        if(offsets[i + 1] - offsets[i] != expectedLength ||
+                uprv_memcmp(dest + offsets[i], expected, expectedLength) != 0) {
+            log_err("%s: ucol_getSortKeys() key %d differs from ucol_getSortKey()\n", name, (int)i);
+        }
+    }
+
+    /* NUL-terminated strings give the same keys. */
+    length = ucol_getSortKeys(coll, strings16, NULL, COUNT, dest + totalLength,
+                              (int32_t)sizeof(dest) - totalLength, offsets, &status);
+    if(U_FAILURE(status) || length != totalLength ||
+            uprv_memcmp(dest, dest + totalLength, totalLength) != 0) {
+        log_err("%s: ucol_getSortKeys(NUL-terminated) failed - %s\n", name, u_errorName(status));
+    }
+
+    /* Too small a buffer must not be overrun. */
+    uprv_memset(dest, 0xff, sizeof(dest));
+    length = ucol_getSortKeys(coll, strings16, lengths, COUNT, dest, totalLength - 1,
+                              offsets, &status);
+    if(status != U_BUFFER_OVERFLOW_ERROR || length != totalLength) {
+        log_err("%s: ucol_getSortKeys(short buffer) failed - %s\n", name, u_errorName(status));
+    }
+    if(dest[totalLength - 1] != 0xff) {
+        log_err("%s: ucol_getSortKeys() wrote beyond the buffer capacity\n", name);
+    }
+
+    /* UTF-8, with a NULL empty string at the end. */
+    for(i = 0; i < COUNT; ++i) {
+        stringsWithNull8[i] = strings8[i];
+        lengthsWithNull[i] = (i & 1) ? -1 : (int32_t)strlen(strings8[i]);
+    }
+    stringsWithNull8[COUNT] = NULL;
+    lengthsWithNull[COUNT] = 0;
+    status = U_ZERO_ERROR;
+    length = ucol_getSortKeysUTF8(coll, stringsWithNull8, lengthsWithNull, COUNT + 1,
+                                  dest, (int32_t)sizeof(dest), offsets, &status);
+    if(U_FAILURE(status)) {
+        log_err("%s: ucol_getSortKeysUTF8() failed - %s\n", name, u_errorName(status));
+        return;
+    }
+    for(i = 0; i <= COUNT; ++i) {
+        static const UChar empty[1] = { 0 };
+        expectedLength = ucol_getSortKey(coll, i < COUNT ? strings16[i] : empty,
+                                         i < COUNT ? lengths[i] : 0,
+                                         expected, (int32_t)sizeof(expected));
+        if(offsets[i + 1] - offsets[i] != expectedLength ||
+                uprv_memcmp(dest + offsets[i], expected, expectedLength) != 0) {
+            log_err("%s: ucol_getSortKeysUTF8() key %d differs from ucol_getSortKey()\n",
+                    name, (int)i);
+        }
+    }
+    if(length != offsets[COUNT + 1]) {
+        log_err("%s: ucol_getSortKeysUTF8() returned %d != last offset %d\n",
+                name, (int)length, (int)offsets[COUNT + 1]);
+    }
+
+    /* Single UTF-8 keys, with preflighting. */
+    for(i = 0; i < COUNT; ++i) {
+        expectedLength = ucol_getSortKey(coll, strings16[i], lengths[i],
+                                         expected, (int32_t)sizeof(expected));
+        length = ucol_getSortKeyUTF8(coll, strings8[i], lengthsWithNull[i], NULL, 0);
+        if(length != expectedLength) {
+            log_err("%s: ucol_getSortKeyUTF8(preflighting) key %d length %d != %d\n",
+                    name, (int)i, (int)length, (int)expectedLength);
+        }
+        length = ucol_getSortKeyUTF8(coll, strings8[i], lengthsWithNull[i],
+                                     dest, (int32_t)sizeof(dest));
+        if(length != expectedLength || uprv_memcmp(dest, expected, expectedLength) != 0) {
+            log_err("%s: ucol_getSortKeyUTF8() key %d differs from ucol_getSortKey()\n",
+                    name, (int)i);
+        }
+    }
+
+    /* A NULL string with a non-zero length is an error. */
+    lengthsWithNull[COUNT] = 1;
+    status = U_ZERO_ERROR;
+    ucol_getSortKeysUTF8(coll, stringsWithNull8, lengthsWithNull, COUNT + 1,
+                         dest, (int32_t)sizeof(dest), offsets, &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("%s: ucol_getSortKeysUTF8(NULL string) - %s != U_ILLEGAL_ARGUMENT_ERROR\n",
+                name, u_errorName(status));
+    }
+}
+
+static void TestGetSortKeys(void) {
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("de", &status);
+    if(U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(de) failed - %s\n", u_errorName(status));
+        return;
+    }
+    doGetSortKeysTest(coll, "de");
+    ucol_setAttribute(coll, UCOL_NORMALIZATION_MODE, UCOL_ON, &status);
+    ucol_setAttribute(coll, UCOL_NUMERIC_COLLATION, UCOL_ON, &status);
+    doGetSortKeysTest(coll, "de/normalization/numeric");
+    ucol_setAttribute(coll, UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, &status);
+    ucol_setAttribute(coll, UCOL_STRENGTH, UCOL_QUATERNARY, &status);
+    doGetSortKeysTest(coll, "de/shifted/quaternary");
+    ucol_setAttribute(coll, UCOL_STRENGTH, UCOL_IDENTICAL, &status);
+    doGetSortKeysTest(coll, "de/shifted/identical");
+    ucol_setAttribute(coll, UCOL_NORMALIZATION_MODE, UCOL_OFF, &status);
+    doGetSortKeysTest(coll, "de/identical");
+    if(U_FAILURE(status)) {
+        log_err("ucol_setAttribute() failed - %s\n", u_errorName(status));
+    }
+    ucol_close(coll);
+}
+
+static void TestSortStrings(void) {
+    /* Pairs of strings that are equal at tertiary strength must keep their order. */
+    static const char *const inputs[] = {
+        "Bach", "\\u00e4b", "ab", "b\\u0308", "a\\u0301b", "zz", "A", "a", "\\u00fc", "u\\u0308",
+        "ab", "", "1a", "Ab", "b"
+    };
+    enum { COUNT = UPRV_LENGTHOF(inputs) };
+    UChar buffers[COUNT][20];
+    const UChar *strings[COUNT];
+    const UChar *expected[COUNT];
+    int32_t lengths[COUNT];
+    int32_t i, j;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("de", &status);
+    if(U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(de) failed - %s\n", u_errorName(status));
+        return;
+    }
+    ucol_setAttribute(coll, UCOL_NORMALIZATION_MODE, UCOL_ON, &status);
+    for(i = 0; i < COUNT; ++i) {
+        u_unescape(inputs[i], buffers[i], UPRV_LENGTHOF(buffers[i]));
+        expected[i] = buffers[i];
+    }
+    /* Expected: a stable insertion sort with ucol_strcoll(). */
+    for(i = 1; i < COUNT; ++i) {
+        const UChar *s = expected[i];
+        for(j = i; j > 0 && ucol_strcoll(coll, expected[j - 1], -1, s, -1) == UCOL_GREATER; --j) {
+            expected[j] = expected[j - 1];
+        }
+        expected[j] = s;
+    }
+
+    /* With lengths that are permuted together with the strings. */
+    for(i = 0; i < COUNT; ++i) {
+        strings[i] = buffers[i];
+        lengths[i] = (i & 1) ? -1 : u_strlen(buffers[i]);
+    }
+    ucol_sortStrings(coll, strings, lengths, COUNT, &status);
+    if(U_FAILURE(status)) {
+        log_err("ucol_sortStrings() failed - %s\n", u_errorName(status));
+    } else {
+        for(i = 0; i < COUNT; ++i) {
+            int32_t inputIndex = (int32_t)(strings[i] - buffers[0]) / UPRV_LENGTHOF(buffers[0]);
+            if(strings[i] != expected[i]) {
+                log_err("ucol_sortStrings() [%d] is input string %d, expected %d\n",
+                        (int)i, (int)inputIndex,
+                        (int)((expected[i] - buffers[0]) / UPRV_LENGTHOF(buffers[0])));
+            }
+            if(lengths[i] != ((inputIndex & 1) ? -1 : u_strlen(strings[i]))) {
+                log_err("ucol_sortStrings() [%d] length %d not moved with its string\n",
+                        (int)i, (int)lengths[i]);
+            }
+        }
+    }
+
+    /* NUL-terminated strings, reverse input order. */
+    for(i = 0; i < COUNT; ++i) {
+        strings[i] = expected[COUNT - 1 - i];
+    }
+    ucol_sortStrings(coll, strings, NULL, COUNT, &status);
+    if(U_FAILURE(status)) {
+        log_err("ucol_sortStrings(NULL lengths) failed - %s\n", u_errorName(status));
+    } else {
+        for(i = 1; i < COUNT; ++i) {
+            if(ucol_strcoll(coll, strings[i - 1], -1, strings[i], -1) == UCOL_GREATER) {
+                log_err("ucol_sortStrings(NULL lengths) [%d] > [%d]\n", (int)(i - 1), (int)i);
+            }
+        }
+    }
+
+    /* Trivial and illegal arguments. */
+    ucol_sortStrings(coll, NULL, NULL, 0, &status);
+    if(U_FAILURE(status)) {
+        log_err("ucol_sortStrings(count=0) failed - %s\n", u_errorName(status));
+    }
+    ucol_sortStrings(coll, NULL, NULL, 2, &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_sortStrings(NULL strings) - %s != U_ILLEGAL_ARGUMENT_ERROR\n",
+                u_errorName(status));
+    }
+    ucol_close(coll);
+}
+
+static void doGetSortKeyPrefixTest(const UCollator *coll, const char *name) {
+    static const char *const inputs[] = {
+        "", "a", "ab", "Ab", "\\u00e4b", "abcdefghijklmnopqrstuvwxyz", "abcdefghijklmnopqrstuvwxyZ",
+        "\\u4e00\\u4e01", "1234567890", "1234567891",
+        "a b c d e f g h i j", "a-b-c-d-e-f-g-h-i-j", "\\u4e00\\u4e01\\u4e02\\u4e03\\u4e04\\u4e05"
+    };
+    static const int32_t prefixLengths[] = { 1, 3, 8, 16, 100 };
+    enum { COUNT = UPRV_LENGTHOF(inputs), MAX_PREFIX = 100 };
+    UChar strings[COUNT][40];
+    uint8_t prefixes[COUNT][MAX_PREFIX + 1];
+    int32_t prefixKeyLengths[COUNT];
+    uint8_t key[500];
+    uint8_t lengthPrefix[MAX_PREFIX];
+    uint8_t bounded[MAX_PREFIX + 1];
+    int32_t i, j, p;
+    for(i = 0; i < COUNT; ++i) {
+        u_unescape(inputs[i], strings[i], UPRV_LENGTHOF(strings[i]));
+    }
+    for(p = 0; p < UPRV_LENGTHOF(prefixLengths); ++p) {
+        int32_t prefixLength = prefixLengths[p];
+        for(i = 0; i < COUNT; ++i) {
+            UErrorCode status = U_ZERO_ERROR;
+            int32_t keyLength = ucol_getSortKey(coll, strings[i], -1, key, (int32_t)sizeof(key)) - 1;
+            int32_t expectedLength = keyLength < prefixLength ? keyLength : prefixLength;
+            prefixes[i][prefixLength] = 0xff;
+            prefixKeyLengths[i] = ucol_getSortKeyPrefix(coll, strings[i], -1,
+                                                       prefixes[i], prefixLength, &status);
+            if(U_FAILURE(status) || prefixKeyLengths[i] != expectedLength) {
+                log_err("%s: ucol_getSortKeyPrefix(%s, %d) failed - %s, length %d != %d\n",
+                        name, inputs[i], (int)prefixLength, u_errorName(status),
+                        (int)prefixKeyLengths[i], (int)expectedLength);
+                continue;
+            }
+            if(uprv_memcmp(prefixes[i], key, expectedLength) != 0) {
+                log_err("%s: ucol_getSortKeyPrefix(%s, %d) differs from the sort key\n",
+                        name, inputs[i], (int)prefixLength);
+            }
+            for(j = expectedLength; j < prefixLength; ++j) {
+                if(prefixes[i][j] != 0) {
+                    log_err("%s: ucol_getSortKeyPrefix(%s, %d) not zero-padded\n",
+                            name, inputs[i], (int)prefixLength);
+                    break;
+                }
+            }
+            if(prefixes[i][prefixLength] != 0xff) {
+                log_err("%s: ucol_getSortKeyPrefix(%s, %d) wrote beyond the prefix\n",
+                        name, inputs[i], (int)prefixLength);
+            }
+            /* The same prefix for the string with its length. */
+            if(ucol_getSortKeyPrefix(coll, strings[i], u_strlen(strings[i]),
+                                     lengthPrefix, prefixLength, &status) != prefixKeyLengths[i] ||
+                    U_FAILURE(status) ||
+                    uprv_memcmp(lengthPrefix, prefixes[i], prefixLength) != 0) {
+                log_err("%s: ucol_getSortKeyPrefix(%s, length, %d) differs from NUL-terminated\n",
+                        name, inputs[i], (int)prefixLength);
+            }
+            /* The bounded key is the complete sort key if it fits, else its prefix. */
+            expectedLength = keyLength < prefixLength ? keyLength + 1 : prefixLength;
+            bounded[prefixLength] = 0xff;
+            if(ucol_getBoundedSortKey(coll, strings[i], -1,
+                                      bounded, prefixLength, &status) != expectedLength ||
+                    U_FAILURE(status) ||
+                    uprv_memcmp(bounded, key, expectedLength) != 0 ||
+                    bounded[prefixLength] != 0xff) {
+                log_err("%s: ucol_getBoundedSortKey(%s, %d) differs from the sort key - %s\n",
+                        name, inputs[i], (int)prefixLength, u_errorName(status));
+            }
+        }
+        /* Prefix order must agree with the collation order. */
+        for(i = 0; i < COUNT; ++i) {
+            for(j = 0; j < COUNT; ++j) {
+                UCollationResult order = ucol_strcoll(coll, strings[i], -1, strings[j], -1);
+                int32_t prefixOrder = uprv_memcmp(prefixes[i], prefixes[j], prefixLength);
+                if((order == UCOL_LESS && prefixOrder > 0) ||
+                        (order == UCOL_GREATER && prefixOrder < 0) ||
+                        (order != UCOL_EQUAL && prefixOrder == 0 &&
+                            prefixKeyLengths[i] < prefixLength &&
+                            prefixKeyLengths[j] < prefixLength)) {
+                    log_err("%s: prefixes of length %d for %s and %s are out of order\n",
+                            name, (int)prefixLength, inputs[i], inputs[j]);
+                }
+            }
+        }
+    }
+}
+
+static void TestGetSortKeyPrefix(void) {
+    static const UChar abc[] = { 0x61, 0x62, 0x63, 0 };
+    uint8_t prefix[8];
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("de", &status);
+    if(U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(de) failed - %s\n", u_errorName(status));
+        return;
+    }
+    doGetSortKeyPrefixTest(coll, "de");
+    ucol_setAttribute(coll, UCOL_NUMERIC_COLLATION, UCOL_ON, &status);
+    ucol_setAttribute(coll, UCOL_CASE_LEVEL, UCOL_ON, &status);
+    doGetSortKeyPrefixTest(coll, "de/numeric/caseLevel");
+    ucol_setAttribute(coll, UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, &status);
+    ucol_setAttribute(coll, UCOL_STRENGTH, UCOL_IDENTICAL, &status);
+    doGetSortKeyPrefixTest(coll, "de/shifted/identical");
+    if(U_FAILURE(status)) {
+        log_err("ucol_setAttribute() failed - %s\n", u_errorName(status));
+    }
+
+    /* Illegal arguments. */
+    ucol_getSortKeyPrefix(coll, abc, -1, prefix, 0, &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_getSortKeyPrefix(prefixLength=0) - %s != U_ILLEGAL_ARGUMENT_ERROR\n",
+                u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ucol_getSortKeyPrefix(coll, NULL, 3, prefix, (int32_t)sizeof(prefix), &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_getSortKeyPrefix(NULL, 3) - %s != U_ILLEGAL_ARGUMENT_ERROR\n",
+                u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ucol_getBoundedSortKey(coll, abc, -1, prefix, 0, &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_getBoundedSortKey(maxLength=0) - %s != U_ILLEGAL_ARGUMENT_ERROR\n",
+                u_errorName(status));
+    }
+    ucol_close(coll);
+}
+
+static void TestStrcollWithScratch(void) {
+    static const char *const inputs[] = {
+        "", "a", "A", "ab", "\\u00e4b", "a\\u0308b", "a\\u0327\\u0301b", "a\\u0301\\u0327b",
+        "abc10", "abc9", "\\u4e00\\u4e01", "\\u0f73\\u0f71", "a-b", "ab-"
+    };
+    enum { COUNT = UPRV_LENGTHOF(inputs) };
+    static const UColAttributeValue normalization[] = { UCOL_OFF, UCOL_ON };
+    UChar strings[COUNT][20];
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("de", &status);
+    UCollatorScratch *scratch;
+    int32_t i, j, n;
+    if(U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(de) failed - %s\n", u_errorName(status));
+        return;
+    }
+    scratch = ucol_openScratch(&status);
+    if(U_FAILURE(status)) {
+        log_err("ucol_openScratch() failed - %s\n", u_errorName(status));
+        ucol_close(coll);
+        return;
+    }
+    for(i = 0; i < COUNT; ++i) {
+        u_unescape(inputs[i], strings[i], UPRV_LENGTHOF(strings[i]));
+    }
+    /* The same scratch is reused across attribute changes and both string lengths. */
+    ucol_setAttribute(coll, UCOL_NUMERIC_COLLATION, UCOL_ON, &status);
+    ucol_setAttribute(coll, UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, &status);
+    for(n = 0; n < UPRV_LENGTHOF(normalization); ++n) {
+        ucol_setAttribute(coll, UCOL_NORMALIZATION_MODE, normalization[n], &status);
+        for(i = 0; i < COUNT; ++i) {
+            for(j = 0; j < COUNT; ++j) {
+                UCollationResult expected = ucol_strcoll(coll, strings[i], -1, strings[j], -1);
+                UCollationResult actual = ucol_strcollWithScratch(
+                    coll, scratch, strings[i], -1, strings[j], u_strlen(strings[j]), &status);
+                if(U_FAILURE(status) || actual != expected) {
+                    log_err("ucol_strcollWithScratch(%s, %s) = %d != %d - %s\n",
+                            inputs[i], inputs[j], (int)actual, (int)expected, u_errorName(status));
+                    status = U_ZERO_ERROR;
+                }
+            }
+        }
+    }
+
+    /* Illegal arguments. */
+    ucol_strcollWithScratch(coll, NULL, strings[1], -1, strings[2], -1, &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_strcollWithScratch(scratch=NULL) - %s != U_ILLEGAL_ARGUMENT_ERROR\n",
+                u_errorName(status));
+    }
+    ucol_closeScratch(scratch);
+    ucol_close(coll);
+}
+
 static void TestAttribute()
 {
     UErrorCode error = U_ZERO_ERROR;
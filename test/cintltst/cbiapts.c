@@ -52,6 +52,7 @@ static void TestBreakIteratorTailoring(void);
 static void TestBreakIteratorRefresh(void);
 static void TestBug11665(void);
 static void TestBreakIteratorSuppressions(void);
+static void TestBreakIteratorGetBoundaries(void);
 
 void addBrkIterAPITest(TestNode** root);
 
@@ -71,6 +72,7 @@ void addBrkIterAPITest(TestNode** root)
 #if !UCONFIG_NO_FILTERED_BREAK_ITERATION
     addTest(root, &TestBreakIteratorSuppressions, "tstxtbd/cbiapts/TestBreakIteratorSuppressions");
 #endif
+    addTest(root, &TestBreakIteratorGetBoundaries, "tstxtbd/cbiapts/TestBreakIteratorGetBoundaries");
 }
 
 #define CLONETEST_ITERATOR_COUNT 2
@@ -1110,4 +1112,68 @@ static void TestBreakIteratorSuppressions(void) {
 }
 
 
+/*
+ *  TestBreakIteratorGetBoundaries
+ *
+ *         ubrk_getBoundaries() returns the same boundaries and rule status values
+ *         as iterating with ubrk_next().
+ */
+static void TestBreakIteratorGetBoundaries(void) {
+    UChar rules[200];
+    UChar text[40];
+    int32_t boundaries[10];
+    int32_t statuses[10];
+    int32_t count;
+    UErrorCode status = U_ZERO_ERROR;
+    UBreakIterator *bi;
+
+    u_uastrncpy(rules, "[a-z]+ {100}; [0-9]+ {200}; !.*;", UPRV_LENGTHOF(rules));
+    u_uastrncpy(text, "abc 12 de, 3456", UPRV_LENGTHOF(text));
+    /*                 0  34 6 7 9 1   5 */
+    bi = ubrk_openRules(rules, -1, text, -1, NULL, &status);
+    if (U_FAILURE(status)) {
+        log_err("FAIL: ubrk_openRules() failed - %s\n", u_errorName(status));
+        return;
+    }
+
+    {
+        static const int32_t expected[] = { 0, 3, 4, 6, 7, 9, 10, 11, 15 };
+        static const int32_t expectedStatuses[] = { 0, 100, 0, 200, 0, 100, 0, 0, 200 };
+        int32_t i;
+        /* The limit is clamped to the text. */
+        count = ubrk_getBoundaries(bi, 0, 100, boundaries, statuses, UPRV_LENGTHOF(boundaries), &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(count == UPRV_LENGTHOF(expected));
+        for (i = 0; i < UPRV_LENGTHOF(expected) && i < count; ++i) {
+            if (boundaries[i] != expected[i] || statuses[i] != expectedStatuses[i]) {
+                log_err("FAIL: ubrk_getBoundaries() boundary %d is %d status %d, expected %d status %d\n",
+                        i, boundaries[i], statuses[i], expected[i], expectedStatuses[i]);
+            }
+        }
+    }
+    /* The iterator is left at the last boundary in the range. */
+    TEST_ASSERT(ubrk_current(bi) == 15);
+
+    /* A range within the text, without rule status values. */
+    count = ubrk_getBoundaries(bi, 5, 9, boundaries, NULL, UPRV_LENGTHOF(boundaries), &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(count == 3 && boundaries[0] == 6 && boundaries[1] == 7 && boundaries[2] == 9);
+    TEST_ASSERT(ubrk_current(bi) == 9);
+    TEST_ASSERT(ubrk_next(bi) == 10);
+
+    /* Preflighting. */
+    count = ubrk_getBoundaries(bi, 1, 12, NULL, NULL, 0, &status);
+    TEST_ASSERT(status == U_BUFFER_OVERFLOW_ERROR);
+    TEST_ASSERT(count == 7);
+    status = U_ZERO_ERROR;
+    count = ubrk_getBoundaries(bi, 1, 12, boundaries, NULL, 2, &status);
+    TEST_ASSERT(status == U_BUFFER_OVERFLOW_ERROR);
+    TEST_ASSERT(count == 7 && boundaries[0] == 3 && boundaries[1] == 4);
+    status = U_ZERO_ERROR;
+
+    ubrk_getBoundaries(bi, 5, 4, boundaries, NULL, UPRV_LENGTHOF(boundaries), &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    ubrk_close(bi);
+}
+
 #endif /* #if !UCONFIG_NO_BREAK_ITERATION */
@@ -19,11 +19,13 @@
 #include "unicode/uchar.h"
 #include "unicode/ustring.h"
 #include "unicode/ubidi.h"
+#include "unicode/uclean.h"
 #include "unicode/ushape.h"
 #include "cbiditst.h"
 #include "cstring.h"
 /* the following include is needed for sprintf */
 #include <stdio.h>
+#include <stdlib.h>
 
 #define MAXLEN      MAX_STRING_LENGTH
 
@@ -97,6 +99,8 @@ static void testReorderingMode(void);
 static void testReorderRunsOnly(void);
 static void testStreaming(void);
 static void testClassOverride(void);
+static void testUnidirectional(void);
+static void testOpenBuffer(void);
 static const char* inverseBasic(UBiDi *pBiDi, const char *src, int32_t srcLen,
                                 uint32_t option, UBiDiLevel level, char *result);
 static UBool assertRoundTrip(UBiDi *pBiDi, int32_t tc, int32_t outIndex,
@@ -136,6 +140,8 @@ addComplexTest(TestNode** root) {
     addTest(root, testReorderRunsOnly, "complex/bidi/TestReorderRunsOnly");
     addTest(root, testStreaming, "complex/bidi/TestStreaming");
     addTest(root, testClassOverride, "complex/bidi/TestClassOverride");
+    addTest(root, testUnidirectional, "complex/bidi/TestUnidirectional");
+    addTest(root, testOpenBuffer, "complex/bidi/TestOpenBuffer");
     addTest(root, testGetBaseDirection, "complex/bidi/testGetBaseDirection");
     addTest(root, testContext, "complex/bidi/testContext");
     addTest(root, testBracketOverflow, "complex/bidi/TestBracketOverflow");
@@ -2462,8 +2468,12 @@ doArabicShapingTest(void) {
         0x6f1, 0x627, 0x32, 0x6f3, 0x61, 0x6f4, 0
     }, lamalef[]={
         0xfefb, 0
+    }, latin[]={
+        0x20, 0x61, 0x34, 0x20, 0x2d, 0x20, 0x7a, 0x32, 0
+    }, latin_en2an[]={
+        0x20, 0x61, 0x664, 0x20, 0x2d, 0x20, 0x7a, 0x662, 0
     };
-    UChar dest[8];
+    UChar dest[10];
     UErrorCode errorCode;
     int32_t length;
 
@@ -2539,6 +2549,26 @@ doArabicShapingTest(void) {
         log_err("failure in u_shapeArabic(noop)\n");
     }
 
+    /* text without Arabic letters is not changed by letter shaping, but its digits are shaped */
+    errorCode=U_ZERO_ERROR;
+    length=u_shapeArabic(latin, -1,
+                         dest, UPRV_LENGTHOF(dest),
+                         U_SHAPE_LETTERS_SHAPE|U_SHAPE_LENGTH_GROW_SHRINK|U_SHAPE_TEXT_DIRECTION_LOGICAL|
+                         U_SHAPE_DIGITS_EN2AN|U_SHAPE_DIGIT_TYPE_AN,
+                         &errorCode);
+    if(U_FAILURE(errorCode) || length!=u_strlen(latin) || memcmp(dest, latin_en2an, (length+1)*U_SIZEOF_UCHAR)!=0) {
+        log_err("failure in u_shapeArabic(latin, shape+en2an)\n");
+    }
+
+    errorCode=U_ZERO_ERROR;
+    length=u_shapeArabic(latin, -1,
+                         dest, UPRV_LENGTHOF(dest),
+                         U_SHAPE_LETTERS_UNSHAPE|U_SHAPE_LENGTH_FIXED_SPACES_NEAR,
+                         &errorCode);
+    if(U_FAILURE(errorCode) || length!=u_strlen(latin) || memcmp(dest, latin, (length+1)*U_SIZEOF_UCHAR)!=0) {
+        log_err("failure in u_shapeArabic(latin, unshape)\n");
+    }
+
     errorCode=U_ZERO_ERROR;
     length=u_shapeArabic(source, 0,
                          dest, UPRV_LENGTHOF(dest),
@@ -4622,6 +4652,319 @@ testClassOverride(void) {
     log_verbose("\nExiting TestClassOverride\n\n");
 }
 
+U_CDECL_BEGIN
+
+static UCharDirection U_CALLCONV
+defaultBidiClass(const void *context, UChar32 c) {
+    (void)context;
+    (void)c;
+    return U_BIDI_CLASS_DEFAULT;
+}
+
+U_CDECL_END
+
+/*
+ * ubidi_setPara() handles unidirectional paragraphs without running the
+ * whole algorithm. Setting a class callback disables that, so compare
+ * the results with and without one.
+ */
+static void
+testUnidirectional(void) {
+    static const struct {
+        const char *text;
+        UBiDiLevel paraLevel;
+        uint32_t options;
+    } testCases[] = {
+        { "The quick brown fox jumps over the lazy dog, 42 times.", UBIDI_DEFAULT_LTR, 0 },
+        { "The quick brown fox jumps over the lazy dog, 42 times.", UBIDI_DEFAULT_RTL, 0 },
+        { "The quick brown fox jumps over the lazy dog, 42 times.", 2, 0 },
+        { "The quick brown fox jumps over the lazy dog, 42 times.", 1, 0 },
+        { "  (123) caf\\u00E9 \\u00A0\\u00AD\\u00C5ngstr\\u00F6m\\u00BF\\u007F\\t.", UBIDI_DEFAULT_RTL, 0 },
+        { "1234567890 1234567890 1234567890", UBIDI_DEFAULT_RTL, 0 },
+        { "1234567890 1234567890 1234567890", UBIDI_DEFAULT_LTR, 0 },
+        { "Latin text with one \\u05D0 Hebrew letter in it", UBIDI_DEFAULT_LTR, 0 },
+        { "Latin text with one \\u0661 Arabic digit in it", UBIDI_LTR, 0 },
+        { "Latin text\\u200E with\\u200D controls\\u200E", UBIDI_LTR, UBIDI_OPTION_REMOVE_CONTROLS },
+        { "Latin text \\U0001D400\\U0001D401 with surrogates", UBIDI_DEFAULT_LTR, 0 },
+        { "Latin text ending with CR LF\\r\\n", UBIDI_DEFAULT_LTR, 0 },
+        { "Two\\r\\nparagraphs", UBIDI_DEFAULT_RTL, 0 },
+        { "Latin text \\u202Bwith an\\u202C embedding", UBIDI_LTR, 0 },
+        { "\\u05D0\\u05D1\\u05D2 \\u05D3\\u05D4, \\u05D5!", UBIDI_DEFAULT_LTR, 0 },
+        { "\\u05D0\\u05D1\\u05D2 \\u05D3\\u05D4, \\u05D5!", UBIDI_RTL, 0 },
+        { "\\u05D0\\u05D1\\u05D2 \\u05D3\\u05D4, \\u05D5!", UBIDI_LTR, 0 },
+        { "\\u05D0\\u05D1\\u05D2 \\u0301\\u05D3\\u05D4 \\U00010900\\u200F\\n", UBIDI_DEFAULT_LTR, UBIDI_OPTION_REMOVE_CONTROLS },
+        { "\\u0627\\u0644\\u0639\\u0631\\u0628\\u064A\\u0629 \\u0661\\u0662", UBIDI_DEFAULT_LTR, 0 },
+        { "\\u0627\\u0644\\u0639\\u0631\\u0628\\u064A\\u0629 12", UBIDI_RTL, 0 },
+        { "\\u0661\\u0662\\u0663", UBIDI_LTR, 0 },
+        { "\\u0661 \\u0662", UBIDI_LTR, 0 }
+    };
+    static const UBiDiReorderingMode modes[] = {
+        UBIDI_REORDER_DEFAULT, UBIDI_REORDER_NUMBERS_SPECIAL, UBIDI_REORDER_INVERSE_LIKE_DIRECT
+    };
+    UChar src[MAXLEN], dest1[MAXLEN], dest2[MAXLEN];
+    UBiDiLevel levels1[MAXLEN];
+    int32_t map1[MAXLEN], map2[MAXLEN];
+    UBiDi *pBiDi1, *pBiDi2, *pLine1, *pLine2;
+    UErrorCode rc = U_ZERO_ERROR;
+    int32_t i, m, srcLen, destLen1, destLen2, limit;
+
+    log_verbose("\nEntering TestUnidirectional\n\n");
+
+    pBiDi1 = ubidi_open();
+    pBiDi2 = ubidi_open();
+    pLine1 = ubidi_open();
+    pLine2 = ubidi_open();
+    ubidi_setClassCallback(pBiDi2, defaultBidiClass, NULL, NULL, NULL, &rc);
+    if (!assertSuccessful("ubidi_setClassCallback", &rc)) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < UPRV_LENGTHOF(testCases); i++) {
+        srcLen = u_unescape(testCases[i].text, src, MAXLEN);
+        for (m = 0; m < UPRV_LENGTHOF(modes); m++) {
+            const UBiDiLevel *levels2;
+            ubidi_setReorderingMode(pBiDi1, modes[m]);
+            ubidi_setReorderingMode(pBiDi2, modes[m]);
+            ubidi_setReorderingOptions(pBiDi1, testCases[i].options);
+            ubidi_setReorderingOptions(pBiDi2, testCases[i].options);
+            ubidi_setPara(pBiDi1, src, srcLen, testCases[i].paraLevel, NULL, &rc);
+            ubidi_setPara(pBiDi2, src, srcLen, testCases[i].paraLevel, NULL, &rc);
+            if (!assertSuccessful("ubidi_setPara", &rc)) {
+                goto cleanup;
+            }
+            if (ubidi_getDirection(pBiDi1) != ubidi_getDirection(pBiDi2) ||
+                    ubidi_getParaLevel(pBiDi1) != ubidi_getParaLevel(pBiDi2) ||
+                    ubidi_countParagraphs(pBiDi1) != ubidi_countParagraphs(pBiDi2) ||
+                    ubidi_getResultLength(pBiDi1) != ubidi_getResultLength(pBiDi2) ||
+                    ubidi_countRuns(pBiDi1, &rc) != ubidi_countRuns(pBiDi2, &rc)) {
+                log_err("Test case %d mode %d: direction %d/%d, paraLevel %d/%d, "
+                        "paragraphs %d/%d or runs %d/%d differ\n", i, modes[m],
+                        ubidi_getDirection(pBiDi1), ubidi_getDirection(pBiDi2),
+                        ubidi_getParaLevel(pBiDi1), ubidi_getParaLevel(pBiDi2),
+                        ubidi_countParagraphs(pBiDi1), ubidi_countParagraphs(pBiDi2),
+                        ubidi_countRuns(pBiDi1, &rc), ubidi_countRuns(pBiDi2, &rc));
+            }
+            uprv_memcpy(levels1, ubidi_getLevels(pBiDi1, &rc), srcLen);
+            levels2 = ubidi_getLevels(pBiDi2, &rc);
+            ubidi_getLogicalMap(pBiDi1, map1, &rc);
+            ubidi_getLogicalMap(pBiDi2, map2, &rc);
+            destLen1 = ubidi_writeReordered(pBiDi1, dest1, MAXLEN, UBIDI_DO_MIRRORING, &rc);
+            destLen2 = ubidi_writeReordered(pBiDi2, dest2, MAXLEN, UBIDI_DO_MIRRORING, &rc);
+            if (!assertSuccessful("ubidi_getLevels/getLogicalMap/writeReordered", &rc)) {
+                goto cleanup;
+            }
+            if (uprv_memcmp(levels1, levels2, srcLen) != 0 ||
+                    uprv_memcmp(map1, map2, srcLen * sizeof(int32_t)) != 0 ||
+                    destLen1 != destLen2 ||
+                    uprv_memcmp(dest1, dest2, destLen1 * U_SIZEOF_UCHAR) != 0) {
+                log_err("Test case %d mode %d: levels, map or reordered text differ\n", i, modes[m]);
+            }
+
+            if (ubidi_countParagraphs(pBiDi1) != 1) {
+                continue;
+            }
+            limit = (srcLen + 1) / 2;
+            ubidi_setLine(pBiDi1, 1, limit, pLine1, &rc);
+            ubidi_setLine(pBiDi2, 1, limit, pLine2, &rc);
+            if (!assertSuccessful("ubidi_setLine", &rc)) {
+                goto cleanup;
+            }
+            uprv_memcpy(levels1, ubidi_getLevels(pLine1, &rc), limit - 1);
+            levels2 = ubidi_getLevels(pLine2, &rc);
+            destLen1 = ubidi_writeReordered(pLine1, dest1, MAXLEN, UBIDI_DO_MIRRORING, &rc);
+            destLen2 = ubidi_writeReordered(pLine2, dest2, MAXLEN, UBIDI_DO_MIRRORING, &rc);
+            if (!assertSuccessful("ubidi_getLevels/writeReordered for a line", &rc)) {
+                goto cleanup;
+            }
+            if (ubidi_getDirection(pLine1) != ubidi_getDirection(pLine2) ||
+                    uprv_memcmp(levels1, levels2, limit - 1) != 0 ||
+                    destLen1 != destLen2 ||
+                    uprv_memcmp(dest1, dest2, destLen1 * U_SIZEOF_UCHAR) != 0) {
+                log_err("Test case %d mode %d: line direction, levels or reordered text differ\n",
+                        i, modes[m]);
+            }
+        }
+    }
+
+cleanup:
+    ubidi_close(pLine2);
+    ubidi_close(pLine1);
+    ubidi_close(pBiDi2);
+    ubidi_close(pBiDi1);
+    log_verbose("\nExiting TestUnidirectional\n\n");
+}
+
+static int32_t gBidiScopeAllocCount = 0;
+
+static void * U_CALLCONV bidiCountingAlloc(const void *context, size_t size) {
+    (void)context;
+    ++gBidiScopeAllocCount;
+    return malloc(size);
+}
+
+static void * U_CALLCONV bidiCountingRealloc(const void *context, void *mem, size_t size) {
+    (void)context;
+    ++gBidiScopeAllocCount;
+    return realloc(mem, size);
+}
+
+static void U_CALLCONV bidiCountingFree(const void *context, void *mem) {
+    (void)context;
+    free(mem);
+}
+
+static UBool U_CALLCONV bidiCountingContains(const void *context, const void *mem) {
+    (void)context;
+    (void)mem;
+    return FALSE;
+}
+
+/*
+ * Objects opened with ubidi_openBuffer() must give the same results as
+ * heap objects, reject texts beyond their sizings, and lay out lines from a
+ * pool of line objects without heap allocations once they are set up.
+ */
+static void
+testOpenBuffer(void) {
+    static const char *const texts[] = {
+        "abc \\u05d0\\u05d1\\u05d2 123 def",
+        "\\u05d0\\u05d1 (abc 12) \\u0627\\u0644 \\u0661\\u0662",
+        "plain latin text with no rtl at all",
+        "\\u05d0 a \\u05d1 b \\u05d2 c \\u05d3 d\\u2029\\u05d4 e \\u05d5 f"
+    };
+    enum { LINE_COUNT = 3 };
+    UMemoryScope scope = { NULL, bidiCountingAlloc, bidiCountingRealloc, bidiCountingFree,
+                           bidiCountingContains, NULL };
+    UChar src[MAXLEN], dest1[MAXLEN], dest2[MAXLEN];
+    int32_t map1[MAXLEN], map2[MAXLEN];
+    UBiDi *pHeapBiDi, *pHeapLine, *pBiDi = NULL, *lines[LINE_COUNT] = { NULL, NULL, NULL };
+    char *arena = NULL;
+    UErrorCode rc = U_ZERO_ERROR;
+    int32_t paraSize, lineSize, i, j, pass, srcLen, destLen1, destLen2, start, limit;
+
+    log_verbose("\nEntering TestOpenBuffer\n\n");
+
+    ubidi_getBufferSize(-1, 0, &rc);
+    if (rc != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ubidi_getBufferSize(-1) set %s instead of U_ILLEGAL_ARGUMENT_ERROR\n", u_errorName(rc));
+    }
+    rc = U_ZERO_ERROR;
+    paraSize = ubidi_getBufferSize(MAXLEN, MAXLEN, &rc);
+    lineSize = ubidi_getBufferSize(MAXLEN, 8, &rc);
+    if (!assertSuccessful("ubidi_getBufferSize", &rc)) {
+        return;
+    }
+    if (lineSize >= paraSize || ubidi_getBufferSize(0, 0, &rc) >= lineSize) {
+        log_err("ubidi_getBufferSize() does not grow with the sizings\n");
+    }
+
+    /* one arena, deliberately misaligned, for the paragraph and all lines */
+    arena = (char *)malloc(1 + paraSize + LINE_COUNT * lineSize);
+    if (arena == NULL) {
+        log_err("out of memory\n");
+        return;
+    }
+    if (ubidi_openBuffer(arena + 1, paraSize - 1, MAXLEN, MAXLEN, &rc) != NULL ||
+            rc != U_BUFFER_OVERFLOW_ERROR) {
+        log_err("ubidi_openBuffer() into a short buffer set %s instead of U_BUFFER_OVERFLOW_ERROR\n",
+                u_errorName(rc));
+    }
+    rc = U_ZERO_ERROR;
+    pBiDi = ubidi_openBuffer(arena + 1, paraSize, MAXLEN, MAXLEN, &rc);
+    for (j = 0; j < LINE_COUNT; j++) {
+        lines[j] = ubidi_openBuffer(arena + 1 + paraSize + j * lineSize, lineSize, MAXLEN, 8, &rc);
+    }
+    pHeapBiDi = ubidi_open();
+    pHeapLine = ubidi_open();
+    if (!assertSuccessful("ubidi_openBuffer", &rc) || pHeapBiDi == NULL || pHeapLine == NULL) {
+        goto cleanup;
+    }
+
+    /*
+     * pass 0 compares with heap objects, pass 1 counts heap allocations,
+     * which needs ICU built with memory scope support
+     */
+    for (pass = 0; pass < (U_ENABLE_MEMORY_SCOPES ? 2 : 1); pass++) {
+        if (pass == 1) {
+            gBidiScopeAllocCount = 0;
+            u_pushMemoryScope(&scope, &rc);
+        }
+        for (i = 0; i < UPRV_LENGTHOF(texts); i++) {
+            srcLen = u_unescape(texts[i], src, MAXLEN);
+            ubidi_setPara(pBiDi, src, srcLen, UBIDI_DEFAULT_LTR, NULL, &rc);
+            if (pass == 0) {
+                ubidi_setPara(pHeapBiDi, src, srcLen, UBIDI_DEFAULT_LTR, NULL, &rc);
+                ubidi_getVisualMap(pBiDi, map1, &rc);
+                ubidi_getVisualMap(pHeapBiDi, map2, &rc);
+                if (!assertSuccessful("ubidi_setPara/getVisualMap", &rc)) {
+                    goto cleanup;
+                }
+                if (uprv_memcmp(map1, map2, srcLen * sizeof(int32_t)) != 0) {
+                    log_err("Text %d: the visual map differs from that of a heap object\n", i);
+                }
+            }
+            /* split the first paragraph into up to LINE_COUNT lines */
+            ubidi_getParagraphByIndex(pBiDi, 0, NULL, &limit, NULL, &rc);
+            for (j = 0, start = 0; j < LINE_COUNT && start < limit; j++) {
+                int32_t lineLimit = j == LINE_COUNT - 1 ? limit : start + (limit + LINE_COUNT - 1) / LINE_COUNT;
+                if (lineLimit > limit) {
+                    lineLimit = limit;
+                }
+                ubidi_setLine(pBiDi, start, lineLimit, lines[j], &rc);
+                ubidi_getLevels(lines[j], &rc);
+                destLen1 = ubidi_writeReordered(lines[j], dest1, MAXLEN, UBIDI_DO_MIRRORING, &rc);
+                if (pass == 0) {
+                    ubidi_setLine(pHeapBiDi, start, lineLimit, pHeapLine, &rc);
+                    destLen2 = ubidi_writeReordered(pHeapLine, dest2, MAXLEN, UBIDI_DO_MIRRORING, &rc);
+                    if (!assertSuccessful("ubidi_setLine/writeReordered", &rc)) {
+                        goto cleanup;
+                    }
+                    if (destLen1 != destLen2 || uprv_memcmp(dest1, dest2, destLen1 * U_SIZEOF_UCHAR) != 0) {
+                        log_err("Text %d line %d: the reordered line differs from that of a heap object\n",
+                                i, j);
+                    }
+                }
+                start = lineLimit;
+            }
+        }
+        if (pass == 1) {
+            u_popMemoryScope(&scope, &rc);
+            if (!assertSuccessful("layout with pooled line objects", &rc)) {
+                goto cleanup;
+            }
+            if (gBidiScopeAllocCount != 0) {
+                log_err("Layout with buffer objects made %d heap allocations\n", gBidiScopeAllocCount);
+            }
+        }
+    }
+
+    /* a text longer than maxLength fails as with ubidi_openSized() */
+    for (i = 0; i < MAXLEN; i++) {
+        src[i] = (UChar)(i & 1 ? 0x5d0 : 0x61);
+    }
+    ubidi_setPara(lines[0], src, MAXLEN, UBIDI_DEFAULT_LTR, NULL, &rc);
+    if (!assertSuccessful("ubidi_setPara(maxLength)", &rc)) {
+        goto cleanup;
+    }
+    ubidi_close(lines[0]);
+    lines[0] = ubidi_openBuffer(arena + 1 + paraSize, lineSize, MAXLEN - 1, 8, &rc);
+    ubidi_setPara(lines[0], src, MAXLEN, UBIDI_DEFAULT_LTR, NULL, &rc);
+    if (rc != U_MEMORY_ALLOCATION_ERROR) {
+        log_err("ubidi_setPara() beyond maxLength set %s instead of U_MEMORY_ALLOCATION_ERROR\n",
+                u_errorName(rc));
+    }
+
+cleanup:
+    for (j = 0; j < LINE_COUNT; j++) {
+        ubidi_close(lines[j]);
+    }
+    ubidi_close(pBiDi);
+    ubidi_close(pHeapLine);
+    ubidi_close(pHeapBiDi);
+    free(arena);
+    log_verbose("\nExiting TestOpenBuffer\n\n");
+}
+
 static char * formatMap(const int32_t * map, int len, char * buffer)
 {
     int32_t i, k;
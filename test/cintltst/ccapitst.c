@@ -54,6 +54,8 @@ cnv_open(const char *name, UErrorCode *pErrorCode) {
 static void ListNames(void);
 static void TestFlushCache(void);
 static void TestDuplicateAlias(void);
+static void TestConverterPool(void);
+static void TestSaveRestoreState(void);
 static void TestCCSID(void);
 static void TestJ932(void);
 static void TestJ1968(void);
@@ -69,6 +71,7 @@ static void TestEBCDICSwapLFNL(void);
 static void TestConvertEx(void);
 static void TestConvertExFromUTF8(void);
 static void TestConvertExFromUTF8_C5F0(void);
+static void TestConvertExToUTF8(void);
 static void TestConvertAlgorithmic(void);
        void TestDefaultConverterError(void);    /* defined in cctest.c */
        void TestDefaultConverterSet(void);    /* defined in cctest.c */
@@ -94,6 +97,8 @@ void addTestConvert(TestNode** root)
 #if !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestConvertSafeCloneCallback,"tsconv/ccapitst/TestConvertSafeCloneCallback");
 #endif
+    addTest(root, &TestConverterPool,           "tsconv/ccapitst/TestConverterPool");
+    addTest(root, &TestSaveRestoreState,        "tsconv/ccapitst/TestSaveRestoreState");
     addTest(root, &TestCCSID,                   "tsconv/ccapitst/TestCCSID"); 
     addTest(root, &TestJ932,                    "tsconv/ccapitst/TestJ932");
     addTest(root, &TestJ1968,                   "tsconv/ccapitst/TestJ1968");
@@ -104,6 +109,7 @@ void addTestConvert(TestNode** root)
     addTest(root, &TestConvertEx,               "tsconv/ccapitst/TestConvertEx");
     addTest(root, &TestConvertExFromUTF8,       "tsconv/ccapitst/TestConvertExFromUTF8");
     addTest(root, &TestConvertExFromUTF8_C5F0,  "tsconv/ccapitst/TestConvertExFromUTF8_C5F0");
+    addTest(root, &TestConvertExToUTF8,         "tsconv/ccapitst/TestConvertExToUTF8");
     addTest(root, &TestConvertAlgorithmic,      "tsconv/ccapitst/TestConvertAlgorithmic");
     addTest(root, &TestDefaultConverterError,   "tsconv/ccapitst/TestDefaultConverterError");
     addTest(root, &TestDefaultConverterSet,     "tsconv/ccapitst/TestDefaultConverterSet");
@@ -1889,6 +1895,247 @@ static void TestConvertSafeClone()
     }
 }
 
+static void TestConverterPool() {
+    static const UChar text[] = { 0x61, 0xe4, 0x4e00, 0 };
+    static const char expected[] = "a\xe4\x1a";
+    char bytes[16];
+    UChar uchars[16];
+    UChar *target;
+    const char *source;
+    UConverterPool *pool;
+    UConverter *cnv1, *cnv2, *cnv3;
+    UErrorCode errorCode = U_ZERO_ERROR;
+
+    pool = ucnv_openPool("ISO-8859-1", 2, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("ucnv_openPool(ISO-8859-1) failed - %s\n", u_errorName(errorCode));
+        return;
+    }
+    cnv1 = ucnv_openPooled(pool, &errorCode);
+    cnv2 = ucnv_openPooled(pool, &errorCode);
+    if(U_FAILURE(errorCode) || cnv1 == NULL || cnv2 == NULL || cnv1 == cnv2) {
+        log_err("ucnv_openPooled() failed - %s\n", u_errorName(errorCode));
+        ucnv_close(cnv1);
+        ucnv_close(cnv2);
+        ucnv_closePool(pool);
+        return;
+    }
+    if(0 != strcmp(ucnv_getName(cnv1, &errorCode), "ISO-8859-1")) {
+        log_err("pooled converter has the wrong name %s\n", ucnv_getName(cnv1, &errorCode));
+    }
+    ucnv_fromUChars(cnv1, bytes, UPRV_LENGTHOF(bytes), text, -1, &errorCode);
+    if(U_FAILURE(errorCode) || 0 != strcmp(bytes, expected)) {
+        log_err("pooled converter converts wrongly - %s\n", u_errorName(errorCode));
+    }
+
+    /* a released converter is reused */
+    ucnv_release(pool, cnv1);
+    cnv3 = ucnv_openPooled(pool, &errorCode);
+    if(cnv3 != cnv1) {
+        log_err("ucnv_openPooled() did not reuse the released converter\n");
+    }
+
+    /* one with changed settings is closed instead; new ones have the defaults */
+    ucnv_setSubstChars(cnv3, "?", 1, &errorCode);
+    ucnv_release(pool, cnv3);
+    ucnv_release(pool, cnv2);
+    ucnv_release(pool, NULL);
+    cnv1 = ucnv_openPooled(pool, &errorCode);
+    cnv2 = ucnv_openPooled(pool, &errorCode);
+    ucnv_fromUChars(cnv2, bytes, UPRV_LENGTHOF(bytes), text, -1, &errorCode);
+    if(U_FAILURE(errorCode) || 0 != strcmp(bytes, expected)) {
+        log_err("new pooled converter does not have the default substitution - %s\n",
+                u_errorName(errorCode));
+    }
+    ucnv_release(pool, cnv1);
+    ucnv_release(pool, cnv2);
+    ucnv_closePool(pool);
+    ucnv_closePool(NULL);
+
+    /* a released converter is reset */
+    pool = ucnv_openPool("UTF-8", 1, &errorCode);
+    cnv1 = ucnv_openPooled(pool, &errorCode);
+    source = "a\xe4\xb8";
+    target = uchars;
+    ucnv_toUnicode(cnv1, &target, uchars + UPRV_LENGTHOF(uchars), &source, source + 3,
+                   NULL, FALSE, &errorCode);
+    if(U_FAILURE(errorCode) || ucnv_toUCountPending(cnv1, &errorCode) != 2) {
+        log_err("UTF-8 converter did not keep a partial character - %s\n", u_errorName(errorCode));
+    }
+    ucnv_release(pool, cnv1);
+    cnv1 = ucnv_openPooled(pool, &errorCode);
+    if(U_FAILURE(errorCode) || ucnv_toUCountPending(cnv1, &errorCode) != 0) {
+        log_err("released converter was not reset - %s\n", u_errorName(errorCode));
+    }
+    ucnv_release(pool, cnv1);
+    ucnv_closePool(pool);
+
+    /* illegal arguments */
+    errorCode = U_ZERO_ERROR;
+    pool = ucnv_openPool("UTF-8", -1, &errorCode);
+    if(pool != NULL || errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucnv_openPool(capacity=-1) did not fail - %s\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    if(ucnv_openPooled(NULL, &errorCode) != NULL || errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucnv_openPooled(NULL) did not fail - %s\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    pool = ucnv_openPool("no-such-converter", 1, &errorCode);
+    if(pool != NULL || U_SUCCESS(errorCode)) {
+        log_err("ucnv_openPool(no-such-converter) did not fail - %s\n", u_errorName(errorCode));
+    }
+}
+
+/*
+ * Converts two streams in small interleaved chunks with one converter,
+ * switching between them with ucnv_saveState()/ucnv_restoreState().
+ * The results must be the same as for converting each stream by itself.
+ */
+static void TestSaveRestoreState() {
+    static const char *const names[]={
+        "UTF-8", "UTF-7", "SCSU", "BOCU-1", "GB18030", "Shift-JIS",
+        "ibm-930", "ISO-2022-JP", "ISO-2022-KR", "ISO-2022-CN", "HZ", "ISCII,version=0"
+    };
+    static const UChar textA[]={
+        0x61, 0x62, 0x20, 0x4e00, 0x4e8c, 0x4e09, 0x20, 0x78, 0x3042, 0x3044, 0xe4, 0xf6,
+        0x915, 0x93f, 0xd83d, 0xde00, 0x65, 0x6e, 0x64, 0xd, 0xa, 0x7e, 0x31
+    };
+    static const UChar textB[]={
+        0x65e5, 0x672c, 0x20, 0x31, 0x32, 0x33, 0x928, 0x92e, 0x20, 0xac00, 0xd55c, 0x74, 0x7e, 0x7e
+    };
+    const UChar *texts[2]={ textA, textB };
+    int32_t textLengths[2]={ UPRV_LENGTHOF(textA), UPRV_LENGTHOF(textB) };
+    char state[2][UCNV_STATE_CAPACITY];
+    int32_t stateLengths[2];
+    char expectedBytes[2][200], bytes[2][200];
+    UChar expectedUChars[2][200], uchars[2][200];
+    int32_t expectedLengths[2], expectedUCharLengths[2];
+    int32_t n, i;
+
+    for(n=0; n<UPRV_LENGTHOF(names); ++n) {
+        const char *name=names[n];
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(name, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open converter %s - %s\n", name, u_errorName(errorCode));
+            continue;
+        }
+        for(i=0; i<2; ++i) {
+            ucnv_reset(cnv);
+            expectedLengths[i]=ucnv_fromUChars(cnv, expectedBytes[i], UPRV_LENGTHOF(expectedBytes[i]),
+                                               texts[i], textLengths[i], &errorCode);
+            expectedUCharLengths[i]=ucnv_toUChars(cnv, expectedUChars[i], UPRV_LENGTHOF(expectedUChars[i]),
+                                                  expectedBytes[i], expectedLengths[i], &errorCode);
+        }
+        if(U_FAILURE(errorCode)) {
+            log_err("%s: reference conversion failed - %s\n", name, u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+
+        /* fromUnicode, 3 UChars at a time */
+        {
+            const UChar *sources[2];
+            char *targets[2];
+            ucnv_reset(cnv);
+            for(i=0; i<2; ++i) {
+                sources[i]=texts[i];
+                targets[i]=bytes[i];
+                stateLengths[i]=ucnv_saveState(cnv, state[i], UCNV_STATE_CAPACITY, &errorCode);
+            }
+            while(U_SUCCESS(errorCode) &&
+                    (sources[0]<textA+textLengths[0] || sources[1]<textB+textLengths[1])) {
+                for(i=0; i<2; ++i) {
+                    const UChar *sourceLimit=texts[i]+textLengths[i];
+                    if(sources[i]==sourceLimit) {
+                        continue;
+                    }
+                    if(sourceLimit-sources[i]>3) {
+                        sourceLimit=sources[i]+3;
+                    }
+                    ucnv_restoreState(cnv, state[i], stateLengths[i], &errorCode);
+                    ucnv_fromUnicode(cnv, &targets[i], bytes[i]+UPRV_LENGTHOF(bytes[i]),
+                                     &sources[i], sourceLimit, NULL,
+                                     (UBool)(sourceLimit==texts[i]+textLengths[i]), &errorCode);
+                    stateLengths[i]=ucnv_saveState(cnv, state[i], UCNV_STATE_CAPACITY, &errorCode);
+                }
+            }
+            for(i=0; i<2; ++i) {
+                int32_t length=(int32_t)(targets[i]-bytes[i]);
+                if(U_FAILURE(errorCode) || length!=expectedLengths[i] ||
+                        0!=uprv_memcmp(bytes[i], expectedBytes[i], length)) {
+                    log_err("%s: interleaved fromUnicode stream %d differs - %s\n",
+                            name, (int)i, u_errorName(errorCode));
+                }
+            }
+        }
+
+        /* toUnicode, 2 bytes at a time */
+        {
+            const char *sources[2];
+            UChar *targets[2];
+            ucnv_reset(cnv);
+            for(i=0; i<2; ++i) {
+                sources[i]=expectedBytes[i];
+                targets[i]=uchars[i];
+                stateLengths[i]=ucnv_saveState(cnv, state[i], UCNV_STATE_CAPACITY, &errorCode);
+            }
+            while(U_SUCCESS(errorCode) &&
+                    (sources[0]<expectedBytes[0]+expectedLengths[0] ||
+                     sources[1]<expectedBytes[1]+expectedLengths[1])) {
+                for(i=0; i<2; ++i) {
+                    const char *sourceLimit=expectedBytes[i]+expectedLengths[i];
+                    if(sources[i]==sourceLimit) {
+                        continue;
+                    }
+                    if(sourceLimit-sources[i]>2) {
+                        sourceLimit=sources[i]+2;
+                    }
+                    ucnv_restoreState(cnv, state[i], stateLengths[i], &errorCode);
+                    ucnv_toUnicode(cnv, &targets[i], uchars[i]+UPRV_LENGTHOF(uchars[i]),
+                                   &sources[i], sourceLimit, NULL,
+                                   (UBool)(sourceLimit==expectedBytes[i]+expectedLengths[i]), &errorCode);
+                    stateLengths[i]=ucnv_saveState(cnv, state[i], UCNV_STATE_CAPACITY, &errorCode);
+                }
+            }
+            for(i=0; i<2; ++i) {
+                int32_t length=(int32_t)(targets[i]-uchars[i]);
+                if(U_FAILURE(errorCode) || length!=expectedUCharLengths[i] ||
+                        0!=u_memcmp(uchars[i], expectedUChars[i], length)) {
+                    log_err("%s: interleaved toUnicode stream %d differs - %s\n",
+                            name, (int)i, u_errorName(errorCode));
+                }
+            }
+        }
+        ucnv_close(cnv);
+    }
+
+    /* preflighting, and a state from a different kind of converter */
+    {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *utf8=ucnv_open("UTF-8", &errorCode);
+        UConverter *utf7=ucnv_open("UTF-7", &errorCode);
+        int32_t length;
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open UTF-8 and UTF-7 converters - %s\n", u_errorName(errorCode));
+        } else {
+            length=ucnv_saveState(utf8, NULL, 0, &errorCode);
+            if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length<=0 || length>UCNV_STATE_CAPACITY) {
+                log_err("ucnv_saveState(preflighting) returned %d - %s\n", (int)length, u_errorName(errorCode));
+            }
+            errorCode=U_ZERO_ERROR;
+            length=ucnv_saveState(utf8, state[0], UCNV_STATE_CAPACITY, &errorCode);
+            ucnv_restoreState(utf7, state[0], length, &errorCode);
+            if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+                log_err("ucnv_restoreState(UTF-7 from UTF-8 state) did not fail - %s\n", u_errorName(errorCode));
+            }
+        }
+        ucnv_close(utf8);
+        ucnv_close(utf7);
+    }
+}
+
 static void TestCCSID() {
 #if !UCONFIG_NO_LEGACY_CONVERSION
     UConverter *cnv;
@@ -2759,6 +3006,127 @@ static void TestConvertExFromUTF8_C5F0() {
     ucnv_close(utf8Cnv);
 }
 
+/*
+ * Conversion from some charsets to UTF-8 does not pivot through UTF-16
+ * for characters with simple mappings.
+ * Compare its output with that of the pivoting ucnv_toUChars() + u_strToUTF8(),
+ * with small target buffers and input in small pieces.
+ */
+static void TestConvertExToUTF8() {
+    static const char *const converterNames[]={
+#if !UCONFIG_NO_LEGACY_CONVERSION
+        "windows-1252",
+        "GBK",
+        "shift-jis",
+        "Big5",
+        "EUC-KR",
+        "ibm-37",
+#endif
+        "iso-8859-1"
+    };
+    /* a truncated or illegal sequence in many of the charsets */
+    static const char illegal[]={ (char)0x81, 0x20, (char)0xff, (char)0x81 };
+    static const int32_t capacities[]={ 1, 2, 3, 5, 200 };
+    static const int32_t chunkLengths[]={ 1, 2, 7, 1000 };
+
+    UConverter *utf8Cnv, *cnv;
+    UErrorCode errorCode;
+    int32_t i, j, k;
+
+    USet *set;
+    UChar text[80];
+    UChar us[300];
+    char bytes[500], expected[1000], result[1000];
+    int32_t textLength, bytesLength, length, usLength, expectedLength, setSize;
+
+    UChar pivotBuffer[40];
+    UChar *pivotSource, *pivotTarget;
+    const char *src, *srcChunkLimit;
+    char *target;
+
+    errorCode=U_ZERO_ERROR;
+    utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("unable to open UTF-8 converter - %s\n", u_errorName(errorCode));
+        return;
+    }
+
+    for(i=0; i<UPRV_LENGTHOF(converterNames); ++i) {
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_open(converterNames[i], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open %s converter - %s\n", converterNames[i], u_errorName(errorCode));
+            continue;
+        }
+
+        /* input: characters from across the roundtrip set, twice, and some bad bytes */
+        set=uset_open(1, 0);
+        ucnv_getUnicodeSet(cnv, set, UCNV_ROUNDTRIP_SET, &errorCode);
+        setSize=uset_size(set);
+        textLength=0;
+        for(j=0; j<30; ++j) {
+            U16_APPEND_UNSAFE(text, textLength, uset_charAt(set, (int32_t)(((int64_t)setSize*j)/30)));
+        }
+        uset_close(set);
+        bytesLength=ucnv_fromUChars(cnv, bytes, (int32_t)sizeof(bytes), text, textLength, &errorCode);
+        uprv_memcpy(bytes+bytesLength, illegal, sizeof(illegal));
+        length=bytesLength+(int32_t)sizeof(illegal);
+        ucnv_resetFromUnicode(cnv);
+        length+=ucnv_fromUChars(cnv, bytes+length, (int32_t)sizeof(bytes)-length, text, textLength, &errorCode);
+        bytesLength=length;
+
+        /* expected output, pivoting through UTF-16 */
+        usLength=ucnv_toUChars(cnv, us, UPRV_LENGTHOF(us), bytes, bytesLength, &errorCode);
+        u_strToUTF8(expected, (int32_t)sizeof(expected), &expectedLength, us, usLength, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("unable to set up the test input for %s - %s\n", converterNames[i], u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+
+        for(j=0; j<UPRV_LENGTHOF(capacities); ++j) {
+            for(k=0; k<UPRV_LENGTHOF(chunkLengths); ++k) {
+                ucnv_reset(cnv);
+                ucnv_reset(utf8Cnv);
+                pivotSource=pivotTarget=pivotBuffer;
+                src=bytes;
+                target=result;
+                errorCode=U_ZERO_ERROR;
+                do {
+                    /* convert chunkLengths[k] input bytes at a time */
+                    srcChunkLimit= (bytes+bytesLength-src)>chunkLengths[k] ? src+chunkLengths[k] : bytes+bytesLength;
+                    do {
+                        char *targetLimit=target+capacities[j];
+                        if(targetLimit>result+sizeof(result)) {
+                            targetLimit=result+sizeof(result);
+                        }
+                        errorCode=U_ZERO_ERROR;
+                        ucnv_convertEx(utf8Cnv, cnv,
+                                       &target, targetLimit,
+                                       &src, srcChunkLimit,
+                                       pivotBuffer, &pivotSource, &pivotTarget,
+                                       pivotBuffer+UPRV_LENGTHOF(pivotBuffer),
+                                       FALSE, srcChunkLimit==bytes+bytesLength,
+                                       &errorCode);
+                    } while(errorCode==U_BUFFER_OVERFLOW_ERROR && target<result+sizeof(result));
+                } while(U_SUCCESS(errorCode) && src<bytes+bytesLength);
+                if(errorCode==U_STRING_NOT_TERMINATED_WARNING) {
+                    errorCode=U_ZERO_ERROR;
+                }
+                if( U_FAILURE(errorCode) || (target-result)!=expectedLength ||
+                    0!=uprv_memcmp(result, expected, expectedLength)
+                ) {
+                    log_err("ucnv_convertEx(%s -> UTF-8) with target capacity %d, %d input bytes at a time: "
+                            "wrong result - %s\n",
+                            converterNames[i], (int)capacities[j], (int)chunkLengths[k], u_errorName(errorCode));
+                }
+            }
+        }
+        ucnv_close(cnv);
+    }
+    ucnv_close(utf8Cnv);
+}
+
 static void
 TestConvertAlgorithmic() {
 #if !UCONFIG_NO_LEGACY_CONVERSION
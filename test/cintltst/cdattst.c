@@ -42,6 +42,7 @@ static void TestContext(void);
 static void TestCalendarDateParse(void);
 static void TestParseErrorReturnValue(void);
 static void TestFormatForFields(void);
+static void TestFormatBatch(void);
 
 void addDateForTest(TestNode** root);
 
@@ -61,6 +62,7 @@ void addDateForTest(TestNode** root)
     TESTCASE(TestOverrideNumberFormat);
     TESTCASE(TestParseErrorReturnValue);
     TESTCASE(TestFormatForFields);
+    TESTCASE(TestFormatBatch);
 }
 /* Testing the DateFormat API */
 static void TestDateFormat()
@@ -1858,4 +1860,50 @@ static void TestFormatForFields(void) {
     }
 }
 
+static void TestFormatBatch(void) {
+    static const UChar pattern[] = { 0x48,0x48,0x3A,0x6D,0x6D,0x3A,0x73,0x73,0x3B,0 }; /* "HH:mm:ss;" */
+    static const UDate dates[] = { 1500000000000.0, 1500000001000.0, 1500000060000.0, 1500086400000.0 };
+    static const char* expected = "02:40:00;02:40:01;02:41:00;02:40:00;";
+    enum { kDateCount = UPRV_LENGTHOF(dates) };
+    UErrorCode status = U_ZERO_ERROR;
+    UDateFormat* udfmt = udat_open(UDAT_PATTERN, UDAT_PATTERN, "en", zoneGMT, -1, pattern, -1, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("udat_open fails with %s (Are you missing data?)\n", u_errorName(status));
+        return;
+    } else {
+        UChar ubuf[64];
+        char bbuf[64];
+        int32_t offsets[kDateCount];
+        int32_t ulen, i;
+
+        /* preflighting */
+        ulen = udat_formatBatch(udfmt, dates, kDateCount, NULL, 0, offsets, &status);
+        if (status != U_BUFFER_OVERFLOW_ERROR || ulen != 36) {
+            log_err("udat_formatBatch preflighting returns %d, status %s; expected 36, U_BUFFER_OVERFLOW_ERROR\n",
+                    ulen, u_errorName(status));
+        }
+        status = U_ZERO_ERROR;
+        ulen = udat_formatBatch(udfmt, dates, kDateCount, ubuf, UPRV_LENGTHOF(ubuf), offsets, &status);
+        if (U_FAILURE(status)) {
+            log_err("udat_formatBatch fails, status %s\n", u_errorName(status));
+        } else {
+            u_austrncpy(bbuf, ubuf, UPRV_LENGTHOF(bbuf));
+            if (ulen != 36 || strcmp(bbuf, expected) != 0) {
+                log_err("udat_formatBatch returns %d \"%s\", expected \"%s\"\n", ulen, bbuf, expected);
+            }
+            for (i = 0; i < kDateCount; ++i) {
+                if (offsets[i] != 9 * (i + 1)) {
+                    log_err("udat_formatBatch offsets[%d] = %d, expected %d\n", i, offsets[i], 9 * (i + 1));
+                }
+            }
+        }
+
+        ulen = udat_formatBatch(udfmt, NULL, 1, ubuf, UPRV_LENGTHOF(ubuf), NULL, &status);
+        if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("udat_formatBatch(dates=NULL) sets status %s, expected U_ILLEGAL_ARGUMENT_ERROR\n", u_errorName(status));
+        }
+        udat_close(udfmt);
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
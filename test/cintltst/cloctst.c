@@ -6104,6 +6104,14 @@ static const struct {
     {"sgn-br-u-co-phonebk", "bzs@collation=phonebook", FULL_LENGTH},
     {"ja-latn-hepburn-heploc", "ja_Latn__ALALC97", FULL_LENGTH},
     {"ja-latn-hepburn-heploc-u-ca-japanese", "ja_Latn__ALALC97@calendar=japanese", FULL_LENGTH},
+    /* simple language[-script][-region] tags without heap allocation */
+    {"und",                 "",                     FULL_LENGTH},
+    {"ZH-hANT-tw",          "zh_Hant_TW",           FULL_LENGTH},
+    {"es-latn-419",         "es_Latn_419",          FULL_LENGTH},
+    {"en-US-",              "en_US",                5},
+    {"en--US",              "en",                   2},
+    {"sgn-US",              "ase",                  FULL_LENGTH},
+    {"no-bok",              "nb",                   FULL_LENGTH},
 };
 
 static void TestForLanguageTag(void) {
@@ -187,6 +187,7 @@ static void TestCLDRStyleAliases(void);
 static void TestFallbackCodes(void);
 static void TestGetUTF8String(void);
 static void TestCLDRVersion(void);
+static void TestPreload(void);
 
 /***************************************************************************************/
 
@@ -223,6 +224,7 @@ void addNEWResourceBundleTest(TestNode** root)
     addTest(root, &TestGetFunctionalEquivalent,"tsutil/creststn/TestGetFunctionalEquivalent");
     addTest(root, &TestJB3763,                "tsutil/creststn/TestJB3763");
     addTest(root, &TestStackReuse,            "tsutil/creststn/TestStackReuse");
+    addTest(root, &TestPreload,               "tsutil/creststn/TestPreload");
 }
 
 
@@ -3093,3 +3095,44 @@ static void TestCLDRVersion(void) {
   }
 
 }
+
+static void TestPreload(void) {
+    static const char * const locales[] = { "de_CH", "ja", "sr_Latn_RS", "zz", NULL };
+    static const char * const noLocales[] = { NULL };
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t sequential, parallel;
+
+    ures_preload(NULL, 1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ures_preload(NULL) - %s, expected U_ILLEGAL_ARGUMENT_ERROR\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ures_preload(locales, 0, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ures_preload(threadCount=0) - %s, expected U_ILLEGAL_ARGUMENT_ERROR\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    if (ures_preload(noLocales, 4, &status) != 0 || U_FAILURE(status)) {
+        log_err("ures_preload(no locales) - %s\n", u_errorName(status));
+    }
+
+    sequential = ures_preload(locales, 1, &status);
+    if (U_FAILURE(status)) {
+        log_err("ures_preload(1 thread) - %s\n", u_errorName(status));
+        return;
+    }
+    if (sequential == 0) {
+        log_data_err("ures_preload() did not find any bundles - (Are you missing data?)\n");
+        return;
+    }
+    /* "zz" has no data and falls back to the root locale. */
+    if (sequential > 3 * 5) {
+        log_err("ures_preload() found %d bundles, expected at most 15\n", (int)sequential);
+    }
+    /* More threads than bundles is fine, and the result is the same. */
+    parallel = ures_preload(locales, 100, &status);
+    if (U_FAILURE(status) || parallel != sequential) {
+        log_err("ures_preload(100 threads) found %d bundles, expected %d - %s\n",
+                (int)parallel, (int)sequential, u_errorName(status));
+    }
+}
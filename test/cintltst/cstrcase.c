@@ -720,6 +720,64 @@ TestCaseCompare(void) {
  * test cases for actual case mappings using UCaseMap see
  * intltest utility/UnicodeStringTest/StringCaseTest/TestCasing
  */
+/*
+ * Long strings where most characters have simple case foldings,
+ * with complex ones (sharp s, ligatures, supplementary) in between,
+ * and differences before and after them.
+ */
+static void
+TestCaseCompareLong(void) {
+    static const struct {
+        const char *s1, *s2;
+        int32_t sign;  /* expected sign of the result */
+    } cases[] = {
+        { "getHttpRequestHeaderContentLength", "GETHTTPREQUESTHEADERCONTENTLENGTH", 0 },
+        { "getHttpRequestHeaderContentLength", "GETHTTPREQUESTHEADERCONTENTLENGTh", 0 },
+        { "getHttpRequestHeaderContentLength", "GETHTTPREQUESTHEADERCONTENTLENGTI", -1 },
+        { "getHttpRequestHeaderContentLength", "GETHTTPREQUESTHEADERCONTENTLENGT", 1 },
+        { "Stra\\u00dfe Gr\\u00f6\\u00dfe \\u00c4\\u00d6\\u00dc \\u041f\\u0440\\u0438\\u0432\\u0435\\u0442",
+          "STRASSE GR\\u00d6SSE \\u00e4\\u00f6\\u00fc \\u043f\\u0440\\u0438\\u0432\\u0435\\u0442", 0 },
+        { "Stra\\u00dfe Gr\\u00f6\\u00dfe \\u00c4\\u00d6\\u00dc \\u041f\\u0440\\u0438\\u0432\\u0435\\u0442",
+          "STRASSE GR\\u00d6SSE \\u00e4\\u00f6\\u00fc \\u043f\\u0440\\u0438\\u0432\\u0435\\u0444", -1 },
+        { "\\ufb03 effective \\U00010400 \\u039c\\u03ac\\u03b9\\u03bf\\u03c2 abcdefghijklmnopqrstuvwxyz",
+          "FFI EFFECTIVE \\U00010428 \\u03bc\\u0386\\u0399\\u039f\\u03a3 ABCDEFGHIJKLMNOPQRSTUVWXYZ", 0 },
+        { "\\ufb03 effective \\U00010400 \\u039c\\u03ac\\u03b9\\u03bf\\u03c2 abcdefghijklmnopqrstuvwxyz",
+          "FFI EFFECTIVE \\U00010428 \\u03bc\\u0386\\u0399\\u039f\\u03a3 ABCDEFGHIJKLMNOPQRSTUVWXYY", 1 },
+        { "abcdefghijklmnopqrstuvwxyz\\u0000ABC", "ABCDEFGHIJKLMNOPQRSTUVWXYZ\\u0000abd", -1 }
+    };
+    UChar s1[100], s2[100];
+    int32_t i, length1, length2, result, matchLength1, matchLength2;
+    UErrorCode errorCode=U_ZERO_ERROR;
+
+    for(i=0; i<UPRV_LENGTHOF(cases); ++i) {
+        length1=u_unescape(cases[i].s1, s1, UPRV_LENGTHOF(s1));
+        length2=u_unescape(cases[i].s2, s2, UPRV_LENGTHOF(s2));
+        result=u_strCaseCompare(s1, length1, s2, length2, U_FOLD_CASE_DEFAULT, &errorCode);
+        if(U_FAILURE(errorCode) || (result>0)-(result<0)!=cases[i].sign) {
+            log_err("error: u_strCaseCompare(cases[%d])=%ld - %s\n",
+                    (int)i, (long)result, u_errorName(errorCode));
+        }
+        if(length1==length2) {
+            result=u_memcasecmp(s1, s2, length1, U_FOLD_CASE_DEFAULT);
+            if((result>0)-(result<0)!=cases[i].sign) {
+                log_err("error: u_memcasecmp(cases[%d])=%ld\n", (int)i, (long)result);
+            }
+        }
+        /* the same code paths report the length of a case-insensitive prefix match */
+        u_caseInsensitivePrefixMatch(s1, length1, s2, length2, U_FOLD_CASE_DEFAULT,
+                                     &matchLength1, &matchLength2, &errorCode);
+        if(cases[i].sign==0 && (matchLength1!=length1 || matchLength2!=length2)) {
+            log_err("error: u_caseInsensitivePrefixMatch(cases[%d]) matches %ld, %ld of %ld, %ld\n",
+                    (int)i, (long)matchLength1, (long)matchLength2, (long)length1, (long)length2);
+        }
+    }
+    /* NUL-terminated: the strings are equal up to the NUL */
+    result=u_strcasecmp(s1, s2, U_FOLD_CASE_DEFAULT);
+    if(result!=0) {
+        log_err("error: u_strcasecmp(NUL-terminated)=%ld instead of 0\n", (long)result);
+    }
+}
+
 static void
 TestUCaseMap(void) {
     static const char
@@ -995,6 +1053,88 @@ TestUCaseMapToTitle(void) {
 #endif
 
 /* Test case for internal API u_caseInsensitivePrefixMatch */
+static void
+TestUCaseMapUTF8ToLowerInPlace(void) {
+    static const char *const texts[] = {
+        /* long ASCII runs, Latin-1, Greek with final sigma, Cyrillic, CJK */
+        "The Quick BROWN Fox Jumps Over The LAZY DOG 0123456789",
+        "\xC3\x84\x72\x67\x65\x72 \xC3\x96L \xC3\x9C\x62\x65\x72 \xC3\x80 LA CARTE",
+        "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3 \xCE\xA3\xCE\x91\xCE\xA3 \xD0\x9F\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2",
+        "\xE6\x97\xA5\xE6\x9C\xAC ABC \xF0\x9D\x90\x80 xyz",
+        /* ill-formed UTF-8 is left unchanged */
+        "A\x80\x42\xC3",
+        ""
+    };
+    char s[100], expected[100];
+    UCaseMap *csm;
+    int32_t i, length, expectedLength;
+    UErrorCode errorCode=U_ZERO_ERROR;
+
+    csm=ucasemap_open("", 0, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("ucasemap_open(\"\") failed - %s\n", u_errorName(errorCode));
+        return;
+    }
+    for(i=0; i<UPRV_LENGTHOF(texts); ++i) {
+        expectedLength=ucasemap_utf8ToLower(csm, expected, (int32_t)sizeof(expected), texts[i], -1, &errorCode);
+        strcpy(s, texts[i]);
+        length=ucasemap_utf8ToLowerInPlace(csm, s, -1, &errorCode);
+        if(U_FAILURE(errorCode) || length!=expectedLength || 0!=strcmp(expected, s)) {
+            log_err("ucasemap_utf8ToLowerInPlace(texts[%d]) failed - %s length %d\n",
+                    (int)i, u_errorName(errorCode), (int)length);
+        }
+        errorCode=U_ZERO_ERROR;
+    }
+
+    /* U+0130 lowercases to i + combining dot above: stop before it */
+    strcpy(s, "abcDEF\xC4\xB0xyz");
+    length=ucasemap_utf8ToLowerInPlace(csm, s, -1, &errorCode);
+    if(errorCode!=U_UNSUPPORTED_ERROR || length!=6 || 0!=strcmp("abcdef\xC4\xB0xyz", s)) {
+        log_err("ucasemap_utf8ToLowerInPlace(U+0130) failed - %s length %d\n",
+                u_errorName(errorCode), (int)length);
+    }
+    /* lowercasing the partially lowercased text yields the normal result */
+    errorCode=U_ZERO_ERROR;
+    expectedLength=ucasemap_utf8ToLower(csm, expected, (int32_t)sizeof(expected), "abcDEF\xC4\xB0xyz", -1, &errorCode);
+    length=ucasemap_utf8ToLower(csm, s + 50, 50, s, -1, &errorCode);
+    if(U_FAILURE(errorCode) || length!=expectedLength || 0!=strcmp(expected, s + 50)) {
+        log_err("ucasemap_utf8ToLower(partially lowercased) failed - %s\n", u_errorName(errorCode));
+    }
+
+    /* Turkish I is not lowercased in place, neither alone nor before U+0307 */
+    errorCode=U_ZERO_ERROR;
+    ucasemap_setLocale(csm, "tr", &errorCode);
+    strcpy(s, "ABC DEF");
+    length=ucasemap_utf8ToLowerInPlace(csm, s, -1, &errorCode);
+    if(U_FAILURE(errorCode) || length!=7 || 0!=strcmp("abc def", s)) {
+        log_err("ucasemap_utf8ToLowerInPlace(tr ABC DEF) failed - %s\n", u_errorName(errorCode));
+    }
+    strcpy(s, "XI\xCC\x87y");
+    length=ucasemap_utf8ToLowerInPlace(csm, s, -1, &errorCode);
+    if(errorCode!=U_UNSUPPORTED_ERROR || length!=1 || 0!=strcmp("xI\xCC\x87y", s)) {
+        log_err("ucasemap_utf8ToLowerInPlace(tr I+U+0307) failed - %s length %d\n",
+                u_errorName(errorCode), (int)length);
+    }
+
+    /* incoming failure code, explicit length, illegal arguments */
+    errorCode=U_PARSE_ERROR;
+    strcpy(s, "ABC");
+    length=ucasemap_utf8ToLowerInPlace(csm, s, -1, &errorCode);
+    if(errorCode!=U_PARSE_ERROR || length!=0 || 0!=strcmp("ABC", s)) {
+        log_err("ucasemap_utf8ToLowerInPlace(failure) failed\n");
+    }
+    errorCode=U_ZERO_ERROR;
+    length=ucasemap_utf8ToLowerInPlace(csm, s, 2, &errorCode);
+    if(U_FAILURE(errorCode) || length!=2 || 0!=strcmp("abC", s)) {
+        log_err("ucasemap_utf8ToLowerInPlace(length 2) failed - %s\n", u_errorName(errorCode));
+    }
+    length=ucasemap_utf8ToLowerInPlace(csm, NULL, 2, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucasemap_utf8ToLowerInPlace(NULL, 2) failed - %s\n", u_errorName(errorCode));
+    }
+    ucasemap_close(csm);
+}
+
 static void
 TestUCaseInsensitivePrefixMatch(void) {
     struct {
@@ -1049,7 +1189,9 @@ void addCaseTest(TestNode** root) {
 #endif
     addTest(root, &TestCaseFolding, "tsutil/cstrcase/TestCaseFolding");
     addTest(root, &TestCaseCompare, "tsutil/cstrcase/TestCaseCompare");
+    addTest(root, &TestCaseCompareLong, "tsutil/cstrcase/TestCaseCompareLong");
     addTest(root, &TestUCaseMap, "tsutil/cstrcase/TestUCaseMap");
+    addTest(root, &TestUCaseMapUTF8ToLowerInPlace, "tsutil/cstrcase/TestUCaseMapUTF8ToLowerInPlace");
 #if !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_FILE_IO
     addTest(root, &TestUCaseMapToTitle, "tsutil/cstrcase/TestUCaseMapToTitle");
 #endif
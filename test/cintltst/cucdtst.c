@@ -63,6 +63,8 @@ static void TestConsistency(void);
 static void TestCaseFolding(void);
 static void TestBinaryCharacterPropertiesAPI(void);
 static void TestIntCharacterPropertiesAPI(void);
+static void TestIntPropertyValues(void);
+static void TestScriptRuns(void);
 
 /* internal methods used */
 static int32_t MakeProp(char* str);
@@ -194,6 +196,7 @@ void addUnicodeTest(TestNode** root)
     addTest(root, &TestGetScriptExtensions, "tsutil/cucdtst/TestGetScriptExtensions");
     addTest(root, &TestScriptMetadataAPI, "tsutil/cucdtst/TestScriptMetadataAPI");
     addTest(root, &TestUScriptRunAPI, "tsutil/cucdtst/TestUScriptRunAPI");
+    addTest(root, &TestScriptRuns, "tsutil/cucdtst/TestScriptRuns");
     addTest(root, &TestPropertyNames, "tsutil/cucdtst/TestPropertyNames");
     addTest(root, &TestPropertyValues, "tsutil/cucdtst/TestPropertyValues");
     addTest(root, &TestConsistency, "tsutil/cucdtst/TestConsistency");
@@ -202,6 +205,7 @@ void addUnicodeTest(TestNode** root)
             "tsutil/cucdtst/TestBinaryCharacterPropertiesAPI");
     addTest(root, &TestIntCharacterPropertiesAPI,
             "tsutil/cucdtst/TestIntCharacterPropertiesAPI");
+    addTest(root, &TestIntPropertyValues, "tsutil/cucdtst/TestIntPropertyValues");
 }
 
 /*==================================================== */
@@ -1879,6 +1883,27 @@ TestCharNames() {
         log_err("u_charFromName(U_UNICODE_CHAR_NAME, \"LATin smALl letTER A\") did not find U+0061 (%s)\n", u_errorName(errorCode));
     }
 
+    /* test that the hashed name index finds every name that u_charName() returns */
+    log_verbose("Testing u_charFromName(u_charName(c))\n");
+    for(c=0; c<=0x3400; ++c) {
+        errorCode=U_ZERO_ERROR;
+        length=u_charName(c, U_UNICODE_CHAR_NAME, name, sizeof(name), &errorCode);
+        if(U_FAILURE(errorCode) || length==0) {
+            continue;
+        }
+        if(c!=u_charFromName(U_UNICODE_CHAR_NAME, name, &errorCode) || U_FAILURE(errorCode)) {
+            log_err("u_charFromName(u_charName(U+%04lx)=%s) does not round-trip (%s)\n",
+                    c, name, u_errorName(errorCode));
+            break;
+        }
+    }
+    errorCode=U_ZERO_ERROR;
+    if(0xffff!=u_charFromName(U_UNICODE_CHAR_NAME, "LATIN SMALL LETTER NO SUCH", &errorCode) ||
+            errorCode!=U_ILLEGAL_CHAR_FOUND) {
+        log_err("u_charFromName(\"LATIN SMALL LETTER NO SUCH\") did not fail (%s)\n", u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+
     /* Test getCharNameCharacters */
     if(!getTestOption(QUICK_OPTION)) {
         enum { BUFSIZE = 256 };
@@ -3566,3 +3591,212 @@ static void TestIntCharacterPropertiesAPI() {
         log_err("u_getIntPropertyMap(UCHAR_GENERAL_CATEGORY) wrong contents\n");
     }
 }
+
+static void TestIntPropertyValues() {
+    static const UProperty which[] = {
+        UCHAR_GENERAL_CATEGORY, UCHAR_SCRIPT, UCHAR_ALPHABETIC,
+        UCHAR_GENERAL_CATEGORY_MASK, UCHAR_NFC_QUICK_CHECK, UCHAR_LINE_BREAK
+    };
+    enum { WHICH_COUNT = UPRV_LENGTHOF(which) };
+    // a, U+0301, Cyrillic, CJK, U+1F600 emoji, unpaired lead surrogate, digit, Greek
+    static const UChar s[] = {
+        0x61, 0x301, 0x416, 0x4e00, 0xd83d, 0xde00, 0xd800, 0x35, 0x3a3, 0
+    };
+    static const UChar32 cps[] = { 0x61, 0x301, 0x416, 0x4e00, 0x1f600, 0xd800, 0x35, 0x3a3 };
+    // The same without the unpaired surrogate, plus an ill-formed byte which counts as U+FFFD.
+    static const char s8[] =
+        "a\xcc\x81\xd0\x96\xe4\xb8\x80\xf0\x9f\x98\x80\xff" "5\xce\xa3";
+    static const UChar32 cps8[] = { 0x61, 0x301, 0x416, 0x4e00, 0x1f600, 0xfffd, 0x35, 0x3a3 };
+    int32_t values[UPRV_LENGTHOF(cps) * WHICH_COUNT];
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t i, j, count;
+
+    count = u_getIntPropertyValues(s, -1, which, WHICH_COUNT,
+                                   values, UPRV_LENGTHOF(values), &errorCode);
+    if (U_FAILURE(errorCode) || count != UPRV_LENGTHOF(cps)) {
+        log_err("u_getIntPropertyValues(NUL-terminated) failed: %s count=%d\n",
+                u_errorName(errorCode), (int)count);
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        for (j = 0; j < WHICH_COUNT; ++j) {
+            int32_t expected = u_getIntPropertyValue(cps[i], which[j]);
+            if (values[i * WHICH_COUNT + j] != expected) {
+                log_err("u_getIntPropertyValues()[%d][%d] for U+%04lx = %ld instead of %ld\n",
+                        (int)i, (int)j, (long)cps[i],
+                        (long)values[i * WHICH_COUNT + j], (long)expected);
+            }
+        }
+    }
+
+    errorCode = U_ZERO_ERROR;
+    count = u_getIntPropertyValuesUTF8(s8, -1, which, WHICH_COUNT,
+                                       values, UPRV_LENGTHOF(values), &errorCode);
+    if (U_FAILURE(errorCode) || count != UPRV_LENGTHOF(cps8)) {
+        log_err("u_getIntPropertyValuesUTF8() failed: %s count=%d\n",
+                u_errorName(errorCode), (int)count);
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        for (j = 0; j < WHICH_COUNT; ++j) {
+            int32_t expected = u_getIntPropertyValue(cps8[i], which[j]);
+            if (values[i * WHICH_COUNT + j] != expected) {
+                log_err("u_getIntPropertyValuesUTF8()[%d][%d] for U+%04lx = %ld instead of %ld\n",
+                        (int)i, (int)j, (long)cps8[i],
+                        (long)values[i * WHICH_COUNT + j], (long)expected);
+            }
+        }
+    }
+
+    // preflighting
+    errorCode = U_ZERO_ERROR;
+    count = u_getIntPropertyValues(s, 3, which, WHICH_COUNT, values, 2 * WHICH_COUNT, &errorCode);
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR || count != 3) {
+        log_err("u_getIntPropertyValues(overflow) = %d %s instead of U_BUFFER_OVERFLOW_ERROR\n",
+                (int)count, u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    count = u_getIntPropertyValues(s, UPRV_LENGTHOF(s) - 1, which, 1, NULL, 0, &errorCode);
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR || count != UPRV_LENGTHOF(cps)) {
+        log_err("u_getIntPropertyValues(preflighting) = %d %s\n",
+                (int)count, u_errorName(errorCode));
+    }
+
+    // illegal arguments
+    errorCode = U_ZERO_ERROR;
+    {
+        static const UProperty bad[] = { UCHAR_SCRIPT, UCHAR_NUMERIC_VALUE };
+        u_getIntPropertyValues(s, -1, bad, 2, values, UPRV_LENGTHOF(values), &errorCode);
+        if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("u_getIntPropertyValues(UCHAR_NUMERIC_VALUE) did not fail\n");
+        }
+    }
+    errorCode = U_ZERO_ERROR;
+    u_getIntPropertyValues(s, -1, which, 0, values, UPRV_LENGTHOF(values), &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_getIntPropertyValues(whichCount=0) did not fail\n");
+    }
+}
+
+static void checkScriptRuns(const char *name, const UScriptRunInfo *runs, int32_t count,
+                            const UScriptRunInfo *expected, int32_t expectedCount) {
+    int32_t i;
+    if (count != expectedCount) {
+        log_err("%s: %d runs instead of %d\n", name, (int)count, (int)expectedCount);
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        if (runs[i].start != expected[i].start || runs[i].limit != expected[i].limit ||
+                runs[i].script != expected[i].script) {
+            log_err("%s: run %d = [%d..%d[ %s instead of [%d..%d[ %s\n",
+                    name, (int)i, (int)runs[i].start, (int)runs[i].limit,
+                    uscript_getShortName(runs[i].script),
+                    (int)expected[i].start, (int)expected[i].limit,
+                    uscript_getShortName(expected[i].script));
+        }
+    }
+}
+
+static void TestScriptRuns() {
+    // "Hi " Zhe zhe space, hi + prolonged sound mark, ka + digit 1, Arabic-Indic zero + alef
+    static const UChar s[] = {
+        0x48, 0x69, 0x20, 0x416, 0x436, 0x20, 0x3072, 0x30fc, 0x30ab, 0x31, 0x660, 0x627, 0
+    };
+    static const UScriptRunInfo expected[] = {
+        { 0, 3, USCRIPT_LATIN },
+        { 3, 6, USCRIPT_CYRILLIC },
+        { 6, 8, USCRIPT_HIRAGANA },
+        { 8, 10, USCRIPT_KATAKANA },
+        { 10, 12, USCRIPT_ARABIC }
+    };
+    static const char s8[] =
+        "Hi \xd0\x96\xd0\xb6 \xe3\x81\xb2\xe3\x83\xbc\xe3\x82\xab" "1\xd9\xa0\xd8\xa7";
+    static const UScriptRunInfo expected8[] = {
+        { 0, 3, USCRIPT_LATIN },
+        { 3, 8, USCRIPT_CYRILLIC },
+        { 8, 14, USCRIPT_HIRAGANA },
+        { 14, 18, USCRIPT_KATAKANA },
+        { 18, 22, USCRIPT_ARABIC }
+    };
+    // A run that starts with a Script_Extensions character takes the script
+    // of the first character that narrows it down.
+    static const UChar kana[] = { 0x30fc, 0x30ab, 0x30fc };
+    static const UScriptRunInfo expectedKana[] = { { 0, 3, USCRIPT_KATAKANA } };
+    static const UChar common[] = { 0x31, 0x2c, 0x20, 0x301, 0x32 };
+    static const UScriptRunInfo expectedCommon[] = { { 0, 5, USCRIPT_COMMON } };
+    // Unpaired surrogates and ill-formed UTF-8 are Unknown.
+    static const UChar surrogate[] = { 0x61, 0xd800, 0x62 };
+    static const char illFormed[] = "a\xff" "b";
+    static const UScriptRunInfo expectedUnknown[] = {
+        { 0, 1, USCRIPT_LATIN }, { 1, 2, USCRIPT_UNKNOWN }, { 2, 3, USCRIPT_LATIN }
+    };
+    UScriptRunInfo runs[8];
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t count;
+    UChar32 c;
+
+    count = uscript_getScriptRuns(s, -1, runs, UPRV_LENGTHOF(runs), &errorCode);
+    if (U_FAILURE(errorCode)) {
+        log_err("uscript_getScriptRuns() failed: %s\n", u_errorName(errorCode));
+        return;
+    }
+    checkScriptRuns("UTF-16", runs, count, expected, UPRV_LENGTHOF(expected));
+    count = uscript_getScriptRunsUTF8(s8, -1, runs, UPRV_LENGTHOF(runs), &errorCode);
+    checkScriptRuns("UTF-8", runs, count, expected8, UPRV_LENGTHOF(expected8));
+    count = uscript_getScriptRuns(kana, UPRV_LENGTHOF(kana), runs, UPRV_LENGTHOF(runs), &errorCode);
+    checkScriptRuns("kana", runs, count, expectedKana, UPRV_LENGTHOF(expectedKana));
+    count = uscript_getScriptRuns(common, UPRV_LENGTHOF(common),
+                                  runs, UPRV_LENGTHOF(runs), &errorCode);
+    checkScriptRuns("common", runs, count, expectedCommon, UPRV_LENGTHOF(expectedCommon));
+    count = uscript_getScriptRuns(surrogate, UPRV_LENGTHOF(surrogate),
+                                  runs, UPRV_LENGTHOF(runs), &errorCode);
+    checkScriptRuns("surrogate", runs, count, expectedUnknown, UPRV_LENGTHOF(expectedUnknown));
+    count = uscript_getScriptRunsUTF8(illFormed, -1, runs, UPRV_LENGTHOF(runs), &errorCode);
+    checkScriptRuns("ill-formed", runs, count, expectedUnknown, UPRV_LENGTHOF(expectedUnknown));
+    if (U_FAILURE(errorCode)) {
+        log_err("uscript_getScriptRuns() failed: %s\n", u_errorName(errorCode));
+    }
+    count = uscript_getScriptRuns(s, 0, runs, UPRV_LENGTHOF(runs), &errorCode);
+    if (U_FAILURE(errorCode) || count != 0) {
+        log_err("uscript_getScriptRuns(empty) = %d %s\n", (int)count, u_errorName(errorCode));
+    }
+
+    // The ASCII fast path must agree with the property data.
+    for (c = 0; c < 0x80; ++c) {
+        UScriptCode scx[2];
+        UChar u = (UChar)c;
+        errorCode = U_ZERO_ERROR;
+        if (uscript_getScriptExtensions(c, scx, UPRV_LENGTHOF(scx), &errorCode) != 1 ||
+                uscript_getScriptRuns(&u, 1, runs, 1, &errorCode) != 1 ||
+                runs[0].script != uscript_getScript(c, &errorCode)) {
+            log_err("uscript_getScriptRuns(U+%04lx) disagrees with the script data\n", (long)c);
+        }
+    }
+
+    // preflighting
+    errorCode = U_ZERO_ERROR;
+    count = uscript_getScriptRuns(s, -1, runs, 2, &errorCode);
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR || count != UPRV_LENGTHOF(expected)) {
+        log_err("uscript_getScriptRuns(overflow) = %d %s instead of U_BUFFER_OVERFLOW_ERROR\n",
+                (int)count, u_errorName(errorCode));
+    }
+    checkScriptRuns("overflow", runs, 2, expected, 2);
+    errorCode = U_ZERO_ERROR;
+    count = uscript_getScriptRunsUTF8(s8, -1, NULL, 0, &errorCode);
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR || count != UPRV_LENGTHOF(expected8)) {
+        log_err("uscript_getScriptRunsUTF8(preflighting) = %d %s\n",
+                (int)count, u_errorName(errorCode));
+    }
+
+    // illegal arguments
+    errorCode = U_ZERO_ERROR;
+    uscript_getScriptRuns(NULL, 1, runs, UPRV_LENGTHOF(runs), &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("uscript_getScriptRuns(NULL) did not fail\n");
+    }
+    errorCode = U_ZERO_ERROR;
+    uscript_getScriptRuns(s, -1, NULL, 1, &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("uscript_getScriptRuns(runs=NULL, capacity=1) did not fail\n");
+    }
+}
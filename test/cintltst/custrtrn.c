@@ -38,6 +38,7 @@ static void Test_strFromUTF32_surrogates(void);
 static void Test_UChar_UTF8_API(void);
 static void Test_FromUTF8(void);
 static void Test_FromUTF8Lenient(void);
+static void Test_UTF8LongRuns(void);
 static void Test_UChar_WCHART_API(void);
 static void Test_widestrs(void);
 static void Test_WCHART_LongString(void);
@@ -55,6 +56,7 @@ addUCharTransformTest(TestNode** root)
    addTest(root, &Test_UChar_UTF8_API, "custrtrn/Test_UChar_UTF8_API");
    addTest(root, &Test_FromUTF8, "custrtrn/Test_FromUTF8");
    addTest(root, &Test_FromUTF8Lenient, "custrtrn/Test_FromUTF8Lenient");
+   addTest(root, &Test_UTF8LongRuns, "custrtrn/Test_UTF8LongRuns");
    addTest(root, &Test_UChar_WCHART_API,  "custrtrn/Test_UChar_WCHART_API");
    addTest(root, &Test_widestrs,  "custrtrn/Test_widestrs");
 #if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
@@ -928,6 +930,101 @@ Test_FromUTF8(void) {
     }
 }
 
+/*
+ * Long ASCII runs are transformed in bulk.
+ * Check the transitions between such runs and other text,
+ * including ill-formed sequences, and the destination capacity checks.
+ */
+static void
+Test_UTF8LongRuns(void) {
+    static const UChar32 others[]={ 0xe4, 0x4e00, 0x1f600, 0xdc00, 0x7ff, 0xd800 };
+    UChar src16[1200], dest16[1200];
+    char src8[2400], dest8[2400];
+    int32_t length16=0, length8=0, expected8, expected16, expectedSubs=0, i, j, capacity, destLength, numSubs;
+    UErrorCode errorCode;
+
+    /* build ASCII runs of increasing length separated by other code points */
+    for(i=0; i<UPRV_LENGTHOF(others)*4; ++i) {
+        UChar32 c=others[i%UPRV_LENGTHOF(others)];
+        UBool isError=FALSE;
+        for(j=0; j<i*3+1; ++j) {
+            src16[length16++]=src8[length8++]=(char)(0x20+(i+j)%0x5f);
+        }
+        if(U_IS_SURROGATE(c)) {
+            src16[length16++]=(UChar)c;
+            U8_APPEND_UNSAFE(src8, length8, 0xfffd);
+            ++expectedSubs;
+        } else {
+            U16_APPEND_UNSAFE(src16, length16, c);
+            U8_APPEND(src8, length8, UPRV_LENGTHOF(src8), c, isError);
+            if(isError) {
+                log_err("Test_UTF8LongRuns: U8_APPEND(U+%04lx) failed\n", (long)c);
+                return;
+            }
+        }
+    }
+    /* ill-formed UTF-8: a truncated sequence, then a stray trail byte, both between ASCII runs */
+    expected8=length8;
+    expected16=length16;
+    src8[length8++]=(char)0xe4;
+    src8[length8++]=(char)0xb8;
+    for(j=0; j<40; ++j) {
+        src8[length8++]=(char)(0x41+j%26);
+    }
+    src8[length8++]=(char)0x80;
+
+    /* UTF-16 -> UTF-8 with all destination capacities near the end of the output */
+    for(capacity=expected8-20; capacity<=expected8+1; ++capacity) {
+        uprv_memset(dest8, 0x55, sizeof(dest8));
+        errorCode=U_ZERO_ERROR;
+        u_strToUTF8WithSub(dest8, capacity, &destLength, src16, length16, 0xfffd, &numSubs, &errorCode);
+        if(destLength!=expected8 || numSubs!=expectedSubs ||
+                (capacity>=destLength ? U_FAILURE(errorCode) : errorCode!=U_BUFFER_OVERFLOW_ERROR) ||
+                dest8[capacity]!=0x55 ||
+                (U_SUCCESS(errorCode) && 0!=memcmp(dest8, src8, destLength))) {
+            log_err("error: u_strToUTF8WithSub(long runs, capacity %ld) fails: destLength=%ld numSubs=%ld - %s\n",
+                    (long)capacity, (long)destLength, (long)numSubs, u_errorName(errorCode));
+        }
+    }
+
+    /* UTF-8 -> UTF-16; the unpaired surrogates were written as U+FFFD */
+    for(i=0; i<length16; ++i) {
+        if(U_IS_SURROGATE(src16[i]) &&
+                !(U16_IS_SURROGATE_LEAD(src16[i]) && (i+1)<length16 && U16_IS_TRAIL(src16[i+1])) &&
+                !(U16_IS_SURROGATE_TRAIL(src16[i]) && i>0 && U16_IS_LEAD(src16[i-1]))) {
+            src16[i]=0xfffd;
+        }
+    }
+    /* the ill-formed UTF-8 sequences yield two more U+FFFD */
+    src16[expected16++]=0xfffd;
+    for(j=0; j<40; ++j) {
+        src16[expected16++]=(UChar)(0x41+j%26);
+    }
+    src16[expected16++]=0xfffd;
+    for(capacity=expected16-20; capacity<=expected16+1; ++capacity) {
+        for(i=0; i<UPRV_LENGTHOF(dest16); ++i) {
+            dest16[i]=0x5555;
+        }
+        errorCode=U_ZERO_ERROR;
+        u_strFromUTF8WithSub(dest16, capacity, &destLength, src8, length8, 0xfffd, &numSubs, &errorCode);
+        if(destLength!=expected16 || numSubs!=2 ||
+                (capacity>=destLength ? U_FAILURE(errorCode) : errorCode!=U_BUFFER_OVERFLOW_ERROR) ||
+                dest16[capacity]!=0x5555 ||
+                (U_SUCCESS(errorCode) && 0!=memcmp(dest16, src16, destLength*U_SIZEOF_UCHAR))) {
+            log_err("error: u_strFromUTF8WithSub(long runs, capacity %ld) fails: destLength=%ld numSubs=%ld - %s\n",
+                    (long)capacity, (long)destLength, (long)numSubs, u_errorName(errorCode));
+        }
+    }
+
+    /* preflighting */
+    errorCode=U_ZERO_ERROR;
+    u_strFromUTF8WithSub(NULL, 0, &destLength, src8, length8, 0xfffd, &numSubs, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || destLength!=expected16 || numSubs!=2) {
+        log_err("error: u_strFromUTF8WithSub(long runs, preflight) fails: destLength=%ld numSubs=%ld - %s\n",
+                (long)destLength, (long)numSubs, u_errorName(errorCode));
+    }
+}
+
 /* test u_strFromUTF8Lenient() */
 static void
 Test_FromUTF8Lenient(void) {
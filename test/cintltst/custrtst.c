@@ -37,6 +37,7 @@ static void TestStringSearching(void);
 static void TestSurrogateSearching(void);
 static void TestUnescape(void);
 static void TestCountChar32(void);
+static void TestLongStrings(void);
 static void TestUCharIterator(void);
 
 void addUStringTest(TestNode** root);
@@ -49,6 +50,7 @@ void addUStringTest(TestNode** root)
     addTest(root, &TestSurrogateSearching, "tsutil/custrtst/TestSurrogateSearching");
     addTest(root, &TestUnescape, "tsutil/custrtst/TestUnescape");
     addTest(root, &TestCountChar32, "tsutil/custrtst/TestCountChar32");
+    addTest(root, &TestLongStrings, "tsutil/custrtst/TestLongStrings");
     addTest(root, &TestUCharIterator, "tsutil/custrtst/TestUCharIterator");
 }
 
@@ -1178,6 +1180,107 @@ TestCountChar32() {
     }
 }
 
+/*
+ * Strings long enough for the vectorized code paths, with surrogates
+ * at various positions relative to the vector blocks.
+ */
+static int32_t
+_refCountChar32(const UChar *s, int32_t length) {
+    int32_t i, count=0;
+    for(i=0; i<length; ++i) {
+        ++count;
+        if(U16_IS_LEAD(s[i]) && (i+1)<length && U16_IS_TRAIL(s[i+1])) {
+            ++i;
+        }
+    }
+    return count;
+}
+
+static const UChar *
+_refFind(const UChar *s, int32_t length, const UChar *sub, int32_t subLength) {
+    int32_t i;
+    for(i=0; (i+subLength)<=length; ++i) {
+        if( u_memcmp(s+i, sub, subLength)==0 &&
+            !(i>0 && U16_IS_TRAIL(s[i]) && U16_IS_LEAD(s[i-1])) &&
+            !((i+subLength)<length && U16_IS_LEAD(s[i+subLength-1]) && U16_IS_TRAIL(s[i+subLength]))
+        ) {
+            return s+i;
+        }
+    }
+    return NULL;
+}
+
+static void
+TestLongStrings() {
+    /* lead and trail surrogates, paired and unpaired, and a supplementary code point to find */
+    static const UChar units[]={ 0x61, 0x62, 0xd800, 0xdc00, 0xd83d, 0xde00, 0xdc01, 0xd801, 0x2e };
+    static const UChar32 codePoints[]={ 0x62, 0x2e, 0xd800, 0xdc00, 0x10000, 0x1f600 };
+    UChar buffer[120], sub[4];
+    int32_t i, j, k, length, number, subLength, count;
+    uint32_t seed=1;
+
+    for(k=0; k<200; ++k) {
+        /* a pseudo-random string, starting at various alignments */
+        int32_t start=k%16;
+        UChar *s=buffer+start;
+        length=(k*7)%100;
+        for(i=0; i<length; ++i) {
+            seed=seed*1103515245+12345;
+            /* mostly 'a' so that the searched units are sparse */
+            s[i]=(seed>>16)%4==0 ? units[(seed>>20)%UPRV_LENGTHOF(units)] : 0x61;
+        }
+        s[length]=0;
+
+        if(u_strlen(s)!=length) {
+            log_err("u_strlen(s+%d) of length %d is wrong\n", (int)start, (int)length);
+        }
+        count=_refCountChar32(s, length);
+        if(u_countChar32(s, length)!=count || u_countChar32(s, -1)!=count) {
+            log_err("u_countChar32(s+%d, %d)=%d is wrong\n",
+                    (int)start, (int)length, (int)u_countChar32(s, length));
+        }
+        for(number=count-2; number<=count+1; ++number) {
+            if( u_strHasMoreChar32Than(s, length, number)!=(count>number) ||
+                u_strHasMoreChar32Than(s, -1, number)!=(count>number)
+            ) {
+                log_err("u_strHasMoreChar32Than(s+%d, %d, %d) is wrong\n",
+                        (int)start, (int)length, (int)number);
+            }
+        }
+
+        for(j=0; j<UPRV_LENGTHOF(codePoints); ++j) {
+            UChar32 c=codePoints[j];
+            const UChar *expected;
+            subLength=0;
+            U16_APPEND_UNSAFE(sub, subLength, c);
+            expected=_refFind(s, length, sub, subLength);
+            if( u_strchr32(s, c)!=expected || u_memchr32(s, c, length)!=expected ||
+                (c<=0xffff && (u_strchr(s, (UChar)c)!=expected || u_memchr(s, (UChar)c, length)!=expected))
+            ) {
+                log_err("finding U+%04lx in s+%d of length %d is wrong\n",
+                        (long)c, (int)start, (int)length);
+            }
+        }
+
+        /* substrings from s itself, so that most are found */
+        for(i=0; i<length; i+=5) {
+            const UChar *expected;
+            subLength=length-i<3 ? length-i : 3;
+            u_memcpy(sub, s+i, subLength);
+            sub[subLength]=0;
+            expected=_refFind(s, length, sub, subLength);
+            if( u_strFindFirst(s, length, sub, subLength)!=expected ||
+                u_strFindFirst(s, -1, sub, subLength)!=expected ||
+                u_strFindFirst(s, length, sub, -1)!=expected ||
+                u_strstr(s, sub)!=expected
+            ) {
+                log_err("u_strFindFirst(s+%d, %d, s+%d, %d) is wrong\n",
+                        (int)start, (int)length, (int)(start+i), (int)subLength);
+            }
+        }
+    }
+}
+
 /* UCharIterator ------------------------------------------------------------ */
 
 /*
@@ -15,7 +15,10 @@
 #include "unicode/uclean.h"
 #include "unicode/uchar.h"
 #include "unicode/ures.h"
+#include "unicode/ucnv.h"
+#include "unicode/uinitsvc.h"
 #include "cintltst.h"
+#include "cmemory.h"
 #include "unicode/utrace.h"
 #include <stdlib.h>
 #include <string.h>
@@ -30,6 +33,9 @@ typedef union {
 } ctest_AlignedMemory;
 
 static void TestHeapFunctions(void);
+static void TestMemoryScope(void);
+static void TestMemoryUsage(void);
+static void TestInitServices(void);
 
 void addHeapMutexTest(TestNode **root);
 
@@ -38,6 +44,9 @@ void
 addHeapMutexTest(TestNode** root)
 {
     addTest(root, &TestHeapFunctions,       "hpmufn/TestHeapFunctions"  );
+    addTest(root, &TestMemoryScope,         "hpmufn/TestMemoryScope"  );
+    addTest(root, &TestMemoryUsage,         "hpmufn/TestMemoryUsage"  );
+    addTest(root, &TestInitServices,        "hpmufn/TestInitServices"  );
 }
 
 static int32_t gMutexFailures = 0;
@@ -194,3 +203,191 @@ static void TestHeapFunctions() {
 }
 
 
+/*
+ *  Test Memory Scopes.
+ *    A simple arena: Blocks are carved out of one static buffer, each one after
+ *    a header with its size; freeing a block only counts it.
+ */
+static union {
+    ctest_AlignedMemory align;
+    char bytes[0x10000];
+} gArena;
+static size_t gArenaLength = 0;
+static int32_t gArenaAllocCount = 0;
+static int32_t gArenaFreeCount = 0;
+
+static void * U_CALLCONV arenaAlloc(const void *context, size_t size) {
+    size_t start = gArenaLength + sizeof(ctest_AlignedMemory);
+    size_t limit = start + (size + sizeof(ctest_AlignedMemory) - 1) / sizeof(ctest_AlignedMemory) *
+        sizeof(ctest_AlignedMemory);
+    (void)context;
+    if (limit > sizeof(gArena.bytes)) {
+        return NULL;
+    }
+    *(size_t *)(gArena.bytes + gArenaLength) = size;
+    gArenaLength = limit;
+    ++gArenaAllocCount;
+    return gArena.bytes + start;
+}
+
+static void * U_CALLCONV arenaRealloc(const void *context, void *mem, size_t size) {
+    size_t oldSize = *(size_t *)((char *)mem - sizeof(ctest_AlignedMemory));
+    void *newMem = arenaAlloc(context, size);
+    if (newMem != NULL) {
+        memcpy(newMem, mem, oldSize < size ? oldSize : size);
+        ++gArenaFreeCount;
+    }
+    return newMem;
+}
+
+static void U_CALLCONV arenaFree(const void *context, void *mem) {
+    (void)context;
+    (void)mem;
+    ++gArenaFreeCount;
+}
+
+static UBool U_CALLCONV arenaContains(const void *context, const void *mem) {
+    (void)context;
+    return (UBool)(gArena.bytes <= (const char *)mem && (const char *)mem < gArena.bytes + sizeof(gArena.bytes));
+}
+
+static void TestMemoryScope() {
+    UMemoryScope scope = { NULL, arenaAlloc, arenaRealloc, arenaFree, arenaContains, NULL };
+    UMemoryScope badScope = { NULL, arenaAlloc, arenaRealloc, arenaFree, NULL, NULL };
+    UErrorCode status = U_ZERO_ERROR;
+    UResourceBundle *rb;
+    UConverter *cnv;
+    char bytes[20];
+
+    u_pushMemoryScope(&badScope, &status);
+    TEST_STATUS(status, U_ILLEGAL_ARGUMENT_ERROR);
+    status = U_ZERO_ERROR;
+    u_popMemoryScope(&scope, &status);
+    TEST_STATUS(status, U_ILLEGAL_ARGUMENT_ERROR);
+
+#if !U_ENABLE_MEMORY_SCOPES
+    /* ICU was built without support for memory scopes. */
+    status = U_ZERO_ERROR;
+    u_pushMemoryScope(&scope, &status);
+    TEST_STATUS(status, U_UNSUPPORTED_ERROR);
+    return;
+#endif
+
+    /* Objects that are opened in the scope come from the arena. */
+    status = U_ZERO_ERROR;
+    gArenaLength = 0;
+    gArenaAllocCount = gArenaFreeCount = 0;
+    u_pushMemoryScope(&scope, &status);
+    TEST_STATUS(status, U_ZERO_ERROR);
+    rb = ures_open(NULL, "it", &status);
+    cnv = ucnv_open("ISO-8859-2", &status);
+    if (U_FAILURE(status)) {
+        log_data_err("unable to open a resource bundle or converter in a memory scope - %s\n",
+                     u_errorName(status));
+    } else if (gArenaAllocCount == 0) {
+        log_err("memory scope functions are not being called from ICU\n");
+    }
+    ucnv_close(cnv);
+    ures_close(rb);
+    if (U_SUCCESS(status) && gArenaFreeCount == 0) {
+        log_err("blocks from the memory scope are not freed into it\n");
+    }
+    u_popMemoryScope(&scope, &status);
+    TEST_STATUS(status, U_ZERO_ERROR);
+
+    /* Cached objects must not have been allocated in the arena. */
+    memset(gArena.bytes, 0xa5, sizeof(gArena.bytes));
+    gArenaAllocCount = 0;
+    status = U_ZERO_ERROR;
+    rb = ures_open(NULL, "it", &status);
+    cnv = ucnv_open("ISO-8859-2", &status);
+    if (U_SUCCESS(status)) {
+        static const UChar text[] = { 0x41, 0x104, 0x141, 0 };
+        int32_t length = ucnv_fromUChars(cnv, bytes, (int32_t)sizeof(bytes), text, -1, &status);
+        TEST_STATUS(status, U_ZERO_ERROR);
+        TEST_ASSERT(length == 3 && bytes[0] == 0x41 && (uint8_t)bytes[1] == 0xa1 && (uint8_t)bytes[2] == 0xa3);
+    }
+    ucnv_close(cnv);
+    ures_close(rb);
+    TEST_ASSERT(gArenaAllocCount == 0);
+}
+
+static void TestMemoryUsage() {
+    UMemoryUsage before[UMEM_TAG_REGEX + 1];
+    UMemoryUsage after[UMEM_TAG_REGEX + 1];
+    UErrorCode status = U_ZERO_ERROR;
+    UResourceBundle *rb;
+    int32_t count, tag;
+
+    count = u_getMemoryUsage(NULL, 0, &status);
+    TEST_STATUS(status, U_ZERO_ERROR);
+    TEST_ASSERT(count >= UMEM_TAG_REGEX + 1);
+    u_getMemoryUsage(NULL, 1, &status);
+    TEST_STATUS(status, U_ILLEGAL_ARGUMENT_ERROR);
+
+    TEST_ASSERT(strcmp(u_getMemoryTagName(UMEM_TAG_COLLATION), "collation") == 0);
+    TEST_ASSERT(strcmp(u_getMemoryTagName(UMEM_TAG_REGEX), "regex") == 0);
+    TEST_ASSERT(strcmp(u_getMemoryTagName(-1), "[BOGUS Memory Tag]") == 0);
+
+    status = U_ZERO_ERROR;
+    u_getMemoryUsage(before, UPRV_LENGTHOF(before), &status);
+    rb = ures_open(NULL, "it", &status);
+    u_getMemoryUsage(after, UPRV_LENGTHOF(after), &status);
+    ures_close(rb);
+    if (U_FAILURE(status)) {
+        log_data_err("unable to open a resource bundle - %s\n", u_errorName(status));
+        return;
+    }
+    for (tag = 0; tag < UPRV_LENGTHOF(after); ++tag) {
+        TEST_ASSERT(after[tag].allocations >= before[tag].allocations);
+    }
+    if (after[UMEM_TAG_RESOURCES].allocations == 0) {
+        /* Memory accounting is disabled: all counters are 0. */
+        for (tag = 0; tag < UPRV_LENGTHOF(after); ++tag) {
+            TEST_ASSERT(after[tag].liveBytes == 0 && after[tag].liveBlocks == 0);
+        }
+    } else {
+        TEST_ASSERT(after[UMEM_TAG_RESOURCES].liveBlocks > 0);
+        TEST_ASSERT(after[UMEM_TAG_RESOURCES].liveBytes > 0);
+    }
+}
+
+static void TestInitServices() {
+    static const char * const locales[] = { "en", "de_CH", "ja", NULL };
+    uint32_t expected = UINIT_ALL;
+    uint32_t loaded;
+    UErrorCode status = U_ZERO_ERROR;
+
+    loaded = u_initServices(NULL, 0x100, &status);
+    TEST_STATUS(status, U_ILLEGAL_ARGUMENT_ERROR);
+    TEST_ASSERT(loaded == 0);
+
+    status = U_ZERO_ERROR;
+    loaded = u_initServices(NULL, 0, &status);
+    TEST_STATUS(status, U_ZERO_ERROR);
+    TEST_ASSERT(loaded == 0);
+
+#if UCONFIG_NO_CONVERSION
+    expected &= ~UINIT_CONVERSION;
+#endif
+#if UCONFIG_NO_COLLATION
+    expected &= ~UINIT_COLLATION;
+#endif
+#if UCONFIG_NO_FORMATTING
+    expected &= ~(UINIT_TIME_ZONE | UINIT_NUMBER_FORMAT | UINIT_DATE_FORMAT);
+#endif
+#if UCONFIG_NO_BREAK_ITERATION
+    expected &= ~UINIT_BREAK_ITERATION;
+#endif
+    loaded = u_initServices(locales, UINIT_ALL, &status);
+    TEST_STATUS(status, U_ZERO_ERROR);
+    if (loaded != expected) {
+        log_data_err("u_initServices() loaded services 0x%x, expected 0x%x - (Are you missing data?)\n",
+                     (int)loaded, (int)expected);
+    }
+    TEST_ASSERT((loaded & ~expected) == 0);
+
+    /* Repeated initialization is harmless. */
+    TEST_ASSERT(u_initServices(NULL, UINIT_LOCALE, &status) == (loaded & UINIT_LOCALE));
+    TEST_STATUS(status, U_ZERO_ERROR);
+}
@@ -43,6 +43,7 @@ static void TestSignatureDetection(void);
 static void TestUTF7(void);
 static void TestIMAP(void);
 static void TestUTF8(void);
+static void TestUTF8LongRuns(void);
 static void TestCESU8(void);
 static void TestUTF16(void);
 static void TestUTF16BE(void);
@@ -50,6 +51,7 @@ static void TestUTF16LE(void);
 static void TestUTF32(void);
 static void TestUTF32BE(void);
 static void TestUTF32LE(void);
+static void TestUTF16UTF32LongRuns(void);
 static void TestLATIN1(void);
 
 #if !UCONFIG_NO_LEGACY_CONVERSION
@@ -78,6 +80,7 @@ static void TestISO_2022_CN_EXT(void);
 #endif
 static void TestJIS(void);
 static void TestHZ(void);
+static void TestStatefulAsciiRuns(void);
 #endif
 
 static void TestSCSU(void);
@@ -259,6 +262,7 @@ void addTestNewConvert(TestNode** root)
    addTest(root, &TestUTF7, "tsconv/nucnvtst/TestUTF7");
    addTest(root, &TestIMAP, "tsconv/nucnvtst/TestIMAP");
    addTest(root, &TestUTF8, "tsconv/nucnvtst/TestUTF8");
+   addTest(root, &TestUTF8LongRuns, "tsconv/nucnvtst/TestUTF8LongRuns");
 
    /* test ucnv_getNextUChar() for charsets that encode single surrogates with complete byte sequences */
    addTest(root, &TestCESU8, "tsconv/nucnvtst/TestCESU8");
@@ -268,6 +272,7 @@ void addTestNewConvert(TestNode** root)
    addTest(root, &TestUTF32, "tsconv/nucnvtst/TestUTF32");
    addTest(root, &TestUTF32BE, "tsconv/nucnvtst/TestUTF32BE");
    addTest(root, &TestUTF32LE, "tsconv/nucnvtst/TestUTF32LE");
+   addTest(root, &TestUTF16UTF32LongRuns, "tsconv/nucnvtst/TestUTF16UTF32LongRuns");
 
 #if !UCONFIG_NO_LEGACY_CONVERSION
    addTest(root, &TestLMBCS, "tsconv/nucnvtst/TestLMBCS");
@@ -300,6 +305,7 @@ void addTestNewConvert(TestNode** root)
    addTest(root, &TestJitterbug915, "tsconv/nucnvtst/TestJitterbug915");
     */
    addTest(root, &TestHZ, "tsconv/nucnvtst/TestHZ");
+   addTest(root, &TestStatefulAsciiRuns, "tsconv/nucnvtst/TestStatefulAsciiRuns");
 #endif
 
    addTest(root, &TestSCSU, "tsconv/nucnvtst/TestSCSU");
@@ -1961,6 +1967,94 @@ static void TestUTF8() {
     ucnv_close(cnv);
 }
 
+/*
+ * Long ASCII runs and well-formed multi-byte sequences are converted in bulk.
+ * Check that the results match the string-function conversion,
+ * in one call and with small buffers, and that offsets stay correct.
+ */
+static void TestUTF8LongRuns() {
+    static const uint8_t pieces[][5]={
+        { 0xc3, 0xa4, 0 },              /* U+00E4 */
+        { 0xe4, 0xb8, 0x80, 0 },        /* U+4E00 */
+        { 0xf0, 0x9f, 0x98, 0x80, 0 },  /* U+1F600 */
+        { 0xe0, 0x80, 0 },              /* illegal non-shortest form */
+        { 0xed, 0xa0, 0x80, 0 },        /* illegal surrogate */
+        { 0xff, 0 },                    /* illegal byte */
+        { 0xe4, 0xb8, 0 }               /* truncated sequence */
+    };
+    uint8_t in[2000];
+    UChar expected[2000], out[2000];
+    int32_t offsets[2000];
+    int32_t inLength=0, expectedLength, outLength, runLength, i;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UConverter *cnv;
+
+    for(runLength=0; runLength<=40 && inLength<(int32_t)sizeof(in)-60; ++runLength) {
+        const uint8_t *piece=pieces[runLength%UPRV_LENGTHOF(pieces)];
+        for(i=0; i<runLength; ++i) {
+            in[inLength++]=(uint8_t)(0x20+(runLength+i)%0x5f);
+        }
+        while(*piece!=0) {
+            in[inLength++]=*piece++;
+        }
+    }
+    for(i=0; i<35; ++i) {
+        in[inLength++]=(uint8_t)(0x41+i%26);
+    }
+
+    u_strFromUTF8WithSub(expected, UPRV_LENGTHOF(expected), &expectedLength,
+                         (const char *)in, inLength, 0xfffd, NULL, &errorCode);
+    cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("Unable to open a UTF-8 converter: %s\n", u_errorName(errorCode));
+        return;
+    }
+
+    /* the whole input at once, with offsets */
+    {
+        const char *source=(const char *)in;
+        UChar *target=out;
+        ucnv_toUnicode(cnv, &target, out+UPRV_LENGTHOF(out), &source, source+inLength,
+                       offsets, TRUE, &errorCode);
+        outLength=(int32_t)(target-out);
+        if(U_FAILURE(errorCode) || outLength!=expectedLength ||
+                0!=u_memcmp(out, expected, expectedLength)) {
+            log_err("UTF-8 long runs: ucnv_toUnicode() does not match u_strFromUTF8WithSub() - %s\n",
+                    u_errorName(errorCode));
+        }
+        for(i=0; i<outLength; ++i) {
+            if(out[i]<0x80 && out[i]!=in[offsets[i]]) {
+                log_err("UTF-8 long runs: wrong offset %d for output index %d\n", offsets[i], i);
+                break;
+            }
+        }
+    }
+
+    /* small chunks of input and output */
+    {
+        const char *source=(const char *)in, *sourceLimit;
+        UChar *target=out, *targetLimit;
+        UBool flush;
+        ucnv_reset(cnv);
+        do {
+            sourceLimit=source+23<(const char *)in+inLength ? source+23 : (const char *)in+inLength;
+            flush=(UBool)(sourceLimit==(const char *)in+inLength);
+            do {
+                errorCode=U_ZERO_ERROR;
+                targetLimit=target+17<out+UPRV_LENGTHOF(out) ? target+17 : out+UPRV_LENGTHOF(out);
+                ucnv_toUnicode(cnv, &target, targetLimit, &source, sourceLimit, NULL, flush, &errorCode);
+            } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+        } while(U_SUCCESS(errorCode) && !flush);
+        outLength=(int32_t)(target-out);
+        if(U_FAILURE(errorCode) || outLength!=expectedLength ||
+                0!=u_memcmp(out, expected, expectedLength)) {
+            log_err("UTF-8 long runs: chunked ucnv_toUnicode() does not match u_strFromUTF8WithSub() - %s\n",
+                    u_errorName(errorCode));
+        }
+    }
+    ucnv_close(cnv);
+}
+
 static void TestCESU8() {
     /* test input */
     static const uint8_t in[]={
@@ -2400,6 +2494,133 @@ TestUTF32LE() {
     ucnv_close(cnv);
 }
 
+/*
+ * Long runs without surrogates are converted in bulk by the UTF-16 and UTF-32 converters.
+ * Check them against a simple serialization of the text, with offsets,
+ * and with small buffers.
+ */
+static void TestUTF16UTF32LongRuns() {
+    static const char *const names[]={ "UTF-16BE", "UTF-16LE", "UTF-32BE", "UTF-32LE" };
+    UChar in[1000], out[1000];
+    char expected[4000], bytes[4000];
+    int32_t fromUOffsets[4000], toUOffsets[1000], offsets[4000];
+    int32_t inLength=0, runLength, i, n;
+
+    for(runLength=0; runLength<=40; ++runLength) {
+        for(i=0; i<runLength; ++i) {
+            in[inLength++]=(UChar)(0x20+(runLength*37+i*0x101)%0xd7e0);  /* no surrogates */
+        }
+        in[inLength++]=0xd83d;  /* U+1F600 */
+        in[inLength++]=0xde00;
+    }
+    for(i=0; i<35; ++i) {
+        in[inLength++]=(UChar)(0xe000+i*0x3f);
+    }
+
+    for(n=0; n<UPRV_LENGTHOF(names); ++n) {
+        UBool bigEndian=(UBool)(n%2==0);
+        int32_t unitSize= n<2 ? 2 : 4;
+        int32_t expectedLength=0, length;
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv;
+
+        /* serialize the text, and record the offsets in both directions */
+        for(i=0; i<inLength;) {
+            int32_t start=i, byteStart=expectedLength, j, k;
+            UChar32 c;
+            U16_NEXT(in, i, inLength, c);
+            for(j=start; j<i; ++j) {
+                toUOffsets[j]=byteStart;
+                if(unitSize==2 || j==start) {
+                    uint32_t unit= unitSize==2 ? in[j] : (uint32_t)c;
+                    for(k=0; k<unitSize; ++k) {
+                        int32_t shift= bigEndian ? 8*(unitSize-1-k) : 8*k;
+                        fromUOffsets[expectedLength]=start;
+                        expected[expectedLength++]=(char)(uint8_t)(unit>>shift);
+                    }
+                }
+            }
+        }
+
+        cnv=ucnv_open(names[n], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("Unable to open a %s converter: %s\n", names[n], u_errorName(errorCode));
+            continue;
+        }
+
+        /* the whole text at once, with offsets */
+        {
+            const UChar *source=in;
+            char *target=bytes;
+            ucnv_fromUnicode(cnv, &target, bytes+UPRV_LENGTHOF(bytes), &source, in+inLength,
+                             offsets, TRUE, &errorCode);
+            length=(int32_t)(target-bytes);
+            if(U_FAILURE(errorCode) || length!=expectedLength ||
+                    0!=uprv_memcmp(bytes, expected, length) ||
+                    0!=uprv_memcmp(offsets, fromUOffsets, length*4)) {
+                log_err("%s long runs: wrong ucnv_fromUnicode() result or offsets - %s\n",
+                        names[n], u_errorName(errorCode));
+            }
+        }
+        {
+            const char *source=expected;
+            UChar *target=out;
+            ucnv_toUnicode(cnv, &target, out+UPRV_LENGTHOF(out), &source, expected+expectedLength,
+                           offsets, TRUE, &errorCode);
+            length=(int32_t)(target-out);
+            if(U_FAILURE(errorCode) || length!=inLength ||
+                    0!=u_memcmp(out, in, length) ||
+                    0!=uprv_memcmp(offsets, toUOffsets, length*4)) {
+                log_err("%s long runs: wrong ucnv_toUnicode() result or offsets - %s\n",
+                        names[n], u_errorName(errorCode));
+            }
+        }
+
+        /* small chunks of input and output */
+        {
+            const UChar *source=in, *sourceLimit;
+            char *target=bytes, *targetLimit;
+            UBool flush;
+            ucnv_reset(cnv);
+            do {
+                sourceLimit=source+23<in+inLength ? source+23 : in+inLength;
+                flush=(UBool)(sourceLimit==in+inLength);
+                do {
+                    errorCode=U_ZERO_ERROR;
+                    targetLimit=target+37<bytes+UPRV_LENGTHOF(bytes) ? target+37 : bytes+UPRV_LENGTHOF(bytes);
+                    ucnv_fromUnicode(cnv, &target, targetLimit, &source, sourceLimit, NULL, flush, &errorCode);
+                } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+            } while(U_SUCCESS(errorCode) && !flush);
+            length=(int32_t)(target-bytes);
+            if(U_FAILURE(errorCode) || length!=expectedLength || 0!=uprv_memcmp(bytes, expected, length)) {
+                log_err("%s long runs: chunked ucnv_fromUnicode() gives wrong bytes - %s\n",
+                        names[n], u_errorName(errorCode));
+            }
+        }
+        {
+            const char *source=expected, *sourceLimit;
+            UChar *target=out, *targetLimit;
+            UBool flush;
+            ucnv_reset(cnv);
+            do {
+                sourceLimit=source+61<expected+expectedLength ? source+61 : expected+expectedLength;
+                flush=(UBool)(sourceLimit==expected+expectedLength);
+                do {
+                    errorCode=U_ZERO_ERROR;
+                    targetLimit=target+17<out+UPRV_LENGTHOF(out) ? target+17 : out+UPRV_LENGTHOF(out);
+                    ucnv_toUnicode(cnv, &target, targetLimit, &source, sourceLimit, NULL, flush, &errorCode);
+                } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+            } while(U_SUCCESS(errorCode) && !flush);
+            length=(int32_t)(target-out);
+            if(U_FAILURE(errorCode) || length!=inLength || 0!=u_memcmp(out, in, length)) {
+                log_err("%s long runs: chunked ucnv_toUnicode() gives wrong text - %s\n",
+                        names[n], u_errorName(errorCode));
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
+
 static void
 TestLATIN1() {
     /* test input */
@@ -3150,6 +3371,142 @@ TestHZ() {
     free(cBuf);
 }
 
+/*
+ * The ISO-2022 and HZ converters convert runs of ASCII characters in bulk
+ * while they are in their ASCII state.
+ * Check round trips, offsets, and that conversion in small chunks
+ * (splitting runs and escape sequences) yields the same bytes.
+ */
+static void
+TestStatefulAsciiRuns() {
+    static const char *const names[]={
+        "ISO-2022-JP", "ISO-2022-KR", "ISO-2022-CN", "HZ"
+    };
+    UChar in[1200], out[1200];
+    char bytes[3000], chunked[3000];
+    int32_t offsets[3000];
+    int32_t inLength=0, length, outLength, chunkedLength, runLength, n, i;
+
+    for(runLength=0; runLength<=40; ++runLength) {
+        for(i=0; i<runLength; ++i) {
+            /* printable ASCII without the backslash which ISO-2022-KR does not round-trip */
+            UChar c=(UChar)(0x20+(runLength+i)%0x5f);
+            in[inLength++]= c==0x5c ? 0x2f : c;
+        }
+        switch(runLength%4) {
+        case 0:
+            in[inLength++]=0x4e2d;  /* CJK, in the DBCS of each charset */
+            in[inLength++]=0x6587;
+            break;
+        case 1:
+            in[inLength++]=0xd;
+            in[inLength++]=0xa;
+            break;
+        case 2:
+            in[inLength++]=0x7e;    /* tilde, escaped in HZ */
+            break;
+        default:
+            in[inLength++]=0x65e5;
+            break;
+        }
+    }
+
+    for(n=0; n<UPRV_LENGTHOF(names); ++n) {
+        const char *name=names[n];
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(name, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("Unable to open a %s converter: %s\n", name, u_errorName(errorCode));
+            continue;
+        }
+
+        /* the whole input at once */
+        length=ucnv_fromUChars(cnv, bytes, UPRV_LENGTHOF(bytes), in, inLength, &errorCode);
+        outLength=ucnv_toUChars(cnv, out, UPRV_LENGTHOF(out), bytes, length, &errorCode);
+        if(U_FAILURE(errorCode) || outLength!=inLength || 0!=u_memcmp(in, out, inLength)) {
+            log_err("%s ASCII runs: round trip failed - %s\n", name, u_errorName(errorCode));
+        }
+
+        /* toUnicode with offsets */
+        {
+            const char *source=bytes;
+            UChar *target=out;
+            ucnv_reset(cnv);
+            ucnv_toUnicode(cnv, &target, out+UPRV_LENGTHOF(out), &source, bytes+length,
+                           offsets, TRUE, &errorCode);
+            outLength=(int32_t)(target-out);
+            for(i=0; i<outLength; ++i) {
+                if(out[i]<0x7e && out[i]!=(uint8_t)bytes[offsets[i]]) {
+                    log_err("%s ASCII runs: wrong toUnicode offset %d for output index %d\n",
+                            name, offsets[i], i);
+                    break;
+                }
+            }
+        }
+
+        /* fromUnicode with offsets */
+        {
+            const UChar *source=in;
+            char *target=chunked;
+            ucnv_reset(cnv);
+            ucnv_fromUnicode(cnv, &target, chunked+UPRV_LENGTHOF(chunked), &source, in+inLength,
+                             offsets, TRUE, &errorCode);
+            chunkedLength=(int32_t)(target-chunked);
+            for(i=0; i<chunkedLength && offsets[i]>=0; ++i) {
+                UChar c=in[offsets[i]];
+                if(c<0x7e && c!=0xd && c!=0xa && (uint8_t)chunked[i]!=c &&
+                        /* escape and shift sequences point to the following character */
+                        (i+1==chunkedLength || offsets[i+1]!=offsets[i])) {
+                    log_err("%s ASCII runs: wrong fromUnicode offset %d for output index %d\n",
+                            name, offsets[i], i);
+                    break;
+                }
+            }
+        }
+
+        /* small chunks of input and output */
+        {
+            const UChar *source=in, *sourceLimit;
+            char *target=chunked, *targetLimit;
+            UBool flush;
+            ucnv_reset(cnv);
+            do {
+                sourceLimit=source+13<in+inLength ? source+13 : in+inLength;
+                flush=(UBool)(sourceLimit==in+inLength);
+                do {
+                    errorCode=U_ZERO_ERROR;
+                    targetLimit=target+7<chunked+UPRV_LENGTHOF(chunked) ? target+7 : chunked+UPRV_LENGTHOF(chunked);
+                    ucnv_fromUnicode(cnv, &target, targetLimit, &source, sourceLimit, NULL, flush, &errorCode);
+                } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+            } while(U_SUCCESS(errorCode) && !flush);
+            chunkedLength=(int32_t)(target-chunked);
+            if(U_FAILURE(errorCode) || chunkedLength!=length || 0!=uprv_memcmp(bytes, chunked, length)) {
+                log_err("%s ASCII runs: chunked ucnv_fromUnicode() differs - %s\n", name, u_errorName(errorCode));
+            }
+        }
+        {
+            const char *source=bytes, *sourceLimit;
+            UChar *target=out, *targetLimit;
+            UBool flush;
+            ucnv_reset(cnv);
+            do {
+                sourceLimit=source+11<bytes+length ? source+11 : bytes+length;
+                flush=(UBool)(sourceLimit==bytes+length);
+                do {
+                    errorCode=U_ZERO_ERROR;
+                    targetLimit=target+5<out+UPRV_LENGTHOF(out) ? target+5 : out+UPRV_LENGTHOF(out);
+                    ucnv_toUnicode(cnv, &target, targetLimit, &source, sourceLimit, NULL, flush, &errorCode);
+                } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+            } while(U_SUCCESS(errorCode) && !flush);
+            outLength=(int32_t)(target-out);
+            if(U_FAILURE(errorCode) || outLength!=inLength || 0!=u_memcmp(in, out, inLength)) {
+                log_err("%s ASCII runs: chunked ucnv_toUnicode() differs - %s\n", name, u_errorName(errorCode));
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
+
 static void
 TestISCII(){
         /* test input */
@@ -1312,6 +1312,29 @@ static void TestRegexCAPI(void) {
      status = U_ZERO_ERROR;
      TEST_ASSERT(uregex_getStackLimit(re, &status) == 40000);
      TEST_TEARDOWN;
+
+     /*
+      * Stack arena, heap allocation count
+      */
+     TEST_SETUP("(a|b)*c", "abababc", 0);
+     int64_t arena[256];
+     int32_t allocationCount;
+     uregex_setStackArena(re, arena, sizeof(arena), &status);
+     TEST_ASSERT_SUCCESS(status);
+     TEST_ASSERT(uregex_getStackLimit(re, &status) == (int32_t)sizeof(arena));
+     TEST_ASSERT(uregex_matches(re, 0, &status));
+     allocationCount = uregex_getHeapAllocationCount(re, &status);
+     TEST_ASSERT(uregex_matches(re, 0, &status));
+     TEST_ASSERT(uregex_findNext(re, &status) == FALSE);
+     TEST_ASSERT(uregex_getHeapAllocationCount(re, &status) == allocationCount);
+     TEST_ASSERT_SUCCESS(status);
+     uregex_setStackArena(re, arena, 8, &status);
+     TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+     status = U_ZERO_ERROR;
+     uregex_setStackArena(re, NULL, 0, &status);
+     TEST_ASSERT(uregex_getStackLimit(re, &status) == 8000000);
+     TEST_ASSERT(uregex_matches(re, 0, &status));
+     TEST_TEARDOWN;
      
      
      /*
@@ -41,6 +41,7 @@ static void Test_nfs4_mixed_prep(void);
 static void TestBEAMWarning(void);
 static void TestCoverage(void);
 static void TestStringPrepProfiles(void);
+static void TestPrepareUTF8(void);
 
 UStringPrepProfileType getTypeFromProfileName(const char* profileName);
 
@@ -58,6 +59,7 @@ addUStringPrepTest(TestNode** root)
 #endif
    addTest(root, &TestCoverage,              "spreptst/TestCoverage");
    addTest(root, &TestStringPrepProfiles,              "spreptst/TestStringPrepProfiles");
+   addTest(root, &TestPrepareUTF8,           "spreptst/TestPrepareUTF8");
 }
 
 static void 
@@ -808,6 +810,81 @@ static void TestStringPrepProfiles(void) {
     }
 }
 
+static void TestPrepareUTF8(void) {
+    UErrorCode status = U_ZERO_ERROR;
+    const char *profileName = NULL;
+    UChar src[SPREP_PROFILE_TEST_MAX_LENGTH];
+    UChar expected[SPREP_PROFILE_TEST_MAX_LENGTH];
+    char src8[SPREP_PROFILE_TEST_MAX_LENGTH * 3];
+    char expected8[SPREP_PROFILE_TEST_MAX_LENGTH * 3];
+    char result8[SPREP_PROFILE_TEST_MAX_LENGTH * 3];
+    int32_t srcLength, expectedLength, src8Length, expected8Length, resultLength;
+    int32_t i, testNum = 0;
+    UStringPrepProfile *sprep = NULL;
+
+    /* the same results as usprep_prepare() */
+    for (i = 0; i < UPRV_LENGTHOF(profile_test_case); i++) {
+        if (uprv_strstr(profile_test_case[i], "RFC")) {
+            usprep_close(sprep);
+            profileName = profile_test_case[i];
+            sprep = usprep_openByType(getTypeFromProfileName(profileName), &status);
+            if (U_FAILURE(status)) {
+                log_data_err("Unable to open String Prep Profile with: %s\n", profileName);
+                return;
+            }
+            testNum = 0;
+            continue;
+        }
+        testNum++;
+        srcLength = u_unescape(profile_test_case[i], src, SPREP_PROFILE_TEST_MAX_LENGTH);
+        expectedLength = u_unescape(profile_test_case[++i], expected, SPREP_PROFILE_TEST_MAX_LENGTH);
+        u_strToUTF8(src8, UPRV_LENGTHOF(src8), &src8Length, src, srcLength, &status);
+        u_strToUTF8(expected8, UPRV_LENGTHOF(expected8), &expected8Length, expected, expectedLength, &status);
+
+        resultLength = usprep_prepareUTF8(sprep, src8, src8Length, result8, UPRV_LENGTHOF(result8),
+                                          USPREP_ALLOW_UNASSIGNED, NULL, &status);
+        if (uprv_strstr(profile_test_case[i], "FAIL") != NULL) {
+            if (U_SUCCESS(status)) {
+                log_err("Error expected on UTF-8 test[%d] for profile: %s\n", testNum, profileName);
+            }
+            status = U_ZERO_ERROR;
+        } else if (U_FAILURE(status)) {
+            log_err("Error occurred on UTF-8 test[%d] for profile: %s - %s\n", testNum, profileName, u_errorName(status));
+            status = U_ZERO_ERROR;
+        } else if (resultLength != expected8Length || uprv_strcmp(result8, expected8) != 0) {
+            log_err("Results do not match expected on UTF-8 test[%d] for profile: %s\n", testNum, profileName);
+        }
+    }
+    usprep_close(sprep);
+
+    /* ASCII strings, and preflighting */
+    sprep = usprep_openByType(USPREP_RFC3920_NODEPREP, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("Unable to open String Prep Profile RFC3920_NODEPREP\n");
+        return;
+    }
+    resultLength = usprep_prepareUTF8(sprep, "JoeUser", -1, NULL, 0, USPREP_DEFAULT, NULL, &status);
+    if (status != U_BUFFER_OVERFLOW_ERROR || resultLength != 7) {
+        log_err("usprep_prepareUTF8(JoeUser) preflighting: %s, length %d\n", u_errorName(status), resultLength);
+    }
+    status = U_ZERO_ERROR;
+    resultLength = usprep_prepareUTF8(sprep, "JoeUser", -1, result8, UPRV_LENGTHOF(result8), USPREP_DEFAULT, NULL, &status);
+    if (U_FAILURE(status) || resultLength != 7 || uprv_strcmp(result8, "joeuser") != 0) {
+        log_err("usprep_prepareUTF8(JoeUser) failed: %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    usprep_prepareUTF8(sprep, "joe@example", -1, result8, UPRV_LENGTHOF(result8), USPREP_DEFAULT, NULL, &status);
+    if (status != U_STRINGPREP_PROHIBITED_ERROR) {
+        log_err("usprep_prepareUTF8(joe@example) did not fail with a prohibited character: %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    usprep_prepareUTF8(sprep, "joe\xff", -1, result8, UPRV_LENGTHOF(result8), USPREP_DEFAULT, NULL, &status);
+    if (status != U_INVALID_CHAR_FOUND) {
+        log_err("usprep_prepareUTF8(ill-formed UTF-8) did not fail: %s\n", u_errorName(status));
+    }
+    usprep_close(sprep);
+}
+
 #endif
 
 /*
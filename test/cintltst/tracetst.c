@@ -18,6 +18,7 @@
 #include "unicode/ures.h"
 #include "unicode/ucnv.h"
 #include "cintltst.h"
+#include "cmemory.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -34,6 +35,8 @@
 
 
 static void TestTraceAPI(void);
+static void TestTraceMetrics(void);
+static void TestMutexStats(void);
 
 
 void
@@ -43,6 +46,8 @@ void
 addUTraceTest(TestNode** root)
 {
     addTest(root, &TestTraceAPI,            "tsutil/TraceTest/TestTraceAPI"  );
+    addTest(root, &TestTraceMetrics,        "tsutil/TraceTest/TestTraceMetrics"  );
+    addTest(root, &TestMutexStats,          "tsutil/TraceTest/TestMutexStats"  );
 }
 
 
@@ -369,6 +374,16 @@ static void TestTraceAPI() {
         TEST_ASSERT(strcmp(name, "ucnv_open") == 0);
         name = utrace_functionName(UTRACE_UCOL_GET_SORTKEY);
         TEST_ASSERT(strcmp(name, "ucol_getSortKey") == 0);
+        name = utrace_functionName(UTRACE_URES_OPEN);
+        TEST_ASSERT(strcmp(name, "ures_open") == 0);
+        name = utrace_functionName(UTRACE_UDATA_MAP_FILE);
+        TEST_ASSERT(strcmp(name, "udata_mapFile") == 0);
+        name = utrace_functionName(UTRACE_UBRK_CREATE);
+        TEST_ASSERT(strcmp(name, "BreakIterator::createInstance") == 0);
+        name = utrace_functionName(UTRACE_UNIFIED_CACHE_CREATE);
+        TEST_ASSERT(strcmp(name, "UnifiedCache::createObject") == 0);
+        name = utrace_functionName(UTRACE_SERVICE_LIMIT);
+        TEST_ASSERT(strncmp(name, "[BOGUS", 6) == 0);
     }
 
 
@@ -379,4 +394,123 @@ static void TestTraceAPI() {
 }
 
 
+/*
+ *   TestTraceMetrics
+ */
+static void TestTraceMetrics() {
+    int64_t     metrics[UTRACE_METRIC_LIMIT + 1];
+    UErrorCode  status = U_ZERO_ERROR;
+    UConverter *cnv1;
+    UConverter *cnv2;
+    void       *p;
+    int32_t     count;
+    int32_t     i;
+
+    /* Preflighting, and illegal arguments. */
+    count = utrace_getMetrics(NULL, 0, &status);
+    TEST_ASSERT(U_SUCCESS(status));
+    TEST_ASSERT(count == UTRACE_METRIC_LIMIT);
+    utrace_getMetrics(NULL, 1, &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    status = U_ZERO_ERROR;
+
+    /* Every metric has a name. */
+    for (i = 0; i < UTRACE_METRIC_LIMIT; ++i) {
+        TEST_ASSERT(strncmp(utrace_metricName(i), "[BOGUS", 6) != 0);
+    }
+    TEST_ASSERT(strcmp(utrace_metricName(UTRACE_METRIC_UNIFIED_CACHE_HIT), "unifiedCacheHit") == 0);
+    TEST_ASSERT(strncmp(utrace_metricName(UTRACE_METRIC_LIMIT), "[BOGUS", 6) == 0);
+
+    /*
+     * Opening the same converter twice loads its data at most once,
+     * and allocates memory each time.
+     */
+    utrace_resetMetrics();
+    cnv1 = ucnv_open("ISO-8859-3", &status);
+    cnv2 = ucnv_open("ISO-8859-3", &status);
+    p = uprv_malloc(100);
+    uprv_free(p);
+    ucnv_close(cnv1);
+    ucnv_close(cnv2);
+    if (U_FAILURE(status)) {
+        log_data_err("ucnv_open(ISO-8859-3) failed - %s\n", u_errorName(status));
+        return;
+    }
+
+    metrics[UTRACE_METRIC_LIMIT] = -1;
+    count = utrace_getMetrics(metrics, UTRACE_METRIC_LIMIT, &status);
+    TEST_ASSERT(U_SUCCESS(status));
+    TEST_ASSERT(count == UTRACE_METRIC_LIMIT);
+    TEST_ASSERT(metrics[UTRACE_METRIC_LIMIT] == -1);
+#if ENABLE_TRACING_ORIG_VAL
+    TEST_ASSERT(metrics[UTRACE_METRIC_CONVERTER_CACHE_HIT] >= 1);
+    TEST_ASSERT(metrics[UTRACE_METRIC_CONVERTER_CACHE_HIT] +
+                metrics[UTRACE_METRIC_CONVERTER_CACHE_MISS] >= 2);
+    TEST_ASSERT(metrics[UTRACE_METRIC_ALLOC_COUNT] >= 1);
+    TEST_ASSERT(metrics[UTRACE_METRIC_ALLOC_BYTES] >= 100);
+    TEST_ASSERT(metrics[UTRACE_METRIC_FREE_COUNT] >= 1);
+#else
+    /* The library does not count anything without tracing. */
+    for (i = 0; i < UTRACE_METRIC_LIMIT; ++i) {
+        TEST_ASSERT(metrics[i] == 0);
+    }
+#endif
+
+    /* A smaller capacity writes fewer metrics. */
+    metrics[1] = -1;
+    TEST_ASSERT(utrace_getMetrics(metrics, 1, &status) == UTRACE_METRIC_LIMIT);
+    TEST_ASSERT(metrics[1] == -1);
+}
 
+
+/*
+ *   TestMutexStats
+ */
+static void TestMutexStats() {
+    UTraceMutexStats stats[100];
+    UErrorCode  status = U_ZERO_ERROR;
+    int32_t     count;
+    int32_t     i;
+#if ENABLE_TRACING_ORIG_VAL
+    UBool       found = FALSE;
+#endif
+
+    /* Preflighting, and illegal arguments. */
+    utrace_getMutexStats(NULL, 0, &status);
+    TEST_ASSERT(U_SUCCESS(status));
+    utrace_getMutexStats(NULL, 1, &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    status = U_ZERO_ERROR;
+
+    /* With a converter in the cache, ucnv_flushCache() locks the converter cache mutex. */
+    ucnv_close(ucnv_open("ISO-8859-3", &status));
+    if (U_FAILURE(status)) {
+        log_data_err("ucnv_open(ISO-8859-3) failed - %s\n", u_errorName(status));
+        return;
+    }
+    utrace_resetMutexStats();
+    ucnv_flushCache();
+    count = utrace_getMutexStats(stats, UPRV_LENGTHOF(stats), &status);
+    TEST_ASSERT(U_SUCCESS(status));
+#if ENABLE_TRACING_ORIG_VAL
+    TEST_ASSERT(count >= 1);
+    for (i = 0; i < count && i < UPRV_LENGTHOF(stats); ++i) {
+        TEST_ASSERT(stats[i].contentions <= stats[i].acquisitions);
+        TEST_ASSERT(stats[i].waitNanos >= 0);
+        if (stats[i].name != NULL && strcmp(stats[i].name, "cnvCacheMutex") == 0) {
+            found = TRUE;
+            TEST_ASSERT(stats[i].acquisitions >= 1);
+        }
+    }
+    TEST_ASSERT(found);
+
+    /* A smaller capacity writes fewer items but counts all of them. */
+    stats[0].name = "untouched";
+    TEST_ASSERT(utrace_getMutexStats(stats, 0, &status) == count);
+    TEST_ASSERT(strcmp(stats[0].name, "untouched") == 0);
+#else
+    /* The library does not record anything without tracing. */
+    (void)i;
+    TEST_ASSERT(count == 0);
+#endif
+}
@@ -33,12 +33,14 @@
 
 static void TestSelector(void);
 static void TestUPropsVector(void);
+static void TestSelectorAsciiRuns(void);
 void addCnvSelTest(TestNode** root);  /* Declaration required to suppress compiler warnings. */
 
 void addCnvSelTest(TestNode** root)
 {
     addTest(root, &TestSelector, "tsconv/ucnvseltst/TestSelector");
     addTest(root, &TestUPropsVector, "tsconv/ucnvseltst/TestUPropsVector");
+    addTest(root, &TestSelectorAsciiRuns, "tsconv/ucnvseltst/TestSelectorAsciiRuns");
 }
 
 static const char **gAvailableNames = NULL;
@@ -505,6 +507,57 @@ static void TestSelector()
   }
 }
 
+/*
+ * Long ASCII runs and repeated characters, which the selector
+ * skips without looking up each code point.
+ */
+static void TestSelectorAsciiRuns() {
+  static const char *encodings[] = { "US-ASCII", "ISO-8859-1", "IBM037" };
+  static const struct {
+    const char *utf8;
+    int32_t count, countExcludingLower;
+  } cases[] = {
+    { "The quick brown fox jumps over the lazy dog, twice.", 3, 3 },
+    { "The quick brown fox jumps over the lazy dog \xC3\xA9\xC3\xA9\xC3\xA9.", 2, 2 },
+    { "\xE2\x82\xAC the quick brown fox jumps over the lazy dog", 0, 0 },
+    { "ABC\xC3\xA9" "DEF", 2, 2 },
+    { "", 3, 3 }
+  };
+  UConverterSelector *sels[2];
+  UErrorCode status = U_ZERO_ERROR;
+  USet *lower = uset_open(0x61, 0x7a);
+  int32_t i, j;
+
+  sels[0] = ucnvsel_open(encodings, UPRV_LENGTHOF(encodings), NULL, UCNV_ROUNDTRIP_SET, &status);
+  sels[1] = ucnvsel_open(encodings, UPRV_LENGTHOF(encodings), lower, UCNV_ROUNDTRIP_SET, &status);
+  uset_close(lower);
+  if (U_FAILURE(status)) {
+    log_data_err("ucnvsel_open() failed - %s\n", u_errorName(status));
+    ucnvsel_close(sels[0]);
+    return;
+  }
+  for (i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+    UChar utf16[100];
+    int32_t length16;
+    u_strFromUTF8(utf16, UPRV_LENGTHOF(utf16), &length16, cases[i].utf8, -1, &status);
+    for (j = 0; j < 2; ++j) {
+      int32_t expected = j == 0 ? cases[i].count : cases[i].countExcludingLower;
+      UEnumeration *e8 = ucnvsel_selectForUTF8(sels[j], cases[i].utf8, -1, &status);
+      UEnumeration *e16 = ucnvsel_selectForString(sels[j], utf16, length16, &status);
+      int32_t count8 = uenum_count(e8, &status);
+      int32_t count16 = uenum_count(e16, &status);
+      if (U_FAILURE(status) || count8 != expected || count16 != expected) {
+        log_err("case %d selector %d: %d encodings for UTF-8, %d for UTF-16, expected %d - %s\n",
+                (int)i, (int)j, (int)count8, (int)count16, (int)expected, u_errorName(status));
+      }
+      uenum_close(e8);
+      uenum_close(e16);
+    }
+  }
+  ucnvsel_close(sels[0]);
+  ucnvsel_close(sels[1]);
+}
+
 /* Improve code coverage of UPropsVectors */
 static void TestUPropsVector() {
     UErrorCode errorCode = U_ILLEGAL_ARGUMENT_ERROR;
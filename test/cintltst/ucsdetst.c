@@ -31,6 +31,9 @@ static void TestChaining(void);
 static void TestBufferOverflow(void);
 static void TestIBM424(void);
 static void TestIBM420(void);
+static void TestStopConfidence(void);
+static void TestSampleLength(void);
+static void TestDetectBatch(void);
 
 void addUCsdetTest(TestNode** root);
 
@@ -43,6 +46,9 @@ void addUCsdetTest(TestNode** root)
     addTest(root, &TestInputFilter, "ucsdetst/TestInputFilter");
     addTest(root, &TestChaining, "ucsdetst/TestErrorChaining");
     addTest(root, &TestBufferOverflow, "ucsdetst/TestBufferOverflow");
+    addTest(root, &TestStopConfidence, "ucsdetst/TestStopConfidence");
+    addTest(root, &TestSampleLength, "ucsdetst/TestSampleLength");
+    addTest(root, &TestDetectBatch, "ucsdetst/TestDetectBatch");
 #if !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestIBM424, "ucsdetst/TestIBM424");
     addTest(root, &TestIBM420, "ucsdetst/TestIBM420");
@@ -589,3 +595,190 @@ static void TestIBM420(void)
     freeBytes(bytes_r);
     ucsdet_close(csd);
 }
+
+static void TestStopConfidence(void)
+{
+    /* UTF-8 with several multi-byte characters: confidence 100 */
+    static const char utf8[] = "Gr\xC3\xBC\xC3\x9F" "e aus K\xC3\xB6ln, \xCE\x91\xCE\x92\xCE\x93 und so weiter.";
+    /* UTF-16LE with a BOM */
+    static const char utf16[] = "\xFF\xFEH\0e\0l\0l\0o\0,\0 \0w\0o\0r\0l\0d\0";
+    UErrorCode status = U_ZERO_ERROR;
+    UCharsetDetector *csd = ucsdet_open(&status);
+    const UCharsetMatch **matches;
+    int32_t count = 0, i;
+
+    ucsdet_setText(csd, utf8, -1, &status);
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count < 2) {
+        log_data_err("ucsdet_detectAll(UTF-8) found %d matches - %s\n", (int)count, u_errorName(status));
+        goto bail;
+    }
+
+    ucsdet_setStopConfidence(csd, 100, &status);
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count != 1 ||
+            strcmp(ucsdet_getName(matches[0], &status), "UTF-8") != 0 ||
+            ucsdet_getConfidence(matches[0], &status) != 100) {
+        log_err("ucsdet_detectAll(UTF-8) with stop confidence 100 did not stop at UTF-8 - %s\n",
+                u_errorName(status));
+    }
+
+    /* With a BOM, only the Unicode charsets are tried. */
+    ucsdet_setStopConfidence(csd, 50, &status);
+    ucsdet_setText(csd, utf16, (int32_t)sizeof(utf16) - 1, &status);
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count < 1 ||
+            strcmp(ucsdet_getName(matches[0], &status), "UTF-16LE") != 0) {
+        log_err("ucsdet_detectAll(UTF-16LE with BOM) with stop confidence 50 failed - %s\n",
+                u_errorName(status));
+    }
+    for (i = 0; i < count; ++i) {
+        if (strncmp(ucsdet_getName(matches[i], &status), "UTF-", 4) != 0) {
+            log_err("ucsdet_detectAll(UTF-16LE with BOM) with stop confidence 50 tried %s\n",
+                    ucsdet_getName(matches[i], &status));
+        }
+    }
+
+    /* 0 turns early termination off again. */
+    ucsdet_setStopConfidence(csd, 0, &status);
+    ucsdet_setText(csd, utf8, -1, &status);
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count < 2) {
+        log_err("ucsdet_detectAll(UTF-8) after stop confidence 0 found %d matches - %s\n",
+                (int)count, u_errorName(status));
+    }
+
+    ucsdet_setStopConfidence(csd, 101, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucsdet_setStopConfidence(101) did not fail - %s\n", u_errorName(status));
+    }
+
+bail:
+    ucsdet_close(csd);
+}
+
+static void TestSampleLength(void)
+{
+    /* English ASCII text followed by Japanese in Shift-JIS */
+    static const char text[] =
+        "This is a sample of plain English text that is long enough for the detector to "
+        "look at, followed by bytes that are not valid UTF-8 at all: "
+        "\x93\xfa\x96\x7b\x8c\xea\x82\xcc\x83\x65\x83\x4c\x83\x58\x83\x67\x82\xc5\x82\xb7\x81\x42"
+        "\x93\xfa\x96\x7b\x8c\xea\x82\xcc\x83\x65\x83\x4c\x83\x58\x83\x67\x82\xc5\x82\xb7\x81\x42";
+    UErrorCode status = U_ZERO_ERROR;
+    UCharsetDetector *csd = ucsdet_open(&status);
+    const UCharsetMatch **matches;
+    const char *names[30];
+    int32_t confidences[30];
+    UChar uchars[300];
+    int32_t count = 0, prefixCount = 0, prefixLength, length, i;
+
+    /* the results for the prefix on its own */
+    prefixLength = (int32_t)(strchr(text, 0x93) - text);
+    ucsdet_setText(csd, text, prefixLength, &status);
+    matches = ucsdet_detectAll(csd, &prefixCount, &status);
+    if (U_FAILURE(status) || prefixCount > UPRV_LENGTHOF(names)) {
+        log_data_err("ucsdet_detectAll(prefix) failed - %s\n", u_errorName(status));
+        goto bail;
+    }
+    for (i = 0; i < prefixCount; ++i) {
+        names[i] = ucsdet_getName(matches[i], &status);
+        confidences[i] = ucsdet_getConfidence(matches[i], &status);
+    }
+
+    /* must be the same as for the whole text with a sample length limit */
+    ucsdet_setText(csd, text, -1, &status);
+    ucsdet_setSampleLength(csd, prefixLength, &status);
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count != prefixCount) {
+        log_err("ucsdet_detectAll(limited to prefix) found %d instead of %d matches - %s\n",
+                (int)count, (int)prefixCount, u_errorName(status));
+        goto bail;
+    }
+    for (i = 0; i < count; ++i) {
+        if (strcmp(ucsdet_getName(matches[i], &status), names[i]) != 0 ||
+                ucsdet_getConfidence(matches[i], &status) != confidences[i]) {
+            log_err("ucsdet_detectAll(limited to prefix) match %d is %s/%d instead of %s/%d\n",
+                    (int)i, ucsdet_getName(matches[i], &status),
+                    (int)ucsdet_getConfidence(matches[i], &status),
+                    names[i], (int)confidences[i]);
+        }
+    }
+
+    /* the conversion is not limited */
+    if (count > 0) {
+        length = ucsdet_getUChars(matches[0], uchars, UPRV_LENGTHOF(uchars), &status);
+        if (U_FAILURE(status) || length <= prefixLength) {
+            log_err("ucsdet_getUChars(limited to prefix) returned only %d UChars - %s\n",
+                    (int)length, u_errorName(status));
+        }
+    }
+
+    /* without the limit, UTF-8 no longer matches well */
+    ucsdet_setSampleLength(csd, 0, &status);
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count < 1 ||
+            strcmp(ucsdet_getName(matches[0], &status), "Shift_JIS") != 0) {
+        log_err("ucsdet_detectAll(all of the input) did not find Shift_JIS - %s\n",
+                u_errorName(status));
+    }
+
+    ucsdet_setSampleLength(csd, -1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucsdet_setSampleLength(-1) did not fail - %s\n", u_errorName(status));
+    }
+
+bail:
+    ucsdet_close(csd);
+}
+
+static void TestDetectBatch(void)
+{
+    static const char *const texts[] = {
+        "Gr\xC3\xBC\xC3\x9F" "e aus K\xC3\xB6ln, \xCE\x91\xCE\x92\xCE\x93 und so weiter.",
+        "\x1b\x24\x28\x44",
+        "\xa1",
+        "\x74\x68\x65\xa1",
+        "Plain ASCII text."
+    };
+    static const int32_t lengths[] = { -1, -1, -1, -1, 8 };
+    const char *names[UPRV_LENGTHOF(texts)];
+    int32_t confidences[UPRV_LENGTHOF(texts)];
+    UErrorCode status = U_ZERO_ERROR;
+    UCharsetDetector *csd = ucsdet_open(&status);
+    const UCharsetMatch *match;
+    const char *name;
+    int32_t i;
+
+    ucsdet_detectBatch(csd, texts, lengths, UPRV_LENGTHOF(texts), names, confidences, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ucsdet_detectBatch() failed - %s\n", u_errorName(status));
+        goto bail;
+    }
+    for (i = 0; i < UPRV_LENGTHOF(texts); ++i) {
+        ucsdet_setText(csd, texts[i], lengths[i], &status);
+        match = ucsdet_detect(csd, &status);
+        name = match != NULL ? ucsdet_getName(match, &status) : NULL;
+        if ((name == NULL) != (names[i] == NULL) ||
+                (name != NULL && (strcmp(name, names[i]) != 0 ||
+                                  ucsdet_getConfidence(match, &status) != confidences[i]))) {
+            log_err("ucsdet_detectBatch() text %d: got %s/%d instead of %s\n",
+                    (int)i, names[i] != NULL ? names[i] : "(none)", (int)confidences[i],
+                    name != NULL ? name : "(none)");
+        }
+    }
+
+    /* confidences can be NULL */
+    ucsdet_detectBatch(csd, texts, lengths, 1, names, NULL, &status);
+    if (U_FAILURE(status) || names[0] == NULL || strcmp(names[0], "UTF-8") != 0) {
+        log_err("ucsdet_detectBatch(confidences=NULL) failed - %s\n", u_errorName(status));
+    }
+
+    ucsdet_detectBatch(csd, texts, lengths, -1, names, confidences, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucsdet_detectBatch(count=-1) did not fail - %s\n", u_errorName(status));
+    }
+
+bail:
+    ucsdet_close(csd);
+}
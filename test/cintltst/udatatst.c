@@ -28,6 +28,7 @@
 #include "cstring.h"
 #include "filestrm.h"
 #include "udatamem.h"
+#include "ucmpdata.h"
 #include "cintltst.h"
 #include "ubrkimpl.h"
 #include "toolutil.h" /* for uprv_fileExists() */
@@ -73,6 +74,9 @@ static void TestICUDataName(void);
 static void PointerTableOfContents(void);
 static void SetBadCommonData(void);
 static void TestUDataFileAccess(void);
+static void TestPrefetchLocales(void);
+static void TestTOCHashIndex(void);
+static void TestCompressedItems(void);
 #if !UCONFIG_NO_FORMATTING && !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
 static void TestTZDataDir(void); 
 #endif
@@ -97,6 +101,9 @@ addUDataTest(TestNode** root)
     addTest(root, &PointerTableOfContents, "udatatst/PointerTableOfContents" );
     addTest(root, &SetBadCommonData, "udatatst/SetBadCommonData" );
     addTest(root, &TestUDataFileAccess, "udatatst/TestUDataFileAccess" );
+    addTest(root, &TestPrefetchLocales, "udatatst/TestPrefetchLocales" );
+    addTest(root, &TestTOCHashIndex, "udatatst/TestTOCHashIndex" );
+    addTest(root, &TestCompressedItems, "udatatst/TestCompressedItems" );
 #if !UCONFIG_NO_FORMATTING && !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestTZDataDir, "udatatst/TestTZDataDir" );
 #endif
@@ -1192,6 +1199,228 @@ static void TestICUDataName()
 
 }
 
+static void TestPrefetchLocales() {
+    static const char *const locales[] = { "de_CH", "zh_Hant_TW@collation=stroke", NULL, "root" };
+    UErrorCode status = U_ZERO_ERROR;
+    UResourceBundle *rb;
+
+    udata_prefetchLocales(locales, UPRV_LENGTHOF(locales), &status);
+    if (U_FAILURE(status)) {
+        log_err("udata_prefetchLocales() failed - %s\n", u_errorName(status));
+    }
+    udata_prefetchLocales(NULL, 0, &status);
+    if (U_FAILURE(status)) {
+        log_err("udata_prefetchLocales(NULL, 0) failed - %s\n", u_errorName(status));
+    }
+
+    /* The prefetched data is unchanged. */
+    rb = ures_open(NULL, "de_CH", &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ures_open(de_CH) after udata_prefetchLocales() failed - %s\n", u_errorName(status));
+    }
+    ures_close(rb);
+
+    status = U_ZERO_ERROR;
+    udata_prefetchLocales(NULL, 1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("udata_prefetchLocales(NULL, 1) did not fail with U_ILLEGAL_ARGUMENT_ERROR - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    udata_prefetchLocales(locales, -1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("udata_prefetchLocales(count=-1) did not fail with U_ILLEGAL_ARGUMENT_ERROR - %s\n", u_errorName(status));
+    }
+    status = U_INVALID_FORMAT_ERROR;
+    udata_prefetchLocales(locales, UPRV_LENGTHOF(locales), &status);
+    if (status != U_INVALID_FORMAT_ERROR) {
+        log_err("udata_prefetchLocales() overwrote an incoming failure - %s\n", u_errorName(status));
+    }
+}
+
+static void TestTOCHashIndex() {
+    /*
+     * The entries are deliberately not sorted,
+     * so that a binary search would not find item1.
+     */
+    static const char *const names[] = {
+        "TOCHashAppData/item2", "TOCHashAppData/item1", "TOCHashAppData/a/b", "TOCHashAppData/zz"
+    };
+    static const DataHeader item = {
+        { 32, 0xda, 0x27 },
+        {
+            sizeof(UDataInfo), 0,
+            U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, sizeof(UChar), 0,
+            {0x31, 0x31, 0x31, 0x31},   /* dataFormat="1111" */
+            {0, 0, 0, 0},               /* formatVersion */
+            {0, 0, 0, 0}                /* dataVersion */
+        }
+    };
+    static uint32_t buffer[96];
+    uint8_t *bytes = (uint8_t *)buffer;
+    UDataOffsetTOC *toc = (UDataOffsetTOC *)(bytes + 32);
+    int32_t count = UPRV_LENGTHOF(names);
+    int32_t hashIndexSize = udata_getTOCHashIndexSize(count);
+    uint32_t nameOffset = 4 + 8 * count + hashIndexSize;
+    uint32_t dataOffset;
+    UErrorCode status = U_ZERO_ERROR;
+    UDataMemory *dataItem;
+    int32_t i;
+
+    if (hashIndexSize != 8 + 2 * 8) {
+        log_err("udata_getTOCHashIndexSize(4)=%d, expected 24\n", (int)hashIndexSize);
+        return;
+    }
+    if (udata_getTOCHashIndexSize(0) != 0 || udata_getTOCHashIndexSize(0x10000) != 0) {
+        log_err("udata_getTOCHashIndexSize() should return 0 for 0 or too many items\n");
+    }
+
+    /* A package like one written by icupkg --toc_hash. */
+    uprv_memset(buffer, 0, sizeof(buffer));
+    uprv_memcpy(bytes, &gEmptyHeader, 32);
+    toc->count = count;
+    for (i = 0; i < count; ++i) {
+        toc->entry[i].nameOffset = nameOffset;
+        uprv_strcpy((char *)toc + nameOffset, names[i]);
+        nameOffset += (uint32_t)uprv_strlen(names[i]) + 1;
+    }
+    dataOffset = (nameOffset + 15) & ~15;
+    for (i = 0; i < count; ++i) {
+        toc->entry[i].dataOffset = dataOffset;
+        uprv_memcpy((char *)toc + dataOffset, &item, sizeof(item));
+        dataOffset += 32;
+    }
+    udata_buildTOCHashIndex(names, count, (UDataTOCHashIndex *)(toc->entry + count));
+
+    udata_setAppData("TOCHashAppData", buffer, &status);
+    if (U_FAILURE(status)) {
+        log_err("udata_setAppData(TOCHashAppData) failed - %s\n", u_errorName(status));
+        return;
+    }
+    dataItem = udata_open("TOCHashAppData", "", "item1", &status);
+    if (U_FAILURE(status) || udata_getMemory(dataItem) != (const char *)toc + toc->entry[1].dataOffset + 32) {
+        log_err("FAIL: item1 in the hashed TOC was not found - %s\n", u_errorName(status));
+    }
+    udata_close(dataItem);
+    status = U_ZERO_ERROR;
+    dataItem = udata_open("TOCHashAppData", "", "item2", &status);
+    if (U_FAILURE(status) || udata_getMemory(dataItem) != (const char *)toc + toc->entry[0].dataOffset + 32) {
+        log_err("FAIL: item2 in the hashed TOC was not found - %s\n", u_errorName(status));
+    }
+    udata_close(dataItem);
+    status = U_ZERO_ERROR;
+    dataItem = udata_open("TOCHashAppData-a", "", "b", &status);
+    if (U_FAILURE(status) || udata_getMemory(dataItem) != (const char *)toc + toc->entry[2].dataOffset + 32) {
+        log_err("FAIL: a/b in the hashed TOC was not found - %s\n", u_errorName(status));
+    }
+    udata_close(dataItem);
+    status = U_ZERO_ERROR;
+    dataItem = udata_open("TOCHashAppData", "", "item3", &status);
+    if (U_SUCCESS(status)) {
+        log_err("FAIL: item3 should not be found in the hashed TOC\n");
+        udata_close(dataItem);
+    }
+}
+
+static void TestCompressedItems() {
+    static const char *const name = "CmpAppData/item";
+    static uint32_t original[256], buffer[512];
+    uint8_t *item = (uint8_t *)original;
+    uint8_t *bytes = (uint8_t *)buffer;
+    uint8_t decompressed[1024];
+    UDataOffsetTOC *toc = (UDataOffsetTOC *)(bytes + 32);
+    const uint8_t *compressed;
+    int32_t itemLength = (int32_t)sizeof(original), length, compressedLength, uncompressedLength;
+    uint32_t dataOffset;
+    UErrorCode status = U_ZERO_ERROR;
+    UDataMemory *dataItem, *dataItem2;
+    int32_t i;
+
+    /* An item with repetitive contents, like much of ICU data. */
+    uprv_memcpy(item, &gEmptyHeader, 32);
+    item[12] = 0x31;    /* dataFormat="1111" */
+    item[13] = 0x31;
+    item[14] = 0x31;
+    item[15] = 0x31;
+    for (i = 32; i < itemLength; ++i) {
+        item[i] = (uint8_t)(i < 128 ? i * 7 : i % 11);
+    }
+
+    /* A package like one written by icupkg --compress. */
+    uprv_memset(buffer, 0, sizeof(buffer));
+    uprv_memcpy(bytes, &gEmptyHeader, 32);
+    toc->count = 1;
+    toc->entry[0].nameOffset = 4 + 8;
+    uprv_strcpy((char *)toc + toc->entry[0].nameOffset, name);
+    dataOffset = (toc->entry[0].nameOffset + (uint32_t)uprv_strlen(name) + 1 + 15) & ~15;
+    toc->entry[0].dataOffset = dataOffset;
+    length = ucmpdata_compressItem(item, itemLength, (uint8_t *)toc + dataOffset,
+                                   (int32_t)sizeof(buffer) - 32 - (int32_t)dataOffset, &status);
+    if (U_FAILURE(status) || length <= 0 || length >= itemLength / 2 || (length & 15) != 0) {
+        log_err("ucmpdata_compressItem() failed or did not compress well: length %d - %s\n",
+                (int)length, u_errorName(status));
+        return;
+    }
+    compressed = ucmpdata_getCompressedBytes((const DataHeader *)((uint8_t *)toc + dataOffset), length,
+                                             &compressedLength, &uncompressedLength, &status);
+    if (U_FAILURE(status) || compressed == NULL || uncompressedLength != itemLength) {
+        log_err("ucmpdata_getCompressedBytes() failed - %s\n", u_errorName(status));
+        return;
+    }
+    if (ucmpdata_decompress(compressed, compressedLength, decompressed, (int32_t)sizeof(decompressed),
+                            &status) != itemLength ||
+            U_FAILURE(status) || uprv_memcmp(decompressed, item, itemLength) != 0) {
+        log_err("ucmpdata_decompress() did not restore the item - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ucmpdata_decompress(compressed, compressedLength - 1, decompressed, (int32_t)sizeof(decompressed), &status);
+    if (status != U_INVALID_FORMAT_ERROR) {
+        log_err("ucmpdata_decompress(truncated) did not fail with U_INVALID_FORMAT_ERROR - %s\n",
+                u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ucmpdata_decompress(compressed, compressedLength, decompressed, itemLength - 1, &status);
+    if (status != U_INVALID_FORMAT_ERROR) {
+        log_err("ucmpdata_decompress(too small) did not fail with U_INVALID_FORMAT_ERROR - %s\n",
+                u_errorName(status));
+    }
+
+    status = U_ZERO_ERROR;
+    udata_setAppData("CmpAppData", buffer, &status);
+    if (U_FAILURE(status)) {
+        log_err("udata_setAppData(CmpAppData) failed - %s\n", u_errorName(status));
+        return;
+    }
+    dataItem = udata_open("CmpAppData", "", "item", &status);
+    dataItem2 = udata_open("CmpAppData", "", "item", &status);
+    if (U_FAILURE(status)) {
+        log_err("FAIL: the compressed item was not opened - %s\n", u_errorName(status));
+        return;
+    }
+    if (udata_getLength(dataItem) != itemLength - 32 ||
+            uprv_memcmp(udata_getMemory(dataItem), item + 32, itemLength - 32) != 0) {
+        log_err("FAIL: the opened item differs from the original one\n");
+    }
+    if (udata_getMemory(dataItem) != udata_getMemory(dataItem2)) {
+        log_err("FAIL: the two open copies of the item were decompressed separately\n");
+    }
+    udata_close(dataItem);
+    udata_close(dataItem2);
+
+    /* Free the decompressed item, and decompress it again. */
+    udata_setDecompressedCacheCapacity(0, &status);
+    dataItem = udata_open("CmpAppData", "", "item", &status);
+    if (U_FAILURE(status) || uprv_memcmp(udata_getMemory(dataItem), item + 32, itemLength - 32) != 0) {
+        log_err("FAIL: the compressed item was not decompressed again - %s\n", u_errorName(status));
+    }
+    udata_close(dataItem);
+    udata_setDecompressedCacheCapacity(0x100000, &status);
+    udata_setDecompressedCacheCapacity(-1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("udata_setDecompressedCacheCapacity(-1) did not fail with U_ILLEGAL_ARGUMENT_ERROR - %s\n",
+                u_errorName(status));
+    }
+}
+
 /* test data swapping ------------------------------------------------------- */
 
 #if U_PLATFORM == U_PF_OS400
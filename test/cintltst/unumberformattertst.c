@@ -12,6 +12,7 @@
 #include "unicode/unumberformatter.h"
 #include "unicode/umisc.h"
 #include "unicode/unum.h"
+#include "unicode/ustring.h"
 #include "cintltst.h"
 #include "cmemory.h"
 
@@ -21,12 +22,15 @@ static void TestSkeletonFormatToFields(void);
 
 static void TestExampleCode(void);
 
+static void TestFormatDoubleBatch(void);
+
 void addUNumberFormatterTest(TestNode** root);
 
 void addUNumberFormatterTest(TestNode** root) {
     addTest(root, &TestSkeletonFormatToString, "unumberformatter/TestSkeletonFormatToString");
     addTest(root, &TestSkeletonFormatToFields, "unumberformatter/TestSkeletonFormatToFields");
     addTest(root, &TestExampleCode, "unumberformatter/TestExampleCode");
+    addTest(root, &TestFormatDoubleBatch, "unumberformatter/TestFormatDoubleBatch");
 }
 
 
@@ -187,4 +191,38 @@ static void TestExampleCode() {
 }
 
 
+static void TestFormatDoubleBatch() {
+    static const double values[] = { 1234.5, -0.25, 0, 1e9 };
+    static const UChar expected[] = u"1,234.5-0.2501,000,000,000";
+    UErrorCode ec = U_ZERO_ERROR;
+    UChar buffer[CAPACITY];
+    int32_t offsets[UPRV_LENGTHOF(values) + 1];
+    int32_t length;
+    UNumberFormatter* f = unumf_openForSkeletonAndLocale(u"", -1, "en", &ec);
+    assertSuccessCheck("Should create without error", &ec, TRUE);
+
+    length = unumf_formatDoubleBatch(f, values, UPRV_LENGTHOF(values), buffer, CAPACITY, offsets, &ec);
+    if (assertSuccessCheck("Should format the batch without error", &ec, TRUE)) {
+        assertIntEquals("Total length", u_strlen(expected), length);
+        assertUEquals("Should produce the results one after the other", expected, buffer);
+        assertIntEquals("Offset of the second result", 7, offsets[1]);
+        assertIntEquals("Offset of the third result", 12, offsets[2]);
+        assertIntEquals("Offset of the fourth result", 13, offsets[3]);
+        assertIntEquals("Offset after the last result", length, offsets[4]);
+
+        // Preflighting:
+        uprv_memset(offsets, 0, sizeof(offsets));
+        assertIntEquals("Preflighting", length,
+                        unumf_formatDoubleBatch(f, values, UPRV_LENGTHOF(values), NULL, 0, offsets, &ec));
+        assertTrue("Preflighting error", ec == U_BUFFER_OVERFLOW_ERROR);
+        assertIntEquals("Offsets while preflighting", 12, offsets[2]);
+        ec = U_ZERO_ERROR;
+        unumf_formatDoubleBatch(f, values, -1, buffer, CAPACITY, offsets, &ec);
+        assertTrue("Negative count", ec == U_ILLEGAL_ARGUMENT_ERROR);
+    }
+
+    unumf_close(f);
+}
+
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
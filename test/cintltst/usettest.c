@@ -18,6 +18,7 @@
 static void TestAPI(void);
 static void Testj2269(void);
 static void TestSerialized(void);
+static void TestOpenRanges(void);
 static void TestNonInvariantPattern(void);
 static void TestBadPattern(void);
 static void TestFreezable(void);
@@ -41,6 +42,7 @@ addUSetTest(TestNode** root) {
     TEST(TestAPI);
     TEST(Testj2269);
     TEST(TestSerialized);
+    TEST(TestOpenRanges);
     TEST(TestNonInvariantPattern);
     TEST(TestBadPattern);
     TEST(TestFreezable);
@@ -508,6 +510,40 @@ TestSerialized() {
         }
     }
 
+    /* round-trip through the serialized form without a pattern */
+    {
+        USet *copy=uset_openSerialized(&sset, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("uset_openSerialized([:Cf:]) failed - %s\n", u_errorName(errorCode));
+        } else if(!uset_equals(set, copy)) {
+            log_err("uset_openSerialized([:Cf:]) != [:Cf:]\n");
+        }
+        uset_close(copy);
+    }
+
+    uset_close(set);
+}
+
+static void
+TestOpenRanges() {
+    static const UChar32 ranges[]={ 0x41, 0x5a, 0x5b, 0x5b, 0x61, 0x7a, 0x10fffe, 0x10ffff };
+    static const UChar32 badRanges[]={ 0x61, 0x7a, 0x41, 0x5a };
+    UErrorCode errorCode=U_ZERO_ERROR;
+    USet *set=uset_openRanges(ranges, UPRV_LENGTHOF(ranges), &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("uset_openRanges() failed - %s\n", u_errorName(errorCode));
+        return;
+    }
+    if(uset_getItemCount(set)!=3 || uset_size(set)!=(27+26+2) ||
+            !uset_contains(set, 0x5b) || !uset_contains(set, 0x10ffff) || uset_contains(set, 0x60)) {
+        log_err("uset_openRanges() returned the wrong set\n");
+    }
+    uset_close(set);
+
+    set=uset_openRanges(badRanges, UPRV_LENGTHOF(badRanges), &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR || set!=NULL) {
+        log_err("uset_openRanges(out of order) did not fail - %s\n", u_errorName(errorCode));
+    }
     uset_close(set);
 }
 
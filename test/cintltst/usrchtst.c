@@ -14,6 +14,7 @@
 
 #if !UCONFIG_NO_COLLATION && !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_FILE_IO
 
+#include "unicode/uchar.h"
 #include "unicode/usearch.h"
 #include "unicode/ustring.h"
 #include "ccolltst.h"
@@ -3005,6 +3006,224 @@ static void TestIndicPrefixMatch(void)
     close();
 }
 
+/*
+ * Long texts with many near matches, so that forward searching with the
+ * standard element comparison skips candidate starts by the last CE of each
+ * window. The matches must be exactly those of a brute-force scan.
+ */
+static void TestLongTextShift(void)
+{
+    static const UChar letters[] = { 0x61, 0x62, 0x63, 0x41, 0x42 }; /* abcAB */
+    UChar text[1200];
+    UChar pattern[8];
+    int32_t expected[1200];
+    uint32_t seed = 1;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("", &status);
+    int32_t iter;
+
+    if (U_FAILURE(status)) {
+        log_data_err("ucol_open(root) failed - %s\n", u_errorName(status));
+        return;
+    }
+    for (iter = 0; iter < 40 && U_SUCCESS(status); iter++) {
+        int32_t textLength = 300 + 20 * iter;
+        int32_t patternLength = 2 + iter % 6;
+        int32_t letterCount = iter % 2 == 0 ? 2 : UPRV_LENGTHOF(letters);
+        int32_t i, j, strength;
+        for (i = 0; i < textLength; i++) {
+            seed = seed * 1103515245 + 12345;
+            text[i] = letters[(seed >> 16) % letterCount];
+        }
+        for (i = 0; i < patternLength; i++) {
+            seed = seed * 1103515245 + 12345;
+            pattern[i] = letters[(seed >> 16) % 2];
+        }
+        for (strength = 0; strength < 2; strength++) {
+            UStringSearch *strsrch;
+            int32_t expectedCount = 0, count = 0, match;
+            ucol_setStrength(coll, strength == 0 ? UCOL_TERTIARY : UCOL_SECONDARY);
+            for (i = 0; i + patternLength <= textLength; i++) {
+                for (j = 0; j < patternLength; j++) {
+                    UChar t = text[i + j], p = pattern[j];
+                    if (strength == 1) {
+                        t = (UChar)u_tolower(t);
+                        p = (UChar)u_tolower(p);
+                    }
+                    if (t != p) {
+                        break;
+                    }
+                }
+                if (j == patternLength) {
+                    expected[expectedCount++] = i;
+                }
+            }
+            strsrch = usearch_openFromCollator(pattern, patternLength, text, textLength,
+                                               coll, NULL, &status);
+            usearch_setAttribute(strsrch, USEARCH_OVERLAP, USEARCH_ON, &status);
+            for (match = usearch_first(strsrch, &status);
+                    match != USEARCH_DONE && U_SUCCESS(status);
+                    match = usearch_next(strsrch, &status)) {
+                if (count >= expectedCount || expected[count] != match) {
+                    log_err("Text %d strength %d: unexpected match at %d\n", iter, strength, match);
+                    break;
+                }
+                ++count;
+            }
+            if (U_FAILURE(status)) {
+                log_err("Text %d strength %d: search failed - %s\n", iter, strength, u_errorName(status));
+            } else if (match == USEARCH_DONE && count != expectedCount) {
+                log_err("Text %d strength %d: found %d matches instead of %d\n",
+                        iter, strength, count, expectedCount);
+            }
+            usearch_close(strsrch);
+        }
+    }
+    ucol_close(coll);
+}
+
+static int32_t findAllSingle(const UChar *pattern, const UChar *text, const UCollator *coll,
+                             int32_t patternIndex, UMultiSearchMatch *matches, int32_t count,
+                             UErrorCode *status)
+{
+    UStringSearch *strsrch = usearch_openFromCollator(pattern, -1, text, -1, coll, NULL, status);
+    int32_t match;
+    usearch_setAttribute(strsrch, USEARCH_OVERLAP, USEARCH_ON, status);
+    for (match = usearch_first(strsrch, status);
+            match != USEARCH_DONE && U_SUCCESS(*status);
+            match = usearch_next(strsrch, status)) {
+        matches[count].patternIndex = patternIndex;
+        matches[count].start = match;
+        matches[count].limit = match + usearch_getMatchedLength(strsrch);
+        ++count;
+    }
+    usearch_close(strsrch);
+    return count;
+}
+
+static UBool containsMatch(const UMultiSearchMatch *matches, int32_t count,
+                           const UMultiSearchMatch *match)
+{
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        if (matches[i].patternIndex == match->patternIndex &&
+                matches[i].start == match->start && matches[i].limit == match->limit) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static void TestMultiPattern(void)
+{
+    static const char *const patternStrings[] = {
+        "abc", "ab", "b", "bca", "abc", "cab", "resume", "\\u00e9", "\\u00df", "ss"
+    };
+    static const char *const textStrings[] = {
+        "xabcabcab ab bca",
+        "R\\u00e9sum\\u00e9 resume RESUME re\\u0301sume\\u0301",
+        "Stra\\u00dfe strasse \\u00e9 \\u00e8 e\\u0301 ABC \\u00e0bc",
+        "ab\\u0107 cab ca\\u0308b"
+    };
+    static const UCollationStrength strengths[] = { UCOL_TERTIARY, UCOL_PRIMARY, UCOL_IDENTICAL };
+    UChar patternBuffers[UPRV_LENGTHOF(patternStrings)][16];
+    UChar textBuffers[UPRV_LENGTHOF(textStrings)][64];
+    const UChar *patterns[UPRV_LENGTHOF(patternStrings)];
+    const UChar *texts[UPRV_LENGTHOF(textStrings)];
+    UMultiSearchMatch expected[100], actual[100];
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("en", &status);
+    int32_t s, t, p, i;
+
+    if (U_FAILURE(status)) {
+        log_data_err("ucol_open(en) failed - %s\n", u_errorName(status));
+        return;
+    }
+    for (p = 0; p < UPRV_LENGTHOF(patternStrings); p++) {
+        u_unescape(patternStrings[p], patternBuffers[p], UPRV_LENGTHOF(patternBuffers[p]));
+        patterns[p] = patternBuffers[p];
+    }
+    for (t = 0; t < UPRV_LENGTHOF(textStrings); t++) {
+        u_unescape(textStrings[t], textBuffers[t], UPRV_LENGTHOF(textBuffers[t]));
+        texts[t] = textBuffers[t];
+    }
+    for (s = 0; s < UPRV_LENGTHOF(strengths); s++) {
+        UMultiStringSearch *msrch;
+        ucol_setStrength(coll, strengths[s]);
+        msrch = usearch_openMulti(patterns, NULL, UPRV_LENGTHOF(patterns), coll, &status);
+        if (U_FAILURE(status)) {
+            log_err("usearch_openMulti(strength %d) failed - %s\n", strengths[s], u_errorName(status));
+            break;
+        }
+        for (t = 0; t < UPRV_LENGTHOF(texts); t++) {
+            int32_t expectedCount = 0, count;
+            for (p = 0; p < UPRV_LENGTHOF(patterns) && U_SUCCESS(status); p++) {
+                expectedCount = findAllSingle(patterns[p], texts[t], coll, p,
+                                              expected, expectedCount, &status);
+            }
+            count = usearch_findAllMulti(msrch, texts[t], -1, actual, UPRV_LENGTHOF(actual), &status);
+            if (U_FAILURE(status)) {
+                log_err("Strength %d text %d: search failed - %s\n", strengths[s], t, u_errorName(status));
+                break;
+            }
+            if (count != expectedCount) {
+                log_err("Strength %d text %d: found %d matches instead of %d\n",
+                        strengths[s], t, count, expectedCount);
+            }
+            for (i = 0; i < count; i++) {
+                if (!containsMatch(expected, expectedCount, &actual[i])) {
+                    log_err("Strength %d text %d: unexpected match of pattern %d at [%d, %d[\n",
+                            strengths[s], t, actual[i].patternIndex, actual[i].start, actual[i].limit);
+                }
+            }
+            for (i = 0; i < expectedCount; i++) {
+                if (!containsMatch(actual, count, &expected[i])) {
+                    log_err("Strength %d text %d: missing match of pattern %d at [%d, %d[\n",
+                            strengths[s], t, expected[i].patternIndex, expected[i].start, expected[i].limit);
+                }
+            }
+
+            /* preflighting */
+            if (count > 0) {
+                UErrorCode preflightStatus = U_ZERO_ERROR;
+                int32_t length = usearch_findAllMulti(msrch, texts[t], -1, NULL, 0, &preflightStatus);
+                if (preflightStatus != U_BUFFER_OVERFLOW_ERROR || length != count) {
+                    log_err("Strength %d text %d: preflighting returned %d - %s\n",
+                            strengths[s], t, length, u_errorName(preflightStatus));
+                }
+            }
+        }
+        usearch_closeMulti(msrch);
+    }
+
+    /* accent-insensitive matching at primary strength */
+    ucol_setStrength(coll, UCOL_PRIMARY);
+    {
+        UMultiStringSearch *msrch = usearch_openMulti(patterns + 6, NULL, 1, coll, &status);
+        int32_t count = usearch_findAllMulti(msrch, texts[1], -1, actual, UPRV_LENGTHOF(actual), &status);
+        if (U_FAILURE(status) || count != 4 || actual[0].start != 0 || actual[0].limit != 6 ||
+                actual[3].start != 21 || actual[3].limit != 29) {
+            log_err("Primary-strength search for \"resume\" found %d matches - %s\n",
+                    count, u_errorName(status));
+        }
+        usearch_closeMulti(msrch);
+    }
+
+    /* a pattern without collation elements is rejected */
+    {
+        static const UChar empty[] = { 0 };
+        const UChar *badPatterns[2];
+        badPatterns[0] = patterns[0];
+        badPatterns[1] = empty;
+        status = U_ZERO_ERROR;
+        if (usearch_openMulti(badPatterns, NULL, 2, coll, &status) != NULL ||
+                status != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("usearch_openMulti() with an empty pattern - %s\n", u_errorName(status));
+        }
+    }
+    ucol_close(coll);
+}
+
 /**
 * addSearchTest
 */
@@ -3068,6 +3287,8 @@ void addSearchTest(TestNode** root)
     addTest(root, &TestPCEBuffer_2surr, "tscoll/usrchtst/TestPCEBuffer/2_dfff");
     addTest(root, &TestMatchFollowedByIgnorables, "tscoll/usrchtst/TestMatchFollowedByIgnorables");
     addTest(root, &TestIndicPrefixMatch, "tscoll/usrchtst/TestIndicPrefixMatch");
+    addTest(root, &TestLongTextShift, "tscoll/usrchtst/TestLongTextShift");
+    addTest(root, &TestMultiPattern, "tscoll/usrchtst/TestMultiPattern");
 }
 
 #endif /* #if !UCONFIG_NO_COLLATION */
@@ -34,6 +34,7 @@ static void TestExtractBetween(void);
 static void TestUnicodeIDs(void);
 static void TestGetRulesAndSourceSet(void);
 static void TestDataVariantsCompounds(void);
+static void TestTransUTF8(void);
 
 static void _expectRules(const char*, const char*, const char*);
 static void _expect(const UTransliterator* trans, const char* cfrom, const char* cto);
@@ -53,6 +54,7 @@ addUTransTest(TestNode** root) {
     TEST(TestUnicodeIDs);
     TEST(TestGetRulesAndSourceSet);
     TEST(TestDataVariantsCompounds);
+    TEST(TestTransUTF8);
 }
 
 /*------------------------------------------------------------------
@@ -702,6 +704,72 @@ static void TestDataVariantsCompounds() {
     }
 }
 
+/**
+ * Test utrans_transUTF8
+ */
+
+typedef struct {
+    const char* transID;
+    const char* src;
+    const char* expected;
+} TransIDUTF8Item;
+
+static const TransIDUTF8Item utf8Items[] = {
+    /* native case mapping, with final sigma */
+    { "Any-Lower",  "ABC \xCE\xA3\xCE\x91\xCE\xA3", "abc \xCF\x83\xCE\xB1\xCF\x82" },
+    { "Any-Upper",  "stra\xC3\x9F", "STRASS" },
+    /* native normalization */
+    { "NFD",        "r\xC3\xA9sum\xC3\xA9", "re\xCC\x81sume\xCC\x81" },
+    { "NFC",        "re\xCC\x81sume\xCC\x81", "r\xC3\xA9sum\xC3\xA9" },
+    /* through UTF-16 */
+    { "[a-c] Any-Upper", "abcdef", "ABCdef" },
+    { "NFD; [:Nonspacing Mark:] Remove; NFC", "r\xC3\xA9sum\xC3\xA9", "resume" },
+    { "Latin-ASCII", "\xC3\x86on \xE2\x80\x9Cx\xE2\x80\x9D", "AEon \"x\"" },
+    { "Any-Lower",  "", "" },
+    { NULL, NULL, NULL }
+};
+
+static void TestTransUTF8() {
+    const TransIDUTF8Item* itemsPtr;
+    for (itemsPtr = utf8Items; itemsPtr->transID != NULL; itemsPtr++) {
+        UErrorCode status = U_ZERO_ERROR;
+        UChar utrid[kUBufMax];
+        char dest[kBBufMax];
+        int32_t length, expectedLength;
+        int32_t utridlen = u_unescape(itemsPtr->transID, utrid, kUBufMax);
+        UTransliterator* utrans = utrans_openU(utrid, utridlen, UTRANS_FORWARD, NULL, 0, NULL, &status);
+        if (U_FAILURE(status)) {
+            log_data_err("FAIL: utrans_openU(%s) failed, error=%s (Are you missing data?)\n", itemsPtr->transID, u_errorName(status));
+            continue;
+        }
+        expectedLength = (int32_t)strlen(itemsPtr->expected);
+        length = utrans_transUTF8(utrans, itemsPtr->src, -1, dest, kBBufMax, &status);
+        if (U_FAILURE(status) || length != expectedLength ||
+                strcmp(dest, itemsPtr->expected) != 0) {
+            log_err("FAIL: utrans_transUTF8(%s, \"%s\") failed, error=%s length=%d\n",
+                    itemsPtr->transID, itemsPtr->src, u_errorName(status), (int)length);
+        }
+
+        /* preflighting */
+        status = U_ZERO_ERROR;
+        length = utrans_transUTF8(utrans, itemsPtr->src, -1, NULL, 0, &status);
+        if (length != expectedLength ||
+                status != (expectedLength == 0 ? U_STRING_NOT_TERMINATED_WARNING : U_BUFFER_OVERFLOW_ERROR)) {
+            log_err("FAIL: utrans_transUTF8(%s, preflighting) error=%s length=%d\n",
+                    itemsPtr->transID, u_errorName(status), (int)length);
+        }
+
+        /* ill-formed UTF-8 */
+        status = U_ZERO_ERROR;
+        utrans_transUTF8(utrans, "a\xFF" "b", -1, dest, kBBufMax, &status);
+        if (status != U_INVALID_CHAR_FOUND) {
+            log_err("FAIL: utrans_transUTF8(%s, ill-formed) error=%s instead of U_INVALID_CHAR_FOUND\n",
+                    itemsPtr->transID, u_errorName(status));
+        }
+        utrans_close(utrans);
+    }
+}
+
 static void _expectRules(const char* crules,
                   const char* cfrom,
                   const char* cto) {
@@ -67,6 +67,7 @@ void AlphabeticIndexTest::runIndexedTest( int32_t index, UBool exec, const char*
     TESTCASE_AUTO(TestChineseZhuyin);
     TESTCASE_AUTO(TestJapaneseKanji);
     TESTCASE_AUTO(TestChineseUnihan);
+    TESTCASE_AUTO(TestGetBucketIndices);
     TESTCASE_AUTO(testHasBuckets);
     TESTCASE_AUTO_END;
 }
@@ -726,6 +727,58 @@ void AlphabeticIndexTest::TestChineseUnihan() {
     assertEquals("getBucketIndex(U+7527)", 101, bucketIndex);
 }
 
+void AlphabeticIndexTest::TestGetBucketIndices() {
+    IcuTestErrorCode errorCode(*this, "TestGetBucketIndices");
+    AlphabeticIndex index(Locale::getGerman(), errorCode);
+    // Sch and St have boundaries with long sort keys.
+    index.addLabels(UnicodeSet("[\\u00C6{Sch*}{St*}]", errorCode), errorCode);
+    static const char *const names[] = {
+        "", "Adelbert", "Afrika", "\\u00C6sculap", "Aesthet", "Berlin", "Rilke", "Sacher",
+        "Sch", "Schiller", "Schillerstra\\u00DFe", "Schwarzwaldklinik", "Sczepanski",
+        "St", "Steiff", "Stuttgart-Feuerbach", "Sultan", "Thomas", "Zz",
+        "\\u03A9mega", "1984", "\\u4E00", "\\uFFFF"
+    };
+    UnicodeString strings[UPRV_LENGTHOF(names)];
+    int32_t indexes[UPRV_LENGTHOF(names)];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(names); ++i) {
+        strings[i] = UnicodeString(names[i], -1, US_INV).unescape();
+        index.addRecord(strings[i], NULL, errorCode);
+    }
+    LocalPointer<AlphabeticIndex::ImmutableIndex> immIndex(index.buildImmutableIndex(errorCode));
+    if (errorCode.errDataIfFailureAndReset("AlphabeticIndex(de) setup")) {
+        return;
+    }
+    index.getBucketIndices(strings, UPRV_LENGTHOF(strings), indexes, errorCode);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(names); ++i) {
+        int32_t expected = immIndex->getBucketIndex(strings[i], errorCode);
+        assertEquals(UnicodeString("getBucketIndices() vs. getBucketIndex(") + names[i] + ")",
+                     expected, indexes[i]);
+    }
+    immIndex->getBucketIndices(strings, UPRV_LENGTHOF(strings), indexes, errorCode);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(names); ++i) {
+        int32_t expected = index.getBucketIndex(strings[i], errorCode);
+        assertEquals(UnicodeString("immutable getBucketIndices() vs. getBucketIndex(") + names[i] + ")",
+                     expected, indexes[i]);
+    }
+    // The records were bucketed the same way.
+    int32_t recordCount = 0;
+    index.resetBucketIterator(errorCode);
+    while (index.nextBucket(errorCode)) {
+        int32_t bucketIndex = index.getBucketIndex();
+        while (index.nextRecord(errorCode)) {
+            ++recordCount;
+            assertEquals(UnicodeString("bucket of record ") + index.getRecordName(),
+                         index.getBucketIndex(index.getRecordName(), errorCode), bucketIndex);
+        }
+    }
+    assertEquals("record count", UPRV_LENGTHOF(names), recordCount);
+
+    index.getBucketIndices(strings, -1, indexes, errorCode);
+    assertEquals("getBucketIndices(count=-1)", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    index.getBucketIndices(NULL, 0, NULL, errorCode);
+    errorCode.errIfFailureAndReset("getBucketIndices(count=0)");
+}
+
 void AlphabeticIndexTest::testHasBuckets() {
     checkHasBuckets(Locale("am"), USCRIPT_ETHIOPIC);
     checkHasBuckets(Locale("haw"), USCRIPT_LATIN);
@@ -50,6 +50,10 @@ class AlphabeticIndexTest: public IntlTest {
     void TestChineseZhuyin();
     void TestJapaneseKanji();
     void TestChineseUnihan();
+    /**
+     * Test getBucketIndices() and the bucketing of records vs. getBucketIndex().
+     */
+    void TestGetBucketIndices();
 
     void testHasBuckets();
     void checkHasBuckets(const Locale &locale, UScriptCode script);
@@ -2517,6 +2517,51 @@ void CollationAPITest::TestGapTooSmall() {
     }
 }
 
+void CollationAPITest::TestSort() {
+    IcuTestErrorCode errorCode(*this, "TestSort");
+    LocalPointer<Collator> coll(Collator::createInstance("de", errorCode));
+    if(errorCode.errDataIfFailureAndReset("Collator::createInstance(de)")) {
+        return;
+    }
+    // "\u00FC" and "u\u0308" are canonically equivalent,
+    // so their relative order must be preserved.
+    UnicodeString strings[] = {
+        u"Bach", u"ab", u"\u00E4b", u"zz", u"\u00FC", u"", u"A", u"ab", u"u\u0308", u"1a", u"b"
+    };
+    const int32_t count = UPRV_LENGTHOF(strings);
+    coll->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, errorCode);
+    coll->sort(strings, count, errorCode);
+    if(errorCode.errIfFailureAndReset("Collator::sort()")) {
+        return;
+    }
+    static const char16_t *const expected[] = {
+        u"", u"1a", u"A", u"ab", u"ab", u"\u00E4b", u"b", u"Bach", u"\u00FC", u"u\u0308", u"zz"
+    };
+    for(int32_t i = 0; i < count; ++i) {
+        assertEquals(UnicodeString("sorted [") + i + "]", expected[i], strings[i]);
+    }
+
+    // At primary strength, all of these are equal, and the sort must be stable.
+    static const char16_t *const equalAtPrimary[] = {
+        u"\u00E4b", u"AB", u"ab", u"a\u0301b", u"Ab"
+    };
+    UnicodeString primaryStrings[UPRV_LENGTHOF(equalAtPrimary)];
+    for(int32_t i = 0; i < UPRV_LENGTHOF(equalAtPrimary); ++i) {
+        primaryStrings[i] = equalAtPrimary[i];
+    }
+    coll->setStrength(Collator::PRIMARY);
+    coll->sort(primaryStrings, UPRV_LENGTHOF(primaryStrings), errorCode);
+    errorCode.errIfFailureAndReset("Collator::sort(primary)");
+    for(int32_t i = 0; i < UPRV_LENGTHOF(equalAtPrimary); ++i) {
+        assertEquals(UnicodeString("stable [") + i + "]", equalAtPrimary[i], primaryStrings[i]);
+    }
+
+    coll->sort(strings, 0, errorCode);
+    errorCode.errIfFailureAndReset("Collator::sort(count=0)");
+    coll->sort(NULL, 1, errorCode);
+    assertEquals("Collator::sort(NULL)", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
  void CollationAPITest::dump(UnicodeString msg, RuleBasedCollator* c, UErrorCode& status) {
     const char* bigone = "One";
     const char* littleone = "one";
@@ -2560,6 +2605,7 @@ void CollationAPITest::runIndexedTest( int32_t index, UBool exec, const char* &n
     TESTCASE_AUTO(TestIterNumeric);
     TESTCASE_AUTO(TestBadKeywords);
     TESTCASE_AUTO(TestGapTooSmall);
+    TESTCASE_AUTO(TestSort);
     TESTCASE_AUTO_END;
 }
 
@@ -336,6 +336,13 @@ void CalendarTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
             TestChineseCalendarMapping();
           }
           break;
+        case 37:
+          name = "TestAddRollDatesAndHours";
+          if(exec) {
+            logln("TestAddRollDatesAndHours---"); logln("");
+            TestAddRollDatesAndHours();
+          }
+          break;
         default: name = ""; break;
     }
 }
@@ -3709,6 +3716,75 @@ void CalendarTest::TestChineseCalendarMapping() {
     }
 }
 
+void CalendarTest::TestAddRollDatesAndHours() {
+    UErrorCode status = U_ZERO_ERROR;
+    GregorianCalendar cal(TimeZone::createTimeZone("America/Los_Angeles"), status);
+    GregorianCalendar expected(TimeZone::createTimeZone("America/Los_Angeles"), status);
+    TEST_CHECK_STATUS;
+
+    // Adding days keeps the wall time across DST transitions,
+    // as if the date fields had been set.
+    cal.clear();
+    cal.set(2015, UCAL_DECEMBER, 25, 12, 30);
+    for (int32_t i = 1; i <= 3 * 366; ++i) {
+        cal.add(UCAL_DATE, 1, status);
+        expected.clear();
+        expected.set(2015, UCAL_DECEMBER, 25 + i, 12, 30);
+        UDate actualTime = cal.getTime(status);
+        UDate expectedTime = expected.getTime(status);
+        TEST_CHECK_STATUS;
+        if (actualTime != expectedTime) {
+            dataerrln("Fail: add(UCAL_DATE, 1) #%d gave %.0f, expected %.0f",
+                      (int)i, actualTime, expectedTime);
+            return;
+        }
+    }
+    cal.add(UCAL_WEEK_OF_YEAR, -52, status);
+    expected.clear();
+    expected.set(2015, UCAL_DECEMBER, 25 + 3 * 366 - 52 * 7, 12, 30);
+    TEST_ASSERT(cal.getTime(status) == expected.getTime(status));
+
+    // Adding hours is plain millisecond arithmetic, also across transitions.
+    UDate start = cal.getTime(status);
+    for (int32_t i = 1; i <= 24 * 400; ++i) {
+        cal.add(UCAL_HOUR_OF_DAY, 1, status);
+        if (cal.getTime(status) != start + i * (double)U_MILLIS_PER_HOUR) {
+            dataerrln("Fail: add(UCAL_HOUR_OF_DAY, 1) #%d", (int)i);
+            return;
+        }
+    }
+    TEST_CHECK_STATUS;
+
+    // Rolling the day of the month wraps at the end of the month.
+    static const struct {
+        int32_t year, month, day, amount, expectedDay;
+    } rollData[] = {
+        { 2016, UCAL_FEBRUARY, 28, 1, 29 },
+        { 2016, UCAL_FEBRUARY, 29, 1, 1 },
+        { 2015, UCAL_FEBRUARY, 28, 1, 1 },
+        { 2016, UCAL_FEBRUARY, 1, -1, 29 },
+        { 2016, UCAL_JANUARY, 31, 31, 31 },
+        { 2016, UCAL_APRIL, 30, -61, 29 },
+        { 2000, UCAL_DECEMBER, 15, 1000, 23 }
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(rollData); ++i) {
+        cal.clear();
+        cal.set(rollData[i].year, rollData[i].month, rollData[i].day, 12, 30);
+        cal.roll(UCAL_DATE, rollData[i].amount, status);
+        int32_t year = cal.get(UCAL_YEAR, status);
+        int32_t month = cal.get(UCAL_MONTH, status);
+        int32_t day = cal.get(UCAL_DATE, status);
+        int32_t hour = cal.get(UCAL_HOUR_OF_DAY, status);
+        TEST_CHECK_STATUS;
+        if (year != rollData[i].year || month != rollData[i].month ||
+                day != rollData[i].expectedDay || hour != 12) {
+            errln("Fail: roll(UCAL_DATE, %d) from %d-%02d-%02d gave %d-%02d-%02d %02d:00",
+                  (int)rollData[i].amount, (int)rollData[i].year, (int)rollData[i].month + 1,
+                  (int)rollData[i].day, (int)year, (int)month + 1, (int)day, (int)hour);
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 //eof
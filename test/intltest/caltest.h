@@ -255,6 +255,8 @@ class CalendarTest: public CalendarTimeZoneTest {
     void TestAddAcrossZoneTransition(void);
 
     void TestChineseCalendarMapping(void);
+
+    void TestAddRollDatesAndHours(void);
 };
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
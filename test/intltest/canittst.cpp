@@ -38,6 +38,7 @@ void CanonicalIteratorTest::runIndexedTest(int32_t index, UBool exec,
         CASE(0, TestBasic);
         CASE(1, TestExhaustive);
         CASE(2, TestAPI);
+        CASE(3, TestMaxCount);
       default: name = ""; break;
     }
 }
@@ -336,4 +337,70 @@ void CanonicalIteratorTest::TestAPI() {
   }
 }
 
+void CanonicalIteratorTest::TestMaxCount() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString source = CharsToUnicodeString("\\u00C5d\\u0307\\u0327");
+    UnicodeString nfd = CharsToUnicodeString("A\\u030Ad\\u0327\\u0307");
+    CanonicalIterator all(source, status);
+    if (U_FAILURE(status)) {
+        dataerrln("Error creating CanonicalIterator: %s", u_errorName(status));
+        return;
+    }
+    Hashtable allResults(status);
+    for (UnicodeString result = all.next(); !result.isBogus(); result = all.next()) {
+        allResults.puti(result, 1, status);
+    }
+    if (allResults.count() != 12) {
+        errln("Expected 12 results, got %d", allResults.count());
+    }
+
+    static const int32_t maxCounts[] = { 1, 2, 5, 12, 100 };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(maxCounts); ++i) {
+        int32_t maxCount = maxCounts[i];
+        CanonicalIterator it(source, maxCount, status);
+        for (int32_t pass = 0; pass < 2 && U_SUCCESS(status); ++pass) {
+            Hashtable results(status);
+            UnicodeString first = it.next();
+            if (first != nfd) {
+                errln(UnicodeString("maxCount ") + maxCount + ": the first result is not the NFD form: " + getReadable(first));
+            }
+            for (UnicodeString result = first; !result.isBogus(); result = it.next()) {
+                if (allResults.geti(result) == 0) {
+                    errln(UnicodeString("maxCount ") + maxCount + ": unexpected result " + getReadable(result));
+                }
+                results.puti(result, 1, status);
+            }
+            if (results.count() != (maxCount < 12 ? maxCount : 12)) {
+                errln("maxCount %d: got %d results", maxCount, results.count());
+            }
+            it.reset();
+        }
+    }
+    if (U_FAILURE(status)) {
+        errln("Error iterating with maxCount: %s", u_errorName(status));
+    }
+
+    // The full set grows exponentially with the number of combining marks,
+    // but the first few are found quickly.
+    UnicodeString marks("a");
+    for (int32_t i = 0; i < 40; ++i) {
+        marks.append((UChar)0x301);
+    }
+    CanonicalIterator marksIt("", status);
+    marksIt.setSource(marks, 20, status);
+    int32_t count = 0;
+    for (UnicodeString result = marksIt.next(); !result.isBogus(); result = marksIt.next()) {
+        ++count;
+    }
+    if (U_FAILURE(status) || count != 20) {
+        errln("setSource() with maxCount 20 returned %d results - %s", count, u_errorName(status));
+    }
+
+    status = U_ZERO_ERROR;
+    CanonicalIterator zero(source, 0, status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        errln("maxCount 0 should fail with U_ILLEGAL_ARGUMENT_ERROR, got %s", u_errorName(status));
+    }
+}
+
 #endif /* #if !UCONFIG_NO_NORMALIZATION */
@@ -0,0 +1,225 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// codepointtrietest.cpp
+// created: 2026oct14
+
+#include "unicode/utypes.h"
+#include "unicode/codepointtrie.h"
+#include "unicode/localpointer.h"
+#include "unicode/utf16.h"
+#include "cmemory.h"
+#include "intltest.h"
+
+// Functional tests of the trie data structure are in cintltst/ucptrietest.c.
+class CodePointTrieTest : public IntlTest {
+public:
+    CodePointTrieTest() {}
+
+    void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
+
+    void TestBuildAndGet();
+    void TestIteration();
+    void TestBinary();
+    void TestFromCodePointTrie();
+
+private:
+    CodePointTrie *buildCategories(UCPTrieType type, UCPTrieValueWidth valueWidth);
+};
+
+extern IntlTest *createCodePointTrieTest() {
+    return new CodePointTrieTest();
+}
+
+void CodePointTrieTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char * /*par*/) {
+    if(exec) {
+        logln("TestSuite CodePointTrieTest: ");
+    }
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestBuildAndGet);
+    TESTCASE_AUTO(TestIteration);
+    TESTCASE_AUTO(TestBinary);
+    TESTCASE_AUTO(TestFromCodePointTrie);
+    TESTCASE_AUTO_END;
+}
+
+namespace {
+
+// Custom character categories as used by a text classifier.
+const struct {
+    UChar32 start, end;
+    uint32_t value;
+} ranges[] = {
+    { 0x30, 0x39, 1 },  // digits
+    { 0x41, 0x5a, 2 },  // Latin capitals
+    { 0x61, 0x7a, 3 },  // Latin lowercase
+    { 0x391, 0x3a9, 4 },  // Greek
+    { 0x4e00, 0x9fff, 5 },  // CJK
+    { 0x1f600, 0x1f64f, 0x1234 },  // emoji; needs more than 8 bits
+    { 0x10ffff, 0x10ffff, 7 }
+};
+
+const uint32_t kErrorValue = 0xff;
+
+uint32_t expectedValue(UChar32 c) {
+    for (int32_t i = 0; i < UPRV_LENGTHOF(ranges); ++i) {
+        if (ranges[i].start <= c && c <= ranges[i].end) {
+            return ranges[i].value;
+        }
+    }
+    return 0;
+}
+
+}  // namespace
+
+CodePointTrie *CodePointTrieTest::buildCategories(UCPTrieType type, UCPTrieValueWidth valueWidth) {
+    IcuTestErrorCode errorCode(*this, "buildCategories");
+    MutableCodePointTrie mutableTrie(0, kErrorValue, errorCode);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(ranges); ++i) {
+        mutableTrie.setRange(ranges[i].start, ranges[i].end, ranges[i].value, errorCode);
+    }
+    mutableTrie.set(0x5f, 8, errorCode);  // '_'
+    assertEquals("mutable get('_')", 8, (int32_t)mutableTrie.get(0x5f));
+    assertEquals("mutable get(U+4E00)", 5, (int32_t)mutableTrie.get(0x4e00));
+    CodePointTrie *trie = mutableTrie.buildImmutable(type, valueWidth, errorCode);
+    if (errorCode.errIfFailureAndReset("buildImmutable()")) {
+        return nullptr;
+    }
+    return trie;
+}
+
+void CodePointTrieTest::TestBuildAndGet() {
+    static const struct {
+        UCPTrieType type;
+        UCPTrieValueWidth valueWidth;
+    } variants[] = {
+        { UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16 },
+        { UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_32 },
+        { UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_16 },
+        { UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_32 }
+    };
+    for (int32_t v = 0; v < UPRV_LENGTHOF(variants); ++v) {
+        LocalPointer<CodePointTrie> trie(buildCategories(variants[v].type, variants[v].valueWidth));
+        if (trie.isNull()) { return; }
+        assertEquals("getType()", variants[v].type, trie->getType());
+        assertEquals("getValueWidth()", variants[v].valueWidth, trie->getValueWidth());
+        for (UChar32 c = 0; c <= 0x10ffff; ++c) {
+            uint32_t expected = c == 0x5f ? 8 : expectedValue(c);
+            if (trie->get(c) != expected) {
+                errln("variant %d: get(U+%04lx)=0x%lx instead of 0x%lx",
+                      (int)v, (long)c, (long)trie->get(c), (long)expected);
+                break;
+            }
+        }
+        assertEquals("get(-1)", (int32_t)kErrorValue, (int32_t)trie->get(-1));
+        assertEquals("get(0x110000)", (int32_t)kErrorValue, (int32_t)trie->get(0x110000));
+
+        uint32_t value;
+        UChar32 end = trie->getRange(0x4e00, UCPMAP_RANGE_NORMAL, 0, nullptr, nullptr, &value);
+        assertEquals("getRange(U+4E00) end", 0x9fff, end);
+        assertEquals("getRange(U+4E00) value", 5, (int32_t)value);
+        assertEquals("UCPMap get", 4, (int32_t)ucpmap_get(trie->toUCPMap(), 0x3a3));
+    }
+}
+
+void CodePointTrieTest::TestIteration() {
+    // 5 a U+03A3 U+4E00 U+1F600 unpaired-lead _ U+10FFFF
+    static const char16_t s16[] = {
+        0x35, 0x61, 0x3a3, 0x4e00, 0xd83d, 0xde00, 0xd800, 0x5f, 0xdbff, 0xdfff
+    };
+    static const char s8[] =
+        "5a\xce\xa3\xe4\xb8\x80\xf0\x9f\x98\x80\xed\xa0\x80_\xf4\x8f\xbf\xbf";
+    static const uint32_t expected[] = { 1, 3, 4, 5, 0x1234, kErrorValue, 8, 7 };
+    static const UChar32 expectedCodePoints[] = {
+        0x35, 0x61, 0x3a3, 0x4e00, 0x1f600, 0xd800, 0x5f, 0x10ffff
+    };
+    static const UCPTrieType types[] = { UCPTRIE_TYPE_FAST, UCPTRIE_TYPE_SMALL };
+    for (int32_t t = 0; t < UPRV_LENGTHOF(types); ++t) {
+        LocalPointer<CodePointTrie> trie(buildCategories(types[t], UCPTRIE_VALUE_BITS_16));
+        if (trie.isNull()) { return; }
+        const char16_t *p = s16, *limit = s16 + UPRV_LENGTHOF(s16);
+        int32_t i = 0;
+        while (p < limit && i < UPRV_LENGTHOF(expected)) {
+            UChar32 c;
+            uint32_t value = trie->nextU16(p, limit, c);
+            if (value != expected[i] || c != expectedCodePoints[i]) {
+                errln("type %d: nextU16() #%d = U+%04lx 0x%lx instead of U+%04lx 0x%lx",
+                      (int)t, (int)i, (long)c, (long)value,
+                      (long)expectedCodePoints[i], (long)expected[i]);
+            }
+            ++i;
+        }
+        assertTrue("nextU16() reached the limit", p == limit && i == UPRV_LENGTHOF(expected));
+
+        // The surrogate code point is ill-formed UTF-8: each of its 3 bytes
+        // is a maximal ill-formed subpart.
+        static const uint32_t expected8[] = {
+            1, 3, 4, 5, 0x1234, kErrorValue, kErrorValue, kErrorValue, 8, 7
+        };
+        const char *q = s8, *limit8 = s8 + sizeof(s8) - 1;
+        i = 0;
+        while (q < limit8 && i < UPRV_LENGTHOF(expected8)) {
+            uint32_t value = trie->nextU8(q, limit8);
+            if (value != expected8[i]) {
+                errln("type %d: nextU8() #%d = 0x%lx instead of 0x%lx",
+                      (int)t, (int)i, (long)value, (long)expected8[i]);
+            }
+            ++i;
+        }
+        assertTrue("nextU8() reached the limit", q == limit8 && i == UPRV_LENGTHOF(expected8));
+    }
+}
+
+void CodePointTrieTest::TestBinary() {
+    IcuTestErrorCode errorCode(*this, "TestBinary");
+    LocalPointer<CodePointTrie> trie(buildCategories(UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16));
+    if (trie.isNull()) { return; }
+    int32_t length = trie->toBinary(nullptr, 0, errorCode);
+    assertEquals("toBinary() preflighting", U_BUFFER_OVERFLOW_ERROR, errorCode.reset());
+    MaybeStackArray<uint32_t, 1> memory((length + 3) / 4);
+    if (memory.getAlias() == nullptr) {
+        errln("out of memory");
+        return;
+    }
+    assertEquals("toBinary() length", length,
+                 trie->toBinary(memory.getAlias(), length, errorCode));
+
+    int32_t actualLength;
+    LocalPointer<CodePointTrie> trie2(CodePointTrie::fromBinary(
+        UCPTRIE_TYPE_ANY, UCPTRIE_VALUE_BITS_ANY, memory.getAlias(), length, &actualLength,
+        errorCode));
+    if (errorCode.errIfFailureAndReset("fromBinary()")) {
+        return;
+    }
+    assertEquals("fromBinary() actual length", length, actualLength);
+    assertEquals("fromBinary() type", UCPTRIE_TYPE_FAST, trie2->getType());
+    for (UChar32 c = 0; c <= 0x10ffff; c += 0x11) {
+        if (trie->get(c) != trie2->get(c)) {
+            errln("fromBinary(): get(U+%04lx) differs", (long)c);
+            break;
+        }
+    }
+
+    // The wrong type fails.
+    LocalPointer<CodePointTrie> trie3(CodePointTrie::fromBinary(
+        UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_ANY, memory.getAlias(), length, nullptr,
+        errorCode));
+    assertEquals("fromBinary(wrong type)", U_INVALID_FORMAT_ERROR, errorCode.reset());
+    assertTrue("fromBinary(wrong type) returns NULL", trie3.isNull());
+}
+
+void CodePointTrieTest::TestFromCodePointTrie() {
+    IcuTestErrorCode errorCode(*this, "TestFromCodePointTrie");
+    LocalPointer<CodePointTrie> trie(buildCategories(UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_32));
+    if (trie.isNull()) { return; }
+    MutableCodePointTrie mutableTrie(*trie, errorCode);
+    mutableTrie.setRange(0x30, 0x39, 9, errorCode);
+    LocalPointer<CodePointTrie> trie2(
+        mutableTrie.buildImmutable(UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16, errorCode));
+    if (errorCode.errIfFailureAndReset("buildImmutable()")) {
+        return;
+    }
+    assertEquals("modified digit", 9, (int32_t)trie2->get(0x37));
+    assertEquals("unmodified emoji", 0x1234, (int32_t)trie2->get(0x1f601));
+    assertEquals("original digit", 1, (int32_t)trie->get(0x37));
+}
@@ -76,6 +76,8 @@ class CollationTest : public IntlTest {
     void TestCollationWeights();
     void TestRootElements();
     void TestTailoredElements();
+    void TestRulesCache();
+    void TestSetAttributeFastLatin();
     void TestDataDriven();
 
 private:
@@ -146,6 +148,8 @@ void CollationTest::runIndexedTest(int32_t index, UBool exec, const char *&name,
     TESTCASE_AUTO(TestCollationWeights);
     TESTCASE_AUTO(TestRootElements);
     TESTCASE_AUTO(TestTailoredElements);
+    TESTCASE_AUTO(TestRulesCache);
+    TESTCASE_AUTO(TestSetAttributeFastLatin);
     TESTCASE_AUTO(TestDataDriven);
     TESTCASE_AUTO_END;
 }
@@ -1620,6 +1624,21 @@ UBool CollationTest::checkCompareTwo(const char *norm, const UnicodeString &prev
         expectedUTF8Order = coll->compare(prevValid, sValid, errorCode);
     }
 
+    // getCollationKeyUTF8() must make the same key as getCollationKey() of the valid string.
+    CollationKey keyUTF8, validKey;
+    coll->getCollationKeyUTF8(sUTF8, keyUTF8, errorCode);
+    const CollationKey &expectedKeyUTF8 =
+        (&sValid == &s) ? key : coll->getCollationKey(sValid, validKey, errorCode);
+    if(!(keyUTF8 == expectedKeyUTF8) || errorCode.isFailure()) {
+        infoln(fileTestName);
+        errln("line %d Collator(%s).getCollationKeyUTF8(current) != getCollationKey() (%s)",
+              (int)fileLineNumber, norm, errorCode.errorName());
+        infoln(fileLine);
+        infoln(printCollationKey(expectedKeyUTF8));
+        infoln(printCollationKey(keyUTF8));
+        return FALSE;
+    }
+
     order = coll->compareUTF8(prevUTF8, sUTF8, errorCode);
     if(order != expectedUTF8Order || errorCode.isFailure()) {
         infoln(fileTestName);
@@ -1803,6 +1822,112 @@ void CollationTest::checkCompareStrings(UCHARBUF *f, IcuTestErrorCode &errorCode
     }
 }
 
+void CollationTest::TestRulesCache() {
+    IcuTestErrorCode errorCode(*this, "TestRulesCache");
+    // Collators built from the same rules share a cached tailoring,
+    // but each one keeps the attributes it was created with.
+    UnicodeString rules(u"&b<a");
+    LocalPointer<RuleBasedCollator> primary(
+        new RuleBasedCollator(rules, Collator::PRIMARY, errorCode), errorCode);
+    if(errorCode.errDataIfFailureAndReset("RuleBasedCollator(rules, PRIMARY)")) {
+        return;
+    }
+    UParseError parseError;
+    UnicodeString reason(u"not reset");
+    LocalPointer<RuleBasedCollator> plain(
+        new RuleBasedCollator(rules, parseError, reason, errorCode), errorCode);
+    if(errorCode.errIfFailureAndReset("RuleBasedCollator(rules) again")) {
+        return;
+    }
+    assertEquals("reason after a cache hit", UnicodeString(), reason);
+    assertEquals("parseError.offset after a cache hit", -1, parseError.offset);
+    assertEquals("primary strength", UCOL_PRIMARY,
+                 primary->getAttribute(UCOL_STRENGTH, errorCode));
+    assertEquals("default strength", UCOL_TERTIARY,
+                 plain->getAttribute(UCOL_STRENGTH, errorCode));
+    assertEquals("primary a=\\u00E1", UCOL_EQUAL, primary->compare(u"a", u"\u00E1", errorCode));
+    assertEquals("default a<\\u00E1", UCOL_LESS, plain->compare(u"a", u"\u00E1", errorCode));
+    assertEquals("b<a", UCOL_LESS, plain->compare(u"b", u"a", errorCode));
+    assertTrue("getRules()", plain->getRules() == rules);
+    plain->setAttribute(UCOL_STRENGTH, UCOL_SECONDARY, errorCode);
+    LocalPointer<RuleBasedCollator> third(new RuleBasedCollator(rules, errorCode), errorCode);
+    if(errorCode.errIfFailureAndReset("RuleBasedCollator(rules) a third time")) {
+        return;
+    }
+    assertEquals("strength not shared", UCOL_TERTIARY,
+                 third->getAttribute(UCOL_STRENGTH, errorCode));
+
+    // Building a failing rule string again still reports the error details.
+    UnicodeString badRules(u"&a<b [unknown option]");
+    int32_t firstOffset = 0;
+    UnicodeString firstReason;
+    for(int32_t i = 0; i < 2; ++i) {
+        UErrorCode buildError = U_ZERO_ERROR;
+        reason.remove();
+        RuleBasedCollator bad(badRules, parseError, reason, buildError);
+        if(U_SUCCESS(buildError)) {
+            errln("RuleBasedCollator(bad rules) succeeded");
+            return;
+        }
+        if(i == 0) {
+            firstOffset = parseError.offset;
+            firstReason = reason;
+            assertTrue("reason", !reason.isEmpty());
+        } else {
+            assertEquals("parseError.offset again", firstOffset, parseError.offset);
+            assertEquals("reason again", firstReason, reason);
+        }
+    }
+}
+
+void CollationTest::TestSetAttributeFastLatin() {
+    IcuTestErrorCode errorCode(*this, "TestSetAttributeFastLatin");
+    // Most attributes update only the options bits of the fast-Latin data.
+    // Setting the numeric attribute at the end recomputes all of it,
+    // and the two collators must compare the same.
+    LocalPointer<Collator> root(Collator::createInstance(Locale::getRoot(), errorCode));
+    if(errorCode.errDataIfFailureAndReset("Collator::createInstance(root)")) {
+        return;
+    }
+    static const UColAttribute attrs[] = {
+        UCOL_STRENGTH, UCOL_CASE_LEVEL, UCOL_CASE_FIRST, UCOL_FRENCH_COLLATION
+    };
+    static const UColAttributeValue values[] = {
+        UCOL_PRIMARY, UCOL_ON, UCOL_UPPER_FIRST, UCOL_ON
+    };
+    static const char16_t *const strings[] = {
+        u"a", u"A", u"\u00E1", u"\u00C1", u"ab", u"Ab", u"a-b", u"a b", u"\u00E1b", u"ba",
+        u"co-op", u"coop", u"Co-op", u"cote", u"cot\u00E9", u"c\u00F4te", u"c\u00F4t\u00E9"
+    };
+    for(int32_t n = 1; n <= UPRV_LENGTHOF(attrs); ++n) {
+        LocalPointer<Collator> quick(root->clone());
+        LocalPointer<Collator> full(root->clone());
+        if(quick.isNull() || full.isNull()) {
+            errln("Collator::clone() failed");
+            return;
+        }
+        for(int32_t i = 0; i < n; ++i) {
+            quick->setAttribute(attrs[i], values[i], errorCode);
+            full->setAttribute(attrs[i], values[i], errorCode);
+        }
+        full->setAttribute(UCOL_NUMERIC_COLLATION, UCOL_OFF, errorCode);
+        if(errorCode.errIfFailureAndReset("setAttribute()")) {
+            return;
+        }
+        for(int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+            for(int32_t j = 0; j < UPRV_LENGTHOF(strings); ++j) {
+                UnicodeString left(strings[i]), right(strings[j]);
+                UCollationResult expected = full->compare(left, right, errorCode);
+                UCollationResult actual = quick->compare(left, right, errorCode);
+                if(actual != expected) {
+                    errln(UnicodeString(u"compare(") + prettify(left) + u", " + prettify(right) +
+                          u") with " + n + u" attributes differs from a full fast-Latin update");
+                }
+            }
+        }
+    }
+}
+
 void CollationTest::TestDataDriven() {
     IcuTestErrorCode errorCode(*this, "TestDataDriven");
 
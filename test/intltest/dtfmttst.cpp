@@ -18,6 +18,7 @@
 #include "unicode/datefmt.h"
 #include "unicode/dtptngen.h"
 #include "unicode/simpletz.h"
+#include "unicode/decimfmt.h"
 #include "unicode/strenum.h"
 #include "unicode/dtfmtsym.h"
 #include "cmemory.h"
@@ -122,6 +123,10 @@ void DateFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &nam
     TESTCASE_AUTO(TestMinuteSecondFieldsInOddPlaces);
     TESTCASE_AUTO(TestDayPeriodParsing);
     TESTCASE_AUTO(TestParseRegression13744);
+    TESTCASE_AUTO(TestCompiledPatternFormat);
+    TESTCASE_AUTO(TestGregorianFieldsFormat);
+    TESTCASE_AUTO(TestFormatBatch);
+    TESTCASE_AUTO(TestFixedNumericParse);
 
     TESTCASE_AUTO_END;
 }
@@ -5553,6 +5558,323 @@ void DateFormatTest::TestParseRegression13744() {
     assertEquals("Error index", inDate.length(), pos.getErrorIndex());
 }
 
+void DateFormatTest::TestCompiledPatternFormat() {
+    IcuTestErrorCode status(*this, "TestCompiledPatternFormat");
+    LocalPointer<Calendar> cal(Calendar::createInstance(TimeZone::getGMT()->clone(), Locale::getEnglish(), status));
+    if (status.errDataIfFailureAndReset("Calendar::createInstance() failed")) {
+        return;
+    }
+    cal->clear();
+    cal->set(2018, UCAL_JULY, 5, 3, 4, 5);
+    cal->set(UCAL_MILLISECOND, 6);
+    UDate date = cal->getTime(status);
+
+    static const struct {
+        const char* pattern;
+        const char16_t* expected;
+    } cases[] = {
+        {"yyyy-MM-dd'T'HH:mm:ss.SSS", u"2018-07-05T03:04:05.006"},
+        {"h 'o''clock' a", u"3 o'clock AM"},
+        {"''yyyy''", u"'2018'"},
+        {"yy", u"18"},
+        {"yyyyyy", u"002018"},
+        {"EEE, d MMM y", u"Thu, 5 Jul 2018"},
+        {"'only literal text'", u"only literal text"},
+        {"m's'm'mm'", u"4s4mm"},
+        {"", u""},
+    };
+    SimpleDateFormat sdf(UnicodeString("y"), Locale::getEnglish(), status);
+    if (status.errDataIfFailureAndReset("SimpleDateFormat constructor failed")) {
+        return;
+    }
+    sdf.setTimeZone(*TimeZone::getGMT());
+    UnicodeString result;
+    for (const auto& cas : cases) {
+        UnicodeString pattern(cas.pattern, -1, US_INV);
+        sdf.applyPattern(pattern);
+        assertEquals(pattern, cas.expected, sdf.format(date, result.remove()));
+        LocalPointer<Format> clone(sdf.clone());
+        assertEquals(pattern + " clone", cas.expected, clone->format(date, result.remove(), status));
+        SimpleDateFormat copy(UnicodeString("G"), Locale::getEnglish(), status);
+        copy = sdf;
+        assertEquals(pattern + " assignment", cas.expected, copy.format(date, result.remove()));
+        sdf.applyPattern(u"G");
+        sdf.applyLocalizedPattern(pattern, status);
+        assertEquals(pattern + " localized", cas.expected, sdf.format(date, result.remove()));
+    }
+
+    // Non-ASCII digits, within and beyond the BMP
+    SimpleDateFormat thaiFormat(u"dd/MM HH:mm", Locale("th-TH-u-nu-thai"), status);
+    if (!status.errDataIfFailureAndReset("SimpleDateFormat for th-TH-u-nu-thai failed")) {
+        thaiFormat.setTimeZone(*TimeZone::getGMT());
+        assertEquals("Thai digits", u"\u0E50\u0E55/\u0E50\u0E57 \u0E50\u0E53:\u0E50\u0E54",
+                     thaiFormat.format(date, result.remove()));
+    }
+    sdf.applyPattern(u"yyyy HH");
+    DecimalFormatSymbols* symbols = new DecimalFormatSymbols(Locale::getEnglish(), status);
+    symbols->setSymbol(DecimalFormatSymbols::kZeroDigitSymbol, u"\U0001D7CE");
+    sdf.adoptNumberFormat(new DecimalFormat(u"0", symbols, status));
+    assertEquals("mathematical bold digits",
+                 u"\U0001D7D0\U0001D7CE\U0001D7CF\U0001D7D6 \U0001D7CE\U0001D7D1",
+                 sdf.format(date, result.remove()));
+
+    // A number format that adds more than the digits must still be used
+    sdf.adoptNumberFormat(new DecimalFormat(u"'#'0", status));
+    assertEquals("prefix", u"#2018 #03", sdf.format(date, result.remove()));
+    sdf.adoptNumberFormat(new DecimalFormat(u"0", status));
+    assertEquals("plain", u"2018 03", sdf.format(date, result.remove()));
+}
+
+void DateFormatTest::TestGregorianFieldsFormat() {
+    // Formatting a UDate with a Gregorian calendar takes a path without a Calendar object;
+    // it must yield the same text and field positions as formatting a Calendar.
+    IcuTestErrorCode status(*this, "TestGregorianFieldsFormat");
+    static const char* const locales[] = { "en", "de", "ja", "ar", "fr-CA" };
+    static const char* const zones[] = { "America/Los_Angeles", "Asia/Kolkata", "Pacific/Kiritimati", "Etc/GMT+12" };
+    static const char* const patterns[] = {
+        "GGGG y MMMM d EEEE h:mm:ss.SSS a zzzz",
+        "G yy-MM-dd'T'HH:mm:ss.SXXX",
+        "D F g A k K SSSSS",
+        "QQQ qqqq QQ U u",
+        "EEEEE LLLLL MMMMM ccc EEEEEE",
+        "h:mm B, h:mm b, h aaaaa",
+        "w W Y e c",  // week fields use the Calendar
+        "VVVV O Z v",
+    };
+    static const UDate dates[] = {
+        -12219292800000.0 - U_MILLIS_PER_DAY,  // before the Gregorian cutover
+        -12219292800000.0 + U_MILLIS_PER_DAY,
+        -12219292800000.0 + 368.0 * U_MILLIS_PER_DAY,  // after the cutover year
+        -2208988800000.0,
+        -1.0,
+        0.0,
+        951782400000.0,   // 2000-02-29
+        1541322000000.0,  // 2018-11-04 09:00 UTC, Pacific DST ends
+        1552212000000.0,  // 2019-03-10 10:00 UTC, Pacific DST starts
+        1900000000123.0,
+        253402300799999.0,  // 9999-12-31 23:59:59.999 UTC
+    };
+    UnicodeString expected, actual;
+    for (const char* localeID : locales) {
+        Locale locale(localeID);
+        for (const char* pattern : patterns) {
+            SimpleDateFormat sdf(UnicodeString(pattern, -1, US_INV), locale, status);
+            if (status.errDataIfFailureAndReset("SimpleDateFormat(%s) for %s failed", pattern, localeID)) {
+                continue;
+            }
+            sdf.setContext(UDISPCTX_CAPITALIZATION_FOR_BEGINNING_OF_SENTENCE, status);
+            for (const char* zoneID : zones) {
+                sdf.adoptTimeZone(TimeZone::createTimeZone(zoneID));
+                LocalPointer<Calendar> cal(sdf.getCalendar()->clone());
+                for (int32_t i = 0; i < UPRV_LENGTHOF(dates); ++i) {
+                    UDate date = dates[i];
+                    cal->setTime(date, status);
+                    FieldPositionIterator expectedIter, actualIter;
+                    sdf.format(*cal, expected.remove(), &expectedIter, status);
+                    sdf.format(date, actual.remove(), &actualIter, status);
+                    UnicodeString message = UnicodeString(localeID, -1, US_INV) + u" " + zoneID +
+                            u" " + pattern + u" date #" + i;
+                    assertEquals(message, expected, actual);
+                    assertTrue(message + u" positions", expectedIter == actualIter);
+                    FieldPosition expectedPos(UDAT_HOUR1_FIELD), actualPos(UDAT_HOUR1_FIELD);
+                    sdf.format(*cal, expected.remove(), expectedPos);
+                    sdf.format(date, actual.remove(), actualPos);
+                    assertEquals(message + u" FieldPosition", expected, actual);
+                    assertEquals(message + u" begin", expectedPos.getBeginIndex(), actualPos.getBeginIndex());
+                    assertEquals(message + u" end", expectedPos.getEndIndex(), actualPos.getEndIndex());
+                }
+            }
+        }
+    }
+}
+
+void DateFormatTest::TestFormatBatch() {
+    // formatBatch() reuses the text of leading fields while the local day or minute stays the same;
+    // it must yield the same text as formatting each date on its own.
+    IcuTestErrorCode status(*this, "TestFormatBatch");
+    static const char* const patterns[] = {
+        "yyyy-MM-dd HH:mm:ss.SSS",
+        "HH:mm yyyy",
+        "EEE h:mm a zzz",
+        "MMMM d h:mm b",
+        "y-MM-dd HH:mm B",
+        "EEEE 'week' w, HH:mm:ss",
+        "G y D HH:mm:ss XXX",
+    };
+    // Monotonic dates within a minute, across minutes, days, DST changes, and the Gregorian cutover.
+    UDate dates[40];
+    int32_t count = 0;
+    static const UDate starts[] = {
+        1541318340000.0,  // 2018-11-04 07:59 UTC, shortly before Pacific DST ends
+        1552214400000.0 - 30000.0,  // 2019-03-10 10:59:30 UTC, Pacific DST starts
+        -12219292800000.0 - 2.0 * U_MILLIS_PER_DAY,  // the Gregorian cutover
+        1546300799000.0,  // the end of 2018 UTC
+    };
+    static const double steps[] = { 0.0, 1.0, 999.0, 30000.0, 30000.0, 3600000.0, U_MILLIS_PER_DAY, 0.0, 7.0, 43200000.0 };
+    for (UDate start : starts) {
+        UDate date = start;
+        for (double step : steps) {
+            date += step;
+            dates[count++] = date;
+        }
+    }
+    static const char* const localeIDs[] = { "en", "de", "ja" };
+    static const UDisplayContext contexts[] = {
+        UDISPCTX_CAPITALIZATION_NONE, UDISPCTX_CAPITALIZATION_FOR_BEGINNING_OF_SENTENCE
+    };
+    static const char* const zones[] = { "America/Los_Angeles", "Asia/Kolkata", "Etc/GMT+12" };
+    UnicodeString expected, actual;
+    int32_t offsets[UPRV_LENGTHOF(dates)];
+    for (const char* localeID : localeIDs) {
+        for (const char* pattern : patterns) {
+            SimpleDateFormat sdf(UnicodeString(pattern, -1, US_INV), Locale(localeID), status);
+            if (status.errDataIfFailureAndReset("SimpleDateFormat(%s) for %s failed", pattern, localeID)) {
+                continue;
+            }
+            for (UDisplayContext context : contexts) {
+                sdf.setContext(context, status);
+                for (const char* zoneID : zones) {
+                    sdf.adoptTimeZone(TimeZone::createTimeZone(zoneID));
+                    UnicodeString message = UnicodeString(localeID, -1, US_INV) + u" " + zoneID +
+                            u" " + pattern;
+                    expected.setTo(u"start:");
+                    actual.setTo(u"start:");
+                    for (int32_t i = 0; i < count; ++i) {
+                        sdf.format(dates[i], expected);
+                    }
+                    sdf.formatBatch(dates, count, actual, offsets, status);
+                    assertEquals(message, expected, actual);
+                    int32_t limit = 6;
+                    for (int32_t i = 0; i < count; ++i) {
+                        UnicodeString single;
+                        limit += sdf.format(dates[i], single).length();
+                        assertEquals(message + u" offset #" + i, limit, offsets[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    // A DateFormat that is not a SimpleDateFormat, and a non-Gregorian calendar.
+    LocalPointer<DateFormat> relative(DateFormat::createDateInstance(DateFormat::kFullRelative, Locale::getEnglish()));
+    LocalPointer<DateFormat> buddhist(DateFormat::createDateTimeInstance(
+            DateFormat::kLong, DateFormat::kMedium, Locale("th-TH-u-ca-buddhist")));
+    DateFormat* formats[] = { relative.getAlias(), buddhist.getAlias() };
+    for (DateFormat* fmt : formats) {
+        if (fmt == nullptr) {
+            dataerrln("Unable to create DateFormat");
+            continue;
+        }
+        expected.remove();
+        for (int32_t i = 0; i < count; ++i) {
+            fmt->format(dates[i], expected);
+        }
+        fmt->formatBatch(dates, count, actual.remove(), nullptr, status);
+        assertEquals("other DateFormat", expected, actual);
+    }
+
+    // Errors
+    SimpleDateFormat sdf(u"HH:mm", Locale::getEnglish(), status);
+    status.errIfFailureAndReset();
+    sdf.formatBatch(nullptr, 0, actual.remove(), nullptr, status);
+    assertSuccess("no dates", status);
+    assertEquals("no dates", u"", actual);
+    sdf.formatBatch(nullptr, 1, actual, nullptr, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    sdf.formatBatch(dates, -1, actual, nullptr, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+}
+
+void DateFormatTest::TestFixedNumericParse() {
+    // Patterns with only fixed-width numeric fields are parsed with a digit scanner;
+    // it must yield the same results as the general parser,
+    // which is used when a field has its own number format.
+    IcuTestErrorCode status(*this, "TestFixedNumericParse");
+    static const struct {
+        const char* pattern;
+        const char* text;
+    } cases[] = {
+        { "yyyy-MM-dd'T'HH:mm:ss.SSSXXX", "2018-11-04T01:30:00.123-07:00" },
+        { "yyyy-MM-dd'T'HH:mm:ss.SSSXXX", "2018-11-04T01:30:00.123Z" },
+        { "yyyy-MM-dd'T'HH:mm:ss.SSSXXX", "2019-03-10T02:30:59.999+05:30 and more" },
+        { "yyyy-MM-dd'T'HH:mm:ss.SSSXXX", "2019-03-10T02:30:59.999+05:30." },
+        { "yyyy-MM-dd'T'HH:mm:ss.SSSXXX", "2019-03-10T02:30:59.999+05:30:45" },
+        { "yyyy-MM-dd'T'HH:mm:ss.SSSXXX", "2019-03-10T02:30:59.9999+05:30" },
+        { "yyyy-MM-dd'T'HH:mm:ss.SSSXXX", "2019-03-10 02:30:59.999+05:30" },
+        { "yyyy-MM-dd'T'HH:mm:ss.SSSXXX", "2019-13-10T02:30:59.999+05:30" },
+        { "yyyy-MM-dd'T'HH:mm:ss.SSSXXX", "2019-02-29T02:30:59.999+05:30" },
+        { "yyyy-MM-dd'T'HH:mm:ss.SSSXXX", "2019-02-28T24:00:00.000Z" },
+        { "yyyy-MM-dd'T'HH:mm:ssxx", "2000-02-29T23:59:59-1200" },
+        { "yyyy-MM-dd'T'HH:mm:ssxx", "2000-02-29T23:59:59Z" },
+        { "yyyy-MM-dd HH:mm:ss.S", "2018-11-04 01:30:00.5" },
+        { "yyyy-MM-dd HH:mm:ss.SSSSSS", "2018-11-04 01:59:59.999999" },
+        { "yyyy-MM-dd HH:mm", "2018-11-04 01:30" },   // repeated wall time in Los Angeles
+        { "yyyy-MM-dd HH:mm", "2019-03-10 02:30" },   // skipped wall time
+        { "yyyy-MM-dd HH:mm", "2019-03-10 02:300" },
+        { "yyyy-MM-dd HH:mm", "2019-03-1002:30" },
+        { "yyyy-MM-dd", "2019-03-10" },
+        { "yyyy-MM-dd", "\u0662\u0660\u0661\u0669-03-10" },
+        { "yyyy-MM-dd", "1582-10-15" },
+        { "yyyy-MM-dd", "0001-01-01" },
+        { "yyyyMMddHHmmss", "20190310023000" },
+        { "yyyyMMddHHmmss", "201903100230001" },
+        { "dd.MM.yyyy", "31.12.9999" },
+    };
+    static const UCalendarWallTimeOption options[] = { UCAL_WALLTIME_LAST, UCAL_WALLTIME_FIRST };
+    for (const auto& cas : cases) {
+        UnicodeString pattern(cas.pattern, -1, US_INV);
+        UnicodeString text = UnicodeString(cas.text, -1, US_INV).unescape();
+        SimpleDateFormat fixed(pattern, Locale::getEnglish(), status);
+        SimpleDateFormat general(pattern, u"d=latn", Locale::getEnglish(), status);
+        if (status.errDataIfFailureAndReset("SimpleDateFormat(%s) failed", cas.pattern)) {
+            continue;
+        }
+        for (UBool lenient : { TRUE, FALSE }) {
+            for (UCalendarWallTimeOption option : options) {
+                UnicodeString message = pattern + u" " + text + u" lenient=" + (int32_t)lenient +
+                        u" option=" + (int32_t)option;
+                for (SimpleDateFormat* sdf : { &fixed, &general }) {
+                    LocalPointer<TimeZone> zone(TimeZone::createTimeZone(u"America/Los_Angeles"));
+                    sdf->setTimeZone(*zone);
+                    sdf->setLenient(lenient);
+                    Calendar* cal = const_cast<Calendar*>(sdf->getCalendar());
+                    cal->setRepeatedWallTimeOption(option);
+                    cal->setSkippedWallTimeOption(option);
+                }
+                ParsePosition fixedPos(0), generalPos(0);
+                UDate fixedDate = fixed.parse(text, fixedPos);
+                UDate generalDate = general.parse(text, generalPos);
+                assertEquals(message + u" date", generalDate, fixedDate);
+                assertEquals(message + u" index", generalPos.getIndex(), fixedPos.getIndex());
+                assertEquals(message + u" error index", generalPos.getErrorIndex(), fixedPos.getErrorIndex());
+
+                // Parsing into a cleared calendar also sets the calendar's time zone.
+                LocalPointer<Calendar> fixedCal(fixed.getCalendar()->clone());
+                LocalPointer<Calendar> generalCal(general.getCalendar()->clone());
+                fixedCal->clear();
+                generalCal->clear();
+                fixedPos.setIndex(0);
+                generalPos.setIndex(0);
+                fixed.parse(text, *fixedCal, fixedPos);
+                general.parse(text, *generalCal, generalPos);
+                assertEquals(message + u" cal index", generalPos.getIndex(), fixedPos.getIndex());
+                if (generalPos.getIndex() > 0) {
+                    UErrorCode fixedStatus = U_ZERO_ERROR, generalStatus = U_ZERO_ERROR;
+                    fixedDate = fixedCal->getTime(fixedStatus);
+                    generalDate = generalCal->getTime(generalStatus);
+                    assertEquals(message + u" cal status", u_errorName(generalStatus), u_errorName(fixedStatus));
+                    assertEquals(message + u" cal date", generalDate, fixedDate);
+                    UnicodeString fixedID, generalID;
+                    assertEquals(message + u" cal zone", generalCal->getTimeZone().getID(generalID),
+                                 fixedCal->getTimeZone().getID(fixedID));
+                    assertEquals(message + u" cal hour", generalCal->get(UCAL_HOUR_OF_DAY, generalStatus),
+                                 fixedCal->get(UCAL_HOUR_OF_DAY, fixedStatus));
+                }
+            }
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 //eof
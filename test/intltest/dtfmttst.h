@@ -262,6 +262,10 @@ class DateFormatTest: public CalendarTimeZoneTest {
     void TestMinuteSecondFieldsInOddPlaces();
     void TestDayPeriodParsing();
     void TestParseRegression13744();
+    void TestCompiledPatternFormat();
+    void TestGregorianFieldsFormat();
+    void TestFormatBatch();
+    void TestFixedNumericParse();
 
 private:
     UBool showParse(DateFormat &format, const UnicodeString &formattedString);
@@ -38,6 +38,7 @@ void IntlTestDateTimePatternGeneratorAPI::runIndexedTest( int32_t index, UBool e
         TESTCASE(4, testC);
         TESTCASE(5, testSkeletonsWithDayPeriods);
         TESTCASE(6, testGetFieldDisplayNames);
+        TESTCASE(7, testCreateInstanceCache);
         default: name = ""; break;
     }
 }
@@ -1135,6 +1136,42 @@ void IntlTestDateTimePatternGeneratorAPI::testC() {
     }
 }
 
+void IntlTestDateTimePatternGeneratorAPI::testCreateInstanceCache() {
+    // createInstance() returns copies of a cached generator:
+    // Changes to one of them must not affect the others.
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<DateTimePatternGenerator> gen(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("FAIL: DateTimePatternGenerator::createInstance failed for en - %s", u_errorName(status));
+        return;
+    }
+    assertEquals("en jmm", u"h:mm a", gen->getBestPattern(u"jmm", status));
+    assertEquals("en MMMd", u"MMM d", gen->getBestPattern(u"MMMd", status));
+    UnicodeString conflictingPattern;
+    gen->addPattern(u"d'.' MMM", TRUE, conflictingPattern, status);
+    gen->setDateTimeFormat(u"{1} 'at' {0}");
+    assertEquals("modified en MMMd", u"d'.' MMM", gen->getBestPattern(u"MMMd", status));
+
+    LocalPointer<DateTimePatternGenerator> gen2(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status));
+    LocalPointer<DateTimePatternGenerator> gen3(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status));
+    if (!assertSuccess("createInstance en", status)) {
+        return;
+    }
+    assertTrue("new en generators are equal", *gen2 == *gen3);
+    assertFalse("modified generator is different", *gen == *gen2);
+    assertEquals("new en MMMd", u"MMM d", gen2->getBestPattern(u"MMMd", status));
+    assertEquals("new en dateTimeFormat", u"{1}, {0}", gen2->getDateTimeFormat());
+    // The allowed hour formats are copied, too.
+    assertEquals("new en Cm", u"h:mm a", gen2->getBestPattern(u"Cm", status));
+
+    LocalPointer<DateTimePatternGenerator> genDe(DateTimePatternGenerator::createInstance(Locale::getGerman(), status));
+    if (!assertSuccess("createInstance de", status)) {
+        return;
+    }
+    assertEquals("de jmm", u"HH:mm", genDe->getBestPattern(u"jmm", status));
+    assertSuccess("getBestPattern", status);
+}
+
 enum { kCharBufMax = 31 };
 void IntlTestDateTimePatternGeneratorAPI::testSkeletonsWithDayPeriods() {
     const char * patterns[] = {
@@ -32,6 +32,7 @@ class IntlTestDateTimePatternGeneratorAPI : public IntlTest {
     void testC();
     void testSkeletonsWithDayPeriods();
     void testGetFieldDisplayNames();
+    void testCreateInstanceCache();
 };
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -71,6 +71,9 @@ extern IntlTest *createTimeUnitTest();
 extern IntlTest *createMeasureFormatTest();
 extern IntlTest *createNumberFormatSpecificationTest();
 extern IntlTest *createScientificNumberFormatterTest();
+#if !UCONFIG_NO_COLLATION && !UCONFIG_NO_BREAK_ITERATION
+extern IntlTest *createStartupSnapshotTest();
+#endif
 
 
 #define TESTCLASS(id, TestClass)          \
@@ -217,6 +220,17 @@ void IntlTestFormat::runIndexedTest( int32_t index, UBool exec, const char* &nam
         TESTCLASS(50,NumberFormatDataDrivenTest);
         TESTCLASS(51,NumberTest);
         TESTCLASS(52,EraRulesTest);
+#if !UCONFIG_NO_COLLATION && !UCONFIG_NO_BREAK_ITERATION
+        case 53:
+          name = "StartupSnapshotTest";
+          if (exec) {
+            logln("StartupSnapshotTest test---");
+            logln((UnicodeString)"");
+            LocalPointer<IntlTest> test(createStartupSnapshotTest());
+            callTest(*test, par);
+          }
+          break;
+#endif
         default: name = ""; break; //needed to end loop
     }
     if (exec) {
@@ -77,6 +77,7 @@ void IntlTestRBNF::runIndexedTest(int32_t index, UBool exec, const char* &name,
         TESTCASE(25, TestCompactDecimalFormatStyle);
         TESTCASE(26, TestParseFailure);
         TESTCASE(27, TestMinMaxIntegerDigitsIgnored);
+        TESTCASE(28, TestRuleTable);
 #else
         TESTCASE(0, TestRBNFDisabled);
 #endif
@@ -2320,6 +2321,54 @@ void IntlTestRBNF::TestMinMaxIntegerDigitsIgnored() {
     }
 }
 
+void IntlTestRBNF::TestRuleTable() {
+    // Rules are selected by table lookup below 1000 and by binary search above,
+    // including the rollback from "x01: << hundred >>" to "x00: << hundred".
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError parseError;
+    UnicodeString rules(
+            "-x: minus >>;"
+            "x.x: << point >>;"
+            "0: zero; 1: one; 2: two; 3: three; 4: four; 5: five; 6: six; 7: seven; 8: eight; 9: nine;"
+            "10: <<ty[->>];"
+            "100: << hundred[ >>];"
+            "1000: << thousand[, >>];");
+    RuleBasedNumberFormat rbnf(rules, Locale::getEnglish(), parseError, status);
+    if (U_FAILURE(status)) {
+        errcheckln(status, "FAIL: could not construct formatter - %s", u_errorName(status));
+        return;
+    }
+    const char * const testData[][2] = {
+        { "0", "zero" },
+        { "9", "nine" },
+        { "10", "onety" },
+        { "19", "onety-nine" },
+        { "20", "twoty" },
+        { "99", "ninety-nine" },
+        { "100", "one hundred" },
+        { "101", "one hundred one" },
+        { "200", "two hundred" },
+        { "999", "nine hundred ninety-nine" },
+        { "1000", "one thousand" },
+        { "2000", "two thousand" },
+        { "2001", "two thousand, one" },
+        { "123456", "one hundred twoty-three thousand, four hundred fivety-six" },
+        { "-5", "minus five" },
+        { "2.5", "two point five" },
+        { NULL, NULL }
+    };
+    doTest(&rbnf, testData, true);
+
+    // The result is appended after existing text.
+    UnicodeString result(u"Total: ");
+    rbnf.format((int32_t)205, result, status);
+    assertEquals("Appended", u"Total: two hundred five", result);
+    result.setTo(u"Total: ");
+    rbnf.format(3.5, result, status);
+    assertEquals("Appended double", u"Total: three point five", result);
+    assertSuccess("format", status);
+}
+
 void 
 IntlTestRBNF::doTest(RuleBasedNumberFormat* formatter, const char* const testData[][2], UBool testParsing) 
 {
@@ -22,12 +22,14 @@
 #include "unicode/uscript.h"
 #include "unicode/uspoof.h"
 
+#include "cmemory.h"
 #include "cstring.h"
 #include "scriptset.h"
 #include "uhash.h"
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string>
 
 #define TEST_ASSERT_SUCCESS(status) {if (U_FAILURE(status)) { \
     errcheckln(status, "Failure at file %s, line %d, error = %s", __FILE__, __LINE__, u_errorName(status));}}
@@ -93,6 +95,8 @@ void IntlTestSpoof::runIndexedTest( int32_t index, UBool exec, const char* &name
     TESTCASE_AUTO(testBug13314_MixedNumbers);
     TESTCASE_AUTO(testBug13328_MixedCombiningMarks);
     TESTCASE_AUTO(testCombiningDot);
+    TESTCASE_AUTO(testSkeletonBuffers);
+    TESTCASE_AUTO(testCheckBatch);
     TESTCASE_AUTO_END;
 }
 
@@ -752,4 +756,130 @@ void IntlTestSpoof::testCombiningDot() {
     }
 }
 
+// The UTF-16, UTF-8 and UnicodeString skeleton functions must agree,
+// whether or not the identifier needs normalization.
+void IntlTestSpoof::testSkeletonBuffers() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUSpoofCheckerPointer sc(uspoof_open(&status));
+    if (!assertSuccess("", status, true, __FILE__, __LINE__)) { return; }
+
+    static const char16_t *const cases[] = {
+        u"paypal",
+        u"p\u0430yp\u0430l",  // Cyrillic a
+        u"Mu\u0308ller",  // combining diaeresis
+        u"\u00FCber",  // decomposes
+        u"\u2A74x",  // maps to 3 characters
+        u"a\u059C",  // maps to a combining mark
+        u"\U0001D5BA\U0001D5BB"  // mathematical letters
+    };
+    for (const char16_t *input : cases) {
+        UnicodeString in(input);
+        UnicodeString expected;
+        uspoof_getSkeletonUnicodeString(sc.getAlias(), 0, in, expected, &status);
+        if (!assertSuccess("uspoof_getSkeletonUnicodeString()", status)) { return; }
+
+        char16_t dest[32];
+        int32_t length = uspoof_getSkeleton(sc.getAlias(), 0, input, -1, nullptr, 0, &status);
+        assertEquals(in + u" preflighting", U_BUFFER_OVERFLOW_ERROR, status);
+        assertEquals(in + u" preflighting length", expected.length(), length);
+        status = U_ZERO_ERROR;
+        uspoof_getSkeleton(sc.getAlias(), 0, input, -1, dest, 1, &status);
+        assertEquals(in + u" overflow", U_BUFFER_OVERFLOW_ERROR, status);
+        status = U_ZERO_ERROR;
+        length = uspoof_getSkeleton(sc.getAlias(), 0, input, -1, dest, UPRV_LENGTHOF(dest), &status);
+        assertSuccess("uspoof_getSkeleton()", status);
+        assertEquals(in + u" UTF-16", expected, UnicodeString(dest, length));
+
+        std::string in8, expected8;
+        in.toUTF8String(in8);
+        expected.toUTF8String(expected8);
+        char dest8[64];
+        length = uspoof_getSkeletonUTF8(sc.getAlias(), 0, in8.c_str(), -1, nullptr, 0, &status);
+        assertEquals(in + u" UTF-8 preflighting", U_BUFFER_OVERFLOW_ERROR, status);
+        status = U_ZERO_ERROR;
+        length = uspoof_getSkeletonUTF8(sc.getAlias(), 0, in8.c_str(), (int32_t)in8.length(),
+                                        dest8, UPRV_LENGTHOF(dest8), &status);
+        assertSuccess("uspoof_getSkeletonUTF8()", status);
+        assertEquals(in + u" UTF-8", expected8.c_str(), std::string(dest8, length).c_str());
+
+        // The output may alias the input.
+        UnicodeString same(in);
+        uspoof_getSkeletonUnicodeString(sc.getAlias(), 0, same, same, &status);
+        assertEquals(in + u" in-place", expected, same);
+    }
+
+    // Ill-formed UTF-8 is treated like U+FFFD.
+    char dest8[16];
+    int32_t length = uspoof_getSkeletonUTF8(sc.getAlias(), 0, "a\xff" "b", -1,
+                                            dest8, UPRV_LENGTHOF(dest8), &status);
+    assertSuccess("uspoof_getSkeletonUTF8(ill-formed)", status);
+    assertEquals("ill-formed UTF-8", "a\xef\xbf\xbd" "b", std::string(dest8, length).c_str());
+}
+
+// uspoof_checkBatch() must return the same results as uspoof_check2(),
+// including for ASCII identifiers that take its shortcut.
+void IntlTestSpoof::testCheckBatch() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUSpoofCheckerPointer sc(uspoof_open(&status));
+    if (!assertSuccess("", status, true, __FILE__, __LINE__)) { return; }
+
+    static const char16_t *const ids[] = {
+        u"user_name",
+        u"",
+        u"paypal.com",
+        u"p\u0430ypal",  // mixed Latin & Cyrillic
+        u"\u0441\u0442\u0440\u0430\u043D\u0430",  // Cyrillic
+        u"12\u0661",  // mixed digits
+        u"i\u0307",  // hidden overlay
+        u"a\u0301\u0301",  // repeated mark
+        u"x\U0001F600"  // not allowed
+    };
+    const int32_t count = UPRV_LENGTHOF(ids);
+    std::string ids8[count];
+    const char *ptrs8[count];
+    int32_t lengths[count];
+    for (int32_t i = 0; i < count; ++i) {
+        UnicodeString(ids[i]).toUTF8String(ids8[i]);
+        ptrs8[i] = ids8[i].c_str();
+        lengths[i] = (int32_t)ids8[i].length();
+    }
+
+    // Default checks, with restriction level info, and with 'x' and '_' disallowed.
+    UnicodeSet allowed(u"[[:L:][:M:][:N:][.]-[x]]", status);
+    for (int32_t config = 0; config < 3 && U_SUCCESS(status); ++config) {
+        if (config == 1) {
+            uspoof_setChecks(sc.getAlias(), USPOOF_ALL_CHECKS | USPOOF_AUX_INFO, &status);
+        } else if (config == 2) {
+            uspoof_setAllowedUnicodeSet(sc.getAlias(), &allowed, &status);
+        }
+        int32_t results[count], results8[count];
+        int32_t numFailed = uspoof_checkBatch(sc.getAlias(), (const UChar *const *)ids, nullptr,
+                                              count, results, &status);
+        int32_t numFailed8 = uspoof_checkBatchUTF8(sc.getAlias(), ptrs8, lengths,
+                                                   count, results8, &status);
+        if (!assertSuccess("uspoof_checkBatch()", status)) { return; }
+        int32_t expectedFailed = 0;
+        for (int32_t i = 0; i < count; ++i) {
+            int32_t expected = uspoof_check2(sc.getAlias(), ids[i], -1, nullptr, &status);
+            if ((expected & USPOOF_ALL_CHECKS) != 0) {
+                ++expectedFailed;
+            }
+            UnicodeString name = UnicodeString(u"config ") + (char16_t)(0x30 + config) + u": " + ids[i];
+            assertEquals(name, expected, results[i]);
+            assertEquals(name + u" UTF-8", expected, results8[i]);
+        }
+        assertEquals("number failed", expectedFailed, numFailed);
+        assertEquals("number failed UTF-8", expectedFailed, numFailed8);
+    }
+
+    // Illegal arguments.
+    int32_t result;
+    uspoof_checkBatch(sc.getAlias(), nullptr, nullptr, 1, &result, &status);
+    assertEquals("ids=NULL", U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+    int32_t badLength = -2;
+    uspoof_checkBatchUTF8(sc.getAlias(), ptrs8, &badLength, 1, &result, &status);
+    assertEquals("length=-2", U_ILLEGAL_ARGUMENT_ERROR, status);
+}
+
 #endif /* !UCONFIG_NO_REGULAR_EXPRESSIONS && !UCONFIG_NO_NORMALIZATION && !UCONFIG_NO_FILE_IO */
@@ -40,6 +40,9 @@ extern IntlTest *createSimpleFormatterTest();
 extern IntlTest *createUnifiedCacheTest();
 extern IntlTest *createQuantityFormatterTest();
 extern IntlTest *createPluralMapTest();
+extern IntlTest *createLocaleMatcherTest();
+extern IntlTest *createCodePointTrieTest();
+extern IntlTest *createOpenHashMapTest();
 #if !UCONFIG_NO_FORMATTING
 extern IntlTest *createStaticUnicodeSetsTest();
 #endif
@@ -148,6 +151,30 @@ void IntlTestUtilities::runIndexedTest( int32_t index, UBool exec, const char* &
             }
 #endif
             break;
+        case 25:
+            name = "LocaleMatcherTest";
+            if (exec) {
+                logln("TestSuite LocaleMatcherTest---"); logln();
+                LocalPointer<IntlTest> test(createLocaleMatcherTest());
+                callTest(*test, par);
+            }
+            break;
+        case 26:
+            name = "CodePointTrieTest";
+            if (exec) {
+                logln("TestSuite CodePointTrieTest---"); logln();
+                LocalPointer<IntlTest> test(createCodePointTrieTest());
+                callTest(*test, par);
+            }
+            break;
+        case 27:
+            name = "OpenHashMapTest";
+            if (exec) {
+                logln("TestSuite OpenHashMapTest---"); logln();
+                LocalPointer<IntlTest> test(createOpenHashMapTest());
+                callTest(*test, par);
+            }
+            break;
         default: name = ""; break; //needed to end loop
     }
 }
@@ -17,6 +17,8 @@
 */
 
 #include "listformattertest.h"
+#include "cmemory.h"
+#include "unicode/appendable.h"
 #include "unicode/ulistformatter.h"
 #include <string.h>
 
@@ -540,6 +542,60 @@ void ListFormatterTest::TestOutOfOrderPatterns() {
     CheckFormatting(&formatter, input4, 4, results[3], "TestOutOfOrderPatterns()");
 }
 
+void ListFormatterTest::TestFormatToAppendable() {
+    IcuTestErrorCode errorCode(*this, "TestFormatToAppendable()");
+    // Literal text around both arguments of each pattern.
+    ListFormatData data("<{0}+{1}>", "[{0}, {1}]", "({0}; {1})", "|{0} & {1}|");
+    ListFormatter formatter(data, errorCode);
+    UnicodeString items[] = {one, two, three, four, "Echo"};
+    static const char16_t *expected[] = {
+        u"",
+        u"Alice",
+        u"<Alice+Bob>",
+        u"|[Alice, Bob] & Charlie|",
+        u"|([Alice, Bob]; Charlie) & Delta|",
+        u"|(([Alice, Bob]; Charlie); Delta) & Echo|"
+    };
+    for (int32_t n = 0; n <= UPRV_LENGTHOF(items); ++n) {
+        UnicodeString result(prefix);
+        UnicodeStringAppendable appendable(result);
+        formatter.format(items, n, appendable, errorCode);
+        assertEquals("Appendable", prefix + expected[n], result);
+        result = prefix;
+        formatter.format(items, n, result, errorCode);
+        assertEquals("UnicodeString", prefix + expected[n], result);
+    }
+
+    // Offset of one item, and field positions
+    UnicodeString result(prefix);
+    int32_t offset = 0;
+    formatter.format(items, 4, result, 2, offset, errorCode);
+    assertEquals("offset", result.indexOf(three), offset);
+    int32_t positions[] = {
+        ULISTFMT_LITERAL_FIELD, 8, 10,
+        ULISTFMT_ELEMENT_FIELD, 10, 15,
+        ULISTFMT_LITERAL_FIELD, 15, 17,
+        ULISTFMT_ELEMENT_FIELD, 17, 20,
+        ULISTFMT_LITERAL_FIELD, 20, 24,
+        ULISTFMT_ELEMENT_FIELD, 24, 31,
+        ULISTFMT_LITERAL_FIELD, 31, 32
+    };
+    result = prefix;
+    RunTestFieldPositionIteratorWithFormatter(
+        &formatter, items, 3, positions, UPRV_LENGTHOF(positions) / 3, result,
+        u"Prefix: |[Alice, Bob] & Charlie|", "TestFormatToAppendable()");
+
+    // Patterns that reorder the items produce the same result as with a UnicodeString.
+    ListFormatData reordering("{1} after {0}", "{1} after the first {0}",
+                              "{1} after {0}", "{1} in the last after {0}");
+    ListFormatter reorderingFormatter(reordering, errorCode);
+    UnicodeString expectedString, actual;
+    UnicodeStringAppendable appendable(actual);
+    reorderingFormatter.format(items, 4, expectedString, errorCode);
+    reorderingFormatter.format(items, 4, appendable, errorCode);
+    assertEquals("reordering patterns", expectedString, actual);
+}
+
 void ListFormatterTest::runIndexedTest(int32_t index, UBool exec,
                                        const char* &name, char* /*par */) {
     switch(index) {
@@ -582,6 +638,9 @@ void ListFormatterTest::runIndexedTest(int32_t index, UBool exec,
         case 20: name = "TestFieldPositionIteratorWith3ItemsPatternShift";
                  if (exec) TestFieldPositionIteratorWith3ItemsPatternShift();
                  break;
+        case 21: name = "TestFormatToAppendable";
+                 if (exec) TestFormatToAppendable();
+                 break;
         default: name = ""; break;
     }
 }
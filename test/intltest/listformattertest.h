@@ -51,6 +51,7 @@ class ListFormatterTest : public IntlTest {
     void TestFieldPositionIteratorWith3ItemsAndDataBefore();
     void TestFieldPositionIteratorWith2ItemsPatternShift();
     void TestFieldPositionIteratorWith3ItemsPatternShift();
+    void TestFormatToAppendable();
 
   private:
     void CheckFormatting(
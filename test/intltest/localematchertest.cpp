@@ -0,0 +1,184 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// localematchertest.cpp
+// created: 2026oct14
+
+#include "unicode/utypes.h"
+#include "unicode/localematcher.h"
+#include "unicode/locid.h"
+#include "cmemory.h"
+#include "intltest.h"
+
+class LocaleMatcherTest : public IntlTest {
+public:
+    LocaleMatcherTest() {}
+
+    void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
+
+    void TestDistance();
+    void TestBestMatch();
+    void TestBestMatchForListString();
+    void TestMalformedListString();
+    void TestDefault();
+
+private:
+    void checkDistance(const char *desired, const char *supported, int32_t expected);
+    void checkListString(const LocaleMatcher &matcher, const char *list, const char *expected);
+};
+
+extern IntlTest *createLocaleMatcherTest() {
+    return new LocaleMatcherTest();
+}
+
+void LocaleMatcherTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char * /*par*/) {
+    if(exec) {
+        logln("TestSuite LocaleMatcherTest: ");
+    }
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestDistance);
+    TESTCASE_AUTO(TestBestMatch);
+    TESTCASE_AUTO(TestBestMatchForListString);
+    TESTCASE_AUTO(TestMalformedListString);
+    TESTCASE_AUTO(TestDefault);
+    TESTCASE_AUTO_END;
+}
+
+void LocaleMatcherTest::checkDistance(const char *desired, const char *supported, int32_t expected) {
+    IcuTestErrorCode errorCode(*this, "checkDistance");
+    Locale desiredLocale = Locale::forLanguageTag(desired, errorCode);
+    Locale supportedLocale = Locale::forLanguageTag(supported, errorCode);
+    int32_t distance = LocaleMatcher::internalDistance(desiredLocale, supportedLocale, errorCode);
+    if (errorCode.errDataIfFailureAndReset("%s -> %s", desired, supported)) {
+        return;
+    }
+    assertEquals(UnicodeString(desired, -1, US_INV) + " -> " + UnicodeString(supported, -1, US_INV),
+                 expected, distance);
+}
+
+void LocaleMatcherTest::checkListString(const LocaleMatcher &matcher, const char *list,
+                                        const char *expected) {
+    IcuTestErrorCode errorCode(*this, "checkListString");
+    const Locale *best = matcher.getBestMatchForListString(list, errorCode);
+    if (errorCode.errDataIfFailureAndReset("\"%s\"", list)) {
+        return;
+    }
+    if (best == NULL) {
+        errln("getBestMatchForListString(\"%s\") returned NULL", list);
+        return;
+    }
+    assertEquals(list, expected, best->getName());
+}
+
+void LocaleMatcherTest::TestDistance() {
+    checkDistance("en", "en", 0);
+    checkDistance("en", "en-Latn-US", 0);
+    checkDistance("en-AU", "en-GB", 3);
+    checkDistance("en-AU", "en-US", 5);
+    checkDistance("es-MX", "es-419", 4);
+    checkDistance("es-MX", "es-ES", 5);
+    checkDistance("sr-Latn", "sr-Cyrl", 5);
+    checkDistance("nb", "no", 1);
+
+    IcuTestErrorCode errorCode(*this, "TestDistance");
+    int32_t distance = LocaleMatcher::internalDistance(Locale("fr"), Locale("en"), errorCode);
+    if (errorCode.errDataIfFailureAndReset("fr -> en")) {
+        return;
+    }
+    if (distance < 50) {
+        errln("fr -> en distance %d is below the matching threshold", (int)distance);
+    }
+    // Different scripts of the same language are matched, but not cheaply.
+    distance = LocaleMatcher::internalDistance(Locale("zh_Hans"), Locale("zh_Hant"), errorCode);
+    if (errorCode.errDataIfFailureAndReset("zh_Hans -> zh_Hant")) {
+        return;
+    }
+    if (distance <= 5 || distance >= 50) {
+        errln("zh_Hans -> zh_Hant distance %d is out of range", (int)distance);
+    }
+}
+
+void LocaleMatcherTest::TestBestMatch() {
+    IcuTestErrorCode errorCode(*this, "TestBestMatch");
+    Locale supported[] = { Locale("en"), Locale("en_GB"), Locale("de"), Locale("fr_CH") };
+    LocaleMatcher matcher(supported, UPRV_LENGTHOF(supported), errorCode);
+    if (errorCode.errDataIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    const Locale *best = matcher.getBestMatch(Locale("en_AU"), errorCode);
+    assertSuccess("getBestMatch(en_AU)", errorCode);
+    assertEquals("en_AU", "en_GB", best->getName());
+    // en_CA is outside of the $enUS region variable and closer to en_GB.
+    best = matcher.getBestMatch(Locale("en_CA"), errorCode);
+    assertEquals("en_CA", "en_GB", best->getName());
+    best = matcher.getBestMatch(Locale("en_PR"), errorCode);
+    assertEquals("en_PR", "en", best->getName());
+    best = matcher.getBestMatch(Locale("de_AT"), errorCode);
+    assertEquals("de_AT", "de", best->getName());
+    best = matcher.getBestMatch(Locale("fr"), errorCode);
+    assertEquals("fr", "fr_CH", best->getName());
+
+    // A better match for a later desired locale does not win over the first desired language.
+    Locale desired[] = { Locale("de_CH"), Locale("en_GB") };
+    best = matcher.getBestMatch(desired, UPRV_LENGTHOF(desired), errorCode);
+    assertSuccess("getBestMatch(de_CH, en_GB)", errorCode);
+    assertEquals("de_CH, en_GB", "de", best->getName());
+    // An unsupported first language falls through to the next one.
+    Locale desired2[] = { Locale("ja"), Locale("fr_FR") };
+    best = matcher.getBestMatch(desired2, UPRV_LENGTHOF(desired2), errorCode);
+    assertEquals("ja, fr_FR", "fr_CH", best->getName());
+}
+
+void LocaleMatcherTest::TestBestMatchForListString() {
+    IcuTestErrorCode errorCode(*this, "TestBestMatchForListString");
+    Locale supported[] = { Locale("en"), Locale("de"), Locale("fr_CH") };
+    LocaleMatcher matcher(supported, UPRV_LENGTHOF(supported), errorCode);
+    if (errorCode.errDataIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    checkListString(matcher, "fr-FR, de;q=0.9", "fr_CH");
+    checkListString(matcher, "de;q=0.9, fr-FR", "fr_CH");
+    checkListString(matcher, "ja, de;q=0.5, en;q=0.9", "en");
+    checkListString(matcher, "ja, de;q=0.5, en;q=0.5", "de");
+    checkListString(matcher, "de;q=0, *, en-GB", "en");
+    checkListString(matcher, " de-AT ; q=1.0 ", "de");
+}
+
+void LocaleMatcherTest::TestMalformedListString() {
+    Locale supported[] = { Locale("en"), Locale("de") };
+    IcuTestErrorCode errorCode(*this, "TestMalformedListString");
+    LocaleMatcher matcher(supported, UPRV_LENGTHOF(supported), errorCode);
+    if (errorCode.errDataIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    static const char *const malformed[] = {
+        "en;q=x", "en;q=2", "en;r=0.5", "de;q=0.5;", "en de"
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(malformed); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        const Locale *best = matcher.getBestMatchForListString(malformed[i], status);
+        if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+            errln("getBestMatchForListString(\"%s\") -> %s, %s instead of U_ILLEGAL_ARGUMENT_ERROR",
+                  malformed[i], best != NULL ? best->getName() : "NULL", u_errorName(status));
+        }
+    }
+}
+
+void LocaleMatcherTest::TestDefault() {
+    Locale supported[] = { Locale("de"), Locale("en") };
+    IcuTestErrorCode errorCode(*this, "TestDefault");
+    LocaleMatcher matcher(supported, UPRV_LENGTHOF(supported), errorCode);
+    if (errorCode.errDataIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    const Locale *best = matcher.getBestMatch(Locale("ja_JP"), errorCode);
+    assertSuccess("getBestMatch(ja_JP)", errorCode);
+    assertEquals("no match -> first supported locale", "de", best->getName());
+    checkListString(matcher, "", "de");
+
+    LocaleMatcher empty(NULL, 0, errorCode);
+    assertSuccess("LocaleMatcher(no locales)", errorCode);
+    best = empty.getBestMatch(Locale("en"), errorCode);
+    assertSuccess("empty.getBestMatch(en)", errorCode);
+    assertTrue("no supported locales -> NULL", best == NULL);
+}
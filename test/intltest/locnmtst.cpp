@@ -82,6 +82,7 @@ void LocaleDisplayNamesTest::runIndexedTest(int32_t index, UBool exec, const cha
         TESTCASE(11, TestPrivateUse);
         TESTCASE(12, TestUldnDisplayContext);
         TESTCASE(13, TestUldnWithGarbage);
+        TESTCASE(14, TestSharedInstancesAndBatch);
 #endif
         default:
             name = "";
@@ -422,4 +423,45 @@ void LocaleDisplayNamesTest::TestRootEtc() {
   delete ldn;
 }
 
+void LocaleDisplayNamesTest::TestSharedInstancesAndBatch() {
+  // Instances with the same locale and contexts share their data;
+  // each one must still be usable after the others are deleted.
+  UDisplayContext contexts[] = {
+    UDISPCTX_CAPITALIZATION_FOR_BEGINNING_OF_SENTENCE, UDISPCTX_DIALECT_NAMES
+  };
+  UDisplayContext reversed[] = {
+    UDISPCTX_DIALECT_NAMES, UDISPCTX_CAPITALIZATION_FOR_BEGINNING_OF_SENTENCE
+  };
+  LocaleDisplayNames *ldn1 = LocaleDisplayNames::createInstance(Locale::getUS(), contexts, 2);
+  LocaleDisplayNames *ldn2 = LocaleDisplayNames::createInstance(Locale::getUS(), reversed, 2);
+  LocaleDisplayNames *ldn3 = LocaleDisplayNames::createInstance(Locale::getUS());
+  UnicodeString temp;
+  ldn1->localeDisplayName("en_GB", temp);
+  delete ldn1;
+  test_assert_equal("British English", temp);
+  ldn2->localeDisplayName("en_GB", temp);
+  test_assert_equal("British English", temp);
+  test_assert(ldn2->getDialectHandling() == ULDN_DIALECT_NAMES);
+  test_assert(ldn2->getContext(UDISPCTX_TYPE_CAPITALIZATION) ==
+              UDISPCTX_CAPITALIZATION_FOR_BEGINNING_OF_SENTENCE);
+  test_assert(ldn3->getDialectHandling() == ULDN_STANDARD_NAMES);
+  test_assert(ldn3->getContext(UDISPCTX_TYPE_CAPITALIZATION) == UDISPCTX_CAPITALIZATION_NONE);
+  ldn3->localeDisplayName("en_GB", temp);
+  test_assert_equal("English (United Kingdom)", temp);
+  delete ldn2;
+
+  // The batch API returns the same names as single calls.
+  Locale locales[] = {
+    Locale("de_CH"), Locale("zh_Hant_TW"), Locale("sr_Latn"), Locale("ja@calendar=japanese"),
+    Locale("und_419"), Locale("xx")
+  };
+  UnicodeString names[UPRV_LENGTHOF(locales)];
+  test_assert(ldn3->localeDisplayNames(locales, UPRV_LENGTHOF(locales), names) == names);
+  for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+    ldn3->localeDisplayName(locales[i], temp);
+    test_assert_print(names[i] == temp, names[i]);
+  }
+  delete ldn3;
+}
+
 #endif   /*  UCONFIG_NO_FORMATTING */
@@ -37,5 +37,6 @@ class LocaleDisplayNamesTest: public IntlTest {
     void TestPrivateUse(void);
     void TestUldnDisplayContext(void);
     void TestUldnWithGarbage(void);
+    void TestSharedInstancesAndBatch(void);
 #endif
 };
@@ -29,6 +29,7 @@
 #include "putilimp.h"
 #include "hash.h"
 #include "locmap.h"
+#include "ustr_imp.h"
 
 static const char* const rawData[33][8] = {
 
@@ -253,6 +254,7 @@ void LocaleTest::runIndexedTest( int32_t index, UBool exec, const char* &name, c
     TESTCASE_AUTO(TestMoveAssign);
     TESTCASE_AUTO(TestMoveCtor);
     TESTCASE_AUTO(TestBug13417VeryLongLanguageTag);
+    TESTCASE_AUTO(TestInternedLocaleID);
     TESTCASE_AUTO_END;
 }
 
@@ -3154,3 +3156,49 @@ void LocaleTest::TestBug13417VeryLongLanguageTag() {
     status.errIfFailureAndReset("\"%s\"", l.getName());
     assertEquals("equals", tag, result.c_str());
 }
+
+void LocaleTest::TestInternedLocaleID() {
+    IcuTestErrorCode status(*this, "TestInternedLocaleID()");
+
+    // Longer than ULOC_FULLNAME_CAPACITY, so that the ID is interned.
+    static const char id[] =
+        "de_DE@calendar=buddhist;collation=phonebook;currency=eur;numbers=latn;"
+        "x=foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz-"
+        "foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz";
+    static const char id2[] =
+        "de_DE@calendar=japanese;collation=phonebook;currency=eur;numbers=latn;"
+        "x=foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz-"
+        "foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz-foo-bar-baz";
+
+    Locale l1(id);
+    assertEquals("l1.getName()", id, l1.getName());
+    assertEquals("l1.getBaseName()", "de_DE", l1.getBaseName());
+
+    // Copies and separately constructed objects share the interned ID.
+    Locale l2(l1);
+    Locale l3(id);
+    assertTrue("l2 shares the name of l1", l1.getName() == l2.getName());
+    assertTrue("l3 shares the name of l1", l1.getName() == l3.getName());
+    assertTrue("l3 shares the base name of l1", l1.getBaseName() == l3.getBaseName());
+    assertTrue("l1 == l3", l1 == l3);
+    assertEquals("l1.hashCode() == l3.hashCode()", l1.hashCode(), l3.hashCode());
+    assertEquals("hashCode()",
+                 ustr_hashCharsN(id, static_cast<int32_t>(uprv_strlen(id))), l1.hashCode());
+
+    // Modifying a copy does not affect the other objects.
+    l2.setKeywordValue("calendar", "japanese", status);
+    status.errIfFailureAndReset("setKeywordValue()");
+    assertEquals("l2.getName()", id2, l2.getName());
+    assertEquals("l1.getName() after modifying l2", id, l1.getName());
+    assertTrue("l1 != l2", l1 != l2);
+
+    // Releasing all but one reference keeps the ID valid.
+    {
+        Locale l4(id2);
+        l2 = l4;
+        l3 = Locale("en");
+    }
+    assertEquals("l2.getName() after releasing l4", id2, l2.getName());
+    assertEquals("l1.getName() after releasing l3", id, l1.getName());
+    assertEquals("l3.getName()", "en", l3.getName());
+}
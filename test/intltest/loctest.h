@@ -126,6 +126,8 @@ class LocaleTest: public IntlTest {
 
     void TestBug13417VeryLongLanguageTag();
 
+    void TestInternedLocaleID();
+
 private:
     void _checklocs(const char* label,
                     const char* req,
@@ -54,6 +54,7 @@ class NumberFormatterApiTest : public IntlTest {
     void unitCompoundMeasure();
     void unitCurrency();
     void unitPercent();
+    void unitLongNamesShared();
     void roundingFraction();
     void roundingFigures();
     void roundingFractionFigures();
@@ -75,6 +76,11 @@ class NumberFormatterApiTest : public IntlTest {
     void validRanges();
     void copyMove();
     void localPointerCAPI();
+    void formatIntToBuffer();
+    void integerFastPath();
+    void compile();
+    void formatBatch();
+    void formatFixedPointAndDecimal128();
 
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = 0);
 
@@ -127,7 +133,9 @@ class DecimalQuantityTest : public IntlTest {
     void testUseApproximateDoubleWhenAble();
     void testHardDoubleConversion();
     void testToDouble();
+    void testRoundToIncrementAndMultiply();
     void testMaxDigits();
+    void testFixedPointAndDecimal128();
 
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = 0);
 
@@ -141,8 +149,12 @@ class DecimalQuantityTest : public IntlTest {
 class DoubleConversionTest : public IntlTest {
   public:
     void testDoubleConversionApi();
+    void testShortestDigits();
 
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = 0);
+
+  private:
+    void checkShortestDigits(double v);
 };
 
 class ModifiersTest : public IntlTest {
@@ -169,6 +181,7 @@ class PatternModifierTest : public IntlTest {
     void testBasic();
     void testPatternWithNoPlaceholder();
     void testMutableEqualsImmutable();
+    void testSharedImmutable();
 
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = 0);
 
@@ -223,6 +236,7 @@ class NumberParserTest : public IntlTest {
     void testSeriesMatcher();
     void testCombinedCurrencyMatcher();
     void testAffixPatternMatcher();
+    void testAsciiFastPath();
     void testGroupingDisabled();
     void testCaseFolding();
 
@@ -258,6 +272,7 @@ class NumberRangeFormatterTest : public IntlTest {
     void testDifferentFormatters();
     void testPlurals();
     void testCopyMove();
+    void testSharedData();
 
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = 0);
 
@@ -8,6 +8,7 @@
 #include "charstr.h"
 #include <cstdarg>
 #include <cmath>
+#include "unicode/uclean.h"
 #include "unicode/unum.h"
 #include "unicode/numberformatter.h"
 #include "number_asformat.h"
@@ -69,6 +70,7 @@ void NumberFormatterApiTest::runIndexedTest(int32_t index, UBool exec, const cha
         TESTCASE_AUTO(unitCompoundMeasure);
         TESTCASE_AUTO(unitCurrency);
         TESTCASE_AUTO(unitPercent);
+        TESTCASE_AUTO(unitLongNamesShared);
         TESTCASE_AUTO(roundingFraction);
         TESTCASE_AUTO(roundingFigures);
         TESTCASE_AUTO(roundingFractionFigures);
@@ -90,6 +92,11 @@ void NumberFormatterApiTest::runIndexedTest(int32_t index, UBool exec, const cha
         TESTCASE_AUTO(validRanges);
         TESTCASE_AUTO(copyMove);
         TESTCASE_AUTO(localPointerCAPI);
+        TESTCASE_AUTO(formatIntToBuffer);
+        TESTCASE_AUTO(integerFastPath);
+        TESTCASE_AUTO(compile);
+        TESTCASE_AUTO(formatBatch);
+        TESTCASE_AUTO(formatFixedPointAndDecimal128);
     TESTCASE_AUTO_END;
 }
 
@@ -809,6 +816,43 @@ void NumberFormatterApiTest::unitPercent() {
             u"-98.765432%");
 }
 
+void NumberFormatterApiTest::unitLongNamesShared() {
+    IcuTestErrorCode status(*this, "unitLongNamesShared");
+    // Formatters for the same locale, unit and width share the compiled long names;
+    // they must still format alike after the formatter that loaded them is gone.
+    UNumberUnitWidth widths[] = {UNUM_UNIT_WIDTH_FULL_NAME, UNUM_UNIT_WIDTH_SHORT, UNUM_UNIT_WIDTH_NARROW};
+    for (int32_t w = 0; w < UPRV_LENGTHOF(widths); w++) {
+        UnlocalizedNumberFormatter unlocalized[] = {
+            NumberFormatter::with().unit(METER).unitWidth(widths[w]),
+            NumberFormatter::with().unit(JOULE).perUnit(FURLONG).unitWidth(widths[w]),
+            NumberFormatter::with().unit(POUND).perUnit(SQUARE_MILE).unitWidth(widths[w]),
+            NumberFormatter::with().unit(USD).unitWidth(widths[w])};
+        for (int32_t i = 0; i < UPRV_LENGTHOF(unlocalized); i++) {
+            UnicodeString expected[2];
+            {
+                LocalizedNumberFormatter first = unlocalized[i].locale("en");
+                expected[0] = first.formatInt(1, status).toString();
+                expected[1] = first.formatDouble(2.5, status).toString();
+            }
+            if (status.errDataIfFailureAndReset()) { return; }
+            LocalizedNumberFormatter second = unlocalized[i].locale("en");
+            assertEquals(UnicodeString("one, width ") + w + ", #" + i,
+                         expected[0], second.formatInt(1, status).toString());
+            assertEquals(UnicodeString("other, width ") + w + ", #" + i,
+                         expected[1], second.formatDouble(2.5, status).toString());
+        }
+    }
+    assertEquals("Unit long name", u"1 meter",
+                 NumberFormatter::withLocale("en").unit(METER).unitWidth(UNUM_UNIT_WIDTH_FULL_NAME)
+                         .formatInt(1, status).toString());
+    assertEquals("Compound long name", u"2.5 joules per furlong",
+                 NumberFormatter::withLocale("en").unit(JOULE).perUnit(FURLONG)
+                         .unitWidth(UNUM_UNIT_WIDTH_FULL_NAME).formatDouble(2.5, status).toString());
+    assertEquals("Currency long name", u"1.00 US dollars",
+                 NumberFormatter::withLocale("en").unit(USD).unitWidth(UNUM_UNIT_WIDTH_FULL_NAME)
+                         .formatInt(1, status).toString());
+}
+
 void NumberFormatterApiTest::roundingFraction() {
     assertFormatDescending(
             u"Integer",
@@ -2454,6 +2498,220 @@ void NumberFormatterApiTest::localPointerCAPI() {
     // No need to do any cleanup since we are using LocalPointer.
 }
 
+#if U_ENABLE_MEMORY_SCOPES
+namespace {
+
+int32_t gScopeAllocCount = 0;
+
+void * U_CALLCONV countingAlloc(const void *, size_t size) {
+    ++gScopeAllocCount;
+    return malloc(size);
+}
+
+void * U_CALLCONV countingRealloc(const void *, void *mem, size_t size) {
+    return realloc(mem, size);
+}
+
+void U_CALLCONV countingFree(const void *, void *mem) {
+    free(mem);
+}
+
+// The counting scope does not own any blocks: They are all freed normally.
+UBool U_CALLCONV countingContains(const void *, const void *) {
+    return FALSE;
+}
+
+}  // namespace
+#endif
+
+void NumberFormatterApiTest::formatIntToBuffer() {
+    IcuTestErrorCode status(*this, "formatIntToBuffer");
+    LocalizedNumberFormatter lnf = NumberFormatter::withLocale("de-CH").threshold(1);
+    char16_t buffer[20];
+    int32_t length = lnf.formatInt(-1234567, buffer, UPRV_LENGTHOF(buffer), status);
+    assertEquals("UTF-16", u"-1’234’567", UnicodeString(buffer, length));
+    assertEquals("NUL-terminated", 0, buffer[length]);
+    assertEquals("same as FormattedNumber", lnf.formatInt(-1234567, status).toString(status),
+                 UnicodeString(buffer, length));
+
+    char bytes[40];
+    int32_t utf8Length = lnf.formatIntToUTF8(-1234567, bytes, UPRV_LENGTHOF(bytes), status);
+    assertEquals("UTF-8", UnicodeString(buffer, length), UnicodeString::fromUTF8(StringPiece(bytes, utf8Length)));
+    status.errIfFailureAndReset();
+
+    assertEquals("UTF-16 preflighting", length, lnf.formatInt(-1234567, nullptr, 0, status));
+    assertEquals("UTF-16 overflow", U_BUFFER_OVERFLOW_ERROR, status.reset());
+    assertEquals("UTF-8 preflighting", utf8Length, lnf.formatIntToUTF8(-1234567, bytes, 4, status));
+    assertEquals("UTF-8 overflow", U_BUFFER_OVERFLOW_ERROR, status.reset());
+    lnf.formatInt(5, nullptr, 5, status);
+    assertEquals("nullptr with capacity", U_ILLEGAL_ARGUMENT_ERROR, status.reset());
+
+#if U_ENABLE_MEMORY_SCOPES
+    // The compiled formatter formats into the buffer without heap allocations.
+    UMemoryScope scope = {
+        nullptr, countingAlloc, countingRealloc, countingFree, countingContains, nullptr };
+    gScopeAllocCount = 0;
+    u_pushMemoryScope(&scope, status);
+    for (int64_t value = 1; value < 1000000000000LL; value = value * 7 + 3) {
+        lnf.formatInt(value, buffer, UPRV_LENGTHOF(buffer), status);
+        lnf.formatIntToUTF8(-value, bytes, UPRV_LENGTHOF(bytes), status);
+    }
+    u_popMemoryScope(&scope, status);
+    status.errIfFailureAndReset();
+    assertEquals("heap allocations", 0, gScopeAllocCount);
+#endif
+}
+
+void NumberFormatterApiTest::integerFastPath() {
+    IcuTestErrorCode status(*this, "integerFastPath");
+    // The compiled formatter may take the integer fast path for these settings;
+    // its output must match the general pipeline, which is used without self-regulation.
+    const UnlocalizedNumberFormatter formatters[] = {
+        NumberFormatter::with(),
+        NumberFormatter::with().precision(Precision::integer()),
+        NumberFormatter::with().grouping(UNUM_GROUPING_MIN2),
+        NumberFormatter::with().grouping(UNUM_GROUPING_OFF),
+        NumberFormatter::with().sign(UNUM_SIGN_ALWAYS),
+        NumberFormatter::with().unit(NoUnit::percent()),
+        NumberFormatter::with().unit(CurrencyUnit(u"EUR", status)).precision(Precision::integer())
+                .sign(UNUM_SIGN_ACCOUNTING),
+        // Not eligible for the fast path:
+        NumberFormatter::with().unit(CurrencyUnit(u"EUR", status)),
+        NumberFormatter::with().integerWidth(IntegerWidth::zeroFillTo(4)),
+    };
+    static const char* const locales[] = { "en", "de-CH", "es", "hi", "ar", "en@numbers=hanidec" };
+    static const int64_t values[] = {
+        0, 1, -7, 12, 999, 1000, -1000, 12345, 123456, 1234567, -98765432,
+        1000000000000LL, INT64_MAX, INT64_MIN, INT64_MIN + 1
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(formatters); ++i) {
+        for (const char* locale : locales) {
+            LocalizedNumberFormatter general = formatters[i].threshold(0).locale(locale);
+            LocalizedNumberFormatter compiled = formatters[i].threshold(1).locale(locale);
+            for (int64_t value : values) {
+                UnicodeString message = UnicodeString(u"formatter ") + Int64ToUnicodeString(i) +
+                        u" " + locale + u" " + Int64ToUnicodeString(value);
+                FormattedNumber expected = general.formatInt(value, status);
+                FormattedNumber actual = compiled.formatInt(value, status);
+                assertEquals(message, expected.toString(status), actual.toString(status));
+                FieldPosition expectedPos(UNUM_GROUPING_SEPARATOR_FIELD);
+                FieldPosition actualPos(UNUM_GROUPING_SEPARATOR_FIELD);
+                expected.populateFieldPosition(expectedPos, status);
+                actual.populateFieldPosition(actualPos, status);
+                assertEquals(message + u" grouping separator position",
+                             expectedPos.getBeginIndex(), actualPos.getBeginIndex());
+            }
+        }
+    }
+    status.errIfFailureAndReset();
+}
+
+void NumberFormatterApiTest::compile() {
+    IcuTestErrorCode status(*this, "compile");
+    // Threshold 0 would never compile lazily.
+    LocalizedNumberFormatter l1 = NumberFormatter::withLocale("en").unit(NoUnit::percent()).threshold(0)
+            .compile(status);
+    if (status.errDataIfFailureAndReset()) { return; }
+    assertEquals("Compiled before the first call", INT32_MIN, l1.getCallCount());
+    assertTrue("Compiled before the first call", l1.getCompiled() != nullptr);
+    assertEquals("Compiled behavior", u"10%", l1.formatInt(10, status).toString());
+
+    // Copies share the compiled form.
+    LocalizedNumberFormatter l2 = l1;
+    assertTrue("[constructor] Copy shares the compiled form", l1.getCompiled() == l2.getCompiled());
+    assertEquals("[constructor] Copy behavior", u"12.5%", l2.formatDouble(12.5, status).toString());
+    LocalizedNumberFormatter l3 = NumberFormatter::withLocale("de");
+    l3.formatInt(1, status);
+    l3 = l2;
+    assertEquals("[assignment] Copy shares the compiled form", INT32_MIN, l3.getCallCount());
+    assertTrue("[assignment] Copy shares the compiled form", l1.getCompiled() == l3.getCompiled());
+    l3 = l3;
+    assertEquals("[assignment] Self-assignment behavior", u"1,000%", l3.formatInt(1000, status).toString());
+    assertTrue("compile() of a compiled formatter shares", l1.compile(status).getCompiled() == l1.getCompiled());
+
+    // Moves carry the shared form along.
+    LocalizedNumberFormatter l4 = std::move(l2);
+    assertTrue("[constructor] Move has the compiled form", l4.getCompiled() == l1.getCompiled());
+    LocalizedNumberFormatter l5 = l4;
+    assertTrue("[constructor] Copy of the moved formatter shares", l5.getCompiled() == l1.getCompiled());
+
+    // A formatter with different settings starts over.
+    LocalizedNumberFormatter l6 = l1.sign(UNUM_SIGN_ALWAYS);
+    assertTrue("Changed settings are not compiled", l6.getCompiled() == nullptr);
+    assertEquals("Changed settings behavior", u"+10%", l6.formatInt(10, status).toString());
+
+    // An error in the settings is reported, and nothing is compiled.
+    status.errIfFailureAndReset();
+    LocalizedNumberFormatter l7 = NumberFormatter::withLocale("en").precision(Precision::maxFraction(1000))
+            .compile(status);
+    assertEquals("Error in the settings", U_NUMBER_ARG_OUTOFBOUNDS_ERROR, status.reset());
+    assertTrue("Error in the settings", l7.getCompiled() == nullptr);
+}
+
+void NumberFormatterApiTest::formatBatch() {
+    IcuTestErrorCode status(*this, "formatBatch");
+    static const double values[] = {87650, -8.765, 0, 1e-7, 1e20, 42};
+    const int32_t count = UPRV_LENGTHOF(values);
+    LocalizedNumberFormatter formatters[] = {
+        NumberFormatter::withLocale("en").threshold(0), // never compiles
+        NumberFormatter::withLocale("de").unit(NoUnit::percent()).compile(status),
+        NumberFormatter::withLocale("en").notation(Notation::compactShort()),
+    };
+    if (status.errDataIfFailureAndReset()) { return; }
+
+    for (int32_t i = 0; i < UPRV_LENGTHOF(formatters); i++) {
+        const LocalizedNumberFormatter& lnf = formatters[i];
+        status.setScope(UnicodeString(u"formatter ") + Int64ToUnicodeString(i));
+        UnicodeString expected;
+        for (int32_t j = 0; j < count; j++) {
+            expected.append(lnf.formatDouble(values[j], status).toString());
+        }
+
+        // Preflighting
+        int32_t offsets[count + 1];
+        int32_t length = lnf.formatBatch(values, count, nullptr, 0, offsets, status);
+        assertEquals("Preflighting error", U_BUFFER_OVERFLOW_ERROR, status.reset());
+        assertEquals("Preflighting length", expected.length(), length);
+
+        char16_t buffer[200];
+        length = lnf.formatBatch(values, count, buffer, UPRV_LENGTHOF(buffer), offsets, status);
+        status.errIfFailureAndReset();
+        assertEquals("Contiguous results", expected, UnicodeString(buffer, length));
+        assertEquals("Offset after the last result", length, offsets[count]);
+        for (int32_t j = 0; j < count; j++) {
+            UnicodeString single = lnf.formatDouble(values[j], status).toString();
+            assertEquals("Result at its offset", single,
+                         UnicodeString(buffer + offsets[j], offsets[j + 1] - offsets[j]));
+        }
+    }
+    status.setScope(u"");
+
+    assertEquals("Empty batch", 0, formatters[0].formatBatch(nullptr, 0, nullptr, 0, nullptr, status));
+    status.errIfFailureAndReset();
+    char16_t buffer[10];
+    formatters[0].formatBatch(values, -1, buffer, UPRV_LENGTHOF(buffer), nullptr, status);
+    assertEquals("Negative count", U_ILLEGAL_ARGUMENT_ERROR, status.reset());
+}
+
+void NumberFormatterApiTest::formatFixedPointAndDecimal128() {
+    IcuTestErrorCode status(*this, "formatFixedPointAndDecimal128");
+    LocalizedNumberFormatter lnf = NumberFormatter::withLocale("en-US")
+        .unit(CurrencyUnit(u"USD", status));
+    if (status.errDataIfFailureAndReset()) { return; }
+
+    assertEquals("Cents", u"$1,234.56", lnf.formatFixedPoint(123456, 2, status).toString());
+    assertEquals("Negative cents", u"-$0.05", lnf.formatFixedPoint(-5, 2, status).toString());
+    // 9223372036854775807 is not exactly representable as a double.
+    assertEquals("Large mantissa", u"$92,233,720,368,547,758.07",
+        lnf.formatFixedPoint(INT64_MAX, 2, status).toString());
+
+    // -12345 * 10^-2 in BID encoding
+    static const uint64_t kHigh = (static_cast<uint64_t>(1) << 63) | (static_cast<uint64_t>(6174) << 49);
+    assertEquals("Decimal128", u"-$123.45", lnf.formatDecimal128(kHigh, 12345, status).toString());
+    assertEquals("Decimal128 infinity", u"$\u221E",
+        lnf.formatDecimal128(0x7800000000000000ULL, 0, status).toString());
+    status.errIfFailureAndReset();
+}
 
 void NumberFormatterApiTest::assertFormatDescending(const char16_t* umessage, const char16_t* uskeleton,
                                                     const UnlocalizedNumberFormatter& f, Locale locale,
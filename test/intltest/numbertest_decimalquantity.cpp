@@ -25,7 +25,9 @@ void DecimalQuantityTest::runIndexedTest(int32_t index, UBool exec, const char *
         TESTCASE_AUTO(testUseApproximateDoubleWhenAble);
         TESTCASE_AUTO(testHardDoubleConversion);
         TESTCASE_AUTO(testToDouble);
+        TESTCASE_AUTO(testRoundToIncrementAndMultiply);
         TESTCASE_AUTO(testMaxDigits);
+        TESTCASE_AUTO(testFixedPointAndDecimal128);
     TESTCASE_AUTO_END;
 }
 
@@ -103,21 +105,50 @@ void DecimalQuantityTest::testSwitchStorage() {
     UErrorCode status = U_ZERO_ERROR;
     DecimalQuantity fq;
 
-    fq.setToLong(1234123412341234L);
+    fq.setToDecNumber({"12341234123412341234123412341234", -1}, status);
+    assertSuccess("Setting decimal number", status);
     assertFalse("Should not be using byte array", fq.isUsingBytes());
-    assertEquals("Failed on initialize", u"1.234123412341234E+15", fq.toScientificString());
+    assertEquals("Failed on initialize", u"1.2341234123412341234123412341234E+31", fq.toScientificString());
     assertHealth(fq);
     // Long -> Bytes
     fq.appendDigit(5, 0, true);
     assertTrue("Should be using byte array", fq.isUsingBytes());
-    assertEquals("Failed on multiply", u"1.2341234123412345E+16", fq.toScientificString());
+    assertEquals("Failed on multiply", u"1.23412341234123412341234123412345E+32", fq.toScientificString());
     assertHealth(fq);
     // Bytes -> Long
     fq.roundToMagnitude(5, RoundingMode::UNUM_ROUND_HALFEVEN, status);
     assertSuccess("Rounding to magnitude", status);
     assertFalse("Should not be using byte array", fq.isUsingBytes());
-    assertEquals("Failed on round", u"1.23412341234E+16", fq.toScientificString());
+    assertEquals("Failed on round", u"1.234123412341234123412341234E+32", fq.toScientificString());
     assertHealth(fq);
+
+    // Doubles with 17 significant digits fit into the packed BCD.
+    fq.setToDouble(0.1 + 0.2);
+    fq.roundToInfinity();
+    assertFalse("17 digits should not be using byte array", fq.isUsingBytes());
+    assertEquals("17 digits", u"3.0000000000000004E-1", fq.toScientificString());
+    assertHealth(fq);
+    fq.setToLong(INT64_MAX);
+    assertFalse("19 digits should not be using byte array", fq.isUsingBytes());
+    assertEquals("19 digits", u"9.223372036854775807E+18", fq.toScientificString());
+    assertHealth(fq);
+
+    // Rounding across the boundary between the two longs of the packed BCD.
+    static const struct RoundCase {
+        const char* input;
+        const char16_t* expected;
+    } roundCases[] = {
+        {"1999999999999999999999.5", u"2E+21"},
+        {"1000000000000000000000.5", u"1E+21"},
+        {"100000000000000000.50000000000001", u"1.00000000000000001E+17"},
+        {"2999999999999999.9999999999999999", u"3E+15"} };
+    for (const auto& cas : roundCases) {
+        fq.setToDecNumber({cas.input, -1}, status);
+        fq.roundToMagnitude(0, RoundingMode::UNUM_ROUND_HALFEVEN, status);
+        assertSuccess("Rounding across the longs", status);
+        assertEquals(UnicodeString("Rounding ") + cas.input, cas.expected, fq.toScientificString());
+        assertHealth(fq);
+    }
 }
 
 void DecimalQuantityTest::testCopyMove() {
@@ -147,23 +178,23 @@ void DecimalQuantityTest::testCopyMove() {
     {
         IcuTestErrorCode status(*this, "testCopyMove");
         DecimalQuantity a;
-        a.setToDecNumber({"1234567890123456789", -1}, status);
+        a.setToDecNumber({"1234567890123456789012345678901234", -1}, status);
         DecimalQuantity b = a; // copy constructor
-        assertToStringAndHealth(a, u"<DecimalQuantity 999:0:0:-999 bytes 1234567890123456789E0>");
-        assertToStringAndHealth(b, u"<DecimalQuantity 999:0:0:-999 bytes 1234567890123456789E0>");
+        assertToStringAndHealth(a, u"<DecimalQuantity 999:0:0:-999 bytes 1234567890123456789012345678901234E0>");
+        assertToStringAndHealth(b, u"<DecimalQuantity 999:0:0:-999 bytes 1234567890123456789012345678901234E0>");
         DecimalQuantity c(std::move(a)); // move constructor
-        assertToStringAndHealth(c, u"<DecimalQuantity 999:0:0:-999 bytes 1234567890123456789E0>");
-        c.setToDecNumber({"9876543210987654321", -1}, status);
-        assertToStringAndHealth(c, u"<DecimalQuantity 999:0:0:-999 bytes 9876543210987654321E0>");
+        assertToStringAndHealth(c, u"<DecimalQuantity 999:0:0:-999 bytes 1234567890123456789012345678901234E0>");
+        c.setToDecNumber({"9876543210987654321098765432109811", -1}, status);
+        assertToStringAndHealth(c, u"<DecimalQuantity 999:0:0:-999 bytes 9876543210987654321098765432109811E0>");
         c = b; // copy assignment
-        assertToStringAndHealth(b, u"<DecimalQuantity 999:0:0:-999 bytes 1234567890123456789E0>");
-        assertToStringAndHealth(c, u"<DecimalQuantity 999:0:0:-999 bytes 1234567890123456789E0>");
-        b.setToDecNumber({"876543210987654321", -1}, status);
-        c.setToDecNumber({"987654321098765432", -1}, status);
+        assertToStringAndHealth(b, u"<DecimalQuantity 999:0:0:-999 bytes 1234567890123456789012345678901234E0>");
+        assertToStringAndHealth(c, u"<DecimalQuantity 999:0:0:-999 bytes 1234567890123456789012345678901234E0>");
+        b.setToDecNumber({"8765432109876543210987654321098765", -1}, status);
+        c.setToDecNumber({"9876543210987654321098765432109812", -1}, status);
         c = std::move(b); // move assignment
-        assertToStringAndHealth(c, u"<DecimalQuantity 999:0:0:-999 bytes 876543210987654321E0>");
+        assertToStringAndHealth(c, u"<DecimalQuantity 999:0:0:-999 bytes 8765432109876543210987654321098765E0>");
         a = std::move(c); // move assignment to a defunct object
-        assertToStringAndHealth(a, u"<DecimalQuantity 999:0:0:-999 bytes 876543210987654321E0>");
+        assertToStringAndHealth(a, u"<DecimalQuantity 999:0:0:-999 bytes 8765432109876543210987654321098765E0>");
     }
 }
 
@@ -347,7 +378,18 @@ void DecimalQuantityTest::testToDouble() {
     } cases[] = {
             { "0", 0.0 },
             { "514.23", 514.23 },
-            { "-3.142E-271", -3.142e-271 } };
+            { "-3.142E-271", -3.142e-271 },
+            { "0.1", 0.1 },
+            { "123456789012345", 123456789012345.0 },
+            { "-98765.4321098765E21", -98765.4321098765e21 },
+            { "1E22", 1e22 },
+            { "1234567890123456789", 1234567890123456789.0 },
+            { "9007199254740993", 9007199254740993.0 },
+            { "3.14159265358979323846264338327950", 3.14159265358979323846264338327950 },
+            { "1.7976931348623157E308", 1.7976931348623157e308 },
+            { "2.2250738585072011E-308", 2.2250738585072011e-308 },
+            { "4.9E-324", 4.9e-324 },
+            { "1E-400", 0.0 } };
 
     for (auto& cas : cases) {
         status.setScope(cas.input);
@@ -358,6 +400,57 @@ void DecimalQuantityTest::testToDouble() {
     }
 }
 
+void DecimalQuantityTest::testRoundToIncrementAndMultiply() {
+    IcuTestErrorCode status(*this, "testRoundToIncrementAndMultiply");
+    static const struct IncrementCase {
+        const char* input;
+        double increment;
+        UNumberFormatRoundingMode mode;
+        int32_t maxFrac;
+        const char* expected;
+    } incrementCases[] = {
+            { "-74.67", 0.07, UNUM_ROUND_UP, 2, "-74.69" },
+            { "0.075", 0.05, UNUM_ROUND_HALFEVEN, 2, "0.1" },
+            { "0.125", 0.05, UNUM_ROUND_HALFEVEN, 2, "0.1" },
+            { "1.005", 0.01, UNUM_ROUND_HALFUP, 2, "1.01" },
+            { "1234.5", 500, UNUM_ROUND_HALFEVEN, 0, "1000" },
+            { "1750", 500, UNUM_ROUND_HALFEVEN, 0, "2000" },
+            { "0.02", 0.05, UNUM_ROUND_DOWN, 2, "0" },
+            { "123456789.123456789123", 0.05, UNUM_ROUND_HALFEVEN, 2, "123456789.1" } };
+
+    for (auto& cas : incrementCases) {
+        status.setScope(cas.input);
+        DecimalQuantity q;
+        q.setToDecNumber({cas.input, -1}, status);
+        q.roundToIncrement(cas.increment, cas.mode, cas.maxFrac, status);
+        assertEquals("roundToIncrement", cas.expected, q.toPlainString());
+        assertHealth(q);
+    }
+
+    static const struct MultiplyCase {
+        const char* input;
+        const char* multiplicand;
+        const char* expected;
+    } multiplyCases[] = {
+            { "12.34", "1.5", "18.51" },
+            { "-2", "0.001", "-0.002" },
+            { "-7.5", "-4", "30" },
+            { "999999999", "999999999", "999999998000000001" },
+            { "123456789012345678", "3", "370370367037037034" },
+            { "0.5", "1234567890.5", "617283945.25" } };
+
+    for (auto& cas : multiplyCases) {
+        status.setScope(cas.input);
+        DecimalQuantity q;
+        q.setToDecNumber({cas.input, -1}, status);
+        DecNum multiplicand;
+        multiplicand.setTo(cas.multiplicand, status);
+        q.multiplyBy(multiplicand, status);
+        assertEquals("multiplyBy", cas.expected, q.toPlainString());
+        assertHealth(q);
+    }
+}
+
 void DecimalQuantityTest::testMaxDigits() {
     IcuTestErrorCode status(*this, "testMaxDigits");
     DecimalQuantity dq;
@@ -380,4 +473,73 @@ void DecimalQuantityTest::testMaxDigits() {
     }
 }
 
+void DecimalQuantityTest::testFixedPointAndDecimal128() {
+    IcuTestErrorCode status(*this, "testFixedPointAndDecimal128");
+    static const struct FixedPointCase {
+        int64_t mantissa;
+        int32_t scale;
+        const char* expected; // char* for the decNumber constructor
+    } fixedPointCases[] = {
+            { 12345, 2, "123.45" },
+            { -500, 2, "-5" },
+            { 7, -3, "7000" },
+            { 1, 20, "1E-20" },
+            { 0, 5, "0" },
+            { INT64_MAX, 4, "922337203685477.5807" },
+            { INT64_MIN, 18, "-9.223372036854775808" } };
+
+    for (auto& cas : fixedPointCases) {
+        status.setScope(cas.expected);
+        DecimalQuantity expected;
+        expected.setToDecNumber({cas.expected, -1}, status);
+        DecimalQuantity actual;
+        actual.setToFixedPoint(cas.mantissa, cas.scale);
+        assertHealth(actual);
+        assertEquals("Fixed point", expected.toScientificString(), actual.toScientificString());
+        assertEquals("Fixed point sign", expected.isNegative(), actual.isNegative());
+    }
+
+    // BID encoding: sign bit, 14-bit exponent biased by 6176, 113-bit coefficient
+    static const uint64_t kSign = static_cast<uint64_t>(1) << 63;
+    static const struct Decimal128Case {
+        uint64_t high;
+        uint64_t low;
+        const char* expected;
+    } decimal128Cases[] = {
+            { static_cast<uint64_t>(6176) << 49, 1, "1" },
+            { kSign | static_cast<uint64_t>(6174) << 49, 12345, "-123.45" },
+            { static_cast<uint64_t>(6176 + 100) << 49, 42, "4.2E+101" },
+            { static_cast<uint64_t>(6176 - 80) << 49 | 1, 0, "1.8446744073709551616E-61" },
+            { static_cast<uint64_t>(6176) << 49 | 0x1ed09bead87c0ULL, 0x378d8e63ffffffffULL,
+              "9999999999999999999999999999999999" },
+            { static_cast<uint64_t>(6165) << 49 | 0x33b2e3cULL, 0x9fd0803ce8000000ULL, "10000000000000000" },
+            // A coefficient of 10^34 is non-canonical and reads as 0.
+            { static_cast<uint64_t>(6176) << 49 | 0x1ed09bead87c0ULL, 0x378d8e6400000000ULL, "0" },
+            // So is a coefficient with the combination field starting with 11.
+            { 0x6000000000000000ULL, 5, "0" },
+            { static_cast<uint64_t>(3000) << 49, 0, "0" } };
+
+    for (auto& cas : decimal128Cases) {
+        status.setScope(cas.expected);
+        DecimalQuantity expected;
+        expected.setToDecNumber({cas.expected, -1}, status);
+        DecimalQuantity actual;
+        actual.setToDecimal128(cas.high, cas.low);
+        assertHealth(actual);
+        assertEquals("Decimal128", expected.toScientificString(), actual.toScientificString());
+        assertEquals("Decimal128 sign", expected.isNegative(), actual.isNegative());
+    }
+    status.setScope("");
+
+    DecimalQuantity special;
+    special.setToDecimal128(0x7800000000000000ULL, 0);
+    assertTrue("Infinity", special.isInfinite() && !special.isNegative());
+    special.setToDecimal128(kSign | 0x7800000000000000ULL, 0);
+    assertTrue("-Infinity", special.isInfinite() && special.isNegative());
+    special.setToDecimal128(0x7c00000000000000ULL, 0);
+    assertTrue("NaN", special.isNaN());
+    special.setToDecimal128(0x7e00000000000000ULL, 1);
+    assertTrue("Signaling NaN", special.isNaN());
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -7,8 +7,12 @@
 
 #include "numbertest.h"
 #include "double-conversion.h"
+#include "number_ryu.h"
+#include "cmemory.h"
+#include <float.h>
 
 using namespace double_conversion;
+using icu::number::impl::doubleToShortestDigits;
 
 void DoubleConversionTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char *) {
     if (exec) {
@@ -16,6 +20,7 @@ void DoubleConversionTest::runIndexedTest(int32_t index, UBool exec, const char
     }
     TESTCASE_AUTO_BEGIN;
         TESTCASE_AUTO(testDoubleConversionApi);
+        TESTCASE_AUTO(testShortestDigits);
     TESTCASE_AUTO_END;
 }
 
@@ -42,4 +47,53 @@ void DoubleConversionTest::testDoubleConversionApi() {
     assertEquals("Scale", 2, point);
 }
 
+void DoubleConversionTest::checkShortestDigits(double v) {
+    char expected[DoubleToStringConverter::kBase10MaximalLength + 1];
+    bool sign;
+    int32_t expectedLength;
+    int32_t expectedPoint;
+    DoubleToStringConverter::DoubleToAscii(
+        v, DoubleToStringConverter::DtoaMode::SHORTEST, 0,
+        expected, sizeof(expected), &sign, &expectedLength, &expectedPoint);
+    char actual[icu::number::impl::kMaxShortestDigits];
+    int32_t actualLength;
+    int32_t actualPoint;
+    doubleToShortestDigits(v, actual, actualLength, actualPoint);
+    if (actualLength != expectedLength || actualPoint != expectedPoint ||
+            uprv_memcmp(actual, expected, actualLength) != 0) {
+        errln(UnicodeString(u"Ryu digits of ") + DoubleToUnicodeString(v) + u": " +
+              UnicodeString(actual, actualLength, US_INV) + u" point " + Int64ToUnicodeString(actualPoint) +
+              u" vs. DoubleToAscii " + UnicodeString(expected, expectedLength, US_INV) +
+              u" point " + Int64ToUnicodeString(expectedPoint));
+    }
+}
+
+void DoubleConversionTest::testShortestDigits() {
+    static const double cases[] = {
+        87.65, 0.1, 0.3, 1.0, 1e22, 1e23, 4.35, 2.0 / 3, 9007199254740993.0, 123456789012345680.0,
+        5e-324, DBL_MIN, 2.2250738585072009e-308, DBL_MAX, 1.7976931348623157e-300,
+        // Hard cases for Grisu3, from testConvertToAccurateDouble:
+        1651087494906221570.0, 83602530019752571E-327, 2.207817077636718750000000000000
+    };
+    for (double v : cases) {
+        checkShortestDigits(v);
+    }
+    // Pseudo-random bit patterns, including subnormals and powers of 2.
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (int32_t i = 0; i < 100000; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint64_t bits = state & 0x7fffffffffffffffULL;
+        if (i % 4 == 1) {
+            bits &= 0x000fffffffffffffULL;
+        } else if (i % 4 == 2) {
+            bits &= 0x7ff0000000000000ULL;
+        }
+        double v;
+        uprv_memcpy(&v, &bits, sizeof(v));
+        if (v > 0 && v <= DBL_MAX) {
+            checkShortestDigits(v);
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
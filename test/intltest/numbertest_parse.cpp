@@ -7,6 +7,7 @@
 
 #include "numbertest.h"
 #include "numparse_impl.h"
+#include "number_patternstring.h"
 #include "static_unicode_sets.h"
 #include "unicode/dcfmtsym.h"
 #include "unicode/testlog.h"
@@ -25,6 +26,7 @@ void NumberParserTest::runIndexedTest(int32_t index, UBool exec, const char*& na
         TESTCASE_AUTO(testSeriesMatcher);
         TESTCASE_AUTO(testCombinedCurrencyMatcher);
         TESTCASE_AUTO(testAffixPatternMatcher);
+        TESTCASE_AUTO(testAsciiFastPath);
     TESTCASE_AUTO_END;
 }
 
@@ -351,4 +353,58 @@ void NumberParserTest::testAffixPatternMatcher() {
 }
 
 
+void NumberParserTest::testAsciiFastPath() {
+    IcuTestErrorCode status(*this, "testAsciiFastPath");
+    const struct TestCase {
+        const char* locale;
+        const char16_t* pattern;
+    } patterns[] = {{"en", u"#,##0.###"},
+                    {"en", u"#,##0%"},
+                    {"de", u"#,##0.###"},
+                    {"fr", u"#,##0.###"},
+                    {"ar", u"#,##0.###"},
+                    {"en", u"0.###;(0.###)"}};
+    const char16_t* inputs[] = {u"51423", u"-51423", u"0", u"-0", u"007", u"1.50", u"1,50", u"12.", u".5",
+                                u"-.5", u"12345678901234567890.125", u"-999999999999999999", u"1.2.3",
+                                u"1,234", u"-", u".", u"+5", u"5-"};
+
+    for (int32_t i = 0; i < 2 * UPRV_LENGTHOF(patterns); i++) {
+        // The fast path is only for lenient parsers; check the strict ones too.
+        const TestCase& pattern = patterns[i / 2];
+        ParseMode parseMode = (i % 2) == 0 ? PARSE_MODE_LENIENT : PARSE_MODE_STRICT;
+        DecimalFormatSymbols symbols(pattern.locale, status);
+        DecimalFormatProperties properties;
+        PatternParser::parseToExistingProperties(pattern.pattern, properties, IGNORE_ROUNDING_NEVER, status);
+        properties.parseMode = parseMode;
+        LocalPointer<const NumberParserImpl> parser(
+                NumberParserImpl::createParserFromProperties(properties, symbols, false, status), status);
+        if (status.errDataIfFailureAndReset()) {
+            continue;
+        }
+        for (auto* input : inputs) {
+            // A leading bidi mark is ignorable, but it is not ASCII, so it takes the general path.
+            UnicodeString slowInput(u"\u200E");
+            slowInput.append(input);
+            UnicodeString message = UnicodeString(pattern.locale) + u" " + pattern.pattern +
+                    (parseMode == PARSE_MODE_LENIENT ? u" lenient " : u" strict ") + input;
+            ParsedNumber fast;
+            parser->parse(input, true, fast, status);
+            ParsedNumber slow;
+            parser->parse(slowInput, true, slow, status);
+            status.setScope(message);
+            status.errIfFailureAndReset();
+            // Compare the results for input that the general path consumes completely:
+            // That is the input for which the fast path may be taken.
+            bool slowComplete = slow.success() && slow.charEnd == slowInput.length();
+            bool fastComplete = fast.success() && fast.charEnd == u_strlen(input);
+            assertEquals(message + u" complete", slowComplete, fastComplete);
+            if (slowComplete && fastComplete) {
+                assertEquals(message + u" flags", slow.flags, fast.flags);
+                assertEquals(message + u" quantity", slow.quantity.toString(), fast.quantity.toString());
+                assertEquals(message + u" double", slow.getDouble(), fast.getDouble());
+            }
+        }
+    }
+}
+
 #endif
@@ -17,6 +17,7 @@ void PatternModifierTest::runIndexedTest(int32_t index, UBool exec, const char *
         TESTCASE_AUTO(testBasic);
         TESTCASE_AUTO(testPatternWithNoPlaceholder);
         TESTCASE_AUTO(testMutableEqualsImmutable);
+        TESTCASE_AUTO(testSharedImmutable);
     TESTCASE_AUTO_END;
 }
 
@@ -167,6 +168,55 @@ void PatternModifierTest::testMutableEqualsImmutable() {
     assertFalse(nsb1.toUnicodeString() + " vs " + nsb3.toUnicodeString(), nsb1.contentEquals(nsb3));
 }
 
+void PatternModifierTest::testSharedImmutable() {
+    UErrorCode status = U_ZERO_ERROR;
+    MutablePatternModifier mod(false);
+    ParsedPatternInfo patternInfo;
+    PatternParser::parseToPatternInfo(u"a0b;c-0d", patternInfo, status);
+    assertSuccess("Spot 1", status);
+    mod.setPatternInfo(&patternInfo);
+    mod.setPatternAttributes(UNUM_SIGN_AUTO, false);
+    DecimalFormatSymbols symbols(Locale::getEnglish(), status);
+    CurrencySymbols currencySymbols({u"USD", status}, "en", status);
+    if (!assertSuccess("Spot 2", status, true)) {
+        return;
+    }
+    mod.setSymbols(&symbols, &currencySymbols, UNUM_UNIT_WIDTH_SHORT, nullptr);
+
+    // The key is normally built by NumberFormatterImpl; any string that identifies the settings will do.
+    UnicodeString key(u"PatternModifierTest a0b;c-0d");
+    LocalPointer<ImmutablePatternModifier> imod1(
+            mod.createSharedImmutableAndChain(nullptr, Locale::getEnglish(), key, status), status);
+    LocalPointer<ImmutablePatternModifier> imod2(
+            mod.createSharedImmutableAndChain(nullptr, Locale::getEnglish(), key, status), status);
+    LocalPointer<ImmutablePatternModifier> imod3(
+            mod.createSharedImmutableAndChain(nullptr, Locale::getGerman(), key, status), status);
+    if (!assertSuccess("Spot 3", status)) {
+        return;
+    }
+    assertTrue("Same key shares the modifiers",
+               imod1->getModifier(-1, StandardPlural::Form::COUNT) ==
+               imod2->getModifier(-1, StandardPlural::Form::COUNT));
+    assertTrue("Different locale does not share the modifiers",
+               imod1->getModifier(-1, StandardPlural::Form::COUNT) !=
+               imod3->getModifier(-1, StandardPlural::Form::COUNT));
+
+    // The shared modifiers behave like the unshared ones, and outlive the first user.
+    LocalPointer<ImmutablePatternModifier> imod4(mod.createImmutable(status), status);
+    if (!assertSuccess("Spot 4", status)) {
+        return;
+    }
+    imod1.adoptInstead(nullptr);
+    for (int8_t signum = -1; signum <= 1; signum++) {
+        NumberStringBuilder nsb2;
+        imod2->getModifier(signum, StandardPlural::Form::COUNT)->apply(nsb2, 0, 0, status);
+        NumberStringBuilder nsb4;
+        imod4->getModifier(signum, StandardPlural::Form::COUNT)->apply(nsb4, 0, 0, status);
+        assertSuccess("Spot 5", status);
+        assertTrue(nsb2.toUnicodeString() + " vs " + nsb4.toUnicodeString(), nsb2.contentEquals(nsb4));
+    }
+}
+
 UnicodeString PatternModifierTest::getPrefix(const MutablePatternModifier &mod, UErrorCode &status) {
     NumberStringBuilder nsb;
     mod.apply(nsb, 0, 0, status);
@@ -49,6 +49,7 @@ void NumberRangeFormatterTest::runIndexedTest(int32_t index, UBool exec, const c
         TESTCASE_AUTO(testDifferentFormatters);
         TESTCASE_AUTO(testPlurals);
         TESTCASE_AUTO(testCopyMove);
+        TESTCASE_AUTO(testSharedData);
     TESTCASE_AUTO_END;
 }
 
@@ -765,6 +766,49 @@ void NumberRangeFormatterTest::testCopyMove() {
     assertEquals("FormattedNumberRange move assignment", u"3,00–6,00 $US", result.toString(status));
 }
 
+void NumberRangeFormatterTest::testSharedData() {
+    IcuTestErrorCode status(*this, "testSharedData");
+
+    // Range formatters for the same locale share the range patterns, plural ranges
+    // and compact patterns; they must still format alike after the formatter that
+    // loaded them is gone.
+    UnlocalizedNumberRangeFormatter unrf = NumberRangeFormatter::with()
+        .numberFormatterBoth(NumberFormatter::with().notation(Notation::compactLong()));
+    {
+        LocalizedNumberRangeFormatter first = unrf.locale("de-CH");
+        assertEquals("First compact", u"5 Tausend – 5 Millionen",
+            first.formatFormattableRange(5000, 5000000, status).toString(status));
+        if (status.errDataIfFailureAndReset()) { return; }
+    }
+    LocalizedNumberRangeFormatter second = unrf.locale("de-CH");
+    assertEquals("Second compact", u"5 Tausend – 5 Millionen",
+        second.formatFormattableRange(5000, 5000000, status).toString(status));
+    assertEquals("Second approximately", u"≈5 Tausend",
+        second.formatFormattableRange(5000, 5000, status).toString(status));
+
+    // Long and short compact patterns are different cache entries.
+    assertEquals("Short compact", u"3K – 5K m",
+        NumberRangeFormatter::withLocale("en-us")
+            .numberFormatterBoth(NumberFormatter::with().notation(Notation::compactShort()).unit(METER))
+            .formatFormattableRange(3000, 5000, status).toString(status));
+
+    UnlocalizedNumberRangeFormatter plurals = NumberRangeFormatter::with()
+        .numberFormatterBoth(NumberFormatter::with()
+            .unit(GBP)
+            .unitWidth(UNUM_UNIT_WIDTH_FULL_NAME)
+            .precision(Precision::integer()));
+    {
+        LocalizedNumberRangeFormatter first = plurals.locale("sl");
+        assertEquals("First plurals", u"1–2 britanska funta",
+            first.formatFormattableRange(1, 2, status).toString(status));
+    }
+    LocalizedNumberRangeFormatter second2 = plurals.locale("sl");
+    assertEquals("Second plurals, one + two", u"1–2 britanska funta",
+        second2.formatFormattableRange(1, 2, status).toString(status));
+    assertEquals("Second plurals, one + one", u"1–1 britanski funti",
+        second2.formatFormattableRange(1, 1, status).toString(status));
+}
+
 void  NumberRangeFormatterTest::assertFormatRange(
       const char16_t* message,
       const UnlocalizedNumberRangeFormatter& f,
@@ -42,6 +42,7 @@
 #include "unicode/msgfmt.h"
 #include "number_decimalquantity.h"
 #include "unicode/numberformatter.h"
+#include "unicode/numberparser.h"
 
 #if (U_PLATFORM == U_PF_AIX) || (U_PLATFORM == U_PF_OS390)
 // These should not be macros. If they are,
@@ -219,6 +220,7 @@ void NumberFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &n
   TESTCASE_AUTO(Test20037_ScientificIntegerOverflow);
   TESTCASE_AUTO(Test13840_ParseLongStringCrash);
   TESTCASE_AUTO(Test13850_EmptyStringCurrency);
+  TESTCASE_AUTO(TestNumberParser);
   TESTCASE_AUTO_END;
 }
 
@@ -9297,4 +9299,79 @@ void NumberFormatTest::Test13850_EmptyStringCurrency() {
     }
 }
 
+void NumberFormatTest::TestNumberParser() {
+    IcuTestErrorCode status(*this, "TestNumberParser");
+    LocalPointer<DecimalFormat> df(dynamic_cast<DecimalFormat*>(
+        NumberFormat::createCurrencyInstance("en-US", status)), status);
+    if (status.errDataIfFailureAndReset()) { return; }
+    number::NumberParser parser = df->toNumberParser(status);
+    status.errIfFailureAndReset();
+
+    static const UChar* inputs[] = {
+        u"$1,234.56", u"-$7.00", u"$0.5", u"12", u"1.5E3", u"abc", u"$", u"US$3.00 tail", u"USD 42"
+    };
+    for (const UChar* input : inputs) {
+        UnicodeString text(input);
+        Formattable expected;
+        Formattable actual;
+        ParsePosition expectedPos;
+        ParsePosition actualPos;
+        df->parse(text, expected, expectedPos);
+        parser.parse(text, actual, actualPos);
+        assertEquals(text + u": index", expectedPos.getIndex(), actualPos.getIndex());
+        assertEquals(text + u": error index", expectedPos.getErrorIndex(), actualPos.getErrorIndex());
+        assertTrue(text + u": number", expected == actual);
+
+        expectedPos.setIndex(0);
+        actualPos.setIndex(0);
+        LocalPointer<CurrencyAmount> expectedAmount(df->parseCurrency(text, expectedPos));
+        LocalPointer<CurrencyAmount> actualAmount(parser.parseCurrency(text, actualPos));
+        assertEquals(text + u": currency index", expectedPos.getIndex(), actualPos.getIndex());
+        assertEquals(text + u": currency success", expectedAmount.isValid(), actualAmount.isValid());
+        if (expectedAmount.isValid() && actualAmount.isValid()) {
+            assertTrue(text + u": currency amount", *expectedAmount == *actualAmount);
+        }
+    }
+
+    // The parser is a snapshot: Changing or deleting the DecimalFormat does not affect it.
+    df->setParseIntegerOnly(TRUE);
+    df->setPositivePrefix(u"+");
+    Formattable result;
+    ParsePosition ppos;
+    parser.parse(u"$1,234.56", result, ppos);
+    assertEquals("after setters", 1234.56, result.getDouble(status));
+    df.adoptInstead(nullptr);
+    ppos.setIndex(0);
+    parser.parse(u"$2.50", result, ppos);
+    assertEquals("after delete", 2.5, result.getDouble(status));
+
+    // Moving leaves the source empty; an empty parser does not accept anything.
+    number::NumberParser moved(std::move(parser));
+    ppos.setIndex(0);
+    moved.parse(u"$3.25", result, ppos);
+    assertEquals("moved", 3.25, result.getDouble(status));
+    ppos.setIndex(0);
+    parser.parse(u"$3.25", result, ppos);
+    assertEquals("empty parser index", 0, ppos.getIndex());
+    assertEquals("empty parser error index", 0, ppos.getErrorIndex());
+    ppos.setErrorIndex(-1);
+    LocalPointer<CurrencyAmount> amount(parser.parseCurrency(u"$3.25", ppos));
+    assertTrue("empty parser currency", amount.isNull());
+    parser = std::move(moved);
+    ppos.setIndex(0);
+    parser.parse(u"$4.75", result, ppos);
+    assertEquals("move-assigned", 4.75, result.getDouble(status));
+    status.errIfFailureAndReset();
+
+    // The parser keeps the settings of the DecimalFormat at the time it was created.
+    DecimalFormat intOnly(u"#,##0.###", new DecimalFormatSymbols(Locale::getEnglish(), status), status);
+    intOnly.setParseIntegerOnly(TRUE);
+    number::NumberParser intParser = intOnly.toNumberParser(status);
+    status.errIfFailureAndReset();
+    ppos.setIndex(0);
+    intParser.parse(u"1,234.56", result, ppos);
+    assertEquals("integer only", 1234.0, result.getDouble(status));
+    assertEquals("integer only index", 5, ppos.getIndex());
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
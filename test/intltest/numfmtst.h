@@ -283,6 +283,7 @@ class NumberFormatTest: public CalendarTimeZoneTest {
     void Test20037_ScientificIntegerOverflow();
     void Test13840_ParseLongStringCrash();
     void Test13850_EmptyStringCurrency();
+    void TestNumberParser();
 
  private:
     UBool testFormattableAsUFormattable(const char *file, int line, Formattable &f);
@@ -0,0 +1,176 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ohashmaptest.cpp
+// created: 2026oct14
+
+#include "unicode/utypes.h"
+#include "intltest.h"
+#include "ohashmap.h"
+
+namespace {
+
+struct IntTraits {
+    static int32_t hash(const int32_t &key) { return key; }
+    static UBool equals(const int32_t &key1, const int32_t &key2) { return key1 == key2; }
+};
+
+// All keys collide, so that all lookups probe past full groups.
+struct CollidingTraits {
+    static int32_t hash(const int32_t & /*key*/) { return 5; }
+    static UBool equals(const int32_t &key1, const int32_t &key2) { return key1 == key2; }
+};
+
+typedef OpenHashMap<int32_t, int32_t, IntTraits> IntMap;
+typedef OpenHashMap<int32_t, int32_t, CollidingTraits> CollidingMap;
+
+}  // namespace
+
+class OpenHashMapTest : public IntlTest {
+public:
+    OpenHashMapTest() {}
+    void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=0);
+    void TestPutGet();
+    void TestRemove();
+    void TestIterate();
+    void TestCollisions();
+    void TestRemoveAll();
+};
+
+void OpenHashMapTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char * /*par*/) {
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestPutGet);
+    TESTCASE_AUTO(TestRemove);
+    TESTCASE_AUTO(TestIterate);
+    TESTCASE_AUTO(TestCollisions);
+    TESTCASE_AUTO(TestRemoveAll);
+    TESTCASE_AUTO_END;
+}
+
+void OpenHashMapTest::TestPutGet() {
+    IcuTestErrorCode errorCode(*this, "TestPutGet");
+    IntMap map;
+    assertEquals("empty count", 0, map.count());
+    assertTrue("empty find", map.find(3) == nullptr);
+    assertEquals("empty get", 0, map.get(3));
+    for (int32_t i = 0; i < 1000; ++i) {
+        map.put(i * 7919, i + 1, errorCode);
+    }
+    if (errorCode.errIfFailureAndReset("put()")) {
+        return;
+    }
+    assertEquals("count", 1000, map.count());
+    for (int32_t i = 0; i < 1000; ++i) {
+        if (map.get(i * 7919) != i + 1) {
+            errln("get(%ld) != %ld", (long)(i * 7919), (long)(i + 1));
+            return;
+        }
+    }
+    assertTrue("find missing", map.find(1) == nullptr);
+    // Replacing a value does not add an entry.
+    IntMap::Entry *entry = map.put(7919, -2, errorCode);
+    assertEquals("replaced count", 1000, map.count());
+    assertTrue("replaced entry", entry != nullptr && entry->key == 7919 && entry->value == -2);
+    assertEquals("replaced get", -2, map.get(7919));
+}
+
+void OpenHashMapTest::TestRemove() {
+    IcuTestErrorCode errorCode(*this, "TestRemove");
+    IntMap map;
+    for (int32_t i = 0; i < 200; ++i) {
+        map.put(i, i, errorCode);
+    }
+    assertFalse("remove missing", map.remove(200));
+    for (int32_t i = 0; i < 200; i += 2) {
+        assertTrue("remove even", map.remove(i));
+    }
+    assertEquals("count after remove", 100, map.count());
+    for (int32_t i = 0; i < 200; ++i) {
+        if ((map.find(i) != nullptr) != ((i & 1) != 0)) {
+            errln("find(%ld) after removing the even keys", (long)i);
+            return;
+        }
+    }
+    // Re-adding reuses deleted slots and keeps everything findable.
+    for (int32_t round = 0; round < 20; ++round) {
+        for (int32_t i = 0; i < 200; i += 2) {
+            map.put(i, round, errorCode);
+        }
+        for (int32_t i = 0; i < 200; i += 2) {
+            map.remove(i);
+        }
+    }
+    assertEquals("count after churn", 100, map.count());
+    assertEquals("odd value kept", 199, map.get(199));
+}
+
+void OpenHashMapTest::TestIterate() {
+    IcuTestErrorCode errorCode(*this, "TestIterate");
+    IntMap map;
+    int32_t pos = -1;
+    assertTrue("empty iteration", map.nextEntry(pos) == nullptr);
+    for (int32_t i = 1; i <= 100; ++i) {
+        map.put(i, i * i, errorCode);
+    }
+    // Removing entries while iterating does not skip any of the remaining ones.
+    int32_t seen = 0;
+    int64_t keySum = 0;
+    pos = -1;
+    const IntMap::Entry *entry;
+    while ((entry = map.nextEntry(pos)) != nullptr) {
+        assertEquals("value", entry->key * entry->key, entry->value);
+        keySum += entry->key;
+        ++seen;
+        if ((entry->key % 3) == 0) {
+            map.removeEntry(entry);
+        }
+    }
+    assertEquals("entries seen", 100, seen);
+    assertEquals("key sum", (int64_t)5050, keySum);
+    assertEquals("count after removeEntry", 67, map.count());
+    assertTrue("end stays at end", map.nextEntry(pos) == nullptr);
+}
+
+void OpenHashMapTest::TestCollisions() {
+    IcuTestErrorCode errorCode(*this, "TestCollisions");
+    CollidingMap map;
+    for (int32_t i = 0; i < 50; ++i) {
+        map.put(i, -i, errorCode);
+    }
+    assertEquals("count", 50, map.count());
+    for (int32_t i = 0; i < 50; ++i) {
+        if (map.get(i) != -i) {
+            errln("colliding get(%ld) != %ld", (long)i, (long)-i);
+            return;
+        }
+    }
+    assertTrue("colliding find missing", map.find(50) == nullptr);
+    // Removing from full groups leaves tombstones that must not end lookups.
+    for (int32_t i = 0; i < 50; i += 5) {
+        map.remove(i);
+    }
+    for (int32_t i = 0; i < 50; ++i) {
+        if ((map.find(i) != nullptr) != ((i % 5) != 0)) {
+            errln("colliding find(%ld) after remove", (long)i);
+            return;
+        }
+    }
+}
+
+void OpenHashMapTest::TestRemoveAll() {
+    IcuTestErrorCode errorCode(*this, "TestRemoveAll");
+    IntMap map;
+    map.removeAll();
+    for (int32_t i = 0; i < 30; ++i) {
+        map.put(i, i, errorCode);
+    }
+    map.removeAll();
+    assertEquals("count", 0, map.count());
+    assertTrue("find", map.find(3) == nullptr);
+    map.put(3, 4, errorCode);
+    assertEquals("get after removeAll", 4, map.get(3));
+}
+
+extern IntlTest *createOpenHashMapTest() {
+    return new OpenHashMapTest();
+}
@@ -53,6 +53,8 @@ void PluralRulesTest::runIndexedTest( int32_t index, UBool exec, const char* &na
     TESTCASE_AUTO(testAvailbleLocales);
     TESTCASE_AUTO(testParseErrors);
     TESTCASE_AUTO(testFixedDecimal);
+    TESTCASE_AUTO(testIntegerSelect);
+    TESTCASE_AUTO(testIntegerTable);
     TESTCASE_AUTO_END;
 }
 
@@ -1003,6 +1005,92 @@ void PluralRulesTest::testFixedDecimal() {
     }
 }
 
+void PluralRulesTest::testIntegerSelect() {
+    IcuTestErrorCode status(*this, "testIntegerSelect");
+
+    // select(int32_t) and select(double) of an integer skip the FixedDecimal;
+    // the fraction operands then have to be 0.
+    LocalPointer<PluralRules> pr(PluralRules::createRules(
+        u"a: v is 0 and i mod 10 is 1 and n mod 100 is not 11;"
+        u"b: i mod 10 in 2..4 and i mod 100 not in 12..14 or f is 0 and n is 15;"
+        u"c: n within 100..200 and t is 0;"
+        u"d: n is 5 or f = 1", status));
+    if (status.errIfFailureAndReset("createRules")) {
+        return;
+    }
+    static const struct {
+        int32_t number;
+        const char16_t *keyword;
+    } cases[] = {
+        {1, u"a"}, {-21, u"a"}, {11, u"other"}, {211, u"other"}, {3, u"b"}, {-1004, u"b"},
+        {13, u"other"}, {15, u"b"}, {150, u"c"}, {200, u"c"}, {5, u"d"}, {0, u"other"},
+        {2000000000, u"other"}
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        UnicodeString message = UnicodeString(u"select ") + cases[i].number;
+        assertEquals(message, cases[i].keyword, pr->select(cases[i].number));
+        assertEquals(message + u".0", cases[i].keyword, pr->select((double)cases[i].number));
+        assertEquals(message + u" FixedDecimal", cases[i].keyword,
+                     pr->select(FixedDecimal((double)cases[i].number, 0, 0)));
+    }
+    assertEquals("select 1.1", u"d", pr->select(1.1));
+    assertEquals("select 2^53", u"b", pr->select(9007199254740992.0));
 
+    // The integer path agrees with the FixedDecimal path for all locales.
+    LocalPointer<StringEnumeration> locales(PluralRules::getAvailableLocales(status));
+    if (status.errDataIfFailureAndReset("getAvailableLocales")) {
+        return;
+    }
+    const char *locale;
+    while ((locale = locales->next(NULL, status)) != NULL) {
+        for (int32_t type = UPLURAL_TYPE_CARDINAL; type <= UPLURAL_TYPE_ORDINAL; ++type) {
+            LocalPointer<PluralRules> rules(PluralRules::forLocale(locale, (UPluralType)type, status));
+            if (status.errDataIfFailureAndReset("forLocale(%s)", locale)) {
+                continue;
+            }
+            for (int32_t n = -3; n <= 1200; ++n) {
+                UnicodeString expected = rules->select(FixedDecimal(n, 0, 0));
+                if (rules->select(n) != expected || rules->select((double)n) != expected) {
+                    errln("select(%d) for %s type %d differs from select(FixedDecimal)",
+                          (int)n, locale, (int)type);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+
+
+void PluralRulesTest::testIntegerTable() {
+    IcuTestErrorCode status(*this, "testIntegerTable");
+    LocalPointer<PluralRules> rules(PluralRules::createRules(
+        u"one: n mod 10 is 1 and n mod 100 is not 11; few: n mod 100 in 3..10", status));
+    if (status.errIfFailureAndReset("createRules")) {
+        return;
+    }
+    // Copies share the compiled rules and their table, and keep working
+    // after the original is gone.
+    LocalPointer<PluralRules> copy(rules->clone());
+    PluralRules assigned(*copy);
+    assigned = *rules;
+    rules.adoptInstead(nullptr);
+    static const int32_t numbers[] = {
+        0, 1, 3, 11, 21, 111, 103, 999,
+        U_PLURAL_INTEGER_TABLE_SIZE - 1, U_PLURAL_INTEGER_TABLE_SIZE, U_PLURAL_INTEGER_TABLE_SIZE + 1,
+        1000001, 1000005
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(numbers); ++i) {
+        int32_t n = numbers[i];
+        UnicodeString expected = copy->select(FixedDecimal(n, 0, 0));
+        UnicodeString message = UnicodeString(u"select ") + n;
+        assertEquals(message, expected, copy->select(n));
+        assertEquals(message + u" assigned", expected, assigned.select(n));
+        assertEquals(message + u" negated", expected, assigned.select(-n));
+    }
+    assertEquals("select 21", u"one", copy->select(21));
+    assertEquals("select 104", u"few", copy->select(104));
+    assertEquals("select 111", u"other", copy->select(111));
+}
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
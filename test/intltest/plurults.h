@@ -37,6 +37,8 @@ class PluralRulesTest : public IntlTest {
     void testAvailbleLocales();
     void testParseErrors();
     void testFixedDecimal();
+    void testIntegerSelect();
+    void testIntegerTable();
 
     void assertRuleValue(const UnicodeString& rule, double expected);
     void assertRuleKeyValue(const UnicodeString& rule, const UnicodeString& key,
@@ -1402,6 +1402,156 @@ void RBBIAPITest::TestFilteredBreakIteratorBuilder() {
 #endif
 }
 
+// Filtered iterators share the compiled exceptions of their builder and locale.
+// Changing the exceptions of a builder must affect only the iterators it builds later.
+
+void RBBIAPITest::TestFilteredBreakIteratorSharedData() {
+#if !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_FILTERED_BREAK_ITERATION
+  UErrorCode status = U_ZERO_ERROR;
+  const UnicodeString text("Hello Mr. Weston. Capt. Gorges is here.");
+  LocalPointer<FilteredBreakIteratorBuilder> builder(
+      FilteredBreakIteratorBuilder::createInstance(Locale::getEnglish(), status));
+  LocalPointer<BreakIterator> before(
+      builder.isValid() ? builder->build(BreakIterator::createSentenceInstance(Locale::getEnglish(), status), status) : NULL);
+  if (U_FAILURE(status) || before.isNull()) {
+    dataerrln("FAIL: filtered English sentence iterator: %s", u_errorName(status));
+    return;
+  }
+  TEST_ASSERT(builder->unsuppressBreakAfter(UnicodeString("Capt."), status));
+  LocalPointer<BreakIterator> after(
+      builder->build(BreakIterator::createSentenceInstance(Locale::getEnglish(), status), status));
+  LocalPointer<BreakIterator> clone(before->clone());
+  TEST_ASSERT_SUCCESS(status);
+  if (U_FAILURE(status) || clone.isNull()) {
+    return;
+  }
+
+  before->setText(text);
+  clone->setText(text);
+  after->setText(text);
+  TEST_ASSERT(18 == before->next());
+  TEST_ASSERT(39 == before->next());
+  TEST_ASSERT(18 == clone->next());
+  TEST_ASSERT(39 == clone->next());
+  TEST_ASSERT(18 == after->next());
+  TEST_ASSERT(24 == after->next());
+  TEST_ASSERT(39 == after->next());
+
+  // A new builder for the locale still has the locale's exceptions.
+  builder.adoptInstead(FilteredBreakIteratorBuilder::createInstance(Locale::getEnglish(), status));
+  after.adoptInstead(builder->build(BreakIterator::createSentenceInstance(Locale::getEnglish(), status), status));
+  TEST_ASSERT_SUCCESS(status);
+  if (U_FAILURE(status)) {
+    return;
+  }
+  after->setText(text);
+  TEST_ASSERT(18 == after->next());
+  TEST_ASSERT(39 == after->next());
+
+  // New text replaces the text that the iterator checked the exceptions in.
+  const UnicodeString other("See Capt. Gorges. Bye.");
+  before->setText(other);
+  TEST_ASSERT(18 == before->next());
+  TEST_ASSERT(22 == before->next());
+  TEST_ASSERT(18 == before->preceding(22));
+  TEST_ASSERT(FALSE == before->isBoundary(10));
+#endif
+}
+
+// Break iterators made for the same locale and kind are clones of one cached
+// prototype. They share rule data but nothing else.
+
+void RBBIAPITest::TestCreateInstanceSharing() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> first(BreakIterator::createWordInstance("ja", status));
+    if (U_FAILURE(status)) {
+        dataerrln("FAIL: BreakIterator::createWordInstance(ja): %s", u_errorName(status));
+        return;
+    }
+    UnicodeString text(u"日本語の文章です。Some words.");
+    first->setText(text);
+    first->following(5);
+
+    LocalPointer<BreakIterator> second(BreakIterator::createWordInstance("ja", status));
+    LocalPointer<BreakIterator> line(BreakIterator::createLineInstance("ja", status));
+    LocalPointer<BreakIterator> strict(BreakIterator::createLineInstance("ja@lb=strict", status));
+    TEST_ASSERT_SUCCESS(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    RuleBasedBreakIterator *firstRBBI = dynamic_cast<RuleBasedBreakIterator *>(first.getAlias());
+    RuleBasedBreakIterator *secondRBBI = dynamic_cast<RuleBasedBreakIterator *>(second.getAlias());
+    RuleBasedBreakIterator *lineRBBI = dynamic_cast<RuleBasedBreakIterator *>(line.getAlias());
+    RuleBasedBreakIterator *strictRBBI = dynamic_cast<RuleBasedBreakIterator *>(strict.getAlias());
+    TEST_ASSERT(firstRBBI != NULL && secondRBBI != NULL && lineRBBI != NULL && strictRBBI != NULL);
+    if (firstRBBI == NULL || secondRBBI == NULL || lineRBBI == NULL || strictRBBI == NULL) {
+        return;
+    }
+    uint32_t length;
+    TEST_ASSERT(firstRBBI->getBinaryRules(length) == secondRBBI->getBinaryRules(length));
+    TEST_ASSERT(firstRBBI->getBinaryRules(length) != lineRBBI->getBinaryRules(length));
+    TEST_ASSERT(lineRBBI->getBinaryRules(length) != strictRBBI->getBinaryRules(length));
+    TEST_ASSERT(second->getLocale(ULOC_VALID_LOCALE, status) ==
+                first->getLocale(ULOC_VALID_LOCALE, status));
+    TEST_ASSERT_SUCCESS(status);
+
+    // The new instance does not see the text or the position of the first one.
+    TEST_ASSERT(second->current() == 0);
+    TEST_ASSERT(second->next() == BreakIterator::DONE);
+    second->setText(text);
+    TEST_ASSERT(second->next() == 3);
+    TEST_ASSERT(first->current() == 6);
+    TEST_ASSERT(first->next() == 8);
+}
+
+// Break iterators built from the same rules share the compiled data of a
+// cached iterator; rules with errors are not cached.
+
+void RBBIAPITest::TestCompiledRulesCache() {
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError parseError;
+    UnicodeString rules(
+        u"$Letter = [a-z];\n"
+        u"$Digit = [0-9];\n"
+        u"$Letter+ {200};\n"
+        u"$Digit+ {100};\n"
+        u"[^$Letter $Digit];\n");
+    LocalPointer<RuleBasedBreakIterator> first(new RuleBasedBreakIterator(rules, parseError, status), status);
+    LocalPointer<RuleBasedBreakIterator> second(new RuleBasedBreakIterator(rules, parseError, status), status);
+    LocalPointer<RuleBasedBreakIterator> third(new RuleBasedBreakIterator(rules, parseError, status), status);
+    if (U_FAILURE(status)) {
+        errln("%s:%d FAIL: creating break iterators from rules: %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    TEST_ASSERT(parseError.line == 0 && parseError.offset == 0);
+    uint32_t firstLength, secondLength, thirdLength;
+    const uint8_t *firstData = first->getBinaryRules(firstLength);
+    const uint8_t *secondData = second->getBinaryRules(secondLength);
+    const uint8_t *thirdData = third->getBinaryRules(thirdLength);
+    TEST_ASSERT(secondData == thirdData);
+    TEST_ASSERT(firstLength == secondLength && secondLength == thirdLength);
+    TEST_ASSERT(firstLength == secondLength && uprv_memcmp(firstData, secondData, firstLength) == 0);
+    TEST_ASSERT(first->getRules() == second->getRules());
+
+    UnicodeString text(u"abc123 x");
+    second->setText(text);
+    TEST_ASSERT(3 == second->next());
+    TEST_ASSERT(200 == second->getRuleStatus());
+    TEST_ASSERT(6 == second->next());
+    TEST_ASSERT(100 == second->getRuleStatus());
+    TEST_ASSERT(0 == third->current());
+    third->setText(text);
+    TEST_ASSERT(3 == third->following(1));
+
+    UnicodeString badRules(u"$Letter = [a-z];\n$Undefined+;\n");
+    for (int32_t i = 0; i < 2; ++i) {
+        status = U_ZERO_ERROR;
+        RuleBasedBreakIterator bad(badRules, parseError, status);
+        TEST_ASSERT(status == U_BRK_UNDEFINED_VARIABLE);
+        TEST_ASSERT(parseError.line == 2);
+    }
+}
+
 //---------------------------------------------
 // runIndexedTest
 //---------------------------------------------
@@ -1427,10 +1577,13 @@ void RBBIAPITest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestRuleStatus);
     TESTCASE_AUTO(TestRoundtripRules);
     TESTCASE_AUTO(TestGetBinaryRules);
+    TESTCASE_AUTO(TestCreateInstanceSharing);
 #endif
     TESTCASE_AUTO(TestRefreshInputText);
 #if !UCONFIG_NO_BREAK_ITERATION
     TESTCASE_AUTO(TestFilteredBreakIteratorBuilder);
+    TESTCASE_AUTO(TestFilteredBreakIteratorSharedData);
+    TESTCASE_AUTO(TestCompiledRulesCache);
 #endif
     TESTCASE_AUTO_END;
 }
@@ -56,6 +56,8 @@ class RBBIAPITest: public IntlTest {
     void TestIteration(void);
 
     void TestFilteredBreakIteratorBuilder(void);
+    void TestFilteredBreakIteratorSharedData(void);
+    void TestCompiledRulesCache();
 
     /**
      * Tests creating RuleBasedBreakIterator from rules strings.
@@ -70,6 +72,7 @@ class RBBIAPITest: public IntlTest {
      * Test getting and using binary (compiled) rules.
      **/
     void TestGetBinaryRules(void);
+    void TestCreateInstanceSharing();
 
     /**
      * Tests grouping effect of 'single quotes' in rules.
@@ -114,6 +114,10 @@ void RBBITest::runIndexedTest( int32_t index, UBool exec, const char* &name, cha
     TESTCASE_AUTO(TestBug13447);
     TESTCASE_AUTO(TestReverse);
     TESTCASE_AUTO(TestBug13692);
+    TESTCASE_AUTO(TestUTF8Native);
+    TESTCASE_AUTO(TestGetBoundaries);
+    TESTCASE_AUTO(TestCjkLongRun);
+    TESTCASE_AUTO(TestStateTableRowWidth);
     TESTCASE_AUTO_END;
 }
 
@@ -4410,6 +4414,19 @@ void RBBITest::TestBug12677() {
 }
 
 
+// The values of a state table row, as a string for comparisons.
+template <typename RowType>
+static UnicodeString stateTableRowString(const RowType *row, int32_t numCharClasses) {
+    UnicodeString s;
+    s.append((UChar)(row->fAccepting + 1));   // values of -1 are expected.
+    s.append((UChar)row->fLookAhead);
+    s.append((UChar)row->fTagIdx);
+    for (int32_t column = 0; column < numCharClasses; column++) {
+        s.append((UChar)row->fNextState[column]);
+    }
+    return s;
+}
+
 void RBBITest::TestTableRedundancies() {
     UErrorCode status = U_ZERO_ERROR;
 
@@ -4425,12 +4442,17 @@ void RBBITest::TestTableRedundancies() {
 
     // Check for duplicate columns (character categories)
 
+    UBool use8Bits = (fwtbl->fFlags & RBBI_8BITS_ROWS) != 0;
     std::vector<UnicodeString> columns;
     for (int32_t column = 0; column < numCharClasses; column++) {
         UnicodeString s;
         for (int32_t r = 1; r < (int32_t)fwtbl->fNumStates; r++) {
-            RBBIStateTableRow  *row = (RBBIStateTableRow *) (fwtbl->fTableData + (fwtbl->fRowLen * r));
-            s.append(row->fNextState[column]);
+            const char *rowBytes = fwtbl->fTableData + (fwtbl->fRowLen * r);
+            if (use8Bits) {
+                s.append((UChar)((const RBBIStateTableRow8 *)rowBytes)->fNextState[column]);
+            } else {
+                s.append((UChar)((const RBBIStateTableRow16 *)rowBytes)->fNextState[column]);
+            }
         }
         columns.push_back(s);
     }
@@ -4448,15 +4470,13 @@ void RBBITest::TestTableRedundancies() {
     // Check for duplicate states
     std::vector<UnicodeString> rows;
     for (int32_t r=0; r < (int32_t)fwtbl->fNumStates; r++) {
-        UnicodeString s;
-        RBBIStateTableRow  *row = (RBBIStateTableRow *) (fwtbl->fTableData + (fwtbl->fRowLen * r));
-        assertTrue(WHERE, row->fAccepting >= -1);
-        s.append(row->fAccepting + 1);   // values of -1 are expected.
-        s.append(row->fLookAhead);
-        s.append(row->fTagIdx);
-        for (int32_t column = 0; column < numCharClasses; column++) {
-            s.append(row->fNextState[column]);
-        }
+        const char *rowBytes = fwtbl->fTableData + (fwtbl->fRowLen * r);
+        int32_t accepting = use8Bits ? ((const RBBIStateTableRow8 *)rowBytes)->fAccepting :
+                                       ((const RBBIStateTableRow16 *)rowBytes)->fAccepting;
+        assertTrue(WHERE, accepting >= -1);
+        UnicodeString s = use8Bits ?
+            stateTableRowString((const RBBIStateTableRow8 *)rowBytes, numCharClasses) :
+            stateTableRowString((const RBBIStateTableRow16 *)rowBytes, numCharClasses);
         rows.push_back(s);
     }
     for (int r1=0; r1 < (int32_t)fwtbl->fNumStates; r1++) {
@@ -4590,6 +4610,238 @@ void RBBITest::TestBug13692() {
     assertSuccess(WHERE, status);
 }
 
+//
+//  TestUTF8Native   Boundaries and rule status values in UTF-8 text, which
+//                   handleNext() reads without the UText access functions,
+//                   are the same as in the equivalent UTF-16 text.
+//
+void RBBITest::TestUTF8Native() {
+    static const char *const utf8Texts[] = {
+        "Hello, world! It's 3.14 o'clock.\r\nNew line\xE2\x80\xA8" "done",
+        "\xE0\xB8\x82\xE0\xB8\xB2\xE0\xB8\xA2\xE0\xB9\x80\xE0\xB8\x84\xE0\xB8\xA3 sim audio",
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0\xE3\x80\x82 Ok.",
+        "e\xCC\x81 \xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9 \xF0\x9F\x87\xAF\xF0\x9F\x87\xB5!",
+        "bad \xFF bytes \xE2\x82 and \xF0\x9F\x98 split \xC3",       // ill-formed
+        "a\xC0\xAF" "b \xED\xA0\x80 c",                             // non-shortest, surrogate
+        ""
+    };
+    static const char *const locales[] = { "en", "th", "ja" };
+    for (int32_t type = 0; type < 4; ++type) {
+        for (int32_t loc = 0; loc < UPRV_LENGTHOF(locales); ++loc) {
+            UErrorCode status = U_ZERO_ERROR;
+            Locale locale(locales[loc]);
+            LocalPointer<BreakIterator> bi8(
+                type == 0 ? BreakIterator::createCharacterInstance(locale, status) :
+                type == 1 ? BreakIterator::createWordInstance(locale, status) :
+                type == 2 ? BreakIterator::createLineInstance(locale, status) :
+                            BreakIterator::createSentenceInstance(locale, status), status);
+            LocalPointer<BreakIterator> bi16(bi8.isValid() ? bi8->clone() : NULL, status);
+            if (!assertSuccess(WHERE, status, true)) {
+                return;
+            }
+            for (int32_t i = 0; i < UPRV_LENGTHOF(utf8Texts); ++i) {
+                // The UTF-16 text, and for each UTF-8 offset the UTF-16 offset, or -1
+                //   within a character.
+                const char *utf8 = utf8Texts[i];
+                int32_t utf8Length = (int32_t)strlen(utf8);
+                UnicodeString utf16;
+                int32_t offsets[100];
+                for (int32_t j = 0; j < utf8Length;) {
+                    offsets[j] = utf16.length();
+                    int32_t start = j;
+                    UChar32 c;
+                    U8_NEXT_OR_FFFD(utf8, j, utf8Length, c);
+                    utf16.append(c);
+                    while (++start < j) {
+                        offsets[start] = -1;
+                    }
+                }
+                offsets[utf8Length] = utf16.length();
+
+                UText ut = UTEXT_INITIALIZER;
+                utext_openUTF8(&ut, utf8, utf8Length, &status);
+                bi8->setText(&ut, status);
+                bi16->setText(utf16);
+                char message[80];
+                sprintf(message, "type %d locale %s text %d", (int)type, locales[loc], (int)i);
+                int32_t b8, b16;
+                for (b8 = bi8->first(), b16 = bi16->first();
+                        b8 != BreakIterator::DONE && b16 != BreakIterator::DONE;
+                        b8 = bi8->next(), b16 = bi16->next()) {
+                    if (!assertEquals(message, b16, offsets[b8]) ||
+                            !assertEquals(message, bi16->getRuleStatus(), bi8->getRuleStatus())) {
+                        break;
+                    }
+                }
+                assertEquals(message, (int32_t)BreakIterator::DONE, b8);
+                assertEquals(message, (int32_t)BreakIterator::DONE, b16);
+
+                // Starting from positions within characters.
+                for (int32_t j = 0; j <= utf8Length; ++j) {
+                    int32_t following = bi8->following(j);
+                    int32_t k = j;
+                    while (offsets[k] < 0) {
+                        --k;
+                    }
+                    assertEquals(message, bi16->following(offsets[k]),
+                                 following == BreakIterator::DONE ? following : offsets[following]);
+                }
+                utext_close(&ut);
+                assertSuccess(message, status);
+            }
+        }
+    }
+}
+
+//
+//  TestGetBoundaries   RuleBasedBreakIterator::getBoundaries() finds the same
+//                      boundaries and rule status values as iterating with next(),
+//                      including in text that is divided with a dictionary.
+//
+void RBBITest::TestGetBoundaries() {
+    UnicodeString text = UnicodeString(
+        u"The quick (“brown”) fox can’t jump 32.3 feet, right? "
+        u"การทดสอบภาษาไทย "
+        u"日本語の文章です。 \U0001F468‍\U0001F469 end.");
+    static const char *const locales[] = { "en", "th", "ja" };
+    for (int32_t type = 0; type < 3; ++type) {
+        for (int32_t loc = 0; loc < UPRV_LENGTHOF(locales); ++loc) {
+            UErrorCode status = U_ZERO_ERROR;
+            Locale locale(locales[loc]);
+            LocalPointer<RuleBasedBreakIterator> bi((RuleBasedBreakIterator *)(
+                type == 0 ? BreakIterator::createWordInstance(locale, status) :
+                type == 1 ? BreakIterator::createLineInstance(locale, status) :
+                            BreakIterator::createCharacterInstance(locale, status)), status);
+            LocalPointer<BreakIterator> reference(bi.isValid() ? bi->clone() : NULL, status);
+            if (!assertSuccess(WHERE, status, true)) {
+                return;
+            }
+            bi->setText(text);
+            reference->setText(text);
+            static const int32_t ranges[][2] = {
+                { 0, 1000 }, { 0, 0 }, { 5, 40 }, { 38, 60 }, { 60, 200 }, { 1, 1 }
+            };
+            for (int32_t r = 0; r < UPRV_LENGTHOF(ranges); ++r) {
+                int32_t start = ranges[r][0];
+                int32_t limit = ranges[r][1];
+                int32_t boundaries[200];
+                int32_t statuses[200];
+                int32_t count = bi->getBoundaries(start, limit, boundaries, statuses,
+                                                  UPRV_LENGTHOF(boundaries), status);
+                if (!assertSuccess(WHERE, status)) {
+                    return;
+                }
+                char message[80];
+                sprintf(message, "type %d locale %s range %d", (int)type, locales[loc], (int)r);
+                int32_t i = 0;
+                for (int32_t b = start == 0 ? reference->first() : reference->following(start - 1);
+                        b != BreakIterator::DONE && b <= limit; b = reference->next(), ++i) {
+                    if (!assertTrue(message, i < count) ||
+                            !assertEquals(message, b, boundaries[i]) ||
+                            !assertEquals(message, reference->getRuleStatus(), statuses[i])) {
+                        break;
+                    }
+                }
+                assertEquals(message, i, count);
+                if (count > 0) {
+                    // The iterator is left at the last boundary, and continues from there.
+                    assertEquals(message, boundaries[count - 1], bi->current());
+                    reference->isBoundary(boundaries[count - 1]);
+                    assertEquals(message, reference->next(), bi->next());
+                    assertEquals(message, reference->getRuleStatus(), bi->getRuleStatus());
+                }
+
+                // Preflighting.
+                if (count > 1) {
+                    assertEquals(message, count,
+                                 bi->getBoundaries(start, limit, boundaries, NULL, 1, status));
+                    assertEquals(message, U_BUFFER_OVERFLOW_ERROR, status);
+                    status = U_ZERO_ERROR;
+                }
+            }
+        }
+    }
+}
+
+//
+//  TestCjkLongRun   The dictionary engine segments a long run of CJK text in pieces.
+//                   A sentence repeated without punctuation is broken the same way
+//                   in every copy as when it stands alone.
+//
+void RBBITest::TestCjkLongRun() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> bi(BreakIterator::createWordInstance(Locale::getJapanese(), status), status);
+    if (!assertSuccess(WHERE, status, true)) {
+        return;
+    }
+    UnicodeString sentence(u"私は毎日図書館で日本語と中国の歴史を勉強しています");
+    bi->setText(sentence);
+    UVector32 expected(status);
+    for (int32_t b = bi->first(); b != BreakIterator::DONE; b = bi->next()) {
+        expected.addElement(b, status);
+    }
+    assertTrue(WHERE, expected.size() > 8);
+
+    const int32_t COPIES = 1000;
+    UnicodeString text;
+    for (int32_t i = 0; i < COPIES; ++i) {
+        text.append(sentence);
+    }
+    bi->setText(text);
+    int32_t b = bi->first();
+    for (int32_t i = 0; i < COPIES; ++i) {
+        for (int32_t j = i == 0 ? 0 : 1; j < expected.size(); ++j) {
+            if (!assertEquals(WHERE, i * sentence.length() + expected.elementAti(j), b)) {
+                return;
+            }
+            b = bi->next();
+        }
+    }
+    assertEquals(WHERE, BreakIterator::DONE, b);
+}
+
+// Rules with few states are built into state tables with 8-bit rows,
+// larger ones into tables with 16-bit rows. Both break the same.
+void RBBITest::TestStateTableRowWidth() {
+    UnicodeString longWord;
+    for (int32_t i = 0; i < 300; ++i) {
+        longWord.append(u'x');
+    }
+    UnicodeString smallRules(u"!!forward; [a-z]+ {200}; [0-9]+ {100}; [^a-z0-9];");
+    UnicodeString largeRules = UnicodeString(u"!!forward; [a-z]+ {200}; [0-9]+ {100}; [^a-z0-9]; ").
+        append(longWord).append(u" {300};");
+    UnicodeString text = UnicodeString(u"abc 123 ").append(longWord).append(u"yz 4");
+    const int32_t expected[] = {0, 3, 4, 7, 8, 8 + 302, 8 + 303, 8 + 304};
+
+    for (int32_t large = 0; large < 2; ++large) {
+        UErrorCode status = U_ZERO_ERROR;
+        UParseError pe;
+        RuleBasedBreakIterator bi(large ? largeRules : smallRules, pe, status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        assertEquals(WHERE, (UBool)!large, (UBool)((bi.fData->fForwardTable->fFlags & RBBI_8BITS_ROWS) != 0));
+        assertTrue(WHERE, (bi.fData->fReverseTable->fFlags & RBBI_8BITS_ROWS) != 0);
+
+        bi.setText(text);
+        int32_t i = 0;
+        for (int32_t b = bi.first(); b != BreakIterator::DONE; b = bi.next()) {
+            if (!assertTrue(WHERE, i < UPRV_LENGTHOF(expected)) || !assertEquals(WHERE, expected[i], b)) {
+                return;
+            }
+            ++i;
+        }
+        assertEquals(WHERE, UPRV_LENGTHOF(expected), i);
+        for (int32_t b = bi.last(); b != BreakIterator::DONE; b = bi.previous()) {
+            if (!assertTrue(WHERE, i > 0) || !assertEquals(WHERE, expected[--i], b)) {
+                return;
+            }
+        }
+        assertEquals(WHERE, 8, bi.preceding(9));
+        assertEquals(WHERE, 4, bi.following(3));
+    }
+}
+
 //
 //  TestDebug    -  A place-holder test for debugging purposes.
 //                  For putting in fragments of other tests that can be invoked
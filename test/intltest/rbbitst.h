@@ -82,6 +82,10 @@ class RBBITest: public IntlTest {
     void TestReverse();
     void TestReverse(std::unique_ptr<RuleBasedBreakIterator>bi);
     void TestBug13692();
+    void TestUTF8Native();
+    void TestGetBoundaries();
+    void TestCjkLongRun();
+    void TestStateTableRowWidth();
 
     void TestDebug();
     void TestProperties();
@@ -31,6 +31,7 @@
 
 #include "unicode/localpointer.h"
 #include "unicode/regex.h"
+#include "unicode/regexset.h"
 #include "unicode/uchar.h"
 #include "unicode/ucnv.h"
 #include "unicode/uniset.h"
@@ -104,6 +105,13 @@ void RegexTest::runIndexedTest( int32_t index, UBool exec, const char* &name, ch
     TESTCASE_AUTO(TestBug12884);
     TESTCASE_AUTO(TestBug13631);
     TESTCASE_AUTO(TestBug13632);
+    TESTCASE_AUTO(TestDFAFind);
+    TESTCASE_AUTO(TestRegexSet);
+    TESTCASE_AUTO(TestFindInitialUnits);
+    TESTCASE_AUTO(TestStackArena);
+    TESTCASE_AUTO(TestUTF8Native);
+    TESTCASE_AUTO(TestMatchOnce);
+    TESTCASE_AUTO(TestBinaryPattern);
     TESTCASE_AUTO_END;
 }
 
@@ -5851,4 +5859,633 @@ void RegexTest::TestBug13632() {
     uregex_close(re);
 }
 
+// A find progress callback that never interrupts.
+// Setting it makes find() try a match at each position instead of using the DFA.
+static UBool U_CALLCONV
+noInterruptCallBack(const void * /*context*/, int64_t /*matchIndex*/) {
+    return TRUE;
+}
+
+static UnicodeString findAll(RegexMatcher &matcher, UErrorCode &status) {
+    UnicodeString result;
+    while (matcher.find(status)) {
+        result = result + "[" + matcher.start(status) + "," + matcher.end(status) + "]";
+    }
+    result.append(matcher.hitEnd() ? u"hitEnd" : u"");
+    return result;
+}
+
+// Matches found with the DFA prefilter must be the same as without it.
+void RegexTest::TestDFAFind() {
+    static const char16_t *const patterns[] = {
+        u"[A-Za-z0-9_]+@[a-z.]+",
+        u"(?i)error|warn(ing)?",
+        u"\\d\\d\\d-\\d\\d\\d\\d",
+        u"a.*b",
+        u"(ab|a)(c|bcd)",
+        u"x[^y]*?y",
+        u"\\p{L}+\\s\\p{N}",
+        u"\\U0001F600+",
+        u"(?i)straße",
+        u"(?i)[a-z]+é",
+        u"(a|b?)+c",
+        u"\\h+\\V",
+        u"(?d).+x",
+        u"\\w+\\W\\S",
+        // Needs more DFA states than allowed: find() falls back to backtracking.
+        u"[ab]*a[ab][ab][ab][ab][ab][ab][ab][ab][ab]c"
+    };
+    static const char *const inputs[] = {
+        "user@example.com and x.y@a.b",
+        "no match here at all",
+        "WARNING: Error 123-4567 with \\U0001F600\\U0001F600 and STRASSE Stra\\u00DFe caf\\u00C9",
+        "abbababbbaaababbbababbabaababbbababaabbbbaababbc aab",
+        "line1\\r\\nline2 xaaay\\tq\\u0085x",
+        "\\uD83D lone \\uDE00 surrogates ab\\uD83Dc",
+        ""
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        UParseError pe;
+        LocalPointer<RegexPattern> pat(RegexPattern::compile(patterns[i], 0, pe, status));
+        if (U_FAILURE(status)) {
+            dataerrln("RegexPattern::compile(%s) failed - %s",
+                      CStr(UnicodeString(patterns[i]))(), u_errorName(status));
+            continue;
+        }
+        for (int32_t j = 0; j < UPRV_LENGTHOF(inputs); ++j) {
+            UnicodeString input = UnicodeString(inputs[j], -1, US_INV).unescape();
+            LocalPointer<RegexMatcher> matcher(pat->matcher(input, status));
+            LocalPointer<RegexMatcher> reference(pat->matcher(input, status));
+            reference->setFindProgressCallback(noInterruptCallBack, NULL, status);
+            if (U_FAILURE(status)) {
+                errln("pattern %d: matcher() failed - %s", (int)i, u_errorName(status));
+                break;
+            }
+            UnicodeString expected = findAll(*reference, status);
+            assertEquals(UnicodeString("pattern ") + i + " input " + j,
+                         expected, findAll(*matcher, status));
+
+            // With a region, and on UTF-8 text, which does not use the UTF-16 code path.
+            int32_t limit = input.length() > 6 ? input.length() - 3 : input.length();
+            int32_t start = limit >= 3 ? 3 : 0;
+            reference->region(start, limit, status);
+            matcher->region(start, limit, status);
+            assertEquals(UnicodeString("pattern ") + i + " input " + j + " region",
+                         findAll(*reference, status), findAll(*matcher, status));
+
+            char utf8[200];
+            int32_t utf8Length;
+            u_strToUTF8WithSub(utf8, UPRV_LENGTHOF(utf8), &utf8Length,
+                               input.getBuffer(), input.length(), 0xfffd, NULL, &status);
+            UText *ut = utext_openUTF8(NULL, utf8, utf8Length, &status);
+            reference->reset(ut);
+            matcher->reset(ut);
+            assertEquals(UnicodeString("pattern ") + i + " input " + j + " UTF-8",
+                         findAll(*reference, status), findAll(*matcher, status));
+            matcher->reset(input);
+            reference->reset(input);
+            utext_close(ut);
+            assertSuccess("find()", status);
+        }
+    }
+}
+
+void RegexTest::TestRegexSet() {
+    static const char16_t *const patterns[] = {
+        u"[A-Za-z0-9_]+@[a-z.]+",
+        u"(?i)error|warn(ing)?",
+        u"\\d\\d\\d-\\d\\d\\d\\d",
+        u"a.*b",
+        u"(ab|a)(c|bcd)",
+        u"\\U0001F600+",
+        u"(?i)[a-z]+é",
+        u"line",
+        u"x*",
+        // Not supported by the DFA: matched one at a time.
+        u"(a)\\1",
+        u"^line",
+        u"\\bat\\b",
+        u"q(?=x)",
+        u"(?i)strasse",
+        // Needs more DFA states than allowed for a set.
+        u"[ab]*a[ab][ab][ab][ab][ab][ab][ab][ab][ab][ab][ab]c"
+    };
+    static const char *const inputs[] = {
+        "user@example.com and x.y@a.b",
+        "no match here at all",
+        "WARNING: Error 123-4567 with \\U0001F600\\U0001F600 and STRASSE Stra\\u00DFe caf\\u00C9",
+        "abbababbbaaababbbababbabaababbbababaabbbbaababbc aab",
+        "line1\\r\\nline2 xaaay\\tq\\u0085x",
+        "\\uD83D lone \\uDE00 surrogates ab\\uD83Dc",
+        ""
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    RegexSet small(status);
+    RegexSet set(status);
+    LocalPointer<RegexPattern> pats[UPRV_LENGTHOF(patterns)];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        UParseError pe;
+        pats[i].adoptInstead(RegexPattern::compile(patterns[i], 0, pe, status));
+        if (i < UPRV_LENGTHOF(patterns) - 1) {
+            small.add(patterns[i], 0, status);
+        }
+        assertEquals("add() index", i, set.add(patterns[i], 0, status));
+        if (U_FAILURE(status)) {
+            dataerrln("RegexSet::add(%s) failed - %s",
+                      CStr(UnicodeString(patterns[i]))(), u_errorName(status));
+            return;
+        }
+    }
+    assertEquals("size()", UPRV_LENGTHOF(patterns), set.size());
+    assertEquals("getPattern()", UnicodeString(patterns[2]), set.getPattern(2).pattern());
+
+    // The same results on every pass over the inputs: The DFA states persist.
+    for (int32_t pass = 0; pass < 2; ++pass) {
+        for (int32_t j = 0; j < UPRV_LENGTHOF(inputs); ++j) {
+            UnicodeString input = UnicodeString(inputs[j], -1, US_INV).unescape();
+            int32_t expected[UPRV_LENGTHOF(patterns)];
+            int32_t expectedCount = 0;
+            for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+                LocalPointer<RegexMatcher> matcher(pats[i]->matcher(input, status));
+                if (U_SUCCESS(status) && matcher->find(status)) {
+                    expected[expectedCount++] = i;
+                }
+            }
+            UnicodeString message = UnicodeString("pass ") + pass + " input " + j;
+            int32_t actual[UPRV_LENGTHOF(patterns)];
+            int32_t count = set.find(input, actual, UPRV_LENGTHOF(actual), status);
+            assertSuccess(message, status);
+            assertEquals(message, expectedCount, count);
+            for (int32_t k = 0; k < expectedCount && k < count; ++k) {
+                assertEquals(message + " [" + k + "]", expected[k], actual[k]);
+            }
+
+            // Without the pattern that overflows the DFA.
+            int32_t smallCount = small.find(input, actual, UPRV_LENGTHOF(actual), status);
+            if (expectedCount > 0 && expected[expectedCount - 1] == UPRV_LENGTHOF(patterns) - 1) {
+                --expectedCount;
+            }
+            assertEquals(message + " small set", expectedCount, smallCount);
+            for (int32_t k = 0; k < expectedCount && k < smallCount; ++k) {
+                assertEquals(message + " small set [" + k + "]", expected[k], actual[k]);
+            }
+
+            char utf8[200];
+            int32_t utf8Length;
+            u_strToUTF8WithSub(utf8, UPRV_LENGTHOF(utf8), &utf8Length,
+                               input.getBuffer(), input.length(), 0xfffd, NULL, &status);
+            UText *ut = utext_openUTF8(NULL, utf8, utf8Length, &status);
+            assertEquals(message + " UTF-8", expectedCount, small.find(ut, actual, 0, status));
+            utext_close(ut);
+            if (status == U_BUFFER_OVERFLOW_ERROR && expectedCount > 0) {
+                status = U_ZERO_ERROR;
+            }
+            assertSuccess(message + " UTF-8", status);
+        }
+    }
+
+    RegexSet empty(status);
+    assertEquals("empty set", 0, empty.find(UnicodeString(u"abc"), NULL, 0, status));
+    assertEquals("invalid pattern", -1, empty.add(u"a(", 0, status));
+    assertEquals("invalid pattern", U_REGEX_MISMATCHED_PAREN, status);
+    status = U_ZERO_ERROR;
+    assertEquals("size() after error", 0, empty.size());
+}
+
+// find() skips to the next possible match start with a vectorized scan
+// for patterns with a literal prefix or few initial characters.
+// A find progress callback turns that off, for the reference results.
+void RegexTest::TestFindInitialUnits() {
+    static const char16_t *const patterns[] = {
+        u"needle",              // START_STRING: first and last code units
+        u"(?=(n+?))\\1needle",  // START_STRING, but the back reference comes first
+        u"n(ee|oo)dle",         // START_CHAR
+        u"\\U0001F600x",        // supplementary START_STRING
+        u"\\U0001F600|\\U0001F601", // START_CHAR on the lead surrogate
+        u"[xyz]\\d",            // START_SET
+        u"(?i)q",               // START_SET {Q, q}
+        u"[\\U0001F600\\U0001F680]!", // START_SET with two lead surrogates
+        u"[\\uD83D\\uDE00]a",   // lone surrogates: not scanned for
+        u"\\uDE00a",
+        u"[a-z]+\\d"            // too many initial units
+    };
+    static const char *const pieces[] = {
+        "hay needl ", "needle", "n\\u00E9edle", "nooDle noodle", "x1 Y2 z",
+        "\\U0001F600", "\\U0001F601x", "\\U0001F680!", "\\uD83D", "\\uDE00a",
+        "Q?q", "0123456789abcdef", "\\u3042\\u3044\\u3046"
+    };
+    // Build inputs of different lengths from the pieces, so that matches
+    //   fall at the ends of vectors, UText chunks and regions.
+    UnicodeString inputs[40];
+    for (int32_t j = 0; j < UPRV_LENGTHOF(inputs); ++j) {
+        int32_t n = j * 7 + 3;
+        for (int32_t k = 0; k < n; ++k) {
+            inputs[j].append(UnicodeString(pieces[(j * 5 + k * k) % UPRV_LENGTHOF(pieces)],
+                                           -1, US_INV).unescape());
+            if (k % 3 == 0) {
+                inputs[j].append(UnicodeString(u"filler text without any of them ", -1));
+            }
+        }
+        inputs[j].truncate(j * 31 + 1);
+    }
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        UParseError pe;
+        LocalPointer<RegexPattern> pat(RegexPattern::compile(patterns[i], 0, pe, status));
+        if (U_FAILURE(status)) {
+            dataerrln("RegexPattern::compile(%s) failed - %s",
+                      CStr(UnicodeString(patterns[i]))(), u_errorName(status));
+            continue;
+        }
+        for (int32_t j = 0; j < UPRV_LENGTHOF(inputs); ++j) {
+            const UnicodeString &input = inputs[j];
+            LocalPointer<RegexMatcher> matcher(pat->matcher(input, status));
+            LocalPointer<RegexMatcher> reference(pat->matcher(input, status));
+            reference->setFindProgressCallback(noInterruptCallBack, NULL, status);
+            if (U_FAILURE(status)) {
+                errln("pattern %d: matcher() failed - %s", (int)i, u_errorName(status));
+                break;
+            }
+            UnicodeString message = UnicodeString("pattern ") + i + " input " + j;
+            assertEquals(message, findAll(*reference, status), findAll(*matcher, status));
+
+            int32_t limit = input.length() > 6 ? input.length() - 3 : input.length();
+            int32_t start = limit >= 5 ? 5 : 0;
+            reference->region(start, limit, status);
+            matcher->region(start, limit, status);
+            assertEquals(message + " region",
+                         findAll(*reference, status), findAll(*matcher, status));
+
+            // UTF-8 text is scanned one UTF-16 chunk at a time.
+            char utf8[4000];
+            int32_t utf8Length;
+            u_strToUTF8WithSub(utf8, UPRV_LENGTHOF(utf8), &utf8Length,
+                               input.getBuffer(), input.length(), 0xfffd, NULL, &status);
+            UText *ut = utext_openUTF8(NULL, utf8, utf8Length, &status);
+            reference->reset(ut);
+            matcher->reset(ut);
+            assertEquals(message + " UTF-8",
+                         findAll(*reference, status), findAll(*matcher, status));
+            reference->region(start, limit, status);
+            matcher->region(start, limit, status);
+            assertEquals(message + " UTF-8 region",
+                         findAll(*reference, status), findAll(*matcher, status));
+            matcher->reset(input);
+            reference->reset(input);
+            utext_close(ut);
+            assertSuccess(message, status);
+        }
+    }
+}
+
+// With a stack arena, repeated matching with a warmed-up matcher
+// makes no heap allocations, and gives the same results as the heap stack.
+void RegexTest::TestStackArena() {
+    static const struct {
+        const char16_t *pattern;
+        uint32_t flags;
+    } patterns[] = {
+        { u"(\\w+)@(\\w+)\\.com", 0 },
+        { u"(a|b)*c", 0 },
+        { u"[a-z]+\\d", 0 },             // find() uses the DFA
+        { u"\\b\\w+\\b", UREGEX_UWORD }
+    };
+    static const char16_t *const inputs[] = {
+        u"mail joe@example.com or ann@example.org",
+        u"abababbbac aac bc",
+        u"x1 yy22 zzz333 ",
+        u"",
+        u"no match here"
+    };
+    int64_t arena[512];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        UParseError pe;
+        LocalPointer<RegexPattern> pat(
+            RegexPattern::compile(patterns[i].pattern, patterns[i].flags, pe, status));
+        if (U_FAILURE(status)) {
+            dataerrln("RegexPattern::compile(%s) failed - %s",
+                      CStr(UnicodeString(patterns[i].pattern))(), u_errorName(status));
+            continue;
+        }
+        LocalPointer<RegexMatcher> matcher(pat->matcher(status));
+        LocalPointer<RegexMatcher> reference(pat->matcher(status));
+        matcher->setStackArena(arena, sizeof(arena), status);
+        if (!assertSuccess("setStackArena", status)) {
+            continue;
+        }
+        assertEquals("getStackLimit() with an arena", (int32_t)sizeof(arena),
+                     matcher->getStackLimit());
+        int32_t allocationCount = 0;
+        for (int32_t round = 0; round < 3; ++round) {
+            if (round == 1) {
+                // The first round warms up the matcher.
+                allocationCount = matcher->getHeapAllocationCount();
+            }
+            for (int32_t j = 0; j < UPRV_LENGTHOF(inputs); ++j) {
+                UnicodeString input(inputs[j]);
+                UnicodeString message = UnicodeString("pattern ") + i + " input " + j;
+                matcher->reset(input);
+                reference->reset(input);
+                assertEquals(message, findAll(*reference, status), findAll(*matcher, status));
+                assertEquals(message + " matches()",
+                             reference->matches(status), matcher->matches(status));
+                assertEquals(message + " lookingAt()",
+                             reference->lookingAt(status), matcher->lookingAt(status));
+            }
+        }
+        assertSuccess("matching with an arena", status);
+        assertEquals(UnicodeString("pattern ") + i + " heap allocations after warm-up",
+                     allocationCount, matcher->getHeapAllocationCount());
+    }
+
+    // A match that needs more stack than the arena holds fails.
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString input(u"ab");
+    for (int32_t i = 0; i < 10; ++i) {
+        input.append(input);
+    }
+    input.append(u'c');
+    RegexMatcher m(u"(a|b)*c", input, 0, status);
+    m.setStackArena(arena, sizeof(arena), status);
+    REGEX_ASSERT(m.matches(status) == FALSE);
+    REGEX_ASSERT(status == U_REGEX_STACK_OVERFLOW);
+    status = U_ZERO_ERROR;
+    m.setStackLimit(0, status);
+    REGEX_ASSERT(m.matches(status));
+    REGEX_CHECK_STATUS;
+
+    // Misaligned and too small arenas are rejected.
+    m.setStackArena((char *)arena + 1, sizeof(arena) - 8, status);
+    REGEX_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    status = U_ZERO_ERROR;
+    m.setStackArena(arena, 8, status);
+    REGEX_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    status = U_ZERO_ERROR;
+    REGEX_ASSERT(m.getStackLimit() == 0);
+}
+
+// All matches and their capture groups, with UTF-16 indexes mapped to UTF-8 offsets
+//   when utf8Offsets is not NULL.
+static UnicodeString findAllGroups(RegexMatcher &matcher, const int32_t *utf8Offsets,
+                                   UErrorCode &status) {
+    UnicodeString result;
+    while (matcher.find(status)) {
+        result.append(u'[');
+        for (int32_t g = 0; g <= matcher.groupCount(); ++g) {
+            int32_t start = matcher.start(g, status);
+            int32_t end = matcher.end(g, status);
+            if (utf8Offsets != NULL && start >= 0) {
+                start = utf8Offsets[start];
+                end = utf8Offsets[end];
+            }
+            result = result + start + "," + end + ";";
+        }
+        result.append(u']');
+    }
+    result.append(matcher.hitEnd() ? u"hitEnd" : u"");
+    return result;
+}
+
+void RegexTest::TestUTF8Native() {
+    static const struct {
+        const char16_t *pattern;
+        uint32_t flags;
+    } patterns[] = {
+        { u"(\\w+)@(\\w+)\\.com", 0 },
+        { u"\\u00E9t\\u00E9", 0 },              // START_STRING with a two-byte lead
+        { u"\\U0001F600+", 0 },                 // START_CHAR, supplementary
+        { u"[\\u3042-\\u3093]+(\\d)?", 0 },
+        { u"\\b\\w+\\b", 0 },
+        { u"(\\w)\\1", 0 },
+        { u"(?i)(\\w)\\1", 0 },
+        { u"(?i)STRASSE", 0 },
+        { u"x(?=\\u00E9)", 0 },
+        { u"(?<=x)\\w", 0 },
+        { u".", UREGEX_DOTALL },
+        { u"(?m)^\\w+$", 0 },
+        { u"\\X", 0 }
+    };
+    static const char16_t *const inputs[] = {
+        u"mail joe@example.com or ann\\u00E9@ex\\u00E4mple.com",
+        u"\\u00E9t\\u00E9 \\u00C9T\\u00C9 x\\u00E9t\\u00E9",
+        u"\\U0001F600\\U0001F600 a\\U0001F600",
+        u"\\u3042\\u3044\\u30463 \\u3048x",
+        u"aa \\u00E9\\u00E9 \\U0001D400\\U0001D400 \\u0130\\u0069",
+        u"Stra\\u00DFe strasse xAx",
+        u"e\\u0301 line1\\nline2\\r\\n\\u0915\\u094D\\u200D\\u0924",
+        u""
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        UParseError pe;
+        LocalPointer<RegexPattern> pat(
+            RegexPattern::compile(patterns[i].pattern, patterns[i].flags, pe, status));
+        if (U_FAILURE(status)) {
+            dataerrln("RegexPattern::compile(%s) failed - %s",
+                      CStr(UnicodeString(patterns[i].pattern))(), u_errorName(status));
+            continue;
+        }
+        LocalPointer<RegexMatcher> matcher(pat->matcher(status));
+        LocalPointer<RegexMatcher> reference(pat->matcher(status));
+        if (U_FAILURE(status)) {
+            errln("pattern %d: matcher() failed - %s", (int)i, u_errorName(status));
+            continue;
+        }
+        for (int32_t j = 0; j < UPRV_LENGTHOF(inputs); ++j) {
+            UnicodeString input = UnicodeString(inputs[j]).unescape();
+            UnicodeString message = UnicodeString("pattern ") + i + " input " + j;
+            char utf8[200];
+            int32_t utf8Offsets[100];
+            int32_t utf8Length = 0;
+            for (int32_t k = 0; k < input.length(); ++k) {
+                utf8Offsets[k] = utf8Length;
+                UChar32 c = input.char32At(k);
+                if (U_IS_SUPPLEMENTARY(c)) {
+                    utf8Offsets[++k] = utf8Length;
+                }
+                U8_APPEND_UNSAFE(utf8, utf8Length, c);
+            }
+            utf8Offsets[input.length()] = utf8Length;
+            UText *ut = utext_openUTF8(NULL, utf8, utf8Length, &status);
+            reference->reset(input);
+            matcher->reset(ut);
+            assertEquals(message, findAllGroups(*reference, utf8Offsets, status),
+                         findAllGroups(*matcher, NULL, status));
+            reference->reset();
+            matcher->reset();
+            assertEquals(message + " matches()",
+                         reference->matches(status), matcher->matches(status));
+            assertEquals(message + " lookingAt()",
+                         reference->lookingAt(status), matcher->lookingAt(status));
+            if (input.length() > 4) {
+                int32_t limit = input.moveIndex32(input.length(), -1);
+                reference->region(2, limit, status);
+                matcher->region(utf8Offsets[2], utf8Offsets[limit], status);
+                assertEquals(message + " region", findAllGroups(*reference, utf8Offsets, status),
+                             findAllGroups(*matcher, NULL, status));
+            }
+            matcher->reset(input);
+            utext_close(ut);
+            assertSuccess(message, status);
+        }
+    }
+
+    // Ill-formed UTF-8 matches like U+FFFD, one per maximal subpart.
+    UErrorCode status = U_ZERO_ERROR;
+    static const char illFormed[] = "a\xFF" "b\xE2\x82";
+    UText *ut = utext_openUTF8(NULL, illFormed, -1, &status);
+    RegexMatcher m(u"\\uFFFD", 0, status);
+    m.reset(ut);
+    REGEX_ASSERT(m.find(status) && m.start(status) == 1 && m.end(status) == 2);
+    REGEX_ASSERT(m.find(status) && m.start(status) == 3 && m.end(status) == 5);
+    REGEX_ASSERT(!m.find(status));
+    REGEX_CHECK_STATUS;
+    utext_close(ut);
+}
+
+void RegexTest::TestMatchOnce() {
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError pe;
+    LocalPointer<RegexPattern> pat(RegexPattern::compile(u"(\\w+)@(\\w+)(\\.com)?", 0, pe, status));
+    LocalPointer<RegexPattern> other(RegexPattern::compile(u"b+", 0, pe, status));
+    REGEX_CHECK_STATUS;
+
+    RegexMatchResult result;
+    REGEX_ASSERT(!result.isMatch());
+    REGEX_ASSERT(result.groupCount() == 0);
+    result.start(0, status);
+    REGEX_ASSERT(status == U_REGEX_INVALID_STATE);
+    status = U_ZERO_ERROR;
+
+    // The results are those of the first find() of a RegexMatcher.
+    static const char16_t *const inputs[] = {
+        u"mail to joe@example.com or ann@example.org", u"ann@example.org", u"no match", u""
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(inputs); ++i) {
+        UnicodeString input(inputs[i]);
+        LocalPointer<RegexMatcher> m(pat->matcher(input, status));
+        UBool found = m->find(status);
+        REGEX_ASSERT(pat->matchOnce(input, result, status) == found);
+        REGEX_ASSERT(result.isMatch() == found);
+        REGEX_CHECK_STATUS;
+        if (found) {
+            REGEX_ASSERT(result.groupCount() == 3);
+            for (int32_t g = 0; g <= 3; ++g) {
+                REGEX_ASSERT(result.start(g, status) == m->start(g, status));
+                REGEX_ASSERT(result.end64(g, status) == m->end64(g, status));
+            }
+            result.start(4, status);
+            REGEX_ASSERT(status == U_INDEX_OUTOFBOUNDS_ERROR);
+            status = U_ZERO_ERROR;
+        }
+
+        // The same result, alternating between patterns.
+        REGEX_ASSERT(other->matchOnce(input, result, status) == (input.indexOf(u'b') >= 0));
+        REGEX_CHECK_STATUS;
+    }
+
+    // UText input, with native indexes.
+    UText *ut = utext_openUTF8(NULL, "\xC3\xA9t\xC3\xA9 x@y", -1, &status);
+    REGEX_ASSERT(pat->matchOnce(ut, result, status));
+    REGEX_ASSERT(result.start(0, status) == 6);
+    REGEX_ASSERT(result.end(2, status) == 9);
+    REGEX_ASSERT(result.start(3, status) == -1);
+    REGEX_CHECK_STATUS;
+    utext_close(ut);
+
+    pat->matchOnce(NULL, result, status);
+    REGEX_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    REGEX_ASSERT(!result.isMatch());
+}
+
+void RegexTest::TestBinaryPattern() {
+    static const struct {
+        const char16_t *pattern;
+        uint32_t flags;
+    } patterns[] = {
+        { u"(?<user>\\w+)@(?<host>\\w+)\\.com", 0 },
+        { u"[a-z\\u00E9\\U0001F600]+\\d", 0 },   // DFA for find()
+        { u"needle", 0 },                       // START_STRING
+        { u"(?i)stra\\u00DFe|\\p{Lu}{2,3}", 0 },
+        { u"\\b\\w+\\b", UREGEX_UWORD },
+        { u"^(a|b)*c$", UREGEX_MULTILINE },
+        { u"(?<=x)y(?!z)", 0 },
+        { u"a.b", UREGEX_DOTALL | UREGEX_CASE_INSENSITIVE },
+        { u"", 0 }
+    };
+    static const char16_t *const inputs[] = {
+        u"mail joe@example.com, ann@example.org",
+        u"x1 \\u00E9\\u00E92 \\U0001F600\\U0001F6003 hay needle",
+        u"STRASSE Stra\\u00DFe ABCD",
+        u"abc\\nbbc\\nxyz xy A\\nB"
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        UParseError pe;
+        LocalPointer<RegexPattern> pat(
+            RegexPattern::compile(patterns[i].pattern, patterns[i].flags, pe, status));
+        if (U_FAILURE(status)) {
+            dataerrln("RegexPattern::compile(%s) failed - %s",
+                      CStr(UnicodeString(patterns[i].pattern))(), u_errorName(status));
+            continue;
+        }
+        int32_t length = pat->toBinary(NULL, 0, status);
+        REGEX_ASSERT(status == U_BUFFER_OVERFLOW_ERROR);
+        status = U_ZERO_ERROR;
+        // The binary form need not be aligned.
+        LocalArray<uint8_t> buffer(new uint8_t[length + 1]);
+        REGEX_ASSERT(pat->toBinary(buffer.getAlias() + 1, length, status) == length);
+        REGEX_CHECK_STATUS;
+        LocalPointer<RegexPattern> copy(RegexPattern::createFromBinary(buffer.getAlias() + 1, length, status));
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(*copy == *pat);
+        REGEX_ASSERT(copy->flags() == pat->flags());
+        for (int32_t j = 0; j < UPRV_LENGTHOF(inputs); ++j) {
+            UnicodeString input = UnicodeString(inputs[j]).unescape();
+            LocalPointer<RegexMatcher> matcher(copy->matcher(input, status));
+            LocalPointer<RegexMatcher> reference(pat->matcher(input, status));
+            UnicodeString message = UnicodeString("pattern ") + i + " input " + j;
+            assertEquals(message, findAllGroups(*reference, NULL, status),
+                         findAllGroups(*matcher, NULL, status));
+            assertEquals(message + " matches()",
+                         reference->matches(status), matcher->matches(status));
+        }
+        assertSuccess("matching with a pattern from binary", status);
+
+        // A copy writes the same binary form.
+        LocalArray<uint8_t> again(new uint8_t[length]);
+        REGEX_ASSERT(copy->toBinary(again.getAlias(), length, status) == length);
+        REGEX_ASSERT(uprv_memcmp(again.getAlias(), buffer.getAlias() + 1, length) == 0);
+        REGEX_CHECK_STATUS;
+    }
+
+    // Named capture groups.
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError pe;
+    LocalPointer<RegexPattern> pat(RegexPattern::compile(patterns[0].pattern, 0, pe, status));
+    int32_t length = pat->toBinary(NULL, 0, status);
+    status = U_ZERO_ERROR;
+    LocalArray<uint8_t> bytes(new uint8_t[length]);
+    uint8_t *buffer = bytes.getAlias();
+    pat->toBinary(buffer, length, status);
+    LocalPointer<RegexPattern> copy(RegexPattern::createFromBinary(buffer, length, status));
+    REGEX_CHECK_STATUS;
+    REGEX_ASSERT(copy->groupNumberFromName("host", -1, status) == 2);
+    REGEX_ASSERT(copy->groupNumberFromName("user", -1, status) == 1);
+    REGEX_CHECK_STATUS;
+
+    // Data that is not a binary pattern is rejected.
+    LocalPointer<RegexPattern> bad(RegexPattern::createFromBinary(buffer, length - 1, status));
+    REGEX_ASSERT(status == U_INVALID_FORMAT_ERROR && bad.isNull());
+    status = U_ZERO_ERROR;
+    buffer[0] ^= 1;
+    bad.adoptInstead(RegexPattern::createFromBinary(buffer, length, status));
+    REGEX_ASSERT(status == U_INVALID_FORMAT_ERROR && bad.isNull());
+    status = U_ZERO_ERROR;
+    bad.adoptInstead(RegexPattern::createFromBinary(buffer, 3, status));
+    REGEX_ASSERT(status == U_INVALID_FORMAT_ERROR && bad.isNull());
+}
+
 #endif  /* !UCONFIG_NO_REGULAR_EXPRESSIONS  */
@@ -59,6 +59,13 @@ class RegexTest: public IntlTest {
     virtual void TestBug12884();
     virtual void TestBug13631();
     virtual void TestBug13632();
+    virtual void TestDFAFind();
+    virtual void TestRegexSet();
+    virtual void TestFindInitialUnits();
+    virtual void TestStackArena();
+    virtual void TestUTF8Native();
+    virtual void TestMatchOnce();
+    virtual void TestBinaryPattern();
 
     // The following functions are internal to the regexp tests.
     virtual void assertUText(const char *expected, UText *actual, const char *file, int line);
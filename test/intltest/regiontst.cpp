@@ -358,6 +358,7 @@ RegionTest::runIndexedTest( int32_t index, UBool exec, const char* &name, char*
    TESTCASE_AUTO(TestContains);
    TESTCASE_AUTO(TestAvailableTerritories);
    TESTCASE_AUTO(TestNoContainedRegions);
+   TESTCASE_AUTO(TestIndexes);
    TESTCASE_AUTO_END;
 }
 
@@ -733,6 +734,44 @@ void RegionTest::TestNoContainedRegions(void) {
   delete containedRegions;
 }
 
+void RegionTest::TestIndexes(void) {
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t limit = Region::getIndexLimit(status);
+    if (U_FAILURE(status) || limit <= 0) {
+        dataerrln("Region::getIndexLimit() failed - %s", u_errorName(status));
+        return;
+    }
+    for (int32_t i = 0 ; i < limit ; i++ ) {
+        const Region *r = Region::getInstanceByIndex(i, status);
+        if (U_FAILURE(status) || r == NULL || r->getIndex() != i) {
+            errln("Region::getInstanceByIndex(%d) failed - %s", (int)i, u_errorName(status));
+            return;
+        }
+        for (int32_t j = 0 ; j < limit ; j++ ) {
+            const Region *other = Region::getInstanceByIndex(j, status);
+            if (Region::containsIndex(i, j) != r->contains(*other)) {
+                errln("Region::containsIndex(\"%s\", \"%s\") differs from contains()",
+                      r->getRegionCode(), other->getRegionCode());
+            }
+        }
+    }
+    const Region *europe = Region::getInstance("150", status);
+    const Region *italy = Region::getInstance("IT", status);
+    const Region *japan = Region::getInstance("JP", status);
+    if (U_FAILURE(status)) {
+        dataerrln("Region::getInstance() failed - %s", u_errorName(status));
+        return;
+    }
+    assertTrue("150 contains IT", Region::containsIndex(europe->getIndex(), italy->getIndex()));
+    assertFalse("150 contains JP", Region::containsIndex(europe->getIndex(), japan->getIndex()));
+    assertFalse("IT contains 150", Region::containsIndex(italy->getIndex(), europe->getIndex()));
+    assertFalse("index out of range", Region::containsIndex(europe->getIndex(), limit));
+    assertFalse("negative index", Region::containsIndex(-1, italy->getIndex()));
+
+    Region::getInstanceByIndex(limit, status);
+    assertEquals("getInstanceByIndex(limit)", U_ILLEGAL_ARGUMENT_ERROR, status);
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 //eof
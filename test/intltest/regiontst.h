@@ -38,6 +38,7 @@ class RegionTest: public IntlTest {
     void TestContains(void);
     void TestAvailableTerritories(void);
     void TestNoContainedRegions(void);
+    void TestIndexes(void);
 
 private:
 
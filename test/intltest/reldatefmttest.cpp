@@ -768,6 +768,7 @@ class RelativeDateTimeFormatterTest : public IntlTest {
     void TestFormat();
     void TestFormatNumeric();
     void TestLocales();
+    void TestIntegerFastPath();
     void RunTest(
             const Locale& locale,
             const WithQuantityExpected* expectedResults,
@@ -858,6 +859,7 @@ void RelativeDateTimeFormatterTest::runIndexedTest(
     TESTCASE_AUTO(TestFormat);
     TESTCASE_AUTO(TestFormatNumeric);
     TESTCASE_AUTO(TestLocales);
+    TESTCASE_AUTO(TestIntegerFastPath);
     TESTCASE_AUTO_END;
 }
 
@@ -1313,6 +1315,70 @@ void RelativeDateTimeFormatterTest::TestLocales() {
     }
 }
 
+void RelativeDateTimeFormatterTest::TestIntegerFastPath() {
+    // Integers take a fast path when the number format shows all integer digits.
+    // Limiting the integer digits disables it but formats small numbers the same,
+    // so compare against such a formatter.
+    static const char *const localeIds[] = { "en", "fr", "ru", "ar", "sr", "cy" };
+    static const double numbers[] = {
+        0, 1, 2, 3, 4, 5, 6, 10, 11, 12, 19, 21, 22, 25, 100, 101, 111, 1000, 1001, 123456 };
+    static const URelativeDateTimeUnit units[] = {
+        UDAT_REL_UNIT_SECOND, UDAT_REL_UNIT_MINUTE, UDAT_REL_UNIT_DAY, UDAT_REL_UNIT_YEAR };
+    static const UDateRelativeDateTimeFormatterStyle styles[] = {
+        UDAT_STYLE_LONG, UDAT_STYLE_SHORT, UDAT_STYLE_NARROW };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(localeIds); ++i) {
+        for (int32_t s = 0; s < UPRV_LENGTHOF(styles); ++s) {
+            IcuTestErrorCode status(*this, "TestIntegerFastPath");
+            Locale locale(localeIds[i]);
+            RelativeDateTimeFormatter fmt(
+                    locale, nullptr, styles[s], UDISPCTX_CAPITALIZATION_NONE, status);
+            if (status.errIfFailureAndReset("Failure creating format object for %s", localeIds[i])) {
+                return;
+            }
+            NumberFormat *nf = static_cast<NumberFormat *>(fmt.getNumberFormat().clone());
+            nf->setMaximumIntegerDigits(9);
+            RelativeDateTimeFormatter ref(
+                    locale, nf, styles[s], UDISPCTX_CAPITALIZATION_NONE, status);
+            if (status.errIfFailureAndReset("Failure creating reference format for %s", localeIds[i])) {
+                return;
+            }
+            for (int32_t u = 0; u < UPRV_LENGTHOF(units); ++u) {
+                for (int32_t n = 0; n < UPRV_LENGTHOF(numbers); ++n) {
+                    for (int32_t sign = 1; sign >= -1; sign -= 2) {
+                        double offset = sign * numbers[n];
+                        UnicodeString expected("x");
+                        UnicodeString actual("x");
+                        ref.formatNumeric(offset, units[u], expected, status);
+                        fmt.formatNumeric(offset, units[u], actual, status);
+                        assertEquals(UnicodeString(localeIds[i]) + " formatNumeric " + offset,
+                                     expected, actual);
+                    }
+                }
+            }
+            status.errIfFailureAndReset("%s formatNumeric", localeIds[i]);
+        }
+    }
+
+    // The older API with an explicit direction takes the same path.
+    IcuTestErrorCode status(*this, "TestIntegerFastPath");
+    RelativeDateTimeFormatter fmt("en", status);
+    if (status.errIfFailureAndReset("Failure creating format object")) {
+        return;
+    }
+    UnicodeString result;
+    fmt.format(5, UDAT_DIRECTION_LAST, UDAT_RELATIVE_MINUTES, result, status);
+    assertEquals("5 minutes ago", u"5 minutes ago", result);
+    result.remove();
+    fmt.format(1, UDAT_DIRECTION_NEXT, UDAT_RELATIVE_HOURS, result, status);
+    assertEquals("in 1 hour", u"in 1 hour", result);
+    result.remove();
+    fmt.formatNumeric(-1234, UDAT_REL_UNIT_DAY, result, status);
+    assertEquals("1,234 days ago", u"1,234 days ago", result);
+    result.remove();
+    fmt.formatNumeric(1.5, UDAT_REL_UNIT_DAY, result, status);
+    assertEquals("in 1.5 days", u"in 1.5 days", result);
+}
+
 static const char *kLast2 = "Last_2";
 static const char *kLast = "Last";
 static const char *kThis = "This";
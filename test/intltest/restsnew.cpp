@@ -8,9 +8,14 @@
 #include "unicode/utypes.h"
 
 #include "cmemory.h"
+#include "charstr.h"
 #include "cstring.h"
+#include "hash.h"
+#include "ureslocs.h"
+#include "uresimp.h"
 #include "unicode/unistr.h"
 #include "unicode/resbund.h"
+#include "unicode/ressink.h"
 #include "restsnew.h"
 
 #include <stdlib.h>
@@ -195,6 +200,7 @@ void NewResourceBundleTest::runIndexedTest( int32_t index, UBool exec, const cha
 #endif
 
     case 5: name = "TestGetByFallback";  if(exec) TestGetByFallback(); break;
+    case 6: name = "TestGetAllItemsWithFallback";  if(exec) TestGetAllItemsWithFallback(); break;
         default: name = ""; break; //needed to end loop
     }
 }
@@ -1198,5 +1204,83 @@ NewResourceBundleTest::TestGetByFallback() {
     status = U_ZERO_ERROR;
 
 }
-//eof
 
+namespace {
+
+// Collects the display name of each currency, child bundle first.
+class CurrencyNamesSink : public ResourceSink {
+public:
+    CurrencyNamesSink(UErrorCode &errorCode) : names(errorCode), putCount(0) {
+        names.setValueDeleter(uprv_deleteUObject);
+    }
+    virtual ~CurrencyNamesSink();
+
+    virtual void put(const char * /*key*/, ResourceValue &value, UBool /*noFallback*/,
+                     UErrorCode &errorCode) {
+        ++putCount;
+        ResourceTable table = value.getTable(errorCode);
+        if (U_FAILURE(errorCode)) { return; }
+        const char *key;
+        for (int32_t i = 0; table.getKeyAndValue(i, key, value); ++i) {
+            UnicodeString isoCode(key, -1, US_INV);
+            if (names.get(isoCode) != NULL) { continue; }
+            ResourceArray array = value.getArray(errorCode);
+            if (U_FAILURE(errorCode) || !array.getValue(1, value)) { return; }
+            names.put(isoCode, new UnicodeString(value.getUnicodeString(errorCode)), errorCode);
+        }
+    }
+
+    Hashtable names;
+    int32_t putCount;
+};
+
+CurrencyNamesSink::~CurrencyNamesSink() {}
+
+}  // namespace
+
+void
+NewResourceBundleTest::TestGetAllItemsWithFallback() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUResourceBundlePointer deCH(ures_open(U_ICUDATA_CURR, "de_CH", &status));
+    CurrencyNamesSink sink(status);
+    ures_getAllItemsWithFallback(deCH.getAlias(), "Currencies", sink, status);
+    if (U_FAILURE(status)) {
+        dataerrln("ures_getAllItemsWithFallback(Currencies) failed - %s", u_errorName(status));
+        return;
+    }
+    // de_CH, de, root
+    assertEquals("put() calls", 3, sink.putCount);
+    assertTrue("many currencies", sink.names.count() > 100);
+
+    // Each name must be the one that per-item fallback lookup finds.
+    int32_t pos = UHASH_FIRST;
+    const UHashElement *element;
+    while ((element = sink.names.nextElement(pos)) != NULL) {
+        const UnicodeString &isoCode = *static_cast<const UnicodeString *>(element->key.pointer);
+        CharString path("Currencies/", status);
+        path.appendInvariantChars(isoCode, status);
+        LocalUResourceBundlePointer item(
+            ures_getByKeyWithFallback(deCH.getAlias(), path.data(), NULL, &status));
+        UnicodeString expected = ures_getUnicodeStringByIndex(item.getAlias(), 1, &status);
+        if (U_FAILURE(status)) {
+            errln(UnicodeString("ures_getByKeyWithFallback(") + path.data() + ") failed - " +
+                  u_errorName(status));
+            return;
+        }
+        assertEquals(path.data(), expected, *static_cast<const UnicodeString *>(element->value.pointer));
+    }
+
+    // The C++ API enumerates the same items.
+    ResourceBundle deCHRes(U_ICUDATA_CURR, "de_CH", status);
+    CurrencyNamesSink bundleSink(status);
+    deCHRes.getAllItemsWithFallback("Currencies", bundleSink, status);
+    assertSuccess("ResourceBundle::getAllItemsWithFallback(Currencies)", status);
+    assertEquals("ResourceBundle put() calls", sink.putCount, bundleSink.putCount);
+    assertEquals("ResourceBundle currency count", sink.names.count(), bundleSink.names.count());
+
+    CurrencyNamesSink missingSink(status);
+    deCHRes.getAllItemsWithFallback("NoSuchTable", missingSink, status);
+    assertEquals("missing path", U_MISSING_RESOURCE_ERROR, status);
+    assertEquals("missing path put() calls", 0, missingSink.putCount);
+}
+//eof
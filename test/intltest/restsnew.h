@@ -38,6 +38,8 @@ class NewResourceBundleTest: public IntlTest {
 
     void TestGetByFallback(void);
 
+    void TestGetAllItemsWithFallback(void);
+
 private:
     /**
      * The assignment operator has no real implementation.
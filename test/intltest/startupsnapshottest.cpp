@@ -0,0 +1,180 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* startupsnapshottest.cpp
+*
+* created on: 2026oct14
+*******************************************************************************
+*/
+
+#include "unicode/utypes.h"
+
+#include "intltest.h"
+
+#if !UCONFIG_NO_FORMATTING && !UCONFIG_NO_COLLATION && !UCONFIG_NO_BREAK_ITERATION
+
+#include "unicode/brkiter.h"
+#include "unicode/coll.h"
+#include "unicode/dcfmtsym.h"
+#include "unicode/dtfmtsym.h"
+#include "unicode/localpointer.h"
+#include "unicode/plurrule.h"
+#include "unicode/smpdtfmt.h"
+#include "unicode/startupsnapshot.h"
+#include "cmemory.h"
+
+class StartupSnapshotTest : public IntlTest {
+public:
+    void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=0);
+private:
+    void TestRoundTrip();
+    void TestInvalid();
+};
+
+void StartupSnapshotTest::runIndexedTest(
+        int32_t index, UBool exec, const char *&name, char *) {
+    if (exec) {
+        logln("TestSuite StartupSnapshotTest: ");
+    }
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestRoundTrip);
+    TESTCASE_AUTO(TestInvalid);
+    TESTCASE_AUTO_END;
+}
+
+void StartupSnapshotTest::TestRoundTrip() {
+    IcuTestErrorCode errorCode(*this, "TestRoundTrip");
+    LocalPointer<Collator> coll(Collator::createInstance("de@collation=phonebook", errorCode));
+    LocalPointer<BreakIterator> bi(BreakIterator::createWordInstance("en", errorCode));
+    LocalPointer<DecimalFormatSymbols> dfs(new DecimalFormatSymbols("de_CH", errorCode), errorCode);
+    LocalPointer<DateFormatSymbols> dtfs(new DateFormatSymbols("fr", errorCode), errorCode);
+    LocalPointer<PluralRules> rules(PluralRules::forLocale("ru", errorCode));
+    if (errorCode.errDataIfFailureAndReset("unable to create the objects")) {
+        return;
+    }
+    coll->setAttribute(UCOL_STRENGTH, UCOL_SECONDARY, errorCode);
+
+    StartupSnapshotBuilder builder(errorCode);
+    int32_t collIndex = builder.addCollator(*coll, errorCode);
+    int32_t biIndex = builder.addBreakIterator(*bi, errorCode);
+    int32_t dfsIndex = builder.addDecimalFormatSymbols(*dfs, errorCode);
+    int32_t dtfsIndex = builder.addDateFormatSymbols(*dtfs, errorCode);
+    int32_t rulesIndex = builder.addPluralRules(*rules, errorCode);
+    if (errorCode.errIfFailureAndReset("unable to add the objects")) {
+        return;
+    }
+    assertEquals("item indexes", 4, rulesIndex);
+    int32_t length = builder.build(NULL, 0, errorCode);
+    assertEquals("preflighting", U_BUFFER_OVERFLOW_ERROR, errorCode.reset());
+    // A heap block has the alignment of a mapped file for the purposes of the test.
+    MaybeStackArray<uint8_t, 1> bytes;
+    if (bytes.resize(length) == NULL) {
+        errln("out of memory");
+        return;
+    }
+    assertEquals("build() length", length, builder.build(bytes.getAlias(), length, errorCode));
+
+    StartupSnapshot snapshot(bytes.getAlias(), length, errorCode);
+    if (errorCode.errIfFailureAndReset("StartupSnapshot()")) {
+        return;
+    }
+    assertEquals("getItemCount()", 5, snapshot.getItemCount());
+
+    LocalPointer<Collator> coll2(snapshot.createCollator(collIndex, errorCode));
+    LocalPointer<BreakIterator> bi2(snapshot.createBreakIterator(biIndex, errorCode));
+    LocalPointer<DecimalFormatSymbols> dfs2(snapshot.createDecimalFormatSymbols(dfsIndex, errorCode));
+    LocalPointer<DateFormatSymbols> dtfs2(snapshot.createDateFormatSymbols(dtfsIndex, errorCode));
+    LocalPointer<PluralRules> rules2(snapshot.createPluralRules(rulesIndex, errorCode));
+    if (errorCode.errIfFailureAndReset("unable to create the objects from the snapshot")) {
+        return;
+    }
+
+    assertEquals("collator strength", UCOL_SECONDARY,
+                 coll2->getAttribute(UCOL_STRENGTH, errorCode));
+    assertTrue("collator tailoring", *coll == *coll2);
+    static const UChar *const strings[] = {
+        u"\u00C4rger", u"Aerosol", u"Arbeit", u"\u00C4hre", u"aerger", u"Zeder"
+    };
+    for (int32_t i = 1; i < UPRV_LENGTHOF(strings); ++i) {
+        UnicodeString a(strings[i - 1]), b(strings[i]);
+        assertEquals(UnicodeString("compare ") + a + " " + b,
+                     coll->compare(a, b, errorCode), coll2->compare(a, b, errorCode));
+    }
+
+    UnicodeString text(u"It's 10:30, isn't it? The book costs $12.50.");
+    bi->setText(text);
+    bi2->setText(text);
+    int32_t boundary;
+    do {
+        boundary = bi->next();
+        assertEquals("word boundary", boundary, bi2->next());
+        assertEquals("rule status", bi->getRuleStatus(), bi2->getRuleStatus());
+    } while (boundary != BreakIterator::DONE);
+
+    assertTrue("DecimalFormatSymbols", *dfs == *dfs2);
+    assertEquals("DecimalFormatSymbols locale", "de_CH", dfs2->getLocale().getName());
+    assertEquals("DecimalFormatSymbols actual locale",
+                 dfs->getLocale(ULOC_ACTUAL_LOCALE, errorCode).getName(),
+                 dfs2->getLocale(ULOC_ACTUAL_LOCALE, errorCode).getName());
+
+    assertTrue("DateFormatSymbols", *dtfs == *dtfs2);
+    UnicodeString pattern(u"EEEE d MMMM y G, QQQQ, h:mm a");
+    SimpleDateFormat fmt(pattern, *dtfs, errorCode);
+    SimpleDateFormat fmt2(pattern, *dtfs2, errorCode);
+    UnicodeString s, s2;
+    assertEquals("formatted with the DateFormatSymbols",
+                 fmt.format(1234567890123.0, s), fmt2.format(1234567890123.0, s2));
+
+    assertTrue("PluralRules", *rules == *rules2);
+    static const double numbers[] = { 0, 1, 2, 5, 11, 21, 22, 1.5 };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(numbers); ++i) {
+        assertEquals("plural category", rules->select(numbers[i]), rules2->select(numbers[i]));
+    }
+    errorCode.errIfFailureAndReset("using the objects");
+}
+
+void StartupSnapshotTest::TestInvalid() {
+    IcuTestErrorCode errorCode(*this, "TestInvalid");
+    StartupSnapshotBuilder builder(errorCode);
+    LocalPointer<PluralRules> rules(PluralRules::createRules(u"one: n is 1", errorCode));
+    builder.addPluralRules(*rules, errorCode);
+    MaybeStackArray<uint8_t, 1> bytes;
+    int32_t length = builder.build(NULL, 0, errorCode);
+    errorCode.reset();
+    if (bytes.resize(length) == NULL) {
+        errln("out of memory");
+        return;
+    }
+    builder.build(bytes.getAlias(), length, errorCode);
+    if (errorCode.errIfFailureAndReset("build()")) {
+        return;
+    }
+
+    {
+        StartupSnapshot snapshot(bytes.getAlias(), length, errorCode);
+        LocalPointer<Collator> coll(snapshot.createCollator(0, errorCode));
+        assertEquals("wrong item type", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+        LocalPointer<PluralRules> rules2(snapshot.createPluralRules(1, errorCode));
+        assertEquals("index out of range", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+        rules2.adoptInstead(snapshot.createPluralRules(0, errorCode));
+        if (!errorCode.errIfFailureAndReset("createPluralRules()")) {
+            assertTrue("PluralRules", *rules == *rules2);
+        }
+    }
+    {
+        StartupSnapshot snapshot(bytes.getAlias(), length - 16, errorCode);
+        assertEquals("truncated", U_INVALID_FORMAT_ERROR, errorCode.reset());
+    }
+    bytes[12] = 0x78;  // Change the data format.
+    {
+        StartupSnapshot snapshot(bytes.getAlias(), length, errorCode);
+        assertEquals("not a snapshot", U_INVALID_FORMAT_ERROR, errorCode.reset());
+    }
+}
+
+extern IntlTest *createStartupSnapshotTest() {
+    return new StartupSnapshotTest();
+}
+
+#endif  // !UCONFIG_NO_FORMATTING && !UCONFIG_NO_COLLATION && !UCONFIG_NO_BREAK_ITERATION
@@ -69,6 +69,7 @@ class StringCaseTest: public IntlTest {
     void TestInPlaceTitle();
     void TestCaseMapEditsIteratorDocs();
     void TestCaseMapGreekExtended();
+    void TestLongASCIIRuns();
 
 private:
     void assertGreekUpper(const char16_t *s, const char16_t *expected);
@@ -115,6 +116,7 @@ StringCaseTest::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
 #endif
     TESTCASE_AUTO(TestCaseMapEditsIteratorDocs);
     TESTCASE_AUTO(TestCaseMapGreekExtended);
+    TESTCASE_AUTO(TestLongASCIIRuns);
     TESTCASE_AUTO_END;
 }
 
@@ -633,6 +635,17 @@ StringCaseTest::TestTitleOptions() {
                    nullptr, "nl-BE", U_TITLECASE_WHOLE_STRING);
     TestCasingImpl(u"«ijs»", u"«İjs»", TEST_TITLE,
                    nullptr, "tr-DE", U_TITLECASE_WHOLE_STRING);
+    // New option in ICU 64.
+    TestCasingImpl(u" bOB's  dINER-bAR\tijs", u" Bob's  Diner-bar\tIjs", TEST_TITLE,
+                   nullptr, "", U_TITLECASE_WHITE_SPACE_WORDS);
+    TestCasingImpl(u"ijs «ijs» ", u"IJs «IJs» ", TEST_TITLE,
+                   nullptr, "nl", U_TITLECASE_WHITE_SPACE_WORDS);
+    TestCasingImpl(u"iPhone mAX", u"IPhone MAX", TEST_TITLE,
+                   nullptr, "", U_TITLECASE_WHITE_SPACE_WORDS|U_TITLECASE_NO_LOWERCASE);
+    // Word iterators are reused from one call to the next; alternate locales.
+    TestCasingImpl(u"ijs ijs", u"IJs IJs", TEST_TITLE, nullptr, "nl", 0);
+    TestCasingImpl(u"ijs ijs", u"Ijs Ijs", TEST_TITLE, nullptr, "", 0);
+    TestCasingImpl(u"ijs ijs", u"IJs IJs", TEST_TITLE, nullptr, "nl", 0);
 
 #if !UCONFIG_NO_BREAK_ITERATION
     // Test conflicting settings.
@@ -653,6 +666,13 @@ StringCaseTest::TestTitleOptions() {
               errorCode.errorName());
     }
     errorCode.reset();
+    CaseMap::toTitle("", U_TITLECASE_WHITE_SPACE_WORDS|U_TITLECASE_WHOLE_STRING, nullptr,
+                     u"", 0, nullptr, 0, nullptr, errorCode);
+    if (errorCode.get() != U_ILLEGAL_ARGUMENT_ERROR) {
+        errln("CaseMap::toTitle(white space words + whole string) -> %s not illegal argument",
+              errorCode.errorName());
+    }
+    errorCode.reset();
     LocalPointer<BreakIterator> iter(
         BreakIterator::createCharacterInstance(Locale::getRoot(), errorCode));
     CaseMap::toTitle("", U_TITLECASE_WHOLE_STRING, iter.getAlias(),
@@ -1700,4 +1720,75 @@ void StringCaseTest::TestCaseMapGreekExtended() {
 #endif
 }
 
+void StringCaseTest::TestLongASCIIRuns() {
+    // Lowercasing handles long ASCII runs several code units at a time.
+    // Vary the alignment and the run lengths, and mix in non-ASCII and Turkic I.
+    static const char16_t *const unit = u"ABCDEFGHIJKLMNOPQRSTUVWXYZ@[`{ 0123456789 abcdefghijklmnopqrstuvwxyz \u00C0\u00C9\u00CE ";
+    static const char16_t *const lower = u"abcdefghijklmnopqrstuvwxyz@[`{ 0123456789 abcdefghijklmnopqrstuvwxyz \u00E0\u00E9\u00EE ";
+    static const char16_t *const trLower = u"abcdefgh\u0131jklmnopqrstuvwxyz@[`{ 0123456789 abcdefghijklmnopqrstuvwxyz \u00E0\u00E9\u00EE ";
+    IcuTestErrorCode errorCode(*this, "TestLongASCIIRuns");
+    for (int32_t prefixLength = 0; prefixLength < 18; ++prefixLength) {
+        for (int32_t count = 1; count <= 6; count += 5) {
+            UnicodeString src(prefixLength, (UChar32)u'X', prefixLength);
+            UnicodeString expected(prefixLength, (UChar32)u'x', prefixLength);
+            UnicodeString trExpected(expected);
+            for (int32_t i = 0; i < count; ++i) {
+                src.append(unit);
+                expected.append(lower);
+                trExpected.append(trLower);
+            }
+            // count 6 is longer than the UnicodeString stack buffer and uses Edits.
+            UnicodeString result(src);
+            result.toLower(Locale::getRoot());
+            assertEquals(UnicodeString("toLower(root) prefix ") + prefixLength, expected, result);
+            result = src;
+            result.toLower(Locale("tr"));
+            assertEquals(UnicodeString("toLower(tr) prefix ") + prefixLength, trExpected, result);
+            result = src;
+            result.foldCase();
+            assertEquals(UnicodeString("foldCase() prefix ") + prefixLength, expected, result);
+
+            // Preflighting and a too-short buffer.
+            UChar dest[600];
+            int32_t length = u_strToLower(dest, 0, src.getBuffer(), src.length(), "", errorCode);
+            errorCode.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+            assertEquals("u_strToLower() preflighting", expected.length(), length);
+            length = u_strToLower(dest, expected.length() - 1,
+                                  src.getBuffer(), src.length(), "", errorCode);
+            errorCode.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+            assertEquals("u_strToLower() overflow", expected.length(), length);
+            length = u_strToLower(dest, UPRV_LENGTHOF(dest), src.getBuffer(), src.length(), "", errorCode);
+            errorCode.errIfFailureAndReset("u_strToLower()");
+            assertEquals("u_strToLower()", expected, UnicodeString(dest, length));
+
+            // UTF-8, with and without Edits.
+            std::string src8, expected8, trExpected8;
+            src.toUTF8String(src8);
+            expected.toUTF8String(expected8);
+            trExpected.toUTF8String(trExpected8);
+            std::string dest8;
+            StringByteSink<std::string> sink(&dest8);
+            CaseMap::utf8ToLower("", 0, src8, sink, nullptr, errorCode);
+            errorCode.errIfFailureAndReset("utf8ToLower(root)");
+            assertEquals("utf8ToLower(root)", expected8.c_str(), dest8.c_str());
+            dest8.clear();
+            Edits edits;
+            CaseMap::utf8ToLower("tr", 0, src8, sink, &edits, errorCode);
+            errorCode.errIfFailureAndReset("utf8ToLower(tr)");
+            assertEquals("utf8ToLower(tr)", trExpected8.c_str(), dest8.c_str());
+            assertEquals("utf8ToLower(tr) lengthDelta",
+                         (int32_t)(trExpected8.length() - src8.length()), edits.lengthDelta());
+            char dest8Array[1200];
+            length = CaseMap::utf8ToLower("", 0, src8.data(), (int32_t)src8.length(),
+                                          dest8Array, (int32_t)expected8.length() - 1, nullptr, errorCode);
+            errorCode.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+            assertEquals("utf8ToLower() overflow", (int32_t)expected8.length(), length);
+            length = CaseMap::utf8ToLower("", 0, src8.data(), (int32_t)src8.length(),
+                                          dest8Array, UPRV_LENGTHOF(dest8Array), nullptr, errorCode);
+            errorCode.errIfFailureAndReset("utf8ToLower() to array");
+            assertEquals("utf8ToLower() to array", expected8.c_str(), std::string(dest8Array, length).c_str());
+        }
+    }
+}
+
 //#endif
@@ -33,6 +33,8 @@
 #include "unicode/selfmt.h"
 #include "unicode/gregocal.h"
 #include "unicode/strenum.h"
+#include "sharedmsgfmt.h"
+#include "sharedobject.h"
 #include <stdio.h>
 
 void
@@ -72,6 +74,8 @@ TestMessageFormat::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestDecimals);
     TESTCASE_AUTO(TestArgIsPrefixOfAnother);
     TESTCASE_AUTO(TestMessageFormatNumberSkeleton);
+    TESTCASE_AUTO(TestTypedArguments);
+    TESTCASE_AUTO(TestSharedInstance);
     TESTCASE_AUTO_END;
 }
 
@@ -2029,4 +2033,131 @@ void TestMessageFormat::TestMessageFormatNumberSkeleton() {
     }
 }
 
+
+void TestMessageFormat::TestTypedArguments() {
+    IcuTestErrorCode status(*this, "TestTypedArguments");
+
+    static const char16_t* patterns[] = {
+        u"{0} has {1,number} new messages",
+        u"{0}, {1,number,integer} of {2,number,percent}: {3}",
+        u"It''s '{'{0}'}' and {1}, not {4}",
+        u"On {4,date,short} {0} paid {3,number,currency}.",
+        u"{4}|{1}|{3}",
+        u"",
+        // not compiled: these use the general formatting code
+        u"{0} has {1,plural,one{# new message}other{# new messages}}",
+        u"{1,choice,0#none|1#one|1<{1,number} of {0}}",
+        u"{0,select,Alice{She}other{They}} left",
+    };
+    const UnicodeString name(u"Alice");
+    const UDate date = 1000000000000.0;
+    const MessageArgument typedArgs[] = {
+        MessageArgument(name), MessageArgument((int32_t)3), MessageArgument((int64_t)1234567),
+        MessageArgument(0.25), MessageArgument::forDate(date)
+    };
+    Formattable args[5];
+    args[0].setString(name);
+    args[1].setLong(3);
+    args[2].setInt64(1234567);
+    args[3].setDouble(0.25);
+    args[4].setDate(date);
+
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        status.setScope(patterns[i]);
+        MessageFormat mf(patterns[i], Locale::getEnglish(), status);
+        for (int32_t count = 3; count <= UPRV_LENGTHOF(args); ++count) {
+            FieldPosition ignore;
+            UnicodeString expected, actual(u"x");
+            mf.format(args, count, expected, ignore, status);
+            mf.format(typedArgs, count, actual, status);
+            assertEquals("typed arguments", UnicodeString(u"x") + expected, actual);
+        }
+    }
+    status.setScope("");
+
+    // Formatting after setFormat(), and with a copy
+    MessageFormat mf(u"{0} has {1,number} new messages", Locale::getEnglish(), status);
+    LocalPointer<NumberFormat> percent(NumberFormat::createPercentInstance(Locale::getEnglish(), status));
+    if (status.errIfFailureAndReset("createPercentInstance")) {
+        return;
+    }
+    mf.setFormat(1, *percent);
+    MessageFormat copy(mf);
+    UnicodeString result;
+    assertEquals("setFormat()", u"Alice has 300% new messages",
+                 mf.format(typedArgs, 2, result, status));
+    assertEquals("copy", u"Alice has 300% new messages",
+                 copy.format(typedArgs, 2, result.remove(), status));
+    mf.applyPattern(u"{1}: {0}", status);
+    assertEquals("applyPattern()", u"3: Alice", mf.format(typedArgs, 2, result.remove(), status));
+
+    // A string passed to a number format fails the same way as with Formattable arguments
+    mf.applyPattern(u"{0,number}", status);
+    {
+        UErrorCode expectedCode = U_ZERO_ERROR, actualCode = U_ZERO_ERROR;
+        FieldPosition ignore;
+        UnicodeString expected, actual;
+        mf.format(args, 1, expected, ignore, expectedCode);
+        mf.format(typedArgs, 1, actual, actualCode);
+        assertEquals("string for a number format", u_errorName(expectedCode), u_errorName(actualCode));
+    }
+
+    mf.format(static_cast<const MessageArgument*>(nullptr), 1, result.remove(), status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+}
+
+void TestMessageFormat::TestSharedInstance() {
+    IcuTestErrorCode status(*this, "TestSharedInstance");
+
+    static const char16_t* patterns[] = {
+        u"{0} has {1,number} new messages",
+        u"{0} has {1,plural,one{# new message}other{# new messages}}",
+        u"{1,selectordinal,one{#st}two{#nd}few{#rd}other{#th}} on {2}",
+        u"{0,select,Alice{She}other{They}} left {1,choice,0#nothing|1#one|1<{1,number} items}",
+    };
+    Formattable args[3];
+    args[0].setString(u"Alice");
+    args[1].setLong(3);
+    args[2].setDate(1000000000000.0);
+
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        status.setScope(patterns[i]);
+        const SharedMessageFormat* shared =
+            MessageFormat::createSharedInstance(patterns[i], Locale::getEnglish(), status);
+        if (status.errDataIfFailureAndReset("createSharedInstance")) {
+            continue;
+        }
+        const SharedMessageFormat* again =
+            MessageFormat::createSharedInstance(patterns[i], Locale::getEnglish(), status);
+        assertTrue("same pattern and locale share one instance", shared == again);
+        again->removeRef();
+
+        MessageFormat mf(patterns[i], Locale::getEnglish(), status);
+        FieldPosition ignore;
+        UnicodeString expected, actual;
+        mf.format(args, UPRV_LENGTHOF(args), expected, ignore, status);
+        (*shared)->format(args, UPRV_LENGTHOF(args), actual, ignore, status);
+        assertEquals("shared instance", expected, actual);
+        shared->removeRef();
+    }
+    status.setScope("");
+
+    // A different locale gets its own instance.
+    const SharedMessageFormat* en =
+        MessageFormat::createSharedInstance(patterns[0], Locale::getEnglish(), status);
+    const SharedMessageFormat* fr =
+        MessageFormat::createSharedInstance(patterns[0], Locale::getFrench(), status);
+    if (!status.errDataIfFailureAndReset("createSharedInstance(fr)")) {
+        assertTrue("different locales", en != fr);
+        assertEquals("locale", "fr", (*fr)->getLocale().getLanguage());
+    }
+    SharedObject::clearPtr(en);
+    SharedObject::clearPtr(fr);
+
+    const SharedMessageFormat* bad =
+        MessageFormat::createSharedInstance(u"{0,number", Locale::getEnglish(), status);
+    status.expectErrorAndReset(U_UNMATCHED_BRACES);
+    assertTrue("no instance for a bad pattern", bad == nullptr);
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
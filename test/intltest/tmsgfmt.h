@@ -122,6 +122,8 @@ class TestMessageFormat: public IntlTest {
     void TestDecimals();
     void TestArgIsPrefixOfAnother();
     void TestMessageFormatNumberSkeleton();
+    void TestTypedArguments();
+    void TestSharedInstance();
 
 private:
     UnicodeString GetPatternAndSkipSyntax(const MessagePattern& pattern);
@@ -15,6 +15,7 @@
 #if !UCONFIG_NO_TRANSLITERATION
 
 #include "transtst.h"
+#include "unicode/localpointer.h"
 #include "unicode/locid.h"
 #include "unicode/dtfmtsym.h"
 #include "unicode/normlzr.h"
@@ -196,6 +197,8 @@ TransliteratorTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(82,TestHalfwidthFullwidth);
         TESTCASE(83,TestThai);
         TESTCASE(84,TestAny);
+        TESTCASE(85,TestRuleCandidateOrder);
+        TESTCASE(86,TestLongCompound);
         default: name = ""; break;
     }
 }
@@ -3879,6 +3882,78 @@ void TransliteratorTest::TestAnyX(void) {
     delete anyLatin;
 }
 
+/**
+ * The rule set tries only the rules that can match at each position,
+ * looked up by literal key prefix and by first key set.
+ * Make sure that they are still tried in rule order.
+ */
+void TransliteratorTest::TestRuleCandidateOrder(void) {
+    UnicodeString rules(
+        "ab > X; [a-c]b > Y; y { a > P; a > Z; b } c > V; [ab] > W;"
+        "[{xy}] > U; x > Q; c > R; \\U0001D49C > S; [\\U0001D49D] > T;");
+    expect(rules, "abcbbcxyxacya", "XYVRUQZRyP");
+    expect(rules, CharsToUnicodeString("\\U0001D49C\\U0001D49Dbz"), "STWz");
+}
+
+/**
+ * Long texts go through a compound transliterator a chunk at a time.
+ * Make sure that the result is the same as running each element over
+ * the whole text in turn, including for a supplementary code point
+ * at a chunk boundary and for a pending match that spans several chunks.
+ */
+void TransliteratorTest::TestLongCompound(void) {
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError parseError;
+    LocalPointer<Transliterator> t(Transliterator::createFromRules("Test",
+        ":: NFD; a b+ c > Q; x } y > z; \\U0001D400 > E; :: Lower; :: NFC;",
+        UTRANS_FORWARD, parseError, status));
+    if (U_FAILURE(status)) {
+        dataerrln("FAIL: createFromRules() - %s", u_errorName(status));
+        return;
+    }
+
+    UnicodeString text;
+    while (text.length() < 1023) {
+        text.append((UChar)0x79);  // y
+    }
+    text.append((UChar32)0x1D400);
+    for (int32_t i = 0; i < 500; ++i) {
+        text.append(CharsToUnicodeString("Ab\\u0308xyY\\U0001D401c\\u00E9 abc"));
+    }
+    text.append((UChar)0x61);  // a
+    for (int32_t i = 0; i < 5000; ++i) {
+        text.append((UChar)0x62);  // b
+    }
+    text.append(CharsToUnicodeString("cXY\\u00C5"));
+    for (int32_t i = 0; i < 3000; ++i) {
+        text.append(CharsToUnicodeString("ab\\u0301"));
+    }
+
+    UnicodeString expected(text);
+    for (int32_t i = 0; i < t->countElements(); ++i) {
+        t->getElement(i, status).transliterate(expected);
+    }
+    assertSuccess("getElement()", status);
+    UnicodeString actual(text);
+    t->transliterate(actual);
+    if (actual != expected) {
+        int32_t i = 0;
+        while (i < actual.length() && i < expected.length() && actual[i] == expected[i]) {
+            ++i;
+        }
+        errln("FAIL: long compound transliteration differs from stepwise at index %d", (int)i);
+    }
+
+    // Text before the start and after the limit is context, and stays in place.
+    UnicodeString prefix(CharsToUnicodeString("x\\u00C5"));
+    UnicodeString contextText(prefix);
+    contextText.append(text).append((UChar)0x79);
+    int32_t limit = t->transliterate(contextText, prefix.length(), prefix.length() + text.length());
+    assertEquals("long compound transliteration with context",
+                 UnicodeString(prefix).append(expected).append((UChar)0x79), contextText);
+    assertEquals("long compound transliteration limit", prefix.length() + expected.length(), limit);
+}
+
 /**
  * Test Any-X transliterators with sample letters from all scripts.
  */
@@ -338,6 +338,10 @@ class TransliteratorTest : public IntlTest {
 
     void TestAny(void);
 
+    void TestRuleCandidateOrder(void);
+
+    void TestLongCompound(void);
+
     void TestSourceTargetSet(void);
 
     void TestPatternWhiteSpace(void);
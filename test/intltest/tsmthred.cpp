@@ -17,6 +17,7 @@
 #include "uparse.h"
 #include "unicode/localpointer.h"
 #include "unicode/resbund.h"
+#include "unicode/ures.h"
 #include "unicode/udata.h"
 #include "unicode/uloc.h"
 #include "unicode/locid.h"
@@ -24,9 +25,15 @@
 #include "intltest.h"
 #include "tsmthred.h"
 #include "unicode/ushape.h"
+#include "unicode/regex.h"
+#include "unicode/normalizer2.h"
+#include "unicode/bytestream.h"
 #include "unicode/translit.h"
+#include "unicode/ucnv.h"
 #include "sharedobject.h"
 #include "unifiedcache.h"
+#include "sharedformatpool.h"
+#include "sharedmsgfmt.h"
 #include "uassert.h"
 
 
@@ -52,8 +59,12 @@ MultithreadTest::~MultithreadTest()
 
 // for mthreadtest
 #include "unicode/numfmt.h"
+#include "unicode/decimfmt.h"
+#include "unicode/numberparser.h"
+#include "unicode/smpdtfmt.h"
 #include "unicode/choicfmt.h"
 #include "unicode/msgfmt.h"
+#include "unicode/dtitvfmt.h"
 #include "unicode/locid.h"
 #include "unicode/coll.h"
 #include "unicode/calendar.h"
@@ -81,11 +92,29 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
     TESTCASE_AUTO(TestUnifiedCache);
 #if !UCONFIG_NO_TRANSLITERATION
     TESTCASE_AUTO(TestBreakTranslit);
+    TESTCASE_AUTO(TestSharedRuleBasedTranslit);
     TESTCASE_AUTO(TestIncDec);
 #if !UCONFIG_NO_FORMATTING
     TESTCASE_AUTO(Test20104);
 #endif /* #if !UCONFIG_NO_FORMATTING */
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
+#if !UCONFIG_NO_FORMATTING
+    TESTCASE_AUTO(TestFormatPool);
+    TESTCASE_AUTO(TestNumberParser);
+    TESTCASE_AUTO(TestSharedMessageFormat);
+    TESTCASE_AUTO(TestDateIntervalFormat);
+#endif
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+    TESTCASE_AUTO(TestRegexMatchOnce);
+#endif
+#if !UCONFIG_NO_NORMALIZATION
+    TESTCASE_AUTO(TestParallelNormalization);
+#endif
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    TESTCASE_AUTO(TestConverterCache);
+#endif
+    TESTCASE_AUTO(TestDataCache);
+    TESTCASE_AUTO(TestResourceBundleCache);
     TESTCASE_AUTO_END
 }
 
@@ -1522,6 +1551,55 @@ void MultithreadTest::TestBreakTranslit() {
 }
 
 
+//
+//  Shared rule-based Transliterator test.
+//     Segment matches must not be shared between threads using one
+//     rule-based transliterator instance.  Reuses BreakTranslitThread.
+//
+
+void MultithreadTest::TestSharedRuleBasedTranslit() {
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError parseError;
+    LocalPointer<Transliterator> tx(Transliterator::createFromRules(
+        UNICODE_STRING_SIMPLE("SwapSegments"),
+        UNICODE_STRING_SIMPLE("([a-z]+) ' ' ([0-9]+) ' ' ([A-Z]?) > $3 ' ' $2 ' ' &Any-Upper($1) ;"),
+        UTRANS_FORWARD, parseError, status));
+    if (U_FAILURE(status)) {
+        dataerrln("File %s, Line %d: Error, status = %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    UnicodeString input;
+    UnicodeString expected;
+    static const char *const words[] = { "alpha", "be", "c", "delta" };
+    for (int32_t i = 0; i < 2000; ++i) {
+        UnicodeString word(words[i % UPRV_LENGTHOF(words)], -1, US_INV);
+        UnicodeString number;
+        number.append((UChar)(0x30 + i % 10)).append((UChar)(0x30 + i / 10 % 10));
+        UnicodeString letter;
+        if (i % 3 != 0) {
+            letter.append((UChar)(0x41 + i % 26));
+        }
+        input.append(word).append((UChar)0x20).append(number).append((UChar)0x20).append(letter).append((UChar)0x2c);
+        expected.append(letter).append((UChar)0x20).append(number).append((UChar)0x20).append(word.toUpper()).append((UChar)0x2c);
+    }
+    gSharedTransliterator = tx.getAlias();
+    gTranslitInput = &input;
+    gTranslitExpected = &expected;
+
+    BreakTranslitThread threads[4];
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].start();
+    }
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].join();
+    }
+
+    gSharedTransliterator = NULL;
+    gTranslitInput = NULL;
+    gTranslitExpected = NULL;
+}
+
+
 class TestIncDecThread : public SimpleThread {
 public:
     TestIncDecThread() { };
@@ -1585,3 +1663,706 @@ void MultithreadTest::Test20104() {
 #endif /* !UCONFIG_NO_FORMATTING */
 
 #endif /* !UCONFIG_NO_TRANSLITERATION */
+
+#if !UCONFIG_NO_FORMATTING
+//-------------------------------------------------------------------------------------------
+//
+//   TestFormatPool.  Threads format with pooled SimpleDateFormat and DecimalFormat
+//                    instances and compare against single-threaded results.
+//
+//-------------------------------------------------------------------------------------------
+
+static const UChar gPoolDatePattern[] = u"yyyy-MM-dd HH:mm:ss";
+static const UChar gPoolNumberPattern[] = u"#,##0.###";
+static UnicodeString *gPoolExpectedDates = NULL;
+static UnicodeString *gPoolExpectedNumbers = NULL;
+static const int32_t POOL_NUM_VALUES = 20;
+
+class FormatPoolThread : public SimpleThread {
+  public:
+    FormatPoolThread() {}
+    virtual void run();
+};
+
+void FormatPoolThread::run() {
+    for (int32_t loop = 0; loop < 200; ++loop) {
+        int32_t i = loop % POOL_NUM_VALUES;
+        UErrorCode status = U_ZERO_ERROR;
+        UnicodeString result;
+        if (loop & 1) {
+            PooledDecimalFormat fmt(Locale::getEnglish(), UnicodeString(gPoolNumberPattern), status);
+            if (U_FAILURE(status)) {
+                IntlTest::gTest->errln("%s:%d Error %s on PooledDecimalFormat.",
+                        __FILE__, __LINE__, u_errorName(status));
+                return;
+            }
+            fmt->format(1234.5 * i, result);
+            if (result != gPoolExpectedNumbers[i]) {
+                IntlTest::gTest->errln("%s:%d Pooled DecimalFormat gave a wrong result for value #%d.",
+                        __FILE__, __LINE__, (int)i);
+            }
+        } else {
+            PooledSimpleDateFormat fmt(Locale::getEnglish(), UnicodeString(gPoolDatePattern), status);
+            if (U_FAILURE(status)) {
+                IntlTest::gTest->errln("%s:%d Error %s on PooledSimpleDateFormat.",
+                        __FILE__, __LINE__, u_errorName(status));
+                return;
+            }
+            fmt->format(1.0e12 + 86400000.0 * 37 * i, result);
+            if (result != gPoolExpectedDates[i]) {
+                IntlTest::gTest->errln("%s:%d Pooled SimpleDateFormat gave a wrong result for value #%d.",
+                        __FILE__, __LINE__, (int)i);
+            }
+        }
+    }
+}
+
+void MultithreadTest::TestFormatPool() {
+    IcuTestErrorCode status(*this, "TestFormatPool");
+    UnicodeString datePattern(gPoolDatePattern);
+    UnicodeString numberPattern(gPoolNumberPattern);
+    const SharedFormatPool *pool =
+        SharedFormatPool::getDateFormatPool(Locale::getEnglish(), datePattern, status);
+    if (status.errDataIfFailureAndReset("getDateFormatPool")) {
+        return;
+    }
+
+    // A released formatter is reused; a modified one is not recycled.
+    Format *first = pool->acquire(status);
+    pool->release(first);
+    int32_t idle = pool->idleCount();
+    Format *second = pool->acquire(status);
+    assertTrue("released formatter is reused", first == second);
+    assertEquals("one fewer idle", idle - 1, pool->idleCount());
+    static_cast<SimpleDateFormat *>(second)->applyPattern(u"HH:mm");
+    pool->release(second);
+    assertEquals("modified formatter not recycled", idle - 1, pool->idleCount());
+    pool->removeRef();
+
+    UnicodeString expectedDates[POOL_NUM_VALUES];
+    UnicodeString expectedNumbers[POOL_NUM_VALUES];
+    SimpleDateFormat dateFormat(datePattern, Locale::getEnglish(), status);
+    DecimalFormat numberFormat(numberPattern, new DecimalFormatSymbols(Locale::getEnglish(), status), status);
+    if (status.errDataIfFailureAndReset("formatters")) {
+        return;
+    }
+    for (int32_t i = 0; i < POOL_NUM_VALUES; ++i) {
+        dateFormat.format(1.0e12 + 86400000.0 * 37 * i, expectedDates[i]);
+        numberFormat.format(1234.5 * i, expectedNumbers[i]);
+    }
+    gPoolExpectedDates = expectedDates;
+    gPoolExpectedNumbers = expectedNumbers;
+
+    static const int32_t NUM_THREADS = 8;
+    LocalPointer<FormatPoolThread> threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i].adoptInstead(new FormatPoolThread());
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+    }
+    gPoolExpectedDates = NULL;
+    gPoolExpectedNumbers = NULL;
+}
+
+
+//-------------------------------------------------------------------------------------------
+//
+//   TestNumberParser.  Threads parse with one shared NumberParser
+//                      and compare against single-threaded results.
+//
+//-------------------------------------------------------------------------------------------
+
+static const number::NumberParser *gSharedNumberParser = NULL;
+static const UnicodeString *gParserInputs = NULL;
+static const double *gParserExpected = NULL;
+static const int32_t PARSER_NUM_VALUES = 20;
+
+class NumberParserThread : public SimpleThread {
+  public:
+    NumberParserThread() {}
+    virtual void run();
+};
+
+void NumberParserThread::run() {
+    for (int32_t loop = 0; loop < 500; ++loop) {
+        int32_t i = loop % PARSER_NUM_VALUES;
+        UErrorCode status = U_ZERO_ERROR;
+        Formattable result;
+        ParsePosition ppos;
+        gSharedNumberParser->parse(gParserInputs[i], result, ppos);
+        if (ppos.getIndex() != gParserInputs[i].length() || result.getDouble(status) != gParserExpected[i]) {
+            IntlTest::gTest->errln("%s:%d Shared NumberParser gave a wrong result for value #%d.",
+                    __FILE__, __LINE__, (int)i);
+        }
+        ppos.setIndex(0);
+        LocalPointer<CurrencyAmount> amount(gSharedNumberParser->parseCurrency(gParserInputs[i], ppos));
+        if (amount.isNull() || amount->getNumber().getDouble(status) != gParserExpected[i] ||
+                UnicodeString(amount->getISOCurrency()) != u"USD") {
+            IntlTest::gTest->errln("%s:%d Shared NumberParser gave a wrong currency for value #%d.",
+                    __FILE__, __LINE__, (int)i);
+        }
+    }
+}
+
+void MultithreadTest::TestNumberParser() {
+    IcuTestErrorCode status(*this, "TestNumberParser");
+    DecimalFormat numberFormat(u"\u00A4#,##0.00", new DecimalFormatSymbols(Locale::getUS(), status), status);
+    numberFormat.setCurrency(u"USD", status);
+    if (status.errDataIfFailureAndReset("DecimalFormat")) {
+        return;
+    }
+    number::NumberParser parser = numberFormat.toNumberParser(status);
+    if (status.errIfFailureAndReset("toNumberParser")) {
+        return;
+    }
+
+    UnicodeString inputs[PARSER_NUM_VALUES];
+    double expected[PARSER_NUM_VALUES];
+    for (int32_t i = 0; i < PARSER_NUM_VALUES; ++i) {
+        expected[i] = 1234.5 * i + 0.25;
+        numberFormat.format(expected[i], inputs[i]);
+    }
+    gSharedNumberParser = &parser;
+    gParserInputs = inputs;
+    gParserExpected = expected;
+
+    static const int32_t NUM_THREADS = 8;
+    LocalPointer<NumberParserThread> threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i].adoptInstead(new NumberParserThread());
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+    }
+    gSharedNumberParser = NULL;
+    gParserInputs = NULL;
+    gParserExpected = NULL;
+}
+
+
+//-------------------------------------------------------------------------------------------
+//
+//   TestSharedMessageFormat.  Threads format with the cached, shared MessageFormat
+//                             while other threads look it up in the cache.
+//
+//-------------------------------------------------------------------------------------------
+
+static const char16_t *gSharedMsgPattern =
+        u"{0} sent {1,plural,one{# message}other{# messages}} on {2}, the {1,selectordinal,"
+        u"one{#st}two{#nd}few{#rd}other{#th}} time";
+static const UnicodeString *gSharedMsgExpected = NULL;
+static const int32_t SHARED_MSG_NUM_VALUES = 10;
+
+static void setSharedMsgArgs(int32_t i, Formattable args[3]) {
+    args[0].setString(i % 2 == 0 ? u"Alice" : u"Bob");
+    args[1].setLong(i);
+    args[2].setDate(1000000000000.0 + 86400000.0 * i);
+}
+
+class SharedMessageFormatThread : public SimpleThread {
+  public:
+    SharedMessageFormatThread(int32_t i) : fOffset(i) {}
+    virtual void run();
+  private:
+    int32_t fOffset;
+};
+
+void SharedMessageFormatThread::run() {
+    for (int32_t loop = 0; loop < 200; ++loop) {
+        int32_t i = (loop + fOffset) % SHARED_MSG_NUM_VALUES;
+        UErrorCode status = U_ZERO_ERROR;
+        const SharedMessageFormat *shared =
+                MessageFormat::createSharedInstance(gSharedMsgPattern, Locale::getEnglish(), status);
+        if (U_FAILURE(status)) {
+            IntlTest::gTest->errln("%s:%d createSharedInstance() failed - %s",
+                    __FILE__, __LINE__, u_errorName(status));
+            return;
+        }
+        Formattable args[3];
+        setSharedMsgArgs(i, args);
+        FieldPosition ignore;
+        UnicodeString result;
+        (*shared)->format(args, 3, result, ignore, status);
+        shared->removeRef();
+        if (U_FAILURE(status) || result != gSharedMsgExpected[i]) {
+            IntlTest::gTest->errln("%s:%d Shared MessageFormat gave a wrong result for value #%d.",
+                    __FILE__, __LINE__, (int)i);
+        }
+    }
+}
+
+void MultithreadTest::TestSharedMessageFormat() {
+    IcuTestErrorCode status(*this, "TestSharedMessageFormat");
+    MessageFormat mf(gSharedMsgPattern, Locale::getEnglish(), status);
+    UnicodeString expected[SHARED_MSG_NUM_VALUES];
+    for (int32_t i = 0; i < SHARED_MSG_NUM_VALUES; ++i) {
+        Formattable args[3];
+        setSharedMsgArgs(i, args);
+        FieldPosition ignore;
+        mf.format(args, 3, expected[i], ignore, status);
+    }
+    if (status.errDataIfFailureAndReset("MessageFormat")) {
+        return;
+    }
+    gSharedMsgExpected = expected;
+
+    static const int32_t NUM_THREADS = 8;
+    LocalPointer<SharedMessageFormatThread> threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i].adoptInstead(new SharedMessageFormatThread(i));
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+    }
+    gSharedMsgExpected = NULL;
+}
+
+
+//-------------------------------------------------------------------------------------------
+//
+//   TestDateIntervalFormat.  Threads format intervals with one shared DateIntervalFormat,
+//                            which must not need a lock for its const format functions.
+//
+//-------------------------------------------------------------------------------------------
+
+static const DateIntervalFormat *gDateIntervalFormat = NULL;
+static const UnicodeString *gDateIntervalExpected = NULL;
+
+static const int32_t DATE_ITV_NUM_VALUES = 5;
+
+// Intervals whose largest different field is the year, month, day, hour and minute.
+static DateInterval getDateInterval(int32_t i) {
+    static const double lengths[DATE_ITV_NUM_VALUES] = {
+        400.0 * 86400000.0, 40.0 * 86400000.0, 2.0 * 86400000.0, 3600000.0, 60000.0
+    };
+    UDate from = 1000000000000.0;
+    return DateInterval(from, from + lengths[i]);
+}
+
+class DateIntervalFormatThread : public SimpleThread {
+  public:
+    DateIntervalFormatThread(int32_t i) : fOffset(i) {}
+    virtual void run();
+  private:
+    int32_t fOffset;
+};
+
+void DateIntervalFormatThread::run() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<Calendar> fromCal(Calendar::createInstance(Locale::getEnglish(), status));
+    LocalPointer<Calendar> toCal(Calendar::createInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status)) {
+        IntlTest::gTest->errln("%s:%d Calendar::createInstance() failed - %s",
+                __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    fromCal->adoptTimeZone(gDateIntervalFormat->getTimeZone().clone());
+    toCal->adoptTimeZone(gDateIntervalFormat->getTimeZone().clone());
+    for (int32_t loop = 0; loop < 500; ++loop) {
+        int32_t i = (loop + fOffset) % DATE_ITV_NUM_VALUES;
+        DateInterval interval = getDateInterval(i);
+        FieldPosition ignore;
+        UnicodeString result;
+        if ((loop & 1) == 0) {
+            gDateIntervalFormat->format(&interval, result, ignore, status);
+        } else {
+            fromCal->setTime(interval.getFromDate(), status);
+            toCal->setTime(interval.getToDate(), status);
+            gDateIntervalFormat->format(*fromCal, *toCal, result, ignore, status);
+        }
+        if (U_FAILURE(status) || result != gDateIntervalExpected[i]) {
+            IntlTest::gTest->errln("%s:%d Shared DateIntervalFormat gave a wrong result for value #%d.",
+                    __FILE__, __LINE__, (int)i);
+            return;
+        }
+    }
+}
+
+void MultithreadTest::TestDateIntervalFormat() {
+    IcuTestErrorCode status(*this, "TestDateIntervalFormat");
+    LocalPointer<DateIntervalFormat> dtitvfmt(
+        DateIntervalFormat::createInstance(UnicodeString("yMMMdjm"), Locale::getEnglish(), status));
+    if (status.errDataIfFailureAndReset("DateIntervalFormat")) {
+        return;
+    }
+    UnicodeString expected[DATE_ITV_NUM_VALUES];
+    for (int32_t i = 0; i < DATE_ITV_NUM_VALUES; ++i) {
+        DateInterval interval = getDateInterval(i);
+        FieldPosition ignore;
+        dtitvfmt->format(&interval, expected[i], ignore, status);
+    }
+    if (status.errIfFailureAndReset()) {
+        return;
+    }
+    gDateIntervalFormat = dtitvfmt.getAlias();
+    gDateIntervalExpected = expected;
+
+    static const int32_t NUM_THREADS = 8;
+    LocalPointer<DateIntervalFormatThread> threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i].adoptInstead(new DateIntervalFormatThread(i));
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+    }
+    gDateIntervalFormat = NULL;
+    gDateIntervalExpected = NULL;
+}
+#endif /* !UCONFIG_NO_FORMATTING */
+
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+//-------------------------------------------------------------------------------------------
+//
+//   TestRegexMatchOnce.  Threads match against one shared RegexPattern,
+//                        each with RegexMatchResult objects of its own.
+//
+//-------------------------------------------------------------------------------------------
+
+static const RegexPattern *gMatchOncePattern = NULL;
+
+class RegexMatchOnceThread : public SimpleThread {
+  public:
+    RegexMatchOnceThread(int32_t n) : fN(n) {}
+    virtual void run();
+    int32_t fN;
+};
+
+void RegexMatchOnceThread::run() {
+    RegexMatchResult result;
+    for (int32_t loop = 0; loop < 2000; ++loop) {
+        int32_t value = fN * 10000 + loop;
+        UnicodeString input = UnicodeString(u"key") + fN + u" = " + value + u";";
+        UErrorCode status = U_ZERO_ERROR;
+        if (!gMatchOncePattern->matchOnce(input, result, status) || U_FAILURE(status)) {
+            IntlTest::gTest->errln("%s:%d No match for thread %d loop %d, status %s.",
+                    __FILE__, __LINE__, (int)fN, (int)loop, u_errorName(status));
+            return;
+        }
+        int32_t start = result.start(2, status);
+        UnicodeString expected = UnicodeString() + value;
+        if (input.tempSubStringBetween(start, result.end(2, status)) != expected ||
+                result.start(1, status) != 0 || U_FAILURE(status)) {
+            IntlTest::gTest->errln("%s:%d Wrong match for thread %d loop %d.",
+                    __FILE__, __LINE__, (int)fN, (int)loop);
+            return;
+        }
+    }
+}
+
+void MultithreadTest::TestRegexMatchOnce() {
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError pe;
+    LocalPointer<RegexPattern> pattern(
+        RegexPattern::compile(u"(\\w+)\\s*=\\s*(\\d+);", 0, pe, status));
+    if (U_FAILURE(status)) {
+        dataerrln("RegexPattern::compile() failed - %s", u_errorName(status));
+        return;
+    }
+    gMatchOncePattern = pattern.getAlias();
+    static const int32_t NUM_THREADS = 8;
+    LocalPointer<RegexMatchOnceThread> threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i].adoptInstead(new RegexMatchOnceThread(i));
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+    }
+    gMatchOncePattern = NULL;
+}
+#endif /* !UCONFIG_NO_REGULAR_EXPRESSIONS */
+
+#if !UCONFIG_NO_NORMALIZATION
+//-------------------------------------------------------------------------------------------
+//
+//   TestParallelNormalization.  A long UTF-8 string is split with getSplitPointsUTF8(),
+//                               and threads normalize the pieces into outputs of their own,
+//                               which are joined in order.
+//
+//-------------------------------------------------------------------------------------------
+
+static const Normalizer2 *gParallelNorm2 = NULL;
+
+class ParallelNormalizationThread : public SimpleThread {
+  public:
+    ParallelNormalizationThread(StringPiece piece) : fPiece(piece) {}
+    virtual void run();
+    StringPiece fPiece;
+    std::string fResult;
+};
+
+void ParallelNormalizationThread::run() {
+    UErrorCode status = U_ZERO_ERROR;
+    StringByteSink<std::string> sink(&fResult);
+    gParallelNorm2->normalizeUTF8(0, fPiece, sink, NULL, status);
+    if (U_FAILURE(status)) {
+        IntlTest::gTest->errln("%s:%d normalizeUTF8() failed - %s",
+                __FILE__, __LINE__, u_errorName(status));
+    }
+}
+
+void MultithreadTest::TestParallelNormalization() {
+    UErrorCode status = U_ZERO_ERROR;
+    gParallelNorm2 = Normalizer2::getNFKCCasefoldInstance(status);
+    if (U_FAILURE(status)) {
+        dataerrln("Normalizer2::getNFKCCasefoldInstance() failed - %s", u_errorName(status));
+        return;
+    }
+    UnicodeString unit(u"Ab\u0308c\u0323\u0307 \u1E0A\u0323\u00C5 \uFB01 ABC\u0301\u0308 \uAC00\u11A8 ");
+    UnicodeString text;
+    for (int32_t i = 0; i < 2000; ++i) {
+        text.append(unit);
+    }
+    std::string text8, expected;
+    text.toUTF8String(text8);
+    StringByteSink<std::string> sink(&expected);
+    gParallelNorm2->normalizeUTF8(0, text8, sink, NULL, status);
+
+    static const int32_t NUM_THREADS = 8;
+    int32_t splits[NUM_THREADS - 1];
+    int32_t count = gParallelNorm2->getSplitPointsUTF8(
+        text8, (int32_t)text8.length() / NUM_THREADS, splits, NUM_THREADS - 1, status);
+    if (U_FAILURE(status)) {
+        errln("%s:%d getSplitPointsUTF8() failed - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    LocalPointer<ParallelNormalizationThread> threads[NUM_THREADS];
+    int32_t start = 0;
+    for (int32_t i = 0; i <= count; ++i) {
+        int32_t limit = i < count ? splits[i] : (int32_t)text8.length();
+        threads[i].adoptInstead(new ParallelNormalizationThread(
+            StringPiece(text8).substr(start, limit - start)));
+        threads[i]->start();
+        start = limit;
+    }
+    std::string result;
+    for (int32_t i = 0; i <= count; ++i) {
+        threads[i]->join();
+        result.append(threads[i]->fResult);
+    }
+    assertTrue("pieces normalized on threads and joined", expected == result);
+    gParallelNorm2 = NULL;
+}
+#endif /* !UCONFIG_NO_NORMALIZATION */
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+//-------------------------------------------------------------------------------------------
+//
+//   TestConverterCache.  Threads open, use and close data-based converters,
+//                        most of which are found in the cache without locking,
+//                        while one of the threads keeps flushing the cache.
+//
+//-------------------------------------------------------------------------------------------
+
+static const char *const gCacheConverterNames[] = {
+    "Shift_JIS", "windows-1252", "ibm-37_P100-1995", "GB18030", "EUC-KR", "ISO-2022-JP"
+};
+static const int32_t NUM_CACHE_CONVERTERS = UPRV_LENGTHOF(gCacheConverterNames);
+static const UChar gCacheText[] = u"Hello, world! 0123 \u00E9\u3042\u4E00";
+static char gCacheExpected[NUM_CACHE_CONVERTERS][64];
+
+class ConverterCacheThread : public SimpleThread {
+  public:
+    ConverterCacheThread(int32_t num) : fNum(num) {}
+    virtual void run();
+    int32_t fNum;
+};
+
+void ConverterCacheThread::run() {
+    for (int32_t loop = 0; loop < 500; ++loop) {
+        int32_t i = (fNum + loop) % NUM_CACHE_CONVERTERS;
+        UErrorCode status = U_ZERO_ERROR;
+        UConverter *cnv = ucnv_open(gCacheConverterNames[i], &status);
+        char dest[64];
+        ucnv_fromUChars(cnv, dest, UPRV_LENGTHOF(dest), gCacheText, -1, &status);
+        if (U_FAILURE(status)) {
+            IntlTest::gTest->errln("%s:%d converting with %s failed - %s",
+                    __FILE__, __LINE__, gCacheConverterNames[i], u_errorName(status));
+        } else if (uprv_strcmp(dest, gCacheExpected[i]) != 0) {
+            IntlTest::gTest->errln("%s:%d wrong output from %s",
+                    __FILE__, __LINE__, gCacheConverterNames[i]);
+        }
+        ucnv_close(cnv);
+        if (fNum == 0) {
+            ucnv_flushCache();
+        }
+    }
+}
+
+void MultithreadTest::TestConverterCache() {
+    for (int32_t i = 0; i < NUM_CACHE_CONVERTERS; ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        UConverter *cnv = ucnv_open(gCacheConverterNames[i], &status);
+        ucnv_fromUChars(cnv, gCacheExpected[i], UPRV_LENGTHOF(gCacheExpected[i]),
+                        gCacheText, -1, &status);
+        ucnv_close(cnv);
+        if (U_FAILURE(status)) {
+            dataerrln("converting with %s failed - %s", gCacheConverterNames[i], u_errorName(status));
+            return;
+        }
+    }
+    static const int32_t NUM_THREADS = 8;
+    LocalPointer<ConverterCacheThread> threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i].adoptInstead(new ConverterCacheThread(i));
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+    }
+}
+#endif /* !UCONFIG_NO_LEGACY_CONVERSION */
+
+//-------------------------------------------------------------------------------------------
+//
+//   TestDataCache.  Threads add application data packages to the udata cache,
+//                   which grows its table while other threads look up packages in it.
+//
+//-------------------------------------------------------------------------------------------
+
+static const struct {
+    uint16_t  headerSize;
+    uint8_t   magic1, magic2;
+    UDataInfo info;
+    char      padding[8];
+    uint32_t  count, reserved;
+} gEmptyCommonData = {
+    32, 0xda, 0x27,
+    {
+        sizeof(UDataInfo), 0,
+        U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, sizeof(UChar), 0,
+        {0x43, 0x6d, 0x6e, 0x44},   /* dataFormat="CmnD" */
+        {1, 0, 0, 0},               /* formatVersion */
+        {0, 0, 0, 0}                /* dataVersion */
+    },
+    {0, 0, 0, 0, 0, 0, 0, 0},
+    0, 0                            /* no TOC entries */
+};
+
+static const int32_t NUM_DATA_CACHE_THREADS = 8;
+static const int32_t NUM_DATA_CACHE_PACKAGES_PER_THREAD = 40;
+
+class DataCacheThread : public SimpleThread {
+  public:
+    DataCacheThread(int32_t num) : fNum(num) {}
+    virtual void run();
+    int32_t fNum;
+};
+
+void DataCacheThread::run() {
+    for (int32_t i = 0; i < NUM_DATA_CACHE_PACKAGES_PER_THREAD; ++i) {
+        char name[32];
+        snprintf(name, sizeof(name), "DataCache%d_%d", (int)fNum, (int)i);
+        UErrorCode status = U_ZERO_ERROR;
+        udata_setAppData(name, &gEmptyCommonData, &status);
+        if (status != U_ZERO_ERROR) {
+            IntlTest::gTest->errln("%s:%d udata_setAppData(%s) - %s",
+                    __FILE__, __LINE__, name, u_errorName(status));
+        }
+        // Each package that was already added must be found in the cache,
+        //   and a second one of the same name is not added.
+        for (int32_t j = 0; j <= i; j += 7) {
+            snprintf(name, sizeof(name), "DataCache%d_%d", (int)fNum, (int)j);
+            status = U_ZERO_ERROR;
+            udata_setAppData(name, &gEmptyCommonData, &status);
+            if (status != U_USING_DEFAULT_WARNING) {
+                IntlTest::gTest->errln("%s:%d package %s was not found in the cache - %s",
+                        __FILE__, __LINE__, name, u_errorName(status));
+            }
+        }
+        status = U_ZERO_ERROR;
+        udata_setAppData("DataCacheShared", &gEmptyCommonData, &status);
+        if (status != U_USING_DEFAULT_WARNING) {
+            IntlTest::gTest->errln("%s:%d package DataCacheShared was not found in the cache - %s",
+                    __FILE__, __LINE__, u_errorName(status));
+        }
+    }
+}
+
+void MultithreadTest::TestDataCache() {
+    UErrorCode status = U_ZERO_ERROR;
+    udata_setAppData("DataCacheShared", &gEmptyCommonData, &status);
+    if (U_FAILURE(status)) {
+        errln("udata_setAppData(DataCacheShared) failed - %s", u_errorName(status));
+        return;
+    }
+    if (status == U_USING_DEFAULT_WARNING) {
+        logln("The packages are already in the cache from an earlier run of this test.");
+        return;
+    }
+    LocalPointer<DataCacheThread> threads[NUM_DATA_CACHE_THREADS];
+    for (int32_t i = 0; i < NUM_DATA_CACHE_THREADS; ++i) {
+        threads[i].adoptInstead(new DataCacheThread(i));
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_DATA_CACHE_THREADS; ++i) {
+        threads[i]->join();
+    }
+}
+
+//-------------------------------------------------------------------------------------------
+//
+//   TestResourceBundleCache.  Threads open, use and close resource bundles,
+//                             most of which are found in the cache without locking.
+//
+//-------------------------------------------------------------------------------------------
+
+static const char *const gCacheBundleLocales[] = {
+    "de_CH", "en_US", "fr", "root", "ja_JP", "sr_Latn_RS", "zh_Hant_TW", "de_CH_XX", "xx_YY"
+};
+static const int32_t NUM_CACHE_BUNDLES = UPRV_LENGTHOF(gCacheBundleLocales);
+static char gCacheBundleActual[NUM_CACHE_BUNDLES][ULOC_FULLNAME_CAPACITY];
+static int32_t gCacheBundleSize[NUM_CACHE_BUNDLES];
+
+class ResourceBundleCacheThread : public SimpleThread {
+  public:
+    ResourceBundleCacheThread(int32_t num) : fNum(num) {}
+    virtual void run();
+    int32_t fNum;
+};
+
+void ResourceBundleCacheThread::run() {
+    for (int32_t loop = 0; loop < 500; ++loop) {
+        int32_t i = (fNum + loop) % NUM_CACHE_BUNDLES;
+        UErrorCode status = U_ZERO_ERROR;
+        LocalUResourceBundlePointer rb(ures_open(NULL, gCacheBundleLocales[i], &status));
+        const char *actual = ures_getLocaleByType(rb.getAlias(), ULOC_ACTUAL_LOCALE, &status);
+        if (U_FAILURE(status)) {
+            IntlTest::gTest->errln("%s:%d ures_open(%s) failed - %s",
+                    __FILE__, __LINE__, gCacheBundleLocales[i], u_errorName(status));
+        } else if (uprv_strcmp(actual, gCacheBundleActual[i]) != 0 ||
+                ures_getSize(rb.getAlias()) != gCacheBundleSize[i]) {
+            IntlTest::gTest->errln("%s:%d wrong bundle for %s",
+                    __FILE__, __LINE__, gCacheBundleLocales[i]);
+        }
+    }
+}
+
+void MultithreadTest::TestResourceBundleCache() {
+    for (int32_t i = 0; i < NUM_CACHE_BUNDLES; ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalUResourceBundlePointer rb(ures_open(NULL, gCacheBundleLocales[i], &status));
+        const char *actual = ures_getLocaleByType(rb.getAlias(), ULOC_ACTUAL_LOCALE, &status);
+        if (U_FAILURE(status)) {
+            dataerrln("ures_open(%s) failed - %s", gCacheBundleLocales[i], u_errorName(status));
+            return;
+        }
+        uprv_strcpy(gCacheBundleActual[i], actual);
+        gCacheBundleSize[i] = ures_getSize(rb.getAlias());
+    }
+    static const int32_t NUM_THREADS = 8;
+    LocalPointer<ResourceBundleCacheThread> threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i].adoptInstead(new ResourceBundleCacheThread(i));
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+    }
+}
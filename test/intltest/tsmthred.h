@@ -52,8 +52,18 @@ class MultithreadTest : public IntlTest
     void TestConditionVariables();
     void TestUnifiedCache();
     void TestBreakTranslit();
+    void TestSharedRuleBasedTranslit();
     void TestIncDec();
     void Test20104();
+    void TestFormatPool();
+    void TestNumberParser();
+    void TestSharedMessageFormat();
+    void TestDateIntervalFormat();
+    void TestRegexMatchOnce();
+    void TestParallelNormalization();
+    void TestConverterCache();
+    void TestDataCache();
+    void TestResourceBundleCache();
 };
 
 #endif
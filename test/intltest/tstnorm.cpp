@@ -10,6 +10,7 @@
 
 #if !UCONFIG_NO_NORMALIZATION
 
+#include "unicode/appendable.h"
 #include "unicode/uchar.h"
 #include "unicode/errorcode.h"
 #include "unicode/normlzr.h"
@@ -60,6 +61,10 @@ void BasicNormalizerTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestNormalizeIllFormedText);
     TESTCASE_AUTO(TestComposeJamoTBase);
     TESTCASE_AUTO(TestComposeBoundaryAfter);
+    TESTCASE_AUTO(TestComposeUTF8LongRuns);
+    TESTCASE_AUTO(TestStreamingNormalizer2);
+    TESTCASE_AUTO(TestNFKCCasefoldUTF8ASCIIRuns);
+    TESTCASE_AUTO(TestGetSplitPoints);
     TESTCASE_AUTO_END;
 }
 
@@ -1805,4 +1810,220 @@ BasicNormalizerTest::TestComposeBoundaryAfter() {
     assertFalse("U+FB2C boundary-after", nfkc->hasBoundaryAfter(0xFB2C));
 }
 
+void
+BasicNormalizerTest::TestComposeUTF8LongRuns() {
+    IcuTestErrorCode errorCode(*this, "TestComposeUTF8LongRuns");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfkc = Normalizer2::getNFKCInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() call failed")) {
+        return;
+    }
+    // composeUTF8() skips long runs of ASCII and Latin-1 text a block at a time.
+    // Insert characters that do not pass the quick check at every position
+    // of such a run, including right after the end of a block and
+    // right after a character that they combine with.
+    UnicodeString run(u"Grüße aus Köln, où l'été est très beau; 0123456789 ¡Olé!");
+    static const char16_t *const inserts[] = {
+        u"e\u0301", u"\u0308", u"A\u030A\u0323", u"\u1E0A\u0323", u"\uFB01", u"\u00A0", u"\u0958"
+    };
+    for (int32_t nf = 0; nf < 2; ++nf) {
+        const Normalizer2 *n2 = nf == 0 ? nfc : nfkc;
+        std::string plain8;
+        run.toUTF8String(plain8);
+        assertTrue("plain isNormalizedUTF8", n2->isNormalizedUTF8(plain8, errorCode));
+        for (int32_t i = 0; i < UPRV_LENGTHOF(inserts); ++i) {
+            UnicodeString insert(inserts[i]);
+            for (int32_t pos = 0; pos <= run.length(); ++pos) {
+                UnicodeString src(run);
+                src.insert(pos, insert);
+                std::string src8, expected8, result8;
+                src.toUTF8String(src8);
+                n2->normalize(src, errorCode).toUTF8String(expected8);
+                StringByteSink<std::string> sink(&result8);
+                n2->normalizeUTF8(0, src8, sink, nullptr, errorCode);
+                if (!assertEquals(UnicodeString("normalizeUTF8 nf=") + nf + " insert " + i + " at " + pos,
+                                  expected8.c_str(), result8.c_str()) ||
+                        !assertEquals(UnicodeString("isNormalizedUTF8 nf=") + nf + " insert " + i +
+                                      " at " + pos, n2->isNormalized(src, errorCode),
+                                      n2->isNormalizedUTF8(src8, errorCode))) {
+                    return;
+                }
+            }
+        }
+    }
+    assertSuccess("TestComposeUTF8LongRuns", errorCode.get());
+}
+
+void
+BasicNormalizerTest::TestStreamingNormalizer2() {
+    IcuTestErrorCode errorCode(*this, "TestStreamingNormalizer2");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFKCCasefoldInstance() call failed")) {
+        return;
+    }
+    const Normalizer2 *const n2s[] = { nfc, nfd, nfkc_cf };
+    // Combining sequences, supplementary characters that compose,
+    // Hangul Jamo, and a long sequence without any boundary.
+    UnicodeString text(
+        u"Ab\u0308c\u0323\u0307 \u1E0A\u0323\u00C5 \U00011099\U000110BA"
+        u"\u1100\u1161\u11A8 \uFB01 ABC\u0301\u0308\u0327\u0316\u0301\u0308"
+        u"\u0327\u0316\u0301\u0308 \U0001D15E\U0001D165 \uAC00\u11A8 z");
+    for (int32_t n = 0; n < UPRV_LENGTHOF(n2s); ++n) {
+        UnicodeString expected = n2s[n]->normalize(text, errorCode);
+        std::string text8, expected8;
+        text.toUTF8String(text8);
+        expected.toUTF8String(expected8);
+        StreamingNormalizer2 stream(*n2s[n]);
+        for (int32_t chunkLength = 1; chunkLength <= 9; ++chunkLength) {
+            UnicodeString result;
+            UnicodeStringAppendable app(result);
+            for (int32_t start = 0; start < text.length(); start += chunkLength) {
+                stream.normalize(text.tempSubString(start, chunkLength), app, errorCode);
+            }
+            stream.finish(app, errorCode);
+            assertEquals(UnicodeString("UTF-16 n2 #") + n + " chunks of " + chunkLength,
+                         expected, result);
+
+            std::string result8;
+            StringByteSink<std::string> sink(&result8);
+            for (int32_t start = 0; start < (int32_t)text8.length(); start += chunkLength) {
+                stream.normalizeUTF8(StringPiece(text8).substr(start, chunkLength), sink, errorCode);
+            }
+            stream.finishUTF8(sink, errorCode);
+            assertEquals(UnicodeString("UTF-8 n2 #") + n + " chunks of " + chunkLength,
+                         expected8.c_str(), result8.c_str());
+        }
+        errorCode.errIfFailureAndReset("StreamingNormalizer2 with n2 #%d", (int)n);
+    }
+
+    // Nothing is written before the text after the last boundary is complete.
+    StreamingNormalizer2 stream(*nfc);
+    UnicodeString result;
+    UnicodeStringAppendable app(result);
+    stream.normalize(u"abe", app, errorCode);
+    assertEquals("up to the last boundary", u"ab", result);
+    stream.normalize(u"\u0301\u0301", app, errorCode);
+    assertEquals("no boundary", u"ab", result);
+    stream.reset();
+    stream.normalize(u"xo", app, errorCode);
+    stream.finish(app, errorCode);
+    assertEquals("after reset()", u"abxo", result);
+    assertSuccess("StreamingNormalizer2", errorCode.get());
+}
+
+void
+BasicNormalizerTest::TestNFKCCasefoldUTF8ASCIIRuns() {
+    IcuTestErrorCode errorCode(*this, "TestNFKCCasefoldUTF8ASCIIRuns");
+    const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFKCCasefoldInstance() call failed")) {
+        return;
+    }
+    // normalizeUTF8() lowercases runs of ASCII text in one piece;
+    // the runs stop before characters that combine with the preceding one.
+    static const char16_t *const strings[] = {
+        u"Hello World",
+        u"already lowercase",
+        u"ICU-4C 63.1 tokenIZER",
+        u"E\u0301COLE CAFE\u0301 NAI\u0308VE",
+        u"AbC\u0323\u0307D",
+        u"SS\u00DF\u1E9E \uFB01X \u2160IV",
+        u"MIXED\u00ADSOFT\u200BHYPHEN",
+        u"\u0130STANBUL \u03A3\u039F\u03A6\u0399\u0391 ABC",
+        u"A",
+        u"Z\u0308"
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+        UnicodeString src(strings[i]);
+        std::string src8, expected8, result8;
+        src.toUTF8String(src8);
+        nfkc_cf->normalize(src, errorCode).toUTF8String(expected8);
+        StringByteSink<std::string> sink(&result8);
+        nfkc_cf->normalizeUTF8(0, src8, sink, nullptr, errorCode);
+        assertEquals(UnicodeString("normalizeUTF8 #") + i, expected8.c_str(), result8.c_str());
+
+        // The same with edits, which do not use the fast path.
+        std::string edited8;
+        StringByteSink<std::string> editedSink(&edited8);
+        Edits edits;
+        nfkc_cf->normalizeUTF8(0, src8, editedSink, &edits, errorCode);
+        assertEquals(UnicodeString("normalizeUTF8 with edits #") + i,
+                     expected8.c_str(), edited8.c_str());
+        assertEquals(UnicodeString("edits lengthDelta #") + i,
+                     (int32_t)(edited8.length() - src8.length()), edits.lengthDelta());
+        assertEquals(UnicodeString("isNormalizedUTF8 #") + i,
+                     nfkc_cf->isNormalized(src, errorCode), nfkc_cf->isNormalizedUTF8(src8, errorCode));
+    }
+    assertSuccess("TestNFKCCasefoldUTF8ASCIIRuns", errorCode.get());
+}
+
+void
+BasicNormalizerTest::TestGetSplitPoints() {
+    IcuTestErrorCode errorCode(*this, "TestGetSplitPoints");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFKCCasefoldInstance() call failed")) {
+        return;
+    }
+    const Normalizer2 *const n2s[] = { nfc, nfkc_cf };
+    UnicodeString unit(
+        u"Ab\u0308c\u0323\u0307 \u1E0A\u0323\u00C5 \U00011099\U000110BA"
+        u"\u1100\u1161\u11A8 \uFB01 ABC\u0301\u0308\u0327\u0316\u0301\u0308 \uAC00\u11A8 ");
+    UnicodeString text;
+    for (int32_t i = 0; i < 20; ++i) {
+        text.append(unit);
+    }
+    std::string text8;
+    text.toUTF8String(text8);
+    int32_t splits[1000];
+    for (int32_t n = 0; n < UPRV_LENGTHOF(n2s); ++n) {
+        UnicodeString expected = n2s[n]->normalize(text, errorCode);
+        std::string expected8;
+        expected.toUTF8String(expected8);
+        for (int32_t pieceLength = 1; pieceLength <= 40; pieceLength += 3) {
+            // Normalize the pieces separately and join them.
+            int32_t count = n2s[n]->getSplitPoints(
+                text, pieceLength, splits, UPRV_LENGTHOF(splits), errorCode);
+            UnicodeString result;
+            int32_t start = 0;
+            for (int32_t i = 0; i <= count; ++i) {
+                int32_t limit = i < count ? splits[i] : text.length();
+                assertTrue("UTF-16 split points ascending", start < limit);
+                result.append(n2s[n]->normalize(text.tempSubStringBetween(start, limit), errorCode));
+                start = limit;
+            }
+            assertEquals(UnicodeString("UTF-16 n2 #") + n + " pieces of " + pieceLength,
+                         expected, result);
+
+            count = n2s[n]->getSplitPointsUTF8(
+                text8, pieceLength, splits, UPRV_LENGTHOF(splits), errorCode);
+            std::string result8;
+            StringByteSink<std::string> sink(&result8);
+            start = 0;
+            for (int32_t i = 0; i <= count; ++i) {
+                int32_t limit = i < count ? splits[i] : (int32_t)text8.length();
+                assertTrue("UTF-8 pieces long enough", i == count || start + pieceLength <= limit);
+                n2s[n]->normalizeUTF8(0, StringPiece(text8).substr(start, limit - start),
+                                      sink, nullptr, errorCode);
+                start = limit;
+            }
+            assertEquals(UnicodeString("UTF-8 n2 #") + n + " pieces of " + pieceLength,
+                         expected8.c_str(), result8.c_str());
+        }
+        errorCode.errIfFailureAndReset("getSplitPoints() with n2 #%d", (int)n);
+    }
+
+    // Preflighting, and no split points in a string without boundaries.
+    int32_t count = nfc->getSplitPointsUTF8(text8, 100, nullptr, 0, errorCode);
+    assertEquals("preflighting", U_BUFFER_OVERFLOW_ERROR, errorCode.reset());
+    assertTrue("number of split points", count > 0);
+    assertEquals("pieces at least as long as the string", 0,
+                 nfc->getSplitPoints(text, text.length(), nullptr, 0, errorCode));
+    assertEquals("no boundaries", 0,
+                 nfc->getSplitPoints(u"a\u0301\u0301\u0301\u0301", 1, splits, 10, errorCode));
+    nfc->getSplitPoints(text, 0, splits, 10, errorCode);
+    assertEquals("pieceLength 0", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
 #endif /* #if !UCONFIG_NO_NORMALIZATION */
@@ -53,6 +53,10 @@ class BasicNormalizerTest : public IntlTest {
     void TestNormalizeIllFormedText();
     void TestComposeJamoTBase();
     void TestComposeBoundaryAfter();
+    void TestComposeUTF8LongRuns();
+    void TestStreamingNormalizer2();
+    void TestNFKCCasefoldUTF8ASCIIRuns();
+    void TestGetSplitPoints();
 
 private:
     UnicodeString canonTests[24][3];
@@ -85,6 +85,7 @@ TimeZoneFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &name
         TESTCASE(5, TestFormatTZDBNames);
         TESTCASE(6, TestFormatCustomZone);
         TESTCASE(7, TestFormatTZDBNamesAllZoneCoverage);
+        TESTCASE(8, TestPreload);
     default: name = ""; break;
     }
 }
@@ -1302,4 +1303,61 @@ TimeZoneFormatTest::TestFormatTZDBNamesAllZoneCoverage(void) {
     }
 }
 
+static const TimeZoneFormat *gPreloadedFormat = NULL;
+
+static const struct {
+    UTimeZoneFormatStyle style;
+    const char* text;
+    const char* expectedID;
+} PRELOAD_PARSE_DATA[] = {
+    { UTZFMT_STYLE_SPECIFIC_LONG,  "Pacific Standard Time", "America/Los_Angeles" },
+    { UTZFMT_STYLE_SPECIFIC_LONG,  "Central European Summer Time", "Europe/Paris" },
+    { UTZFMT_STYLE_SPECIFIC_LONG,  "British Summer Time", "Europe/London" },
+    { UTZFMT_STYLE_GENERIC_LONG,   "Mountain Time", "America/Denver" },
+    { UTZFMT_STYLE_GENERIC_LONG,   "Pacific Time", "America/Los_Angeles" },
+    { UTZFMT_STYLE_GENERIC_LOCATION, "Japan Time", "Asia/Tokyo" },
+    { UTZFMT_STYLE_GENERIC_LOCATION, "Chicago Time", "America/Chicago" },
+};
+
+void
+TimeZoneFormatTest::TestPreload(void) {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<TimeZoneFormat> tzfmt(TimeZoneFormat::createInstance(Locale("en"), status));
+    if (U_FAILURE(status)) {
+        dataerrln("FAIL: TimeZoneFormat::createInstance failed for en - %s", u_errorName(status));
+        return;
+    }
+    tzfmt->preload(status);
+    if (!assertSuccess("preload", status, TRUE)) {
+        return;
+    }
+
+    // The names are now parsed by many threads at the same time,
+    // from the trie that preload() has prepared.
+    gPreloadedFormat = tzfmt.getAlias();
+    ThreadPool<TimeZoneFormatTest> threads(this, threadCount, &TimeZoneFormatTest::RunPreloadedParseTests);
+    threads.start();
+    threads.join();
+    gPreloadedFormat = NULL;
+}
+
+void TimeZoneFormatTest::RunPreloadedParseTests(int32_t /*threadNumber*/) {
+    for (int32_t n = 0; n < 50; n++) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(PRELOAD_PARSE_DATA); i++) {
+            UnicodeString text(PRELOAD_PARSE_DATA[i].text, -1, US_INV);
+            ParsePosition pos(0);
+            LocalPointer<TimeZone> tz(gPreloadedFormat->parse(PRELOAD_PARSE_DATA[i].style, text, pos));
+            UnicodeString id;
+            if (tz.isValid()) {
+                tz->getID(id);
+            }
+            if (pos.getIndex() != text.length() || id != UnicodeString(PRELOAD_PARSE_DATA[i].expectedID, -1, US_INV)) {
+                errln(UnicodeString("FAIL: parse \"") + text + "\" - got " + id + " at " + pos.getIndex()
+                    + ", expected " + PRELOAD_PARSE_DATA[i].expectedID);
+                return;
+            }
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -29,8 +29,10 @@ class TimeZoneFormatTest : public IntlTest {
     void TestFormatTZDBNames(void);
     void TestFormatCustomZone(void);
     void TestFormatTZDBNamesAllZoneCoverage(void);
+    void TestPreload(void);
 
     void RunTimeRoundTripTests(int32_t threadNumber);
+    void RunPreloadedParseTests(int32_t threadNumber);
 };
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
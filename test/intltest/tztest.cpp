@@ -12,6 +12,7 @@
 
 #include "unicode/timezone.h"
 #include "unicode/simpletz.h"
+#include "unicode/tztrans.h"
 #include "unicode/calendar.h"
 #include "unicode/gregocal.h"
 #include "unicode/resbund.h"
@@ -74,6 +75,9 @@ void TimeZoneTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestGetUnknown);
     TESTCASE_AUTO(TestGetWindowsID);
     TESTCASE_AUTO(TestGetIDForWindowsID);
+    TESTCASE_AUTO(TestGetOffsetLookupOrder);
+    TESTCASE_AUTO(TestFinalZoneOffsets);
+    TESTCASE_AUTO(TestCreateTimeZoneCache);
     TESTCASE_AUTO_END;
 }
 
@@ -2478,4 +2482,146 @@ void TimeZoneTest::TestGetIDForWindowsID(void) {
     }
 }
 
+void TimeZoneTest::TestGetOffsetLookupOrder() {
+    // The historical offset lookup starts from the transition found by the previous one.
+    // The results must not depend on the order of the lookups.
+    static const char* const zoneIDs[] = { "America/New_York", "Europe/Moscow", "Asia/Kolkata", "Australia/Lord_Howe" };
+    // From 1880 to 2010, in steps that are not a multiple of a day
+    static const int32_t kCount = 400;
+    static const UDate kStart = -2840140800000.0;
+    static const UDate kStep = 10254321123.0;
+    UErrorCode status = U_ZERO_ERROR;
+    for (const char* zoneID : zoneIDs) {
+        LocalPointer<BasicTimeZone> tz(
+            dynamic_cast<BasicTimeZone*>(TimeZone::createTimeZone(UnicodeString(zoneID, -1, US_INV))));
+        if (tz.isNull()) {
+            errln(UnicodeString("Failed to create ") + zoneID);
+            continue;
+        }
+        for (int32_t order = 0; order < 3; ++order) {
+            for (int32_t i = 0; i < kCount; ++i) {
+                // Ascending, descending, then jumping back and forth
+                int32_t n = (order == 0) ? i : (order == 1) ? kCount - 1 - i : (i * 157) % kCount;
+                UDate date = kStart + n * kStep;
+                LocalPointer<BasicTimeZone> fresh(static_cast<BasicTimeZone*>(tz->clone()));
+                int32_t raw, dst, expectedRaw, expectedDst;
+                tz->getOffset(date, FALSE, raw, dst, status);
+                fresh->getOffset(date, FALSE, expectedRaw, expectedDst, status);
+                if (raw != expectedRaw || dst != expectedDst) {
+                    errln(UnicodeString("FAIL: ") + zoneID + " getOffset(" + date + ") order " + order +
+                          " raw=" + raw + " dst=" + dst + ", expected raw=" + expectedRaw + " dst=" + expectedDst);
+                }
+                fresh.adoptInstead(static_cast<BasicTimeZone*>(tz->clone()));
+                tz->getOffsetFromLocal(date, BasicTimeZone::kFormer, BasicTimeZone::kLatter, raw, dst, status);
+                fresh->getOffsetFromLocal(date, BasicTimeZone::kFormer, BasicTimeZone::kLatter,
+                                          expectedRaw, expectedDst, status);
+                if (raw != expectedRaw || dst != expectedDst) {
+                    errln(UnicodeString("FAIL: ") + zoneID + " getOffsetFromLocal(" + date + ") order " + order +
+                          " raw=" + raw + " dst=" + dst + ", expected raw=" + expectedRaw + " dst=" + expectedDst);
+                }
+            }
+        }
+        if (U_FAILURE(status)) {
+            errln(UnicodeString("FAIL: ") + zoneID + " - " + u_errorName(status));
+            status = U_ZERO_ERROR;
+        }
+    }
+}
+
+void TimeZoneTest::TestFinalZoneOffsets() {
+    // The offsets under the final rule of a zone come from a table of its transitions.
+    // Check them against the transitions that BasicTimeZone reports,
+    // up to and beyond the end of that table.
+    static const UDate kStart = 946684800000.0;  // 2000-01-01
+    static const UDate kLimit = 4449513600000.0;  // 2111-01-01
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<StringEnumeration> ids(TimeZone::createEnumeration());
+    if (ids.isNull()) {
+        dataerrln("TimeZone::createEnumeration() failed");
+        return;
+    }
+    const UnicodeString* id;
+    while ((id = ids->snext(status)) != NULL && U_SUCCESS(status)) {
+        LocalPointer<BasicTimeZone> tz(dynamic_cast<BasicTimeZone*>(TimeZone::createTimeZone(*id)));
+        if (tz.isNull()) {
+            continue;
+        }
+        TimeZoneTransition trans;
+        UDate date = kStart;
+        int32_t raw, dst;
+        while (tz->getNextTransition(date, FALSE, trans) && trans.getTime() < kLimit) {
+            UDate t = trans.getTime();
+            // Just before the transition, halfway to it, and at it
+            const UDate dates[] = { t - 1.0, date + uprv_floor((t - date) / 2.0), t };
+            const TimeZoneRule* rules[] = { trans.getFrom(), trans.getFrom(), trans.getTo() };
+            for (int32_t i = 0; i < 3; ++i) {
+                if (dates[i] <= kStart) {
+                    continue;
+                }
+                tz->getOffset(dates[i], FALSE, raw, dst, status);
+                if (raw != rules[i]->getRawOffset() || dst != rules[i]->getDSTSavings()) {
+                    errln(UnicodeString("FAIL: ") + *id + " getOffset(" + dates[i] + ") raw=" + raw +
+                          " dst=" + dst + ", expected raw=" + rules[i]->getRawOffset() +
+                          " dst=" + rules[i]->getDSTSavings());
+                }
+            }
+            date = t;
+        }
+    }
+    if (U_FAILURE(status)) {
+        errln(UnicodeString("FAIL: ") + u_errorName(status));
+    }
+}
+
+void TimeZoneTest::TestCreateTimeZoneCache() {
+    // createTimeZone() clones cached zones; each clone must be independent,
+    // and must behave like a zone created from the resource bundle.
+    UErrorCode status = U_ZERO_ERROR;
+    static const char* const ids[] = {
+        "America/Los_Angeles", "US/Pacific", "Europe/Berlin", "Australia/Lord_Howe",
+        "Asia/Kolkata", "Etc/GMT+5", "Africa/Casablanca"
+    };
+    const UDate dates[] = { -2.0e12, 0.0, 1.5e12, 1.9e12, 4.2e12, 1.0e14 };
+    for (const char* idChars : ids) {
+        UnicodeString id(idChars, -1, US_INV);
+        LocalPointer<TimeZone> first(TimeZone::createTimeZone(id));
+        LocalPointer<TimeZone> second(TimeZone::createTimeZone(id));
+        UnicodeString firstID, secondID;
+        assertEquals(id + " ID", id, first->getID(firstID));
+        assertTrue(id + " equal", *first == *second && first->hasSameRules(*second));
+        assertTrue(id + " distinct objects", first.getAlias() != second.getAlias());
+
+        // Changes to one clone must not affect the cache.
+        first->setID(u"Changed/Zone");
+        LocalPointer<TimeZone> third(TimeZone::createTimeZone(id));
+        assertEquals(id + " ID after change", id, third->getID(secondID));
+
+        // Use the zones in a different order than they were created,
+        // and after deleting one that shares data with the others.
+        int32_t expectedRaw[UPRV_LENGTHOF(dates)], expectedDst[UPRV_LENGTHOF(dates)];
+        for (int32_t i = 0; i < UPRV_LENGTHOF(dates); ++i) {
+            third->getOffset(dates[i], FALSE, expectedRaw[i], expectedDst[i], status);
+        }
+        third.adoptInstead(nullptr);
+        LocalPointer<TimeZone> copy(second->clone());
+        second.adoptInstead(nullptr);
+        for (int32_t i = 0; i < UPRV_LENGTHOF(dates); ++i) {
+            int32_t raw, dst;
+            copy->getOffset(dates[i], FALSE, raw, dst, status);
+            assertEquals(id + " raw #" + i, expectedRaw[i], raw);
+            assertEquals(id + " dst #" + i, expectedDst[i], dst);
+        }
+    }
+    assertSuccess("getOffset", status);
+
+    // Unknown IDs are not system zones, also on repeated requests.
+    for (int32_t i = 0; i < 2; ++i) {
+        LocalPointer<TimeZone> unknown(TimeZone::createTimeZone(u"Mars/Olympus_Mons"));
+        UnicodeString unknownID;
+        assertEquals("unknown zone", u"Etc/Unknown", unknown->getID(unknownID));
+        LocalPointer<TimeZone> custom(TimeZone::createTimeZone(u"GMT+05:30"));
+        assertEquals("custom zone", 19800000, custom->getRawOffset());
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -102,6 +102,9 @@ class TimeZoneTest: public CalendarTimeZoneTest {
 
     void TestGetWindowsID(void);
     void TestGetIDForWindowsID(void);
+    void TestGetOffsetLookupOrder();
+    void TestFinalZoneOffsets();
+    void TestCreateTimeZoneCache();
 
     static const UDate INTERVAL;
 
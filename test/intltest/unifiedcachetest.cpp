@@ -10,20 +10,29 @@
 *
 ********************************************************************************
 */
+#include <stdio.h>
+
+#include "cmemory.h"
 #include "cstring.h"
 #include "intltest.h"
 #include "unifiedcache.h"
 #include "unicode/datefmt.h"
 
+static int32_t gItemsCreated = 0;
+
 class UCTItem : public SharedObject {
   public:
     char *value;
     UCTItem(const char *x) : value(NULL) { 
         value = uprv_strdup(x);
+        ++gItemsCreated;
     }
     virtual ~UCTItem() {
         uprv_free(value);
     }
+    virtual int32_t getApproximateSize() const {
+        return 1000;
+    }
 };
 
 class UCTItem2 : public SharedObject {
@@ -77,6 +86,8 @@ class UnifiedCacheTest : public IntlTest {
     void TestError();
     void TestHashEquals();
     void TestEvictionUnderStress();
+    void TestManyKeys();
+    void TestMemoryLimit();
 };
 
 void UnifiedCacheTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
@@ -87,6 +98,8 @@ void UnifiedCacheTest::runIndexedTest(int32_t index, UBool exec, const char* &na
   TESTCASE_AUTO(TestError);
   TESTCASE_AUTO(TestHashEquals);
   TESTCASE_AUTO(TestEvictionUnderStress);
+  TESTCASE_AUTO(TestManyKeys);
+  TESTCASE_AUTO(TestMemoryLimit);
   TESTCASE_AUTO_END;
 }
 
@@ -396,6 +409,106 @@ void UnifiedCacheTest::TestHashEquals() {
     assertTrue("", diffKey1 != diffKey2);
 }
 
+// Enough keys to populate all of the cache's shards.
+// Eviction must still honor the policy for the cache as a whole.
+void UnifiedCacheTest::TestManyKeys() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("T0", status);
+    cache.setEvictionPolicy(5, 0, status);
+
+    char name[16];
+    const UCTItem *item = NULL;
+    for (int32_t i = 0; i < 200; ++i) {
+        sprintf(name, "x%d", (int)i);
+        cache.get(LocaleCacheKey<UCTItem>(name), &cache, item, status);
+        SharedObject::clearPtr(item);
+        if (cache.unusedCount() > 5) {
+            errln("T1: unusedCount()=%d > 5 after %d keys", (int)cache.unusedCount(), (int)i + 1);
+            break;
+        }
+    }
+    assertEquals("T2", 5, cache.keyCount());
+    assertEquals("T3", 195, (int32_t)cache.autoEvictedCount());
+
+    // Values in use are never evicted, and the cache keeps returning them.
+    const UCTItem *held[50] = {};
+    for (int32_t i = 0; i < UPRV_LENGTHOF(held); ++i) {
+        sprintf(name, "y%d", (int)i);
+        cache.get(LocaleCacheKey<UCTItem>(name), &cache, held[i], status);
+    }
+    assertEquals("T4", 55, cache.keyCount());
+    for (int32_t i = 0; i < UPRV_LENGTHOF(held); ++i) {
+        sprintf(name, "y%d", (int)i);
+        cache.get(LocaleCacheKey<UCTItem>(name), &cache, item, status);
+        if (item != held[i]) {
+            errln("T5: Expected %s to resolve to the same object.", name);
+        }
+    }
+    SharedObject::clearPtr(item);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(held); ++i) {
+        SharedObject::clearPtr(held[i]);
+    }
+    assertEquals("T6", 5, cache.unusedCount());
+    assertEquals("T7", 5, cache.keyCount());
+    assertSuccess("T8", status);
+}
+
+void UnifiedCacheTest::TestMemoryLimit() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("T0", status);
+    cache.setMemoryLimit(-1, status);
+    assertEquals("T1", U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+
+    // Each UCTItem reports 1000 bytes. The count limit alone would keep 1000 of them.
+    cache.setMemoryLimit(5000, status);
+    char name[16];
+    const UCTItem *item = NULL;
+    for (int32_t i = 0; i < 20; ++i) {
+        sprintf(name, "m%d", (int)i);
+        cache.get(LocaleCacheKey<UCTItem>(name), &cache, item, status);
+        SharedObject::clearPtr(item);
+        if (cache.memoryUsage() > 5000) {
+            errln("T2: memoryUsage()=%d > 5000 after %d keys", (int)cache.memoryUsage(), (int)i + 1);
+            break;
+        }
+    }
+    assertEquals("T3", 5, cache.keyCount());
+    assertEquals("T4", 5000, cache.memoryUsage());
+
+    // A recently used entry gets a second chance before it is evicted.
+    cache.get(LocaleCacheKey<UCTItem>("m19"), &cache, item, status);
+    SharedObject::clearPtr(item);
+    cache.get(LocaleCacheKey<UCTItem>("new"), &cache, item, status);
+    SharedObject::clearPtr(item);
+    assertEquals("T5", 5, cache.keyCount());
+    int32_t created = gItemsCreated;
+    cache.get(LocaleCacheKey<UCTItem>("m19"), &cache, item, status);
+    SharedObject::clearPtr(item);
+    assertEquals("T6", created, gItemsCreated);
+
+    // Values in use are never evicted, even beyond the limit.
+    const UCTItem *held[8] = {};
+    for (int32_t i = 0; i < UPRV_LENGTHOF(held); ++i) {
+        sprintf(name, "h%d", (int)i);
+        cache.get(LocaleCacheKey<UCTItem>(name), &cache, held[i], status);
+    }
+    assertEquals("T7", 8, cache.keyCount());
+    assertEquals("T8", 8000, cache.memoryUsage());
+    for (int32_t i = 0; i < UPRV_LENGTHOF(held); ++i) {
+        SharedObject::clearPtr(held[i]);
+    }
+    assertTrue("T9", cache.memoryUsage() <= 5000);
+    cache.flush();
+    assertEquals("T10", 0, cache.memoryUsage());
+    assertSuccess("T11", status);
+}
+
 extern IntlTest *createUnifiedCacheTest() {
     return new UnifiedCacheTest();
 }
+
@@ -14,6 +14,7 @@
 #include <stdio.h>
 
 #include <string.h>
+#include <string>
 #include "unicode/utypes.h"
 #include "usettest.h"
 #include "unicode/ucnv.h"
@@ -26,6 +27,7 @@
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
 #include "unicode/uversion.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "hash.h"
 
@@ -87,11 +89,14 @@ UnicodeSetTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestIteration);
     TESTCASE_AUTO(TestFreezable);
     TESTCASE_AUTO(TestSpan);
+    TESTCASE_AUTO(TestSpanUTF8LongRuns);
     TESTCASE_AUTO(TestStringSpan);
     TESTCASE_AUTO(TestUCAUnsafeBackwards);
     TESTCASE_AUTO(TestIntOverflow);
     TESTCASE_AUTO(TestUnusedCcc);
     TESTCASE_AUTO(TestDeepPattern);
+    TESTCASE_AUTO(TestSetToRanges);
+    TESTCASE_AUTO(TestFrozenManySupplementary);
     TESTCASE_AUTO_END;
 }
 
@@ -3787,6 +3792,56 @@ void UnicodeSetTest::TestSpan() {
 }
 
 // Test select patterns and strings, and test USET_SPAN_SIMPLE.
+// Frozen sets span long runs of ASCII bytes in bulk.
+// Compare with the unfrozen sets at every start offset.
+void UnicodeSetTest::TestSpanUTF8LongRuns() {
+    static const char *const patterns[]={
+        "[a-z]", "[^a-z]", "[\\u0000-\\u007f]", "[\\u0020-\\u007e]",
+        "[aeiou\\u00e4\\u4e00]", "[a-z\\ufffd]", "[\\u0000-\\u007f\\U0001F600]"
+    };
+    // Long runs of spaces, letters and digits, separated by
+    // multi-byte characters and ill-formed sequences, ending with a truncated sequence.
+    static const char *const pieces[]={
+        "the quick brown fox jumps over the lazy dog ",
+        "THE QUICK BROWN FOX ",
+        "0123456789012345678901234567890123456789",
+        "\xc3\xa4", "\xe4\xb8\x80", "\xf0\x9f\x98\x80", "\x80", "\xe4\xb8",
+        "abcdefghijklmnopabcdefghijklmnop ",
+        "                                ",
+        "\xe4"
+    };
+    CharString s;
+    IcuTestErrorCode errorCode(*this, "TestSpanUTF8LongRuns");
+    for(int32_t i=0; i<UPRV_LENGTHOF(pieces); ++i) {
+        s.append(pieces[i], errorCode);
+        s.append(pieces[(i*7)%UPRV_LENGTHOF(pieces)], errorCode);
+    }
+    const char *s8=s.data();
+    int32_t length=s.length();
+    for(int32_t i=0; i<UPRV_LENGTHOF(patterns); ++i) {
+        UnicodeSet set(UnicodeString(patterns[i], -1, US_INV).unescape(), errorCode);
+        if(errorCode.errIfFailureAndReset("UnicodeSet(%s)", patterns[i])) {
+            continue;
+        }
+        UnicodeSet frozen(set);
+        frozen.freeze();
+        static const USetSpanCondition conditions[]={
+            USET_SPAN_NOT_CONTAINED, USET_SPAN_CONTAINED, USET_SPAN_SIMPLE
+        };
+        for(int32_t j=0; j<UPRV_LENGTHOF(conditions); ++j) {
+            for(int32_t start=0; start<length; ++start) {
+                int32_t expected=set.spanUTF8(s8+start, length-start, conditions[j]);
+                int32_t actual=frozen.spanUTF8(s8+start, length-start, conditions[j]);
+                if(actual!=expected) {
+                    errln("%s.freeze().spanUTF8(start %ld, condition %d)=%ld != %ld",
+                          patterns[i], (long)start, (int)conditions[j], (long)actual, (long)expected);
+                    break;
+                }
+            }
+        }
+    }
+}
+
 void UnicodeSetTest::TestStringSpan() {
     static const char *pattern="[x{xy}{xya}{axy}{ax}]";
     static const char *const string=
@@ -3978,3 +4033,99 @@ void UnicodeSetTest::TestDeepPattern() {
     assertTrue("[a[a[a...1000s...]]] -> error", errorCode.isFailure());
     errorCode.reset();
 }
+
+void UnicodeSetTest::TestSetToRanges() {
+    IcuTestErrorCode errorCode(*this, "TestSetToRanges");
+    static const UChar32 ranges[] = {
+        0, 0x1f, 0x20, 0x20, 0x41, 0x5a, 0xffff, 0x10000, 0x10fffe, 0x10ffff
+    };
+    UnicodeSet set(u"[abc{xyz}]", errorCode);
+    set.setToRanges(ranges, UPRV_LENGTHOF(ranges), errorCode);
+    assertSuccess("setToRanges()", errorCode);
+    UnicodeSet expected(0, 0x20);
+    expected.add(0x41, 0x5a).add(0xffff, 0x10000).add(0x10fffe, 0x10ffff);
+    assertTrue("setToRanges() merged adjacent ranges, removed strings", set == expected);
+    assertEquals("range count", 4, set.getRangeCount());
+
+    set.setToRanges(nullptr, 0, errorCode);
+    assertTrue("setToRanges(empty)", set.isEmpty() && errorCode.isSuccess());
+
+    // Invalid ranges leave the set unchanged.
+    static const UChar32 overlapping[] = { 0x41, 0x5a, 0x50, 0x60 };
+    static const UChar32 reversed[] = { 0x5a, 0x41 };
+    static const UChar32 tooHigh[] = { 0x10fff0, 0x110000 };
+    set.add(0x30);
+    set.setToRanges(overlapping, UPRV_LENGTHOF(overlapping), errorCode);
+    assertEquals("overlapping", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    set.setToRanges(reversed, UPRV_LENGTHOF(reversed), errorCode);
+    assertEquals("reversed", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    set.setToRanges(tooHigh, UPRV_LENGTHOF(tooHigh), errorCode);
+    assertEquals("too high", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    set.setToRanges(ranges, 3, errorCode);
+    assertEquals("odd length", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    assertTrue("unchanged after errors", set == UnicodeSet(0x30, 0x30));
+
+    // Round-trip through the serialized form.
+    uint16_t buffer[32];
+    int32_t length = expected.serialize(buffer, UPRV_LENGTHOF(buffer), errorCode);
+    USerializedSet sset;
+    assertTrue("uset_getSerializedSet()", uset_getSerializedSet(&sset, buffer, length));
+    set.setToSerialized(sset, errorCode);
+    assertTrue("setToSerialized()", errorCode.isSuccess() && set == expected);
+    UnicodeSet deserialized(buffer, length, UnicodeSet::kSerialized, errorCode);
+    assertTrue("kSerialized constructor", errorCode.isSuccess() && deserialized == expected);
+    UnicodeSet truncated(buffer, length - 1, UnicodeSet::kSerialized, errorCode);
+    assertEquals("truncated serialization", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    assertTrue("truncated serialization -> bogus", truncated.isBogus());
+    // Swap the first two BMP values, after the two header units.
+    uint16_t first = buffer[2];
+    buffer[2] = buffer[3];
+    buffer[3] = first;
+    uset_getSerializedSet(&sset, buffer, length);
+    set.setToSerialized(sset, errorCode);
+    assertEquals("unsorted serialization", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    assertTrue("unchanged after unsorted serialization", set == expected);
+
+    // A frozen set is not modified.
+    set.freeze();
+    set.setToRanges(ranges, 2, errorCode);
+    assertTrue("frozen", set == expected);
+}
+
+void UnicodeSetTest::TestFrozenManySupplementary() {
+    // Enough supplementary ranges for the frozen set to use a trie.
+    UnicodeSet set;
+    for (UChar32 c = 0x10000; c < 0x110000; c += 0x1000 + (c & 0x3ff)) {
+        set.add(c, c + (c & 0x7f));
+    }
+    set.add(0x10ffff).add(0x41, 0x5a).add(0xd800);
+    UnicodeSet frozen(set);
+    frozen.freeze();
+    LocalPointer<UnicodeSet> clone(static_cast<UnicodeSet *>(frozen.clone()));
+    assertTrue("clone is frozen", clone->isFrozen());
+    for (UChar32 c = 0xd000; c <= 0x10ffff; ++c) {
+        UBool expected = set.contains(c);
+        if (frozen.contains(c) != expected || clone->contains(c) != expected) {
+            errln("frozen.contains(U+%04lx) != %d", (long)c, expected);
+            return;
+        }
+    }
+    // span() over UTF-16 and UTF-8 decides supplementary code points the same way.
+    UnicodeString s;
+    for (int32_t i = 0; i < set.getRangeCount(); ++i) {
+        if (set.getRangeStart(i) >= 0x10000) {
+            s.append(set.getRangeStart(i)).append(set.getRangeEnd(i));
+        }
+    }
+    UChar32 notInSet = 0x10000;
+    while (set.contains(notInSet)) { ++notInSet; }
+    s.append(notInSet);
+    assertEquals("span(UTF-16)", s.length() - 2,
+                 frozen.span(s.getBuffer(), s.length(), USET_SPAN_CONTAINED));
+    std::string utf8;
+    s.toUTF8String(utf8);
+    assertEquals("spanUTF8()", (int32_t)utf8.length() - 4,
+                 frozen.spanUTF8(utf8.data(), (int32_t)utf8.length(), USET_SPAN_CONTAINED));
+    assertEquals("spanBackUTF8(not contained)", (int32_t)utf8.length() - 4,
+                 clone->spanBackUTF8(utf8.data(), (int32_t)utf8.length(), USET_SPAN_NOT_CONTAINED));
+}
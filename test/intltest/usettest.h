@@ -87,6 +87,7 @@ class UnicodeSetTest: public IntlTest {
     void TestFreezable();
 
     void TestSpan();
+    void TestSpanUTF8LongRuns();
 
     void TestStringSpan();
 
@@ -94,6 +95,8 @@ class UnicodeSetTest: public IntlTest {
     void TestIntOverflow();
     void TestUnusedCcc();
     void TestDeepPattern();
+    void TestSetToRanges();
+    void TestFrozenManySupplementary();
 
 private:
 
@@ -10,6 +10,7 @@
 #include "unicode/appendable.h"
 #include "unicode/std_string.h"
 #include "unicode/unistr.h"
+#include "unicode/unistrarena.h"
 #include "unicode/uchar.h"
 #include "unicode/ustring.h"
 #include "unicode/locid.h"
@@ -19,6 +20,8 @@
 #include "unicode/utf16.h"
 #include "cmemory.h"
 #include "charstr.h"
+#include "uhash.h"
+#include "ustr_imp.h"
 
 #if 0
 #include "unicode/ustream.h"
@@ -65,6 +68,8 @@ void UnicodeStringTest::runIndexedTest( int32_t index, UBool exec, const char* &
     TESTCASE_AUTO(TestWCharPointers);
     TESTCASE_AUTO(TestNullPointers);
     TESTCASE_AUTO(TestUnicodeStringInsertAppendToSelf);
+    TESTCASE_AUTO(TestArena);
+    TESTCASE_AUTO(TestHashKeys);
     TESTCASE_AUTO_END;
 }
 
@@ -2303,3 +2308,127 @@ void UnicodeStringTest::TestUnicodeStringInsertAppendToSelf() {
     str.insert(2, sub);
     assertEquals("", u"abbcdcde", str);
 }
+
+namespace {
+
+UBool isInBuffer(const UnicodeString &s, const char *buffer, int32_t capacity) {
+    const char *p = (const char *)s.getBuffer();
+    return buffer <= p && p < (buffer + capacity);
+}
+
+}  // namespace
+
+void UnicodeStringTest::TestArena() {
+    UnicodeStringArena emptyArena;
+    assertTrue("allocate(-1)", emptyArena.allocate(-1) == NULL);
+    void *p = emptyArena.allocate(3);
+    assertTrue("allocate(3) aligned", p != NULL && ((size_t)p & 0xf) == 0);
+    p = emptyArena.allocate(5);
+    assertTrue("allocate(5) aligned", p != NULL && ((size_t)p & 0xf) == 0);
+    assertEquals("one heap block for small allocations", 1, emptyArena.getHeapBlockCount());
+
+    char buffer[2000];
+    UnicodeStringArena arena(buffer, UPRV_LENGTHOF(buffer));
+    UnicodeString s(arena);
+    assertTrue("empty arena string", s.isEmpty() && !s.isBogus());
+    assertTrue("arena string in the arena buffer", isInBuffer(s, buffer, UPRV_LENGTHOF(buffer)));
+    for (int32_t i = 0; i < 20; ++i) {
+        s.append(u"abcdefghij");
+    }
+    assertEquals("arena string length", 200, s.length());
+    assertTrue("grown arena string in the arena buffer",
+               isInBuffer(s, buffer, UPRV_LENGTHOF(buffer)));
+    assertEquals("no heap block for growth", 0, arena.getHeapBlockCount());
+    const char16_t *terminated = s.getTerminatedBuffer();
+    assertTrue("NUL-terminated arena string", terminated != NULL && terminated[200] == 0);
+
+    // Copies are independent of the arena.
+    UnicodeString copy(s);
+    assertTrue("copy not in the arena buffer", !isInBuffer(copy, buffer, UPRV_LENGTHOF(buffer)));
+    assertEquals("copy contents", s, copy);
+    UnicodeString assigned;
+    assigned = s;
+    assigned.fastCopyFrom(s);
+    assertTrue("assigned not in the arena buffer",
+               !isInBuffer(assigned, buffer, UPRV_LENGTHOF(buffer)));
+    copy.setCharAt(0, u'X');
+    assertEquals("modified copy", u'X', copy.charAt(0));
+    assertEquals("arena string unchanged", u'a', s.charAt(0));
+
+    UnicodeString fromCopy(arena, copy);
+    assertEquals("arena copy contents", copy, fromCopy);
+    assertTrue("arena copy in the arena buffer",
+               isInBuffer(fromCopy, buffer, UPRV_LENGTHOF(buffer)));
+    fromCopy.toUpper("");
+    assertEquals("toUpper() of an arena string", u'B', fromCopy.charAt(1));
+    assertTrue("case-mapped arena string in the arena buffer",
+               isInBuffer(fromCopy, buffer, UPRV_LENGTHOF(buffer)));
+
+    // Moving the string moves the arena buffer.
+    UnicodeString moved(std::move(fromCopy));
+    assertTrue("moved arena string in the arena buffer",
+               isInBuffer(moved, buffer, UPRV_LENGTHOF(buffer)));
+    moved.append(u'!');
+    assertEquals("moved arena string length", 201, moved.length());
+
+    // When the caller's buffer is used up, the arena continues on the heap.
+    UnicodeString long1(arena);
+    for (int32_t i = 0; i < 100; ++i) {
+        long1.append(u"0123456789");
+    }
+    assertEquals("long arena string length", 1000, long1.length());
+    assertEquals("long arena string contents", u'9', long1.charAt(999));
+    assertTrue("long arena string on the heap",
+               !isInBuffer(long1, buffer, UPRV_LENGTHOF(buffer)));
+    assertTrue("arena heap blocks", arena.getHeapBlockCount() > 0);
+    assertEquals("earlier arena string unchanged", 200, s.length());
+    assertEquals("earlier arena string contents", u'j', s.charAt(199));
+}
+
+// Hash table keys use a faster hash than UnicodeString::hashCode().
+// It must depend only on the contents, for every length and kind of storage.
+void UnicodeStringTest::TestHashKeys() {
+    UChar buffer[200];
+    for (int32_t length = 0; length <= 130; ++length) {
+        for (int32_t i = 0; i < length; ++i) {
+            buffer[i] = (UChar)(0x61 + (i * 7) % 26);
+        }
+        buffer[length] = 0;
+        UnicodeString heap(buffer, length);
+        UnicodeString alias(TRUE, buffer, length);
+        UnicodeString shared(heap);
+        UElement key1, key2, key3;
+        key1.pointer = &heap;
+        key2.pointer = &alias;
+        key3.pointer = &shared;
+        int32_t hash = uhash_hashUnicodeString(key1);
+        if (hash != uhash_hashUnicodeString(key2) || hash != uhash_hashUnicodeString(key3)) {
+            errln("uhash_hashUnicodeString() differs for equal strings of length %d", (int)length);
+        }
+        UHashTok chars;
+        chars.pointer = buffer;
+        if (hash != uhash_hashUChars(chars)) {
+            errln("uhash_hashUChars() != uhash_hashUnicodeString() for length %d", (int)length);
+        }
+        if (heap != alias || heap != shared || !uhash_compareUnicodeString(key1, key2)) {
+            errln("equal strings of length %d compare as different", (int)length);
+        }
+        if (length > 0) {
+            buffer[length - 1] ^= 1;
+            UnicodeString other(buffer, length);
+            key2.pointer = &other;
+            if (hash == uhash_hashUnicodeString(key2)) {
+                errln("uhash_hashUnicodeString() ignores the last of %d code units", (int)length);
+            }
+            if (heap == other) {
+                errln("different strings of length %d compare as equal", (int)length);
+            }
+        }
+    }
+    UnicodeString bogus;
+    bogus.setToBogus();
+    UElement key;
+    key.pointer = &bogus;
+    assertEquals("bogus string hash", (int32_t)uhash_hashUnicodeString(key),
+                 ustr_fastHashUCharsN(nullptr, 0));
+}
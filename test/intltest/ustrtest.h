@@ -97,6 +97,8 @@ class UnicodeStringTest: public IntlTest {
     void TestWCharPointers();
     void TestNullPointers();
     void TestUnicodeStringInsertAppendToSelf();
+    void TestArena();
+    void TestHashKeys();
 };
 
 #endif
@@ -29,6 +29,7 @@
 #include "charstr.h"
 #include "cmemory.h"
 #include "intltest.h"
+#include "punycode.h"
 #include "uparse.h"
 
 class UTS46Test : public IntlTest {
@@ -39,6 +40,8 @@ class UTS46Test : public IntlTest {
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
     void TestAPI();
     void TestNotSTD3();
+    void TestLowercaseLDH();
+    void TestPunycodeUTF8();
     void TestSomeCases();
     void IdnaTest();
 
@@ -82,6 +85,8 @@ void UTS46Test::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
     TESTCASE_AUTO_BEGIN;
     TESTCASE_AUTO(TestAPI);
     TESTCASE_AUTO(TestNotSTD3);
+    TESTCASE_AUTO(TestLowercaseLDH);
+    TESTCASE_AUTO(TestPunycodeUTF8);
     TESTCASE_AUTO(TestSomeCases);
     TESTCASE_AUTO(IdnaTest);
     TESTCASE_AUTO_END;
@@ -245,6 +250,116 @@ void UTS46Test::TestNotSTD3() {
     }
 }
 
+// Already-lowercase LDH names take a shortcut in nameToASCII_UTF8().
+// Their results and errors must match those of the UTF-16 nameToASCII().
+void UTS46Test::TestLowercaseLDH() {
+    IcuTestErrorCode errorCode(*this, "TestLowercaseLDH()");
+    std::string label63(63, 'a');
+    std::string label64(64, 'a');
+    std::string name253, name254;
+    for(int i=0; i<4; ++i) {
+        name253.append(label63).append(1, '.');
+    }
+    name253.erase(253);  // 3 labels of 63 and one of 61 bytes
+    name254=name253+".";
+    std::string names[]={
+        "www.example.com", "www.example.com.", "a", "a-b.c-d.e0-9",
+        "0123456789.abcdefghijklmnopqrstuvwxyz.com",
+        ".", ".com", "www..com", "www.-example.com", "www.example-.com", "-",
+        "ab--cd.com", "xn--bcher-kva.de", "xn--.com", "a--b.com",
+        label63, label64, label63+"."+label64+".com",
+        name253, name254, name253+"a", name254+"a", name254+".",
+        "www.eXample.com", "www.example.com\x7f"
+    };
+    for(int32_t i=0; i<UPRV_LENGTHOF(names); ++i) {
+        const std::string &name=names[i];
+        UnicodeString name16=UnicodeString(name.data(), (int32_t)name.length(), US_INV).unescape();
+        UnicodeString result16;
+        IDNAInfo info16;
+        nontrans->nameToASCII(name16, result16, info16, errorCode);
+        std::string name8, result8;
+        name16.toUTF8String(name8);
+        StringByteSink<std::string> sink(&result8);
+        IDNAInfo info8;
+        nontrans->nameToASCII_UTF8(name8, sink, info8, errorCode);
+        if(errorCode.errIfFailureAndReset("nameToASCII[%d] %s", (int)i, name.c_str())) {
+            continue;
+        }
+        if(UnicodeString::fromUTF8(result8)!=result16 || info8.getErrors()!=info16.getErrors()) {
+            errln("N.nameToASCII_UTF8([%d] %s) vs. UTF-16 errors %04lx vs. %04lx "
+                  "or different string results",
+                  (int)i, name.c_str(), (long)info8.getErrors(), (long)info16.getErrors());
+        }
+    }
+
+    // Converting in place does not need any copying.
+    char buffer[20];
+    strcpy(buffer, "www.example.com");
+    TestCheckedArrayByteSink sink(buffer, UPRV_LENGTHOF(buffer));
+    IDNAInfo info;
+    trans->nameToASCII_UTF8(StringPiece(buffer, 15), sink, info, errorCode);
+    if( errorCode.errIfFailureAndReset("in-place nameToASCII_UTF8()") ||
+        info.hasErrors() || sink.NumberOfBytesWritten()!=15 ||
+        0!=memcmp(buffer, "www.example.com", 15) || !sink.calledFlush
+    ) {
+        errln("T.nameToASCII_UTF8(www.example.com) in place failed");
+    }
+}
+
+void UTS46Test::TestPunycodeUTF8() {
+    IcuTestErrorCode errorCode(*this, "TestPunycodeUTF8()");
+    static const char *const labels[]={
+        "b\\u00FCcher",
+        // RFC 3492 sample strings
+        "\\u0644\\u064A\\u0647\\u0645\\u0627\\u0628\\u062A\\u0643\\u0644"
+        "\\u0645\\u0648\\u0634\\u0639\\u0631\\u0628\\u064A\\u061F",
+        "3\\u5E74B\\u7D44\\u91D1\\u516B\\u5148\\u751F",
+        "Pu\\u00F1amantaq",
+        // many repeated and supplementary code points
+        "\\U0001F600a\\u00E9\\U0001F600\\u00E9\\u4E00\\u00E9z\\U0001F600\\u4E00"
+        "\\u00E9\\u00E9\\u4E00\\U0001F601\\u00E9",
+        "abc"
+    };
+    for(int32_t i=0; i<UPRV_LENGTHOF(labels); ++i) {
+        UnicodeString label16=UnicodeString(labels[i], -1, US_INV).unescape();
+        std::string label8;
+        label16.toUTF8String(label8);
+        UChar dest16[100];
+        char dest8[100];
+        int32_t length16=u_strToPunycode(label16.getBuffer(), label16.length(),
+                                         dest16, UPRV_LENGTHOF(dest16), NULL, errorCode);
+        int32_t length8=u_strToPunycodeUTF8(label8.data(), (int32_t)label8.length(),
+                                            dest8, UPRV_LENGTHOF(dest8), NULL, errorCode);
+        if(errorCode.errIfFailureAndReset("u_strToPunycode[UTF8]([%d])", (int)i)) {
+            continue;
+        }
+        UnicodeString puny16(dest16, length16);
+        if(i==0) {
+            assertEquals("Punycode(b\\u00FCcher)", UNICODE_STRING_SIMPLE("bcher-kva"), puny16);
+        }
+        if(puny16!=UnicodeString(dest8, length8, US_INV)) {
+            errln("u_strToPunycodeUTF8([%d]) differs from u_strToPunycode()", (int)i);
+        }
+        // Round trip.
+        UChar back[100];
+        int32_t backLength=u_strFromPunycode(dest16, length16,
+                                             back, UPRV_LENGTHOF(back), NULL, errorCode);
+        if(errorCode.errIfFailureAndReset("u_strFromPunycode([%d])", (int)i) ||
+                label16!=UnicodeString(back, backLength)) {
+            errln("u_strFromPunycode([%d]) does not round-trip", (int)i);
+        }
+    }
+
+    // Case flags apply to the lead bytes; ill-formed UTF-8 is an error.
+    static const char s[]="ab\xc3\xbc";
+    static const UBool caseFlags[]={ TRUE, FALSE, TRUE, TRUE };
+    char dest[20];
+    int32_t length=u_strToPunycodeUTF8(s, 4, dest, UPRV_LENGTHOF(dest), caseFlags, errorCode);
+    assertEquals("u_strToPunycodeUTF8(case flags)", "Ab-ykA", std::string(dest, length).c_str());
+    u_strToPunycodeUTF8("a\xc3", 2, dest, UPRV_LENGTHOF(dest), NULL, errorCode);
+    assertEquals("u_strToPunycodeUTF8(ill-formed)", U_INVALID_CHAR_FOUND, errorCode.reset());
+}
+
 struct TestCase {
     // Input string and options string (Nontransitional/Transitional/Both).
     const char *s, *o;
@@ -13,6 +13,8 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string>
+#include <vector>
 #include "unicode/utypes.h"
 #include "unicode/utext.h"
 #include "unicode/utf8.h"
@@ -61,6 +63,7 @@ UTextTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(Ticket10983);
     TESTCASE_AUTO(Ticket12130);
     TESTCASE_AUTO(Ticket13344);
+    TESTCASE_AUTO(UTF8ChunkTest);
     TESTCASE_AUTO_END;
 }
 
@@ -278,6 +281,54 @@ void UTextTest::TestString(const UnicodeString &s) {
     TestAccess(sa, ut, cpCount, u8Map);
     utext_close(ut);
 
+    //
+    // Segmented text tests.
+    //   Split the text into segments of varying lengths, including empty ones,
+    //   so that characters and surrogate pairs are split across segments.
+    //
+    static const int32_t segLengths[] = { 1, 0, 3, 2, 7, 0, 5, 1, 16 };
+    int32_t segCount = 0;
+    const UChar **u16Segs = new const UChar *[saLen + UPRV_LENGTHOF(segLengths)];
+    const char **u8Segs = new const char *[u8Len + UPRV_LENGTHOF(segLengths)];
+    int32_t *segLens = new int32_t[u8Len + UPRV_LENGTHOF(segLengths)];
+
+    const UChar *u16Text = sa.getBuffer();
+    for (i=0, j=0; i<saLen || j==0; j++) {
+        int32_t len = segLengths[j % UPRV_LENGTHOF(segLengths)];
+        if (len > saLen - i) {
+            len = saLen - i;
+        }
+        u16Segs[j] = u16Text + i;
+        segLens[j] = len;
+        i += len;
+    }
+    segCount = j;
+    status = U_ZERO_ERROR;
+    ut = utext_openUCharsSegments(NULL, u16Segs, segLens, segCount, &status);
+    TEST_SUCCESS(status);
+    TestAccess(sa, ut, cpCount, cpMap);
+    utext_close(ut);
+
+    for (i=0, j=0; i<u8Len || j==0; j++) {
+        int32_t len = segLengths[j % UPRV_LENGTHOF(segLengths)];
+        if (len > u8Len - i) {
+            len = u8Len - i;
+        }
+        u8Segs[j] = u8String + i;
+        segLens[j] = len;
+        i += len;
+    }
+    segCount = j;
+    status = U_ZERO_ERROR;
+    ut = utext_openUTF8Segments(NULL, u8Segs, segLens, segCount, &status);
+    TEST_SUCCESS(status);
+    TestAccess(sa, ut, cpCount, u8Map);
+    utext_close(ut);
+
+    delete []u16Segs;
+    delete []u8Segs;
+    delete []segLens;
+
 
 
     delete []cpMap;
@@ -1605,3 +1656,92 @@ void UTextTest::Ticket13344() {
     assertEquals("UTextTest::Ticket13344-bmp-2", (int64_t)5, utext_getNativeIndex(ut.getAlias()));
 }
 
+
+// UTF8ChunkTest  Iterate over UTF-8 text that spans many chunks, with long ASCII runs
+//                and with non-ASCII characters at and around the chunk boundaries,
+//                forwards, backwards and at random native indexes.
+
+void UTextTest::UTF8ChunkTest() {
+    UnicodeString ascii;
+    for (int32_t i = 0; i < 2000; ++i) {
+        ascii.append((UChar)(0x20 + i % 0x5f));
+    }
+    UnicodeString mixed;
+    for (int32_t i = 0; i < 2000; ++i) {
+        switch (m_rand() % 8) {
+            case 0: mixed.append((UChar)0xe9); break;
+            case 1: mixed.append((UChar)0x4e00); break;
+            case 2: mixed.append((UChar32)0x1f600); break;
+            default: mixed.append((UChar)(0x61 + i % 26)); break;
+        }
+    }
+    UnicodeString tail(ascii, 0, 1000);
+    tail.append(UnicodeString(u"\u00e9\U0001f600"));
+    const UnicodeString *texts[] = { &ascii, &mixed, &tail };
+
+    for (int32_t t = 0; t < UPRV_LENGTHOF(texts); ++t) {
+        const UnicodeString &us = *texts[t];
+        std::string u8;
+        us.toUTF8String(u8);
+        UErrorCode status = U_ZERO_ERROR;
+        LocalUTextPointer ut(utext_openUTF8(NULL, u8.data(), (int64_t)u8.length(), &status));
+        if (!assertSuccess("UTF8ChunkTest open", status)) {
+            return;
+        }
+        assertEquals("UTF8ChunkTest initial refill count", (int64_t)0, utext_getUTF8RefillCount(ut.getAlias()));
+
+        // Native index of each code point, and the code points in order.
+        std::vector<int64_t> nativeIndexes;
+        std::vector<UChar32> cps;
+        int32_t u8Index = 0;
+        for (int32_t i = 0; i < us.length(); i = us.moveIndex32(i, 1)) {
+            UChar32 c = us.char32At(i);
+            nativeIndexes.push_back(u8Index);
+            cps.push_back(c);
+            u8Index += U8_LENGTH(c);
+        }
+        int32_t cpCount = (int32_t)cps.size();
+
+        utext_setNativeIndex(ut.getAlias(), 0);
+        for (int32_t i = 0; i < cpCount; ++i) {
+            if (utext_getNativeIndex(ut.getAlias()) != nativeIndexes[i] ||
+                    utext_next32(ut.getAlias()) != cps[i]) {
+                errln("UTF8ChunkTest text %d: forward iteration fails at code point %d", (int)t, (int)i);
+                break;
+            }
+        }
+        assertEquals("UTF8ChunkTest end", U_SENTINEL, utext_next32(ut.getAlias()));
+        int64_t forwardRefills = utext_getUTF8RefillCount(ut.getAlias());
+        assertTrue("UTF8ChunkTest forward refills", forwardRefills > 0 && forwardRefills < cpCount);
+
+        for (int32_t i = cpCount - 1; i >= 0; --i) {
+            if (utext_previous32(ut.getAlias()) != cps[i] ||
+                    utext_getNativeIndex(ut.getAlias()) != nativeIndexes[i]) {
+                errln("UTF8ChunkTest text %d: backward iteration fails at code point %d", (int)t, (int)i);
+                break;
+            }
+        }
+        assertEquals("UTF8ChunkTest start", U_SENTINEL, utext_previous32(ut.getAlias()));
+        assertTrue("UTF8ChunkTest backward refills",
+                   utext_getUTF8RefillCount(ut.getAlias()) >= forwardRefills);
+
+        for (int32_t n = 0; n < 1000; ++n) {
+            int32_t i = m_rand() % cpCount;
+            if (utext_char32At(ut.getAlias(), nativeIndexes[i]) != cps[i] ||
+                    utext_getNativeIndex(ut.getAlias()) != nativeIndexes[i]) {
+                errln("UTF8ChunkTest text %d: random access fails at code point %d", (int)t, (int)i);
+                break;
+            }
+            // Step back from the random position, which may cross into the other buffer.
+            if (i > 0 && utext_previous32(ut.getAlias()) != cps[i - 1]) {
+                errln("UTF8ChunkTest text %d: previous32 fails at code point %d", (int)t, (int)i);
+                break;
+            }
+        }
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+    const UChar *str = u"abc";
+    LocalUTextPointer uut(utext_openUChars(NULL, str, -1, &status));
+    assertEquals("UTF8ChunkTest UChars refill count", (int64_t)-1, utext_getUTF8RefillCount(uut.getAlias()));
+}
@@ -11,6 +11,7 @@
 #include "intltest.h"
 
 #include "uvectest.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "hash.h"
 #include "uelement.h"
@@ -46,6 +47,9 @@ void UVectorTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
         case 2: name = "Hashtable_API";
             if (exec) Hashtable_API();
             break;
+        case 3: name = "MaybeStackVector_API";
+            if (exec) MaybeStackVector_API();
+            break;
         default: name = "";
             break; //needed to end loop
     }
@@ -200,3 +204,53 @@ void UVectorTest::Hashtable_API() {
     delete a;
 }
 
+
+namespace {
+
+// Counts its live instances, to check that MaybeStackVector deletes its items.
+struct CountedItem : public UMemory {
+    CountedItem(int32_t v, int32_t &live) : value(v), liveCount(live) { ++liveCount; }
+    ~CountedItem() { --liveCount; }
+    int32_t value;
+    int32_t &liveCount;
+};
+
+}  // namespace
+
+void UVectorTest::MaybeStackVector_API() {
+    int32_t live = 0;
+    {
+        // Grow past the stack capacity.
+        MaybeStackVector<CountedItem, 4> a;
+        TEST_ASSERT(a.length() == 0);
+        for (int32_t i = 0; i < 20; ++i) {
+            CountedItem *item = a.emplaceBack(i, live);
+            TEST_ASSERT(item != NULL && item->value == i);
+        }
+        TEST_ASSERT(a.length() == 20);
+        TEST_ASSERT(live == 20);
+        TEST_ASSERT(a[0]->value == 0 && a[19]->value == 19);
+
+        a.removeAt(5);
+        TEST_ASSERT(a.length() == 19);
+        TEST_ASSERT(live == 19);
+        TEST_ASSERT(a[4]->value == 4 && a[5]->value == 6 && a[18]->value == 19);
+        a.removeAt(18);
+        TEST_ASSERT(a.length() == 18 && a[17]->value == 18);
+
+        // Moving transfers the items.
+        MaybeStackVector<CountedItem, 4> b(std::move(a));
+        TEST_ASSERT(a.length() == 0);
+        TEST_ASSERT(b.length() == 18 && b[17]->value == 18);
+        TEST_ASSERT(live == 18);
+
+        // Moving a vector that still uses its stack array.
+        MaybeStackVector<CountedItem, 4> c;
+        c.emplaceBack(100, live);
+        b = std::move(c);
+        TEST_ASSERT(live == 1);
+        TEST_ASSERT(b.length() == 1 && b[0]->value == 100);
+        TEST_ASSERT(c.length() == 0);
+    }
+    TEST_ASSERT(live == 0);
+}
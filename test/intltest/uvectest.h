@@ -30,6 +30,7 @@ class UVectorTest: public IntlTest {
     void UVector_API();
     void UStack_API();
     void Hashtable_API();
+    void MaybeStackVector_API();
 
 };
 
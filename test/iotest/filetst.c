@@ -1511,6 +1511,54 @@ static void TestUnicodeFormat(void)
 #endif
 }
 
+static void TestFprintfCompiledFormat(void)
+{
+#if !UCONFIG_NO_FORMATTING
+    UChar uBuffer[256];
+    UErrorCode status = U_ZERO_ERROR;
+    UFILE *myFile;
+    UPrintfFormat *format;
+    int32_t i;
+
+    format = u_printf_openFormat(u"%d: %-6s|%.2f|%x%n\n", -1, "en_US_POSIX", &status);
+    if (U_FAILURE(status)) {
+        log_err("u_printf_openFormat() failed - %s\n", u_errorName(status));
+        return;
+    }
+    myFile = u_fopen(STANDARD_TEST_FILE, "w", "fr", "UTF-8");
+    if (!myFile) {
+        log_err("Test file can't be opened\n");
+        u_printf_closeFormat(format);
+        return;
+    }
+    for (i = 0; i < 3; i++) {
+        int32_t count = -1;
+        if (u_fprintf_format(myFile, format, i, "line", 1.5 * i, 4096 + i, &count) != 20 || count != 19) {
+            log_err("u_fprintf_format() returned the wrong length for line %d\n", (int)i);
+        }
+    }
+    u_fclose(myFile);
+    u_printf_closeFormat(format);
+
+    /* The locale of the compiled format is used, not the one of the UFILE. */
+    myFile = u_fopen(STANDARD_TEST_FILE, "r", NULL, "UTF-8");
+    if (!myFile) {
+        log_err("Test file can't be opened\n");
+        return;
+    }
+    if (u_fgets(uBuffer, UPRV_LENGTHOF(uBuffer), myFile) == NULL
+        || u_strcmp(uBuffer, u"0: line  |0.00|1000\n") != 0
+        || u_fgets(uBuffer, UPRV_LENGTHOF(uBuffer), myFile) == NULL
+        || u_strcmp(uBuffer, u"1: line  |1.50|1001\n") != 0
+        || u_fgets(uBuffer, UPRV_LENGTHOF(uBuffer), myFile) == NULL
+        || u_strcmp(uBuffer, u"2: line  |3.00|1002\n") != 0)
+    {
+        log_err("u_fprintf_format() wrote the wrong text\n");
+    }
+    u_fclose(myFile);
+#endif
+}
+
 static void TestFileWriteRetval(const char * a_pszEncoding) { 
     UChar * buffer; 
     UFILE * myFile; 
@@ -1585,6 +1633,224 @@ static void TestFileWriteRetvalNONE(void) {
     TestFileWriteRetval(""); 
 } 
 
+/* Writes lines of mixed-script text that cross the default buffer size many times. */
+static int32_t WriteMixedLines(const char *codepage, UChar *expected, int32_t capacity) {
+    static const UChar line[] = u"abc été 中文 \U0001F600 نص end\n";
+    UFILE *myFile = u_fopen(STANDARD_TEST_FILE, "w", NULL, codepage);
+    int32_t lineLength = u_strlen(line);
+    int32_t length = 0;
+
+    if (myFile == NULL) {
+        log_err("Can't write test file with codepage %s.\n", codepage);
+        return 0;
+    }
+    while (length + lineLength < capacity) {
+        u_file_write(line, lineLength, myFile);
+        u_memcpy(expected + length, line, lineLength);
+        length += lineLength;
+    }
+    expected[length] = 0;
+    u_fclose(myFile);
+    return length;
+}
+
+static void ReadAllAndCompare(UFILE *myFile, const UChar *expected, int32_t expectedLength, const char *name) {
+    UChar line[256];
+    int32_t length = 0;
+
+    while (u_fgets(line, UPRV_LENGTHOF(line), myFile) != NULL) {
+        int32_t lineLength = u_strlen(line);
+        if (length + lineLength > expectedLength
+            || u_memcmp(line, expected + length, lineLength) != 0)
+        {
+            log_err("%s: wrong text after %d UChars\n", name, (int)length);
+            return;
+        }
+        length += lineLength;
+    }
+    if (length != expectedLength) {
+        log_err("%s: read %d UChars, expected %d\n", name, (int)length, (int)expectedLength);
+    }
+    if (!u_feof(myFile)) {
+        log_err("%s: u_feof() is FALSE after reading everything\n", name);
+    }
+}
+
+static void TestFileMapped(void) {
+    static const char *codepages[] = { "UTF-8", "UTF-16", "ibm-1208", "" };
+    UChar expected[8000];
+    int32_t i;
+
+    for (i = 0; i < UPRV_LENGTHOF(codepages); i++) {
+        const char *codepage = codepages[i];
+        int32_t expectedLength;
+        UFILE *myFile;
+        UErrorCode status = U_ZERO_ERROR;
+
+        if (*codepage == 0) {
+            /* The invariant conversion only handles printable ASCII. */
+            static const UChar text[] = u"no codepage ";
+            UFILE *written = u_fopen(STANDARD_TEST_FILE, "w", NULL, codepage);
+            for (expectedLength = 0; expectedLength + 12 < 3000; expectedLength += 12) {
+                u_file_write(text, 12, written);
+                u_memcpy(expected + expectedLength, text, 12);
+            }
+            u_fclose(written);
+        } else {
+            expectedLength = WriteMixedLines(codepage, expected, UPRV_LENGTHOF(expected));
+        }
+
+        myFile = u_fopen_mapped(STANDARD_TEST_FILE, NULL, codepage);
+        if (myFile == NULL) {
+            log_err("u_fopen_mapped(%s) failed\n", codepage);
+            continue;
+        }
+        ReadAllAndCompare(myFile, expected, expectedLength, codepage);
+        if (u_file_write(expected, 3, myFile) != 0) {
+            log_err("u_file_write() on a mapped file should not write anything\n");
+        }
+
+        /* Read it again with the smallest buffer. */
+        u_frewind(myFile);
+        u_fsetbuffersize(myFile, 64, &status);
+        if (U_FAILURE(status)) {
+            log_err("u_fsetbuffersize(64) after u_frewind failed - %s\n", u_errorName(status));
+        }
+        ReadAllAndCompare(myFile, expected, expectedLength, codepage);
+        u_fclose(myFile);
+    }
+
+    /* An empty file is mapped without any data. */
+    {
+        UFILE *myFile = u_fopen(STANDARD_TEST_FILE, "w", NULL, "UTF-8");
+        u_fclose(myFile);
+        myFile = u_fopen_mapped(STANDARD_TEST_FILE, NULL, "UTF-8");
+        if (myFile == NULL || u_fgetc(myFile) != U_EOF || !u_feof(myFile)) {
+            log_err("u_fopen_mapped() on an empty file should be at EOF\n");
+        }
+        u_fclose(myFile);
+    }
+    if (u_fopen_mapped("no-such-file.txt", NULL, "UTF-8") != NULL) {
+        log_err("u_fopen_mapped() on a missing file should return NULL\n");
+    }
+}
+
+static void TestFileBufferSize(void) {
+    static const int32_t sizes[] = { 64, 100, 1024, 65536 };
+    UChar expected[8000];
+    UChar stringBuf[16];
+    int32_t expectedLength = WriteMixedLines("UTF-8", expected, UPRV_LENGTHOF(expected));
+    UErrorCode status = U_ZERO_ERROR;
+    UFILE *myFile;
+    int32_t i;
+
+    for (i = 0; i < UPRV_LENGTHOF(sizes); i++) {
+        status = U_ZERO_ERROR;
+        myFile = u_fopen(STANDARD_TEST_FILE, "r", NULL, "UTF-8");
+        u_fsetbuffersize(myFile, sizes[i], &status);
+        if (U_FAILURE(status)) {
+            log_err("u_fsetbuffersize(%d) failed - %s\n", (int)sizes[i], u_errorName(status));
+        }
+        ReadAllAndCompare(myFile, expected, expectedLength, "u_fsetbuffersize");
+        u_fclose(myFile);
+    }
+
+    /* Large output chunks produce the same bytes. */
+    myFile = u_fopen(STANDARD_TEST_FILE, "w", NULL, "UTF-16");
+    u_fsetbuffersize(myFile, 65536, &status);
+    u_file_write(expected, expectedLength, myFile);
+    u_fclose(myFile);
+    myFile = u_fopen(STANDARD_TEST_FILE, "r", NULL, "UTF-16");
+    ReadAllAndCompare(myFile, expected, expectedLength, "UTF-16 output");
+    u_fclose(myFile);
+
+    status = U_ZERO_ERROR;
+    myFile = u_fopen(STANDARD_TEST_FILE, "r", NULL, "UTF-16");
+    u_fsetbuffersize(myFile, 63, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_fsetbuffersize(63) should fail - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    u_fgetc(myFile);
+    u_fsetbuffersize(myFile, 4096, &status);
+    if (status != U_INVALID_STATE_ERROR) {
+        log_err("u_fsetbuffersize() after reading should fail - %s\n", u_errorName(status));
+    }
+    u_fclose(myFile);
+
+    status = U_ZERO_ERROR;
+    myFile = u_fstropen(stringBuf, UPRV_LENGTHOF(stringBuf), NULL);
+    u_fsetbuffersize(myFile, 4096, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_fsetbuffersize() on a string UFILE should fail - %s\n", u_errorName(status));
+    }
+    u_fclose(myFile);
+}
+
+static void TestFileWriteUTF8(void) {
+    static const char text[] = "plain \xC3\xA9t\xC3\xA9 \xE4\xB8\xAD \xF0\x9F\x98\x80 \xFF bad\n";
+    static const UChar expected[] = u"plain été 中 \U0001F600 � bad\n";
+    int32_t textLength = (int32_t)strlen(text);
+    char readBack[sizeof(text)];
+    UChar uBuffer[64];
+    UChar stringBuf[64];
+    FILE *stdFile;
+    UFILE *myFile;
+    int32_t i;
+
+    /* UTF-8 output: the bytes, even ill-formed ones, are copied unchanged. */
+    myFile = u_fopen(STANDARD_TEST_FILE, "w", NULL, "UTF-8");
+    if (u_file_write_utf8(text, -1, myFile) != textLength) {
+        log_err("u_file_write_utf8() did not write all bytes\n");
+    }
+    u_fclose(myFile);
+    stdFile = fopen(STANDARD_TEST_FILE, "rb");
+    if (fread(readBack, 1, sizeof(readBack), stdFile) != (size_t)textLength
+        || memcmp(readBack, text, textLength) != 0)
+    {
+        log_err("u_file_write_utf8() changed the bytes of UTF-8 output\n");
+    }
+    fclose(stdFile);
+
+    /* A pending lead surrogate is written before the UTF-8 text. */
+    myFile = u_fopen(STANDARD_TEST_FILE, "w", NULL, "UTF-8");
+    u_file_write(u"\U0001F600", 1, myFile);
+    u_file_write(u"\U0001F600" + 1, 1, myFile);
+    u_file_write_utf8("x", 1, myFile);
+    u_fclose(myFile);
+    myFile = u_fopen(STANDARD_TEST_FILE, "r", NULL, "UTF-8");
+    if (u_fgets(uBuffer, UPRV_LENGTHOF(uBuffer), myFile) == NULL
+        || u_strcmp(uBuffer, u"\U0001F600x") != 0)
+    {
+        log_err("u_file_write_utf8() after a split surrogate pair wrote the wrong text\n");
+    }
+    u_fclose(myFile);
+
+    /* Other codepages and longer text go through UTF-16 in chunks. */
+    myFile = u_fopen(STANDARD_TEST_FILE, "w", NULL, "UTF-16");
+    for (i = 0; i < 100; i++) {
+        u_file_write_utf8(text, textLength, myFile);
+    }
+    u_fclose(myFile);
+    myFile = u_fopen(STANDARD_TEST_FILE, "r", NULL, "UTF-16");
+    for (i = 0; i < 100; i++) {
+        if (u_fgets(uBuffer, UPRV_LENGTHOF(uBuffer), myFile) == NULL
+            || u_strcmp(uBuffer, expected) != 0)
+        {
+            log_err("u_file_write_utf8() to UTF-16 wrote the wrong text in line %d\n", (int)i);
+            break;
+        }
+    }
+    u_fclose(myFile);
+
+    myFile = u_fstropen(stringBuf, UPRV_LENGTHOF(stringBuf), NULL);
+    u_file_write_utf8(text, textLength, myFile);
+    u_fclose(myFile);
+    if (u_strncmp(stringBuf, expected, u_strlen(expected)) != 0) {
+        log_err("u_file_write_utf8() to a string UFILE wrote the wrong text\n");
+    }
+}
+
 U_CFUNC void
 addFileTest(TestNode** root) {
 #if !UCONFIG_NO_FORMATTING
@@ -1605,6 +1871,9 @@ addFileTest(TestNode** root) {
     addTest(root, &TestFileWriteRetvalUTF8, "file/TestFileWriteRetvalUTF8");
     addTest(root, &TestFileWriteRetvalASCII, "file/TestFileWriteRetvalASCII");
     addTest(root, &TestFileWriteRetvalNONE, "file/TestFileWriteRetvalNONE");
+    addTest(root, &TestFileMapped, "file/TestFileMapped");
+    addTest(root, &TestFileBufferSize, "file/TestFileBufferSize");
+    addTest(root, &TestFileWriteUTF8, "file/TestFileWriteUTF8");
 #if !UCONFIG_NO_FORMATTING
     addTest(root, &TestCodepageAndLocale, "file/TestCodepageAndLocale");
     addTest(root, &TestFprintfFormat, "file/TestFprintfFormat");
@@ -1613,5 +1882,6 @@ addFileTest(TestNode** root) {
     addTest(root, &TestBadScanfFormat, "file/TestBadScanfFormat");
     addTest(root, &TestVargs, "file/TestVargs");
     addTest(root, &TestUnicodeFormat, "file/TestUnicodeFormat");
+    addTest(root, &TestFprintfCompiledFormat, "file/TestFprintfCompiledFormat");
 #endif
 }
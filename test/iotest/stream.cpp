@@ -179,6 +179,61 @@ static void U_CALLCONV TestStream(void)
     ucnv_close(defConv);
 }
 
+static void U_CALLCONV TestStreamDefaultCharset(void)
+{
+    char defConvName[UCNV_MAX_CONVERTER_NAME_LENGTH*2];
+    UnicodeString str;
+    string expected;
+    int32_t i;
+
+    // A surrogate pair at a conversion chunk boundary, and an unpaired surrogate.
+    for (i = 0; i < 255; i++) {
+        str.append((UChar)0x61);
+        expected.append("a");
+    }
+    str.append((UChar32)0x10000).append((UChar)0xE9).append((UChar)0xD800).append((UChar)0x62);
+    expected.append("\xF0\x90\x80\x80\xC3\xA9\xEF\xBF\xBD" "b");
+
+    strncpy(defConvName, ucnv_getDefaultName(), UPRV_LENGTHOF(defConvName));
+    ucnv_setDefaultName("UTF-8");
+#ifdef USE_SSTREAM
+    ostringstream outUTF8;
+    outUTF8 << str << setw(6) << right << UnicodeString(u"été");
+    // setw() counts bytes, as for any char* insertion
+    if (outUTF8.str() != expected + " \xC3\xA9t\xC3\xA9") {
+        log_err("UnicodeString << to UTF-8 wrote the wrong bytes\n");
+    }
+#endif
+
+    // Switching the default charset must not keep using the previous converter.
+    ucnv_setDefaultName("ISO-8859-1");
+#if defined(USE_SSTREAM) && !U_CHARSET_IS_UTF8
+    for (i = 0; i < 2; i++) {
+        ostringstream outLatin1;
+        outLatin1 << UnicodeString(u"café");
+        if (outLatin1.str() != "caf\xE9") {
+            log_err("UnicodeString << to ISO-8859-1 wrote the wrong bytes\n");
+        }
+        UnicodeString inStr;
+        istringstream inLatin1("\xE9t\xE9 x");
+        inLatin1 >> inStr;
+        if (inStr != UnicodeString(u"été")) {
+            log_err("UnicodeString >> from ISO-8859-1 read the wrong text\n");
+        }
+    }
+#endif
+    ucnv_setDefaultName("UTF-8");
+#ifdef USE_SSTREAM
+    UnicodeString inStr;
+    istringstream inUTF8("\xC3\xA9t\xC3\xA9 x");
+    inUTF8 >> inStr;
+    if (inStr != UnicodeString(u"été")) {
+        log_err("UnicodeString >> from UTF-8 read the wrong text\n");
+    }
+#endif
+    ucnv_setDefaultName(defConvName);
+}
+
 #define IOSTREAM_GOOD_SHIFT 3
 #define IOSTREAM_GOOD (1<<IOSTREAM_GOOD_SHIFT)
 #define IOSTREAM_BAD_SHIFT 2
@@ -320,4 +375,5 @@ U_CDECL_END
 U_CFUNC void addStreamTests(TestNode** root) {
     addTest(root, &TestStream, "stream/TestStream");
     addTest(root, &TestStreamEOF, "stream/TestStreamEOF");
+    addTest(root, &TestStreamDefaultCharset, "stream/TestStreamDefaultCharset");
 }
@@ -786,6 +786,132 @@ static void TestCount(void) {
 #endif
 }
 
+#if !UCONFIG_NO_FORMATTING
+/* Formats with a compiled pattern, which must give the same result as u_vsnprintf_u(). */
+static void TestCompiledFormat(const char *pattern, const char *expected, ...) {
+    UChar uPattern[256];
+    UChar uExpected[256];
+    UChar compiledResult[256];
+    UChar parsedResult[256];
+    UErrorCode status = U_ZERO_ERROR;
+    UPrintfFormat *format;
+    int32_t compiledLength;
+    int32_t parsedLength;
+    va_list ap;
+
+    u_uastrcpy(uPattern, pattern);
+    u_uastrcpy(uExpected, expected);
+    format = u_printf_openFormat(uPattern, -1, NULL, &status);
+    if (U_FAILURE(status)) {
+        log_err("u_printf_openFormat(\"%s\") failed - %s\n", pattern, u_errorName(status));
+        return;
+    }
+
+    va_start(ap, expected);
+    compiledLength = u_vsnprintf_format(compiledResult, UPRV_LENGTHOF(compiledResult), format, ap);
+    va_end(ap);
+    va_start(ap, expected);
+    parsedLength = u_vsnprintf_u(parsedResult, UPRV_LENGTHOF(parsedResult), uPattern, ap);
+    va_end(ap);
+
+    if (u_strcmp(compiledResult, parsedResult) != 0 || compiledLength != parsedLength) {
+        char cResult[256];
+        u_austrncpy(cResult, compiledResult, UPRV_LENGTHOF(cResult));
+        log_err("\"%s\" compiled and parsed results differ, compiled: \"%s\"\n", pattern, cResult);
+    }
+    if (u_strcmp(compiledResult, uExpected) != 0) {
+        char cResult[256];
+        u_austrncpy(cResult, compiledResult, UPRV_LENGTHOF(cResult));
+        log_err("\"%s\" Got: \"%s\", Expected: \"%s\"\n", pattern, cResult, expected);
+    }
+    u_printf_closeFormat(format);
+}
+#endif
+
+static void TestCompiledPrintf(void) {
+#if !UCONFIG_NO_FORMATTING
+    UChar uBuffer[64];
+    UErrorCode status = U_ZERO_ERROR;
+    UPrintfFormat *format;
+    int32_t length;
+
+    TestCompiledFormat("%d|%5d|%-5d|%05d|%+d|% d|%.3d", "-42|   42|42   |00042|+42| 42|042",
+        -42, 42, 42, 42, 42, 42, 42);
+    TestCompiledFormat("%hd %d %lld %u %hu", "1 -2147483648 1311768467463790322 4294967295 1",
+        65537, (int32_t)(-2147483647-1), INT64_C(1311768467463790322), -1, 65537);
+    TestCompiledFormat("%f|%.2f|%10.3f|%-10.1f|%+f|%.0f", "1.500000|3.14|     3.142|-3.1      |+2.500000|7",
+        1.5, 3.14159, 3.14159, -3.14159, 2.5, 7.0);
+    TestCompiledFormat("%s|%S|%c|%C|%#x|%o|%%", "abc|def|e|f|0xff|17|%",
+        "abc", u"def", 'e', (UChar)0x66, 255, 15);
+    TestCompiledFormat("%*d|%-*d|%*d|%.*f|%.*d", "    42|42    |42    |3.142|0042",
+        6, 42, 6, 42, -6, 42, 3, 3.14159, 4, 42);
+    TestCompiledFormat("%2$s %1$d %3$.1f %2$s", "y 7 2.8 y", 7, "y", 2.75);
+    TestCompiledFormat("%e|%.1P", "1.234000e+001|12.5%", 12.34, 0.125);
+    TestCompiledFormat("no arguments", "no arguments");
+
+    /* The numbers use the locale of the compiled format. */
+    format = u_printf_openFormat(u"%d %.1f", -1, "en", &status);
+    if (U_SUCCESS(status)) {
+        u_snprintf_format(uBuffer, UPRV_LENGTHOF(uBuffer), format, 1234567, 1234.5);
+        if (u_strcmp(uBuffer, u"1,234,567 1,234.5") != 0) {
+            log_err("u_snprintf_format() did not use the locale of the compiled format\n");
+        }
+    }
+    else {
+        log_data_err("u_printf_openFormat(en) failed - %s\n", u_errorName(status));
+    }
+    u_printf_closeFormat(format);
+
+    /* Output is truncated like u_snprintf_u() does, and the pattern length is honored. */
+    status = U_ZERO_ERROR;
+    format = u_printf_openFormat(u"%dabc", 2, NULL, &status);
+    if (U_SUCCESS(status)) {
+        u_memset(uBuffer, 0x78, UPRV_LENGTHOF(uBuffer));
+        length = u_snprintf_format(uBuffer, 2, format, 123);
+        if (length != 3 || u_strncmp(uBuffer, u"12x", 3) != 0) {
+            log_err("u_snprintf_format() with a short buffer returned %d\n", (int)length);
+        }
+    }
+    else {
+        log_err("u_printf_openFormat() with a length failed - %s\n", u_errorName(status));
+    }
+    u_printf_closeFormat(format);
+
+    /* Unknown tags and a trailing '%' are echoed. */
+    status = U_ZERO_ERROR;
+    format = u_printf_openFormat(u"ab%Qc%", -1, NULL, &status);
+    if (U_SUCCESS(status)) {
+        u_snprintf_format(uBuffer, UPRV_LENGTHOF(uBuffer), format);
+        if (u_strcmp(uBuffer, u"ab%Qc%") != 0) {
+            log_err("u_snprintf_format() did not echo unknown tags\n");
+        }
+    }
+    else {
+        log_err("u_printf_openFormat() with unknown tags failed - %s\n", u_errorName(status));
+    }
+    u_printf_closeFormat(format);
+
+    /* Mixed positional and sequential arguments, and unused positions, are rejected. */
+    status = U_ZERO_ERROR;
+    format = u_printf_openFormat(u"%1$d %d", -1, NULL, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR || format != NULL) {
+        log_err("u_printf_openFormat() with mixed arguments - %s\n", u_errorName(status));
+    }
+    u_printf_closeFormat(format);
+    status = U_ZERO_ERROR;
+    format = u_printf_openFormat(u"%2$d", -1, NULL, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR || format != NULL) {
+        log_err("u_printf_openFormat() with an unused argument - %s\n", u_errorName(status));
+    }
+    u_printf_closeFormat(format);
+    status = U_ZERO_ERROR;
+    format = u_printf_openFormat(NULL, -1, NULL, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR || format != NULL) {
+        log_err("u_printf_openFormat(NULL) - %s\n", u_errorName(status));
+    }
+#endif
+}
+
 U_CFUNC void
 addStringTest(TestNode** root) {
 #if !UCONFIG_NO_FORMATTING
@@ -798,6 +924,7 @@ addStringTest(TestNode** root) {
     addTest(root, &TestBadScanfFormat, "string/TestBadScanfFormat");
     addTest(root, &TestVargs, "string/TestVargs");
     addTest(root, &TestCount, "string/TestCount");
+    addTest(root, &TestCompiledPrintf, "string/TestCompiledPrintf");
 #endif
 }
 
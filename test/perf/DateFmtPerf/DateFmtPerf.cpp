@@ -60,6 +60,8 @@ UPerfFunction* DateFormatPerfTest::runIndexedTest(int32_t index, UBool exec,cons
         TESTCASE(22,DateFmtCopy10000);
         TESTCASE(23,DateFmtCreate250);
         TESTCASE(24,DateFmtCreate10000);
+        TESTCASE(25, TimeZoneOffset250);
+        TESTCASE(26, TimeZoneOffset10000);
 
 
         default: 
@@ -144,6 +146,14 @@ UPerfFunction *DateFormatPerfTest::TimeZoneCreate10000() {
     return new TimeZoneCreateFunction(10000, locale);
 }
 
+UPerfFunction *DateFormatPerfTest::TimeZoneOffset250() {
+    return new TimeZoneOffsetFunction(250);
+}
+
+UPerfFunction *DateFormatPerfTest::TimeZoneOffset10000() {
+    return new TimeZoneOffsetFunction(10000);
+}
+
 UPerfFunction *DateFormatPerfTest::DTPatternGeneratorCreate250() {
     return new DTPatternGeneratorCreateFunction(250, locale);
 }
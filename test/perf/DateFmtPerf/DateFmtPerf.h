@@ -416,6 +416,57 @@ class TimeZoneCreateFunction : public UPerfFunction
 
 };
 
+// Gets the offsets of many time zones for nearly monotonic timestamps,
+// like those of a log stream, in the range of their historical transitions.
+class TimeZoneOffsetFunction : public UPerfFunction
+{
+
+private:
+	int num;
+	TimeZone* zones[12];
+	int32_t zoneCount;
+public:
+
+	TimeZoneOffsetFunction(int a)
+	{
+		static const char* const ids[] = {
+			"America/Los_Angeles", "America/New_York", "America/Sao_Paulo", "Europe/London",
+			"Europe/Berlin", "Europe/Moscow", "Africa/Cairo", "Asia/Jerusalem",
+			"Asia/Kolkata", "Asia/Tokyo", "Australia/Sydney", "Pacific/Auckland"
+		};
+		num = a;
+		zoneCount = UPRV_LENGTHOF(ids);
+		for (int32_t i = 0; i < zoneCount; i++) {
+			zones[i] = TimeZone::createTimeZone(UnicodeString(ids[i], -1, US_INV));
+		}
+	}
+
+	virtual ~TimeZoneOffsetFunction()
+	{
+		for (int32_t i = 0; i < zoneCount; i++) {
+			delete zones[i];
+		}
+	}
+
+	virtual void call(UErrorCode* status)
+	{
+		// 1995-01-01, then about 7 hours apart, with every 16th step going back a little
+		UDate date = 788918400000.0;
+		int32_t raw, dst;
+		for(int j = 0; j < num; j++) {
+			date += ((j & 15) == 15) ? -3600000.0 : 25000000.0;
+			for (int32_t i = 0; i < zoneCount; i++) {
+				zones[i]->getOffset(date, FALSE, raw, dst, *status);
+			}
+		}
+	}
+
+	virtual long getOperationsPerIteration()
+	{
+		return num * zoneCount;
+	}
+};
+
 class DTPatternGeneratorCreateFunction : public UPerfFunction
 {
 
@@ -838,6 +889,8 @@ class DateFormatPerfTest : public UPerfTest
     UPerfFunction* DIFCreate10000();
     UPerfFunction* TimeZoneCreate250();
     UPerfFunction* TimeZoneCreate10000();
+    UPerfFunction* TimeZoneOffset250();
+    UPerfFunction* TimeZoneOffset10000();
     UPerfFunction* DTPatternGeneratorCreate250();
     UPerfFunction* DTPatternGeneratorCreate10000();
     UPerfFunction* DTPatternGeneratorCopy250();
@@ -69,9 +69,12 @@
     "ucol_strcollUTF8/len",         ["$p1,TestStrcollUTF8", "$p2,TestStrcollUTF8"],
     "ucol_strcollUTF8/null",        ["$p1,TestStrcollUTF8Null", "$p2,TestStrcollUTF8Null"],
     "ucol_strcollUTF8/len/similar", ["$p1,TestStrcollUTF8Similar", "$p2,TestStrcollUTF8Similar"],
+    "ucol_strcollUTF8/len/adjacent", ["$p1,TestStrcollUTF8Adjacent", "$p2,TestStrcollUTF8Adjacent"],
 
     "ucol_getSortKey/len",          ["$p1,TestGetSortKey", "$p2,TestGetSortKey"],
     "ucol_getSortKey/null",         ["$p1,TestGetSortKeyNull", "$p2,TestGetSortKeyNull"],
+    "ucol_getSortKeys",             ["$p1,TestGetSortKeys", "$p2,TestGetSortKeys"],
+    "ucol_getSortKeysUTF8",         ["$p1,TestGetSortKeysUTF8", "$p2,TestGetSortKeysUTF8"],
 
     "ucol_nextSortKeyPart/4_all",   ["$p1,TestNextSortKeyPart_4All", "$p2,TestNextSortKeyPart_4All"],
     "ucol_nextSortKeyPart/4x4",     ["$p1,TestNextSortKeyPart_4x4", "$p2,TestNextSortKeyPart_4x4"],
@@ -224,6 +224,51 @@ long StrcollUTF8::getOperationsPerIteration()
     return maxTestStrings * maxTestStrings;
 }
 
+//
+// Test case taking a single test data array in sorted order, calling ucol_strcollUTF8
+// for each pair of adjacent strings, which often share long prefixes
+//
+class StrcollUTF8Adjacent : public UPerfFunction
+{
+public:
+    StrcollUTF8Adjacent(const UCollator* coll, const CA_char* source);
+    ~StrcollUTF8Adjacent();
+    virtual void call(UErrorCode* status);
+    virtual long getOperationsPerIteration();
+
+private:
+    const UCollator *coll;
+    const CA_char *source;
+};
+
+StrcollUTF8Adjacent::StrcollUTF8Adjacent(const UCollator* coll, const CA_char* source)
+    :   coll(coll),
+        source(source)
+{
+}
+
+StrcollUTF8Adjacent::~StrcollUTF8Adjacent()
+{
+}
+
+void StrcollUTF8Adjacent::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    for (int32_t i = 1; U_SUCCESS(*status) && i < source->count; i++) {
+        // The data is sorted, so no string compares greater than the next one.
+        if (ucol_strcollUTF8(coll, source->dataOf(i - 1), source->lengthOf(i - 1),
+                             source->dataOf(i), source->lengthOf(i), status) == UCOL_GREATER) {
+            *status = U_INTERNAL_PROGRAM_ERROR;
+        }
+    }
+}
+
+long StrcollUTF8Adjacent::getOperationsPerIteration()
+{
+    return source->count > 0 ? source->count - 1 : 0;
+}
+
 //
 // Test case taking two test data arrays, calling ucol_strcoll for strings at a same index
 //
@@ -328,6 +373,93 @@ long GetSortKey::getOperationsPerIteration()
     return source->count;
 }
 
+//
+// Test case taking a single test data array, calling ucol_getSortKeys or ucol_getSortKeysUTF8
+// for batches of strings
+//
+#define SORT_KEYS_BATCH_SIZE 100
+
+class GetSortKeys : public UPerfFunction
+{
+public:
+    GetSortKeys(const UCollator* coll, const CA_uchar* source);
+    GetSortKeys(const UCollator* coll, const CA_char* source8);
+    ~GetSortKeys();
+    virtual void call(UErrorCode* status);
+    virtual long getOperationsPerIteration();
+
+private:
+    const UCollator *coll;
+    int32_t count;
+    const UChar **strings;
+    const char **strings8;
+    int32_t *lengths;
+    uint8_t *keys;
+};
+
+GetSortKeys::GetSortKeys(const UCollator* coll, const CA_uchar* source)
+    :   coll(coll),
+        count(source->count),
+        strings((const UChar **)malloc(sizeof(UChar *) * source->count)),
+        strings8(NULL),
+        lengths((int32_t *)malloc(sizeof(int32_t) * source->count)),
+        keys((uint8_t *)malloc(SORT_KEYS_BATCH_SIZE * KEY_BUF_SIZE))
+{
+    for (int32_t i = 0; i < count; i++) {
+        strings[i] = source->dataOf(i);
+        lengths[i] = source->lengthOf(i);
+    }
+}
+
+GetSortKeys::GetSortKeys(const UCollator* coll, const CA_char* source8)
+    :   coll(coll),
+        count(source8->count),
+        strings(NULL),
+        strings8((const char **)malloc(sizeof(char *) * source8->count)),
+        lengths((int32_t *)malloc(sizeof(int32_t) * source8->count)),
+        keys((uint8_t *)malloc(SORT_KEYS_BATCH_SIZE * KEY_BUF_SIZE))
+{
+    for (int32_t i = 0; i < count; i++) {
+        strings8[i] = source8->dataOf(i);
+        lengths[i] = source8->lengthOf(i);
+    }
+}
+
+GetSortKeys::~GetSortKeys()
+{
+    free(strings);
+    free(strings8);
+    free(lengths);
+    free(keys);
+}
+
+void GetSortKeys::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    int32_t offsets[SORT_KEYS_BATCH_SIZE + 1];
+
+    for (int32_t start = 0; start < count; start += SORT_KEYS_BATCH_SIZE) {
+        int32_t batchCount = count - start;
+        if (batchCount > SORT_KEYS_BATCH_SIZE) {
+            batchCount = SORT_KEYS_BATCH_SIZE;
+        }
+        UErrorCode errorCode = U_ZERO_ERROR;
+        if (strings != NULL) {
+            ucol_getSortKeys(coll, strings + start, lengths + start, batchCount,
+                             keys, SORT_KEYS_BATCH_SIZE * KEY_BUF_SIZE, offsets, &errorCode);
+        } else {
+            ucol_getSortKeysUTF8(coll, strings8 + start, lengths + start, batchCount,
+                                 keys, SORT_KEYS_BATCH_SIZE * KEY_BUF_SIZE, offsets, &errorCode);
+        }
+    }
+}
+
+long GetSortKeys::getOperationsPerIteration()
+{
+    return count;
+}
+
 //
 // Test case taking a single test data array in UTF-16, calling ucol_nextSortKeyPart for each for the
 // given buffer size
@@ -1090,9 +1222,12 @@ class CollPerf2Test : public UPerfTest
     UPerfFunction* TestStrcollUTF8();
     UPerfFunction* TestStrcollUTF8Null();
     UPerfFunction* TestStrcollUTF8Similar();
+    UPerfFunction* TestStrcollUTF8Adjacent();
 
     UPerfFunction* TestGetSortKey();
     UPerfFunction* TestGetSortKeyNull();
+    UPerfFunction* TestGetSortKeys();
+    UPerfFunction* TestGetSortKeysUTF8();
 
     UPerfFunction* TestNextSortKeyPart_4All();
     UPerfFunction* TestNextSortKeyPart_4x2();
@@ -1399,9 +1534,12 @@ CollPerf2Test::runIndexedTest(int32_t index, UBool exec, const char *&name, char
     TESTCASE_AUTO(TestStrcollUTF8);
     TESTCASE_AUTO(TestStrcollUTF8Null);
     TESTCASE_AUTO(TestStrcollUTF8Similar);
+    TESTCASE_AUTO(TestStrcollUTF8Adjacent);
 
     TESTCASE_AUTO(TestGetSortKey);
     TESTCASE_AUTO(TestGetSortKeyNull);
+    TESTCASE_AUTO(TestGetSortKeys);
+    TESTCASE_AUTO(TestGetSortKeysUTF8);
 
     TESTCASE_AUTO(TestNextSortKeyPart_4All);
     TESTCASE_AUTO(TestNextSortKeyPart_4x4);
@@ -1506,6 +1644,16 @@ UPerfFunction* CollPerf2Test::TestStrcollUTF8Similar()
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestStrcollUTF8Adjacent()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_char *source = getSortedData8(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new StrcollUTF8Adjacent(coll, source);
+}
+
 UPerfFunction* CollPerf2Test::TestGetSortKey()
 {
     UErrorCode status = U_ZERO_ERROR;
@@ -1528,6 +1676,26 @@ UPerfFunction* CollPerf2Test::TestGetSortKeyNull()
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestGetSortKeys()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *source = getData16(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new GetSortKeys(coll, source);
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeysUTF8()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_char *source = getData8(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new GetSortKeys(coll, source);
+}
+
 UPerfFunction* CollPerf2Test::TestNextSortKeyPart_4All()
 {
     UErrorCode status = U_ZERO_ERROR;
@@ -0,0 +1,631 @@
+/*
+ ***********************************************************************
+ * © 2026 and later: Unicode, Inc. and others.
+ * License & terms of use: http://www.unicode.org/copyright.html#License
+ ***********************************************************************
+ *  file name:  collperf3.cpp
+ *  encoding:   UTF-8
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  created on: 2026oct14
+ *
+ *  Collation benchmark over a matrix of locales and attribute settings.
+ *  For each locale, strength and alternate handling value, it times
+ *  string comparison, sort key generation, sorting and string search
+ *  over a corpus, with UTF-16 and UTF-8 input where the API supports both,
+ *  and writes the results as JSON for comparing ICU versions:
+ *  collperf3 --locales root,de --strengths tertiary --output results.json
+ *
+ *  Each locale uses a generated corpus from built-in words and phrases
+ *  unless --corpus-dir names a directory with a <locale>.txt file
+ *  (UTF-8, one string per line).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "unicode/utypes.h"
+#include "unicode/localpointer.h"
+#include "unicode/uchar.h"
+#include "unicode/ucol.h"
+#include "unicode/unistr.h"
+#include "unicode/usearch.h"
+#include "unicode/utimer.h"
+#include "unicode/uversion.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+using icu::UnicodeString;
+
+namespace {
+
+// Built-in corpora -------------------------------------------------------- ***
+
+// root
+const char16_t *const kRootWords[] = {
+    u"apple", u"Apple", u"apple pie", u"apple-pie", u"applesauce", u"co-op", u"coop",
+    u"cooperate", u"r\u00e9sum\u00e9", u"resume", u"R\u00e9sum\u00e9", u"na\u00efve", u"naive",
+    u"fa\u00e7ade", u"42", u"4.2", u"100", u"9", u"file_10", u"file_9", u"zebra", u"Zebra",
+    u"Z\u00fcrich", u"\u00e5ngstr\u00f6m", u"\u00c6r\u00f8", u"\u00fcber",
+    u"The Quick Brown Fox", u"the quick brown fox", u"email@example.com", u"\u00a35",
+    u"\u20ac10", u"#hashtag", u"@mention", u"O'Neil", u"ONeil", u"MacDonald", u"McDonald",
+    u"\u03a9-omega", u"alpha \u03b2", u"\u03c0 \u2248 3.14",
+    nullptr
+};
+
+// de
+const char16_t *const kGermanWords[] = {
+    u"\u00c4pfel", u"Apfel", u"B\u00e4cker", u"Backen", u"M\u00fcller", u"Mueller",
+    u"Stra\u00dfe", u"Strasse", u"\u00dcbung", u"Ufer", u"\u00d6l", u"Ofen",
+    u"gr\u00f6\u00dfer", u"Gr\u00f6\u00dfe", u"sch\u00f6n", u"Schon", u"Fu\u00dfball",
+    u"Fussball", u"K\u00e4se", u"Kasse", u"M\u00fcnchen", u"M\u00fcnze", u"\u00c4rger",
+    u"Arger", u"T\u00fcr", u"Tuer", u"gro\u00df", u"Gross", u"B\u00e4r", u"Bar", u"H\u00f6hle",
+    u"hohl", u"Zo\u00eb", u"Zoo", u"L\u00f6we", u"Lowe", u"Ma\u00df", u"Masse",
+    u"Schl\u00fcssel", u"Schluss",
+    nullptr
+};
+
+// ja
+const char16_t *const kJapaneseWords[] = {
+    u"\u3042\u3044", u"\u30a2\u30a4", u"\u3044\u306c", u"\u30a4\u30cc", u"\u304b\u304d",
+    u"\u304c\u304d", u"\u30ab\u30ad", u"\u304d\u3087\u3046", u"\u30ad\u30e7\u30a6",
+    u"\u6771\u4eac", u"\u4eac\u90fd", u"\u5927\u962a", u"\u65e5\u672c", u"\u65e5\u672c\u8a9e",
+    u"\u306b\u307b\u3093", u"\u30cb\u30db\u30f3", u"\u3055\u304f\u3089", u"\u30b5\u30af\u30e9",
+    u"\u685c", u"\u5c71", u"\u5ddd", u"\u3059\u3057", u"\u30b9\u30b7", u"\u5bff\u53f8",
+    u"\u30e9\u30fc\u30e1\u30f3", u"\u3089\u3042\u3081\u3093", u"\u30b3\u30fc\u30d2\u30fc",
+    u"\u3053\u3046\u3072\u3044", u"\u30c6\u30b9\u30c8", u"\u3066\u3059\u3068",
+    u"\uff76\uff80\uff76\uff85", u"\u30ab\u30bf\u30ab\u30ca", u"\u306f\u306f", u"\u3070\u3070",
+    u"\u3071\u3071", u"\u30d1\u30d1", u"\u30cf\u30cf", u"\u6771", u"\u897f", u"ABC",
+    nullptr
+};
+
+// zh-u-co-pinyin
+const char16_t *const kPinyinWords[] = {
+    u"\u4e2d\u56fd", u"\u4e2d\u6587", u"\u5317\u4eac", u"\u4e0a\u6d77", u"\u5e7f\u5dde",
+    u"\u6c49\u5b57", u"\u62fc\u97f3", u"\u4f60\u597d", u"\u8c22\u8c22", u"\u518d\u89c1",
+    u"\u5b66\u751f", u"\u8001\u5e08", u"\u670b\u53cb", u"\u7535\u8111", u"\u624b\u673a",
+    u"\u706b\u8f66", u"\u98de\u673a", u"\u82f9\u679c", u"\u9999\u8549", u"\u897f\u74dc",
+    u"\u957f\u57ce", u"\u957f\u6c5f", u"\u94f6\u884c", u"\u884c\u4eba", u"\u91cd\u5e86",
+    u"\u91cd\u8981", u"\u97f3\u4e50", u"\u5feb\u4e50", u"\u4eba\u6c11", u"\u4eba\u53e3",
+    u"\u963f\u59e8", u"\u7238\u7238", u"\u5988\u5988", u"\u54e5\u54e5", u"\u59d0\u59d0",
+    u"\u5f1f\u5f1f", u"\u59b9\u59b9", u"\u4e2d\u95f4", u"ABC", u"abc",
+    nullptr
+};
+
+// ar
+const char16_t *const kArabicWords[] = {
+    u"\u0643\u062a\u0627\u0628", u"\u0643\u062a\u0628", u"\u0645\u0643\u062a\u0628\u0629",
+    u"\u0643\u0627\u062a\u0628", u"\u0645\u062f\u0631\u0633\u0629", u"\u062f\u0631\u0633",
+    u"\u0645\u062f\u0631\u0633", u"\u0633\u0644\u0627\u0645",
+    u"\u0627\u0644\u0633\u0644\u0627\u0645", u"\u0628\u064a\u062a", u"\u0628\u0646\u062a",
+    u"\u0627\u0628\u0646", u"\u0623\u0628", u"\u0623\u0645", u"\u0625\u0633\u0644\u0627\u0645",
+    u"\u0639\u0631\u0628\u064a", u"\u0627\u0644\u0639\u0631\u0628\u064a\u0629",
+    u"\u0642\u0644\u0645", u"\u0645\u0627\u0621", u"\u0633\u0645\u0627\u0621",
+    u"\u0634\u0645\u0633", u"\u0642\u0645\u0631", u"\u0646\u062c\u0645", u"\u0628\u062d\u0631",
+    u"\u062c\u0628\u0644", u"\u0645\u062f\u064a\u0646\u0629", u"\u0642\u0631\u064a\u0629",
+    u"\u0634\u0627\u0631\u0639", u"\u0633\u064a\u0627\u0631\u0629",
+    u"\u0637\u0627\u0626\u0631\u0629", u"\u0643\u064e\u062a\u064e\u0628\u064e",
+    u"\u0643\u064f\u062a\u064f\u0628", u"\u0645\u064f\u062f\u064e\u0631\u0650\u0651\u0633",
+    u"\u0661\u0662\u0663", u"123", u"\u0622\u062e\u0631", u"\u0623\u062e\u0631\u0649",
+    u"\u0625\u0644\u0649", u"\u0639\u0644\u0649", u"\u0641\u064a",
+    nullptr
+};
+
+struct LocaleWords {
+    const char *locale;
+    const char16_t *const *words;
+    // Joins the words of a generated string.
+    const char16_t *separator;
+};
+
+const LocaleWords kLocaleWords[] = {
+    { "root", kRootWords, u" " },
+    { "de", kGermanWords, u" " },
+    { "ja", kJapaneseWords, u"" },
+    { "zh-u-co-pinyin", kPinyinWords, u"" },
+    { "ar", kArabicWords, u" " }
+};
+
+struct Corpus {
+    std::vector<UnicodeString> strings16;
+    std::vector<std::string> strings8;
+    // The strings separated by newlines, for string search.
+    UnicodeString text;
+
+    void add(const UnicodeString &s) {
+        strings16.push_back(s);
+        strings8.push_back(std::string());
+        s.toUTF8String(strings8.back());
+    }
+    int32_t count() const { return (int32_t)strings16.size(); }
+};
+
+// Combines one to three random words into each string, so that the corpus
+// has duplicates and shared prefixes like real data.
+// Unknown locales get the root words.
+void generateCorpus(const char *locale, int32_t count, Corpus &corpus) {
+    const LocaleWords *lw = &kLocaleWords[0];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(kLocaleWords); ++i) {
+        if (strcmp(locale, kLocaleWords[i].locale) == 0) {
+            lw = &kLocaleWords[i];
+            break;
+        }
+    }
+    int32_t numWords = 0;
+    while (lw->words[numWords] != nullptr) { ++numWords; }
+    uint32_t state = 0x12345;
+    for (int32_t i = 0; i < count; ++i) {
+        UnicodeString s;
+        state = state * 1103515245 + 12345;
+        int32_t length = 1 + (int32_t)((state >> 16) % 3);
+        for (int32_t j = 0; j < length; ++j) {
+            if (j > 0) { s.append(UnicodeString(lw->separator)); }
+            state = state * 1103515245 + 12345;
+            s.append(UnicodeString(lw->words[(state >> 16) % numWords]));
+        }
+        corpus.add(s);
+    }
+}
+
+// Reads the non-empty lines of a UTF-8 file.
+UBool readCorpus(const char *path, Corpus &corpus) {
+    FILE *f = fopen(path, "rb");
+    if (f == nullptr) { return FALSE; }
+    std::string contents;
+    char buffer[4096];
+    size_t length;
+    while ((length = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+        contents.append(buffer, length);
+    }
+    fclose(f);
+    size_t start = 0;
+    if (contents.compare(0, 3, "\xEF\xBB\xBF") == 0) { start = 3; }  // BOM
+    while (start < contents.length()) {
+        size_t limit = contents.find('\n', start);
+        if (limit == std::string::npos) { limit = contents.length(); }
+        size_t end = limit;
+        if (end > start && contents[end - 1] == '\r') { --end; }
+        if (end > start) {
+            corpus.add(UnicodeString::fromUTF8(
+                icu::StringPiece(contents.data() + start, (int32_t)(end - start))));
+        }
+        start = limit + 1;
+    }
+    return TRUE;
+}
+
+// Settings ---------------------------------------------------------------- ***
+
+struct NamedValue {
+    const char *name;
+    UColAttributeValue value;
+};
+
+const NamedValue kStrengths[] = {
+    { "primary", UCOL_PRIMARY },
+    { "secondary", UCOL_SECONDARY },
+    { "tertiary", UCOL_TERTIARY },
+    { "quaternary", UCOL_QUATERNARY },
+    { "identical", UCOL_IDENTICAL }
+};
+
+const NamedValue kAlternates[] = {
+    { "non-ignorable", UCOL_NON_IGNORABLE },
+    { "shifted", UCOL_SHIFTED }
+};
+
+const char *const kOperations[] = { "compare", "sortkey", "sort", "search" };
+const char *const kEncodings[] = { "UTF-16", "UTF-8" };
+
+// Splits a comma-separated option value.
+std::vector<std::string> splitList(const char *list) {
+    std::vector<std::string> items;
+    const char *p = list;
+    for (;;) {
+        const char *comma = strchr(p, ',');
+        size_t length = (comma != nullptr) ? (size_t)(comma - p) : strlen(p);
+        if (length > 0) { items.push_back(std::string(p, length)); }
+        if (comma == nullptr) { break; }
+        p = comma + 1;
+    }
+    return items;
+}
+
+// Returns the index of name in names[], or -1.
+int32_t findName(const char *name, const char *const names[], int32_t count) {
+    for (int32_t i = 0; i < count; ++i) {
+        if (strcmp(name, names[i]) == 0) { return i; }
+    }
+    return -1;
+}
+
+// Measurements ------------------------------------------------------------ ***
+
+struct Benchmark {
+    // Sort keys longer than this are truncated, which does not change the timing much.
+    static const int32_t kKeyCapacity = 1024;
+
+    const UCollator *coll;
+    const Corpus &corpus;
+    UStringSearch *search;
+    std::vector<int32_t> order;
+    uint8_t key[kKeyCapacity];
+
+    Benchmark(const UCollator *c, const Corpus &cp, UStringSearch *ss)
+            : coll(c), corpus(cp), search(ss) {}
+
+    // Each function runs one loop over the corpus and returns a checksum
+    // that depends on the results, so that the collation work is not optimized away.
+    // The checksums also differ if ICU versions order the corpus differently.
+
+    int64_t compare16() const {
+        int64_t sum = 0;
+        for (int32_t i = 1; i < corpus.count(); ++i) {
+            const UnicodeString &a = corpus.strings16[i - 1];
+            const UnicodeString &b = corpus.strings16[i];
+            sum += ucol_strcoll(coll, a.getBuffer(), a.length(), b.getBuffer(), b.length()) * i;
+        }
+        return sum;
+    }
+
+    int64_t compare8() const {
+        int64_t sum = 0;
+        UErrorCode errorCode = U_ZERO_ERROR;
+        for (int32_t i = 1; i < corpus.count(); ++i) {
+            const std::string &a = corpus.strings8[i - 1];
+            const std::string &b = corpus.strings8[i];
+            sum += ucol_strcollUTF8(coll, a.data(), (int32_t)a.length(),
+                                    b.data(), (int32_t)b.length(), &errorCode) * i;
+        }
+        return sum;
+    }
+
+    int64_t sortKey16() {
+        int64_t sum = 0;
+        for (int32_t i = 0; i < corpus.count(); ++i) {
+            const UnicodeString &s = corpus.strings16[i];
+            sum += ucol_getSortKey(coll, s.getBuffer(), s.length(), key, kKeyCapacity);
+        }
+        return sum;
+    }
+
+    int64_t sortKey8() {
+        int64_t sum = 0;
+        for (int32_t i = 0; i < corpus.count(); ++i) {
+            const std::string &s = corpus.strings8[i];
+            sum += ucol_getSortKeyUTF8(coll, s.data(), (int32_t)s.length(), key, kKeyCapacity);
+        }
+        return sum;
+    }
+
+    int64_t sort(UBool utf8) {
+        order.resize(corpus.count());
+        for (int32_t i = 0; i < corpus.count(); ++i) { order[i] = i; }
+        const UCollator *c = coll;
+        const Corpus &cp = corpus;
+        if (utf8) {
+            std::stable_sort(order.begin(), order.end(), [c, &cp](int32_t i, int32_t j) {
+                const std::string &a = cp.strings8[i];
+                const std::string &b = cp.strings8[j];
+                UErrorCode errorCode = U_ZERO_ERROR;
+                return ucol_strcollUTF8(c, a.data(), (int32_t)a.length(),
+                                        b.data(), (int32_t)b.length(), &errorCode) == UCOL_LESS;
+            });
+        } else {
+            std::stable_sort(order.begin(), order.end(), [c, &cp](int32_t i, int32_t j) {
+                const UnicodeString &a = cp.strings16[i];
+                const UnicodeString &b = cp.strings16[j];
+                return ucol_strcoll(c, a.getBuffer(), a.length(),
+                                    b.getBuffer(), b.length()) == UCOL_LESS;
+            });
+        }
+        int64_t sum = 0;
+        for (int32_t i = 0; i < corpus.count(); ++i) { sum += (int64_t)order[i] * (i + 1); }
+        return sum;
+    }
+
+    // Searches the whole corpus text for every tenth string of the corpus.
+    int64_t search16() {
+        int64_t matches = 0;
+        UErrorCode errorCode = U_ZERO_ERROR;
+        for (int32_t i = 0; i < getSearchPatternCount(); ++i) {
+            const UnicodeString &pattern = corpus.strings16[i * (corpus.count() / 10)];
+            usearch_setPattern(search, pattern.getBuffer(), pattern.length(), &errorCode);
+            for (int32_t m = usearch_first(search, &errorCode);
+                    m != USEARCH_DONE && U_SUCCESS(errorCode);
+                    m = usearch_next(search, &errorCode)) {
+                ++matches;
+            }
+        }
+        return U_SUCCESS(errorCode) ? matches : -1;
+    }
+
+    int32_t getSearchPatternCount() const { return corpus.count() >= 10 ? 10 : 0; }
+
+    int64_t run(int32_t operation, UBool utf8) {
+        switch (operation) {
+        case 0: return utf8 ? compare8() : compare16();
+        case 1: return utf8 ? sortKey8() : sortKey16();
+        case 2: return sort(utf8);
+        default: return search16();
+        }
+    }
+
+    int32_t getOperationsPerLoop(int32_t operation) const {
+        switch (operation) {
+        case 0: return corpus.count() - 1;  // comparisons of adjacent strings
+        case 1: return corpus.count();  // sort keys
+        case 2: return corpus.count();  // strings sorted
+        default: return getSearchPatternCount();  // patterns searched in the whole text
+        }
+    }
+};
+
+struct Timing {
+    int32_t loops;
+    double bestSeconds;  // per loop
+    double meanSeconds;  // per loop
+    int64_t checksum;
+};
+
+// Doubles the number of loops until one run takes at least minSeconds,
+// then times that many loops in each pass.
+Timing measure(Benchmark &b, int32_t operation, UBool utf8, double minSeconds, int32_t passes) {
+    Timing t = { 1, 0, 0, 0 };
+    t.checksum = b.run(operation, utf8);  // warm-up
+    UTimer start, stop;
+    for (;;) {
+        utimer_getTime(&start);
+        for (int32_t i = 0; i < t.loops; ++i) { b.run(operation, utf8); }
+        utimer_getTime(&stop);
+        if (utimer_getDeltaSeconds(&start, &stop) >= minSeconds || t.loops >= (1 << 24)) { break; }
+        t.loops *= 2;
+    }
+    double total = 0;
+    for (int32_t p = 0; p < passes; ++p) {
+        utimer_getTime(&start);
+        for (int32_t i = 0; i < t.loops; ++i) { b.run(operation, utf8); }
+        utimer_getTime(&stop);
+        double seconds = utimer_getDeltaSeconds(&start, &stop) / t.loops;
+        if (p == 0 || seconds < t.bestSeconds) { t.bestSeconds = seconds; }
+        total += seconds;
+    }
+    t.meanSeconds = total / passes;
+    return t;
+}
+
+// JSON output ------------------------------------------------------------- ***
+
+void printJSONString(FILE *out, const char *s) {
+    fputc('"', out);
+    for (; *s != 0; ++s) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            fprintf(out, "\\%c", c);
+        } else if (c < 0x20) {
+            fprintf(out, "\\u%04x", c);
+        } else {
+            fputc(c, out);
+        }
+    }
+    fputc('"', out);
+}
+
+void printVersion(FILE *out, const UVersionInfo version) {
+    char s[U_MAX_VERSION_STRING_LENGTH];
+    u_versionToString(version, s);
+    printJSONString(out, s);
+}
+
+UOption options[] = {
+    UOPTION_HELP_H,
+    UOPTION_DEF("locales", 'L', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("strengths", 's', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("alternates", 'a', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("operations", 'p', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("encodings", 'e', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("corpus-dir", 'd', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("strings", 'n', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("time", 't', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("passes", 'r', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("output", 'o', UOPT_REQUIRES_ARG)
+};
+
+enum {
+    OPT_HELP, OPT_LOCALES, OPT_STRENGTHS, OPT_ALTERNATES, OPT_OPERATIONS, OPT_ENCODINGS,
+    OPT_CORPUS_DIR, OPT_STRINGS, OPT_TIME, OPT_PASSES, OPT_OUTPUT
+};
+
+void printUsage(const char *program) {
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "Times collation operations for each combination of the settings\n"
+        "and writes the results as JSON.\n"
+        "  -L, --locales list     default: root,de,ja,zh-u-co-pinyin,ar\n"
+        "  -s, --strengths list   primary, secondary, tertiary, quaternary, identical\n"
+        "                         default: primary,tertiary,identical\n"
+        "  -a, --alternates list  non-ignorable, shifted; default: both\n"
+        "  -p, --operations list  compare, sortkey, sort, search; default: all\n"
+        "  -e, --encodings list   UTF-16, UTF-8; default: both (search is UTF-16 only)\n"
+        "  -d, --corpus-dir dir   read <locale>.txt corpora (UTF-8, one string per line)\n"
+        "                         instead of generating them from built-in words\n"
+        "  -n, --strings n        size of a generated corpus, default: 1000\n"
+        "  -t, --time seconds     minimum time for each measurement, default: 0.1\n"
+        "  -r, --passes n         timed passes per measurement, default: 3\n"
+        "  -o, --output file      default: standard output\n",
+        program);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    argc = u_parseArgs(argc, argv, UPRV_LENGTHOF(options), options);
+    if (argc != 1 || options[OPT_HELP].doesOccur) {
+        if (argc < 0) {
+            fprintf(stderr, "error in command line argument \"%s\"\n", argv[-argc]);
+        } else if (argc > 1) {
+            fprintf(stderr, "unexpected command line argument \"%s\"\n", argv[1]);
+        }
+        printUsage(argv[0]);
+        return options[OPT_HELP].doesOccur ? 0 : U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    std::vector<std::string> locales = splitList(options[OPT_LOCALES].doesOccur ?
+        options[OPT_LOCALES].value : "root,de,ja,zh-u-co-pinyin,ar");
+    std::vector<std::string> strengthNames = splitList(options[OPT_STRENGTHS].doesOccur ?
+        options[OPT_STRENGTHS].value : "primary,tertiary,identical");
+    std::vector<std::string> alternateNames = splitList(options[OPT_ALTERNATES].doesOccur ?
+        options[OPT_ALTERNATES].value : "non-ignorable,shifted");
+    std::vector<std::string> operationNames = splitList(options[OPT_OPERATIONS].doesOccur ?
+        options[OPT_OPERATIONS].value : "compare,sortkey,sort,search");
+    std::vector<std::string> encodingNames = splitList(options[OPT_ENCODINGS].doesOccur ?
+        options[OPT_ENCODINGS].value : "UTF-16,UTF-8");
+    int32_t numStrings = options[OPT_STRINGS].doesOccur ? atoi(options[OPT_STRINGS].value) : 1000;
+    double minSeconds = options[OPT_TIME].doesOccur ? atof(options[OPT_TIME].value) : 0.1;
+    int32_t passes = options[OPT_PASSES].doesOccur ? atoi(options[OPT_PASSES].value) : 3;
+    if (numStrings < 2 || passes < 1) {
+        printUsage(argv[0]);
+        return U_ILLEGAL_ARGUMENT_ERROR;
+    }
+
+    std::vector<const NamedValue *> strengths, alternates;
+    std::vector<int32_t> operations, encodings;
+    for (const std::string &name : strengthNames) {
+        const NamedValue *nv = nullptr;
+        for (const NamedValue &s : kStrengths) {
+            if (name == s.name) { nv = &s; }
+        }
+        if (nv == nullptr) {
+            fprintf(stderr, "unknown strength \"%s\"\n", name.c_str());
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        strengths.push_back(nv);
+    }
+    for (const std::string &name : alternateNames) {
+        const NamedValue *nv = nullptr;
+        for (const NamedValue &a : kAlternates) {
+            if (name == a.name) { nv = &a; }
+        }
+        if (nv == nullptr) {
+            fprintf(stderr, "unknown alternate handling \"%s\"\n", name.c_str());
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        alternates.push_back(nv);
+    }
+    for (const std::string &name : operationNames) {
+        int32_t op = findName(name.c_str(), kOperations, UPRV_LENGTHOF(kOperations));
+        if (op < 0) {
+            fprintf(stderr, "unknown operation \"%s\"\n", name.c_str());
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        operations.push_back(op);
+    }
+    for (const std::string &name : encodingNames) {
+        int32_t enc = findName(name.c_str(), kEncodings, UPRV_LENGTHOF(kEncodings));
+        if (enc < 0) {
+            fprintf(stderr, "unknown encoding \"%s\"\n", name.c_str());
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        encodings.push_back(enc);
+    }
+
+    FILE *out = stdout;
+    if (options[OPT_OUTPUT].doesOccur) {
+        out = fopen(options[OPT_OUTPUT].value, "w");
+        if (out == nullptr) {
+            fprintf(stderr, "unable to open \"%s\" for writing\n", options[OPT_OUTPUT].value);
+            return U_FILE_ACCESS_ERROR;
+        }
+    }
+
+    UVersionInfo version;
+    fprintf(out, "{\n  \"icuVersion\": ");
+    u_getVersion(version);
+    printVersion(out, version);
+    fprintf(out, ",\n  \"unicodeVersion\": ");
+    u_getUnicodeVersion(version);
+    printVersion(out, version);
+    fprintf(out, ",\n  \"minSeconds\": %g,\n  \"passes\": %d,\n  \"results\": [",
+            minSeconds, (int)passes);
+
+    int exitCode = 0;
+    const char *separator = "\n";
+    for (const std::string &locale : locales) {
+        Corpus corpus;
+        if (options[OPT_CORPUS_DIR].doesOccur) {
+            std::string path(options[OPT_CORPUS_DIR].value);
+            path.append("/").append(locale).append(".txt");
+            if (!readCorpus(path.c_str(), corpus) || corpus.count() < 2) {
+                fprintf(stderr, "unable to read a corpus from \"%s\"\n", path.c_str());
+                exitCode = U_FILE_ACCESS_ERROR;
+                continue;
+            }
+        } else {
+            generateCorpus(locale.c_str(), numStrings, corpus);
+        }
+        for (int32_t i = 0; i < corpus.count(); ++i) {
+            if (i > 0) { corpus.text.append((UChar)0xa); }
+            corpus.text.append(corpus.strings16[i]);
+        }
+
+        UErrorCode errorCode = U_ZERO_ERROR;
+        icu::LocalUCollatorPointer coll(ucol_open(locale.c_str(), &errorCode));
+        if (U_FAILURE(errorCode)) {
+            fprintf(stderr, "ucol_open(%s) failed: %s\n", locale.c_str(), u_errorName(errorCode));
+            exitCode = errorCode;
+            continue;
+        }
+        UVersionInfo collVersion;
+        ucol_getVersion(coll.getAlias(), collVersion);
+
+        for (const NamedValue *strength : strengths) {
+            for (const NamedValue *alternate : alternates) {
+                ucol_setStrength(coll.getAlias(), strength->value);
+                ucol_setAttribute(coll.getAlias(), UCOL_ALTERNATE_HANDLING,
+                                  alternate->value, &errorCode);
+                // The string search caches the collator settings when it is opened.
+                icu::LocalUStringSearchPointer search(usearch_openFromCollator(
+                    corpus.strings16[0].getBuffer(), corpus.strings16[0].length(),
+                    corpus.text.getBuffer(), corpus.text.length(),
+                    coll.getAlias(), nullptr, &errorCode));
+                if (U_FAILURE(errorCode)) {
+                    fprintf(stderr, "setting up %s/%s/%s failed: %s\n", locale.c_str(),
+                            strength->name, alternate->name, u_errorName(errorCode));
+                    return errorCode;
+                }
+                Benchmark b(coll.getAlias(), corpus, search.getAlias());
+                for (int32_t op : operations) {
+                    for (int32_t enc : encodings) {
+                        UBool utf8 = enc == 1;
+                        if (op == 3 && utf8) { continue; }  // usearch_*() is UTF-16 only
+                        if (b.getOperationsPerLoop(op) == 0) { continue; }
+                        Timing t = measure(b, op, utf8, minSeconds, passes);
+                        double nsPerLoop = 1e9 / b.getOperationsPerLoop(op);
+                        fprintf(out, "%s    {\"locale\": ", separator);
+                        printJSONString(out, locale.c_str());
+                        fprintf(out, ", \"collatorVersion\": ");
+                        printVersion(out, collVersion);
+                        fprintf(out, ", \"strength\": \"%s\", \"alternate\": \"%s\",\n"
+                                "     \"operation\": \"%s\", \"encoding\": \"%s\", "
+                                "\"strings\": %d, \"operations\": %d, \"loops\": %d,\n"
+                                "     \"nsPerOperation\": %.2f, \"meanNsPerOperation\": %.2f, "
+                                "\"checksum\": %lld}",
+                                strength->name, alternate->name,
+                                kOperations[op], kEncodings[enc],
+                                (int)corpus.count(), (int)b.getOperationsPerLoop(op),
+                                (int)t.loops, t.bestSeconds * nsPerLoop,
+                                t.meanSeconds * nsPerLoop, (long long)t.checksum);
+                        fflush(out);
+                        separator = ",\n";
+                    }
+                }
+            }
+        }
+    }
+    fprintf(out, "\n  ]\n}\n");
+    if (out != stdout) { fclose(out); }
+    return exitCode;
+}
@@ -116,6 +116,26 @@ UPerfFunction* ConverterPerformanceTest::runIndexedTest(int32_t index, UBool exe
         TESTCASE(52,TestWinANSI_ISO2022JP_ToUnicode);
         TESTCASE(53,TestWinANSI_ISO2022JP_FromUnicode);
 
+        TESTCASE(54,TestICU_UTF8_MostlyASCII_ToUnicode);
+
+        TESTCASE(55,TestICU_ISO2022JP_MostlyASCII_ToUnicode);
+        TESTCASE(56,TestICU_ISO2022JP_MostlyASCII_FromUnicode);
+        TESTCASE(57,TestICU_ISO2022KR_MostlyASCII_ToUnicode);
+        TESTCASE(58,TestICU_ISO2022KR_MostlyASCII_FromUnicode);
+        TESTCASE(59,TestICU_ISO2022CN_MostlyASCII_ToUnicode);
+        TESTCASE(60,TestICU_ISO2022CN_MostlyASCII_FromUnicode);
+        TESTCASE(61,TestICU_HZ_MostlyASCII_ToUnicode);
+        TESTCASE(62,TestICU_HZ_MostlyASCII_FromUnicode);
+
+        TESTCASE(63,TestICU_SCSU_Cyrillic_ToUnicode);
+        TESTCASE(64,TestICU_SCSU_Cyrillic_FromUnicode);
+        TESTCASE(65,TestICU_SCSU_Han_ToUnicode);
+        TESTCASE(66,TestICU_SCSU_Han_FromUnicode);
+        TESTCASE(67,TestICU_BOCU1_Cyrillic_ToUnicode);
+        TESTCASE(68,TestICU_BOCU1_Cyrillic_FromUnicode);
+        TESTCASE(69,TestICU_BOCU1_Han_ToUnicode);
+        TESTCASE(70,TestICU_BOCU1_Han_FromUnicode);
+
         default: 
             name = ""; 
             return NULL;
@@ -161,6 +181,15 @@ UPerfFunction*  ConverterPerformanceTest::TestICU_UTF8_ToUnicode(){
 }
 
 
+UPerfFunction*  ConverterPerformanceTest::TestICU_UTF8_MostlyASCII_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("utf-8",utf8_mostlyASCIISource, (int32_t)(sizeof(utf8_mostlyASCIISource)-1), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
 UPerfFunction* ConverterPerformanceTest::TestWinIML2_UTF8_FromUnicode(){
     UErrorCode status = U_ZERO_ERROR;
     UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("utf-8",utf8_uniSource, UPRV_LENGTHOF(utf8_uniSource), status);
@@ -657,3 +686,126 @@ UPerfFunction*  ConverterPerformanceTest::TestWinANSI_ISO2022JP_ToUnicode(){
     }
     return pf;
 }
+
+//#################
+
+/*
+ * Converts the Unicode source with the named converter into buffer,
+ * for the ToUnicode tests of converters that have no precomputed
+ * encoded source in data.h.
+ */
+static UPerfFunction* createToUnicode(const char* name, const UChar* source, int32_t sourceLength,
+                                      char* buffer, int32_t capacity){
+    UErrorCode status = U_ZERO_ERROR;
+    UConverter* cnv = ucnv_open(name, &status);
+    int32_t length = ucnv_fromUChars(cnv, buffer, capacity, source, sourceLength, &status);
+    ucnv_close(cnv);
+    UPerfFunction* pf = new ICUToUnicodePerfFunction(name, buffer, length, status);
+    if(U_FAILURE(status)){
+        delete pf;
+        return NULL;
+    }
+    return pf;
+}
+
+static UPerfFunction* createFromUnicode(const char* name, const UChar* source, int32_t sourceLength){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUFromUnicodePerfFunction(name, source, sourceLength, status);
+    if(U_FAILURE(status)){
+        delete pf;
+        return NULL;
+    }
+    return pf;
+}
+
+/*
+ * Converts iso2022_mostlyASCIIUniSource with the named converter,
+ * for the ToUnicode tests of the stateful converters.
+ */
+static UPerfFunction* createMostlyASCIIToUnicode(const char* name, char* buffer, int32_t capacity){
+    return createToUnicode(name, iso2022_mostlyASCIIUniSource, UPRV_LENGTHOF(iso2022_mostlyASCIIUniSource)-1,
+                           buffer, capacity);
+}
+
+static UPerfFunction* createMostlyASCIIFromUnicode(const char* name){
+    return createFromUnicode(name, iso2022_mostlyASCIIUniSource, UPRV_LENGTHOF(iso2022_mostlyASCIIUniSource)-1);
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022JP_MostlyASCII_ToUnicode(){
+    static char buffer[MAX_BUF_SIZE];
+    return createMostlyASCIIToUnicode("iso-2022-jp", buffer, UPRV_LENGTHOF(buffer));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022JP_MostlyASCII_FromUnicode(){
+    return createMostlyASCIIFromUnicode("iso-2022-jp");
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022KR_MostlyASCII_ToUnicode(){
+    static char buffer[MAX_BUF_SIZE];
+    return createMostlyASCIIToUnicode("iso-2022-kr", buffer, UPRV_LENGTHOF(buffer));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022KR_MostlyASCII_FromUnicode(){
+    return createMostlyASCIIFromUnicode("iso-2022-kr");
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022CN_MostlyASCII_ToUnicode(){
+    static char buffer[MAX_BUF_SIZE];
+    return createMostlyASCIIToUnicode("iso-2022-cn", buffer, UPRV_LENGTHOF(buffer));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022CN_MostlyASCII_FromUnicode(){
+    return createMostlyASCIIFromUnicode("iso-2022-cn");
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_HZ_MostlyASCII_ToUnicode(){
+    static char buffer[MAX_BUF_SIZE];
+    return createMostlyASCIIToUnicode("hz", buffer, UPRV_LENGTHOF(buffer));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_HZ_MostlyASCII_FromUnicode(){
+    return createMostlyASCIIFromUnicode("hz");
+}
+
+//#################
+
+/*
+ * SCSU and BOCU-1 over a small alphabet (Cyrillic, one dynamic window)
+ * and over Han (uncompressible in SCSU, 2-byte differences in BOCU-1).
+ */
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Cyrillic_ToUnicode(){
+    static char buffer[MAX_BUF_SIZE*2];
+    return createToUnicode("SCSU", latin5_uniSource, UPRV_LENGTHOF(latin5_uniSource), buffer, UPRV_LENGTHOF(buffer));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Cyrillic_FromUnicode(){
+    return createFromUnicode("SCSU", latin5_uniSource, UPRV_LENGTHOF(latin5_uniSource));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Han_ToUnicode(){
+    static char buffer[MAX_BUF_SIZE*2];
+    return createToUnicode("SCSU", gb2312_uniSource, UPRV_LENGTHOF(gb2312_uniSource), buffer, UPRV_LENGTHOF(buffer));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Han_FromUnicode(){
+    return createFromUnicode("SCSU", gb2312_uniSource, UPRV_LENGTHOF(gb2312_uniSource));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Cyrillic_ToUnicode(){
+    static char buffer[MAX_BUF_SIZE*2];
+    return createToUnicode("BOCU-1", latin5_uniSource, UPRV_LENGTHOF(latin5_uniSource), buffer, UPRV_LENGTHOF(buffer));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Cyrillic_FromUnicode(){
+    return createFromUnicode("BOCU-1", latin5_uniSource, UPRV_LENGTHOF(latin5_uniSource));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Han_ToUnicode(){
+    static char buffer[MAX_BUF_SIZE*2];
+    return createToUnicode("BOCU-1", gb2312_uniSource, UPRV_LENGTHOF(gb2312_uniSource), buffer, UPRV_LENGTHOF(buffer));
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Han_FromUnicode(){
+    return createFromUnicode("BOCU-1", gb2312_uniSource, UPRV_LENGTHOF(gb2312_uniSource));
+}
@@ -507,6 +507,7 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinANSI_UTF8_FromUnicode();
     UPerfFunction* TestWinIML2_UTF8_ToUnicode();
     UPerfFunction* TestWinIML2_UTF8_FromUnicode();
+    UPerfFunction* TestICU_UTF8_MostlyASCII_ToUnicode();
         
     UPerfFunction* TestICU_Latin1_ToUnicode();
     UPerfFunction* TestICU_Latin1_FromUnicode();
@@ -566,6 +567,24 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinIML2_ISO2022JP_ToUnicode();
     UPerfFunction* TestWinIML2_ISO2022JP_FromUnicode(); 
 
+    UPerfFunction* TestICU_ISO2022JP_MostlyASCII_ToUnicode();
+    UPerfFunction* TestICU_ISO2022JP_MostlyASCII_FromUnicode();
+    UPerfFunction* TestICU_ISO2022KR_MostlyASCII_ToUnicode();
+    UPerfFunction* TestICU_ISO2022KR_MostlyASCII_FromUnicode();
+    UPerfFunction* TestICU_ISO2022CN_MostlyASCII_ToUnicode();
+    UPerfFunction* TestICU_ISO2022CN_MostlyASCII_FromUnicode();
+    UPerfFunction* TestICU_HZ_MostlyASCII_ToUnicode();
+    UPerfFunction* TestICU_HZ_MostlyASCII_FromUnicode();
+
+    UPerfFunction* TestICU_SCSU_Cyrillic_ToUnicode();
+    UPerfFunction* TestICU_SCSU_Cyrillic_FromUnicode();
+    UPerfFunction* TestICU_SCSU_Han_ToUnicode();
+    UPerfFunction* TestICU_SCSU_Han_FromUnicode();
+    UPerfFunction* TestICU_BOCU1_Cyrillic_ToUnicode();
+    UPerfFunction* TestICU_BOCU1_Cyrillic_FromUnicode();
+    UPerfFunction* TestICU_BOCU1_Han_ToUnicode();
+    UPerfFunction* TestICU_BOCU1_Han_FromUnicode();
+
 };
 
 #endif
@@ -2731,5 +2731,47 @@ unsigned char utf8_encSmSource[]={
     0xE3,0x80,0x80,0xE3,0x80,0x81,0xE3,0x80,0x82,0x20,0xEF,0xBC,0x8E,0xE3,0x83,0xBB,
     0xEF,0xBC,0x9A,0xEF,0xBC,0x9B,0x0D,0x0A
 };
+/* Mostly-ASCII web payload with occasional non-ASCII characters. */
+char utf8_mostlyASCIISource[]=
+    "<!DOCTYPE html>\r\n<html lang=\"en\">\r\n<head>\r\n"
+    "<meta charset=\"utf-8\">\r\n<title>Caf\xC3\xA9 menu \xE2\x80\x93 daily specials</title>\r\n"
+    "<link rel=\"stylesheet\" href=\"/static/css/main.css?v=20181003\">\r\n"
+    "<script type=\"text/javascript\" src=\"/static/js/app.bundle.min.js\"></script>\r\n"
+    "</head>\r\n<body class=\"page page-menu\">\r\n"
+    "<div id=\"header\"><a href=\"/\" title=\"Home\">Home</a> | <a href=\"/menu\">Menu</a> | "
+    "<a href=\"/contact\">Contact</a></div>\r\n"
+    "<p>Welcome to our caf\xC3\xA9! Today we serve cr\xC3\xA8me br\xC3\xBBl\xC3\xA9" "e, "
+    "Spaghetti alla carbonara and a selection of fresh juices.</p>\r\n"
+    "<ul class=\"items\">\r\n<li data-id=\"1001\">Espresso &mdash; 2.50 \xE2\x82\xAC</li>\r\n"
+    "<li data-id=\"1002\">Cappuccino &mdash; 3.20 \xE2\x82\xAC</li>\r\n"
+    "<li data-id=\"1003\">Latte macchiato &mdash; 3.60 \xE2\x82\xAC</li>\r\n"
+    "<li data-id=\"1004\">Green tea (\xE7\xB7\x91\xE8\x8C\xB6) &mdash; 2.80 \xE2\x82\xAC</li>\r\n</ul>\r\n"
+    "<p>Opening hours: Monday to Friday 07:00-19:00, Saturday 08:00-16:00. "
+    "Closed on Sundays and public holidays. Free wireless internet access for all guests; "
+    "ask the staff for the password. We accept all major credit cards.</p>\r\n"
+    "<div id=\"footer\">Copyright 2018 Example Restaurant Group. All rights reserved. "
+    "<a href=\"/privacy\">Privacy policy</a> | <a href=\"/imprint\">Imprint</a></div>\r\n"
+    "</body>\r\n</html>\r\n";
+/* Mostly-ASCII mail text with short CJK segments, for the stateful CJK converters. */
+const UChar iso2022_mostlyASCIIUniSource[]=
+    u"From: support@example.com\r\nTo: customers@example.com\r\n"
+    u"Subject: Release notes for version 4.2 (\u65E5\u672C / \u4E2D\u6587)\r\n"
+    u"Content-Type: text/plain\r\n\r\n"
+    u"Dear customer,\r\n\r\n"
+    u"version 4.2 of our document viewer is now available for download. "
+    u"This release improves the rendering of long tables and fixes several problems "
+    u"with printing on network printers. The user interface is now also available in "
+    u"\u65E5\u672C\u8A9E and \u4E2D\u6587, and the installer detects the language "
+    u"of the operating system.\r\n\r\n"
+    u"Changes in this release:\r\n"
+    u" - Faster startup when many documents are open at the same time.\r\n"
+    u" - Search results are highlighted in all pages, not only in the current one.\r\n"
+    u" - Bookmarks can be exported to and imported from plain text files.\r\n"
+    u" - Fixed a crash when a font could not be loaded (\u6587\u5B57).\r\n"
+    u" - Fixed the page numbering of documents with more than 9999 pages.\r\n\r\n"
+    u"To update, open the Help menu and select Check for Updates, or download the "
+    u"installer from https://www.example.com/downloads/viewer-4.2.0.exe and run it. "
+    u"Your settings and bookmarks are kept.\r\n\r\n"
+    u"Best regards,\r\nThe Example Software Team (\u5927\u962A / \u4E0A\u6D77)\r\n";
 #endif
 
@@ -36,6 +36,7 @@
 #include "unicode/uperf.h"
 #include "unicode/utext.h"
 #include "charstr.h"
+#include "dictionarydata.h"
 #include "package.h"
 #include "toolutil.h"
 #include "ucbuf.h"  // struct ULine
@@ -418,7 +419,6 @@ class UCharsTrieDictLookup : public DictLookup {
             }
             builder->add(UnicodeString(FALSE, lines[i].name, lines[i].len), 0, errorCode);
         }
-        UnicodeString trieUChars;
         int32_t length=builder->buildUnicodeString(USTRINGTRIE_BUILD_SMALL, trieUChars, errorCode).length();
         printf("size of UCharsTrie:          %6ld bytes\n", (long)length*2);
         trie=builder->build(USTRINGTRIE_BUILD_SMALL, errorCode);
@@ -432,6 +432,7 @@ class UCharsTrieDictLookup : public DictLookup {
 protected:
     UCharsTrieBuilder *builder;
     UCharsTrie *trie;
+    UnicodeString trieUChars;
 };
 
 class UCharsTrieDictMatches : public UCharsTrieDictLookup {
@@ -480,6 +481,36 @@ class UCharsTrieDictContains : public UCharsTrieDictLookup {
     }
 };
 
+// Calls the dictionary break engines' UCharsDictionaryMatcher::matches()
+// for each word, reading it through a UText like the engines do.
+class UCharsDictMatcherMatches : public UCharsTrieDictLookup {
+public:
+    UCharsDictMatcherMatches(const DictionaryTriePerfTest &perfTest)
+            : UCharsTrieDictLookup(perfTest), matcher(trieUChars.getBuffer(), NULL) {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        UText text=UTEXT_INITIALIZER;
+        int32_t lengths[20];
+        const ULine *lines=perf.getCachedLines();
+        int32_t numLines=perf.getNumLines();
+        for(int32_t i=0; i<numLines; ++i) {
+            // Skip comment lines (start with a character below 'A').
+            if(lines[i].name[0]<0x41) {
+                continue;
+            }
+            utext_openUChars(&text, lines[i].name, lines[i].len, pErrorCode);
+            int32_t count=matcher.matches(&text, lines[i].len, UPRV_LENGTHOF(lengths),
+                                          lengths, NULL, NULL, NULL);
+            if(count==0 || lengths[count-1]!=lines[i].len) {
+                fprintf(stderr, "word %ld (0-based) not found\n", (long)i);
+            }
+        }
+    }
+
+private:
+    UCharsDictionaryMatcher matcher;
+};
+
 static inline int32_t thaiCharToByte(UChar32 c) {
     if(0xe00<=c && c<=0xefe) {
         return c&0xff;
@@ -527,7 +558,8 @@ class BytesTrieDictLookup : public DictLookup {
             builder->add(str.toStringPiece(), 0, errorCode);
         }
         if(!noDict) {
-            int32_t length=builder->buildStringPiece(USTRINGTRIE_BUILD_SMALL, errorCode).length();
+            trieBytes=builder->buildStringPiece(USTRINGTRIE_BUILD_SMALL, errorCode);
+            int32_t length=trieBytes.length();
             printf("size of BytesTrie:           %6ld bytes\n", (long)length);
             trie=builder->build(USTRINGTRIE_BUILD_SMALL, errorCode);
         }
@@ -541,6 +573,7 @@ class BytesTrieDictLookup : public DictLookup {
 protected:
     BytesTrieBuilder *builder;
     BytesTrie *trie;
+    StringPiece trieBytes;  // owned by the builder
     UBool noDict;
 };
 
@@ -642,6 +675,40 @@ class BytesTrieDictContains : public BytesTrieDictLookup {
     }
 };
 
+// Same as UCharsDictMatcherMatches but with the BytesDictionaryMatcher,
+// which maps Thai characters to bytes like thaiCharToByte().
+class BytesDictMatcherMatches : public BytesTrieDictLookup {
+public:
+    BytesDictMatcherMatches(const DictionaryTriePerfTest &perfTest)
+            : BytesTrieDictLookup(perfTest),
+              matcher(trieBytes.data(), DictionaryData::TRANSFORM_TYPE_OFFSET|0xe00, NULL) {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        if(noDict) {
+            return;
+        }
+        UText text=UTEXT_INITIALIZER;
+        int32_t lengths[20];
+        const ULine *lines=perf.getCachedLines();
+        int32_t numLines=perf.getNumLines();
+        for(int32_t i=0; i<numLines; ++i) {
+            // Skip comment lines (start with a character below 'A').
+            if(lines[i].name[0]<0x41) {
+                continue;
+            }
+            utext_openUChars(&text, lines[i].name, lines[i].len, pErrorCode);
+            int32_t count=matcher.matches(&text, lines[i].len, UPRV_LENGTHOF(lengths),
+                                          lengths, NULL, NULL, NULL);
+            if(count==0 || lengths[count-1]!=lines[i].len) {
+                fprintf(stderr, "word %ld (0-based) not found\n", (long)i);
+            }
+        }
+    }
+
+private:
+    BytesDictionaryMatcher matcher;
+};
+
 UPerfFunction *DictionaryTriePerfTest::runIndexedTest(int32_t index, UBool exec,
                                                       const char *&name, char * /*par*/) {
     if(hasFile()) {
@@ -670,6 +737,18 @@ UPerfFunction *DictionaryTriePerfTest::runIndexedTest(int32_t index, UBool exec,
                 return new BytesTrieDictContains(*this);
             }
             break;
+        case 4:
+            name="ucharsdictmatcher";
+            if(exec) {
+                return new UCharsDictMatcherMatches(*this);
+            }
+            break;
+        case 5:
+            name="bytesdictmatcher";
+            if(exec) {
+                return new BytesDictMatcherMatches(*this);
+            }
+            break;
         default:
             name="";
             break;
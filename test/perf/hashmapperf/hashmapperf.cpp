@@ -0,0 +1,243 @@
+/*
+ ***********************************************************************
+ * © 2026 and later: Unicode, Inc. and others.
+ * License & terms of use: http://www.unicode.org/copyright.html#License
+ ***********************************************************************
+ *  file name:  hashmapperf.cpp
+ *  encoding:   UTF-8
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  created on: 2026oct14
+ *
+ *  Performance test program comparing UHashtable with OpenHashMap.
+ *
+ *  Each iteration looks up a set of integer or string keys,
+ *  half of which are in the table, or adds and removes all of them:
+ *  hashmapperf UHashFindInt OHashFindInt --passes 3 --iterations 1000
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "unicode/unistr.h"
+#include "unicode/uperf.h"
+#include "ohashmap.h"
+#include "uhash.h"
+
+namespace {
+
+struct IntTraits {
+    static int32_t hash(const int32_t &key) { return key; }
+    static UBool equals(const int32_t &key1, const int32_t &key2) { return key1 == key2; }
+};
+
+struct StringTraits {
+    static int32_t hash(const icu::UnicodeString *key) { return key->hashCode(); }
+    static UBool equals(const icu::UnicodeString *key1, const icu::UnicodeString *key2) {
+        return *key1 == *key2;
+    }
+};
+
+typedef icu::OpenHashMap<int32_t, int32_t, IntTraits> IntMap;
+typedef icu::OpenHashMap<const icu::UnicodeString *, int32_t, StringTraits> StringMap;
+
+}  // namespace
+
+// Test object.
+class HashMapPerfTest : public UPerfTest {
+public:
+    HashMapPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, NULL, 0, "", status) {
+        // Keys with even indexes are added to the tables, the others are misses.
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for (int32_t i = 0; i < kCount; ++i) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            integers[i] = (int32_t)(state >> 33);
+            char buffer[32];
+            sprintf(buffer, "key/%d/%x", (int)i, (unsigned)integers[i]);
+            strings[i] = icu::UnicodeString(buffer, -1, US_INV);
+        }
+    }
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    static constexpr int32_t kCount = 2000;
+    int32_t integers[kCount];
+    icu::UnicodeString strings[kCount];
+};
+
+// Performance test function object.
+class Command : public UPerfFunction {
+protected:
+    Command(const HashMapPerfTest &testcase) : testcase(testcase) {}
+
+public:
+    virtual ~Command() {}
+
+    virtual long getOperationsPerIteration() {
+        // Number of keys looked up, or added and removed.
+        return HashMapPerfTest::kCount;
+    }
+
+    const HashMapPerfTest &testcase;
+    int64_t found = 0;
+};
+
+class UHashFindInt : public Command {
+protected:
+    UHashFindInt(const HashMapPerfTest &testcase, UErrorCode &status) : Command(testcase) {
+        table = uhash_open(uhash_hashLong, uhash_compareLong, NULL, &status);
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; i += 2) {
+            uhash_iputi(table, testcase.integers[i], i + 1, &status);
+        }
+    }
+public:
+    virtual ~UHashFindInt() { uhash_close(table); }
+    static UPerfFunction* get(const HashMapPerfTest &testcase, UErrorCode &status) {
+        return new UHashFindInt(testcase, status);
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; ++i) {
+            found += uhash_igeti(table, testcase.integers[i]);
+        }
+    }
+    UHashtable *table;
+};
+
+class OHashFindInt : public Command {
+protected:
+    OHashFindInt(const HashMapPerfTest &testcase, UErrorCode &status) : Command(testcase) {
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; i += 2) {
+            map.put(testcase.integers[i], i + 1, status);
+        }
+    }
+public:
+    static UPerfFunction* get(const HashMapPerfTest &testcase, UErrorCode &status) {
+        return new OHashFindInt(testcase, status);
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; ++i) {
+            found += map.get(testcase.integers[i]);
+        }
+    }
+    IntMap map;
+};
+
+class UHashFindString : public Command {
+protected:
+    UHashFindString(const HashMapPerfTest &testcase, UErrorCode &status) : Command(testcase) {
+        table = uhash_open(uhash_hashUnicodeString, uhash_compareUnicodeString, NULL, &status);
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; i += 2) {
+            uhash_puti(table, (void *)&testcase.strings[i], i + 1, &status);
+        }
+    }
+public:
+    virtual ~UHashFindString() { uhash_close(table); }
+    static UPerfFunction* get(const HashMapPerfTest &testcase, UErrorCode &status) {
+        return new UHashFindString(testcase, status);
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; ++i) {
+            found += uhash_geti(table, &testcase.strings[i]);
+        }
+    }
+    UHashtable *table;
+};
+
+class OHashFindString : public Command {
+protected:
+    OHashFindString(const HashMapPerfTest &testcase, UErrorCode &status) : Command(testcase) {
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; i += 2) {
+            map.put(&testcase.strings[i], i + 1, status);
+        }
+    }
+public:
+    static UPerfFunction* get(const HashMapPerfTest &testcase, UErrorCode &status) {
+        return new OHashFindString(testcase, status);
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; ++i) {
+            found += map.get(&testcase.strings[i]);
+        }
+    }
+    StringMap map;
+};
+
+// Adds all keys to a table, then removes them.
+class UHashPutRemove : public Command {
+protected:
+    UHashPutRemove(const HashMapPerfTest &testcase, UErrorCode &status) : Command(testcase) {
+        table = uhash_open(uhash_hashLong, uhash_compareLong, NULL, &status);
+    }
+public:
+    virtual ~UHashPutRemove() { uhash_close(table); }
+    static UPerfFunction* get(const HashMapPerfTest &testcase, UErrorCode &status) {
+        return new UHashPutRemove(testcase, status);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; ++i) {
+            uhash_iputi(table, testcase.integers[i], i + 1, pErrorCode);
+        }
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; ++i) {
+            found += uhash_iremovei(table, testcase.integers[i]);
+        }
+    }
+    UHashtable *table;
+};
+
+class OHashPutRemove : public Command {
+protected:
+    OHashPutRemove(const HashMapPerfTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const HashMapPerfTest &testcase) {
+        return new OHashPutRemove(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; ++i) {
+            map.put(testcase.integers[i], i + 1, *pErrorCode);
+        }
+        for (int32_t i = 0; i < HashMapPerfTest::kCount; ++i) {
+            found += map.remove(testcase.integers[i]);
+        }
+    }
+    IntMap map;
+};
+
+UPerfFunction* HashMapPerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction *function = NULL;
+    switch (index) {
+        case 0: name = "UHashFindInt";      if (exec) function = UHashFindInt::get(*this, status); break;
+        case 1: name = "OHashFindInt";      if (exec) function = OHashFindInt::get(*this, status); break;
+        case 2: name = "UHashFindString";   if (exec) function = UHashFindString::get(*this, status); break;
+        case 3: name = "OHashFindString";   if (exec) function = OHashFindString::get(*this, status); break;
+        case 4: name = "UHashPutRemove";    if (exec) function = UHashPutRemove::get(*this, status); break;
+        case 5: name = "OHashPutRemove";    if (exec) function = OHashPutRemove::get(*this); break;
+        default: name = ""; break;
+    }
+    if (U_FAILURE(status)) {
+        fprintf(stderr, "error: unable to set up %s: %s\n", name, u_errorName(status));
+        delete function;
+        return NULL;
+    }
+    return function;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status = U_ZERO_ERROR;
+    HashMapPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+
+    return 0;
+}
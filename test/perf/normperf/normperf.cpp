@@ -66,6 +66,9 @@ UPerfFunction* NormalizerPerformanceTest::runIndexedTest(int32_t index, UBool ex
         TESTCASE(31,TestIsNormalized_FCD_NFC_Text);
         TESTCASE(32,TestIsNormalized_FCD_Orig_Text);
 
+        TESTCASE(33,TestTrans_Compound_Orig_Text);
+        TESTCASE(34,TestTrans_Stepwise_Orig_Text);
+
         default: 
             name = ""; 
             return NULL;
@@ -506,3 +509,21 @@ int main(int argc, const char* argv[]){
     }
     return 0;
 }
+
+// Test compound transliterator performance
+static const char TRANS_COMPOUND_ID[] = "NFD; Latin-ASCII; Lower; NFC";
+
+UPerfFunction* NormalizerPerformanceTest::TestTrans_Compound_Orig_Text(){
+    if(line_mode){
+        return new TransPerfFunction(TRANS_COMPOUND_ID, FALSE, lines, numLines);
+    }else{
+        return new TransPerfFunction(TRANS_COMPOUND_ID, FALSE, buffer, bufferLen);
+    }
+}
+UPerfFunction* NormalizerPerformanceTest::TestTrans_Stepwise_Orig_Text(){
+    if(line_mode){
+        return new TransPerfFunction(TRANS_COMPOUND_ID, TRUE, lines, numLines);
+    }else{
+        return new TransPerfFunction(TRANS_COMPOUND_ID, TRUE, buffer, bufferLen);
+    }
+}
@@ -12,6 +12,7 @@
 #ifndef _NORMPERF_H
 #define _NORMPERF_H
 
+#include "unicode/translit.h"
 #include "unicode/unorm.h"
 #include "unicode/ustring.h"
 
@@ -178,6 +179,91 @@ class NormPerfFunction : public UPerfFunction{
 
 
 
+/**
+ * Transliterates the text with a compound transliterator, either as a whole
+ * (pushing chunks of long texts through all of its elements) or
+ * by running each of its elements over the whole text in turn.
+ */
+class TransPerfFunction : public UPerfFunction{
+private:
+    ULine* lines;
+    int32_t numLines;
+    icu::Transliterator* trans;
+    UBool stepwise;
+    const UChar* src;
+    int32_t srcLen;
+    UBool line_mode;
+
+    void transliterate(const UChar* s, int32_t sLen, UErrorCode* status){
+        icu::UnicodeString text(s, sLen);
+        if(stepwise){
+            for(int32_t i = 0; i < trans->countElements(); i++){
+                trans->getElement(i, *status).transliterate(text);
+            }
+        }else{
+            trans->transliterate(text);
+        }
+    }
+
+public:
+    virtual void call(UErrorCode* status){
+        if(trans == NULL){
+            *status = U_MISSING_RESOURCE_ERROR;
+            return;
+        }
+        if(line_mode==TRUE){
+            for(int32_t i = 0; i< numLines; i++){
+                transliterate(lines[i].name, lines[i].len, status);
+            }
+        }else{
+            transliterate(src, srcLen, status);
+        }
+    }
+    virtual long getOperationsPerIteration(){
+        if(line_mode ==TRUE){
+            int32_t totalChars=0;
+            for(int32_t i =0; i< numLines; i++){
+                totalChars+= lines[i].len;
+            }
+            return totalChars;
+        }else{
+            return srcLen;
+        }
+    }
+    TransPerfFunction(const char* id, UBool _stepwise, ULine* srcLines, int32_t srcNumLines) {
+        init(id, _stepwise);
+        lines = srcLines;
+        numLines = srcNumLines;
+        src = NULL;
+        srcLen = 0;
+        line_mode = TRUE;
+    }
+    TransPerfFunction(const char* id, UBool _stepwise, const UChar* source, int32_t sourceLen) {
+        init(id, _stepwise);
+        lines = NULL;
+        numLines = 0;
+        src = source;
+        srcLen = sourceLen;
+        line_mode = FALSE;
+    }
+    void init(const char* id, UBool _stepwise){
+        UErrorCode status = U_ZERO_ERROR;
+        UParseError parseError;
+        stepwise = _stepwise;
+        trans = icu::Transliterator::createInstance(icu::UnicodeString(id, -1, US_INV),
+                                                    UTRANS_FORWARD, parseError, status);
+        if(U_FAILURE(status)){
+            fprintf(stderr, "FAILED to create transliterator %s. Error: %s\n", id, u_errorName(status));
+            delete trans;
+            trans = NULL;
+        }
+    }
+    ~TransPerfFunction(){
+        delete trans;
+    }
+};
+
+
 class  NormalizerPerformanceTest : public UPerfTest{
 private:
     ULine* NFDFileLines;
@@ -249,6 +335,10 @@ class  NormalizerPerformanceTest : public UPerfTest{
     UPerfFunction* TestIsNormalized_FCD_NFC_Text();
     UPerfFunction* TestIsNormalized_FCD_Orig_Text();
 
+    /* Compound transliterator performance */
+    UPerfFunction* TestTrans_Compound_Orig_Text();
+    UPerfFunction* TestTrans_Stepwise_Orig_Text();
+
 };
 
 //---------------------------------------------------------------------------------------
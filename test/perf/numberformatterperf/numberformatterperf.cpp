@@ -0,0 +1,147 @@
+/*
+ ***********************************************************************
+ * © 2026 and later: Unicode, Inc. and others.
+ * License & terms of use: http://www.unicode.org/copyright.html#License
+ ***********************************************************************
+ *  file name:  numberformatterperf.cpp
+ *  encoding:   UTF-8
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  created on: 2026oct14
+ *
+ *  Performance test program for NumberFormatter with random doubles.
+ *
+ *  Each iteration formats the same set of pseudo-random doubles
+ *  of varying magnitudes and numbers of significant digits:
+ *  numberformatterperf FormatDouble -L de --passes 3 --iterations 1000
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "unicode/numberformatter.h"
+#include "unicode/uperf.h"
+#include "cmemory.h"
+
+using namespace icu::number;
+
+// Test object.
+class NumberFormatterPerfTest : public UPerfTest {
+public:
+    NumberFormatterPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, NULL, 0, "", status) {
+        // Mix bit patterns of random magnitudes with decimal values that have few digits.
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for (int32_t i = 0; i < kCount; ++i) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            if (i % 2 == 0) {
+                // Exponents from about 1e-20 to 1e20.
+                uint64_t bits = (state >> 12) | ((uint64_t)(1023 - 66 + (state >> 56) % 133) << 52);
+                uprv_memcpy(&values[i], &bits, sizeof(double));
+            } else {
+                values[i] = (double)(int64_t)((state >> 20) % 100000000) / 1000.0;
+            }
+        }
+    }
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    const char *getLocale() const { return locale != NULL ? locale : "en"; }
+
+    static constexpr int32_t kCount = 1000;
+    double values[kCount];
+};
+
+// Performance test function object.
+class Command : public UPerfFunction {
+protected:
+    Command(const NumberFormatterPerfTest &testcase, const LocalizedNumberFormatter &formatter)
+            : testcase(testcase), formatter(formatter) {}
+
+public:
+    virtual ~Command() {}
+
+    virtual void call(UErrorCode* pErrorCode) {
+        for (int32_t i = 0; i < NumberFormatterPerfTest::kCount; ++i) {
+            FormattedNumber result = formatter.formatDouble(testcase.values[i], *pErrorCode);
+            length += result.toString(*pErrorCode).length();
+        }
+        if (U_FAILURE(*pErrorCode)) {
+            fprintf(stderr, "error: formatDouble() failed: %s\n", u_errorName(*pErrorCode));
+        }
+    }
+
+    virtual long getOperationsPerIteration() {
+        // Number of doubles formatted.
+        return NumberFormatterPerfTest::kCount;
+    }
+
+    const NumberFormatterPerfTest &testcase;
+    LocalizedNumberFormatter formatter;
+    int64_t length = 0;
+};
+
+// Default settings: at most 6 fraction digits.
+class FormatDouble : public Command {
+protected:
+    FormatDouble(const NumberFormatterPerfTest &testcase)
+            : Command(testcase, NumberFormatter::withLocale(testcase.getLocale())) {}
+public:
+    static UPerfFunction* get(const NumberFormatterPerfTest &testcase) {
+        return new FormatDouble(testcase);
+    }
+};
+
+// All digits of the shortest round-trip representation.
+class FormatDoubleUnlimited : public Command {
+protected:
+    FormatDoubleUnlimited(const NumberFormatterPerfTest &testcase)
+            : Command(testcase, NumberFormatter::withLocale(testcase.getLocale())
+                                        .precision(Precision::unlimited())) {}
+public:
+    static UPerfFunction* get(const NumberFormatterPerfTest &testcase) {
+        return new FormatDoubleUnlimited(testcase);
+    }
+};
+
+// Scientific notation with the shortest round-trip digits.
+class FormatDoubleScientific : public Command {
+protected:
+    FormatDoubleScientific(const NumberFormatterPerfTest &testcase)
+            : Command(testcase, NumberFormatter::withLocale(testcase.getLocale())
+                                        .notation(Notation::scientific())
+                                        .precision(Precision::unlimited())) {}
+public:
+    static UPerfFunction* get(const NumberFormatterPerfTest &testcase) {
+        return new FormatDoubleScientific(testcase);
+    }
+};
+
+UPerfFunction* NumberFormatterPerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
+    switch (index) {
+        case 0: name = "FormatDouble";              if (exec) return FormatDouble::get(*this); break;
+        case 1: name = "FormatDoubleUnlimited";     if (exec) return FormatDoubleUnlimited::get(*this); break;
+        case 2: name = "FormatDoubleScientific";    if (exec) return FormatDoubleScientific::get(*this); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status = U_ZERO_ERROR;
+    NumberFormatterPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+
+    return 0;
+}
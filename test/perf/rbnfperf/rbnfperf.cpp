@@ -0,0 +1,149 @@
+/*
+ ***********************************************************************
+ * © 2026 and later: Unicode, Inc. and others.
+ * License & terms of use: http://www.unicode.org/copyright.html#License
+ ***********************************************************************
+ *  file name:  rbnfperf.cpp
+ *  encoding:   UTF-8
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  created on: 2026oct14
+ *
+ *  Performance test program for RuleBasedNumberFormat.
+ *
+ *  Each iteration formats the same set of pseudo-random integers
+ *  of varying magnitudes, or a set of small positive doubles:
+ *  rbnfperf SpelloutInt -L de --passes 3 --iterations 1000
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "unicode/rbnf.h"
+#include "unicode/uperf.h"
+
+// Test object.
+class RBNFPerfTest : public UPerfTest {
+public:
+    RBNFPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, NULL, 0, "", status) {
+        // A quarter of the values is below 1000, the rest is spread up to 10^9.
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        static const int64_t limits[] = { 1000, 1000000, 1000000000, 100 };
+        for (int32_t i = 0; i < kCount; ++i) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            integers[i] = (int64_t)((state >> 24) % limits[i % 4]);
+            doubles[i] = (double)integers[i] / 100.0;
+        }
+    }
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    const char *getLocale() const { return locale != NULL ? locale : "en"; }
+
+    static constexpr int32_t kCount = 1000;
+    int64_t integers[kCount];
+    double doubles[kCount];
+};
+
+// Performance test function object.
+class Command : public UPerfFunction {
+protected:
+    Command(const RBNFPerfTest &testcase, URBNFRuleSetTag tag, UBool useDoubles)
+            : testcase(testcase), useDoubles(useDoubles),
+              formatter(tag, testcase.getLocale(), status) {
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "error: unable to create RuleBasedNumberFormat: %s\n", u_errorName(status));
+        }
+    }
+
+public:
+    virtual ~Command() {}
+
+    virtual void call(UErrorCode* pErrorCode) {
+        if (U_FAILURE(status)) {
+            *pErrorCode = status;
+            return;
+        }
+        icu::UnicodeString result;
+        for (int32_t i = 0; i < RBNFPerfTest::kCount; ++i) {
+            result.remove();
+            if (useDoubles) {
+                formatter.format(testcase.doubles[i], result);
+            } else {
+                formatter.format(testcase.integers[i], result);
+            }
+            length += result.length();
+        }
+    }
+
+    virtual long getOperationsPerIteration() {
+        // Number of values formatted.
+        return RBNFPerfTest::kCount;
+    }
+
+    const RBNFPerfTest &testcase;
+    UBool useDoubles;
+    UErrorCode status = U_ZERO_ERROR;
+    icu::RuleBasedNumberFormat formatter;
+    int64_t length = 0;
+};
+
+// Spelled-out integers, such as "one hundred twenty-three".
+class SpelloutInt : public Command {
+protected:
+    SpelloutInt(const RBNFPerfTest &testcase) : Command(testcase, icu::URBNF_SPELLOUT, FALSE) {}
+public:
+    static UPerfFunction* get(const RBNFPerfTest &testcase) {
+        return new SpelloutInt(testcase);
+    }
+};
+
+// Spelled-out doubles with two fraction digits.
+class SpelloutDouble : public Command {
+protected:
+    SpelloutDouble(const RBNFPerfTest &testcase) : Command(testcase, icu::URBNF_SPELLOUT, TRUE) {}
+public:
+    static UPerfFunction* get(const RBNFPerfTest &testcase) {
+        return new SpelloutDouble(testcase);
+    }
+};
+
+// Ordinal abbreviations, such as "123rd".
+class OrdinalInt : public Command {
+protected:
+    OrdinalInt(const RBNFPerfTest &testcase) : Command(testcase, icu::URBNF_ORDINAL, FALSE) {}
+public:
+    static UPerfFunction* get(const RBNFPerfTest &testcase) {
+        return new OrdinalInt(testcase);
+    }
+};
+
+UPerfFunction* RBNFPerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
+    switch (index) {
+        case 0: name = "SpelloutInt";       if (exec) return SpelloutInt::get(*this); break;
+        case 1: name = "SpelloutDouble";    if (exec) return SpelloutDouble::get(*this); break;
+        case 2: name = "OrdinalInt";        if (exec) return OrdinalInt::get(*this); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status = U_ZERO_ERROR;
+    RBNFPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+
+    return 0;
+}
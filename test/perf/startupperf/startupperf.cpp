@@ -0,0 +1,352 @@
+/*
+ ***********************************************************************
+ * © 2026 and later: Unicode, Inc. and others.
+ * License & terms of use: http://www.unicode.org/copyright.html#License
+ ***********************************************************************
+ *  file name:  startupperf.cpp
+ *  encoding:   UTF-8
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  created on: 2026oct14
+ *
+ *  Cold start benchmark: the time from process start to the first result
+ *  of a service. For each workload and locale, the program starts fresh
+ *  copies of itself, each of which creates one service object and uses it
+ *  once, and prints the median times over the runs:
+ *  startupperf --workloads number,collation --locales en,de,ja --runs 5
+ *
+ *  "wall" is measured by the parent around the whole child process,
+ *  including process creation and library loading; the "none" workload
+ *  shows that part alone. "first" is measured in the child, from main()
+ *  to the first result.
+ *
+ *  When the library is built with U_ENABLE_TRACING, the child also splits
+ *  "first" into the time spent in udata_open(), ures_open() and mapping
+ *  data files, each without the time of the others nested inside it, and
+ *  the remaining time for constructing the objects.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "unicode/utypes.h"
+#include "unicode/brkiter.h"
+#include "unicode/coll.h"
+#include "unicode/datefmt.h"
+#include "unicode/locid.h"
+#include "unicode/numberformatter.h"
+#include "unicode/unistr.h"
+#include "unicode/utimer.h"
+#include "unicode/utrace.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+#if U_PLATFORM_USES_ONLY_WIN32_API
+#define popen _popen
+#define pclose _pclose
+#endif
+
+using icu::BreakIterator;
+using icu::Collator;
+using icu::DateFormat;
+using icu::Locale;
+using icu::UnicodeString;
+using icu::number::NumberFormatter;
+
+namespace {
+
+// Workloads --------------------------------------------------------------- ***
+
+// Each workload function creates one service object and uses it once.
+// It returns a value derived from the result, so that the work cannot be optimized away.
+typedef int32_t WorkloadFn(const Locale &locale, UErrorCode &errorCode);
+
+int32_t doNothing(const Locale &, UErrorCode &) {
+    return 0;
+}
+
+int32_t formatNumber(const Locale &locale, UErrorCode &errorCode) {
+    UnicodeString s = NumberFormatter::withLocale(locale)
+        .formatDouble(1234567.89, errorCode).toString();
+    return s.length();
+}
+
+int32_t formatDate(const Locale &locale, UErrorCode &errorCode) {
+    icu::LocalPointer<DateFormat> fmt(DateFormat::createDateTimeInstance(
+        DateFormat::kLong, DateFormat::kLong, locale));
+    if (fmt.isNull()) {
+        errorCode = U_MISSING_RESOURCE_ERROR;
+        return 0;
+    }
+    UnicodeString s;
+    fmt->format((UDate)1.5e12, s);
+    return s.length();
+}
+
+int32_t collate(const Locale &locale, UErrorCode &errorCode) {
+    icu::LocalPointer<Collator> coll(Collator::createInstance(locale, errorCode));
+    if (U_FAILURE(errorCode)) { return 0; }
+    return coll->compare(UnicodeString(u"résumé"), UnicodeString(u"resume"), errorCode);
+}
+
+int32_t breakWords(const Locale &locale, UErrorCode &errorCode) {
+    icu::LocalPointer<BreakIterator> bi(BreakIterator::createWordInstance(locale, errorCode));
+    if (U_FAILURE(errorCode)) { return 0; }
+    UnicodeString text(u"The quick brown fox, 2018.");
+    bi->setText(text);
+    int32_t count = 0;
+    while (bi->next() != BreakIterator::DONE) { ++count; }
+    return count;
+}
+
+struct Workload {
+    const char *name;
+    WorkloadFn *fn;
+};
+
+const Workload kWorkloads[] = {
+    { "none", doNothing },
+    { "number", formatNumber },
+    { "date", formatDate },
+    { "collation", collate },
+    { "break", breakWords }
+};
+
+const Workload *findWorkload(const char *name) {
+    for (const Workload &w : kWorkloads) {
+        if (strcmp(name, w.name) == 0) { return &w; }
+    }
+    return nullptr;
+}
+
+// Splits a comma-separated option value.
+std::vector<std::string> splitList(const char *list) {
+    std::vector<std::string> items;
+    const char *p = list;
+    for (;;) {
+        const char *comma = strchr(p, ',');
+        size_t length = (comma != nullptr) ? (size_t)(comma - p) : strlen(p);
+        if (length > 0) { items.push_back(std::string(p, length)); }
+        if (comma == nullptr) { break; }
+        p = comma + 1;
+    }
+    return items;
+}
+
+// Child process ----------------------------------------------------------- ***
+
+// The parts of the startup time, in the order of the child's output.
+enum {
+    T_FIRST, T_UDATA_OPEN, T_URES_OPEN, T_MAP_FILE, T_CONSTRUCT, T_COUNT
+};
+
+// Attributes the time of each traced call to its function,
+// minus the time of the traced calls nested inside it.
+struct TraceTimes {
+    static const int32_t kMaxDepth = 64;
+    UTimer start[kMaxDepth];
+    double nested[kMaxDepth];
+    int32_t depth = 0;
+    double udataOpen = 0, uresOpen = 0, mapFile = 0;
+};
+
+TraceTimes gTrace;
+
+void U_CALLCONV traceEntry(const void *, int32_t) {
+    if (gTrace.depth < TraceTimes::kMaxDepth) {
+        gTrace.nested[gTrace.depth] = 0;
+        utimer_getTime(&gTrace.start[gTrace.depth]);
+    }
+    ++gTrace.depth;
+}
+
+void U_CALLCONV traceExit(const void *, int32_t fnNumber, const char *, va_list) {
+    if (--gTrace.depth >= TraceTimes::kMaxDepth || gTrace.depth < 0) { return; }
+    UTimer now;
+    utimer_getTime(&now);
+    double total = utimer_getDeltaSeconds(&gTrace.start[gTrace.depth], &now);
+    double self = total - gTrace.nested[gTrace.depth];
+    if (gTrace.depth > 0) { gTrace.nested[gTrace.depth - 1] += total; }
+    switch (fnNumber) {
+    case UTRACE_UDATA_OPEN: gTrace.udataOpen += self; break;
+    case UTRACE_URES_OPEN: gTrace.uresOpen += self; break;
+    case UTRACE_UDATA_MAP_FILE: gTrace.mapFile += self; break;
+    default: break;
+    }
+}
+
+// Runs one workload and prints its times in milliseconds, or -1 for unknown parts.
+int runChild(const Workload &workload, const char *localeID) {
+    UTimer start;
+    utimer_getTime(&start);
+    // Without tracing in the library, the functions are never called.
+    utrace_setFunctions(nullptr, traceEntry, traceExit, nullptr);
+    utrace_setLevel(UTRACE_OPEN_CLOSE);
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t sum = workload.fn(Locale(localeID), errorCode);
+    UTimer stop;
+    utimer_getTime(&stop);
+    utrace_setLevel(UTRACE_OFF);
+    if (U_FAILURE(errorCode)) {
+        printf("error %s\n", u_errorName(errorCode));
+        return errorCode;
+    }
+    double first = utimer_getDeltaSeconds(&start, &stop);
+    double traced = gTrace.udataOpen + gTrace.uresOpen + gTrace.mapFile;
+    // Loading anything at all calls udata_open(), so 0 means no tracing.
+    UBool haveTrace = traced > 0 || &workload == &kWorkloads[0];
+    printf("ok %d %.4f %.4f %.4f %.4f %.4f\n", (int)(sum & 1), first * 1e3,
+           haveTrace ? gTrace.udataOpen * 1e3 : -1, haveTrace ? gTrace.uresOpen * 1e3 : -1,
+           haveTrace ? gTrace.mapFile * 1e3 : -1, haveTrace ? (first - traced) * 1e3 : -1);
+    return 0;
+}
+
+// Parent process ---------------------------------------------------------- ***
+
+struct Sample {
+    double wall;
+    double times[T_COUNT];
+};
+
+// Starts the child and parses its output line.
+UBool runOnce(const char *program, const char *workload, const char *localeID,
+              Sample &sample, std::string &error) {
+    std::string command = std::string("\"") + program + "\" --child " + workload +
+        " --locales " + localeID;
+    UTimer start;
+    utimer_getTime(&start);
+    FILE *child = popen(command.c_str(), "r");
+    if (child == nullptr) {
+        error = "cannot start " + command;
+        return FALSE;
+    }
+    char line[200] = "";
+    char *got = fgets(line, (int)sizeof(line), child);
+    int status = pclose(child);
+    UTimer stop;
+    utimer_getTime(&stop);
+    sample.wall = utimer_getDeltaSeconds(&start, &stop) * 1e3;
+    int ignored;
+    if (got == nullptr || status != 0 ||
+            sscanf(line, "ok %d %lf %lf %lf %lf %lf", &ignored, &sample.times[T_FIRST],
+                   &sample.times[T_UDATA_OPEN], &sample.times[T_URES_OPEN],
+                   &sample.times[T_MAP_FILE], &sample.times[T_CONSTRUCT]) != 6) {
+        error = got != nullptr ? std::string(line, strcspn(line, "\n")) : "no output";
+        return FALSE;
+    }
+    return TRUE;
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    return (n % 2) != 0 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+UOption options[] = {
+    UOPTION_HELP_H,
+    UOPTION_DEF("workloads", 'w', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("locales", 'L', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("runs", 'r', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("child", 0, UOPT_REQUIRES_ARG)
+};
+
+enum {
+    OPT_HELP, OPT_WORKLOADS, OPT_LOCALES, OPT_RUNS, OPT_CHILD
+};
+
+void printUsage(const char *program) {
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "Measures the time from process start to the first result of a service,\n"
+        "in fresh processes.\n"
+        "  -w, --workloads list       none, number, date, collation, break; default: all\n"
+        "  -L, --locales list         default: en,de,ja,ar,zh_Hant\n"
+        "  -r, --runs n               processes per workload and locale, default: 5\n",
+        program);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    argc = u_parseArgs(argc, argv, UPRV_LENGTHOF(options), options);
+    if (argc != 1 || options[OPT_HELP].doesOccur) {
+        if (argc < 0) {
+            fprintf(stderr, "error in command line argument \"%s\"\n", argv[-argc]);
+        } else if (argc > 1) {
+            fprintf(stderr, "unexpected command line argument \"%s\"\n", argv[1]);
+        }
+        printUsage(argv[0]);
+        return options[OPT_HELP].doesOccur ? 0 : U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    if (options[OPT_CHILD].doesOccur) {
+        const Workload *w = findWorkload(options[OPT_CHILD].value);
+        if (w == nullptr || !options[OPT_LOCALES].doesOccur) {
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        return runChild(*w, options[OPT_LOCALES].value);
+    }
+
+    std::vector<std::string> workloadNames = splitList(options[OPT_WORKLOADS].doesOccur ?
+        options[OPT_WORKLOADS].value : "none,number,date,collation,break");
+    std::vector<std::string> locales = splitList(options[OPT_LOCALES].doesOccur ?
+        options[OPT_LOCALES].value : "en,de,ja,ar,zh_Hant");
+    int32_t runs = options[OPT_RUNS].doesOccur ? atoi(options[OPT_RUNS].value) : 5;
+    for (const std::string &name : workloadNames) {
+        if (findWorkload(name.c_str()) == nullptr) {
+            fprintf(stderr, "unknown workload \"%s\"\n", name.c_str());
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+    }
+    if (runs < 1 || locales.empty()) {
+        printUsage(argv[0]);
+        return U_ILLEGAL_ARGUMENT_ERROR;
+    }
+
+    printf("%-10s %-10s %9s %9s %9s %9s %9s %9s\n",
+           "workload", "locale", "wall", "first", "udata", "ures", "map", "construct");
+    printf("%-10s %-10s %9s %9s %9s %9s %9s %9s\n",
+           "", "", "ms", "ms", "ms", "ms", "ms", "ms");
+    int exitCode = 0;
+    UBool haveTrace = TRUE;
+    for (const std::string &workload : workloadNames) {
+        for (const std::string &locale : locales) {
+            std::vector<double> wall;
+            std::vector<double> times[T_COUNT];
+            std::string error;
+            for (int32_t run = 0; run < runs; ++run) {
+                Sample sample;
+                if (!runOnce(argv[0], workload.c_str(), locale.c_str(), sample, error)) {
+                    break;
+                }
+                wall.push_back(sample.wall);
+                for (int32_t i = 0; i < T_COUNT; ++i) { times[i].push_back(sample.times[i]); }
+            }
+            if (!error.empty()) {
+                fprintf(stderr, "%s %s failed: %s\n", workload.c_str(), locale.c_str(),
+                        error.c_str());
+                exitCode = U_INTERNAL_PROGRAM_ERROR;
+                continue;
+            }
+            printf("%-10s %-10s %9.3f %9.3f", workload.c_str(), locale.c_str(),
+                   median(wall), median(times[T_FIRST]));
+            if (times[T_UDATA_OPEN][0] >= 0) {
+                printf(" %9.3f %9.3f %9.3f %9.3f\n", median(times[T_UDATA_OPEN]),
+                       median(times[T_URES_OPEN]), median(times[T_MAP_FILE]),
+                       median(times[T_CONSTRUCT]));
+            } else {
+                haveTrace = FALSE;
+                printf(" %9s %9s %9s %9s\n", "-", "-", "-", "-");
+            }
+            fflush(stdout);
+        }
+    }
+    if (!haveTrace) {
+        printf("(Build ICU with U_ENABLE_TRACING for the udata, ures, map and construct times.)\n");
+    }
+    return exitCode;
+}
@@ -59,6 +59,8 @@
 my $tests = {
     "ICU Forward Search", [ "$p1 Test_ICU_Forward_Search", "$p2 Test_ICU_Forward_Search" ],
     "ICU Backward Search",[ "$p1 Test_ICU_Backward_Search", "$p2 Test_ICU_Backward_Search" ],
+    "ICU Forward Search Large",[ "$p1 Test_ICU_Forward_Search_Large", "$p2 Test_ICU_Forward_Search_Large" ],
+    "ICU Forward Search Large Wildcard",[ "$p1 Test_ICU_Forward_Search_Large_Wildcard", "$p2 Test_ICU_Forward_Search_Large_Wildcard" ],
 };
 
 runTests( $options, $tests, $dataFiles );
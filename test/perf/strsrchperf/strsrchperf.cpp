@@ -16,11 +16,17 @@
 
 #include "strsrchperf.h"
 
+#define LARGE_REPEAT_COUNT 64
+
 StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status)
 :UPerfTest(argc,argv,status){
     int32_t start, end;
     srch = NULL;
     pttrn = NULL;
+    largeSrc = NULL;
+    largeSrcLen = 0;
+    largeSrch = NULL;
+    largeWildcardSrch = NULL;
     if(status== U_ILLEGAL_ARGUMENT_ERROR || line_mode){
        fprintf(stderr,gUsageString, "strsrchperf");
        return;
@@ -71,7 +77,26 @@ StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const cha
         fprintf(stderr, "FAILED to create UPerfTest object. Error: %s\n", u_errorName(status));
         return;
     }
-    
+
+    /* Large haystack: the whole text again and again, with a line break in between. */
+    largeSrcLen = (srcLen + 1) * LARGE_REPEAT_COUNT;
+    largeSrc = (UChar*)malloc(sizeof(UChar)*largeSrcLen);
+    if (largeSrc == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < LARGE_REPEAT_COUNT; i++) {
+        u_memcpy(largeSrc + i * (srcLen + 1), src, srcLen);
+        largeSrc[i * (srcLen + 1) + srcLen] = 0x000A;
+    }
+    largeSrch = usearch_open(pttrn, pttrnLen, largeSrc, largeSrcLen, locale, NULL, &status);
+    largeWildcardSrch = usearch_open(pttrn, pttrnLen, largeSrc, largeSrcLen, locale, NULL, &status);
+    usearch_setAttribute(largeWildcardSrch, USEARCH_ELEMENT_COMPARISON,
+                         USEARCH_PATTERN_BASE_WEIGHT_IS_WILDCARD, &status);
+    if(U_FAILURE(status)){
+        fprintf(stderr, "FAILED to create the large haystack searches. Error: %s\n", u_errorName(status));
+        return;
+    }
 }
 
 StringSearchPerformanceTest::~StringSearchPerformanceTest() {
@@ -81,12 +106,17 @@ StringSearchPerformanceTest::~StringSearchPerformanceTest() {
     if (srch != NULL) {
         usearch_close(srch);
     }
+    usearch_close(largeSrch);
+    usearch_close(largeWildcardSrch);
+    free(largeSrc);
 }
 
 UPerfFunction* StringSearchPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char *par) {
     switch (index) {
         TESTCASE(0,Test_ICU_Forward_Search);
         TESTCASE(1,Test_ICU_Backward_Search);
+        TESTCASE(2,Test_ICU_Forward_Search_Large);
+        TESTCASE(3,Test_ICU_Forward_Search_Large_Wildcard);
 
         default: 
             name = ""; 
@@ -105,6 +135,16 @@ UPerfFunction* StringSearchPerformanceTest::Test_ICU_Backward_Search(){
     return func;
 }
 
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Forward_Search_Large(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUForwardSearch, largeSrch, largeSrc, largeSrcLen, pttrn, pttrnLen);
+    return func;
+}
+
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Forward_Search_Large_Wildcard(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUForwardSearch, largeWildcardSrch, largeSrc, largeSrcLen, pttrn, pttrnLen);
+    return func;
+}
+
 int main (int argc, const char* argv[]) {
     UErrorCode status = U_ZERO_ERROR;
     StringSearchPerformanceTest test(argc, argv, status);
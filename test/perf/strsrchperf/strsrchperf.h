@@ -12,6 +12,7 @@
 #define _STRSRCHPERF_H
 
 #include "unicode/usearch.h"
+#include "unicode/ustring.h"
 #include "unicode/uperf.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -53,6 +54,12 @@ class StringSearchPerformanceTest : public UPerfTest {
     UChar* pttrn;
     int32_t pttrnLen;
     UStringSearch* srch;
+    // The file text repeated LARGE_REPEAT_COUNT times, searched with the standard
+    // and with a wildcard element comparison, which does not skip candidate starts.
+    UChar* largeSrc;
+    int32_t largeSrcLen;
+    UStringSearch* largeSrch;
+    UStringSearch* largeWildcardSrch;
     
 public:
     StringSearchPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status);
@@ -60,6 +67,8 @@ class StringSearchPerformanceTest : public UPerfTest {
     virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = NULL);
     UPerfFunction* Test_ICU_Forward_Search();
     UPerfFunction* Test_ICU_Backward_Search();
+    UPerfFunction* Test_ICU_Forward_Search_Large();
+    UPerfFunction* Test_ICU_Forward_Search_Large_Wildcard();
 };
 
 
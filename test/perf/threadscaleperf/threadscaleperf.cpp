@@ -0,0 +1,414 @@
+/*
+ ***********************************************************************
+ * © 2026 and later: Unicode, Inc. and others.
+ * License & terms of use: http://www.unicode.org/copyright.html#License
+ ***********************************************************************
+ *  file name:  threadscaleperf.cpp
+ *  encoding:   UTF-8
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  created on: 2026oct14
+ *
+ *  Concurrency scaling benchmark for service object creation and use.
+ *  For each workload and thread count, all threads repeatedly create
+ *  a service object, use it once and delete it, for a fixed time.
+ *  The program prints the throughput per thread count and the scaling
+ *  relative to one thread:
+ *  threadscaleperf --workloads collator,converter --threads 1,2,4,8
+ *
+ *  When the library is built with U_ENABLE_TRACING, it also prints
+ *  the utrace metrics for each measurement: how often threads waited
+ *  for a mutex and for how long, and the hit and miss counts of the
+ *  UnifiedCache, the resource bundle cache and the converter cache.
+ *  The last column names the mutex that threads waited for the longest,
+ *  from utrace_getMutexStats(), which shows where creating objects
+ *  contends on the cache and registry mutexes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include "unicode/utypes.h"
+#include "unicode/brkiter.h"
+#include "unicode/coll.h"
+#include "unicode/locid.h"
+#include "unicode/numberformatter.h"
+#include "unicode/smpdtfmt.h"
+#include "unicode/translit.h"
+#include "unicode/ucnv.h"
+#include "unicode/unistr.h"
+#include "unicode/utimer.h"
+#include "unicode/utrace.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+using icu::BreakIterator;
+using icu::Collator;
+using icu::Locale;
+using icu::SimpleDateFormat;
+using icu::Transliterator;
+using icu::UnicodeString;
+using icu::number::NumberFormatter;
+
+namespace {
+
+// Workloads --------------------------------------------------------------- ***
+
+struct Settings {
+    Locale locale;
+    const char *converterName;
+    UnicodeString transliteratorID;
+    UnicodeString text;
+};
+
+// Each workload function creates one service object, uses it once and deletes it.
+// It returns a value derived from the result, so that the work cannot be optimized away.
+typedef int32_t WorkloadFn(const Settings &settings, UErrorCode &errorCode);
+
+int32_t formatNumber(const Settings &settings, UErrorCode &errorCode) {
+    UnicodeString s = NumberFormatter::withLocale(settings.locale)
+        .formatDouble(1234567.89, errorCode).toString();
+    return s.length();
+}
+
+int32_t formatDate(const Settings &settings, UErrorCode &errorCode) {
+    SimpleDateFormat fmt(UnicodeString(u"yyyy-MM-dd HH:mm:ss zzzz"), settings.locale, errorCode);
+    UnicodeString s;
+    if (U_SUCCESS(errorCode)) {
+        fmt.format((UDate)1.5e12, s);
+    }
+    return s.length();
+}
+
+int32_t collate(const Settings &settings, UErrorCode &errorCode) {
+    icu::LocalPointer<Collator> coll(Collator::createInstance(settings.locale, errorCode));
+    if (U_FAILURE(errorCode)) { return 0; }
+    return coll->compare(settings.text, UnicodeString(u"resume"), errorCode);
+}
+
+int32_t breakWords(const Settings &settings, UErrorCode &errorCode) {
+    icu::LocalPointer<BreakIterator> bi(
+        BreakIterator::createWordInstance(settings.locale, errorCode));
+    if (U_FAILURE(errorCode)) { return 0; }
+    bi->setText(settings.text);
+    int32_t count = 0;
+    while (bi->next() != BreakIterator::DONE) { ++count; }
+    return count;
+}
+
+int32_t transliterate(const Settings &settings, UErrorCode &errorCode) {
+    icu::LocalPointer<Transliterator> t(Transliterator::createInstance(
+        settings.transliteratorID, UTRANS_FORWARD, errorCode));
+    if (U_FAILURE(errorCode)) { return 0; }
+    UnicodeString s(settings.text);
+    t->transliterate(s);
+    return s.length();
+}
+
+int32_t convert(const Settings &settings, UErrorCode &errorCode) {
+    char bytes[256];
+    icu::LocalUConverterPointer cnv(ucnv_open(settings.converterName, &errorCode));
+    if (U_FAILURE(errorCode)) { return 0; }
+    int32_t length = ucnv_fromUChars(cnv.getAlias(), bytes, UPRV_LENGTHOF(bytes),
+                                     settings.text.getBuffer(), settings.text.length(),
+                                     &errorCode);
+    if (U_FAILURE(errorCode)) { return 0; }
+    // ucnv_convert() opens and closes both converters internally.
+    char utf8[512];
+    return length + ucnv_convert("UTF-8", settings.converterName, utf8, UPRV_LENGTHOF(utf8),
+                                 bytes, length, &errorCode);
+}
+
+struct Workload {
+    const char *name;
+    WorkloadFn *fn;
+};
+
+const Workload kWorkloads[] = {
+    { "numberformatter", formatNumber },
+    { "dateformat", formatDate },
+    { "collator", collate },
+    { "breakiterator", breakWords },
+    { "transliterator", transliterate },
+    { "converter", convert }
+};
+
+// Splits a comma-separated option value.
+std::vector<std::string> splitList(const char *list) {
+    std::vector<std::string> items;
+    const char *p = list;
+    for (;;) {
+        const char *comma = strchr(p, ',');
+        size_t length = (comma != nullptr) ? (size_t)(comma - p) : strlen(p);
+        if (length > 0) { items.push_back(std::string(p, length)); }
+        if (comma == nullptr) { break; }
+        p = comma + 1;
+    }
+    return items;
+}
+
+// Measurements ------------------------------------------------------------ ***
+
+// The metrics that show contention. They stay 0 unless the library is built with tracing.
+const int32_t kMetrics[] = {
+    UTRACE_METRIC_MUTEX_WAIT_COUNT, UTRACE_METRIC_MUTEX_WAIT_NANOS,
+    UTRACE_METRIC_UNIFIED_CACHE_HIT, UTRACE_METRIC_UNIFIED_CACHE_MISS,
+    UTRACE_METRIC_RESBUND_CACHE_HIT, UTRACE_METRIC_RESBUND_CACHE_MISS,
+    UTRACE_METRIC_CONVERTER_CACHE_HIT, UTRACE_METRIC_CONVERTER_CACHE_MISS,
+    UTRACE_METRIC_ALLOC_COUNT
+};
+
+// Indexes into kMetrics[].
+enum {
+    M_MUTEX_WAIT_COUNT, M_MUTEX_WAIT_NANOS, M_UNIFIED_CACHE_HIT, M_UNIFIED_CACHE_MISS,
+    M_RESBUND_CACHE_HIT, M_RESBUND_CACHE_MISS, M_CONVERTER_CACHE_HIT, M_CONVERTER_CACHE_MISS,
+    M_ALLOC_COUNT
+};
+
+struct Result {
+    int64_t operations = 0;
+    double seconds = 0;
+    int64_t metrics[UPRV_LENGTHOF(kMetrics)] = {};
+    std::string hottestLock;  // the mutex with the longest total wait time
+    UErrorCode errorCode = U_ZERO_ERROR;
+};
+
+void getMetrics(int64_t values[]) {
+    int64_t all[64] = {};
+    UErrorCode errorCode = U_ZERO_ERROR;
+    utrace_getMetrics(all, UPRV_LENGTHOF(all), &errorCode);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(kMetrics); ++i) {
+        values[i] = U_SUCCESS(errorCode) ? all[kMetrics[i]] : 0;
+    }
+}
+
+// Returns the name of the mutex with the longest total wait time since
+// utrace_resetMutexStats(), or an empty string if there was no contention.
+// Mutexes with the same name, like the UnifiedCache shards, are added up.
+std::string getHottestLock() {
+    UTraceMutexStats stats[200];
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t count = utrace_getMutexStats(stats, UPRV_LENGTHOF(stats), &errorCode);
+    std::map<std::string, int64_t> waitNanos;
+    for (int32_t i = 0; U_SUCCESS(errorCode) && i < count && i < UPRV_LENGTHOF(stats); ++i) {
+        if (stats[i].waitNanos > 0) {
+            waitNanos[stats[i].name != nullptr ? stats[i].name : "(unnamed)"] += stats[i].waitNanos;
+        }
+    }
+    std::string hottest;
+    int64_t max = 0;
+    for (const auto &entry : waitNanos) {
+        if (entry.second > max) {
+            hottest = entry.first;
+            max = entry.second;
+        }
+    }
+    return hottest;
+}
+
+// Runs the workload on numThreads threads for about the given number of seconds.
+// The threads start together, and each one checks the time after every operation.
+Result measure(const Workload &workload, const Settings &settings,
+               int32_t numThreads, double seconds) {
+    std::atomic<int32_t> numReady(0);
+    std::atomic<bool> go(false);
+    std::vector<int64_t> counts(numThreads, 0);
+    std::vector<UErrorCode> codes(numThreads, U_ZERO_ERROR);
+    std::atomic<int32_t> sink(0);
+    UTimer start;
+    std::vector<std::thread> workers;
+    for (int32_t i = 0; i < numThreads; ++i) {
+        workers.emplace_back([&, i]() {
+            numReady.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            int32_t sum = 0;
+            int64_t n = 0;
+            UTimer now;
+            do {
+                sum += workload.fn(settings, codes[i]);
+                ++n;
+                utimer_getTime(&now);
+            } while (U_SUCCESS(codes[i]) && utimer_getDeltaSeconds(&start, &now) < seconds);
+            counts[i] = n;
+            sink.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+    while (numReady.load() < numThreads) {
+        std::this_thread::yield();
+    }
+    Result result;
+    int64_t before[UPRV_LENGTHOF(kMetrics)];
+    getMetrics(before);
+    utrace_resetMutexStats();
+    utimer_getTime(&start);
+    go.store(true, std::memory_order_release);
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    UTimer stop;
+    utimer_getTime(&stop);
+    result.seconds = utimer_getDeltaSeconds(&start, &stop);
+    getMetrics(result.metrics);
+    result.hottestLock = getHottestLock();
+    for (int32_t i = 0; i < UPRV_LENGTHOF(kMetrics); ++i) {
+        result.metrics[i] -= before[i];
+    }
+    for (int32_t i = 0; i < numThreads; ++i) {
+        result.operations += counts[i];
+        if (U_FAILURE(codes[i])) { result.errorCode = codes[i]; }
+    }
+    return result;
+}
+
+UOption options[] = {
+    UOPTION_HELP_H,
+    UOPTION_DEF("workloads", 'w', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("threads", 'n', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("time", 't', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("locale", 'L', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("converter", 'c', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("transliterator", 'x', UOPT_REQUIRES_ARG)
+};
+
+enum {
+    OPT_HELP, OPT_WORKLOADS, OPT_THREADS, OPT_TIME, OPT_LOCALE, OPT_CONVERTER,
+    OPT_TRANSLITERATOR
+};
+
+void printUsage(const char *program) {
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "Measures the throughput of creating and using service objects\n"
+        "on several threads at the same time.\n"
+        "  -w, --workloads list       numberformatter, dateformat, collator, breakiterator,\n"
+        "                             transliterator, converter; default: all\n"
+        "  -n, --threads list         thread counts, default: 1,2,4,8\n"
+        "  -t, --time seconds         time for each measurement, default: 1\n"
+        "  -L, --locale id            default: de\n"
+        "  -c, --converter name       default: windows-1252\n"
+        "  -x, --transliterator id    default: Latin-ASCII\n",
+        program);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    argc = u_parseArgs(argc, argv, UPRV_LENGTHOF(options), options);
+    if (argc != 1 || options[OPT_HELP].doesOccur) {
+        if (argc < 0) {
+            fprintf(stderr, "error in command line argument \"%s\"\n", argv[-argc]);
+        } else if (argc > 1) {
+            fprintf(stderr, "unexpected command line argument \"%s\"\n", argv[1]);
+        }
+        printUsage(argv[0]);
+        return options[OPT_HELP].doesOccur ? 0 : U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    std::vector<std::string> workloadNames = splitList(options[OPT_WORKLOADS].doesOccur ?
+        options[OPT_WORKLOADS].value :
+        "numberformatter,dateformat,collator,breakiterator,transliterator,converter");
+    std::vector<std::string> threadCountNames = splitList(options[OPT_THREADS].doesOccur ?
+        options[OPT_THREADS].value : "1,2,4,8");
+    double seconds = options[OPT_TIME].doesOccur ? atof(options[OPT_TIME].value) : 1;
+
+    std::vector<const Workload *> workloads;
+    for (const std::string &name : workloadNames) {
+        const Workload *w = nullptr;
+        for (const Workload &kw : kWorkloads) {
+            if (name == kw.name) { w = &kw; }
+        }
+        if (w == nullptr) {
+            fprintf(stderr, "unknown workload \"%s\"\n", name.c_str());
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        workloads.push_back(w);
+    }
+    std::vector<int32_t> threadCounts;
+    for (const std::string &name : threadCountNames) {
+        int32_t n = atoi(name.c_str());
+        if (n < 1) {
+            fprintf(stderr, "illegal thread count \"%s\"\n", name.c_str());
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        threadCounts.push_back(n);
+    }
+    if (seconds <= 0) {
+        printUsage(argv[0]);
+        return U_ILLEGAL_ARGUMENT_ERROR;
+    }
+
+    Settings settings;
+    settings.locale = Locale(options[OPT_LOCALE].doesOccur ? options[OPT_LOCALE].value : "de");
+    settings.converterName = options[OPT_CONVERTER].doesOccur ?
+        options[OPT_CONVERTER].value : "windows-1252";
+    settings.transliteratorID = UnicodeString(options[OPT_TRANSLITERATOR].doesOccur ?
+        options[OPT_TRANSLITERATOR].value : "Latin-ASCII", -1, US_INV);
+    settings.text = UnicodeString(
+        u"Résumé of the naïve café owner, Müller & Søren, 2018.");
+
+    printf("%-16s %7s %12s %14s %9s %12s %8s %8s %8s %8s  %s\n",
+           "workload", "threads", "ops/s", "ops/s/thread", "scaling",
+           "mutex waits", "wait ns", "ucache", "resb", "cnv", "hottest");
+    printf("%-16s %7s %12s %14s %9s %12s %8s %8s %8s %8s  %s\n",
+           "", "", "", "", "", "per op", "per op", "miss %", "miss %", "miss %", "lock");
+    int exitCode = 0;
+    UBool haveMetrics = FALSE;
+    for (const Workload *w : workloads) {
+        // Create the objects once, to load the data before the first measurement.
+        UErrorCode errorCode = U_ZERO_ERROR;
+        w->fn(settings, errorCode);
+        if (U_FAILURE(errorCode)) {
+            fprintf(stderr, "%s failed: %s\n", w->name, u_errorName(errorCode));
+            exitCode = errorCode;
+            continue;
+        }
+        double singleThreaded = 0;
+        for (int32_t numThreads : threadCounts) {
+            Result r = measure(*w, settings, numThreads, seconds);
+            if (U_FAILURE(r.errorCode)) {
+                fprintf(stderr, "%s on %d threads failed: %s\n",
+                        w->name, (int)numThreads, u_errorName(r.errorCode));
+                exitCode = r.errorCode;
+                break;
+            }
+            double throughput = r.operations / r.seconds;
+            if (numThreads == 1) { singleThreaded = throughput; }
+            double ops = (double)r.operations;
+            auto missPercent = [&](int32_t hitIndex, int32_t missIndex) {
+                int64_t total = r.metrics[hitIndex] + r.metrics[missIndex];
+                return total > 0 ? 100.0 * r.metrics[missIndex] / total : 0.0;
+            };
+            printf("%-16s %7d %12.0f %14.0f ", w->name, (int)numThreads,
+                   throughput, throughput / numThreads);
+            if (singleThreaded > 0) {
+                printf("%8.2fx ", throughput / singleThreaded);
+            } else {
+                printf("%9s ", "-");
+            }
+            // Allocations stay at 0 without tracing, and every workload allocates.
+            if (r.metrics[M_ALLOC_COUNT] > 0) {
+                haveMetrics = TRUE;
+                printf("%12.3f %8.0f %8.1f %8.1f %8.1f  %s\n",
+                       r.metrics[M_MUTEX_WAIT_COUNT] / ops, r.metrics[M_MUTEX_WAIT_NANOS] / ops,
+                       missPercent(M_UNIFIED_CACHE_HIT, M_UNIFIED_CACHE_MISS),
+                       missPercent(M_RESBUND_CACHE_HIT, M_RESBUND_CACHE_MISS),
+                       missPercent(M_CONVERTER_CACHE_HIT, M_CONVERTER_CACHE_MISS),
+                       r.hottestLock.empty() ? "-" : r.hottestLock.c_str());
+            } else {
+                printf("%12s %8s %8s %8s %8s\n", "-", "-", "-", "-", "-");
+            }
+            fflush(stdout);
+        }
+    }
+    if (!haveMetrics) {
+        printf("(Build ICU with U_ENABLE_TRACING for the mutex and cache metrics.)\n");
+    }
+    return exitCode;
+}
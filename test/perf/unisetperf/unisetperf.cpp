@@ -21,6 +21,7 @@
 #include <string.h>
 #include "unicode/uperf.h"
 #include "unicode/uniset.h"
+#include "unicode/uset.h"
 #include "unicode/unistr.h"
 #include "uoptions.h"
 #include "cmemory.h" // for UPRV_LENGTHOF
@@ -407,6 +408,38 @@ class SpanBackUTF8 : public Command {
     }
 };
 
+// Span throughput via the C API: the whole UTF-8 input
+// in alternating not-contained/contained spans.
+class USetSpanUTF8 : public Command {
+protected:
+    USetSpanUTF8(const UnicodeSetPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UnicodeSetPerformanceTest &testcase) {
+        return new USetSpanUTF8(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const USet *set=testcase.set.toUSet();
+        const char *s=testcase.utf8;
+        int32_t length=testcase.utf8Length;
+        int32_t count=0;
+        int32_t i=0;
+        UBool tf=FALSE;
+        while(i<length) {
+            i+=uset_spanUTF8(set, s+i, length-i, (USetSpanCondition)tf);
+            tf=(UBool)(!tf);
+            ++count;
+        }
+        if(count!=testcase.spanCount) {
+            fprintf(stderr, "error: USetSpanUTF8() count=%ld != %ld=UnicodeSetPerformanceTest.spanCount\n",
+                    (long)count, (long)testcase.spanCount);
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        // Number of UTF-8 bytes spanned.
+        return testcase.utf8Length;
+    }
+};
+
 UPerfFunction* UnicodeSetPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "Contains";     if (exec) return Contains::get(*this); break;
@@ -414,6 +447,7 @@ UPerfFunction* UnicodeSetPerformanceTest::runIndexedTest(int32_t index, UBool ex
         case 2: name = "SpanBackUTF16";if (exec) return SpanBackUTF16::get(*this); break;
         case 3: name = "SpanUTF8";     if (exec) return SpanUTF8::get(*this); break;
         case 4: name = "SpanBackUTF8"; if (exec) return SpanBackUTF8::get(*this); break;
+        case 5: name = "USetSpanUTF8"; if (exec) return USetSpanUTF8::get(*this); break;
         default: name = ""; break;
     }
     return NULL;
@@ -91,3 +91,24 @@
 };
 
 runTests($options, $tests, $dataFiles);
+
+$options = {
+    "title"=>"UnicodeSet UTF-8 span throughput",
+    "headers"=>"slow fast",
+    "operationIs"=>"spanned UTF-8 byte",
+    "passes"=>"3",
+    "time"=>"2",
+    #"outputType"=>"HTML",
+    "dataDir"=>$UDHRDataPath,
+    "outputDir"=>"../results"
+};
+
+$tests = {
+    "USetSpanUTF8",
+    [
+        "$p,USetSpanUTF8 --type slow",
+        "$p,USetSpanUTF8 --type fast"
+    ]
+};
+
+runTests($options, $tests, $dataFiles);
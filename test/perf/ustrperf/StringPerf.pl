@@ -39,6 +39,8 @@
 } else {
     $p = "LD_LIBRARY_PATH=".$ICULatest."/source/lib:".$ICULatest."/source/tools/ctestfw ".$ICUPathLatest."/ustrperf/stringperf -l -u";
 }
+# without -u, for the functions on NUL-terminated strings
+my $pz = substr($p, 0, -3);
 
 my $tests = { 
     "Object Construction(empty string)",      ["$p,TestStdLibCtor"         , "$p,TestCtor"         ],
@@ -53,6 +55,16 @@
     "String Scanning(char)",                  ["$p,TestStdLibScan"         , "$p,TestScan"         ],
     "String Scanning(string)",                ["$p,TestStdLibScan1"        , "$p,TestScan1"        ],
     "String Scanning(char set)",              ["$p,TestStdLibScan2"        , "$p,TestScan2"        ],
+    "Hash Code",                              ["$p,TestStdLibHash"         , "$p,TestHashCode"     ],
+    "Hash Table Key Hash",                    ["$p,TestStdLibHash"         , "$p,TestHashKey"      ],
+    "Equality",                               ["$p,TestStdLibEquals"       , "$p,TestEquals"       ],
+    "String Length",                          ["$pz,TestStdLibStrlen"      , "$pz,TestStrlen"      ],
+    "Find Character",                         ["$p,TestStdLibFindChar"     , "$p,TestFindChar"     ],
+    "Find Character(NUL-terminated)",         ["$pz,TestStdLibFindChar"    , "$pz,TestFindChar"    ],
+    "Find Supplementary Character",           ["$p,TestStdLibFindChar"     , "$p,TestFindChar32"   ],
+    "Count Code Points",                      ["$p,TestStdLibStrlen"       , "$p,TestCountChar32"  ],
+    "Find Substring",                         ["$p,TestStdLibFindFirst"    , "$p,TestFindFirst"    ],
+    "Has More Code Points Than",              ["$p,TestStdLibStrlen"       , "$p,TestHasMoreChar32Than"],
 };
 
 my $dataFiles = {
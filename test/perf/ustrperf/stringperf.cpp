@@ -153,6 +153,22 @@ UPerfFunction* StringPerformanceTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(22, TestStdLibScan1);
         TESTCASE(23, TestStdLibScan2);
 
+        TESTCASE(24, TestHashCode);
+        TESTCASE(25, TestHashKey);
+        TESTCASE(26, TestEquals);
+        TESTCASE(27, TestStdLibHash);
+        TESTCASE(28, TestStdLibEquals);
+
+        TESTCASE(29, TestStrlen);
+        TESTCASE(30, TestFindChar);
+        TESTCASE(31, TestFindChar32);
+        TESTCASE(32, TestCountChar32);
+        TESTCASE(33, TestFindFirst);
+        TESTCASE(34, TestHasMoreChar32Than);
+        TESTCASE(35, TestStdLibStrlen);
+        TESTCASE(36, TestStdLibFindChar);
+        TESTCASE(37, TestStdLibFindFirst);
+
         default: 
             name = ""; 
             return NULL;
@@ -380,3 +396,129 @@ UPerfFunction* StringPerformanceTest::TestStdLibScan2()
 }
 
 
+
+UPerfFunction* StringPerformanceTest::TestHashCode()
+{
+    if (line_mode) {
+        return new StringPerfFunction(hashCode, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(hashCode, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestHashKey()
+{
+    if (line_mode) {
+        return new StringPerfFunction(hashKey, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(hashKey, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestEquals()
+{
+    if (line_mode) {
+        return new StringPerfFunction(equals, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(equals, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestStdLibHash()
+{
+    if (line_mode) {
+        return new StringPerfFunction(StdLibHash, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(StdLibHash, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestStdLibEquals()
+{
+    if (line_mode) {
+        return new StringPerfFunction(StdLibEquals, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(StdLibEquals, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestStrlen()
+{
+    if (line_mode) {
+        return new StringPerfFunction(strLength, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(strLength, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestFindChar()
+{
+    if (line_mode) {
+        return new StringPerfFunction(findChar, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(findChar, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestFindChar32()
+{
+    if (line_mode) {
+        return new StringPerfFunction(findChar32, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(findChar32, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestCountChar32()
+{
+    if (line_mode) {
+        return new StringPerfFunction(countChar32, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(countChar32, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestFindFirst()
+{
+    if (line_mode) {
+        return new StringPerfFunction(findFirst, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(findFirst, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestHasMoreChar32Than()
+{
+    if (line_mode) {
+        return new StringPerfFunction(hasMoreChar32Than, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(hasMoreChar32Than, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestStdLibStrlen()
+{
+    if (line_mode) {
+        return new StringPerfFunction(StdLibStrlen, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(StdLibStrlen, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestStdLibFindChar()
+{
+    if (line_mode) {
+        return new StringPerfFunction(StdLibFindChar, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(StdLibFindChar, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestStdLibFindFirst()
+{
+    if (line_mode) {
+        return new StringPerfFunction(StdLibFindFirst, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(StdLibFindFirst, StrBuffer, StrBufferLen, uselen);
+    }
+}
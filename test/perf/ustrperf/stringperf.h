@@ -12,14 +12,18 @@
 #define _STRINGPERF_H
 
 #include "cmemory.h"
+#include "uhash.h"
 #include "unicode/utypes.h"
 #include "unicode/unistr.h"
+#include "unicode/ustring.h"
 
 #include "unicode/uperf.h"
 
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <functional>
+#include <wchar.h>
 
 typedef std::wstring stlstring;	
 
@@ -365,6 +369,15 @@ class StringPerformanceTest : public UPerfTest
     UPerfFunction* TestScan();
     UPerfFunction* TestScan1();
     UPerfFunction* TestScan2();
+    UPerfFunction* TestHashCode();
+    UPerfFunction* TestHashKey();
+    UPerfFunction* TestEquals();
+    UPerfFunction* TestStrlen();
+    UPerfFunction* TestFindChar();
+    UPerfFunction* TestFindChar32();
+    UPerfFunction* TestCountChar32();
+    UPerfFunction* TestFindFirst();
+    UPerfFunction* TestHasMoreChar32Than();
 
     UPerfFunction* TestStdLibCtor();
     UPerfFunction* TestStdLibCtor1();
@@ -378,6 +391,11 @@ class StringPerformanceTest : public UPerfTest
     UPerfFunction* TestStdLibScan();
     UPerfFunction* TestStdLibScan1();
     UPerfFunction* TestStdLibScan2();
+    UPerfFunction* TestStdLibHash();
+    UPerfFunction* TestStdLibEquals();
+    UPerfFunction* TestStdLibStrlen();
+    UPerfFunction* TestStdLibFindChar();
+    UPerfFunction* TestStdLibFindFirst();
 
 private:
     long COUNT_;
@@ -472,6 +490,64 @@ inline void scan2(const UChar* src,int32_t srcLen, UnicodeString s0)
 }
 
 
+volatile int32_t hash_value;
+volatile UBool equals_result;
+
+inline void hashCode(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    hash_value = s0.hashCode();
+}
+
+// The hash function of UHashtable keys.
+inline void hashKey(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    UElement key;
+    key.pointer = &s0;
+    hash_value = uhash_hashUnicodeString(key);
+}
+
+// Compares with a separate buffer, as with a hash table lookup key.
+inline void equals(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    UnicodeString alias(srcLen==-1, src, srcLen);
+    equals_result = (s0 == alias);
+}
+
+// The ustring.h functions work on the source itself.
+// u_strlen() needs a NUL-terminated string: without -u.
+inline void strLength(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    scan_idx = srcLen==-1 ? u_strlen(src) : srcLen;
+}
+
+inline void findChar(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    const UChar *p = srcLen==-1 ? u_strchr(src, 0x2e) : u_memchr(src, 0x2e, srcLen);
+    scan_idx = p==NULL ? -1 : (int)(p - src);
+}
+
+inline void findChar32(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    const UChar *p = srcLen==-1 ? u_strchr32(src, 0x1f600) : u_memchr32(src, 0x1f600, srcLen);
+    scan_idx = p==NULL ? -1 : (int)(p - src);
+}
+
+inline void countChar32(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    scan_idx = u_countChar32(src, srcLen);
+}
+
+inline void findFirst(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    const UChar *p = u_strFindFirst(src, srcLen, SCAN1, 3);
+    scan_idx = p==NULL ? -1 : (int)(p - src);
+}
+
+inline void hasMoreChar32Than(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    equals_result = u_strHasMoreChar32Than(src, srcLen, 10);
+}
+
 inline void StdLibCtor(const wchar_t* src,int32_t srcLen, stlstring s0)
 {
     stlstring a;
@@ -552,5 +628,35 @@ inline void StdLibScan2(const wchar_t* src,int32_t srcLen, stlstring s0)
     scan_idx = (int) sScan_STRING.find_first_of(L"sm");
 }
 
+inline void StdLibHash(const wchar_t* src,int32_t srcLen, stlstring s0)
+{
+    hash_value = (int32_t)std::hash<stlstring>()(s0);
+}
+
+inline void StdLibEquals(const wchar_t* src,int32_t srcLen, stlstring s0)
+{
+    if (srcLen==-1) {
+        equals_result = (s0 == src);
+    } else {
+        equals_result = (s0.compare(0, s0.length(), src, srcLen) == 0);
+    }
+}
+
+inline void StdLibStrlen(const wchar_t* src,int32_t srcLen, stlstring s0)
+{
+    scan_idx = srcLen==-1 ? (int)wcslen(src) : srcLen;
+}
+
+inline void StdLibFindChar(const wchar_t* src,int32_t srcLen, stlstring s0)
+{
+    const wchar_t *p = srcLen==-1 ? wcschr(src, L'.') : wmemchr(src, L'.', srcLen);
+    scan_idx = p==NULL ? -1 : (int)(p - src);
+}
+
+inline void StdLibFindFirst(const wchar_t* src,int32_t srcLen, stlstring s0)
+{
+    scan_idx = (int) s0.find(L"123");
+}
+
 #endif // STRINGPERF_H
 
@@ -328,11 +328,47 @@ class FromUTF8 : public Command {
     int32_t input8Length;
 };
 
+// Test the UTF-16->UTF-8 string transformation u_strToUTF8().
+class StrToUTF8 : public UPerfFunction {
+public:
+    StrToUTF8(const UtfPerformanceTest &testcase)
+            : input(testcase.getBuffer()), inputLength(testcase.getBufferLen()) {}
+    virtual void call(UErrorCode* pErrorCode){
+        u_strToUTF8(intermediate, OUTPUT_CAPACITY, &encodedLength,
+                    input, inputLength, pErrorCode);
+    }
+    virtual long getOperationsPerIteration() {
+        return countInputCodePoints;
+    }
+protected:
+    const UChar *input;
+    int32_t inputLength;
+};
+
+// Test the UTF-8->UTF-16 string transformation u_strFromUTF8().
+class StrFromUTF8 : public UPerfFunction {
+public:
+    StrFromUTF8(const UtfPerformanceTest & /*testcase*/)
+            : input8(utf8), input8Length(utf8Length) {}
+    virtual void call(UErrorCode* pErrorCode){
+        u_strFromUTF8(output, OUTPUT_CAPACITY, &outputLength,
+                      input8, input8Length, pErrorCode);
+    }
+    virtual long getOperationsPerIteration() {
+        return countInputCodePoints;
+    }
+protected:
+    const char *input8;
+    int32_t input8Length;
+};
+
 UPerfFunction* UtfPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "Roundtrip";     if (exec) return Roundtrip::get(*this); break;
         case 1: name = "FromUnicode";   if (exec) return FromUnicode::get(*this); break;
         case 2: name = "FromUTF8";      if (exec) return FromUTF8::get(*this); break;
+        case 3: name = "StrToUTF8";     if (exec) return new StrToUTF8(*this); break;
+        case 4: name = "StrFromUTF8";   if (exec) return new StrFromUTF8(*this); break;
         default: name = ""; break;
     }
     return NULL;
@@ -19,4 +19,9 @@ rem %PERF% CheckFCDAlwaysGet  -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterati
 rem %PERF% CheckFCDUTF8       -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
     %PERF% ToNFC              -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
     %PERF% GetBiDiClass       -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
+    %PERF% GetGeneralCategory -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
+    %PERF% ToLowerSimple      -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
+    %PERF% ScriptRuns         -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
+    %PERF% ScriptRunsUTF8     -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
+    %PERF% ScriptRunIterator  -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
 )
@@ -23,7 +23,9 @@
 #include "unicode/uchar.h"
 #include "unicode/unorm.h"
 #include "unicode/uperf.h"
+#include "unicode/uscript.h"
 #include "uoptions.h"
+#include "usc_impl.h"
 
 #if 0
 // Left over from when icu/branches/markus/utf8 could use both old UTrie
@@ -229,14 +231,142 @@ class GetBiDiClass : public Command {
     }
 };
 
+class GetGeneralCategory : public Command {
+protected:
+    GetGeneralCategory(const UTrie2PerfTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new GetGeneralCategory(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *buffer=testcase.getBuffer();
+        int32_t length=testcase.getBufferLen();
+        UChar32 c;
+        int32_t i;
+        uint32_t bitSet=0;
+        for(i=0; i<length;) {
+            U16_NEXT(buffer, i, length, c);
+            bitSet|=(uint32_t)1<<u_charType(c);
+        }
+        if(length>0 && bitSet==0) {
+            fprintf(stderr, "error: GetGeneralCategory() did not collect bits\n");
+        }
+    }
+};
+
+class ToLowerSimple : public Command {
+protected:
+    ToLowerSimple(const UTrie2PerfTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new ToLowerSimple(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *buffer=testcase.getBuffer();
+        int32_t length=testcase.getBufferLen();
+        UChar32 c;
+        int32_t i;
+        UChar32 sum=0;
+        for(i=0; i<length;) {
+            U16_NEXT(buffer, i, length, c);
+            sum+=u_tolower(c);
+        }
+        if(length>0 && sum==0) {
+            fprintf(stderr, "error: ToLowerSimple() did not sum up code points\n");
+        }
+    }
+};
+
+// Script runs with Script_Extensions, one trie lookup per code point.
+class ScriptRuns : public Command {
+protected:
+    ScriptRuns(const UTrie2PerfTest &testcase) : Command(testcase) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        capacity=uscript_getScriptRuns(testcase.getBuffer(), testcase.getBufferLen(),
+                                       NULL, 0, &errorCode);
+        runs=new UScriptRunInfo[capacity>0 ? capacity : 1];
+    }
+    ~ScriptRuns() {
+        delete [] runs;
+    }
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new ScriptRuns(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        int32_t count=uscript_getScriptRuns(testcase.getBuffer(), testcase.getBufferLen(),
+                                            runs, capacity, &errorCode);
+        if(U_FAILURE(errorCode) || count!=capacity) {
+            fprintf(stderr, "error: uscript_getScriptRuns() failed: %s\n",
+                    u_errorName(errorCode));
+        }
+    }
+
+protected:
+    UScriptRunInfo *runs;
+    int32_t capacity;
+};
+
+class ScriptRunsUTF8 : public ScriptRuns {
+protected:
+    ScriptRunsUTF8(const UTrie2PerfTest &testcase) : ScriptRuns(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new ScriptRunsUTF8(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        int32_t count=uscript_getScriptRunsUTF8(testcase.utf8, testcase.utf8Length,
+                                                runs, capacity, &errorCode);
+        if(U_FAILURE(errorCode) || count!=capacity) {
+            fprintf(stderr, "error: uscript_getScriptRunsUTF8() failed: %s\n",
+                    u_errorName(errorCode));
+        }
+    }
+};
+
+// For comparison: The UScriptRun iterator looks up Script and Script_Extensions separately.
+class ScriptRunIterator : public Command {
+protected:
+    ScriptRunIterator(const UTrie2PerfTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new ScriptRunIterator(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UScriptRun *scriptRun=uscript_openRun(testcase.getBuffer(), testcase.getBufferLen(),
+                                              &errorCode);
+        if(U_FAILURE(errorCode)) {
+            fprintf(stderr, "error: uscript_openRun() failed: %s\n", u_errorName(errorCode));
+            return;
+        }
+        int32_t runStart, runLimit, count=0;
+        UScriptCode script;
+        while(uscript_nextRun(scriptRun, &runStart, &runLimit, &script)) {
+            ++count;
+        }
+        uscript_closeRun(scriptRun);
+        if(testcase.getBufferLen()>0 && count==0) {
+            fprintf(stderr, "error: ScriptRunIterator() did not find any runs\n");
+        }
+    }
+};
+
 UPerfFunction* UTrie2PerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "CheckFCD";              if (exec) return CheckFCD::get(*this); break;
         case 1: name = "ToNFC";                 if (exec) return ToNFC::get(*this); break;
         case 2: name = "GetBiDiClass";          if (exec) return GetBiDiClass::get(*this); break;
+        case 3: name = "GetGeneralCategory";    if (exec) return GetGeneralCategory::get(*this); break;
+        case 4: name = "ToLowerSimple";         if (exec) return ToLowerSimple::get(*this); break;
+        case 5: name = "ScriptRuns";            if (exec) return ScriptRuns::get(*this); break;
+        case 6: name = "ScriptRunsUTF8";        if (exec) return ScriptRunsUTF8::get(*this); break;
+        case 7: name = "ScriptRunIterator";     if (exec) return ScriptRunIterator::get(*this); break;
 #if 0  // See comment at unorm_initUTrie2() forward declaration.
-        case 3: name = "CheckFCDAlwaysGet";     if (exec) return CheckFCDAlwaysGet::get(*this); break;
-        case 4: name = "CheckFCDUTF8";          if (exec) return CheckFCDUTF8::get(*this); break;
+        case 8: name = "CheckFCDAlwaysGet";     if (exec) return CheckFCDAlwaysGet::get(*this); break;
+        case 9: name = "CheckFCDUTF8";          if (exec) return CheckFCDUTF8::get(*this); break;
 #endif
         default: name = ""; break;
     }
@@ -25,4 +25,9 @@ for file in udhr_eng.txt \
 # $PERF CheckFCDUTF8        -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
   $PERF ToNFC               -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
   $PERF GetBiDiClass        -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF GetGeneralCategory  -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF ToLowerSimple       -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF ScriptRuns          -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF ScriptRunsUTF8      -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF ScriptRunIterator   -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
 done
@@ -93,6 +93,8 @@ class T_CTEST_EXPORT_API UPerfFunction {
     /**
      * Subclasses must implement this method to do the action to be
      * measured.
+     * With the --threads option, call() runs concurrently on the same object,
+     * so it must then not modify shared state without synchronization.
      */
     virtual void call(UErrorCode* status)=0;
 
@@ -185,7 +187,13 @@ class T_CTEST_EXPORT_API UPerfTest {
     int32_t      iterations;
     int32_t      time;
     const char*  locale;
+    int32_t      warmups;
+    int32_t      threads;
+    UBool        percentiles;
+    const char*  jsonFileName;
 private:
+    UBool runTests();
+
     UPerfTest*   caller;
     char*        path;           // specifies subtests
 
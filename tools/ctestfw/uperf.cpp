@@ -15,6 +15,11 @@
 #include "cmemory.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
 
 #if !UCONFIG_NO_CONVERSION
 
@@ -43,7 +48,12 @@ const char UPerfTest::gUsageString[] =
     "\t-l or --line-mode    The data file should be processed in line mode\n"
     "\t-b or --bulk-mode    The data file should be processed in file based.\n"
     "\t                     Cannot be used with --line-mode\n"
-    "\t-L or --locale       Locale for the test\n";
+    "\t-L or --locale       Locale for the test\n"
+    "\t--warmup             Number of untimed passes before the timed ones. Requires Numeric argument.\n"
+    "\t--threads            Number of threads that run each test function concurrently.\n"
+    "\t                     Requires Numeric argument. Test functions must be thread-safe.\n"
+    "\t--percentiles        Also time each iteration individually, and print latency percentiles\n"
+    "\t--json               Write the results as JSON to the file, or to stdout for \"-\"\n";
 
 enum
 {
@@ -60,6 +70,10 @@ enum
     LINE_MODE,
     BULK_MODE,
     LOCALE,
+    WARMUP,
+    THREADS,
+    PERCENTILES,
+    JSON,
     OPTIONS_COUNT
 };
 
@@ -77,9 +91,141 @@ static UOption options[OPTIONS_COUNT+20]={
     UOPTION_DEF( "time",          't', UOPT_REQUIRES_ARG),
     UOPTION_DEF( "line-mode",     'l', UOPT_NO_ARG),
     UOPTION_DEF( "bulk-mode",     'b', UOPT_NO_ARG),
-    UOPTION_DEF( "locale",        'L', UOPT_REQUIRES_ARG)
+    UOPTION_DEF( "locale",        'L', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "warmup",        '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "threads",       '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "percentiles",   '\x01', UOPT_NO_ARG),
+    UOPTION_DEF( "json",          '\x01', UOPT_REQUIRES_ARG)
 };
 
+// Results of all tests in this process, as comma-separated JSON objects.
+static std::string gJsonResults;
+
+/**
+ * Runs the loops like UPerfFunction::time() on the calling thread, or
+ * concurrently on numThreads threads that start at the same time.
+ * Returns the elapsed wall-clock seconds.
+ */
+static double timeConcurrently(UPerfFunction *function, int32_t loops, int32_t numThreads,
+                               UErrorCode *status) {
+    if (numThreads <= 1) {
+        return function->time(loops, status);
+    }
+    std::atomic<int32_t> numReady(0);
+    std::atomic<bool> go(false);
+    std::vector<UErrorCode> codes(numThreads, U_ZERO_ERROR);
+    std::vector<std::thread> workers;
+    for (int32_t i = 0; i < numThreads; ++i) {
+        workers.emplace_back([&, i]() {
+            numReady.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int32_t n = loops; n > 0; --n) {
+                function->call(&codes[i]);
+            }
+        });
+    }
+    while (numReady.load() < numThreads) {
+        std::this_thread::yield();
+    }
+    UTimer start, stop;
+    utimer_getTime(&start);
+    go.store(true, std::memory_order_release);
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    utimer_getTime(&stop);
+    for (UErrorCode code : codes) {
+        if (U_FAILURE(code)) {
+            *status = code;
+        }
+    }
+    return utimer_getDeltaSeconds(&start, &stop);
+}
+
+/**
+ * Times each call() individually on each of numThreads threads,
+ * and returns the sorted latencies in nanoseconds.
+ * The timer overhead is included, which matters only for very fast functions.
+ */
+static std::vector<double> measureLatencies(UPerfFunction *function, int32_t loops,
+                                            int32_t numThreads, UErrorCode *status) {
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+    std::vector<std::vector<double> > samples(numThreads);
+    std::vector<UErrorCode> codes(numThreads, U_ZERO_ERROR);
+    auto measure = [&](int32_t i) {
+        std::vector<double> &latencies = samples[i];
+        latencies.reserve(loops);
+        UTimer start, stop;
+        for (int32_t n = loops; n > 0; --n) {
+            utimer_getTime(&start);
+            function->call(&codes[i]);
+            utimer_getTime(&stop);
+            latencies.push_back(utimer_getDeltaSeconds(&start, &stop) * 1E9);
+        }
+    };
+    if (numThreads == 1) {
+        measure(0);
+    } else {
+        std::vector<std::thread> workers;
+        for (int32_t i = 0; i < numThreads; ++i) {
+            workers.emplace_back(measure, i);
+        }
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+    std::vector<double> all;
+    for (int32_t i = 0; i < numThreads; ++i) {
+        if (U_FAILURE(codes[i])) {
+            *status = codes[i];
+        }
+        all.insert(all.end(), samples[i].begin(), samples[i].end());
+    }
+    std::sort(all.begin(), all.end());
+    return all;
+}
+
+/** Nearest-rank percentile of sorted values, for 0<p<=100. */
+static double getPercentile(const std::vector<double> &sorted, double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t rank = (size_t)(p / 100 * sorted.size() + 0.999999);
+    if (rank < 1) {
+        rank = 1;
+    } else if (rank > sorted.size()) {
+        rank = sorted.size();
+    }
+    return sorted[rank - 1];
+}
+
+static void appendJsonString(std::string &json, const char *s) {
+    json.push_back('"');
+    for (; *s != 0; ++s) {
+        if (*s == '"' || *s == '\\') {
+            json.push_back('\\');
+            json.push_back(*s);
+        } else if ((uint8_t)*s < 0x20) {
+            char escape[8];
+            sprintf(escape, "\\u%04x", (int)(uint8_t)*s);
+            json.append(escape);
+        } else {
+            json.push_back(*s);
+        }
+    }
+    json.push_back('"');
+}
+
+static void appendJsonNumber(std::string &json, const char *key, double value) {
+    char buffer[64];
+    sprintf(buffer, ", \"%s\": %.6g", key, value);
+    json.append(buffer);
+}
+
 UPerfTest::UPerfTest(int32_t argc, const char* argv[], UErrorCode& status)
         : _argc(argc), _argv(argv), _addUsage(NULL),
           ucharBuf(NULL), encoding(""),
@@ -89,7 +235,8 @@ UPerfTest::UPerfTest(int32_t argc, const char* argv[], UErrorCode& status)
           buffer(NULL), bufferLen(0),
           verbose(FALSE), bulk_mode(FALSE),
           passes(1), iterations(0), time(0),
-          locale(NULL) {
+          locale(NULL), warmups(0), threads(1),
+          percentiles(FALSE), jsonFileName(NULL) {
     init(NULL, 0, status);
 }
 
@@ -105,7 +252,8 @@ UPerfTest::UPerfTest(int32_t argc, const char* argv[],
           buffer(NULL), bufferLen(0),
           verbose(FALSE), bulk_mode(FALSE),
           passes(1), iterations(0), time(0),
-          locale(NULL) {
+          locale(NULL), warmups(0), threads(1),
+          percentiles(FALSE), jsonFileName(NULL) {
     init(addOptions, addOptionsCount, status);
 }
 
@@ -186,6 +334,26 @@ void UPerfTest::init(UOption addOptions[], int32_t addOptionsCount,
         locale = options[LOCALE].value;
     }
 
+    if(options[WARMUP].doesOccur) {
+        warmups = atoi(options[WARMUP].value);
+    }
+
+    if(options[THREADS].doesOccur) {
+        threads = atoi(options[THREADS].value);
+        if(threads < 1) {
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+    }
+
+    if(options[PERCENTILES].doesOccur) {
+        percentiles = TRUE;
+    }
+
+    if(options[JSON].doesOccur) {
+        jsonFileName = options[JSON].value;
+    }
+
     int32_t len = 0;
     if(fileName!=NULL){
         //pre-flight
@@ -260,6 +428,22 @@ const UChar* UPerfTest::getBuffer(int32_t& len, UErrorCode& status){
     return buffer;
 }
 UBool UPerfTest::run(){
+    gJsonResults.clear();
+    UBool res=runTests();
+    if(jsonFileName != NULL) {
+        FILE *jsonFile = strcmp(jsonFileName, "-") == 0 ? stdout : fopen(jsonFileName, "w");
+        if(jsonFile == NULL) {
+            fprintf(stderr, "Unable to write the JSON results to %s\n", jsonFileName);
+            return FALSE;
+        }
+        fprintf(jsonFile, "{\"tests\": [\n%s\n]}\n", gJsonResults.c_str());
+        if(jsonFile != stdout) {
+            fclose(jsonFile);
+        }
+    }
+    return res;
+}
+UBool UPerfTest::runTests(){
     if(_remainingArgc==1){
         // Testing all methods
         return runTest();
@@ -408,8 +592,16 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                 loops = iterations;
             }
 
+            for(int32_t w = 0; w < warmups && U_SUCCESS(status); w++){
+                if(verbose==TRUE){
+                    fprintf(stdout, "#= %s warmup %i\n", name, (int)w);
+                }
+                timeConcurrently(testFunction, loops, threads, &status);
+            }
+
             double min_t=1000000.0, sum_t=0.0;
             long events = -1;
+            std::vector<double> passTimes;
 
             for(int32_t ps =0; ps < passes; ps++){
                 fprintf(stdout,"= %s begin " ,name);
@@ -422,11 +614,12 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                 } else {
                     fprintf(stdout, "\n");
                 }
-                t = testFunction->time(loops, &status);
+                t = timeConcurrently(testFunction, loops, threads, &status);
                 if(U_FAILURE(status)){
                     printf("Performance test failed with error: %s \n", u_errorName(status));
                     break;
                 }
+                passTimes.push_back(t);
                 sum_t+=t;
                 if(t<min_t) {
                     min_t=t;
@@ -465,6 +658,59 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                             name, min_t, (int)loops, (min_t*1E9)/(loops*ops), (min_t*1E9)/(loops*events));
                 }
             }
+            // The extra results lines start with '#' so that the perldriver ignores them.
+            double avg_t = passTimes.empty() ? 0 : sum_t/passTimes.size();
+            if(threads > 1 && avg_t > 0) {
+                fprintf(stdout, "#= %s threads: %i throughput: %.4g ops/s\n",
+                        name, (int)threads, ((double)threads*loops*ops)/avg_t);
+            }
+            std::vector<double> latencies;
+            if(percentiles && U_SUCCESS(status)) {
+                latencies = measureLatencies(testFunction, loops, threads, &status);
+                if(U_FAILURE(status)){
+                    printf("Performance test failed with error: %s \n", u_errorName(status));
+                } else {
+                    fprintf(stdout, "#= %s p50: %.4g ns p90: %.4g ns p99: %.4g ns max: %.4g ns\n",
+                            name, getPercentile(latencies, 50), getPercentile(latencies, 90),
+                            getPercentile(latencies, 99), latencies.empty() ? 0 : latencies.back());
+                }
+            }
+            if(jsonFileName != NULL && !passTimes.empty()) {
+                std::string &json = gJsonResults;
+                if(!json.empty()) {
+                    json.append(",\n");
+                }
+                json.append("    {\"name\": ");
+                appendJsonString(json, name);
+                appendJsonNumber(json, "threads", threads);
+                appendJsonNumber(json, "loops", loops);
+                appendJsonNumber(json, "operationsPerIteration", (double)ops);
+                if(events != -1) {
+                    appendJsonNumber(json, "eventsPerIteration", (double)events);
+                }
+                appendJsonNumber(json, "warmupPasses", warmups);
+                json.append(", \"seconds\": [");
+                for(size_t i = 0; i < passTimes.size(); ++i) {
+                    char buffer[32];
+                    sprintf(buffer, i == 0 ? "%.6g" : ", %.6g", passTimes[i]);
+                    json.append(buffer);
+                }
+                json.append("]");
+                appendJsonNumber(json, "meanSeconds", avg_t);
+                appendJsonNumber(json, "minSeconds", min_t);
+                appendJsonNumber(json, "meanNsPerOperation", (avg_t*1E9)/((double)loops*ops));
+                appendJsonNumber(json, "minNsPerOperation", (min_t*1E9)/((double)loops*ops));
+                if(avg_t > 0) {
+                    appendJsonNumber(json, "operationsPerSecond", ((double)threads*loops*ops)/avg_t);
+                }
+                if(!latencies.empty()) {
+                    appendJsonNumber(json, "p50Ns", getPercentile(latencies, 50));
+                    appendJsonNumber(json, "p90Ns", getPercentile(latencies, 90));
+                    appendJsonNumber(json, "p99Ns", getPercentile(latencies, 99));
+                    appendJsonNumber(json, "maxNs", latencies.back());
+                }
+                json.append("}");
+            }
             delete testFunction;
         }
         index++;
@@ -21,6 +21,8 @@
 #include "unicode/bytestriebuilder.h"
 #include "unicode/ucharstrie.h"
 #include "unicode/bytestrie.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/ucnv.h"
 #include "unicode/ustring.h"
 #include "unicode/utf16.h"
@@ -38,6 +40,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <utility>
+#include <vector>
 
 #include "putilimp.h"
 UDate startTime;
@@ -59,6 +66,7 @@ static UOption options[]={
     { "bytes", NULL, NULL, NULL, '\1', UOPT_NO_ARG, 0}, /* 7 */
     { "transform", NULL, NULL, NULL, '\1', UOPT_REQUIRES_ARG, 0}, /* 8 */
     UOPTION_QUIET,              /* 9 */
+    { "doublearray", NULL, NULL, NULL, '\1', UOPT_NO_ARG, 0}, /* 10 */
 };
 
 enum arguments {
@@ -70,7 +78,8 @@ enum arguments {
     ARG_UCHARS,
     ARG_BYTES,
     ARG_TRANSFORM,
-    ARG_QUIET
+    ARG_QUIET,
+    ARG_DOUBLE_ARRAY
 };
 
 // prints out the standard usage method describing command line arguments, 
@@ -89,6 +98,8 @@ static void usageAndDie(UErrorCode retCode) {
            "\t                    followed by path, defaults to %s\n"
            "\t--uchars            output a UCharsTrie (mutually exclusive with -b!)\n"
            "\t--bytes             output a BytesTrie (mutually exclusive with -u!)\n"
+           "\t--doublearray       output a double-array trie, which is larger but faster to match\n"
+           "\t                    (mutually exclusive with --uchars and --bytes)\n"
            "\t--transform         the kind of transform to use (eg --transform offset-40A3,\n"
            "\t                    which specifies an offset transform with constant 0x40A3)\n",
             u_getDataDirectory());
@@ -113,6 +124,249 @@ static UDataInfo dataInfo = {
 
 #if !UCONFIG_NO_BREAK_ITERATION
 
+// Builds a double-array trie (DictionaryData::TRIE_TYPE_DOUBLE_ARRAY)
+// from the words, see the format description in dictionarydata.h.
+class DoubleArrayBuilder {
+private:
+    static const size_t WIDE_CHILD_COUNT = 8;
+    static const uint8_t MAX_FAILURES = 32;
+
+    struct Word {
+        UnicodeString s;
+        int32_t value;
+        bool operator<(const Word &other) const { return s.compareCodePointOrder(other.s) < 0; }
+    };
+    struct Node {
+        std::vector<std::pair<int32_t, int32_t> > children;  // (code, node index)
+        UBool hasValue;
+        int32_t value;
+        Node() : hasValue(FALSE), value(0) {}
+    };
+
+    // A set of cells with a "lowest member >=i" lookup,
+    // implemented like a union-find with path compression.
+    // All cells beyond the current size are members.
+    class CellSet {
+    public:
+        int32_t next(int32_t cell) {
+            grow(cell);
+            int32_t f = cell;
+            while (nextMember[f] != f) {
+                f = nextMember[f];
+                grow(f);
+            }
+            while (nextMember[cell] != f) {
+                int32_t n = nextMember[cell];
+                nextMember[cell] = f;
+                cell = n;
+            }
+            return f;
+        }
+        UBool contains(int32_t cell) { return next(cell) == cell; }
+        void remove(int32_t cell) {
+            grow(cell + 1);
+            nextMember[cell] = cell + 1;
+        }
+    private:
+        void grow(int32_t cell) {
+            int32_t oldSize = (int32_t)nextMember.size();
+            if (oldSize <= cell) {
+                int32_t newSize = cell + 1 + oldSize / 2;
+                nextMember.resize(newSize);
+                for (int32_t i = oldSize; i < newSize; ++i) {
+                    nextMember[i] = i;
+                }
+            }
+        }
+        std::vector<int32_t> nextMember;
+    };
+
+    std::vector<Word> words;
+    std::vector<Node> nodes;
+    std::vector<int32_t> cells;  // pairs of (base, check)
+    // the free cells, and the ones of them that are still tried for the first child of a wide state
+    CellSet freeCells, candidates;
+    std::vector<uint8_t> failures;
+    UMutableCPTrie *codes;
+    int32_t codeCount;
+
+    // assigns code 1 to the most frequent code point, etc.,
+    // so that the child codes of most states are small and close together
+    void assignCodes(UErrorCode &status) {
+        std::map<UChar32, int32_t> counts;
+        for (size_t i = 0; i < words.size(); ++i) {
+            const UnicodeString &s = words[i].s;
+            UChar32 c;
+            for (int32_t j = 0; j < s.length(); j += U16_LENGTH(c)) {
+                c = s.char32At(j);
+                ++counts[c];
+            }
+        }
+        std::vector<std::pair<int32_t, UChar32> > byCount;
+        for (std::map<UChar32, int32_t>::const_iterator it = counts.begin(); it != counts.end(); ++it) {
+            byCount.push_back(std::make_pair(-it->second, it->first));
+        }
+        std::sort(byCount.begin(), byCount.end());
+        codes = umutablecptrie_open(0, 0, &status);
+        for (size_t i = 0; i < byCount.size(); ++i) {
+            umutablecptrie_set(codes, byCount[i].second, (uint32_t)(i + 1), &status);
+        }
+        codeCount = (int32_t)byCount.size();
+    }
+
+    void buildNodes() {
+        nodes.resize(1);  // root
+        for (size_t i = 0; i < words.size(); ++i) {
+            const UnicodeString &s = words[i].s;
+            int32_t node = 0;
+            UChar32 c;
+            for (int32_t j = 0; j < s.length(); j += U16_LENGTH(c)) {
+                c = s.char32At(j);
+                int32_t code = (int32_t)umutablecptrie_get(codes, c);
+                // The words are sorted, so an existing child for c was the last one added.
+                std::vector<std::pair<int32_t, int32_t> > &children = nodes[node].children;
+                if (!children.empty() && children.back().first == code) {
+                    node = children.back().second;
+                } else {
+                    int32_t child = (int32_t)nodes.size();
+                    children.push_back(std::make_pair(code, child));
+                    nodes.resize(nodes.size() + 1);
+                    node = child;
+                }
+            }
+            nodes[node].hasValue = TRUE;
+            nodes[node].value = words[i].value;
+        }
+    }
+
+    void setUsed(int32_t cell) {
+        freeCells.remove(cell);
+        candidates.remove(cell);
+        if ((int32_t)cells.size() <= 2 * cell) {
+            cells.resize(2 * (cell + 1 + cell / 2), 0);
+        }
+    }
+
+    // Finds the lowest base for which all of the codes lead to free cells.
+    // Only bases that put the lowest code onto a free cell are tried.
+    // For states with many children, a cell where that failed many times
+    // is not tried any more, which trades a little density for much less searching.
+    int32_t findBase(const std::vector<int32_t> &childCodes) {
+        UBool isWide = childCodes.size() >= WIDE_CHILD_COUNT;
+        CellSet &starts = isWide ? candidates : freeCells;
+        for (int32_t f = starts.next(childCodes[0]);; f = starts.next(f + 1)) {
+            int32_t base = f - childCodes[0];
+            size_t i = 1;
+            while (i < childCodes.size() && freeCells.contains(base + childCodes[i])) {
+                ++i;
+            }
+            if (i == childCodes.size()) {
+                return base;
+            }
+            if (isWide) {
+                if ((int32_t)failures.size() <= f) {
+                    failures.resize(f + 1 + f / 2, 0);
+                }
+                if (++failures[f] == MAX_FAILURES) {
+                    candidates.remove(f);
+                }
+            }
+        }
+    }
+
+public:
+    DoubleArrayBuilder() : codes(NULL), codeCount(0) {}
+    ~DoubleArrayBuilder() {
+        umutablecptrie_close(codes);
+    }
+
+    void addWord(const UnicodeString &word, int32_t value) {
+        Word w;
+        w.s = word;
+        w.value = value;
+        words.push_back(w);
+    }
+
+    // builds the cells and the serialized code map
+    void build(std::vector<int32_t> &outCells, std::vector<uint8_t> &outCodeMap, UErrorCode &status) {
+        if (U_FAILURE(status)) { return; }
+        std::sort(words.begin(), words.end());
+        for (size_t i = 1; i < words.size(); ++i) {
+            if (words[i].s == words[i - 1].s) {
+                status = U_ILLEGAL_ARGUMENT_ERROR;  // duplicate word, as in the string trie builders
+                return;
+            }
+        }
+        for (size_t i = 0; i < words.size(); ++i) {
+            if (words[i].value < 0) {
+                fprintf(stderr, "gendict: a double-array trie requires values 0..0x7fffffff\n");
+                status = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+        }
+        assignCodes(status);
+        if (U_FAILURE(status)) { return; }
+        buildNodes();
+
+        // Place the states with the most children first, while there is more room
+        // for them at low bases; each at the lowest base that fits.
+        setUsed(0);
+        setUsed(1);
+        std::priority_queue<std::pair<int32_t, std::pair<int32_t, int32_t> > > queue;  // (children, (node index, state))
+        queue.push(std::make_pair((int32_t)nodes[0].children.size(), std::make_pair(0, 1)));
+        std::vector<int32_t> childCodes;
+        while (!queue.empty()) {
+            const Node &node = nodes[queue.top().second.first];
+            int32_t state = queue.top().second.second;
+            queue.pop();
+            if (node.children.empty()) {
+                cells[2 * state] = ~node.value;
+                continue;
+            }
+            childCodes.clear();
+            if (node.hasValue) {
+                childCodes.push_back(0);
+            }
+            for (size_t i = 0; i < node.children.size(); ++i) {
+                childCodes.push_back(node.children[i].first);
+            }
+            std::sort(childCodes.begin(), childCodes.end());
+            int32_t base = findBase(childCodes);
+            for (size_t i = 0; i < childCodes.size(); ++i) {
+                setUsed(base + childCodes[i]);
+                cells[2 * (base + childCodes[i]) + 1] = state;
+            }
+            cells[2 * state] = base;
+            if (node.hasValue) {
+                cells[2 * base] = node.value;
+            }
+            for (size_t i = 0; i < node.children.size(); ++i) {
+                int32_t child = node.children[i].second;
+                queue.push(std::make_pair((int32_t)nodes[child].children.size(),
+                                          std::make_pair(child, base + node.children[i].first)));
+            }
+        }
+        // trim the unused cells at the end
+        int32_t cellCount = (int32_t)cells.size() / 2;
+        while (cellCount > 2 && freeCells.contains(cellCount - 1)) {
+            --cellCount;
+        }
+        cells.resize(2 * cellCount);
+        outCells.swap(cells);
+
+        LocalUCPTriePointer codeMap(umutablecptrie_buildImmutable(
+            codes, UCPTRIE_TYPE_FAST,
+            codeCount <= 0xffff ? UCPTRIE_VALUE_BITS_16 : UCPTRIE_VALUE_BITS_32, &status));
+        if (U_FAILURE(status)) { return; }
+        int32_t length = ucptrie_toBinary(codeMap.getAlias(), NULL, 0, &status);
+        if (status != U_BUFFER_OVERFLOW_ERROR) { return; }
+        status = U_ZERO_ERROR;
+        // pad to a multiple of 4 bytes
+        outCodeMap.assign((length + 3) & ~3, 0);
+        ucptrie_toBinary(codeMap.getAlias(), &outCodeMap[0], length, &status);
+    }
+};
+
 // A wrapper for both BytesTrieBuilder and UCharsTrieBuilder.
 // may want to put this somewhere in ICU, as it could be useful outside
 // of this tool?
@@ -120,25 +374,29 @@ class DataDict {
 private:
     BytesTrieBuilder *bt;
     UCharsTrieBuilder *ut;
+    DoubleArrayBuilder *dab;
     UChar32 transformConstant;
     int32_t transformType;
 public:
     // constructs a new data dictionary. if there is an error, 
     // it will be returned in status
-    // isBytesTrie != 0 will produce a BytesTrieBuilder,
-    // isBytesTrie == 0 will produce a UCharsTrieBuilder
-    DataDict(UBool isBytesTrie, UErrorCode &status) : bt(NULL), ut(NULL), 
+    // trieType is one of DictionaryData::TRIE_TYPE_BYTES, TRIE_TYPE_UCHARS
+    // and TRIE_TYPE_DOUBLE_ARRAY
+    DataDict(int32_t trieType, UErrorCode &status) : bt(NULL), ut(NULL), dab(NULL),
         transformConstant(0), transformType(DictionaryData::TRANSFORM_NONE) {
-        if (isBytesTrie) {
+        if (trieType == DictionaryData::TRIE_TYPE_BYTES) {
             bt = new BytesTrieBuilder(status);
-        } else {
+        } else if (trieType == DictionaryData::TRIE_TYPE_UCHARS) {
             ut = new UCharsTrieBuilder(status);
+        } else {
+            dab = new DoubleArrayBuilder();
         }
     }
 
     ~DataDict() {
         delete bt;
         delete ut;
+        delete dab;
     }
 
 private:
@@ -199,6 +457,7 @@ class DataDict {
             bt->add(buf.toStringPiece(), value, status);
         }
         if (ut) { ut->add(word, value, status); }
+        if (dab) { dab->addWord(word, value); }
     }
 
     // if we are a bytestrie, give back the StringPiece representing the serialized version of us
@@ -211,6 +470,11 @@ class DataDict {
         ut->buildUnicodeString(USTRINGTRIE_BUILD_SMALL, s, status);
     }
 
+    // if we are a double-array trie, produce the cells and the serialized code map
+    void serializeDoubleArray(std::vector<int32_t> &cells, std::vector<uint8_t> &codeMap, UErrorCode &status) {
+        dab->build(cells, codeMap, status);
+    }
+
     int32_t getTransform() {
         return (int32_t)(transformType | transformConstant); 
     }
@@ -281,11 +545,15 @@ int  main(int argc, char **argv) {
         copyright = U_COPYRIGHT_STRING;
     }
 
-    if (options[ARG_UCHARS].doesOccur == options[ARG_BYTES].doesOccur) {
+    if (options[ARG_UCHARS].doesOccur + options[ARG_BYTES].doesOccur +
+            options[ARG_DOUBLE_ARRAY].doesOccur != 1) {
         fprintf(stderr, "you must specify exactly one type of trie to output!\n");
         usageAndDie(U_ILLEGAL_ARGUMENT_ERROR);
     }
     UBool isBytesTrie = options[ARG_BYTES].doesOccur;
+    UBool isDoubleArray = options[ARG_DOUBLE_ARRAY].doesOccur;
+    int32_t trieType = isBytesTrie ? DictionaryData::TRIE_TYPE_BYTES :
+        isDoubleArray ? DictionaryData::TRIE_TYPE_DOUBLE_ARRAY : DictionaryData::TRIE_TYPE_UCHARS;
     if (isBytesTrie != options[ARG_TRANSFORM].doesOccur) {
         fprintf(stderr, "you must provide a transformation for a bytes trie, and must not provide one for a uchars trie!\n");
         usageAndDie(U_ILLEGAL_ARGUMENT_ERROR);
@@ -319,8 +587,11 @@ int  main(int argc, char **argv) {
         fprintf(stderr, "error opening input file: ICU Error \"%s\"\n", status.errorName());
         exit(status.reset());
     }
-    if (verbose) { printf("Initializing dictionary builder of type %s...\n", (isBytesTrie ? "BytesTrie" : "UCharsTrie")); }
-    DataDict dict(isBytesTrie, status);
+    if (verbose) {
+        printf("Initializing dictionary builder of type %s...\n",
+               (isBytesTrie ? "BytesTrie" : isDoubleArray ? "double-array trie" : "UCharsTrie"));
+    }
+    DataDict dict(trieType, status);
     if (status.isFailure()) {
         fprintf(stderr, "new DataDict: ICU Error \"%s\"\n", status.errorName());
         exit(status.reset());
@@ -403,10 +674,16 @@ int  main(int argc, char **argv) {
     int32_t outDataSize;
     const void *outData;
     UnicodeString usp;
+    std::vector<int32_t> cells;
+    std::vector<uint8_t> codeMap;
     if (isBytesTrie) {
         StringPiece sp = dict.serializeBytes(status);
         outDataSize = sp.size();
         outData = sp.data();
+    } else if (isDoubleArray) {
+        dict.serializeDoubleArray(cells, codeMap, status);
+        outDataSize = (int32_t)(cells.size() * sizeof(int32_t));
+        outData = cells.empty() ? NULL : &cells[0];
     } else {
         dict.serializeUChars(usp, status);
         outDataSize = usp.length() * U_SIZEOF_UCHAR;
@@ -429,10 +706,11 @@ int  main(int argc, char **argv) {
     };
     int32_t size = outDataSize + indexes[DictionaryData::IX_STRING_TRIE_OFFSET];
     indexes[DictionaryData::IX_RESERVED1_OFFSET] = size;
+    size += (int32_t)codeMap.size();
     indexes[DictionaryData::IX_RESERVED2_OFFSET] = size;
     indexes[DictionaryData::IX_TOTAL_SIZE] = size;
 
-    indexes[DictionaryData::IX_TRIE_TYPE] = isBytesTrie ? DictionaryData::TRIE_TYPE_BYTES : DictionaryData::TRIE_TYPE_UCHARS;
+    indexes[DictionaryData::IX_TRIE_TYPE] = trieType;
     if (hasValues) {
         indexes[DictionaryData::IX_TRIE_TYPE] |= DictionaryData::TRIE_HAS_VALUES;
     }
@@ -440,6 +718,9 @@ int  main(int argc, char **argv) {
     indexes[DictionaryData::IX_TRANSFORM] = dict.getTransform();
     udata_writeBlock(pData, indexes, sizeof(indexes));
     udata_writeBlock(pData, outData, outDataSize);
+    if (!codeMap.empty()) {
+        udata_writeBlock(pData, &codeMap[0], (int32_t)codeMap.size());
+    }
     size_t bytesWritten = udata_finish(pData, status);
     if (status.isFailure()) {
         fprintf(stderr, "gendict: error \"%s\" writing the output file\n", status.errorName());
@@ -454,7 +735,9 @@ int  main(int argc, char **argv) {
     if (!quiet) { printf("%s: done writing\t%s (%ds).\n", progName, outFileName, elapsedTime()); }
 
 #ifdef TEST_GENDICT
-    if (isBytesTrie) {
+    if (isDoubleArray) {
+        printf("double-array trie: %d cells\n", (int)(cells.size() / 2));
+    } else if (isBytesTrie) {
         BytesTrie::Iterator it(outData, outDataSize, status);
         while (it.hasNext()) {
             it.next(status);
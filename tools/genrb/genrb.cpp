@@ -19,6 +19,7 @@
 */
 
 #include <assert.h>
+#include <stdlib.h>
 #include "genrb.h"
 #include "unicode/localpointer.h"
 #include "unicode/uclean.h"
@@ -28,14 +29,29 @@
 #include "reslist.h"
 #include "ucmndata.h"  /* TODO: for reading the pool bundle */
 
+#if U_PLATFORM_IMPLEMENTS_POSIX && !U_PLATFORM_USES_ONLY_WIN32_API
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define GENRB_HAVE_JOBS 1
+#else
+#define GENRB_HAVE_JOBS 0
+#endif
+
 U_NAMESPACE_USE
 
 /* Protos */
 void  processFile(const char *filename, const char* cp, const char *inputDir, const char *outputDir,
                   const char *packageName,
                   SRBRoot *newPoolBundle, UBool omitBinaryCollation, UErrorCode &status);
+static UErrorCode processFiles(int argc, char *argv[], int32_t first, int32_t step,
+                               const char *encoding, const char *inputDir, const char *outputDir,
+                               SRBRoot *newPoolBundle);
 static char *make_res_filename(const char *filename, const char *outputDir,
                                const char *packageName, UErrorCode &status);
+static void flattenBundle(SRBRoot *data, const char *encoding,
+                          const char *inputDir, const char *outputDir,
+                          UBool omitBinaryCollation, UErrorCode &status);
 
 /* File suffixes */
 #define RES_SUFFIX ".res"
@@ -76,7 +92,9 @@ enum
     FORMAT_VERSION,
     WRITE_POOL_BUNDLE,
     USE_POOL_BUNDLE,
-    INCLUDE_UNIHAN_COLL
+    INCLUDE_UNIHAN_COLL,
+    FLATTEN,
+    JOBS
 };
 
 UOption options[]={
@@ -102,6 +120,8 @@ UOption options[]={
                       UOPTION_DEF("writePoolBundle", '\x01', UOPT_NO_ARG),/* 19 */
                       UOPTION_DEF("usePoolBundle", '\x01', UOPT_OPTIONAL_ARG),/* 20 */
                       UOPTION_DEF("includeUnihanColl", '\x01', UOPT_NO_ARG),/* 21 */ /* temporary, don't display in usage info */
+                      UOPTION_DEF("flatten", '\x01', UOPT_NO_ARG),/* 22 */
+                      UOPTION_DEF("jobs", '\x01', UOPT_REQUIRES_ARG),/* 23 */
                   };
 
 static     UBool       write_java = FALSE;
@@ -118,7 +138,6 @@ main(int argc,
      char* argv[])
 {
     UErrorCode  status    = U_ZERO_ERROR;
-    const char *arg       = NULL;
     const char *outputDir = NULL; /* NULL = no output directory, use current */
     const char *inputDir  = NULL;
     const char *encoding  = "";
@@ -157,6 +176,18 @@ main(int argc,
         }
     }
 
+    int32_t jobs = 1;
+    if(options[JOBS].doesOccur) {
+        jobs = (int32_t)atoi(options[JOBS].value);
+        if(jobs < 1) {
+            fprintf(stderr, "%s: --jobs requires a positive number\n", argv[0]);
+            illegalArg = TRUE;
+        } else if(jobs > 1 && options[WRITE_POOL_BUNDLE].doesOccur) {
+            fprintf(stderr, "%s: cannot combine --jobs with --writePoolBundle\n", argv[0]);
+            illegalArg = TRUE;
+        }
+    }
+
     if((options[JAVA_PACKAGE].doesOccur || options[BUNDLE_NAME].doesOccur) &&
             !options[WRITE_JAVA].doesOccur) {
         fprintf(stderr,
@@ -228,6 +259,14 @@ main(int argc,
                 "\t      --usePoolBundle [path-to-pool.res]  point to keys from the pool.res keys pool bundle if they are available there;\n"
                 "\t                           makes .res files smaller but dependent on the pool bundle\n"
                 "\t                           (--writePoolBundle and --usePoolBundle cannot be combined)\n");
+        fprintf(stderr,
+                "\t      --flatten            copy the items that each bundle inherits from its parent bundles\n"
+                "\t                           (read from the source directory) into the bundle,\n"
+                "\t                           and mark it as not falling back to its parents at runtime;\n"
+                "\t                           makes .res files larger but lookups faster\n");
+        fprintf(stderr,
+                "\t      --jobs n             process the input files in n parallel processes\n"
+                "\t                           (cannot be combined with --writePoolBundle)\n");
 
         return illegalArg ? U_ILLEGAL_ARGUMENT_ERROR : U_ZERO_ERROR;
     }
@@ -507,26 +546,70 @@ main(int argc,
         printf("genrb number of files: %d\n", argc - 1);
     }
     /* generate the binary files */
-    for(i = 1; i < argc; ++i) {
+#if GENRB_HAVE_JOBS
+    if(jobs > argc - 1) {
+        jobs = argc - 1;
+    }
+    if(jobs > 1) {
+        /*
+         * genrb keeps state in global variables,
+         * so each job processes every jobs-th file in its own process.
+         * Flush first so that buffered output is not repeated by the children.
+         */
+        fflush(stdout);
+        fflush(stderr);
         status = U_ZERO_ERROR;
-        arg    = getLongPathname(argv[i]);
-
-        CharString theCurrentFileName;
-        if (inputDir) {
-            theCurrentFileName.append(inputDir, status);
+        pid_t children[256];
+        int32_t childCount = 0;
+        if(jobs > UPRV_LENGTHOF(children) + 1) {
+            jobs = UPRV_LENGTHOF(children) + 1;
         }
-        theCurrentFileName.appendPathPart(arg, status);
-        if (U_FAILURE(status)) {
-            break;
+        for(int32_t job = 1; job < jobs; ++job) {
+            pid_t pid = fork();
+            if(pid == 0) {
+                status = processFiles(argc, argv, 1 + job, jobs, encoding, inputDir, outputDir,
+                                      newPoolBundle.getAlias());
+                u_cleanup();
+                fflush(stdout);
+                fflush(stderr);
+                _exit(U_SUCCESS(status) ? 0 : 1);
+            } else if(pid > 0) {
+                children[childCount++] = pid;
+            } else {
+                /* could not start another process: this one does the remaining files */
+                fprintf(stderr, "genrb: unable to start job %d, processing its files serially\n", (int)job);
+                for(int32_t rest = job; rest < jobs; ++rest) {
+                    status = processFiles(argc, argv, 1 + rest, jobs, encoding, inputDir, outputDir,
+                                          newPoolBundle.getAlias());
+                    if(U_FAILURE(status)) {
+                        break;
+                    }
+                }
+                break;
+            }
         }
-
-        gCurrentFileName = theCurrentFileName.data();
-        if (isVerbose()) {
-            printf("Processing file \"%s\"\n", theCurrentFileName.data());
+        UErrorCode firstJobStatus = U_ZERO_ERROR;
+        if(U_SUCCESS(status)) {
+            firstJobStatus = processFiles(argc, argv, 1, jobs, encoding, inputDir, outputDir,
+                                          newPoolBundle.getAlias());
         }
-        processFile(arg, encoding, inputDir, outputDir, NULL,
-                    newPoolBundle.getAlias(),
-                    options[NO_BINARY_COLLATION].doesOccur, status);
+        if(U_SUCCESS(status)) {
+            status = firstJobStatus;
+        }
+        for(int32_t child = 0; child < childCount; ++child) {
+            int childStatus = 0;
+            if(waitpid(children[child], &childStatus, 0) < 0 ||
+                    !WIFEXITED(childStatus) || WEXITSTATUS(childStatus) != 0) {
+                if(U_SUCCESS(status)) {
+                    status = U_INTERNAL_PROGRAM_ERROR;
+                }
+            }
+        }
+    } else
+#endif
+    {
+        status = processFiles(argc, argv, 1, 1, encoding, inputDir, outputDir,
+                              newPoolBundle.getAlias());
     }
 
     poolBundle.close();
@@ -549,6 +632,39 @@ main(int argc,
     return status;
 }
 
+/*
+ * Processes argv[first], argv[first+step], ... up to argc.
+ * Returns the status of the last file, like the loop that it replaces.
+ */
+static UErrorCode
+processFiles(int argc, char *argv[], int32_t first, int32_t step,
+             const char *encoding, const char *inputDir, const char *outputDir,
+             SRBRoot *newPoolBundle) {
+    UErrorCode status = U_ZERO_ERROR;
+    for(int32_t i = first; i < argc; i += step) {
+        status = U_ZERO_ERROR;
+        const char *arg = getLongPathname(argv[i]);
+
+        CharString theCurrentFileName;
+        if (inputDir) {
+            theCurrentFileName.append(inputDir, status);
+        }
+        theCurrentFileName.appendPathPart(arg, status);
+        if (U_FAILURE(status)) {
+            break;
+        }
+
+        gCurrentFileName = theCurrentFileName.data();
+        if (isVerbose()) {
+            printf("Processing file \"%s\"\n", theCurrentFileName.data());
+        }
+        processFile(arg, encoding, inputDir, outputDir, NULL,
+                    newPoolBundle,
+                    options[NO_BINARY_COLLATION].doesOccur, status);
+    }
+    return status;
+}
+
 /* Process a file */
 void
 processFile(const char *filename, const char *cp,
@@ -560,6 +676,7 @@ processFile(const char *filename, const char *cp,
     char           *rbname       = NULL;
     char           *openFileName = NULL;
     char           *inputDirBuf  = NULL;
+    const char     *encoding     = cp;  /* ucbuf_open() may set cp to the detected encoding */
 
     char           outputFileName[256];
 
@@ -668,6 +785,14 @@ processFile(const char *filename, const char *cp,
         fprintf(stderr, "couldn't parse the file %s. Error:%s\n", filename, u_errorName(status));
         goto finish;
     }
+    if(options[FLATTEN].doesOccur) {
+        flattenBundle(data.getAlias(), encoding, inputDir, outputDir, omitBinaryCollation, status);
+        gCurrentFileName = openFileName;
+        if(U_FAILURE(status)) {
+            fprintf(stderr, "couldn't flatten the bundle %s. Error:%s\n", filename, u_errorName(status));
+            goto finish;
+        }
+    }
     if(options[WRITE_POOL_BUNDLE].doesOccur) {
         data->fWritePoolBundle = newPoolBundle;
         data->compactKeys(status);
@@ -733,6 +858,130 @@ processFile(const char *filename, const char *cp,
     }
 }
 
+/*
+ * Parses the source file of a parent bundle of the one being flattened.
+ * Returns NULL without an error if there is no such file.
+ */
+static SRBRoot *
+parseParentBundle(const char *name, const char *encoding,
+                  const char *inputDir, const char *outputDir,
+                  UBool omitBinaryCollation, UErrorCode &status) {
+    CharString filename(name, status);
+    filename.append(".txt", status);
+    CharString openFileName;
+    if (inputDir != NULL) {
+        openFileName.append(inputDir, status);
+    }
+    openFileName.appendPathPart(filename.toStringPiece(), status);
+    if (U_FAILURE(status) || !T_FileStream_file_exists(openFileName.data())) {
+        /* Like a missing bundle at runtime: Go on with the next fallback. */
+        return NULL;
+    }
+    const char *cp = encoding;
+    LocalUCHARBUFPointer ucbuf(
+            ucbuf_open(openFileName.data(), &cp, getShowWarning(), TRUE, &status));
+    if (ucbuf.isNull() || U_FAILURE(status)) {
+        fprintf(stderr, "couldn't open parent file %s. Error:%s\n",
+                openFileName.data(), u_errorName(status));
+        return NULL;
+    }
+    if (isVerbose()) {
+        printf("Inheriting from \"%s\"\n", openFileName.data());
+    }
+    gCurrentFileName = openFileName.data();
+    LocalPointer<SRBRoot> bundle(parse(ucbuf.getAlias(), inputDir, outputDir, filename.data(),
+            !omitBinaryCollation, options[NO_COLLATION_RULES].doesOccur, &status));
+    gCurrentFileName = NULL;
+    if (bundle.isNull() || U_FAILURE(status)) {
+        fprintf(stderr, "couldn't parse the parent file %s. Error:%s\n",
+                openFileName.data(), u_errorName(status));
+        return NULL;
+    }
+    return bundle.orphan();
+}
+
+/* Sets name to the top-level string with the key and returns TRUE, if there is one. */
+static UBool
+getTopLevelName(const SRBRoot *bundle, const char *key, CharString &name, UErrorCode &status) {
+    const SResource *res = bundle->getTopLevelResource(key);
+    if (res == NULL || !res->isString()) {
+        return FALSE;
+    }
+    name.clear().appendInvariantChars(static_cast<const StringResource *>(res)->fString, status);
+    return U_SUCCESS(status);
+}
+
+/*
+ * For --flatten: Adds to the bundle what it would inherit at runtime
+ * from the parent bundles in its fallback chain, ending with root,
+ * which are found in the same way as by ures_open().
+ * The bundle is then marked "nofallback", so that the runtime
+ * neither loads the parents nor falls back to them for missing items.
+ * Bundles that are aliases of other bundles are left as they are.
+ */
+static void
+flattenBundle(SRBRoot *data, const char *encoding,
+              const char *inputDir, const char *outputDir,
+              UBool omitBinaryCollation, UErrorCode &status) {
+    if (U_FAILURE(status) || data->fNoFallback || uprv_strcmp(data->fLocale, "root") == 0 ||
+            data->getTopLevelResource("%%ALIAS") != NULL) {
+        return;
+    }
+    CharString name(data->fLocale, status);
+    LocalPointer<SRBRoot> parent;
+    const SRBRoot *current = data;  /* NULL if the last parent did not exist */
+    while (U_SUCCESS(status)) {
+        if (current != NULL &&
+                (current->fNoFallback || current->getTopLevelResource("%%ParentIsRoot") != NULL)) {
+            break;
+        }
+        CharString parentName;
+        if (current != NULL && getTopLevelName(current, "%%Parent", parentName, status)) {
+            name.clear().append(parentName, status);
+        } else {
+            int32_t i = name.lastIndexOf('_');
+            if (i < 0) {
+                break;
+            }
+            name.truncate(i);
+        }
+        if (U_FAILURE(status) || uprv_strcmp(name.data(), "root") == 0) {
+            break;
+        }
+        parent.adoptInstead(parseParentBundle(name.data(), encoding, inputDir, outputDir,
+                                              omitBinaryCollation, status));
+        /* Use the data of the bundle that a parent is an alias for. */
+        CharString aliasName;
+        for (int32_t depth = 0;
+                parent.isValid() && getTopLevelName(parent.getAlias(), "%%ALIAS", aliasName, status);
+                ++depth) {
+            if (depth == 10) {
+                fprintf(stderr, "too many aliases for the parent bundle %s\n", name.data());
+                status = U_TOO_MANY_ALIASES_ERROR;
+                return;
+            }
+            parent.adoptInstead(parseParentBundle(aliasName.data(), encoding, inputDir, outputDir,
+                                                  omitBinaryCollation, status));
+        }
+        if (parent.isValid()) {
+            data->inheritFrom(*parent, status);
+        }
+        current = parent.getAlias();
+    }
+    parent.adoptInstead(parseParentBundle("root", encoding, inputDir, outputDir,
+                                          omitBinaryCollation, status));
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (parent.isNull()) {
+        fprintf(stderr, "there is no root.txt to flatten %s with\n", data->fLocale);
+        status = U_FILE_ACCESS_ERROR;
+        return;
+    }
+    data->inheritFrom(*parent, status);
+    data->fNoFallback = TRUE;
+}
+
 /* Generate the target .res file name from the input file name */
 static char*
 make_res_filename(const char *filename,
@@ -1205,6 +1205,116 @@ void SRBRoot::setLocale(UChar *locale, UErrorCode &errorCode) {
     u_UCharsToChars(locale, fLocale, u_strlen(locale)+1);
 }
 
+const SResource *
+SRBRoot::getTopLevelResource(const char *key) const {
+    if (fRoot == NULL || !fRoot->isTable()) {
+        return NULL;
+    }
+    for (const SResource *res = static_cast<const TableResource *>(fRoot)->fFirst;
+            res != NULL; res = res->fNext) {
+        if (uprv_strcmp(res->getKeyString(this), key) == 0) {
+            return res;
+        }
+    }
+    return NULL;
+}
+
+/* Returns a deep copy of the resource of the source bundle, with keys in the new bundle. */
+static SResource *
+copyResource(SRBRoot *bundle, const char *tag,
+             const SRBRoot *srcBundle, const SResource *src, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    switch (src->fType) {
+    case URES_TABLE: {
+        const TableResource *srcTable = static_cast<const TableResource *>(src);
+        LocalPointer<TableResource> table(table_open(bundle, tag, &src->fComment, &errorCode));
+        for (const SResource *item = srcTable->fFirst;
+                item != NULL && U_SUCCESS(errorCode); item = item->fNext) {
+            table->add(copyResource(bundle, item->getKeyString(srcBundle), srcBundle, item, errorCode),
+                       item->line, errorCode);
+        }
+        return U_SUCCESS(errorCode) ? table.orphan() : NULL;
+    }
+    case URES_ARRAY: {
+        const ArrayResource *srcArray = static_cast<const ArrayResource *>(src);
+        LocalPointer<ArrayResource> array(array_open(bundle, tag, &src->fComment, &errorCode));
+        for (const SResource *item = srcArray->fFirst;
+                item != NULL && U_SUCCESS(errorCode); item = item->fNext) {
+            array->add(copyResource(bundle, NULL, srcBundle, item, errorCode));
+        }
+        return U_SUCCESS(errorCode) ? array.orphan() : NULL;
+    }
+    case URES_STRING: {
+        const StringResource *srcString = static_cast<const StringResource *>(src);
+        return string_open(bundle, tag, srcString->getBuffer(), srcString->length(),
+                           &src->fComment, &errorCode);
+    }
+    case URES_ALIAS: {
+        const AliasResource *srcAlias = static_cast<const AliasResource *>(src);
+        return alias_open(bundle, tag, const_cast<UChar *>(srcAlias->getBuffer()), srcAlias->length(),
+                          &src->fComment, &errorCode);
+    }
+    case URES_INT:
+        return int_open(bundle, tag, static_cast<const IntResource *>(src)->fValue,
+                        &src->fComment, &errorCode);
+    case URES_INT_VECTOR: {
+        const IntVectorResource *srcVector = static_cast<const IntVectorResource *>(src);
+        LocalPointer<IntVectorResource> vector(intvector_open(bundle, tag, &src->fComment, &errorCode));
+        for (uint32_t i = 0; i < srcVector->fCount && U_SUCCESS(errorCode); ++i) {
+            vector->add((int32_t)srcVector->fArray[i], errorCode);
+        }
+        return U_SUCCESS(errorCode) ? vector.orphan() : NULL;
+    }
+    case URES_BINARY: {
+        const BinaryResource *srcBinary = static_cast<const BinaryResource *>(src);
+        return bin_open(bundle, tag, srcBinary->fLength, srcBinary->fData, srcBinary->fFileName,
+                        &src->fComment, &errorCode);
+    }
+    default:
+        errorCode = U_INTERNAL_PROGRAM_ERROR;
+        return NULL;
+    }
+}
+
+static void
+inheritTable(SRBRoot *bundle, TableResource *table,
+             const SRBRoot *srcBundle, const TableResource *srcTable, UBool isTopLevel,
+             UErrorCode &errorCode) {
+    for (const SResource *src = srcTable->fFirst;
+            src != NULL && U_SUCCESS(errorCode); src = src->fNext) {
+        const char *key = src->getKeyString(srcBundle);
+        if (isTopLevel && key[0] == '%' && key[1] == '%') {
+            continue;  // %%ALIAS, %%Parent etc. are about the parent bundle itself.
+        }
+        SResource *res = table->fFirst;
+        while (res != NULL && uprv_strcmp(res->getKeyString(bundle), key) != 0) {
+            res = res->fNext;
+        }
+        if (res == NULL) {
+            table->add(copyResource(bundle, key, srcBundle, src, errorCode), src->line, errorCode);
+        } else if (res->isTable() && src->isTable()) {
+            inheritTable(bundle, static_cast<TableResource *>(res),
+                         srcBundle, static_cast<const TableResource *>(src), FALSE, errorCode);
+        }
+        // Otherwise this bundle overrides the parent's item.
+    }
+}
+
+void
+SRBRoot::inheritFrom(const SRBRoot &parent, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (fRoot == NULL || !fRoot->isTable() || parent.fRoot == NULL || !parent.fRoot->isTable()) {
+        errorCode = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    inheritTable(this, static_cast<TableResource *>(fRoot),
+                 &parent, static_cast<const TableResource *>(parent.fRoot), TRUE, errorCode);
+}
+
 const char *
 SRBRoot::getKeyString(int32_t key) const {
     if (key < 0) {
@@ -87,6 +87,18 @@ struct SRBRoot {
     int32_t makeRes16(uint32_t resWord) const;
     int32_t mapKey(int32_t oldpos) const;
 
+    /**
+     * Returns the top-level resource with this key, or NULL if there is none.
+     */
+    const SResource *getTopLevelResource(const char *key) const;
+
+    /**
+     * Adds copies of the parent bundle's resources that are missing in this bundle,
+     * merging tables recursively, the way they would be inherited at runtime.
+     * Top-level resources whose keys start with "%%" are not inherited.
+     */
+    void inheritFrom(const SRBRoot &parent, UErrorCode &errorCode);
+
 private:
     void compactStringsV2(UHashtable *stringSet, UErrorCode &errorCode);
 
@@ -57,9 +57,10 @@ printUsage(const char *pname, UBool isHelp) {
 
     fprintf(where,
             "%csage: %s [-h|-?|--help ] [-tl|-tb|-te] [-c] [-C comment]\n"
-            "\t[-a list] [-r list] [-x list] [-l [-o outputListFileName]]\n"
+            "\t[-a list] [-r list] [-k list] [-x list] [-l [-o outputListFileName]]\n"
             "\t[-s path] [-d path] [-w] [-m mode]\n"
             "\t[--auto_toc_prefix] [--auto_toc_prefix_with_type] [--toc_prefix]\n"
+            "\t[--toc_hash] [--compress]\n"
             "\tinfilename [outfilename]\n",
             isHelp ? 'U' : 'u', pname);
     if(isHelp) {
@@ -68,7 +69,7 @@ printUsage(const char *pname, UBool isHelp) {
             "Read the input ICU .dat package file, modify it according to the options,\n"
             "swap it to the desired platform properties (charset & endianness),\n"
             "and optionally write the resulting ICU .dat package to the output file.\n"
-            "Items are removed, then added, then extracted and listed.\n"
+            "Items are kept or removed, then added, then extracted and listed.\n"
             "An ICU .dat package is written if items are removed or added,\n"
             "or if the input and output filenames differ,\n"
             "or if the --writepkg (-w) option is set.\n");
@@ -106,10 +107,15 @@ printUsage(const char *pname, UBool isHelp) {
             "\n"
             "\t-a list or --add list      add items to the package\n"
             "\t-r list or --remove list   remove items from the package\n"
+            "\t-k list or --keep list     remove all items from the package except these\n"
+            "\t                           and the items that they depend on\n"
             "\t-x list or --extract list  extract items from the package\n"
             "\tThe list can be a single item's filename,\n"
             "\tor a .txt filename with a list of item filenames,\n"
-            "\tor an ICU .dat package filename.\n");
+            "\tor an ICU .dat package filename.\n"
+            "\tA list for --keep can be written by running ICU with the ICU_DATA_TRACE\n"
+            "\tenvironment variable set to a filename: ICU then appends the names\n"
+            "\tof the ICU data items that it loads to that file.\n");
         fprintf(where,
             "\n"
             "\t-w or --writepkg  write the output package even if no items are removed\n"
@@ -143,7 +149,17 @@ printUsage(const char *pname, UBool isHelp) {
             "\t--toc_prefix prefix          ToC prefix to be used in the output package\n"
             "\t                             Overrides the package basename\n"
             "\t                             and --auto_toc_prefix.\n"
-            "\t                             Cannot be combined with --auto_toc_prefix_with_type.\n");
+            "\t                             Cannot be combined with --auto_toc_prefix_with_type.\n"
+            "\t--toc_hash                   write a hash index of the ToC entries\n"
+            "\t                             into the output package, for faster\n"
+            "\t                             item lookups at runtime.\n"
+            "\t                             Implies -w.\n"
+            "\t--compress                   compress each item of the output package\n"
+            "\t                             that gets at least 1/8 smaller;\n"
+            "\t                             ICU decompresses them when they are\n"
+            "\t                             opened. Compressed items in an input\n"
+            "\t                             package are always decompressed.\n"
+            "\t                             Implies -w.\n");
         /*
          * Usage text columns, starting after the initial TAB.
          *      1         2         3         4         5         6         7         8
@@ -158,7 +174,7 @@ printUsage(const char *pname, UBool isHelp) {
             "\tare also ignored, to reserve for future syntax.\n",
             U_PKG_RESERVED_CHARS);
         fprintf(where,
-            "\tItems for removal or extraction may contain a single '*' wildcard\n"
+            "\tItems for removal, keeping or extraction may contain a single '*' wildcard\n"
             "\tcharacter. The '*' matches zero or more characters.\n"
             "\tIf --matchmode noslash (-m noslash) is set, then the '*'\n"
             "\tdoes not match '/'.\n");
@@ -200,6 +216,7 @@ static UOption options[]={
 
     UOPTION_DEF("add", 'a', UOPT_REQUIRES_ARG),
     UOPTION_DEF("remove", 'r', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("keep", 'k', UOPT_REQUIRES_ARG),
     UOPTION_DEF("extract", 'x', UOPT_REQUIRES_ARG),
 
     UOPTION_DEF("list", 'l', UOPT_NO_ARG),
@@ -207,7 +224,9 @@ static UOption options[]={
 
     UOPTION_DEF("auto_toc_prefix", '\1', UOPT_NO_ARG),
     UOPTION_DEF("auto_toc_prefix_with_type", '\1', UOPT_NO_ARG),
-    UOPTION_DEF("toc_prefix", '\1', UOPT_REQUIRES_ARG)
+    UOPTION_DEF("toc_prefix", '\1', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("toc_hash", '\1', UOPT_NO_ARG),
+    UOPTION_DEF("compress", '\1', UOPT_NO_ARG)
 };
 
 enum {
@@ -227,6 +246,7 @@ enum {
 
     OPT_ADD_LIST,
     OPT_REMOVE_LIST,
+    OPT_KEEP_LIST,
     OPT_EXTRACT_LIST,
 
     OPT_LIST_ITEMS,
@@ -235,6 +255,8 @@ enum {
     OPT_AUTO_TOC_PREFIX,
     OPT_AUTO_TOC_PREFIX_WITH_TYPE,
     OPT_TOC_PREFIX,
+    OPT_TOC_HASH,
+    OPT_COMPRESS,
 
     OPT_COUNT
 };
@@ -376,7 +398,8 @@ main(int argc, char *argv[]) {
         outType=0; /* tells extractItem() to not swap */
     }
 
-    if(options[OPT_WRITEPKG].doesOccur) {
+    if(options[OPT_WRITEPKG].doesOccur || options[OPT_TOC_HASH].doesOccur ||
+            options[OPT_COMPRESS].doesOccur) {
         isModified=TRUE;
     }
 
@@ -389,9 +412,12 @@ main(int argc, char *argv[]) {
             options[OPT_COPYRIGHT].doesOccur ||
             options[OPT_MATCHMODE].doesOccur ||
             options[OPT_REMOVE_LIST].doesOccur ||
+            options[OPT_KEEP_LIST].doesOccur ||
             options[OPT_ADD_LIST].doesOccur ||
             options[OPT_EXTRACT_LIST].doesOccur ||
-            options[OPT_LIST_ITEMS].doesOccur
+            options[OPT_LIST_ITEMS].doesOccur ||
+            options[OPT_TOC_HASH].doesOccur ||
+            options[OPT_COMPRESS].doesOccur
         ) {
             printUsage(pname, FALSE);
             return U_ILLEGAL_ARGUMENT_ERROR;
@@ -423,6 +449,23 @@ main(int argc, char *argv[]) {
         }
     }
 
+    /* keep items */
+    if(options[OPT_KEEP_LIST].doesOccur) {
+        listPkg=new Package();
+        if(listPkg==NULL) {
+            fprintf(stderr, "icupkg: not enough memory\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        if(readList(NULL, options[OPT_KEEP_LIST].value, FALSE, listPkg)) {
+            pkg->keepItems(*listPkg);
+            delete listPkg;
+            isModified=TRUE;
+        } else {
+            printUsage(pname, FALSE);
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+    }
+
     /* remove items */
     if(options[OPT_REMOVE_LIST].doesOccur) {
         listPkg=new Package();
@@ -536,7 +579,9 @@ main(int argc, char *argv[]) {
         if(options[OPT_TOC_PREFIX].doesOccur) {
             pkg->setPrefix(options[OPT_TOC_PREFIX].value);
         }
-        result = writePackageDatFile(outFilename, outComment, NULL, NULL, pkg, outType);
+        result = writePackageDatFile(outFilename, outComment, NULL, NULL, pkg, outType,
+                                     options[OPT_TOC_HASH].doesOccur,
+                                     options[OPT_COMPRESS].doesOccur);
     }
 
     delete addListPkg;
@@ -344,7 +344,7 @@ udata_swapPackage(const char *inFilename, const char *outFilename,
     uint8_t *outBytes;
 
     uint32_t itemCount, offset, i;
-    int32_t itemLength;
+    int32_t itemLength, hashIndexSize;
 
     const UDataOffsetTOCEntry *inEntries;
     UDataOffsetTOCEntry *outEntries;
@@ -462,8 +462,22 @@ udata_swapPackage(const char *inFilename, const char *outFilename,
             return headerSize+4;
         }
 
-        /* swap the item name strings */
+        /* skip the hash index, if any: it is rebuilt for the output charset below */
         offset=4+8*itemCount;
+        hashIndexSize=0;
+        if( (offset+8)<=ds->readUInt32(inEntries[0].nameOffset) &&
+            ds->readUInt32(*(const uint32_t *)(inBytes+offset))==UDATA_TOC_HASH_SIGNATURE
+        ) {
+            hashIndexSize=8+2*(int32_t)ds->readUInt32(*(const uint32_t *)(inBytes+offset+4));
+            if(hashIndexSize!=udata_getTOCHashIndexSize((int32_t)itemCount)) {
+                udata_printError(ds, "udata_swapPackage(): unexpected hash index length\n");
+                *pErrorCode=U_INVALID_FORMAT_ERROR;
+                return 0;
+            }
+            offset+=hashIndexSize;
+        }
+
+        /* swap the item name strings */
         itemLength=(int32_t)(ds->readUInt32(inEntries[0].dataOffset)-offset);
         udata_swapInvStringBlock(ds, inBytes+offset, itemLength, outBytes+offset, pErrorCode);
         if(U_FAILURE(*pErrorCode)) {
@@ -601,6 +615,33 @@ udata_swapPackage(const char *inFilename, const char *outFilename,
             ds->writeUInt32(&outEntries[i].dataOffset, table[i].outOffset);
         }
 
+        /* write the hash index of the output names in the output entry order */
+        if(hashIndexSize>0) {
+            UDataTOCHashIndex *hashIndex=(UDataTOCHashIndex *)uprv_malloc(hashIndexSize);
+            const char **names=(const char **)uprv_malloc(itemCount*sizeof(const char *));
+            if(hashIndex==NULL || names==NULL) {
+                uprv_free(hashIndex);
+                uprv_free(names);
+                uprv_free(table);
+                udata_printError(ds, "udata_swapPackage(): out of memory allocating the hash index\n");
+                *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+                return 0;
+            }
+            for(i=0; i<itemCount; ++i) {
+                names[i]=(const char *)outBytes+table[i].nameOffset;
+            }
+            udata_buildTOCHashIndex(names, (int32_t)itemCount, hashIndex);
+
+            UDataTOCHashIndex *outHashIndex=(UDataTOCHashIndex *)(outEntries+itemCount);
+            ds->writeUInt32(&outHashIndex->signature, hashIndex->signature);
+            ds->writeUInt32(&outHashIndex->length, hashIndex->length);
+            for(i=0; i<hashIndex->length; ++i) {
+                ds->writeUInt16(outHashIndex->slots+i, hashIndex->slots[i]);
+            }
+            uprv_free(names);
+            uprv_free(hashIndex);
+        }
+
         /* swap each data item */
         for(i=0; i<itemCount; ++i) {
             /* first copy the item bytes to make sure that unreachable bytes are copied */ 
@@ -1417,6 +1417,67 @@ MBCSPostprocess(MBCSData *mbcsData, const UConverterStaticData * /*staticData*/)
     }
 }
 
+/*
+ * Precompute the data for the swaplfnl option if it applies to this table,
+ * so that it need not be built in heap memory when the converter is opened.
+ * See ucnv_MBCSSwapLFNL() and MBCS_OPT_SWAP_LFNL in ucnvmbcs.h.
+ * Call after the stage 1 entries have been adjusted for writing.
+ * Returns NULL if the option does not apply.
+ */
+static uint8_t *
+MBCSGetSwapLFNLData(MBCSData *mbcsData, const UConverterStaticData *staticData,
+                    int32_t stage1Top, uint32_t stage2Length, uint32_t *pLength) {
+    UConverterMBCSTable mbcsTable;
+    uint8_t *fromUTable, *data;
+    char *name;
+    uint32_t countStates, nameLength, length;
+
+    /* the fromUnicode stage 1 and 2 tables, contiguous as in the .cnv file */
+    fromUTable=(uint8_t *)uprv_malloc(stage1Top*2+stage2Length);
+    if(fromUTable==NULL) {
+        printf("out of memory\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+    uprv_memcpy(fromUTable, mbcsData->stage1, stage1Top*2);
+    if(mbcsData->ucm->states.maxCharLength==1) {
+        uprv_memcpy(fromUTable+stage1Top*2, mbcsData->stage2Single, stage2Length);
+    } else {
+        uprv_memcpy(fromUTable+stage1Top*2, mbcsData->stage2, stage2Length);
+    }
+
+    countStates=(uint32_t)mbcsData->ucm->states.countStates;
+    uprv_memset(&mbcsTable, 0, sizeof(mbcsTable));
+    mbcsTable.countStates=(uint8_t)countStates;
+    mbcsTable.stateTable=(const int32_t (*)[256])mbcsData->ucm->states.stateTable;
+    mbcsTable.outputType=(uint8_t)mbcsData->ucm->states.outputType;
+    mbcsTable.fromUnicodeTable=(const uint16_t *)fromUTable;
+    mbcsTable.fromUnicodeBytes=mbcsData->fromUBytes;
+    mbcsTable.fromUBytesLength=mbcsData->stage3Top;
+
+    data=NULL;
+    if(ucnv_MBCSSwapLFNL(&mbcsTable, NULL, NULL)) {
+        nameLength=(uint32_t)(uprv_strlen(staticData->name)+uprv_strlen(UCNV_SWAP_LFNL_OPTION_STRING));
+        length=countStates*1024+mbcsData->stage3Top+((nameLength+4)&~3);
+        data=(uint8_t *)uprv_malloc(length);
+        if(data==NULL) {
+            printf("out of memory\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        uprv_memset(data, 0, length);
+        ucnv_MBCSSwapLFNL(&mbcsTable, (int32_t (*)[256])data, data+countStates*1024);
+
+        name=(char *)data+countStates*1024+mbcsData->stage3Top;
+        uprv_strcpy(name, staticData->name);
+        uprv_strcat(name, UCNV_SWAP_LFNL_OPTION_STRING);
+        *pLength=length;
+        if(VERBOSE) {
+            printf("+ precomputed %lu bytes of swaplfnl data\n", (unsigned long)length);
+        }
+    }
+    uprv_free(fromUTable);
+    return data;
+}
+
 U_CDECL_BEGIN
 static uint32_t
 MBCSWrite(NewConverter *cnvData, const UConverterStaticData *staticData,
@@ -1426,6 +1487,8 @@ MBCSWrite(NewConverter *cnvData, const UConverterStaticData *staticData,
     uint32_t top, stageUTF8Length=0;
     int32_t i, stage1Top;
     uint32_t headerLength;
+    uint8_t *swapLFNLData=NULL;
+    uint32_t swapLFNLLength=0;
 
     _MBCSHeader header=UCNV_MBCS_HEADER_INITIALIZER;
 
@@ -1501,8 +1564,19 @@ MBCSWrite(NewConverter *cnvData, const UConverterStaticData *staticData,
     /* round up stage3Top so that the sizes of all data blocks are multiples of 4 */
     mbcsData->stage3Top=(mbcsData->stage3Top+3)&~3;
 
+    /* the swaplfnl data needs the full fromUnicode tables */
+    if(SWAP_LFNL && !(header.options&MBCS_OPT_NO_FROM_U)) {
+        swapLFNLData=MBCSGetSwapLFNLData(mbcsData, staticData, stage1Top, stage2Length, &swapLFNLLength);
+        if(swapLFNLData!=NULL) {
+            header.options|=MBCS_OPT_SWAP_LFNL;
+        }
+    }
+
     /* fill the header */
-    if(header.options&MBCS_OPT_INCOMPATIBLE_MASK) {
+    if(header.options&MBCS_OPT_SWAP_LFNL) {
+        header.version[0]=5;
+        headerLength=MBCS_HEADER_V5_SWAP_LFNL_LENGTH;  /* 11, include offsetSwapLFNL */
+    } else if(header.options&MBCS_OPT_INCOMPATIBLE_MASK) {
         header.version[0]=5;
         if(header.options&MBCS_OPT_NO_FROM_U) {
             headerLength=10;  /* include fullStage2Length */
@@ -1538,12 +1612,17 @@ MBCSWrite(NewConverter *cnvData, const UConverterStaticData *staticData,
     if(!(header.options&MBCS_OPT_NO_FROM_U)) {
         top+=header.fromUBytesLength;
     }
+    if(swapLFNLData!=NULL) {
+        header.offsetSwapLFNL=top;
+        top+=swapLFNLLength;
+    }
 
     header.flags=(uint8_t)(mbcsData->ucm->states.outputType);
 
     if(tableType&TABLE_EXT) {
         if(top>0xffffff) {
             fprintf(stderr, "error: offset 0x%lx to extension table exceeds 0xffffff\n", (long)top);
+            uprv_free(swapLFNLData);
             return 0;
         }
 
@@ -1569,6 +1648,11 @@ MBCSWrite(NewConverter *cnvData, const UConverterStaticData *staticData,
         udata_writeBlock(pData, mbcsData->stageUTF8, stageUTF8Length*2);
     }
 
+    if(swapLFNLData!=NULL) {
+        udata_writeBlock(pData, swapLFNLData, swapLFNLLength);
+        uprv_free(swapLFNLData);
+    }
+
     /* return the number of bytes that should have been written */
     return top;
 }
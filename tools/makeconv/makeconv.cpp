@@ -48,7 +48,7 @@ typedef struct ConvData {
 
 static void
 initConvData(ConvData *data) {
-    uprv_memset(data, 0, sizeof(ConvData));
+    uprv_memset((void *)data, 0, sizeof(ConvData));
     data->sharedData.structSize=sizeof(UConverterSharedData);
     data->staticData.structSize=sizeof(UConverterStaticData);
     data->sharedData.staticData=&data->staticData;
@@ -81,6 +81,7 @@ U_CAPI const UConverterStaticData * ucnv_converterStaticData[UCNV_NUMBER_OF_SUPP
 UBool VERBOSE = FALSE;
 UBool QUIET = FALSE;
 UBool SMALL = FALSE;
+UBool SWAP_LFNL = FALSE;
 UBool IGNORE_SISO_CHECK = FALSE;
 
 static void
@@ -177,6 +178,7 @@ enum {
     OPT_DESTDIR,
     OPT_VERBOSE,
     OPT_SMALL,
+    OPT_SWAP_LFNL,
     OPT_IGNORE_SISO_CHECK,
     OPT_QUIET,
 
@@ -191,6 +193,7 @@ static UOption options[]={
     UOPTION_DESTDIR,
     UOPTION_VERBOSE,
     { "small", NULL, NULL, NULL, '\1', UOPT_NO_ARG, 0 },
+    { "swaplfnl", NULL, NULL, NULL, '\1', UOPT_NO_ARG, 0 },
     { "ignore-siso-check", NULL, NULL, NULL, '\1', UOPT_NO_ARG, 0 },
     UOPTION_QUIET,
 };
@@ -237,6 +240,10 @@ int main(int argc, char* argv[])
             "\t                    significantly smaller but may not be compatible with\n"
             "\t                    older versions of ICU and will require heap memory\n"
             "\t                    allocation when loaded.\n"
+            "\t      --swaplfnl    For EBCDIC tables, also store the tables for the\n"
+            "\t                    swaplfnl option, so that converters opened with it\n"
+            "\t                    share the loaded data rather than building private\n"
+            "\t                    copies in heap memory. Ignored with --small.\n"
             "\t      --ignore-siso-check         Use SI/SO other than 0xf/0xe.\n");
         return argc<0 ? U_ILLEGAL_ARGUMENT_ERROR : U_ZERO_ERROR;
     }
@@ -254,6 +261,7 @@ int main(int argc, char* argv[])
     VERBOSE = options[OPT_VERBOSE].doesOccur;
     QUIET = options[OPT_QUIET].doesOccur;
     SMALL = options[OPT_SMALL].doesOccur;
+    SWAP_LFNL = options[OPT_SWAP_LFNL].doesOccur;
 
     if (options[OPT_IGNORE_SISO_CHECK].doesOccur) {
         IGNORE_SISO_CHECK = TRUE;
@@ -27,6 +27,7 @@
 /* exports from makeconv.c */
 U_CFUNC UBool VERBOSE;
 U_CFUNC UBool SMALL;
+U_CFUNC UBool SWAP_LFNL;
 U_CFUNC UBool IGNORE_SISO_CHECK;
 
 /* converter table type for writing */
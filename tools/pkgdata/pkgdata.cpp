@@ -123,7 +123,9 @@ enum {
     WITHOUT_ASSEMBLY,
     PDS_BUILD,
     UWP_BUILD,
-    UWP_ARM_BUILD
+    UWP_ARM_BUILD,
+    TOC_HASH,
+    COMPRESS
 };
 
 /* This sets the modes that are available */
@@ -167,7 +169,9 @@ static UOption options[]={
     /*20*/    UOPTION_DEF( "without-assembly", 'w', UOPT_NO_ARG),
     /*21*/    UOPTION_DEF("zos-pds-build", 'z', UOPT_NO_ARG),
     /*22*/    UOPTION_DEF("windows-uwp-build", 'u', UOPT_NO_ARG),
-    /*23*/    UOPTION_DEF("windows-uwp-arm-build", 'a', UOPT_NO_ARG)
+    /*23*/    UOPTION_DEF("windows-uwp-arm-build", 'a', UOPT_NO_ARG),
+    /*24*/    UOPTION_DEF("toc-hash", '\1', UOPT_NO_ARG),
+    /*25*/    UOPTION_DEF("compress", '\1', UOPT_NO_ARG)
 };
 
 /* This enum and the following char array should be kept in sync. */
@@ -258,7 +262,9 @@ const char options_help[][320]={
     "Build the data without assembly code",
     "Build PDS dataset (zOS build only)",
     "Build for Universal Windows Platform (Windows build only)",
-    "Set DLL machine type for UWP to target windows ARM (Windows UWP build only)"
+    "Set DLL machine type for UWP to target windows ARM (Windows UWP build only)",
+    "Write a hash index of the table of contents into the .dat file, for faster lookups",
+    "Compress the items of the .dat file that compress well; ICU decompresses them on first use"
 };
 
 const char  *progname = "PKGDATA";
@@ -458,6 +464,9 @@ main(int argc, char* argv[]) {
         o.entryName = o.cShortName;
     }
 
+    o.tocHash = options[TOC_HASH].doesOccur;
+    o.compressItems = options[COMPRESS].doesOccur;
+
     o.withoutAssembly = FALSE;
     if (options[WITHOUT_ASSEMBLY].doesOccur) {
 #ifndef BUILD_DATA_WITHOUT_ASSEMBLY
@@ -599,10 +608,26 @@ static int32_t pkg_executeOptions(UPKGOptions *o) {
 
         uprv_strcat(datFileNamePath, datFileName);
 
+        if (IN_COMMON_MODE(mode) && o->rebuild == FALSE) {
+            /* Check to see if a previously built dat file exists and is newer than all of its items. */
+            sprintf(checkLibFile, "%s%s", targetDir, datFileName);
+            if (T_FileStream_file_exists(checkLibFile) &&
+                    isFileModTimeLater(checkLibFile, o->srcDir, TRUE) &&
+                    isFileModTimeLater(checkLibFile, o->fileListFiles->str)) {
+                if(o->verbose) {
+                    fprintf(stdout, "# Not rebuilding %s - up to date.\n", checkLibFile);
+                }
+                if (o->install != NULL) {
+                    result = pkg_installCommonMode(o->install, checkLibFile);
+                }
+                return result;
+            }
+        }
+
         if(o->verbose) {
           fprintf(stdout, "# Writing package file %s ..\n", datFileNamePath);
         }
-        result = writePackageDatFile(datFileNamePath, o->comment, o->srcDir, o->fileListFiles->str, NULL, U_CHARSET_FAMILY ? 'e' :  U_IS_BIG_ENDIAN ? 'b' : 'l');
+        result = writePackageDatFile(datFileNamePath, o->comment, o->srcDir, o->fileListFiles->str, NULL, U_CHARSET_FAMILY ? 'e' :  U_IS_BIG_ENDIAN ? 'b' : 'l', o->tocHash, o->compressItems);
         if (result != 0) {
             fprintf(stderr,"Error writing package dat file.\n");
             return result;
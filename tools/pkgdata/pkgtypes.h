@@ -129,6 +129,8 @@ typedef struct UPKGOptions_
   UBool      quiet;
   UBool      withoutAssembly;
   UBool      pdsbuild;     /* for building PDS in z/OS */
+  UBool      tocHash;      /* write a hash index into the .dat file */
+  UBool      compressItems; /* compress the items of the .dat file */
 } UPKGOptions;
 
 char * convertToNativePathSeparators(char *path);
@@ -29,6 +29,7 @@
 #include "cstring.h"
 #include "uarrsort.h"
 #include "ucmndata.h"
+#include "ucmpdata.h"
 #include "udataswp.h"
 #include "swapimpl.h"
 #include "toolutil.h"
@@ -382,7 +383,7 @@ U_CDECL_END
 U_NAMESPACE_BEGIN
 
 Package::Package()
-        : doAutoPrefix(FALSE), prefixEndsWithType(FALSE) {
+        : doAutoPrefix(FALSE), prefixEndsWithType(FALSE), doHashIndex(FALSE), doCompressItems(FALSE) {
     inPkgName[0]=0;
     pkgPrefix[0]=0;
     inData=NULL;
@@ -545,8 +546,17 @@ Package::readPackage(const char *filename) {
             exit(U_BUFFER_OVERFLOW_ERROR);
         }
 
-        /* swap the item name strings */
+        /* swap the item name strings, after the hash index if there is one */
         int32_t stringsOffset=4+8*itemCount;
+        if( length>=(stringsOffset+8) &&
+            ds->readUInt32(*(const uint32_t *)(inBytes+stringsOffset))==UDATA_TOC_HASH_SIGNATURE
+        ) {
+            stringsOffset+=8+2*(int32_t)ds->readUInt32(*(const uint32_t *)(inBytes+stringsOffset+4));
+            if(stringsOffset>(int32_t)ds->readUInt32(inEntries[0].nameOffset)) {
+                fprintf(stderr, "icupkg: the hash index overlaps the item names of the input .dat package\n");
+                exit(U_INVALID_FORMAT_ERROR);
+            }
+        }
         itemLength=(int32_t)(ds->readUInt32(inEntries[0].dataOffset))-stringsOffset;
 
         // don't include padding bytes at the end of the item names
@@ -672,11 +682,52 @@ Package::readPackage(const char *filename) {
             // sort the item names for the local charset
             sortItems();
         }
+
+        decompressItems(filename);
     }
 
     udata_closeSwapper(ds);
 }
 
+void
+Package::decompressItems(const char *filename) {
+    Item *pItem;
+    int32_t i;
+
+    for(pItem=items, i=0; i<itemCount; ++pItem, ++i) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        int32_t compressedLength, uncompressedLength;
+        const uint8_t *compressed=ucmpdata_getCompressedBytes(
+            (const DataHeader *)pItem->data, pItem->length,
+            &compressedLength, &uncompressedLength, &errorCode);
+        if(compressed==NULL) {
+            if(U_FAILURE(errorCode)) {
+                fprintf(stderr, "icupkg: malformed compressed item \"%s\" in \"%s\"\n", pItem->name, filename);
+                exit(errorCode);
+            }
+            continue;
+        }
+        // keep the item length a multiple of 16 like for items read from files
+        int32_t length=(uncompressedLength+15)&~15;
+        uint8_t *data=(uint8_t *)uprv_malloc(length);
+        if(data==NULL) {
+            fprintf(stderr, "icupkg: not enough memory\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        if( ucmpdata_decompress(compressed, compressedLength, data, uncompressedLength, &errorCode)!=uncompressedLength ||
+            U_FAILURE(errorCode)
+        ) {
+            fprintf(stderr, "icupkg: unable to decompress item \"%s\" in \"%s\"\n", pItem->name, filename);
+            exit(U_INVALID_FORMAT_ERROR);
+        }
+        memset(data+uncompressedLength, 0, length-uncompressedLength);
+        // the compressed item has the platform type of the original one
+        pItem->data=data;
+        pItem->length=length;
+        pItem->isDataOwned=TRUE;
+    }
+}
+
 char
 Package::getInType() {
     return makeTypeLetter(inCharset, inIsBigEndian);
@@ -691,7 +742,7 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
     Item *pItem;
     char *name;
     UErrorCode errorCode;
-    int32_t i, length, prefixLength, maxItemLength, basenameOffset, offset, outInt32;
+    int32_t i, length, prefixLength, maxItemLength, basenameOffset, offset, outInt32, hashIndexSize;
     uint8_t outCharset;
     UBool outIsBigEndian;
 
@@ -745,6 +796,43 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
 
     dsLocalToOut=ds[makeTypeEnum(U_CHARSET_FAMILY, U_IS_BIG_ENDIAN)];
 
+    // swap the items that compress well to the output type, then compress them,
+    // because the item lengths go into the ToC before the items are written
+    if(doCompressItems) {
+        for(pItem=items, i=0; i<itemCount; ++pItem, ++i) {
+            int32_t type=makeTypeEnum(pItem->type);
+            if(ds[type]!=NULL) {
+                udata_swap(ds[type], pItem->data, pItem->length, pItem->data, &errorCode);
+                if(U_FAILURE(errorCode)) {
+                    fprintf(stderr, "icupkg: udata_swap(item %ld) failed - %s\n", (long)i, u_errorName(errorCode));
+                    exit(errorCode);
+                }
+                pItem->type=outType;
+            }
+            int32_t capacity=UCMPDATA_COMPRESSED_ITEM_CAPACITY(pItem->length);
+            uint8_t *data=(uint8_t *)uprv_malloc(capacity);
+            if(data==NULL) {
+                fprintf(stderr, "icupkg: not enough memory\n");
+                exit(U_MEMORY_ALLOCATION_ERROR);
+            }
+            length=ucmpdata_compressItem(pItem->data, pItem->length, data, capacity, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                fprintf(stderr, "icupkg: unable to compress item %ld - %s\n", (long)i, u_errorName(errorCode));
+                exit(errorCode);
+            }
+            if(length<=(pItem->length-pItem->length/8)) {
+                if(pItem->isDataOwned) {
+                    uprv_free(pItem->data);
+                }
+                pItem->data=data;
+                pItem->length=length;
+                pItem->isDataOwned=TRUE;
+            } else {
+                uprv_free(data);
+            }
+        }
+    }
+
     // create the file and write its contents
     file=fopen(filename, "wb");
     if(file==NULL) {
@@ -804,9 +892,18 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
         items[i].name=name;
     }
 
+    // the optional hash index goes between the ToC entries and the item names
+    hashIndexSize=0;
+    if(doHashIndex && itemCount>0) {
+        hashIndexSize=udata_getTOCHashIndexSize(itemCount);
+        if(hashIndexSize==0) {
+            fprintf(stderr, "icupkg: too many items (%ld) for a hash index, writing none\n", (long)itemCount);
+        }
+    }
+
     // calculate offsets for item names and items, pad to 16-align items
     // align only the first item; each item's length is a multiple of 16
-    basenameOffset=4+8*itemCount;
+    basenameOffset=4+8*itemCount+hashIndexSize;
     offset=basenameOffset+outStringTop;
     if((length=(offset&15))!=0) {
         length=16-length;
@@ -855,6 +952,35 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
         offset+=length;
     }
 
+    // then the hash index of the item names, which are already in the output charset
+    if(hashIndexSize>0) {
+        UDataTOCHashIndex *hashIndex=(UDataTOCHashIndex *)uprv_malloc(hashIndexSize);
+        const char **names=(const char **)uprv_malloc(itemCount*sizeof(const char *));
+        if(hashIndex==NULL || names==NULL) {
+            fprintf(stderr, "icupkg: not enough memory for the hash index\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        for(i=0; i<itemCount; ++i) {
+            names[i]=items[i].name;
+        }
+        udata_buildTOCHashIndex(names, itemCount, hashIndex);
+        if(dsLocalToOut!=NULL) {
+            dsLocalToOut->swapArray32(dsLocalToOut, hashIndex, 8, hashIndex, &errorCode);
+            dsLocalToOut->swapArray16(dsLocalToOut, hashIndex->slots, hashIndexSize-8, hashIndex->slots, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                fprintf(stderr, "icupkg: swapping the hash index failed - %s\n", u_errorName(errorCode));
+                exit(errorCode);
+            }
+        }
+        length=(int32_t)fwrite(hashIndex, 1, hashIndexSize, file);
+        uprv_free(names);
+        uprv_free(hashIndex);
+        if(length!=hashIndexSize) {
+            fprintf(stderr, "icupkg: unable to write complete hash index to file \"%s\"\n", filename);
+            exit(U_FILE_ACCESS_ERROR);
+        }
+    }
+
     // write the item names
     length=(int32_t)fwrite(outStrings, 1, outStringTop, file);
     if(length!=outStringTop) {
@@ -1123,6 +1249,66 @@ Package::removeItems(const Package &listPkg) {
     }
 }
 
+// state for keepItems()
+struct KeepContext {
+    Package *pkg;
+    UBool *isKept;
+    UBool didKeepMore;
+};
+
+void
+Package::keepDependency(void *context, const char * /*itemName*/, const char *targetName) {
+    // keep the target item, and later the items that it depends on
+    KeepContext *ctx=(KeepContext *)context;
+    int32_t idx=ctx->pkg->findItem(targetName);
+    if(idx>=0 && !ctx->isKept[idx]) {
+        ctx->isKept[idx]=TRUE;
+        ctx->didKeepMore=TRUE;
+    }
+}
+
+void
+Package::keepItems(const Package &listPkg) {
+    const Item *pItem;
+    int32_t i, idx;
+
+    if(itemCount==0) {
+        return;
+    }
+    KeepContext ctx={ this, (UBool *)uprv_malloc(itemCount), FALSE };
+    if(ctx.isKept==NULL) {
+        fprintf(stderr, "icupkg: not enough memory\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+    memset(ctx.isKept, 0, itemCount);
+
+    // mark the items that match the list
+    for(pItem=listPkg.items, i=0; i<listPkg.itemCount; ++pItem, ++i) {
+        findItems(pItem->name);
+        while((idx=findNextItem())>=0) {
+            ctx.isKept[idx]=TRUE;
+        }
+    }
+
+    // mark the items that the kept items depend on, until there are no more
+    do {
+        ctx.didKeepMore=FALSE;
+        for(i=0; i<itemCount; ++i) {
+            if(ctx.isKept[i]) {
+                enumDependencies(items+i, &ctx, keepDependency);
+            }
+        }
+    } while(ctx.didKeepMore);
+
+    // remove the other items, from the end so that the marks stay in sync
+    for(i=itemCount-1; i>=0; --i) {
+        if(!ctx.isKept[i]) {
+            removeItem(i);
+        }
+    }
+    uprv_free(ctx.isKept);
+}
+
 void
 Package::extractItem(const char *filesPath, const char *outName, int32_t idx, char outType) {
     char filename[1024];
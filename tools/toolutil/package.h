@@ -66,6 +66,17 @@ class U_TOOLUTIL_API Package {
         prefixEndsWithType=TRUE;
     }
     void setPrefix(const char *p);
+    /**
+     * Makes writePackage() write a hash index of the item names
+     * for faster lookups at runtime. See UDataTOCHashIndex in ucmndata.h.
+     */
+    void setHashIndex() { doHashIndex=TRUE; }
+    /**
+     * Makes writePackage() replace each item that gets at least 1/8 smaller
+     * with a compressed item. See ucmpdata.h.
+     * readPackage() always decompresses such items.
+     */
+    void setCompressItems() { doCompressItems=TRUE; }
 
     /*
      * Read an existing .dat package file.
@@ -116,6 +127,12 @@ class U_TOOLUTIL_API Package {
     void removeItems(const char *pattern);
     void removeItems(const Package &listPkg);
 
+    /*
+     * Removes all items except the ones that match the list
+     * and the ones that those depend on, directly or indirectly.
+     */
+    void keepItems(const Package &listPkg);
+
     /* The extractItem() functions accept outputType=0 to mean "don't swap the item". */
     void extractItem(const char *filesPath, int32_t itemIndex, char outType);
     void extractItems(const char *filesPath, const char *pattern, char outType);
@@ -147,6 +164,11 @@ class U_TOOLUTIL_API Package {
      */
     static void checkDependency(void *context, const char *itemName, const char *targetName);
 
+    /**
+     * CheckDependency function used by keepItems()
+     */
+    static void keepDependency(void *context, const char *itemName, const char *targetName);
+
     /*
      * Allocate a string in inStrings or outStrings.
      * The length does not include the terminating NUL.
@@ -155,6 +177,9 @@ class U_TOOLUTIL_API Package {
 
     void sortItems();
 
+    /* Replace the compressed items read by readPackage() with the original items. */
+    void decompressItems(const char *filename);
+
     // data fields
     char inPkgName[MAX_PKG_NAME_LENGTH];
     char pkgPrefix[MAX_PKG_NAME_LENGTH];
@@ -166,6 +191,8 @@ class U_TOOLUTIL_API Package {
     UBool inIsBigEndian;
     UBool doAutoPrefix;
     UBool prefixEndsWithType;
+    UBool doHashIndex;
+    UBool doCompressItems;
 
     int32_t itemCount;
     int32_t itemMax;
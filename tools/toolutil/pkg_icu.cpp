@@ -151,7 +151,7 @@ readList(const char *filesPath, const char *listname, UBool readContents, Packag
 }
 
 U_CAPI int U_EXPORT2
-writePackageDatFile(const char *outFilename, const char *outComment, const char *sourcePath, const char *addList, Package *pkg, char outType) {
+writePackageDatFile(const char *outFilename, const char *outComment, const char *sourcePath, const char *addList, Package *pkg, char outType, UBool hashIndex, UBool compressItems) {
     LocalPointer<Package> ownedPkg;
     LocalPointer<Package> addListPkg;
 
@@ -171,6 +171,12 @@ writePackageDatFile(const char *outFilename, const char *outComment, const char
         }
     }
 
+    if (hashIndex) {
+        pkg->setHashIndex();
+    }
+    if (compressItems) {
+        pkg->setCompressItems();
+    }
     pkg->writePackage(outFilename, outType, outComment);
     return 0;
 }
@@ -17,7 +17,7 @@
 U_CAPI int U_EXPORT2
 writePackageDatFile(const char *outFilename, const char *outComment,
                     const char *sourcePath, const char *addList, icu::Package *pkg,
-                    char outType);
+                    char outType, UBool hashIndex, UBool compressItems);
 
 U_CAPI icu::Package * U_EXPORT2
 readList(const char *filesPath, const char *listname, UBool readContents, icu::Package *listPkgIn);
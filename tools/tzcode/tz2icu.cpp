@@ -895,6 +895,8 @@ struct FinalRule {
         return part[0].isset && part[1].isset;
     }
 
+    void getData(int32_t data[11]) const;
+
     void print(ostream& os) const;
 };
 
@@ -1186,6 +1188,147 @@ ostream& printStringList( ostream& os, const ZoneMap& zoneinfo) {
   return os;
 }
 
+//--------------------------------------------------------------------
+// Binary output
+//--------------------------------------------------------------------
+
+// SEE olsontz.h FOR THE zoneinfo64.tzb DATA LAYOUT
+
+// Indexes, as OLSONTZB_IX_... in olsontz.h
+enum {
+    TZB_IX_INDEXES_LENGTH,
+    TZB_IX_ZONE_COUNT,
+    TZB_IX_NAMES_OFFSET,
+    TZB_IX_ZONES_OFFSET,
+    TZB_IX_VERSION_OFFSET,
+    TZB_IX_TOTAL_SIZE,
+    TZB_IX_COUNT = 8
+};
+
+// Size of OlsonZoneRecord in olsontz.h
+const int32_t TZB_ZONE_RECORD_SIZE = 64;
+
+void appendBytes(vector<char>& buf, const void* p, size_t length) {
+    const char* bytes = static_cast<const char*>(p);
+    buf.insert(buf.end(), bytes, bytes + length);
+}
+
+void appendInt32(vector<char>& buf, int32_t value) {
+    appendBytes(buf, &value, sizeof(value));
+}
+
+void padTo8(vector<char>& buf) {
+    while (buf.size() % 8 != 0) {
+        buf.push_back(0);
+    }
+}
+
+void setInt32(vector<char>& buf, size_t offset, int32_t value) {
+    memcpy(&buf[offset], &value, sizeof(value));
+}
+
+/**
+ * Write the zone data as zoneinfo64.tzb, an ICU data file in the byte
+ * order of this platform, so that the zones need not be parsed from
+ * the resource bundle at runtime.
+ */
+bool writeBinary(const string& filename, const ZoneMap& zoneinfo, const string& version) {
+    int32_t zoneCount = (int32_t)zoneinfo.size();
+    vector<char> buf;
+    buf.resize(TZB_IX_COUNT * 4, 0);
+
+    // Name and record offsets, filled in below
+    size_t namesOffset = buf.size();
+    buf.resize(buf.size() + zoneCount * 4, 0);
+    size_t zonesOffset = buf.size();
+    buf.resize(buf.size() + zoneCount * 4, 0);
+
+    size_t versionOffset = buf.size();
+    appendBytes(buf, version.c_str(), version.length() + 1);
+
+    int32_t n = 0;
+    for (ZoneMapIter it = zoneinfo.begin(); it != zoneinfo.end(); ++it, ++n) {
+        setInt32(buf, namesOffset + n * 4, (int32_t)buf.size());
+        appendBytes(buf, it->first.c_str(), it->first.length() + 1);
+    }
+    padTo8(buf);
+
+    vector<int32_t> recordOffsets(zoneCount, -1);
+    n = 0;
+    for (ZoneMapIter it = zoneinfo.begin(); it != zoneinfo.end(); ++it, ++n) {
+        const ZoneInfo& info = it->second;
+        if (info.isAlias()) {
+            continue;
+        }
+        recordOffsets[n] = (int32_t)buf.size();
+        size_t recordStart = buf.size();
+        appendInt32(buf, (int32_t)info.transitions.size());
+        appendInt32(buf, (int32_t)info.types.size());
+        int32_t rule[11] = { 0 };
+        if (info.finalYear != -1) {
+            finalRules[info.finalRuleID].getData(rule);
+            appendInt32(buf, info.finalOffset);
+        } else {
+            appendInt32(buf, 0);
+        }
+        appendInt32(buf, info.finalYear);
+        appendBytes(buf, rule, sizeof(rule));
+        appendInt32(buf, 0); // reserved
+        assert(buf.size() - recordStart == (size_t)TZB_ZONE_RECORD_SIZE);
+
+        vector<Transition>::const_iterator trn;
+        for (trn = info.transitions.begin(); trn != info.transitions.end(); ++trn) {
+            int64_t time = trn->time;
+            appendBytes(buf, &time, sizeof(time));
+        }
+        vector<ZoneType>::const_iterator typ;
+        for (typ = info.types.begin(); typ != info.types.end(); ++typ) {
+            appendInt32(buf, (int32_t)typ->rawoffset);
+            appendInt32(buf, (int32_t)typ->dstoffset);
+        }
+        for (trn = info.transitions.begin(); trn != info.transitions.end(); ++trn) {
+            buf.push_back((char)(uint8_t)trn->type);
+        }
+        padTo8(buf);
+    }
+    n = 0;
+    for (ZoneMapIter it = zoneinfo.begin(); it != zoneinfo.end(); ++it, ++n) {
+        int32_t target = it->second.isAlias() ? it->second.aliasTo : n;
+        if (recordOffsets[target] < 0) {
+            cerr << "Error: Alias to an alias in binary data: " << it->first << endl;
+            return false;
+        }
+        setInt32(buf, zonesOffset + n * 4, recordOffsets[target]);
+    }
+
+    setInt32(buf, TZB_IX_INDEXES_LENGTH * 4, TZB_IX_COUNT);
+    setInt32(buf, TZB_IX_ZONE_COUNT * 4, zoneCount);
+    setInt32(buf, TZB_IX_NAMES_OFFSET * 4, (int32_t)namesOffset);
+    setInt32(buf, TZB_IX_ZONES_OFFSET * 4, (int32_t)zonesOffset);
+    setInt32(buf, TZB_IX_VERSION_OFFSET * 4, (int32_t)versionOffset);
+    setInt32(buf, TZB_IX_TOTAL_SIZE * 4, (int32_t)buf.size());
+
+    // Standard ICU data header: headerSize, magic, then the UDataInfo.
+    char header[32] = { 0 };
+    uint16_t headerSize = (uint16_t)sizeof(header);
+    memcpy(header, &headerSize, 2);
+    header[2] = (char)0xda;
+    header[3] = 0x27;
+    uint16_t infoSize = 20;
+    memcpy(header + 4, &infoSize, 2);
+    header[8] = U_IS_BIG_ENDIAN;
+    header[9] = U_CHARSET_FAMILY;
+    header[10] = U_SIZEOF_UCHAR;
+    memcpy(header + 12, "TzBn", 4); // dataFormat
+    header[16] = 1;                 // formatVersion 1.0.0.0
+
+    ofstream file(filename.c_str(), ios::out | ios::binary);
+    file.write(header, sizeof(header));
+    file.write(&buf[0], buf.size());
+    file.close();
+    return !file.fail();
+}
+
 //--------------------------------------------------------------------
 // main
 //--------------------------------------------------------------------
@@ -1409,21 +1552,35 @@ void mergeFinalZone(const pair<string,FinalZone>& p) {
  * Print this rule in resource bundle format to os.  ID and enclosing
  * braces handled elsewhere.
  */
-void FinalRule::print(ostream& os) const {
-    // First print the rule part that enters DST; then the rule part
+void FinalRule::getData(int32_t data[11]) const {
+    // First the rule part that enters DST; then the rule part
     // that exits it.
     int32_t whichpart = (part[0].offset != 0) ? 0 : 1;
     assert(part[whichpart].offset != 0);
     assert(part[1-whichpart].offset == 0);
 
-    os << "    ";
+    int32_t n = 0;
     for (int32_t i=0; i<2; ++i) {
         const FinalRulePart& p = part[whichpart];
         whichpart = 1-whichpart;
-        os << p.month << ", " << p.stz_dowim() << ", " << p.stz_dow() << ", "
-           << p.time << ", " << p.timemode() << ", ";
+        data[n++] = p.month;
+        data[n++] = p.stz_dowim();
+        data[n++] = p.stz_dow();
+        data[n++] = p.time;
+        data[n++] = p.timemode();
+    }
+    data[n] = part[whichpart].offset;
+}
+
+void FinalRule::print(ostream& os) const {
+    int32_t data[11];
+    getData(data);
+
+    os << "    ";
+    for (int32_t i=0; i<10; ++i) {
+        os << data[i] << ", ";
     }
-    os << part[whichpart].offset << endl;
+    os << data[10] << endl;
 }
 
 #define ICU_ZONE_OVERRIDE_SUFFIX "--ICU"
@@ -1878,5 +2035,14 @@ int main(int argc, char *argv[]) {
         cerr << "Error: Unable to open/write to " << TZ_RESOURCE_NAME << ".txt" << endl;
         return 1;
     }
+
+    if (ICU44PLUS) {
+        if (writeBinary(TZ_RESOURCE_NAME + ".tzb", ZONEINFO, version)) {
+            cout << "Finished writing " << TZ_RESOURCE_NAME << ".tzb" << endl;
+        } else {
+            cerr << "Error: Unable to open/write to " << TZ_RESOURCE_NAME << ".tzb" << endl;
+            return 1;
+        }
+    }
 }
 //eof